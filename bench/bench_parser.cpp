@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "benchmark_instrumentation.hpp"
+#include "core/syrec/program.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+using namespace syrec;
+
+namespace {
+    /*
+     * The shape of the nested expression on the right-hand side of the assignment of the parsed SyReC program. Every shape starts with the same sequence of opening parentheses which
+     * requires the adaptive prediction of the parser to look ahead up to the operation of the matching parenthesis to decide between the number, binary and shift expression alternatives.
+     */
+    enum class NestedExpressionShape : std::uint8_t {
+        LeftNestedBinaryExpression,
+        RightNestedBinaryExpression,
+        LeftNestedShiftExpression,
+        LeftNestedNumberExpression
+    };
+
+    [[nodiscard]] std::string generateNestedExpression(const NestedExpressionShape shape, const std::size_t nestingDepth) {
+        std::string expression;
+        switch (shape) {
+            case NestedExpressionShape::LeftNestedBinaryExpression:
+                expression.append(nestingDepth, '(');
+                expression += "b";
+                for (std::size_t i = 0; i < nestingDepth; ++i) {
+                    expression += " + c)";
+                }
+                break;
+            case NestedExpressionShape::RightNestedBinaryExpression:
+                for (std::size_t i = 0; i < nestingDepth; ++i) {
+                    expression += "(b + ";
+                }
+                expression += "c";
+                expression.append(nestingDepth, ')');
+                break;
+            case NestedExpressionShape::LeftNestedShiftExpression:
+                expression.append(nestingDepth, '(');
+                expression += "b";
+                for (std::size_t i = 0; i < nestingDepth; ++i) {
+                    expression += " << 1)";
+                }
+                break;
+            case NestedExpressionShape::LeftNestedNumberExpression:
+                expression.append(nestingDepth, '(');
+                expression += "1";
+                for (std::size_t i = 0; i < nestingDepth; ++i) {
+                    expression += " + 1)";
+                }
+                break;
+        }
+        return expression;
+    }
+
+    void benchmarkParsingOfNestedExpression(benchmark::State& state, const NestedExpressionShape shape) {
+        const auto        nestingDepth       = static_cast<std::size_t>(state.range(0));
+        const std::string stringifiedProgram = "module main(inout a(16), in b(16), in c(16))\n\ta += " + generateNestedExpression(shape, nestingDepth);
+
+        const benchmarks::PhaseInstrumentation instrumentationOfParsing;
+        for (auto _: state) {
+            Program program;
+            if (const std::string foundErrors = program.readFromString(stringifiedProgram); !foundErrors.empty()) {
+                state.SkipWithError(("Failed to parse SyReC program: " + foundErrors).c_str());
+                return;
+            }
+            benchmark::DoNotOptimize(program);
+        }
+        instrumentationOfParsing.recordCounters(state, "parsing");
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(stringifiedProgram.size()));
+        state.SetComplexityN(state.range(0));
+    }
+
+    [[nodiscard]] bool registerBenchmarksOfParsingOfNestedExpressions() {
+        const auto registerBenchmark = [](const std::string& nameOfShape, const NestedExpressionShape shape) {
+            // The fitted complexity reports whether the parsing time grows super-linearly with the nesting depth of the expression.
+            benchmark::RegisterBenchmark(("BM_ParsingOfNestedExpression/" + nameOfShape).c_str(), benchmarkParsingOfNestedExpression, shape)
+                    ->ArgName("nesting_depth")
+                    ->RangeMultiplier(2)
+                    ->Range(1, 512)
+                    ->Complexity();
+        };
+
+        registerBenchmark("LeftNestedBinaryExpression", NestedExpressionShape::LeftNestedBinaryExpression);
+        registerBenchmark("RightNestedBinaryExpression", NestedExpressionShape::RightNestedBinaryExpression);
+        registerBenchmark("LeftNestedShiftExpression", NestedExpressionShape::LeftNestedShiftExpression);
+        registerBenchmark("LeftNestedNumberExpression", NestedExpressionShape::LeftNestedNumberExpression);
+        return true;
+    }
+
+    [[maybe_unused]] const bool ARE_BENCHMARKS_OF_PARSING_OF_NESTED_EXPRESSIONS_REGISTERED = registerBenchmarksOfParsingOfNestedExpressions();
+} // namespace
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/statistics.hpp"
+#include "benchmark_instrumentation.hpp"
+#include "core/syrec/program.hpp"
+#include "syrec_program_generator.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <optional>
+#include <string>
+
+using namespace syrec;
+
+namespace {
+    /*
+     * The parameter of the generated SyReC program that is varied by a scaling benchmark while all other parameters keep their default value.
+     */
+    enum class ScaledParameter : std::uint8_t {
+        Bitwidth,
+        NumDimensions,
+        NumValuesPerDimension,
+        LoopTripCount,
+        CallDepth,
+        ExpressionDepth
+    };
+
+    [[nodiscard]] benchmarks::SyrecProgramGeneratorParameters determineParametersOfGeneratedProgram(const ScaledParameter scaledParameter, const std::int64_t valueOfScaledParameter) {
+        benchmarks::SyrecProgramGeneratorParameters parameters;
+        const auto                                  value = static_cast<std::size_t>(valueOfScaledParameter);
+        switch (scaledParameter) {
+            case ScaledParameter::Bitwidth:
+                parameters.bitwidth = static_cast<unsigned int>(value);
+                break;
+            case ScaledParameter::NumDimensions:
+                parameters.numDimensions = value;
+                break;
+            case ScaledParameter::NumValuesPerDimension:
+                parameters.numValuesPerDimension = value;
+                break;
+            case ScaledParameter::LoopTripCount:
+                parameters.loopTripCount = value;
+                break;
+            case ScaledParameter::CallDepth:
+                parameters.callDepth = value;
+                break;
+            case ScaledParameter::ExpressionDepth:
+                parameters.expressionDepth = value;
+                break;
+        }
+        return parameters;
+    }
+
+    template<typename Synthesizer>
+    void benchmarkScalingOfSynthesis(benchmark::State& state, const ScaledParameter scaledParameter) {
+        const std::optional<std::string> stringifiedProgram = benchmarks::generateSyrecProgram(determineParametersOfGeneratedProgram(scaledParameter, state.range(0)));
+        if (!stringifiedProgram.has_value()) {
+            state.SkipWithError("Invalid parameters of generated SyReC program");
+            return;
+        }
+
+        Program program;
+        if (const std::string foundErrors = program.readFromString(*stringifiedProgram); !foundErrors.empty()) {
+            state.SkipWithError(("Failed to parse generated SyReC program: " + foundErrors).c_str());
+            return;
+        }
+
+        Statistics                             statistics;
+        const benchmarks::PhaseInstrumentation instrumentationOfSynthesis;
+        for (auto _: state) {
+            AnnotatableQuantumComputation annotatableQuantumComputation;
+            if (!Synthesizer::synthesize(annotatableQuantumComputation, program, ConfigurableOptions(), &statistics)) {
+                state.SkipWithError("Failed to synthesize generated SyReC program");
+                return;
+            }
+            benchmark::DoNotOptimize(annotatableQuantumComputation);
+        }
+        instrumentationOfSynthesis.recordCounters(state, "synthesis");
+
+        // The peak resident set size is a high-water mark of the whole process, thus the scaling benchmarks should be executed in separate processes (i.e. via the --benchmark_filter option) to determine the memory usage of the synthesis of a single program.
+        state.counters["program_size_in_bytes"]           = static_cast<double>(stringifiedProgram->size());
+        state.counters["num_gates"]                       = static_cast<double>(statistics.numQuantumOperations);
+        state.counters["num_qubits"]                      = static_cast<double>(statistics.numQubits);
+        state.counters["num_ancillary_qubits"]            = static_cast<double>(statistics.numAncillaryQubits);
+        state.counters["peak_resident_set_size_in_bytes"] = static_cast<double>(statistics.peakResidentSetSizeInBytes);
+    }
+
+    template<typename Synthesizer>
+    void registerScalingBenchmarksOfSynthesizer(const std::string& nameOfSynthesizer) {
+        const auto registerScalingBenchmark = [&nameOfSynthesizer](const ScaledParameter scaledParameter, const std::string& nameOfScaledParameter, const std::initializer_list<std::int64_t> valuesOfScaledParameter) {
+            auto* registeredBenchmark = benchmark::RegisterBenchmark(("BM_" + nameOfSynthesizer + "Scaling").c_str(), benchmarkScalingOfSynthesis<Synthesizer>, scaledParameter);
+            registeredBenchmark->ArgName(nameOfScaledParameter)->Unit(benchmark::kMillisecond);
+            for (const std::int64_t valueOfScaledParameter: valuesOfScaledParameter) {
+                registeredBenchmark->Arg(valueOfScaledParameter);
+            }
+        };
+
+        registerScalingBenchmark(ScaledParameter::Bitwidth, "bitwidth", {1, 2, 4, 8, 16, 32});
+        registerScalingBenchmark(ScaledParameter::NumDimensions, "num_dimensions", {1, 2, 3, 4});
+        registerScalingBenchmark(ScaledParameter::NumValuesPerDimension, "num_values_per_dimension", {1, 4, 16, 64, 256});
+        registerScalingBenchmark(ScaledParameter::LoopTripCount, "loop_trip_count", {1, 4, 16, 64, 256});
+        registerScalingBenchmark(ScaledParameter::CallDepth, "call_depth", {0, 1, 2, 4, 8, 16});
+        registerScalingBenchmark(ScaledParameter::ExpressionDepth, "expression_depth", {1, 2, 4, 8, 16, 32});
+    }
+
+    [[nodiscard]] bool registerScalingBenchmarks() {
+        registerScalingBenchmarksOfSynthesizer<CostAwareSynthesis>("CostAwareSynthesis");
+        registerScalingBenchmarksOfSynthesizer<LineAwareSynthesis>("LineAwareSynthesis");
+        return true;
+    }
+
+    [[maybe_unused]] const bool ARE_SCALING_BENCHMARKS_REGISTERED = registerScalingBenchmarks();
+} // namespace
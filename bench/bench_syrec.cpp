@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/simple_simulation.hpp"
+#include "algorithms/simulation/simulation_program.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
+#include "benchmark_circuits.hpp"
+#include "benchmark_instrumentation.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/n_bit_values_container.hpp"
+#include "core/syrec/program.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <random>
+#include <string>
+
+using namespace syrec;
+
+namespace {
+    [[nodiscard]] bool parseProgram(benchmark::State& state, Program& program, const std::string& stringifiedProgram) {
+        if (const std::string foundErrors = program.readFromString(stringifiedProgram); !foundErrors.empty()) {
+            state.SkipWithError(("Failed to parse SyReC program: " + foundErrors).c_str());
+            return false;
+        }
+        return true;
+    }
+
+    void recordPropertiesOfSynthesizedQuantumComputation(benchmark::State& state, const AnnotatableQuantumComputation& annotatableQuantumComputation) {
+        state.counters["num_gates"]       = static_cast<double>(annotatableQuantumComputation.getNops());
+        state.counters["num_qubits"]      = static_cast<double>(annotatableQuantumComputation.getNqubits());
+        state.counters["quantum_cost"]    = static_cast<double>(annotatableQuantumComputation.getQuantumCostForSynthesis());
+        state.counters["transistor_cost"] = static_cast<double>(annotatableQuantumComputation.getTransistorCostForSynthesis());
+    }
+
+    void benchmarkParsing(benchmark::State& state, const std::string& stringifiedProgram) {
+        const benchmarks::PhaseInstrumentation instrumentationOfParsing;
+        for (auto _: state) {
+            Program program;
+            if (!parseProgram(state, program, stringifiedProgram)) {
+                return;
+            }
+            benchmark::DoNotOptimize(program);
+        }
+        instrumentationOfParsing.recordCounters(state, "parsing");
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(stringifiedProgram.size()));
+    }
+
+    template<typename Synthesizer>
+    void benchmarkSynthesis(benchmark::State& state, const std::string& stringifiedProgram) {
+        Program program;
+        if (!parseProgram(state, program, stringifiedProgram)) {
+            return;
+        }
+
+        // The properties of the synthesized quantum computation are determined prior to the measured iterations to not distort the measured runtime.
+        if (AnnotatableQuantumComputation annotatableQuantumComputation; Synthesizer::synthesize(annotatableQuantumComputation, program)) {
+            recordPropertiesOfSynthesizedQuantumComputation(state, annotatableQuantumComputation);
+        } else {
+            state.SkipWithError("Failed to synthesize SyReC program");
+            return;
+        }
+
+        const benchmarks::PhaseInstrumentation instrumentationOfSynthesis;
+        for (auto _: state) {
+            AnnotatableQuantumComputation annotatableQuantumComputation;
+            benchmark::DoNotOptimize(Synthesizer::synthesize(annotatableQuantumComputation, program));
+            benchmark::DoNotOptimize(annotatableQuantumComputation);
+        }
+        instrumentationOfSynthesis.recordCounters(state, "synthesis");
+    }
+
+    [[nodiscard]] NBitValuesContainer generateRandomInputState(const std::size_t numQubits) {
+        std::mt19937_64     randomNumberGenerator(42U);
+        NBitValuesContainer inputState(numQubits);
+        for (std::size_t i = 0; i < numQubits; ++i) {
+            inputState.setUnchecked(i, (randomNumberGenerator() & 1U) != 0U);
+        }
+        return inputState;
+    }
+
+    void benchmarkSimulation(benchmark::State& state, const std::string& stringifiedProgram, const bool useCompiledSimulationProgram) {
+        // The allocations of the preparation of the simulation are reported separately from the ones of the measured simulation itself.
+        const benchmarks::PhaseInstrumentation instrumentationOfPreparation;
+        Program                                program;
+        AnnotatableQuantumComputation          annotatableQuantumComputation;
+        if (!parseProgram(state, program, stringifiedProgram)) {
+            return;
+        }
+        if (!CostAwareSynthesis::synthesize(annotatableQuantumComputation, program)) {
+            state.SkipWithError("Failed to synthesize SyReC program");
+            return;
+        }
+
+        const std::optional<SimulationProgram> simulationProgram = useCompiledSimulationProgram ? SimulationProgram::compile(annotatableQuantumComputation) : std::nullopt;
+        if (useCompiledSimulationProgram && !simulationProgram.has_value()) {
+            state.SkipWithError("Failed to compile synthesized quantum computation into simulation program");
+            return;
+        }
+
+        const NBitValuesContainer inputState = generateRandomInputState(annotatableQuantumComputation.getNqubits());
+        NBitValuesContainer       outputState(annotatableQuantumComputation.getNqubits());
+        instrumentationOfPreparation.recordCounters(state, "preparation", false);
+
+        const benchmarks::PhaseInstrumentation instrumentationOfSimulation;
+        for (auto _: state) {
+            if (simulationProgram.has_value()) {
+                simpleSimulation(outputState, *simulationProgram, inputState);
+            } else {
+                simpleSimulation(outputState, annotatableQuantumComputation, inputState);
+            }
+            benchmark::DoNotOptimize(outputState);
+        }
+        instrumentationOfSimulation.recordCounters(state, "simulation");
+        state.counters["num_gates"]        = static_cast<double>(annotatableQuantumComputation.getNops());
+        state.counters["gates_per_second"] = benchmark::Counter(static_cast<double>(annotatableQuantumComputation.getNops()), benchmark::Counter::kIsIterationInvariantRate);
+    }
+
+    [[nodiscard]] bool registerBenchmarksOfSyrecPrograms() {
+        for (const std::filesystem::path& syrecProgramFile: benchmarks::determineCircuitFilesWithExtension(".src")) {
+            const std::optional<std::string> stringifiedProgram = benchmarks::readFileContent(syrecProgramFile);
+            if (!stringifiedProgram.has_value()) {
+                continue;
+            }
+
+            const std::string circuitName = syrecProgramFile.stem().string();
+            benchmark::RegisterBenchmark(("BM_Parsing/" + circuitName).c_str(), benchmarkParsing, *stringifiedProgram);
+            benchmark::RegisterBenchmark(("BM_CostAwareSynthesis/" + circuitName).c_str(), benchmarkSynthesis<CostAwareSynthesis>, *stringifiedProgram);
+            benchmark::RegisterBenchmark(("BM_LineAwareSynthesis/" + circuitName).c_str(), benchmarkSynthesis<LineAwareSynthesis>, *stringifiedProgram);
+            benchmark::RegisterBenchmark(("BM_SimpleSimulation/" + circuitName).c_str(), benchmarkSimulation, *stringifiedProgram, false);
+            benchmark::RegisterBenchmark(("BM_SimpleSimulationOfSimulationProgram/" + circuitName).c_str(), benchmarkSimulation, *stringifiedProgram, true);
+        }
+        return true;
+    }
+
+    // The benchmarks are registered during the static initialization since their number depends on the circuits found in the circuits directory.
+    [[maybe_unused]] const bool ARE_BENCHMARKS_OF_SYREC_PROGRAMS_REGISTERED = registerBenchmarksOfSyrecPrograms();
+} // namespace
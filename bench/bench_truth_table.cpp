@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/optimization/esop_minimization.hpp"
+#include "algorithms/simulation/circuit_to_truthtable.hpp"
+#include "algorithms/synthesis/dd_synthesis.hpp"
+#include "benchmark_circuits.hpp"
+#include "benchmark_instrumentation.hpp"
+#include "core/io/pla_parser.hpp"
+#include "core/truthTable/truth_table.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+
+using namespace syrec;
+
+namespace {
+    // The runtime of the truth table extraction and the ESOP minimization grows exponentially with the number of inputs, thus only the truth tables with at most this number of inputs are benchmarked.
+    constexpr std::size_t MAX_NUM_INPUTS_OF_EXPONENTIAL_BENCHMARKS = 12U;
+
+    [[nodiscard]] bool parseTruthTable(benchmark::State& state, TruthTable& truthTable, const std::string& stringifiedPla) {
+        if (!parsePla(truthTable, stringifiedPla)) {
+            state.SkipWithError("Failed to parse .pla file");
+            return false;
+        }
+        extend(truthTable);
+        return true;
+    }
+
+    void benchmarkPlaParsing(benchmark::State& state, const std::string& stringifiedPla) {
+        const benchmarks::PhaseInstrumentation instrumentationOfParsing;
+        for (auto _: state) {
+            TruthTable truthTable;
+            if (!parseTruthTable(state, truthTable, stringifiedPla)) {
+                return;
+            }
+            benchmark::DoNotOptimize(truthTable);
+        }
+        instrumentationOfParsing.recordCounters(state, "parsing");
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(stringifiedPla.size()));
+    }
+
+    void benchmarkDDSynthesis(benchmark::State& state, const std::string& stringifiedPla, const bool useOnePassSynthesis) {
+        TruthTable truthTable;
+        if (!parseTruthTable(state, truthTable, stringifiedPla)) {
+            return;
+        }
+
+        std::size_t                            numGatesOfSynthesizedQuantumComputation = 0;
+        const benchmarks::PhaseInstrumentation instrumentationOfSynthesis;
+        for (auto _: state) {
+            const std::shared_ptr<qc::QuantumComputation> synthesizedQuantumComputation = useOnePassSynthesis ? DDSynthesizer::synthesizeOnePass(truthTable) : DDSynthesizer::synthesizeCodingTechniques(truthTable);
+            if (synthesizedQuantumComputation == nullptr) {
+                state.SkipWithError("Failed to synthesize truth table");
+                return;
+            }
+            numGatesOfSynthesizedQuantumComputation = synthesizedQuantumComputation->getNops();
+        }
+        instrumentationOfSynthesis.recordCounters(state, "synthesis");
+        state.counters["num_inputs"] = static_cast<double>(truthTable.nInputs());
+        state.counters["num_gates"]  = static_cast<double>(numGatesOfSynthesizedQuantumComputation);
+    }
+
+    void benchmarkTruthTableExtraction(benchmark::State& state, const std::string& stringifiedPla, const bool useClassicalSimulation) {
+        TruthTable truthTable;
+        if (!parseTruthTable(state, truthTable, stringifiedPla)) {
+            return;
+        }
+
+        const std::shared_ptr<qc::QuantumComputation> synthesizedQuantumComputation = DDSynthesizer::synthesizeCodingTechniques(truthTable);
+        if (synthesizedQuantumComputation == nullptr) {
+            state.SkipWithError("Failed to synthesize truth table");
+            return;
+        }
+
+        const benchmarks::PhaseInstrumentation instrumentationOfExtraction;
+        for (auto _: state) {
+            TruthTable extractedTruthTable;
+            benchmark::DoNotOptimize(buildTruthTable(*synthesizedQuantumComputation, extractedTruthTable, TruthTableExtractionSettings{.numThreads = 1U, .useClassicalSimulationForPermutationCircuits = useClassicalSimulation}));
+            benchmark::DoNotOptimize(extractedTruthTable);
+        }
+        instrumentationOfExtraction.recordCounters(state, "extraction");
+        state.counters["num_qubits"] = static_cast<double>(synthesizedQuantumComputation->getNqubits());
+        state.counters["num_gates"]  = static_cast<double>(synthesizedQuantumComputation->getNops());
+    }
+
+    void benchmarkEsopMinimization(benchmark::State& state, const TruthTable::Cube::Set& onSet, const bool minimizeHeuristically = false) {
+        std::size_t                            numCubesOfMinimizedExpression = 0;
+        const benchmarks::PhaseInstrumentation instrumentationOfMinimization;
+        for (auto _: state) {
+            const TruthTable::Cube::Set minimizedExpression = minimizeHeuristically ? minbool::minimizeBooleanHeuristically(onSet) : minbool::minimizeBoolean(onSet);
+            numCubesOfMinimizedExpression                   = minimizedExpression.size();
+        }
+        instrumentationOfMinimization.recordCounters(state, "minimization");
+        state.counters["num_cubes"]           = static_cast<double>(onSet.size());
+        state.counters["num_minimized_cubes"] = static_cast<double>(numCubesOfMinimizedExpression);
+    }
+
+    /*
+     * The on-set of a single output of a truth table consists of the inputs for which the output is set.
+     */
+    [[nodiscard]] TruthTable::Cube::Set determineOnSetOfOutput(const TruthTable& truthTable, const std::size_t output) {
+        TruthTable::Cube::Set onSet;
+        for (const auto& [input, outputs]: truthTable) {
+            if (output < outputs.size() && outputs[output] == true) {
+                onSet.emplace(input);
+            }
+        }
+        return onSet;
+    }
+
+    void benchmarkEsopMinimizationOfRandomFunction(benchmark::State& state, const bool minimizeHeuristically) {
+        const auto   numInputs = static_cast<std::size_t>(state.range(0));
+        std::mt19937 randomNumberGenerator(42U);
+
+        TruthTable::Cube::Set onSet;
+        for (std::uint64_t input = 0; input < (std::uint64_t{1} << numInputs); ++input) {
+            if ((randomNumberGenerator() & 1U) != 0U) {
+                onSet.emplace(TruthTable::Cube::fromInteger(input, numInputs));
+            }
+        }
+        benchmarkEsopMinimization(state, onSet, minimizeHeuristically);
+    }
+
+    [[nodiscard]] bool registerBenchmarksOfTruthTables() {
+        for (const std::filesystem::path& plaFile: benchmarks::determineCircuitFilesWithExtension(".pla")) {
+            const std::optional<std::string> stringifiedPla = benchmarks::readFileContent(plaFile);
+            if (!stringifiedPla.has_value()) {
+                continue;
+            }
+
+            const std::string circuitName = plaFile.stem().string();
+            benchmark::RegisterBenchmark(("BM_PlaParsing/" + circuitName).c_str(), benchmarkPlaParsing, *stringifiedPla);
+            benchmark::RegisterBenchmark(("BM_DDSynthesisCodingTechniques/" + circuitName).c_str(), benchmarkDDSynthesis, *stringifiedPla, false);
+            benchmark::RegisterBenchmark(("BM_DDSynthesisOnePass/" + circuitName).c_str(), benchmarkDDSynthesis, *stringifiedPla, true);
+
+            TruthTable truthTable;
+            if (!parsePla(truthTable, *stringifiedPla) || truthTable.nInputs() > MAX_NUM_INPUTS_OF_EXPONENTIAL_BENCHMARKS) {
+                continue;
+            }
+            extend(truthTable);
+            benchmark::RegisterBenchmark(("BM_BuildTruthTable/" + circuitName).c_str(), benchmarkTruthTableExtraction, *stringifiedPla, false);
+            benchmark::RegisterBenchmark(("BM_BuildTruthTableUsingClassicalSimulation/" + circuitName).c_str(), benchmarkTruthTableExtraction, *stringifiedPla, true);
+            benchmark::RegisterBenchmark(("BM_EsopMinimization/" + circuitName).c_str(), benchmarkEsopMinimization, determineOnSetOfOutput(truthTable, 0U));
+        }
+        benchmark::RegisterBenchmark("BM_EsopMinimizationOfRandomFunction", benchmarkEsopMinimizationOfRandomFunction, false)->DenseRange(4, static_cast<std::int64_t>(MAX_NUM_INPUTS_OF_EXPONENTIAL_BENCHMARKS), 2);
+        benchmark::RegisterBenchmark("BM_HeuristicEsopMinimizationOfRandomFunction", benchmarkEsopMinimizationOfRandomFunction, true)->DenseRange(4, static_cast<std::int64_t>(MAX_NUM_INPUTS_OF_EXPONENTIAL_BENCHMARKS), 2);
+        return true;
+    }
+
+    // The benchmarks are registered during the static initialization since their number depends on the circuits found in the circuits directory.
+    [[maybe_unused]] const bool ARE_BENCHMARKS_OF_TRUTH_TABLES_REGISTERED = registerBenchmarksOfTruthTables();
+} // namespace
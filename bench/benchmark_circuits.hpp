@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace syrec::benchmarks {
+    /**
+     * The directory containing the SyReC programs (.src) and truth tables (.pla) that are shared with the tests.
+     */
+    constexpr std::string_view CIRCUITS_DIRECTORY = MQT_SYREC_BENCHMARK_CIRCUITS_DIR;
+
+    /**
+     * Determine the paths of all circuit files with a given extension in the circuits directory.
+     * @param fileExtension The file extension including the leading dot (i.e. '.src').
+     * @return The paths of the matching files sorted in ascending order.
+     */
+    [[nodiscard]] inline std::vector<std::filesystem::path> determineCircuitFilesWithExtension(const std::string_view& fileExtension) {
+        std::vector<std::filesystem::path> matchingFiles;
+        for (const std::filesystem::directory_entry& directoryEntry: std::filesystem::directory_iterator(std::filesystem::path(CIRCUITS_DIRECTORY))) {
+            if (directoryEntry.is_regular_file() && directoryEntry.path().extension() == fileExtension) {
+                matchingFiles.emplace_back(directoryEntry.path());
+            }
+        }
+        std::ranges::sort(matchingFiles);
+        return matchingFiles;
+    }
+
+    /**
+     * Read the whole content of a file.
+     * @param filePath The path of the file.
+     * @return The content of the file, std::nullopt if the file could not be read.
+     */
+    [[nodiscard]] inline std::optional<std::string> readFileContent(const std::filesystem::path& filePath) {
+        std::ifstream inputFileStream(filePath, std::ios_base::in | std::ios_base::binary);
+        if (!inputFileStream.is_open()) {
+            return std::nullopt;
+        }
+        std::ostringstream fileContentBuffer;
+        fileContentBuffer << inputFileStream.rdbuf();
+        return fileContentBuffer.str();
+    }
+} // namespace syrec::benchmarks
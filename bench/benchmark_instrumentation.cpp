@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "benchmark_instrumentation.hpp"
+
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#if defined(MQT_SYREC_BENCHMARK_HARDWARE_COUNTERS) && __linux__
+#include <array>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace syrec::benchmarks;
+
+namespace {
+    std::atomic<std::uint64_t> numAllocationsOfProcess    = 0;
+    std::atomic<std::uint64_t> numAllocatedBytesOfProcess = 0;
+
+    // The replaced global operator new forwards to malloc and only counts successful allocations, the behaviour on failure matches the one of the default implementation.
+    void* allocateAndCount(const std::size_t numBytes) {
+        while (true) {
+            // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+            if (void* allocatedMemory = std::malloc(numBytes == 0 ? 1 : numBytes); allocatedMemory != nullptr) {
+                numAllocationsOfProcess.fetch_add(1, std::memory_order_relaxed);
+                numAllocatedBytesOfProcess.fetch_add(numBytes, std::memory_order_relaxed);
+                return allocatedMemory;
+            }
+            const std::new_handler newHandler = std::get_new_handler();
+            if (newHandler == nullptr) {
+                throw std::bad_alloc();
+            }
+            newHandler();
+        }
+    }
+
+    void* allocateAndCountWithoutThrowing(const std::size_t numBytes) noexcept {
+        try {
+            return allocateAndCount(numBytes);
+        } catch (...) {
+            return nullptr;
+        }
+    }
+
+    void deallocate(void* memory) noexcept {
+        // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+        std::free(memory);
+    }
+
+#if defined(MQT_SYREC_BENCHMARK_HARDWARE_COUNTERS) && __linux__
+    /*
+     * A group of hardware counters of the owning thread which are read atomically, the counters are not available if any of them could not be opened.
+     */
+    class PerfEventGroup {
+    public:
+        PerfEventGroup() {
+            constexpr std::array<std::uint64_t, NAMES_OF_HARDWARE_COUNTERS.size()> COUNTED_EVENTS = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+            for (std::size_t i = 0; i < COUNTED_EVENTS.size(); ++i) {
+                perf_event_attr eventAttributes{};
+                eventAttributes.type           = PERF_TYPE_HARDWARE;
+                eventAttributes.size           = sizeof(perf_event_attr);
+                eventAttributes.config         = COUNTED_EVENTS[i];
+                eventAttributes.disabled       = i == 0 ? 1U : 0U;
+                eventAttributes.exclude_kernel = 1U;
+                eventAttributes.exclude_hv     = 1U;
+                eventAttributes.read_format    = PERF_FORMAT_GROUP;
+
+                const int groupLeaderFileDescriptor = i == 0 ? -1 : fileDescriptors.front();
+                fileDescriptors[i]                  = static_cast<int>(syscall(SYS_perf_event_open, &eventAttributes, 0, -1, groupLeaderFileDescriptor, 0));
+                if (fileDescriptors[i] < 0) {
+                    closeFileDescriptors();
+                    return;
+                }
+            }
+            ioctl(fileDescriptors.front(), PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(fileDescriptors.front(), PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+
+        ~PerfEventGroup() {
+            closeFileDescriptors();
+        }
+
+        PerfEventGroup(const PerfEventGroup&)            = delete;
+        PerfEventGroup& operator=(const PerfEventGroup&) = delete;
+        PerfEventGroup(PerfEventGroup&&)                 = delete;
+        PerfEventGroup& operator=(PerfEventGroup&&)      = delete;
+
+        [[nodiscard]] std::optional<HardwareCounterValues> read() const {
+            if (fileDescriptors.front() < 0) {
+                return std::nullopt;
+            }
+            // The layout of the values of a group read with the PERF_FORMAT_GROUP format (see the man page of perf_event_open).
+            struct {
+                std::uint64_t         numValues;
+                HardwareCounterValues values;
+            } readValues{};
+            if (::read(fileDescriptors.front(), &readValues, sizeof(readValues)) != static_cast<ssize_t>(sizeof(readValues)) || readValues.numValues != readValues.values.size()) {
+                return std::nullopt;
+            }
+            return readValues.values;
+        }
+
+    protected:
+        std::array<int, NAMES_OF_HARDWARE_COUNTERS.size()> fileDescriptors{-1, -1, -1, -1};
+
+        void closeFileDescriptors() {
+            for (int& fileDescriptor: fileDescriptors) {
+                if (fileDescriptor >= 0) {
+                    close(fileDescriptor);
+                    fileDescriptor = -1;
+                }
+            }
+        }
+    };
+#endif
+} // namespace
+
+// The global allocation functions are replaced for the whole benchmark executable. The overloads with an explicit alignment are not replaced, thus allocations of over-aligned types are not counted.
+void* operator new(const std::size_t numBytes) {
+    return allocateAndCount(numBytes);
+}
+
+void* operator new[](const std::size_t numBytes) {
+    return allocateAndCount(numBytes);
+}
+
+void* operator new(const std::size_t numBytes, const std::nothrow_t& /*tag*/) noexcept {
+    return allocateAndCountWithoutThrowing(numBytes);
+}
+
+void* operator new[](const std::size_t numBytes, const std::nothrow_t& /*tag*/) noexcept {
+    return allocateAndCountWithoutThrowing(numBytes);
+}
+
+void operator delete(void* memory) noexcept {
+    deallocate(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+    deallocate(memory);
+}
+
+void operator delete(void* memory, std::size_t /*numBytes*/) noexcept {
+    deallocate(memory);
+}
+
+void operator delete[](void* memory, std::size_t /*numBytes*/) noexcept {
+    deallocate(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t& /*tag*/) noexcept {
+    deallocate(memory);
+}
+
+void operator delete[](void* memory, const std::nothrow_t& /*tag*/) noexcept {
+    deallocate(memory);
+}
+
+InstrumentationSample syrec::benchmarks::sampleInstrumentation() {
+    InstrumentationSample sample;
+    sample.numAllocations    = numAllocationsOfProcess.load(std::memory_order_relaxed);
+    sample.numAllocatedBytes = numAllocatedBytesOfProcess.load(std::memory_order_relaxed);
+#if defined(MQT_SYREC_BENCHMARK_HARDWARE_COUNTERS) && __linux__
+    thread_local const PerfEventGroup perfEventGroupOfThread;
+    sample.hardwareCounterValues = perfEventGroupOfThread.read();
+#endif
+    return sample;
+}
+
+void PhaseInstrumentation::recordCounters(benchmark::State& state, const std::string_view nameOfPhase, const bool averagePerIteration) const {
+    // The end of the phase is sampled prior to the creation of the counters to not count the allocations of the latter.
+    const InstrumentationSample     sampleAtEndOfPhase = sampleInstrumentation();
+    const benchmark::Counter::Flags flags              = averagePerIteration ? benchmark::Counter::kAvgIterations : benchmark::Counter::kDefaults;
+    const std::string               prefixOfCounters   = std::string(nameOfPhase) + "_";
+
+    state.counters[prefixOfCounters + "allocations"]     = benchmark::Counter(static_cast<double>(sampleAtEndOfPhase.numAllocations - sampleAtStartOfPhase.numAllocations), flags);
+    state.counters[prefixOfCounters + "allocated_bytes"] = benchmark::Counter(static_cast<double>(sampleAtEndOfPhase.numAllocatedBytes - sampleAtStartOfPhase.numAllocatedBytes), flags);
+
+    if (!sampleAtStartOfPhase.hardwareCounterValues.has_value() || !sampleAtEndOfPhase.hardwareCounterValues.has_value()) {
+        return;
+    }
+    for (std::size_t i = 0; i < NAMES_OF_HARDWARE_COUNTERS.size(); ++i) {
+        state.counters[prefixOfCounters + std::string(NAMES_OF_HARDWARE_COUNTERS[i])] = benchmark::Counter(static_cast<double>(sampleAtEndOfPhase.hardwareCounterValues->at(i) - sampleAtStartOfPhase.hardwareCounterValues->at(i)), flags);
+    }
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include <array>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace syrec::benchmarks {
+    /**
+     * The hardware events counted via the perf_event interface of the Linux kernel, with their names used as the suffix of the reported benchmark counters.
+     */
+    constexpr std::array<std::string_view, 4> NAMES_OF_HARDWARE_COUNTERS = {"cycles", "instructions", "cache_misses", "branch_misses"};
+
+    using HardwareCounterValues = std::array<std::uint64_t, NAMES_OF_HARDWARE_COUNTERS.size()>;
+
+    /**
+     * The number of allocations and allocated bytes of the whole process (i.e. of all threads) via the replaced global operator new, together with the hardware events of the calling thread at a point in time.
+     */
+    struct InstrumentationSample {
+        std::uint64_t                        numAllocations    = 0;
+        std::uint64_t                        numAllocatedBytes = 0;
+        std::optional<HardwareCounterValues> hardwareCounterValues;
+    };
+
+    /**
+     * @brief Sample the allocation counters and hardware events.
+     *
+     * The hardware events are only available if the benchmarks were built with the MQT_SYREC_BENCHMARK_HARDWARE_COUNTERS option on Linux and the kernel permits the calling thread to open the performance counters (see /proc/sys/kernel/perf_event_paranoid).
+     * The counters of a thread are opened on its first sample and only count the events of said thread in user space, thus the events of the worker threads of a parallel computation are not included.
+     */
+    [[nodiscard]] InstrumentationSample sampleInstrumentation();
+
+    /**
+     * @brief Measure the allocations and hardware events of a phase of a benchmark, starting the measurement on construction.
+     *
+     * The difference to the start of the measurement is reported as benchmark counters prefixed with the name of the phase (i.e. synthesis_allocations, synthesis_allocated_bytes, synthesis_cycles), thus they are reported next to the timings of the benchmark.
+     */
+    class PhaseInstrumentation {
+    public:
+        PhaseInstrumentation():
+            sampleAtStartOfPhase(sampleInstrumentation()) {}
+
+        /**
+         * @brief Record the allocations and hardware events since the start of the phase as counters of the benchmark.
+         * @param state The state of the benchmark whose counters are extended.
+         * @param nameOfPhase The name of the phase used as the prefix of the counters.
+         * @param averagePerIteration Whether the phase spanned the measured iterations of the benchmark and the counters should thus be reported per iteration.
+         */
+        void recordCounters(benchmark::State& state, std::string_view nameOfPhase, bool averagePerIteration = true) const;
+
+    protected:
+        InstrumentationSample sampleAtStartOfPhase;
+    };
+} // namespace syrec::benchmarks
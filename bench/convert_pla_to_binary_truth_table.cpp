@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/io/pla_parser.hpp"
+#include "core/truthTable/truth_table.hpp"
+
+#include <cstddef>
+#include <iostream>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace {
+    void printUsage(const std::string_view& nameOfExecutable) {
+        std::cerr << "Usage: " << nameOfExecutable << " <input .pla file> <output file>\n"
+                  << "Reads and extends the truth table of the .pla file and writes it in the binary truth table format that can be memory-mapped via TruthTable::mapFile.\n";
+    }
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const std::span<char*> arguments(argv, static_cast<std::size_t>(argc));
+    if (arguments.size() != 3U) {
+        printUsage(arguments.empty() ? "convert-pla" : arguments.front());
+        return 1;
+    }
+
+    syrec::TruthTable tt;
+    if (!syrec::readPla(tt, arguments[1])) {
+        return 1;
+    }
+    if (!tt.save(arguments[2])) {
+        std::cerr << "Cannot write the binary truth table to " << arguments[2] << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "syrec_program_generator.hpp"
+
+#include <charconv>
+#include <cstddef>
+#include <iostream>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+namespace {
+    [[nodiscard]] std::optional<std::size_t> tryParseValueOfOption(const std::string_view& argument, const std::string_view& optionPrefix) {
+        if (!argument.starts_with(optionPrefix)) {
+            return std::nullopt;
+        }
+
+        const std::string_view stringifiedValue = argument.substr(optionPrefix.size());
+        std::size_t            value            = 0;
+        if (const auto [endOfParsedValue, errorCode] = std::from_chars(stringifiedValue.data(), stringifiedValue.data() + stringifiedValue.size(), value); errorCode != std::errc() || endOfParsedValue != stringifiedValue.data() + stringifiedValue.size()) {
+            return std::nullopt;
+        }
+        return value;
+    }
+
+    void printUsage(const std::string_view& nameOfExecutable) {
+        std::cerr << "Usage: " << nameOfExecutable << " [--bitwidth=<n>] [--num_dimensions=<n>] [--num_values_per_dimension=<n>] [--loop_trip_count=<n>] [--call_depth=<n>] [--expression_depth=<n>]\n"
+                  << "Writes a generated SyReC program to the standard output, unspecified parameters keep their default value.\n";
+    }
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const std::span<char*> arguments(argv, static_cast<std::size_t>(argc));
+
+    syrec::benchmarks::SyrecProgramGeneratorParameters parameters;
+    for (const char* argument: arguments.subspan(1)) {
+        if (const std::optional<std::size_t> value = tryParseValueOfOption(argument, "--bitwidth="); value.has_value()) {
+            parameters.bitwidth = static_cast<unsigned int>(*value);
+        } else if (const std::optional<std::size_t> value = tryParseValueOfOption(argument, "--num_dimensions="); value.has_value()) {
+            parameters.numDimensions = *value;
+        } else if (const std::optional<std::size_t> value = tryParseValueOfOption(argument, "--num_values_per_dimension="); value.has_value()) {
+            parameters.numValuesPerDimension = *value;
+        } else if (const std::optional<std::size_t> value = tryParseValueOfOption(argument, "--loop_trip_count="); value.has_value()) {
+            parameters.loopTripCount = *value;
+        } else if (const std::optional<std::size_t> value = tryParseValueOfOption(argument, "--call_depth="); value.has_value()) {
+            parameters.callDepth = *value;
+        } else if (const std::optional<std::size_t> value = tryParseValueOfOption(argument, "--expression_depth="); value.has_value()) {
+            parameters.expressionDepth = *value;
+        } else {
+            std::cerr << "Unknown or malformed option " << argument << "\n";
+            printUsage(arguments.front());
+            return 1;
+        }
+    }
+
+    const std::optional<std::string> stringifiedProgram = syrec::benchmarks::generateSyrecProgram(parameters);
+    if (!stringifiedProgram.has_value()) {
+        std::cerr << "The bitwidth must be in the range [1, 32] while the number of dimensions, values per dimension and loop iterations must be larger than zero\n";
+        return 1;
+    }
+    std::cout << *stringifiedProgram;
+    return 0;
+}
@@ -0,0 +1,120 @@
+# Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+# Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+# All rights reserved.
+#
+# SPDX-License-Identifier: MIT
+#
+# Licensed under the MIT License
+
+"""Create a scaling report from the results of the scaling benchmarks of the mqt-syrec-bench target.
+
+The results are expected to be stored in the JSON format of Google Benchmark, i.e. generated via:
+
+    mqt-syrec-bench --benchmark_filter=Scaling --benchmark_out=scaling.json --benchmark_out_format=json
+
+The report lists the synthesis time, the peak resident set size, the number of gates and the number of qubits per
+synthesizer and scaled parameter of the generated SyReC programs as markdown tables. If matplotlib is available, the
+same metrics can additionally be plotted against the scaled parameters.
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import re
+from collections import defaultdict
+from pathlib import Path
+
+BENCHMARK_NAME_PATTERN = re.compile(r"^BM_(?P<synthesizer>\w+)Scaling/(?P<parameter>\w+):(?P<value>\d+)$")
+REPORTED_METRICS = {
+    "real_time": "synthesis time [ms]",
+    "peak_resident_set_size_in_bytes": "peak RSS [MiB]",
+    "num_gates": "gates",
+    "num_qubits": "qubits",
+}
+
+ScalingResults = dict[str, dict[str, list[tuple[int, dict[str, float]]]]]
+
+
+def load_scaling_results(result_files: list[Path]) -> ScalingResults:
+    """Group the measured metrics of the scaling benchmarks by synthesizer and scaled parameter."""
+    results: ScalingResults = defaultdict(lambda: defaultdict(list))
+    for result_file in result_files:
+        for benchmark in json.loads(result_file.read_text(encoding="utf-8"))["benchmarks"]:
+            match = BENCHMARK_NAME_PATTERN.match(benchmark["name"])
+            if match is None or benchmark.get("error_occurred", False) or benchmark.get("run_type") == "aggregate":
+                continue
+
+            metrics = {metric: float(benchmark.get(metric, 0.0)) for metric in REPORTED_METRICS}
+            metrics["peak_resident_set_size_in_bytes"] /= 1024.0 * 1024.0
+            results[match["synthesizer"]][match["parameter"]].append((int(match["value"]), metrics))
+
+    for results_per_parameter in results.values():
+        for measurements in results_per_parameter.values():
+            measurements.sort(key=lambda measurement: measurement[0])
+    return results
+
+
+def create_markdown_report(results: ScalingResults) -> str:
+    """Stringify the scaling results as one markdown table per synthesizer and scaled parameter."""
+    lines: list[str] = []
+    for synthesizer, results_per_parameter in sorted(results.items()):
+        for parameter, measurements in sorted(results_per_parameter.items()):
+            lines.extend((
+                f"## {synthesizer}: {parameter}",
+                "",
+                "| " + " | ".join([parameter, *REPORTED_METRICS.values()]) + " |",
+                "|" + "---|" * (len(REPORTED_METRICS) + 1),
+            ))
+            lines.extend(
+                "| " + " | ".join([str(value), *(f"{metrics[metric]:.6g}" for metric in REPORTED_METRICS)]) + " |"
+                for value, metrics in measurements
+            )
+            lines.append("")
+    return "\n".join(lines)
+
+
+def plot_scaling_results(results: ScalingResults, output_directory: Path) -> None:
+    """Plot every reported metric against every scaled parameter with one line per synthesizer."""
+    import matplotlib.pyplot as plt  # noqa: PLC0415 because plotting is optional
+
+    output_directory.mkdir(parents=True, exist_ok=True)
+    parameters = sorted({
+        parameter for results_per_parameter in results.values() for parameter in results_per_parameter
+    })
+    for parameter in parameters:
+        figure, axes = plt.subplots(1, len(REPORTED_METRICS), figsize=(5 * len(REPORTED_METRICS), 4))
+        for axis, (metric, label) in zip(axes, REPORTED_METRICS.items(), strict=True):
+            for synthesizer, results_per_parameter in sorted(results.items()):
+                measurements = results_per_parameter.get(parameter, [])
+                axis.plot(
+                    [value for value, _ in measurements],
+                    [metrics[metric] for _, metrics in measurements],
+                    marker="o",
+                    label=synthesizer,
+                )
+            axis.set_xlabel(parameter)
+            axis.set_ylabel(label)
+            axis.legend()
+        figure.tight_layout()
+        figure.savefig(output_directory / f"{parameter}.png")
+        plt.close(figure)
+
+
+def main() -> None:
+    """Create the scaling report from the given benchmark results."""
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("result_files", nargs="+", type=Path, help="JSON files generated by the scaling benchmarks")
+    parser.add_argument(
+        "--plot-directory", type=Path, help="directory in which the plots are stored (requires matplotlib)"
+    )
+    arguments = parser.parse_args()
+
+    results = load_scaling_results(arguments.result_files)
+    print(create_markdown_report(results))  # noqa: T201
+    if arguments.plot_directory is not None:
+        plot_scaling_results(results, arguments.plot_directory)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "syrec_program_generator.hpp"
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+namespace {
+    constexpr unsigned int                    MAX_SUPPORTED_BITWIDTH = 32U;
+    constexpr std::array<std::string_view, 5> BINARY_OPERATIONS      = {"+", "^", "-", "&", "|"};
+    constexpr std::array<std::string_view, 3> PARAMETER_IDENTIFIERS  = {"a", "b", "c"};
+
+    [[nodiscard]] std::string determineModuleIdentifier(const std::size_t callLevel) {
+        return callLevel == 0U ? "main" : "level" + std::to_string(callLevel);
+    }
+
+    [[nodiscard]] std::string stringifyDimensionAccessOfLoopVariables(const std::size_t numDimensions) {
+        std::string stringifiedDimensionAccess;
+        for (std::size_t dimension = 0; dimension < numDimensions; ++dimension) {
+            stringifiedDimensionAccess += "[$i" + std::to_string(dimension) + "]";
+        }
+        return stringifiedDimensionAccess;
+    }
+
+    void writeIndentation(std::ostringstream& outputStream, const std::size_t indentationLevel) {
+        outputStream << std::string(2U * indentationLevel, ' ');
+    }
+
+    void writeModule(std::ostringstream& outputStream, const syrec::benchmarks::SyrecProgramGeneratorParameters& parameters, const std::size_t callLevel) {
+        std::string stringifiedDeclaredDimensions;
+        for (std::size_t dimension = 0; dimension < parameters.numDimensions; ++dimension) {
+            stringifiedDeclaredDimensions += "[" + std::to_string(parameters.numValuesPerDimension) + "]";
+        }
+        const std::string stringifiedDeclaredBitwidth = "(" + std::to_string(parameters.bitwidth) + ")";
+
+        outputStream << "module " << determineModuleIdentifier(callLevel) << "(";
+        for (std::size_t i = 0; i < PARAMETER_IDENTIFIERS.size(); ++i) {
+            outputStream << (i > 0U ? ", " : "") << "inout " << PARAMETER_IDENTIFIERS.at(i) << stringifiedDeclaredDimensions << stringifiedDeclaredBitwidth;
+        }
+        outputStream << ")\n";
+
+        // The end value of the iteration range of a loop is not included in the iteration range, thus a loop only defining an end value n performs n iterations.
+        writeIndentation(outputStream, 1U);
+        outputStream << "for " << parameters.loopTripCount << " do\n";
+        for (std::size_t dimension = 0; dimension < parameters.numDimensions; ++dimension) {
+            writeIndentation(outputStream, 2U + dimension);
+            outputStream << "for $i" << dimension << " = 0 to " << parameters.numValuesPerDimension << " do\n";
+        }
+
+        // The expression is generated as a chain of nested binary expressions alternately using the elements of b and c as the right-hand side operand, i.e. (((b + c) ^ b) - c) for an expression depth of three.
+        const std::string stringifiedDimensionAccess = stringifyDimensionAccessOfLoopVariables(parameters.numDimensions);
+        std::string       stringifiedExpression      = "b" + stringifiedDimensionAccess;
+        for (std::size_t depth = 0; depth < parameters.expressionDepth; ++depth) {
+            stringifiedExpression = "(" + stringifiedExpression + " " + std::string(BINARY_OPERATIONS.at(depth % BINARY_OPERATIONS.size())) + " " + (depth % 2U == 0U ? "c" : "b") + stringifiedDimensionAccess + ")";
+        }
+        writeIndentation(outputStream, 2U + parameters.numDimensions);
+        outputStream << "a" << stringifiedDimensionAccess << " += " << stringifiedExpression << "\n";
+
+        for (std::size_t dimension = parameters.numDimensions; dimension > 0U; --dimension) {
+            writeIndentation(outputStream, 1U + dimension);
+            outputStream << "rof\n";
+        }
+        writeIndentation(outputStream, 1U);
+        outputStream << "rof";
+
+        if (callLevel < parameters.callDepth) {
+            // The parameters are rotated for every call to prevent the called module from only updating the same elements again.
+            outputStream << ";\n";
+            writeIndentation(outputStream, 1U);
+            outputStream << "call " << determineModuleIdentifier(callLevel + 1U) << "(b, c, a)";
+        }
+        outputStream << "\n\n";
+    }
+} // namespace
+
+std::optional<std::string> syrec::benchmarks::generateSyrecProgram(const SyrecProgramGeneratorParameters& parameters) {
+    if (parameters.bitwidth == 0U || parameters.bitwidth > MAX_SUPPORTED_BITWIDTH || parameters.numDimensions == 0U || parameters.numValuesPerDimension == 0U || parameters.loopTripCount == 0U) {
+        return std::nullopt;
+    }
+
+    // A called module must be defined prior to its caller, thus the modules are defined starting from the deepest call level.
+    std::ostringstream stringifiedProgram;
+    for (std::size_t callLevel = parameters.callDepth + 1U; callLevel > 0U; --callLevel) {
+        writeModule(stringifiedProgram, parameters, callLevel - 1U);
+    }
+    return stringifiedProgram.str();
+}
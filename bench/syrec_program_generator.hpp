@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+
+namespace syrec::benchmarks {
+    /**
+     * The parameters of a generated SyReC program.
+     *
+     * The generated program consists of a chain of modules in which every module calls the next one, with the last defined module serving as the main module.
+     * Each module defines the three parameters a, b and c sharing the same dimensions and bitwidth and repeatedly updates every element of a with an expression using the elements of b and c.
+     */
+    struct SyrecProgramGeneratorParameters {
+        /**
+         * The bitwidth of the parameters of every module (must be in the range [1, 32]).
+         */
+        unsigned int bitwidth = 8;
+        /**
+         * The number of dimensions of the parameters of every module.
+         */
+        std::size_t numDimensions = 1;
+        /**
+         * The number of values of every dimension of the parameters of every module.
+         */
+        std::size_t numValuesPerDimension = 4;
+        /**
+         * The number of times every element of the parameter a is updated in a module.
+         */
+        std::size_t loopTripCount = 2;
+        /**
+         * The number of nested calls, i.e. the generated program defines one more module than this value.
+         */
+        std::size_t callDepth = 1;
+        /**
+         * The number of nested binary expressions on the right-hand side of the assignment updating an element of the parameter a.
+         */
+        std::size_t expressionDepth = 2;
+    };
+
+    /**
+     * Generate a stringified SyReC program from the given parameters.
+     * @param parameters The parameters of the generated SyReC program.
+     * @return The stringified SyReC program, std::nullopt if the bitwidth was not in the range [1, 32] or any of the number of dimensions, values per dimension or loop iterations was zero.
+     */
+    [[nodiscard]] std::optional<std::string> generateSyrecProgram(const SyrecProgramGeneratorParameters& parameters);
+} // namespace syrec::benchmarks
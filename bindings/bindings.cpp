@@ -8,33 +8,315 @@
  * Licensed under the MIT License
  */
 
+#include "algorithms/optimization/ancillary_qubit_recycling.hpp"
+#include "algorithms/optimization/line_ordering.hpp"
+#include "algorithms/optimization/loop_optimization.hpp"
+#include "algorithms/optimization/optimization_pass_manager.hpp"
+#include "algorithms/optimization/program_simplification.hpp"
+#include "algorithms/simulation/checkpointed_simulation.hpp"
+#include "algorithms/simulation/differential_verification.hpp"
+#include "algorithms/simulation/equivalence_checking.hpp"
+#include "algorithms/simulation/fault_simulation.hpp"
+#include "algorithms/simulation/program_interpreter.hpp"
+#include "algorithms/simulation/random_stimulus_simulation.hpp"
 #include "algorithms/simulation/simple_simulation.hpp"
+#include "algorithms/simulation/simulation_program.hpp"
+#include "algorithms/simulation/symbolic_simulation.hpp"
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "algorithms/synthesis/clifford_t_lowering.hpp"
+#include "algorithms/synthesis/incremental_synthesis.hpp"
+#include "algorithms/synthesis/resource_estimation.hpp"
+#include "algorithms/synthesis/synthesis_result_cache.hpp"
+#include "algorithms/synthesis/synthesis_sweep.hpp"
 #include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "algorithms/synthesis/syrec_hybrid_synthesis.hpp"
 #include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
 #include "core/annotatable_quantum_computation.hpp"
+#include "core/background_task.hpp"
 #include "core/configurable_options.hpp"
+#include "core/diagnostics.hpp"
+#include "core/frozen_quantum_computation.hpp"
+#include "core/execution_limits.hpp"
+#include "core/io/circuit_writers.hpp"
+#include "core/memory_accounting.hpp"
 #include "core/n_bit_values_container.hpp"
+#include "core/progress_reporting.hpp"
 #include "core/qubit_inlining_stack.hpp"
 #include "core/statistics.hpp"
+#include "core/syrec/incremental_program_reader.hpp"
+#include "core/syrec/ir_node_arena.hpp"
 #include "core/syrec/parser/utils/syrec_operation_utils.hpp"
 #include "core/syrec/program.hpp"
+#include "core/syrec/program_cache.hpp"
+#include "core/syrec/program_serialization.hpp"
+#include "ir/Definitions.hpp"
 #include "ir/QuantumComputation.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <optional>
 #include <pybind11/attr.h>
 #include <pybind11/cast.h>
-#include <pybind11/iostream.h>
+#include <pybind11/functional.h> // NOLINT(misc-include-cleaner)
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/pytypes.h>
 #include <pybind11/stl.h> // NOLINT(misc-include-cleaner)
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 namespace py = pybind11;
 using namespace pybind11::literals;
 using namespace syrec;
 
+namespace {
+    using IntegerStates = py::array_t<std::uint64_t, py::array::c_style | py::array::forcecast>;
+    // Boolean arrays are converted to arrays of bytes storing one bit value per byte.
+    using BitValues = py::array_t<std::uint8_t, py::array::c_style | py::array::forcecast>;
+
+    // The errors reported while the GIL is released cannot be redirected to the python sys.stderr output stream, they are thus collected per call and either stored in the user-provided
+    // diagnostics or written to sys.stderr once the GIL was reacquired. The callable must not access any Python object.
+    template<typename Callable>
+    void callWithoutGil(Diagnostics* optionalDiagnostics, const Callable& callable) {
+        Diagnostics diagnostics;
+        {
+            const py::gil_scoped_release      releasedGil;
+            const ScopedDiagnosticsCollection diagnosticsCollection(optionalDiagnostics != nullptr ? *optionalDiagnostics : diagnostics);
+            callable();
+        }
+        if (diagnostics.hasErrors()) {
+            const py::object standardErrorStream = py::module::import("sys").attr("stderr");
+            for (const std::string& errorMessage: diagnostics.getErrorMessages()) {
+                py::print(errorMessage, "file"_a = standardErrorStream);
+            }
+        }
+    }
+
+    // The states are passed to the simulation as raw pointers into the NumPy arrays since the GIL, which is required to access the Python objects, is released during the simulation.
+    // The optional progress callback, which acquires the GIL when invoked, is rate-limited to avoid contending for the GIL after every simulated block of input states.
+    py::array_t<std::uint64_t> simulateBatchOfIntegerStates(const SimulationProgram& simulationProgram, const std::uint64_t* inputs, const std::size_t numInputs, Statistics* optionalRecordedStatistics, Diagnostics* optionalDiagnostics, const ProgressCallback& progressCallback) {
+        py::array_t<std::uint64_t> outputs(static_cast<py::ssize_t>(numInputs));
+        std::uint64_t*             outputData   = outputs.mutable_data();
+        bool                       simulationOk = false;
+        callWithoutGil(optionalDiagnostics, [&] {
+            ProgressReporter                progressReporter(progressCallback, std::chrono::milliseconds(100));
+            BatchSimulationProgressCallback batchSimulationProgressCallback;
+            if (progressCallback) {
+                batchSimulationProgressCallback = [&progressReporter](const std::size_t numSimulatedInputs, const std::size_t numInputsOfSimulation) {
+                    progressReporter.reportIfDue([&] { return ProgressReport{.numSimulatedPatterns = numSimulatedInputs, .numPatterns = numInputsOfSimulation}; });
+                    return true;
+                };
+            }
+            simulationOk = batchSimulation(std::span(outputData, numInputs), simulationProgram, std::span(inputs, numInputs), optionalRecordedStatistics, batchSimulationProgressCallback);
+            if (simulationOk) {
+                progressReporter.report(ProgressReport{.numSimulatedPatterns = numInputs, .numPatterns = numInputs});
+            }
+        });
+        return simulationOk ? outputs : py::array_t<std::uint64_t>(static_cast<py::ssize_t>(0));
+    }
+
+    // The returned read-only NumPy array references the memory of the vector which is kept alive by the Python object owning the vector.
+    template<typename T>
+    py::array_t<T> exportVectorAsArrayViewOwnedBy(const std::vector<T>& vector, const py::object& owner) {
+        py::array_t<T> arrayView(static_cast<py::ssize_t>(vector.size()), vector.data(), owner);
+        arrayView.attr("setflags")("write"_a = false);
+        return arrayView;
+    }
+
+    // The serialized content of any contiguous buffer (i.e. a bytes object or a memoryview of a multiprocessing.shared_memory.SharedMemory) is deserialized without copying it.
+    template<typename Deserializer>
+    auto deserializeFromBuffer(const py::buffer& buffer, const Deserializer& deserializer) {
+        const py::buffer_info bufferInfo = buffer.request();
+        if (bufferInfo.ndim != 1 || bufferInfo.strides.front() != bufferInfo.itemsize) {
+            throw std::invalid_argument("The serialized content must be stored in a one-dimensional contiguous buffer");
+        }
+        return deserializer(std::string_view(static_cast<const char*>(bufferInfo.ptr), static_cast<std::size_t>(bufferInfo.size * bufferInfo.itemsize)));
+    }
+
+    // Python integers of arbitrary width are converted via their little-endian byte representation which matches the one of the containers.
+    [[nodiscard]] NBitValuesContainer createNBitValuesContainerFromInteger(const std::size_t n, const py::int_& value) {
+        if (value < py::int_(0)) {
+            throw std::invalid_argument("Only non-negative integers can be stored in a container");
+        }
+        const py::int_         bitsOfContainer = value & ((py::int_(1) << py::int_(n)) - py::int_(1));
+        const auto             bytes           = bitsOfContainer.attr("to_bytes")((n + 7U) / 8U, "little").cast<py::bytes>();
+        const std::string_view byteView        = static_cast<std::string_view>(bytes);
+        return NBitValuesContainer::fromBytes(n, std::span(reinterpret_cast<const std::uint8_t*>(byteView.data()), byteView.size())); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+
+    [[nodiscard]] py::bytes exportNBitValuesContainerAsBytes(const NBitValuesContainer& nBitValuesContainer) {
+        std::vector<std::uint8_t> bytes(nBitValuesContainer.getNumBytesOfByteRepresentation(), 0U);
+        nBitValuesContainer.exportBytes(bytes);
+        return {reinterpret_cast<const char*>(bytes.data()), bytes.size()}; // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+
+    [[nodiscard]] std::vector<NBitValuesContainer> createNBitValuesContainersFromBitValues(const BitValues& bitValues) {
+        if (bitValues.ndim() != 2) {
+            throw std::invalid_argument("The bit values must be stored in a two-dimensional array with one row per container");
+        }
+        const auto                       numContainers = static_cast<std::size_t>(bitValues.shape(0));
+        const auto                       numBits       = static_cast<std::size_t>(bitValues.shape(1));
+        const std::uint8_t*              data          = bitValues.data();
+        std::vector<NBitValuesContainer> nBitValuesContainers;
+        nBitValuesContainers.reserve(numContainers);
+        for (std::size_t i = 0; i < numContainers; ++i) {
+            nBitValuesContainers.emplace_back(NBitValuesContainer::fromBitValues(std::span(data + (i * numBits), numBits)));
+        }
+        return nBitValuesContainers;
+    }
+
+    [[nodiscard]] py::array_t<std::uint8_t> exportNBitValuesContainersAsBitValues(const std::vector<NBitValuesContainer>& nBitValuesContainers, const std::size_t numBitsOfEmptyBatch = 0U) {
+        const std::size_t numBits = nBitValuesContainers.empty() ? numBitsOfEmptyBatch : nBitValuesContainers.front().size();
+        if (std::ranges::any_of(nBitValuesContainers, [numBits](const NBitValuesContainer& nBitValuesContainer) { return nBitValuesContainer.size() != numBits; })) {
+            throw std::invalid_argument("All containers must store the same number of bits");
+        }
+
+        py::array_t<std::uint8_t> bitValues({static_cast<py::ssize_t>(nBitValuesContainers.size()), static_cast<py::ssize_t>(numBits)});
+        std::uint8_t*             data = bitValues.mutable_data();
+        for (std::size_t i = 0; i < nBitValuesContainers.size(); ++i) {
+            nBitValuesContainers[i].exportBitValues(std::span(data + (i * numBits), numBits));
+        }
+        return bitValues;
+    }
+
+    [[nodiscard]] std::unique_ptr<Program> deserializeProgramFromBuffer(const py::buffer& serializedProgram, const ConfigurableOptions& settings) {
+        return deserializeFromBuffer(serializedProgram, [&settings](const std::string_view serializedContent) {
+            auto program = std::make_unique<Program>();
+            return deserializeProgram(*program, serializedContent, settings.allocateIrNodesInArena ? std::make_shared<IrNodeArena>() : nullptr) ? std::move(program) : nullptr;
+        });
+    }
+
+    // Every assignment of the non-ancillary qubits is simulated with the ancillary qubits being initialized to zero, the quantum computation itself is assumed to set the initial state of the latter.
+    [[nodiscard]] std::vector<std::uint64_t> determineAllAssignmentsOfNonAncillaryQubits(const qc::QuantumComputation& quantumComputation) {
+        std::vector<std::uint64_t> nonAncillaryQubitMasks;
+        for (std::size_t qubit = 0; qubit < quantumComputation.getNqubits() && qubit < MAX_NUM_QUBITS_OF_INTEGER_BATCH_SIMULATION; ++qubit) {
+            if (!quantumComputation.logicalQubitIsAncillary(static_cast<qc::Qubit>(qubit))) {
+                nonAncillaryQubitMasks.emplace_back(static_cast<std::uint64_t>(1) << qubit);
+            }
+        }
+        if (nonAncillaryQubitMasks.size() >= MAX_NUM_QUBITS_OF_INTEGER_BATCH_SIMULATION) {
+            return {};
+        }
+
+        std::vector<std::uint64_t> assignments(static_cast<std::size_t>(1) << nonAncillaryQubitMasks.size(), 0U);
+        for (std::size_t assignment = 0; assignment < assignments.size(); ++assignment) {
+            for (std::size_t i = 0; i < nonAncillaryQubitMasks.size(); ++i) {
+                assignments[assignment] |= ((assignment >> i) & 1U) != 0U ? nonAncillaryQubitMasks[i] : 0U;
+            }
+        }
+        return assignments;
+    }
+
+    [[nodiscard]] bool synthesizeUsingAlgorithm(AnnotatableQuantumComputation& annotatableQuantumComputation, const Program& program, const SynthesisAlgorithm synthesisAlgorithm, const ConfigurableOptions& settings, Statistics* optionalRecordedStatistics) {
+        switch (synthesisAlgorithm) {
+            case SynthesisAlgorithm::CostAware:
+                return CostAwareSynthesis::synthesize(annotatableQuantumComputation, program, settings, optionalRecordedStatistics);
+            case SynthesisAlgorithm::LineAware:
+                return LineAwareSynthesis::synthesize(annotatableQuantumComputation, program, settings, optionalRecordedStatistics);
+            case SynthesisAlgorithm::Hybrid:
+                return HybridSynthesis::synthesize(annotatableQuantumComputation, program, settings, optionalRecordedStatistics);
+        }
+        return false;
+    }
+
+    // The synthesis of a build task is interrupted via the cancellation token of its settings, which is created if the settings of the task do not define one.
+    ConfigurableOptions defineCancellationTokenIfMissing(ConfigurableOptions settings) {
+        if (!settings.executionLimits.optionalCancellationToken.has_value()) {
+            settings.executionLimits.optionalCancellationToken = CancellationToken();
+        }
+        return settings;
+    }
+
+    // The asynchronous tasks own the inputs and results of their work, with the background task being declared last such that its destructor waits for the termination of the work before the former are destroyed.
+    // The results are only handed out to Python once the work terminated while the partially determined outputs of a simulation are handed out as a view of the already simulated prefix of the outputs.
+    class BuildTask {
+    public:
+        BuildTask(IncrementalProgramReader& programReader, std::string stringifiedProgram, ConfigurableOptions settings, const SynthesisAlgorithm synthesisAlgorithm):
+            stringifiedProgram(std::move(stringifiedProgram)), settings(defineCancellationTokenIfMissing(std::move(settings))), synthesisAlgorithm(synthesisAlgorithm), task([this, &programReader](BackgroundTask& self) { return build(self, programReader); }) {}
+
+        void cancel() {
+            settings.executionLimits.optionalCancellationToken->requestCancellation();
+            task.requestCancellation();
+        }
+
+        std::string                                    stringifiedProgram;
+        ConfigurableOptions                            settings;
+        SynthesisAlgorithm                             synthesisAlgorithm;
+        Program                                        program;
+        std::string                                    parserErrors;
+        std::unique_ptr<AnnotatableQuantumComputation> annotatableQuantumComputation;
+        Statistics                                     statistics;
+        BackgroundTask                                 task;
+
+    private:
+        // The build is performed in two steps (the parsing and the synthesis), the cancellation is checked prior to every step with the synthesis additionally being interrupted via the cancellation token of the settings since the parser cannot be interrupted.
+        bool build(BackgroundTask& self, IncrementalProgramReader& programReader) {
+            self.reportProgress(0U, 2U);
+            parserErrors = programReader.readFromString(program, stringifiedProgram, settings, &statistics);
+            if (!parserErrors.empty() || self.isCancellationRequested()) {
+                return false;
+            }
+
+            self.reportProgress(1U, 2U);
+            auto synthesizedQuantumComputation = std::make_unique<AnnotatableQuantumComputation>(settings.generateQuantumOperationAnnotations);
+            if (!synthesizeUsingAlgorithm(*synthesizedQuantumComputation, program, synthesisAlgorithm, settings, &statistics) || self.isCancellationRequested()) {
+                return false;
+            }
+            annotatableQuantumComputation = std::move(synthesizedQuantumComputation);
+            self.reportProgress(2U, 2U);
+            return true;
+        }
+    };
+
+    class SimulationTask {
+    public:
+        SimulationTask(const qc::QuantumComputation& quantumComputation, std::vector<std::uint64_t> inputs):
+            inputs(std::move(inputs)), outputs(this->inputs.size(), 0U), task([this, &quantumComputation](BackgroundTask& self) { return simulate(self, quantumComputation); }) {}
+
+        void cancel() {
+            task.requestCancellation();
+        }
+
+        std::vector<std::uint64_t> inputs;
+        std::vector<std::uint64_t> outputs;
+        BackgroundTask             task;
+
+    private:
+        bool simulate(BackgroundTask& self, const qc::QuantumComputation& quantumComputation) {
+            self.reportProgress(0U, inputs.size());
+            const std::optional<SimulationProgram> simulationProgram = SimulationProgram::compile(quantumComputation);
+            return simulationProgram.has_value() && batchSimulation(outputs, *simulationProgram, inputs, nullptr, [&self](const std::size_t numSimulatedInputs, const std::size_t numInputs) {
+                       self.reportProgress(numSimulatedInputs, numInputs);
+                       return !self.isCancellationRequested();
+                   });
+        }
+    };
+
+    template<typename Task>
+    void defineInterfaceOfBackgroundTask(py::class_<Task>& taskClass) {
+        taskClass.def_property_readonly("state", [](const Task& task) { return task.task.getState(); }, "Get the state of the task")
+                .def_property_readonly("is_finished", [](const Task& task) { return task.task.isFinished(); }, "Determine whether the work of the task terminated")
+                .def_property_readonly("num_processed_work_items", [](const Task& task) { return task.task.getNumProcessedWorkItems(); }, "Get the number of work items processed so far")
+                .def_property_readonly("num_work_items", [](const Task& task) { return task.task.getNumWorkItems(); }, "Get the total number of work items of the task")
+                .def_property_readonly("error_messages", [](const Task& task) { return task.task.getErrorMessages(); }, "Get the errors reported by the work of the task (only available once the task is finished)")
+                .def("cancel", [](Task& task) { task.cancel(); }, "Request the cancellation of the task which takes effect once the work reaches its next cancellation point")
+                .def(
+                        "wait", [](const Task& task, const std::optional<std::size_t>& optionalTimeoutInMilliseconds) {
+                            const py::gil_scoped_release releasedGil;
+                            return task.task.wait(optionalTimeoutInMilliseconds.has_value() ? std::make_optional(std::chrono::milliseconds(*optionalTimeoutInMilliseconds)) : std::nullopt);
+                        },
+                        "timeout_in_milliseconds"_a = py::none(), "Wait, without holding the GIL, for the termination of the task. Returns whether the task terminated within the optional timeout");
+    }
+} // namespace
+
 PYBIND11_MODULE(MQT_SYREC_MODULE_NAME, m, py::mod_gil_not_used()) { // NOLINT(misc-include-cleaner)
     py::module::import("mqt.core.ir");
     m.doc() = "Python interface for the SyReC programming language for the synthesis of reversible circuits";
@@ -53,26 +335,147 @@ PYBIND11_MODULE(MQT_SYREC_MODULE_NAME, m, py::mod_gil_not_used()) { // NOLINT(mi
     py::class_<AnnotatableQuantumComputation::InlinedQubitInformation>(m, "inlined_qubit_information")
             .def(py::init<>(), "Constructs an empty inlined qubit information container")
             .def_property_readonly("user_declared_qubit_label", [](const AnnotatableQuantumComputation::InlinedQubitInformation& inlinedQubitInfo) { return inlinedQubitInfo.userDeclaredQubitLabel; }, "Get the label of the qubit as defined by the user in the SyReC program")
-            .def_property_readonly("inline_stack", [](const AnnotatableQuantumComputation::InlinedQubitInformation& inlinedQubitInfo) { return inlinedQubitInfo.inlineStack; }, "Get the inline stack associated with the qubit");
+            .def_property_readonly("inline_stack", [](const AnnotatableQuantumComputation::InlinedQubitInformation& inlinedQubitInfo) { return inlinedQubitInfo.inlineStack; }, "Get the inline stack associated with the qubit (whose entries are only created from the module call tree recorded during the synthesis once they are accessed)");
 
     py::enum_<AnnotatableQuantumComputation::QubitLabelType>(m, "qubit_label_type")
             .value("internal", AnnotatableQuantumComputation::QubitLabelType::Internal, "Generate the qubit label using the internal qubit identifier (only available for ancillary qubits and local SyReC module variables)")
             .value("user_declared", AnnotatableQuantumComputation::QubitLabelType::UserDeclared, "Generate the qubit label using the user declared variable identifier (only available for the qubits of the variables of a SyReC program [ancillary qubits are not associated with a variable and thus have no user declared label])")
             .export_values();
 
+    py::class_<AnnotatableQuantumComputation::SynthesisCost>(m, "synthesis_cost")
+            .def(py::init<>(), "Constructs a synthesis cost container with zero quantum and transistor cost")
+            .def_readwrite("quantum_cost", &AnnotatableQuantumComputation::SynthesisCost::quantumCost, "The quantum cost for the synthesis of the quantum operations")
+            .def_readwrite("transistor_cost", &AnnotatableQuantumComputation::SynthesisCost::transistorCost, "The transistor cost for the synthesis of the quantum operations");
+
+    py::class_<AnnotatableQuantumComputation::DepthAnalysis>(m, "depth_analysis")
+            .def_readonly("depth", &AnnotatableQuantumComputation::DepthAnalysis::depth, "The number of layers of the retained quantum operations")
+            .def_readonly("num_quantum_operations_per_qubit", &AnnotatableQuantumComputation::DepthAnalysis::numQuantumOperationsPerQubit, "The number of quantum operations using a qubit as control or target qubit for every qubit")
+            .def_readonly("layer_per_quantum_operation", &AnnotatableQuantumComputation::DepthAnalysis::layerPerQuantumOperation, "The zero-based layer of every retained quantum operation, with the quantum operations of a layer operating on disjoint qubits")
+            .def_readonly("indices_of_quantum_operations_of_critical_path", &AnnotatableQuantumComputation::DepthAnalysis::indicesOfQuantumOperationsOfCriticalPath, "The indices of the quantum operations of a longest sequence of quantum operations in which every quantum operation shares a qubit with its successor")
+            .def_readonly("num_quantum_operations_of_critical_path_per_statement_line_number", &AnnotatableQuantumComputation::DepthAnalysis::numQuantumOperationsOfCriticalPathPerStatementLineNumber, "The number of quantum operations of the critical path per line number of the statement whose synthesis generated them (requires the generation of quantum operation annotations)");
+
+    using QuantumOperationArrays = AnnotatableQuantumComputation::QuantumOperationArrays;
+    py::class_<QuantumOperationArrays>(m, "quantum_operation_arrays")
+            .def_readonly("index_of_first_quantum_operation", &QuantumOperationArrays::indexOfFirstQuantumOperation, "The index of the first exported quantum operation in the quantum computation")
+            .def_property_readonly("op_types", [](const py::object& self) { return exportVectorAsArrayViewOwnedBy(self.cast<const QuantumOperationArrays&>().opTypes, self); }, "The qc::OpType of every quantum operation")
+            .def_property_readonly("target_offsets", [](const py::object& self) { return exportVectorAsArrayViewOwnedBy(self.cast<const QuantumOperationArrays&>().targetOffsets, self); }, "The targets of the i-th quantum operation are stored in target_qubits[target_offsets[i]:target_offsets[i + 1]]")
+            .def_property_readonly("target_qubits", [](const py::object& self) { return exportVectorAsArrayViewOwnedBy(self.cast<const QuantumOperationArrays&>().targetQubits, self); }, "The target qubits of all quantum operations")
+            .def_property_readonly("control_offsets", [](const py::object& self) { return exportVectorAsArrayViewOwnedBy(self.cast<const QuantumOperationArrays&>().controlOffsets, self); }, "The controls of the i-th quantum operation are stored in control_qubits[control_offsets[i]:control_offsets[i + 1]]")
+            .def_property_readonly("control_qubits", [](const py::object& self) { return exportVectorAsArrayViewOwnedBy(self.cast<const QuantumOperationArrays&>().controlQubits, self); }, "The control qubits of all quantum operations")
+            .def_property_readonly("is_control_positive", [](const py::object& self) { return exportVectorAsArrayViewOwnedBy(self.cast<const QuantumOperationArrays&>().isControlPositive, self); }, "Whether the control qubit at the same position in control_qubits is a positive control")
+            .def_property_readonly("annotations_indices", [](const py::object& self) { return exportVectorAsArrayViewOwnedBy(self.cast<const QuantumOperationArrays&>().annotationsIndices, self); }, "The index of the annotations of every quantum operation in distinct_annotations")
+            .def_readonly("distinct_annotations", &QuantumOperationArrays::distinctAnnotations, "The distinct sets of annotations of the quantum operations")
+            .def("__len__", [](const QuantumOperationArrays& quantumOperationArrays) { return quantumOperationArrays.opTypes.size(); });
+
+    using QuantumOperationLayout = AnnotatableQuantumComputation::QuantumOperationLayout;
+    py::class_<QuantumOperationLayout>(m, "quantum_operation_layout")
+            .def_readonly("num_columns", &QuantumOperationLayout::numColumns, "The number of columns of the circuit diagram")
+            .def_property_readonly("column_per_gate", [](const py::object& self) { return exportVectorAsArrayViewOwnedBy(self.cast<const QuantumOperationLayout&>().columnPerGate, self); }, "The zero-based column of every gate exported by export_quantum_operations")
+            .def_property_readonly("min_qubit_per_gate", [](const py::object& self) { return exportVectorAsArrayViewOwnedBy(self.cast<const QuantumOperationLayout&>().minQubitPerGate, self); }, "The smallest qubit operated on by every gate")
+            .def_property_readonly("max_qubit_per_gate", [](const py::object& self) { return exportVectorAsArrayViewOwnedBy(self.cast<const QuantumOperationLayout&>().maxQubitPerGate, self); }, "The largest qubit operated on by every gate")
+            .def_property_readonly("column_offsets", [](const py::object& self) { return exportVectorAsArrayViewOwnedBy(self.cast<const QuantumOperationLayout&>().columnOffsets, self); }, "The gates of the c-th column are stored in gates_ordered_by_column[column_offsets[c]:column_offsets[c + 1]]")
+            .def_property_readonly("gates_ordered_by_column", [](const py::object& self) { return exportVectorAsArrayViewOwnedBy(self.cast<const QuantumOperationLayout&>().gatesOrderedByColumn, self); }, "The indices of the gates ordered by their column")
+            .def("__len__", [](const QuantumOperationLayout& quantumOperationLayout) { return quantumOperationLayout.columnPerGate.size(); });
+
+    py::class_<CircuitWriterSettings>(m, "circuit_writer_settings")
+            .def(py::init<>(), "Constructs the default settings of the writers of a quantum computation in the .real and OpenQASM 3 format, writing neither comments of annotations nor of qubit labels.")
+            .def_readwrite("write_statement_line_numbers", &CircuitWriterSettings::writeStatementLineNumbers, "Write the line number of the statement whose synthesis generated the quantum operations as a comment whenever it changes")
+            .def_readwrite("write_quantum_operation_annotations", &CircuitWriterSettings::writeQuantumOperationAnnotations, "Write all annotations of the quantum operations as a comment whenever they change")
+            .def_readwrite("write_qubit_labels", &CircuitWriterSettings::writeQubitLabels, "Write the user declared (or internal) label of every qubit as a comment in the header");
+
     py::class_<AnnotatableQuantumComputation, qc::QuantumComputation>(m, "annotatable_quantum_computation")
             .def(py::init<>(), "Constructs an annotatable quantum computation")
             .def(py::init<bool>(), "generate_quantum_operation_annotations"_a, "Constructs an annotatable quantum computation while also specifying whether quantum operation annotations can be generated")
             .def("get_qubit_label", &AnnotatableQuantumComputation::getQubitLabel, "qubit"_a, "qubit_label_type"_a, "Get either the internal or user-declared label of a qubit as a stringified SyReC variable access based on its location in the quantum register storing the qubit and, optionally, the layout of the SyReC variable stored in the register.")
+            .def("get_qubit_labels", &AnnotatableQuantumComputation::getQubitLabels, "qubit_label_type"_a, "Get either the internal or user-declared label of every qubit, indexed by the qubit, in a single pass over the quantum registers (None for qubits whose label could not be determined).")
             .def("get_quantum_cost_for_synthesis", &AnnotatableQuantumComputation::getQuantumCostForSynthesis, "Get the quantum cost to synthesis the quantum computation")
             .def("get_transistor_cost_for_synthesis", &AnnotatableQuantumComputation::getTransistorCostForSynthesis, "Get the transistor cost to synthesis the quantum computation")
+            .def("get_synthesis_cost_per_statement_line_number", &AnnotatableQuantumComputation::getSynthesisCostPerStatementLineNumber, "Get the synthesis cost of the quantum operations of the quantum computation per line number of the statement whose synthesis generated them (requires the generation of quantum operation annotations)")
+            .def("analyze_depth", &AnnotatableQuantumComputation::analyzeDepth, "Determine the depth, the number of quantum operations per qubit, the layer of every quantum operation and a critical path of the retained quantum operations")
             .def("get_annotations_of_quantum_operation", &AnnotatableQuantumComputation::getAnnotationsOfQuantumOperation, "quantum_operation_index_in_quantum_operation"_a, "Get the annotations of a specific quantum operation in the quantum computation")
-            .def("get_inlined_qubit_information", &AnnotatableQuantumComputation::getInlinedQubitInformation, "qubit"_a, "Get the inlined information of a qubit");
+            .def("get_statement_line_number_of_quantum_operation", &AnnotatableQuantumComputation::getStatementLineNumberOfQuantumOperation, "quantum_operation_index_in_quantum_operation"_a, "Get the line number of the statement whose synthesis generated a specific quantum operation in the quantum computation (requires the generation of quantum operation annotations)")
+            .def("get_inlined_qubit_information", &AnnotatableQuantumComputation::getInlinedQubitInformation, "qubit"_a, "Get the inlined information of a qubit")
+            .def("write_real", &writeRealFormatToFile, "filename"_a, "settings"_a = CircuitWriterSettings(), "Write the retained quantum operations in the .real format to a file without creating a Python object per quantum operation")
+            .def("write_openqasm3", &writeOpenQasm3ToFile, "filename"_a, "settings"_a = CircuitWriterSettings(), "Write the retained quantum operations in the OpenQASM 3 format to a file without creating a Python object per quantum operation")
+            .def("save", &AnnotatableQuantumComputation::save, "filename"_a, "Save the quantum computation together with the annotations of its quantum operations, the variable layouts of its quantum registers and the inlined information of its qubits in a versioned binary format")
+            .def_static("load", &AnnotatableQuantumComputation::load, "filename"_a, "Load a quantum computation saved in the binary format from a memory-mapped file, returns None if the file does not contain a valid quantum computation")
+            .def("serialize", [](const AnnotatableQuantumComputation& annotatableQuantumComputation) -> std::optional<py::bytes> {
+                std::optional<std::string> serializedQuantumComputation = annotatableQuantumComputation.serialize();
+                return serializedQuantumComputation.has_value() ? std::make_optional(py::bytes(*serializedQuantumComputation)) : std::nullopt; }, "Serialize the quantum computation into the binary format used by save(...), returns None if the quantum computation cannot be serialized")
+            .def_static("deserialize", [](const py::buffer& serializedQuantumComputation) { return deserializeFromBuffer(serializedQuantumComputation, &AnnotatableQuantumComputation::deserialize); }, "serialized_quantum_computation"_a, "Deserialize a quantum computation serialized in the binary format from a bytes-like object (i.e. a memoryview of a shared memory block) without copying it, returns None if the serialized quantum computation is not valid")
+            .def(py::pickle(
+                    [](const AnnotatableQuantumComputation& annotatableQuantumComputation) {
+                        std::optional<std::string> serializedQuantumComputation = annotatableQuantumComputation.serialize();
+                        if (!serializedQuantumComputation.has_value()) {
+                            throw std::runtime_error("The quantum computation cannot be serialized");
+                        }
+                        return py::bytes(*serializedQuantumComputation);
+                    },
+                    [](const py::bytes& serializedQuantumComputation) {
+                        std::unique_ptr<AnnotatableQuantumComputation> annotatableQuantumComputation = deserializeFromBuffer(serializedQuantumComputation, &AnnotatableQuantumComputation::deserialize);
+                        if (annotatableQuantumComputation == nullptr) {
+                            throw std::runtime_error("The pickled quantum computation is not valid");
+                        }
+                        return annotatableQuantumComputation;
+                    }))
+            .def("export_quantum_operations", &AnnotatableQuantumComputation::exportQuantumOperationsAsArrays, "Export the retained quantum operations and their annotations as a struct of NumPy arrays without creating a Python object per quantum operation")
+            .def("determine_layout_of_quantum_operations", &AnnotatableQuantumComputation::determineLayoutOfQuantumOperations, "Determine the column and the spanned qubits of every gate exported by export_quantum_operations in a circuit diagram, with gates whose spans do not overlap sharing a column")
+            .def("determine_nearest_neighbor_cost", &AnnotatableQuantumComputation::determineNearestNeighborCost, "Determine the number of SWAP gates required to move the qubits of every gate onto adjacent lines of a linear nearest neighbor architecture, summed over all gates of the quantum computation")
+            .def("permute_qubits", &AnnotatableQuantumComputation::permuteQubits, "new_index_per_qubit"_a, "Permute the qubits of the quantum computation, with the quantum operations, qubit labels, quantum registers and layouts being updated accordingly. Returns whether the qubits were permuted, the quantum computation is not modified otherwise.")
+            .def("flatten_compound_operations", &AnnotatableQuantumComputation::flattenCompoundOperations, "Replace every (nested) compound operation by the quantum operations it contains, returns the number of replaced compound operations")
+            .def("propagate_constant_qubit_values", &AnnotatableQuantumComputation::propagateConstantQubitValues, "Simplify the quantum operations using the values of the qubits known at their position, with the ancillary qubits being initialized to zero, returns the number of removed or simplified quantum operations")
+            .def("apply_reversible_circuit_templates", &AnnotatableQuantumComputation::applyReversibleCircuitTemplates, "window_size"_a, "time_budget_in_milliseconds"_a = std::nullopt, "Simplify the multi-controlled X gates using reversible circuit templates for pairs of gates with the same target qubit, returns the number of removed quantum operations")
+            .def("cancel_adjacent_self_inverse_quantum_operations", &AnnotatableQuantumComputation::cancelAdjacentSelfInverseQuantumOperations, "Remove pairs of identical self-inverse quantum operations with no other quantum operation accessing any of their qubits in between them, returns the number of removed quantum operations")
+            .def("reorder_quantum_operations_to_reduce_depth", &AnnotatableQuantumComputation::reorderQuantumOperationsToReduceDepth, "Reorder the quantum operations by moving them in front of previous quantum operations they commute with, returns the number of layers by which the depth was reduced")
+            .def("freeze", [](const AnnotatableQuantumComputation& annotatableQuantumComputation) { return std::const_pointer_cast<FrozenQuantumComputation>(annotatableQuantumComputation.freeze()); }, "Create an immutable snapshot of the retained quantum operations, the qubit labels and the synthesis costs that can be analysed and simulated by multiple threads concurrently");
+
+    // The snapshot is exposed as non-const since pybind11 does not support holders of const types, none of its members can however be modified from python.
+    py::class_<FrozenQuantumComputation, std::shared_ptr<FrozenQuantumComputation>>(m, "frozen_quantum_computation")
+            .def_property_readonly("num_qubits", &FrozenQuantumComputation::getNqubits, "Get the number of qubits of the frozen quantum computation")
+            .def_property_readonly("num_ops", &FrozenQuantumComputation::getNops, "Get the number of frozen quantum operations, with a compound operation counting as a single quantum operation")
+            .def_property_readonly("num_gates", &FrozenQuantumComputation::getNumGates, "Get the number of gates of the frozen quantum operations")
+            .def_property_readonly("quantum_operations", [](const FrozenQuantumComputation& frozenQuantumComputation) { return frozenQuantumComputation.getQuantumOperationArrays(); }, "Get a copy of the gates of the frozen quantum operations and their annotations as a struct of NumPy arrays")
+            .def("get_qubit_labels", &FrozenQuantumComputation::getQubitLabels, "qubit_label_type"_a, "Get either the internal or user-declared label of every qubit, indexed by the qubit, resolved when the quantum computation was frozen")
+            .def("get_annotations_of_quantum_operation", [](const FrozenQuantumComputation& frozenQuantumComputation, const std::size_t indexOfQuantumOperationInQuantumComputation) {
+                const FrozenQuantumComputation::QuantumOperationAnnotationsLookup* annotations = frozenQuantumComputation.getAnnotationsOfQuantumOperation(indexOfQuantumOperationInQuantumComputation);
+                return annotations != nullptr ? std::make_optional(*annotations) : std::nullopt; }, "quantum_operation_index_in_quantum_operation"_a, "Get the annotations of a specific frozen quantum operation")
+            .def("get_statement_line_number_of_quantum_operation", &FrozenQuantumComputation::getStatementLineNumberOfQuantumOperation, "quantum_operation_index_in_quantum_operation"_a, "Get the line number of the statement whose synthesis generated a specific frozen quantum operation")
+            .def("get_quantum_cost_for_synthesis", &FrozenQuantumComputation::getQuantumCostForSynthesis, "Get the quantum cost to synthesis the frozen quantum operations")
+            .def("get_transistor_cost_for_synthesis", &FrozenQuantumComputation::getTransistorCostForSynthesis, "Get the transistor cost to synthesis the frozen quantum operations")
+            .def("get_synthesis_cost_per_statement_line_number", &FrozenQuantumComputation::getSynthesisCostPerStatementLineNumber, "Get the synthesis cost of the frozen quantum operations per line number of the statement whose synthesis generated them")
+            .def("analyze_depth", &FrozenQuantumComputation::analyzeDepth, py::call_guard<py::gil_scoped_release>(), "Determine the depth, the number of quantum operations per qubit, the layer of every quantum operation and a critical path of the frozen quantum operations without holding the GIL")
+            .def("determine_layout_of_quantum_operations", &FrozenQuantumComputation::determineLayoutOfQuantumOperations, py::call_guard<py::gil_scoped_release>(), "Determine the column and the spanned qubits of every frozen gate in a circuit diagram without holding the GIL")
+            .def("determine_nearest_neighbor_cost", &FrozenQuantumComputation::determineNearestNeighborCost, py::call_guard<py::gil_scoped_release>(), "Determine the nearest neighbor cost of the frozen gates without holding the GIL");
 
     py::class_<NBitValuesContainer>(m, "n_bit_values_container")
             .def(py::init<>(), "Constructs an empty container of size zero.")
             .def(py::init<std::size_t>(), "n"_a, "Constructs a zero-initialized container of size n.")
             .def(py::init<std::size_t, uint64_t>(), "n"_a, "initialLineValues"_a, "Constructs a container of size n from an integer initialLineValues")
+            .def(py::init(&createNBitValuesContainerFromInteger), "n"_a, "initialLineValues"_a, "Constructs a container of size n from a non-negative integer of arbitrary width whose i-th bit defines the value of the bit at position i, the bits of the integer at positions >= n are ignored")
+            .def_static(
+                    "from_bytes", [](const std::size_t n, const py::buffer& bytes) {
+                        return deserializeFromBuffer(bytes, [n](const std::string_view byteView) { return NBitValuesContainer::fromBytes(n, std::span(reinterpret_cast<const std::uint8_t*>(byteView.data()), byteView.size())); }); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                    },
+                    "n"_a, "bytes"_a, "Constructs a container of size n from the little-endian byte representation of its bits (i.e. the bit at position i is stored in the bit i % 8 of the byte i / 8) stored in a bytes-like object, missing bytes are assumed to be zero")
+            .def_static(
+                    "from_bit_array", [](const BitValues& bitValues) {
+                        if (bitValues.ndim() != 1) {
+                            throw std::invalid_argument("The bit values must be stored in a one-dimensional array");
+                        }
+                        return NBitValuesContainer::fromBitValues(std::span(bitValues.data(), static_cast<std::size_t>(bitValues.size())));
+                    },
+                    "bit_values"_a, "Constructs a container storing one bit per value of a NumPy uint8 or bool array, with every non-zero value being interpreted as TRUE")
+            .def_static("batch_from_bit_array", &createNBitValuesContainersFromBitValues, "bit_values"_a, "Constructs one container per row of a two-dimensional NumPy uint8 or bool array storing one bit value per column")
+            .def_static("batch_to_bit_array", [](const std::vector<NBitValuesContainer>& nBitValuesContainers) { return exportNBitValuesContainersAsBitValues(nBitValuesContainers); }, "n_bit_values_containers"_a, "Export the bits of containers of the same size as a two-dimensional NumPy uint8 array with one row per container and one column per bit")
+            .def("__int__", [](const NBitValuesContainer& nBitValuesContainer) { return py::module_::import("builtins").attr("int").attr("from_bytes")(exportNBitValuesContainerAsBytes(nBitValuesContainer), "little"); }, "Get the integer whose i-th bit stores the value of the bit at position i")
+            .def("to_bytes", &exportNBitValuesContainerAsBytes, "Export the bits in their little-endian byte representation (see from_bytes(...))")
+            .def(
+                    "to_bit_array", [](const NBitValuesContainer& nBitValuesContainer) {
+                        py::array_t<std::uint8_t> bitValues(static_cast<py::ssize_t>(nBitValuesContainer.size()));
+                        nBitValuesContainer.exportBitValues(std::span(bitValues.mutable_data(), nBitValuesContainer.size()));
+                        return bitValues;
+                    },
+                    "Export the bits as a NumPy uint8 array storing the value of the bit at position i at index i")
             .def("__getitem__", [](const NBitValuesContainer& nBitValuesContainer, std::size_t bitIndex) { return nBitValuesContainer[bitIndex]; })
             .def("test", &NBitValuesContainer::test, "n"_a, "Determine the value of the bit at position n")
             .def("set", py::overload_cast<std::size_t>(&NBitValuesContainer::set), "n"_a, "Set the value of the bit at position n to TRUE")                 // NOLINT(misc-include-cleaner)
@@ -87,32 +490,738 @@ PYBIND11_MODULE(MQT_SYREC_MODULE_NAME, m, py::mod_gil_not_used()) { // NOLINT(mi
                     },
                     "Returns a string containing the stringified values of the stored bits.");
 
+    py::class_<SimulationProgram>(m, "simulation_program")
+            .def_static("compile", py::overload_cast<const qc::QuantumComputation&, bool>(&SimulationProgram::compile), "quantum_computation"_a, "fuse_cnot_gates"_a = true, "Compile a quantum computation consisting only of X and SWAP gates into a simulation program, returns None if the quantum computation contained any other gate")
+            .def_static("compile", py::overload_cast<const FrozenQuantumComputation&, bool>(&SimulationProgram::compile), "frozen_quantum_computation"_a, "fuse_cnot_gates"_a = true, "Compile a frozen quantum computation consisting only of X and SWAP gates into a simulation program, returns None if it contained any other gate")
+            .def_property_readonly("num_qubits", &SimulationProgram::getNumQubits, "Get the number of qubits of the compiled quantum computation")
+            .def_property_readonly("num_instructions", &SimulationProgram::getNumInstructions, "Get the number of instructions of the simulation program")
+            .def_property_readonly("num_gates", &SimulationProgram::getNumGates, "Get the number of gates of the compiled quantum computation");
+
+    py::class_<EquivalenceCheckingSettings>(m, "equivalence_checking_settings")
+            .def(py::init<>(), "Constructs the default settings of the simulation-based equivalence check.")
+            .def_readwrite("max_num_primary_inputs_of_exhaustive_check", &EquivalenceCheckingSettings::maxNumPrimaryInputsOfExhaustiveCheck, "The maximum number of primary inputs for which all assignments of the primary inputs are simulated, otherwise only randomly sampled assignments are simulated")
+            .def_readwrite("num_random_samples", &EquivalenceCheckingSettings::numRandomSamples, "The number of randomly sampled assignments of the primary inputs (rounded up to a multiple of 64)")
+            .def_readwrite("seed", &EquivalenceCheckingSettings::seed, "The seed of the random sampling")
+            .def_readwrite("confidence_level", &EquivalenceCheckingSettings::confidenceLevel, "The confidence level of the reported upper bound on the fraction of non-equivalent assignments of a random sampling")
+            .def_readwrite("num_threads", &EquivalenceCheckingSettings::numThreads, "The number of threads among which the assignments are split (a number of threads equal to zero uses one thread per available hardware thread)");
+
+    py::enum_<EquivalenceCheckingResult::Outcome>(m, "equivalence_checking_outcome")
+            .value("equivalent", EquivalenceCheckingResult::Outcome::Equivalent, "All assignments of the primary inputs yield the same primary outputs")
+            .value("probably_equivalent", EquivalenceCheckingResult::Outcome::ProbablyEquivalent, "All randomly sampled assignments of the primary inputs yield the same primary outputs")
+            .value("not_equivalent", EquivalenceCheckingResult::Outcome::NotEquivalent, "An assignment of the primary inputs yields different primary outputs or the numbers of primary inputs or outputs differ")
+            .value("not_supported", EquivalenceCheckingResult::Outcome::NotSupported, "A quantum computation contains a gate that is neither an X nor a SWAP gate")
+            .value("limit_exceeded", EquivalenceCheckingResult::Outcome::LimitExceeded, "The symbolic simulation exceeded its maximum number of nodes before the primary outputs could be compared")
+            .export_values();
+
+    py::class_<EquivalenceCheckingResult>(m, "equivalence_checking_result")
+            .def_readonly("outcome", &EquivalenceCheckingResult::outcome, "The outcome of the equivalence check")
+            .def_readonly("num_checked_assignments", &EquivalenceCheckingResult::numCheckedAssignments, "The number of simulated assignments of the primary inputs")
+            .def_readonly("max_fraction_of_non_equivalent_assignments", &EquivalenceCheckingResult::maxFractionOfNonEquivalentAssignments, "The upper bound on the fraction of assignments of the primary inputs yielding different primary outputs at the configured confidence level (only non-zero if the outcome is probably_equivalent)")
+            .def_readonly("counterexample", &EquivalenceCheckingResult::counterexample, "The values of the primary inputs, ordered by descending qubit index, of an assignment yielding different primary outputs (empty unless the outcome is not_equivalent)");
+
+    py::enum_<SymbolicSimulationSettings::VariableOrder>(m, "symbolic_simulation_variable_order")
+            .value("primary_inputs", SymbolicSimulationSettings::VariableOrder::PrimaryInputs, "Order the variables of the BDDs like the primary inputs, i.e. by descending qubit index")
+            .value("first_use", SymbolicSimulationSettings::VariableOrder::FirstUse, "Order the variables of the BDDs by the first gate of the first quantum computation operating on the associated primary input")
+            .export_values();
+
+    py::class_<SymbolicSimulationSettings>(m, "symbolic_simulation_settings")
+            .def(py::init<>(), "Constructs the default settings of the symbolic simulation-based equivalence check.")
+            .def_readwrite("variable_order", &SymbolicSimulationSettings::variableOrder, "The order of the variables of the BDDs representing the values of the qubits")
+            .def_readwrite("max_num_nodes", &SymbolicSimulationSettings::maxNumNodes, "The maximum number of nodes of the BDDs shared by all qubits of both quantum computations");
+
+    py::class_<StimulusSimulationSettings>(m, "stimulus_simulation_settings")
+            .def(py::init<>(), "Constructs the default settings of the simulation of generated input patterns.")
+            .def_readwrite("num_random_patterns", &StimulusSimulationSettings::numRandomPatterns, "The number of randomly generated input patterns")
+            .def_readwrite("simulate_corner_case_patterns", &StimulusSimulationSettings::simulateCornerCasePatterns, "Whether the all zeros, all ones and walking ones assignments of the data qubits are simulated in addition to the random ones")
+            .def_readwrite("seed", &StimulusSimulationSettings::seed, "The seed of the random input patterns, which do not depend on the number of threads")
+            .def_readwrite("num_threads", &StimulusSimulationSettings::numThreads, "The number of threads among which the input patterns are split (a number of threads equal to zero uses one thread per available hardware thread)");
+
+    py::class_<StimulusSimulationResult>(m, "stimulus_simulation_result")
+            .def(py::init<>(), "Constructs an empty toggle coverage.")
+            .def_readonly("num_simulated_patterns", &StimulusSimulationResult::numSimulatedPatterns, "The number of simulated input patterns")
+            .def_readonly("num_ones_per_qubit", &StimulusSimulationResult::numOnesPerQubit, "The number of simulated input patterns in which the output value of the q-th qubit was one")
+            .def_readonly("num_flips_per_qubit", &StimulusSimulationResult::numFlipsPerQubit, "The number of simulated input patterns in which the output value of the q-th qubit differed from its input value")
+            .def("is_qubit_toggle_covered", &StimulusSimulationResult::isQubitToggleCovered, "qubit"_a, "Determine whether the output value of the qubit was observed to be both zero and one")
+            .def_property_readonly("num_toggle_covered_qubits", &StimulusSimulationResult::getNumToggleCoveredQubits, "Get the number of qubits whose output value was observed to be both zero and one");
+
+    py::enum_<ReversibleCircuitFault::Kind>(m, "reversible_circuit_fault_kind")
+            .value("missing_gate", ReversibleCircuitFault::Kind::MissingGate, "The gate is not applied")
+            .value("repeated_gate", ReversibleCircuitFault::Kind::RepeatedGate, "The gate is applied num_repetitions times")
+            .value("stuck_at_zero", ReversibleCircuitFault::Kind::StuckAtZero, "The value of the qubit is zero at the inputs of the gate (or at the outputs of the circuit if the gate index is equal to the number of gates)")
+            .value("stuck_at_one", ReversibleCircuitFault::Kind::StuckAtOne, "The value of the qubit is one at the inputs of the gate (or at the outputs of the circuit if the gate index is equal to the number of gates)")
+            .export_values();
+
+    py::class_<ReversibleCircuitFault>(m, "reversible_circuit_fault")
+            .def(py::init<>(), "Constructs a missing gate fault of the first gate.")
+            .def_readwrite("kind", &ReversibleCircuitFault::kind, "The kind of the fault")
+            .def_readwrite("gate_index", &ReversibleCircuitFault::gateIndex, "The index of the faulty gate, with the gates of a compound operation being numbered in place of the latter")
+            .def_readwrite("qubit", &ReversibleCircuitFault::qubit, "The qubit of a stuck-at fault")
+            .def_readwrite("num_repetitions", &ReversibleCircuitFault::numRepetitions, "The number of applications of the gate of a repeated gate fault");
+
+    py::enum_<FaultSimulationSettings::Mode>(m, "fault_simulation_mode")
+            .value("parallel_fault", FaultSimulationSettings::Mode::ParallelFault, "Simulate the faulty circuits of up to 64 faults in the lanes of a word for one input pattern at a time")
+            .value("parallel_pattern", FaultSimulationSettings::Mode::ParallelPattern, "Simulate up to 64 input patterns in the lanes of a word for one fault at a time")
+            .export_values();
+
+    py::class_<FaultSimulationSettings>(m, "fault_simulation_settings")
+            .def(py::init<>(), "Constructs the default settings of the fault simulation of a reversible circuit.")
+            .def_readwrite("mode", &FaultSimulationSettings::mode, "The lanes of the simulated words")
+            .def_readwrite("num_threads", &FaultSimulationSettings::numThreads, "The number of threads among which the faults are split (a number of threads equal to zero uses one thread per available hardware thread)");
+
+    py::class_<FaultSimulationResult>(m, "fault_simulation_result")
+            .def(py::init<>(), "Constructs an empty result of a fault simulation.")
+            .def_readonly("detecting_patterns_per_fault", &FaultSimulationResult::detectingPatternsPerFault, "The indices of the input patterns, in ascending order, detecting the i-th simulated fault")
+            .def("is_fault_detected", &FaultSimulationResult::isFaultDetected, "fault_index"_a, "Determine whether the fault was detected by any input pattern")
+            .def_property_readonly("num_detected_faults", &FaultSimulationResult::getNumDetectedFaults, "Get the number of faults detected by any input pattern");
+
+    py::class_<CheckpointedSimulationSettings>(m, "checkpointed_simulation_settings")
+            .def(py::init<>(), "Constructs the default settings of the statement-level checkpointed simulation of a quantum computation.")
+            .def_readwrite("num_statements_per_snapshot", &CheckpointedSimulationSettings::numStatementsPerSnapshot, "The number of simulated statements between two full snapshots of the simulated states (a value of zero only stores the snapshot of the input states)");
+
+    py::class_<CheckpointedSimulation::Statement>(m, "checkpointed_simulation_statement")
+            .def_readonly("statement_line_number", &CheckpointedSimulation::Statement::statementLineNumber, "The line number of the statement, None if its quantum operations have no statement line number")
+            .def_property_readonly("index_of_first_quantum_operation", [](const CheckpointedSimulation::Statement& statement) { return statement.quantumOperations.indexOfFirstQuantumOperation; }, "The index of the first quantum operation of the statement")
+            .def_property_readonly("num_quantum_operations", [](const CheckpointedSimulation::Statement& statement) { return statement.quantumOperations.numQuantumOperations; }, "The number of quantum operations of the statement");
+
+    py::class_<CheckpointedSimulation>(m, "checkpointed_simulation")
+            .def(py::init<>(), "Constructs a simulation recording the state of all qubits after every statement of the SyReC program from which a quantum computation was synthesized.")
+            .def(
+                    "simulate", [](CheckpointedSimulation& simulation, const AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<NBitValuesContainer>& inputs, const CheckpointedSimulationSettings& settings, Statistics* optionalRecordedStatistics, Diagnostics* optionalDiagnostics) {
+                        bool simulationOk = false;
+                        callWithoutGil(optionalDiagnostics, [&] { simulationOk = simulation.simulate(annotatableQuantumComputation, inputs, settings, optionalRecordedStatistics); });
+                        return simulationOk;
+                    },
+                    "annotatable_quantum_computation"_a, "inputs"_a, "settings"_a = CheckpointedSimulationSettings(), "optional_recorded_statistics"_a = nullptr, "optional_diagnostics"_a = nullptr, "Simulate the quantum computation for the input patterns bit-parallel without holding the GIL, recording the differences between the states of successive statements, and reset the position of the simulation to the input states")
+            .def_property_readonly("statements", &CheckpointedSimulation::getStatements, "Get the statements of the simulated quantum computation, every statement being a maximal sequence of quantum operations with the same statement line number")
+            .def_property_readonly("num_inputs", &CheckpointedSimulation::getNumInputs, "Get the number of simulated input patterns")
+            .def_property_readonly("num_simulated_statements", &CheckpointedSimulation::getNumSimulatedStatements, "Get the number of statements whose quantum operations were applied to the current states")
+            .def_property_readonly("num_recorded_differences", &CheckpointedSimulation::getNumRecordedDifferences, "Get the number of recorded differences between the states of successive statements")
+            .def("step_forward", &CheckpointedSimulation::stepForward, "Apply the quantum operations of the next statement to the current states")
+            .def("step_backward", &CheckpointedSimulation::stepBackward, "Revert the quantum operations of the last simulated statement from the current states")
+            .def("seek", &CheckpointedSimulation::seek, "num_statements"_a, "Set the current states to the ones after the given number of simulated statements")
+            .def("get_state", &CheckpointedSimulation::getState, "index_of_input"_a, "Get the current state of the qubits for an input pattern, None if no such input pattern was simulated");
+
+    py::class_<CliffordTLoweringSettings>(m, "clifford_t_lowering_settings")
+            .def(py::init<>(), "Constructs the default settings of the lowering of a quantum computation to the Clifford+T gate set.")
+            .def_readwrite("use_relative_phase_toffoli_gates", &CliffordTLoweringSettings::useRelativePhaseToffoliGates, "Whether the Toffoli gates of the decomposition of a multi-controlled X gate, whose relative phase is cancelled by their uncomputation, are implemented by relative-phase Toffoli gates requiring four instead of seven T gates")
+            .def_readwrite("add_clean_ancillary_qubits", &CliffordTLoweringSettings::addCleanAncillaryQubits, "Whether clean ancillary qubits are added if the qubits known to be zero do not suffice for the decomposition of a multi-controlled gate, otherwise idle qubits are borrowed as dirty ancillary qubits");
+
+    py::class_<DifferentialVerificationSettings>(m, "differential_verification_settings")
+            .def(py::init<>(), "Constructs the default settings of the differential verification of the synthesis of a SyReC program.")
+            .def_readwrite("synthesis_algorithm", &DifferentialVerificationSettings::synthesisAlgorithm, "The synthesizer whose synthesized quantum computation is verified")
+            .def_readwrite("num_stimuli", &DifferentialVerificationSettings::numStimuli, "The number of randomly generated stimuli (rounded up to a multiple of 64)")
+            .def_readwrite("seed", &DifferentialVerificationSettings::seed, "The seed of the stimuli, which do not depend on the number of threads")
+            .def_readwrite("num_threads", &DifferentialVerificationSettings::numThreads, "The number of threads among which the stimuli are split (a number of threads equal to zero uses one thread per available hardware thread)");
+
+    py::class_<DifferentialVerificationMismatch>(m, "differential_verification_mismatch")
+            .def(py::init<>(), "Constructs an empty mismatch.")
+            .def_readonly("index_of_stimulus", &DifferentialVerificationMismatch::indexOfStimulus, "The index of the stimulus in the generated stream of stimuli")
+            .def_readonly("stimulus", &DifferentialVerificationMismatch::stimulus, "The values of the variables of the main module, in the assignment layout of interpret_program, prior to the execution of the program")
+            .def_readonly("expected_values", &DifferentialVerificationMismatch::expectedValues, "The values of the variables of the main module determined by the interpretation of the program")
+            .def_readonly("actual_values", &DifferentialVerificationMismatch::actualValues, "The values of the variables of the main module determined by the simulation of the synthesized quantum computation")
+            .def_readonly("label_of_mismatching_qubit", &DifferentialVerificationMismatch::labelOfMismatchingQubit, "The label of the mismatching qubit with the smallest index")
+            .def_readonly("statement_line_number", &DifferentialVerificationMismatch::statementLineNumber, "The line number of the statement associated with the last quantum operation targeting the mismatching qubit (None if no quantum operation targets said qubit)");
+
+    py::class_<DifferentialVerificationResult>(m, "differential_verification_result")
+            .def(py::init<>(), "Constructs an empty result of a differential verification.")
+            .def_readonly("num_checked_stimuli", &DifferentialVerificationResult::numCheckedStimuli, "The number of checked stimuli up to and including the first mismatching one")
+            .def_readonly("first_mismatch", &DifferentialVerificationResult::firstMismatch, "The first mismatching stimulus in the order of the generated stream of stimuli (None if no mismatch was found)");
+
+    py::class_<ResourceEstimate>(m, "resource_estimate")
+            .def(py::init<>(), "Constructs an empty estimate of the resources of a synthesized quantum computation.")
+            .def_readonly("num_qubits", &ResourceEstimate::numQubits, "The estimated number of qubits of the synthesized quantum computation (including the ancillary qubits)")
+            .def_readonly("num_quantum_operations", &ResourceEstimate::numQuantumOperations, "The estimated number of quantum operations of the synthesized quantum computation")
+            .def_readonly("quantum_cost", &ResourceEstimate::quantumCost, "The estimated quantum cost of the synthesized quantum computation")
+            .def_readonly("transistor_cost", &ResourceEstimate::transistorCost, "The estimated transistor cost of the synthesized quantum computation")
+            .def_readonly("num_statements", &ResourceEstimate::numStatements, "The estimated number of statements synthesized by the synthesizer, including the statements of the bodies of expanded module calls and of every loop iteration");
+
+    py::class_<ProgressReport>(m, "progress_report")
+            .def(py::init<>(), "Constructs an empty report of the progress of a synthesis or simulation.")
+            .def_readonly("num_processed_statements", &ProgressReport::numProcessedStatements, "The number of statements synthesized so far")
+            .def_readonly("estimated_num_statements", &ProgressReport::estimatedNumStatements, "The estimated total number of statements of the synthesis, zero if no estimate is available")
+            .def_readonly("num_emitted_quantum_operations", &ProgressReport::numEmittedQuantumOperations, "The number of quantum operations emitted so far")
+            .def_readonly("estimated_num_quantum_operations", &ProgressReport::estimatedNumQuantumOperations, "The estimated total number of quantum operations emitted by the synthesis, zero if no estimate is available")
+            .def_readonly("num_simulated_patterns", &ProgressReport::numSimulatedPatterns, "The number of input patterns simulated so far")
+            .def_readonly("num_patterns", &ProgressReport::numPatterns, "The total number of input patterns of the simulation")
+            .def_readonly("num_processed_dd_nodes", &ProgressReport::numProcessedDdNodes, "The number of nodes of the decision diagram processed so far by the DD-based synthesis");
+
+    py::class_<AncillaryQubitRecyclingSettings>(m, "ancillary_qubit_recycling_settings")
+            .def(py::init<>(), "Constructs the default settings of the recycling of ancillary qubits.")
+            .def_readwrite("max_num_inputs_of_exhaustive_check", &AncillaryQubitRecyclingSettings::maxNumInputsOfExhaustiveCheck, "The maximum number of non-ancillary qubits whose assignments are all simulated to determine whether an ancillary qubit is restored to zero and to verify the recycled quantum computation, quantum computations with more non-ancillary qubits are not recycled");
+
+    py::class_<LineOrderingSettings>(m, "line_ordering_settings")
+            .def(py::init<>(), "Constructs the default settings of the reordering of the qubits.")
+            .def_readwrite("num_moves_per_qubit", &LineOrderingSettings::numMovesPerQubit, "The number of exchanges of the positions of two qubits evaluated by the simulated annealing per qubit of the quantum computation")
+            .def_readwrite("seed", &LineOrderingSettings::seed, "The seed of the randomly selected moves");
+
+    py::class_<LoopOptimizationSettings>(m, "loop_optimization_settings")
+            .def(py::init<>(), "Constructs the default settings of the loop optimizations, performing all passes.")
+            .def_readwrite("fuse_adjacent_loops", &LoopOptimizationSettings::fuseAdjacentLoops, "Fuse adjacent loops performing the same iterations into a single loop")
+            .def_readwrite("hoist_loop_invariant_expressions", &LoopOptimizationSettings::hoistLoopInvariantExpressions, "Hoist the computation of expressions not depending on the iterations of a loop out of the loop");
+
+    py::class_<LoopOptimizationPassReport>(m, "loop_optimization_pass_report")
+            .def(py::init<>(), "Constructs an empty report of a loop optimization pass.")
+            .def_readonly("num_transformations", &LoopOptimizationPassReport::numTransformations, "The number of fused loops respectively the number of hoisted expressions")
+            .def_readonly("estimated_num_quantum_operations_prior_to_pass", &LoopOptimizationPassReport::estimatedNumQuantumOperationsPriorToPass, "The estimated number of quantum operations synthesized for the program prior to the pass (None if the estimation failed)")
+            .def_readonly("estimated_num_quantum_operations_after_pass", &LoopOptimizationPassReport::estimatedNumQuantumOperationsAfterPass, "The estimated number of quantum operations synthesized for the program after the pass (None if the estimation failed)")
+            .def_property_readonly("estimated_num_removed_quantum_operations", &LoopOptimizationPassReport::getEstimatedNumRemovedQuantumOperations, "The estimated number of quantum operations removed by the pass (None if any of the estimations failed)");
+
+    py::class_<LoopOptimizationReport>(m, "loop_optimization_report")
+            .def(py::init<>(), "Constructs an empty report of the loop optimizations.")
+            .def_readonly("loop_fusion", &LoopOptimizationReport::loopFusion, "The report of the loop fusion pass")
+            .def_readonly("loop_invariant_code_motion", &LoopOptimizationReport::loopInvariantCodeMotion, "The report of the loop invariant code motion pass");
+
+    py::class_<Diagnostics>(m, "diagnostics")
+            .def(py::init<>(), "Constructs an empty container for the errors reported by a synthesis or simulation call.")
+            .def_property_readonly("error_messages", &Diagnostics::getErrorMessages, "Get the reported error messages in the order in which they were reported.")
+            .def_property_readonly("has_errors", &Diagnostics::hasErrors, "Determine whether any error was reported.")
+            .def("clear", &Diagnostics::clear, "Remove all reported error messages.");
+
+    py::class_<OptimizationPassStatistics>(m, "optimization_pass_statistics")
+            .def(py::init<>(), "Constructs an empty container for the statistics of a pass of the optimization pipeline.")
+            .def_readonly("num_applications", &OptimizationPassStatistics::numApplications, "The number of applications of the pass")
+            .def_readonly("num_modifications", &OptimizationPassStatistics::numModifications, "The number of modifications of the quantum computation reported by the pass")
+            .def_readonly("runtime_in_nanoseconds", &OptimizationPassStatistics::runtimeInNanoseconds, "The runtime of the pass in nanoseconds")
+            .def_readonly("num_removed_quantum_operations", &OptimizationPassStatistics::numRemovedQuantumOperations, "The number of quantum operations removed by the pass (negative if the pass added quantum operations)")
+            .def_readonly("num_removed_qubits", &OptimizationPassStatistics::numRemovedQubits, "The number of qubits removed by the pass (negative if the pass added qubits)");
+
+    py::class_<CancellationToken>(m, "cancellation_token")
+            .def(py::init<>(), "Constructs a token via which the cancellation of the synthesis using execution limits referencing the token (or any copy of it) can be requested from any thread.")
+            .def("request_cancellation", &CancellationToken::requestCancellation, "Request the cancellation of all computations using the token, which takes effect once they reach their next check of their execution limits")
+            .def_property_readonly("is_cancellation_requested", &CancellationToken::isCancellationRequested, "Determine whether the cancellation was requested");
+
+    py::class_<ExecutionLimits>(m, "execution_limits")
+            .def(py::init<>(), "Constructs an object without any execution limits.")
+            .def_readwrite("cancellation_token", &ExecutionLimits::optionalCancellationToken, "The optional token via which the cancellation of the computation can be requested")
+            .def_readwrite("time_limit_in_milliseconds", &ExecutionLimits::timeLimitInMilliseconds, "The optional wall-clock time in milliseconds after which the computation is stopped")
+            .def_readwrite("memory_budget_in_mib", &ExecutionLimits::memoryBudgetInMiB, "The optional maximum resident set size of the process in MiB above which the computation is stopped");
+
+    py::enum_<ExecutionLimitViolation>(m, "execution_limit_violation")
+            .value("none", ExecutionLimitViolation::None, "No execution limit was violated")
+            .value("cancelled", ExecutionLimitViolation::Cancelled, "The cancellation of the computation was requested")
+            .value("time_limit_exceeded", ExecutionLimitViolation::TimeLimitExceeded, "The computation exceeded its time limit")
+            .value("memory_budget_exceeded", ExecutionLimitViolation::MemoryBudgetExceeded, "The computation exceeded its memory budget")
+            .export_values();
+
+    py::class_<MemoryUsage>(m, "memory_usage")
+            .def(py::init<>(), "Constructs an empty container for the memory held by the data structures of a processing step.")
+            .def_readonly("num_bytes_of_program", &MemoryUsage::numBytesOfProgram, "The estimated number of bytes held by the IR of the parsed SyReC program")
+            .def_readonly("num_bytes_of_symbol_tables", &MemoryUsage::numBytesOfSymbolTables, "The estimated number of bytes held by the symbol tables of the parser at the end of the semantic checks")
+            .def_readonly("num_bytes_of_quantum_operations", &MemoryUsage::numBytesOfQuantumOperations, "The estimated number of bytes held by the quantum operations of the synthesized quantum computation")
+            .def_readonly("num_bytes_of_quantum_operation_annotations", &MemoryUsage::numBytesOfQuantumOperationAnnotations, "The estimated number of bytes held by the annotations of the quantum operations of the synthesized quantum computation")
+            .def_readonly("num_bytes_of_quantum_register_layouts", &MemoryUsage::numBytesOfQuantumRegisterLayouts, "The estimated number of bytes held by the variable layouts of the quantum registers of the synthesized quantum computation")
+            .def_readonly("num_bytes_of_inline_stacks", &MemoryUsage::numBytesOfInlineStacks, "The estimated number of bytes held by the distinct inline stacks of the qubits of the synthesized quantum computation")
+            .def_readonly("resident_set_size_at_start_of_synthesis_in_bytes", &MemoryUsage::residentSetSizeAtStartOfSynthesisInBytes, "The resident set size of the process in bytes at the start of the synthesis")
+            .def_readonly("peak_resident_set_size_during_synthesis_in_bytes", &MemoryUsage::peakResidentSetSizeDuringSynthesisInBytes, "The largest resident set size of the process in bytes sampled during the synthesis");
+
     py::class_<Statistics>(m, "statistics")
             .def(py::init<>(), "Constructs an object to record collected statistics.")
-            .def_readwrite("runtime_in_milliseconds", &Statistics::runtimeInMilliseconds, "The recorded runtime in milliseconds");
+            .def_readwrite("runtime_in_milliseconds", &Statistics::runtimeInMilliseconds, "The recorded runtime in milliseconds")
+            .def_readwrite("runtime_in_nanoseconds", &Statistics::runtimeInNanoseconds, "The recorded runtime in nanoseconds")
+            .def_readwrite("parsing_runtime_in_nanoseconds", &Statistics::parsingRuntimeInNanoseconds, "The runtime of the syntactic analysis of a SyReC program by the parser in nanoseconds")
+            .def_readwrite("semantic_check_runtime_in_nanoseconds", &Statistics::semanticCheckRuntimeInNanoseconds, "The runtime of the semantic checks performed by the parser in nanoseconds")
+            .def_readwrite("synthesis_runtime_in_nanoseconds", &Statistics::synthesisRuntimeInNanoseconds, "The runtime of the synthesis of the statements of a SyReC program in nanoseconds")
+            .def_readwrite("optimization_runtime_in_nanoseconds", &Statistics::optimizationRuntimeInNanoseconds, "The runtime of the optimizations applied to the quantum computation after the synthesis in nanoseconds")
+            .def_readwrite("num_reused_ancillary_qubits", &Statistics::numReusedAncillaryQubits, "The number of ancillary qubits that were reused instead of generating new ancillary qubits during the synthesis")
+            .def_readwrite("num_uncomputed_expressions", &Statistics::numUncomputedExpressions, "The number of expressions whose ancillary qubits were reset to be reused during the synthesis")
+            .def_readwrite("num_quantum_operations_of_uncomputed_expressions", &Statistics::numQuantumOperationsOfUncomputedExpressions, "The number of quantum operations synthesized to reset the ancillary qubits of the uncomputed expressions")
+            .def_readwrite("num_cancelled_quantum_operations", &Statistics::numCancelledQuantumOperations, "The number of quantum operations removed by the cancellation of adjacent self-inverse quantum operations after the synthesis")
+            .def_readwrite("num_qubits", &Statistics::numQubits, "The number of qubits of the synthesized quantum computation")
+            .def_readwrite("num_ancillary_qubits", &Statistics::numAncillaryQubits, "The number of ancillary qubits allocated during the synthesis")
+            .def_readwrite("num_quantum_operations", &Statistics::numQuantumOperations, "The number of quantum operations of the synthesized quantum computation")
+            .def_readwrite("num_quantum_operations_per_gate_type", &Statistics::numQuantumOperationsPerGateType, "The number of quantum operations of the synthesized quantum computation per gate type (i.e. 'x', 'cx', 'ccx', 'c3x', ..., 'swap', 'cswap', ...)")
+            .def_readwrite("depth", &Statistics::depth, "The depth of the synthesized quantum computation excluding the quantum operations forwarded to a quantum operation sink")
+            .def_readwrite("num_expanded_module_calls", &Statistics::numExpandedModuleCalls, "The number of Call-/UncallStatements for which the body of the called module was synthesized")
+            .def_readwrite("num_reused_module_calls", &Statistics::numReusedModuleCalls, "The number of Call-/UncallStatements for which the quantum operations synthesized for a previous call/uncall of the same module were reused")
+            .def_readwrite("num_unrolled_loop_iterations", &Statistics::numUnrolledLoopIterations, "The number of iterations of loops whose body was synthesized")
+            .def_readwrite("num_replayed_loop_iterations", &Statistics::numReplayedLoopIterations, "The number of iterations of loops for which the quantum operations synthesized for a previous iteration were replayed")
+            .def_readwrite("num_assignments_synthesized_cost_aware", &Statistics::numAssignmentsSynthesizedCostAware, "The number of AssignStatements synthesized like in the cost aware synthesis by the hybrid synthesis")
+            .def_readwrite("num_assignments_synthesized_line_aware", &Statistics::numAssignmentsSynthesizedLineAware, "The number of AssignStatements synthesized like in the line aware synthesis by the hybrid synthesis")
+            .def_readwrite("estimated_num_quantum_operations_saved_by_hybrid_synthesis", &Statistics::estimatedNumQuantumOperationsSavedByHybridSynthesis, "The estimated number of quantum operations saved by the hybrid synthesis by synthesizing AssignStatements like in the cost aware synthesis")
+            .def_readwrite("estimated_num_ancillary_qubits_saved_by_hybrid_synthesis", &Statistics::estimatedNumAncillaryQubitsSavedByHybridSynthesis, "The estimated number of ancillary qubits saved by the hybrid synthesis by synthesizing AssignStatements like in the line aware synthesis")
+            .def_readwrite("num_iterations_of_optimization_pipeline", &Statistics::numIterationsOfOptimizationPipeline, "The number of iterations of the optimization pipeline")
+            .def_readwrite("statistics_per_optimization_pass", &Statistics::statisticsPerOptimizationPass, "The statistics of every pass of the optimization pipeline accumulated over all of its applications")
+            .def_readwrite("num_synthesis_result_cache_hits", &Statistics::numSynthesisResultCacheHits, "The number of synthesized SyReC programs whose quantum computation was loaded from the synthesis result cache used for the synthesis")
+            .def_readwrite("num_synthesis_result_cache_misses", &Statistics::numSynthesisResultCacheMisses, "The number of SyReC programs that needed to be synthesized by the synthesis result cache used for the synthesis")
+            .def_readwrite("num_t_gates", &Statistics::numTGates, "The number of T and T^dagger gates of the quantum computation lowered to the Clifford+T gate set")
+            .def_readwrite("t_depth", &Statistics::tDepth, "The T-depth of the quantum computation lowered to the Clifford+T gate set")
+            .def_readwrite("peak_resident_set_size_in_bytes", &Statistics::peakResidentSetSizeInBytes, "The peak resident set size of the process in bytes at the end of the processing step")
+            .def_readwrite("memory_usage", &Statistics::memoryUsage, "The memory held by the data structures of the processing step, only recorded if requested via the record_memory_usage option")
+            .def_readwrite("execution_limit_violation", &Statistics::executionLimitViolation, "The violated execution limit due to which the processing step was stopped prior to its completion")
+            .def("to_json", &Statistics::toJson, "Stringify the recorded statistics as a JSON object.");
 
     py::enum_<utils::IntegerConstantTruncationOperation>(m, "integer_constant_truncation_operation")
             .value("modulo", utils::IntegerConstantTruncationOperation::Modulo, "Use the modulo operation for the truncation of constant values")
             .value("bitwise_and", utils::IntegerConstantTruncationOperation::BitwiseAnd, "Use the bitwise AND operation for the truncation of constant values")
             .export_values();
 
+    py::enum_<AncillaryQubitUncomputationStrategy>(m, "ancillary_qubit_uncomputation_strategy")
+            .value("eager", AncillaryQubitUncomputationStrategy::Eager, "Uncompute the expression on the right-hand side of an assignment directly after the synthesis of the assignment")
+            .value("lazy", AncillaryQubitUncomputationStrategy::Lazy, "Defer the uncomputation of an expression until new ancillary qubits would otherwise have to be created")
+            .value("bennett", AncillaryQubitUncomputationStrategy::Bennett, "Defer the uncomputation of an expression similar to lazy but keep at most a limited number of expressions computed at once")
+            .export_values();
+
+    py::enum_<AdderArchitecture>(m, "adder_architecture")
+            .value("ripple_carry", AdderArchitecture::RippleCarry, "Use the ripple-carry adder without any ancillary qubits")
+            .value("cuccaro", AdderArchitecture::Cuccaro, "Use the ripple-carry adder of Cuccaro et al. requiring a single ancillary qubit")
+            .value("carry_lookahead", AdderArchitecture::CarryLookahead, "Use the carry-lookahead adder of Draper et al. with logarithmic depth requiring a linear number of ancillary qubits")
+            .export_values();
+
+    py::enum_<MultiplierArchitecture>(m, "multiplier_architecture")
+            .value("controlled_additions", MultiplierArchitecture::ControlledAdditions, "Add every shifted partial product using an adder controlled by the corresponding bit of the left hand side operand")
+            .value("partial_products", MultiplierArchitecture::PartialProducts, "Compute every partial product into ancillary qubits, add it using an uncontrolled adder and uncompute it again")
+            .export_values();
+
+    py::enum_<DividerArchitecture>(m, "divider_architecture")
+            .value("restoring", DividerArchitecture::Restoring, "Subtract the divisor and restore a negative partial remainder using a controlled addition for every bit of the quotient")
+            .value("non_restoring", DividerArchitecture::NonRestoring, "Add or subtract the divisor, depending on the sign of the previous partial remainder, using an uncontrolled adder for every bit of the quotient")
+            .export_values();
+
     py::class_<ConfigurableOptions, std::shared_ptr<ConfigurableOptions>>(m, "configurable_options")
             .def(py::init<>(), "Constructs a configurable options object.")
             .def_readwrite("default_bitwidth", &ConfigurableOptions::defaultBitwidth, "Defines the default variable bitwidth used by the SyReC parser for variables whose bitwidth specification was omitted")
             .def_readwrite("integer_constant_truncation_operation", &ConfigurableOptions::integerConstantTruncationOperation, "Defines the operation used by the SyReC parser for the truncation of integer constant values. For further details we refer to the semantics of the SyReC language")
             .def_readwrite("allow_access_on_assigned_to_variable_parts_in_dimension_access_of_variable_access", &ConfigurableOptions::allowAccessOnAssignedToVariablePartsInDimensionAccessOfVariableAccess, "Defines whether an access on the assigned to signal parts of an assigned is allowed in variable accesses defined in any operand of the assignment. For further details we refer to the semantics of the SyReC language.")
+            .def_readwrite("allocate_ir_nodes_in_arena", &ConfigurableOptions::allocateIrNodesInArena, "Should the nodes of the IR generated by the SyReC parser for a program be allocated in a shared arena that is released together with the program, enabled by default")
             .def_readwrite("main_module_identifier", &ConfigurableOptions::optionalProgramEntryPointModuleIdentifier, "Define the identifier of the module serving as the entry-point of the to be processed SyReC program")
+            .def_readwrite("max_num_reported_parser_errors", &ConfigurableOptions::optionalMaxNumReportedParserErrors, "The maximum number of errors reported by the SyReC parser with only the number of all further errors being reported, identical errors at the same position are only reported once and all errors are reported by default")
+            .def_readwrite("prune_modules_not_reachable_from_program_entry_point", &ConfigurableOptions::pruneModulesNotReachableFromProgramEntryPoint, "Should the SyReC parser only check and keep the modules reachable via call-/uncall statements from the program entry point, with all other modules only being validated syntactically. Disabled by default")
+            .def_readwrite("parse_module_declarations_concurrently", &ConfigurableOptions::parseModuleDeclarationsConcurrently, "Should the module declarations of an ASCII encoded SyReC program be parsed concurrently by up to max_num_threads threads, with programs containing errors being parsed sequentially to report the same errors. Disabled by default")
             .def_readwrite("generate_inlined_qubit_debug_information", &ConfigurableOptions::generatedInlinedQubitDebugInformation, "Should debug information for the qubits associated with the local variables of a SyReC module be generated")
-            .def_readwrite("generate_quantum_operation_annotations", &ConfigurableOptions::generateQuantumOperationAnnotations, "Should the optional quantum operation annotations be generated during the synthesis of a SyReC program, disabled by default");
+            .def_readwrite("generate_quantum_operation_annotations", &ConfigurableOptions::generateQuantumOperationAnnotations, "Should the optional quantum operation annotations be generated during the synthesis of a SyReC program, disabled by default")
+            .def_readwrite("reuse_synthesized_module_calls", &ConfigurableOptions::reuseSynthesizedModuleCalls, "Should the quantum operations synthesized for the body of a called/uncalled SyReC module be reused for further calls/uncalls of the same module in the same context, enabled by default")
+            .def_readwrite("replay_synthesized_loop_iterations", &ConfigurableOptions::replaySynthesizedLoopIterations, "Should the quantum operations synthesized for the first iterations of a loop be replayed, with shifted qubits, for the remaining iterations of the loop if the loop variable is only used as an affine offset in variable accesses, enabled by default")
+            .def_readwrite("share_synthesized_common_subexpressions", &ConfigurableOptions::shareSynthesizedCommonSubexpressions, "Should the qubits storing the synthesized result of an expression be reused for any structurally identical expression synthesized later on as long as none of the variables accessed by the expression were modified, only supported by the cost aware synthesis and disabled by default")
+            .def_readwrite("reuse_ancillary_qubits_across_statements", &ConfigurableOptions::reuseAncillaryQubitsAcrossStatements, "Should the ancillary qubits used by the expression on the right-hand side of an assignment be reset and reused by later statements instead of always generating new ancillary qubits, only supported by the cost aware synthesis and disabled by default")
+            .def_readwrite("ancillary_qubit_uncomputation_strategy", &ConfigurableOptions::ancillaryQubitUncomputationStrategy, "The strategy determining when the ancillary qubits of the expression on the right-hand side of an assignment are reset and reused, the eager strategy is used by default")
+            .def_readwrite("max_num_deferred_expression_uncomputations", &ConfigurableOptions::maxNumDeferredExpressionUncomputations, "The maximum number of computed expressions whose uncomputation is deferred at once when using the bennett uncomputation strategy")
+            .def_readwrite("qubit_budget_of_hybrid_synthesis", &ConfigurableOptions::qubitBudgetOfHybridSynthesis, "The maximum number of qubits of the quantum computation synthesized by the hybrid synthesis, assignments are only synthesized like in the cost-aware synthesis if their estimated ancillary qubits fit into the budget, no budget is defined by default")
+            .def_readwrite("decode_non_constant_indices_using_unary_iteration", &ConfigurableOptions::decodeNonConstantIndicesUsingUnaryIteration, "Should the element selected by an index of a variable access not evaluable at compile time be determined by a unary iteration tree requiring one ancillary qubit per bit of the index instead of comparing the index with the index of every element, disabled by default")
+            .def_readwrite("share_index_decoding_of_non_constant_indices", &ConfigurableOptions::shareIndexDecodingOfNonConstantIndices, "Should the variable accesses of a statement using structurally identical indices not evaluable at compile time on variables with the same dimensions share a single decoding of their index into one ancillary qubit per element, only supported by the cost aware synthesis and disabled by default")
+            .def_readwrite("pad_dimensions_of_unrolled_indices_to_powers_of_two", &ConfigurableOptions::padDimensionsOfUnrolledIndicesToPowersOfTwo, "Should the unrolled index of a variable access with indices not evaluable at compile time be calculated by concatenating the copied indices of the dimensions of the accessed variable, padded to powers of two, instead of multiplying and adding them, disabled by default")
+            .def_readwrite("reuse_qubit_of_guard_variable_not_accessed_in_branches", &ConfigurableOptions::reuseQubitOfGuardVariableNotAccessedInBranches, "Should the qubit of the variable accessed by the guard expression of an IfStatement be used as the control qubit of both branches instead of copying its value to an ancillary qubit if no statement of either branch accesses any variable of the guard expression, disabled by default")
+            .def_readwrite("combine_guards_of_nested_if_statements", &ConfigurableOptions::combineGuardsOfNestedIfStatements, "Should the quantum operations of the branches of a nested IfStatement only be controlled by a single ancillary qubit storing the conjunction of the guards of all enclosing IfStatements and its own guard, disabled by default")
+            .def_readwrite("lift_control_qubits_of_module_calls", &ConfigurableOptions::liftControlQubitsOfModuleCalls, "Should the body of a module called/uncalled in a branch of an IfStatement be synthesized uncontrolled, with the guard control qubits only being added to the core of the compute-apply-uncompute structures of the synthesized quantum operations if this reduces their quantum cost, disabled by default")
+            .def_readwrite("adder_architecture", &ConfigurableOptions::adderArchitecture, "The architecture of the adder used for the synthesis of additions and subtractions, the ripple-carry adder without any ancillary qubits is used by default")
+            .def_readwrite("multiplier_architecture", &ConfigurableOptions::multiplierArchitecture, "The architecture of the multiplier used for the synthesis of multiplications, the multiplier using controlled additions is used by default")
+            .def_readwrite("divider_architecture", &ConfigurableOptions::dividerArchitecture, "The architecture of the divider used for the synthesis of divisions and modulo operations, the restoring divider is used by default")
+            .def_readwrite("share_divider_of_quotient_and_remainder", &ConfigurableOptions::shareDividerOfQuotientAndRemainder, "Should the quotient and remainder of a division of the same operands used in the same statement be computed by a single divider, only supported by the cost aware synthesis and disabled by default")
+            .def_readwrite("share_comparator_of_relational_operations", &ConfigurableOptions::shareComparatorOfRelationalOperations, "Should all relational operations of the same operands used in the same statement determine their result from a single comparator, only supported by the cost aware synthesis and disabled by default")
+            .def_readwrite("add_constants_without_ancillary_qubits", &ConfigurableOptions::addConstantsWithoutAncillaryQubits, "Should the addition/subtraction of an integer constant in an assignment be synthesized as a sequence of increments/decrements of the assigned to qubits that does not require any ancillary qubits, disabled by default")
+            .def_readwrite("specialize_operations_with_constant_operand", &ConfigurableOptions::specializeOperationsWithConstantOperand, "Should a multiplication or relational operation with an integer constant operand be synthesized by a circuit specialized for the value of the constant instead of storing the constant in ancillary qubits, disabled by default")
+            .def_readwrite("synthesize_shifts_by_relabeling_qubits", &ConfigurableOptions::synthesizeShiftsByRelabelingQubits, "Should a shift by a compile time constant be synthesized by relabeling the qubits of the shifted operand, padded with zero-initialized ancillary qubits, instead of copying the shifted qubits to ancillary qubits, only supported by the cost aware synthesis and disabled by default")
+            .def_readwrite("track_unconditional_swaps_as_qubit_permutation", &ConfigurableOptions::trackUnconditionalSwapsAsQubitPermutation, "Should an unconditional swap of two variables of the main module of the same type and bitwidth be synthesized by swapping the qubits associated with the variables instead of synthesizing SWAP gates, with the final association being recorded as the output permutation, disabled by default")
+            .def_readwrite("fold_negations_into_negative_controls", &ConfigurableOptions::foldNegationsIntoNegativeControls, "Should negations only used as control qubits be folded into negative control qubits of the consuming quantum operations instead of synthesizing X gates, disabled by default")
+            .def_readwrite("narrow_operations_using_value_range_analysis", &ConfigurableOptions::narrowOperationsUsingValueRangeAnalysis, "Should the binary operations of an expression whose operands and result are known to fit into fewer bits than their bitwidth only be synthesized for the least significant bits of their operands, disabled by default")
+            .def_readwrite("propagate_constant_qubit_values", &ConfigurableOptions::propagateConstantQubitValues, "Should the quantum operations be simplified using the values of the qubits known at their position, with the ancillary qubits being initialized to zero, after the synthesis, disabled by default")
+            .def_readwrite("apply_reversible_circuit_templates", &ConfigurableOptions::applyReversibleCircuitTemplates, "Should the multi-controlled X gates be simplified using reversible circuit templates after the synthesis, disabled by default")
+            .def_readwrite("window_size_of_reversible_circuit_templates", &ConfigurableOptions::windowSizeOfReversibleCircuitTemplates, "The maximum number of previous multi-controlled X gates with the same target qubit considered as the partner of a multi-controlled X gate during the application of the reversible circuit templates, defaults to 64")
+            .def_readwrite("time_budget_of_reversible_circuit_templates_in_milliseconds", &ConfigurableOptions::timeBudgetOfReversibleCircuitTemplatesInMilliseconds, "The optional time budget in milliseconds of the application of the reversible circuit templates, no budget is defined by default")
+            .def_readwrite("cancel_adjacent_self_inverse_quantum_operations", &ConfigurableOptions::cancelAdjacentSelfInverseQuantumOperations, "Should pairs of identical self-inverse quantum operations with no other quantum operation accessing any of their qubits in between them be removed after the synthesis, disabled by default")
+            .def_readwrite("recycle_ancillary_qubits_with_non_overlapping_live_ranges", &ConfigurableOptions::recycleAncillaryQubitsWithNonOverlappingLiveRanges, "Should ancillary qubits with non-overlapping live ranges be merged onto the same qubit after the synthesis, disabled by default")
+            .def_readwrite("reorder_quantum_operations_to_reduce_depth", &ConfigurableOptions::reorderQuantumOperationsToReduceDepth, "Should the quantum operations be reordered, by moving them in front of previous quantum operations they commute with, to reduce the depth after the synthesis, disabled by default")
+            .def_readwrite("optimization_pipeline", &ConfigurableOptions::optimizationPipeline, "The identifiers of the passes of the optimization pass manager applied, in the given order, after the synthesis instead of the optimizations enabled by the individual flags, empty by default")
+            .def_readwrite("max_num_iterations_of_optimization_pipeline", &ConfigurableOptions::maxNumIterationsOfOptimizationPipeline, "The maximum number of iterations of the optimization pipeline, which is repeated until no pass modified the quantum computation, defaults to 1")
+            .def_readwrite("verify_passes_of_optimization_pipeline", &ConfigurableOptions::verifyPassesOfOptimizationPipeline, "Should every pass of the optimization pipeline be verified using the bit-parallel simulation, disabled by default")
+            .def_readwrite("emit_module_calls_as_compound_operations", &ConfigurableOptions::emitModuleCallsAsCompoundOperations, "Should the quantum operations synthesized for every module call and uncall be grouped into a (nested) compound operation after the synthesis, disabled by default")
+            .def_readwrite("synthesize_independent_statements_concurrently", &ConfigurableOptions::synthesizeIndependentStatementsConcurrently, "Should groups of statements of the main module not accessing a variable modified by another group be synthesized concurrently, each using separate ancillary qubits, disabled by default")
+            .def_readwrite("num_threads_of_concurrent_synthesis", &ConfigurableOptions::numThreadsOfConcurrentSynthesis, "The number of threads used to synthesize the groups of independent statements of the main module, zero uses max_num_threads")
+            .def_readwrite("max_num_threads", &ConfigurableOptions::maxNumThreads, "The maximum number of threads used by parallel loops whose number of threads was not defined explicitly, zero uses the number of concurrent threads supported by the hardware")
+            .def_readwrite("pin_worker_threads_to_cores", &ConfigurableOptions::pinWorkerThreadsToCores, "Should the worker threads of the shared thread pool be pinned to separate cores (only supported on Linux and persisting for the lifetime of the process), disabled by default")
+            .def_readwrite("deterministic_parallel_execution", &ConfigurableOptions::deterministicParallelExecution, "Should parallel loops partition their work items into a fixed number of sequentially processed groups independent of the scheduling of the threads, disabled by default")
+            .def_readwrite("execution_limits", &ConfigurableOptions::executionLimits, "The cancellation token, time limit and memory budget of the synthesis checked prior to the synthesis of every statement and loop iteration, no limits are defined by default")
+            .def_readwrite("progress_callback", &ConfigurableOptions::progressCallback, "The optional callable invoked with a progress_report of the synthesis at most once per progress_report_interval_in_milliseconds as well as once at the end of the synthesis, the callable is invoked while holding the GIL")
+            .def_readwrite("progress_report_interval_in_milliseconds", &ConfigurableOptions::progressReportIntervalInMilliseconds, "The minimum duration in milliseconds between two reports of the progress, defaults to 100ms")
+            .def_readwrite("record_memory_usage", &ConfigurableOptions::recordMemoryUsage, "Should the memory held by the data structures of the parser and the synthesis together with the peak resident set size during the synthesis be recorded in the memory_usage of the statistics, disabled by default")
+            .def_readwrite("synthesis_trace_file_path", &ConfigurableOptions::optionalSynthesisTraceFilePath, "The path of the file to which a trace of the synthesis is written in the Chrome trace-event JSON format, only supported if the library was built with the MQT_SYREC_ENABLE_SYNTHESIS_TRACING option");
+
+    py::enum_<SynthesisAlgorithm>(m, "synthesis_algorithm")
+            .value("cost_aware", SynthesisAlgorithm::CostAware, "Use the cost-aware synthesis")
+            .value("line_aware", SynthesisAlgorithm::LineAware, "Use the line-aware synthesis")
+            .value("hybrid", SynthesisAlgorithm::Hybrid, "Use the hybrid synthesis selecting the cost-aware or line-aware synthesis per assignment")
+            .export_values();
 
     py::class_<Program>(m, "program")
             .def(py::init<>(), "Constructs SyReC program object.")
             .def("add_module", &Program::addModule)
-            .def("read", &Program::read, "filename"_a, "configurable_options"_a = ConfigurableOptions(), "Read and process a SyReC program from a file.")
-            .def("read_from_string", &Program::readFromString, "stringifiedProgram"_a, "configurable_options"_a = ConfigurableOptions(), "Process an already stringified SyReC program.");
+            .def("read", &Program::read, "filename"_a, "configurable_options"_a = ConfigurableOptions(), "optional_recorded_statistics"_a = nullptr, "Read and process a SyReC program from a file.")
+            .def("read_from_string", &Program::readFromString, "stringifiedProgram"_a, "configurable_options"_a = ConfigurableOptions(), "optional_recorded_statistics"_a = nullptr, "Process an already stringified SyReC program.")
+            .def("save", &Program::save, "filename"_a, "Store the binary representation of the IR of the program in a file.")
+            .def("load", &Program::load, "filename"_a, "configurable_options"_a = ConfigurableOptions(), "Load a program previously stored with save, replacing the modules of the program.")
+            .def("serialize", [](const Program& program) -> std::optional<py::bytes> {
+                std::optional<std::string> serializedProgram = serializeProgram(program);
+                return serializedProgram.has_value() ? std::make_optional(py::bytes(*serializedProgram)) : std::nullopt; }, "Serialize the IR of the program into the binary format used by save(...), returns None if the program references a variable or module not declared in the program")
+            .def_static("deserialize", &deserializeProgramFromBuffer, "serialized_program"_a, "configurable_options"_a = ConfigurableOptions(), "Deserialize a program serialized in the binary format from a bytes-like object (i.e. a memoryview of a shared memory block) without copying it, returns None if the serialized program is not valid")
+            .def(py::pickle(
+                    [](const Program& program) {
+                        std::optional<std::string> serializedProgram = serializeProgram(program);
+                        if (!serializedProgram.has_value()) {
+                            throw std::runtime_error("The program cannot be serialized");
+                        }
+                        return py::bytes(*serializedProgram);
+                    },
+                    [](const py::bytes& serializedProgram) {
+                        std::unique_ptr<Program> program = deserializeProgramFromBuffer(serializedProgram, ConfigurableOptions());
+                        if (program == nullptr) {
+                            throw std::runtime_error("The pickled program is not valid");
+                        }
+                        return program;
+                    }));
+
+    // The library is exposed as non-const since pybind11 does not support holders of const types, none of its members can however be modified from python.
+    py::class_<ModuleLibrary, std::shared_ptr<ModuleLibrary>>(m, "module_library")
+            .def_property_readonly("num_modules", [](const ModuleLibrary& library) { return library.modules().size(); }, "Get the number of modules of the library");
+
+    py::class_<ProgramReader>(m, "program_reader")
+            .def(py::init<>(), "Constructs a reader of SyReC programs reusing its lexer and parser for all programs it reads.")
+            .def_static("warm_up_prediction_caches", &ProgramReader::warmUpPredictionCaches, "Populate the prediction caches shared by all SyReC parsers of the process by parsing a SyReC program using all productions of the SyReC grammar")
+            .def("read", py::overload_cast<Program&, const std::string&, const ConfigurableOptions&, Statistics*>(&ProgramReader::read), "program"_a, "filename"_a, "configurable_options"_a = ConfigurableOptions(), "optional_recorded_statistics"_a = nullptr, "Read and process a SyReC program from a memory mapped file into the given program.")
+            .def("read_from_string", py::overload_cast<Program&, const std::string_view&, const ConfigurableOptions&, Statistics*>(&ProgramReader::readFromString), "program"_a, "stringifiedProgram"_a, "configurable_options"_a = ConfigurableOptions(), "optional_recorded_statistics"_a = nullptr, "Process an already stringified SyReC program into the given program.")
+            .def("read", py::overload_cast<Program&, const std::string&, const ModuleLibrary&, const ConfigurableOptions&, Statistics*>(&ProgramReader::read), "program"_a, "filename"_a, "linked_library"_a, "configurable_options"_a = ConfigurableOptions(), "optional_recorded_statistics"_a = nullptr, "Read and process a SyReC program, which can call the modules of the given library, from a memory mapped file into the given program.")
+            .def("read_from_string", py::overload_cast<Program&, const std::string_view&, const ModuleLibrary&, const ConfigurableOptions&, Statistics*>(&ProgramReader::readFromString), "program"_a, "stringifiedProgram"_a, "linked_library"_a, "configurable_options"_a = ConfigurableOptions(), "optional_recorded_statistics"_a = nullptr, "Process an already stringified SyReC program, which can call the modules of the given library, into the given program.")
+            .def(
+                    "read_module_library", [](ProgramReader& reader, const std::string& filename, const ConfigurableOptions& settings) {
+                        ModuleLibrary::ptr library;
+                        std::string        foundErrors = reader.readModuleLibrary(library, filename, settings);
+                        return std::make_pair(std::const_pointer_cast<ModuleLibrary>(library), std::move(foundErrors));
+                    },
+                    "filename"_a, "configurable_options"_a = ConfigurableOptions(), "Read and process a module library from a memory mapped file, returning the library (None in case of an error) together with the found errors.")
+            .def(
+                    "read_module_library_from_string", [](ProgramReader& reader, const std::string_view& stringifiedLibrary, const ConfigurableOptions& settings) {
+                        ModuleLibrary::ptr library;
+                        std::string        foundErrors = reader.readModuleLibraryFromString(library, stringifiedLibrary, settings);
+                        return std::make_pair(std::const_pointer_cast<ModuleLibrary>(library), std::move(foundErrors));
+                    },
+                    "stringified_library"_a, "configurable_options"_a = ConfigurableOptions(), "Process an already stringified module library, returning the library (None in case of an error) together with the found errors.");
+
+    py::class_<ProgramCache>(m, "program_cache")
+            .def(py::init<std::size_t, std::optional<std::string>>(), "max_num_cached_programs"_a = ProgramCache::DEFAULT_MAX_NUM_CACHED_PROGRAMS, "on_disk_cache_directory"_a = std::nullopt, "Constructs a cache of the results of the SyReC parser storing at most the given number of results in memory and optionally all results in the given directory.")
+            .def("read", &ProgramCache::read, "program"_a, "filename"_a, "configurable_options"_a = ConfigurableOptions(), "optional_recorded_statistics"_a = nullptr, "Read and process a SyReC program from a file into the given program or load the cached result of the parser for its content.")
+            .def("read_from_string", &ProgramCache::readFromString, "program"_a, "stringifiedProgram"_a, "configurable_options"_a = ConfigurableOptions(), "optional_recorded_statistics"_a = nullptr, "Process an already stringified SyReC program into the given program or load the cached result of the parser for the string.")
+            .def("clear", &ProgramCache::clear, "Remove all parser results from the in-memory cache")
+            .def_property_readonly("num_cached_programs", &ProgramCache::getNumCachedPrograms, "Get the number of parser results stored in the in-memory cache")
+            .def_property_readonly("num_cache_hits", &ProgramCache::getNumCacheHits, "Get the number of processed programs whose parser result was loaded from the cache")
+            .def_property_readonly("num_cache_misses", &ProgramCache::getNumCacheMisses, "Get the number of processed programs that needed to be parsed");
+
+    py::class_<SynthesisResultCache>(m, "synthesis_result_cache")
+            .def(py::init<std::size_t, std::optional<std::string>>(), "max_num_cached_results"_a = SynthesisResultCache::DEFAULT_MAX_NUM_CACHED_RESULTS, "on_disk_cache_directory"_a = std::nullopt, "Constructs a cache of the quantum computations synthesized for SyReC programs storing at most the given number of results in memory and optionally all results in the given directory. The cache must not be used by multiple threads at the same time.")
+            .def(
+                    "synthesize", [](SynthesisResultCache& cache, const Program& program, const SynthesisAlgorithm synthesisAlgorithm, const ConfigurableOptions& settings, Statistics* optionalRecordedStatistics, Diagnostics* optionalDiagnostics) {
+                        std::unique_ptr<AnnotatableQuantumComputation> annotatableQuantumComputation;
+                        callWithoutGil(optionalDiagnostics, [&] { annotatableQuantumComputation = cache.synthesize(program, synthesisAlgorithm, settings, optionalRecordedStatistics); });
+                        return annotatableQuantumComputation;
+                    },
+                    "program"_a, "synthesis_algorithm"_a = SynthesisAlgorithm::CostAware, "configurable_options"_a = ConfigurableOptions(), "optional_recorded_statistics"_a = nullptr, "optional_diagnostics"_a = nullptr, "Synthesize the SyReC program with the given synthesis algorithm or load the cached quantum computation synthesized for a program with identical IR and synthesis settings without holding the GIL. Returns None if the synthesis failed with the errors being collected in the diagnostics, if given, and otherwise written to sys.stderr.")
+            .def("clear", &SynthesisResultCache::clear, "Remove all synthesized quantum computations from the in-memory cache")
+            .def_property_readonly("num_cached_results", &SynthesisResultCache::getNumCachedResults, "Get the number of synthesized quantum computations stored in the in-memory cache")
+            .def_property_readonly("num_cache_hits", &SynthesisResultCache::getNumCacheHits, "Get the number of synthesized programs whose quantum computation was loaded from the cache")
+            .def_property_readonly("num_cache_misses", &SynthesisResultCache::getNumCacheMisses, "Get the number of programs that needed to be synthesized");
+
+    py::class_<SynthesizedStatementFootprint>(m, "synthesized_statement_footprint")
+            .def_property_readonly("index_of_first_quantum_operation", [](const SynthesizedStatementFootprint& footprint) { return footprint.quantumOperations.indexOfFirstQuantumOperation; }, "The index of the first quantum operation synthesized for the statement")
+            .def_property_readonly("num_quantum_operations", [](const SynthesizedStatementFootprint& footprint) { return footprint.quantumOperations.numQuantumOperations; }, "The number of quantum operations synthesized for the statement")
+            .def_property_readonly(
+                    "ancillary_qubits", [](const SynthesizedStatementFootprint& footprint) -> std::optional<std::pair<qc::Qubit, qc::Qubit>> {
+                        if (!footprint.ancillaryQubits.has_value()) {
+                            return std::nullopt;
+                        }
+                        return std::make_pair(footprint.ancillaryQubits->firstQubitIndex, footprint.ancillaryQubits->lastQubitIndex);
+                    },
+                    "The first and last ancillary qubit used only by the statement, None if the statement does not require any ancillary qubits")
+            .def_readonly("was_resynthesized", &SynthesizedStatementFootprint::wasResynthesized, "Whether the statement was synthesized by the last synthesis instead of being reused from a previous one");
+
+    py::class_<IncrementalSynthesis>(m, "incremental_synthesis")
+            .def(py::init<SynthesisAlgorithm>(), "synthesis_algorithm"_a = SynthesisAlgorithm::CostAware, "Constructs a synthesizer of successive revisions of a SyReC program only resynthesizing the top-level statements of the main module changed since the last synthesized revision. The synthesizer must not be used by multiple threads at the same time.")
+            .def(
+                    "synthesize", [](IncrementalSynthesis& incrementalSynthesis, const Program& program, const ConfigurableOptions& settings, Statistics* optionalRecordedStatistics, Diagnostics* optionalDiagnostics) {
+                        std::unique_ptr<AnnotatableQuantumComputation> annotatableQuantumComputation;
+                        callWithoutGil(optionalDiagnostics, [&] { annotatableQuantumComputation = incrementalSynthesis.synthesize(program, settings, optionalRecordedStatistics); });
+                        return annotatableQuantumComputation;
+                    },
+                    "program"_a, "configurable_options"_a = ConfigurableOptions(), "optional_recorded_statistics"_a = nullptr, "optional_diagnostics"_a = nullptr, "Synthesize the SyReC program by only resynthesizing the top-level statements of its main module changed since the last synthesis without holding the GIL. Returns None if the synthesis failed with the errors being collected in the diagnostics, if given, and otherwise written to sys.stderr.")
+            .def("clear", &IncrementalSynthesis::clear, "Discard the quantum computations synthesized for the statements of the previously synthesized program")
+            .def_property_readonly("footprints_of_statements", &IncrementalSynthesis::getFootprintsOfStatements, "Get the footprints of the top-level statements of the main module in the quantum computation synthesized by the last synthesis (empty if the program was synthesized from scratch)")
+            .def_property_readonly("num_resynthesized_statements", &IncrementalSynthesis::getNumResynthesizedStatements, "Get the number of top-level statements of the main module synthesized by the last synthesis")
+            .def_property_readonly("num_reused_statements", &IncrementalSynthesis::getNumReusedStatements, "Get the number of top-level statements of the main module whose quantum operations were reused by the last synthesis");
+
+    py::class_<IncrementalProgramReader>(m, "incremental_program_reader")
+            .def(py::init<>(), "Constructs a reader of successive revisions of a SyReC program only re-parsing the modules changed since the last read revision.")
+            .def("read_from_string", &IncrementalProgramReader::readFromString, "program"_a, "stringifiedProgram"_a, "configurable_options"_a = ConfigurableOptions(), "optional_recorded_statistics"_a = nullptr, "Process a revision of a stringified SyReC program into the given program by only re-parsing its changed modules.")
+            .def("reset", &IncrementalProgramReader::reset, "Forget the last read revision, causing the next read revision to be fully parsed")
+            .def_property_readonly("num_parsed_modules_of_last_read", &IncrementalProgramReader::getNumParsedModulesOfLastRead, "Get the number of modules that were parsed during the last read")
+            .def_property_readonly("was_last_read_incremental", &IncrementalProgramReader::wasLastReadIncremental, "Get whether only the changed modules were parsed during the last read");
+
+    py::enum_<BackgroundTask::State>(m, "background_task_state")
+            .value("running", BackgroundTask::State::Running, "The work of the task is still running")
+            .value("succeeded", BackgroundTask::State::Succeeded, "The work of the task was performed successfully")
+            .value("failed", BackgroundTask::State::Failed, "The work of the task failed")
+            .value("cancelled", BackgroundTask::State::Cancelled, "The work of the task was cancelled")
+            .export_values();
+
+    // The results of a task are only accessible once its work terminated, since the work is performed on a separate thread and the results are not synchronized otherwise.
+    py::class_<BuildTask> buildTask(m, "build_task");
+    buildTask.def(py::init<IncrementalProgramReader&, std::string, ConfigurableOptions, SynthesisAlgorithm>(), "program_reader"_a, "stringified_program"_a, "configurable_options"_a = ConfigurableOptions(), "synthesis_algorithm"_a = SynthesisAlgorithm::CostAware, py::keep_alive<1, 2>(),
+                  "Parse and synthesize a stringified SyReC program on a separate thread. The program reader must not be used until the task is finished. The cancellation of the task takes effect after the parsing or prior to the synthesis of the next statement of the program")
+            .def_property_readonly("parser_errors", [](const BuildTask& task) { return task.task.isFinished() ? task.parserErrors : std::string(); }, "Get the errors found by the SyReC parser (only available once the task is finished)")
+            .def_property_readonly(
+                    "program", [](const BuildTask& task) { return task.task.isFinished() && task.parserErrors.empty() ? &task.program : nullptr; }, py::return_value_policy::reference_internal, "Get the parsed SyReC program, None if the task is not finished or the parsing failed")
+            .def_property_readonly(
+                    "annotatable_quantum_computation", [](const BuildTask& task) { return task.task.getState() == BackgroundTask::State::Succeeded ? task.annotatableQuantumComputation.get() : nullptr; }, py::return_value_policy::reference_internal, "Get the synthesized quantum computation, None unless the task succeeded")
+            .def_property_readonly("statistics", [](const BuildTask& task) { return task.task.isFinished() ? task.statistics : Statistics(); }, "Get the statistics recorded by the parsing and synthesis (only available once the task is finished)");
+    defineInterfaceOfBackgroundTask(buildTask);
+
+    py::class_<SimulationTask> simulationTask(m, "simulation_task");
+    simulationTask.def(py::init([](const qc::QuantumComputation& quantumComputation, const std::optional<IntegerStates>& inputs) {
+                           std::vector<std::uint64_t> assignments;
+                           if (inputs.has_value()) {
+                               assignments.assign(inputs->data(), inputs->data() + inputs->size());
+                           } else {
+                               const py::gil_scoped_release releasedGil;
+                               assignments = determineAllAssignmentsOfNonAncillaryQubits(quantumComputation);
+                           }
+                           return std::make_unique<SimulationTask>(quantumComputation, std::move(assignments));
+                       }),
+                       "quantum_computation"_a, "inputs"_a = py::none(), py::keep_alive<1, 2>(),
+                       "Bit-parallel simulation of a synthesized SyReC program with at most 64 qubits on a separate thread, either for a NumPy array of input states or all assignments of the non-ancillary qubits (see simulate_batch). The cancellation of the task takes effect after the next simulated block of input states")
+            .def_property_readonly("inputs", [](const py::object& self) { return exportVectorAsArrayViewOwnedBy(self.cast<const SimulationTask&>().inputs, self); }, "The simulated input states")
+            .def_property_readonly(
+                    "outputs", [](const py::object& self) {
+                        // The outputs of the already simulated inputs are not modified by the running simulation.
+                        const auto&                task = self.cast<const SimulationTask&>();
+                        py::array_t<std::uint64_t> arrayView(static_cast<py::ssize_t>(task.task.getNumProcessedWorkItems()), task.outputs.data(), self);
+                        arrayView.attr("setflags")("write"_a = false);
+                        return arrayView;
+                    },
+                    "Get the output states of the already simulated input states, i.e. of the first num_processed_work_items input states");
+    defineInterfaceOfBackgroundTask(simulationTask);
 
     // Due to the cost and line aware synthesizers reporting found synthesis errors on the std::cerr output stream an explicit redirection to the python sys.stderr output stream is required. However, this should only be a temporary solution and the synthesizer should either use a return value or output parameter to return the found synthesis errors similarly to how the SyReC parser is doing it.
-    m.def("cost_aware_synthesis", &CostAwareSynthesis::synthesize, py::call_guard<py::scoped_estream_redirect>(), "annotated_quantum_computation"_a, "program"_a, "configurable_options"_a = ConfigurableOptions(), "optional_recorded_statistics"_a = nullptr, "Cost-aware synthesis of the SyReC program.");
-    m.def("line_aware_synthesis", &LineAwareSynthesis::synthesize, py::call_guard<py::scoped_estream_redirect>(), "annotated_quantum_computation"_a, "program"_a, "configurable_options"_a = ConfigurableOptions(), "optional_recorded_statistics"_a = nullptr, "Line-aware synthesis of the SyReC program.");
-    m.def("simple_simulation", &simpleSimulation, "output"_a, "quantum_computation"_a, "input"_a, "optional_recorded_statistics"_a = nullptr, "Simulation of a synthesized SyReC program");
+    // The synthesis and simulation functions are executed without holding the GIL, thus independent calls from multiple Python threads are processed concurrently as long as they do not share any mutable argument.
+    m.def(
+            "cost_aware_synthesis", [](AnnotatableQuantumComputation& annotatableQuantumComputation, const Program& program, const ConfigurableOptions& settings, Statistics* optionalRecordedStatistics, Diagnostics* optionalDiagnostics) {
+                bool synthesisOk = false;
+                callWithoutGil(optionalDiagnostics, [&] { synthesisOk = CostAwareSynthesis::synthesize(annotatableQuantumComputation, program, settings, optionalRecordedStatistics); });
+                return synthesisOk;
+            },
+            "annotated_quantum_computation"_a, "program"_a, "configurable_options"_a = ConfigurableOptions(), "optional_recorded_statistics"_a = nullptr, "optional_diagnostics"_a = nullptr, "Cost-aware synthesis of the SyReC program without holding the GIL. Synthesis errors are collected in the diagnostics, if given, and otherwise written to sys.stderr.");
+    m.def(
+            "line_aware_synthesis", [](AnnotatableQuantumComputation& annotatableQuantumComputation, const Program& program, const ConfigurableOptions& settings, Statistics* optionalRecordedStatistics, Diagnostics* optionalDiagnostics) {
+                bool synthesisOk = false;
+                callWithoutGil(optionalDiagnostics, [&] { synthesisOk = LineAwareSynthesis::synthesize(annotatableQuantumComputation, program, settings, optionalRecordedStatistics); });
+                return synthesisOk;
+            },
+            "annotated_quantum_computation"_a, "program"_a, "configurable_options"_a = ConfigurableOptions(), "optional_recorded_statistics"_a = nullptr, "optional_diagnostics"_a = nullptr, "Line-aware synthesis of the SyReC program without holding the GIL. Synthesis errors are collected in the diagnostics, if given, and otherwise written to sys.stderr.");
+    m.def(
+            "hybrid_synthesis", [](AnnotatableQuantumComputation& annotatableQuantumComputation, const Program& program, const ConfigurableOptions& settings, Statistics* optionalRecordedStatistics, Diagnostics* optionalDiagnostics) {
+                bool synthesisOk = false;
+                callWithoutGil(optionalDiagnostics, [&] { synthesisOk = HybridSynthesis::synthesize(annotatableQuantumComputation, program, settings, optionalRecordedStatistics); });
+                return synthesisOk;
+            },
+            "annotated_quantum_computation"_a, "program"_a, "configurable_options"_a = ConfigurableOptions(), "optional_recorded_statistics"_a = nullptr, "optional_diagnostics"_a = nullptr, "Hybrid synthesis of the SyReC program, selecting the cost-aware or line-aware synthesis per assignment, without holding the GIL. Synthesis errors are collected in the diagnostics, if given, and otherwise written to sys.stderr.");
+    m.def(
+            "simple_simulation", [](NBitValuesContainer& output, const qc::QuantumComputation& quantumComputation, const NBitValuesContainer& input, Statistics* optionalRecordedStatistics, Diagnostics* optionalDiagnostics) {
+                callWithoutGil(optionalDiagnostics, [&] { simpleSimulation(output, quantumComputation, input, optionalRecordedStatistics); });
+            },
+            "output"_a, "quantum_computation"_a, "input"_a, "optional_recorded_statistics"_a = nullptr, "optional_diagnostics"_a = nullptr, "Simulation of a synthesized SyReC program without holding the GIL");
+    m.def(
+            "simple_simulation", [](NBitValuesContainer& output, const SimulationProgram& simulationProgram, const NBitValuesContainer& input, Statistics* optionalRecordedStatistics, Diagnostics* optionalDiagnostics) {
+                callWithoutGil(optionalDiagnostics, [&] { simpleSimulation(output, simulationProgram, input, optionalRecordedStatistics); });
+            },
+            "output"_a, "simulation_program"_a, "input"_a, "optional_recorded_statistics"_a = nullptr, "optional_diagnostics"_a = nullptr, "Simulation of an already compiled simulation program without holding the GIL");
+    m.def(
+            "batch_simulation", [](const qc::QuantumComputation& quantumComputation, const std::vector<NBitValuesContainer>& inputs, Statistics* optionalRecordedStatistics, Diagnostics* optionalDiagnostics) {
+                std::vector<NBitValuesContainer> outputs;
+                callWithoutGil(optionalDiagnostics, [&] { batchSimulation(outputs, quantumComputation, inputs, optionalRecordedStatistics); });
+                return outputs;
+            },
+            "quantum_computation"_a, "inputs"_a, "optional_recorded_statistics"_a = nullptr, "optional_diagnostics"_a = nullptr, "Bit-parallel simulation of a synthesized SyReC program for multiple input states without holding the GIL, returns the output states in the order of the input states (or an empty list if the simulation failed)");
+    m.def(
+            "batch_simulation", [](const SimulationProgram& simulationProgram, const std::vector<NBitValuesContainer>& inputs, Statistics* optionalRecordedStatistics, Diagnostics* optionalDiagnostics) {
+                std::vector<NBitValuesContainer> outputs;
+                callWithoutGil(optionalDiagnostics, [&] { batchSimulation(outputs, simulationProgram, inputs, optionalRecordedStatistics); });
+                return outputs;
+            },
+            "simulation_program"_a, "inputs"_a, "optional_recorded_statistics"_a = nullptr, "optional_diagnostics"_a = nullptr, "Bit-parallel simulation of an already compiled simulation program for multiple input states without holding the GIL, returns the output states in the order of the input states (or an empty list if the simulation failed)");
+    m.def(
+            "batch_simulation", [](const FrozenQuantumComputation& frozenQuantumComputation, const std::vector<NBitValuesContainer>& inputs, Statistics* optionalRecordedStatistics, Diagnostics* optionalDiagnostics) {
+                std::vector<NBitValuesContainer> outputs;
+                callWithoutGil(optionalDiagnostics, [&] { batchSimulation(outputs, frozenQuantumComputation, inputs, optionalRecordedStatistics); });
+                return outputs;
+            },
+            "frozen_quantum_computation"_a, "inputs"_a, "optional_recorded_statistics"_a = nullptr, "optional_diagnostics"_a = nullptr, "Bit-parallel simulation of a frozen quantum computation for multiple input states without holding the GIL, returns the output states in the order of the input states (or an empty list if the simulation failed)");
+    m.def(
+            "batch_simulation", [](const qc::QuantumComputation& quantumComputation, const BitValues& inputs, Statistics* optionalRecordedStatistics, Diagnostics* optionalDiagnostics) {
+                const std::vector<NBitValuesContainer> inputStates = createNBitValuesContainersFromBitValues(inputs);
+                std::vector<NBitValuesContainer>       outputStates;
+                callWithoutGil(optionalDiagnostics, [&] { batchSimulation(outputStates, quantumComputation, inputStates, optionalRecordedStatistics); });
+                return exportNBitValuesContainersAsBitValues(outputStates, quantumComputation.getNqubits());
+            },
+            "quantum_computation"_a, "inputs"_a, "optional_recorded_statistics"_a = nullptr, "optional_diagnostics"_a = nullptr, "Bit-parallel simulation of a synthesized SyReC program for the input states stored in the rows of a two-dimensional NumPy uint8 or bool array (with the column q storing the value of qubit q) without holding the GIL, returns the output states in the same form (with no rows if the simulation failed)");
+    m.def(
+            "simulate_batch", [](const qc::QuantumComputation& quantumComputation, const std::optional<IntegerStates>& inputs, Statistics* optionalRecordedStatistics, Diagnostics* optionalDiagnostics, const ProgressCallback& progressCallback) {
+                std::optional<SimulationProgram> simulationProgram;
+                callWithoutGil(optionalDiagnostics, [&] { simulationProgram = SimulationProgram::compile(quantumComputation); });
+                if (!simulationProgram.has_value()) {
+                    return py::array_t<std::uint64_t>(static_cast<py::ssize_t>(0));
+                }
+                if (inputs.has_value()) {
+                    return simulateBatchOfIntegerStates(*simulationProgram, inputs->data(), static_cast<std::size_t>(inputs->size()), optionalRecordedStatistics, optionalDiagnostics, progressCallback);
+                }
+                const std::vector<std::uint64_t> assignmentsOfNonAncillaryQubits = determineAllAssignmentsOfNonAncillaryQubits(quantumComputation);
+                return simulateBatchOfIntegerStates(*simulationProgram, assignmentsOfNonAncillaryQubits.data(), assignmentsOfNonAncillaryQubits.size(), optionalRecordedStatistics, optionalDiagnostics, progressCallback);
+            },
+            "quantum_computation"_a, "inputs"_a = py::none(), "optional_recorded_statistics"_a = nullptr, "optional_diagnostics"_a = nullptr, "progress_callback"_a = py::none(), "Bit-parallel simulation of a synthesized SyReC program with at most 64 qubits for a NumPy array of input states, with the q-th bit of a state storing the value of qubit q, without holding the GIL. If no input states are given, all assignments of the non-ancillary qubits (in ascending order of their value) are simulated with the ancillary qubits initialized to zero. Returns a NumPy array of the output states in the order of the input states (or an empty array if the simulation failed). The optional progress_callback is invoked with a progress_report at most every 100ms as well as once after the simulation completed.");
+    m.def(
+            "simulate_batch", [](const SimulationProgram& simulationProgram, const IntegerStates& inputs, Statistics* optionalRecordedStatistics, Diagnostics* optionalDiagnostics, const ProgressCallback& progressCallback) {
+                return simulateBatchOfIntegerStates(simulationProgram, inputs.data(), static_cast<std::size_t>(inputs.size()), optionalRecordedStatistics, optionalDiagnostics, progressCallback);
+            },
+            "simulation_program"_a, "inputs"_a, "optional_recorded_statistics"_a = nullptr, "optional_diagnostics"_a = nullptr, "progress_callback"_a = py::none(), "Bit-parallel simulation of an already compiled simulation program with at most 64 qubits for a NumPy array of input states, with the q-th bit of a state storing the value of qubit q, without holding the GIL. Returns a NumPy array of the output states in the order of the input states (or an empty array if the simulation failed). The optional progress_callback is invoked with a progress_report at most every 100ms as well as once after the simulation completed.");
+    m.def(
+            "random_stimulus_simulation", [](const qc::QuantumComputation& quantumComputation, const StimulusSimulationSettings& settings, Statistics* optionalRecordedStatistics, Diagnostics* optionalDiagnostics) {
+                StimulusSimulationResult result;
+                callWithoutGil(optionalDiagnostics, [&] { [[maybe_unused]] const bool simulationOk = randomStimulusSimulation(result, quantumComputation, settings, optionalRecordedStatistics); });
+                return result;
+            },
+            "quantum_computation"_a, "settings"_a = StimulusSimulationSettings(), "optional_recorded_statistics"_a = nullptr, "optional_diagnostics"_a = nullptr, "Bit-parallel simulation of a synthesized SyReC program for randomly generated and corner case assignments of its data qubits, with the ancillary qubits initialized to zero, on multiple threads without holding the GIL. Returns the toggle coverage of the qubits (which is empty if the simulation failed)");
+    m.def("determine_single_faults", &determineSingleFaults, "quantum_computation"_a, "Determine all single missing gate, repeated gate and stuck-at faults of a quantum computation consisting only of X and SWAP gates (an empty list if the quantum computation could not be compiled)");
+    m.def(
+            "fault_simulation", [](const qc::QuantumComputation& quantumComputation, const std::vector<ReversibleCircuitFault>& faults, const std::vector<NBitValuesContainer>& inputPatterns, const FaultSimulationSettings& settings, Statistics* optionalRecordedStatistics, Diagnostics* optionalDiagnostics) {
+                FaultSimulationResult result;
+                callWithoutGil(optionalDiagnostics, [&] { [[maybe_unused]] const bool simulationOk = faultSimulation(result, quantumComputation, faults, inputPatterns, settings, optionalRecordedStatistics); });
+                return result;
+            },
+            "quantum_computation"_a, "faults"_a, "input_patterns"_a, "settings"_a = FaultSimulationSettings(), "optional_recorded_statistics"_a = nullptr, "optional_diagnostics"_a = nullptr, "Bit-parallel simulation of single faults of a quantum computation consisting only of X and SWAP gates for the given input patterns on multiple threads without holding the GIL. Returns the input patterns detecting every fault (which is empty if the simulation failed)");
+    m.def(
+            "check_equivalence", [](const qc::QuantumComputation& lhs, const qc::QuantumComputation& rhs, const EquivalenceCheckingSettings& settings, Diagnostics* optionalDiagnostics) {
+                EquivalenceCheckingResult result;
+                callWithoutGil(optionalDiagnostics, [&] { result = checkEquivalence(lhs, rhs, settings); });
+                return result;
+            },
+            "lhs"_a, "rhs"_a, "settings"_a = EquivalenceCheckingSettings(), "optional_diagnostics"_a = nullptr, "Simulation-based check whether two quantum computations consisting only of X and SWAP gates compute the same function of their non-ancillary qubits on their non-garbage qubits, with the ancillary qubits being initialized to zero, without holding the GIL. All assignments are simulated up to the configured number of non-ancillary qubits, otherwise randomly sampled ones");
+    m.def(
+            "check_equivalence_symbolically", [](const qc::QuantumComputation& lhs, const qc::QuantumComputation& rhs, const SymbolicSimulationSettings& settings, Diagnostics* optionalDiagnostics) {
+                EquivalenceCheckingResult result;
+                callWithoutGil(optionalDiagnostics, [&] { result = checkEquivalenceSymbolically(lhs, rhs, settings); });
+                return result;
+            },
+            "lhs"_a, "rhs"_a, "settings"_a = SymbolicSimulationSettings(), "optional_diagnostics"_a = nullptr, "Check whether two quantum computations consisting only of X and SWAP gates compute the same function of their non-ancillary qubits on their non-garbage qubits by simulating them symbolically with one BDD over the non-ancillary qubits per qubit, without holding the GIL. The runtime depends on the size of the BDDs instead of the number of non-ancillary qubits");
+    m.def(
+            "interpret_program", [](const Program& program, std::vector<std::vector<std::uint64_t>> assignments, const ConfigurableOptions& settings, std::size_t numThreads, Statistics* optionalRecordedStatistics, Diagnostics* optionalDiagnostics) {
+                bool interpretationOk = false;
+                callWithoutGil(optionalDiagnostics, [&] { interpretationOk = interpretProgram(assignments, program, settings, numThreads, optionalRecordedStatistics); });
+                return interpretationOk ? assignments : std::vector<std::vector<std::uint64_t>>();
+            },
+            "program"_a, "assignments"_a, "settings"_a = ConfigurableOptions(), "num_threads"_a = 0, "optional_recorded_statistics"_a = nullptr, "optional_diagnostics"_a = nullptr, "Word-level interpretation of a SyReC program for multiple assignments of the variables of its main module on multiple threads without holding the GIL, with an assignment storing the values of the elements of the parameters followed by the ones of the local variables of the main module in declaration order. Returns the assignments after the execution of the program in the order of the given assignments (or an empty list if the interpretation failed)");
+    m.def(
+            "differential_verification", [](const Program& program, const ConfigurableOptions& synthesisSettings, const DifferentialVerificationSettings& settings, Statistics* optionalRecordedStatistics, Diagnostics* optionalDiagnostics) {
+                DifferentialVerificationResult result;
+                callWithoutGil(optionalDiagnostics, [&] { [[maybe_unused]] const bool verificationOk = differentialVerification(result, program, synthesisSettings, settings, optionalRecordedStatistics); });
+                return result;
+            },
+            "program"_a, "synthesis_settings"_a = ConfigurableOptions(), "settings"_a = DifferentialVerificationSettings(), "optional_recorded_statistics"_a = nullptr, "optional_diagnostics"_a = nullptr, "Verify the synthesis of a SyReC program by comparing the bit-parallel simulation of the synthesized quantum computation with the word-level interpretation of the program for randomly generated values of the in, inout and state variables of its main module on multiple threads without holding the GIL. Returns the first mismatching stimulus, if any, together with the number of checked stimuli (which is zero if the verification failed)");
+    m.def(
+            "estimate_resources", [](const Program& program, const ConfigurableOptions& settings, const SynthesisAlgorithm synthesisAlgorithm, Diagnostics* optionalDiagnostics) {
+                std::optional<ResourceEstimate> estimate;
+                callWithoutGil(optionalDiagnostics, [&] {
+                    ResourceEstimate resourceEstimate;
+                    if (estimateResourcesOfSynthesis(resourceEstimate, program, settings, synthesisAlgorithm)) {
+                        estimate = resourceEstimate;
+                    }
+                });
+                return estimate;
+            },
+            "program"_a, "configurable_options"_a = ConfigurableOptions(), "synthesis_algorithm"_a = SynthesisAlgorithm::CostAware, "optional_diagnostics"_a = nullptr, "Predict the number of qubits, quantum operations, quantum cost and transistor cost of the quantum computation synthesized for the SyReC program by the given synthesis algorithm without synthesizing any quantum operation and without holding the GIL. Returns None if the estimation failed with the errors being collected in the diagnostics, if given, and otherwise written to sys.stderr.");
+    m.def(
+            "lower_to_clifford_t", [](const qc::QuantumComputation& quantumComputation, const CliffordTLoweringSettings& settings, Statistics* optionalRecordedStatistics, Diagnostics* optionalDiagnostics) {
+                std::optional<qc::QuantumComputation> loweredQuantumComputation;
+                callWithoutGil(optionalDiagnostics, [&] {
+                    qc::QuantumComputation lowering;
+                    if (lowerToCliffordT(lowering, quantumComputation, settings, optionalRecordedStatistics)) {
+                        loweredQuantumComputation = std::move(lowering);
+                    }
+                });
+                return loweredQuantumComputation;
+            },
+            "quantum_computation"_a, "settings"_a = CliffordTLoweringSettings(), "optional_recorded_statistics"_a = nullptr, "optional_diagnostics"_a = nullptr, "Lower a quantum computation consisting only of (multi-controlled) X and SWAP gates to the Clifford+T gate set without holding the GIL, recording the T-count and T-depth of the lowered quantum computation in the statistics. Returns None if the lowering failed with the errors being collected in the diagnostics, if given, and otherwise written to sys.stderr.");
+    m.def("determine_t_count", &determineTCount, "quantum_computation"_a, "Determine the number of T and T^dagger gates of a quantum computation");
+    m.def("determine_t_depth", &determineTDepth, "quantum_computation"_a, "Determine the maximum number of T and T^dagger gates in a sequence of gates of a quantum computation in which every gate shares a qubit with its successor");
+    m.def(
+            "batch_synthesis", [](const std::vector<std::tuple<const Program*, ConfigurableOptions, SynthesisAlgorithm>>& jobs, std::size_t numThreads) {
+                std::vector<BatchSynthesisJob> batchSynthesisJobs;
+                batchSynthesisJobs.reserve(jobs.size());
+                for (const auto& [program, settings, synthesisAlgorithm]: jobs) {
+                    batchSynthesisJobs.emplace_back(BatchSynthesisJob{.program = program, .settings = settings, .synthesisAlgorithm = synthesisAlgorithm});
+                }
+
+                std::vector<BatchSynthesisResult> batchSynthesisResults;
+                {
+                    const py::gil_scoped_release releasedGil;
+                    batchSynthesis(batchSynthesisResults, batchSynthesisJobs, numThreads);
+                }
+
+                std::vector<std::tuple<bool, std::unique_ptr<AnnotatableQuantumComputation>, Statistics, Diagnostics>> results;
+                results.reserve(batchSynthesisResults.size());
+                for (auto& batchSynthesisResult: batchSynthesisResults) {
+                    results.emplace_back(batchSynthesisResult.synthesisOk, std::move(batchSynthesisResult.annotatableQuantumComputation), batchSynthesisResult.statistics, std::move(batchSynthesisResult.diagnostics));
+                }
+                return results;
+            },
+            "jobs"_a, "num_threads"_a = 0, "Synthesis of multiple independent SyReC programs, each defined as a tuple of the program, the configurable options and the synthesis algorithm, on a pool of threads (a number of threads equal to zero uses one thread per available hardware thread). Returns a tuple of the synthesis result, the synthesized annotatable quantum computation, the recorded statistics and the diagnostics containing the synthesis errors per job in the order of the jobs");
+    py::class_<SynthesisSweepEntry>(m, "synthesis_sweep_entry")
+            .def_readonly("synthesis_ok", &SynthesisSweepEntry::synthesisOk, "Whether the program could be parsed and synthesized with the settings of the variant")
+            .def_readonly("statistics", &SynthesisSweepEntry::statistics, "The statistics recorded during the parsing and synthesis of the variant")
+            .def_readonly("quantum_cost", &SynthesisSweepEntry::quantumCost, "The quantum cost of the synthesized quantum computation")
+            .def_readonly("is_pareto_optimal", &SynthesisSweepEntry::isParetoOptimal, "Whether no other successfully synthesized variant requires at most as many qubits and at most the same quantum cost while improving at least one of them")
+            .def_readonly("index_of_synthesized_variant", &SynthesisSweepEntry::indexOfSynthesizedVariant, "The index of the variant whose synthesis result is reused for this variant")
+            .def_property_readonly("annotatable_quantum_computation", [](const SynthesisSweepEntry& entry) { return entry.annotatableQuantumComputation.get(); }, py::return_value_policy::reference_internal, "The quantum computation synthesized for a Pareto-optimal variant if the quantum computations were kept by the sweep (None otherwise)")
+            .def_readonly("diagnostics", &SynthesisSweepEntry::diagnostics, "The errors reported during the parsing and synthesis of the variant");
+    py::class_<SynthesisSweepResult>(m, "synthesis_sweep_result")
+            .def(py::init<>(), "Constructs an empty result of a synthesis sweep.")
+            .def_readonly("entries", &SynthesisSweepResult::entries, "The results of the variants in the order of the variants")
+            .def_readonly("num_parsed_programs", &SynthesisSweepResult::numParsedPrograms, "The number of times the program was parsed")
+            .def_readonly("num_synthesized_variants", &SynthesisSweepResult::numSynthesizedVariants, "The number of times the program was synthesized");
+    m.def(
+            "synthesis_sweep", [](const std::string& stringifiedProgram, const std::vector<std::tuple<ConfigurableOptions, SynthesisAlgorithm>>& variants, const std::size_t numThreads, const bool keepParetoOptimalQuantumComputations) {
+                std::vector<SynthesisSweepVariant> synthesisSweepVariants;
+                synthesisSweepVariants.reserve(variants.size());
+                for (const auto& [settings, synthesisAlgorithm]: variants) {
+                    synthesisSweepVariants.emplace_back(SynthesisSweepVariant{.settings = settings, .synthesisAlgorithm = synthesisAlgorithm});
+                }
+
+                SynthesisSweepResult result;
+                {
+                    const py::gil_scoped_release releasedGil;
+                    synthesisSweep(result, stringifiedProgram, synthesisSweepVariants, SynthesisSweepSettings{.numThreads = numThreads, .deterministic = false, .keepParetoOptimalQuantumComputations = keepParetoOptimalQuantumComputations});
+                }
+                return result;
+            },
+            "stringified_program"_a, "variants"_a, "num_threads"_a = 0, "keep_pareto_optimal_quantum_computations"_a = false, "Synthesis of a SyReC program under multiple variants, each defined as a tuple of the configurable options and the synthesis algorithm, on a pool of threads with the program only being parsed once per distinct combination of the settings influencing the parser and variants with identical synthesis relevant settings only being synthesized once. Returns the statistics and quantum cost per variant together with the variants that are Pareto-optimal with respect to the number of qubits and the quantum cost");
+    py::class_<OptimizationPassManager>(m, "optimization_pass_manager")
+            .def(py::init<const ConfigurableOptions&>(), "configurable_options"_a = ConfigurableOptions(), "Constructs a pass manager with an empty pipeline whose default passes are parameterized by the given settings, which also define the maximum number of iterations of the pipeline and whether the passes are verified.")
+            .def(
+                    "register_pass", [](OptimizationPassManager& passManager, const std::string& identifier, const py::function& pass) {
+                        // The quantum computation is passed by reference to the Python callable, which must return the number of modifications it performed.
+                        return passManager.registerPass(identifier, [pass](AnnotatableQuantumComputation& annotatableQuantumComputation) {
+                            return pass(py::cast(&annotatableQuantumComputation, py::return_value_policy::reference)).cast<std::size_t>();
+                        });
+                    },
+                    "identifier"_a, "pass"_a, "Register a Python callable, modifying the given annotatable quantum computation in-place and returning the number of performed modifications, as a pass. Returns whether the pass was registered, which is not the case if a pass with the same identifier exists.")
+            .def("is_pass_registered", &OptimizationPassManager::isPassRegistered, "identifier"_a, "Determine whether a pass with the given identifier is registered")
+            .def_property_readonly("registered_passes", &OptimizationPassManager::getIdentifiersOfRegisteredPasses, "Get the identifiers of all registered passes")
+            .def("set_pipeline", &OptimizationPassManager::setPipeline, "identifiers_of_passes"_a, "Define the passes of the pipeline in the order of their application. Returns whether all passes are registered, the pipeline is not modified otherwise.")
+            .def_property_readonly("pipeline", &OptimizationPassManager::getPipeline, "Get the identifiers of the passes of the pipeline")
+            .def_property("max_num_iterations", &OptimizationPassManager::getMaxNumIterations, &OptimizationPassManager::setMaxNumIterations, "The maximum number of iterations of the pipeline, which is repeated until no pass modified the quantum computation")
+            .def("set_verification_of_passes", &OptimizationPassManager::setVerificationOfPasses, "verify_passes"_a, "verification_settings"_a = EquivalenceCheckingSettings(), "Define whether every pass modifying the quantum computation is verified using the bit-parallel simulation of the equivalence check with the given settings")
+            .def_property_readonly("are_passes_verified", &OptimizationPassManager::arePassesVerified, "Determine whether every pass modifying the quantum computation is verified")
+            .def("run", &OptimizationPassManager::run, "annotatable_quantum_computation"_a, "optional_recorded_statistics"_a = nullptr, "Apply the pipeline to the annotatable quantum computation, recording the number of iterations and the statistics of every pass in the optional statistics. Returns false if a pass failed its verification.");
+    m.def("recycle_ancillary_qubits", &recycleAncillaryQubits, "annotatable_quantum_computation"_a, "settings"_a = AncillaryQubitRecyclingSettings(), "Merge the ancillary qubits with non-overlapping live ranges, that are restored to zero for all simulated random input patterns, of the synthesized quantum computation onto the same qubit and verify the result using the batched simulation. Returns the number of removed qubits.");
+    m.def("reorder_qubits_to_reduce_nearest_neighbor_cost", &reorderQubitsToReduceNearestNeighborCost, "annotatable_quantum_computation"_a, "settings"_a = LineOrderingSettings(), "Reorder the qubits of the synthesized quantum computation using simulated annealing to reduce its nearest neighbor cost, with the qubit labels following their qubits. Returns the reduction of the nearest neighbor cost.");
+    m.def("simplify_program", &simplifyProgram, "program"_a, "configurable_options"_a = ConfigurableOptions(), "Perform compile time simplifications of the statements of all modules of the SyReC program (i.e. evaluation of compile time constant expressions, inlining of loops performing a single iteration and removal of statements without effect) prior to its synthesis.");
+    m.def(
+            "optimize_loops", [](Program& program, const LoopOptimizationSettings& settings, const ConfigurableOptions& synthesisSettings, const SynthesisAlgorithm synthesisAlgorithm) {
+                LoopOptimizationReport report;
+                optimizeLoopsOfProgram(program, settings, synthesisSettings, synthesisAlgorithm, &report);
+                return report;
+            },
+            "program"_a, "settings"_a = LoopOptimizationSettings(), "synthesis_settings"_a = ConfigurableOptions(), "synthesis_algorithm"_a = SynthesisAlgorithm::CostAware, "Fuse adjacent loops of the SyReC program performing the same iterations and hoist the loop invariant expressions out of its loops prior to its synthesis. Returns the report of every pass, containing the number of quantum operations removed by the pass as estimated for the given synthesis settings and synthesis algorithm.");
 }
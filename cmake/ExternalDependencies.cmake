@@ -69,6 +69,26 @@ if(BUILD_MQT_SYREC_TESTS)
   list(APPEND FETCH_PACKAGES googletest)
 endif()
 
+if(BUILD_MQT_SYREC_BENCHMARKS)
+  set(BENCHMARK_ENABLE_TESTING
+      OFF
+      CACHE BOOL "" FORCE)
+  set(BENCHMARK_ENABLE_GTEST_TESTS
+      OFF
+      CACHE BOOL "" FORCE)
+  set(BENCHMARK_ENABLE_INSTALL
+      OFF
+      CACHE BOOL "" FORCE)
+  set(GBENCHMARK_VERSION
+      1.9.4
+      CACHE STRING "Google Benchmark version")
+  set(GBENCHMARK_URL
+      https://github.com/google/benchmark/archive/refs/tags/v${GBENCHMARK_VERSION}.tar.gz)
+  FetchContent_Declare(googlebenchmark URL ${GBENCHMARK_URL} FIND_PACKAGE_ARGS ${GBENCHMARK_VERSION}
+                                                                           NAMES benchmark)
+  list(APPEND FETCH_PACKAGES googlebenchmark)
+endif()
+
 # The original CMake configuration in the ANTLR C++ git repository
 # (https://github.com/antlr/antlr4/blob/master/runtime/Cpp/cmake/ExternalAntlr4Cpp.cmake) uses the
 # ExternalProject_XX functions to configure the built of the ANTLR runtime and serves as a reference
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/annotatable_quantum_computation.hpp"
+
+#include <cstddef>
+
+namespace syrec {
+    /**
+     * The settings of recycleAncillaryQubits(...).
+     */
+    struct AncillaryQubitRecyclingSettings {
+        /**
+         * The maximum number of non-ancillary qubits of a quantum computation whose assignments are simulated to determine whether an ancillary qubit is restored to zero and to verify the recycled quantum computation.
+         * Quantum computations with more non-ancillary qubits are not recycled. Values larger than 63 are treated like 63.
+         */
+        std::size_t maxNumInputsOfExhaustiveCheck = 20U;
+    };
+
+    /**
+     * @brief Reduce the number of qubits of a synthesized quantum computation by merging ancillary qubits with non-overlapping live ranges onto the same qubit
+     *
+     * The live range of an ancillary qubit spans from the first to the last quantum operation accessing it. An ancillary qubit is considered to be restored to its initial value of zero at the end of its
+     * live range if its value is zero after the simulation of the quantum computation for all assignments of the non-ancillary qubits, with the ancillary qubits initialized to zero. Restored ancillary qubits are assigned,
+     * in the order of the start of their live range, to the first ancillary qubit whose live range ended before (greedy interval partitioning) while ancillary qubits not accessed by any quantum operation are
+     * removed. Ancillary qubits not restored to zero keep their qubit. Prior to modifying the quantum computation, the merged quantum computation is verified against the original one using the batched simulation
+     * of all assignments of the non-ancillary qubits.
+     *
+     * @param annotatableQuantumComputation The quantum computation whose ancillary qubits shall be recycled. Must neither contain quantum operations that are not standard operations nor quantum operations already forwarded to a quantum operation sink.
+     * @param settings The settings of the recycling.
+     * @return The number of removed qubits, zero if the quantum computation was not modified because no ancillary qubits could be merged, the verification failed, the quantum computation has more non-ancillary qubits than
+     * AncillaryQubitRecyclingSettings::maxNumInputsOfExhaustiveCheck or did not satisfy the requirements of the recycling.
+     * @remark The qubits of the quantum computation are renumbered (see AnnotatableQuantumComputation::relocateAncillaryQubits(...)), the recycling should thus only be performed after the synthesis of the quantum computation was completed.
+     */
+    [[maybe_unused]] std::size_t recycleAncillaryQubits(AnnotatableQuantumComputation& annotatableQuantumComputation, const AncillaryQubitRecyclingSettings& settings = {});
+} // namespace syrec
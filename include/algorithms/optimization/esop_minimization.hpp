@@ -13,13 +13,19 @@
 #include "core/truthTable/truth_table.hpp"
 
 #include <algorithm>
+#include <array>
 #include <bitset>
 #include <cassert>
+#include <compare>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <numeric>
 #include <ostream>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -31,85 +37,173 @@ namespace minbool {
         return std::bitset<64U>(n).count();
     }
 
-    struct MinTerm {
+    // The bits of a minterm with more than 64 positions, with the bit i being stored in the bit (i % 64) of the (i / 64)-th word.
+    template<std::size_t NumWords>
+    struct WideWord {
+        std::array<std::uint64_t, NumWords> words{};
+
+        friend WideWord operator&(WideWord lhs, const WideWord& rhs) {
+            for (std::size_t k = 0U; k < NumWords; ++k) {
+                lhs.words[k] &= rhs.words[k];
+            }
+            return lhs;
+        }
+
+        friend WideWord operator|(WideWord lhs, const WideWord& rhs) {
+            for (std::size_t k = 0U; k < NumWords; ++k) {
+                lhs.words[k] |= rhs.words[k];
+            }
+            return lhs;
+        }
+
+        friend WideWord operator^(WideWord lhs, const WideWord& rhs) {
+            for (std::size_t k = 0U; k < NumWords; ++k) {
+                lhs.words[k] ^= rhs.words[k];
+            }
+            return lhs;
+        }
+
+        friend WideWord operator~(WideWord word) {
+            for (auto& w: word.words) {
+                w = ~w;
+            }
+            return word;
+        }
+
+        friend auto operator<=>(const WideWord& lhs, const WideWord& rhs) = default;
+    };
+
+    // The word storing the bits of a minterm with at most 64 * NumWords positions, minterms with at most 64 positions are stored in a single 64-bit integer.
+    template<std::size_t NumWords>
+    using MinTermWord = std::conditional_t<NumWords == 1U, std::uint64_t, WideWord<NumWords>>;
+
+    template<std::size_t NumWords>
+    std::size_t popcount(const WideWord<NumWords>& word) {
+        std::size_t count = 0U;
+        for (const auto w: word.words) {
+            count += popcount(w);
+        }
+        return count;
+    }
+
+    inline bool testBit(const std::uint64_t word, const std::size_t i) {
+        return ((word >> i) & 1U) == 1U;
+    }
+
+    template<std::size_t NumWords>
+    bool testBit(const WideWord<NumWords>& word, const std::size_t i) {
+        return testBit(word.words[i / 64U], i % 64U);
+    }
+
+    inline std::uint64_t withBit(const std::uint64_t word, const std::size_t i) {
+        return word | (static_cast<std::uint64_t>(1U) << i);
+    }
+
+    template<std::size_t NumWords>
+    WideWord<NumWords> withBit(WideWord<NumWords> word, const std::size_t i) {
+        word.words[i / 64U] = withBit(word.words[i / 64U], i % 64U);
+        return word;
+    }
+
+    template<std::size_t NumWords>
+    struct BasicMinTerm {
         using Value = syrec::TruthTable::Cube::Value;
+        using Word  = MinTermWord<NumWords>;
 
-        explicit MinTerm(const std::uint64_t value = 0U, const std::uint64_t dash = 0U):
+        explicit BasicMinTerm(const Word& value = Word{}, const Word& dash = Word{}):
             value(value),
             dash(dash) {}
 
         Value operator[](const std::size_t i) const {
-            if (((dash >> i) & 1U) == 1U) {
+            if (testBit(dash, i)) {
                 return {};
             }
-            return {((value >> i) & 1U) == 1U};
+            return {testBit(value, i)};
         }
 
-        [[nodiscard]] MinTerm combine(const MinTerm& other) const {
-            const std::uint64_t mask = (value ^ other.value) | (dash ^ other.dash);
-            return MinTerm{value & ~mask, dash | mask};
+        [[nodiscard]] BasicMinTerm combine(const BasicMinTerm& other) const {
+            const Word mask = (value ^ other.value) | (dash ^ other.dash);
+            return BasicMinTerm{value & ~mask, dash | mask};
         }
 
         template<typename F>
-        void foreachValue(F f, const std::size_t n, const std::size_t bit = 0U, const std::uint64_t cur = 0U) const {
+        void foreachValue(F f, const std::size_t n, const std::size_t bit = 0U, const Word& cur = Word{}) const {
             if (bit == n) {
                 f(cur);
             } else {
                 const auto val = (*this)[bit];
                 if (val == Value{}) {
                     foreachValue(f, n, bit + 1U, cur);
-                    foreachValue(f, n, bit + 1U, cur | (1 << bit));
+                    foreachValue(f, n, bit + 1U, withBit(cur, bit));
                 } else {
                     if (val == Value{false}) {
                         foreachValue(f, n, bit + 1U, cur);
                     } else {
-                        foreachValue(f, n, bit + 1U, cur | (1U << bit));
+                        foreachValue(f, n, bit + 1U, withBit(cur, bit));
                     }
                 }
             }
         }
 
-        friend bool operator<(const MinTerm& lhs, const MinTerm& rhs) {
+        friend bool operator<(const BasicMinTerm& lhs, const BasicMinTerm& rhs) {
             return lhs.value < rhs.value || (lhs.value == rhs.value && lhs.dash < rhs.dash);
         }
 
-        friend bool operator==(const MinTerm& lhs, const MinTerm& rhs) {
+        friend bool operator==(const BasicMinTerm& lhs, const BasicMinTerm& rhs) {
             return lhs.value == rhs.value && lhs.dash == rhs.dash;
         }
 
-        std::uint64_t value;
-        std::uint64_t dash;
+        Word value;
+        Word dash;
     };
 
+    using MinTerm = BasicMinTerm<1U>;
+
 } // namespace minbool
 
 namespace std {
-    template<>
-    struct hash<minbool::MinTerm> {
-        auto operator()(const minbool::MinTerm& term) const -> size_t {
-            return (33 * term.value ^ term.dash);
+    template<std::size_t NumWords>
+    struct hash<minbool::WideWord<NumWords>> {
+        auto operator()(const minbool::WideWord<NumWords>& word) const -> size_t {
+            size_t hashValue = 0U;
+            for (const auto w: word.words) {
+                hashValue = 33 * hashValue ^ w;
+            }
+            return hashValue;
+        }
+    };
+
+    template<std::size_t NumWords>
+    struct hash<minbool::BasicMinTerm<NumWords>> {
+        auto operator()(const minbool::BasicMinTerm<NumWords>& term) const -> size_t {
+            if constexpr (NumWords == 1U) {
+                return (33 * term.value ^ term.dash);
+            } else {
+                return 33 * hash<minbool::WideWord<NumWords>>()(term.value) ^ hash<minbool::WideWord<NumWords>>()(term.dash);
+            }
         }
     };
 } // namespace std
 
 namespace minbool {
 
+    template<std::size_t NumWords = 1U>
     struct ImplicantTable {
-        std::vector<std::size_t> groups;
-        std::vector<bool>        marks;
-        std::vector<MinTerm>     terms;
-        std::size_t              nBits;
+        std::vector<std::size_t>            groups;
+        std::vector<bool>                   marks;
+        std::vector<BasicMinTerm<NumWords>> terms;
+        std::size_t                         nBits;
 
         explicit ImplicantTable(const std::size_t nBits):
             nBits(nBits) {}
 
         [[nodiscard]] std::size_t size() const { return terms.size(); }
 
-        void fill(const std::vector<MinTerm>& minterms);
+        void fill(const std::vector<BasicMinTerm<NumWords>>& minterms);
 
-        void combine(std::vector<MinTerm>& res);
+        void combine(std::vector<BasicMinTerm<NumWords>>& res);
 
-        void primes(std::vector<MinTerm>& res) {
+        void primes(std::vector<BasicMinTerm<NumWords>>& res) {
             const auto nTerms = terms.size();
             for (std::size_t i = 0U; i < nTerms; ++i) {
                 if (!marks[i]) {
@@ -119,9 +213,10 @@ namespace minbool {
         }
     };
 
+    template<std::size_t NumWords = 1U>
     struct PrimeChart {
-        std::unordered_map<std::uint64_t, std::vector<MinTerm>> columns;
-        std::size_t                                             nBits;
+        std::unordered_map<MinTermWord<NumWords>, std::vector<BasicMinTerm<NumWords>>> columns;
+        std::size_t                                                                    nBits;
 
         explicit PrimeChart(const std::size_t nBits):
             nBits(nBits) {}
@@ -130,21 +225,68 @@ namespace minbool {
             return columns.size();
         }
 
-        void fill(const std::vector<MinTerm>& primes);
+        void fill(const std::vector<BasicMinTerm<NumWords>>& primes);
 
-        bool removeEssentials(std::vector<MinTerm>& essentials);
+        bool removeEssentials(std::vector<BasicMinTerm<NumWords>>& essentials);
 
-        void removeHeuristic(std::vector<MinTerm>& solution);
+        void removeHeuristic(std::vector<BasicMinTerm<NumWords>>& solution);
 
         bool simplify();
     };
 
-    std::vector<MinTerm> primeImplicants(std::vector<MinTerm>& terms, const std::size_t& n);
+    // The Quine–McCluskey algorithm is implemented for minterms consisting of one and two words (i.e. at most 128 positions), see MAX_NUM_WORDS_OF_EXACTLY_MINIMIZED_ON_SET.
+    template<std::size_t NumWords>
+    std::vector<BasicMinTerm<NumWords>> primeImplicants(std::vector<BasicMinTerm<NumWords>>& terms, const std::size_t& n);
+
+    template<std::size_t NumWords>
+    bool evalBoolean(const std::vector<BasicMinTerm<NumWords>>& solution, const MinTermWord<NumWords>& v, const std::size_t& n);
+
+    // Checks whether every on-value is covered by the solution while every term of the solution only covers on-values.
+    template<std::size_t NumWords>
+    bool checkSolution(const std::vector<BasicMinTerm<NumWords>>& solution, const std::unordered_set<MinTermWord<NumWords>>& onValues, const std::size_t& n);
 
-    bool evalBoolean(const std::vector<MinTerm>& solution, std::uint64_t v, const std::size_t& n);
+    // On-sets of cubes with more than 64 * MAX_NUM_WORDS_OF_EXACTLY_MINIMIZED_ON_SET positions are minimized heuristically.
+    constexpr std::size_t MAX_NUM_WORDS_OF_EXACTLY_MINIMIZED_ON_SET = 2U;
 
-    bool checkSolution(const std::vector<MinTerm>& solution, const std::unordered_set<std::uint64_t>& onValues, const std::size_t& n);
+    // On-sets consisting of more cubes are minimized heuristically since the number of implicants generated by the Quine–McCluskey algorithm grows exponentially in practice.
+    constexpr std::size_t MAX_NUM_CUBES_OF_EXACTLY_MINIMIZED_ON_SET = 256U;
 
     syrec::TruthTable::Cube::Set minimizeBoolean(syrec::TruthTable::Cube::Set const& sigVec);
 
+    // Espresso-style heuristic minimization (expand, irredundant and reduce) of an on-set of fully specified cubes with an arbitrary number of positions.
+    // Every cube of the result only covers cubes of the on-set while every cube of the on-set is covered by at least one cube of the result.
+    syrec::TruthTable::Cube::Set minimizeBooleanHeuristically(syrec::TruthTable::Cube::Set const& sigVec);
+
+    // Cache of the minimized expressions of already minimized on-sets, with the on-sets being identified by the hash of their (canonically ordered) cubes.
+    class MinimizedExpressionCache {
+    public:
+        syrec::TruthTable::Cube::Set minimize(syrec::TruthTable::Cube::Set const& sigVec);
+
+        void clear() {
+            minimizedExpressionsPerOnSetHash.clear();
+        }
+
+    private:
+        std::unordered_map<std::size_t, std::vector<std::pair<syrec::TruthTable::Cube::Set, syrec::TruthTable::Cube::Set>>> minimizedExpressionsPerOnSetHash;
+    };
+
+    // Appends the cubes covering the minterms of the minuend not covered by the subtrahend (i.e. the sharp product of both cubes), which are disjoint from each other.
+    void subtractCube(const syrec::TruthTable::Cube& minuend, const syrec::TruthTable::Cube& subtrahend, syrec::TruthTable::Cube::Vector& difference);
+
+    // Determines disjoint cubes covering the same minterms as the given (possibly overlapping and not fully specified) cubes, with the cubes with the most don't cares being processed first to reduce the number of cubes they are split into.
+    // The sum of the disjoint cubes is thus also an exclusive sum of products (ESOP) of the covered minterms.
+    syrec::TruthTable::Cube::Vector makeDisjoint(syrec::TruthTable::Cube::Vector cubes);
+
+    // A product term of a multi-output ESOP, i.e. a cube of the inputs together with the outputs whose ESOP contains the cube (the j-th entry being associated with the j-th output).
+    struct EsopTerm {
+        syrec::TruthTable::Cube cube;
+        std::vector<bool>       outputs;
+    };
+
+    // Determines a multi-output ESOP of a (not necessarily complete) truth table, whose j-th output is 1 for all completions of the inputs of the entries whose j-th output is 1 (outputs being don't cares are treated as 0),
+    // with the outputs of inputs covered by several entries being resolved like in syrec::extend(...). The entries are split into disjoint cubes, which are merged into terms with the same cube. Afterwards, the outputs shared by two terms
+    // whose cubes differ in exactly one position are repeatedly moved to the term of the merged cube (using a ⊕ a' = - and - ⊕ a = a' for the value a of the position), which strictly decreases the sum of the numbers of outputs of all terms.
+    // The runtime thus depends on the number of entries of the truth table instead of its number of minterms.
+    std::vector<EsopTerm> minimizeMultiOutputEsop(syrec::TruthTable const& tt);
+
 } // namespace minbool
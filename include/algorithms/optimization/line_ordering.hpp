@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/annotatable_quantum_computation.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace syrec {
+    /**
+     * The settings of reorderQubitsToReduceNearestNeighborCost(...).
+     */
+    struct LineOrderingSettings {
+        /**
+         * The number of moves (i.e. exchanges of the positions of two qubits) evaluated by the simulated annealing per qubit of the quantum computation.
+         */
+        std::size_t numMovesPerQubit = 200U;
+        /**
+         * The seed of the randomly selected moves.
+         */
+        std::uint64_t seed = 0U;
+    };
+
+    /**
+     * @brief Reduce the nearest neighbor cost of a synthesized quantum computation (see AnnotatableQuantumComputation::determineNearestNeighborCost()) by reordering its qubits
+     *
+     * The gates of the quantum computation are grouped by the set of qubits they operate on, with every group being weighted by its number of gates. Starting from the order of the qubits determined by the synthesis, simulated annealing
+     * repeatedly exchanges the positions of two randomly selected qubits, only re-evaluating the nearest neighbor cost of the groups containing exactly one of them, and accepts a move increasing the cost by d with probability exp(-d / T).
+     * The temperature T is initialized to the average cost increase of a set of random moves and decreased geometrically to a thousandth of its initial value. The qubits are permuted according to the order with the lowest encountered cost.
+     *
+     * @param annotatableQuantumComputation The quantum computation whose qubits shall be reordered. Must neither contain quantum operations that are not standard operations nor quantum operations already forwarded to a quantum operation sink.
+     * @param settings The settings of the reordering.
+     * @return The reduction of the nearest neighbor cost, zero if the quantum computation was not modified because no order with a lower cost was found or the quantum computation did not satisfy the requirements of AnnotatableQuantumComputation::permuteQubits(...).
+     * @remark The qubits of the quantum computation are renumbered with the qubit labels following their qubits, the reordering should thus only be performed after the synthesis and any recycling of ancillary qubits of the quantum computation was completed.
+     */
+    [[maybe_unused]] AnnotatableQuantumComputation::SynthesisCostMetricValue reorderQubitsToReduceNearestNeighborCost(AnnotatableQuantumComputation& annotatableQuantumComputation, const LineOrderingSettings& settings = {});
+} // namespace syrec
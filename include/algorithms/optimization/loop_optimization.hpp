@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "core/configurable_options.hpp"
+#include "core/syrec/program.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace syrec {
+    /**
+     * The passes of optimizeLoopsOfProgram(...) that shall be performed.
+     */
+    struct LoopOptimizationSettings {
+        /**
+         * Fuse adjacent loops performing the same iterations into a single loop.
+         */
+        bool fuseAdjacentLoops = true;
+        /**
+         * Hoist the computation of expressions not depending on the iterations of a loop out of the loop.
+         */
+        bool hoistLoopInvariantExpressions = true;
+    };
+
+    /**
+     * The transformations performed by a single pass of optimizeLoopsOfProgram(...).
+     */
+    struct LoopOptimizationPassReport {
+        /**
+         * The number of fused loops respectively the number of hoisted expressions.
+         */
+        std::size_t numTransformations = 0;
+        /**
+         * The number of quantum operations synthesized for the program prior to the pass as predicted by estimateResourcesOfSynthesis(...), std::nullopt if the estimation failed.
+         */
+        std::optional<std::size_t> estimatedNumQuantumOperationsPriorToPass;
+        /**
+         * The number of quantum operations synthesized for the program after the pass as predicted by estimateResourcesOfSynthesis(...), std::nullopt if the estimation failed.
+         */
+        std::optional<std::size_t> estimatedNumQuantumOperationsAfterPass;
+
+        /**
+         * @brief Get the number of quantum operations removed by the pass.
+         * @return The number of removed quantum operations (which is negative if the pass increased the number of quantum operations), std::nullopt if any of the estimations failed.
+         */
+        [[nodiscard]] std::optional<std::int64_t> getEstimatedNumRemovedQuantumOperations() const {
+            if (!estimatedNumQuantumOperationsPriorToPass.has_value() || !estimatedNumQuantumOperationsAfterPass.has_value()) {
+                return std::nullopt;
+            }
+            return static_cast<std::int64_t>(*estimatedNumQuantumOperationsPriorToPass) - static_cast<std::int64_t>(*estimatedNumQuantumOperationsAfterPass);
+        }
+    };
+
+    /**
+     * The per-pass report of optimizeLoopsOfProgram(...), the report of a pass that was not performed is empty.
+     */
+    struct LoopOptimizationReport {
+        LoopOptimizationPassReport loopFusion;
+        LoopOptimizationPassReport loopInvariantCodeMotion;
+    };
+
+    /**
+     * @brief Optimize the loops of all modules of a SyReC program prior to its synthesis
+     *
+     * The following passes are performed in the statements of every module:
+     * I.  Loop fusion: Adjacent loops with compile time constant and equal start values, end values and step sizes are fused into a single loop if the loop bodies do not depend on each other,
+     *     i.e. a variable modified in one of the loop bodies is not accessed in the other one unless all accesses of the variable in both loop bodies access the element selected by the loop variable. <br>
+     * II. Loop invariant code motion: Subexpressions of the right-hand sides of assignments in the body of a loop that neither use a loop variable nor access a variable modified in the loop body are computed
+     *     into a new local wire variable of the module prior to the loop and reverted after the loop, with the hoisted subexpression being replaced by an access of the wire variable. Only the
+     *     expressions of loops performing at least three iterations are hoisted since the computation and the uncomputation of the hoisted expression are only amortized over multiple iterations. <br>
+     *
+     * The statements are optimized in-place while the replaced IR nodes are not modified, thus IR nodes shared with other statements remain valid.
+     *
+     * @param program The program whose modules shall be optimized.
+     * @param settings The passes that shall be performed.
+     * @param synthesisSettings The settings later used during synthesis, only used to estimate the number of quantum operations removed by a pass.
+     * @param synthesisAlgorithm The synthesizer later used to synthesize the program, only used to estimate the number of quantum operations removed by a pass.
+     * @param optionalReport The report of the transformations of every pass, the number of quantum operations is only estimated if a report is requested.
+     */
+    void optimizeLoopsOfProgram(Program& program, const LoopOptimizationSettings& settings = LoopOptimizationSettings{}, const ConfigurableOptions& synthesisSettings = ConfigurableOptions{},
+                                SynthesisAlgorithm synthesisAlgorithm = SynthesisAlgorithm::CostAware, LoopOptimizationReport* optionalReport = nullptr);
+} // namespace syrec
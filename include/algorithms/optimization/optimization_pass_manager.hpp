@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "algorithms/simulation/equivalence_checking.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/statistics.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace syrec {
+    /**
+     * @brief Compose the optimizations of a synthesized quantum computation into a pipeline of named passes.
+     *
+     * The following passes are registered by default (with the parameters of the passes being taken from the syrec::ConfigurableOptions used to construct the pass manager):
+     * - 'propagate_constant_qubit_values' (see AnnotatableQuantumComputation::propagateConstantQubitValues())
+     * - 'apply_reversible_circuit_templates' (see AnnotatableQuantumComputation::applyReversibleCircuitTemplates(...))
+     * - 'cancel_adjacent_self_inverse_quantum_operations' (see AnnotatableQuantumComputation::cancelAdjacentSelfInverseQuantumOperations())
+     * - 'reorder_quantum_operations_to_reduce_depth' (see AnnotatableQuantumComputation::reorderQuantumOperationsToReduceDepth())
+     * - 'recycle_ancillary_qubits' (see recycleAncillaryQubits(...))
+     *
+     * The passes of the pipeline are applied in their order, with the pipeline being repeated until it reached a fixed point (i.e. no pass modified the quantum computation) or the maximum number of iterations was performed.
+     * The runtime, the number of modifications and the change of the number of quantum operations and qubits are recorded per pass.
+     */
+    class OptimizationPassManager {
+    public:
+        /**
+         * A pass modifies the quantum computation in-place and returns the number of modifications it performed (i.e. the number of removed quantum operations), zero if the quantum computation was not modified.
+         */
+        using Pass = std::function<std::size_t(AnnotatableQuantumComputation&)>;
+
+        static constexpr std::string_view PROPAGATE_CONSTANT_QUBIT_VALUES_PASS                 = "propagate_constant_qubit_values";
+        static constexpr std::string_view APPLY_REVERSIBLE_CIRCUIT_TEMPLATES_PASS              = "apply_reversible_circuit_templates";
+        static constexpr std::string_view CANCEL_ADJACENT_SELF_INVERSE_QUANTUM_OPERATIONS_PASS = "cancel_adjacent_self_inverse_quantum_operations";
+        static constexpr std::string_view REORDER_QUANTUM_OPERATIONS_TO_REDUCE_DEPTH_PASS      = "reorder_quantum_operations_to_reduce_depth";
+        static constexpr std::string_view RECYCLE_ANCILLARY_QUBITS_PASS                        = "recycle_ancillary_qubits";
+
+        /**
+         * @brief Construct a pass manager with an empty pipeline whose default passes are registered.
+         * @param settings The settings defining the parameters of the default passes, the maximum number of iterations of the pipeline (see ConfigurableOptions::maxNumIterationsOfOptimizationPipeline) and whether the passes are verified (see ConfigurableOptions::verifyPassesOfOptimizationPipeline).
+         */
+        explicit OptimizationPassManager(const ConfigurableOptions& settings = ConfigurableOptions{});
+
+        /**
+         * @brief Register a pass usable in the pipeline.
+         * @param identifier The identifier of the pass.
+         * @param pass The pass.
+         * @return Whether the pass was registered, which is not the case if a pass with the same identifier was already registered or the pass was empty.
+         */
+        [[nodiscard]] bool registerPass(const std::string& identifier, Pass pass);
+
+        [[nodiscard]] bool isPassRegistered(std::string_view identifier) const;
+
+        /**
+         * @brief Get the identifiers of all registered passes in lexicographical order.
+         */
+        [[nodiscard]] std::vector<std::string> getIdentifiersOfRegisteredPasses() const;
+
+        /**
+         * @brief Define the passes of the pipeline.
+         * @param identifiersOfPasses The identifiers of the passes in the order in which they are applied, a pass can be applied multiple times per iteration of the pipeline.
+         * @return Whether all passes were registered, the pipeline is not modified otherwise.
+         */
+        [[nodiscard]] bool setPipeline(const std::vector<std::string>& identifiersOfPasses);
+
+        [[nodiscard]] const std::vector<std::string>& getPipeline() const noexcept {
+            return pipeline;
+        }
+
+        void setMaxNumIterations(const std::size_t maxNumIterations) noexcept {
+            this->maxNumIterations = maxNumIterations;
+        }
+
+        [[nodiscard]] std::size_t getMaxNumIterations() const noexcept {
+            return maxNumIterations;
+        }
+
+        /**
+         * @brief Define whether the quantum computation is verified after every pass that modified it.
+         *
+         * The quantum computation prior to the pass is compared to the one after the pass using the bit-parallel simulation of checkEquivalence(...), which is skipped for quantum computations containing gates not supported by the latter
+         * or quantum operations already forwarded to a quantum operation sink.
+         *
+         * @param verifyPasses Whether the passes shall be verified.
+         * @param verificationSettings The settings of the equivalence check.
+         */
+        void setVerificationOfPasses(bool verifyPasses, const EquivalenceCheckingSettings& verificationSettings);
+
+        [[nodiscard]] bool arePassesVerified() const noexcept {
+            return verifyPasses;
+        }
+
+        /**
+         * @brief Apply the pipeline to a quantum computation.
+         *
+         * @param annotatableQuantumComputation The quantum computation to optimize.
+         * @param optionalRecordedStatistics An optional container in which the number of performed iterations of the pipeline and the statistics of every pass (accumulated over all of its applications) are recorded.
+         * @return Whether all passes were applied successfully, false if a pass failed its verification with the pipeline being aborted after the pass and the error being reported in the error stream.
+         */
+        [[nodiscard]] bool run(AnnotatableQuantumComputation& annotatableQuantumComputation, Statistics* optionalRecordedStatistics = nullptr) const;
+
+    protected:
+        std::map<std::string, Pass, std::less<>> registeredPasses;
+        std::vector<std::string>                 pipeline;
+        std::size_t                              maxNumIterations = 1U;
+        bool                                     verifyPasses     = false;
+        EquivalenceCheckingSettings              verificationSettings;
+    };
+} // namespace syrec
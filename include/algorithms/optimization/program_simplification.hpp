@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/configurable_options.hpp"
+#include "core/syrec/program.hpp"
+
+namespace syrec {
+    /**
+     * @brief Perform compile time simplifications of the statements of all modules of a SyReC program prior to its synthesis
+     *
+     * The following simplifications are performed in the statements of every module:
+     * I.    Loops performing a single iteration are replaced by their body with every usage of the loop variable being replaced by its value in said iteration. <br>
+     * II.   Compile time constant expressions and numbers are replaced by their value. Integer constant values are not truncated, similarly to the evaluation of compile time constant expressions performed during synthesis. <br>
+     * III.  Skip statements as well as assignments whose right-hand side evaluates to zero are removed. <br>
+     * IV.   If statements whose guard and closing guard condition both evaluate to the same truth value are replaced by the statements of the executed branch. If statements with empty branches are removed. <br>
+     * V.    Loops performing no iteration or without any statement in their body are removed. <br>
+     * VI.   Calls and uncalls of modules without any statement in their body are removed. <br>
+     *
+     * The statements are simplified in-place while the replaced IR nodes are not modified, thus IR nodes shared with other statements remain valid.
+     *
+     * @param program The program whose modules shall be simplified.
+     * @param settings The settings defining the truncation of integer constant values used to determine the truth value of the guard conditions of if statements (should match the settings later used during synthesis).
+     */
+    void simplifyProgram(Program& program, const ConfigurableOptions& settings = ConfigurableOptions{});
+} // namespace syrec
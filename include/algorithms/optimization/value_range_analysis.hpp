@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/syrec/expression.hpp"
+#include "core/syrec/number.hpp"
+#include "core/syrec/parser/utils/syrec_operation_utils.hpp"
+
+#include <bit>
+#include <cstdint>
+#include <optional>
+
+namespace syrec {
+    /**
+     * @brief The range of the unsigned values an expression can evaluate to.
+     *
+     * All bits of a value above the most significant bit of the upper bound of the range are known to be zero.
+     */
+    struct ValueRange {
+        std::uint64_t minValue = 0;
+        std::uint64_t maxValue = 0;
+        /**
+         * The number of qubits storing the value of the expression during synthesis.
+         */
+        unsigned bitwidth = 0;
+
+        [[nodiscard]] bool isConstant() const noexcept {
+            return minValue == maxValue;
+        }
+
+        [[nodiscard]] unsigned getNumberOfSignificantBits() const noexcept {
+            return static_cast<unsigned>(std::bit_width(maxValue));
+        }
+
+        [[nodiscard]] bool operator==(const ValueRange& other) const noexcept = default;
+    };
+
+    /**
+     * @brief Determine the range of values of an expression by abstract interpretation of its operations.
+     *
+     * The range of a variable access covers all values of the accessed bits since the value of a variable depends on the statements executed prior to the expression. Integer constants and loop variables are
+     * replaced by their value, which is truncated to the expected bitwidth of the operands of the enclosing binary expression like during synthesis, thus the expression is assumed to be simplified like by
+     * SyrecSynthesis::performCompileTimeSimplificationsOfExpression(...). The results of logical and relational operations are in the range [0, 1] unless the ranges of their operands determine their truth value.
+     * An operation whose result could wrap around results in the range of all values of its bitwidth.
+     *
+     * @param expression The expression whose range of values shall be determined.
+     * @param loopVariableValues The values of the loop variables used in the expression.
+     * @param expectedBitwidth The bitwidth to which an integer constant is truncated, std::nullopt if the bitwidth of the constant should not be changed (with an integer constant being stored in 32 bits).
+     * @param integerConstantTruncationOperation The operation used to truncate integer constants.
+     * @return The range of values of the expression, std::nullopt if an integer constant, a loop variable or the bitrange of a variable access could not be evaluated or the bitwidths of the operands of a binary expression do not match.
+     */
+    [[nodiscard]] std::optional<ValueRange> determineValueRangeOfExpression(const Expression& expression, const Number::LoopVariableMapping& loopVariableValues, const std::optional<unsigned>& expectedBitwidth = std::nullopt,
+                                                                            utils::IntegerConstantTruncationOperation integerConstantTruncationOperation = utils::IntegerConstantTruncationOperation::BitwiseAnd);
+
+    /**
+     * @brief Determine the number of least significant bits of the operands of a binary expression that suffice to compute its result.
+     *
+     * The operation applied to the least significant bits of its operands computes the same value as the operation applied to all bits of its operands if all omitted bits of the result are known to be zero,
+     * e.g. the sum of two operands whose values are at most 3 fits into the three least significant bits of the result. The logical operations are not narrowed since their operands are single bits.
+     *
+     * @param expression The binary expression to narrow.
+     * @param loopVariableValues The values of the loop variables used in the expression.
+     * @param integerConstantTruncationOperation The operation used to truncate integer constants.
+     * @return The number of required bits of the operands if it is smaller than the bitwidth of the operands, otherwise std::nullopt.
+     */
+    [[nodiscard]] std::optional<unsigned> determineNumberOfOperandBitsRequiredByBinaryOperation(const BinaryExpression& expression, const Number::LoopVariableMapping& loopVariableValues,
+                                                                                               utils::IntegerConstantTruncationOperation integerConstantTruncationOperation = utils::IntegerConstantTruncationOperation::BitwiseAnd);
+} // namespace syrec
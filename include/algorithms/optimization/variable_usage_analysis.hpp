@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/syrec/expression.hpp"
+#include "core/syrec/number.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace syrec {
+    /**
+     * The usages of a variable in a sequence of statements.
+     */
+    struct VariableUsage {
+        /**
+         * Whether the variable is modified by any of the statements.
+         */
+        bool isModified = false;
+        /**
+         * Whether the variable is passed as a parameter to a called or uncalled module, which can modify any element of the variable.
+         */
+        bool isPassedToModule = false;
+        /**
+         * The variable accesses of the variable, the parameters of called or uncalled modules are not recorded as variable accesses.
+         */
+        std::vector<const VariableAccess*> accesses;
+    };
+
+    /**
+     * The variables and loop variables used in a sequence of statements, with the variables being identified by their name in the module declaring the statements.
+     */
+    struct UsagesOfStatements {
+        std::unordered_map<std::string, VariableUsage> variables;
+        std::unordered_set<std::string>                usedLoopVariables;
+        std::unordered_set<std::string>                declaredLoopVariables;
+
+        /**
+         * @brief Determine whether the statements depend on another sequence of statements.
+         *
+         * Two sequences of statements are independent if no variable modified in one of them is accessed in the other one, thus they can be executed in any order.
+         *
+         * @param other The usages of the other sequence of statements.
+         * @return Whether any variable modified in one of the sequences of statements is accessed in the other one.
+         */
+        [[nodiscard]] bool dependsOn(const UsagesOfStatements& other) const;
+    };
+
+    /**
+     * @brief Record the loop variables used in a number.
+     * @param number The number to analyze.
+     * @param usages The usages to which the used loop variables are added.
+     */
+    void collectUsagesOfNumber(const Number::ptr& number, UsagesOfStatements& usages);
+
+    /**
+     * @brief Record the variables read and the loop variables used in an expression.
+     * @param expression The expression to analyze.
+     * @param usages The usages to which the variables and loop variables of the expression are added.
+     */
+    void collectUsagesOfExpression(const Expression::ptr& expression, UsagesOfStatements& usages);
+
+    /**
+     * @brief Record the usage of a variable by a variable access, the variables and loop variables used in the indices and bitrange of the variable access are recorded as well.
+     * @param variableAccess The variable access to analyze.
+     * @param isModified Whether the accessed variable is modified by the variable access.
+     * @param usages The usages to which the usage is added.
+     */
+    void collectUsagesOfVariableAccess(const VariableAccess::ptr& variableAccess, bool isModified, UsagesOfStatements& usages);
+
+    /**
+     * @brief Record the variables accessed as well as the loop variables used and declared in a sequence of statements, including the nested statements of IfStatements and ForStatements.
+     *
+     * The assigned to variables of assignments, the variables of unary statements and both sides of swap statements are modified by the statements while the variables passed as parameters to a called or uncalled module are assumed to be modified.
+     *
+     * @param statements The statements to analyze.
+     * @param usages The usages to which the usages of the statements are added.
+     */
+    void collectUsagesOfStatements(const Statement::vec& statements, UsagesOfStatements& usages);
+} // namespace syrec
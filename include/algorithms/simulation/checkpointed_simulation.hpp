@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/n_bit_values_container.hpp"
+#include "core/statistics.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace syrec {
+    /**
+     * @brief Settings of the statement-level checkpointed simulation of a quantum computation
+     */
+    struct CheckpointedSimulationSettings {
+        /**
+         * The number of simulated statements between two full snapshots of the simulated states, the states in between are only reconstructed from the recorded differences between the states of successive statements.
+         * Smaller values speed up random access to the states of a statement at the cost of additional memory. A value of zero only stores the snapshot of the input states.
+         */
+        std::size_t numStatementsPerSnapshot = 16U;
+    };
+
+    /**
+     * @brief A simulation of a quantum computation for a batch of input patterns that records the state of all qubits after every statement of the SyReC program from which the quantum computation was synthesized
+     *
+     * The quantum operations of the quantum computation are grouped into statements, with every maximal sequence of successive quantum operations with the same value of the
+     * syrec::AnnotatableQuantumComputation::QUANTUM_OPERATION_ANNOTATION_KEY_ASSOCIATED_STATEMENT_LINE_NUMBER annotation forming a statement (all quantum operations thus form a single statement if the generation
+     * of quantum operation annotations was disabled during the synthesis). The input patterns are simulated bit-parallel in blocks of \ref BATCH_SIMULATION_LANE_COUNT patterns in a single pass over the quantum operations,
+     * with the lanes of the qubits changed by a statement being recorded as sparse differences. Since applying the differences of a statement is self-inverse, the simulation can be stepped forward and backward by
+     * a statement at the cost of the number of changed lanes. Full snapshots of all lanes are stored every CheckpointedSimulationSettings::numStatementsPerSnapshot statements to bound the cost of random access.
+     */
+    class CheckpointedSimulation {
+    public:
+        /**
+         * @brief A statement of the simulated quantum computation
+         */
+        struct Statement {
+            /**
+             * The line number of the statement, std::nullopt if its quantum operations have no statement line number.
+             */
+            std::optional<unsigned> statementLineNumber;
+            /**
+             * The quantum operations of the statement.
+             */
+            AnnotatableQuantumComputation::QuantumOperationIndexRange quantumOperations;
+        };
+
+        /**
+         * @brief Simulate a quantum computation for a batch of input patterns and record the states after every statement. The position of the simulation is reset to the input states afterward.
+         *
+         * @param annotatableQuantumComputation The quantum computation to simulate, none of its quantum operations must have been forwarded to a quantum operation sink.
+         * @param inputs The input patterns. The bit-width of every pattern has to be equal to the number of qubits of the quantum computation.
+         * @param settings The settings of the simulation.
+         * @param optionalRecordedStatistics Container to optionally store recorded statistics during the simulation of the given input states.
+         * @returns Whether all quantum operations could be simulated for all input patterns. The recorded states are discarded if the simulation failed.
+         */
+        [[nodiscard]] bool simulate(const AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<NBitValuesContainer>& inputs, const CheckpointedSimulationSettings& settings = CheckpointedSimulationSettings(), Statistics* optionalRecordedStatistics = nullptr);
+
+        /**
+         * @brief Get the statements of the simulated quantum computation in the order of their quantum operations.
+         */
+        [[nodiscard]] const std::vector<Statement>& getStatements() const noexcept {
+            return statements;
+        }
+
+        /**
+         * @brief Get the number of simulated input patterns.
+         */
+        [[nodiscard]] std::size_t getNumInputs() const noexcept {
+            return numInputs;
+        }
+
+        /**
+         * @brief Get the number of statements whose quantum operations were applied to the current states, zero if the current states are the input states.
+         */
+        [[nodiscard]] std::size_t getNumSimulatedStatements() const noexcept {
+            return numSimulatedStatements;
+        }
+
+        /**
+         * @brief Get the number of recorded differences between the states of successive statements, every difference storing the changed lanes of a single qubit for a block of input patterns.
+         */
+        [[nodiscard]] std::size_t getNumRecordedDifferences() const noexcept {
+            return differences.size();
+        }
+
+        /**
+         * @brief Apply the quantum operations of the next statement to the current states.
+         * @returns Whether a statement remained to be simulated.
+         */
+        [[nodiscard]] bool stepForward();
+
+        /**
+         * @brief Revert the quantum operations of the last simulated statement from the current states.
+         * @returns Whether any statement was simulated.
+         */
+        [[nodiscard]] bool stepBackward();
+
+        /**
+         * @brief Set the current states to the ones after the given number of simulated statements, starting from the nearest snapshot or the current states.
+         * @param numStatements The number of simulated statements.
+         * @returns Whether the number of statements did not exceed the number of statements of the quantum computation.
+         */
+        [[nodiscard]] bool seek(std::size_t numStatements);
+
+        /**
+         * @brief Get the current state of the qubits for an input pattern.
+         * @param indexOfInput The index of the input pattern in the simulated input patterns.
+         * @returns The current state of the qubits, std::nullopt if no such input pattern was simulated.
+         */
+        [[nodiscard]] std::optional<NBitValuesContainer> getState(std::size_t indexOfInput) const;
+
+    protected:
+        /**
+         * @brief The changed lanes of a word of the simulated states.
+         */
+        struct LaneDifference {
+            std::size_t   indexOfWord;
+            std::uint64_t flippedLanes;
+        };
+
+        std::size_t            numQubits                = 0;
+        std::size_t            numInputs                = 0;
+        std::size_t            numSimulatedStatements   = 0;
+        std::size_t            numStatementsPerSnapshot = 0;
+        std::vector<Statement> statements;
+        // The lanes of the qubits of every block of input patterns with the lanes of qubit q of block b being stored at index b * numQubits + q.
+        std::vector<std::uint64_t>              currentLaneValues;
+        std::vector<std::vector<std::uint64_t>> snapshots;
+        std::vector<LaneDifference>             differences;
+        // The differences of the i-th statement are stored in the range [firstDifferenceOfStatement[i], firstDifferenceOfStatement[i + 1]) of the recorded differences.
+        std::vector<std::size_t> firstDifferenceOfStatement;
+
+        void reset();
+        void applyDifferencesOfStatement(std::size_t indexOfStatement);
+    };
+} // namespace syrec
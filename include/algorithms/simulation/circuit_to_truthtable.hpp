@@ -10,11 +10,71 @@
 
 #pragma once
 
+#include "algorithms/synthesis/dd_package_settings.hpp"
+#include "core/execution_limits.hpp"
 #include "core/truthTable/truth_table.hpp"
 #include "ir/QuantumComputation.hpp"
 
+#include <cstddef>
+#include <ostream>
+
 namespace syrec {
 
-    auto buildTruthTable(const qc::QuantumComputation& qc, TruthTable& tt) -> void;
+    /**
+     * Settings of the extraction of the truth table of a quantum computation.
+     */
+    struct TruthTableExtractionSettings {
+        /**
+         * The number of threads among which the input space is split. A value of zero uses the number of concurrent threads supported by the hardware.
+         */
+        std::size_t numThreads = 1U;
+        /**
+         * Whether circuits consisting only of (multi-)controlled X and SWAP gates are simulated using the bit-parallel classical simulator instead of the DD-based simulation.
+         */
+        bool useClassicalSimulationForPermutationCircuits = true;
+        /**
+         * Whether the circuits not simulated classically are converted into a single DD of their functionality whose permutation is then read off by following
+         * the path of every input through the DD (sharing the paths of inputs with common prefixes) instead of simulating every input separately. The extraction from
+         * the functionality is single-threaded. Circuits containing non-unitary operations or mapping an input to a superposition are simulated per input instead.
+         */
+        bool useFunctionalityDd = false;
+        /**
+         * The sizes of the tables of the DD packages used by the DD-based simulation (one per thread) and the construction of the functionality DD.
+         */
+        DDPackageSettings ddPackageSettings{};
+        /**
+         * The cancellation token, time limit and memory budget of the extraction, checked prior to the simulation of every batch of 64 inputs by every thread.
+         */
+        ExecutionLimits executionLimits{};
+    };
+
+    /**
+     * Build the truth table of a quantum computation by simulating every input in which all constant (i.e. ancillary) lines are zero.
+     *
+     * Only the assignments of the non-constant lines are enumerated, thus no simulation work is wasted on inputs violating the constant lines.
+     * The enumeration visits the inputs in ascending order, i.e. in the same order as an enumeration of all integers in [0, 2^n) skipping the
+     * inputs that violate the constant lines.
+     *
+     * @param qc The quantum computation to simulate.
+     * @param tt The truth table to which the extracted entries are added.
+     * @param settings The settings of the extraction.
+     * @return Whether the extraction was completed, no entries are added to the truth table if it was stopped due to a violation of its execution limits.
+     */
+    [[nodiscard]] auto buildTruthTable(const qc::QuantumComputation& qc, TruthTable& tt, const TruthTableExtractionSettings& settings = TruthTableExtractionSettings()) -> bool;
+
+    /**
+     * Write the truth table of a quantum computation in the PLA format to an output stream without building a syrec::TruthTable.
+     *
+     * The inputs are enumerated and simulated like in buildTruthTable(...) but in blocks of a fixed number of inputs per thread, whose rows are written to the output stream in ascending order of the inputs before the
+     * next block is simulated, thus the memory consumption does not depend on the number of inputs. Every row only consists of the values of the primary inputs (i.e. the non-ancillary qubits) and primary outputs
+     * (i.e. the non-garbage qubits), which are written from the most to the least significant qubit. The functionality DD (see TruthTableExtractionSettings::useFunctionalityDd) is not used since it requires all
+     * entries to be extracted at once.
+     *
+     * @param qc The quantum computation to simulate.
+     * @param outputStream The output stream to which the PLA is written.
+     * @param settings The settings of the extraction.
+     * @return Whether the PLA was written completely, false if the extraction was stopped due to a violation of its execution limits (with the rows written so far remaining in the output stream) or the output stream failed.
+     */
+    [[nodiscard]] auto writeTruthTableAsPla(const qc::QuantumComputation& qc, std::ostream& outputStream, const TruthTableExtractionSettings& settings = TruthTableExtractionSettings()) -> bool;
 
 } // namespace syrec
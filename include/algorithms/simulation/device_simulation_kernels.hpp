@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/*
+ * The interface between the host code and the kernels of the device simulation. Since the kernels are compiled by the CUDA compiler, this header only uses plain types and must not include any header of mqt-core.
+ */
+namespace syrec::device {
+    /**
+     * A view of the gate arrays of a simulation program (see SimulationProgram::GateArrays) with every pointer referencing host or device memory.
+     */
+    struct GateArraysView {
+        std::size_t          numQubits          = 0;
+        std::size_t          numGates           = 0;
+        std::size_t          numControls        = 0;
+        const std::uint8_t*  isSwapGate         = nullptr;
+        const std::uint32_t* firstTargetQubits  = nullptr;
+        const std::uint32_t* secondTargetQubits = nullptr;
+        const std::uint32_t* controlOffsets     = nullptr;
+        const std::uint32_t* controlQubits      = nullptr;
+        const std::uint8_t*  controlPolarities  = nullptr;
+    };
+
+    /**
+     * The simulation of the assignments of the primary inputs of two gate programs with the i-th primary input (output) of both programs being compared.
+     * The assignments are simulated in blocks of 64 assignments with the lane values of the primary inputs of a block being determined by determineLaneValuesOfPrimaryInput(...).
+     */
+    struct EquivalenceCheckProblem {
+        GateArraysView       lhs;
+        GateArraysView       rhs;
+        const std::uint32_t* lhsPrimaryInputQubits  = nullptr;
+        const std::uint32_t* rhsPrimaryInputQubits  = nullptr;
+        const std::uint32_t* lhsPrimaryOutputQubits = nullptr;
+        const std::uint32_t* rhsPrimaryOutputQubits = nullptr;
+        std::size_t          numPrimaryInputs       = 0;
+        std::size_t          numPrimaryOutputs      = 0;
+        bool                 isExhaustive           = true;
+        std::uint64_t        numAssignments         = 0;
+        std::uint64_t        seed                   = 0;
+    };
+
+    /**
+     * The results of an equivalence check reduced on the device.
+     */
+    struct EquivalenceCheckOutcome {
+        /**
+         * The smallest index of an assignment yielding different primary outputs, UINT64_MAX if no such assignment exists.
+         */
+        std::uint64_t indexOfFirstMismatchingAssignment = UINT64_MAX;
+        /**
+         * The number of assignments yielding a different value for the i-th primary output.
+         */
+        std::vector<std::uint64_t> numMismatchingAssignmentsPerPrimaryOutput;
+    };
+
+    /**
+     * @return The number of usable devices, zero if the library was built without the MQT_SYREC_ENABLE_CUDA_SIMULATION option.
+     */
+    [[nodiscard]] int determineNumDevices() noexcept;
+
+    /**
+     * Upload the gate programs and primary lines of the problem, whose pointers must reference host memory, and simulate all of its assignments on the device.
+     * @param problem The simulated problem.
+     * @param outcome The outcome of the simulation which is overwritten.
+     * @return Whether the simulation on the device was successful.
+     */
+    [[nodiscard]] bool checkEquivalence(const EquivalenceCheckProblem& problem, EquivalenceCheckOutcome& outcome);
+
+    /**
+     * Determine the lane values of a primary input in a block of 64 assignments.
+     *
+     * For the exhaustive simulation, the value of the i-th primary input in the assignment with index a is the i-th bit of a. Otherwise, the lane values are pseudo random values
+     * derived from the seed, the block and the primary input via the SplitMix64 finalizer, which allows the host to reconstruct the assignment of a lane from its index.
+     */
+    [[nodiscard]] constexpr std::uint64_t determineLaneValuesOfPrimaryInput(const bool isExhaustive, const std::uint64_t block, const std::size_t primaryInput, const std::uint64_t seed) noexcept {
+        if (isExhaustive) {
+            switch (primaryInput) {
+                case 0:
+                    return 0xAAAAAAAAAAAAAAAAULL;
+                case 1:
+                    return 0xCCCCCCCCCCCCCCCCULL;
+                case 2:
+                    return 0xF0F0F0F0F0F0F0F0ULL;
+                case 3:
+                    return 0xFF00FF00FF00FF00ULL;
+                case 4:
+                    return 0xFFFF0000FFFF0000ULL;
+                case 5:
+                    return 0xFFFFFFFF00000000ULL;
+                default:
+                    return (((block * 64U) >> primaryInput) & 1U) != 0U ? ~static_cast<std::uint64_t>(0U) : 0U;
+            }
+        }
+
+        std::uint64_t value = seed + (block * 0x9E3779B97F4A7C15ULL) + (static_cast<std::uint64_t>(primaryInput) * 0xD1B54A32D192ED03ULL);
+        value               = (value ^ (value >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+        value               = (value ^ (value >> 27U)) * 0x94D049BB133111EBULL;
+        return value ^ (value >> 31U);
+    }
+} // namespace syrec::device
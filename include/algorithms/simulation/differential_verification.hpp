@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "core/configurable_options.hpp"
+#include "core/statistics.hpp"
+#include "core/syrec/program.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace syrec {
+    /**
+     * @brief Settings of the differential verification of the synthesis of a SyReC program
+     */
+    struct DifferentialVerificationSettings {
+        /**
+         * The synthesizer whose synthesized quantum computation is verified.
+         */
+        SynthesisAlgorithm synthesisAlgorithm = SynthesisAlgorithm::CostAware;
+        /**
+         * The number of randomly generated stimuli (rounded up to a multiple of the 64 stimuli simulated at once).
+         */
+        std::uint64_t numStimuli = static_cast<std::uint64_t>(1) << 16U;
+        /**
+         * The seed of the stimuli. The generated stimuli only depend on the seed and not on the number of threads.
+         */
+        std::uint64_t seed = 0U;
+        /**
+         * The number of threads among which the stimuli are split. A value of zero uses the number of concurrent threads supported by the hardware.
+         */
+        std::size_t numThreads = 0U;
+    };
+
+    /**
+     * @brief A stimulus for which the values computed by the synthesized quantum computation differ from the ones of the interpretation of the SyReC program
+     *
+     * The values of the variables are stored in the assignment layout of the syrec::ProgramInterpreter, i.e. the values of the elements of the parameters followed by the ones of the local variables of the main module.
+     */
+    struct DifferentialVerificationMismatch {
+        /**
+         * The index of the stimulus in the generated stream of stimuli.
+         */
+        std::uint64_t indexOfStimulus = 0U;
+        /**
+         * The values of the variables of the main module prior to the execution of the program.
+         */
+        std::vector<std::uint64_t> stimulus;
+        /**
+         * The values of the variables of the main module determined by the interpretation of the program.
+         */
+        std::vector<std::uint64_t> expectedValues;
+        /**
+         * The values of the qubits of the variables of the main module determined by the simulation of the synthesized quantum computation.
+         */
+        std::vector<std::uint64_t> actualValues;
+        /**
+         * The label of the qubit with the smallest index whose value differed (see syrec::AnnotatableQuantumComputation::getQubitLabel).
+         */
+        std::string labelOfMismatchingQubit;
+        /**
+         * The value of the syrec::AnnotatableQuantumComputation::QUANTUM_OPERATION_ANNOTATION_KEY_ASSOCIATED_STATEMENT_LINE_NUMBER annotation of the last quantum operation targeting the mismatching qubit,
+         * std::nullopt if no quantum operation targets said qubit.
+         */
+        std::optional<std::string> statementLineNumber;
+    };
+
+    /**
+     * @brief The result of the differential verification of the synthesis of a SyReC program
+     */
+    struct DifferentialVerificationResult {
+        /**
+         * The number of checked stimuli, i.e. all generated stimuli if no mismatch was found or the stimuli up to and including the first mismatching one otherwise.
+         */
+        std::uint64_t numCheckedStimuli = 0U;
+        /**
+         * The first stimulus, in the order of the generated stream of stimuli, for which the values of the synthesized quantum computation and the interpretation of the program differed.
+         */
+        std::optional<DifferentialVerificationMismatch> firstMismatch;
+    };
+
+    /**
+     * @brief Verify the synthesis of a SyReC program by comparing the simulation of the synthesized quantum computation with the interpretation of the program for a stream of random stimuli
+     *
+     * The program is synthesized with the generation of quantum operation annotations being enabled, the qubits of the variables of the main module are determined by their labels (see syrec::AnnotatableQuantumComputation::getQubitLabel).
+     * Every stimulus assigns random values to the in, inout and state variables of the main module while all other qubits are initialized to zero. The stimuli are generated per block of \ref BATCH_SIMULATION_LANE_COUNT stimuli by a
+     * counter-based generator, the blocks are split among multiple threads with every thread simulating the quantum computation bit-parallel for a block and executing the syrec::ProgramInterpreter for every stimulus of the block.
+     * The values of the non-garbage variables (i.e. all but the in and wire variables) are compared.
+     *
+     * @param result The result of the verification. Will be reset if the verification failed.
+     * @param program The program to verify.
+     * @param synthesisSettings The settings of the synthesis and interpretation of the program.
+     * @param settings The settings of the verification.
+     * @param optionalRecordedStatistics Container to optionally store recorded statistics during the verification.
+     * @returns Whether the program could be synthesized, simulated and interpreted for all checked stimuli. A stimulus for which the interpretation fails (e.g. due to an access outside of the dimensions of a variable) is reported as an error.
+     */
+    [[nodiscard]] bool differentialVerification(DifferentialVerificationResult& result, const Program& program, const ConfigurableOptions& synthesisSettings = ConfigurableOptions(), const DifferentialVerificationSettings& settings = DifferentialVerificationSettings(), Statistics* optionalRecordedStatistics = nullptr);
+} // namespace syrec
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/truthTable/truth_table.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace syrec {
+
+    /**
+     * Settings of the simulation-based equivalence check of quantum computations.
+     */
+    struct EquivalenceCheckingSettings {
+        /**
+         * The maximum number of primary inputs for which all assignments of the primary inputs are simulated. Otherwise, only randomly sampled assignments are simulated.
+         */
+        std::size_t maxNumPrimaryInputsOfExhaustiveCheck = 30U;
+        /**
+         * The number of randomly sampled assignments of the primary inputs (rounded up to a multiple of the 64 assignments simulated at once per thread).
+         */
+        std::uint64_t numRandomSamples = static_cast<std::uint64_t>(1U) << 20U;
+        /**
+         * The seed of the random sampling, the sampled assignments are reproducible for the same seed and number of threads.
+         */
+        std::uint64_t seed = 0U;
+        /**
+         * The confidence level of the reported upper bound on the fraction of non-equivalent assignments of a random sampling.
+         */
+        double confidenceLevel = 0.95;
+        /**
+         * The number of threads among which the assignments are split. A value of zero uses the number of concurrent threads supported by the hardware.
+         */
+        std::size_t numThreads = 0U;
+        /**
+         * Whether the assignments are simulated on a CUDA device (see isDeviceSimulationAvailable()) which counts the mismatches of every primary output instead of stopping at the
+         * first counterexample. The device derives its random samples from the seed via a different generator than the host, falls back to the host if no device is available.
+         */
+        bool useDeviceSimulation = false;
+    };
+
+    /**
+     * The result of the simulation-based equivalence check of quantum computations.
+     */
+    struct EquivalenceCheckingResult {
+        enum class Outcome : std::uint8_t {
+            /**
+             * All assignments of the primary inputs yield the same primary outputs.
+             */
+            Equivalent,
+            /**
+             * All randomly sampled assignments of the primary inputs yield the same primary outputs.
+             */
+            ProbablyEquivalent,
+            /**
+             * An assignment of the primary inputs yields different primary outputs or the numbers of primary inputs or outputs differ.
+             */
+            NotEquivalent,
+            /**
+             * A quantum computation contains a gate that is neither an X nor a SWAP gate and thus cannot be simulated by the bit-parallel simulation.
+             */
+            NotSupported,
+            /**
+             * The symbolic simulation exceeded its maximum number of nodes before the primary outputs could be compared (see checkEquivalenceSymbolically(...)).
+             */
+            LimitExceeded
+        };
+
+        Outcome outcome = Outcome::NotSupported;
+        /**
+         * The number of simulated assignments of the primary inputs (zero for the symbolic simulation, which covers all assignments at once).
+         */
+        std::uint64_t numCheckedAssignments = 0U;
+        /**
+         * The upper bound on the fraction of all assignments of the primary inputs yielding different primary outputs at the configured confidence level,
+         * only non-zero for the outcome ProbablyEquivalent.
+         */
+        double maxFractionOfNonEquivalentAssignments = 0.;
+        /**
+         * The values of the primary inputs of an assignment yielding different primary outputs (only set for the outcome NotEquivalent if such an assignment exists).
+         */
+        std::vector<bool> counterexample;
+        /**
+         * The number of simulated assignments yielding a different value for the i-th primary output, only set if the assignments were simulated on a device.
+         */
+        std::vector<std::uint64_t> numMismatchingAssignmentsPerPrimaryOutput;
+    };
+
+    /**
+     * @return Whether the library was built with the MQT_SYREC_ENABLE_CUDA_SIMULATION option and a CUDA device is usable for the simulation-based equivalence check.
+     */
+    [[nodiscard]] auto isDeviceSimulationAvailable() -> bool;
+
+    /**
+     * Check whether two quantum computations consisting only of (multi-)controlled X and SWAP gates compute the same function on their primary inputs and outputs.
+     *
+     * The primary inputs (outputs) are the non-ancillary (non-garbage) qubits with the i-th primary input (output) of both quantum computations being compared, ordered by descending qubit index
+     * as the positions of a truth table extracted from the quantum computation. The ancillary qubits are initialized to zero and the values of the garbage qubits are ignored. All assignments
+     * of the primary inputs are simulated if their number does not exceed the configured limit, otherwise the configured number of random assignments is simulated.
+     *
+     * @param lhs The first quantum computation.
+     * @param rhs The second quantum computation.
+     * @param settings The settings of the equivalence check.
+     * @return The result of the equivalence check.
+     */
+    [[nodiscard]] auto checkEquivalence(const qc::QuantumComputation& lhs, const qc::QuantumComputation& rhs, const EquivalenceCheckingSettings& settings = EquivalenceCheckingSettings()) -> EquivalenceCheckingResult;
+
+    /**
+     * Check whether a quantum computation consisting only of (multi-)controlled X and SWAP gates computes the function specified by a truth table on its primary inputs and outputs.
+     *
+     * The primary inputs and outputs of the truth table are determined by its constants and garbage, every entry (with the don't cares of its input being completed) is simulated with
+     * the don't cares of its output matching any value. Inputs without an entry are not checked, thus the outcome is either Equivalent, NotEquivalent or NotSupported.
+     *
+     * @param quantumComputation The quantum computation.
+     * @param tt The truth table specifying the function.
+     * @param settings The settings of the equivalence check (of which only the number of threads is considered).
+     * @return The result of the equivalence check.
+     */
+    [[nodiscard]] auto checkEquivalence(const qc::QuantumComputation& quantumComputation, const TruthTable& tt, const EquivalenceCheckingSettings& settings = EquivalenceCheckingSettings()) -> EquivalenceCheckingResult;
+
+} // namespace syrec
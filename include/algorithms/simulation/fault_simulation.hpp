@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/n_bit_values_container.hpp"
+#include "core/statistics.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace syrec {
+    /**
+     * @brief A single fault of a reversible circuit consisting only of (multi-)controlled X and SWAP gates
+     *
+     * The gates are numbered in the order in which they are simulated, with the gates of a qc::CompoundOperation being numbered in place of the latter (see syrec::SimulationProgram).
+     */
+    struct ReversibleCircuitFault {
+        enum class Kind : std::uint8_t {
+            /**
+             * The gate at ReversibleCircuitFault::gateIndex is not applied.
+             */
+            MissingGate,
+            /**
+             * The gate at ReversibleCircuitFault::gateIndex is applied ReversibleCircuitFault::numRepetitions times. Since X and SWAP gates are self-inverse, an even number of repetitions is equivalent to a missing gate while an odd number is not detectable.
+             */
+            RepeatedGate,
+            /**
+             * The value of the qubit is zero at the inputs of the gate at ReversibleCircuitFault::gateIndex (or at the outputs of the circuit if the index is equal to the number of gates).
+             */
+            StuckAtZero,
+            /**
+             * The value of the qubit is one at the inputs of the gate at ReversibleCircuitFault::gateIndex (or at the outputs of the circuit if the index is equal to the number of gates).
+             */
+            StuckAtOne
+        };
+
+        Kind          kind           = Kind::MissingGate;
+        std::size_t   gateIndex      = 0;
+        qc::Qubit     qubit          = 0;
+        std::uint32_t numRepetitions = 2U;
+
+        [[nodiscard]] bool operator==(const ReversibleCircuitFault& other) const = default;
+    };
+
+    /**
+     * @brief Settings of the fault simulation of a reversible circuit
+     */
+    struct FaultSimulationSettings {
+        enum class Mode : std::uint8_t {
+            /**
+             * The faulty circuits of up to 64 faults are simulated in the lanes of a word for one input pattern at a time. Preferable for many faults and few patterns.
+             */
+            ParallelFault,
+            /**
+             * Up to 64 input patterns are simulated in the lanes of a word for one fault at a time, with the simulation of the faulty circuit starting from the state of the fault-free one at the location of the fault.
+             * Preferable for many patterns.
+             */
+            ParallelPattern
+        };
+
+        /**
+         * The lanes of the simulated words.
+         */
+        Mode mode = Mode::ParallelPattern;
+        /**
+         * The number of threads among which the faults are split. A value of zero uses the number of concurrent threads supported by the hardware.
+         */
+        std::size_t numThreads = 0U;
+    };
+
+    /**
+     * @brief The input patterns detecting the simulated faults of a reversible circuit
+     */
+    struct FaultSimulationResult {
+        /**
+         * The indices of the input patterns, in ascending order, whose output state of the faulty circuit differs from the one of the fault-free circuit for every simulated fault.
+         */
+        std::vector<std::vector<std::size_t>> detectingPatternsPerFault;
+
+        /**
+         * @return Whether the fault was detected by any input pattern.
+         */
+        [[nodiscard]] bool isFaultDetected(std::size_t faultIndex) const;
+
+        /**
+         * @return The number of faults detected by any input pattern.
+         */
+        [[nodiscard]] std::size_t getNumDetectedFaults() const;
+    };
+
+    /**
+     * @brief Determine all single missing gate, repeated gate (with two repetitions) and stuck-at faults of a reversible circuit
+     *
+     * The stuck-at faults are generated for every qubit at the inputs of every gate and at the outputs of the circuit.
+     * @param quantumComputation Quantum computation consisting only of X and SWAP gates.
+     * @return The faults ordered by their gate index, empty if the quantum computation could not be compiled.
+     */
+    [[nodiscard]] std::vector<ReversibleCircuitFault> determineSingleFaults(const qc::QuantumComputation& quantumComputation);
+
+    /**
+     * @brief Bit-parallel simulation of single faults of a reversible circuit for the given input patterns
+     *
+     * Every fault is simulated on its own copy of the circuit, a fault is detected by an input pattern if the output state of its faulty circuit differs in any qubit from the output state of the fault-free circuit.
+     *
+     * @param result The input patterns detecting every fault. Will be reset if the simulation failed.
+     * @param quantumComputation Quantum computation consisting only of X and SWAP gates to be simulated.
+     * @param faults The simulated faults.
+     * @param inputPatterns The input states of the simulated circuit whose sizes must match the number of qubits of the quantum computation.
+     * @param settings The settings of the simulation.
+     * @param optionalRecordedStatistics Container to optionally store recorded statistics during the simulation.
+     * @returns Whether the quantum computation could be simulated, which is not the case if the quantum computation could not be compiled or if any fault or input pattern did not match the quantum computation.
+     */
+    [[nodiscard]] bool faultSimulation(FaultSimulationResult& result, const qc::QuantumComputation& quantumComputation, const std::vector<ReversibleCircuitFault>& faults, const std::vector<NBitValuesContainer>& inputPatterns, const FaultSimulationSettings& settings = FaultSimulationSettings(), Statistics* optionalRecordedStatistics = nullptr);
+} // namespace syrec
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "algorithms/simulation/simulation_program.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace syrec {
+    /**
+     * @brief A simulation program translated into straight-line machine code of the host that simulates all gates of the program bit-sliced over 256 lanes without any dispatch per gate.
+     *
+     * The machine code keeps the lane values of the qubits in the vector registers of the host, with a qubit being evicted to memory only if all registers are occupied by qubits used earlier by the following gates.
+     * The native code is only generated if the library was built with the MQT_SYREC_ENABLE_JIT_SIMULATION option on an x86-64 host supporting AVX2, otherwise the translated simulation program is interpreted instead.
+     * A translated program is immutable and can be simulated by multiple threads concurrently.
+     */
+    class JitSimulationProgram {
+    public:
+        /**
+         * @brief The number of 64-bit lane words stored per qubit in a block simulated by a single execution of the program.
+         */
+        static constexpr std::size_t NUM_LANE_WORDS_PER_QUBIT = 4U;
+
+        /**
+         * @brief The number of input patterns simulated by a single execution of the program.
+         */
+        static constexpr std::size_t LANE_COUNT = NUM_LANE_WORDS_PER_QUBIT * 64U;
+
+        /**
+         * @brief Translate a simulation program into native code (if supported by the build and the host).
+         *
+         * @param simulationProgram The simulation program to translate.
+         * @return The translated simulation program.
+         */
+        [[nodiscard]] static JitSimulationProgram compile(const SimulationProgram& simulationProgram);
+
+        /**
+         * @return Whether native code can be generated, i.e. whether the library was built with the MQT_SYREC_ENABLE_JIT_SIMULATION option and the host supports the used instructions.
+         */
+        [[nodiscard]] static bool isNativeCodeGenerationAvailable() noexcept;
+
+        /**
+         * @brief Bit-sliced simulation of a block of \ref LANE_COUNT input patterns.
+         *
+         * The words [q * NUM_LANE_WORDS_PER_QUBIT, (q + 1) * NUM_LANE_WORDS_PER_QUBIT) store the lane values of qubit q, with the i-th bit of the w-th word of a qubit storing the value of the qubit in the (w * 64 + i)-th input pattern.
+         * @param laneWordsPerQubit The lane words of every qubit which are modified directly.
+         * @return Whether the number of lane words matched the number of qubits of the program.
+         */
+        [[nodiscard]] bool simulate(std::span<std::uint64_t> laneWordsPerQubit) const;
+
+        /**
+         * @return Whether the program is simulated by native code instead of interpreting the translated simulation program.
+         */
+        [[nodiscard]] bool isNative() const noexcept {
+            return nativeFunction != nullptr;
+        }
+
+        /**
+         * @return The size of the generated native code in bytes, zero if no native code was generated.
+         */
+        [[nodiscard]] std::size_t getNativeCodeSize() const noexcept {
+            return nativeCodeSize;
+        }
+
+        /**
+         * @return The number of instructions of the generated native code accessing the lane values of a qubit in memory instead of in a vector register.
+         */
+        [[nodiscard]] std::size_t getNumMemoryAccessesOfNativeCode() const noexcept {
+            return numMemoryAccessesOfNativeCode;
+        }
+
+        /**
+         * @return The number of qubits of the translated simulation program.
+         */
+        [[nodiscard]] std::size_t getNumQubits() const noexcept {
+            return simulationProgram.getNumQubits();
+        }
+
+        /**
+         * @return The number of gates of the translated simulation program.
+         */
+        [[nodiscard]] std::size_t getNumGates() const noexcept {
+            return simulationProgram.getNumGates();
+        }
+
+    protected:
+        using NativeFunction = void (*)(std::uint64_t* laneWordsPerQubit);
+
+        explicit JitSimulationProgram(SimulationProgram simulationProgram):
+            simulationProgram(std::move(simulationProgram)) {}
+
+        SimulationProgram simulationProgram;
+        // The executable memory storing the native code is shared by all copies of the program.
+        std::shared_ptr<const void> nativeCode;
+        NativeFunction              nativeFunction                = nullptr;
+        std::size_t                 nativeCodeSize                = 0;
+        std::size_t                 numMemoryAccessesOfNativeCode = 0;
+    };
+
+    /**
+     * @brief A cache of the simulation programs translated into native code, identified by a hash of their gates, allowing circuits that are simulated repeatedly (i.e. by several verification runs) to be translated only once.
+     *
+     * Since the gates of a cached program are compared with the ones of the requested program, hash collisions do not result in the reuse of a wrong program. The cache can be shared between threads.
+     */
+    class JitSimulationProgramCache {
+    public:
+        /**
+         * @brief Translate a simulation program or load the program cached for a simulation program with the same gates.
+         *
+         * @param simulationProgram The simulation program to translate.
+         * @return The translated simulation program.
+         */
+        [[nodiscard]] std::shared_ptr<const JitSimulationProgram> getOrCompile(const SimulationProgram& simulationProgram);
+
+        /**
+         * @brief Remove all cached programs.
+         */
+        void clear();
+
+        [[nodiscard]] std::size_t getNumCachedPrograms() const;
+
+        /**
+         * @brief Get the number of requested simulation programs whose translation was loaded from the cache.
+         */
+        [[nodiscard]] std::size_t getNumCacheHits() const;
+
+        /**
+         * @brief Get the number of requested simulation programs that needed to be translated.
+         */
+        [[nodiscard]] std::size_t getNumCacheMisses() const;
+
+    protected:
+        struct CachedProgram {
+            std::size_t                                 numQubits;
+            SimulationProgram::GateArrays               gateArrays;
+            std::shared_ptr<const JitSimulationProgram> program;
+        };
+
+        mutable std::mutex                                            mutex;
+        std::unordered_map<std::uint64_t, std::vector<CachedProgram>> cachedProgramsPerHash;
+        std::size_t                                                   numCachedPrograms = 0;
+        std::size_t                                                   numCacheHits      = 0;
+        std::size_t                                                   numCacheMisses    = 0;
+    };
+} // namespace syrec
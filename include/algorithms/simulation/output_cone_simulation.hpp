@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "algorithms/simulation/simulation_program.hpp"
+#include "core/n_bit_values_container.hpp"
+#include "core/statistics.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <compare>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace syrec {
+    /**
+     * @brief A cache of the simulation programs compiled for the backward dependency cones of output qubits of quantum computations (see SimulationProgram::compileOutputCone(...)), allowing repeated simulations of the same outputs to skip the slicing and compilation.
+     *
+     * The simulation programs are identified by the address and the number of operations of the quantum computation together with the set of requested output qubits (independent of their order and multiplicity).
+     * Since the operations of a quantum computation are not compared, the cache must be cleared if an operation of a cached quantum computation was modified or the quantum computation was destroyed. A cache must not be shared between threads.
+     */
+    class OutputConeSimulationProgramCache {
+    public:
+        /**
+         * @brief Compile the output cone of a quantum computation or load the cached simulation program compiled for it.
+         *
+         * @param quantumComputation The quantum computation whose output cone is compiled.
+         * @param outputQubits The output qubits whose values are of interest.
+         * @return The simulation program of the output cone, nullptr if it could not be compiled (which is not cached).
+         */
+        [[nodiscard]] std::shared_ptr<const SimulationProgram> getOrCompile(const qc::QuantumComputation& quantumComputation, std::span<const qc::Qubit> outputQubits);
+
+        /**
+         * @brief Remove all cached simulation programs.
+         */
+        void clear();
+
+        [[nodiscard]] std::size_t getNumCachedPrograms() const noexcept {
+            return cachedPrograms.size();
+        }
+
+        /**
+         * @brief Get the number of requested output cones whose simulation program was loaded from the cache.
+         */
+        [[nodiscard]] std::size_t getNumCacheHits() const noexcept {
+            return numCacheHits;
+        }
+
+        /**
+         * @brief Get the number of requested output cones that needed to be compiled.
+         */
+        [[nodiscard]] std::size_t getNumCacheMisses() const noexcept {
+            return numCacheMisses;
+        }
+
+    protected:
+        struct CacheKey {
+            const qc::QuantumComputation* quantumComputation;
+            std::size_t                   numOperations;
+            // Sorted without duplicates
+            std::vector<qc::Qubit> outputQubits;
+
+            [[nodiscard]] auto operator<=>(const CacheKey& other) const = default;
+        };
+
+        std::map<CacheKey, std::shared_ptr<const SimulationProgram>> cachedPrograms;
+        std::size_t                                                  numCacheHits   = 0;
+        std::size_t                                                  numCacheMisses = 0;
+    };
+
+    /**
+     * @brief Simulation of the backward dependency cone of the given output qubits of a quantum computation for a single input pattern
+     *
+     * Only the gates influencing the values of the output qubits are simulated, thus the values of the output qubits (and of every other qubit of their cone) in @p output are equal to the ones determined by
+     * \ref syrec::simpleSimulation "simpleSimulation" while the values of all other qubits are the ones of the input pattern.
+     *
+     * @param output Output pattern. The index of the pattern corresponds to the line index.
+     * @param quantumComputation Quantum computation to be simulated.
+     * @param input Input pattern. The bit-width of the input pattern has to be equal to the number of lines.
+     * @param outputQubits The output qubits whose values are of interest.
+     * @param optionalCache An optional cache of the simulation programs of output cones, the output cone is compiled for every simulation otherwise.
+     * @param optionalRecordedStatistics Container to optionally store recorded statistics during the simulation of the given input state.
+     */
+    void outputConeSimulation(NBitValuesContainer& output, const qc::QuantumComputation& quantumComputation, const NBitValuesContainer& input, std::span<const qc::Qubit> outputQubits, OutputConeSimulationProgramCache* optionalCache = nullptr, Statistics* optionalRecordedStatistics = nullptr);
+
+    /**
+     * @brief Bit-parallel simulation of the backward dependency cone of the given output qubits of a quantum computation for multiple input patterns
+     *
+     * Determines the same values of the output qubits as calling \ref syrec::outputConeSimulation "outputConeSimulation" for every input pattern in @p inputs.
+     *
+     * @param outputs The output patterns with the i-th output corresponding to the i-th input pattern. Will be cleared if any input pattern was invalid or the output cone could not be compiled.
+     * @param quantumComputation Quantum computation to be simulated.
+     * @param inputs The input patterns. The bit-width of every pattern has to be equal to the number of lines.
+     * @param outputQubits The output qubits whose values are of interest.
+     * @param optionalCache An optional cache of the simulation programs of output cones, the output cone is compiled for every simulation otherwise.
+     * @param optionalRecordedStatistics Container to optionally store recorded statistics during the simulation of the given input states.
+     */
+    void outputConeBatchSimulation(std::vector<NBitValuesContainer>& outputs, const qc::QuantumComputation& quantumComputation, const std::vector<NBitValuesContainer>& inputs, std::span<const qc::Qubit> outputQubits, OutputConeSimulationProgramCache* optionalCache = nullptr, Statistics* optionalRecordedStatistics = nullptr);
+} // namespace syrec
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/configurable_options.hpp"
+#include "core/statistics.hpp"
+#include "core/syrec/compiled_number.hpp"
+#include "core/syrec/expression.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/parser/utils/syrec_operation_utils.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace syrec {
+    /**
+     * @brief Word-level interpreter of a SyReC program serving as the reference model of the quantum computation synthesized for said program
+     *
+     * The statements of the main module are executed directly on the IR of the program with every element of a variable being stored in a native 64-bit integer (the parser restricts the bitwidth of
+     * a variable to 32 bits which allows the product of two operands to be computed without an overflow). The semantics of the operations match the ones of the synthesis:
+     * - Integer constants are truncated to the bitwidth of the other operand of the enclosing operation (or to one bit for logical operations) using the truncation operation of the settings,
+     *   subexpressions consisting only of integer constants are evaluated with 32-bit unsigned integers prior to their truncation.
+     * - Arithmetic operations are performed modulo 2^n with n being the bitwidth of the operands.
+     * - A division by zero yields a quotient with all bits set and a remainder equal to the dividend (the result of the synthesized restoring division).
+     * - A module is uncalled by executing the inverses of its statements in reverse order (see syrec::invertStatementBlock) while the local variables of a called or uncalled module are initialized to zero.
+     *
+     * An access on an element outside of the dimensions of a variable, a fi-condition of an IfStatement that does not match the value of its guard condition after the execution of the branch or a loop
+     * with a step size of zero are reported as errors on the error stream.
+     *
+     * The values of the variables of the main module are provided as an assignment that stores the values of the elements of every parameter and local variable in declaration order, with the elements of
+     * a multi-dimensional variable being stored in row-major order. Only the values of the in and inout parameters are not initialized to zero by the synthesized quantum computation.
+     */
+    class ProgramInterpreter {
+    public:
+        /**
+         * Prepare the interpretation of a SyReC program.
+         * @param program The program to interpret.
+         * @param settings The settings defining the entry point of the program and the truncation of integer constants.
+         * @return The interpreter of the program, std::nullopt if no main module could be determined.
+         */
+        [[nodiscard]] static std::optional<ProgramInterpreter> create(const Program& program, const ConfigurableOptions& settings = ConfigurableOptions());
+
+        /**
+         * @return The module used as the entry point of the interpreted program.
+         */
+        [[nodiscard]] const Module::ptr& getMainModule() const noexcept {
+            return mainModule;
+        }
+
+        /**
+         * @return The number of values of an assignment of the variables of the main module.
+         */
+        [[nodiscard]] std::size_t getNumValuesOfAssignment() const noexcept {
+            return numValuesOfAssignment;
+        }
+
+        /**
+         * Determine where the values of a parameter or local variable of the main module are stored in an assignment.
+         * @param variableIdentifier The identifier of the variable.
+         * @return The index of the value of the first element of the variable in an assignment, std::nullopt if no such variable was declared in the main module.
+         */
+        [[nodiscard]] std::optional<std::size_t> getIndexOfFirstValueOfVariable(std::string_view variableIdentifier) const;
+
+        /**
+         * Execute the statements of the main module for an assignment of its variables.
+         * @param assignment The values of the variables of the main module prior to the execution which are modified directly and contain the values after the execution afterwards.
+         * @return Whether the program could be executed, the assignment might only be partially updated otherwise.
+         */
+        [[nodiscard]] bool execute(std::vector<std::uint64_t>& assignment);
+
+    protected:
+        /**
+         * The value of an evaluated expression, an integer constant whose bitwidth is only determined by the enclosing operation is considered to be unsized.
+         */
+        struct EvaluatedValue {
+            std::uint64_t value;
+            unsigned      bitwidth;
+            bool          isUnsizedConstant;
+        };
+
+        struct AccessedBitsOfElement {
+            std::size_t indexOfElement;
+            unsigned    bitrangeStart;
+            unsigned    bitrangeEnd;
+
+            [[nodiscard]] unsigned getNumberOfAccessedBits() const noexcept {
+                return (bitrangeStart > bitrangeEnd ? bitrangeStart - bitrangeEnd : bitrangeEnd - bitrangeStart) + 1U;
+            }
+        };
+
+        struct StackFrame {
+            const Module* module = nullptr;
+            // The index of the first element of the i-th variable (according to the declaration order of the parameters and local variables of the module) in the values of all active variables.
+            std::vector<std::size_t> indexOfFirstElementPerVariable;
+        };
+
+        ProgramInterpreter() = default;
+
+        Module::ptr                               mainModule;
+        utils::IntegerConstantTruncationOperation integerConstantTruncationOperation = utils::IntegerConstantTruncationOperation::BitwiseAnd;
+        std::size_t                               numValuesOfAssignment              = 0;
+
+        std::vector<std::uint64_t> valuesOfElements;
+        // The stack frames are reused by later calls to prevent the reallocation of their containers, only the first numActiveStackFrames frames belong to active calls.
+        std::vector<StackFrame>                                          stackFrames;
+        std::size_t                                                      numActiveStackFrames = 0;
+        CompiledNumberEvaluator                                          loopVariableNumberEvaluator;
+        std::unordered_map<const Module*, std::optional<Statement::vec>> invertedStatementsPerModule;
+
+        [[nodiscard]] bool pushStackFrame(const Module& module, const std::vector<std::size_t>& indexOfFirstElementPerParameter);
+        void               popStackFrame();
+
+        [[nodiscard]] bool executeStatements(const Statement::vec& statements);
+        [[nodiscard]] bool executeStatement(const Statement& statement);
+        [[nodiscard]] bool executeStatement(const AssignStatement& statement);
+        [[nodiscard]] bool executeStatement(const UnaryStatement& statement);
+        [[nodiscard]] bool executeStatement(const SwapStatement& statement);
+        [[nodiscard]] bool executeStatement(const IfStatement& statement);
+        [[nodiscard]] bool executeStatement(const ForStatement& statement);
+        [[nodiscard]] bool executeModuleCall(const Module::ptr& targetModule, const std::vector<std::string>& callerArguments, bool isUncall, unsigned lineNumber);
+
+        [[nodiscard]] std::optional<EvaluatedValue>        evaluateExpression(const Expression::ptr& expression, std::optional<unsigned> expectedBitwidth);
+        [[nodiscard]] std::optional<EvaluatedValue>        evaluateOperand(const Expression& expression);
+        [[nodiscard]] std::optional<EvaluatedValue>        evaluateOperand(const BinaryExpression& expression);
+        [[nodiscard]] std::optional<EvaluatedValue>        evaluateOperand(const ShiftExpression& expression);
+        [[nodiscard]] std::optional<EvaluatedValue>        evaluateOperand(const UnaryExpression& expression);
+        [[nodiscard]] EvaluatedValue                       truncateUnsizedConstant(const EvaluatedValue& evaluatedValue, std::optional<unsigned> expectedBitwidth) const;
+        [[nodiscard]] std::optional<AccessedBitsOfElement> evaluateVariableAccess(const VariableAccess::ptr& variableAccess);
+        [[nodiscard]] std::uint64_t                        readAccessedBits(const AccessedBitsOfElement& accessedBits) const;
+        void                                               writeAccessedBits(const AccessedBitsOfElement& accessedBits, std::uint64_t value);
+    };
+
+    /**
+     * @brief Interpret a SyReC program for a batch of assignments of the variables of its main module on multiple threads
+     *
+     * @param assignments The assignments (see syrec::ProgramInterpreter) of the variables of the main module which are modified directly and contain the values of the variables after the execution of the program afterwards.
+     * @param program The program to interpret.
+     * @param settings The settings defining the entry point of the program and the truncation of integer constants.
+     * @param numThreads The number of threads among which the assignments are split. A value of zero uses the maximum number of threads defined by the settings (see ConfigurableOptions::maxNumThreads).
+     * @param optionalRecordedStatistics Container to optionally store recorded statistics during the interpretation.
+     * @returns Whether the program could be executed for all assignments.
+     */
+    [[nodiscard]] bool interpretProgram(std::vector<std::vector<std::uint64_t>>& assignments, const Program& program, const ConfigurableOptions& settings = ConfigurableOptions(), std::size_t numThreads = 0U, Statistics* optionalRecordedStatistics = nullptr);
+} // namespace syrec
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/statistics.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace syrec {
+    /**
+     * @brief Settings of the simulation of a quantum computation for generated input patterns
+     */
+    struct StimulusSimulationSettings {
+        /**
+         * The number of randomly generated input patterns.
+         */
+        std::uint64_t numRandomPatterns = static_cast<std::uint64_t>(1) << 20U;
+        /**
+         * Whether the corner case input patterns, i.e. all data qubits being zero, all data qubits being one and every pattern with exactly one set data qubit (walking ones), are simulated in addition to the random ones.
+         */
+        bool simulateCornerCasePatterns = true;
+        /**
+         * The seed of the random input patterns. The generated patterns only depend on the seed and not on the number of threads.
+         */
+        std::uint64_t seed = 0U;
+        /**
+         * The number of threads among which the input patterns are split. A value of zero uses the number of concurrent threads supported by the hardware.
+         */
+        std::size_t numThreads = 0U;
+    };
+
+    /**
+     * @brief The toggle coverage of the qubits of a quantum computation determined by the simulation of generated input patterns
+     */
+    struct StimulusSimulationResult {
+        /**
+         * The number of simulated input patterns.
+         */
+        std::uint64_t numSimulatedPatterns = 0U;
+        /**
+         * The number of simulated input patterns in which the output value of the q-th qubit was one.
+         */
+        std::vector<std::uint64_t> numOnesPerQubit;
+        /**
+         * The number of simulated input patterns in which the output value of the q-th qubit differed from its input value.
+         */
+        std::vector<std::uint64_t> numFlipsPerQubit;
+
+        /**
+         * @return Whether the output value of the qubit was observed to be both zero and one.
+         */
+        [[nodiscard]] bool isQubitToggleCovered(std::size_t qubit) const;
+
+        /**
+         * @return The number of qubits whose output value was observed to be both zero and one.
+         */
+        [[nodiscard]] std::size_t getNumToggleCoveredQubits() const;
+    };
+
+    /**
+     * @brief Bit-parallel simulation of a circuit for randomly generated and corner case assignments of its data qubits
+     *
+     * The data (i.e. non-ancillary) qubits are assigned the generated values while the ancillary qubits are initialized to zero, the quantum computation itself is assumed to set
+     * the initial state of the latter (as done by the synthesis of a SyReC program). The input patterns are generated per block of \ref BATCH_SIMULATION_LANE_COUNT patterns by a
+     * counter-based generator and simulated on multiple threads, the toggle coverage of the qubits is accumulated directly from the output lanes without unpacking the output patterns.
+     *
+     * @param result The toggle coverage of the qubits of the quantum computation. Will be reset if the simulation failed.
+     * @param quantumComputation Quantum computation consisting only of X and SWAP gates to be simulated.
+     * @param settings The settings of the generation of the input patterns.
+     * @param optionalRecordedStatistics Container to optionally store recorded statistics during the simulation.
+     * @returns Whether the quantum computation could be simulated.
+     */
+    [[nodiscard]] bool randomStimulusSimulation(StimulusSimulationResult& result, const qc::QuantumComputation& quantumComputation, const StimulusSimulationSettings& settings = StimulusSimulationSettings(), Statistics* optionalRecordedStatistics = nullptr);
+} // namespace syrec
@@ -10,11 +10,20 @@
 
 #pragma once
 
+#include "algorithms/simulation/jit_simulation_program.hpp"
+#include "algorithms/simulation/simulation_program.hpp"
+#include "core/frozen_quantum_computation.hpp"
 #include "core/n_bit_values_container.hpp"
 #include "core/statistics.hpp"
 #include "ir/QuantumComputation.hpp"
 #include "ir/operations/Operation.hpp"
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <vector>
+
 namespace syrec {
     /**
     * @brief Simulation for a single gate \p g
@@ -24,7 +33,7 @@ namespace syrec {
     *
     * \b Important: The operator should modify \p input directly.
     *
-    * @param op     The quantum operation to simulate
+    * @param op     The quantum operation to simulate, the gates of a qc::CompoundOperation are simulated in their order in the latter
     * @param input An input pattern
     * @returns Whether the operation could be applied.
     */
@@ -47,4 +56,119 @@ namespace syrec {
     * @param optionalRecordedStatistics Container to optionally store recorded statistics during the simulation of the given input state.
     */
     void simpleSimulation(NBitValuesContainer& output, const qc::QuantumComputation& quantumComputation, const NBitValuesContainer& input, Statistics* optionalRecordedStatistics = nullptr);
+
+    /**
+     * @brief The number of input patterns that are simulated simultaneously by a single pass over the operations of a quantum computation in the batch simulation.
+     */
+    constexpr std::size_t BATCH_SIMULATION_LANE_COUNT = 64U;
+
+    /**
+     * @brief Bit-parallel simulation of a single gate for up to \ref BATCH_SIMULATION_LANE_COUNT input patterns
+     *
+     * The i-th bit of the word @p laneValuesPerQubit[q] stores the value of qubit q in the i-th simulated input pattern.
+     * Each supported gate is thus evaluated using a small number of bitwise operations for all patterns at once.
+     *
+     * @param op The quantum operation to simulate, the gates of a qc::CompoundOperation are simulated in their order in the latter
+     * @param laneValuesPerQubit The lane values of every qubit of the quantum computation. Will be modified directly.
+     * @returns Whether the operation could be applied.
+     */
+    [[nodiscard]] bool coreOperationBatchSimulation(const qc::Operation& op, std::vector<std::uint64_t>& laneValuesPerQubit);
+
+    /**
+     * @brief Bit-parallel simulation of a circuit for multiple input patterns
+     *
+     * Determines the same output patterns as calling \ref syrec::simpleSimulation "simpleSimulation" for every input pattern in @p inputs.
+     * However, the input patterns are packed into blocks of \ref BATCH_SIMULATION_LANE_COUNT patterns with each block requiring only a single
+     * pass over the operations of the quantum computation. Negative control qubits are evaluated with respect to their polarity.
+     *
+     * @param outputs The output patterns with the i-th output corresponding to the i-th input pattern. Will be cleared if any input pattern was invalid or an operation could not be simulated.
+     * @param quantumComputation Quantum computation to be simulated.
+     * @param inputs The input patterns. The bit-width of every pattern has to be equal to the number of lines.
+     * @param optionalRecordedStatistics Container to optionally store recorded statistics during the simulation of the given input states.
+     */
+    void batchSimulation(std::vector<NBitValuesContainer>& outputs, const qc::QuantumComputation& quantumComputation, const std::vector<NBitValuesContainer>& inputs, Statistics* optionalRecordedStatistics = nullptr);
+
+    /**
+     * @brief Bit-parallel simulation of a frozen quantum computation for multiple input patterns
+     *
+     * The frozen quantum computation is compiled directly from its struct of arrays (see SimulationProgram::compile(const FrozenQuantumComputation&, bool)), thus the same frozen quantum computation can be simulated by multiple threads concurrently.
+     *
+     * @param outputs The output patterns with the i-th output corresponding to the i-th input pattern. Will be cleared if any input pattern was invalid.
+     * @param frozenQuantumComputation The frozen quantum computation to be simulated.
+     * @param inputs The input patterns. The bit-width of every pattern has to be equal to the number of lines.
+     * @param optionalRecordedStatistics Container to optionally store recorded statistics during the simulation of the given input states.
+     */
+    void batchSimulation(std::vector<NBitValuesContainer>& outputs, const FrozenQuantumComputation& frozenQuantumComputation, const std::vector<NBitValuesContainer>& inputs, Statistics* optionalRecordedStatistics = nullptr);
+
+    /**
+     * @brief Simulation of an already compiled simulation program for a single input pattern
+     *
+     * Should be preferred over \ref syrec::simpleSimulation "simpleSimulation" when the same quantum computation is simulated for many input patterns.
+     *
+     * @param output Output pattern. The index of the pattern corresponds to the line index.
+     * @param simulationProgram The compiled quantum computation to be simulated.
+     * @param input Input pattern. The bit-width of the input pattern has to be equal to the number of lines.
+     * @param optionalRecordedStatistics Container to optionally store recorded statistics during the simulation of the given input state.
+     */
+    void simpleSimulation(NBitValuesContainer& output, const SimulationProgram& simulationProgram, const NBitValuesContainer& input, Statistics* optionalRecordedStatistics = nullptr);
+
+    /**
+     * @brief Bit-parallel simulation of an already compiled simulation program for multiple input patterns
+     *
+     * @param outputs The output patterns with the i-th output corresponding to the i-th input pattern. Will be cleared if any input pattern was invalid.
+     * @param simulationProgram The compiled quantum computation to be simulated.
+     * @param inputs The input patterns. The bit-width of every pattern has to be equal to the number of lines.
+     * @param optionalRecordedStatistics Container to optionally store recorded statistics during the simulation of the given input states.
+     */
+    void batchSimulation(std::vector<NBitValuesContainer>& outputs, const SimulationProgram& simulationProgram, const std::vector<NBitValuesContainer>& inputs, Statistics* optionalRecordedStatistics = nullptr);
+
+    /**
+     * @brief The maximum number of qubits of a simulation program whose input and output patterns can be stored as integers in the batch simulation.
+     */
+    constexpr std::size_t MAX_NUM_QUBITS_OF_INTEGER_BATCH_SIMULATION = 64U;
+
+    /**
+     * Callback invoked periodically during the bit-parallel simulation of integer input patterns with the number of already simulated input patterns and the total number of input patterns.
+     * Returning false cancels the simulation.
+     */
+    using BatchSimulationProgressCallback = std::function<bool(std::size_t numSimulatedInputs, std::size_t numInputs)>;
+
+    /**
+     * @brief Bit-parallel simulation of an already compiled simulation program for multiple input patterns stored as integers
+     *
+     * The q-th bit of an input or output pattern stores the value of qubit q. Avoids the creation of an \ref syrec::NBitValuesContainer "NBitValuesContainer" per input and output pattern,
+     * but requires that the simulation program operates on at most \ref MAX_NUM_QUBITS_OF_INTEGER_BATCH_SIMULATION qubits.
+     *
+     * @param outputs The output patterns with the i-th output corresponding to the i-th input pattern. Must contain as many elements as @p inputs.
+     * @param simulationProgram The compiled quantum computation to be simulated.
+     * @param inputs The input patterns. Bits not associated with a qubit of the simulation program must not be set.
+     * @param optionalRecordedStatistics Container to optionally store recorded statistics during the simulation of the given input states.
+     * @param progressCallback An optional callback to report the progress of the simulation and to cancel it, the outputs of the reported number of simulated input patterns are already determined when the callback is invoked.
+     * @returns Whether all input patterns could be simulated, false if the simulation was cancelled by the progress callback.
+     */
+    [[nodiscard]] bool batchSimulation(std::span<std::uint64_t> outputs, const SimulationProgram& simulationProgram, std::span<const std::uint64_t> inputs, Statistics* optionalRecordedStatistics = nullptr, const BatchSimulationProgressCallback& progressCallback = nullptr);
+
+    /**
+     * @brief Bit-parallel simulation of a simulation program translated into native code for multiple input patterns
+     *
+     * Determines the same output patterns as the simulation of the translated simulation program but simulates \ref syrec::JitSimulationProgram::LANE_COUNT "JitSimulationProgram::LANE_COUNT" input patterns per execution of the native code.
+     *
+     * @param outputs The output patterns with the i-th output corresponding to the i-th input pattern. Will be cleared if any input pattern was invalid.
+     * @param jitSimulationProgram The translated simulation program to be simulated.
+     * @param inputs The input patterns. The bit-width of every pattern has to be equal to the number of lines.
+     * @param optionalRecordedStatistics Container to optionally store recorded statistics during the simulation of the given input states.
+     */
+    void batchSimulation(std::vector<NBitValuesContainer>& outputs, const JitSimulationProgram& jitSimulationProgram, const std::vector<NBitValuesContainer>& inputs, Statistics* optionalRecordedStatistics = nullptr);
+
+    /**
+     * @brief Bit-parallel simulation of a simulation program translated into native code for multiple input patterns stored as integers
+     *
+     * @param outputs The output patterns with the i-th output corresponding to the i-th input pattern. Must contain as many elements as @p inputs.
+     * @param jitSimulationProgram The translated simulation program to be simulated, which must operate on at most \ref MAX_NUM_QUBITS_OF_INTEGER_BATCH_SIMULATION qubits.
+     * @param inputs The input patterns. Bits not associated with a qubit of the simulation program must not be set.
+     * @param optionalRecordedStatistics Container to optionally store recorded statistics during the simulation of the given input states.
+     * @param progressCallback An optional callback to report the progress of the simulation and to cancel it, the outputs of the reported number of simulated input patterns are already determined when the callback is invoked.
+     * @returns Whether all input patterns could be simulated, false if the simulation was cancelled by the progress callback.
+     */
+    [[nodiscard]] bool batchSimulation(std::span<std::uint64_t> outputs, const JitSimulationProgram& jitSimulationProgram, std::span<const std::uint64_t> inputs, Statistics* optionalRecordedStatistics = nullptr, const BatchSimulationProgressCallback& progressCallback = nullptr);
 } // namespace syrec
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/n_bit_values_container.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace syrec {
+    class FrozenQuantumComputation;
+
+    /**
+     * A quantum computation consisting only of (multi-)controlled X and SWAP gates compiled into a flat structure-of-arrays representation.
+     *
+     * The control qubits of every instruction are stored as triples of (word index, control mask, polarity mask) with each triple covering
+     * the control qubits located in the same 64-bit word of a \ref NBitValuesContainer. The controls of an instruction are thus satisfied if
+     * (stateWord[wordIndex] & controlMask) == polarityMask holds for all of its triples. Sequences of CNOT gates whose targets are neither
+     * targets nor controls of any other CNOT gate of the sequence are fused into a single instruction.
+     *
+     * Compiling a quantum computation once allows the repeated simulation of it without the need to query the (virtual) accessors of its operations.
+     */
+    class SimulationProgram {
+    public:
+        /**
+         * The kinds of instructions of a simulation program.
+         */
+        enum class InstructionKind : std::uint8_t {
+            /**
+             * Flip the target qubit if all controls are satisfied.
+             */
+            Toggle,
+            /**
+             * Swap the values of the two target qubits if all controls are satisfied.
+             */
+            Swap,
+            /**
+             * A sequence of CNOT gates with pairwise disjoint targets that are independent of each other.
+             */
+            FusedCnots
+        };
+
+        /**
+         * The gates of a simulation program as flat arrays with the i-th entry of every per gate array describing the i-th gate, the controls of the i-th gate are stored in the range [controlOffsets[i], controlOffsets[i + 1]).
+         * A positive (negative) control is satisfied if the value of its control qubit is one (zero).
+         */
+        struct GateArrays {
+            std::vector<std::uint8_t>  isSwapGate;
+            std::vector<qc::Qubit>     firstTargetQubits;
+            std::vector<qc::Qubit>     secondTargetQubits;
+            std::vector<std::uint32_t> controlOffsets{0U};
+            std::vector<qc::Qubit>     controlQubits;
+            std::vector<std::uint8_t>  controlPolarities;
+
+            [[nodiscard]] bool operator==(const GateArrays& other) const = default;
+        };
+
+        /**
+         * Compile a quantum computation into a simulation program.
+         * @param quantumComputation The quantum computation to compile.
+         * @param fuseCnotGates Whether sequences of independent CNOT gates are fused into a single instruction. Otherwise, the i-th instruction of the program is the i-th gate of the quantum computation.
+         * @return The compiled simulation program, std::nullopt if the quantum computation contained a NULL operation or a gate that is neither an X nor a SWAP gate. The gates of a qc::CompoundOperation are compiled in place of the latter.
+         */
+        [[nodiscard]] static std::optional<SimulationProgram> compile(const qc::QuantumComputation& quantumComputation, bool fuseCnotGates = true);
+
+        /**
+         * Compile the gates of a frozen quantum computation into a simulation program directly from its struct of arrays, with the i-th instruction of the program being the i-th gate of the frozen quantum computation if CNOT gates are not fused.
+         * @param frozenQuantumComputation The frozen quantum computation to compile.
+         * @param fuseCnotGates Whether sequences of independent CNOT gates are fused into a single instruction.
+         * @return The compiled simulation program, std::nullopt if the frozen quantum computation contained a gate that is neither an X nor a SWAP gate.
+         */
+        [[nodiscard]] static std::optional<SimulationProgram> compile(const FrozenQuantumComputation& frozenQuantumComputation, bool fuseCnotGates = true);
+
+        /**
+         * Compile only the gates of a quantum computation in the backward dependency cone of the given output qubits, i.e. the gates that (transitively) influence the value of any output qubit.
+         *
+         * Simulating the compiled program for an input state yields the same values for the output qubits (and every other qubit of the cone) as simulating the whole quantum computation,
+         * while the values of all qubits outside of the cone remain unchanged. The number of qubits of the program is equal to the one of the quantum computation.
+         * @param quantumComputation The quantum computation to compile.
+         * @param outputQubits The output qubits whose values are of interest.
+         * @param fuseCnotGates Whether sequences of independent CNOT gates of the cone are fused into a single instruction.
+         * @return The compiled simulation program, std::nullopt if an output qubit was out of range or the quantum computation could not be compiled by compile(const qc::QuantumComputation&, bool).
+         */
+        [[nodiscard]] static std::optional<SimulationProgram> compileOutputCone(const qc::QuantumComputation& quantumComputation, std::span<const qc::Qubit> outputQubits, bool fuseCnotGates = true);
+
+        /**
+         * Simulate the program for a single input state.
+         * @param state The input state which is modified directly and contains the output state afterwards.
+         * @return Whether the size of the state matched the number of qubits of the program.
+         */
+        [[nodiscard]] bool simulate(NBitValuesContainer& state) const;
+
+        /**
+         * Bit-parallel simulation of the program with the i-th bit of @p laneValuesPerQubit[q] storing the value of qubit q in the i-th simulated input state.
+         * @param laneValuesPerQubit The lane values of every qubit which are modified directly.
+         * @return Whether the number of lane values matched the number of qubits of the program.
+         */
+        [[nodiscard]] bool simulate(std::vector<std::uint64_t>& laneValuesPerQubit) const;
+
+        /**
+         * Bit-parallel simulation of a single instruction of the program restricted to the given lanes, the values of all other lanes remain unchanged.
+         * @param instructionIndex The index of the simulated instruction, which is not validated.
+         * @param laneValuesPerQubit The lane values of every qubit which are modified directly, the number of lane values is not validated.
+         * @param maskOfLanes The mask of the lanes in which the instruction is applied.
+         */
+        void simulateInstruction(std::size_t instructionIndex, std::vector<std::uint64_t>& laneValuesPerQubit, std::uint64_t maskOfLanes) const;
+
+        /**
+         * Export the instructions of the program as flat arrays of gates (i.e. for the upload of the program to a device), with every fused CNOT gate being exported as a separate gate.
+         * The second target qubit of a gate other than a SWAP gate is equal to its first target qubit.
+         * @return The exported gates.
+         */
+        [[nodiscard]] GateArrays exportGateArrays() const;
+
+        /**
+         * @return The number of qubits of the compiled quantum computation.
+         */
+        [[nodiscard]] std::size_t getNumQubits() const noexcept {
+            return numQubits;
+        }
+
+        /**
+         * @return The number of instructions of the program (with a sequence of fused CNOT gates counting as a single instruction).
+         */
+        [[nodiscard]] std::size_t getNumInstructions() const noexcept {
+            return instructionKinds.size();
+        }
+
+        /**
+         * @return The number of gates of the compiled quantum computation.
+         */
+        [[nodiscard]] std::size_t getNumGates() const noexcept {
+            return numGates;
+        }
+
+    protected:
+        SimulationProgram() = default;
+
+        /**
+         * Compile the gates provided by the gate accessor, which offers the type, the target qubits and the controls of the gate with a given index, into a simulation program.
+         */
+        template<typename GateAccessor>
+        [[nodiscard]] static std::optional<SimulationProgram> compileGates(std::size_t numQubits, std::size_t numGates, bool fuseCnotGates, GateAccessor& gateAccessor);
+
+        std::size_t numQubits = 0;
+        std::size_t numGates  = 0;
+
+        // Per instruction data
+        std::vector<InstructionKind> instructionKinds;
+        std::vector<std::size_t>     firstControlTripleOfInstruction;
+        std::vector<qc::Qubit>       firstTargetQubitOfInstruction;
+        std::vector<qc::Qubit>       secondTargetQubitOfInstruction;
+        std::vector<std::size_t>     firstFusedCnotOfInstruction;
+
+        // Control triples of toggle and swap instructions, the triples of the i-th instruction are stored in the range [firstControlTripleOfInstruction[i], firstControlTripleOfInstruction[i + 1])
+        std::vector<std::size_t>   controlWordIndices;
+        std::vector<std::uint64_t> controlMasks;
+        std::vector<std::uint64_t> controlPolarityMasks;
+
+        // Fused CNOT gates, the gates of the i-th instruction are stored in the range [firstFusedCnotOfInstruction[i], firstFusedCnotOfInstruction[i + 1])
+        std::vector<qc::Qubit> fusedCnotControlQubits;
+        std::vector<bool>      fusedCnotControlPolarities;
+        std::vector<qc::Qubit> fusedCnotTargetQubits;
+    };
+} // namespace syrec
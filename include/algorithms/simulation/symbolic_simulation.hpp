@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "algorithms/simulation/equivalence_checking.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace syrec {
+
+    /**
+     * Settings of the symbolic simulation of quantum computations consisting only of (multi-)controlled X and SWAP gates.
+     */
+    struct SymbolicSimulationSettings {
+        /**
+         * The order of the variables of the binary decision diagrams (BDDs) representing the values of the qubits, with every variable being associated with a primary input.
+         */
+        enum class VariableOrder : std::uint8_t {
+            /**
+             * The variables are ordered like the primary inputs, i.e. by descending qubit index.
+             */
+            PrimaryInputs,
+            /**
+             * The variables are ordered by the first gate of the first quantum computation operating on the associated primary input, with unused primary inputs being ordered last.
+             * Since the synthesis of word-level operations usually processes the bits of its operands in the same order, the variables associated with the bits of the same significance of
+             * different operands are placed next to each other, which keeps the BDDs of arithmetic operations small.
+             */
+            FirstUse
+        };
+
+        VariableOrder variableOrder = VariableOrder::FirstUse;
+        /**
+         * The maximum number of nodes of the BDDs shared by all qubits of both quantum computations.
+         */
+        std::size_t maxNumNodes = static_cast<std::size_t>(1U) << 22U;
+    };
+
+    /**
+     * Check whether two quantum computations consisting only of (multi-)controlled X and SWAP gates compute the same function on their primary inputs and outputs by simulating them symbolically.
+     *
+     * The primary inputs and outputs are determined as in checkEquivalence(...). Every qubit stores a reduced ordered binary decision diagram (BDD) over the primary inputs (with the ancillary qubits being
+     * initialized to the constant zero function), which is updated gate by gate with a multi-controlled X gate XOR-ing the conjunction of its controls onto its target and a controlled SWAP gate exchanging
+     * the functions of its targets for the assignments satisfying its controls. Since the BDDs are canonical, the i-th primary outputs of both quantum computations are equal for all assignments iff their BDDs
+     * are the same node. In contrast to the simulation-based check, the runtime thus does not depend on the number of assignments of the primary inputs but on the size of the BDDs, which is small for
+     * arithmetic circuits if the variables associated with bits of the same significance are placed next to each other (see SymbolicSimulationSettings::VariableOrder::FirstUse).
+     *
+     * @param lhs The first quantum computation.
+     * @param rhs The second quantum computation.
+     * @param settings The settings of the symbolic simulation.
+     * @return The result of the equivalence check, which is either Equivalent, NotEquivalent (with a counterexample if the numbers of primary inputs and outputs match), NotSupported or LimitExceeded.
+     */
+    [[nodiscard]] auto checkEquivalenceSymbolically(const qc::QuantumComputation& lhs, const qc::QuantumComputation& rhs, const SymbolicSimulationSettings& settings = SymbolicSimulationSettings()) -> EquivalenceCheckingResult;
+
+} // namespace syrec
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "ir/Definitions.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <span>
+
+namespace syrec {
+    /**
+     * Determine the number of ancillary qubits required by an adder architecture to synthesize the addition of two operands.
+     * @param adderArchitecture The adder architecture used to synthesize the addition.
+     * @param bitwidth The bitwidth of the operands of the addition.
+     * @param isCarryOutComputed Whether the carry out of the addition is computed.
+     * @return The number of required ancillary qubits, which are reset to zero by the synthesized addition.
+     */
+    [[nodiscard]] std::size_t determineNumberOfAncillaryQubitsRequiredByAdder(AdderArchitecture adderArchitecture, std::size_t bitwidth, bool isCarryOutComputed);
+
+    /**
+     * The number of quantum operations synthesized by an adder architecture for the addition of two operands grouped by the number of control qubits of the operations (not considering propagated control qubits).
+     */
+    struct NumberOfQuantumOperationsOfAdder {
+        std::size_t numNotGates     = 0;
+        std::size_t numCnotGates    = 0;
+        std::size_t numToffoliGates = 0;
+    };
+
+    /**
+     * Determine the number of quantum operations synthesized by an adder architecture for the addition of two operands without synthesizing the addition.
+     * @param adderArchitecture The adder architecture used to synthesize the addition.
+     * @param bitwidth The bitwidth of the operands of the addition.
+     * @param isCarryOutComputed Whether the carry out of the addition is computed.
+     * @return The number of quantum operations synthesized by synthesizeInplaceAddition(...) for the given parameters.
+     */
+    [[nodiscard]] NumberOfQuantumOperationsOfAdder determineNumberOfQuantumOperationsOfAdder(AdderArchitecture adderArchitecture, std::size_t bitwidth, bool isCarryOutComputed);
+
+    /**
+     * Synthesizes the addition \p lhs + \p rhs using the given adder architecture and stores the result in the qubits of the rhs operand.
+     *
+     * The quantum operations of the addition are controlled by the control qubits propagated by the \p annotatableQuantumComputation.
+     * @param annotatableQuantumComputation The annotatable quantum computation to which the generated gates are added.
+     * @param adderArchitecture The adder architecture used to synthesize the addition.
+     * @param lhs The left hand side operand of the addition.
+     * @param rhs The right hand side operand of the addition.
+     * @param ancillaryQubits The ancillary qubits, initially set to zero, used by the adder architecture whose number must match the one determined by determineNumberOfAncillaryQubitsRequiredByAdder(...).
+     * @param optionalCarryOut Optionally pass the qubit whose value is toggled if the addition produced a carry out.
+     * @return Whether the addition could be synthesized (i.e. the operands have the same bitwidth, the expected number of ancillary qubits was provided and all required gates could be added to the \p annotatableQuantumComputation).
+     */
+    [[nodiscard]] bool synthesizeInplaceAddition(AnnotatableQuantumComputation& annotatableQuantumComputation, AdderArchitecture adderArchitecture, std::span<const qc::Qubit> lhs, std::span<const qc::Qubit> rhs, std::span<const qc::Qubit> ancillaryQubits, const std::optional<qc::Qubit>& optionalCarryOut = std::nullopt);
+} // namespace syrec
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "ir/Definitions.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <unordered_set>
+#include <vector>
+
+namespace syrec {
+    /**
+     * A pool of ancillary qubits that were reset to their initial state of zero and can thus be borrowed instead of allocating new ancillary qubits.
+     *
+     * The released qubits are managed in a hierarchy of scopes with qubits only being borrowed from the last opened scope. A closed scope hands its released qubits to its parent scope.
+     * Scopes are used to prevent that the quantum operations synthesized for a sequence of statements (i.e. a module body or a loop body) access ancillary qubits created outside of said statements,
+     * which would prevent the reuse of the synthesized quantum operations with remapped qubits.
+     */
+    class AncillaryQubitPool {
+    public:
+        AncillaryQubitPool():
+            scopes(1) {}
+
+        /**
+         * Open a new scope from which qubits are borrowed and to which qubits are released until the scope is closed.
+         */
+        void openScope();
+
+        /**
+         * Close the last opened scope and hand its released qubits to the parent scope.
+         * @return Whether a scope was closed, the outermost scope cannot be closed.
+         */
+        [[maybe_unused]] bool closeScope();
+
+        /**
+         * Release qubits reset to their initial state of zero to the last opened scope.
+         * @param qubits The released qubits. Qubits already released to any scope are ignored.
+         */
+        void releaseQubits(const std::vector<qc::Qubit>& qubits);
+
+        /**
+         * Borrow a qubit from the last opened scope.
+         * @return The borrowed qubit, std::nullopt if no qubit was released to the last opened scope.
+         */
+        [[nodiscard]] std::optional<qc::Qubit> tryBorrowQubit();
+
+        /**
+         * @return Whether any qubit can be borrowed from the last opened scope.
+         */
+        [[nodiscard]] bool hasReleasedQubitsInLastOpenedScope() const noexcept {
+            return !scopes.back().empty();
+        }
+
+        /**
+         * @return The qubits borrowed from the pool in the order in which they were borrowed.
+         */
+        [[nodiscard]] const std::vector<qc::Qubit>& getBorrowedQubits() const noexcept {
+            return borrowedQubits;
+        }
+
+    protected:
+        std::vector<std::vector<qc::Qubit>> scopes;
+        std::unordered_set<qc::Qubit>       releasedQubits;
+        std::vector<qc::Qubit>              borrowedQubits;
+    };
+} // namespace syrec
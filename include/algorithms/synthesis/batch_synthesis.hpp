@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/diagnostics.hpp"
+#include "core/statistics.hpp"
+#include "core/syrec/program.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace syrec {
+    /**
+     * The synthesizers usable to synthesize the jobs of a batch synthesis.
+     */
+    enum class SynthesisAlgorithm : std::uint8_t {
+        CostAware,
+        LineAware,
+        Hybrid
+    };
+
+    /**
+     * A SyReC program to synthesize as part of a batch synthesis.
+     */
+    struct BatchSynthesisJob {
+        /**
+         * The program to synthesize. The program must outlive the batch synthesis but can be shared between multiple jobs since the synthesis does not modify the program.
+         */
+        const Program* program = nullptr;
+        /**
+         * The settings used to synthesize the program.
+         */
+        ConfigurableOptions settings;
+        /**
+         * The synthesizer used to synthesize the program.
+         */
+        SynthesisAlgorithm synthesisAlgorithm = SynthesisAlgorithm::CostAware;
+    };
+
+    /**
+     * The result of a job of a batch synthesis.
+     */
+    struct BatchSynthesisResult {
+        /**
+         * Whether the synthesis of the job was successful.
+         */
+        bool synthesisOk = false;
+        /**
+         * The quantum computation synthesized for the program of the job.
+         */
+        std::unique_ptr<AnnotatableQuantumComputation> annotatableQuantumComputation;
+        /**
+         * The statistics recorded during the synthesis of the job.
+         */
+        Statistics statistics;
+        /**
+         * The errors reported during the synthesis of the job.
+         */
+        Diagnostics diagnostics;
+    };
+
+    /**
+     * @brief Synthesize multiple independent SyReC programs in parallel
+     *
+     * Every job is synthesized by a separate synthesizer instance into its own annotatable quantum computation, thus the jobs do not share any synthesis state.
+     * The jobs are synthesized by the worker threads of the shared syrec::Executor which claim the next not yet started job whenever they finished their previous one, thus jobs with a long synthesis time do not delay the
+     * processing of the remaining jobs.
+     *
+     * The synthesis errors of a job are collected in the diagnostics of its result, thus the errors of jobs synthesized at the same time are not interleaved.
+     *
+     * @param results The results with the i-th result corresponding to the i-th job.
+     * @param jobs The jobs to synthesize.
+     * @param numThreads The maximum number of threads synthesizing jobs at the same time. A value of zero uses the number of concurrent threads supported by the hardware.
+     * @param deterministic Whether the jobs are partitioned into a fixed number of groups each synthesized sequentially by a single thread instead of being claimed one by one (see Executor::parallelFor(...)).
+     */
+    void batchSynthesis(std::vector<BatchSynthesisResult>& results, const std::vector<BatchSynthesisJob>& jobs, std::size_t numThreads = 0U, bool deterministic = false);
+} // namespace syrec
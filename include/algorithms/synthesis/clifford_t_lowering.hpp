@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/statistics.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <cstddef>
+
+namespace syrec {
+    /**
+     * The settings of lowerToCliffordT(...).
+     */
+    struct CliffordTLoweringSettings {
+        /**
+         * Whether the Toffoli gates of the decomposition of a multi-controlled X gate, whose relative phase is cancelled by their uncomputation, are implemented by relative-phase Toffoli gates requiring four instead of seven T gates.
+         */
+        bool useRelativePhaseToffoliGates = true;
+        /**
+         * Whether clean ancillary qubits are added to the lowered quantum computation if the qubits known to be zero prior to a multi-controlled gate do not suffice for its decomposition. Otherwise, the decomposition borrows the idle qubits
+         * of the quantum computation as dirty ancillary qubits, which requires more T gates and fails if the quantum computation does not have enough idle qubits.
+         */
+        bool addCleanAncillaryQubits = true;
+    };
+
+    /**
+     * @brief Lower a quantum computation consisting only of (multi-controlled) X and SWAP gates to the Clifford+T gate set (i.e. H, T, T^dagger, X and CNOT gates)
+     *
+     * The gates are decomposed as follows, with negative control qubits being conjugated by X gates:
+     * - An X gate with at most one control qubit is kept.
+     * - A Toffoli gate is decomposed into seven T gates.
+     * - An X gate with n > 2 control qubits is decomposed into a V-chain of Toffoli gates using n - 2 ancillary qubits. If enough clean ancillary qubits (i.e. ancillary qubits whose value is known to be zero prior to the gate according to
+     *   the propagation of the constant values of the ancillary qubits, or qubits added by the lowering) are available, the conjunction of the control qubits is computed into and afterwards uncomputed from the ancillary qubits, with the
+     *   computing Toffoli gates being implementable by relative-phase Toffoli gates. Otherwise, idle qubits of the quantum computation are borrowed as dirty ancillary qubits whose values are restored by the decomposition of
+     *   Barenco et al. (Elementary gates for quantum computation, Lemma 7.2).
+     * - A SWAP gate with control qubits C is decomposed into a CNOT gate, an X gate controlled by C and one of the swapped qubits, and another CNOT gate.
+     *
+     * The qubits of the quantum computation keep their index while the clean ancillary qubits added by the lowering are appended as ancillary qubits, all of which are restored to zero after every decomposed gate.
+     *
+     * @param loweredQuantumComputation The lowered quantum computation. Will be reset if the quantum computation could not be lowered.
+     * @param quantumComputation The quantum computation to lower. The gates of a qc::CompoundOperation are lowered in place of the latter.
+     * @param settings The settings of the lowering.
+     * @param optionalRecordedStatistics Container to optionally store the runtime as well as the T-count and T-depth of the lowered quantum computation.
+     * @returns Whether all gates of the quantum computation could be lowered.
+     */
+    [[nodiscard]] bool lowerToCliffordT(qc::QuantumComputation& loweredQuantumComputation, const qc::QuantumComputation& quantumComputation, const CliffordTLoweringSettings& settings = CliffordTLoweringSettings(), Statistics* optionalRecordedStatistics = nullptr);
+
+    /**
+     * @brief Determine the number of T and T^dagger gates of a quantum computation.
+     * @param quantumComputation The quantum computation. The gates of a qc::CompoundOperation are counted in place of the latter.
+     * @returns The T-count of the quantum computation.
+     */
+    [[nodiscard]] std::size_t determineTCount(const qc::QuantumComputation& quantumComputation);
+
+    /**
+     * @brief Determine the T-depth of a quantum computation (i.e. the maximum number of T and T^dagger gates in a sequence of gates in which every gate shares a qubit with its successor).
+     * @param quantumComputation The quantum computation. The gates of a qc::CompoundOperation are considered in place of the latter.
+     * @returns The T-depth of the quantum computation.
+     */
+    [[nodiscard]] std::size_t determineTDepth(const qc::QuantumComputation& quantumComputation);
+} // namespace syrec
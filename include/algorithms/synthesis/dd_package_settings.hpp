@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "dd/DDpackageConfig.hpp"
+#include "dd/Package.hpp"
+
+#include <cstddef>
+#include <memory>
+
+namespace syrec {
+
+    // the sizes of the tables of the DD packages created by the DD based synthesis and the extraction of truth tables, with the defaults being the ones of dd::DDPackageConfig.
+    // functions of 16 or more variables usually benefit from larger tables, since the default tables are resized (unique tables) or overwrite their entries (compute tables) constantly.
+    // all numbers of buckets should be powers of two.
+    struct DDPackageSettings {
+        // the number of buckets of the unique tables of the vector and matrix nodes of every level.
+        std::size_t uniqueTableNumBuckets = dd::DDPackageConfig{}.utMatNumBucket;
+        // the number of nodes allocated by the memory manager of a unique table at once, with every further allocation growing the previous one.
+        std::size_t uniqueTableInitialAllocationSize = dd::DDPackageConfig{}.utMatInitialAllocationSize;
+        // the number of buckets of the compute tables of the multiplications of matrix DDs with matrix and vector DDs (the only operations performed by the DD based synthesis).
+        std::size_t multiplicationComputeTableNumBuckets = dd::DDPackageConfig{}.ctMatMatMultNumBucket;
+        // the number of buckets of the compute tables of the additions of matrix and vector DDs.
+        std::size_t additionComputeTableNumBuckets = dd::DDPackageConfig{}.ctMatAddNumBucket;
+
+        [[nodiscard]] auto toPackageConfig() const -> dd::DDPackageConfig;
+    };
+
+    // creates a DD package for the given number of qubits whose tables are sized according to the settings.
+    [[nodiscard]] auto createDDPackage(std::size_t nQubits, const DDPackageSettings& settings) -> std::unique_ptr<dd::Package>;
+
+} // namespace syrec
@@ -10,6 +10,11 @@
 
 #pragma once
 
+#include "algorithms/optimization/esop_minimization.hpp"
+#include "algorithms/synthesis/dd_package_settings.hpp"
+#include "algorithms/synthesis/truth_table_pipeline.hpp"
+#include "core/execution_limits.hpp"
+#include "core/progress_reporting.hpp"
 #include "core/truthTable/truth_table.hpp"
 #include "dd/Node.hpp"
 #include "dd/Package.hpp"
@@ -17,50 +22,231 @@
 #include "ir/QuantumComputation.hpp"
 #include "ir/operations/Control.hpp"
 
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace syrec {
 
+    // the don't cares in the inputs are expanded symbolically (i.e. both children of the respective node are built from the same entry) instead of completing the inputs,
+    // which requires the completions of different inputs to be disjoint.
     auto buildDD(const TruthTable& tt, std::unique_ptr<dd::Package>& dd) -> dd::mEdge;
 
+    // builds the same DD as buildDD but splits a single packed copy of the truth table entries instead of copying the cubes into sub-tables
+    // and builds identical sub-tables only once (requires at most 64 inputs, otherwise buildDD is used).
+    auto buildDDMemoized(const TruthTable& tt, std::unique_ptr<dd::Package>& dd) -> dd::mEdge;
+    // builds the DD of a packed truth table (with the same number of inputs and outputs) without converting it back into a truth table.
+    auto buildDDMemoized(const PackedTruthTable& tt, std::unique_ptr<dd::Package>& dd) -> dd::mEdge;
+
+    // the reordering of the lines of a truth table prior to its DD based synthesis with the number of nodes of the DD of the reordered truth table being minimized.
+    struct LineReorderingSettings {
+        enum class Strategy : std::uint8_t {
+            // the lines keep the order of the positions of the cubes of the truth table.
+            None,
+            // every line is moved to the position minimizing the number of nodes while the relative order of the other lines is kept.
+            Sifting,
+            // all permutations of the lines of a window of `windowSize` adjacent positions are evaluated for every start position of the window.
+            WindowPermutation
+        };
+
+        Strategy    strategy   = Strategy::Sifting;
+        std::size_t windowSize = 3U;
+        // the passes over all lines (or window positions) are repeated until a pass does not reduce the number of nodes or this number of passes was performed.
+        std::size_t maxNumPasses = 2U;
+    };
+
+    // determines an order of the lines of the truth table with the i-th position of the cubes of the reordered truth table being the position `order[i]` of the cubes of the given one.
+    // the natural order is returned if the truth table does not have the same number of inputs and outputs or cannot be packed (see TruthTablePipeline::apply).
+    auto determineLineOrder(const TruthTable& tt, const LineReorderingSettings& settings) -> std::vector<std::size_t>;
+
+    // reorders the positions of the inputs and outputs as well as the constant and garbage lines of the truth table according to the order determined by determineLineOrder.
+    auto reorderLines(const TruthTable& tt, const std::vector<std::size_t>& order) -> TruthTable;
+
     class DDSynthesizer {
     public:
-        static auto synthesizeCodingTechniques(const TruthTable& tt, const bool withAdditionalLine = true) -> std::shared_ptr<qc::QuantumComputation> {
-            DDSynthesizer synthesizer{};
-            return synthesizer.synthesizeCodingTechniquesTT(tt, withAdditionalLine);
+        // determines when the nodes of the DD package no longer referenced by the synthesized DD are garbage collected.
+        struct GarbageCollectionPolicy {
+            enum class Trigger : std::uint8_t {
+                // the DD package decides whether a collection is required after every operation (i.e. once its unique table reached its own limit).
+                PackageManaged,
+                // the nodes are collected once the unique table stores at least `nodeCountThreshold` nodes.
+                NodeCountThreshold,
+                // the nodes are collected once the memory used by the DD package exceeds `memoryBudgetInMiB`.
+                MemoryBudget,
+                // the nodes are collected after every `numIterationsBetweenCollections` iterations of the synthesis.
+                EveryKIterations
+            };
+
+            Trigger     trigger                         = Trigger::PackageManaged;
+            std::size_t nodeCountThreshold              = 1U << 16U;
+            double      memoryBudgetInMiB               = 512.;
+            std::size_t numIterationsBetweenCollections = 16U;
+        };
+
+        // bounds the effort of `synthesize` to trade the quality (i.e. the number of gates) of the synthesized circuit against the runtime of the synthesis.
+        struct EffortSettings {
+            // path signatures (and sets of unique paths) with more than this number of cubes are neither minimized nor extended by the paths to other nodes with the same signatures. zero disables the cap.
+            std::size_t maxPathSignatureSize = 0U;
+            // the unique paths are shifted by `shiftUniquePaths` using only the paths from the root to the `current` node instead of searching the unique table for all nodes with the same signatures.
+            bool greedyUniquePathSearch = false;
+            // once this budget (measured from the start of every call of `synthesize`) is exceeded, the remaining synthesis uses the fallback strategy which neither searches the unique table
+            // for nodes with the same signatures nor minimizes any signature. zero disables the budget.
+            std::chrono::nanoseconds timeBudget{0};
+
+            [[nodiscard]] auto isBounded() const -> bool {
+                return maxPathSignatureSize != 0U || greedyUniquePathSearch || timeBudget.count() != 0;
+            }
+        };
+
+        // the mode in which `synthesize` shifts the paths of the nodes.
+        enum class EffortMode : std::uint8_t {
+            // all nodes with the same signatures are searched and all signatures are minimized.
+            Exhaustive,
+            // the effort is bounded by the cap on the path signature sizes and the greedy unique path search of the effort settings.
+            Bounded,
+            // the time budget of the effort settings was exceeded.
+            Fallback
+        };
+
+        // statistics of the DD package recorded at the end of the synthesis.
+        struct Statistics {
+            // the number of nodes stored in the unique tables at the end of the synthesis and the sum of the largest numbers of nodes stored in the unique table of every level during the latter.
+            std::size_t numNodes              = 0U;
+            std::size_t peakNumNodes          = 0U;
+            std::size_t numGarbageCollections = 0U;
+            std::size_t uniqueTableLookups    = 0U;
+            std::size_t uniqueTableHits       = 0U;
+            std::size_t computeTableLookups   = 0U;
+            std::size_t computeTableHits      = 0U;
+            // The memory of the DD package in MiB in use at the end of the synthesis and the largest amount used during the latter.
+            double activeMemoryInMiB = 0.;
+            double peakMemoryInMiB   = 0.;
+            // the mode in which the synthesis finished, i.e. Fallback if any gate was synthesized after the time budget was exceeded.
+            EffortMode effortMode = EffortMode::Exhaustive;
+
+            [[nodiscard]] auto uniqueTableHitRatio() const -> double {
+                return uniqueTableLookups == 0U ? 0. : static_cast<double>(uniqueTableHits) / static_cast<double>(uniqueTableLookups);
+            }
+
+            [[nodiscard]] auto computeTableHitRatio() const -> double {
+                return computeTableLookups == 0U ? 0. : static_cast<double>(computeTableHits) / static_cast<double>(computeTableLookups);
+            }
+        };
+
+        // determines how the synthesis using coding techniques decodes the primary outputs from the codewords.
+        enum class DecoderMode : std::uint8_t {
+            // the r most significant outputs are decoded by one multi-controlled X gate per codeword and set output bit, while the remaining (m - r) outputs are decoded by the DD based synthesis
+            // of a correction truth table built from the completions of the codewords.
+            DDSynthesis,
+            // every decoded line is XORed with an ESOP of the other lines, which consists of disjoint cubes covering the codewords whose line has to be flipped (minimized via minbool::minimizeBoolean if the
+            // completion of these cubes is small enough). the (m - r) remaining outputs are decoded by the DD based synthesis if flipping one of them for some codewords would also flip it for another codeword.
+            EsopNetwork
+        };
+
+        DDSynthesizer() = default;
+
+        explicit DDSynthesizer(const GarbageCollectionPolicy& garbageCollectionPolicy, const DDPackageSettings& ddPackageSettings = {}):
+            garbageCollectionPolicy(garbageCollectionPolicy), ddPackageSettings(ddPackageSettings) {}
+
+        static auto synthesizeCodingTechniques(const TruthTable& tt, const bool withAdditionalLine = true, const DecoderMode decoderMode = DecoderMode::DDSynthesis, const DDPackageSettings& ddPackageSettings = {}) -> std::shared_ptr<qc::QuantumComputation> {
+            DDSynthesizer synthesizer({}, ddPackageSettings);
+            return synthesizer.synthesizeCodingTechniquesTT(tt, withAdditionalLine, decoderMode);
+        }
+
+        static auto synthesizeOnePass(const TruthTable& tt, const bool memoizeDDConstruction = false, const DDPackageSettings& ddPackageSettings = {}) -> std::shared_ptr<qc::QuantumComputation> {
+            DDSynthesizer synthesizer({}, ddPackageSettings);
+            return synthesizer.synthesizeOnePassTT(tt, memoizeDDConstruction);
         }
 
-        static auto synthesizeOnePass(const TruthTable& tt) -> std::shared_ptr<qc::QuantumComputation> {
+        // synthesizes the truth tables concurrently using the one-pass synthesis with the i-th circuit being synthesized for the i-th truth table.
+        // a `numThreads` of zero uses the number of concurrent threads supported by the hardware.
+        static auto synthesizeOnePassBatch(const std::vector<TruthTable>& tts, std::size_t numThreads = 0U, bool memoizeDDConstruction = false) -> std::vector<std::shared_ptr<qc::QuantumComputation>>;
+
+        // experimental: partitions the outputs of the truth table into at most `maxNumPartitions` groups of outputs sharing most of their inputs (i.e. by their output cones)
+        // and synthesizes the partitions concurrently using the one-pass synthesis. the circuits of the partitions are composed by computing the outputs of a partition,
+        // copying them to dedicated output lines and uncomputing the partition again, thus the composed circuit requires one line per input and output (and the ancillary lines of the largest partition).
+        static auto synthesizeOnePassPartitioned(const TruthTable& tt, std::size_t maxNumPartitions, std::size_t numThreads = 0U) -> std::shared_ptr<qc::QuantumComputation>;
+
+        // synthesizes the truth table (with the same number of inputs and outputs) after reordering its lines to reduce the number of nodes of its DD (see determineLineOrder).
+        // the operations of the circuit act on the reordered lines while the initial layout and the output permutation of the circuit map them to the lines of the truth table.
+        static auto synthesizeWithReorderedLines(const TruthTable& tt, const LineReorderingSettings& settings = {}) -> std::shared_ptr<qc::QuantumComputation> {
             DDSynthesizer synthesizer{};
-            return synthesizer.synthesizeOnePassTT(tt);
+            return synthesizer.synthesizeWithReorderedLinesTT(tt, settings);
         }
 
+        // returns no circuit if any of the execution limits was violated during the synthesis (see setExecutionLimits).
         auto synthesize(dd::mEdge src, std::unique_ptr<dd::Package>& dd) -> std::shared_ptr<qc::QuantumComputation>;
 
+        // the limits of `synthesize` are checked prior to processing every node of its breadth-first traversal, with the runtime being measured from the start of every call.
+        auto setExecutionLimits(const ExecutionLimits& limits) -> void {
+            executionLimits = limits;
+        }
+
+        // the effort of `synthesize`, which is exhaustive by default.
+        auto setEffortSettings(const EffortSettings& settings) -> void {
+            effortSettings = settings;
+        }
+
+        // the number of processed nodes and emitted gates of `synthesize` are reported at most once per `minDurationBetweenReports` as well as once at the end of every call.
+        auto setProgressCallback(ProgressCallback callback, const std::chrono::milliseconds minDurationBetweenReports = std::chrono::milliseconds(100)) -> void {
+            progressCallback                  = std::move(callback);
+            minDurationBetweenProgressReports = minDurationBetweenReports;
+        }
+
+        // the sizes of the tables of the DD package created by the next synthesis of a truth table (a DD package passed to `synthesize` is used as is).
+        auto setDDPackageSettings(const DDPackageSettings& settings) -> void {
+            ddPackageSettings = settings;
+        }
+
+        // the violated execution limit due to which the last call of `synthesize` was stopped.
+        [[nodiscard]] auto getExecutionLimitViolation() const -> ExecutionLimitViolation {
+            return executionLimitViolation;
+        }
+
         [[nodiscard]] auto numGate() const -> std::size_t {
             return numGates;
         }
 
         auto reset() -> void {
-            runtime     = 0.;
-            numGates    = 0U;
-            n           = 0U;
-            m           = 0U;
-            totalNoBits = 0U;
-            r           = 0U;
-            garbageFlag = false;
+            runtime                 = 0.;
+            numGates                = 0U;
+            n                       = 0U;
+            m                       = 0U;
+            totalNoBits             = 0U;
+            r                       = 0U;
+            garbageFlag             = false;
+            statistics              = {};
+            executionLimitViolation = ExecutionLimitViolation::None;
+            pathSignatureCache.clear();
+            minimizedExpressionCache.clear();
         }
 
         [[nodiscard]] auto getExecutionTime() const -> double {
             return runtime;
         }
 
+        [[nodiscard]] auto getStatistics() const -> const Statistics& {
+            return statistics;
+        }
+
     private:
         double                                  runtime  = 0.;
         std::size_t                             numGates = 0U;
         std::unique_ptr<dd::Package>            ddSynth;
         std::shared_ptr<qc::QuantumComputation> qc;
+        GarbageCollectionPolicy                 garbageCollectionPolicy;
+        DDPackageSettings                       ddPackageSettings;
+        Statistics                              statistics;
+        ExecutionLimits                         executionLimits;
+        EffortSettings                          effortSettings;
+        EffortMode                              effortMode              = EffortMode::Exhaustive;
+        ExecutionLimitViolation                 executionLimitViolation = ExecutionLimitViolation::None;
+        ProgressCallback                        progressCallback;
+        std::chrono::milliseconds               minDurationBetweenProgressReports{100};
 
         // n -> No. of primary inputs.
         // m -> No. of primary outputs.
@@ -73,13 +259,48 @@ namespace syrec {
         std::size_t r           = 0U;
         bool        garbageFlag = false;
 
-        static auto pathFromSrcDst(dd::mEdge const& src, dd::mNode* const& dst, TruthTable::Cube::Set& sigVec) -> void;
+        // number of iterations of the synthesis since the last garbage collection triggered by the `EveryKIterations` policy.
+        std::size_t numIterationsSinceGarbageCollection = 0U;
+
+        // key of the memoized paths starting at a node on a given level and ending at the destination node (or at a terminal for a path signature, i.e. no destination node)
+        struct PathSignatureCacheKey {
+            const dd::mNode* node;
+            std::size_t      level;
+            const dd::mNode* destination;
+            bool             isIdentity;
+
+            auto operator==(const PathSignatureCacheKey& other) const -> bool = default;
+        };
+
+        struct PathSignatureCacheKeyHash {
+            auto operator()(const PathSignatureCacheKey& key) const noexcept -> std::size_t;
+        };
+
+        // the paths are stored as sorted packed cubes (with the first position of a cube being stored in the most significant bit) and thus only for paths of at most 64 levels.
+        // since the nodes of a DD are never modified, only the garbage collection of nodes by the DD package invalidates the memoized paths.
+        std::unordered_map<PathSignatureCacheKey, std::vector<std::uint64_t>, PathSignatureCacheKeyHash> pathSignatureCache;
+
+        // the same sets of control cubes are minimized repeatedly since the synthesis restarts from the `src` node after every shifted path.
+        minbool::MinimizedExpressionCache minimizedExpressionCache;
+
+        auto        pathFromSrcDst(dd::mEdge const& src, dd::mNode* const& dst, TruthTable::Cube::Set& sigVec) -> void;
         static auto pathFromSrcDst(dd::mEdge const& src, size_t level, dd::mNode* const& dst, TruthTable::Cube::Set& sigVec, TruthTable::Cube& cube) -> void;
+        auto        packedPathsFromSrcDst(dd::mEdge const& src, size_t level, dd::mNode* const& dst) -> const std::vector<std::uint64_t>&;
 
-        [[nodiscard]] static auto finalSrcPathSignature(dd::mEdge const& src, dd::mEdge const& current, TruthTable::Cube::Set const& p1SigVec, TruthTable::Cube::Set const& p2SigVec, bool const& changePaths, std::unique_ptr<dd::Package>& dd) -> TruthTable::Cube::Set;
+        [[nodiscard]] auto finalSrcPathSignature(dd::mEdge const& src, dd::mEdge const& current, TruthTable::Cube::Set const& p1SigVec, TruthTable::Cube::Set const& p2SigVec, bool const& changePaths, std::unique_ptr<dd::Package>& dd) -> TruthTable::Cube::Set;
 
-        static auto pathSignature(dd::mEdge const& src, size_t pathLength, TruthTable::Cube::Set& sigVec) -> void;
+        auto        pathSignature(dd::mEdge const& src, size_t pathLength, TruthTable::Cube::Set& sigVec) -> void;
         static auto pathSignature(dd::mEdge const& src, size_t pathLength, TruthTable::Cube::Set& sigVec, TruthTable::Cube& cube) -> void;
+        auto        packedPathSignature(dd::mEdge const& src, size_t pathLength) -> const std::vector<std::uint64_t>&;
+
+        // `isEndOfIteration` marks the garbage collection performed after the paths of a node were shifted.
+        auto garbageCollect(const std::unique_ptr<dd::Package>& dd, bool isEndOfIteration = false) -> void;
+        auto recordStatistics(const std::unique_ptr<dd::Package>& dd) -> void;
+
+        // whether the set of cubes exceeds the cap on the path signature sizes of the current effort mode.
+        [[nodiscard]] auto isSignatureSizeCapped(std::size_t signatureSize) const -> bool;
+        // the set of cubes is only minimized if its size is not capped (see isSignatureSizeCapped), the cubes of a path signature are disjoint and can thus be used as is otherwise.
+        auto minimizeSignature(TruthTable::Cube::Set const& sigVec) -> TruthTable::Cube::Set;
 
         static auto completeUniCubes(TruthTable::Cube::Set const& p1SigVec, TruthTable::Cube::Set const& p2SigVec, TruthTable::Cube::Set& uniqueCubeVec) -> void;
 
@@ -99,15 +320,22 @@ namespace syrec {
         auto shiftingPaths(dd::mEdge const& src, dd::mEdge const& current, std::unique_ptr<dd::Package>& dd) -> dd::mEdge;
 
         template<class T>
-        auto decoder(T const& codewords) -> void;
+        auto decoder(T const& codewords, DecoderMode decoderMode) -> void;
+
+        // determines the gates XORing the lines at the given positions of the cubes with an ESOP of the other lines (excluding the decoded ones), which sets the line of every codeword to its decoded value,
+        // and updates the current values of the codewords accordingly. returns false if flipping the line of some codewords would also flip it for a codeword whose line has to keep its value.
+        auto decodeUsingEsopNetwork(std::vector<TruthTable::Cube>& currentValuePerCodeword, std::vector<TruthTable::Cube> const& decodedValuePerCodeword, std::vector<std::size_t> const& decodedPositions, std::vector<std::pair<qc::Controls, qc::Qubit>>& gates) -> bool;
 
         auto initializeSynthesizer(TruthTable const& tt) -> void;
 
-        auto buildAndSynthesize(TruthTable const& tt) -> void;
+        auto buildAndSynthesize(TruthTable const& tt, bool memoizeDDConstruction) -> void;
+        auto buildAndSynthesize(PackedTruthTable const& tt, bool memoizeDDConstruction) -> void;
+
+        auto synthesizeOnePassTT(TruthTable tt, bool memoizeDDConstruction) -> std::shared_ptr<qc::QuantumComputation>;
 
-        auto synthesizeOnePassTT(TruthTable tt) -> std::shared_ptr<qc::QuantumComputation>;
+        auto synthesizeCodingTechniquesTT(TruthTable tt, bool withAdditionalLine, DecoderMode decoderMode) -> std::shared_ptr<qc::QuantumComputation>;
 
-        auto synthesizeCodingTechniquesTT(TruthTable tt, bool withAdditionalLine) -> std::shared_ptr<qc::QuantumComputation>;
+        auto synthesizeWithReorderedLinesTT(const TruthTable& tt, const LineReorderingSettings& settings) -> std::shared_ptr<qc::QuantumComputation>;
     };
 
 } // namespace syrec
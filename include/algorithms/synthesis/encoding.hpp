@@ -12,46 +12,25 @@
 
 #include "core/truthTable/truth_table.hpp"
 
-namespace syrec {
-
-    struct MinHeapNode {
-        TruthTable::Cube data;
-
-        std::size_t freq{};
-
-        std::shared_ptr<MinHeapNode> left{};
-        std::shared_ptr<MinHeapNode> right{};
+#include <cstddef>
+#include <cstdint>
+#include <vector>
 
-        MinHeapNode(TruthTable::Cube data, const std::size_t freq):
-            data(std::move(data)), freq(freq) {}
-
-        auto operator>(const MinHeapNode& other) const -> bool {
-            return (freq > other.freq || (freq == other.freq && (data > other.data)));
-        }
-
-        template<class T>
-        auto traverse(TruthTable::Cube&& encodedCube, T& encoding) const -> void {
-            // leaf node -> add encoding
-            if (!data.empty()) {
-                encoding.emplace(data, std::move(encodedCube));
-                return;
-            }
+namespace syrec {
 
-            // non-leaf node -> traverse left and right subtree
-            if (left) {
-                left->traverse(encodedCube.appendZero(), encoding);
-            }
-            if (right) {
-                right->traverse(encodedCube.appendOne(), encoding);
-            }
-        }
+    // a codeword of the Huffman encoding with its first position being stored in the most significant of its `length` bits.
+    struct PackedCodeword {
+        std::uint64_t bits   = 0U;
+        std::size_t   length = 0U;
     };
 
     template<class T>
     auto computeOutputFreq(TruthTable const& tt, T& outputFreq) -> void;
 
+    // builds the Huffman tree of the output frequencies in a flat array of nodes and determines the codeword of every output frequency, with the i-th codeword belonging to the i-th element of `outputFreq`.
+    // returns the weight of the root of the Huffman tree, i.e. the number of bits required to encode the outputs.
     template<class T>
-    auto topNodeOfHuffmanTree(T const& outputFreq) -> std::shared_ptr<MinHeapNode>;
+    auto huffmanCodewords(T const& outputFreq, std::vector<PackedCodeword>& codewords) -> std::size_t;
 
     template<class T>
     auto alterTTAndCodewords(TruthTable& tt, T& encoding, std::size_t const& requiredGarbage) -> void;
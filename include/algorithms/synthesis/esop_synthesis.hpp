@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/truthTable/truth_table.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <cstddef>
+#include <memory>
+
+namespace syrec {
+
+    // synthesizes a truth table as an ESOP network, i.e. the inputs are kept on their lines while every output is computed on an additional line (initialized with zero) by one multi-controlled X gate per product term
+    // of the multi-output ESOP of the truth table (see minbool::minimizeMultiOutputEsop). the truth table is neither required to be complete nor reversible, thus the cubes of a parsed PLA can be synthesized without extending them
+    // (see parsePla), with the runtime depending on the number of cubes instead of the number of minterms of the truth table.
+    class EsopSynthesizer {
+    public:
+        // the primary inputs are stored in the upmost qubits (the input i in the qubit n + m - 1 - i) and are considered as garbage, while the primary outputs are stored in the ancillary lowest qubits (the output j in the qubit m - 1 - j).
+        auto synthesizeTT(const TruthTable& tt) -> std::shared_ptr<qc::QuantumComputation>;
+
+        static auto synthesize(const TruthTable& tt) -> std::shared_ptr<qc::QuantumComputation> {
+            EsopSynthesizer synthesizer{};
+            return synthesizer.synthesizeTT(tt);
+        }
+
+        [[nodiscard]] auto numGate() const -> std::size_t {
+            return numGates;
+        }
+
+        // the number of product terms of the multi-output ESOP, with a product term shared by several outputs being counted once.
+        [[nodiscard]] auto numProductTerm() const -> std::size_t {
+            return numProductTerms;
+        }
+
+        [[nodiscard]] auto getExecutionTime() const -> double {
+            return runtime;
+        }
+
+    private:
+        double      runtime         = 0.;
+        std::size_t numGates        = 0U;
+        std::size_t numProductTerms = 0U;
+    };
+
+} // namespace syrec
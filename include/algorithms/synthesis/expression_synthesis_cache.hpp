@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/syrec/expression.hpp"
+#include "core/syrec/number.hpp"
+#include "core/syrec/variable.hpp"
+#include "ir/Definitions.hpp"
+
+#include <cstddef>
+#include <unordered_set>
+#include <vector>
+
+namespace syrec {
+    /**
+     * A cache storing the qubits holding the synthesized result of side-effect free SyReC expressions that can be shared by any structurally identical expression synthesized later on instead of synthesizing the latter again.
+     *
+     * Two expressions are structurally identical if they consist of the same operations applied to the same variable accesses and constant values (with loop variables being replaced by their current value).
+     * The cached result of an expression stays valid as long as none of the variables accessed by the expression is modified and the control qubits propagated to the synthesized quantum operations do not change,
+     * the user of the cache is responsible to invalidate the affected results when either of the two happens.
+     */
+    class ExpressionSynthesisCache {
+    public:
+        /**
+         * Find the qubits storing the synthesized result of an expression structurally identical to the given one.
+         * @param expression The expression to search for.
+         * @param loopVariableValueLookup The current values of the loop variables.
+         * @return A pointer to the qubits storing the synthesized result of a structurally identical expression, nullptr if no such result was cached.
+         */
+        [[nodiscard]] const std::vector<qc::Qubit>* findSynthesisResult(const Expression& expression, const Number::LoopVariableMapping& loopVariableValueLookup) const;
+
+        /**
+         * Record the qubits storing the synthesized result of an expression.
+         * @param expression The synthesized expression.
+         * @param loopVariableValueLookup The current values of the loop variables.
+         * @param qubitsStoringSynthesisResult The qubits storing the synthesized result of the expression.
+         */
+        void recordSynthesisResult(const Expression::ptr& expression, const Number::LoopVariableMapping& loopVariableValueLookup, const std::vector<qc::Qubit>& qubitsStoringSynthesisResult);
+
+        /**
+         * Determine whether two expressions are structurally identical.
+         * @param lExpr The first expression.
+         * @param rExpr The second expression.
+         * @param loopVariableValueLookup The current values of the loop variables.
+         * @return Whether both expressions consist of the same operations applied to the same variable accesses and constant values.
+         */
+        [[nodiscard]] static bool areExpressionsStructurallyIdentical(const Expression& lExpr, const Expression& rExpr, const Number::LoopVariableMapping& loopVariableValueLookup);
+
+        /**
+         * Invalidate the cached results of all expressions accessing the given variable.
+         * @param variable The modified variable.
+         */
+        void invalidateSynthesisResultsAccessingVariable(const Variable& variable);
+
+        /**
+         * Invalidate the cached results of all expressions whose result is stored in any of the given qubits.
+         * @param modifiedQubits The qubits whose value was modified.
+         */
+        void invalidateSynthesisResultsStoredInQubits(const std::unordered_set<qc::Qubit>& modifiedQubits);
+
+        /**
+         * Invalidate all cached results.
+         */
+        void clear() noexcept {
+            cachedSynthesisResults.clear();
+        }
+
+        /**
+         * @return The number of cached results.
+         */
+        [[nodiscard]] std::size_t getNumCachedSynthesisResults() const noexcept {
+            return cachedSynthesisResults.size();
+        }
+
+    protected:
+        struct CachedSynthesisResult {
+            Expression::ptr              expression;
+            std::size_t                  structuralHash = 0;
+            std::vector<const Variable*> accessedVariables;
+            std::vector<qc::Qubit>       qubitsStoringSynthesisResult;
+        };
+
+        // Only a few results are cached at once since the cache is frequently invalidated, a linear search with a precomputed hash is thus sufficient.
+        std::vector<CachedSynthesisResult> cachedSynthesisResults;
+    };
+} // namespace syrec
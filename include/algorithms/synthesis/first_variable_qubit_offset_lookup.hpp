@@ -10,9 +10,12 @@
 
 #pragma once
 
+#include "core/syrec/variable.hpp"
 #include "ir/Definitions.hpp"
 
+#include <cstddef>
 #include <optional>
+#include <span>
 #include <string_view>
 #include <unordered_map>
 #include <vector>
@@ -20,14 +23,19 @@
 namespace syrec {
     /**
      * A lookup to register and manage the offset to the first qubit of a variable in a hierarchy of called/uncalled SyReC modules
+     *
+     * The offsets registered for the variables with a declaration index (see syrec::Module::assignDeclarationIndicesOfVariables) are stored in a flat array of slots shared by all scopes with every scope
+     * owning a contiguous range of slots at the end of the array, thus opening/closing a scope only adjusts the end of the array and the offset of a variable is fetched by its declaration index without
+     * hashing the identifier of the variable. Offsets registered using only the identifier of a variable are stored in a second flat array, partitioned in the same way, and are searched linearly.
      */
     class FirstVariableQubitOffsetLookup {
     public:
         /**
          * Open a new variable qubit offset scope.
+         * @param numVariableSlotsToReserve The number of slots for variables with a declaration index that are preallocated in the new scope (i.e. the number of parameters and local variables of the module of the scope).
          * @remark Registering a new variable qubit offset can only be done if an open scope exists in the internal lookup.
          */
-        void openNewVariableQubitOffsetScope();
+        void openNewVariableQubitOffsetScope(std::size_t numVariableSlotsToReserve = 0);
 
         /**
          * Close the last opened offset scope.
@@ -50,8 +58,78 @@ namespace syrec {
          */
         [[nodiscard]] std::optional<qc::Qubit> getOffsetToFirstQubitOfVariableInCurrentScope(const std::string_view& variableIdentifier) const;
 
+        /**
+         * Register or update the qubit offset for a variable in the last opened scope.
+         * @param variable The variable for which an offset shall be recorded. If a declaration index was assigned to the variable, the offset can also be fetched without a lookup using the identifier of the variable.
+         * @param offsetToFirstQubitOfVariable The offset to record.
+         * @return Whether an entry was added or updated in the last opened scope.
+         */
+        [[maybe_unused]] bool registerOrUpdateOffsetToFirstQubitOfVariableInCurrentScope(const Variable& variable, qc::Qubit offsetToFirstQubitOfVariable);
+
+        /**
+         * Fetch the last registered offset to the first qubit of a variable in the last opened scope.
+         * @param variable The variable for which the registered offset shall be fetched.
+         * @return The registered offset to the first qubit of the variable, otherwise std::nullopt.
+         */
+        [[nodiscard]] std::optional<qc::Qubit> getOffsetToFirstQubitOfVariableInCurrentScope(const Variable& variable) const;
+
+        /**
+         * Cache the qubits accessed by a variable access whose indices and bitrange only consist of constant values in the last opened scope.
+         * @remark The cached qubits of all variable accesses of a scope are invalidated when the offset of an already registered variable is updated in said scope.
+         * @param variableAccess The variable access whose accessed qubits shall be cached.
+         * @param accessedQubits The qubits accessed by the variable access.
+         * @return Whether the accessed qubits could be cached in the last opened scope.
+         */
+        [[maybe_unused]] bool cacheQubitsOfVariableAccessInCurrentScope(const VariableAccess::ptr& variableAccess, const std::vector<qc::Qubit>& accessedQubits);
+
+        /**
+         * Fetch the cached qubits accessed by a variable access in the last opened scope.
+         * @param variableAccess The variable access whose cached qubits shall be fetched.
+         * @return A view of the cached qubits accessed by the variable access which is valid until the scope is modified, otherwise std::nullopt.
+         */
+        [[nodiscard]] std::optional<std::span<const qc::Qubit>> getCachedQubitsOfVariableAccessInCurrentScope(const VariableAccess& variableAccess) const;
+
     protected:
-        using QubitOffsetScope = std::unordered_map<std::string_view, qc::Qubit>;
-        std::vector<QubitOffsetScope> recordedOffsetsToFirstQubitPerVariableScopes;
+        struct CachedQubitsOfVariableAccess {
+            // Keeps the variable access alive to prevent the reuse of its address by another variable access while its qubits are cached
+            VariableAccess::ptr variableAccess;
+            std::size_t         offsetToFirstCachedQubit = 0;
+            std::size_t         numCachedQubits          = 0;
+        };
+
+        struct VariableQubitOffsetSlot {
+            // The variable registered for a declaration index is stored alongside its offset since a variable could be registered in a scope of a module other than its declaring one.
+            const Variable* variable                     = nullptr;
+            qc::Qubit       offsetToFirstQubitOfVariable = 0;
+        };
+
+        struct VariableQubitOffsetOfIdentifier {
+            std::string_view variableIdentifier;
+            qc::Qubit        offsetToFirstQubitOfVariable = 0;
+        };
+
+        struct QubitOffsetScope {
+            std::size_t                                                             indexOfFirstVariableSlot       = 0;
+            std::size_t                                                             indexOfFirstIdentifierOffset   = 0;
+            std::unordered_map<const VariableAccess*, CachedQubitsOfVariableAccess> cachedQubitsPerVariableAccess;
+            std::vector<qc::Qubit>                                                  cachedQubitsOfVariableAccesses;
+
+            void invalidateCachedQubitsOfVariableAccesses() noexcept {
+                cachedQubitsPerVariableAccess.clear();
+                cachedQubitsOfVariableAccesses.clear();
+            }
+        };
+
+        std::vector<QubitOffsetScope>                recordedOffsetsToFirstQubitPerVariableScopes;
+        std::vector<VariableQubitOffsetSlot>         variableSlotsOfScopes;
+        std::vector<VariableQubitOffsetOfIdentifier> identifierOffsetsOfScopes;
+
+        /**
+         * Fetch the offset registered for an identifier in the last opened scope, either for a variable with a declaration index or only using the identifier.
+         * @param variableIdentifier The identifier of the variable.
+         * @return A pointer to the registered offset, otherwise nullptr. The pointer is invalidated if the lookup is modified.
+         */
+        [[nodiscard]] qc::Qubit* findOffsetRegisteredForIdentifierInCurrentScope(const std::string_view& variableIdentifier);
+        [[nodiscard]] const qc::Qubit* findOffsetRegisteredForIdentifierInCurrentScope(const std::string_view& variableIdentifier) const;
     };
 } // namespace syrec
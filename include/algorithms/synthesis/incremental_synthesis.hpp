@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/statistics.hpp"
+#include "core/syrec/program.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace syrec {
+    /**
+     * @brief The quantum operations and ancillary qubits of a top-level statement of the main module in a quantum computation synthesized by syrec::IncrementalSynthesis.
+     */
+    struct SynthesizedStatementFootprint {
+        /**
+         * The quantum operations synthesized for the statement.
+         */
+        AnnotatableQuantumComputation::QuantumOperationIndexRange quantumOperations;
+        /**
+         * The ancillary qubits used only by the quantum operations of the statement, std::nullopt if the statement does not require any ancillary qubits.
+         */
+        std::optional<AnnotatableQuantumComputation::QubitIndexRange> ancillaryQubits;
+        /**
+         * Whether the quantum operations of the statement were synthesized by the last synthesis instead of being reused from a previous one.
+         */
+        bool wasResynthesized = false;
+    };
+
+    /**
+     * @brief A synthesizer that, when a SyReC program is synthesized repeatedly, only resynthesizes the top-level statements of the main module that changed since the previous synthesis.
+     *
+     * Every top-level statement of the main module is synthesized on its own into a quantum computation storing the parameters and local variables of the main module followed by the ancillary qubits of the statement, as done for
+     * the concurrent synthesis of independent statements (see ConfigurableOptions::synthesizeIndependentStatementsConcurrently). The synthesized quantum computation is assembled by appending the quantum operations of every statement,
+     * with the ancillary qubits of a statement being mapped to a separate range of ancillary qubits, and the quantum operations and ancillary qubits of every statement are recorded as its footprint.
+     *
+     * The quantum computations of the statements are identified by the serialized IR of the statement, without its line numbers, and are kept as long as the qubit layout of the program remains unchanged. Any change of the parameters or
+     * local variables of the main module, of any other module, of the used synthesizer or of the settings influencing the synthesis discards the quantum computations of all statements. Statements changed by an edit of the program are
+     * synthesized concurrently on up to ConfigurableOptions::maxNumThreads threads.
+     *
+     * Ancillary qubits are thus only reused within but not across statements (see ConfigurableOptions::reuseAncillaryQubitsAcrossStatements). Since the optimizations of the synthesized quantum computation would change the recorded footprints,
+     * programs are synthesized from scratch by the configured synthesizer (without recording any footprints) if any optimization of the synthesized quantum computation, the emission of module calls as compound operations or any of the
+     * settings preventing the concurrent synthesis of independent statements is enabled. The synthesizer must not be shared between threads.
+     */
+    class IncrementalSynthesis {
+    public:
+        explicit IncrementalSynthesis(SynthesisAlgorithm synthesisAlgorithm = SynthesisAlgorithm::CostAware):
+            synthesisAlgorithm(synthesisAlgorithm) {}
+
+        /**
+         * @brief Synthesize a SyReC program by resynthesizing only the top-level statements of its main module that changed since the previous synthesis.
+         *
+         * @param program The SyReC program to synthesize.
+         * @param settings The settings used to synthesize the program.
+         * @param optionalRecordedStatistics An optional container in which the runtime and the size of the synthesized quantum computation are recorded.
+         * @return The synthesized quantum computation, nullptr if the synthesis failed.
+         */
+        [[nodiscard]] std::unique_ptr<AnnotatableQuantumComputation> synthesize(const Program& program, const ConfigurableOptions& settings = ConfigurableOptions{}, Statistics* optionalRecordedStatistics = nullptr);
+
+        /**
+         * @brief Discard the quantum computations synthesized for the statements of the previously synthesized program.
+         */
+        void clear();
+
+        /**
+         * @brief Get the footprints of the top-level statements of the main module, in the order of the statements, in the quantum computation synthesized by the last successful synthesis (empty if the latter was synthesized from scratch).
+         */
+        [[nodiscard]] const std::vector<SynthesizedStatementFootprint>& getFootprintsOfStatements() const noexcept {
+            return footprintsOfStatements;
+        }
+
+        /**
+         * @brief Get the number of top-level statements of the main module that needed to be synthesized by the last synthesis.
+         */
+        [[nodiscard]] std::size_t getNumResynthesizedStatements() const noexcept {
+            return numResynthesizedStatements;
+        }
+
+        /**
+         * @brief Get the number of top-level statements of the main module whose quantum operations were reused by the last synthesis.
+         */
+        [[nodiscard]] std::size_t getNumReusedStatements() const noexcept {
+            return numReusedStatements;
+        }
+
+    protected:
+        SynthesisAlgorithm synthesisAlgorithm;
+        // The serialized program without the statements of its main module followed by the synthesizer and the synthesis relevant settings of the previously synthesized program.
+        std::string                                                                           serializedLayoutOfSynthesizedProgram;
+        std::unordered_map<std::string, std::shared_ptr<const AnnotatableQuantumComputation>> synthesizedStatementLookup;
+        std::vector<SynthesizedStatementFootprint>                                            footprintsOfStatements;
+        std::size_t                                                                           numResynthesizedStatements = 0;
+        std::size_t                                                                           numReusedStatements        = 0;
+
+        [[nodiscard]] static bool canStatementsBeSynthesizedIncrementally(const ConfigurableOptions& settings);
+
+        [[nodiscard]] std::unique_ptr<AnnotatableQuantumComputation> synthesizeFromScratch(const Program& program, const ConfigurableOptions& settings, Statistics* optionalRecordedStatistics);
+    };
+} // namespace syrec
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "algorithms/synthesis/statement_execution_order_stack.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/variable.hpp"
+#include "ir/Definitions.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace syrec {
+    /**
+     * A cache storing the quantum operations synthesized for the body of a called/uncalled SyReC module as a template that can be instantiated, by remapping the qubits of the recorded quantum operations,
+     * for any further call/uncall of the same module in the same context instead of synthesizing the statements of the module again.
+     *
+     * The recorded quantum operations are not copied but referenced by their index in the quantum computation in which the template was recorded.
+     */
+    class ModuleCallSynthesisCache {
+    public:
+        /**
+         * A quantum register created during the synthesis of the body of a module, either for a local variable of a called module or for ancillary qubits.
+         */
+        struct QuantumRegisterAllocation {
+            /**
+             * The local variable for which the quantum register was created, nullptr if ancillary qubits were created.
+             */
+            Variable::ptr localVariable;
+            /**
+             * The number of created ancillary qubits (only relevant if no local variable is set).
+             */
+            unsigned numAncillaryQubits = 0;
+        };
+
+        /**
+         * The context in which the body of a module is synthesized.
+         */
+        struct ModuleCallContext {
+            /**
+             * The called/uncalled module.
+             */
+            const Module* targetModule = nullptr;
+            /**
+             * The aggregate statement execution order used to synthesize the statements of the module.
+             */
+            StatementExecutionOrderStack::StatementExecutionOrder statementExecutionOrder = StatementExecutionOrderStack::StatementExecutionOrder::Sequential;
+            /**
+             * The control qubits registered for propagation at the start of the synthesis of the module body, sorted in ascending order.
+             */
+            std::vector<qc::Qubit> propagatedControlQubits;
+
+            [[nodiscard]] bool operator==(const ModuleCallContext& other) const = default;
+        };
+
+        /**
+         * The recorded synthesis of the body of a module.
+         */
+        struct ModuleCallTemplate {
+            /**
+             * The first qubit of every caller argument of the module in the order of the formal parameters of the latter.
+             */
+            std::vector<qc::Qubit> firstQubitPerParameter;
+            /**
+             * The first of the qubits created during the synthesis of the module body.
+             */
+            qc::Qubit firstCreatedQubit = 0;
+            /**
+             * The number of qubits created during the synthesis of the module body.
+             */
+            std::size_t numCreatedQubits = 0;
+            /**
+             * The index of the first recorded quantum operation in the quantum computation.
+             */
+            std::size_t indexOfFirstQuantumOperation = 0;
+            /**
+             * The number of recorded quantum operations.
+             */
+            std::size_t numQuantumOperations = 0;
+            /**
+             * The quantum registers created during the synthesis of the module body in the order of their creation.
+             */
+            std::vector<QuantumRegisterAllocation> quantumRegisterAllocations;
+            /**
+             * The global statement line number active after the synthesis of the module body.
+             */
+            std::optional<unsigned> statementLineNumberAfterSynthesis;
+        };
+
+        /**
+         * Find the template recorded for a module call context.
+         * @param moduleCallContext The module call context to search for.
+         * @return A pointer to the recorded template, nullptr if no template was recorded for the given context.
+         */
+        [[nodiscard]] const ModuleCallTemplate* findTemplate(const ModuleCallContext& moduleCallContext) const;
+
+        /**
+         * Start the recording of a template for a module call context. Recordings can be nested with every created quantum register being recorded in all active recordings.
+         * @param moduleCallContext The module call context for which the template is recorded.
+         * @param firstQubitPerParameter The first qubit of every caller argument of the module in the order of the formal parameters of the latter.
+         * @param firstCreatedQubit The first qubit that will be created during the synthesis of the module body.
+         * @param indexOfFirstQuantumOperation The index of the first quantum operation that will be created during the synthesis of the module body.
+         */
+        void startRecording(const ModuleCallContext& moduleCallContext, const std::vector<qc::Qubit>& firstQubitPerParameter, qc::Qubit firstCreatedQubit, std::size_t indexOfFirstQuantumOperation);
+
+        /**
+         * Record a created quantum register in all active recordings.
+         * @param quantumRegisterAllocation The created quantum register.
+         */
+        void recordQuantumRegisterAllocation(const QuantumRegisterAllocation& quantumRegisterAllocation);
+
+        /**
+         * Get the template of the last started recording.
+         * @return A pointer to the template of the last started recording, nullptr if no recording is active.
+         */
+        [[nodiscard]] ModuleCallTemplate* getTemplateOfLastStartedRecording();
+
+        /**
+         * Stop the last started recording.
+         * @param shouldTemplateBeCached Whether the recorded template shall be stored in the cache.
+         * @return Whether an active recording was stopped.
+         */
+        [[maybe_unused]] bool stopLastStartedRecording(bool shouldTemplateBeCached);
+
+        /**
+         * Remove all templates whose recorded quantum operations start at or after a given index in the quantum computation, i.e. templates whose quantum operations were modified after their recording.
+         * @param indexOfFirstQuantumOperation The index of the first quantum operation in the quantum computation whose templates shall be removed.
+         * @return The number of removed templates.
+         */
+        [[maybe_unused]] std::size_t removeTemplatesRecordedStartingAt(std::size_t indexOfFirstQuantumOperation);
+
+        /**
+         * @return The number of recorded templates.
+         */
+        [[nodiscard]] std::size_t getNumRecordedTemplates() const noexcept {
+            return recordedTemplates.size();
+        }
+
+    protected:
+        struct ModuleCallContextHash {
+            [[nodiscard]] std::size_t operator()(const ModuleCallContext& moduleCallContext) const noexcept;
+        };
+
+        struct ActiveRecording {
+            ModuleCallContext  moduleCallContext;
+            ModuleCallTemplate moduleCallTemplate;
+        };
+
+        std::vector<ActiveRecording>                                                     activeRecordings;
+        std::unordered_map<ModuleCallContext, ModuleCallTemplate, ModuleCallContextHash> recordedTemplates;
+    };
+} // namespace syrec
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/quantum_operation_sink.hpp"
+#include "ir/operations/Operation.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+namespace syrec {
+    /**
+     * A quantum operation sink writing the consumed (multi-controlled) X and SWAP gates as the gate section of a circuit in the .real format to an output stream.
+     *
+     * Since the number of qubits of the quantum computation is only known after the synthesis was completed, the header of the .real file (defining the number of qubits and their names) is not written by the sink
+     * but can be written via syrec::RealFormatQuantumOperationSink::writeHeader(...) to a separate output stream once the number of qubits is known. The name of the i-th qubit in the written gate section is 'q<i>'.
+     */
+    class RealFormatQuantumOperationSink: public QuantumOperationSink {
+    public:
+        explicit RealFormatQuantumOperationSink(std::ostream& outputStream):
+            outputStream(outputStream) {}
+
+        [[nodiscard]] bool consumeQuantumOperation(const qc::Operation& quantumOperation, const QuantumOperationAnnotationsLookup& annotationsOfQuantumOperation) override;
+        [[nodiscard]] bool finish(std::size_t numQubits) override;
+
+        /**
+         * Write the header of a .real file, whose gate section was written by a syrec::RealFormatQuantumOperationSink, to an output stream.
+         * @param outputStream The output stream to which the header is written.
+         * @param numQubits The number of qubits of the quantum computation.
+         */
+        static void writeHeader(std::ostream& outputStream, std::size_t numQubits);
+
+    protected:
+        std::ostream& outputStream;
+    };
+
+    /**
+     * A quantum operation sink performing the bit-parallel simulation of the consumed quantum operations for up to syrec::BATCH_SIMULATION_LANE_COUNT input patterns.
+     *
+     * The i-th bit of the lane value of qubit q stores the value of qubit q in the i-th simulated input pattern. Qubits that were not part of the initial lane values (i.e. ancillary qubits added during the synthesis) are initialized with zero in every input pattern.
+     */
+    class BatchSimulationQuantumOperationSink: public QuantumOperationSink {
+    public:
+        explicit BatchSimulationQuantumOperationSink(std::vector<std::uint64_t> initialLaneValuesPerQubit):
+            laneValuesPerQubit(std::move(initialLaneValuesPerQubit)) {}
+
+        [[nodiscard]] bool consumeQuantumOperation(const qc::Operation& quantumOperation, const QuantumOperationAnnotationsLookup& annotationsOfQuantumOperation) override;
+        [[nodiscard]] bool finish(std::size_t numQubits) override;
+
+        [[nodiscard]] const std::vector<std::uint64_t>& getLaneValuesPerQubit() const noexcept {
+            return laneValuesPerQubit;
+        }
+
+    protected:
+        std::vector<std::uint64_t> laneValuesPerQubit;
+    };
+
+    /**
+     * A quantum operation sink accumulating the number of consumed (multi-controlled) X and SWAP gates as well as their synthesis cost.
+     *
+     * Since the quantum cost of a gate depends on the number of qubits of the quantum computation, which is only known after all quantum operations were consumed, the quantum cost is only available after the sink was finished.
+     */
+    class SynthesisCostQuantumOperationSink: public QuantumOperationSink {
+    public:
+        [[nodiscard]] bool consumeQuantumOperation(const qc::Operation& quantumOperation, const QuantumOperationAnnotationsLookup& annotationsOfQuantumOperation) override;
+        [[nodiscard]] bool finish(std::size_t numQubits) override;
+
+        [[nodiscard]] std::size_t getNumConsumedQuantumOperations() const noexcept {
+            return numConsumedQuantumOperations;
+        }
+
+        [[nodiscard]] AnnotatableQuantumComputation::SynthesisCostMetricValue getQuantumCostForSynthesis() const noexcept {
+            return quantumCost;
+        }
+
+        [[nodiscard]] AnnotatableQuantumComputation::SynthesisCostMetricValue getTransistorCostForSynthesis() const noexcept {
+            return transistorCost;
+        }
+
+    protected:
+        // The key of the lookup is the pair (number of control qubits, is SWAP gate).
+        std::map<std::pair<std::size_t, bool>, std::size_t>     numConsumedGatesPerKind;
+        std::size_t                                             numConsumedQuantumOperations = 0;
+        AnnotatableQuantumComputation::SynthesisCostMetricValue quantumCost                  = 0;
+        AnnotatableQuantumComputation::SynthesisCostMetricValue transistorCost               = 0;
+    };
+} // namespace syrec
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/hash_combine.hpp"
+#include "ir/Definitions.hpp"
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace syrec {
+    /**
+     * @brief A utility class assigning an identifier to every distinct sequence of qubits (i.e. an operand of an expression) such that two sequences are equal if and only if their identifiers are equal.
+     *
+     * Every distinct sequence is only stored once in an arena from which it can be fetched by its identifier, the sequence is looked up via its hash when interned. References to stored sequences remain valid until the interner is cleared.
+     * The empty sequence is always assigned the identifier QubitSpanInterner::EMPTY_SPAN_ID.
+     */
+    class QubitSpanInterner {
+    public:
+        using Id                          = std::size_t;
+        constexpr static Id EMPTY_SPAN_ID = 0;
+
+        QubitSpanInterner() {
+            clear();
+        }
+
+        /**
+         * @brief Get the identifier of a sequence of qubits, which is stored in the arena if it was not interned previously.
+         * @param qubits The sequence of qubits to intern.
+         * @return The identifier of the sequence.
+         */
+        [[nodiscard]] Id intern(const std::vector<qc::Qubit>& qubits) {
+            if (qubits.empty()) {
+                return EMPTY_SPAN_ID;
+            }
+
+            const std::size_t hash = determineHash(qubits);
+            for (auto [it, end] = idsPerHash.equal_range(hash); it != end; ++it) {
+                if (spans[it->second] == qubits) {
+                    return it->second;
+                }
+            }
+
+            const Id id = spans.size();
+            spans.emplace_back(qubits);
+            idsPerHash.emplace(hash, id);
+            return id;
+        }
+
+        /**
+         * @brief Get the sequence of qubits interned with the given identifier.
+         * @param id The identifier of a previously interned sequence.
+         * @return A reference to the stored sequence.
+         */
+        [[nodiscard]] const std::vector<qc::Qubit>& get(const Id id) const {
+            return spans.at(id);
+        }
+
+        /**
+         * @brief Remove all interned sequences, which invalidates all previously returned identifiers except QubitSpanInterner::EMPTY_SPAN_ID.
+         */
+        void clear() {
+            spans.clear();
+            idsPerHash.clear();
+            spans.emplace_back();
+        }
+
+        [[nodiscard]] std::size_t getNumInternedSpans() const noexcept {
+            return spans.size() - 1;
+        }
+
+    protected:
+        // A deque is used as arena since its elements are not relocated when new elements are appended.
+        std::deque<std::vector<qc::Qubit>>       spans;
+        std::unordered_multimap<std::size_t, Id> idsPerHash;
+
+        [[nodiscard]] static std::size_t determineHash(const std::vector<qc::Qubit>& qubits) noexcept {
+            std::size_t hash = qubits.size();
+            for (const qc::Qubit qubit: qubits) {
+                hashCombine(hash, qubit);
+            }
+            return hash;
+        }
+    };
+} // namespace syrec
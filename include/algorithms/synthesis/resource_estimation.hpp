@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/syrec/program.hpp"
+
+#include <cstddef>
+
+namespace syrec {
+    /**
+     * The resources of the quantum computation synthesized for a SyReC program as predicted by estimateResourcesOfSynthesis(...).
+     */
+    struct ResourceEstimate {
+        /**
+         * The number of qubits of the synthesized quantum computation (including the ancillary qubits).
+         */
+        std::size_t numQubits = 0;
+        /**
+         * The number of quantum operations of the synthesized quantum computation.
+         */
+        std::size_t numQuantumOperations = 0;
+        /**
+         * The quantum cost of the synthesized quantum computation (see AnnotatableQuantumComputation::getQuantumCostForSynthesis()).
+         */
+        AnnotatableQuantumComputation::SynthesisCostMetricValue quantumCost = 0;
+        /**
+         * The transistor cost of the synthesized quantum computation (see AnnotatableQuantumComputation::getTransistorCostForSynthesis()).
+         */
+        AnnotatableQuantumComputation::SynthesisCostMetricValue transistorCost = 0;
+        /**
+         * The number of statements synthesized by the synthesizer, including the statements of the bodies of expanded module calls and of every loop iteration (see ProgressReport::estimatedNumStatements).
+         */
+        std::size_t numStatements = 0;
+    };
+
+    /**
+     * @brief Predict the resources of the quantum computation synthesized for a SyReC program without synthesizing any quantum operation
+     *
+     * The estimator traverses the program like the selected synthesizer (i.e. unrolling loops, inlining module calls and evaluating compile time constant expressions) but only counts the qubits and
+     * quantum operations, grouped by their number of control qubits, that the synthesizer would generate for every statement and expression. Its runtime and memory usage thus only depend on the
+     * number of synthesized statements and expressions but not on the number of quantum operations.
+     *
+     * For the cost aware synthesis, the estimate is exact if the following settings have their default value: ancillaryQubitUncomputationStrategy, reuseAncillaryQubitsAcrossStatements,
+     * shareSynthesizedCommonSubexpressions, shareDividerOfQuotientAndRemainder, shareComparatorOfRelationalOperations, specializeOperationsWithConstantOperand, addConstantsWithoutAncillaryQubits,
+     * synthesizeShiftsByRelabelingQubits, trackUnconditionalSwapsAsQubitPermutation, foldNegationsIntoNegativeControls, narrowOperationsUsingValueRangeAnalysis, combineGuardsOfNestedIfStatements, reuseQubitOfGuardVariableNotAccessedInBranches,
+     * decodeNonConstantIndicesUsingUnaryIteration, shareIndexDecodingOfNonConstantIndices, padDimensionsOfUnrolledIndicesToPowersOfTwo, liftControlQubitsOfModuleCalls, propagateConstantQubitValues, applyReversibleCircuitTemplates, cancelAdjacentSelfInverseQuantumOperations, reorderQuantumOperationsToReduceDepth, recycleAncillaryQubitsWithNonOverlappingLiveRanges and optimizationPipeline. The estimate also assumes that no quantum operation uses a propagated
+     * control qubit as one of its own control qubits (e.g. in the multiplication a * a synthesized with the controlled additions). The adder, multiplier and divider architecture as well as the truncation of
+     * integer constants are modeled for all settings while reusing synthesized module calls or loop iterations does not change the estimate.
+     *
+     * For the line aware and the hybrid synthesis, assignments whose right-hand side operands repeat are estimated as if their operands did not repeat.
+     *
+     * @param estimate The estimated resources, only valid if the estimation was successful.
+     * @param program The SyReC program to estimate.
+     * @param settings The settings used to synthesize the program.
+     * @param synthesisAlgorithm The synthesizer whose synthesis result is estimated.
+     * @return Whether the resources could be estimated, an estimation fails for programs that the synthesizer fails to synthesize with the errors being reported via syrec::getErrorStream().
+     */
+    [[nodiscard]] bool estimateResourcesOfSynthesis(ResourceEstimate& estimate, const Program& program, const ConfigurableOptions& settings = ConfigurableOptions(), SynthesisAlgorithm synthesisAlgorithm = SynthesisAlgorithm::CostAware);
+} // namespace syrec
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/statistics.hpp"
+#include "core/syrec/program.hpp"
+#include "core/truthTable/truth_table.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace syrec {
+    /**
+     * The synthesizer of the truth table of a small main module.
+     */
+    enum class TruthTableSynthesisEngine : std::uint8_t {
+        /**
+         * The one-pass synthesis based on the decision diagram of the truth table (see DDSynthesizer::synthesizeOnePass(...)).
+         */
+        OnePassDD,
+        /**
+         * The synthesis of the multi-output ESOP of the truth table (see EsopSynthesizer::synthesize(...)).
+         */
+        Esop
+    };
+
+    /**
+     * Settings of the synthesis of small SyReC modules via their truth table.
+     */
+    struct SmallModuleSynthesisSettings {
+        /**
+         * The maximum number of bits of the in and inout parameters of the main module for which its truth table is built and synthesized, the truth table consists of one entry per assignment of these bits.
+         */
+        std::size_t maxNumInputBits = 8U;
+        /**
+         * The synthesizer of the truth table.
+         */
+        TruthTableSynthesisEngine truthTableSynthesisEngine = TruthTableSynthesisEngine::OnePassDD;
+    };
+
+    /**
+     * @brief Build the truth table of the main module of a SyReC program by interpreting the latter for every assignment of the bits of the in and inout parameters of the main module
+     *
+     * The inputs of the truth table are the bits of the in and inout parameters of the main module (i.e. the variables not initialized to zero by the synthesized quantum computation) while its outputs are the bits of the out and
+     * inout parameters and the state variables (i.e. the variables not considered as garbage by the synthesized quantum computation). The bits of both are ordered by the declaration order of their variables, the row-major order
+     * of the elements of a variable and from the most to the least significant bit of an element, thus the first position of a cube stores the most significant bit of the first element of the first such variable.
+     *
+     * @param tt The truth table in which the entries are stored, existing entries are removed.
+     * @param program The SyReC program whose main module is evaluated by the syrec::ProgramInterpreter.
+     * @param settings The settings defining the entry point of the program and the truncation of integer constants.
+     * @param maxNumInputBits The maximum number of inputs of the truth table.
+     * @return Whether the truth table could be built, which requires the main module to have at least one input and output bit and at most \p maxNumInputBits input bits as well as the program to be executable for every assignment.
+     */
+    [[nodiscard]] bool buildTruthTableOfMainModule(TruthTable& tt, const Program& program, const ConfigurableOptions& settings = ConfigurableOptions(), std::size_t maxNumInputBits = SmallModuleSynthesisSettings().maxNumInputBits);
+
+    /**
+     * The quantum computation selected for a SyReC program by the syrec::SmallModuleSynthesizer.
+     */
+    struct SmallModuleSynthesisResult {
+        enum class Origin : std::uint8_t {
+            /**
+             * The quantum computation was synthesized statement by statement using the selected syrec::SynthesisAlgorithm.
+             */
+            StatementWise,
+            /**
+             * The quantum computation was synthesized for the truth table of the main module (see buildTruthTableOfMainModule(...)), its primary inputs and outputs (i.e. its non-ancillary and non-garbage qubits)
+             * store the inputs and outputs of the truth table.
+             */
+            TruthTable
+        };
+
+        Origin                                  origin = Origin::StatementWise;
+        std::shared_ptr<qc::QuantumComputation> quantumComputation;
+        /**
+         * The quantum cost of the statement-wise synthesized quantum computation, only set if the latter was synthesized.
+         */
+        std::optional<AnnotatableQuantumComputation::SynthesisCostMetricValue> quantumCostOfStatementWiseSynthesis;
+        /**
+         * The quantum cost of the quantum computation synthesized for the truth table of the main module, only set if the latter was synthesized.
+         */
+        std::optional<AnnotatableQuantumComputation::SynthesisCostMetricValue> quantumCostOfTruthTableSynthesis;
+    };
+
+    /**
+     * @brief A synthesizer of SyReC programs selecting the cheaper one of the statement-wise synthesized quantum computation and the one synthesized for the truth table of a small main module
+     *
+     * Small modules (e.g. lookup logic operating on a few bits) are synthesized statement by statement with far more quantum operations and ancillary qubits than required by a functional synthesis of the same function. For a main module
+     * with at most SmallModuleSynthesisSettings::maxNumInputBits input bits, the truth table of the main module is thus built by exhaustively interpreting the latter (see buildTruthTableOfMainModule(...)) and synthesized with the configured
+     * engine. The quantum computation with the lower quantum cost (and with fewer qubits if both costs are equal) is selected, with the statement-wise synthesized one being preferred otherwise.
+     *
+     * The selection is cached per signature of a program, consisting of its serialized IR (see syrec::serializeProgram(...)) and the synthesis relevant settings (see SynthesisResultCache::serializeSynthesisRelevantSettings(...)), thus a program
+     * with the same signature as an already synthesized one is only synthesized using the previously selected variant. Programs whose IR is not serializable are always synthesized using both variants. The synthesizer must not be shared between threads.
+     */
+    class SmallModuleSynthesizer {
+    public:
+        explicit SmallModuleSynthesizer(const SmallModuleSynthesisSettings& smallModuleSynthesisSettings = SmallModuleSynthesisSettings()):
+            smallModuleSynthesisSettings(smallModuleSynthesisSettings) {}
+
+        /**
+         * @brief Synthesize a SyReC program using the variant selected for its signature
+         *
+         * @param program The SyReC program to synthesize.
+         * @param synthesisAlgorithm The synthesizer used for the statement-wise synthesis of the program.
+         * @param settings The settings used to synthesize and interpret the program.
+         * @param optionalRecordedStatistics An optional container in which the statistics of the statement-wise synthesis are recorded, only modified if the program was synthesized statement by statement.
+         * @return The selected quantum computation, std::nullopt if neither variant could be synthesized.
+         */
+        [[nodiscard]] std::optional<SmallModuleSynthesisResult> synthesize(const Program& program, SynthesisAlgorithm synthesisAlgorithm = SynthesisAlgorithm::CostAware, const ConfigurableOptions& settings = ConfigurableOptions(), Statistics* optionalRecordedStatistics = nullptr);
+
+        /**
+         * @brief Remove all cached selections.
+         */
+        void clear() {
+            originPerSignature.clear();
+        }
+
+        [[nodiscard]] std::size_t getNumCachedSelections() const noexcept {
+            return originPerSignature.size();
+        }
+
+        /**
+         * @brief Get the number of synthesized programs whose variant was selected by a cached selection.
+         */
+        [[nodiscard]] std::size_t getNumCacheHits() const noexcept {
+            return numCacheHits;
+        }
+
+    protected:
+        SmallModuleSynthesisSettings                                        smallModuleSynthesisSettings;
+        std::unordered_map<std::string, SmallModuleSynthesisResult::Origin> originPerSignature;
+        std::size_t                                                         numCacheHits = 0;
+    };
+} // namespace syrec
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/statistics.hpp"
+#include "core/syrec/program.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace syrec {
+    /**
+     * @brief A content addressed cache of the quantum computations synthesized for SyReC programs, allowing repeatedly synthesized programs to skip their synthesis.
+     *
+     * The synthesized quantum computations are identified by the serialized IR of the program (see syrec::serializeProgram(...)), thus programs with identical IR share a cache entry independent of their source text, together with the
+     * used synthesizer and the fields of the syrec::ConfigurableOptions influencing the synthesis (all fields except the ones only used by the parser, the number of threads of the concurrent synthesis and the path of the synthesis trace file).
+     * The synthesized quantum computations are stored in the binary format of syrec::AnnotatableQuantumComputation::serialize() with the least recently used ones being evicted from the in-memory cache once it stores the maximum number of results.
+     * Additionally, the results can be stored in an on-disk cache directory (shared by multiple processes) from which results evicted from the in-memory cache, or recorded by other processes, are loaded.
+     *
+     * Programs whose IR or synthesized quantum computation is not serializable (i.e. if module calls are emitted as compound operations) as well as failed synthesis results are not cached. Programs synthesized with a
+     * synthesis trace file are always synthesized, since the trace would not be recorded otherwise. A cache can only process one program at a time and must thus not be shared between threads.
+     */
+    class SynthesisResultCache {
+    public:
+        static constexpr std::size_t DEFAULT_MAX_NUM_CACHED_RESULTS = 64U;
+
+        /**
+         * @brief Construct a synthesis result cache.
+         *
+         * @param maxNumCachedResults The maximum number of synthesized quantum computations stored in the in-memory cache.
+         * @param optionalOnDiskCacheDirectory The optional directory in which the synthesized quantum computations are additionally stored, the directory is created if it does not exist.
+         */
+        explicit SynthesisResultCache(std::size_t maxNumCachedResults = DEFAULT_MAX_NUM_CACHED_RESULTS, std::optional<std::string> optionalOnDiskCacheDirectory = std::nullopt);
+
+        /**
+         * @brief Synthesize a SyReC program or load the cached quantum computation synthesized for it.
+         *
+         * @param program The SyReC program to synthesize.
+         * @param synthesisAlgorithm The synthesizer used to synthesize the program.
+         * @param settings The settings used to synthesize the program.
+         * @param optionalRecordedStatistics An optional container in which the statistics of the synthesis are recorded. The statistics of a cached result are the ones recorded during its synthesis with the runtime being the one of the cache lookup and the synthesis and optimization runtime being zero.
+         * @return The synthesized quantum computation, nullptr if the synthesis failed.
+         */
+        [[nodiscard]] std::unique_ptr<AnnotatableQuantumComputation> synthesize(const Program& program, SynthesisAlgorithm synthesisAlgorithm = SynthesisAlgorithm::CostAware, const ConfigurableOptions& settings = ConfigurableOptions{}, Statistics* optionalRecordedStatistics = nullptr);
+
+        /**
+         * @brief Remove all synthesized quantum computations from the in-memory cache, the on-disk cache is not modified.
+         */
+        void clear();
+
+        [[nodiscard]] std::size_t getNumCachedResults() const noexcept {
+            return cacheEntries.size();
+        }
+
+        /**
+         * @brief Get the number of synthesized programs whose quantum computation was loaded from the in-memory or on-disk cache.
+         */
+        [[nodiscard]] std::size_t getNumCacheHits() const noexcept {
+            return numCacheHits;
+        }
+
+        /**
+         * @brief Get the number of programs that needed to be synthesized.
+         */
+        [[nodiscard]] std::size_t getNumCacheMisses() const noexcept {
+            return numCacheMisses;
+        }
+
+        /**
+         * @brief Serialize the synthesizer and the fields of the settings influencing the synthesis which, together with the serialized IR of a program, identify the quantum computation synthesized for the latter.
+         */
+        [[nodiscard]] static std::string serializeSynthesisRelevantSettings(SynthesisAlgorithm synthesisAlgorithm, const ConfigurableOptions& settings);
+
+    protected:
+        struct CacheKey {
+            std::uint64_t hash;
+            // The serialized IR of the program followed by the synthesizer and the synthesis relevant settings.
+            std::string serializedKey;
+
+            [[nodiscard]] bool operator==(const CacheKey& other) const = default;
+        };
+
+        struct CacheEntry {
+            CacheKey    key;
+            Statistics  recordedStatistics;
+            std::string serializedQuantumComputation;
+        };
+
+        std::size_t                maxNumCachedResults;
+        std::optional<std::string> optionalOnDiskCacheDirectory;
+        std::size_t                numCacheHits   = 0;
+        std::size_t                numCacheMisses = 0;
+
+        // The cache entries ordered from the most to the least recently used one.
+        std::list<CacheEntry>                                             cacheEntries;
+        std::unordered_map<std::uint64_t, std::list<CacheEntry>::iterator> cacheEntryLookup;
+
+        [[nodiscard]] static std::optional<CacheKey> buildCacheKey(const Program& program, SynthesisAlgorithm synthesisAlgorithm, const ConfigurableOptions& settings);
+
+        [[nodiscard]] const CacheEntry* findCacheEntry(const CacheKey& key);
+        void                            insertCacheEntry(CacheEntry cacheEntry);
+
+        [[nodiscard]] std::optional<CacheEntry> tryLoadCacheEntryFromDisk(const CacheKey& key) const;
+        void                                    storeCacheEntryOnDisk(const CacheEntry& cacheEntry) const;
+
+        void recordCacheStatistics(Statistics* optionalRecordedStatistics) const;
+    };
+} // namespace syrec
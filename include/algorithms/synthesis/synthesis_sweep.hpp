@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/diagnostics.hpp"
+#include "core/statistics.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace syrec {
+    /**
+     * A configuration under which the program of a synthesis sweep is synthesized.
+     */
+    struct SynthesisSweepVariant {
+        /**
+         * The settings used to parse and synthesize the program.
+         */
+        ConfigurableOptions settings;
+        /**
+         * The synthesizer used to synthesize the program.
+         */
+        SynthesisAlgorithm synthesisAlgorithm = SynthesisAlgorithm::CostAware;
+    };
+
+    /**
+     * The settings of a synthesis sweep.
+     */
+    struct SynthesisSweepSettings {
+        /**
+         * The maximum number of threads synthesizing variants at the same time. A value of zero uses the number of concurrent threads supported by the hardware.
+         */
+        std::size_t numThreads = 0;
+        /**
+         * Whether the variants are synthesized in a deterministic order (see syrec::batchSynthesis(...)).
+         */
+        bool deterministic = false;
+        /**
+         * Should the quantum computations synthesized for the Pareto-optimal variants be kept in the result, the quantum computations of all other variants are always discarded.
+         */
+        bool keepParetoOptimalQuantumComputations = false;
+    };
+
+    /**
+     * The result of a variant of a synthesis sweep.
+     */
+    struct SynthesisSweepEntry {
+        /**
+         * Whether the program could be parsed and synthesized with the settings of the variant.
+         */
+        bool synthesisOk = false;
+        /**
+         * The statistics recorded during the parsing and synthesis of the variant. Variants sharing the same parser result or synthesis result share the statistics of the latter.
+         */
+        Statistics statistics;
+        /**
+         * The quantum cost of the synthesized quantum computation.
+         */
+        AnnotatableQuantumComputation::SynthesisCostMetricValue quantumCost = 0;
+        /**
+         * Whether no other successfully synthesized variant requires at most as many qubits and at most the same quantum cost while improving at least one of them.
+         */
+        bool isParetoOptimal = false;
+        /**
+         * The index of the variant whose synthesis result is reused for this variant, which is the index of this variant if the program was synthesized for it.
+         */
+        std::size_t indexOfSynthesizedVariant = 0;
+        /**
+         * The quantum computation synthesized for the variant, only set for Pareto-optimal variants if SynthesisSweepSettings::keepParetoOptimalQuantumComputations is enabled.
+         * Variants sharing the same synthesis result share the quantum computation.
+         */
+        std::shared_ptr<const AnnotatableQuantumComputation> annotatableQuantumComputation;
+        /**
+         * The errors reported during the parsing and synthesis of the variant.
+         */
+        Diagnostics diagnostics;
+    };
+
+    /**
+     * The result of a synthesis sweep.
+     */
+    struct SynthesisSweepResult {
+        /**
+         * The results of the variants with the i-th entry corresponding to the i-th variant.
+         */
+        std::vector<SynthesisSweepEntry> entries;
+        /**
+         * The number of times the program was parsed.
+         */
+        std::size_t numParsedPrograms = 0;
+        /**
+         * The number of times the program was synthesized.
+         */
+        std::size_t numSynthesizedVariants = 0;
+    };
+
+    /**
+     * @brief Synthesize a SyReC program under multiple configurations (i.e. to explore the trade-off between the number of qubits and the quantum cost of different synthesizers and arithmetic architectures)
+     *
+     * The program is only parsed once per distinct combination of the settings influencing the parser (see syrec::ProgramCache) with the IR being shared by all variants using said combination. Variants whose synthesizer
+     * and settings influencing the synthesis are identical (see SynthesisResultCache::serializeSynthesisRelevantSettings(...)) are only synthesized once, unless a synthesis trace file is recorded for them.
+     * The remaining variants are synthesized in parallel by the worker threads of the shared syrec::Executor (see syrec::batchSynthesis(...)), with each synthesizer using its own module call and loop iteration templates since the
+     * quantum operations recorded in the latter depend on the settings of the variant.
+     *
+     * @param result The result of the sweep, which is overwritten.
+     * @param stringifiedProgram The SyReC program to synthesize.
+     * @param variants The configurations under which the program is synthesized.
+     * @param sweepSettings The settings of the sweep.
+     */
+    void synthesisSweep(SynthesisSweepResult& result, std::string_view stringifiedProgram, const std::vector<SynthesisSweepVariant>& variants, const SynthesisSweepSettings& sweepSettings = SynthesisSweepSettings{});
+} // namespace syrec
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/annotatable_quantum_computation.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace syrec {
+    /**
+     * A recorder of the time spent in and the number of quantum operations emitted by the synthesis of the modules, loops, statements and expressions of a SyReC program.
+     *
+     * The recorded events can be exported in the Chrome trace-event JSON format which can be loaded in Perfetto (https://ui.perfetto.dev) or chrome://tracing to inspect the synthesis as a flame graph.
+     * Events are only recorded by the synthesizers if the library was built with the MQT_SYREC_ENABLE_SYNTHESIS_TRACING option, otherwise the tracing scopes of the synthesizers are compiled out.
+     */
+    class SynthesisTraceRecorder {
+    public:
+        using TimeStamp = std::chrono::time_point<std::chrono::steady_clock>;
+
+        struct TraceEvent {
+            std::string_view        category;
+            std::string             name;
+            std::optional<unsigned> lineNumber;
+            std::uint64_t           startTimestampInNanoseconds;
+            std::uint64_t           durationInNanoseconds;
+            std::size_t             numEmittedQuantumOperations;
+        };
+
+        SynthesisTraceRecorder():
+            startTime(std::chrono::steady_clock::now()) {}
+
+        /**
+         * Record a completed event.
+         * @param category The category of the event (i.e. 'module', 'module call', 'statement', 'loop' or 'expression'), must outlive the recorder.
+         * @param name The name of the event.
+         * @param lineNumber The line number of the SyReC statement associated with the event, if any.
+         * @param eventStartTime The time at which the event started.
+         * @param eventEndTime The time at which the event ended.
+         * @param numEmittedQuantumOperations The number of quantum operations emitted during the event, including the ones emitted by any nested event.
+         */
+        void recordEvent(std::string_view category, std::string name, std::optional<unsigned> lineNumber, TimeStamp eventStartTime, TimeStamp eventEndTime, std::size_t numEmittedQuantumOperations);
+
+        [[nodiscard]] const std::vector<TraceEvent>& getEvents() const noexcept {
+            return events;
+        }
+
+        /**
+         * Stringify the recorded events as complete events ('ph': 'X') of the Chrome trace-event JSON format.
+         * @return The stringified JSON object.
+         */
+        [[nodiscard]] std::string toChromeTraceEventJson() const;
+
+        /**
+         * Write the recorded events in the Chrome trace-event JSON format to a file.
+         * @param filePath The path of the file to which the events shall be written.
+         * @return Whether the file could be written.
+         */
+        [[nodiscard]] bool writeChromeTraceEventJson(const std::string& filePath) const;
+
+    protected:
+        TimeStamp               startTime;
+        std::vector<TraceEvent> events;
+    };
+
+    /**
+     * Record an event of the synthesis in a trace recorder from the construction of this object until its destruction.
+     *
+     * No event is recorded if no trace recorder is set, in which case neither the current time nor the number of quantum operations is queried.
+     */
+    class ScopedSynthesisTraceEvent {
+    public:
+        ScopedSynthesisTraceEvent(SynthesisTraceRecorder* traceRecorder, const AnnotatableQuantumComputation& annotatableQuantumComputation, std::string_view category, std::string_view name, std::optional<unsigned> lineNumber = std::nullopt);
+        ~ScopedSynthesisTraceEvent();
+
+        ScopedSynthesisTraceEvent(const ScopedSynthesisTraceEvent&)            = delete;
+        ScopedSynthesisTraceEvent(ScopedSynthesisTraceEvent&&)                 = delete;
+        ScopedSynthesisTraceEvent& operator=(const ScopedSynthesisTraceEvent&) = delete;
+        ScopedSynthesisTraceEvent& operator=(ScopedSynthesisTraceEvent&&)      = delete;
+
+    protected:
+        SynthesisTraceRecorder*              traceRecorder;
+        const AnnotatableQuantumComputation& annotatableQuantumComputation;
+        std::string_view                     category;
+        std::string                          name;
+        std::optional<unsigned>              lineNumber;
+        SynthesisTraceRecorder::TimeStamp    startTime;
+        std::size_t                          numQuantumOperationsAtStart = 0;
+    };
+} // namespace syrec
+
+#define SYREC_SYNTHESIS_TRACE_CONCAT_IMPL(lhs, rhs) lhs##rhs
+#define SYREC_SYNTHESIS_TRACE_CONCAT(lhs, rhs)      SYREC_SYNTHESIS_TRACE_CONCAT_IMPL(lhs, rhs)
+
+// The arguments of the tracing scope are not evaluated if the tracing is compiled out, thus the name of an event should only be determined in the macro arguments.
+#ifdef MQT_SYREC_ENABLE_SYNTHESIS_TRACING
+#define SYREC_SYNTHESIS_TRACE_SCOPE(traceRecorder, annotatableQuantumComputation, category, ...) \
+    const ::syrec::ScopedSynthesisTraceEvent SYREC_SYNTHESIS_TRACE_CONCAT(syrecSynthesisTraceEvent, __LINE__)((traceRecorder), (annotatableQuantumComputation), (category), __VA_ARGS__)
+#else
+#define SYREC_SYNTHESIS_TRACE_SCOPE(traceRecorder, annotatableQuantumComputation, category, ...) static_cast<void>(0)
+#endif
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "algorithms/synthesis/batch_synthesis.hpp"
 #include "algorithms/synthesis/syrec_synthesis.hpp"
 #include "core/annotatable_quantum_computation.hpp"
 #include "core/configurable_options.hpp"
@@ -33,6 +34,10 @@ namespace syrec {
             return SyrecSynthesis::onStatement(statement);
         }
 
+        [[nodiscard]] SynthesisAlgorithm getSynthesisAlgorithm() const override {
+            return SynthesisAlgorithm::CostAware;
+        }
+
         bool assignAdd(std::vector<qc::Qubit>& lhs, std::vector<qc::Qubit>& rhs, [[maybe_unused]] AssignStatement::AssignOperation assignOperation) override {
             // The assignment lhs += rhs is synthesized using the inplace addition which stores the result of the addition in the qubits passed as the right hand side operand thus the operands of the assignment need to be passed in the reverse order.
             return inplaceAdd(annotatableQuantumComputation, rhs, lhs); // NOLINT(readability-suspicious-call-argument)
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/statistics.hpp"
+#include "core/syrec/expression.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/statement.hpp"
+#include "ir/Definitions.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace syrec {
+    /**
+     * A synthesizer selecting for every AssignStatement whether it is synthesized like in the cost aware synthesis (storing the results of the subexpressions of its right-hand side in ancillary qubits) or like in the line aware synthesis
+     * (computing the subexpressions in the qubits of their operands and reverting them after the assignment). The selection is based on a static estimate of the number of quantum operations and ancillary qubits of both variants and the
+     * qubit budget defined in the ConfigurableOptions (see ConfigurableOptions::qubitBudgetOfHybridSynthesis). All other statements are synthesized like in the cost aware synthesis.
+     */
+    class HybridSynthesis: public LineAwareSynthesis {
+    public:
+        using LineAwareSynthesis::LineAwareSynthesis;
+
+        /**
+         * The estimated number of quantum operations and ancillary qubits required to synthesize an AssignStatement.
+         */
+        struct EstimatedSynthesisCost {
+            std::size_t numQuantumOperations = 0;
+            std::size_t numAncillaryQubits   = 0;
+        };
+
+        static bool synthesize(AnnotatableQuantumComputation& annotatableQuantumComputation, const Program& program, const ConfigurableOptions& settings = ConfigurableOptions(), Statistics* optionalRecordedStatistics = nullptr);
+
+        /**
+         * Estimate the cost used to select the synthesis variant of an assignment whose right-hand side is not null, the estimate assumes that the ripple-carry adder is used.
+         * @param assignmentStmt The assignment to synthesize.
+         * @param synthesizeCostAware Whether the assignment is synthesized like in the cost aware or like in the line aware synthesis.
+         * @return The estimated cost to synthesize the assignment.
+         */
+        [[nodiscard]] static EstimatedSynthesisCost estimateSynthesisCostOfAssignment(const AssignStatement& assignmentStmt, bool synthesizeCostAware);
+
+    protected:
+        bool processStatement(const Statement::ptr& statement) override;
+
+        [[nodiscard]] SynthesisAlgorithm getSynthesisAlgorithm() const override {
+            return SynthesisAlgorithm::Hybrid;
+        }
+
+        void accumulateStatisticsOfConcurrentlySynthesizedStatements(const Statistics& statistics) override;
+
+        using LineAwareSynthesis::opRhsLhsExpression;
+        bool opRhsLhsExpression(const Expression::ptr& expression, std::vector<qc::Qubit>& v) override;
+
+        bool assignAdd(std::vector<qc::Qubit>& lhs, std::vector<qc::Qubit>& rhs, AssignStatement::AssignOperation assignOperation) override;
+        bool assignSubtract(std::vector<qc::Qubit>& lhs, std::vector<qc::Qubit>& rhs, AssignStatement::AssignOperation assignOperation) override;
+        bool assignExor(std::vector<qc::Qubit>& lhs, std::vector<qc::Qubit>& rhs, AssignStatement::AssignOperation assignOperation) override;
+
+        bool expAdd(unsigned bitwidth, std::vector<qc::Qubit>& lines, const std::vector<qc::Qubit>& lhs, const std::vector<qc::Qubit>& rhs) override;
+        bool expSubtract(unsigned bitwidth, std::vector<qc::Qubit>& lines, const std::vector<qc::Qubit>& lhs, const std::vector<qc::Qubit>& rhs) override;
+        bool expExor(unsigned bitwidth, std::vector<qc::Qubit>& lines, const std::vector<qc::Qubit>& lhs, const std::vector<qc::Qubit>& rhs) override;
+
+        bool expressionOpInverse(BinaryExpression::BinaryOperation binaryOperation, const std::vector<qc::Qubit>& expLhs, const std::vector<qc::Qubit>& expRhs) override;
+
+        /**
+         * Select whether the given assignment is synthesized like in the cost aware synthesis and record the selection as well as its estimated savings.
+         *
+         * The cost aware variant is selected if the line aware synthesis cannot synthesize the assignment or if the cost aware variant is estimated to require fewer quantum operations while its estimated ancillary qubits do not exceed the qubit budget.
+         * @param assignmentStmt The assignment to synthesize.
+         * @return Whether the assignment is synthesized like in the cost aware synthesis.
+         */
+        [[nodiscard]] bool selectCostAwareSynthesisOfAssignment(const AssignStatement& assignmentStmt);
+
+        /**
+         * Estimate the cost to synthesize an expression used on the right-hand side of an assignment, the estimate assumes that the ripple-carry adder is used.
+         * @param expression The expression to synthesize.
+         * @param synthesizeCostAware Whether the expression is synthesized like in the cost aware or like in the line aware synthesis.
+         * @return The estimated cost to synthesize the expression.
+         */
+        [[nodiscard]] static EstimatedSynthesisCost estimateSynthesisCostOfExpression(const Expression& expression, bool synthesizeCostAware);
+
+        /**
+         * Whether the quantum operations of the currently synthesized statement are synthesized like in the cost aware synthesis.
+         */
+        bool isCostAwareSynthesisSelected = true;
+        /**
+         * The maximum number of qubits of the synthesized quantum computation, std::nullopt if no budget is defined.
+         */
+        std::optional<std::size_t> qubitBudget;
+
+        std::size_t numAssignmentsSynthesizedCostAware                  = 0;
+        std::size_t numAssignmentsSynthesizedLineAware                  = 0;
+        std::size_t estimatedNumQuantumOperationsSavedByHybridSynthesis = 0;
+        std::size_t estimatedNumAncillaryQubitsSavedByHybridSynthesis   = 0;
+    };
+} // namespace syrec
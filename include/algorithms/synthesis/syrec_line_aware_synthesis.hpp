@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "algorithms/synthesis/batch_synthesis.hpp"
 #include "algorithms/synthesis/syrec_synthesis.hpp"
 #include "core/annotatable_quantum_computation.hpp"
 #include "core/configurable_options.hpp"
@@ -34,6 +35,10 @@ namespace syrec {
     protected:
         bool processStatement(const Statement::ptr& statement) override;
 
+        [[nodiscard]] SynthesisAlgorithm getSynthesisAlgorithm() const override {
+            return SynthesisAlgorithm::LineAware;
+        }
+
         bool opRhsLhsExpression(const Expression::ptr& expression, std::vector<qc::Qubit>& v) override;
 
         bool opRhsLhsExpression(const VariableExpression& expression, std::vector<qc::Qubit>& v) override;
@@ -73,13 +78,25 @@ namespace syrec {
             return synthesisOfExprOk;
         }
 
-        bool expEvaluate(std::vector<qc::Qubit>& lines, BinaryExpression::BinaryOperation binaryOperation, const std::vector<qc::Qubit>& lhs, const std::vector<qc::Qubit>& rhs) const;
+        bool expEvaluate(std::vector<qc::Qubit>& lines, BinaryExpression::BinaryOperation binaryOperation, const std::vector<qc::Qubit>& lhs, const std::vector<qc::Qubit>& rhs);
 
-        [[nodiscard]] bool expressionSingleOp(BinaryExpression::BinaryOperation binaryOperation, const std::vector<qc::Qubit>& expLhs, const std::vector<qc::Qubit>& expRhs) const;
-        static bool        decreaseNewAssign(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<qc::Qubit>& lhs, const std::vector<qc::Qubit>& rhs);
+        [[nodiscard]] bool expressionSingleOp(BinaryExpression::BinaryOperation binaryOperation, const std::vector<qc::Qubit>& expLhs, const std::vector<qc::Qubit>& expRhs);
+        bool               decreaseNewAssign(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<qc::Qubit>& lhs, const std::vector<qc::Qubit>& rhs);
 
         bool expressionOpInverse([[maybe_unused]] BinaryExpression::BinaryOperation binaryOperation, [[maybe_unused]] const std::vector<qc::Qubit>& expLhs, [[maybe_unused]] const std::vector<qc::Qubit>& expRhs) override;
 
+        /**
+         * The synthesis of an assignment in the line aware synthesis depends on the expressions recorded for previously synthesized assignments, the quantum operations synthesized for a sequence of statements (i.e. a module body or a loop body) can thus only be reused if no such expressions were recorded prior to and after the synthesis of said statements.
+         * @return Whether the quantum operations synthesized for a sequence of statements can be reused instead of synthesizing the statements again.
+         */
+        [[nodiscard]] bool canSynthesisOfStatementsBeReused() const override;
+
+        /**
+         * The line aware synthesis reuses the qubits of the operands of an expression to store its result and reverts the synthesized expression after the assignment, the synthesized result of an expression can thus not be shared.
+         * @return Whether the synthesized results of common subexpressions can be shared.
+         */
+        [[nodiscard]] bool canSynthesizedResultsOfExpressionsBeShared() const override;
+
         [[nodiscard]] std::optional<bool> doesVariableAccessNotContainCompileTimeconstantExpressions(const VariableAccess::ptr& variableAccess) const;
         [[nodiscard]] std::optional<bool> doesExpressionNotContainVariableAccessWithCompileTimeConstantExpressions(const Expression::ptr& expr) const;
     };
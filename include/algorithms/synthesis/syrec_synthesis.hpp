@@ -10,12 +10,23 @@
 
 #pragma once
 
+#include "algorithms/synthesis/ancillary_qubit_pool.hpp"
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "algorithms/synthesis/expression_synthesis_cache.hpp"
 #include "algorithms/synthesis/first_variable_qubit_offset_lookup.hpp"
+#include "algorithms/synthesis/module_call_synthesis_cache.hpp"
+#include "algorithms/synthesis/qubit_span_interner.hpp"
 #include "algorithms/synthesis/statement_execution_order_stack.hpp"
+#include "algorithms/synthesis/synthesis_trace_recorder.hpp"
 #include "core/annotatable_quantum_computation.hpp"
 #include "core/configurable_options.hpp"
+#include "core/execution_limits.hpp"
+#include "core/memory_accounting.hpp"
+#include "core/module_call_tree.hpp"
+#include "core/progress_reporting.hpp"
 #include "core/qubit_inlining_stack.hpp"
 #include "core/statistics.hpp"
+#include "core/syrec/compiled_number.hpp"
 #include "core/syrec/expression.hpp"
 #include "core/syrec/module.hpp"
 #include "core/syrec/number.hpp"
@@ -24,13 +35,16 @@
 #include "core/syrec/statement.hpp"
 #include "core/syrec/variable.hpp"
 #include "ir/Definitions.hpp"
+#include "ir/operations/Control.hpp"
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <memory>
 #include <optional>
 #include <stack>
+#include <string>
 #include <string_view>
 #include <variant>
 #include <vector>
@@ -38,15 +52,19 @@
 namespace syrec {
     class SyrecSynthesis {
     public:
+        /**
+         * The operands recorded by the line aware synthesis are stored as identifiers of their interned qubits (see qubitSpanInterner) to avoid copying them and to compare them in constant time.
+         */
+        QubitSpanInterner                              qubitSpanInterner;
         std::stack<BinaryExpression::BinaryOperation>  expOpp;
-        std::stack<std::vector<unsigned>>              expLhss;
-        std::stack<std::vector<unsigned>>              expRhss;
+        std::stack<QubitSpanInterner::Id>              expLhss;
+        std::stack<QubitSpanInterner::Id>              expRhss;
         bool                                           subFlag = false;
         std::vector<BinaryExpression::BinaryOperation> opVec;
         std::vector<AssignStatement::AssignOperation>  assignOpVector;
         std::vector<BinaryExpression::BinaryOperation> expOpVector;
-        std::vector<std::vector<unsigned>>             expLhsVector;
-        std::vector<std::vector<unsigned>>             expRhsVector;
+        std::vector<QubitSpanInterner::Id>             expLhsVector;
+        std::vector<QubitSpanInterner::Id>             expRhsVector;
 
         explicit SyrecSynthesis(AnnotatableQuantumComputation& annotatableQuantumComputation);
         virtual ~SyrecSynthesis() = default;
@@ -55,12 +73,17 @@ namespace syrec {
         [[maybe_unused]] static bool synthesize(SyrecSynthesis* synthesizer, const Program& program, const ConfigurableOptions& settings = ConfigurableOptions(), Statistics* optionalRecordedStatistics = nullptr);
 
     protected:
-        constexpr static std::string_view GATE_ANNOTATION_KEY_ASSOCIATED_STATEMENT_LINE_NUMBER = "lno";
+        constexpr static std::string_view GATE_ANNOTATION_KEY_ASSOCIATED_STATEMENT_LINE_NUMBER = AnnotatableQuantumComputation::QUANTUM_OPERATION_ANNOTATION_KEY_ASSOCIATED_STATEMENT_LINE_NUMBER;
         using OperationVariant                                                                 = std::variant<AssignStatement::AssignOperation, BinaryExpression::BinaryOperation, ShiftExpression::ShiftOperation, UnaryExpression::UnaryOperation>;
 
         virtual bool processStatement(const Statement::ptr& statement) = 0;
         virtual bool onModule(const Module::ptr&);
 
+        /**
+         * @return The synthesizer used to synthesize the groups of independent statements of the main module if the latter are synthesized concurrently (see ConfigurableOptions::synthesizeIndependentStatementsConcurrently).
+         */
+        [[nodiscard]] virtual SynthesisAlgorithm getSynthesisAlgorithm() const = 0;
+
         virtual bool opRhsLhsExpression([[maybe_unused]] const Expression::ptr& expression, [[maybe_unused]] std::vector<qc::Qubit>& v);
         virtual bool opRhsLhsExpression([[maybe_unused]] const VariableExpression& expression, [[maybe_unused]] std::vector<qc::Qubit>& v);
         virtual bool opRhsLhsExpression([[maybe_unused]] const BinaryExpression& expression, [[maybe_unused]] std::vector<qc::Qubit>& v);
@@ -100,16 +123,16 @@ namespace syrec {
         static bool bitwiseCnot(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<qc::Qubit>& dest, const std::vector<qc::Qubit>& src);                                     // ^=
         static bool bitwiseOr(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<qc::Qubit>& dest, const std::vector<qc::Qubit>& src1, const std::vector<qc::Qubit>& src2);  // &
         static bool conjunction(AnnotatableQuantumComputation& annotatableQuantumComputation, qc::Qubit dest, qc::Qubit src1, qc::Qubit src2);                                                            // &&// -=
-        static bool decreaseWithCarry(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<qc::Qubit>& dest, const std::vector<qc::Qubit>& src, qc::Qubit carry);
+        bool        decreaseWithCarry(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<qc::Qubit>& dest, const std::vector<qc::Qubit>& src, qc::Qubit carry);
         static bool disjunction(AnnotatableQuantumComputation& annotatableQuantumComputation, qc::Qubit dest, qc::Qubit src1, qc::Qubit src2);                                                                                                              // ||
-        static bool division(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<qc::Qubit>& dividend, const std::vector<qc::Qubit>& divisor, const std::vector<qc::Qubit>& quotient, const std::vector<qc::Qubit>& remainder); // /
+        bool        division(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<qc::Qubit>& dividend, const std::vector<qc::Qubit>& divisor, const std::vector<qc::Qubit>& quotient, const std::vector<qc::Qubit>& remainder); // /
         static bool equals(AnnotatableQuantumComputation& annotatableQuantumComputation, qc::Qubit dest, const std::vector<qc::Qubit>& src1, const std::vector<qc::Qubit>& src2);                                                                           // =
-        static bool greaterEquals(AnnotatableQuantumComputation& annotatableQuantumComputation, qc::Qubit dest, const std::vector<qc::Qubit>& srcTwo, const std::vector<qc::Qubit>& srcOne);                                                                // >
-        static bool greaterThan(AnnotatableQuantumComputation& annotatableQuantumComputation, qc::Qubit dest, const std::vector<qc::Qubit>& src2, const std::vector<qc::Qubit>& src1);                                                                      // >// +=
-        static bool lessEquals(AnnotatableQuantumComputation& annotatableQuantumComputation, qc::Qubit dest, const std::vector<qc::Qubit>& src2, const std::vector<qc::Qubit>& src1);                                                                       // <=
-        static bool lessThan(AnnotatableQuantumComputation& annotatableQuantumComputation, qc::Qubit dest, const std::vector<qc::Qubit>& src1, const std::vector<qc::Qubit>& src2);                                                                         // <
-        static bool modulo(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<qc::Qubit>& dividend, const std::vector<qc::Qubit>& divisor, const std::vector<qc::Qubit>& quotient, const std::vector<qc::Qubit>& remainder);   // %
-        static bool multiplication(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<qc::Qubit>& dest, const std::vector<qc::Qubit>& src1, const std::vector<qc::Qubit>& src2);                                               // *
+        bool        greaterEquals(AnnotatableQuantumComputation& annotatableQuantumComputation, qc::Qubit dest, const std::vector<qc::Qubit>& srcTwo, const std::vector<qc::Qubit>& srcOne);                                                                // >
+        bool        greaterThan(AnnotatableQuantumComputation& annotatableQuantumComputation, qc::Qubit dest, const std::vector<qc::Qubit>& src2, const std::vector<qc::Qubit>& src1);                                                                      // >// +=
+        bool        lessEquals(AnnotatableQuantumComputation& annotatableQuantumComputation, qc::Qubit dest, const std::vector<qc::Qubit>& src2, const std::vector<qc::Qubit>& src1);                                                                       // <=
+        bool        lessThan(AnnotatableQuantumComputation& annotatableQuantumComputation, qc::Qubit dest, const std::vector<qc::Qubit>& src1, const std::vector<qc::Qubit>& src2);                                                                         // <
+        bool        modulo(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<qc::Qubit>& dividend, const std::vector<qc::Qubit>& divisor, const std::vector<qc::Qubit>& quotient, const std::vector<qc::Qubit>& remainder);   // %
+        bool        multiplication(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<qc::Qubit>& dest, const std::vector<qc::Qubit>& src1, const std::vector<qc::Qubit>& src2);                                               // *
         static bool notEquals(AnnotatableQuantumComputation& annotatableQuantumComputation, qc::Qubit dest, const std::vector<qc::Qubit>& src1, const std::vector<qc::Qubit>& src2);                                                                        // !=
         static bool swap(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<qc::Qubit>& dest1, const std::vector<qc::Qubit>& dest2);
         /**
@@ -119,16 +142,63 @@ namespace syrec {
          * @param rhs The right hand side operand of the subtraction.
          * @return Whether the subtraction could be synthesized (i.e. no overlapping qubits and qubit length difference between the operands and whether all required gates could be added to the \p annotatableQuantumComputation).
          */
-        static bool inplaceSubtract(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<qc::Qubit>& lhs, const std::vector<qc::Qubit>& rhs);
+        bool inplaceSubtract(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<qc::Qubit>& lhs, const std::vector<qc::Qubit>& rhs);
         /**
-         * Synthesizes the addition \p lhs + \p rhs and stores the result in the qubits of the rhs operand.
+         * Synthesizes the addition \p lhs + \p rhs using the configured adder architecture and stores the result in the qubits of the rhs operand.
          * @param annotatableQuantumComputation The annotatable quantum computation to which the generated gates are added.
          * @param lhs The left hand side operand of the addition.
          * @param rhs The right hand side operand of the addition.
          * @param optionalCarryOut Optionally pass the qubit that will store the output carry of the addition.
          * @return Whether the addition could be synthesized (i.e. no overlapping qubits and qubit length difference between the operands and whether all required gates could be added to the \p annotatableQuantumComputation).
          */
-        static bool  inplaceAdd(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<qc::Qubit>& lhs, const std::vector<qc::Qubit>& rhs, const std::optional<qc::Qubit>& optionalCarryOut = std::nullopt);
+        bool inplaceAdd(AnnotatableQuantumComputation& annotatableQuantumComputation, std::span<const qc::Qubit> lhs, std::span<const qc::Qubit> rhs, const std::optional<qc::Qubit>& optionalCarryOut = std::nullopt);
+        /**
+         * Synthesizes the addition (subtraction) of a constant to (from) the given qubits using only increments and decrements of the qubits without requiring any ancillary qubits.
+         * @param qubits The qubits storing the operand to which the constant is added and the result of the operation.
+         * @param constant The constant which must be representable using the number of given qubits.
+         * @param subtractConstant Whether the constant is subtracted instead of added.
+         * @return Whether all required gates could be added to the annotatable quantum computation.
+         */
+        bool         addConstantWithoutAncillaryQubits(const std::vector<qc::Qubit>& qubits, unsigned constant, bool subtractConstant);
+        /**
+         * Synthesizes the multiplication of the \p src operand with a constant by adding/subtracting shifted copies of the operand to the qubits of \p dest for every non-zero digit in the canonical signed digit representation of the constant.
+         * @param dest The qubits, initially set to zero, storing the product after the synthesis.
+         * @param src The operand multiplied with the constant, only the least significant bits of the operand that fit into the qubits of \p dest are used.
+         * @param constant The constant with which the operand is multiplied.
+         * @return Whether the operand is at least as large as \p dest and whether all required gates could be added to the annotatable quantum computation.
+         */
+        bool multiplicationByConstant(const std::vector<qc::Qubit>& dest, const std::vector<qc::Qubit>& src, unsigned constant);
+        /**
+         * Synthesizes the comparison of the \p src operand with a constant by toggling \p dest for every bit of the constant at which the comparison can be decided (i.e. the bit of the operand differs from the one of the constant while all more significant bits are equal)
+         * using one multi-controlled X gate per such bit without requiring any ancillary qubits.
+         * @param annotatableQuantumComputation The annotatable quantum computation to which the generated gates are added.
+         * @param dest The qubit toggled if the comparison evaluates to true.
+         * @param src The operand compared with the constant.
+         * @param constant The constant which must be representable using the number of qubits of the operand.
+         * @param checkLessThan Whether the comparison \p src < \p constant instead of \p src > \p constant is synthesized.
+         * @return Whether all required gates could be added to the \p annotatableQuantumComputation.
+         */
+        static bool compareWithConstant(AnnotatableQuantumComputation& annotatableQuantumComputation, qc::Qubit dest, const std::vector<qc::Qubit>& src, unsigned constant, bool checkLessThan);
+        /**
+         * Synthesizes the equality check of the \p src operand with a constant using a single multi-controlled X gate whose control qubits are set for the bits of the constant set to '0' by surrounding X gates.
+         * @param annotatableQuantumComputation The annotatable quantum computation to which the generated gates are added.
+         * @param dest The qubit toggled if the operand is equal to the constant.
+         * @param src The operand compared with the constant.
+         * @param constant The constant which must be representable using the number of qubits of the operand.
+         * @return Whether all required gates could be added to the \p annotatableQuantumComputation.
+         */
+        static bool equalsConstant(AnnotatableQuantumComputation& annotatableQuantumComputation, qc::Qubit dest, const std::vector<qc::Qubit>& src, unsigned constant);
+        /**
+         * Synthesizes a binary operation with one operand being a constant whose value is known at compile time without storing the constant in ancillary qubits.
+         * @param binaryOperation The synthesized operation which must be a multiplication or a relational operation.
+         * @param expressionBitwidth The bitwidth of the result of the operation.
+         * @param lines The container storing the qubits of the result of the operation.
+         * @param nonConstantOperand The qubits of the operand that is not a constant.
+         * @param constant The value of the constant operand truncated to the bitwidth of the other operand.
+         * @param isConstantLhsOperand Whether the constant is the left hand side operand of the operation.
+         * @return Whether the operation could be synthesized.
+         */
+        bool synthesizeBinaryOperationWithConstantOperand(BinaryExpression::BinaryOperation binaryOperation, unsigned expressionBitwidth, std::vector<qc::Qubit>& lines, const std::vector<qc::Qubit>& nonConstantOperand, unsigned constant, bool isConstantLhsOperand);
         virtual bool expressionOpInverse([[maybe_unused]] BinaryExpression::BinaryOperation binaryOperation, [[maybe_unused]] const std::vector<qc::Qubit>& expLhs, [[maybe_unused]] const std::vector<qc::Qubit>& expRhs);
         bool         checkRepeats();
 
@@ -136,15 +206,35 @@ namespace syrec {
         static bool leftShift(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<qc::Qubit>& dest, const std::vector<qc::Qubit>& toBeShiftedQubits, unsigned qubitIndexShiftAmount);  // <<
         static bool rightShift(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<qc::Qubit>& dest, const std::vector<qc::Qubit>& toBeShiftedQubits, unsigned qubitIndexShiftAmount); // >>
 
+        /**
+         * Synthesize a shift by relabeling the shifted qubits, i.e. the result of the shift consists of the shifted qubits at their shifted positions and zero-initialized ancillary qubits at the positions of the shifted-in bits.
+         * @param shiftOperation The shift operation.
+         * @param expressionBitwidth The bitwidth of the result of the shift.
+         * @param lines The container storing the qubits of the result of the shift.
+         * @param toBeShiftedQubits The qubits of the shifted operand.
+         * @param qubitIndexShiftAmount The shift amount.
+         * @return Whether the shift could be synthesized.
+         * @remark Since the qubits of the result can be qubits of a variable, the result must only be read by the enclosing expression or statement.
+         */
+        [[nodiscard]] bool shiftByRelabelingQubits(ShiftExpression::ShiftOperation shiftOperation, unsigned expressionBitwidth, std::vector<qc::Qubit>& lines, const std::vector<qc::Qubit>& toBeShiftedQubits, unsigned qubitIndexShiftAmount);
+
+        /**
+         * Replace the qubits of an operand of a binary expression, which were determined by relabeling the qubits of a shift (see SyrecSynthesis::shiftByRelabelingQubits), with a copy in ancillary qubits if they share any qubit with the other operand.
+         * @param operand The operand of the binary expression.
+         * @param otherOperand The qubits of the other operand of the binary expression.
+         * @param operandExpression The expression of the operand.
+         * @return Whether the copy of the operand could be synthesized, if required.
+         */
+        [[nodiscard]] bool copyRelabeledQubitsOfShiftOperandSharedWithOtherOperand(std::vector<qc::Qubit>& operand, const std::vector<qc::Qubit>& otherOperand, const Expression& operandExpression);
+
         /**
          * Perform compile time simplifications of the operands of the expressions.
          * @param expression The expression to simplify.
-         * @param loopVariableValueLookup A lookup for the current value of the active loop variables.
          * @return std::nullopt if the expression type could not be handled or if an evaluation of a compile time constant expression failed, otherwise either the original expression (if no simplification could be performed) or its simplification.
          * @remark The truncation of compile time constant integer values/bitwidth used in subexpressions of the expression to simplify is also considered a simplification since this will help to reduce the number of ancillary qubits needed to synthesis the integer value.
          */
-        [[nodiscard]] static std::optional<Expression::ptr> performCompileTimeSimplificationsOfExpression(const Expression::ptr& expression, const Number::LoopVariableMapping& loopVariableValueLookup);
-        [[nodiscard]] bool                                  createQuantumRegistersForSyrecVariables(const Variable::vec& variables) const;
+        [[nodiscard]] std::optional<Expression::ptr> performCompileTimeSimplificationsOfExpression(const Expression::ptr& expression) const;
+        [[nodiscard]] bool                           createQuantumRegistersForSyrecVariables(const Variable::vec& variables) const;
 
         /**
          * Get the qubits accessed by the defined variable access.
@@ -160,14 +250,26 @@ namespace syrec {
 
         [[nodiscard]] std::optional<qc::Qubit> getConstantLine(bool value, const std::optional<QubitInliningStack::ptr>& inlinedQubitModuleCallStack) const;
         [[nodiscard]] bool                     getConstantLines(unsigned bitwidth, unsigned value, std::vector<qc::Qubit>& lines) const;
+        /**
+         * Append the given number of ancillary qubits initialized to zero to the container of qubits, the ancillary qubits are generated in chunks of at most 32 qubits using getConstantLines(...).
+         */
+        [[nodiscard]] bool getZeroInitializedAncillaryQubits(std::size_t numQubits, std::vector<qc::Qubit>& lines) const;
 
         [[nodiscard]] static std::optional<AssignStatement::AssignOperation>  tryMapBinaryToAssignmentOperation(BinaryExpression::BinaryOperation binaryOperation) noexcept;
         [[nodiscard]] static std::optional<BinaryExpression::BinaryOperation> tryMapAssignmentToBinaryOperation(AssignStatement::AssignOperation assignOperation) noexcept;
         [[nodiscard]] std::optional<QubitInliningStack::ptr>                  getLastCreatedModuleCallStackInstance() const;
-        [[nodiscard]] std::optional<QubitInliningStack::ptr>                  createInsertAndGetCopyOfLastCreatedCallStackInstance();
+        [[nodiscard]] bool                                                    createAndInsertModuleCallStackInstanceOfCalledModule(const Module::ptr& calledModule, unsigned lineNumberOfCallStatement, bool isCalledModuleAccessedViaCallStmt);
         [[nodiscard]] bool                                                    shouldQubitInlineInformationBeRecorded() const;
         void                                                                  discardLastCreateModuleCallStackInstance();
 
+        /**
+         * The inline stack shared by all qubits generated during the synthesis of one invocation of a module, the inline stack is a view of the node of the invocation in the module call tree.
+         */
+        struct ModuleCallStackInstance {
+            ModuleCallTree::NodeId  moduleCallTreeNodeId;
+            QubitInliningStack::ptr inlineStack;
+        };
+
         struct EvaluatedBitrangeAccess {
             unsigned bitrangeStart;
             unsigned bitrangeEnd;
@@ -194,34 +296,394 @@ namespace syrec {
             SwapQubits
         };
 
+        /**
+         * Determine whether a SwapStatement can be synthesized by swapping the qubits associated with the variables of its operands instead of synthesizing SWAP gates (see syrec::ConfigurableOptions::trackUnconditionalSwapsAsQubitPermutation).
+         * @param evaluatedLhsOperand The evaluated left hand side operand of the SwapStatement.
+         * @param evaluatedRhsOperand The evaluated right hand side operand of the SwapStatement.
+         * @return Whether the operands access all qubits of two distinct variables of the main module with the same type and bitwidth while neither control qubits are propagated nor the body of a loop is synthesized.
+         */
+        [[nodiscard]] bool canSwapBeTrackedAsQubitPermutation(const EvaluatedVariableAccess& evaluatedLhsOperand, const EvaluatedVariableAccess& evaluatedRhsOperand) const;
+
+        /**
+         * Record the qubits associated with the variables of the main module at the end of the synthesis as the output permutation of the synthesized quantum computation.
+         * @param mainModule The main module.
+         * @return Whether the qubits associated with every variable of the main module could be determined.
+         */
+        [[nodiscard]] bool recordOutputPermutationOfVariablesOfMainModule(const Module& mainModule);
+
         [[nodiscard]] bool synthesizeModuleCall(const std::variant<const CallStatement*, const UncallStatement*>& callStmtVariant);
 
+        /**
+         * Synthesize a Call-/UncallStatement, either with the propagated control qubits being added to every synthesized quantum operation or with the propagated control qubits being lifted (see syrec::ConfigurableOptions::liftControlQubitsOfModuleCalls),
+         * and record the synthesized quantum operations if the module calls shall be emitted as compound operations.
+         * @param callStmtVariant The Call-/UncallStatement to synthesize.
+         * @return Whether the synthesis of the Call-/UncallStatement was successful.
+         */
+        [[nodiscard]] bool synthesizeAndRecordModuleCall(const std::variant<const CallStatement*, const UncallStatement*>& callStmtVariant);
+
+        /**
+         * Determine whether the propagated control qubits can be lifted from the quantum operations synthesized for the body of a called/uncalled module (see syrec::ConfigurableOptions::liftControlQubitsOfModuleCalls).
+         * @param callerArguments The identifiers of the caller arguments of the Call-/UncallStatement.
+         * @return Whether the lifting of control qubits is enabled, whether any control qubit is propagated and whether no qubit of a caller argument is a propagated control qubit.
+         */
+        [[nodiscard]] bool canControlQubitsOfModuleCallBeLifted(const std::vector<std::string>& callerArguments) const;
+
+        /**
+         * Synthesize the body of a called/uncalled module without the propagated control qubits and add the latter afterwards to either all synthesized quantum operations or only to the ones of the core of their nested compute-apply-uncompute structures,
+         * depending on which of the alternatives has the smaller quantum cost.
+         * @param callStmtVariant The Call-/UncallStatement to synthesize.
+         * @return Whether the synthesis of the Call-/UncallStatement was successful.
+         */
+        [[nodiscard]] bool synthesizeModuleCallWithLiftedControlQubits(const std::variant<const CallStatement*, const UncallStatement*>& callStmtVariant);
+
+        /**
+         * The quantum operations synthesized for the first iteration of the body of a syrec::ForStatement that can be replayed, by shifting their qubits by a fixed offset per iteration, for the remaining iterations of the loop.
+         */
+        struct LoopBodyIterationTemplate {
+            /**
+             * The index of the first quantum operation synthesized for the first iteration of the loop body.
+             */
+            std::size_t indexOfFirstQuantumOperation = 0;
+            /**
+             * The number of quantum operations synthesized per iteration of the loop body.
+             */
+            std::size_t numQuantumOperations = 0;
+            /**
+             * The first of the ancillary qubits created during the first iteration of the loop body.
+             */
+            qc::Qubit firstCreatedQubit = 0;
+            /**
+             * The number of ancillary qubits created per iteration of the loop body.
+             */
+            qc::Qubit numCreatedQubits = 0;
+            /**
+             * The qubits used in the first iteration of the loop body whose index changes between iterations, with the qubits of every range being shifted by the same offset per iteration.
+             */
+            std::vector<std::pair<AnnotatableQuantumComputation::QubitIndexRange, std::int64_t>> qubitIndexShiftsPerIteration;
+        };
+
+        /**
+         * Determine whether the synthesis of a sequence of statements (i.e. a module body or the body of a loop) only depends on the qubits accessed by said statements, the statement execution order and the propagated control qubits and not on any other state of the synthesizer.
+         * @return Whether the quantum operations synthesized for a sequence of statements can be reused instead of synthesizing the statements again.
+         */
+        [[nodiscard]] virtual bool canSynthesisOfStatementsBeReused() const;
+
+        /**
+         * Determine whether the qubits storing the synthesized result of an expression can be used as the result of any structurally identical expression synthesized later on, which requires the synthesis of an expression to neither modify the qubits of its operands nor the qubits storing its result.
+         * Since the same requirement allows to reset the ancillary qubits of the right-hand side expression of an assignment by replaying its quantum operations in reverse order, the reuse of ancillary qubits across statements is also only supported if this function returns true.
+         * @return Whether the synthesized results of common subexpressions can be shared.
+         */
+        [[nodiscard]] virtual bool canSynthesizedResultsOfExpressionsBeShared() const;
+
+        /**
+         * Invalidate the shared synthesized results of expressions that could be invalidated by the synthesis of the given statement (i.e. results of expressions accessing a variable modified by the statement or all results if the statement modifies the propagated control qubits or is a call/uncall statement).
+         * @param statement The synthesized statement.
+         */
+        void invalidateSharedSynthesisResultsOfExpressionsModifiedByStatement(const Statement& statement) const;
+
+        /**
+         * Report the progress of the synthesis to the progress callback of the synthesis settings (see ConfigurableOptions::progressCallback) if the minimum duration between two reports elapsed since the last report.
+         */
+        void reportProgressIfDue();
+
+        /**
+         * Invalidate the shared synthesized results of expressions, dividers and index decodings stored in or operating on any qubit targeted by a sequence of quantum operations (e.g. when the quantum operations synthesized for an expression were replayed in reverse order to reset the used ancillary qubits).
+         * @param indexOfFirstQuantumOperation The index of the first quantum operation of the sequence.
+         * @param indexOfLastQuantumOperation The index of the last quantum operation of the sequence.
+         */
+        void invalidateSharedSynthesisResultsOfExpressionsStoredInQubitsTargetedByQuantumOperations(std::size_t indexOfFirstQuantumOperation, std::size_t indexOfLastQuantumOperation);
+
+        /**
+         * The qubits of the operands as well as the qubits storing the quotient and remainder of a divider synthesized for the currently synthesized statement.
+         */
+        struct SynthesizedDivider {
+            std::vector<qc::Qubit> dividend;
+            std::vector<qc::Qubit> divisor;
+            std::vector<qc::Qubit> quotient;
+            std::vector<qc::Qubit> remainder;
+        };
+
+        /**
+         * Find a divider synthesized for the currently synthesized statement whose quotient and remainder can be used as the result of a division/modulo operation of the given operands.
+         * @param dividend The qubits of the dividend.
+         * @param divisor The qubits of the divisor.
+         * @return A pointer to the divider synthesized for the same operand qubits, nullptr if no such divider was synthesized or the sharing of dividers is disabled.
+         */
+        [[nodiscard]] const SynthesizedDivider* findDividerSynthesizedForCurrentStatement(const std::vector<qc::Qubit>& dividend, const std::vector<qc::Qubit>& divisor) const;
+
+        /**
+         * The qubits of the operands as well as the qubits storing whether the lhs operand is less than and equal to the rhs operand of a comparator synthesized for the currently synthesized statement.
+         */
+        struct SynthesizedComparator {
+            std::vector<qc::Qubit> lhsOperand;
+            std::vector<qc::Qubit> rhsOperand;
+            qc::Qubit              lessThanResult;
+            qc::Qubit              equalityResult;
+        };
+
+        /**
+         * Find a comparator synthesized for the currently synthesized statement for the given operands.
+         * @param lhsOperand The qubits of the lhs operand.
+         * @param rhsOperand The qubits of the rhs operand.
+         * @return A pointer to the comparator synthesized for the same operand qubits, nullptr if no such comparator was synthesized or the sharing of comparators is disabled.
+         */
+        [[nodiscard]] const SynthesizedComparator* findComparatorSynthesizedForCurrentStatement(const std::vector<qc::Qubit>& lhsOperand, const std::vector<qc::Qubit>& rhsOperand) const;
+
+        /**
+         * Synthesize a comparator computing whether the lhs operand is less than and equal to the rhs operand using a single subtractor and record it for the currently synthesized statement.
+         * @param lhsOperand The qubits of the lhs operand.
+         * @param rhsOperand The qubits of the rhs operand.
+         * @return Whether the synthesis of the comparator was successful.
+         */
+        [[nodiscard]] bool synthesizeComparator(const std::vector<qc::Qubit>& lhsOperand, const std::vector<qc::Qubit>& rhsOperand);
+
+        /**
+         * Synthesize a relational operation whose result is determined from the results of a comparator synthesized for the same operands in the currently synthesized statement, the comparator is synthesized if no such comparator exists.
+         * @param relationalOperation The relational operation.
+         * @param dest The zero-initialized qubit storing the result of the relational operation.
+         * @param lhsOperand The qubits of the lhs operand.
+         * @param rhsOperand The qubits of the rhs operand.
+         * @return Whether the synthesis of the relational operation was successful.
+         */
+        [[nodiscard]] bool synthesizeRelationalOperationUsingSharedComparator(BinaryExpression::BinaryOperation relationalOperation, qc::Qubit dest, const std::vector<qc::Qubit>& lhsOperand, const std::vector<qc::Qubit>& rhsOperand);
+
+        /**
+         * The qubits storing the unrolled index of the element selected by a dimension access containing indices not evaluable at compile time as well as its one-hot decoding, with one qubit per element of the accessed variable,
+         * determined for the currently synthesized statement. The decoding can be shared by every access of a variable with the same dimensions using a structurally identical dimension access.
+         */
+        struct SharedIndexDecoding {
+            std::vector<unsigned>  dimensionsOfAccessedVariable;
+            Expression::vec        accessedIndexPerDimension;
+            qc::Controls           propagatedControlQubits;
+            std::vector<qc::Qubit> qubitsStoringUnrolledIndex;
+            std::vector<qc::Qubit> qubitsStoringOneHotIndex;
+            std::size_t            indexOfFirstDecodingOperation;
+            std::size_t            indexOfLastDecodingOperation;
+        };
+
+        /**
+         * Find a decoding of the unrolled index recorded for the currently synthesized statement that can be shared by the given variable access.
+         * @param evaluatedVariableAccess The evaluated variable access containing indices not evaluable at compile time.
+         * @return A pointer to the decoding recorded for a structurally identical dimension access on a variable with the same dimensions, nullptr if no such decoding was recorded or the sharing of decodings is disabled for the current statement.
+         */
+        [[nodiscard]] const SharedIndexDecoding* findIndexDecodingSharedInCurrentStatement(const EvaluatedVariableAccess& evaluatedVariableAccess) const;
+
+        /**
+         * Transfer the qubits of the element selected by the unrolled index using a one-hot decoding of the latter shared by all accesses of the currently synthesized statement with the same unrolled index, the decoding is synthesized and recorded if no such decoding exists.
+         * @param evaluatedVariableAccess The variable access defining the accessed variable from which qubits shall be extracted.
+         * @param qubitsStoringUnrolledIndexOfElementToSelect The qubits storing the index of the accessed element in the unrolled variable.
+         * @param qubitsStoringResultOfTransferOperation The qubits storing the qubits of the accessed variable transferred with the specified transfer operation.
+         * @param qubitTransferOperation The transfer operation applied to the accessed qubits of the variable.
+         * @return Whether the qubits of the accessed element could be transferred to the result container.
+         */
+        [[nodiscard]] bool transferQubitsOfElementUsingSharedIndexDecoding(const EvaluatedVariableAccess& evaluatedVariableAccess, const std::vector<qc::Qubit>& qubitsStoringUnrolledIndexOfElementToSelect, const std::vector<qc::Qubit>& qubitsStoringResultOfTransferOperation, QubitTransferOperation qubitTransferOperation);
+
+        /**
+         * Reset the one-hot decodings of the unrolled indices shared in the currently synthesized statement by replaying their quantum operations in reverse order and discard the recorded decodings.
+         * @return Whether the quantum operations resetting the decodings could be synthesized.
+         * @remark The decodings are not reset if the uncomputation of expressions is deferred since the deferred uncomputation of an expression could replay the quantum operations of a decoding after said reset.
+         */
+        [[nodiscard]] bool resetIndexDecodingsSharedInCurrentStatement();
+
+        /**
+         * The number of quantum operations, qubits and ancillary qubits borrowed from the ancillary qubit pool at a point during the synthesis.
+         */
+        struct AncillaryQubitUsageMark {
+            std::size_t numQuantumOperations       = 0;
+            qc::Qubit   numQubits                  = 0;
+            std::size_t numBorrowedAncillaryQubits = 0;
+        };
+
+        /**
+         * @return The current number of quantum operations, qubits and ancillary qubits borrowed from the ancillary qubit pool.
+         */
+        [[nodiscard]] AncillaryQubitUsageMark markAncillaryQubitUsage() const;
+
+        /**
+         * Record the statistics of the synthesized quantum computation (i.e. the number of qubits and quantum operations) as well as the counters recorded during the synthesis of a SyReC program.
+         * @param statistics The container in which the statistics are recorded.
+         */
+        void recordStatisticsOfSynthesizedQuantumComputation(Statistics& statistics) const;
+
+        /**
+         * Add the counters recorded during the synthesis of a group of independent statements of the main module (see ConfigurableOptions::synthesizeIndependentStatementsConcurrently) to the counters of the synthesizer.
+         * @param statistics The statistics recorded during the synthesis of the group of independent statements.
+         */
+        virtual void accumulateStatisticsOfConcurrentlySynthesizedStatements(const Statistics& statistics);
+
+        /**
+         * Synthesize groups of statements of a module, such that no statement of a group accesses a variable modified by a statement of another group, concurrently into separate quantum computations and append their quantum operations, with the ancillary qubits of every group being mapped to new ancillary qubits, to the synthesized quantum computation in the order of the groups.
+         * @param program The program that declares the module.
+         * @param module The module whose parameters and local variables were already added to the synthesized quantum computation.
+         * @param groupsOfIndependentStatements The groups of independent statements of the module.
+         * @param settings The settings used to synthesize the groups of independent statements.
+         * @return Whether all groups could be synthesized and their quantum operations could be appended to the synthesized quantum computation.
+         */
+        [[nodiscard]] bool synthesizeGroupsOfIndependentStatementsConcurrently(const Program& program, const Module::ptr& module, const std::vector<Statement::vec>& groupsOfIndependentStatements, const ConfigurableOptions& settings);
+
+        /**
+         * Reset the ancillary qubits initialized during the synthesis of an expression by replaying the quantum operations synthesized for the expression in reverse order and release them to the ancillary qubit pool.
+         *
+         * The reset is only performed if none of the quantum operations synthesized after the expression targeted a qubit used but not initialized by the expression, since the replayed quantum operations would otherwise not restore the initial state of the ancillary qubits.
+         * @param priorToSynthesisOfExpression The usage mark recorded prior to the synthesis of the expression.
+         * @param afterSynthesisOfExpression The usage mark recorded after the synthesis of the expression.
+         * @return Whether no error occurred while replaying the quantum operations of the expression. Note that a skipped reset is not considered to be an error.
+         */
+        [[nodiscard]] bool resetAndReleaseAncillaryQubitsOfExpression(const AncillaryQubitUsageMark& priorToSynthesisOfExpression, const AncillaryQubitUsageMark& afterSynthesisOfExpression);
+
+        /**
+         * The usage marks recorded prior to and after the synthesis of an expression whose ancillary qubits were not yet reset.
+         */
+        struct DeferredUncomputationOfExpression {
+            AncillaryQubitUsageMark priorToSynthesisOfExpression;
+            AncillaryQubitUsageMark afterSynthesisOfExpression;
+        };
+
+        /**
+         * Reset and release the ancillary qubits initialized during the synthesis of an expression using syrec::SyrecSynthesis::resetAndReleaseAncillaryQubitsOfExpression(...) either directly or deferred, as determined by the ancillary qubit uncomputation strategy.
+         * @param priorToSynthesisOfExpression The usage mark recorded prior to the synthesis of the expression.
+         * @param afterSynthesisOfExpression The usage mark recorded after the synthesis of the expression.
+         * @return Whether no error occurred while replaying the quantum operations of any uncomputed expression.
+         */
+        [[nodiscard]] bool scheduleUncomputationOfExpression(const AncillaryQubitUsageMark& priorToSynthesisOfExpression, const AncillaryQubitUsageMark& afterSynthesisOfExpression);
+
+        /**
+         * Uncompute all deferred expressions of the last opened scope of the ancillary qubit pool, in reverse order of their synthesis, if no ancillary qubit can be borrowed from said scope.
+         * @return Whether no error occurred while replaying the quantum operations of any uncomputed expression.
+         */
+        [[nodiscard]] bool uncomputeDeferredExpressionsIfNoAncillaryQubitIsAvailable();
+
+        /**
+         * Open a new scope of the ancillary qubit pool (if the reuse of ancillary qubits is enabled) in which the uncomputation of expressions is deferred separately from the parent scope.
+         */
+        void openAncillaryQubitPoolScope();
+
+        /**
+         * Close the last opened scope of the ancillary qubit pool (if the reuse of ancillary qubits is enabled) and hand its deferred uncomputations of expressions to the parent scope.
+         */
+        void closeAncillaryQubitPoolScope();
+
+        /**
+         * Determine whether the qubit of the variable accessed by the guard expression of a syrec::IfStatement can be used as the control qubit of the statements of both branches instead of copying its value to an ancillary qubit.
+         *
+         * This requires that none of the statements of either branch (including nested statements and the arguments of called/uncalled modules) accesses any variable of the guard expression, since the synthesis of an expression can also temporarily modify the qubits of its operands.
+         * @param statement The IfStatement whose guard expression should be checked.
+         * @return Whether the qubit of the guard variable is not accessed by any statement of the branches and the reuse of said qubit is enabled.
+         */
+        [[nodiscard]] bool canQubitOfGuardVariableBeUsedAsControlQubitOfBranches(const IfStatement& statement) const;
+
+        /**
+         * Synthesize the branches of a syrec::IfStatement nested in a statement with propagated control qubits with the quantum operations of both branches only being controlled by a single combined guard qubit, storing the conjunction of the propagated control qubits and the guard expression qubit, instead of all of the former.
+         * @param statement The IfStatement whose branches should be synthesized.
+         * @param guardExpressionQubit The qubit storing the synthesized guard expression.
+         * @param isGuardExpressionQubitConjunctionWithPropagatedControlQubits Whether the guard expression qubit already stores the conjunction of its value with the propagated control qubits, said qubit is then used as the combined guard qubit.
+         * @return Whether the branches could be synthesized.
+         */
+        [[nodiscard]] bool synthesizeBranchesControlledByCombinedGuard(const IfStatement& statement, qc::Qubit guardExpressionQubit, bool isGuardExpressionQubitConjunctionWithPropagatedControlQubits);
+
+        /**
+         * Determine whether the quantum operations synthesized for an iteration of the body of a syrec::ForStatement can be replayed for the remaining iterations of the loop.
+         *
+         * This requires the loop variable to only be used in indices of variable accesses whose value is an affine function of the loop variable, with all variable accesses on the same variable being shifted by the same number of qubits per iteration,
+         * while the loop body must neither contain a loop nor a call/uncall statement.
+         * @param statement The loop whose body should be checked.
+         * @param valuesOfLoopVariable The values of the loop variable in the first, second and last iteration of the loop.
+         * @return Whether the synthesis of the first iterations of the loop body can be used as a template for the remaining iterations.
+         */
+        [[nodiscard]] bool canIterationsOfLoopBodyBeReplayed(const ForStatement& statement, const std::array<unsigned, 3>& valuesOfLoopVariable) const;
+
+        /**
+         * Determine the template for the replay of the iterations of a loop body by comparing the quantum operations synthesized for the first three iterations.
+         * @param indexOfFirstQuantumOperationPerIteration The index of the first quantum operation synthesized for each of the first three iterations as well as the number of quantum operations after the synthesis of the third iteration.
+         * @param firstCreatedQubitPerIteration The first qubit created during each of the first three iterations as well as the number of qubits after the synthesis of the third iteration.
+         * @param numIterations The number of iterations of the loop.
+         * @return The template if the quantum operations of all three iterations only differ by a constant shift of their qubits per iteration, otherwise std::nullopt.
+         */
+        [[nodiscard]] std::optional<LoopBodyIterationTemplate> determineLoopBodyIterationTemplate(const std::array<std::size_t, 4>& indexOfFirstQuantumOperationPerIteration, const std::array<qc::Qubit, 4>& firstCreatedQubitPerIteration, std::size_t numIterations) const;
+
+        /**
+         * Replay the quantum operations of a loop body iteration template for a further iteration of the loop by recreating the ancillary qubits of an iteration and shifting the qubits of the recorded quantum operations.
+         * @param loopBodyIterationTemplate The template to replay.
+         * @param iterationIndex The zero-based index of the replayed iteration of the loop.
+         * @return Whether the ancillary qubits could be recreated and all recorded quantum operations could be replayed.
+         */
+        [[nodiscard]] bool replayLoopBodyIterationTemplate(const LoopBodyIterationTemplate& loopBodyIterationTemplate, std::size_t iterationIndex);
+
+        /**
+         * Determine the context used to store and find the quantum operations synthesized for the body of a called/uncalled module in the internal syrec::ModuleCallSynthesisCache.
+         * @param targetModule The called/uncalled module.
+         * @param firstQubitPerParameter The first qubit of every caller argument in the order of the formal parameters of the \p targetModule.
+         * @param statementExecutionOrder The aggregate statement execution order used to synthesize the statements of the \p targetModule.
+         * @return The module call context if the reuse of the synthesized quantum operations is enabled and the qubits of the caller arguments do neither overlap with each other nor with the propagated control qubits, otherwise std::nullopt.
+         */
+        [[nodiscard]] std::optional<ModuleCallSynthesisCache::ModuleCallContext> determineModuleCallContextForReuseOfSynthesis(const Module& targetModule, const std::vector<qc::Qubit>& firstQubitPerParameter, StatementExecutionOrderStack::StatementExecutionOrder statementExecutionOrder) const;
+
+        /**
+         * Check whether all quantum operations recorded in a module call template only operate on qubits of the caller arguments, on qubits created during the synthesis of the module body or on the propagated control qubits of the module call context.
+         * @param moduleCallTemplate The recorded module call template.
+         * @param moduleCallContext The module call context in which the template was recorded.
+         * @param targetModule The called/uncalled module.
+         * @return Whether all recorded quantum operations are standard operations whose qubits can be remapped when the template is instantiated.
+         */
+        [[nodiscard]] bool canQubitsOfModuleCallTemplateBeRemapped(const ModuleCallSynthesisCache::ModuleCallTemplate& moduleCallTemplate, const ModuleCallSynthesisCache::ModuleCallContext& moduleCallContext, const Module& targetModule) const;
+
+        /**
+         * Instantiate a module call template by recreating the quantum registers and replaying the quantum operations recorded in said template with the qubits of the caller arguments of the current call/uncall.
+         * @param moduleCallTemplate The module call template to instantiate.
+         * @param targetModule The called/uncalled module.
+         * @param firstQubitPerParameter The first qubit of every caller argument in the order of the formal parameters of the \p targetModule.
+         * @return Whether all quantum registers could be recreated and all recorded quantum operations could be replayed.
+         */
+        [[nodiscard]] bool instantiateModuleCallTemplate(const ModuleCallSynthesisCache::ModuleCallTemplate& moduleCallTemplate, const Module& targetModule, const std::vector<qc::Qubit>& firstQubitPerParameter);
+
+        /**
+         * Record the module calls synthesized in a sequence of quantum operations for a copy of the latter that was appended to the quantum computation, thus the quantum operations of the copied module calls are grouped into compound operations as well.
+         * @param indexOfFirstCopiedQuantumOperation The index of the first quantum operation of the copied sequence in the quantum computation.
+         * @param numCopiedQuantumOperations The number of quantum operations of the copied sequence.
+         * @param indexOfFirstQuantumOperationOfCopy The index of the first quantum operation of the copy in the quantum computation.
+         * @param isCopyInReverseOrder Whether the quantum operations of the sequence were copied in reverse order.
+         */
+        void recordModuleCallsOfCopiedQuantumOperations(std::size_t indexOfFirstCopiedQuantumOperation, std::size_t numCopiedQuantumOperations, std::size_t indexOfFirstQuantumOperationOfCopy, bool isCopyInReverseOrder = false);
+
+        /**
+         * Find the template recorded for the mirrored module call of a call/uncall, i.e. for a previous uncall/call of the same module on the same caller arguments and with the same propagated control qubits, whose quantum operations
+         * can be replayed in reverse order instead of synthesizing the module body for the call/uncall.
+         * @param moduleCallContext The module call context of the call/uncall.
+         * @param firstQubitPerParameter The first qubit of every caller argument of the call/uncall in the order of the formal parameters of the called/uncalled module.
+         * @return A pointer to the template of the mirrored module call if the latter did not create any qubits and its quantum operations were not yet forwarded to a quantum operation sink, otherwise nullptr.
+         */
+        [[nodiscard]] const ModuleCallSynthesisCache::ModuleCallTemplate* findTemplateOfMirroredModuleCall(const ModuleCallSynthesisCache::ModuleCallContext& moduleCallContext, const std::vector<qc::Qubit>& firstQubitPerParameter) const;
+
+        /**
+         * Replay the quantum operations recorded in the template of a mirrored module call (see findTemplateOfMirroredModuleCall(...)) in reverse order.
+         * @param mirroredModuleCallTemplate The template of the mirrored module call.
+         * @return Whether all recorded quantum operations could be replayed.
+         */
+        [[nodiscard]] bool replayMirroredModuleCallTemplate(const ModuleCallSynthesisCache::ModuleCallTemplate& mirroredModuleCallTemplate);
+
         /**
          * Evaluate and validate the value of the indices evaluable at compile time defined in the bitrange component of a variable access.
          * @param userDefinedVariableAccess The variable access to evaluate.
-         * @param loopVariableValueLookup A lookup for loop variable values.
          * @return A container storing the value of the indices of the bitrange if the evaluation was possible (value for all loop variables known, etc.), otherwise std::nullopt is returned.
          */
-        [[nodiscard]] static std::optional<EvaluatedBitrangeAccess> evaluateAndValidateBitrangeAccess(const VariableAccess& userDefinedVariableAccess, const Number::LoopVariableMapping& loopVariableValueLookup);
+        [[nodiscard]] std::optional<EvaluatedBitrangeAccess> evaluateAndValidateBitrangeAccess(const VariableAccess& userDefinedVariableAccess) const;
 
         /**
          * Evaluate and validate the value of the indices evaluable at compile time defined in the dimension access of a variable access.
          * @param userDefinedVariableAccess The variable access to validate, accessed variable must not be null.
-         * @param loopVariableValueLookup A lookup containing the current value of the activate loop variables.
          * @return A container storing the evaluated values of each dimension, if the number of accessed dimensions is equal to the number of defined dimensions of the accessed variable and if all numeric expressions in the dimension access could be evaluated and defined a value within the range [0, number of values in dimension at same index in accessed variable - 1]. If the validation failed, std::nullopt is returned.
          * @remark Note that only numeric expressions are evaluated while all other expressions types are ignored. A flag in the returned container can be used to distinguish between the two cases.
          * @remark No arithmetic or logical simplifications are performed at the moment which could enable the evaluation of other expression types at compile time.
          */
-        [[nodiscard]] static std::optional<EvaluatedDimensionAccess> evaluateAndValidateDimensionAccess(const VariableAccess& userDefinedVariableAccess, const Number::LoopVariableMapping& loopVariableValueLookup);
+        [[nodiscard]] std::optional<EvaluatedDimensionAccess> evaluateAndValidateDimensionAccess(const VariableAccess& userDefinedVariableAccess) const;
 
         /**
          * Determine and validate compile time information for a given syrec::VariableAccess.
          * @param userDefinedVariableAccess The variable access to validate, accessed variable must not be null.
-         * @param loopVariableValueLookup A lookup containing the current value of the activate loop variables.
          * @param firstVariableQubitOffsetLookup A lookup usable to determine the first qubit of every variable using its identifier.
          * @return A container storing information about the evaluated syrec::VariableAccess known at compile time including its bitrange as well as dimension access component. If the syrec::VariableAccess contained invalid indices (e.g. nullptr, loop variables for which no value could be determined) then std::nullopt is returned.
          */
-        [[nodiscard]] static std::optional<EvaluatedVariableAccess> evaluateAndValidateVariableAccess(const VariableAccess::ptr& userDefinedVariableAccess, const Number::LoopVariableMapping& loopVariableValueLookup, const std::unique_ptr<FirstVariableQubitOffsetLookup>& firstVariableQubitOffsetLookup);
+        [[nodiscard]] std::optional<EvaluatedVariableAccess> evaluateAndValidateVariableAccess(const VariableAccess::ptr& userDefinedVariableAccess, const std::unique_ptr<FirstVariableQubitOffsetLookup>& firstVariableQubitOffsetLookup) const;
 
         /**
          * Determine the qubits accessed by a syrec::VariableAccess.
@@ -250,6 +712,40 @@ namespace syrec {
          */
         [[nodiscard]] bool calculateSymbolicUnrolledIndexForElementInVariable(const EvaluatedVariableAccess& evaluatedVariableAccess, std::vector<qc::Qubit>& containerToStoreUnrolledIndex);
 
+        /**
+         * Calculate the index of the accessed value in the unrolled variable, whose dimensions are padded to powers of two, by concatenating the copies of the indices of all dimensions of the evaluated variable access.
+         * @param evaluatedVariableAccess The evaluated variable access whose accessed index should be calculated.
+         * @param containerToStoreUnrolledIndex The container storing the qubits storing the calculated index. Must be passed as an empty container.
+         * @return Whether the index of the accessed element in the provided variable access could be calculated.
+         * @remark The index of the last dimension is stored in the least significant qubits of the unrolled index, e.g. the unrolled index of the element 'a[1][2][1]' in 'a[2][4][3]' is equal to 25 (1*16 + 2*4 + 1).
+         *         The indices of the dimensions are only copied, instead of being multiplied with the number of elements per value of the dimension and summed up, with the index of a dimension whose value is a compile time constant being
+         *         initialized in ancillary qubits.
+         */
+        [[nodiscard]] bool concatenateIndicesOfDimensionsToUnrolledIndex(const EvaluatedVariableAccess& evaluatedVariableAccess, std::vector<qc::Qubit>& containerToStoreUnrolledIndex);
+
+        /**
+         * Determine the number of qubits storing the unrolled index of any element of a variable.
+         * @param variable The accessed variable.
+         * @return The number of qubits required to store the largest unrolled index of an element of the variable, depends on whether the dimensions of the variable are padded to powers of two.
+         */
+        [[nodiscard]] unsigned determineNumberOfQubitsOfUnrolledIndex(const Variable& variable) const;
+
+        /**
+         * Determine the unrolled index of an element of a variable.
+         * @param variable The accessed variable.
+         * @param indexOfElement The index of the element in the row-major order of the elements of the variable.
+         * @return The unrolled index of the element, which is equal to \p indexOfElement unless the dimensions of the variable are padded to powers of two.
+         */
+        [[nodiscard]] std::size_t determineUnrolledIndexOfElement(const Variable& variable, std::size_t indexOfElement) const;
+
+        /**
+         * Determine the element of a variable selected by an unrolled index.
+         * @param variable The accessed variable.
+         * @param unrolledIndex The unrolled index.
+         * @return The index of the selected element in the row-major order of the elements of the variable, std::nullopt if the unrolled index does not select any element of the variable.
+         */
+        [[nodiscard]] std::optional<std::size_t> determineElementAtUnrolledIndex(const Variable& variable, std::size_t unrolledIndex) const;
+
         /**
          * Transfer the qubits at index of the accessed value in the unrolled variable using one of the supported transfer operations.
          * @param evaluatedVariableAccess The variable access defining the accessed variable from which qubits shall be extracted.
@@ -260,15 +756,100 @@ namespace syrec {
          */
         [[nodiscard]] bool transferQubitsOfElementAtIndexInVariableToOtherQubits(const EvaluatedVariableAccess& evaluatedVariableAccess, const std::vector<qc::Qubit>& qubitsStoringUnrolledIndexOfElementToSelect, const std::vector<qc::Qubit>& qubitsStoringResultOfTransferOperation, QubitTransferOperation qubitTransferOperation);
 
+        /**
+         * Transfer the qubits of the element selected by the unrolled index among the elements in the subtree of a node of a unary iteration tree, whose leaves are the elements of the accessed variable, using one of the supported transfer operations.
+         * @param evaluatedVariableAccess The variable access defining the accessed variable from which qubits shall be extracted.
+         * @param qubitsStoringUnrolledIndexOfElementToSelect The qubits storing the index of the accessed element in the unrolled variable.
+         * @param ancillaryQubitsStoringActivationOfNodePerLevel The ancillary qubits, initially set to zero, storing whether the visited node of a level (excluding the root) is on the path to the leaf selected by the unrolled index.
+         * @param qubitsStoringResultOfTransferOperation The qubits storing the qubits of the accessed variable transferred with the specified transfer operation.
+         * @param qubitTransferOperation The transfer operation applied to the accessed qubits of the variable to "move" them to qubits storing the result of the transfer operation.
+         * @param level The level of the node in the unary iteration tree with the root being at level 0.
+         * @param indexOfFirstElementInSubtree The index of the first element in the unrolled variable that is a leaf in the subtree of the node.
+         * @param qubitStoringActivationOfNode The qubit storing whether the node is on the path to the selected leaf, not defined for the root.
+         * @return Whether the qubits of the accessed element in the subtree could be transferred to the result container.
+         * @remark The quantum operations synthesized for the tree are linear in the number of elements of the variable while only requiring one comparison per node instead of one comparison of the whole index per element.
+         */
+        [[nodiscard]] bool transferQubitsOfElementsInSubtreeOfUnaryIterationTree(const EvaluatedVariableAccess& evaluatedVariableAccess, const std::vector<qc::Qubit>& qubitsStoringUnrolledIndexOfElementToSelect, const std::vector<qc::Qubit>& ancillaryQubitsStoringActivationOfNodePerLevel, const std::vector<qc::Qubit>& qubitsStoringResultOfTransferOperation, QubitTransferOperation qubitTransferOperation, std::size_t level, std::size_t indexOfFirstElementInSubtree, std::optional<qc::Qubit> qubitStoringActivationOfNode);
+
+        /**
+         * Transfer the accessed qubits of an element of a variable, controlled by the control qubits propagated in the current scope, using one of the supported transfer operations.
+         * @param qubitOffsetToElement The first qubit of the element.
+         * @param relativeQubitOffsetForAccessedQubitsInElement The offsets of the accessed qubits relative to the first qubit of the element.
+         * @param qubitsStoringResultOfTransferOperation The qubits storing the qubits of the element transferred with the specified transfer operation.
+         * @param qubitTransferOperation The transfer operation applied to the accessed qubits of the element.
+         * @return Whether the accessed qubits of the element could be transferred to the result container.
+         */
+        [[nodiscard]] bool transferAccessedQubitsOfElement(qc::Qubit qubitOffsetToElement, const std::vector<qc::Qubit>& relativeQubitOffsetForAccessedQubitsInElement, const std::vector<qc::Qubit>& qubitsStoringResultOfTransferOperation, QubitTransferOperation qubitTransferOperation);
+
         std::stack<Statement::ptr>  stmts;
         Number::LoopVariableMapping loopMap;
         std::stack<Module::ptr>     modules;
 
+        // The values of the loop variables of the loopMap in dense slots used to evaluate the numbers in the indices of variable accesses, with numbers being lowered during their first evaluation (which is also performed by const member functions).
+        mutable CompiledNumberEvaluator loopVariableNumberEvaluator;
+
         AnnotatableQuantumComputation&                      annotatableQuantumComputation; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
-        std::optional<std::vector<QubitInliningStack::ptr>> moduleCallStackInstances;
+        ModuleCallTree::ptr                                 moduleCallTree;
+        std::optional<std::vector<ModuleCallStackInstance>> moduleCallStackInstances;
         std::unique_ptr<StatementExecutionOrderStack>       statementExecutionOrderStack;
         std::unique_ptr<FirstVariableQubitOffsetLookup>     firstVariableQubitOffsetLookup;
-
-        utils::IntegerConstantTruncationOperation integerConstantTruncationOperation = utils::IntegerConstantTruncationOperation::BitwiseAnd;
+        std::unique_ptr<ModuleCallSynthesisCache>           moduleCallSynthesisCache;
+        std::unique_ptr<ExpressionSynthesisCache>           expressionSynthesisCache;
+        std::unique_ptr<AncillaryQubitPool>                 ancillaryQubitPool;
+        std::unique_ptr<SynthesisTraceRecorder>             synthesisTraceRecorder;
+        std::unique_ptr<ExecutionLimitsMonitor>             executionLimitsMonitor;
+        std::optional<ProgressReporter>                     progressReporter;
+        std::optional<ResidentSetSizeSampler>               residentSetSizeSampler;
+
+        // The progress of the synthesis with the number of emitted quantum operations only being updated when the progress is reported.
+        ProgressReport progressOfSynthesis;
+
+        // The dividers synthesized for the currently synthesized statement, which are only recorded if the sharing of the quotient and remainder of a divider is enabled.
+        std::vector<SynthesizedDivider> dividersSynthesizedForCurrentStatement;
+
+        // The comparators synthesized for the currently synthesized statement, which are only recorded if the sharing of comparators by relational operations is enabled.
+        std::vector<SynthesizedComparator> comparatorsSynthesizedForCurrentStatement;
+
+        // The decodings of unrolled indices shared by the variable accesses of the currently synthesized AssignStatement, SwapStatement or UnaryStatement, which are only recorded if the sharing of index decodings is enabled.
+        std::vector<SharedIndexDecoding> indexDecodingsSharedInCurrentStatement;
+        bool                             shareIndexDecodingsInCurrentStatement = false;
+
+        // The expressions whose uncomputation was deferred per opened scope of the ancillary qubit pool, in the order of their synthesis.
+        std::vector<std::vector<DeferredUncomputationOfExpression>> deferredUncomputationsOfExpressionsPerAncillaryQubitPoolScope = std::vector<std::vector<DeferredUncomputationOfExpression>>(1);
+
+        // The number of bodies of loops enclosing the currently synthesized statement.
+        std::size_t numEnclosingLoopBodies = 0;
+
+        // The quantum operations synthesized for every module call and uncall, in the order in which the synthesis of the module calls was completed, if the module calls shall be emitted as compound operations.
+        std::optional<std::vector<AnnotatableQuantumComputation::QuantumOperationIndexRange>> quantumOperationsPerModuleCall;
+
+        utils::IntegerConstantTruncationOperation integerConstantTruncationOperation             = utils::IntegerConstantTruncationOperation::BitwiseAnd;
+        bool                                      replaySynthesizedLoopIterations                = false;
+        bool                                      decodeNonConstantIndicesUsingUnaryIteration    = false;
+        bool                                      shareIndexDecodingOfNonConstantIndices         = false;
+        bool                                      padDimensionsOfUnrolledIndicesToPowersOfTwo    = false;
+        bool                                      reuseQubitOfGuardVariableNotAccessedInBranches = false;
+        bool                                      combineGuardsOfNestedIfStatements              = false;
+        bool                                      liftControlQubitsOfModuleCalls                 = false;
+        AdderArchitecture                         adderArchitecture                              = AdderArchitecture::RippleCarry;
+        bool                                      addConstantsWithoutAncillaryQubits             = false;
+        bool                                      specializeOperationsWithConstantOperand        = false;
+        bool                                      synthesizeShiftsByRelabelingQubits             = false;
+        bool                                      trackUnconditionalSwapsAsQubitPermutation      = false;
+        bool                                      foldNegationsIntoNegativeControls              = false;
+        bool                                      narrowOperationsUsingValueRangeAnalysis        = false;
+        MultiplierArchitecture                    multiplierArchitecture                         = MultiplierArchitecture::ControlledAdditions;
+        DividerArchitecture                       dividerArchitecture                            = DividerArchitecture::Restoring;
+        bool                                      shareDividerOfQuotientAndRemainder             = false;
+        bool                                      shareComparatorOfRelationalOperations          = false;
+        AncillaryQubitUncomputationStrategy       ancillaryQubitUncomputationStrategy            = AncillaryQubitUncomputationStrategy::Eager;
+        std::size_t                               maxNumDeferredExpressionUncomputations         = 0;
+
+        std::size_t numExpandedModuleCalls                      = 0;
+        std::size_t numReusedModuleCalls                        = 0;
+        std::size_t numUnrolledLoopIterations                   = 0;
+        std::size_t numReplayedLoopIterations                   = 0;
+        std::size_t numUncomputedExpressions                    = 0;
+        std::size_t numQuantumOperationsOfUncomputedExpressions = 0;
     };
 } // namespace syrec
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/truthTable/truth_table.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace syrec {
+
+    // a truth table entry with the first position of its input and output cube being stored in the most significant bit of the respective word
+    struct PackedTruthTableEntry {
+        std::uint64_t input           = 0U;
+        std::uint64_t outputValues    = 0U;
+        std::uint64_t outputDontCares = 0U;
+    };
+
+    // a truth table with at most 64 completely specified inputs and at most 64 outputs whose entries are stored as packed cubes in a flat array.
+    struct PackedTruthTable {
+        std::size_t                        nInputs  = 0U;
+        std::size_t                        nOutputs = 0U;
+        std::vector<bool>                  constants;
+        std::vector<bool>                  garbage;
+        std::vector<PackedTruthTableEntry> entries;
+
+        [[nodiscard]] auto toTruthTable() const -> TruthTable;
+    };
+
+    // applies a chain of transformations of a truth table in a single pass over its packed entries instead of rebuilding the truth table for every transformation.
+    class TruthTablePipeline {
+    public:
+        // completes the inputs containing don't cares and adds the missing inputs with an all-zero output (equivalently to extend(...)).
+        // the completion is always applied before any other transformation.
+        auto completeDontCares() -> TruthTablePipeline&;
+
+        // replaces every output by its codeword (equivalently to assigning `codewords[output]` to every output), all codewords must have the same length.
+        auto substituteOutputs(const TruthTable::CubeMap& codewords) -> TruthTablePipeline&;
+
+        // augments the inputs and outputs with constants (equivalently to augmentWithConstants(...)).
+        auto augmentWithConstants(std::size_t nBits, bool appendZero = false) -> TruthTablePipeline&;
+
+        // returns std::nullopt if the transformed truth table cannot be stored packed, i.e. if it has more than 64 inputs or outputs, an input containing a don't care
+        // without the completion being applied or an output without a codeword (or a codeword of different length) in a substitution.
+        [[nodiscard]] auto apply(const TruthTable& tt) const -> std::optional<PackedTruthTable>;
+
+    private:
+        struct PackedCube {
+            std::uint64_t values    = 0U;
+            std::uint64_t dontCares = 0U;
+
+            auto operator==(const PackedCube& other) const -> bool = default;
+        };
+
+        struct PackedCubeHash {
+            auto operator()(const PackedCube& cube) const noexcept -> std::size_t;
+        };
+
+        struct Step {
+            enum class Kind : std::uint8_t {
+                Substitution,
+                Augmentation
+            };
+
+            Kind kind = Kind::Augmentation;
+            // the codewords of a substitution, packed using the bitwidth of the outputs and of the codewords respectively.
+            std::unordered_map<PackedCube, PackedCube, PackedCubeHash> codewords;
+            std::size_t                                                nOutputsOfCodewords = 0U;
+            std::size_t                                                nBitsOfCodewords    = 0U;
+            // whether all outputs and codewords of a substitution could be packed.
+            bool isPackable = true;
+            // the bitwidth and kind of an augmentation.
+            std::size_t nBits      = 0U;
+            bool        appendZero = false;
+        };
+
+        bool              isDontCareCompletionEnabled = false;
+        std::vector<Step> steps;
+    };
+
+} // namespace syrec
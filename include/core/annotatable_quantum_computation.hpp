@@ -14,6 +14,9 @@
 #include "ir/QuantumComputation.hpp"
 #include "ir/operations/Control.hpp"
 #include "ir/operations/Operation.hpp"
+#include "memory_accounting.hpp"
+#include "quantum_operation_annotations_table.hpp"
+#include "quantum_operation_sink.hpp"
 #include "qubit_inlining_stack.hpp"
 
 #include <cstddef>
@@ -22,6 +25,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -30,14 +34,34 @@
 #include <vector>
 
 namespace syrec {
+    class FrozenQuantumComputation;
+
     /**
      * A class to build a MQT::Core QuantumComputation and offer functionality to optionally annotate its quantum operations with string key-value pairs.
      */
     class AnnotatableQuantumComputation: public qc::QuantumComputation {
     public:
-        using QuantumOperationAnnotationsLookup = std::map<std::string, std::string, std::less<>>;
+        using QuantumOperationAnnotationsLookup = QuantumOperationSink::QuantumOperationAnnotationsLookup;
         using SynthesisCostMetricValue          = std::uint64_t;
 
+        /**
+         * The key of the quantum operation annotation storing the line number of the statement whose synthesis generated the annotated quantum operation.
+         *
+         * The statement line number is stored as an integer (see setOrUpdateGlobalStatementLineNumber(..)) and is only converted to an annotation with this key when the annotations of a quantum operation are fetched, exported or
+         * forwarded to a quantum operation sink. The generic global quantum operation annotation functions route this key to the statement line number and only accept integer values for it.
+         */
+        constexpr static std::string_view QUANTUM_OPERATION_ANNOTATION_KEY_ASSOCIATED_STATEMENT_LINE_NUMBER = "lno";
+
+        /**
+         * The quantum and transistor cost for the synthesis of a set of quantum operations.
+         */
+        struct SynthesisCost {
+            SynthesisCostMetricValue quantumCost    = 0;
+            SynthesisCostMetricValue transistorCost = 0;
+
+            [[nodiscard]] bool operator==(const SynthesisCost& other) const = default;
+        };
+
         /**
          * A wrapper for a qubit index range [first, last] in which the firstQubitIndex is less than or equal to the last qubit index.
          */
@@ -52,6 +76,34 @@ namespace syrec {
             qc::Qubit lastQubitIndex;
         };
 
+        /**
+         * A mapping of the qubits of a qubit index range to the same number of consecutive qubits starting at a given qubit.
+         */
+        struct QubitIndexRangeMapping {
+            /**
+             * The mapped qubit index range.
+             */
+            QubitIndexRange mappedQubitIndexRange;
+            /**
+             * The qubit to which the first qubit of the mapped qubit index range is mapped.
+             */
+            qc::Qubit firstQubitIndexOfMappingTarget;
+        };
+
+        /**
+         * A sequence of adjacent quantum operations of the quantum computation.
+         */
+        struct QuantumOperationIndexRange {
+            /**
+             * The index of the first quantum operation of the sequence.
+             */
+            std::size_t indexOfFirstQuantumOperation;
+            /**
+             * The number of quantum operations of the sequence.
+             */
+            std::size_t numQuantumOperations;
+        };
+
         /**
          * Stores debug information about the ancillary and local module variable qubits that can be used to determine the origin of the qubit in the
          * SyReC program or to determine the user declared identifier of the associated variable for a qubit. This information is not available for the
@@ -97,6 +149,93 @@ namespace syrec {
             unsigned bitwidth;
         };
 
+        /**
+         * The retained quantum operations of the quantum computation stored as a struct of arrays in which the i-th entry of every per quantum operation array describes the i-th retained quantum operation.
+         *
+         * The targets and controls of the i-th quantum operation are stored in the ranges [offsets[i], offsets[i + 1]) of the flat target and control qubit arrays.
+         */
+        struct QuantumOperationArrays {
+            /**
+             * The index of the first retained quantum operation in the quantum computation (i.e. the number of quantum operations already forwarded to a quantum operation sink).
+             */
+            std::size_t indexOfFirstQuantumOperation = 0;
+            /**
+             * The qc::OpType of every quantum operation.
+             */
+            std::vector<std::uint8_t> opTypes;
+            /**
+             * The offsets of the targets of each quantum operation with the number of offsets being equal to the number of quantum operations + 1.
+             */
+            std::vector<std::uint64_t> targetOffsets{0U};
+            std::vector<qc::Qubit>     targetQubits;
+            /**
+             * The offsets of the controls of each quantum operation with the number of offsets being equal to the number of quantum operations + 1.
+             */
+            std::vector<std::uint64_t> controlOffsets{0U};
+            std::vector<qc::Qubit>     controlQubits;
+            /**
+             * Whether the control at the same position in the control qubit array is a positive control qubit.
+             */
+            std::vector<std::uint8_t> isControlPositive;
+            /**
+             * The index of the annotations of every quantum operation in the distinct annotations. Quantum operations with identical annotations share the same index.
+             */
+            std::vector<std::uint64_t>                     annotationsIndices;
+            std::vector<QuantumOperationAnnotationsLookup> distinctAnnotations;
+        };
+
+        /**
+         * The depth related properties of the retained quantum operations of the quantum computation, with every quantum operation being placed in the earliest layer after all previous quantum operations sharing a qubit with it.
+         */
+        struct DepthAnalysis {
+            /**
+             * The number of layers of the quantum computation (i.e. the length of the longest sequence of quantum operations in which every quantum operation shares a qubit with its successor).
+             */
+            std::size_t depth = 0;
+            /**
+             * The number of quantum operations using a qubit as either control or target qubit for every qubit of the quantum computation.
+             */
+            std::vector<std::size_t> numQuantumOperationsPerQubit;
+            /**
+             * The zero-based layer of every retained quantum operation. The quantum operations of a layer operate on disjoint qubits, thus the layers define a partition of the quantum operations that can be executed in parallel.
+             */
+            std::vector<std::size_t> layerPerQuantumOperation;
+            /**
+             * The indices, in the quantum computation, of the quantum operations of a longest sequence of quantum operations in which every quantum operation shares a qubit with its successor.
+             */
+            std::vector<std::size_t> indicesOfQuantumOperationsOfCriticalPath;
+            /**
+             * The number of quantum operations of the critical path per value of their syrec::AnnotatableQuantumComputation::QUANTUM_OPERATION_ANNOTATION_KEY_ASSOCIATED_STATEMENT_LINE_NUMBER annotation, quantum operations without said annotation are not included.
+             */
+            std::map<std::string, std::size_t, std::less<>> numQuantumOperationsOfCriticalPathPerStatementLineNumber;
+        };
+
+        /**
+         * The layout of the gates of the retained quantum operations of the quantum computation in a circuit diagram, with the i-th entry of every per gate array describing the i-th gate exported by exportQuantumOperationsAsArrays().
+         *
+         * Every gate spans the qubits between its smallest and largest qubit and is placed in the earliest column after all previous gates whose span overlaps its own, thus the gates of a column can be drawn without overlapping each other.
+         */
+        struct QuantumOperationLayout {
+            /**
+             * The number of columns of the circuit diagram.
+             */
+            std::size_t numColumns = 0;
+            /**
+             * The zero-based column of every gate.
+             */
+            std::vector<std::uint64_t> columnPerGate;
+            /**
+             * The smallest and largest qubit operated on by every gate (as either control or target qubit).
+             */
+            std::vector<qc::Qubit> minQubitPerGate;
+            std::vector<qc::Qubit> maxQubitPerGate;
+            /**
+             * The indices of the gates ordered by their column, with the gates of the c-th column being stored in the range [columnOffsets[c], columnOffsets[c + 1]) and the number of offsets being equal to the number of columns + 1.
+             */
+            std::vector<std::uint64_t> columnOffsets{0U};
+            std::vector<std::uint64_t> gatesOrderedByColumn;
+        };
+
         AnnotatableQuantumComputation() = default;
 
         /**
@@ -154,6 +293,28 @@ namespace syrec {
          */
         [[nodiscard]] bool addOperationsImplementingFredkinGate(qc::Qubit targetQubitOne, qc::Qubit targetQubitTwo);
 
+        /**
+         * Add the quantum operations representing a sequence of CNOT gates to the quantum computation, with the i-th CNOT gate using the i-th qubit of \p controlQubits as its control qubit and the i-th qubit of \p targetQubits as its target qubit (i.e. a CNOT ladder between two qubit spans).
+         *
+         * The result is equal to adding every CNOT gate via addOperationsImplementingCnotGate(...) in the order of the spans, but the qubits of all gates are validated prior to the addition of any quantum operation, the storage for all quantum operations is reserved at once
+         * and the added quantum operations are annotated as a single range.
+         * @param controlQubits The control qubits of the CNOT gates, each control qubit must satisfy the requirements of addOperationsImplementingCnotGate(...).
+         * @param targetQubits The target qubits of the CNOT gates, each target qubit must satisfy the requirements of addOperationsImplementingCnotGate(...).
+         * @return Whether both spans contained the same number of qubits and the quantum operations of all CNOT gates could be added to the quantum computation. No quantum operation is added if the validation of any gate failed.
+         */
+        [[nodiscard]] bool addOperationsImplementingCnotGates(std::span<const qc::Qubit> controlQubits, std::span<const qc::Qubit> targetQubits);
+
+        /**
+         * Add the quantum operations representing a sequence of Fredkin gates to the quantum computation, with the i-th Fredkin gate swapping the i-th qubit of \p targetQubitsOne with the i-th qubit of \p targetQubitsTwo.
+         *
+         * The result is equal to adding every Fredkin gate via addOperationsImplementingFredkinGate(...) in the order of the spans, but the qubits of all gates are validated prior to the addition of any quantum operation, the storage for all quantum operations is reserved at once
+         * and the added quantum operations are annotated as a single range.
+         * @param targetQubitsOne The first target qubits of the Fredkin gates, each qubit must satisfy the requirements of addOperationsImplementingFredkinGate(...).
+         * @param targetQubitsTwo The second target qubits of the Fredkin gates, each qubit must satisfy the requirements of addOperationsImplementingFredkinGate(...).
+         * @return Whether both spans contained the same number of qubits and the quantum operations of all Fredkin gates could be added to the quantum computation. No quantum operation is added if the validation of any gate failed.
+         */
+        [[nodiscard]] bool addOperationsImplementingFredkinGates(std::span<const qc::Qubit> targetQubitsOne, std::span<const qc::Qubit> targetQubitsTwo);
+
         /**
          * Add a quantum register for the qubits of a SyReC variable to the quantum computation.
          * @param quantumRegisterLabel The label for the to be added quantum register. Must not be empty and no other qubit or quantum register with the same name must exist in the quantum computation.
@@ -180,6 +341,31 @@ namespace syrec {
          */
         void promotePreliminaryAncillaryQubitsToDefinitiveAncillaryQubits();
 
+        /**
+         * Relocate the quantum operations of ancillary qubits onto other ancillary qubits and remove the relocated qubits from the quantum computation.
+         *
+         * The remaining qubits are renumbered in ascending order, with the quantum registers, the qubit labels and inline information, the initial layout and the output permutation of the quantum computation being updated accordingly.
+         * Quantum registers and ancillary quantum register layouts only storing removed qubits are removed. The caller is responsible for the relocation preserving the functionality of the quantum computation
+         * (i.e. the relocated ancillary qubit and its host qubit are not used by overlapping sequences of quantum operations and the host qubit is restored to its initial value prior to the first usage of the relocated qubit).
+         * @param hostQubitPerQubit The qubit onto which the quantum operations of every qubit of the quantum computation are relocated, with every qubit not being relocated being its own host.
+         * @return Whether the relocation was performed, which requires that every relocated qubit and its host qubit are ancillary qubits not stored in a quantum register of a SyReC variable, that no host qubit is itself relocated,
+         * that all quantum operations are standard operations of which none was already forwarded to a quantum operation sink and that no relocated quantum operation accesses a qubit more than once. The quantum computation is not modified if any of the checks failed.
+         * @remark Can only be used after the preliminary ancillary qubits were promoted via AnnotatableQuantumComputation::promotePreliminaryAncillaryQubitsToDefinitiveAncillaryQubits() and only if the qubits were not permuted via AnnotatableQuantumComputation::permuteQubits(...).
+         */
+        [[nodiscard]] bool relocateAncillaryQubits(const std::vector<qc::Qubit>& hostQubitPerQubit);
+
+        /**
+         * Permute the qubits of the quantum computation, with the quantum operations, the ancillary and garbage qubits, the qubit labels and inline information, the initial layout and the output permutation of the quantum computation being updated accordingly.
+         *
+         * Since the qubits of a quantum register of the base quantum computation must be consecutive, every quantum register is split into the maximal ranges of its qubits that are assigned consecutive indices, with every range except for
+         * one covering all qubits of the quantum register being labeled by the label of the quantum register followed by '_' and the offset of the first qubit of the range in the quantum register.
+         * @param newIndexPerQubit The new index of every qubit of the quantum computation.
+         * @return Whether the qubits were permuted, which requires that the new indices are a permutation of the qubits, that every qubit is stored in a quantum register and that all quantum operations are standard operations of which none was already
+         * forwarded to a quantum operation sink. The quantum computation is not modified if any of the checks failed.
+         * @remark Can only be used after the preliminary ancillary qubits were promoted via AnnotatableQuantumComputation::promotePreliminaryAncillaryQubitsToDefinitiveAncillaryQubits().
+         */
+        [[nodiscard]] bool permuteQubits(const std::vector<qc::Qubit>& newIndexPerQubit);
+
         /**
          * Determine the label of a qubit based on its location and the associated variable layout of the SyReC variable stored in the quantum register that stores the qubit.
          * @param qubit The qubit whose label shall be determined.
@@ -188,10 +374,26 @@ namespace syrec {
          */
         [[nodiscard]] std::optional<std::string> getQubitLabel(qc::Qubit qubit, QubitLabelType qubitLabelType) const;
 
+        /**
+         * Append the label of a qubit (see AnnotatableQuantumComputation::getQubitLabel) to a caller-provided buffer, which allows the caller to reuse the storage of the buffer when determining the labels of multiple qubits.
+         * @param qubit The qubit whose label shall be determined.
+         * @param qubitLabelType The type of qubit label to generate. Can either be the internal or user declared one.
+         * @param qubitLabel The buffer to which the label of the qubit is appended. Not modified if the label could not be determined.
+         * @return Whether the label of the qubit could be determined.
+         */
+        [[nodiscard]] bool appendQubitLabel(qc::Qubit qubit, QubitLabelType qubitLabelType, std::string& qubitLabel) const;
+
+        /**
+         * Determine the labels of all qubits of the quantum computation in a single pass over the quantum registers.
+         * @param qubitLabelType The type of qubit labels to generate. Can either be the internal or user declared one.
+         * @return The label of every qubit of the quantum computation (see AnnotatableQuantumComputation::getQubitLabel) indexed by the qubit, with the entry of a qubit being std::nullopt if its label could not be determined.
+         */
+        [[nodiscard]] std::vector<std::optional<std::string>> getQubitLabels(QubitLabelType qubitLabelType) const;
+
         /**
          * Get a pointer to the quantum operation at a given index in the quantum computation.
          * @param indexOfQuantumOperationInQuantumComputation The index to the quantum operation in the quantum computation.
-         * @return A pointer to the quantum operation if an operation at the given index existed in the quantum computation, otherwise nullptr.
+         * @return A pointer to the quantum operation if an operation at the given index existed in the quantum computation and was not yet forwarded to a quantum operation sink, otherwise nullptr.
          */
         [[nodiscard]] const qc::Operation* getQuantumOperation(std::size_t indexOfQuantumOperationInQuantumComputation) const;
 
@@ -199,31 +401,306 @@ namespace syrec {
         * Replay a set of already existing quantum operations by readding the quantum operations to the quantum computation.
         * @param indexOfFirstQuantumOperationToReplayInQuantumComputation The index of the first quantum operation to replay. The index of the first quantum operation to replay is allowed to be larger than the index of the last quantum operation to replay.
         * @param indexOfLastQuantumOperationToReplayInQuantumComputation The index of the last quantum operation to replay.
-        * @return Whether the indices referenced an existing quantum operation and whether all requested quantum operation could be replayed.
+        * @return Whether the indices referenced an existing quantum operation, not yet forwarded to a quantum operation sink, and whether all requested quantum operation could be replayed.
         * @remark While a quantum operation can be added to the qc::QuantumComputation with qc::QuantumComputation::emplace_back(...), the required quantum gate annotations are not added to the annotatable quantum computation. Additionally, this function restricts the user to operations that can be simulated by syrec::SimpleSimulation (assuming the replayed operations were generated by addOperationsImplementingXGate calls).
         * @remark This function is not thread-safe. Additionally, the annotations of the replayed operations are not copied to the newly created operations.
         */
         [[nodiscard]] bool replayOperationsAtGivenIndexRange(std::size_t indexOfFirstQuantumOperationToReplayInQuantumComputation, std::size_t indexOfLastQuantumOperationToReplayInQuantumComputation);
 
+        /**
+         * Replay a sequence of already existing quantum operations by readding copies of the latter, whose qubits were remapped, to the quantum computation.
+         * @param indexOfFirstQuantumOperationToReplayInQuantumComputation The index of the first quantum operation of the sequence to replay.
+         * @param numQuantumOperationsToReplay The number of quantum operations in the sequence to replay.
+         * @param qubitIndexRangeMappings The mappings defining the qubit used in the copy of a replayed quantum operation for a qubit of the latter. Qubits not covered by any mapping are not remapped.
+         * @return Whether the replayed sequence referenced only existing standard operations, not yet forwarded to a quantum operation sink, in the quantum computation and whether all remapped qubits were within the range of qubits of the quantum computation.
+         * @remark Contrary to syrec::AnnotatableQuantumComputation::replayOperationsAtGivenIndexRange(...), the annotations of the replayed operations are copied to the newly created operations while the currently active global quantum operation annotations are ignored.
+         * Control qubits registered for propagation are not added to the copies of the replayed quantum operations.
+         */
+        [[nodiscard]] bool replayOperationsWithRemappedQubits(std::size_t indexOfFirstQuantumOperationToReplayInQuantumComputation, std::size_t numQuantumOperationsToReplay, const std::vector<QubitIndexRangeMapping>& qubitIndexRangeMappings);
+
+        /**
+         * Append copies, whose qubits were remapped, of all quantum operations of another quantum computation to the quantum computation.
+         * @param other The quantum computation whose quantum operations shall be appended, none of its quantum operations must have been forwarded to a quantum operation sink.
+         * @param qubitIndexRangeMappings The mappings defining the qubit used in the copy of an appended quantum operation for a qubit of the latter. Qubits not covered by any mapping are not remapped.
+         * @return Whether all quantum operations of the other quantum computation were standard operations and whether all remapped qubits were within the range of qubits of the quantum computation.
+         * @remark The annotations of the appended quantum operations are not copied, the copies are only annotated with the currently active global quantum operation annotations. Control qubits registered for propagation are not added to the copies of the appended quantum operations.
+         */
+        [[nodiscard]] bool appendOperationsOfQuantumComputationWithRemappedQubits(const AnnotatableQuantumComputation& other, const std::vector<QubitIndexRangeMapping>& qubitIndexRangeMappings);
+
+        /**
+         * Simplify the quantum operations of the quantum computation using the values of the qubits that are known at the position of every quantum operation, with every ancillary qubit being initialized to zero while the value of any other qubit is unknown.
+         *
+         * The known values are propagated forward through (multi-controlled) X and SWAP gates. A quantum operation with a control qubit known to not satisfy its control is removed while control qubits known to satisfy their control are removed from the quantum operation.
+         * A SWAP gate whose target qubits are known to store the same value is removed as well. Every other quantum operation causes the values of its target qubits to become unknown, quantum operations that are not standard operations cause the values of all qubits to become unknown.
+         * The annotations of the remaining quantum operations are kept while the recorded synthesis cost of the quantum computation is updated.
+         * @return The number of removed or simplified quantum operations, no quantum operation is modified if any quantum operation was already forwarded to a quantum operation sink.
+         * @remark Since the indices of the remaining quantum operations change, this function should only be called after the synthesis of the quantum computation was completed and after the ancillary qubits were promoted via AnnotatableQuantumComputation::promotePreliminaryAncillaryQubitsToDefinitiveAncillaryQubits().
+         */
+        [[maybe_unused]] std::size_t propagateConstantQubitValues();
+
+        /**
+         * Simplify the multi-controlled X gates of the quantum computation using the reversible circuit templates X(C) X(C) = I, X(C + {x}) X(C + {!x}) = X(C) and X(C) X(C + {x}) = X(C + {!x}) for two multi-controlled X gates with the same target qubit.
+         *
+         * Every multi-controlled X gate is moved in front of all previous quantum operations it commutes with (i.e. quantum operations not modifying any of its control qubits and not accessing its target qubit other than as the target qubit of a multi-controlled X gate)
+         * and matched against the last multi-controlled X gates with the same target qubit within the given window. The previous multi-controlled X gates are indexed by their target qubit, thus every match only considers up to \p windowSize quantum operations.
+         * The passes over the quantum operations are repeated until no further quantum operation is removed or the time budget is exceeded. The annotations of the remaining quantum operations are kept while the recorded synthesis cost of the quantum computation is updated.
+         * @param windowSize The maximum number of previous multi-controlled X gates with the same target qubit considered as the partner of a multi-controlled X gate.
+         * @param timeBudgetInMilliseconds The optional time after which no further quantum operations are simplified.
+         * @return The number of removed quantum operations, no quantum operation is modified if any quantum operation was already forwarded to a quantum operation sink.
+         * @remark Since the indices of the remaining quantum operations change, this function should only be called after the synthesis of the quantum computation was completed.
+         */
+        [[maybe_unused]] std::size_t applyReversibleCircuitTemplates(std::size_t windowSize, std::optional<std::uint64_t> timeBudgetInMilliseconds = std::nullopt);
+
+        /**
+         * Remove pairs of identical self-inverse quantum operations (i.e. multi-controlled X and SWAP gates) with no other quantum operation accessing any of their qubits in between them.
+         *
+         * The pairs are determined in a single pass over the quantum operations, thus a pair whose removal causes another pair of identical self-inverse quantum operations to become adjacent is also removed (e.g. X(a) CX(a, b) CX(a, b) X(a)).
+         * The annotations of the remaining quantum operations are kept while quantum operations already forwarded to a quantum operation sink are not considered.
+         * @return The number of removed quantum operations.
+         * @remark Since the indices of the remaining quantum operations change, this function should only be called after the synthesis of the quantum computation was completed.
+         */
+        [[maybe_unused]] std::size_t cancelAdjacentSelfInverseQuantumOperations();
+
+        /**
+         * Reorder the quantum operations of the quantum computation to reduce its depth by moving quantum operations in front of previous quantum operations they commute with.
+         *
+         * Every quantum operation is placed, in the order of the quantum operations, in the earliest layer after the layers of all previous quantum operations not commuting with it that does not yet contain a quantum operation sharing a qubit with it.
+         * Two (multi-controlled) X gates commute if the target qubit of neither of them is a control qubit of the other, while the target qubits of all other quantum operations (e.g. SWAP gates) do not commute with any usage of said qubits.
+         * Since the quantum operations are then ordered by their layer, the order of all pairs of quantum operations that do not commute is preserved and the depth of the quantum computation does not increase.
+         * The annotations of the quantum operations are reordered together with the latter while quantum operations already forwarded to a quantum operation sink are not considered.
+         * @return The number of layers by which the depth of the quantum computation was reduced.
+         * @remark Since the indices of the quantum operations change, this function should only be called after the synthesis of the quantum computation was completed (i.e. no further replay via syrec::AnnotatableQuantumComputation::replayOperationsAtGivenIndexRange(...) should refer to the quantum operations prior to the reordering).
+         */
+        [[maybe_unused]] std::size_t reorderQuantumOperationsToReduceDepth();
+
+        /**
+         * Replace every sequence of quantum operations by a single qc::CompoundOperation containing said quantum operations.
+         *
+         * Any two sequences must either be disjoint or one of them must contain the other, with the compound operation of the contained sequence then being nested in the compound operation of the containing one. Empty sequences are ignored.
+         * The recorded synthesis cost of the quantum computation does not change since the grouped quantum operations are kept.
+         * @param quantumOperationIndexRanges The sequences of quantum operations to group.
+         * @return Whether all sequences only referenced quantum operations not yet forwarded to a quantum operation sink and whether any two sequences were either disjoint or nested. The quantum operations are not modified if any of the checks failed.
+         * @remark Only supported if the generation of quantum operation annotations is disabled since the annotations are recorded per quantum operation of the quantum computation. Since the indices of the quantum operations change, this function should only be called after the synthesis of the quantum computation was completed.
+         */
+        [[nodiscard]] bool groupQuantumOperationsIntoCompoundOperations(const std::vector<QuantumOperationIndexRange>& quantumOperationIndexRanges);
+
+        /**
+         * Replace every qc::CompoundOperation, including nested ones, by the quantum operations it contains.
+         * @return The number of replaced compound operations.
+         * @remark Only supported if the generation of quantum operation annotations is disabled since the annotations are recorded per quantum operation of the quantum computation.
+         */
+        [[maybe_unused]] std::size_t flattenCompoundOperations();
+
+        /**
+         * Determine which quantum operations of a sequence of retained quantum operations need to be controlled by additional control qubits for the sequence to implement the controlled version of itself.
+         *
+         * The sequence is decomposed into nested compute-apply-uncompute structures 'g M g', with g being a self-inverse quantum operation, of which only the core M needs to be controlled since both occurrences of g cancel each other if M is not applied.
+         * A quantum operation is paired with the last identical quantum operation of the enclosing core, every quantum operation not part of such a pair needs to be controlled.
+         * @param indexOfFirstQuantumOperation The index of the first quantum operation of the sequence in the quantum computation.
+         * @param numQuantumOperations The number of quantum operations of the sequence.
+         * @return Whether a quantum operation of the sequence needs to be controlled for every quantum operation of the sequence, std::nullopt if the sequence referenced a quantum operation not retained in the quantum computation.
+         * @remark The control qubits must not be accessed by any quantum operation of the sequence.
+         */
+        [[nodiscard]] std::optional<std::vector<bool>> determineQuantumOperationsToControlInControlledSequence(std::size_t indexOfFirstQuantumOperation, std::size_t numQuantumOperations) const;
+
+        /**
+         * Determine the quantum cost of a sequence of retained quantum operations if additional control qubits were added to a subset of them.
+         * @param indexOfFirstQuantumOperation The index of the first quantum operation of the sequence in the quantum computation.
+         * @param shouldQuantumOperationBeControlled Whether the control qubits shall be added to a quantum operation for every quantum operation of the sequence.
+         * @param numAdditionalControlQubits The number of control qubits added to every controlled quantum operation.
+         * @return The quantum cost of the sequence, std::nullopt if the sequence referenced a quantum operation not retained in the quantum computation.
+         */
+        [[nodiscard]] std::optional<SynthesisCostMetricValue> determineQuantumCostOfControlledSequence(std::size_t indexOfFirstQuantumOperation, const std::vector<bool>& shouldQuantumOperationBeControlled, std::size_t numAdditionalControlQubits) const;
+
+        /**
+         * Add control qubits to a subset of a sequence of retained quantum operations, the recorded synthesis cost of the quantum computation is updated accordingly.
+         * @param indexOfFirstQuantumOperation The index of the first quantum operation of the sequence in the quantum computation.
+         * @param shouldQuantumOperationBeControlled Whether the control qubits shall be added to a quantum operation for every quantum operation of the sequence.
+         * @param controlQubits The control qubits to add.
+         * @return Whether all quantum operations of the sequence were retained standard operations, whether no quantum operation of the sequence used a control qubit as target qubit and whether no controlled quantum operation already accessed a control qubit. The quantum operations are not modified if any of the checks failed.
+         */
+        [[nodiscard]] bool addControlQubitsToQuantumOperations(std::size_t indexOfFirstQuantumOperation, const std::vector<bool>& shouldQuantumOperationBeControlled, const qc::Controls& controlQubits);
+
+        /**
+         * Forward the quantum operations of the quantum computation to a sink instead of retaining all of them. Only the most recently added quantum operations, of which there are at least \p numRetainedQuantumOperations many, are retained
+         * in the quantum computation and can thus be accessed or replayed. All other quantum operations, including the already added ones, are forwarded to the sink together with their annotations and are removed from the
+         * quantum computation afterward.
+         *
+         * The index of a quantum operation in the quantum computation used by the functions of this class (i.e. syrec::AnnotatableQuantumComputation::getQuantumOperation(...)) is not changed by the forwarding of quantum operations
+         * while qc::QuantumComputation::getNops() only returns the number of retained quantum operations.
+         * @param quantumOperationSink The sink to which the quantum operations are forwarded.
+         * @param numRetainedQuantumOperations The minimum number of most recently added quantum operations that are retained in the quantum computation.
+         * @return Whether the sink was set, which is not possible if the sink was NULL or another sink is already set.
+         * @remark The remaining retained quantum operations are only forwarded to the sink by a call to syrec::AnnotatableQuantumComputation::finishStreamingOfQuantumOperations().
+         */
+        [[nodiscard]] bool streamQuantumOperationsToSink(const QuantumOperationSink::ptr& quantumOperationSink, std::size_t numRetainedQuantumOperations);
+
+        /**
+         * Forward all retained quantum operations to the sink set via syrec::AnnotatableQuantumComputation::streamQuantumOperationsToSink(...), notify the sink that all quantum operations were forwarded and remove the sink from the quantum computation.
+         * @return Whether a sink was set and whether the latter could consume all forwarded quantum operations.
+         */
+        [[nodiscard]] bool finishStreamingOfQuantumOperations();
+
+        /**
+         * Determine whether the quantum operations of the quantum computation are forwarded to a sink.
+         * @return Whether a sink was set via syrec::AnnotatableQuantumComputation::streamQuantumOperationsToSink(...) for which the streaming was not yet finished.
+         */
+        [[nodiscard]] bool isStreamingOfQuantumOperationsActive() const noexcept;
+
+        /**
+         * Get the number of quantum operations added to the quantum computation.
+         * @return The number of added quantum operations, including the ones that were already forwarded to a quantum operation sink.
+         */
+        [[nodiscard]] std::size_t getNumQuantumOperations() const noexcept;
+
+        /**
+         * Get the number of quantum operations forwarded to a quantum operation sink which is equal to the index of the first retained quantum operation of the quantum computation.
+         * @return The number of forwarded quantum operations.
+         */
+        [[nodiscard]] std::size_t getNumForwardedQuantumOperations() const noexcept;
+
         /**
          * Get the annotations of a quantum operation at a given index in the quantum computation.
          * @param indexOfQuantumOperationInQuantumComputation The index to the quantum operation whose annotations shall be fetched in the quantum computation.
-         * @return A lookup of the fetched annotations. If the index did not reference an operation in the quantum computation then an empty lookup is returned.
+         * @return A lookup of the fetched annotations. If the index did not reference an operation in the quantum computation or the operation was already forwarded to a quantum operation sink then an empty lookup is returned.
          */
         [[nodiscard]] QuantumOperationAnnotationsLookup getAnnotationsOfQuantumOperation(std::size_t indexOfQuantumOperationInQuantumComputation) const;
 
+        /**
+         * Get the line number of the statement whose synthesis generated a quantum operation at a given index in the quantum computation.
+         * @param indexOfQuantumOperationInQuantumComputation The index to the quantum operation in the quantum computation.
+         * @return The statement line number of the quantum operation, std::nullopt if the generation of quantum operation annotations is disabled, the quantum operation has no statement line number or the index did not reference a retained quantum operation.
+         */
+        [[nodiscard]] std::optional<unsigned> getStatementLineNumberOfQuantumOperation(std::size_t indexOfQuantumOperationInQuantumComputation) const;
+
+        /**
+         * Export the retained quantum operations of the quantum computation together with their annotations as a struct of arrays.
+         * @return The exported quantum operations. If the generation of quantum operation annotations is disabled, all quantum operations reference a single empty set of annotations. The gates of a qc::CompoundOperation are exported in place of the latter.
+         */
+        [[nodiscard]] QuantumOperationArrays exportQuantumOperationsAsArrays() const;
+
+        /**
+         * Create an immutable snapshot of the retained quantum operations of the quantum computation together with their annotations, the labels of the qubits and the synthesis costs, which can be shared between threads analysing or
+         * simulating the quantum computation without synchronization (see syrec::FrozenQuantumComputation).
+         * @return The created snapshot, which is not affected by later modifications of the quantum computation.
+         */
+        [[nodiscard]] std::shared_ptr<const FrozenQuantumComputation> freeze() const;
+
+        /**
+         * Record the estimated number of bytes held by the quantum operations, their annotations, the variable layouts of the quantum registers and the distinct inline stacks of the qubits of the quantum computation.
+         * @param memoryUsage The memory usage whose corresponding fields are overwritten, all other fields are not modified.
+         */
+        void recordMemoryUsage(MemoryUsage& memoryUsage) const;
+
+        /**
+         * Serialize the quantum computation, together with the annotations of its quantum operations, the variable layouts of its quantum registers and the inlined information of its qubits, into a versioned binary format.
+         *
+         * The binary format consists of a sequence of 64-bit words (stored in the native byte order of the platform) with every variable sized section being padded to a multiple of the word size. The retained quantum operations
+         * are stored as the struct of arrays created by exportQuantumOperationsAsArrays(), thus the gates of a qc::CompoundOperation are stored in place of the latter while every distinct set of annotations is only stored once.
+         * The target modules of the inline stacks of the qubits are stored as their declaration (i.e. their identifier and parameters) without their statements.
+         * @return The serialized quantum computation, std::nullopt if quantum operations were already forwarded to a quantum operation sink, a gate is neither a (multi-controlled) X nor SWAP gate, the quantum registers
+         * do not cover all qubits or the target module of an inline stack entry is not set.
+         * @remark The global quantum operation annotations and the control qubit propagation scopes are part of the state used to build the quantum computation and are thus not serialized.
+         */
+        [[nodiscard]] std::optional<std::string> serialize() const;
+
+        /**
+         * Deserialize a quantum computation serialized with serialize().
+         * @param serializedQuantumComputation The serialized quantum computation.
+         * @return The deserialized quantum computation, nullptr if the serialized quantum computation was not valid (also if it was serialized on a platform with a different byte order).
+         */
+        [[nodiscard]] static std::unique_ptr<AnnotatableQuantumComputation> deserialize(std::string_view serializedQuantumComputation);
+
+        /**
+         * Save the quantum computation in its binary format (see serialize()) to the given file.
+         * @param filename The name of the created file.
+         * @return Whether the quantum computation could be serialized and the file could be written.
+         */
+        [[nodiscard]] bool save(const std::string& filename) const;
+
+        /**
+         * Load a quantum computation saved with save(...) from a file that is memory-mapped instead of being read into a buffer.
+         * @param filename The name of the file.
+         * @return The loaded quantum computation, nullptr if the file could not be opened or does not contain a valid quantum computation in the binary format.
+         */
+        [[nodiscard]] static std::unique_ptr<AnnotatableQuantumComputation> load(const std::string& filename);
+
         /**
          * Determine the quantum cost to synthesis the given quantum computation.
-         * @return The quantum cost for the synthesis of the quantum computation.
+         *
+         * The number of retained quantum operations per number of control qubits is updated whenever a quantum operation is added or removed, thus the cost is determined without iterating over the retained quantum operations.
+         * @return The quantum cost for the synthesis of the retained quantum operations of the quantum computation.
+         * @remark Only quantum operations added via the functions of this class are considered.
          */
         [[nodiscard]] SynthesisCostMetricValue getQuantumCostForSynthesis() const;
 
         /**
          * Determine the transistor cost to synthesis the given quantum computation.
-         * @return The transistor cost for the synthesis of the quantum computation.
+         * @return The transistor cost for the synthesis of the retained quantum operations of the quantum computation.
+         * @remark Only quantum operations added via the functions of this class are considered.
          */
         [[nodiscard]] SynthesisCostMetricValue getTransistorCostForSynthesis() const;
 
+        /**
+         * Determine the synthesis cost of the retained quantum operations of the quantum computation per statement, with the statement of a quantum operation being determined by the value of its
+         * syrec::AnnotatableQuantumComputation::QUANTUM_OPERATION_ANNOTATION_KEY_ASSOCIATED_STATEMENT_LINE_NUMBER annotation at the time it was added to the quantum computation.
+         * @return A lookup of the synthesis cost per statement line number. Quantum operations without a statement line number annotation (i.e. if the generation of quantum operation annotations is disabled) are not included.
+         * @remark The quantum cost of a quantum operation depends on the number of qubits of the quantum computation, thus the quantum cost per statement is determined using the current number of qubits.
+         */
+        [[nodiscard]] std::map<std::string, SynthesisCost, std::less<>> getSynthesisCostPerStatementLineNumber() const;
+
+        /**
+         * Determine the depth, the number of quantum operations per qubit, the layer of every quantum operation and a critical path of the retained quantum operations of the quantum computation in a single pass over the latter.
+         * @return The determined depth related properties of the retained quantum operations.
+         * @remark Quantum operations already forwarded to a quantum operation sink are not considered. A qc::CompoundOperation is considered to be a single quantum operation operating on the qubits of all of its gates.
+         */
+        [[nodiscard]] DepthAnalysis analyzeDepth() const;
+
+        /**
+         * Determine the layout of the gates of the retained quantum operations of the quantum computation in a circuit diagram in a single pass over the latter, allowing a viewer to only create the graphical representations of the gates in a given range of columns and qubits.
+         * @return The determined layout of the gates, the gates of a qc::CompoundOperation are laid out in place of the latter.
+         */
+        [[nodiscard]] QuantumOperationLayout determineLayoutOfQuantumOperations() const;
+
+        /**
+         * Determine the nearest neighbor cost of the retained quantum operations of the quantum computation, i.e. the number of SWAP gates between adjacent qubits required to move the qubits of every gate next to each other if only qubits with
+         * consecutive indices can interact (linear nearest neighbor architecture).
+         * @return The sum of the nearest neighbor costs of the gates (see AnnotatableQuantumComputation::getNearestNeighborCostOfGate(...)), the gates of a qc::CompoundOperation are considered in place of the latter.
+         * @remark Quantum operations already forwarded to a quantum operation sink are not considered.
+         */
+        [[nodiscard]] SynthesisCostMetricValue determineNearestNeighborCost() const;
+
+        /**
+         * Invoke a callback for every gate of a quantum operation, with the gates of a qc::CompoundOperation (including the ones of nested compound operations) being visited in their order in the compound operation.
+         * @param quantumOperation The quantum operation whose gates shall be visited, a quantum operation that is not a compound operation is its only gate.
+         * @param callback The callback invoked for every gate, the visit of the remaining gates is aborted if the callback returns false.
+         * @return Whether the callback returned true for all gates and whether no compound operation contained a NULL operation.
+         */
+        [[nodiscard]] static bool forEachGateOfQuantumOperation(const qc::Operation& quantumOperation, const std::function<bool(const qc::Operation&)>& callback);
+
+        /**
+         * Determine the quantum cost to synthesis a single (multi-controlled) X or SWAP gate.
+         * @param numControlQubits The number of control qubits of the gate.
+         * @param isSwapGate Whether the gate is a SWAP gate.
+         * @param numQubits The number of qubits of the quantum computation containing the gate.
+         * @return The quantum cost for the synthesis of the gate.
+         */
+        [[nodiscard]] static SynthesisCostMetricValue getQuantumCostForSynthesisOfGate(std::size_t numControlQubits, bool isSwapGate, std::size_t numQubits);
+
+        /**
+         * Determine the transistor cost to synthesis a single (multi-controlled) X or SWAP gate.
+         * @param numControlQubits The number of control qubits of the gate.
+         * @return The transistor cost for the synthesis of the gate.
+         */
+        [[nodiscard]] static SynthesisCostMetricValue getTransistorCostForSynthesisOfGate(std::size_t numControlQubits);
+
+        /**
+         * Determine the minimum number of SWAP gates between adjacent qubits required to move the qubits of a gate next to each other in a linear nearest neighbor architecture, with the SWAP gates restoring the previous order of the qubits not being counted.
+         * @param sortedPositionsOfQubits The distinct positions of the qubits of the gate in ascending order.
+         * @return The nearest neighbor cost of the gate, which for a gate operating on two qubits is the number of qubits positioned between them.
+         */
+        [[nodiscard]] static SynthesisCostMetricValue getNearestNeighborCostOfGate(std::span<const qc::Qubit> sortedPositionsOfQubits);
+
         /**
          * Activate a new control qubit propagation scope.
          *
@@ -260,11 +737,24 @@ namespace syrec {
         /**
          * Register a control qubit in the last activated control qubit propagation scope.
          *
-         * @remarks If no active local control qubit scope exists, a new one is created.
+         * @remarks If no active local control qubit scope exists, a new one is created. Registering an already propagated control qubit with a different polarity replaces the latter until the current scope is deactivated.
          * @param controlQubit The control qubit to register.
+         * @param controlQubitType The polarity of the control qubit, a negative control qubit enables the quantum operations only if it is not set.
          * @return Whether the control qubit exists in the \p quantumComputation and was registered in the last activated propagation scope.
          */
-        [[nodiscard]] bool registerControlQubitForPropagationInCurrentAndNestedScopes(qc::Qubit controlQubit);
+        [[nodiscard]] bool registerControlQubitForPropagationInCurrentAndNestedScopes(qc::Qubit controlQubit, qc::Control::Type controlQubitType = qc::Control::Type::Pos);
+
+        /**
+         * Get the aggregate of the control qubits registered for propagation in the currently active control qubit propagation scopes.
+         * @return The control qubits added to any quantum operation created by any of the addOperationsImplementingXGate functions.
+         */
+        [[nodiscard]] const std::unordered_set<qc::Qubit>& getAggregateOfPropagatedControlQubits() const noexcept;
+
+        /**
+         * Get the control qubits, together with their polarity, registered for propagation in the currently active control qubit propagation scopes.
+         * @return The control qubits added to any quantum operation created by any of the addOperationsImplementingXGate functions.
+         */
+        [[nodiscard]] const qc::Controls& getPropagatedControlQubits() const noexcept;
 
         /**
          * Register or update a global quantum operation annotation. Global quantum operation annotations are added to all quantum operations added to the internally used qc::QuantumComputation.
@@ -284,12 +774,40 @@ namespace syrec {
          */
         [[maybe_unused]] bool removeGlobalQuantumOperationAnnotation(const std::string_view& key);
 
+        /**
+         * Get the value of a global quantum operation annotation.
+         * @param key The key of the global quantum operation annotation.
+         * @return The value of the global quantum operation annotation if the generation of quantum gate annotations is enabled and an annotation with the given key exists, otherwise std::nullopt.
+         */
+        [[nodiscard]] std::optional<std::string> getGlobalQuantumOperationAnnotation(const std::string_view& key) const;
+
+        /**
+         * Register or update the global statement line number which is assigned to all quantum operations added to the internally used qc::QuantumComputation.
+         * Already existing quantum computations in the qc::QuantumComputation are not modified.
+         * @param statementLineNumber The line number of the statement whose synthesis generates the next quantum operations.
+         * @return If the generation of quantum gate annotations is enabled, returns whether an existing global statement line number was updated. Otherwise, false is returned.
+         * @remark Contrary to setOrUpdateGlobalQuantumOperationAnnotation(..), neither a string needs to be created nor a new set of annotations of the quantum operations is determined per statement line number.
+         */
+        [[maybe_unused]] bool setOrUpdateGlobalStatementLineNumber(unsigned statementLineNumber);
+
+        /**
+         * Remove the global statement line number. Existing statement line numbers of the gates of the circuit are not modified.
+         * @return If the generation of quantum gate annotations is enabled, returns whether a global statement line number was removed. Otherwise, false is returned.
+         */
+        [[maybe_unused]] bool removeGlobalStatementLineNumber();
+
+        /**
+         * Get the global statement line number.
+         * @return The global statement line number if the generation of quantum gate annotations is enabled and a global statement line number was set, otherwise std::nullopt.
+         */
+        [[nodiscard]] std::optional<unsigned> getGlobalStatementLineNumber() const;
+
         /**
          * Set a key value annotation for a quantum operation.
          * @param indexOfQuantumOperationInQuantumComputation The index of the quantum operation in the quantum computation.
          * @param annotationKey The key of the quantum operation annotation.
          * @param annotationValue The value of the quantum operation annotation.
-         * @return If the generation of quantum gate annotations is enabled, returns whether an operation at the user-provided index existed in the quantum computation. Otherwise, false is returned.
+         * @return If the generation of quantum gate annotations is enabled, returns whether an operation at the user-provided index existed in the quantum computation and was not yet forwarded to a quantum operation sink. Otherwise, false is returned.
          * @remark The generation of quantum gate annotations needs to be explicitly be enabled in the constructor of the annotatable quantum computation.
          */
         [[maybe_unused]] bool setOrUpdateAnnotationOfQuantumOperation(std::size_t indexOfQuantumOperationInQuantumComputation, const std::string_view& annotationKey, const std::string& annotationValue);
@@ -314,6 +832,68 @@ namespace syrec {
         [[maybe_unused]] bool annotateAllQuantumOperationsAtPositions(std::size_t fromQuantumOperationIndex, std::size_t toQuantumOperationIndex, const QuantumOperationAnnotationsLookup& userProvidedAnnotationsPerQuantumOperation);
         [[nodiscard]] bool    isQubitWithinRange(qc::Qubit qubit) const noexcept;
 
+        /**
+         * Determine the position of a quantum operation in the retained quantum operations of the quantum computation.
+         * @param indexOfQuantumOperationInQuantumComputation The index of the quantum operation in the quantum computation.
+         * @return The position of the quantum operation in the retained quantum operations, std::nullopt if the quantum operation was already forwarded to the quantum operation sink.
+         */
+        [[nodiscard]] std::optional<std::size_t> determinePositionOfRetainedQuantumOperation(std::size_t indexOfQuantumOperationInQuantumComputation) const noexcept;
+
+        /**
+         * Determine the annotations of a retained quantum operation including the annotation storing its statement line number.
+         * @param position The position of the quantum operation in the retained quantum operations.
+         * @return The annotations of the quantum operation.
+         */
+        [[nodiscard]] QuantumOperationAnnotationsLookup determineAnnotationsOfRetainedQuantumOperation(std::size_t position) const;
+
+        /**
+         * Forward the oldest retained quantum operations to the quantum operation sink if more than twice the requested number of retained quantum operations are retained, thus the quantum operations are forwarded in batches.
+         * @return Whether no quantum operation had to be forwarded or whether the quantum operation sink could consume all forwarded quantum operations.
+         */
+        [[nodiscard]] bool forwardQuantumOperationsNotInReplayWindowToSink();
+
+        /**
+         * Forward a number of the oldest retained quantum operations together with their annotations to the quantum operation sink and remove them from the quantum computation.
+         * @param numQuantumOperationsToForward The number of quantum operations to forward.
+         * @return Whether the quantum operation sink could consume all forwarded quantum operations.
+         */
+        [[nodiscard]] bool forwardOldestRetainedQuantumOperationsToSink(std::size_t numQuantumOperationsToForward);
+
+        /**
+         * Add a copy of a standard operation, whose qubits were remapped, to the quantum computation without annotating the copy.
+         * @param quantumOperation The quantum operation to copy.
+         * @param qubitIndexRangeMappings The mappings defining the qubit used in the copy for a qubit of the copied quantum operation. Qubits not covered by any mapping are not remapped.
+         * @return Whether the copied quantum operation was a standard operation and whether all remapped qubits were within the range of qubits of the quantum computation.
+         */
+        [[nodiscard]] bool addCopyOfQuantumOperationWithRemappedQubits(const qc::Operation* quantumOperation, const std::vector<QubitIndexRangeMapping>& qubitIndexRangeMappings);
+
+        /**
+         * Add the synthesis cost of all retained quantum operations starting at a given position to the recorded synthesis cost of the retained quantum operations.
+         * @param positionOfFirstAddedQuantumOperation The position of the first added quantum operation in the retained quantum operations.
+         * @remark Should be called after the added quantum operations were annotated since the statement line number annotation determines the statement to which the synthesis cost is attributed.
+         */
+        void recordSynthesisCostOfAddedQuantumOperations(std::size_t positionOfFirstAddedQuantumOperation);
+
+        /**
+         * Reserve the storage for a number of quantum operations that will be added to the retained quantum operations, with the capacity being at least doubled if it is increased to not degrade the amortized cost of frequent reservations for few quantum operations.
+         * @param numQuantumOperationsToAdd The number of quantum operations that will be added.
+         */
+        void reserveStorageForAddedQuantumOperations(std::size_t numQuantumOperationsToAdd);
+
+        /**
+         * Annotate the quantum operations added starting at a given position with the active global quantum operation annotations, record their synthesis cost and forward the quantum operations not in the replay window to the quantum operation sink.
+         * @param positionOfFirstAddedQuantumOperation The position of the first added quantum operation in the retained quantum operations.
+         * @return Whether any quantum operation was added, whether the added quantum operations could be annotated and whether the forwarding of the quantum operations to the sink was successful.
+         */
+        [[nodiscard]] bool finalizeAddedQuantumOperations(std::size_t positionOfFirstAddedQuantumOperation);
+
+        /**
+         * Add or remove the synthesis cost of a retained quantum operation to/from the recorded synthesis cost of the retained quantum operations.
+         * @param position The position of the quantum operation in the retained quantum operations.
+         * @param wasQuantumOperationAdded Whether the quantum operation was added or is about to be removed.
+         */
+        void updateRecordedSynthesisCostOfQuantumOperation(std::size_t position, bool wasQuantumOperationAdded);
+
         /**
          * Check whether a qubit index range is the immediate successor for the covered qubit index range of the last added quantum register.
          * @param toBeCheckedQubitIndexRange The qubit index range to check.
@@ -321,16 +901,60 @@ namespace syrec {
          */
         [[nodiscard]] bool isQubitIndexRangeImmediateSuccessorOfCoveredRangeOfLastAddedQuantumRegister(const QubitIndexRange& toBeCheckedQubitIndexRange) const noexcept;
 
-        std::unordered_set<qc::Qubit>                    aggregateOfPropagatedControlQubits;
-        std::vector<std::unordered_map<qc::Qubit, bool>> controlQubitPropagationScopes;
-        bool                                             canQubitsBeAddedToQuantumComputation = true;
-        bool                                             generateQuantumOperationAnnotations  = false;
+        /**
+         * Remove a control qubit temporarily added to the propagated control qubits for the creation of a quantum operation, control qubits registered for propagation are not removed.
+         * @param gateLocalControlQubit The control qubit of the created quantum operation.
+         */
+        void removeGateLocalControlQubitFromPropagatedOnes(const qc::Control& gateLocalControlQubit);
+
+        /**
+         * Determine the polarity with which a control qubit is propagated.
+         * @param controlQubit The control qubit.
+         * @return The polarity of the propagated control qubit, std::nullopt if the control qubit is not propagated.
+         */
+        [[nodiscard]] std::optional<qc::Control::Type> getPolarityOfPropagatedControlQubit(qc::Qubit controlQubit) const;
+
+        /**
+         * Remove a propagated control qubit, regardless of its polarity, from the aggregate of the propagated control qubits.
+         * @param controlQubit The control qubit to remove.
+         */
+        void removeControlQubitFromPropagatedOnes(qc::Qubit controlQubit);
+
+        std::unordered_set<qc::Qubit> aggregateOfPropagatedControlQubits;
+        // The subset of the propagated control qubits with a negative polarity.
+        std::unordered_set<qc::Qubit> negativePropagatedControlQubits;
+        // The aggregate of the propagated control qubits as ordered controls kept in sync with the former, which can then be passed to all created quantum operations without creating new controls per quantum operation.
+        qc::Controls propagatedControlQubits;
+        // The polarity of the control qubits registered in a propagation scope in the parent scope, std::nullopt if a control qubit was not propagated by the parent scope.
+        std::vector<std::unordered_map<qc::Qubit, std::optional<qc::Control::Type>>> controlQubitPropagationScopes;
+        bool                                                                          canQubitsBeAddedToQuantumComputation = true;
+        bool                                                                          generateQuantumOperationAnnotations  = false;
 
         QuantumOperationAnnotationsLookup activateGlobalQuantumOperationAnnotations;
+        std::optional<unsigned>           activeGlobalStatementLineNumber;
+
+        QuantumOperationSink::ptr quantumOperationSink;
+        std::size_t               numRetainedQuantumOperationsInReplayWindow = 0;
+        std::size_t               numForwardedQuantumOperations              = 0;
+
+        // We are assuming that no operations in the qc::QuantumComputation are removed (i.e. by applying qc::CircuitOptimizer), except when cancelling adjacent self-inverse quantum operations or forwarding quantum operations to a sink which also removes the
+        // annotations of the removed operations, and will thus use the position of the quantum operation in the retained quantum operations as the search key in the container storing the annotations per quantum operation.
+        QuantumOperationAnnotationsTable annotationsPerQuantumOperation;
 
-        // We are assuming that no operations in the qc::QuantumComputation are removed (i.e. by applying qc::CircuitOptimizer) and will thus use the index of the quantum operation
-        // as the search key in the container storing the annotations per quantum operation.
-        std::vector<QuantumOperationAnnotationsLookup> annotationsPerQuantumOperation;
+        /**
+         * The synthesis cost of a set of quantum operations whose quantum cost is only determined on demand since it depends on the number of qubits of the quantum computation.
+         */
+        struct RecordedSynthesisCost {
+            /**
+             * The number of quantum operations per number of control qubits with the additional control qubit required to implement a SWAP gate being included in the latter.
+             */
+            std::map<std::size_t, std::size_t> numQuantumOperationsPerNumControlQubits;
+            SynthesisCostMetricValue           transistorCost = 0;
+
+            [[nodiscard]] SynthesisCostMetricValue determineQuantumCost(std::size_t numQubits) const;
+        };
+        RecordedSynthesisCost                      recordedSynthesisCostOfRetainedQuantumOperations;
+        std::map<unsigned, RecordedSynthesisCost> recordedSynthesisCostPerStatementLineNumber;
 
         /**
          * A container to store layout information for a quantum register.
@@ -378,6 +1002,21 @@ namespace syrec {
              */
             [[nodiscard]] virtual std::optional<QubitInVariableLayoutData> determineQubitInVariableLayoutData(qc::Qubit qubit) const = 0;
 
+            /**
+             * Append the access of the element storing a given qubit in the variable layout of the quantum register as well as the relative index of the qubit in said element (e.g. [0][1].1) to a buffer.
+             * @param qubit The qubit whose access should be appended.
+             * @param qubitLabel The buffer to which the access is appended. Not modified if the access could not be determined.
+             * @return Whether the access of the qubit could be determined.
+             */
+            [[nodiscard]] virtual bool appendAccessOfQubitInVariableLayout(qc::Qubit qubit, std::string& qubitLabel) const = 0;
+
+            /**
+             * Find the inline qubit information of a given qubit in the variable layout of the quantum register without copying it.
+             * @param qubit The qubit whose inline qubit information should be determined.
+             * @return A pointer to the inline qubit information of the qubit, otherwise nullptr.
+             */
+            [[nodiscard]] virtual const InlinedQubitInformation* findInlinedQubitInformation(qc::Qubit qubit) const = 0;
+
             /**
              * Determine the number of qubits of the quantum register.
              * @return The number of qubits stored in the quantum register
@@ -398,6 +1037,8 @@ namespace syrec {
              * @return Information about the qubit in the variable layout of the quantum register, otherwise std::nullopt.
              */
             [[nodiscard]] std::optional<QubitInVariableLayoutData> determineQubitInVariableLayoutData(qc::Qubit qubit) const override;
+            [[nodiscard]] bool                                     appendAccessOfQubitInVariableLayout(qc::Qubit qubit, std::string& qubitLabel) const override;
+            [[nodiscard]] const InlinedQubitInformation*           findInlinedQubitInformation(qc::Qubit qubit) const override;
 
             /**
              * Determine the required accessed value per dimension in the variable layout to access the element in the syrec::Variable that contains the \p qubit.
@@ -432,6 +1073,8 @@ namespace syrec {
              * @return Information about the qubit in the variable layout of the quantum register, otherwise std::nullopt.
              */
             [[nodiscard]] std::optional<QubitInVariableLayoutData> determineQubitInVariableLayoutData(qc::Qubit qubit) const override;
+            [[nodiscard]] bool                                     appendAccessOfQubitInVariableLayout(qc::Qubit qubit, std::string& qubitLabel) const override;
+            [[nodiscard]] const InlinedQubitInformation*           findInlinedQubitInformation(qc::Qubit qubit) const override;
 
             /**
              * Append a qubit index range to the ancillary quantum register
@@ -465,25 +1108,50 @@ namespace syrec {
         };
 
         /**
-         * Determine which quantum register in the quantum computation contains the given qubit.
+         * Determine which quantum register in the quantum computation contains the given qubit in constant time.
          * @param qubit The qubit whose associated quantum register shall be determined.
          * @return The index of the quantum register containing the qubit, std::nullopt if no such quantum register is found.
          */
         [[nodiscard]] std::optional<std::size_t> determineIndexOfQuantumRegisterStoringQubit(qc::Qubit qubit) const;
 
         /**
-         * Build the label of a qubit in the format of a stringified syrec::VariableAccess.
-         * @param quantumRegisterLabel The label of the quantum register storing the qubit.
-         * @param accessedValuePerDimension The required value per dimension to access the qubit in the associated quantum registers variable layout.
-         * @param relativeQubitIndexInElement The relative index in the element containing the qubit in the associated quantum register variable layout (the element is assumed to be accessed using the \p accessedValuePerDimension dimension access).
-         * @return The build qubit label (e.g. a[0][2].2)
+         * Determine the qubit by which a qubit of the quantum computation is referenced in the quantum register variable layouts.
+         * @param qubit The qubit of the quantum computation.
+         * @return The qubit in the quantum register variable layouts, which only differs from \p qubit if the qubits were permuted via AnnotatableQuantumComputation::permuteQubits(...).
          */
-        [[nodiscard]] static std::string buildQubitLabelForQubitOfVariableInQuantumRegister(const std::string& quantumRegisterLabel, const std::vector<unsigned>& accessedValuePerDimension, std::size_t relativeQubitIndexInElement);
+        [[nodiscard]] qc::Qubit determineQubitInVariableLayouts(qc::Qubit qubit) const noexcept;
+
+        /**
+         * Replace the quantum registers of the base quantum computation by the maximal ranges of the qubits of every quantum register variable layout that are stored in consecutive qubits of the quantum computation.
+         */
+        void splitQuantumRegistersOfPermutedQubits();
+
+        /**
+         * Append the label of a qubit in the format of a stringified syrec::VariableAccess to a buffer.
+         * @param quantumRegisterVariableLayout The variable layout of the quantum register storing the qubit.
+         * @param qubit The qubit whose label shall be determined.
+         * @param qubitLabelType The type of qubit label to generate. Can either be the internal or user declared one.
+         * @param qubitLabel The buffer to which the label of the qubit is appended (e.g. a[0][2].2). Not modified if the label could not be determined.
+         * @return Whether the label of the qubit could be determined.
+         */
+        [[nodiscard]] static bool appendQubitLabelOfQubitInQuantumRegister(const BaseQuantumRegisterVariableLayout& quantumRegisterVariableLayout, qc::Qubit qubit, QubitLabelType qubitLabelType, std::string& qubitLabel);
 
         /**
          * An ordered collection storing the variable layout stored in each quantum register.
          * Said quantum registers are assumed to be sorted according to the index of their first qubit in the quantum computation in ascending order. Additionally, no gaps are allowed to exist between the stored qubits of the quantum registers.
          */
         std::vector<std::unique_ptr<BaseQuantumRegisterVariableLayout>> quantumRegisterAssociatedVariableLayouts;
+
+        /**
+         * The index of the variable layout in syrec::AnnotatableQuantumComputation::quantumRegisterAssociatedVariableLayouts storing a qubit with the qubit being used as the index in the collection.
+         * The collection is extended whenever qubits are added to a quantum register and allows the determination of the quantum register storing a qubit in constant time.
+         */
+        std::vector<std::size_t> indexOfVariableLayoutPerQubit;
+
+        /**
+         * The qubit by which a qubit of the quantum computation is referenced in the quantum register variable layouts, with the qubit of the quantum computation being used as the index in the collection.
+         * The collection is empty unless the qubits were permuted via AnnotatableQuantumComputation::permuteQubits(...), since the qubits of the variable layouts are otherwise equal to the ones of the quantum computation.
+         */
+        std::vector<qc::Qubit> qubitInVariableLayoutsPerQubit;
     };
 } // namespace syrec
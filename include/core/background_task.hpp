@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/diagnostics.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace syrec {
+    /**
+     * @brief Execute a unit of work on a separate thread whose progress can be queried and which can be cancelled.
+     *
+     * The work is started on construction of the task and reports its progress via reportProgress(...). Since the work can only be aborted at the points at which it checks whether its cancellation was requested (see isCancellationRequested()),
+     * a requested cancellation only takes effect once the work reaches the next of these points. The errors reported by the work via syrec::getErrorStream() are collected in the diagnostics of the task.
+     *
+     * Objects accessed by the work must outlive the task, with the destructor of the task requesting the cancellation of the work and waiting for its termination. An object owning both the task and the objects accessed by the work
+     * should thus declare the task as its last member.
+     */
+    class BackgroundTask {
+    public:
+        enum class State : std::uint8_t {
+            Running,
+            Succeeded,
+            Failed,
+            Cancelled
+        };
+
+        /**
+         * The work returns whether it was performed successfully, an unsuccessful work whose cancellation was requested is considered to be cancelled instead of failed.
+         */
+        using Work = std::function<bool(BackgroundTask&)>;
+
+        explicit BackgroundTask(Work work);
+        ~BackgroundTask();
+
+        BackgroundTask(const BackgroundTask&)            = delete;
+        BackgroundTask(BackgroundTask&&)                 = delete;
+        BackgroundTask& operator=(const BackgroundTask&) = delete;
+        BackgroundTask& operator=(BackgroundTask&&)      = delete;
+
+        void requestCancellation() noexcept {
+            cancellationRequested.store(true, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] bool isCancellationRequested() const noexcept {
+            return cancellationRequested.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Report the progress of the work, which is expected to be called by the work itself.
+         * @param numProcessedWorkItems The number of already processed work items.
+         * @param numWorkItems The total number of work items.
+         */
+        void reportProgress(std::size_t numProcessedWorkItems, std::size_t numWorkItems) noexcept;
+
+        [[nodiscard]] std::size_t getNumProcessedWorkItems() const noexcept {
+            return numProcessedWorkItems.load(std::memory_order_acquire);
+        }
+
+        [[nodiscard]] std::size_t getNumWorkItems() const noexcept {
+            return numWorkItems.load(std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] State getState() const noexcept {
+            return state.load(std::memory_order_acquire);
+        }
+
+        [[nodiscard]] bool isFinished() const noexcept {
+            return getState() != State::Running;
+        }
+
+        /**
+         * @brief Wait for the termination of the work.
+         * @param optionalTimeout The maximum duration to wait, the caller is blocked until the work terminated if no timeout is defined.
+         * @return Whether the work terminated within the timeout.
+         */
+        [[nodiscard]] bool wait(const std::optional<std::chrono::milliseconds>& optionalTimeout = std::nullopt) const;
+
+        /**
+         * @brief Get the errors reported by the work.
+         * @return The reported errors, which are only available once the work terminated (an empty collection is returned while the work is running).
+         */
+        [[nodiscard]] std::vector<std::string> getErrorMessages() const;
+
+    protected:
+        Work                            work;
+        std::atomic_bool                cancellationRequested = false;
+        std::atomic<std::size_t>        numProcessedWorkItems = 0;
+        std::atomic<std::size_t>        numWorkItems          = 0;
+        std::atomic<State>              state                 = State::Running;
+        Diagnostics                     diagnostics;
+        mutable std::mutex              terminationMutex;
+        mutable std::condition_variable terminationCondition;
+        // The worker thread is started last, after all other members were initialized.
+        std::thread worker;
+
+        void execute();
+    };
+} // namespace syrec
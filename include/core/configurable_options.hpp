@@ -10,12 +10,86 @@
 
 #pragma once
 
+#include "core/execution_limits.hpp"
+#include "core/progress_reporting.hpp"
 #include "core/syrec/parser/utils/syrec_operation_utils.hpp"
 
+#include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <string>
+#include <vector>
 
 namespace syrec {
+    /**
+     * The architecture of the circuit synthesizing the in-place addition of two operands (which is also used to synthesize subtractions, multiplications, divisions and comparisons).
+     */
+    enum class AdderArchitecture : std::uint8_t {
+        /**
+         * The ripple-carry adder defined in "Quantum Addition Circuits and Unbounded Fan-Out" (arXiv:0910.2530) requiring no ancillary qubits and whose depth is linear in the bitwidth of the operands.
+         */
+        RippleCarry,
+        /**
+         * The ripple-carry adder defined in "A new quantum ripple-carry addition circuit" (arXiv:quant-ph/0410184) requiring one ancillary qubit and whose depth is linear in the bitwidth of the operands.
+         */
+        Cuccaro,
+        /**
+         * The carry-lookahead adder defined in "A logarithmic-depth quantum carry-lookahead adder" (arXiv:quant-ph/0406142) whose depth is logarithmic in the bitwidth N of the operands while requiring less than 2 * N ancillary qubits.
+         */
+        CarryLookahead
+    };
+
+    /**
+     * The architecture of the circuit synthesizing the multiplication of two operands of which only the least significant bits fitting into the bitwidth of the operands are computed.
+     */
+    enum class MultiplierArchitecture : std::uint8_t {
+        /**
+         * Add the right hand side operand, shifted by i bits, to the product using an adder whose quantum operations are all controlled by the i-th bit of the left hand side operand.
+         */
+        ControlledAdditions,
+        /**
+         * Compute the partial product of the i-th bit of the left hand side operand and the right hand side operand into ancillary qubits, add it to the product using an uncontrolled adder and uncompute it again.
+         * Replaces the additionally controlled quantum operations of every adder by two Toffoli gates per bit of the partial product at the cost of N - 1 ancillary qubits (with N being the bitwidth of the product) reused for every partial product.
+         */
+        PartialProducts
+    };
+
+    /**
+     * The architecture of the circuit synthesizing the quotient and remainder of the division of two unsigned operands.
+     */
+    enum class DividerArchitecture : std::uint8_t {
+        /**
+         * The restoring division defined in "Quantum Circuit Designs of Integer Division Optimizing T-count and T-depth" (arXiv:1809.09732) performing a subtraction of the divisor and a controlled addition of the divisor, restoring a negative partial remainder, per bit of the quotient.
+         */
+        Restoring,
+        /**
+         * The non-restoring division defined in the same paper performing either an addition or a subtraction of the divisor, selected by the sign of the previous partial remainder, per bit of the quotient using an uncontrolled adder
+         * and a single controlled addition of the divisor restoring a negative final remainder.
+         */
+        NonRestoring
+    };
+
+    /**
+     * The strategy determining when the ancillary qubits used by the expression on the right-hand side of an assignment are reset, by replaying the quantum operations synthesized for the expression in reverse order, and released to the pool of reusable ancillary qubits.
+     *
+     * An uncomputation is skipped (leaving the ancillary qubits of the expression as garbage) if a later quantum operation targeted any of the other qubits used by the expression, deferring an uncomputation thus saves quantum operations at the risk of requiring more qubits.
+     */
+    enum class AncillaryQubitUncomputationStrategy : std::uint8_t {
+        /**
+         * Uncompute the expression directly after the synthesis of the assignment.
+         */
+        Eager,
+        /**
+         * Defer the uncomputation of the expression until the synthesis of the right-hand side of a later assignment would otherwise have to create new ancillary qubits, the expressions that were not uncomputed at the end of the synthesis are not uncomputed at all.
+         */
+        Lazy,
+        /**
+         * Defer the uncomputation of the expression similar to Lazy but keep at most ConfigurableOptions::maxNumDeferredExpressionUncomputations expressions computed at once (comparable to the number of pebbles in Bennett's pebble game),
+         * uncomputing the oldest computed expression when the limit is exceeded.
+         */
+        Bennett
+    };
+
     struct ConfigurableOptions {
         /**
          * @brief Defines the default variable bitwidth used by the SyReC parser for variables whose bitwidth specification was omitted.
@@ -58,6 +132,33 @@ namespace syrec {
          */
         bool allowAccessOnAssignedToVariablePartsInDimensionAccessOfVariableAccess = false;
 
+        /**
+         * Should the nodes of the IR generated by the SyReC parser for a program (i.e. expressions, statements, numbers, variables and variable accesses) be allocated in a shared arena that is released together with the program, enabled by default.
+         */
+        bool allocateIrNodesInArena = true;
+
+        /**
+         * The maximum number of errors reported by the SyReC parser, with the number of all further errors being reported instead of the errors themselves. Identical errors reported at the same position of the program are only reported once.
+         * Note that the errors are limited in the order in which they are found, which does not necessarily match the order of their positions in the program. All errors are reported by default.
+         */
+        std::optional<std::size_t> optionalMaxNumReportedParserErrors;
+
+        /**
+         * Should the module declarations of an ASCII encoded SyReC program consisting of multiple modules be parsed and semantically checked concurrently by up to ConfigurableOptions::maxNumThreads threads, disabled by default.
+         * The declarations are split into contiguous parts by only lexing the program with the overload resolution of all call-/uncall statements being performed once all parts were parsed. The parsed program is identical to the one of a
+         * sequential parse, which is performed instead (and reports the errors in the same order as before) if any part contains an error or requires full-context predictions or if the joined parts contain duplicate or invalid module declarations or calls.
+         * The parsing runtime recorded in the syrec::Statistics then covers the concurrent parse of the parts and the semantic check runtime the join of the latter.
+         */
+        bool parseModuleDeclarationsConcurrently = false;
+
+        /**
+         * Should the SyReC parser only perform the semantic checks of and generate the IR for the modules reachable via call-/uncall statements from the program entry point (see ConfigurableOptions::optionalProgramEntryPointModuleIdentifier),
+         * disabled by default. The reachable modules are determined from the parse tree of the program with all overloads of a called module identifier being considered reachable. All other modules are only validated syntactically and
+         * are not part of the parsed program, thus semantic errors in the latter are not reported. If the program entry point cannot be determined, all modules are checked. Programs are never parsed concurrently (see ConfigurableOptions::parseModuleDeclarationsConcurrently)
+         * or incrementally (see syrec::IncrementalProgramReader) if this option is enabled.
+         */
+        bool pruneModulesNotReachableFromProgramEntryPoint = false;
+
         /**
          * Should debug information for the local variables of a SyReC module be generated (e.g. call stack and associated original variable identifier, etc.) in the annotatable quantum computation during synthesis. Is not recorded by default.
          */
@@ -68,6 +169,279 @@ namespace syrec {
          */
         bool generateQuantumOperationAnnotations = false;
 
+        /**
+         * Should the quantum operations synthesized for the body of a called/uncalled SyReC module be reused, by remapping their qubits, for any further call/uncall of the same module in the same context instead of synthesizing the statements of the module again, enabled by default.
+         * An uncall (call) mirroring a previous call (uncall) of the same module on the same caller arguments and with the same propagated control qubits replays the quantum operations of the latter in reverse order if no qubits were created during its synthesis.
+         */
+        bool reuseSynthesizedModuleCalls = true;
+
+        /**
+         * Should the quantum operations synthesized for the first iterations of a loop be replayed, by shifting their qubits, for the remaining iterations of the loop instead of synthesizing the loop body again, if the loop variable is only used as an affine offset in the indices of the variable accesses of the loop body. Enabled by default.
+         */
+        bool replaySynthesizedLoopIterations = true;
+
+        /**
+         * Should the qubits storing the synthesized result of an expression be reused as the result of any structurally identical expression synthesized later on, as long as none of the variables accessed by the expression were modified in the meantime, instead of synthesizing the latter expression again.
+         * Only supported by the cost aware synthesis and disabled by default.
+         */
+        bool shareSynthesizedCommonSubexpressions = false;
+
+        /**
+         * Should the ancillary qubits used by the expression on the right-hand side of an assignment be reset, by replaying the quantum operations synthesized for the expression in reverse order, and reused as ancillary qubits by later statements instead of always generating new ancillary qubits.
+         * Only supported by the cost aware synthesis, ignored if inlined qubit debug information shall be generated and disabled by default.
+         */
+        bool reuseAncillaryQubitsAcrossStatements = false;
+
+        /**
+         * The strategy determining when the ancillary qubits of the expression on the right-hand side of an assignment are reset and reused if ConfigurableOptions::reuseAncillaryQubitsAcrossStatements is enabled, defaults to the eager uncomputation of every expression.
+         */
+        AncillaryQubitUncomputationStrategy ancillaryQubitUncomputationStrategy = AncillaryQubitUncomputationStrategy::Eager;
+
+        /**
+         * The maximum number of computed expressions whose uncomputation is deferred at once when using the AncillaryQubitUncomputationStrategy::Bennett.
+         */
+        std::size_t maxNumDeferredExpressionUncomputations = 2;
+
+        /**
+         * The maximum number of qubits of the quantum computation synthesized by the hybrid synthesis, which selects for every AssignStatement whether it is synthesized like in the cost aware synthesis (storing the results of subexpressions
+         * in ancillary qubits) or like in the line aware synthesis (computing subexpressions in the qubits of their operands and reverting them afterwards). An assignment is only synthesized like in the cost aware synthesis if the latter is
+         * estimated to require fewer quantum operations and the estimated number of its ancillary qubits does not exceed the remaining budget. The budget is not enforced if an assignment cannot be synthesized like in the line aware synthesis.
+         * Only used by the hybrid synthesis, no budget is defined by default.
+         */
+        std::optional<std::size_t> qubitBudgetOfHybridSynthesis;
+
+        /**
+         * The architecture of the adder used during the synthesis of a SyReC program, defaults to the ripple-carry adder requiring no ancillary qubits.
+         */
+        AdderArchitecture adderArchitecture = AdderArchitecture::RippleCarry;
+
+        /**
+         * The architecture of the multiplier used during the synthesis of a SyReC program, defaults to the multiplier using controlled additions that requires no ancillary qubits besides the ones of the adder.
+         */
+        MultiplierArchitecture multiplierArchitecture = MultiplierArchitecture::ControlledAdditions;
+
+        /**
+         * The architecture of the divider used during the synthesis of a SyReC program, defaults to the restoring divider.
+         */
+        DividerArchitecture dividerArchitecture = DividerArchitecture::Restoring;
+
+        /**
+         * Should the quotient and remainder of a division of the same operands (e.g. 'a / b' and 'a % b') used in the same statement be computed by a single divider instead of synthesizing one divider for every operation.
+         * Only supported by the cost aware synthesis and disabled by default.
+         */
+        bool shareDividerOfQuotientAndRemainder = false;
+
+        /**
+         * Should all relational operations of the same operands (e.g. 'a < b' and 'a = b') used in the same statement determine their result from a single comparator instead of synthesizing one comparison circuit for every operation.
+         * The comparator computes whether the lhs operand is less than and equal to the rhs operand using a single subtractor. Only supported by the cost aware synthesis and disabled by default.
+         */
+        bool shareComparatorOfRelationalOperations = false;
+
+        /**
+         * Should the addition/subtraction of an integer constant in an assignment (e.g. 'a += 5') be synthesized by a sequence of increments/decrements of the assigned to qubits, determined by the non-adjacent form of the constant, instead of
+         * storing the constant in ancillary qubits and adding the latter to the assigned to qubits. Requires no ancillary qubits at the cost of multi-controlled quantum operations. Disabled by default.
+         */
+        bool addConstantsWithoutAncillaryQubits = false;
+
+        /**
+         * Should a multiplication or relational operation with an operand that is an integer constant be synthesized by a circuit specialized for the value of the constant instead of storing the constant in ancillary qubits.
+         * A multiplication with a constant is synthesized by adding/subtracting shifted copies of the other operand for every non-zero digit in the canonical signed digit representation of the constant, a comparison with a constant by one
+         * multi-controlled X gate per bit of the constant at which the comparison can be decided and a check for equality with a constant by a single multi-controlled X gate. Also applies to the multiplications used to calculate the index of
+         * an accessed element in a variable access with indices that are not evaluable at compile time. Disabled by default.
+         */
+        bool specializeOperationsWithConstantOperand = false;
+
+        /**
+         * Should a shift by a compile time constant (e.g. 'a << 2') be synthesized by relabeling the qubits of the shifted operand, padded with zero-initialized ancillary qubits for the shifted-in bits, instead of copying the shifted qubits to
+         * ancillary qubits. No quantum operations are synthesized for such a shift since the result is only read by the enclosing expression or statement and the shifted operand is copied only if it shares qubits with the other operand of a binary
+         * expression. Only supported by the cost aware synthesis and disabled by default.
+         */
+        bool synthesizeShiftsByRelabelingQubits = false;
+
+        /**
+         * Should an unconditional SwapStatement of the main module (i.e. a SwapStatement that is neither defined in the branch of an IfStatement nor in the body of a loop) whose operands access all qubits of two variables of the same type and bitwidth
+         * (e.g. 'a <=> b') be synthesized by swapping the qubits associated with the two variables instead of synthesizing SWAP gates. The final association of the qubits of the variables of the main module is recorded as the output permutation
+         * of the synthesized quantum computation. Disabled by default.
+         */
+        bool trackUnconditionalSwapsAsQubitPermutation = false;
+
+        /**
+         * Should negations only used as control qubits be folded into negative control qubits of the consuming quantum operations instead of synthesizing X gates. The result of a bitwise or logical negation is copied to its ancillary qubits by
+         * quantum operations with a negative control qubit and the statements of the else branch of an IfStatement are controlled by the negative guard expression qubit instead of toggling the latter prior to and after said statements.
+         * Disabled by default.
+         */
+        bool foldNegationsIntoNegativeControls = false;
+
+        /**
+         * Should the binary operations of an expression whose operands and result are known to fit into fewer bits than their bitwidth (e.g. the sum '(a & 3) + (b & 3)' that fits into three bits) only be synthesized for the least significant
+         * bits of their operands. The required bits are determined by a value range analysis of the expression, with the omitted bits of the ancillary qubits storing the result remaining zero. An operation whose result is known at compile time
+         * is synthesized by initializing its ancillary qubits to said value. The additions, subtractions and XOR operations synthesized in the qubits of their operands by the line aware synthesis are not narrowed. Disabled by default.
+         */
+        bool narrowOperationsUsingValueRangeAnalysis = false;
+
+        /**
+         * Should the element selected by an index of a variable access that is not evaluable at compile time be determined by a unary iteration tree, branching on one bit of the index per level and requiring one ancillary qubit per bit, instead of comparing the index with the index of every element of the variable.
+         * The former only synthesizes a constant number of quantum operations per element of the variable while the latter requires a number of quantum operations per element that grows with the number of bits of the index. Disabled by default.
+         */
+        bool decodeNonConstantIndicesUsingUnaryIteration = false;
+
+        /**
+         * Should the unrolled index of the variable accesses of an AssignStatement, SwapStatement or UnaryStatement using structurally identical indices not evaluable at compile time on variables with the same dimensions (e.g. 'a[i] += b[i]' or 'x[i] <=> y[i]')
+         * only be calculated once and decoded into one ancillary qubit per element of the accessed variables, set only for the selected element, instead of calculating and comparing the index with the index of every element for every access.
+         * The decoded qubits are used as the control qubits of the transfer of the selected element of every such access and are reset after the synthesis of the statement if the uncomputation of expressions is not deferred.
+         * Takes precedence over decodeNonConstantIndicesUsingUnaryIteration, only supported by the cost aware synthesis and disabled by default.
+         */
+        bool shareIndexDecodingOfNonConstantIndices = false;
+
+        /**
+         * Should the unrolled index of a variable access with indices not evaluable at compile time be calculated as if every dimension of the accessed variable was padded to the next power of two, i.e. by concatenating the copied indices of the
+         * dimensions (e.g. the unrolled index of 'a[i][j]' in 'a[3][5]' consists of the two bits of 'i' followed by the three bits of 'j') instead of multiplying the index of every dimension with the number of elements per value of the dimension
+         * and adding the products. Only the address space of the unrolled index is padded while no qubits are created for the padding elements, which do not select any element of the accessed variable. Trades a larger number of qubits storing
+         * the unrolled index for the omitted multiplications and additions. Disabled by default.
+         */
+        bool padDimensionsOfUnrolledIndicesToPowersOfTwo = false;
+
+        /**
+         * Should the qubit of the variable accessed by the guard expression of an IfStatement (e.g. 'if a.0 then ... fi a.0') be used as the control qubit of the statements of both branches instead of copying its value to an ancillary qubit
+         * if none of said statements (including nested statements and the arguments of called/uncalled modules) accesses any variable of the guard expression. Disabled by default.
+         */
+        bool reuseQubitOfGuardVariableNotAccessedInBranches = false;
+
+        /**
+         * Should the guards of nested IfStatements be combined, by computing the conjunction of the propagated control qubits of the enclosing statements and the guard of the nested IfStatement in a single ancillary qubit per nested IfStatement,
+         * such that the quantum operations of the branches of the nested IfStatement are only controlled by said ancillary qubit instead of accumulating the guards of all enclosing IfStatements as control qubits. Disabled by default.
+         */
+        bool combineGuardsOfNestedIfStatements = false;
+
+        /**
+         * Should the body of a module called/uncalled in a branch of an IfStatement be synthesized without the control qubits propagated by the enclosing IfStatements, with the latter only being added to the quantum operations of the core of the nested compute-apply-uncompute structures of the synthesized quantum operations
+         * (see AnnotatableQuantumComputation::determineQuantumOperationsToControlInControlledSequence(...)) if this reduces their quantum cost compared to controlling every synthesized quantum operation. Disabled by default.
+         * Ignored for a module call whose caller arguments overlap with a propagated control qubit, if the quantum operations are streamed to a sink or if the uncomputation of the ancillary qubits of expressions can be deferred.
+         */
+        bool liftControlQubitsOfModuleCalls = false;
+
+        /**
+         * Should the quantum operations be simplified using the values of the qubits known at their position, starting from the ancillary qubits being initialized to zero, after the synthesis of a SyReC program was completed, disabled by default.
+         * Quantum operations with a control qubit known to not satisfy its control are removed while control qubits known to satisfy their control are removed from their quantum operation. The simplification is performed prior to the cancellation of adjacent self-inverse quantum operations.
+         */
+        bool propagateConstantQubitValues = false;
+
+        /**
+         * Should the multi-controlled X gates be simplified using reversible circuit templates after the synthesis of a SyReC program was completed, disabled by default (see AnnotatableQuantumComputation::applyReversibleCircuitTemplates).
+         * The templates are applied after the propagation of constant qubit values and prior to the cancellation of adjacent self-inverse quantum operations.
+         */
+        bool applyReversibleCircuitTemplates = false;
+
+        /**
+         * The maximum number of previous multi-controlled X gates with the same target qubit considered as the partner of a multi-controlled X gate during the application of the reversible circuit templates, defaults to 64.
+         */
+        std::size_t windowSizeOfReversibleCircuitTemplates = 64U;
+
+        /**
+         * The optional time budget in milliseconds of the application of the reversible circuit templates, no budget is defined by default.
+         */
+        std::optional<std::uint64_t> timeBudgetOfReversibleCircuitTemplatesInMilliseconds;
+
+        /**
+         * Should pairs of identical self-inverse quantum operations (i.e. multi-controlled X and SWAP gates) with no other quantum operation accessing any of their qubits in between them be removed after the synthesis of a SyReC program was completed, disabled by default.
+         */
+        bool cancelAdjacentSelfInverseQuantumOperations = false;
+
+        /**
+         * Should the quantum operations be reordered, by moving quantum operations in front of previous quantum operations they commute with, to reduce the depth of the quantum computation after the synthesis of a SyReC program was completed, disabled by default.
+         * The reordering is performed after the cancellation of adjacent self-inverse quantum operations.
+         */
+        bool reorderQuantumOperationsToReduceDepth = false;
+
+        /**
+         * Should ancillary qubits with non-overlapping live ranges be merged onto the same qubit after the synthesis of a SyReC program was completed, disabled by default (see recycleAncillaryQubits(...)).
+         * The recycling is performed last and is skipped if the quantum operations of the module calls are grouped into compound operations or if the quantum operations were forwarded to a quantum operation sink.
+         */
+        bool recycleAncillaryQubitsWithNonOverlappingLiveRanges = false;
+
+        /**
+         * The identifiers of the passes of syrec::OptimizationPassManager (i.e. 'cancel_adjacent_self_inverse_quantum_operations') applied, in the given order, to the quantum computation after the synthesis of a SyReC program was completed, empty by default.
+         * If defined, the pipeline replaces the optimizations enabled by the flags propagateConstantQubitValues, applyReversibleCircuitTemplates, cancelAdjacentSelfInverseQuantumOperations, reorderQuantumOperationsToReduceDepth and recycleAncillaryQubitsWithNonOverlappingLiveRanges.
+         */
+        std::vector<std::string> optimizationPipeline;
+
+        /**
+         * The maximum number of iterations of the optimization pipeline, which is repeated until no pass modified the quantum computation, defaults to 1.
+         */
+        std::size_t maxNumIterationsOfOptimizationPipeline = 1U;
+
+        /**
+         * Should the quantum computation be verified after every pass of the optimization pipeline by comparing it to the quantum computation prior to the pass using the bit-parallel simulation of checkEquivalence(...), disabled by default.
+         * The synthesis fails if a pass did not preserve the function of the quantum computation.
+         */
+        bool verifyPassesOfOptimizationPipeline = false;
+
+        /**
+         * Should the quantum operations synthesized for every module call and uncall be grouped into a qc::CompoundOperation after the synthesis of a SyReC program was completed, with the compound operations of nested module calls being nested in the one of the calling module, disabled by default.
+         * The grouping is performed prior to the cancellation of adjacent self-inverse quantum operations and the reordering of the quantum operations which do not move quantum operations across the boundaries of a compound operation.
+         * The quantum operations are not grouped if the generation of quantum operation annotations, the streaming of quantum operations to a sink or the concurrent synthesis of independent statements is requested.
+         */
+        bool emitModuleCallsAsCompoundOperations = false;
+
+        /**
+         * Should the statements of the main module be partitioned into groups such that no statement of a group accesses a variable modified by a statement of another group, with the groups being synthesized concurrently into separate quantum computations
+         * whose quantum operations are appended, in the order of the first statement of every group, to the synthesized quantum computation afterwards, disabled by default. Every group uses separate ancillary qubits, thus the synthesized quantum computation
+         * can require more ancillary qubits than its sequential synthesis. The synthesized quantum computation does not depend on the number of threads used. The statements are synthesized sequentially if the main module consists of a single group or if
+         * the generation of quantum operation annotations, inlined qubit debug information, the tracking of unconditional swaps as a qubit permutation, the tracing of the synthesis or a qubit budget of the hybrid synthesis is requested.
+         */
+        bool synthesizeIndependentStatementsConcurrently = false;
+
+        /**
+         * The number of threads used to synthesize the groups of independent statements of the main module (see ConfigurableOptions::synthesizeIndependentStatementsConcurrently), a value of zero uses the maximum number of threads defined by ConfigurableOptions::maxNumThreads.
+         */
+        std::size_t numThreadsOfConcurrentSynthesis = 0;
+
+        /**
+         * The maximum number of threads used by the parallel loops of a synthesis or simulation call configured by these settings whose number of threads was not defined explicitly (i.e. the concurrent synthesis of independent statements and the interpretation of a program for a batch of assignments),
+         * a value of zero uses the number of concurrent threads supported by the hardware. All parallel loops are executed by the worker threads of the shared syrec::Executor, thus concurrent calls do not oversubscribe the hardware.
+         */
+        std::size_t maxNumThreads = 0;
+
+        /**
+         * Should the worker threads of the shared syrec::Executor be pinned to separate cores, disabled by default. Only supported on Linux with the pinning persisting for the lifetime of the process once it was requested by any call.
+         */
+        bool pinWorkerThreadsToCores = false;
+
+        /**
+         * Should the parallel loops balancing their load by letting every thread claim the next not yet processed work item instead partition their work items into a fixed number of groups each processed sequentially by a single thread,
+         * disabled by default. The partition only depends on the number of threads but not on the scheduling of the latter (see syrec::Executor::parallelFor(...)).
+         */
+        bool deterministicParallelExecution = false;
+
+        /**
+         * The cancellation token, time limit and memory budget of a synthesis configured by these settings, checked prior to the synthesis of every statement and loop iteration. A synthesis violating any of these limits fails with the violated limit being recorded in
+         * its statistics (see Statistics::executionLimitViolation), no limits are defined by default.
+         */
+        ExecutionLimits executionLimits;
+
+        /**
+         * The optional callback to which the progress of a synthesis configured by these settings (i.e. the number of synthesized statements and emitted quantum operations together with their totals predicted by the resource estimation, see syrec::estimateResourcesOfSynthesis(...)) is reported
+         * at most once per ConfigurableOptions::progressReportIntervalInMilliseconds as well as once at the end of the synthesis. The groups of independent statements synthesized concurrently only report their progress once all of them were synthesized.
+         */
+        ProgressCallback progressCallback;
+
+        /**
+         * The minimum duration in milliseconds between two reports of the progress to the ConfigurableOptions::progressCallback, defaults to 100ms.
+         */
+        std::uint64_t progressReportIntervalInMilliseconds = 100;
+
+        /**
+         * Should the memory held by the data structures of the parser and the synthesis (i.e. the IR of the parsed SyReC program, the symbol tables, the quantum operations and their annotations, the quantum register layouts and the inline stacks) together with the peak of the resident set size
+         * during the synthesis be recorded in the statistics of the latter (see Statistics::memoryUsage), disabled by default since the accounting requires an additional traversal of the data structures.
+         */
+        bool recordMemoryUsage = false;
+
+        /**
+         * The path of the file to which the begin and end of the synthesis of every module call, loop iteration, statement and expression, together with the number of quantum operations emitted by the latter, is written in the Chrome trace-event JSON format (loadable in Perfetto).
+         * Only supported if the library was built with the MQT_SYREC_ENABLE_SYNTHESIS_TRACING option, no trace is recorded by default.
+         */
+        std::optional<std::string> optionalSynthesisTraceFilePath;
+
         /**
          * @brief Define the identifier of the module that should serve as the entry point of the SyReC program.
          * @details By default the entry point in a SyReC program is identified by a module with an identifier equal to 'main'. If no such module is found, the last defined module in the program also serves as the entry point for the latter.
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace syrec {
+    /**
+     * A container for the error messages reported during a synthesis or simulation call.
+     */
+    class Diagnostics {
+    public:
+        /**
+         * Append the lines of a text to the reported error messages with every non-empty line being stored as a separate message.
+         * @param text The text to append.
+         */
+        void reportErrors(const std::string& text);
+
+        [[nodiscard]] const std::vector<std::string>& getErrorMessages() const noexcept {
+            return errorMessages;
+        }
+
+        [[nodiscard]] bool hasErrors() const noexcept {
+            return !errorMessages.empty();
+        }
+
+        void clear() noexcept {
+            errorMessages.clear();
+        }
+
+    protected:
+        std::vector<std::string> errorMessages;
+    };
+
+    /**
+     * Get the output stream on which errors are reported by the calling thread.
+     * @return The output stream of the innermost syrec::ScopedDiagnosticsCollection active in the calling thread, std::cerr if no such collection is active.
+     */
+    [[nodiscard]] std::ostream& getErrorStream() noexcept;
+
+    /**
+     * Collect the errors reported by the calling thread via syrec::getErrorStream() from the construction of this object until its destruction in a diagnostics container.
+     *
+     * Since the collection is limited to the calling thread, concurrent synthesis or simulation calls from multiple threads do not interleave their errors. Collections can be nested
+     * with the errors only being collected by the innermost one.
+     */
+    class ScopedDiagnosticsCollection {
+    public:
+        explicit ScopedDiagnosticsCollection(Diagnostics& diagnostics);
+        ~ScopedDiagnosticsCollection();
+
+        ScopedDiagnosticsCollection(const ScopedDiagnosticsCollection&)            = delete;
+        ScopedDiagnosticsCollection(ScopedDiagnosticsCollection&&)                 = delete;
+        ScopedDiagnosticsCollection& operator=(const ScopedDiagnosticsCollection&) = delete;
+        ScopedDiagnosticsCollection& operator=(ScopedDiagnosticsCollection&&)      = delete;
+
+    protected:
+        Diagnostics&       diagnostics;
+        std::ostringstream collectedErrors;
+        std::ostream*      errorStreamOfEnclosingCollection;
+    };
+} // namespace syrec
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string_view>
+
+namespace syrec {
+    /**
+     * @brief A token via which the cancellation of one or more long-running computations (i.e. a synthesis) can be requested from any thread.
+     *
+     * All copies of a token share the same state, thus requesting the cancellation via a copy cancels all computations using any copy of the token. A token cannot be reset once its cancellation was requested.
+     */
+    class CancellationToken {
+    public:
+        CancellationToken():
+            cancellationRequested(std::make_shared<std::atomic_bool>(false)) {}
+
+        void requestCancellation() const noexcept {
+            cancellationRequested->store(true, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] bool isCancellationRequested() const noexcept {
+            return cancellationRequested->load(std::memory_order_relaxed);
+        }
+
+    protected:
+        std::shared_ptr<std::atomic_bool> cancellationRequested;
+    };
+
+    /**
+     * The limits of a long-running computation which are checked cooperatively by the latter (i.e. prior to the synthesis of every statement), the computation thus only stops once it reaches its next check.
+     */
+    struct ExecutionLimits {
+        /**
+         * The optional token via which the cancellation of the computation can be requested.
+         */
+        std::optional<CancellationToken> optionalCancellationToken{};
+
+        /**
+         * The optional wall-clock time in milliseconds, measured from the start of the computation, after which the computation is stopped.
+         */
+        std::optional<std::uint64_t> timeLimitInMilliseconds{};
+
+        /**
+         * The optional maximum resident set size of the process in MiB above which the computation is stopped. Since the memory usage of the whole process is monitored, the budget also includes the memory used by other computations running concurrently.
+         */
+        std::optional<double> memoryBudgetInMiB{};
+
+        [[nodiscard]] bool isAnyLimitDefined() const noexcept {
+            return optionalCancellationToken.has_value() || timeLimitInMilliseconds.has_value() || memoryBudgetInMiB.has_value();
+        }
+    };
+
+    /**
+     * The reason why a computation was stopped prior to its completion.
+     */
+    enum class ExecutionLimitViolation : std::uint8_t {
+        None,
+        Cancelled,
+        TimeLimitExceeded,
+        MemoryBudgetExceeded
+    };
+
+    [[nodiscard]] std::string_view stringifyExecutionLimitViolation(ExecutionLimitViolation violation) noexcept;
+
+    /**
+     * @brief Determine the current resident set size of the process.
+     * @return The resident set size in bytes, std::nullopt if it could not be determined on the current platform.
+     */
+    [[nodiscard]] std::optional<std::uint64_t> determineResidentSetSizeInBytes();
+
+    /**
+     * @brief Check whether any of the limits of a computation was violated, starting the measurement of its runtime on construction.
+     *
+     * The monitor can be shared by all threads of a computation. Since the resident set size of the process is more expensive to determine than the elapsed time, it is only sampled at most once per millisecond.
+     * The first detected violation is reported on the error stream (see syrec::getErrorStream()) of the thread detecting it and is kept by the monitor, thus all later checks fail as well.
+     */
+    class ExecutionLimitsMonitor {
+    public:
+        explicit ExecutionLimitsMonitor(ExecutionLimits executionLimits);
+
+        /**
+         * @brief Check the limits of the computation.
+         * @return Whether any limit was violated, in which case the computation should stop.
+         */
+        [[nodiscard]] bool isAnyLimitViolated();
+
+        [[nodiscard]] ExecutionLimitViolation getViolation() const noexcept {
+            return violation.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Adopt the violation of the limits detected by a nested computation using a copy of the limits of this monitor, without reporting it again.
+         * @param violationOfNestedComputation The violation detected by the nested computation, ignored if another violation was already detected.
+         */
+        void adoptViolationOfNestedComputation(ExecutionLimitViolation violationOfNestedComputation) noexcept {
+            ExecutionLimitViolation expectedViolation = ExecutionLimitViolation::None;
+            violation.compare_exchange_strong(expectedViolation, violationOfNestedComputation, std::memory_order_acq_rel);
+        }
+
+    protected:
+        ExecutionLimits                       executionLimits;
+        std::chrono::steady_clock::time_point startTime;
+        std::atomic<std::int64_t>             nextSampleOfResidentSetSizeInNanoseconds = 0;
+        std::atomic<ExecutionLimitViolation>  violation                                = ExecutionLimitViolation::None;
+
+        void recordViolation(ExecutionLimitViolation detectedViolation);
+    };
+} // namespace syrec
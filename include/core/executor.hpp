@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace syrec {
+    /**
+     * @brief A work-stealing thread pool executing the parallel loops of the algorithms of this library.
+     *
+     * Every worker thread owns a task queue from whose back it takes its next task, a worker whose queue is empty steals the oldest task from the front of the queue of another worker. Tasks submitted by a worker thread are pushed to its own queue
+     * while tasks submitted by any other thread are distributed among the queues in a round-robin fashion.
+     *
+     * The calling thread of a parallel loop participates in its execution and only waits for the iterations already started by a worker thread, parallel loops can thus be nested (i.e. started by an iteration of another parallel loop) without
+     * deadlocks. Since all parallel loops of the library are executed by the process-wide pool returned by getShared(), calling the library from multiple threads (i.e. from the thread pool of the caller or a syrec::BackgroundTask) does
+     * not oversubscribe the hardware with an additional set of threads per call.
+     */
+    class Executor {
+    public:
+        /**
+         * @brief Construct an executor with a fixed number of worker threads.
+         * @param numWorkerThreads The number of worker threads, an executor without worker threads executes parallel loops sequentially on the calling thread.
+         */
+        explicit Executor(std::size_t numWorkerThreads);
+        ~Executor();
+
+        Executor(const Executor&)            = delete;
+        Executor(Executor&&)                 = delete;
+        Executor& operator=(const Executor&) = delete;
+        Executor& operator=(Executor&&)      = delete;
+
+        /**
+         * @brief Get the executor shared by all algorithms of this library.
+         *
+         * The shared executor is created on the first call with one worker thread less than the number of concurrent threads supported by the hardware since the calling thread of a parallel loop participates in its execution.
+         */
+        [[nodiscard]] static Executor& getShared();
+
+        /**
+         * @brief Determine the number of threads used for a requested number of threads.
+         * @param requestedNumThreads The requested number of threads, a value of zero uses the number of concurrent threads supported by the hardware.
+         * @return The number of threads, which is at least one.
+         */
+        [[nodiscard]] static std::size_t determineNumThreads(std::size_t requestedNumThreads) noexcept;
+
+        [[nodiscard]] std::size_t getNumWorkerThreads() const noexcept {
+            return workers.size();
+        }
+
+        /**
+         * @brief Pin every worker thread to a separate core (in a round-robin fashion if there are more worker threads than cores).
+         *
+         * The pinning persists for the lifetime of the executor and is only supported on Linux, the call has no effect on other platforms.
+         */
+        void pinWorkerThreadsToCores();
+
+        /**
+         * @brief Execute a function for every index in [0, count) and wait for all executions to finish.
+         *
+         * By default, the participating threads claim the next not yet processed index whenever they finished their previous one, thus balancing the load between indices with largely different runtimes. In deterministic mode, the indices are
+         * instead partitioned into a fixed number of groups (the index i being assigned to the group i mod numGroups) whose indices are processed sequentially in ascending order by a single thread, with the partition only depending on the
+         * number of indices and the maximum number of threads but not on the scheduling of the threads.
+         *
+         * If the function throws for some indices, the remaining indices are still processed and the exception thrown for the smallest index is rethrown once all executions finished.
+         *
+         * @param count The number of indices.
+         * @param function The function to execute for every index.
+         * @param maxNumThreads The maximum number of threads (including the calling thread) concurrently executing the function, a value of zero uses the number of concurrent threads supported by the hardware. In deterministic mode, this also defines the number of groups.
+         * @param deterministic Whether the indices are processed in deterministic groups.
+         */
+        void parallelFor(std::size_t count, const std::function<void(std::size_t)>& function, std::size_t maxNumThreads = 0U, bool deterministic = false);
+
+    protected:
+        using Task = std::function<void()>;
+
+        struct TaskQueue {
+            std::mutex       mutex;
+            std::deque<Task> tasks;
+        };
+
+        std::vector<std::unique_ptr<TaskQueue>> taskQueues;
+        std::vector<std::thread>                workers;
+        std::mutex                              idleMutex;
+        std::condition_variable                 idleCondition;
+        std::size_t                             numQueuedTasks = 0;
+        std::size_t                             nextTaskQueue  = 0;
+        bool                                    stopRequested  = false;
+        std::once_flag                          pinningOfWorkerThreads;
+
+        void               submit(Task task);
+        [[nodiscard]] bool tryTakeTask(std::size_t indexOfOwnTaskQueue, Task& task);
+        void               runWorker(std::size_t indexOfOwnTaskQueue);
+    };
+} // namespace syrec
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/annotatable_quantum_computation.hpp"
+#include "ir/Definitions.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace syrec {
+    /**
+     * An immutable snapshot of the retained quantum operations of a syrec::AnnotatableQuantumComputation created by AnnotatableQuantumComputation::freeze().
+     *
+     * The quantum operations are stored as the struct of arrays created by AnnotatableQuantumComputation::exportQuantumOperationsAsArrays(), thus the gates of a qc::CompoundOperation are stored in place of the latter, with the gates of the i-th quantum operation
+     * being stored in the range [gateOffsets[i], gateOffsets[i + 1]). The qubit labels, the statement line numbers of the quantum operations and the synthesis costs are resolved when the snapshot is created. Since the snapshot is not modifiable after
+     * its creation and none of its functions modify any internal state, it can be shared between threads without synchronization.
+     */
+    class FrozenQuantumComputation {
+    public:
+        using ptr                               = std::shared_ptr<const FrozenQuantumComputation>;
+        using QuantumOperationArrays            = AnnotatableQuantumComputation::QuantumOperationArrays;
+        using QuantumOperationAnnotationsLookup = AnnotatableQuantumComputation::QuantumOperationAnnotationsLookup;
+        using SynthesisCostMetricValue          = AnnotatableQuantumComputation::SynthesisCostMetricValue;
+        using SynthesisCost                     = AnnotatableQuantumComputation::SynthesisCost;
+        using DepthAnalysis                     = AnnotatableQuantumComputation::DepthAnalysis;
+        using QuantumOperationLayout            = AnnotatableQuantumComputation::QuantumOperationLayout;
+        using QubitLabelType                    = AnnotatableQuantumComputation::QubitLabelType;
+
+        [[nodiscard]] std::size_t getNqubits() const noexcept {
+            return numQubits;
+        }
+
+        /**
+         * @return The number of quantum operations retained in the quantum computation at the time of its freezing, with a qc::CompoundOperation counting as a single quantum operation.
+         */
+        [[nodiscard]] std::size_t getNops() const noexcept {
+            return gateOffsets.size() - 1U;
+        }
+
+        [[nodiscard]] std::size_t getNumGates() const noexcept {
+            return quantumOperationArrays.opTypes.size();
+        }
+
+        /**
+         * @return The index of the first frozen quantum operation in the quantum computation (i.e. the number of quantum operations already forwarded to a quantum operation sink at the time of its freezing).
+         */
+        [[nodiscard]] std::size_t getIndexOfFirstQuantumOperation() const noexcept {
+            return quantumOperationArrays.indexOfFirstQuantumOperation;
+        }
+
+        /**
+         * @return The gates of the frozen quantum operations, with the i-th entry of every per quantum operation array describing the i-th gate.
+         */
+        [[nodiscard]] const QuantumOperationArrays& getQuantumOperationArrays() const noexcept {
+            return quantumOperationArrays;
+        }
+
+        /**
+         * @return The offsets of the gates of every frozen quantum operation with the number of offsets being equal to the number of quantum operations + 1.
+         */
+        [[nodiscard]] std::span<const std::uint64_t> getGateOffsets() const noexcept {
+            return gateOffsets;
+        }
+
+        [[nodiscard]] std::span<const qc::Qubit> getTargetQubitsOfGate(const std::size_t gateIndex) const {
+            return std::span(quantumOperationArrays.targetQubits).subspan(quantumOperationArrays.targetOffsets[gateIndex], quantumOperationArrays.targetOffsets[gateIndex + 1] - quantumOperationArrays.targetOffsets[gateIndex]);
+        }
+
+        [[nodiscard]] std::span<const qc::Qubit> getControlQubitsOfGate(const std::size_t gateIndex) const {
+            return std::span(quantumOperationArrays.controlQubits).subspan(quantumOperationArrays.controlOffsets[gateIndex], quantumOperationArrays.controlOffsets[gateIndex + 1] - quantumOperationArrays.controlOffsets[gateIndex]);
+        }
+
+        /**
+         * Get the annotations of a frozen quantum operation.
+         * @param indexOfQuantumOperationInQuantumComputation The index of the quantum operation in the quantum computation.
+         * @return A pointer to the annotations of the quantum operation (including its statement line number annotation), nullptr if the index did not reference a frozen quantum operation or the latter consists of no gates.
+         */
+        [[nodiscard]] const QuantumOperationAnnotationsLookup* getAnnotationsOfQuantumOperation(std::size_t indexOfQuantumOperationInQuantumComputation) const;
+
+        /**
+         * Get the line number of the statement whose synthesis generated a frozen quantum operation.
+         * @param indexOfQuantumOperationInQuantumComputation The index of the quantum operation in the quantum computation.
+         * @return The statement line number of the quantum operation, std::nullopt if the quantum operation has no statement line number or consists of no gates or the index did not reference a frozen quantum operation.
+         */
+        [[nodiscard]] std::optional<unsigned> getStatementLineNumberOfQuantumOperation(std::size_t indexOfQuantumOperationInQuantumComputation) const;
+
+        /**
+         * @return The labels of all qubits, indexed by the qubit, resolved at the time of the freezing (see AnnotatableQuantumComputation::getQubitLabels(...)).
+         */
+        [[nodiscard]] const std::vector<std::optional<std::string>>& getQubitLabels(QubitLabelType qubitLabelType) const noexcept {
+            return qubitLabelType == QubitLabelType::Internal ? internalQubitLabels : userDeclaredQubitLabels;
+        }
+
+        [[nodiscard]] const std::vector<bool>& getAncillary() const noexcept {
+            return ancillary;
+        }
+
+        [[nodiscard]] const std::vector<bool>& getGarbage() const noexcept {
+            return garbage;
+        }
+
+        /**
+         * @return The quantum cost for the synthesis of the frozen quantum operations (see AnnotatableQuantumComputation::getQuantumCostForSynthesis()).
+         */
+        [[nodiscard]] SynthesisCostMetricValue getQuantumCostForSynthesis() const noexcept {
+            return quantumCost;
+        }
+
+        /**
+         * @return The transistor cost for the synthesis of the frozen quantum operations (see AnnotatableQuantumComputation::getTransistorCostForSynthesis()).
+         */
+        [[nodiscard]] SynthesisCostMetricValue getTransistorCostForSynthesis() const noexcept {
+            return transistorCost;
+        }
+
+        /**
+         * @return The synthesis cost of the frozen quantum operations per statement line number (see AnnotatableQuantumComputation::getSynthesisCostPerStatementLineNumber()).
+         */
+        [[nodiscard]] const std::map<std::string, SynthesisCost, std::less<>>& getSynthesisCostPerStatementLineNumber() const noexcept {
+            return synthesisCostPerStatementLineNumber;
+        }
+
+        /**
+         * Determine the depth related properties of the frozen quantum operations (see AnnotatableQuantumComputation::analyzeDepth()).
+         * @return The determined depth related properties, a qc::CompoundOperation is considered to be a single quantum operation operating on the qubits of all of its gates.
+         */
+        [[nodiscard]] DepthAnalysis analyzeDepth() const;
+
+        /**
+         * Determine the layout of the gates of the frozen quantum operations in a circuit diagram (see AnnotatableQuantumComputation::determineLayoutOfQuantumOperations()).
+         * @return The determined layout of the gates.
+         */
+        [[nodiscard]] QuantumOperationLayout determineLayoutOfQuantumOperations() const;
+
+        /**
+         * Determine the nearest neighbor cost of the frozen quantum operations (see AnnotatableQuantumComputation::determineNearestNeighborCost()).
+         * @return The sum of the nearest neighbor costs of the gates.
+         */
+        [[nodiscard]] SynthesisCostMetricValue determineNearestNeighborCost() const;
+
+    protected:
+        // The snapshot can only be created by AnnotatableQuantumComputation::freeze() which initializes its fields.
+        friend class AnnotatableQuantumComputation;
+        FrozenQuantumComputation() = default;
+
+        std::size_t                             numQubits = 0;
+        QuantumOperationArrays                  quantumOperationArrays;
+        std::vector<std::uint64_t>              gateOffsets{0U};
+        std::vector<std::optional<unsigned>>    statementLineNumberPerDistinctAnnotations;
+        std::vector<std::optional<std::string>> internalQubitLabels;
+        std::vector<std::optional<std::string>> userDeclaredQubitLabels;
+        std::vector<bool>                       ancillary;
+        std::vector<bool>                       garbage;
+
+        SynthesisCostMetricValue                          quantumCost    = 0;
+        SynthesisCostMetricValue                          transistorCost = 0;
+        std::map<std::string, SynthesisCost, std::less<>> synthesisCostPerStatementLineNumber;
+
+        [[nodiscard]] std::optional<std::size_t> determinePositionOfQuantumOperation(std::size_t indexOfQuantumOperationInQuantumComputation) const noexcept;
+        [[nodiscard]] bool                       isQubitWithinRange(qc::Qubit qubit) const noexcept;
+
+        /**
+         * Collect the qubits of all gates of a frozen quantum operation that are within the range of qubits of the quantum computation, the qubits of a quantum operation consisting of multiple gates are sorted and deduplicated.
+         */
+        void collectQubitsOfQuantumOperation(std::size_t position, std::vector<qc::Qubit>& qubits) const;
+    };
+} // namespace syrec
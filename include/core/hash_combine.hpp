@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace syrec {
+    /**
+     * @brief Combine the hash of a value into an existing hash value as performed by boost::hash_combine.
+     * @tparam T The type of the value to hash, for which a specialization of std::hash must exist.
+     * @param hashValue The hash value into which the hash of \p value is combined.
+     * @param value The value whose hash is combined into \p hashValue.
+     */
+    template<typename T>
+    void hashCombine(std::size_t& hashValue, const T& value) noexcept {
+        hashValue ^= std::hash<T>{}(value) + static_cast<std::size_t>(0x9e3779b97f4a7c15ULL) + (hashValue << 6U) + (hashValue >> 2U);
+    }
+} // namespace syrec
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/annotatable_quantum_computation.hpp"
+
+#include <ostream>
+#include <string>
+
+namespace syrec {
+    /**
+     * The settings of the writers of a syrec::AnnotatableQuantumComputation in the .real and OpenQASM 3 format.
+     */
+    struct CircuitWriterSettings {
+        /**
+         * Whether the line number of the statement whose synthesis generated a quantum operation (see syrec::AnnotatableQuantumComputation::QUANTUM_OPERATION_ANNOTATION_KEY_ASSOCIATED_STATEMENT_LINE_NUMBER) is written as a comment
+         * preceding the first gate of every sequence of quantum operations sharing the same statement line number.
+         */
+        bool writeStatementLineNumbers = false;
+        /**
+         * Whether all annotations of a quantum operation are written as a comment preceding the first gate of every sequence of quantum operations sharing the same annotations (this includes the statement line number).
+         */
+        bool writeQuantumOperationAnnotations = false;
+        /**
+         * Whether the user declared label (or the internal label for qubits without a user declared label) of every qubit is written as a comment in the header.
+         */
+        bool writeQubitLabels = false;
+    };
+
+    /**
+     * Write the retained quantum operations of a quantum computation in the .real format to an output stream.
+     *
+     * The i-th qubit of the quantum computation is named 'q<i>' with its ancillary and garbage state being recorded in the .constants and .garbage entries of the header. The written content is
+     * formatted into a buffer (using std::to_chars) that is written to the output stream in large chunks, thus the output stream can be any stream (i.e. one writing to a compressed file).
+     * @param annotatableQuantumComputation The quantum computation to write which must only contain (multi-controlled) X and SWAP gates (either directly or as gates of a qc::CompoundOperation).
+     * @param outputStream The output stream to which the quantum computation is written.
+     * @param settings The settings of the writer.
+     * @return Whether the quantum computation could be written, false if a quantum operation is not supported, the quantum computation contains quantum operations already forwarded to a quantum operation sink or the output stream failed.
+     */
+    [[nodiscard]] bool writeRealFormat(const AnnotatableQuantumComputation& annotatableQuantumComputation, std::ostream& outputStream, const CircuitWriterSettings& settings = {});
+
+    /**
+     * Write the retained quantum operations of a quantum computation in the OpenQASM 3 format to an output stream.
+     *
+     * The qubits of the quantum computation are declared as the single register 'q' with the gates of the quantum computation being written as gates of the standard library (x, cx, ccx, swap and cswap)
+     * or as the gates x and swap prefixed with the required ctrl and negctrl modifiers. The output is buffered equally to syrec::writeRealFormat(...).
+     * @param annotatableQuantumComputation The quantum computation to write which must only contain (multi-controlled) X and SWAP gates (either directly or as gates of a qc::CompoundOperation).
+     * @param outputStream The output stream to which the quantum computation is written.
+     * @param settings The settings of the writer.
+     * @return Whether the quantum computation could be written, false if a quantum operation is not supported, the quantum computation contains quantum operations already forwarded to a quantum operation sink or the output stream failed.
+     */
+    [[nodiscard]] bool writeOpenQasm3(const AnnotatableQuantumComputation& annotatableQuantumComputation, std::ostream& outputStream, const CircuitWriterSettings& settings = {});
+
+    /**
+     * Write the retained quantum operations of a quantum computation in the .real format to a file (see syrec::writeRealFormat(...)).
+     */
+    [[nodiscard]] bool writeRealFormatToFile(const AnnotatableQuantumComputation& annotatableQuantumComputation, const std::string& filename, const CircuitWriterSettings& settings = {});
+
+    /**
+     * Write the retained quantum operations of a quantum computation in the OpenQASM 3 format to a file (see syrec::writeOpenQasm3(...)).
+     */
+    [[nodiscard]] bool writeOpenQasm3ToFile(const AnnotatableQuantumComputation& annotatableQuantumComputation, const std::string& filename, const CircuitWriterSettings& settings = {});
+} // namespace syrec
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace syrec {
+    /**
+     * Read-only view of the content of a file that is memory-mapped (if supported by the platform) instead of being read into a buffer.
+     *
+     * On platforms not supporting memory-mapping the content of the file is read into a buffer instead.
+     */
+    class MappedFile {
+    public:
+        /**
+         * The expected access pattern of the mapped content, forwarded as a hint to the operating system.
+         */
+        enum class AccessPattern : unsigned char {
+            Sequential,
+            Random
+        };
+
+        explicit MappedFile(const std::string& filename, AccessPattern accessPattern = AccessPattern::Sequential);
+
+        MappedFile(const MappedFile&)            = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        ~MappedFile();
+
+        /**
+         * Determine whether the file could be opened, an empty file is considered to be opened with an empty content.
+         */
+        [[nodiscard]] bool isOpen() const {
+            return opened;
+        }
+
+        /**
+         * Get the content of the file. The start of a non-empty content is aligned to (at least) the alignment of any fundamental type.
+         */
+        [[nodiscard]] std::string_view getContent() const;
+
+    private:
+#if _WIN32
+        std::string buffer;
+#else
+        int         fileDescriptor = -1;
+        void*       mappedContent  = nullptr;
+        std::size_t mappedSize     = 0U;
+#endif
+        bool opened = false;
+    };
+} // namespace syrec
@@ -12,7 +12,12 @@
 
 #include "core/truthTable/truth_table.hpp"
 
+#include <cstddef>
+#include <functional>
+#include <istream>
 #include <stdexcept>
+#include <string>
+#include <string_view>
 
 namespace syrec {
 
@@ -21,10 +26,52 @@ namespace syrec {
         str.erase(0, str.find_first_not_of(' ')); //prefixing spaces
     }
 
+    /**
+     * Callback invoked periodically while parsing a PLA with the number of already processed bytes and the total number of bytes of the PLA.
+     * Returning false cancels the parsing.
+     */
+    using PlaParsingProgressCallback = std::function<bool(std::size_t processedBytes, std::size_t totalBytes)>;
+
     void parsePla(TruthTable& tt, std::istream& in);
 
+    /**
+     * Parse the entries of a PLA stored in the given buffer into the truth table.
+     *
+     * The buffer is tokenized in place, i.e. without copying its lines, with the cubes being written directly into the packed cube storage of the truth table.
+     * @param tt The truth table to which the entries are added.
+     * @param content The content of the PLA.
+     * @param progressCallback An optional callback to report the progress of the parsing and to cancel it.
+     * @return Whether the whole content was parsed, false if the parsing was cancelled by the progress callback.
+     */
+    bool parsePla(TruthTable& tt, std::string_view content, const PlaParsingProgressCallback& progressCallback = nullptr);
+
+    /**
+     * Parse the entries of a PLA stored in the given buffer into the truth table using multiple threads.
+     *
+     * The declarations preceding the first cube are parsed sequentially while the remaining buffer is split at line boundaries into chunks whose cubes are parsed concurrently into packed per-chunk buffers and sorted by their input.
+     * The sorted chunks are then merged into the truth table in ascending order of their inputs, with the first line of an input being kept if the input is defined by multiple lines, thus the resulting truth table is equal to the one
+     * built by parsePla(...). A PLA redeclaring the number of its inputs or outputs after its first cube as well as a small buffer (or a single thread) is parsed by parsePla(...).
+     *
+     * @param tt The truth table to which the entries are added.
+     * @param content The content of the PLA.
+     * @param numThreads The maximum number of threads parsing the chunks, a value of zero uses the number of concurrent threads supported by the hardware.
+     * @param progressCallback An optional callback to report the progress of the parsing and to cancel it, which is invoked by one parsing thread at a time.
+     * @return Whether the whole content was parsed, false if the parsing was cancelled by the progress callback (in which case no entries were added).
+     */
+    bool parsePlaInParallel(TruthTable& tt, std::string_view content, std::size_t numThreads = 0U, const PlaParsingProgressCallback& progressCallback = nullptr);
+
     auto extend(TruthTable& tt) -> void;
 
-    bool readPla(TruthTable& tt, const std::string& filename);
+    /**
+     * Read and extend the truth table of the PLA stored in the given file.
+     *
+     * The file is memory-mapped (if supported by the platform) instead of being read through a stream.
+     * @param tt The truth table to which the entries are added.
+     * @param filename The name of the PLA file.
+     * @param progressCallback An optional callback to report the progress of the parsing and to cancel it.
+     * @param numThreads The maximum number of threads parsing the file (see parsePlaInParallel(...)), a value of zero uses the number of concurrent threads supported by the hardware.
+     * @return Whether the file could be opened and was parsed completely.
+     */
+    bool readPla(TruthTable& tt, const std::string& filename, const PlaParsingProgressCallback& progressCallback = nullptr, std::size_t numThreads = 1U);
 
 } // namespace syrec
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/execution_limits.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace syrec {
+    /**
+     * The memory held by the data structures of the processing steps of a SyReC program, which is only determined if requested via ConfigurableOptions::recordMemoryUsage.
+     *
+     * The number of bytes of a data structure is estimated from the sizes of its objects and the capacities of the containers owned by the latter, thus it does not include the overhead of the memory allocator. Objects shared by multiple owners are only counted once.
+     */
+    struct MemoryUsage {
+        /**
+         * The number of bytes held by the IR of the parsed SyReC program (i.e. its modules, variables, statements, expressions and numbers), recorded by the parser and the synthesis.
+         */
+        std::size_t numBytesOfProgram = 0;
+
+        /**
+         * The number of bytes held by the symbol tables of the parser at the end of the semantic checks, recorded by the parser.
+         */
+        std::size_t numBytesOfSymbolTables = 0;
+
+        /**
+         * The number of bytes held by the quantum operations of the synthesized quantum computation, recorded by the synthesis.
+         */
+        std::size_t numBytesOfQuantumOperations = 0;
+
+        /**
+         * The number of bytes held by the annotations of the quantum operations of the synthesized quantum computation, recorded by the synthesis.
+         */
+        std::size_t numBytesOfQuantumOperationAnnotations = 0;
+
+        /**
+         * The number of bytes held by the layouts of the quantum registers storing the qubits of the variables of the SyReC program, recorded by the synthesis.
+         */
+        std::size_t numBytesOfQuantumRegisterLayouts = 0;
+
+        /**
+         * The number of bytes held by the inline stacks recorded as the debug information of the qubits, recorded by the synthesis.
+         */
+        std::size_t numBytesOfInlineStacks = 0;
+
+        /**
+         * The resident set size of the process in bytes at the start of the synthesis, zero if it could not be determined on the current platform.
+         */
+        std::size_t residentSetSizeAtStartOfSynthesisInBytes = 0;
+
+        /**
+         * The largest resident set size of the process in bytes sampled during the synthesis (at most once per millisecond and at the end of the synthesis), zero if it could not be determined on the current platform.
+         *
+         * Contrary to Statistics::peakResidentSetSizeInBytes, which is the high-water mark of the whole lifetime of the process, the peak is only sampled during the synthesis and thus attributable to the latter.
+         */
+        std::size_t peakResidentSetSizeDuringSynthesisInBytes = 0;
+
+        [[nodiscard]] bool operator==(const MemoryUsage& other) const = default;
+    };
+
+    namespace memory_accounting {
+        /**
+         * The estimated number of bytes of the control block of an object managed by a std::shared_ptr (i.e. the virtual table pointer and the reference counts).
+         */
+        constexpr std::size_t NUM_BYTES_OF_SHARED_POINTER_CONTROL_BLOCK = 2U * sizeof(void*);
+
+        /**
+         * The estimated number of bytes of a node of a std::map or std::set in addition to the stored value (i.e. the pointers to the parent and child nodes and the color of the node).
+         */
+        constexpr std::size_t NUM_BYTES_OF_TREE_NODE_OVERHEAD = 4U * sizeof(void*);
+
+        /**
+         * @brief Determine the number of bytes allocated by a string on the heap, zero for strings stored in the small string buffer of the string object itself.
+         */
+        [[nodiscard]] inline std::size_t numBytesOfHeapStorage(const std::string& string) noexcept {
+            const auto* const stringObject = reinterpret_cast<const char*>(&string);
+            if (string.data() >= stringObject && string.data() < stringObject + sizeof(std::string)) {
+                return 0;
+            }
+            return string.capacity() + 1U;
+        }
+
+        /**
+         * @brief Determine the number of bytes of the elements of a vector, excluding any memory owned by the elements themselves.
+         */
+        template<typename T>
+        [[nodiscard]] std::size_t numBytesOfHeapStorage(const std::vector<T>& vector) noexcept {
+            return vector.capacity() * sizeof(T);
+        }
+
+        /**
+         * @brief Determine the number of bytes of the nodes of a std::map or std::set, excluding any memory owned by the stored values themselves.
+         */
+        template<typename TOrderedContainer>
+        [[nodiscard]] std::size_t numBytesOfNodesOfOrderedContainer(const TOrderedContainer& container) noexcept {
+            return container.size() * (sizeof(typename TOrderedContainer::value_type) + NUM_BYTES_OF_TREE_NODE_OVERHEAD);
+        }
+
+        /**
+         * @brief Determine the number of bytes of the nodes and buckets of a std::unordered_map or std::unordered_set, excluding any memory owned by the stored values themselves.
+         */
+        template<typename TUnorderedContainer>
+        [[nodiscard]] std::size_t numBytesOfNodesOfUnorderedContainer(const TUnorderedContainer& container) noexcept {
+            return container.size() * (sizeof(typename TUnorderedContainer::value_type) + 2U * sizeof(void*)) + container.bucket_count() * sizeof(void*);
+        }
+    } // namespace memory_accounting
+
+    /**
+     * @brief Sample the resident set size of the process during a computation to determine its peak, starting with a sample on construction.
+     *
+     * Since the resident set size is more expensive to determine than the elapsed time, it is sampled at most once per millisecond by sampleIfDue().
+     */
+    class ResidentSetSizeSampler {
+    public:
+        ResidentSetSizeSampler():
+            residentSetSizeAtStartInBytes(determineResidentSetSizeInBytes().value_or(0U)), peakResidentSetSizeInBytes(residentSetSizeAtStartInBytes), timeOfLastSample(std::chrono::steady_clock::now()) {}
+
+        void sampleIfDue() {
+            if (const auto now = std::chrono::steady_clock::now(); now - timeOfLastSample >= MIN_DURATION_BETWEEN_SAMPLES) {
+                timeOfLastSample = now;
+                sample();
+            }
+        }
+
+        void sample() {
+            if (const std::optional<std::uint64_t> residentSetSizeInBytes = determineResidentSetSizeInBytes(); residentSetSizeInBytes.has_value()) {
+                peakResidentSetSizeInBytes = std::max(peakResidentSetSizeInBytes, static_cast<std::size_t>(*residentSetSizeInBytes));
+            }
+        }
+
+        [[nodiscard]] std::size_t getResidentSetSizeAtStartInBytes() const noexcept {
+            return residentSetSizeAtStartInBytes;
+        }
+
+        [[nodiscard]] std::size_t getPeakResidentSetSizeInBytes() const noexcept {
+            return peakResidentSetSizeInBytes;
+        }
+
+    protected:
+        static constexpr std::chrono::milliseconds MIN_DURATION_BETWEEN_SAMPLES{1};
+
+        std::size_t                           residentSetSizeAtStartInBytes;
+        std::size_t                           peakResidentSetSizeInBytes;
+        std::chrono::steady_clock::time_point timeOfLastSample;
+    };
+} // namespace syrec
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/syrec/module.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace syrec {
+    /**
+     * A persistent tree of the Call-/UncallStatements processed during the synthesis of a SyReC program.
+     *
+     * Every node represents one invocation of a module and only references the node of the module that contained the Call-/UncallStatement, thus the recording of an invocation requires constant memory
+     * regardless of the depth of the invocation in the call hierarchy. The inline stack of an invocation (see syrec::QubitInliningStack) is defined by the path from the root node to the node of the invocation.
+     */
+    class ModuleCallTree {
+    public:
+        using ptr    = std::shared_ptr<ModuleCallTree>;
+        using NodeId = std::size_t;
+
+        struct Node {
+            /**
+             * The node of the module that contained the Call-/UncallStatement of the target module, std::nullopt for the root node.
+             */
+            std::optional<NodeId> parentNodeId;
+            /**
+             * The optional line number of the Call-/UncallStatement that called/uncalled the target module in the SyReC program.
+             */
+            std::optional<unsigned int> lineNumberOfCallOfTargetModule;
+            /**
+             * An optional boolean flag to determine whether the target module was called/uncalled.
+             */
+            std::optional<bool> isTargetModuleAccessedViaCallStmt;
+            /**
+             * The invoked target module.
+             */
+            Module::ptr targetModule;
+            /**
+             * The number of nodes on the path from the root node to this node (including both nodes).
+             */
+            std::size_t depth;
+        };
+
+        /**
+         * Add a new node to the tree
+         * @param parentNodeId The node of the module that contained the Call-/UncallStatement of the target module, std::nullopt if a root node should be added.
+         * @param targetModule The invoked target module.
+         * @param lineNumberOfCallOfTargetModule The optional line number of the Call-/UncallStatement of the target module.
+         * @param isTargetModuleAccessedViaCallStmt An optional boolean flag to determine whether the target module was called/uncalled.
+         * @return The identifier of the added node, std::nullopt if either the target module was not set or no node with the given parent node identifier exists.
+         */
+        [[nodiscard]] std::optional<NodeId> addNode(const std::optional<NodeId>& parentNodeId, const Module::ptr& targetModule, const std::optional<unsigned int>& lineNumberOfCallOfTargetModule, const std::optional<bool>& isTargetModuleAccessedViaCallStmt);
+
+        /**
+         * Fetch a node of the tree
+         * @param nodeId The identifier of the node
+         * @return If a node with the given identifier exists then a pointer to it is returned, otherwise nullptr is returned.
+         * @remark The tree is responsible to manage the lifetime of the fetched nodes, adding a node to the tree invalidates all previously fetched pointers to nodes.
+         */
+        [[nodiscard]] const Node* getNode(NodeId nodeId) const;
+
+        /**
+         * Get the number of nodes of the tree
+         * @return The number of nodes of the tree
+         */
+        [[nodiscard]] std::size_t getNumNodes() const;
+
+    protected:
+        std::vector<Node> nodes;
+    };
+} // namespace syrec
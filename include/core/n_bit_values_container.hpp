@@ -10,19 +10,42 @@
 
 #pragma once
 
+#include "core/hash_combine.hpp"
+
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <optional>
+#include <span>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
 namespace syrec {
     /**
      * Provides a rudimentary reimplementation of the boost dynamic_bitset container
+     *
+     * The bits are stored in a contiguous array of 64-bit words with the bit at position i being stored in bit (i % 64) of the (i / 64)-th word.
+     * Containers storing at most \ref NBitValuesContainer::INLINE_STORAGE_CAPACITY_IN_BITS bits do not require a heap allocation.
+     * All bits of the storage words not associated with a position in the range [0, size()) are always zero which allows word-level comparisons of containers.
      */
     class NBitValuesContainer {
     public:
+        using Word = std::uint64_t;
+
+        /**
+         * The number of bits stored per word of the container.
+         */
+        static constexpr std::size_t BITS_PER_WORD = 64U;
+
+        /**
+         * The maximum number of bits that can be stored without requiring a heap allocation.
+         */
+        static constexpr std::size_t INLINE_STORAGE_CAPACITY_IN_BITS = 128U;
+
         /**
          * Constructs an empty container
          */
@@ -32,8 +55,9 @@ namespace syrec {
          * Construct a zero initialized container storing n bits.
          * @param n The number of bits to be stored in the container
          */
-        explicit NBitValuesContainer(std::size_t n):
-            lineValues(std::vector(n, false)) {}
+        explicit NBitValuesContainer(std::size_t n) {
+            resize(n);
+        }
 
         /**
          * Construct and initialize a container storing @p n bits using an integer
@@ -46,8 +70,9 @@ namespace syrec {
          */
         explicit NBitValuesContainer(std::size_t n, std::uint64_t initialLineValues):
             NBitValuesContainer(n) {
-            for (std::size_t i = 0; i < lineValues.size() && i < 64U; ++i) {
-                lineValues[i] = static_cast<bool>((initialLineValues >> i) & 1);
+            if (n > 0) {
+                getWords().front() = initialLineValues;
+                clearBitsOutsideOfContainerRange();
             }
         }
 
@@ -58,7 +83,20 @@ namespace syrec {
          * @param n Resize the container to hold n elements
          */
         void resize(std::size_t n) {
-            lineValues.resize(n, false);
+            const std::size_t requiredNumberOfWords = determineNumberOfWordsRequiredToStoreBits(n);
+            if (n > INLINE_STORAGE_CAPACITY_IN_BITS) {
+                if (!usesHeapStorage()) {
+                    heapStorageWords.assign(inlineStorageWords.cbegin(), inlineStorageWords.cend());
+                    inlineStorageWords.fill(0U);
+                }
+                heapStorageWords.resize(requiredNumberOfWords, 0U);
+            } else if (usesHeapStorage()) {
+                std::copy_n(heapStorageWords.cbegin(), requiredNumberOfWords, inlineStorageWords.begin());
+                heapStorageWords.clear();
+                heapStorageWords.shrink_to_fit();
+            }
+            numBits = n;
+            clearBitsOutsideOfContainerRange();
         }
 
         /**
@@ -76,11 +114,10 @@ namespace syrec {
          * @return Whether the provided index was in the range [0, size())
          */
         [[maybe_unused]] bool flip(std::size_t bitPosition) {
-            const auto currentBitValue = test(bitPosition);
-            if (!currentBitValue.has_value()) {
+            if (bitPosition >= size()) {
                 return false;
             }
-            set(bitPosition, !*currentBitValue);
+            flipUnchecked(bitPosition);
             return true;
         }
 
@@ -94,7 +131,7 @@ namespace syrec {
             if (bitPosition >= size()) {
                 return false;
             }
-            lineValues[bitPosition] = value;
+            setUnchecked(bitPosition, value);
             return true;
         }
 
@@ -125,21 +162,116 @@ namespace syrec {
             if (bitPosition >= size()) {
                 return std::nullopt;
             }
-            return lineValues[bitPosition];
+            return testUnchecked(bitPosition);
+        }
+
+        /**
+         * @brief Get the value of a specific bit without validating the accessed position
+         * @param bitPosition The zero-based index of the accessed bit, must be in the range [0, size())
+         * @return The value of the accessed bit
+         */
+        [[nodiscard]] bool testUnchecked(std::size_t bitPosition) const noexcept {
+            return ((getWords()[bitPosition / BITS_PER_WORD] >> (bitPosition % BITS_PER_WORD)) & 1U) != 0U;
+        }
+
+        /**
+         * @brief Set the value of a specific bit without validating the accessed position
+         * @param bitPosition The zero-based index of the accessed bit, must be in the range [0, size())
+         * @param value The future value of the bit
+         */
+        void setUnchecked(std::size_t bitPosition, bool value) noexcept {
+            Word&      word    = getWords()[bitPosition / BITS_PER_WORD];
+            const Word bitMask = static_cast<Word>(1U) << (bitPosition % BITS_PER_WORD);
+            word               = value ? (word | bitMask) : (word & ~bitMask);
+        }
+
+        /**
+         * @brief Flip the value of a specific bit without validating the accessed position
+         * @param bitPosition The zero-based index of the accessed bit, must be in the range [0, size())
+         */
+        void flipUnchecked(std::size_t bitPosition) noexcept {
+            getWords()[bitPosition / BITS_PER_WORD] ^= static_cast<Word>(1U) << (bitPosition % BITS_PER_WORD);
         }
 
         /**
          * @return The number of bits stored in the container
          */
         [[nodiscard]] std::size_t size() const noexcept {
-            return lineValues.size();
+            return numBits;
         }
 
         /**
          * @return Returns whether any bit in the container is set to the boolean value TRUE. A empty container is considered as having no bits set to TRUE.
          */
-        [[nodiscard]] bool none() const {
-            return std::none_of(lineValues.begin(), lineValues.end(), [](const bool lineValue) { return lineValue; });
+        [[nodiscard]] bool none() const noexcept {
+            return std::ranges::all_of(getWords(), [](const Word word) { return word == 0U; });
+        }
+
+        /**
+         * @return The number of bits in the container set to the boolean value TRUE.
+         */
+        [[nodiscard]] std::size_t count() const noexcept {
+            std::size_t numSetBits = 0;
+            for (const Word word: getWords()) {
+                numSetBits += static_cast<std::size_t>(std::popcount(word));
+            }
+            return numSetBits;
+        }
+
+        /**
+         * @brief Get read-only access to the words storing the bits of the container.
+         * @return The ceil(size() / 64) words of the container with the bits outside of the range [0, size()) being zero.
+         */
+        [[nodiscard]] std::span<const Word> getWords() const noexcept {
+            return {usesHeapStorage() ? heapStorageWords.data() : inlineStorageWords.data(), determineNumberOfWordsRequiredToStoreBits(numBits)};
+        }
+
+        /**
+         * @brief Get mutable access to the words storing the bits of the container.
+         *
+         * \b Important: The caller must not set any bit outside of the range [0, size()).
+         * @return The ceil(size() / 64) words of the container.
+         */
+        [[nodiscard]] std::span<Word> getWords() noexcept {
+            return {usesHeapStorage() ? heapStorageWords.data() : inlineStorageWords.data(), determineNumberOfWordsRequiredToStoreBits(numBits)};
+        }
+
+        /**
+         * @brief Combine the bits of this container with the ones of another container of the same size using the bitwise AND operation.
+         * @param other The other operand of the bitwise operation
+         * @return Whether both containers stored the same number of bits. The container is not modified if the sizes did not match.
+         */
+        [[maybe_unused]] bool applyBitwiseAnd(const NBitValuesContainer& other) noexcept {
+            return applyWordwiseOperation(other, std::bit_and<>());
+        }
+
+        /**
+         * @brief Combine the bits of this container with the ones of another container of the same size using the bitwise OR operation.
+         * @param other The other operand of the bitwise operation
+         * @return Whether both containers stored the same number of bits. The container is not modified if the sizes did not match.
+         */
+        [[maybe_unused]] bool applyBitwiseOr(const NBitValuesContainer& other) noexcept {
+            return applyWordwiseOperation(other, std::bit_or<>());
+        }
+
+        /**
+         * @brief Combine the bits of this container with the ones of another container of the same size using the bitwise XOR operation.
+         * @param other The other operand of the bitwise operation
+         * @return Whether both containers stored the same number of bits. The container is not modified if the sizes did not match.
+         */
+        [[maybe_unused]] bool applyBitwiseXor(const NBitValuesContainer& other) noexcept {
+            return applyWordwiseOperation(other, std::bit_xor<>());
+        }
+
+        /**
+         * @return A hash of the size and the bits stored in the container.
+         */
+        [[nodiscard]] std::size_t hash() const noexcept {
+            std::size_t hashValue = std::hash<std::size_t>()(numBits);
+            for (const Word word: getWords()) {
+                hashCombine(hashValue, word);
+            }
+            return hashValue;
         }
 
         /**
@@ -150,13 +282,108 @@ namespace syrec {
         [[nodiscard]] std::string stringify() const {
             std::string stringifiedContainerContent(size(), '0');
             for (std::size_t i = 0; i < size(); ++i) {
-                stringifiedContainerContent[i] = operator[](i) ? '1' : '0';
+                stringifiedContainerContent[i] = testUnchecked(i) ? '1' : '0';
             }
             return stringifiedContainerContent;
         }
 
+        /**
+         * @brief Construct a container from the little-endian byte representation of its bits, i.e. the i-th bit is stored in the bit (i % 8) of the (i / 8)-th byte.
+         * @param n The number of bits stored in the container
+         * @param bytes The bytes storing the bits, missing bytes are assumed to be zero while the bits outside of the range [0, n) are ignored
+         * @return The constructed container
+         */
+        [[nodiscard]] static NBitValuesContainer fromBytes(std::size_t n, std::span<const std::uint8_t> bytes) {
+            NBitValuesContainer   container(n);
+            const std::span<Word> words    = container.getWords();
+            const std::size_t     numBytes = std::min(bytes.size(), words.size() * sizeof(Word));
+            for (std::size_t i = 0; i < numBytes; ++i) {
+                words[i / sizeof(Word)] |= static_cast<Word>(bytes[i]) << (8U * (i % sizeof(Word)));
+            }
+            container.clearBitsOutsideOfContainerRange();
+            return container;
+        }
+
+        /**
+         * @return The number of bytes required to store the little-endian byte representation of the bits of the container, i.e. ceil(size() / 8)
+         */
+        [[nodiscard]] std::size_t getNumBytesOfByteRepresentation() const noexcept {
+            return (numBits + 7U) / 8U;
+        }
+
+        /**
+         * @brief Export the bits of the container in their little-endian byte representation (see fromBytes(...)).
+         * @param bytes The bytes in which the bits are stored, only the first getNumBytesOfByteRepresentation() bytes are written.
+         */
+        void exportBytes(std::span<std::uint8_t> bytes) const noexcept {
+            const std::span<const Word> words    = getWords();
+            const std::size_t           numBytes = std::min(bytes.size(), getNumBytesOfByteRepresentation());
+            for (std::size_t i = 0; i < numBytes; ++i) {
+                bytes[i] = static_cast<std::uint8_t>(words[i / sizeof(Word)] >> (8U * (i % sizeof(Word))));
+            }
+        }
+
+        /**
+         * @brief Construct a container storing one bit per given value.
+         * @param bitValues The values of the bits with every non-zero value being interpreted as TRUE
+         * @return The constructed container of size bitValues.size()
+         */
+        [[nodiscard]] static NBitValuesContainer fromBitValues(std::span<const std::uint8_t> bitValues) {
+            NBitValuesContainer   container(bitValues.size());
+            const std::span<Word> words = container.getWords();
+            for (std::size_t i = 0; i < bitValues.size(); ++i) {
+                words[i / BITS_PER_WORD] |= static_cast<Word>(bitValues[i] != 0U) << (i % BITS_PER_WORD);
+            }
+            return container;
+        }
+
+        /**
+         * @brief Export the value of every bit of the container (FALSE -> 0, TRUE -> 1).
+         * @param bitValues The values in which the bits are stored, only the first size() values are written.
+         */
+        void exportBitValues(std::span<std::uint8_t> bitValues) const noexcept {
+            const std::size_t numValues = std::min(bitValues.size(), size());
+            for (std::size_t i = 0; i < numValues; ++i) {
+                bitValues[i] = testUnchecked(i) ? 1U : 0U;
+            }
+        }
+
     protected:
-        std::vector<bool> lineValues;
+        std::size_t                                                       numBits = 0;
+        std::array<Word, INLINE_STORAGE_CAPACITY_IN_BITS / BITS_PER_WORD> inlineStorageWords{};
+        std::vector<Word>                                                 heapStorageWords;
+
+        [[nodiscard]] static constexpr std::size_t determineNumberOfWordsRequiredToStoreBits(std::size_t n) noexcept {
+            return (n + BITS_PER_WORD - 1U) / BITS_PER_WORD;
+        }
+
+        [[nodiscard]] bool usesHeapStorage() const noexcept {
+            return numBits > INLINE_STORAGE_CAPACITY_IN_BITS;
+        }
+
+        void clearBitsOutsideOfContainerRange() noexcept {
+            if (!usesHeapStorage()) {
+                for (std::size_t i = determineNumberOfWordsRequiredToStoreBits(numBits); i < inlineStorageWords.size(); ++i) {
+                    inlineStorageWords[i] = 0U;
+                }
+            }
+            if (const std::size_t numUsedBitsInLastWord = numBits % BITS_PER_WORD; numUsedBitsInLastWord != 0U) {
+                getWords().back() &= (static_cast<Word>(1U) << numUsedBitsInLastWord) - 1U;
+            }
+        }
+
+        template<typename WordwiseOperation>
+        [[nodiscard]] bool applyWordwiseOperation(const NBitValuesContainer& other, WordwiseOperation operation) noexcept {
+            if (size() != other.size()) {
+                return false;
+            }
+            const std::span<Word>       words      = getWords();
+            const std::span<const Word> otherWords = other.getWords();
+            for (std::size_t i = 0; i < words.size(); ++i) {
+                words[i] = operation(words[i], otherWords[i]);
+            }
+            return true;
+        }
     };
 
     /**
@@ -166,13 +393,41 @@ namespace syrec {
      * @return The result of the bitwise AND operation if both operands had the same size, otherwise and exception
      */
     inline NBitValuesContainer operator&(const NBitValuesContainer& lOperand, const NBitValuesContainer& rOperand) {
-        auto bitwiseAndResult = NBitValuesContainer(lOperand.size());
-        for (std::size_t i = 0; i < lOperand.size(); ++i) {
-            bitwiseAndResult.set(i, lOperand[i] && rOperand[i]);
+        auto bitwiseAndResult = lOperand;
+        if (!bitwiseAndResult.applyBitwiseAnd(rOperand)) {
+            throw std::invalid_argument("Operands of bitwise AND operation must store the same number of bits");
         }
         return bitwiseAndResult;
     }
 
+    /**
+     * @brief Combine two containers storing the same number of bits using the bitwise OR operation.
+     * @param lOperand The left-hand operand of the bitwise OR operation (A | B)
+     * @param rOperand The right-hand operand of the bitwise OR operation (A | B)
+     * @return The result of the bitwise OR operation if both operands had the same size, otherwise and exception
+     */
+    inline NBitValuesContainer operator|(const NBitValuesContainer& lOperand, const NBitValuesContainer& rOperand) {
+        auto bitwiseOrResult = lOperand;
+        if (!bitwiseOrResult.applyBitwiseOr(rOperand)) {
+            throw std::invalid_argument("Operands of bitwise OR operation must store the same number of bits");
+        }
+        return bitwiseOrResult;
+    }
+
+    /**
+     * @brief Combine two containers storing the same number of bits using the bitwise XOR operation.
+     * @param lOperand The left-hand operand of the bitwise XOR operation (A ^ B)
+     * @param rOperand The right-hand operand of the bitwise XOR operation (A ^ B)
+     * @return The result of the bitwise XOR operation if both operands had the same size, otherwise and exception
+     */
+    inline NBitValuesContainer operator^(const NBitValuesContainer& lOperand, const NBitValuesContainer& rOperand) {
+        auto bitwiseXorResult = lOperand;
+        if (!bitwiseXorResult.applyBitwiseXor(rOperand)) {
+            throw std::invalid_argument("Operands of bitwise XOR operation must store the same number of bits");
+        }
+        return bitwiseXorResult;
+    }
+
     /**
      * @brief Perform a bitwise comparison between two containers container.
      * @param lOperand The left operand of the equality operation
@@ -180,14 +435,13 @@ namespace syrec {
      * @return Whether the two objects store the same number of bits and are bitwise equal
      */
     inline bool operator==(const NBitValuesContainer& lOperand, const NBitValuesContainer& rOperand) {
-        if (lOperand.size() != rOperand.size()) {
-            return false;
-        }
-
-        bool equal = true;
-        for (std::size_t i = 0; i < lOperand.size() && equal; ++i) {
-            equal = lOperand[i] == rOperand[i];
-        }
-        return equal;
+        return lOperand.size() == rOperand.size() && std::ranges::equal(lOperand.getWords(), rOperand.getWords());
     }
 }; // namespace syrec
+
+template<>
+struct std::hash<syrec::NBitValuesContainer> {
+    std::size_t operator()(const syrec::NBitValuesContainer& container) const noexcept {
+        return container.hash();
+    }
+};
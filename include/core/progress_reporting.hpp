@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+namespace syrec {
+    /**
+     * The progress of a long-running computation (i.e. a synthesis or simulation), with all counters not tracked by the reporting computation remaining zero.
+     */
+    struct ProgressReport {
+        /**
+         * The number of statements synthesized so far, including the statements of the bodies of expanded module calls and of every unrolled or replayed loop iteration.
+         */
+        std::size_t numProcessedStatements = 0;
+        /**
+         * The estimated total number of statements of the synthesis (see ResourceEstimate::numStatements), zero if no estimate is available. Since the statements of reused module calls are not synthesized again, the estimate is an upper bound of the number of processed statements.
+         */
+        std::size_t estimatedNumStatements = 0;
+        /**
+         * The number of quantum operations emitted so far.
+         */
+        std::size_t numEmittedQuantumOperations = 0;
+        /**
+         * The estimated total number of quantum operations emitted by the synthesis (see ResourceEstimate::numQuantumOperations), zero if no estimate is available.
+         */
+        std::size_t estimatedNumQuantumOperations = 0;
+        /**
+         * The number of input patterns simulated so far.
+         */
+        std::size_t numSimulatedPatterns = 0;
+        /**
+         * The total number of input patterns of the simulation.
+         */
+        std::size_t numPatterns = 0;
+        /**
+         * The number of nodes of the decision diagram processed so far by the DD-based synthesis.
+         */
+        std::size_t numProcessedDdNodes = 0;
+    };
+
+    /**
+     * Callback invoked periodically with the progress of a long-running computation, which is invoked on the thread performing the computation.
+     */
+    using ProgressCallback = std::function<void(const ProgressReport& report)>;
+
+    /**
+     * @brief Forward the progress of a computation to a callback at most once per defined interval.
+     *
+     * Determining whether a report is due only requires to read the steady clock, the progress can thus be reported at the granularity of the iterations of the hot loops of a computation while the report itself is only assembled if it is forwarded to the callback.
+     * The reporter is not thread-safe and should thus only be used by the thread performing the computation.
+     */
+    class ProgressReporter {
+    public:
+        ProgressReporter(ProgressCallback callback, const std::chrono::milliseconds minDurationBetweenReports):
+            callback(std::move(callback)), minDurationBetweenReports(minDurationBetweenReports), timeOfLastReport(std::chrono::steady_clock::now()) {}
+
+        /**
+         * @brief Forward the progress determined by the given function to the callback if the minimum duration between two reports elapsed since the last report.
+         * @param determineReport The function assembling the report, which is only invoked if the report is forwarded to the callback.
+         */
+        template<typename DetermineReport>
+        void reportIfDue(const DetermineReport& determineReport) {
+            if (!callback) {
+                return;
+            }
+            if (const auto now = std::chrono::steady_clock::now(); now - timeOfLastReport >= minDurationBetweenReports) {
+                timeOfLastReport = now;
+                callback(determineReport());
+            }
+        }
+
+        /**
+         * @brief Forward the given progress to the callback regardless of the time elapsed since the last report, i.e. to report the final progress of the computation.
+         */
+        void report(const ProgressReport& progressReport) {
+            if (callback) {
+                timeOfLastReport = std::chrono::steady_clock::now();
+                callback(progressReport);
+            }
+        }
+
+    protected:
+        ProgressCallback                      callback;
+        std::chrono::milliseconds             minDurationBetweenReports;
+        std::chrono::steady_clock::time_point timeOfLastReport;
+    };
+} // namespace syrec
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace syrec {
+    /**
+     * A compact storage of the annotations of a sequence of quantum operations.
+     *
+     * Since the quantum operations synthesized for a single statement usually share the same annotations, every distinct set of annotations is only stored once and the table only records one entry per
+     * contiguous range of quantum operations with identical annotations. The annotations of a quantum operation are thus determined by a binary search over these ranges.
+     * Sets of annotations that are no longer referenced by any range are kept until the table is destroyed.
+     *
+     * The line number of the statement whose synthesis generated a quantum operation changes for nearly every synthesized statement, thus it is not stored in the sets of annotations but as an integer of the ranges.
+     * This avoids the creation of a new set of annotations (and the conversion of the line number to a string) per statement, the ranges of two quantum operations are only merged if both their annotations and
+     * their statement line numbers are identical.
+     */
+    class QuantumOperationAnnotationsTable {
+    public:
+        using QuantumOperationAnnotationsLookup = std::map<std::string, std::string, std::less<>>;
+
+        QuantumOperationAnnotationsTable();
+
+        /**
+         * Get the number of quantum operations covered by the table.
+         * @return The number of covered quantum operations.
+         */
+        [[nodiscard]] std::size_t size() const noexcept {
+            return numQuantumOperations;
+        }
+
+        /**
+         * Change the number of quantum operations covered by the table. Newly covered quantum operations have no annotations.
+         * @param numQuantumOperations The new number of covered quantum operations.
+         */
+        void resize(std::size_t numQuantumOperations);
+
+        /**
+         * Get the annotations of a quantum operation.
+         * @param position The position of the quantum operation in the table.
+         * @return The annotations of the quantum operation, an empty lookup if the position is not covered by the table.
+         * @remark The returned reference is valid until the table is destroyed.
+         */
+        [[nodiscard]] const QuantumOperationAnnotationsLookup& getAnnotationsOfQuantumOperation(std::size_t position) const;
+
+        /**
+         * Get the id of the set of annotations of a quantum operation. Quantum operations with identical annotations share the same id.
+         * @param position The position of the quantum operation in the table.
+         * @return The id of the annotations of the quantum operation, the id of the empty set of annotations if the position is not covered by the table.
+         * @remark The id of a set of annotations is not changed until the table is destroyed.
+         */
+        [[nodiscard]] std::size_t getAnnotationsIdOfQuantumOperation(std::size_t position) const;
+
+        /**
+         * Get the set of annotations with a given id.
+         * @param annotationsId The id of the set of annotations.
+         * @return The set of annotations, an empty lookup if no set with the given id exists.
+         * @remark The returned reference is valid until the table is destroyed.
+         */
+        [[nodiscard]] const QuantumOperationAnnotationsLookup& getAnnotationsWithId(std::size_t annotationsId) const;
+
+        /**
+         * Get the line number of the statement whose synthesis generated a quantum operation.
+         * @param position The position of the quantum operation in the table.
+         * @return The statement line number of the quantum operation, std::nullopt if no statement line number was set or the position is not covered by the table.
+         */
+        [[nodiscard]] std::optional<unsigned> getStatementLineNumberOfQuantumOperation(std::size_t position) const;
+
+        /**
+         * Set or update a single annotation of a quantum operation.
+         * @param position The position of the quantum operation in the table.
+         * @param annotationKey The key of the annotation.
+         * @param annotationValue The value of the annotation.
+         * @return Whether the position was covered by the table.
+         */
+        [[maybe_unused]] bool setOrUpdateAnnotationOfQuantumOperation(std::size_t position, const std::string_view& annotationKey, const std::string& annotationValue);
+
+        /**
+         * Set or update the annotations of all quantum operations in a range of positions. The annotations of the first lookup are applied before the ones of the second lookup, thus annotations of the second lookup take precedence.
+         * @param firstPosition The position of the first quantum operation to annotate.
+         * @param lastPosition The position of the last quantum operation to annotate.
+         * @param firstAnnotationsToApply The first set of annotations to apply.
+         * @param secondAnnotationsToApply The second set of annotations to apply.
+         * @param statementLineNumberToApply The statement line number to apply, the statement line numbers of the quantum operations are not modified if no value is provided.
+         * @return Whether the range was covered by the table and the first position was not larger than the last one.
+         */
+        [[maybe_unused]] bool setOrUpdateAnnotationsOfQuantumOperations(std::size_t firstPosition, std::size_t lastPosition, const QuantumOperationAnnotationsLookup& firstAnnotationsToApply, const QuantumOperationAnnotationsLookup& secondAnnotationsToApply, const std::optional<unsigned>& statementLineNumberToApply = std::nullopt);
+
+        /**
+         * Copy the annotations of a range of quantum operations to another range of quantum operations.
+         * @param firstSourcePosition The position of the first quantum operation whose annotations are copied.
+         * @param firstTargetPosition The position of the first quantum operation to which the annotations are copied.
+         * @param numQuantumOperations The number of quantum operations in both ranges.
+         * @return Whether both ranges were covered by the table.
+         */
+        [[maybe_unused]] bool copyAnnotationsOfQuantumOperations(std::size_t firstSourcePosition, std::size_t firstTargetPosition, std::size_t numQuantumOperations);
+
+        /**
+         * Remove the annotations of the first quantum operations of the table with the annotations of the remaining quantum operations being moved to the front of the table.
+         * @param numQuantumOperations The number of removed quantum operations.
+         */
+        void eraseFirstQuantumOperations(std::size_t numQuantumOperations);
+
+        /**
+         * Remove the annotations of some of the quantum operations of the table while preserving the order of the annotations of the remaining quantum operations.
+         * @param isQuantumOperationRemoved Whether the quantum operation at a given position is removed. Positions not covered by this container are not removed.
+         */
+        void eraseQuantumOperations(const std::vector<bool>& isQuantumOperationRemoved);
+
+        /**
+         * Reorder the annotations of the quantum operations of the table.
+         * @param previousPositionPerPosition The position, prior to the reordering, of the quantum operation at a given position after the reordering. Must be a permutation of the covered positions.
+         * @return Whether the number of positions matched the number of covered quantum operations and every covered position was contained exactly once, the table is not modified otherwise.
+         */
+        [[maybe_unused]] bool reorderQuantumOperations(const std::vector<std::size_t>& previousPositionPerPosition);
+
+        /**
+         * Estimate the number of bytes held by the table, i.e. by its distinct sets of annotations and its ranges of quantum operations sharing the same annotations (see syrec::MemoryUsage::numBytesOfQuantumOperationAnnotations).
+         * @return The estimated number of bytes.
+         */
+        [[nodiscard]] std::size_t determineNumBytes() const;
+
+    protected:
+        struct AnnotationsRange {
+            std::size_t             firstPosition;
+            std::size_t             annotationsId;
+            std::optional<unsigned> statementLineNumber;
+
+            [[nodiscard]] bool hasSameAnnotationsAs(const AnnotationsRange& other) const noexcept {
+                return annotationsId == other.annotationsId && statementLineNumber == other.statementLineNumber;
+            }
+        };
+
+        // The key of the lookup is a distinct set of annotations while the value is its id. The set of annotations with id i is stored in the i-th entry of annotationsPerId.
+        std::map<QuantumOperationAnnotationsLookup, std::size_t> idPerAnnotations;
+        std::vector<const QuantumOperationAnnotationsLookup*>    annotationsPerId;
+
+        // The ranges are sorted by their first position with a range ending at the first position of the next range (or at the number of covered quantum operations for the last range). Adjacent ranges never share the same annotations
+        // and statement line number.
+        std::vector<AnnotationsRange> annotationsRanges;
+        std::size_t                   numQuantumOperations = 0;
+
+        /**
+         * Determine the id of a set of annotations, the set is stored in the table if it did not exist yet.
+         * @param annotations The set of annotations.
+         * @return The id of the set of annotations.
+         */
+        [[nodiscard]] std::size_t internAnnotations(QuantumOperationAnnotationsLookup annotations);
+
+        /**
+         * Determine the index of the range containing a covered position.
+         * @param position The covered position.
+         * @return The index of the range containing the position.
+         */
+        [[nodiscard]] std::size_t determineIndexOfRangeContainingPosition(std::size_t position) const;
+
+        /**
+         * Determine the position after the last position of a range.
+         * @param indexOfRange The index of the range.
+         * @return The position after the last position of the range.
+         */
+        [[nodiscard]] std::size_t determineEndOfRange(std::size_t indexOfRange) const noexcept;
+
+        /**
+         * Assign a set of annotations and a statement line number to all quantum operations in a range of covered positions while merging the resulting range with adjacent ranges sharing the same annotations and statement line number.
+         * @param firstPosition The first position of the range.
+         * @param endPosition The position after the last position of the range.
+         * @param annotationsId The id of the assigned set of annotations.
+         * @param statementLineNumber The assigned statement line number.
+         */
+        void assignAnnotationsToPositions(std::size_t firstPosition, std::size_t endPosition, std::size_t annotationsId, const std::optional<unsigned>& statementLineNumber);
+    };
+} // namespace syrec
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "ir/operations/Operation.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace syrec {
+    /**
+     * A consumer of the quantum operations of a syrec::AnnotatableQuantumComputation that are no longer retained by the latter (i.e. to write the quantum operations to a file, to simulate them or to determine their cost) which allows
+     * the synthesis of a SyReC program without the need to store all synthesized quantum operations in memory.
+     */
+    class QuantumOperationSink {
+    public:
+        using ptr                               = std::shared_ptr<QuantumOperationSink>;
+        using QuantumOperationAnnotationsLookup = std::map<std::string, std::string, std::less<>>;
+
+        QuantumOperationSink()          = default;
+        virtual ~QuantumOperationSink() = default;
+        // Prevent object slicing when trying to copy assign or copy construct base class object from derived class object.
+        QuantumOperationSink(const QuantumOperationSink&)            = delete;
+        QuantumOperationSink& operator=(const QuantumOperationSink&) = delete;
+        QuantumOperationSink(QuantumOperationSink&&)                 = default;
+        QuantumOperationSink& operator=(QuantumOperationSink&&)      = default;
+
+        /**
+         * Consume the next quantum operation of the quantum computation, the quantum operations are consumed in the order of their occurrence in the quantum computation.
+         * @param quantumOperation The consumed quantum operation which is only valid during this call.
+         * @param annotationsOfQuantumOperation The annotations of the consumed quantum operation (empty if the generation of quantum operation annotations is disabled).
+         * @return Whether the quantum operation could be consumed.
+         */
+        [[nodiscard]] virtual bool consumeQuantumOperation(const qc::Operation& quantumOperation, const QuantumOperationAnnotationsLookup& annotationsOfQuantumOperation) = 0;
+
+        /**
+         * Notify the sink that all quantum operations of the quantum computation were consumed.
+         * @param numQubits The number of qubits of the quantum computation after all quantum operations were consumed (qubits can be added to the quantum computation after some quantum operations were already consumed).
+         * @return Whether the sink could finish the processing of the consumed quantum operations.
+         */
+        [[nodiscard]] virtual bool finish(std::size_t numQubits) = 0;
+    };
+} // namespace syrec
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "core/module_call_tree.hpp"
 #include "core/syrec/module.hpp"
 
 #include <cstddef>
@@ -48,6 +49,18 @@ namespace syrec {
             [[nodiscard]] std::optional<std::string> stringifySignatureOfCalledModule() const;
         };
 
+        QubitInliningStack() = default;
+
+        /**
+         * Create a view of the inline stack of a node of a module call tree, i.e. the stack whose entries are the target modules on the path from the root node of the tree to the given node.
+         *
+         * The entries of the stack are only created once an entry is fetched from or the stack is modified, until then the view only references the node of the tree.
+         * @param moduleCallTree The module call tree containing the node.
+         * @param moduleCallTreeNodeId The identifier of the node in the module call tree.
+         * @remark A view of a node that does not exist in the module call tree is equal to an empty stack.
+         */
+        QubitInliningStack(std::shared_ptr<const ModuleCallTree> moduleCallTree, ModuleCallTree::NodeId moduleCallTreeNodeId);
+
         /**
          * Push a new element onto the stack
          * @param inlineStackEntry The element to push
@@ -75,7 +88,31 @@ namespace syrec {
          */
         [[nodiscard]] QubitInliningStackEntry* getStackEntryAt(std::size_t idx);
 
+        /**
+         * Determine whether the target module of every entry of the stack is set without creating the entries of a view of a module call tree node.
+         * @return Whether the target module of every entry of the stack is set.
+         */
+        [[nodiscard]] bool areTargetModulesOfAllStackEntriesSet() const;
+
+        /**
+         * Estimate the number of bytes held by the stack, excluding the target modules of its entries and the module call tree referenced by a view (see syrec::MemoryUsage::numBytesOfInlineStacks).
+         * @return The estimated number of bytes.
+         */
+        [[nodiscard]] std::size_t determineNumBytes() const;
+
     protected:
         std::vector<QubitInliningStackEntry> stackEntries;
+        /**
+         * The module call tree whose node defines the entries of the stack that were not created yet, nullptr if the entries of the stack were already created.
+         */
+        std::shared_ptr<const ModuleCallTree> moduleCallTree;
+        ModuleCallTree::NodeId                moduleCallTreeNodeId = 0;
+
+        /**
+         * Create the entries of the stack from the path from the root node of the module call tree to the referenced node.
+         *
+         * The call information of an entry is stored in the module call tree node of the called module while the entries of the stack store said information in the entry of the calling module.
+         */
+        void createStackEntriesFromModuleCallTree();
     };
 } // namespace syrec
@@ -10,14 +10,244 @@
 
 #pragma once
 
+#include "core/execution_limits.hpp"
+#include "core/memory_accounting.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+
 namespace syrec {
+    /**
+     * The statistics of a pass of the optimization pipeline applied by syrec::OptimizationPassManager, accumulated over all applications of the pass.
+     */
+    struct OptimizationPassStatistics {
+        /**
+         * The number of applications of the pass.
+         */
+        std::size_t numApplications = 0;
+
+        /**
+         * The number of modifications of the quantum computation reported by the pass.
+         */
+        std::size_t numModifications = 0;
+
+        /**
+         * The runtime of the pass in nanoseconds.
+         */
+        std::uint64_t runtimeInNanoseconds = 0;
+
+        /**
+         * The number of quantum operations removed by the pass (which is negative if the pass increased the number of quantum operations).
+         */
+        std::int64_t numRemovedQuantumOperations = 0;
+
+        /**
+         * The number of qubits removed by the pass (which is negative if the pass increased the number of qubits).
+         */
+        std::int64_t numRemovedQubits = 0;
+
+        [[nodiscard]] bool operator==(const OptimizationPassStatistics& other) const = default;
+    };
+
     /**
      * An object to store collected statistics during parsing/synthesis.
+     *
+     * Every processing step (i.e. the parsing, the synthesis or the simulation) only overwrites the statistics it records, thus the same object can be used to collect the statistics of all steps of a pipeline processing a SyReC program.
+     * The runtime of the whole processing step is only recorded by the synthesis and the simulation.
      */
     struct Statistics {
         /**
          * The measured runtime in milliseconds.
          */
         double runtimeInMilliseconds = 0;
+
+        /**
+         * The measured runtime in nanoseconds.
+         */
+        std::uint64_t runtimeInNanoseconds = 0;
+
+        /**
+         * The runtime of the syntactic analysis of a SyReC program by the parser in nanoseconds.
+         */
+        std::uint64_t parsingRuntimeInNanoseconds = 0;
+
+        /**
+         * The runtime of the semantic checks performed by the parser, which also creates the IR of the SyReC program, in nanoseconds.
+         */
+        std::uint64_t semanticCheckRuntimeInNanoseconds = 0;
+
+        /**
+         * The runtime of the synthesis of the statements of a SyReC program in nanoseconds.
+         */
+        std::uint64_t synthesisRuntimeInNanoseconds = 0;
+
+        /**
+         * The runtime of the optimizations applied to the quantum computation after the synthesis of a SyReC program in nanoseconds.
+         */
+        std::uint64_t optimizationRuntimeInNanoseconds = 0;
+
+        /**
+         * The number of ancillary qubits that were reused instead of generating new ancillary qubits during the synthesis.
+         */
+        std::size_t numReusedAncillaryQubits = 0;
+
+        /**
+         * The number of expressions whose ancillary qubits were reset, by replaying the quantum operations synthesized for the expression in reverse order, to be reused during the synthesis.
+         */
+        std::size_t numUncomputedExpressions = 0;
+
+        /**
+         * The number of quantum operations synthesized to reset the ancillary qubits of the uncomputed expressions (i.e. the number of quantum operations traded for the reused ancillary qubits).
+         */
+        std::size_t numQuantumOperationsOfUncomputedExpressions = 0;
+
+        /**
+         * The number of quantum operations removed by the cancellation of adjacent self-inverse quantum operations after the synthesis.
+         */
+        std::size_t numCancelledQuantumOperations = 0;
+
+        /**
+         * The number of qubits of the synthesized quantum computation.
+         */
+        std::size_t numQubits = 0;
+
+        /**
+         * The number of ancillary qubits allocated during the synthesis.
+         */
+        std::size_t numAncillaryQubits = 0;
+
+        /**
+         * The number of quantum operations of the synthesized quantum computation, including the ones forwarded to a quantum operation sink, with the gates of a qc::CompoundOperation being counted instead of the latter.
+         */
+        std::size_t numQuantumOperations = 0;
+
+        /**
+         * The number of quantum operations of the synthesized quantum computation per gate type (i.e. 'x', 'cx', 'ccx', 'c3x', ..., 'swap', 'cswap', ...).
+         *
+         * Quantum operations forwarded to a quantum operation sink are not included.
+         */
+        std::map<std::string, std::size_t, std::less<>> numQuantumOperationsPerGateType;
+
+        /**
+         * The depth of the synthesized quantum computation (i.e. the length of the longest sequence of quantum operations in which every quantum operation shares a qubit with its successor).
+         *
+         * Quantum operations forwarded to a quantum operation sink are not included.
+         */
+        std::size_t depth = 0;
+
+        /**
+         * The number of Call-/UncallStatements for which the body of the called module was synthesized.
+         */
+        std::size_t numExpandedModuleCalls = 0;
+
+        /**
+         * The number of Call-/UncallStatements for which the quantum operations synthesized for a previous call/uncall of the same module were reused.
+         */
+        std::size_t numReusedModuleCalls = 0;
+
+        /**
+         * The number of iterations of loops whose body was synthesized.
+         */
+        std::size_t numUnrolledLoopIterations = 0;
+
+        /**
+         * The number of iterations of loops for which the quantum operations synthesized for a previous iteration were replayed with shifted qubits.
+         */
+        std::size_t numReplayedLoopIterations = 0;
+
+        /**
+         * The number of AssignStatements synthesized like in the cost aware synthesis by the hybrid synthesis.
+         */
+        std::size_t numAssignmentsSynthesizedCostAware = 0;
+
+        /**
+         * The number of AssignStatements synthesized like in the line aware synthesis by the hybrid synthesis.
+         */
+        std::size_t numAssignmentsSynthesizedLineAware = 0;
+
+        /**
+         * The estimated number of quantum operations saved by the hybrid synthesis by synthesizing AssignStatements like in the cost aware instead of the line aware synthesis.
+         */
+        std::size_t estimatedNumQuantumOperationsSavedByHybridSynthesis = 0;
+
+        /**
+         * The estimated number of ancillary qubits saved by the hybrid synthesis by synthesizing AssignStatements like in the line aware instead of the cost aware synthesis.
+         */
+        std::size_t estimatedNumAncillaryQubitsSavedByHybridSynthesis = 0;
+
+        /**
+         * The number of iterations of the optimization pipeline performed by syrec::OptimizationPassManager.
+         */
+        std::size_t numIterationsOfOptimizationPipeline = 0;
+
+        /**
+         * The statistics of every pass of the optimization pipeline performed by syrec::OptimizationPassManager, empty if no optimization pipeline was used.
+         */
+        std::map<std::string, OptimizationPassStatistics, std::less<>> statisticsPerOptimizationPass;
+
+        /**
+         * The number of synthesized SyReC programs whose quantum computation was loaded from the syrec::SynthesisResultCache used for the synthesis, recorded by the latter.
+         */
+        std::size_t numSynthesisResultCacheHits = 0;
+
+        /**
+         * The number of SyReC programs that needed to be synthesized by the syrec::SynthesisResultCache used for the synthesis, recorded by the latter.
+         */
+        std::size_t numSynthesisResultCacheMisses = 0;
+
+        /**
+         * The number of T and T^dagger gates of the quantum computation lowered to the Clifford+T gate set, recorded by syrec::lowerToCliffordT(...).
+         */
+        std::size_t numTGates = 0;
+
+        /**
+         * The T-depth of the quantum computation lowered to the Clifford+T gate set, recorded by syrec::lowerToCliffordT(...).
+         */
+        std::size_t tDepth = 0;
+
+        /**
+         * The peak resident set size of the process in bytes at the end of the processing step, zero if it could not be determined on the current platform.
+         */
+        std::size_t peakResidentSetSizeInBytes = 0;
+
+        /**
+         * The memory held by the data structures of the processing step, only recorded if requested via ConfigurableOptions::recordMemoryUsage.
+         */
+        MemoryUsage memoryUsage;
+
+        /**
+         * The execution limit (see syrec::ExecutionLimits) due to whose violation the processing step was stopped prior to its completion, in which case all other statistics only describe the part of the processing step performed until then.
+         */
+        ExecutionLimitViolation executionLimitViolation = ExecutionLimitViolation::None;
+
+        /**
+         * Record the runtime of the whole processing step in both milliseconds and nanoseconds.
+         * @param runtime The measured runtime.
+         */
+        void recordRuntime(std::chrono::steady_clock::duration runtime);
+
+        /**
+         * Record the current peak resident set size of the process.
+         */
+        void recordPeakResidentSetSize();
+
+        /**
+         * Stringify the recorded statistics as a JSON object whose keys match the names of the statistics in the Python bindings.
+         * @return The stringified JSON object.
+         */
+        [[nodiscard]] std::string toJson() const;
+
+        /**
+         * Convert a measured duration to nanoseconds.
+         * @param duration The measured duration.
+         * @return The duration in nanoseconds.
+         */
+        [[nodiscard]] static std::uint64_t toNanoseconds(const std::chrono::steady_clock::duration duration) {
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+        }
     };
 } // namespace syrec
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/syrec/number.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace syrec {
+    /**
+     * @brief A syrec::Number lowered to a form evaluable without traversing its expression tree.
+     *
+     * The loop variables of the number are replaced by the index of their slot in a dense container storing the value of every loop variable. A number whose operations are only additions,
+     * subtractions and multiplications with at most one of the operands referencing a loop variable is lowered to the affine form 'a * i + b' of a single loop variable 'i' (which is exact since
+     * these operations wrap around in the same way for unsigned integers). All other numbers are lowered to a sequence of instructions operating on a stack of operands in postfix order.
+     *
+     * The evaluation of the compiled number and the one of the number using Number::tryEvaluate(...) return the same result.
+     */
+    class CompiledNumber {
+    public:
+        /**
+         * @brief Lower a number.
+         * @param number The number to lower.
+         * @param identifierPerLoopVariableSlot The identifier of the loop variable stored in every slot, new slots are appended for loop variables not stored in any slot.
+         */
+        CompiledNumber(const Number& number, std::vector<std::string>& identifierPerLoopVariableSlot);
+
+        /**
+         * @brief Evaluate the compiled number.
+         * @param valuePerLoopVariableSlot The value of the loop variable in every slot, with std::nullopt marking a loop variable without a value.
+         * @return The value of the number if all referenced loop variables have a value and no division by zero was performed, otherwise std::nullopt.
+         */
+        [[nodiscard]] std::optional<unsigned> tryEvaluate(std::span<const std::optional<unsigned>> valuePerLoopVariableSlot) const;
+
+        [[nodiscard]] bool isAffine() const noexcept {
+            return affineForm.has_value();
+        }
+
+    protected:
+        static constexpr std::size_t MAX_INLINE_OPERAND_STACK_SIZE = 16;
+
+        struct AffineForm {
+            unsigned coefficient;
+            unsigned offset;
+            // The coefficient of a referenced loop variable can be zero (e.g. for 'i - i') while the number is still only evaluable if the loop variable has a value.
+            std::optional<std::size_t> loopVariableSlot;
+        };
+
+        enum class Opcode : std::uint8_t {
+            PushConstant,
+            PushLoopVariable,
+            Add,
+            Subtract,
+            Multiply,
+            Divide
+        };
+
+        struct Instruction {
+            Opcode opcode;
+            // The pushed constant or the slot of the pushed loop variable, unused for all other opcodes.
+            std::size_t operand;
+        };
+
+        // A number containing a constant expression with a missing operand is never evaluable.
+        bool                      isEvaluable = true;
+        std::optional<AffineForm> affineForm;
+        std::vector<Instruction>  instructions;
+        std::size_t               maxOperandStackSize = 0;
+
+        [[nodiscard]] static std::optional<AffineForm> tryLowerToAffineForm(const Number& number, std::vector<std::string>& identifierPerLoopVariableSlot);
+        [[nodiscard]] bool                             lowerToInstructions(const Number& number, std::vector<std::string>& identifierPerLoopVariableSlot, std::size_t operandStackSize);
+    };
+
+    /**
+     * @brief An evaluator of numbers storing the value of the active loop variables in dense slots.
+     *
+     * Every evaluated number is lowered to a syrec::CompiledNumber once, with the evaluator keeping the number alive to prevent the reuse of its address by another number.
+     * Constants are evaluated without being lowered. The evaluator is intended to be owned by a single synthesis and must thus not be shared between threads.
+     */
+    class CompiledNumberEvaluator {
+    public:
+        /**
+         * @brief Get the slot storing the value of a loop variable, a new slot is created if the loop variable was not stored in any slot.
+         */
+        [[nodiscard]] std::size_t getLoopVariableSlot(const std::string& loopVariableIdentifier);
+
+        void setLoopVariableValue(const std::size_t loopVariableSlot, const std::optional<unsigned> value) {
+            valuePerLoopVariableSlot.at(loopVariableSlot) = value;
+        }
+
+        [[nodiscard]] std::optional<unsigned> getLoopVariableValue(const std::size_t loopVariableSlot) const {
+            return valuePerLoopVariableSlot.at(loopVariableSlot);
+        }
+
+        /**
+         * @brief Replace the values of all loop variables (e.g. when entering and leaving the body of a called module).
+         * @param values The new value of the loop variable of every slot, a container with fewer elements than slots resets the value of the loop variables of the remaining slots.
+         * @return The previous value of the loop variable of every slot.
+         */
+        [[nodiscard]] std::vector<std::optional<unsigned>> exchangeLoopVariableValues(std::vector<std::optional<unsigned>> values);
+
+        /**
+         * @brief Evaluate a number using the current values of the loop variables.
+         * @return The value of the number if it could be evaluated, otherwise std::nullopt.
+         */
+        [[nodiscard]] std::optional<unsigned> tryEvaluate(const Number::ptr& number);
+
+        void clear();
+
+    protected:
+        std::vector<std::string>                                                  identifierPerLoopVariableSlot;
+        std::vector<std::optional<unsigned>>                                      valuePerLoopVariableSlot;
+        std::unordered_map<const Number*, std::pair<Number::ptr, CompiledNumber>> compiledNumbers;
+    };
+} // namespace syrec
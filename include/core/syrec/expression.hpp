@@ -36,15 +36,42 @@ namespace syrec {
         using vec = std::vector<ptr>;
 
         /**
-       * @brief Standard constructor
+       * @brief Kind of an expression
+       *
+       * Every derived expression defines its kind, which allows to dispatch on the
+       * type of an expression with a switch instead of a cascade of dynamic_casts.
+       */
+        enum class Kind : std::uint8_t {
+            Numeric,
+            Variable,
+            Binary,
+            Shift,
+            Unary
+        };
+
+        /**
+       * @brief Constructor
+       *
+       * @param kind Kind of the derived expression
        */
-        Expression() = default;
+        explicit Expression(const Kind kind):
+            kind(kind) {}
 
         /**
        * @brief Standard destructor
        */
         virtual ~Expression() = default;
 
+        /**
+       * @brief Kind of the expression
+       *
+       * @return Kind of the derived expression
+       */
+        [[nodiscard]] Kind getKind() const noexcept {
+            return kind;
+        }
+
+
         /**
        * @brief Bit-width of the expression
        *
@@ -53,12 +80,17 @@ namespace syrec {
        * @return Bit-width of the expression
        */
         [[nodiscard]] virtual unsigned bitwidth() const = 0;
+
+    private:
+        Kind kind;
     };
 
     /**
      * @brief Numeric Expression
      */
     struct NumericExpression: Expression {
+        static constexpr Kind KIND = Kind::Numeric;
+
         /**
        * @brief Creates a numeric expression with a value and a bit-width
        *
@@ -66,7 +98,7 @@ namespace syrec {
        * @param bitwidth Bit-width of the value
        */
         NumericExpression(Number::ptr value, unsigned bitwidth):
-            value(std::move(value)), bwidth(bitwidth) {}
+            Expression(KIND), value(std::move(value)), bwidth(bitwidth) {}
 
         [[nodiscard]] unsigned bitwidth() const override {
             return bwidth;
@@ -83,13 +115,15 @@ namespace syrec {
      * capsulates a variable access pointer var().
      */
     struct VariableExpression: Expression {
+        static constexpr Kind KIND = Kind::Variable;
+
         /**
        * @brief Constructor with variable
        *
        * @param var Variable access
        */
         explicit VariableExpression(VariableAccess::ptr var):
-            var(std::move(var)) {}
+            Expression(KIND), var(std::move(var)) {}
 
         [[nodiscard]] unsigned bitwidth() const override {
             return var->bitwidth();
@@ -105,6 +139,8 @@ namespace syrec {
      * expressions lhs() and rhs() by an operation op().
      */
     struct BinaryExpression: Expression {
+        static constexpr Kind KIND = Kind::Binary;
+
         /**
        * @brief Operation to perform
        */
@@ -211,7 +247,7 @@ namespace syrec {
         BinaryExpression(ptr                   lhs,
                          const BinaryOperation binaryOperation,
                          ptr                   rhs):
-            lhs(std::move(lhs)),
+            Expression(KIND), lhs(std::move(lhs)),
             binaryOperation(binaryOperation), rhs(std::move(rhs)) {}
 
         /**
@@ -254,6 +290,8 @@ namespace syrec {
      * sub-expression lhs() and a number rhs() by a shift operation op().
      */
     struct ShiftExpression: Expression {
+        static constexpr Kind KIND = Kind::Shift;
+
         /**
        * @brief Shift Operation
        */
@@ -283,7 +321,7 @@ namespace syrec {
         ShiftExpression(ptr                  lhs,
                         const ShiftOperation shiftOperation,
                         Number::ptr          rhs):
-            lhs(std::move(lhs)),
+            Expression(KIND), lhs(std::move(lhs)),
             shiftOperation(shiftOperation), rhs(std::move(rhs)) {}
 
         /**
@@ -304,13 +342,15 @@ namespace syrec {
     };
 
     struct UnaryExpression: Expression {
+        static constexpr Kind KIND = Kind::Unary;
+
         enum class UnaryOperation : std::uint8_t {
             LogicalNegation,
             BitwiseNegation
         };
 
         UnaryExpression(const UnaryOperation op, ptr expr):
-            unaryOperation(op), expr(std::move(expr)) {}
+            Expression(KIND), unaryOperation(op), expr(std::move(expr)) {}
 
         [[nodiscard]] unsigned bitwidth() const override {
             return unaryOperation == UnaryOperation::LogicalNegation ? 1 : expr->bitwidth();
@@ -319,4 +359,36 @@ namespace syrec {
         UnaryOperation unaryOperation;
         ptr            expr;
     };
+
+    /**
+     * @brief Cast a expression to a derived expression type by comparing its kind instead of using a dynamic_cast
+     *
+     * @param expression The expression to cast
+     * @return Pointer to the derived expression if the expression was not nullptr and its kind matched the kind of the derived expression type, otherwise nullptr
+     */
+    template<typename DerivedExpression>
+    [[nodiscard]] DerivedExpression* expressionCast(Expression* expression) noexcept {
+        return expression != nullptr && expression->getKind() == DerivedExpression::KIND ? static_cast<DerivedExpression*>(expression) : nullptr;
+    }
+
+    template<typename DerivedExpression>
+    [[nodiscard]] const DerivedExpression* expressionCast(const Expression* expression) noexcept {
+        return expression != nullptr && expression->getKind() == DerivedExpression::KIND ? static_cast<const DerivedExpression*>(expression) : nullptr;
+    }
+
+    /**
+     * @brief Cast a smart pointer of a expression to a smart pointer of a derived expression type by comparing its kind instead of using a std::dynamic_pointer_cast
+     *
+     * @param expression The expression to cast
+     * @return Smart pointer to the derived expression sharing the ownership with the given smart pointer if the expression was not nullptr and its kind matched the kind of the derived expression type, otherwise nullptr
+     */
+    template<typename DerivedExpression>
+    [[nodiscard]] std::shared_ptr<DerivedExpression> expressionPointerCast(const std::shared_ptr<Expression>& expression) noexcept {
+        return expression != nullptr && expression->getKind() == DerivedExpression::KIND ? std::static_pointer_cast<DerivedExpression>(expression) : nullptr;
+    }
+
+    template<typename DerivedExpression>
+    [[nodiscard]] std::shared_ptr<const DerivedExpression> expressionPointerCast(const std::shared_ptr<const Expression>& expression) noexcept {
+        return expression != nullptr && expression->getKind() == DerivedExpression::KIND ? std::static_pointer_cast<const DerivedExpression>(expression) : nullptr;
+    }
 } // namespace syrec
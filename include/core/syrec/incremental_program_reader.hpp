@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/configurable_options.hpp"
+#include "core/statistics.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/parser/utils/syrec_operation_utils.hpp"
+#include "core/syrec/program.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace syrec {
+    /**
+     * @brief A reader of successive revisions of a SyReC program (i.e. the content of an editor) that only re-parses the module declarations changed since the last read revision.
+     *
+     * The text of a revision is split into its module declarations, each starting at its 'module' keyword, by only lexing the revision. The declarations that differ from the ones of the previously
+     * read revision are parsed and semantically checked with all other modules of the previous revision being declared in the symbol table of the parser. Afterwards, the overload resolution of the
+     * call- and uncall-statements of the unchanged modules is repeated to account for any changed signature of their callees and the line numbers of the statements of unchanged modules located after
+     * the changed ones are updated. The result of the parser is equal to the one of a syrec::ProgramReader parsing the whole revision, which is used instead if:
+     * - no revision, or a revision with errors, was read before or the parser relevant fields of the syrec::ConfigurableOptions changed since the last read revision.
+     * - the revision is not ASCII encoded or the re-parsed declarations contain any error (whose reported positions and order should match the one of a full parse).
+     * - the updated program does not contain exactly one module whose identifier matches the one of the program entry point (either the user defined one or 'main').
+     * - the overload resolution of any call of an unchanged module fails.
+     *
+     * The modules of the unchanged declarations are shared between successively read programs, the modules of programs read by this reader should thus not be modified (i.e. by syrec::simplifyProgram(...))
+     * unless reset() is called prior to the next read. A reader can only read one program at a time and must thus not be shared between threads.
+     */
+    class IncrementalProgramReader {
+    public:
+        /**
+         * @brief Read and parse a revision of a SyReC program from a string by only re-parsing the module declarations changed since the last read revision.
+         *
+         * @param program The program in which the modules of the parsed SyReC program are stored.
+         * @param stringifiedProgram A stringified SyReC program string.
+         * @param settings The configuration to use by the parser.
+         * @param optionalRecordedStatistics An optional container in which the runtimes of the syntactic analysis and the semantic checks of the parser are recorded (only covering the re-parsed declarations).
+         * @return A std::string containing the list of errors found during the parsing of the SyReC program.
+         */
+        std::string readFromString(Program& program, const std::string_view& stringifiedProgram, const ConfigurableOptions& settings = ConfigurableOptions{}, Statistics* optionalRecordedStatistics = nullptr);
+
+        /**
+         * @brief Forget the last read revision, causing the next read revision to be fully parsed.
+         */
+        void reset();
+
+        /**
+         * @brief Get the number of modules that were parsed during the last read.
+         */
+        [[nodiscard]] std::size_t getNumParsedModulesOfLastRead() const noexcept {
+            return numParsedModulesOfLastRead;
+        }
+
+        /**
+         * @brief Determine whether only the changed module declarations were parsed during the last read.
+         */
+        [[nodiscard]] bool wasLastReadIncremental() const noexcept {
+            return wasLastReadPerformedIncrementally;
+        }
+
+    protected:
+        struct ParserRelevantOptions {
+            unsigned                                  defaultBitwidth;
+            utils::IntegerConstantTruncationOperation integerConstantTruncationOperation;
+            bool                                      allowAccessOnAssignedToVariablePartsInDimensionAccessOfVariableAccess;
+            std::optional<std::string>                optionalProgramEntryPointModuleIdentifier;
+            bool                                      allocateIrNodesInArena;
+            std::optional<std::size_t>                optionalMaxNumReportedParserErrors;
+
+            [[nodiscard]] bool operator==(const ParserRelevantOptions& other) const = default;
+        };
+
+        struct ModuleDeclaration {
+            // The text of the declaration including all whitespace and comments up to the next declaration, the first declaration also includes the text preceding it.
+            std::string text;
+            // The number of lines preceding the declaration in the program.
+            std::size_t numPrecedingLines;
+            Module::ptr module;
+        };
+
+        ProgramReader                        reader;
+        std::optional<ParserRelevantOptions> parserRelevantOptionsOfLastRead;
+        std::vector<ModuleDeclaration>       moduleDeclarationsOfLastRead;
+        std::size_t                          numParsedModulesOfLastRead        = 0;
+        bool                                 wasLastReadPerformedIncrementally = false;
+
+        [[nodiscard]] static ParserRelevantOptions         getParserRelevantOptions(const ConfigurableOptions& settings);
+        [[nodiscard]] bool                                 tryReadIncrementally(Program& program, const std::string_view& stringifiedProgram, const std::vector<std::string_view>& moduleDeclarations, const ConfigurableOptions& settings, Statistics* optionalRecordedStatistics);
+        [[nodiscard]] std::string                          readFully(Program& program, const std::string_view& stringifiedProgram, const std::optional<std::vector<std::string_view>>& moduleDeclarations, const ConfigurableOptions& settings, Statistics* optionalRecordedStatistics);
+        void                                               recordModuleDeclarations(const std::vector<std::string_view>& moduleDeclarations, const Module::vec& modules);
+    };
+} // namespace syrec
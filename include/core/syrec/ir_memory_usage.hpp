@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/syrec/module.hpp"
+
+#include <cstddef>
+
+namespace syrec {
+    /**
+     * @brief Estimate the number of bytes held by the IR of the given modules (see syrec::MemoryUsage::numBytesOfProgram).
+     *
+     * Every IR node is counted together with the control block of the std::shared_ptr managing it and the heap storage of its strings and containers. Nodes shared by multiple owners (i.e. the variables referenced by variable accesses or the modules called by Call-/UncallStatements) are only counted once.
+     * @param modules The modules of a SyReC program.
+     * @return The estimated number of bytes.
+     */
+    [[nodiscard]] std::size_t determineNumBytesOfIr(const Module::vec& modules);
+} // namespace syrec
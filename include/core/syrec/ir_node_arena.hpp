@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+namespace syrec {
+    /**
+     * A bump allocator for the nodes of the SyReC IR (i.e. expressions, statements, numbers, variables, variable accesses) of a single program.
+     *
+     * The nodes are allocated, together with the control block of their std::shared_ptr, contiguously in blocks of geometrically growing size. The memory of a node is not released when the node
+     * is destroyed but all blocks are released together when the arena is destroyed. Since every node allocated in the arena keeps the latter alive, the arena is destroyed once the program and all
+     * other owners of the nodes of the program were destroyed. Existing users of the IR are thus not affected by the allocation strategy of the nodes.
+     *
+     * The allocation of nodes is not thread-safe while the destruction of nodes allocated in the same arena from multiple threads is safe.
+     */
+    class IrNodeArena {
+    public:
+        using ptr = std::shared_ptr<IrNodeArena>;
+
+        static constexpr std::size_t DEFAULT_INITIAL_BLOCK_SIZE_IN_BYTES = 64U * 1024U;
+
+        explicit IrNodeArena(const std::size_t initialBlockSizeInBytes = DEFAULT_INITIAL_BLOCK_SIZE_IN_BYTES):
+            memoryResource(initialBlockSizeInBytes) {}
+
+        IrNodeArena(const IrNodeArena&)            = delete;
+        IrNodeArena& operator=(const IrNodeArena&) = delete;
+        IrNodeArena(IrNodeArena&&)                 = delete;
+        IrNodeArena& operator=(IrNodeArena&&)      = delete;
+        ~IrNodeArena()                             = default;
+
+        /**
+         * An allocator for std::allocate_shared using the memory of an arena. Every copy of the allocator (including the one stored in the control block of an allocated node) owns the arena.
+         */
+        template<typename T>
+        class Allocator {
+        public:
+            using value_type = T;
+
+            explicit Allocator(IrNodeArena::ptr arena) noexcept:
+                arena(std::move(arena)) {}
+
+            template<typename U>
+            // Implicit conversion is required by the allocator requirements to be able to rebind the allocator to the type of the control block
+            // NOLINTNEXTLINE(google-explicit-constructor)
+            Allocator(const Allocator<U>& other) noexcept:
+                arena(other.getArena()) {}
+
+            [[nodiscard]] T* allocate(const std::size_t numElements) {
+                return static_cast<T*>(arena->memoryResource.allocate(numElements * sizeof(T), alignof(T)));
+            }
+
+            // The memory of the arena is only released when the arena is destroyed
+            void deallocate([[maybe_unused]] T* elements, [[maybe_unused]] const std::size_t numElements) noexcept {}
+
+            [[nodiscard]] const IrNodeArena::ptr& getArena() const noexcept {
+                return arena;
+            }
+
+            template<typename U>
+            [[nodiscard]] bool operator==(const Allocator<U>& other) const noexcept {
+                return arena == other.getArena();
+            }
+
+        private:
+            IrNodeArena::ptr arena;
+        };
+
+        /**
+         * Create an IR node in the given arena.
+         * @tparam T The type of the created node.
+         * @tparam Args The types of the arguments of the constructor of the created node.
+         * @param arena The arena in which the node shall be allocated. If no arena is provided, the node is allocated using std::make_shared.
+         * @param args The arguments passed to the constructor of the created node.
+         * @return A pointer to the created node.
+         */
+        template<typename T, typename... Args>
+        [[nodiscard]] static std::shared_ptr<T> makeNode(const IrNodeArena::ptr& arena, Args&&... args) {
+            if (arena == nullptr) {
+                return std::make_shared<T>(std::forward<Args>(args)...);
+            }
+            return std::allocate_shared<T>(Allocator<T>(arena), std::forward<Args>(args)...);
+        }
+
+    private:
+        std::pmr::monotonic_buffer_resource memoryResource;
+    };
+} // namespace syrec
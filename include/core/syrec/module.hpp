@@ -13,6 +13,7 @@
 #include "core/syrec/statement.hpp"
 #include "core/syrec/variable.hpp"
 
+#include <cstddef>
 #include <memory>
 #include <optional>
 #include <string>
@@ -80,6 +81,21 @@ namespace syrec {
             return std::nullopt;
         }
 
+        /**
+         * Assign the dense declaration index of every parameter and local variable of the module, with the parameters preceding the local variables in their order of declaration.
+         *
+         * The declaration indices allow the synthesis to determine the qubits of an accessed variable without a lookup using the identifier of the variable.
+         */
+        void assignDeclarationIndicesOfVariables() const {
+            std::size_t declarationIndex = 0;
+            for (const auto& parameter: parameters) {
+                parameter->declarationIndexInModule = declarationIndex++;
+            }
+            for (const auto& localVariable: variables) {
+                localVariable->declarationIndexInModule = declarationIndex++;
+            }
+        }
+
         /**
        * @brief Adds a statement to the module
        *
@@ -99,28 +99,28 @@ namespace syrec_parser {
 
         enum : std::uint8_t {
             RuleNumber                 = 0,
-            RuleProgram                = 1,
-            RuleModule                 = 2,
-            RuleParameterList          = 3,
-            RuleParameter              = 4,
-            RuleSignalList             = 5,
-            RuleSignalDeclaration      = 6,
-            RuleStatementList          = 7,
-            RuleStatement              = 8,
-            RuleCallStatement          = 9,
-            RuleLoopVariableDefinition = 10,
-            RuleLoopStepsizeDefinition = 11,
-            RuleForStatement           = 12,
-            RuleIfStatement            = 13,
-            RuleUnaryStatement         = 14,
-            RuleAssignStatement        = 15,
-            RuleSwapStatement          = 16,
-            RuleSkipStatement          = 17,
-            RuleSignal                 = 18,
-            RuleExpression             = 19,
-            RuleBinaryExpression       = 20,
-            RuleUnaryExpression        = 21,
-            RuleShiftExpression        = 22
+            RuleAtomicNumber           = 1,
+            RuleProgram                = 2,
+            RuleModule                 = 3,
+            RuleParameterList          = 4,
+            RuleParameter              = 5,
+            RuleSignalList             = 6,
+            RuleSignalDeclaration      = 7,
+            RuleStatementList          = 8,
+            RuleStatement              = 9,
+            RuleCallStatement          = 10,
+            RuleLoopVariableDefinition = 11,
+            RuleLoopStepsizeDefinition = 12,
+            RuleForStatement           = 13,
+            RuleIfStatement            = 14,
+            RuleUnaryStatement         = 15,
+            RuleAssignStatement        = 16,
+            RuleSwapStatement          = 17,
+            RuleSkipStatement          = 18,
+            RuleSignal                 = 19,
+            RuleExpression             = 20,
+            RuleBinaryExpression       = 21,
+            RuleUnaryExpression        = 22
         };
 
         explicit TSyrecParser(antlr4::TokenStream* input);
@@ -135,6 +135,7 @@ namespace syrec_parser {
         [[nodiscard]] antlr4::atn::SerializedATNView  getSerializedATN() const override;
 
         class NumberContext;
+        class AtomicNumberContext;
         class ProgramContext;
         class ModuleContext;
         class ParameterListContext;
@@ -156,7 +157,6 @@ namespace syrec_parser {
         class ExpressionContext;
         class BinaryExpressionContext;
         class UnaryExpressionContext;
-        class ShiftExpressionContext;
 
         class NumberContext: public antlr4::ParserRuleContext {
         public:
@@ -169,58 +169,78 @@ namespace syrec_parser {
             [[nodiscard]] size_t getRuleIndex() const override;
         };
 
-        class NumberFromHexLiteralContext: public NumberContext {
+        class NumberFromAtomicNumberContext: public NumberContext {
         public:
-            explicit NumberFromHexLiteralContext(NumberContext* ctx);
+            explicit NumberFromAtomicNumberContext(NumberContext* ctx);
+
+            [[nodiscard]] AtomicNumberContext* atomicNumber() const;
+        };
+
+        class NumberFromExpressionContext: public NumberContext {
+        public:
+            explicit NumberFromExpressionContext(NumberContext* ctx);
+
+            NumberContext*                            lhsOperand = nullptr;
+            antlr4::Token*                            op         = nullptr;
+            NumberContext*                            rhsOperand = nullptr;
+            [[nodiscard]] std::vector<NumberContext*> number() const;
+            [[nodiscard]] antlr4::tree::TerminalNode* literalOpPlus() const;
+            [[nodiscard]] antlr4::tree::TerminalNode* literalOpMinus() const;
+            [[nodiscard]] antlr4::tree::TerminalNode* literalOpMultiply() const;
+            [[nodiscard]] antlr4::tree::TerminalNode* literalOpDivision() const;
+        };
+
+        NumberContext* number();
+
+        class AtomicNumberContext: public antlr4::ParserRuleContext {
+        public:
+            AtomicNumberContext(ParserRuleContext* parent, size_t invokingState);
+
+            AtomicNumberContext() = default;
+            void copyFrom(AtomicNumberContext* ctx);
+            using ParserRuleContext::copyFrom;
+
+            [[nodiscard]] size_t getRuleIndex() const override;
+        };
+
+        class NumberFromHexLiteralContext: public AtomicNumberContext {
+        public:
+            explicit NumberFromHexLiteralContext(AtomicNumberContext* ctx);
 
             [[nodiscard]] antlr4::tree::TerminalNode* hexLiteral() const;
         };
 
-        class NumberFromBinaryLiteralContext: public NumberContext {
+        class NumberFromBinaryLiteralContext: public AtomicNumberContext {
         public:
-            explicit NumberFromBinaryLiteralContext(NumberContext* ctx);
+            explicit NumberFromBinaryLiteralContext(AtomicNumberContext* ctx);
 
             [[nodiscard]] antlr4::tree::TerminalNode* binaryLiteral() const;
         };
 
-        class NumberFromSignalwidthContext: public NumberContext {
+        class NumberFromSignalwidthContext: public AtomicNumberContext {
         public:
-            explicit NumberFromSignalwidthContext(NumberContext* ctx);
+            explicit NumberFromSignalwidthContext(AtomicNumberContext* ctx);
 
             [[nodiscard]] antlr4::tree::TerminalNode* literalSignalWidthPrefix() const;
             [[nodiscard]] antlr4::tree::TerminalNode* literalIdent() const;
         };
 
-        class NumberFromLoopVariableContext: public NumberContext {
+        class NumberFromLoopVariableContext: public AtomicNumberContext {
         public:
-            explicit NumberFromLoopVariableContext(NumberContext* ctx);
+            explicit NumberFromLoopVariableContext(AtomicNumberContext* ctx);
 
             [[nodiscard]] antlr4::tree::TerminalNode* literalLoopVariablePrefix() const;
             [[nodiscard]] antlr4::tree::TerminalNode* literalIdent() const;
         };
 
-        class NumberFromIntegerContext: public NumberContext {
+        class NumberFromIntegerContext: public AtomicNumberContext {
         public:
-            explicit NumberFromIntegerContext(NumberContext* ctx);
+            explicit NumberFromIntegerContext(AtomicNumberContext* ctx);
 
             [[nodiscard]] antlr4::tree::TerminalNode* integerLiteral() const;
         };
 
-        class NumberFromExpressionContext: public NumberContext {
-        public:
-            explicit NumberFromExpressionContext(NumberContext* ctx);
-
-            NumberContext*                            lhsOperand = nullptr;
-            antlr4::Token*                            op         = nullptr;
-            NumberContext*                            rhsOperand = nullptr;
-            [[nodiscard]] std::vector<NumberContext*> number() const;
-            [[nodiscard]] antlr4::tree::TerminalNode* literalOpPlus() const;
-            [[nodiscard]] antlr4::tree::TerminalNode* literalOpMinus() const;
-            [[nodiscard]] antlr4::tree::TerminalNode* literalOpMultiply() const;
-            [[nodiscard]] antlr4::tree::TerminalNode* literalOpDivision() const;
-        };
-
-        NumberContext* number();
+        AtomicNumberContext* atomicNumber();
 
         class ProgramContext: public antlr4::ParserRuleContext {
         public:
@@ -458,7 +478,7 @@ namespace syrec_parser {
         public:
             explicit ExpressionFromNumberContext(ExpressionContext* ctx);
 
-            [[nodiscard]] NumberContext* number() const;
+            [[nodiscard]] AtomicNumberContext* atomicNumber() const;
         };
 
         class ExpressionFromUnaryExpressionContext: public ExpressionContext {
@@ -468,13 +488,6 @@ namespace syrec_parser {
             [[nodiscard]] UnaryExpressionContext* unaryExpression() const;
         };
 
-        class ExpressionFromShiftExpressionContext: public ExpressionContext {
-        public:
-            explicit ExpressionFromShiftExpressionContext(ExpressionContext* ctx);
-
-            [[nodiscard]] ShiftExpressionContext* shiftExpression() const;
-        };
-
         ExpressionContext* expression();
 
         class BinaryExpressionContext: public antlr4::ParserRuleContext {
@@ -482,8 +495,11 @@ namespace syrec_parser {
             ExpressionContext* lhsOperand      = nullptr;
             antlr4::Token*     binaryOperation = nullptr;
             ExpressionContext* rhsOperand      = nullptr;
+            antlr4::Token*     shiftOperation  = nullptr;
+            NumberContext*     shiftAmount     = nullptr;
             BinaryExpressionContext(ParserRuleContext* parent, size_t invokingState);
             [[nodiscard]] size_t                      getRuleIndex() const override;
+            [[nodiscard]] NumberContext*              number() const;
             [[nodiscard]] antlr4::tree::TerminalNode* literalOpPlus() const;
             [[nodiscard]] antlr4::tree::TerminalNode* literalOpMinus() const;
             [[nodiscard]] antlr4::tree::TerminalNode* literalOpMultiply() const;
@@ -501,6 +517,8 @@ namespace syrec_parser {
             [[nodiscard]] antlr4::tree::TerminalNode* literalOpNotEqual() const;
             [[nodiscard]] antlr4::tree::TerminalNode* literalOpLessOrEqual() const;
             [[nodiscard]] antlr4::tree::TerminalNode* literalOpGreaterOrEqual() const;
+            [[nodiscard]] antlr4::tree::TerminalNode* literalOpRightShift() const;
+            [[nodiscard]] antlr4::tree::TerminalNode* literalOpLeftShift() const;
         };
 
         BinaryExpressionContext* binaryExpression();
@@ -517,19 +535,6 @@ namespace syrec_parser {
 
         UnaryExpressionContext* unaryExpression();
 
-        class ShiftExpressionContext: public antlr4::ParserRuleContext {
-        public:
-            antlr4::Token* shiftOperation = nullptr;
-            ShiftExpressionContext(ParserRuleContext* parent, size_t invokingState);
-            [[nodiscard]] size_t                      getRuleIndex() const override;
-            [[nodiscard]] ExpressionContext*          expression() const;
-            [[nodiscard]] NumberContext*              number() const;
-            [[nodiscard]] antlr4::tree::TerminalNode* literalOpRightShift() const;
-            [[nodiscard]] antlr4::tree::TerminalNode* literalOpLeftShift() const;
-        };
-
-        ShiftExpressionContext* shiftExpression();
-
         // By default the static state used to implement the parser is lazily initialized during the first
         // call to the constructor. You can call this function if you wish to initialize the static state
         // ahead of time.
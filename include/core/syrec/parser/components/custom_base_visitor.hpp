@@ -13,6 +13,7 @@
 #include "Token.h"
 #include "core/configurable_options.hpp"
 #include "core/syrec/expression.hpp"
+#include "core/syrec/ir_node_arena.hpp"
 #include "core/syrec/number.hpp"
 #include "core/syrec/parser/utils/custom_error_messages.hpp"
 #include "core/syrec/parser/utils/parser_messages_container.hpp"
@@ -21,13 +22,13 @@
 
 #include <charconv>
 #include <cstdlib>
-#include <format>
 #include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
 #include <system_error>
 #include <utility>
+#include <vector>
 
 namespace syrec_parser {
     /**
@@ -61,8 +62,8 @@ namespace syrec_parser {
      */
     class CustomBaseVisitor {
     public:
-        CustomBaseVisitor(const std::shared_ptr<ParserMessagesContainer>& sharedGeneratedMessageContainerInstance, const std::shared_ptr<utils::BaseSymbolTable>& sharedSymbolTableInstance, syrec::ConfigurableOptions parserConfiguration):
-            sharedGeneratedMessageContainerInstance(sharedGeneratedMessageContainerInstance), symbolTable(sharedSymbolTableInstance), parserConfiguration(std::move(parserConfiguration)) {}
+        CustomBaseVisitor(const std::shared_ptr<ParserMessagesContainer>& sharedGeneratedMessageContainerInstance, const std::shared_ptr<utils::BaseSymbolTable>& sharedSymbolTableInstance, syrec::ConfigurableOptions parserConfiguration, syrec::IrNodeArena::ptr sharedIrNodeArena):
+            sharedGeneratedMessageContainerInstance(sharedGeneratedMessageContainerInstance), symbolTable(sharedSymbolTableInstance), parserConfiguration(std::move(parserConfiguration)), irNodeArena(std::move(sharedIrNodeArena)) {}
 
     protected:
         static constexpr unsigned int DEFAULT_EXPRESSION_BITWIDTH   = 32;
@@ -71,6 +72,22 @@ namespace syrec_parser {
         std::shared_ptr<ParserMessagesContainer> sharedGeneratedMessageContainerInstance;
         std::shared_ptr<utils::BaseSymbolTable>  symbolTable;
         syrec::ConfigurableOptions               parserConfiguration;
+        /**
+         * The arena in which the IR nodes generated by the visitors are allocated, nullptr if the IR nodes are allocated separately.
+         */
+        syrec::IrNodeArena::ptr irNodeArena;
+
+        /**
+         * Create a node of the SyReC IR in the arena shared by all visitors (or separately if no arena is used).
+         * @tparam T The type of the created node.
+         * @tparam Args The types of the arguments of the constructor of the created node.
+         * @param args The arguments passed to the constructor of the created node.
+         * @return A pointer to the created node.
+         */
+        template<typename T, typename... Args>
+        [[nodiscard]] std::shared_ptr<T> makeIrNode(Args&&... args) const {
+            return syrec::IrNodeArena::makeNode<T>(irNodeArena, std::forward<Args>(args)...);
+        }
 
         [[nodiscard]] static Message::Position mapTokenPositionToMessagePosition(const antlr4::Token& token) {
             return Message::Position(token.getLine(), token.getCharPositionInLine());
@@ -125,7 +142,7 @@ namespace syrec_parser {
         }
 
         [[nodiscard]] static std::optional<unsigned int> tryGetConstantValueOf(const syrec::Expression& expression) {
-            if (const auto& expressionAsNumericOne = dynamic_cast<const syrec::NumericExpression*>(&expression); expressionAsNumericOne != nullptr && expressionAsNumericOne->value && expressionAsNumericOne->value) {
+            if (const auto& expressionAsNumericOne = syrec::expressionCast<syrec::NumericExpression>(&expression); expressionAsNumericOne != nullptr && expressionAsNumericOne->value && expressionAsNumericOne->value) {
                 return tryGetConstantValueOf(*expressionAsNumericOne->value);
             }
             return std::nullopt;
@@ -173,7 +190,8 @@ namespace syrec_parser {
             static_assert(!getIdentifierForSemanticError<semanticError>().empty(), "No identifiers for semantic error found!");
 
             constexpr std::string_view identifierForSemanticError = getIdentifierForSemanticError<semanticError>();
-            sharedGeneratedMessageContainerInstance->recordMessage(std::make_unique<Message>(Message::Type::Error, std::string(identifierForSemanticError), messagePosition, std::format(getFormatForSemanticErrorMessage<semanticError>(), std::forward<T>(args)...)));
+            // The message is only formatted once its text is requested, thus discarded duplicate messages or messages exceeding the limit of recorded errors are never formatted.
+            sharedGeneratedMessageContainerInstance->recordMessage(std::make_unique<Message>(Message::Type::Error, std::string(identifierForSemanticError), messagePosition, getFormatForSemanticErrorMessage<semanticError>(), std::vector<Message::Argument>{Message::makeArgument(std::forward<T>(args))...}));
         }
 
         /**
@@ -191,7 +209,7 @@ namespace syrec_parser {
             static_assert(!getIdentifierForSemanticError<semanticError>().empty(), "No identifiers for semantic error found!");
 
             constexpr std::string_view identifierForSemanticError = getIdentifierForSemanticError<semanticError>();
-            sharedGeneratedMessageContainerInstance->recordMessage(std::make_unique<Message>(Message::Type::Error, std::string(identifierForSemanticError), messagePosition, std::string(getFormatForSemanticErrorMessage<semanticError>())));
+            sharedGeneratedMessageContainerInstance->recordMessage(std::make_unique<Message>(Message::Type::Error, std::string(identifierForSemanticError), messagePosition, getFormatForSemanticErrorMessage<semanticError>(), std::vector<Message::Argument>{}));
         }
 
         /**
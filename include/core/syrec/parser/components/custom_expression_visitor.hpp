@@ -10,15 +10,18 @@
 
 #pragma once
 
+#include "ParserRuleContext.h"
 #include "TSyrecParser.h"
 #include "core/configurable_options.hpp"
 #include "core/syrec/expression.hpp"
+#include "core/syrec/ir_node_arena.hpp"
 #include "core/syrec/number.hpp"
 #include "core/syrec/parser/components/custom_base_visitor.hpp"
 #include "core/syrec/parser/utils/if_statement_expression_components_recorder.hpp"
 #include "core/syrec/parser/utils/parser_messages_container.hpp"
 #include "core/syrec/parser/utils/symbolTable/base_symbol_table.hpp"
 #include "core/syrec/parser/utils/syrec_operation_utils.hpp"
+#include "core/syrec/parser/utils/variable_overlap_check.hpp"
 #include "core/syrec/variable.hpp"
 
 #include <memory>
@@ -29,8 +32,8 @@
 namespace syrec_parser {
     class CustomExpressionVisitor: protected CustomBaseVisitor {
     public:
-        CustomExpressionVisitor(const std::shared_ptr<ParserMessagesContainer>& sharedMessagesContainerInstance, const std::shared_ptr<utils::BaseSymbolTable>& sharedSymbolTableInstance, syrec::ConfigurableOptions parserConfiguration):
-            CustomBaseVisitor(sharedMessagesContainerInstance, sharedSymbolTableInstance, std::move(parserConfiguration)) {}
+        CustomExpressionVisitor(const std::shared_ptr<ParserMessagesContainer>& sharedMessagesContainerInstance, const std::shared_ptr<utils::BaseSymbolTable>& sharedSymbolTableInstance, syrec::ConfigurableOptions parserConfiguration, const syrec::IrNodeArena::ptr& sharedIrNodeArena):
+            CustomBaseVisitor(sharedMessagesContainerInstance, sharedSymbolTableInstance, std::move(parserConfiguration), sharedIrNodeArena) {}
 
         struct DeterminedExpressionOperandBitwidthInformation {
             unsigned int                     operandBitwidth = 0;
@@ -42,15 +45,18 @@ namespace syrec_parser {
         [[nodiscard]] std::optional<syrec::Expression::ptr>        visitExpressionFromSignalTyped(const TSyrecParser::ExpressionFromSignalContext* context, std::optional<DeterminedExpressionOperandBitwidthInformation>& optionalDeterminedOperandBitwidth);
         [[nodiscard]] std::optional<syrec::Expression::ptr>        visitBinaryExpressionTyped(const TSyrecParser::BinaryExpressionContext* context, std::optional<DeterminedExpressionOperandBitwidthInformation>& optionalDeterminedOperandBitwidth);
         [[nodiscard]] std::optional<syrec::Expression::ptr>        visitUnaryExpressionTyped(const TSyrecParser::UnaryExpressionContext* context, std::optional<DeterminedExpressionOperandBitwidthInformation>& optionalDeterminedOperandBitwidth);
-        [[nodiscard]] std::optional<syrec::Expression::ptr>        visitShiftExpressionTyped(const TSyrecParser::ShiftExpressionContext* context, std::optional<DeterminedExpressionOperandBitwidthInformation>& optionalDeterminedOperandBitwidth);
+        [[nodiscard]] std::optional<syrec::Expression::ptr>        visitShiftExpressionTyped(const TSyrecParser::BinaryExpressionContext* context, std::optional<DeterminedExpressionOperandBitwidthInformation>& optionalDeterminedOperandBitwidth);
         [[maybe_unused]] std::optional<syrec::VariableAccess::ptr> visitSignalTyped(const TSyrecParser::SignalContext* context, std::optional<DeterminedExpressionOperandBitwidthInformation>* optionalDeterminedOperandBitwidth);
         [[nodiscard]] std::optional<syrec::Number::ptr>            visitNumberTyped(const TSyrecParser::NumberContext* context) const;
+        [[nodiscard]] std::optional<syrec::Number::ptr>            visitAtomicNumberTyped(const TSyrecParser::AtomicNumberContext* context) const;
         [[nodiscard]] std::optional<syrec::Number::ptr>            visitNumberFromIntegerTyped(const TSyrecParser::NumberFromIntegerContext* context) const;
         [[nodiscard]] std::optional<syrec::Number::ptr>            visitNumberFromHexLiteralTyped(const TSyrecParser::NumberFromHexLiteralContext* context) const;
         [[nodiscard]] std::optional<syrec::Number::ptr>            visitNumberFromBinaryLiteralTyped(const TSyrecParser::NumberFromBinaryLiteralContext* context) const;
         [[nodiscard]] std::optional<syrec::Number::ptr>            visitNumberFromSignalwidthTyped(const TSyrecParser::NumberFromSignalwidthContext* context) const;
         [[nodiscard]] std::optional<syrec::Number::ptr>            visitNumberFromExpressionTyped(const TSyrecParser::NumberFromExpressionContext* context) const;
         [[nodiscard]] std::optional<syrec::Number::ptr>            visitNumberFromLoopVariableTyped(const TSyrecParser::NumberFromLoopVariableContext* context) const;
+        [[nodiscard]] std::optional<syrec::Number::ptr>            visitConstantExpressionTyped(const TSyrecParser::BinaryExpressionContext* context) const;
+        [[nodiscard]] std::optional<syrec::Number::ptr>            visitConstantExpressionOperandTyped(const TSyrecParser::ExpressionContext* context) const;
 
         void                                                                             clearRestrictionOnVariableAccesses();
         void                                                                             setRestrictionOnLoopVariablesUsableInFutureLoopVariableValueInitializations(const std::string_view& loopVariableIdentifier);
@@ -62,24 +68,32 @@ namespace syrec_parser {
         [[nodiscard]] std::optional<utils::IfStatementExpressionComponentsRecorder::ptr> getIfStatementExpressionComponentsRecorder() const;
         [[maybe_unused]] bool                                                            setRestrictionOnVariableAccesses(const syrec::VariableAccess::ptr& notAccessiblePartsForFutureVariableAccesses);
         [[nodiscard]] bool                                                               isCurrentlyProcessingDimensionAccessOfVariableAccess() const;
-        [[maybe_unused]] static bool                                                     truncateConstantValuesInExpression(syrec::Expression::ptr& expression, unsigned int expectedBitwidthOfOperandsInExpression, utils::IntegerConstantTruncationOperation truncationOperationToUseForIntegerConstants, bool* detectedDivisionByZero);
+        [[maybe_unused]] bool                                                            truncateConstantValuesInExpression(syrec::Expression::ptr& expression, unsigned int expectedBitwidthOfOperandsInExpression, utils::IntegerConstantTruncationOperation truncationOperationToUseForIntegerConstants, bool* detectedDivisionByZero) const;
 
     protected:
-        std::optional<syrec::VariableAccess::ptr>                          optionalRestrictionOnVariableAccesses;
+        std::optional<utils::VariableAccessOverlapChecker>                 optionalRestrictionOnVariableAccesses;
         std::optional<std::string_view>                                    optionalRestrictionOnLoopVariableUsageInLoopVariableValueInitialization;
         std::optional<utils::IfStatementExpressionComponentsRecorder::ptr> optionalIfStatementExpressionComponentsRecorder;
         bool                                                               isCurrentlyProcessingDimensionAccessOfVariableAccessFlag = false;
 
         void                                            recordExpressionComponent(const utils::IfStatementExpressionComponentsRecorder::ExpressionComponent& expressionComponent) const;
         [[nodiscard]] std::optional<syrec::Number::ptr> tryParseNumberFromString(const std::string_view& stringifiedNumber, int expectedBaseOfStringifiedNumber, const Message::Position& reportedErrorPositionOnOverflow) const;
+        [[nodiscard]] std::optional<syrec::Number::ptr> trySimplifyConstantExpression(const std::optional<syrec::Number::ptr>& lhsOperand, const std::optional<syrec::Number::ConstantExpression::Operation>& operation, const std::optional<syrec::Number::ptr>& rhsOperand, const antlr4::ParserRuleContext* rhsOperandContext) const;
 
         [[nodiscard]] static std::optional<syrec::BinaryExpression::BinaryOperation>     mapTokenToBinaryOperation(const TSyrecParser::BinaryExpressionContext& binaryExpressionContext);
-        [[nodiscard]] static std::optional<syrec::ShiftExpression::ShiftOperation>       mapTokenToShiftOperation(const TSyrecParser::ShiftExpressionContext& shiftExpressionContext);
+        [[nodiscard]] static std::optional<syrec::ShiftExpression::ShiftOperation>       mapTokenToShiftOperation(const TSyrecParser::BinaryExpressionContext& shiftExpressionContext);
         [[nodiscard]] static std::optional<syrec::Number::ConstantExpression::Operation> mapTokenToConstantExpressionOperation(const TSyrecParser::NumberFromExpressionContext& constantExpressionContext);
+        [[nodiscard]] static std::optional<syrec::Number::ConstantExpression::Operation> mapTokenToConstantExpressionOperation(const TSyrecParser::BinaryExpressionContext& constantExpressionContext);
         [[nodiscard]] static std::optional<syrec::UnaryExpression::UnaryOperation>       mapTokenToUnaryOperation(const TSyrecParser::UnaryExpressionContext& unaryExpressionContext);
-        [[nodiscard]] static std::optional<syrec::Expression::ptr>                       trySimplifyBinaryExpressionWithConstantValueOfOneOperandKnown(unsigned int knownOperandValue, syrec::BinaryExpression::BinaryOperation binaryOperation, const syrec::Expression::ptr& unknownOperandValue, bool isValueOfLhsOperandKnown);
-        [[nodiscard]] static std::optional<syrec::Expression::ptr>                       trySimplifyShiftExpression(const syrec::ShiftExpression& shiftExpr, const std::optional<unsigned int>& optionalBitwidthOfOperandsInExpression);
-        [[nodiscard]] static std::optional<syrec::Expression::ptr>                       trySimplifyBinaryExpression(const syrec::BinaryExpression& binaryExpr, const std::optional<unsigned int>& optionalBitwidthOfOperandsInExpression, bool* detectedDivisionByZero);
+        [[nodiscard]] std::optional<syrec::Expression::ptr>                              trySimplifyBinaryExpressionWithConstantValueOfOneOperandKnown(unsigned int knownOperandValue, syrec::BinaryExpression::BinaryOperation binaryOperation, const syrec::Expression::ptr& unknownOperandValue, bool isValueOfLhsOperandKnown) const;
+        [[nodiscard]] std::optional<syrec::Expression::ptr>                              trySimplifyShiftExpression(const syrec::ShiftExpression& shiftExpr, const std::optional<unsigned int>& optionalBitwidthOfOperandsInExpression) const;
+        /**
+         * Determine whether an expression is a constant expression, i.e. either a number or a binary expression with only constant expressions as operands that uses one of the operations allowed in a number.
+         * @param expressionContext The parser context of the expression.
+         * @return Whether the expression is a constant expression.
+         */
+        [[nodiscard]] static bool                                                        isConstantExpression(const TSyrecParser::ExpressionContext* expressionContext);
+        [[nodiscard]] std::optional<syrec::Expression::ptr>                              trySimplifyBinaryExpression(const syrec::BinaryExpression& binaryExpr, const std::optional<unsigned int>& optionalBitwidthOfOperandsInExpression, bool* detectedDivisionByZero) const;
         [[nodiscard]] static constexpr bool                                              isBinaryOperationARelationalOrLogicalOne(const syrec::BinaryExpression::BinaryOperation binaryOperation) {
             switch (binaryOperation) {
                 case syrec::BinaryExpression::BinaryOperation::Equals:
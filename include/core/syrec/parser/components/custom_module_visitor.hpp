@@ -13,6 +13,7 @@
 #include "TSyrecParser.h"
 #include "algorithms/synthesis/internal_qubit_label_builder.hpp"
 #include "core/configurable_options.hpp"
+#include "core/syrec/ir_node_arena.hpp"
 #include "core/syrec/module.hpp"
 #include "core/syrec/parser/components/custom_base_visitor.hpp"
 #include "core/syrec/parser/components/custom_statement_visitor.hpp"
@@ -22,28 +23,87 @@
 #include "core/syrec/statement.hpp"
 #include "core/syrec/variable.hpp"
 
+#include <cstddef>
 #include <memory>
 #include <optional>
+#include <string>
 #include <string_view>
+#include <unordered_set>
 #include <vector>
 
 namespace syrec_parser {
     class CustomModuleVisitor: protected CustomBaseVisitor {
     public:
-        CustomModuleVisitor(const std::shared_ptr<ParserMessagesContainer>& sharedMessagesContainerInstance, const syrec::ConfigurableOptions& userProvidedParserSettings):
-            CustomBaseVisitor(sharedMessagesContainerInstance, std::make_shared<utils::BaseSymbolTable>(), userProvidedParserSettings),
+        /**
+         * @param symbolTableOfLinkedModules The optional symbol table declaring the modules of a linked syrec::ModuleLibrary, a snapshot of which is used as the initial symbol table of this visitor.
+         */
+        CustomModuleVisitor(const std::shared_ptr<ParserMessagesContainer>& sharedMessagesContainerInstance, const syrec::ConfigurableOptions& userProvidedParserSettings, const std::shared_ptr<const utils::BaseSymbolTable>& symbolTableOfLinkedModules = nullptr):
+            CustomBaseVisitor(sharedMessagesContainerInstance, symbolTableOfLinkedModules != nullptr ? symbolTableOfLinkedModules->createSnapshotOfDeclaredModules() : std::make_shared<utils::BaseSymbolTable>(), userProvidedParserSettings, userProvidedParserSettings.allocateIrNodesInArena ? std::make_shared<syrec::IrNodeArena>() : nullptr),
             defaultVariableBitwidth(userProvidedParserSettings.defaultBitwidth),
-            statementVisitorInstance(std::make_unique<CustomStatementVisitor>(sharedGeneratedMessageContainerInstance, this->symbolTable, userProvidedParserSettings)) {}
+            statementVisitorInstance(std::make_unique<CustomStatementVisitor>(sharedGeneratedMessageContainerInstance, this->symbolTable, userProvidedParserSettings, this->irNodeArena)) {}
+
+        /**
+         * The modules of a part of a SyReC program parsed without performing the overload resolution of their call-/uncall statements (see CustomModuleVisitor::parseModulesWithoutOverloadResolution).
+         */
+        struct ModulesWithNotPerformedOverloadResolution {
+            syrec::Module::vec                                                          modules;
+            std::vector<CustomStatementVisitor::NotOverloadResolutedCallStatementScope> callStatementsWithNotPerformedOverloadResolution;
+        };
 
         [[maybe_unused]] std::optional<std::shared_ptr<syrec::Program>> parseProgram(const TSyrecParser::ProgramContext* context) const;
 
+        /**
+         * Parse the modules of a part of a SyReC program without performing the checks requiring the modules of the other parts (i.e. the detection of duplicate module declarations in other parts, the determination
+         * of the program entry point and the overload resolution of call-/uncall statements). The latter are performed once the modules of all parts were parsed by CustomModuleVisitor::joinModulesOfParts.
+         * @param context The parse tree of the part of the SyReC program.
+         * @return The parsed modules together with their not overload resolved call-/uncall statements, std::nullopt if the parse tree was not defined.
+         */
+        [[nodiscard]] std::optional<ModulesWithNotPerformedOverloadResolution> parseModulesWithoutOverloadResolution(const TSyrecParser::ProgramContext* context) const;
+
+        /**
+         * Join the modules of the separately parsed parts of a SyReC program by registering their signatures in the symbol table of this visitor in the order of the parts, determining the program entry point and performing the overload
+         * resolution of all call-/uncall statements with any semantic error of the latter being recorded in the messages container of this visitor.
+         * @param modulesOfParts The modules of the parts of the SyReC program in the order in which they are declared in the program.
+         * @return The joined program, std::nullopt if any module duplicated a previously declared one since such errors can only be reported at the position of the module identifier by CustomModuleVisitor::parseProgram.
+         */
+        [[nodiscard]] std::optional<std::shared_ptr<syrec::Program>> joinModulesOfParts(const std::vector<ModulesWithNotPerformedOverloadResolution>& modulesOfParts) const;
+
+        /**
+         * Declare modules that are not part of the parsed program but can be called by its modules. Declaration conflicts between these and the modules of the parsed program are reported as semantic errors.
+         * @param modules The modules to declare, which are not added to the parsed program.
+         */
+        void declareModulesDefinedOutsideOfProgram(const syrec::Module::vec& modules) const;
+
+        /**
+         * Parse the modules of a module library, i.e. a SyReC program without a program entry point (see syrec::ModuleLibrary). All modules are checked and the overload resolution of the call-/uncall statements is performed without
+         * determining a program entry point, thus neither the absence of an entry point nor a call of the last declared module is reported as an error.
+         * @param context The parse tree of the module library.
+         * @return The modules of the library, std::nullopt if the parse tree was not defined.
+         */
+        [[maybe_unused]] std::optional<std::shared_ptr<syrec::Program>> parseModuleLibrary(const TSyrecParser::ProgramContext* context);
+
+        /**
+         * Create a snapshot of the modules declared in the symbol table of this visitor that can be used as the initial symbol table of further visitors (see CustomModuleVisitor::CustomModuleVisitor(...)).
+         */
+        [[nodiscard]] std::shared_ptr<const utils::BaseSymbolTable> createSnapshotOfSymbolTable() const {
+            return symbolTable->createSnapshotOfDeclaredModules();
+        }
+
+        [[nodiscard]] std::size_t determineNumBytesOfSymbolTable() const {
+            return symbolTable->determineNumBytes();
+        }
+
     protected:
         unsigned int                      defaultVariableBitwidth;
+        bool                              isParsingModuleLibrary = false;
         static constexpr std::string_view RESERVED_IDENTIFIER_PREFIX = syrec::InternalQubitLabelBuilder::INTERNAL_QUBIT_LABEL_PREFIX;
 
         std::unique_ptr<CustomStatementVisitor>                         statementVisitorInstance;
         [[nodiscard]] std::optional<std::shared_ptr<syrec::Program>>    visitProgramTyped(const TSyrecParser::ProgramContext* context) const;
         [[nodiscard]] std::optional<syrec::Module::ptr>                 visitModuleTyped(const TSyrecParser::ModuleContext* context) const;
+        [[nodiscard]] std::optional<std::unordered_set<std::string>>    determineIdentifiersOfModulesReachableFromProgramEntryPoint(const TSyrecParser::ProgramContext* context) const;
+        [[nodiscard]] bool                                              isModuleSignatureAlreadyDeclared(const std::string& moduleIdentifier, const syrec::Variable::vec& parameters, bool declaresParameters) const;
+        void                                                            resolveOverloadsOfCallStatements(const std::shared_ptr<const syrec::Module>& lastProcessedUserDefinedModule, const std::vector<CustomStatementVisitor::NotOverloadResolutedCallStatementScope>& callStatementsScopeForWhichOverloadResolutionShouldBePerformed) const;
         [[nodiscard]] std::optional<std::vector<syrec::Variable::ptr>>  visitParameterListTyped(const TSyrecParser::ParameterListContext* context) const;
         [[nodiscard]] std::optional<syrec::Variable::ptr>               visitParameterTyped(const TSyrecParser::ParameterContext* context) const;
         [[nodiscard]] std::optional<std::vector<syrec::Variable::ptr>>  visitSignalListTyped(const TSyrecParser::SignalListContext* context) const;
@@ -13,6 +13,7 @@
 #include "TSyrecParser.h"
 #include "Token.h"
 #include "core/configurable_options.hpp"
+#include "core/syrec/ir_node_arena.hpp"
 #include "core/syrec/number.hpp"
 #include "core/syrec/parser/components/custom_base_visitor.hpp"
 #include "core/syrec/parser/components/custom_expression_visitor.hpp"
@@ -63,9 +64,9 @@ namespace syrec_parser {
                 signatureOfModuleContainingCallStatement(std::move(signatureOfModuleContainingCallStatement)) {}
         };
 
-        CustomStatementVisitor(const std::shared_ptr<ParserMessagesContainer>& sharedMessagesContainerInstance, const std::shared_ptr<utils::BaseSymbolTable>& sharedSymbolTableInstance, const syrec::ConfigurableOptions& parserConfiguration):
-            CustomBaseVisitor(sharedMessagesContainerInstance, sharedSymbolTableInstance, parserConfiguration),
-            expressionVisitorInstance(std::make_unique<CustomExpressionVisitor>(sharedMessagesContainerInstance, sharedSymbolTableInstance, parserConfiguration)) {}
+        CustomStatementVisitor(const std::shared_ptr<ParserMessagesContainer>& sharedMessagesContainerInstance, const std::shared_ptr<utils::BaseSymbolTable>& sharedSymbolTableInstance, const syrec::ConfigurableOptions& parserConfiguration, const syrec::IrNodeArena::ptr& sharedIrNodeArena):
+            CustomBaseVisitor(sharedMessagesContainerInstance, sharedSymbolTableInstance, parserConfiguration, sharedIrNodeArena),
+            expressionVisitorInstance(std::make_unique<CustomExpressionVisitor>(sharedMessagesContainerInstance, sharedSymbolTableInstance, parserConfiguration, sharedIrNodeArena)) {}
 
         [[nodiscard]] std::optional<syrec::Statement::vec>        visitStatementListTyped(const TSyrecParser::StatementListContext* context);
         [[nodiscard]] std::optional<syrec::Statement::ptr>        visitStatementTyped(const TSyrecParser::StatementContext* context);
@@ -75,7 +76,7 @@ namespace syrec_parser {
         [[nodiscard]] std::optional<syrec::Statement::ptr>        visitUnaryStatementTyped(const TSyrecParser::UnaryStatementContext* context) const;
         [[nodiscard]] std::optional<syrec::Statement::ptr>        visitAssignStatementTyped(const TSyrecParser::AssignStatementContext* context) const;
         [[nodiscard]] std::optional<syrec::Statement::ptr>        visitSwapStatementTyped(const TSyrecParser::SwapStatementContext* context) const;
-        [[nodiscard]] static std::optional<syrec::Statement::ptr> visitSkipStatementTyped(const TSyrecParser::SkipStatementContext* context);
+        [[nodiscard]] std::optional<syrec::Statement::ptr>        visitSkipStatementTyped(const TSyrecParser::SkipStatementContext* context) const;
 
         [[nodiscard]] std::vector<NotOverloadResolutedCallStatementScope> getCallStatementsWithNotPerformedOverloadResolution() const;
         void                                                              openNewScopeToRecordCallStatementsInModule(const NotOverloadResolutedCallStatementScope::DeclaredModuleSignature& enclosingModuleSignature);
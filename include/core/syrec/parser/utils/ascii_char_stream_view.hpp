@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "CharStream.h"
+#include "misc/Interval.h"
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace syrec_parser {
+    /**
+     * An ANTLR character stream reading the characters of an ASCII encoded text directly from a view of the text without copying it.
+     *
+     * Contrary to antlr4::ANTLRInputStream, which decodes its input into a UTF-32 encoded copy, every byte of the text is used as a single character. The stream thus only produces the
+     * same characters as the former if the text only consists of ASCII characters (see syrec_parser::AsciiCharStreamView::isAsciiText(...)). The viewed text must outlive the stream.
+     */
+    class AsciiCharStreamView final: public antlr4::CharStream {
+    public:
+        explicit AsciiCharStreamView(std::string_view text, std::string sourceName = ""):
+            text(text), sourceName(std::move(sourceName)) {}
+
+        /**
+         * Determine whether a text only consists of ASCII characters.
+         * @param text The text to check.
+         * @return Whether all characters of the text are ASCII characters.
+         */
+        [[nodiscard]] static bool isAsciiText(std::string_view text) noexcept;
+
+        void                      consume() override;
+        [[nodiscard]] std::size_t LA(ssize_t i) override;
+        [[nodiscard]] ssize_t     mark() override;
+        void                      release(ssize_t marker) override;
+        [[nodiscard]] std::size_t index() override;
+        void                      seek(std::size_t index) override;
+        [[nodiscard]] std::size_t size() override;
+        [[nodiscard]] std::string getSourceName() const override;
+        [[nodiscard]] std::string getText(const antlr4::misc::Interval& interval) override;
+        [[nodiscard]] std::string toString() const override;
+
+    protected:
+        std::string_view text;
+        std::string      sourceName;
+        std::size_t      position = 0;
+    };
+} // namespace syrec_parser
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace syrec_parser {
+    /**
+     * A read-only view of the content of a file which is mapped into memory instead of being copied into a buffer.
+     *
+     * If the file cannot be mapped into memory (i.e. because it is not a regular file), its content is read into an internal buffer instead.
+     * The content of the mapped file must not be modified (i.e. truncated) by another process while the mapping is active.
+     */
+    class MemoryMappedFile {
+    public:
+        /**
+         * Map the content of a file into memory.
+         * @param filename The path to the file.
+         * @param foundFileHandlingErrors An optional container in which the error that prevented the file from being mapped or read is stored.
+         * @return The mapped file if its content could be accessed, otherwise std::nullopt.
+         */
+        [[nodiscard]] static std::optional<MemoryMappedFile> open(const std::string& filename, std::string* foundFileHandlingErrors = nullptr);
+
+        ~MemoryMappedFile();
+        MemoryMappedFile(const MemoryMappedFile&)            = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+        MemoryMappedFile(MemoryMappedFile&& other) noexcept;
+        MemoryMappedFile& operator=(MemoryMappedFile&& other) noexcept;
+
+        /**
+         * Get the content of the file.
+         * @return A view of the content of the file which is valid until this object is destroyed.
+         */
+        [[nodiscard]] std::string_view getContent() const noexcept {
+            return mappedContent != nullptr ? std::string_view(mappedContent, mappedContentSize) : std::string_view(fallbackContentBuffer);
+        }
+
+        /**
+         * Determine whether the content of the file is mapped into memory or was read into an internal buffer.
+         * @return Whether the content of the file is mapped into memory.
+         */
+        [[nodiscard]] bool isMappedIntoMemory() const noexcept {
+            return mappedContent != nullptr;
+        }
+
+    protected:
+        MemoryMappedFile() = default;
+
+        const char* mappedContent     = nullptr;
+        std::size_t mappedContentSize = 0;
+        std::string fallbackContentBuffer;
+
+        void unmap() noexcept;
+    };
+} // namespace syrec_parser
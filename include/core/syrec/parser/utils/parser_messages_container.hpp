@@ -12,22 +12,30 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
+#include <variant>
 #include <vector>
 
 namespace syrec_parser {
     struct Message {
-        using ptr = std::shared_ptr<Message>;
+        using ptr      = std::shared_ptr<Message>;
+        using Argument = std::variant<std::string, std::int64_t, std::uint64_t>;
         struct Position {
             std::size_t line;
             std::size_t column;
 
             explicit Position(std::size_t line, std::size_t column):
                 line(line), column(column) {}
+
+            [[nodiscard]] bool operator==(const Position& other) const = default;
         };
 
         enum class Type : std::uint8_t {
@@ -39,32 +47,94 @@ namespace syrec_parser {
         Type        type;
         std::string id;
         Position    position;
-        std::string message;
 
         Message(Type type, std::string id, const Position position, std::string message):
             type(type), id(std::move(id)), position(position), message(std::move(message)) {}
 
+        /**
+         * Create a message whose text is only formatted when it is requested.
+         * @param messageFormat The format of the message text whose replacement fields ('{:d}' and '{:s}') are replaced by the stringified arguments in the order of the latter, must outlive the message.
+         * @param messageArguments The arguments of the message text.
+         */
+        Message(Type type, std::string id, const Position position, std::string_view messageFormat, std::vector<Argument> messageArguments):
+            type(type), id(std::move(id)), position(position), messageFormat(messageFormat), messageArguments(std::move(messageArguments)) {}
+
+        template<typename T>
+        [[nodiscard]] static Argument makeArgument(T&& value) {
+            using ValueType = std::remove_cvref_t<T>;
+            if constexpr (std::is_integral_v<ValueType> && std::is_signed_v<ValueType>) {
+                return static_cast<std::int64_t>(value);
+            } else if constexpr (std::is_integral_v<ValueType>) {
+                return static_cast<std::uint64_t>(value);
+            } else {
+                return std::string(std::forward<T>(value));
+            }
+        }
+
+        [[nodiscard]] std::string getMessage() const;
+
         [[nodiscard]] std::string stringify() const {
-            return "-- line " + std::to_string(position.line) + " col " + std::to_string(position.column) + ": " + message;
+            return "-- line " + std::to_string(position.line) + " col " + std::to_string(position.column) + ": " + getMessage();
+        }
+
+        /**
+         * Determine whether two messages describe the same issue, i.e. share their identifier, position and the arguments of their message text.
+         */
+        [[nodiscard]] bool isDuplicateOf(const Message& other) const {
+            return type == other.type && id == other.id && position == other.position && messageFormat == other.messageFormat && messageArguments == other.messageArguments && message == other.message;
         }
+
+    protected:
+        std::string           message;
+        std::string_view      messageFormat;
+        std::vector<Argument> messageArguments;
     };
 
+    /**
+     * A container for the messages generated by the parser.
+     *
+     * Messages describing the same issue as an already recorded message are discarded and the number of recorded errors can be limited with all further errors only being counted.
+     * Since the text of the messages of semantic errors is only formatted when requested, discarded messages are never formatted.
+     */
     class ParserMessagesContainer {
     public:
-        ParserMessagesContainer() {
+        explicit ParserMessagesContainer(std::optional<std::size_t> optionalMaxNumRecordedErrors = std::nullopt):
+            optionalMaxNumRecordedErrors(optionalMaxNumRecordedErrors) {
             messagesPerType.emplace(Message::Type::Error, std::vector<Message::ptr>());
             messagesPerType.emplace(Message::Type::Information, std::vector<Message::ptr>());
             messagesPerType.emplace(Message::Type::Warning, std::vector<Message::ptr>());
         }
 
-        void                                    recordMessage(std::unique_ptr<Message> message);
-        [[nodiscard]] std::vector<Message::ptr> getMessagesOfType(Message::Type messageType) const;
-        [[maybe_unused]] bool                   setFilterForToBeRecordedMessages(const std::string& messageIdToPassFilter);
-        void                                    clearFilterForToBeRecordedMessages();
-        void                                    sortRecordedMessagesOfTypeInAscendingOrder(Message::Type messageType);
+        void                                           recordMessage(std::unique_ptr<Message> message);
+        [[nodiscard]] const std::vector<Message::ptr>& getMessagesOfType(Message::Type messageType) const;
+        [[maybe_unused]] bool                          setFilterForToBeRecordedMessages(const std::string& messageIdToPassFilter);
+        void                                           clearFilterForToBeRecordedMessages();
+        void                                           sortRecordedMessagesOfTypeInAscendingOrder(Message::Type messageType);
+
+        /**
+         * Get the number of errors that were not recorded because the maximum number of recorded errors was reached (duplicates of recorded errors are not counted).
+         */
+        [[nodiscard]] std::size_t getNumNotRecordedErrors() const noexcept {
+            return numNotRecordedErrors;
+        }
 
     protected:
-        std::unordered_map<Message::Type, std::vector<Message::ptr>> messagesPerType;
-        std::optional<std::string>                                   temporaryFilterForToBeRecordedMessages;
+        struct MessagePositionHash {
+            [[nodiscard]] std::size_t operator()(const Message* message) const noexcept {
+                return std::hash<std::string>{}(message->id) ^ (std::hash<std::size_t>{}(message->position.line) * 31U + std::hash<std::size_t>{}(message->position.column));
+            }
+        };
+
+        struct DuplicateMessageEquality {
+            [[nodiscard]] bool operator()(const Message* lMessage, const Message* rMessage) const {
+                return lMessage->isDuplicateOf(*rMessage);
+            }
+        };
+
+        std::unordered_map<Message::Type, std::vector<Message::ptr>>                      messagesPerType;
+        std::unordered_set<const Message*, MessagePositionHash, DuplicateMessageEquality> recordedMessages;
+        std::optional<std::string>                                                        temporaryFilterForToBeRecordedMessages;
+        std::optional<std::size_t>                                                        optionalMaxNumRecordedErrors;
+        std::size_t                                                                       numNotRecordedErrors = 0;
     };
 } // namespace syrec_parser
@@ -11,16 +11,17 @@
 #pragma once
 
 #include "core/syrec/module.hpp"
+#include "core/syrec/parser/utils/symbolTable/flat_identifier_map.hpp"
 #include "core/syrec/parser/utils/symbolTable/temporary_variable_scope.hpp"
 #include "core/syrec/variable.hpp"
 
+#include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace utils {
@@ -50,9 +51,30 @@ namespace utils {
         [[maybe_unused]] TemporaryVariableScope::ptr                openTemporaryScope();
         [[maybe_unused]] std::optional<TemporaryVariableScope::ptr> closeTemporaryScope();
 
+        /**
+         * Create a symbol table declaring the same modules as this one (i.e. the modules of a syrec::ModuleLibrary) which reuses the cached overload resolution results of this symbol table but does not share any temporary variable scope with it.
+         */
+        [[nodiscard]] std::shared_ptr<BaseSymbolTable> createSnapshotOfDeclaredModules() const;
+
+        /**
+         * Estimate the number of bytes held by the symbol table (see syrec::MemoryUsage::numBytesOfSymbolTables), excluding the declared modules and variables which are part of the IR of the parsed program.
+         */
+        [[nodiscard]] std::size_t determineNumBytes() const;
+
     protected:
-        std::map<std::string, syrec::Module::vec, std::less<>> declaredModules;
-        std::vector<TemporaryVariableScope::ptr>               temporaryVariableScopes;
+        struct DeclaredModulesOfIdentifier {
+            // The modules in the order of their declaration
+            syrec::Module::vec modules;
+            // The modules grouped by the structure of their parameters (see buildParameterStructureKey(...))
+            std::unordered_map<std::string, syrec::Module::vec> modulesByParameterStructure;
+        };
+
+        FlatIdentifierMap<DeclaredModulesOfIdentifier> declaredModules;
+        // The results of the overload resolutions indexed by the accessed module identifier, the structure and the types of the caller arguments, invalidated by the insertion of any module.
+        mutable std::unordered_map<std::string, ModuleOverloadResolutionResult> cachedModuleOverloadResolutionResults;
+        std::vector<TemporaryVariableScope::ptr> temporaryVariableScopes;
+        // Closed scopes no longer referenced outside of the symbol table whose storage is reused by the next opened scopes.
+        std::vector<TemporaryVariableScope::ptr> reusableTemporaryVariableScopes;
 
         [[nodiscard]] ModuleOverloadResolutionResult getModulesMatchingSignature(const std::string_view& accessedModuleIdentifier, const syrec::Variable::vec& callerArguments, bool validateCallerArguments) const;
         [[nodiscard]] constexpr static bool          doesVariableTypePairCreateOverloadResolutionAmbiguity(syrec::Variable::Type lType, syrec::Variable::Type rType) {
@@ -66,6 +88,11 @@ namespace utils {
                     return true;
             }
         }
-        [[nodiscard]] static bool doVariableStructuresMatch(const syrec::Variable& lVariable, const syrec::Variable& rVariable) noexcept;
+        /**
+         * Build a key that is equal for two collections of variables if and only if they have the same size and the variables at every index have the same bitwidth and dimensions.
+         * @param variables The variables whose structure shall be encoded, all variables must not be null.
+         * @return The key for the structure of the variables.
+         */
+        [[nodiscard]] static std::string buildParameterStructureKey(const syrec::Variable::vec& variables);
     };
 } // namespace utils
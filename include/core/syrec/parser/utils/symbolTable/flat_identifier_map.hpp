@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/memory_accounting.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace utils {
+    /**
+     * A hash map from identifiers to values storing its entries contiguously in insertion order (with the exception of erased entries being replaced by the last entry).
+     *
+     * The entries are located via an open addressing table storing only the index of the entry for every slot, with the hash of every identifier being computed once during its insertion.
+     * Thus, a lookup only compares the identifiers of entries whose hash matches the one of the looked for identifier.
+     * Pointers to values of the map are invalidated by any insertion or erasure of an entry.
+     */
+    template<typename TValue>
+    class FlatIdentifierMap {
+    public:
+        struct Entry {
+            std::string identifier;
+            std::size_t hash;
+            TValue      value;
+        };
+
+        [[nodiscard]] std::size_t size() const noexcept {
+            return entries.size();
+        }
+
+        [[nodiscard]] bool empty() const noexcept {
+            return entries.empty();
+        }
+
+        [[nodiscard]] typename std::vector<Entry>::const_iterator begin() const noexcept {
+            return entries.cbegin();
+        }
+
+        [[nodiscard]] typename std::vector<Entry>::const_iterator end() const noexcept {
+            return entries.cend();
+        }
+
+        [[nodiscard]] bool contains(const std::string_view& identifier) const {
+            return find(identifier) != nullptr;
+        }
+
+        [[nodiscard]] const TValue* find(const std::string_view& identifier) const {
+            if (entries.empty()) {
+                return nullptr;
+            }
+            const std::uint32_t entryIndex = indexTable[findSlot(identifier, computeHash(identifier))];
+            return entryIndex != EMPTY_SLOT ? &entries[entryIndex].value : nullptr;
+        }
+
+        [[nodiscard]] TValue* find(const std::string_view& identifier) {
+            return const_cast<TValue*>(std::as_const(*this).find(identifier));
+        }
+
+        /**
+         * Insert a value for an identifier if no entry for the identifier exists.
+         * @param identifier The identifier of the inserted value.
+         * @param value The value to insert.
+         * @return A pointer to the value of the entry for the identifier and whether the value was inserted.
+         */
+        std::pair<TValue*, bool> tryEmplace(const std::string_view& identifier, TValue value) {
+            if ((entries.size() + 1U) * 2U > indexTable.size()) {
+                rehash(indexTable.empty() ? MIN_NUM_SLOTS : indexTable.size() * 2U);
+            }
+
+            const std::size_t hash = computeHash(identifier);
+            const std::size_t slot = findSlot(identifier, hash);
+            if (indexTable[slot] != EMPTY_SLOT) {
+                return {&entries[indexTable[slot]].value, false};
+            }
+            indexTable[slot] = static_cast<std::uint32_t>(entries.size());
+            entries.emplace_back(Entry{std::string(identifier), hash, std::move(value)});
+            return {&entries.back().value, true};
+        }
+
+        [[maybe_unused]] bool erase(const std::string_view& identifier) {
+            if (entries.empty()) {
+                return false;
+            }
+
+            std::size_t         slot       = findSlot(identifier, computeHash(identifier));
+            const std::uint32_t entryIndex = indexTable[slot];
+            if (entryIndex == EMPTY_SLOT) {
+                return false;
+            }
+
+            // Shift the following entries of the probe sequence backwards to fill the freed slot, which avoids the usage of tombstones.
+            const std::size_t slotMask = indexTable.size() - 1U;
+            for (std::size_t nextSlot = (slot + 1U) & slotMask; indexTable[nextSlot] != EMPTY_SLOT; nextSlot = (nextSlot + 1U) & slotMask) {
+                const std::size_t homeSlot             = entries[indexTable[nextSlot]].hash & slotMask;
+                const bool        isHomeSlotInProbeGap = slot <= nextSlot ? (slot < homeSlot && homeSlot <= nextSlot) : (slot < homeSlot || homeSlot <= nextSlot);
+                if (!isHomeSlotInProbeGap) {
+                    indexTable[slot] = indexTable[nextSlot];
+                    slot             = nextSlot;
+                }
+            }
+            indexTable[slot] = EMPTY_SLOT;
+
+            // The last entry is moved into the position of the erased one to keep the entries contiguous.
+            if (const auto lastEntryIndex = static_cast<std::uint32_t>(entries.size() - 1U); entryIndex != lastEntryIndex) {
+                std::size_t slotOfLastEntry = entries[lastEntryIndex].hash & slotMask;
+                while (indexTable[slotOfLastEntry] != lastEntryIndex) {
+                    slotOfLastEntry = (slotOfLastEntry + 1U) & slotMask;
+                }
+                indexTable[slotOfLastEntry] = entryIndex;
+                entries[entryIndex]         = std::move(entries[lastEntryIndex]);
+            }
+            entries.pop_back();
+            return true;
+        }
+
+        /**
+         * Remove all entries from the map while keeping the already allocated storage for future insertions.
+         */
+        void clear() noexcept {
+            entries.clear();
+            std::fill(indexTable.begin(), indexTable.end(), EMPTY_SLOT);
+        }
+
+        /**
+         * Estimate the number of bytes of the storage of the entries and slots of the map including the identifiers, excluding any memory owned by the values.
+         */
+        [[nodiscard]] std::size_t determineNumBytesOfStorage() const noexcept {
+            std::size_t numBytes = syrec::memory_accounting::numBytesOfHeapStorage(entries) + syrec::memory_accounting::numBytesOfHeapStorage(indexTable);
+            for (const Entry& entry: entries) {
+                numBytes += syrec::memory_accounting::numBytesOfHeapStorage(entry.identifier);
+            }
+            return numBytes;
+        }
+
+    protected:
+        static constexpr std::uint32_t EMPTY_SLOT    = std::numeric_limits<std::uint32_t>::max();
+        static constexpr std::size_t   MIN_NUM_SLOTS = 16U;
+
+        std::vector<Entry> entries;
+        // The number of slots is always a power of two which is at least twice the number of entries.
+        std::vector<std::uint32_t> indexTable;
+
+        [[nodiscard]] static std::size_t computeHash(const std::string_view& identifier) noexcept {
+            return std::hash<std::string_view>{}(identifier);
+        }
+
+        [[nodiscard]] std::size_t findSlot(const std::string_view& identifier, const std::size_t hash) const noexcept {
+            const std::size_t slotMask = indexTable.size() - 1U;
+            std::size_t       slot     = hash & slotMask;
+            while (indexTable[slot] != EMPTY_SLOT && (entries[indexTable[slot]].hash != hash || entries[indexTable[slot]].identifier != identifier)) {
+                slot = (slot + 1U) & slotMask;
+            }
+            return slot;
+        }
+
+        void rehash(const std::size_t numSlots) {
+            indexTable.assign(numSlots, EMPTY_SLOT);
+            const std::size_t slotMask = numSlots - 1U;
+            for (std::size_t i = 0; i < entries.size(); ++i) {
+                std::size_t slot = entries[i].hash & slotMask;
+                while (indexTable[slot] != EMPTY_SLOT) {
+                    slot = (slot + 1U) & slotMask;
+                }
+                indexTable[slot] = static_cast<std::uint32_t>(i);
+            }
+            entries.reserve(numSlots / 2U);
+        }
+    };
+} // namespace utils
@@ -11,10 +11,9 @@
 #pragma once
 
 #include "core/syrec/number.hpp"
+#include "core/syrec/parser/utils/symbolTable/flat_identifier_map.hpp"
 #include "core/syrec/variable.hpp"
 
-#include <functional>
-#include <map>
 #include <memory>
 #include <optional>
 #include <string>
@@ -24,6 +23,8 @@
 #include <vector>
 
 namespace utils {
+    class BaseSymbolTable;
+
     class TemporaryVariableScope {
     public:
         using ptr = std::shared_ptr<TemporaryVariableScope>;
@@ -59,7 +60,20 @@ namespace utils {
         [[nodiscard]] std::optional<unsigned int>            getValueOfLoopVariable(const std::string_view& loopVariableIdentifier);
 
     protected:
-        std::map<std::string, ScopeEntry::ptr, std::less<>> signalIdentifierLookup;
-        std::map<std::string, unsigned int, std::less<>>    knownLoopVariableValues;
+        friend class BaseSymbolTable;
+
+        struct IdentifierLookupEntry {
+            ScopeEntry::ptr scopeEntry;
+            // Only defined for loop variables whose value is known
+            std::optional<unsigned int> knownLoopVariableValue;
+        };
+        FlatIdentifierMap<IdentifierLookupEntry> signalIdentifierLookup;
+
+        /**
+         * Remove all entries from the scope while keeping the storage of the identifier lookup for the reuse of the scope.
+         */
+        void clear() noexcept {
+            signalIdentifierLookup.clear();
+        }
     };
 } //namespace utils
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/syrec/expression.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/number.hpp"
+#include "core/syrec/parser/utils/base_syrec_ir_entity_stringifier.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace utils {
+    /**
+     * A stringifier of the SyReC IR appending the stringified entities to a growable character buffer instead of formatting every token via a std::ostream.
+     *
+     * Numbers are converted via std::to_chars and the operators are looked up in precomputed tables indexed by the operation, the generated output is equal to the one of the utils::BaseSyrecIrEntityStringifier for the same formatting options.
+     * Additionally, the signatures of modules (as generated by syrec::QubitInliningStack::QubitInliningStackEntry::stringifySignatureOfCalledModule()) are memoized per module.
+     */
+    class SyrecIrEntityBufferStringifier {
+    public:
+        using AdditionalFormattingOptions = BaseSyrecIrEntityStringifier::AdditionalFormattingOptions;
+
+        explicit SyrecIrEntityBufferStringifier(const std::optional<AdditionalFormattingOptions>& additionalFormattingOptions);
+
+        /**
+         * Append the stringified SyReC program to the buffer.
+         * @param buffer The buffer to which the stringified program is appended.
+         * @param program The SyReC program to stringify.
+         * @return Whether the stringification was successful, the buffer can contain a partially stringified program otherwise.
+         */
+        [[maybe_unused]] bool stringify(std::string& buffer, const syrec::Program& program);
+
+        /**
+         * Stringify the signature of a module with every parameter being stringified with its type, dimensions and bitwidth (e.g. "module add(in a[1](4), inout b[2](4))").
+         *
+         * The stringified signature is memoized per module, thus the module is expected to not be modified nor destroyed while memoized signatures are available (see clearMemoizedSignatures()).
+         * @param programModule The module whose signature shall be stringified.
+         * @return The stringified signature which remains valid until the memoized signatures are cleared, std::nullopt if the module had no name or a parameter that was not of type in, out or inout.
+         */
+        [[nodiscard]] std::optional<std::string_view> stringifySignatureOfModule(const syrec::Module& programModule);
+
+        void clearMemoizedSignatures() noexcept {
+            memoizedSignaturePerModule.clear();
+        }
+
+    protected:
+        AdditionalFormattingOptions                                          additionalFormattingOptions;
+        std::string                                                          newlineSequence;
+        std::string                                                          indentationSequencePerLevel;
+        std::string                                                          indentationSequence;
+        std::unordered_map<const syrec::Module*, std::optional<std::string>> memoizedSignaturePerModule;
+
+        void incrementIndentationLevel();
+        void decrementIndentationLevel() noexcept;
+
+        [[nodiscard]] bool stringify(std::string& buffer, const syrec::Module& programModule);
+        [[nodiscard]] bool stringify(std::string& buffer, const syrec::Variable& variable, bool stringifyVariableType) const;
+        [[nodiscard]] bool stringify(std::string& buffer, const syrec::Statement::ptr& statement);
+        [[nodiscard]] bool stringify(std::string& buffer, const syrec::AssignStatement& assignStatement) const;
+        [[nodiscard]] bool stringify(std::string& buffer, const syrec::ForStatement& forStatement);
+        [[nodiscard]] bool stringify(std::string& buffer, const syrec::IfStatement& ifStatement);
+        [[nodiscard]] bool stringify(std::string& buffer, const syrec::SwapStatement& swapStatement) const;
+        [[nodiscard]] bool stringify(std::string& buffer, const syrec::UnaryStatement& unaryAssignStatement) const;
+        [[nodiscard]] bool stringify(std::string& buffer, const syrec::Expression& expression) const;
+        [[nodiscard]] bool stringify(std::string& buffer, const syrec::VariableAccess& variableAccess) const;
+        [[nodiscard]] bool stringify(std::string& buffer, const syrec::Number& number) const;
+        [[nodiscard]] bool stringify(std::string& buffer, const syrec::Variable::vec& variables, bool stringifyVariableTypeForEveryEntry) const;
+        [[nodiscard]] bool stringify(std::string& buffer, const syrec::Statement::vec& statements);
+
+        /**
+         * Append the operator of a binary operation to the buffer, optionally surrounded by whitespaces if the formatting options require whitespace between the operands of a binary operation.
+         */
+        [[nodiscard]] bool        appendOperatorOfBinaryOperation(std::string& buffer, std::string_view stringifiedOperator) const;
+        void                      appendNewline(std::string& buffer) const;
+        static void               appendNumber(std::string& buffer, unsigned number);
+        [[nodiscard]] static bool stringifyModuleCallVariant(std::string& buffer, std::string_view moduleCallVariantKeyword, const syrec::Module& callTarget, const std::vector<std::string>& callerArguments);
+    };
+} // namespace utils
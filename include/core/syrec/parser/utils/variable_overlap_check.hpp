@@ -11,6 +11,7 @@
 #pragma once
 
 #include <core/syrec/variable.hpp>
+#include <cstddef>
 #include <cstdint>
 #include <optional>
 #include <string>
@@ -58,4 +59,38 @@ namespace utils {
      * @return In case that either a potential or definitive overlap was detected, a container holding information about the type of overlap and additional information about the overlapping indices (in case of a definitive overlap) from the point of the lhs variable access, otherwise std::nullopt is returned. <br>
      */
     [[nodiscard]] std::optional<VariableAccessOverlapCheckResult> checkOverlapBetweenVariableAccesses(const syrec::VariableAccess& lVariableAccess, const syrec::VariableAccess& rVariableAccess);
+
+    /**
+     * @brief Checks the overlap between a fixed variable access (i.e. the assigned to variable access of an assignment) and any number of other variable accesses.
+     * @details The checker evaluates the indices of the accessed values per dimension and the accessed bitrange of the fixed variable access once during its construction, thus checking the overlap with
+     * every operand of an assignment only requires the evaluation of the indices of the operand. The results of the checks are identical to the ones of utils::checkOverlapBetweenVariableAccesses(...)
+     * with the fixed variable access being used as the lhs operand. The information about the overlapping indices is only stringified on demand (see VariableAccessOverlapCheckResult::stringifyOverlappingIndicesInformation()).
+     */
+    class VariableAccessOverlapChecker {
+    public:
+        explicit VariableAccessOverlapChecker(const syrec::VariableAccess& fixedVariableAccess);
+
+        /**
+         * @brief Check whether the fixed variable access of the checker overlaps the given variable access.
+         * @param variableAccess The rhs operand of the binary overlap operation
+         * @return The result of utils::checkOverlapBetweenVariableAccesses(...) for the fixed variable access and the given variable access.
+         */
+        [[nodiscard]] std::optional<VariableAccessOverlapCheckResult> checkOverlapWith(const syrec::VariableAccess& variableAccess) const;
+
+    protected:
+        struct EvaluatedVariableAccess {
+            syrec::Variable::ptr                    var;
+            std::size_t                             numDefinedIndices;
+            std::vector<std::optional<unsigned int>> constantValuePerDimension;
+            // The accessed value of the first dimension if either no or only a null index was defined for the first dimension, otherwise the constant value of the first index.
+            std::optional<unsigned int> accessedValueOfFirstDimension;
+            std::optional<unsigned int> bitRangeStart;
+            std::optional<unsigned int> bitRangeEnd;
+        };
+
+        EvaluatedVariableAccess fixedVariableAccess;
+
+        [[nodiscard]] static EvaluatedVariableAccess                          evaluateVariableAccess(const syrec::VariableAccess& variableAccess);
+        [[nodiscard]] static std::optional<VariableAccessOverlapCheckResult> checkOverlapBetweenEvaluatedVariableAccesses(const EvaluatedVariableAccess& lVariableAccess, const EvaluatedVariableAccess& rVariableAccess);
+    };
 } // namespace utils
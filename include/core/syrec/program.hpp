@@ -11,13 +11,184 @@
 #pragma once
 
 #include "core/configurable_options.hpp"
+#include "core/statistics.hpp"
 #include "core/syrec/module.hpp"
 
+#include <cstddef>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
+
+namespace utils {
+    class BaseSymbolTable;
+} // namespace utils
 
 namespace syrec {
+    class Program;
+    class IncrementalProgramReader;
+
+    /**
+     * @brief An immutable set of modules, parsed and semantically checked once by a syrec::ProgramReader, that can be linked into many SyReC programs.
+     *
+     * A module library is a SyReC program without a program entry point, i.e. neither the absence of a 'main' module nor the call of its last declared module is reported as an error. The library stores a snapshot of the symbol table
+     * of the parser declaring its modules, which is used as the initial symbol table of the parser of every program linking the library. The modules of the library can thus be called by the modules of a linking program without re-parsing
+     * or re-declaring them, with declaration conflicts between the modules of the program and the library being reported as semantic errors.
+     *
+     * A linking program references the modules of the library instead of copying them, the modules of a linking program should thus not be modified (i.e. by syrec::simplifyProgram(...)). A library can be linked by multiple readers concurrently.
+     */
+    class ModuleLibrary {
+    public:
+        using ptr = std::shared_ptr<const ModuleLibrary>;
+
+        /**
+         * @brief Get the modules of the library in the order of their declaration.
+         */
+        [[nodiscard]] const Module::vec& modules() const noexcept {
+            return modulesVec;
+        }
+
+    private:
+        friend class ProgramReader;
+        Module::vec                                   modulesVec;
+        std::shared_ptr<const utils::BaseSymbolTable> symbolTableSnapshot;
+
+        ModuleLibrary(Module::vec modules, std::shared_ptr<const utils::BaseSymbolTable> symbolTableSnapshot):
+            modulesVec(std::move(modules)), symbolTableSnapshot(std::move(symbolTableSnapshot)) {}
+    };
+
+    /**
+     * @brief A reader of SyReC programs reusing its lexer and parser instances for all programs it reads.
+     *
+     * Programs read from files are mapped into memory and, if they only consist of ASCII characters, lexed directly from the mapped file content without
+     * copying it. Reading many programs with a single reader instance additionally avoids the recreation of the lexer and parser for every program.
+     * A reader can only read one program at a time and must thus not be shared between threads.
+     *
+     * Programs are parsed in two stages, with the second, slower stage using full-context predictions only being required for programs whose parsing failed in the first stage.
+     * The prediction caches of the lexer and parser are shared by all reader instances of the process and kept for the lifetime of the latter.
+     */
+    class ProgramReader {
+    public:
+        ProgramReader();
+        ~ProgramReader();
+
+        ProgramReader(const ProgramReader&)            = delete;
+        ProgramReader& operator=(const ProgramReader&) = delete;
+        ProgramReader(ProgramReader&&) noexcept;
+        ProgramReader& operator=(ProgramReader&&) noexcept;
+
+        /**
+         * @brief Populate the prediction caches shared by all lexer and parser instances of the process by parsing a SyReC program using all productions of the SyReC grammar.
+         *
+         * Calling this function once before processing many small SyReC programs avoids that the cost of the prediction cache population is paid by the first parsed programs.
+         */
+        static void warmUpPredictionCaches();
+
+        /**
+         * @brief Read and parse a SyReC program from a file.
+         *
+         * @param program The program in which the modules of the parsed SyReC program are stored.
+         * @param filename Defines where the SyReC program to process is located.
+         * @param settings The configuration to use by the parser.
+         * @param optionalRecordedStatistics An optional container in which the runtimes of the syntactic analysis and the semantic checks of the parser are recorded.
+         * @return A std::string containing the list of errors found during the processing of the file or the parsing of the SyReC program.
+         */
+        std::string read(Program& program, const std::string& filename, const ConfigurableOptions& settings = ConfigurableOptions{}, Statistics* optionalRecordedStatistics = nullptr);
+
+        /**
+         * @brief Read and parse a SyReC program from a string.
+         *
+         * @param program The program in which the modules of the parsed SyReC program are stored.
+         * @param stringifiedProgram A stringified SyReC program string.
+         * @param settings The configuration to use by the parser.
+         * @param optionalRecordedStatistics An optional container in which the runtimes of the syntactic analysis and the semantic checks of the parser are recorded.
+         * @return A std::string containing the list of errors found during the parsing of the SyReC program.
+         */
+        std::string readFromString(Program& program, const std::string_view& stringifiedProgram, const ConfigurableOptions& settings = ConfigurableOptions{}, Statistics* optionalRecordedStatistics = nullptr);
+
+        /**
+         * @brief Read and parse a SyReC program from a file that can call the modules of a module library.
+         *
+         * @param program The program in which the modules of the linked library, followed by the modules of the parsed SyReC program, are stored.
+         * @param filename Defines where the SyReC program to process is located.
+         * @param linkedLibrary The module library whose modules are declared prior to the modules of the program.
+         * @param settings The configuration to use by the parser.
+         * @param optionalRecordedStatistics An optional container in which the runtimes of the syntactic analysis and the semantic checks of the parser are recorded.
+         * @return A std::string containing the list of errors found during the processing of the file or the parsing of the SyReC program.
+         */
+        std::string read(Program& program, const std::string& filename, const ModuleLibrary& linkedLibrary, const ConfigurableOptions& settings = ConfigurableOptions{}, Statistics* optionalRecordedStatistics = nullptr);
+
+        /**
+         * @brief Read and parse a SyReC program from a string that can call the modules of a module library.
+         *
+         * @param program The program in which the modules of the linked library, followed by the modules of the parsed SyReC program, are stored.
+         * @param stringifiedProgram A stringified SyReC program string.
+         * @param linkedLibrary The module library whose modules are declared prior to the modules of the program.
+         * @param settings The configuration to use by the parser.
+         * @param optionalRecordedStatistics An optional container in which the runtimes of the syntactic analysis and the semantic checks of the parser are recorded.
+         * @return A std::string containing the list of errors found during the parsing of the SyReC program.
+         */
+        std::string readFromString(Program& program, const std::string_view& stringifiedProgram, const ModuleLibrary& linkedLibrary, const ConfigurableOptions& settings = ConfigurableOptions{}, Statistics* optionalRecordedStatistics = nullptr);
+
+        /**
+         * @brief Read, parse and semantically check a module library from a file.
+         *
+         * @param library The parsed library, only set if no error was found.
+         * @param filename Defines where the SyReC modules of the library are located.
+         * @param settings The configuration to use by the parser, the program entry point and the pruning of modules not reachable from the latter are ignored.
+         * @return A std::string containing the list of errors found during the processing of the file or the parsing of the library.
+         */
+        std::string readModuleLibrary(ModuleLibrary::ptr& library, const std::string& filename, const ConfigurableOptions& settings = ConfigurableOptions{});
+
+        /**
+         * @brief Read, parse and semantically check a module library from a string.
+         *
+         * @param library The parsed library, only set if no error was found.
+         * @param stringifiedLibrary The stringified SyReC modules of the library.
+         * @param settings The configuration to use by the parser, the program entry point and the pruning of modules not reachable from the latter are ignored.
+         * @return A std::string containing the list of errors found during the parsing of the library.
+         */
+        std::string readModuleLibraryFromString(ModuleLibrary::ptr& library, const std::string_view& stringifiedLibrary, const ConfigurableOptions& settings = ConfigurableOptions{});
+
+    private:
+        friend class IncrementalProgramReader;
+        struct ParserInstances;
+        std::unique_ptr<ParserInstances> parserInstances;
+
+        /**
+         * @brief Parse the SyReC program defined in the given content.
+         *
+         * @param modulesDeclaredOutsideOfContent Modules that are not part of the content but can be called by the modules of the content, i.e. the unchanged modules of an incrementally re-parsed program.
+         * @param optionalLinkedLibrary The optional module library whose modules can be called by the modules of the content and are prepended to the modules of the \p program.
+         * @param optionalParsedLibrary If set, the content is parsed as a module library which is stored in the given container while the \p program only stores its modules.
+         */
+        std::string readProgramFromContent(Program& program, const std::string_view& content, const std::string& sourceName, const ConfigurableOptions& settings, Statistics* optionalRecordedStatistics, const Module::vec& modulesDeclaredOutsideOfContent = {}, const ModuleLibrary* optionalLinkedLibrary = nullptr, ModuleLibrary::ptr* optionalParsedLibrary = nullptr);
+
+        /**
+         * @brief Determine the offsets of the 'module' keywords starting the module declarations of an ASCII encoded SyReC program by only lexing the program.
+         *
+         * @return The offsets of the module declarations in ascending order or std::nullopt if the lexer reported an error.
+         */
+        [[nodiscard]] std::optional<std::vector<std::size_t>> findOffsetsOfModuleDeclarations(const std::string_view& asciiContent);
+
+        /**
+         * @brief Split an ASCII encoded SyReC program into its module declarations, the first declaration also including the text preceding it.
+         *
+         * @param offsetsOfModuleDeclarations The offsets of the module declarations as determined by findOffsetsOfModuleDeclarations(...).
+         * @return The text of every module declaration including all whitespace and comments up to the next declaration.
+         */
+        [[nodiscard]] static std::vector<std::string_view> splitIntoModuleDeclarations(const std::string_view& asciiContent, const std::vector<std::size_t>& offsetsOfModuleDeclarations);
+
+        /**
+         * @brief Parse contiguous parts of the module declarations of an ASCII encoded SyReC program concurrently and join the parsed modules (see ConfigurableOptions::parseModuleDeclarationsConcurrently).
+         *
+         * @return Whether the program could be parsed without any error, the \p program is not modified otherwise.
+         */
+        [[nodiscard]] bool tryReadModuleDeclarationsConcurrently(Program& program, const std::string_view& asciiContent, const ConfigurableOptions& settings, Statistics* optionalRecordedStatistics);
+    };
+
     class Program {
     public:
         Program() = default;
@@ -50,9 +221,10 @@ namespace syrec {
          *
          * @param filename Defines where the SyReC program to process is located.
          * @param settings The configuration to use by the parser.
+         * @param optionalRecordedStatistics An optional container in which the runtimes of the syntactic analysis and the semantic checks of the parser are recorded.
          * @return A std::string containing the list of errors found during the processing of the file or the parsing of the SyReC program.
          */
-        std::string read(const std::string& filename, const ConfigurableOptions& settings = ConfigurableOptions{});
+        std::string read(const std::string& filename, const ConfigurableOptions& settings = ConfigurableOptions{}, Statistics* optionalRecordedStatistics = nullptr);
 
         /**
          * @brief Read and parse a SyReC program from a string.
@@ -64,11 +236,34 @@ namespace syrec {
          *
          * @param stringifiedProgram A stringified SyReC program string.
          * @param settings The configuration to use by the parser.
+         * @param optionalRecordedStatistics An optional container in which the runtimes of the syntactic analysis and the semantic checks of the parser are recorded.
          * @return A std::string containing the list of errors found during the parsing of the SyReC program.
          */
-        std::string readFromString(const std::string_view& stringifiedProgram, const ConfigurableOptions& settings = ConfigurableOptions{});
+        std::string readFromString(const std::string_view& stringifiedProgram, const ConfigurableOptions& settings = ConfigurableOptions{}, Statistics* optionalRecordedStatistics = nullptr);
+
+        /**
+         * @brief Store the IR of the modules of the program in its binary representation (see syrec::serializeProgram(...)) in a file.
+         *
+         * Loading the stored program with Program::load(...) skips the lexing, parsing and semantic checks required to read the program from its SyReC source.
+         *
+         * @param filename Defines where the binary representation of the program is stored, an existing file is overwritten.
+         * @return A std::string containing the error that prevented the program from being stored.
+         */
+        [[nodiscard]] std::string save(const std::string& filename) const;
+
+        /**
+         * @brief Load a program previously stored with Program::save(...) and replace the modules of this program with the loaded ones.
+         *
+         * The file is mapped into memory with only the identifiers of the program being copied out of its content.
+         *
+         * @param filename Defines where the binary representation of the program to load is located.
+         * @param settings The configuration defining whether the IR nodes of the loaded program are allocated in an arena, all other options are ignored.
+         * @return A std::string containing the error that prevented the program from being loaded, the modules of this program are not modified in case of an error.
+         */
+        [[nodiscard]] std::string load(const std::string& filename, const ConfigurableOptions& settings = ConfigurableOptions{});
 
     private:
+        friend class ProgramReader;
         Module::vec modulesVec;
 
         /**
@@ -85,9 +280,7 @@ namespace syrec {
         *
         * @return true if parsing was successful, otherwise false
         */
-        bool                                            readFile(const std::string& filename, const ConfigurableOptions& settings, std::string& error);
-        bool                                            readProgramFromString(const std::string_view& content, const ConfigurableOptions& settings, std::string&);
-        [[nodiscard]] static std::optional<std::string> tryReadFileContent(const std::string& filename, std::string* foundFileHandlingErrors);
+        bool readFile(const std::string& filename, const ConfigurableOptions& settings, std::string& error);
     };
 
 } // namespace syrec
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/configurable_options.hpp"
+#include "core/statistics.hpp"
+#include "core/syrec/parser/utils/syrec_operation_utils.hpp"
+#include "core/syrec/program.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace syrec {
+    /**
+     * @brief A content addressed cache of the results of the SyReC parser, allowing repeatedly processed SyReC programs to skip the lexing, parsing and semantic checks of the parser.
+     *
+     * The results of the parser are identified by the processed SyReC program together with the fields of the syrec::ConfigurableOptions influencing the parser (the default variable bitwidth,
+     * the integer constant truncation operation, whether access on the assigned to variable parts in the dimension access of variable accesses is allowed, the entry point module identifier and the maximum number of reported errors).
+     * The least recently used results are evicted from the in-memory cache once it stores the maximum number of results. Additionally, the results can be stored in an on-disk cache directory
+     * (shared by multiple processes) from which results evicted from the in-memory cache, or recorded by other processes, are loaded.
+     *
+     * Every program read from the cache receives its own copy of the IR of the cached result, thus modifications of the program (i.e. by syrec::simplifyProgram(...)) do not modify the cache.
+     * The errors found by the parser are cached as well. A cache can only process one program at a time and must thus not be shared between threads.
+     */
+    class ProgramCache {
+    public:
+        static constexpr std::size_t DEFAULT_MAX_NUM_CACHED_PROGRAMS = 256U;
+
+        /**
+         * @brief Construct a program cache.
+         *
+         * @param maxNumCachedPrograms The maximum number of parser results stored in the in-memory cache.
+         * @param optionalOnDiskCacheDirectory The optional directory in which the parser results are additionally stored, the directory is created if it does not exist.
+         */
+        explicit ProgramCache(std::size_t maxNumCachedPrograms = DEFAULT_MAX_NUM_CACHED_PROGRAMS, std::optional<std::string> optionalOnDiskCacheDirectory = std::nullopt);
+
+        /**
+         * @brief Read and parse a SyReC program from a file or load the cached result of the parser for its content.
+         *
+         * @param program The program in which the modules of the parsed SyReC program are stored.
+         * @param filename Defines where the SyReC program to process is located.
+         * @param settings The configuration to use by the parser.
+         * @param optionalRecordedStatistics An optional container in which the runtimes of the syntactic analysis and the semantic checks of the parser are recorded (both are zero if the cached result was used).
+         * @return A std::string containing the list of errors found during the processing of the file or the parsing of the SyReC program.
+         */
+        std::string read(Program& program, const std::string& filename, const ConfigurableOptions& settings = ConfigurableOptions{}, Statistics* optionalRecordedStatistics = nullptr);
+
+        /**
+         * @brief Read and parse a SyReC program from a string or load the cached result of the parser for the string.
+         *
+         * @param program The program in which the modules of the parsed SyReC program are stored.
+         * @param stringifiedProgram A stringified SyReC program string.
+         * @param settings The configuration to use by the parser.
+         * @param optionalRecordedStatistics An optional container in which the runtimes of the syntactic analysis and the semantic checks of the parser are recorded (both are zero if the cached result was used).
+         * @return A std::string containing the list of errors found during the parsing of the SyReC program.
+         */
+        std::string readFromString(Program& program, const std::string_view& stringifiedProgram, const ConfigurableOptions& settings = ConfigurableOptions{}, Statistics* optionalRecordedStatistics = nullptr);
+
+        /**
+         * @brief Remove all parser results from the in-memory cache, the on-disk cache is not modified.
+         */
+        void clear();
+
+        [[nodiscard]] std::size_t getNumCachedPrograms() const noexcept {
+            return cacheEntries.size();
+        }
+
+        /**
+         * @brief Get the number of processed programs whose parser result was loaded from the in-memory or on-disk cache.
+         */
+        [[nodiscard]] std::size_t getNumCacheHits() const noexcept {
+            return numCacheHits;
+        }
+
+        /**
+         * @brief Get the number of processed programs that needed to be parsed.
+         */
+        [[nodiscard]] std::size_t getNumCacheMisses() const noexcept {
+            return numCacheMisses;
+        }
+
+    protected:
+        struct CacheKey {
+            std::uint64_t                             hash;
+            std::string                               stringifiedProgram;
+            unsigned                                  defaultBitwidth;
+            utils::IntegerConstantTruncationOperation integerConstantTruncationOperation;
+            bool                                      allowAccessOnAssignedToVariablePartsInDimensionAccessOfVariableAccess;
+            std::optional<std::string>                optionalProgramEntryPointModuleIdentifier;
+            std::optional<std::size_t>                optionalMaxNumReportedParserErrors;
+            bool                                      pruneModulesNotReachableFromProgramEntryPoint;
+
+            [[nodiscard]] bool operator==(const CacheKey& other) const = default;
+        };
+
+        struct CacheEntry {
+            CacheKey    key;
+            std::string foundErrors;
+            // Empty if the parser found any error
+            std::string serializedProgram;
+        };
+
+        ProgramReader              reader;
+        std::size_t                maxNumCachedPrograms;
+        std::optional<std::string> optionalOnDiskCacheDirectory;
+        std::size_t                numCacheHits   = 0;
+        std::size_t                numCacheMisses = 0;
+
+        // The cache entries ordered from the most to the least recently used one.
+        std::list<CacheEntry>                                             cacheEntries;
+        std::unordered_map<std::uint64_t, std::list<CacheEntry>::iterator> cacheEntryLookup;
+
+        [[nodiscard]] static CacheKey buildCacheKey(const std::string_view& stringifiedProgram, const ConfigurableOptions& settings);
+
+        [[nodiscard]] const CacheEntry* findCacheEntry(const CacheKey& key);
+        void                            insertCacheEntry(CacheEntry cacheEntry);
+
+        [[nodiscard]] std::optional<CacheEntry> tryLoadCacheEntryFromDisk(const CacheKey& key) const;
+        void                                    storeCacheEntryOnDisk(const CacheEntry& cacheEntry) const;
+    };
+} // namespace syrec
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/syrec/ir_node_arena.hpp"
+#include "core/syrec/program.hpp"
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace syrec {
+    /**
+     * @brief Serialize the IR of the modules of a SyReC program into a platform independent binary representation.
+     *
+     * The serialized representation preserves the references of variable accesses to the variables of their modules as well as the references of call/uncall statements to the called modules.
+     * All other IR nodes shared by multiple parents in the serialized program are duplicated in the deserialized program.
+     *
+     * @param program The program to serialize.
+     * @param omitLineNumbers Whether the line numbers of the statements are serialized as zero, thus programs whose IR only differs in the positions of their statements in the source text share the same serialized representation.
+     * @return The serialized program or std::nullopt if the program references a variable or module not declared in the program.
+     */
+    [[nodiscard]] std::optional<std::string> serializeProgram(const Program& program, bool omitLineNumbers = false);
+
+    /**
+     * @brief Deserialize a SyReC program serialized with syrec::serializeProgram(...) and append its modules to a program.
+     *
+     * @param program The program to which the deserialized modules are appended.
+     * @param serializedProgram The serialized program.
+     * @param irNodeArena An optional arena in which the expressions, statements, numbers, variables and variable accesses of the deserialized program are allocated.
+     * @return Whether the serialized program was valid, the given program is not modified if the serialized program was invalid.
+     */
+    [[nodiscard]] bool deserializeProgram(Program& program, std::string_view serializedProgram, const IrNodeArena::ptr& irNodeArena = nullptr);
+} // namespace syrec
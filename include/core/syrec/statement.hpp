@@ -45,23 +45,59 @@ namespace syrec {
         using vec = std::vector<ptr>;
 
         /**
-       * @brief Standard constructor
+       * @brief Kind of a statement
        *
-       * Initializes default values
+       * Every derived statement defines its kind, which allows to dispatch on the
+       * type of a statement with a switch instead of a cascade of dynamic_casts.
+       */
+        enum class Kind : std::uint8_t {
+            Skip,
+            Swap,
+            Unary,
+            Assign,
+            If,
+            For,
+            Call,
+            Uncall
+        };
+
+        /**
+       * @brief Constructor
+       *
+       * @param kind Kind of the derived statement
        */
-        Statement() = default;
+        explicit Statement(const Kind kind):
+            kind(kind) {}
 
         /**
        * @brief Deconstructor
        */
         virtual ~Statement() = default;
 
+        /**
+       * @brief Kind of the statement
+       *
+       * @return Kind of the derived statement
+       */
+        [[nodiscard]] Kind getKind() const noexcept {
+            return kind;
+        }
+
+
         unsigned lineNumber = 0U;
 
         [[maybe_unused]] virtual std::optional<ptr> reverse() = 0;
+
+    private:
+        Kind kind;
     };
 
     struct SkipStatement: Statement {
+        static constexpr Kind KIND = Kind::Skip;
+
+        SkipStatement():
+            Statement(KIND) {}
+
         [[maybe_unused]] std::optional<ptr> reverse() override {
             return std::make_shared<SkipStatement>();
         }
@@ -74,6 +110,8 @@ namespace syrec {
      * between two variables lhs() and rhs().
      */
     struct SwapStatement: Statement {
+        static constexpr Kind KIND = Kind::Swap;
+
         /**
        * @brief Constructor
        *
@@ -82,7 +120,7 @@ namespace syrec {
        */
         SwapStatement(VariableAccess::ptr lhs,
                       VariableAccess::ptr rhs):
-            lhs(std::move(lhs)),
+            Statement(KIND), lhs(std::move(lhs)),
             rhs(std::move(rhs)) {}
 
         [[maybe_unused]] std::optional<ptr> reverse() override {
@@ -100,6 +138,8 @@ namespace syrec {
      * on the variable access var().
      */
     struct UnaryStatement: Statement {
+        static constexpr Kind KIND = Kind::Unary;
+
         /**
        * @brief Type of the statement
        */
@@ -128,7 +168,7 @@ namespace syrec {
        */
         UnaryStatement(const UnaryOperation unaryOperation,
                        VariableAccess::ptr  var):
-            unaryOperation(unaryOperation),
+            Statement(KIND), unaryOperation(unaryOperation),
             var(std::move(var)) {}
 
         [[maybe_unused]] std::optional<ptr> reverse() override {
@@ -160,6 +200,8 @@ namespace syrec {
      * of the expression rhs() to the variable access lhs().
      */
     struct AssignStatement: Statement {
+        static constexpr Kind KIND = Kind::Assign;
+
         /**
        * @brief Type of assignment
        */
@@ -190,7 +232,7 @@ namespace syrec {
         AssignStatement(VariableAccess::ptr   lhs,
                         const AssignOperation assignOperation,
                         Expression::ptr       rhs):
-            lhs(std::move(lhs)),
+            Statement(KIND), lhs(std::move(lhs)),
             assignOperation(assignOperation), rhs(std::move(rhs)) {}
 
         [[maybe_unused]] std::optional<ptr> reverse() override {
@@ -222,12 +264,15 @@ namespace syrec {
      * This class represents the SyReC \b if statement
      */
     struct IfStatement: Statement {
+        static constexpr Kind KIND = Kind::If;
+
         /**
        * @brief Standard constructor
        *
        * Initializes default values
        */
-        IfStatement() = default;
+        IfStatement():
+            Statement(KIND) {}
 
         /**
        * @brief Sets the condition for the execution of the then_statements()
@@ -286,12 +331,15 @@ namespace syrec {
      * This class represents the SyReC \b for statement
      */
     struct ForStatement: Statement {
+        static constexpr Kind KIND = Kind::For;
+
         /**
        * @brief Standard constructor
        *
        * Initializes default values
        */
-        ForStatement() = default;
+        ForStatement():
+            Statement(KIND) {}
 
         /**
        * @brief Adds a statement to be executed in the loop
@@ -316,6 +364,8 @@ namespace syrec {
      * This class represents the SyReC \b call statement to call a module.
      */
     struct CallStatement: Statement {
+        static constexpr Kind KIND = Kind::Call;
+
         /**
        * @brief Constructor with module and parameters
        *
@@ -323,7 +373,7 @@ namespace syrec {
        * @param parameters Parameters to assign
        */
         CallStatement(std::shared_ptr<Module> target, std::vector<std::string> parameters):
-            target(std::move(target)), parameters(std::move(parameters)) {}
+            Statement(KIND), target(std::move(target)), parameters(std::move(parameters)) {}
 
         [[maybe_unused]] std::optional<ptr> reverse() override;
 
@@ -337,6 +387,8 @@ namespace syrec {
      * This class represents the SyReC \b uncall statement to uncall a module.
      */
     struct UncallStatement: Statement {
+        static constexpr Kind KIND = Kind::Uncall;
+
         /**
        * @brief Constructor with module and parameters
        *
@@ -344,7 +396,7 @@ namespace syrec {
        * @param parameters Parameters to assign
        */
         UncallStatement(std::shared_ptr<Module> target, std::vector<std::string> parameters):
-            target(std::move(target)), parameters(std::move(parameters)) {}
+            Statement(KIND), target(std::move(target)), parameters(std::move(parameters)) {}
 
         [[maybe_unused]] std::optional<ptr> reverse() override;
 
@@ -387,4 +439,36 @@ namespace syrec {
         invertedForStmt->step         = step;
         return invertStatementBlock(statements, invertedForStmt->statements) ? std::make_optional(invertedForStmt) : std::nullopt;
     }
+
+    /**
+     * @brief Cast a statement to a derived statement type by comparing its kind instead of using a dynamic_cast
+     *
+     * @param statement The statement to cast
+     * @return Pointer to the derived statement if the statement was not nullptr and its kind matched the kind of the derived statement type, otherwise nullptr
+     */
+    template<typename DerivedStatement>
+    [[nodiscard]] DerivedStatement* statementCast(Statement* statement) noexcept {
+        return statement != nullptr && statement->getKind() == DerivedStatement::KIND ? static_cast<DerivedStatement*>(statement) : nullptr;
+    }
+
+    template<typename DerivedStatement>
+    [[nodiscard]] const DerivedStatement* statementCast(const Statement* statement) noexcept {
+        return statement != nullptr && statement->getKind() == DerivedStatement::KIND ? static_cast<const DerivedStatement*>(statement) : nullptr;
+    }
+
+    /**
+     * @brief Cast a smart pointer of a statement to a smart pointer of a derived statement type by comparing its kind instead of using a std::dynamic_pointer_cast
+     *
+     * @param statement The statement to cast
+     * @return Smart pointer to the derived statement sharing the ownership with the given smart pointer if the statement was not nullptr and its kind matched the kind of the derived statement type, otherwise nullptr
+     */
+    template<typename DerivedStatement>
+    [[nodiscard]] std::shared_ptr<DerivedStatement> statementPointerCast(const std::shared_ptr<Statement>& statement) noexcept {
+        return statement != nullptr && statement->getKind() == DerivedStatement::KIND ? std::static_pointer_cast<DerivedStatement>(statement) : nullptr;
+    }
+
+    template<typename DerivedStatement>
+    [[nodiscard]] std::shared_ptr<const DerivedStatement> statementPointerCast(const std::shared_ptr<const Statement>& statement) noexcept {
+        return statement != nullptr && statement->getKind() == DerivedStatement::KIND ? std::static_pointer_cast<const DerivedStatement>(statement) : nullptr;
+    }
 } // namespace syrec
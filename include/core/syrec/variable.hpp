@@ -12,6 +12,7 @@
 
 #include "core/syrec/number.hpp"
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <optional>
@@ -77,6 +78,10 @@ namespace syrec {
         std::string           name;
         std::vector<unsigned> dimensions;
         unsigned              bitwidth;
+        /**
+         * The dense index of the variable in the parameters and local variables of its declaring module (see syrec::Module::assignDeclarationIndicesOfVariables), std::nullopt if no index was assigned.
+         */
+        std::optional<std::size_t> declarationIndexInModule;
     };
 
     /**
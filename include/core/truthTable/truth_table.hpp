@@ -13,43 +13,198 @@
 #include "dd/Package.hpp"
 
 #include <algorithm>
+#include <bit>
 #include <bitset>
 #include <cassert>
 #include <cmath>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <iterator>
+#include <limits>
 #include <map>
 #include <memory>
 #include <optional>
 #include <queue>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 namespace syrec {
+    class MappedFile;
+    class MappedTruthTable;
 
     class TruthTable {
     public:
+        class CubeCompletions;
+
+        /**
+         * A cube with every position storing either the value 0, 1 or a don't care.
+         *
+         * The cube is stored in a bit-packed representation consisting of a value word and a don't care mask word per 64 positions (similarly to minbool::MinTerm)
+         * with the i-th position of the cube being stored in the bit (i % 64) of the (i / 64)-th word. The words for the first 64 positions are stored inline, thus
+         * cubes with at most 64 positions do not require a heap allocation. The value bit of a don't care position as well as all bits not associated with a position
+         * of the cube are always zero.
+         */
         class Cube {
         public:
             using Value  = std::optional<bool>;
             using Vector = std::vector<Cube>;
             using Set    = std::set<Cube>;
+            using Word   = std::uint64_t;
 
-        private:
-            std::vector<Value> cube{};
+            static constexpr std::size_t BITS_PER_WORD = 64U;
+
+            /**
+             * A proxy providing mutable access to a position of a cube.
+             */
+            class ValueReference {
+            public:
+                ValueReference(Cube& cube, const std::size_t pos):
+                    cube(&cube), pos(pos) {}
+
+                ValueReference(const ValueReference&) = default;
+
+                // NOLINTNEXTLINE(cppcoreguidelines-c-copy-assignment-signature, misc-unconventional-assign-operator) proxy assignment writes the referenced value
+                auto operator=(const ValueReference& other) -> ValueReference& {
+                    cube->set(pos, static_cast<Value>(other));
+                    return *this;
+                }
+
+                auto operator=(const Value& value) -> ValueReference& {
+                    cube->set(pos, value);
+                    return *this;
+                }
+
+                auto operator=(const bool value) -> ValueReference& {
+                    cube->set(pos, Value(value));
+                    return *this;
+                }
+
+                // NOLINTNEXTLINE(google-explicit-constructor) keeping same Interface as a reference to a std::optional<bool>
+                operator Value() const {
+                    return cube->get(pos);
+                }
+
+                [[nodiscard]] auto has_value() const -> bool { // NOLINT(readability-identifier-naming) keeping same Interface as std::optional
+                    return cube->get(pos).has_value();
+                }
+
+                [[nodiscard]] auto value() const -> bool {
+                    return cube->get(pos).value();
+                }
+
+                [[nodiscard]] auto operator*() const -> bool {
+                    return *cube->get(pos);
+                }
+
+                friend auto operator==(const ValueReference& lhs, const ValueReference& rhs) -> bool {
+                    return static_cast<Value>(lhs) == static_cast<Value>(rhs);
+                }
+
+                friend auto operator==(const ValueReference& lhs, const Value& rhs) -> bool {
+                    return static_cast<Value>(lhs) == rhs;
+                }
+
+            private:
+                Cube*       cube;
+                std::size_t pos;
+            };
+
+            /**
+             * A random access iterator over the values of the positions of a cube.
+             */
+            class ConstIterator {
+            public:
+                using iterator_category = std::random_access_iterator_tag;
+                using value_type        = Value;
+                using difference_type   = std::ptrdiff_t;
+                using pointer           = void;
+                using reference         = Value;
+
+                ConstIterator() = default;
+                ConstIterator(const Cube* cube, const difference_type pos):
+                    cube(cube), pos(pos) {}
+
+                auto operator*() const -> Value {
+                    return cube->get(static_cast<std::size_t>(pos));
+                }
+                auto operator[](const difference_type offset) const -> Value {
+                    return cube->get(static_cast<std::size_t>(pos + offset));
+                }
+
+                auto operator++() -> ConstIterator& {
+                    ++pos;
+                    return *this;
+                }
+                auto operator++(int) -> ConstIterator {
+                    auto copy = *this;
+                    ++pos;
+                    return copy;
+                }
+                auto operator--() -> ConstIterator& {
+                    --pos;
+                    return *this;
+                }
+                auto operator--(int) -> ConstIterator {
+                    auto copy = *this;
+                    --pos;
+                    return copy;
+                }
+                auto operator+=(const difference_type offset) -> ConstIterator& {
+                    pos += offset;
+                    return *this;
+                }
+                auto operator-=(const difference_type offset) -> ConstIterator& {
+                    pos -= offset;
+                    return *this;
+                }
+
+                friend auto operator+(ConstIterator it, const difference_type offset) -> ConstIterator {
+                    return it += offset;
+                }
+                friend auto operator+(const difference_type offset, ConstIterator it) -> ConstIterator {
+                    return it += offset;
+                }
+                friend auto operator-(ConstIterator it, const difference_type offset) -> ConstIterator {
+                    return it -= offset;
+                }
+                friend auto operator-(const ConstIterator& lhs, const ConstIterator& rhs) -> difference_type {
+                    return lhs.pos - rhs.pos;
+                }
+                friend auto operator==(const ConstIterator& lhs, const ConstIterator& rhs) -> bool {
+                    return lhs.cube == rhs.cube && lhs.pos == rhs.pos;
+                }
+                friend auto operator<=>(const ConstIterator& lhs, const ConstIterator& rhs) -> std::strong_ordering {
+                    return lhs.pos <=> rhs.pos;
+                }
+
+            private:
+                const Cube*     cube = nullptr;
+                difference_type pos  = 0;
+            };
 
-        public:
             Cube() = default;
-            explicit Cube(std::vector<Value> cube):
-                cube(std::move(cube)) {}
+            explicit Cube(const std::vector<Value>& cube) {
+                reserve(cube.size());
+                for (const auto& v: cube) {
+                    emplace_back(v);
+                }
+            }
 
             Cube(const std::size_t bw, const Value& initializer) {
-                cube.resize(bw, initializer);
+                resize(bw, initializer);
             }
 
             template<class InputIt>
             Cube(InputIt first, InputIt last) {
-                std::copy(first, last, std::back_inserter(cube));
+                for (; first != last; ++first) {
+                    emplace_back(*first);
+                }
             }
 
             static auto getValue(const char& c) -> Value {
@@ -66,28 +221,54 @@ namespace syrec {
                 }
             }
 
+            // the smallest fully specified cube (in the order of their integer values) with the size of the first cube of the set that is not contained in the set (an empty cube if no such cube exists)
             static auto findMissingCube(TruthTable::Cube::Set const& p1SigVec) -> Cube {
-                if (p1SigVec.empty()) {
-                    return {};
+                auto missingCubes = findMissingCubes(p1SigVec, 1U);
+                return missingCubes.empty() ? Cube{} : std::move(missingCubes.front());
+            }
+
+            // the k smallest fully specified cubes (in ascending order of their integer values) with the size of the first cube of the set that are not contained in the set.
+            // since the fully specified cubes of the same size are ordered by their integer values in the set, the missing cubes are determined by a single pass over its sorted integer values.
+            static auto findMissingCubes(TruthTable::Cube::Set const& p1SigVec, const std::size_t k) -> Vector {
+                Vector missingCubes;
+                if (p1SigVec.empty() || k == 0U) {
+                    return missingCubes;
                 }
 
-                const auto    bitwidth = p1SigVec.begin()->size();
-                std::uint64_t idx      = 0U;
-                while (true) {
-                    if (auto cube = Cube::fromInteger(idx, bitwidth); std::find(p1SigVec.begin(), p1SigVec.end(), cube) == p1SigVec.end()) {
-                        return cube;
+                const auto bitwidth = p1SigVec.begin()->size();
+                assert(bitwidth <= 64U);
+                const std::uint64_t largestValue = bitwidth == 64U ? std::numeric_limits<std::uint64_t>::max() : (static_cast<std::uint64_t>(1U) << bitwidth) - 1U;
+
+                std::uint64_t candidate = 0U;
+                for (const auto& cube: p1SigVec) {
+                    if (cube.size() != bitwidth || !cube.hasNoDontCares()) {
+                        continue;
+                    }
+                    const auto presentValue = cube.toInteger();
+                    for (; candidate < presentValue && missingCubes.size() < k; ++candidate) {
+                        missingCubes.emplace_back(fromInteger(candidate, bitwidth));
+                    }
+                    if (missingCubes.size() == k || presentValue == largestValue) {
+                        return missingCubes;
+                    }
+                    candidate = presentValue + 1U;
+                }
+                for (; missingCubes.size() < k; ++candidate) {
+                    missingCubes.emplace_back(fromInteger(candidate, bitwidth));
+                    if (candidate == largestValue) {
+                        break;
                     }
-                    ++idx;
                 }
+                return missingCubes;
             }
 
             // construct a cube from a (64bit) number with a given bitwidth
             static auto fromInteger(const std::uint64_t number, const std::size_t bw) -> Cube {
                 assert(bw <= 64U);
-                Cube cube{};
-                cube.reserve(bw);
+                Cube cube(bw, false);
+                // the most significant bit of the number is stored at the first position of the cube
                 for (std::size_t i = 0U; i < bw; ++i) {
-                    cube.emplace_back((number & (1ULL << (bw - 1U - i))) != 0U);
+                    cube.firstValueWord |= ((number >> (bw - 1U - i)) & 1U) << i;
                 }
                 return cube;
             }
@@ -102,41 +283,50 @@ namespace syrec {
                 return cube;
             }
 
+            // construct a cube from its packed representation, i.e. the value and don't care words of the positions [64 * k, 64 * (k + 1)) of the cube for every word k
+            static auto fromWords(const std::size_t bw, const Word* valueWords, const Word* dontCareWords) -> Cube {
+                Cube cube(bw, false);
+                for (std::size_t k = 0U; k < cube.numWords(); ++k) {
+                    cube.valueWord(k)    = valueWords[k] & ~dontCareWords[k];
+                    cube.dontCareWord(k) = dontCareWords[k];
+                }
+                cube.releaseUnusedStorage();
+                return cube;
+            }
+
             // return integer representation of the cube
             [[nodiscard]] auto toInteger() const -> std::uint64_t {
-                assert(cube.size() <= 64U);
-                assert(std::none_of(cube.cbegin(), cube.cend(), [](auto const& v) { return !v.has_value(); }));
+                assert(size() <= 64U);
+                assert(firstDontCareWord == 0U);
                 std::uint64_t result = 0U;
-                for (std::size_t i = 0U; i < cube.size(); ++i) {
-                    if (*cube[i]) {
-                        result |= (1ULL << (cube.size() - 1U - i));
-                    }
+                for (std::size_t i = 0U; i < size(); ++i) {
+                    result |= ((firstValueWord >> i) & 1U) << (size() - 1U - i);
                 }
                 return result;
             }
 
             // return bool vec representation of the cube (order is b0,b1,b2......bn)
             [[nodiscard]] auto toBoolVec() const -> std::vector<bool> {
-                assert(std::all_of(cube.cbegin(), cube.cend(), [](auto const& v) { return v.has_value(); }));
+                assert(hasNoDontCares());
                 const auto        nBits = size();
                 std::vector<bool> result(nBits);
                 for (std::size_t i = 0U; i < nBits; ++i) {
-                    result[nBits - 1 - i] = *cube[i];
+                    result[nBits - 1 - i] = testValueBit(i);
                 }
                 return result;
             }
 
             // return string representation of the cube
             [[nodiscard]] auto toString() const -> std::string {
-                std::stringstream ss{};
-                for (const auto& i: cube) {
-                    if (!i.has_value()) {
-                        ss << '-';
-                    } else {
-                        ss << (*i ? '1' : '0');
+                std::string result(size(), '0');
+                for (std::size_t i = 0U; i < size(); ++i) {
+                    if (testDontCareBit(i)) {
+                        result[i] = '-';
+                    } else if (testValueBit(i)) {
+                        result[i] = '1';
                     }
                 }
-                return ss.str();
+                return result;
             }
 
             // checks if 2 Cubes are equal irrespective of don't care
@@ -144,12 +334,12 @@ namespace syrec {
                 if (c1.size() != c2.size()) {
                     return false;
                 }
-                const auto nBits = c1.size();
-                for (auto i = 0U; i < nBits; ++i) {
-                    if (equalityUpToDontCare && (!c1[i].has_value() || !c2[i].has_value())) {
-                        continue;
-                    }
-                    if (*c1[i] != *c2[i]) {
+                if (!equalityUpToDontCare) {
+                    return c1 == c2;
+                }
+                for (std::size_t k = 0U; k < c1.numWords(); ++k) {
+                    const Word comparedPositions = ~(c1.getDontCareWord(k) | c2.getDontCareWord(k));
+                    if (((c1.getValueWord(k) ^ c2.getValueWord(k)) & comparedPositions) != 0U) {
                         return false;
                     }
                 }
@@ -157,14 +347,24 @@ namespace syrec {
             }
 
             [[nodiscard]] auto completeCubes() const -> Vector;
+            // lazily enumerates all completions of the cube without materializing them (see CubeCompletions).
+            [[nodiscard]] auto completions() const -> CubeCompletions;
 
             auto insertZero() -> void {
-                cube.insert(cube.begin(), false);
+                // shift all positions by one towards the end of the cube starting with the last word
+                ensureStorageForSize(size() + 1U);
+                ++nBits;
+                for (std::size_t k = numWords() - 1U; k > 0U; --k) {
+                    valueWord(k)    = (valueWord(k) << 1U) | (valueWord(k - 1U) >> (BITS_PER_WORD - 1U));
+                    dontCareWord(k) = (dontCareWord(k) << 1U) | (dontCareWord(k - 1U) >> (BITS_PER_WORD - 1U));
+                }
+                firstValueWord <<= 1U;
+                firstDontCareWord <<= 1U;
             }
             [[nodiscard]] auto append(const Value& v) const -> Cube {
-                auto c = cube;
+                auto c = *this;
                 c.emplace_back(v);
-                return Cube(c);
+                return c;
             }
             [[nodiscard]] auto appendZero() const -> Cube {
                 return append(false);
@@ -173,50 +373,80 @@ namespace syrec {
                 return append(true);
             }
 
-            // pass-through functions for underlying vector
+            // pass-through functions for the positions of the cube
+
+            auto operator[](std::size_t pos) -> ValueReference {
+                return {*this, pos};
+            }
+
+            auto operator[](std::size_t pos) const -> Value {
+                return get(pos);
+            }
 
-            auto operator[](std::size_t pos) -> Value& {
-                return cube[pos];
+            [[nodiscard]] auto get(const std::size_t pos) const -> Value {
+                if (testDontCareBit(pos)) {
+                    return {};
+                }
+                return testValueBit(pos);
             }
 
-            auto operator[](std::size_t pos) const -> const Value& {
-                return cube[pos];
+            auto set(const std::size_t pos, const Value& v) -> void {
+                const Word bitMask = static_cast<Word>(1U) << (pos % BITS_PER_WORD);
+                Word&      value   = valueWord(pos / BITS_PER_WORD);
+                Word&      dc      = dontCareWord(pos / BITS_PER_WORD);
+                value              = v.value_or(false) ? (value | bitMask) : (value & ~bitMask);
+                dc                 = v.has_value() ? (dc & ~bitMask) : (dc | bitMask);
             }
 
+            // lexicographic comparison using the ordering of std::optional<bool> (don't care < 0 < 1) per position
             auto operator<(const Cube& cv) const -> bool {
-                return (cube < cv.cube);
+                return compare(cv) < 0;
             }
 
             auto operator>(const Cube& cv) const -> bool {
-                return (cube > cv.cube);
+                return compare(cv) > 0;
             }
 
             auto operator==(const Cube& cv) const -> bool {
-                return (cube == cv.cube);
+                if (size() != cv.size()) {
+                    return false;
+                }
+                return firstValueWord == cv.firstValueWord && firstDontCareWord == cv.firstDontCareWord && remainingWords == cv.remainingWords;
             }
 
             auto operator!=(const Cube& cv) const -> bool {
-                return (cube != cv.cube);
+                return !(*this == cv);
             }
 
             auto reserve(const std::size_t n) -> void {
-                cube.reserve(n);
-            }
-
-            auto resize(const std::size_t n, Value val = Value()) -> void {
-                cube.resize(n, val);
+                if (const auto requiredNumWords = determineNumberOfWords(n); requiredNumWords > 1U) {
+                    remainingWords.reserve(2U * (requiredNumWords - 1U));
+                }
             }
 
-            auto resize(const std::size_t n, const Value& val) -> void {
-                cube.resize(n, val);
+            auto resize(const std::size_t n, const Value& val = Value()) -> void {
+                const auto oldSize = size();
+                ensureStorageForSize(n);
+                nBits = n;
+                if (n < oldSize) {
+                    releaseUnusedStorage();
+                    return;
+                }
+                for (std::size_t i = oldSize; i < n; ++i) {
+                    set(i, val);
+                }
             }
 
             auto emplace_back(const Value& v) -> void { // NOLINT(readability-identifier-naming) keeping same Interface as std::vector
-                cube.emplace_back(v);
+                ensureStorageForSize(size() + 1U);
+                ++nBits;
+                set(nBits - 1U, v);
             }
 
             auto pop_back() -> void { // NOLINT(readability-identifier-naming) keeping same Interface as std::vector
-                cube.pop_back();
+                set(nBits - 1U, false);
+                --nBits;
+                releaseUnusedStorage();
             }
 
             [[nodiscard]] auto equals(const std::uint64_t num, const std::size_t bw) const -> bool {
@@ -228,32 +458,326 @@ namespace syrec {
             }
 
             [[nodiscard]] auto size() const -> std::size_t {
-                return cube.size();
+                return nBits;
             }
             [[nodiscard]] auto empty() const -> bool {
-                return cube.empty();
+                return nBits == 0U;
             }
-            [[nodiscard]] auto begin() const -> decltype(cube.begin()) {
-                return cube.begin();
+            [[nodiscard]] auto begin() const -> ConstIterator {
+                return {this, 0};
             }
-            [[nodiscard]] auto cbegin() const -> decltype(cube.cbegin()) {
-                return cube.cbegin();
+            [[nodiscard]] auto cbegin() const -> ConstIterator {
+                return begin();
             }
-            [[nodiscard]] auto end() const -> decltype(cube.end()) {
-                return cube.end();
+            [[nodiscard]] auto end() const -> ConstIterator {
+                return {this, static_cast<ConstIterator::difference_type>(nBits)};
             }
-            [[nodiscard]] auto cend() const -> decltype(cube.cend()) {
-                return cube.cend();
+            [[nodiscard]] auto cend() const -> ConstIterator {
+                return end();
+            }
+
+            // access to the packed representation of the cube
+
+            // the number of words required to store the positions of the cube
+            [[nodiscard]] auto numWords() const -> std::size_t {
+                return determineNumberOfWords(nBits);
+            }
+            // the value bits of the positions [64 * k, 64 * (k + 1)) of the cube
+            [[nodiscard]] auto getValueWord(const std::size_t k) const -> Word {
+                return k == 0U ? firstValueWord : remainingWords[2U * (k - 1U)];
+            }
+            // the don't care bits of the positions [64 * k, 64 * (k + 1)) of the cube
+            [[nodiscard]] auto getDontCareWord(const std::size_t k) const -> Word {
+                return k == 0U ? firstDontCareWord : remainingWords[(2U * (k - 1U)) + 1U];
+            }
+            [[nodiscard]] auto hasNoDontCares() const -> bool {
+                for (std::size_t k = 0U; k < numWords(); ++k) {
+                    if (getDontCareWord(k) != 0U) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            // the hash of the cube computed from its size and its packed value and don't care words
+            [[nodiscard]] auto hash() const -> std::size_t {
+                // the words are combined using the finalizer of splitmix64
+                const auto mix = [](Word h) {
+                    h = (h ^ (h >> 30U)) * 0xBF58476D1CE4E5B9U;
+                    h = (h ^ (h >> 27U)) * 0x94D049BB133111EBU;
+                    return h ^ (h >> 31U);
+                };
+                Word h = mix(nBits);
+                for (std::size_t k = 0U; k < numWords(); ++k) {
+                    h = mix(h ^ getValueWord(k));
+                    h = mix(h ^ getDontCareWord(k));
+                }
+                return static_cast<std::size_t>(h);
+            }
+
+        private:
+            std::size_t nBits             = 0U;
+            Word        firstValueWord    = 0U;
+            Word        firstDontCareWord = 0U;
+            // value and don't care words of the positions beyond the first 64 ones stored as interleaved pairs
+            std::vector<Word> remainingWords;
+
+            [[nodiscard]] static auto determineNumberOfWords(const std::size_t n) -> std::size_t {
+                return (n + BITS_PER_WORD - 1U) / BITS_PER_WORD;
+            }
+
+            [[nodiscard]] auto valueWord(const std::size_t k) -> Word& {
+                return k == 0U ? firstValueWord : remainingWords[2U * (k - 1U)];
+            }
+
+            [[nodiscard]] auto dontCareWord(const std::size_t k) -> Word& {
+                return k == 0U ? firstDontCareWord : remainingWords[(2U * (k - 1U)) + 1U];
+            }
+
+            [[nodiscard]] auto testValueBit(const std::size_t pos) const -> bool {
+                return ((getValueWord(pos / BITS_PER_WORD) >> (pos % BITS_PER_WORD)) & 1U) != 0U;
+            }
+
+            [[nodiscard]] auto testDontCareBit(const std::size_t pos) const -> bool {
+                return ((getDontCareWord(pos / BITS_PER_WORD) >> (pos % BITS_PER_WORD)) & 1U) != 0U;
+            }
+
+            auto ensureStorageForSize(const std::size_t n) -> void {
+                if (const auto requiredNumWords = determineNumberOfWords(n); requiredNumWords > 1U && remainingWords.size() < 2U * (requiredNumWords - 1U)) {
+                    remainingWords.resize(2U * (requiredNumWords - 1U), 0U);
+                }
+            }
+
+            auto releaseUnusedStorage() -> void {
+                const auto requiredNumWords = std::max<std::size_t>(determineNumberOfWords(nBits), 1U);
+                remainingWords.resize(2U * (requiredNumWords - 1U));
+                if (const auto numUsedBitsInLastWord = nBits % BITS_PER_WORD; numUsedBitsInLastWord != 0U) {
+                    const Word usedBitsMask = (static_cast<Word>(1U) << numUsedBitsInLastWord) - 1U;
+                    valueWord(requiredNumWords - 1U) &= usedBitsMask;
+                    dontCareWord(requiredNumWords - 1U) &= usedBitsMask;
+                } else if (nBits == 0U) {
+                    firstValueWord    = 0U;
+                    firstDontCareWord = 0U;
+                }
+            }
+
+            // three-way lexicographic comparison of the positions of two cubes
+            [[nodiscard]] auto compare(const Cube& other) const -> int {
+                const auto numCommonPositions = std::min(size(), other.size());
+                for (std::size_t k = 0U; k < determineNumberOfWords(numCommonPositions); ++k) {
+                    Word differingPositions = (getValueWord(k) ^ other.getValueWord(k)) | (getDontCareWord(k) ^ other.getDontCareWord(k));
+                    if (const auto numCommonPositionsInWord = numCommonPositions - (k * BITS_PER_WORD); numCommonPositionsInWord < BITS_PER_WORD) {
+                        differingPositions &= (static_cast<Word>(1U) << numCommonPositionsInWord) - 1U;
+                    }
+                    if (differingPositions != 0U) {
+                        // map each position to its rank in the ordering of std::optional<bool> (don't care: 0, false: 1, true: 2)
+                        const auto pos    = (k * BITS_PER_WORD) + static_cast<std::size_t>(std::countr_zero(differingPositions));
+                        const auto rankOf = [pos](const Cube& c) { return c.testDontCareBit(pos) ? 0 : (c.testValueBit(pos) ? 2 : 1); };
+                        return rankOf(*this) - rankOf(other);
+                    }
+                }
+                if (size() == other.size()) {
+                    return 0;
+                }
+                return size() < other.size() ? -1 : 1;
             }
         };
 
+        /**
+         * A lazily evaluated range over the completions of a cube, i.e. the cubes obtained by assigning a value to every don't care position of the cube.
+         *
+         * The completions are enumerated in Gray code order (consecutive completions only differ in a single position), thus every step only updates a single position
+         * of the current completion instead of copying a completed cube. In contrast to Cube::completeCubes(), the completions are therefore not enumerated in lexicographic order.
+         */
+        class CubeCompletions {
+        public:
+            class Iterator {
+            public:
+                using iterator_category = std::input_iterator_tag;
+                using difference_type   = std::ptrdiff_t;
+                using value_type        = Cube;
+                using reference         = const Cube&;
+                using pointer           = const Cube*;
+
+                Iterator() = default;
+                Iterator(const CubeCompletions& completions, const std::uint64_t index):
+                    completions(&completions), index(index), current(completions.firstCompletion) {}
+
+                auto operator*() const -> reference {
+                    return current;
+                }
+                auto operator->() const -> pointer {
+                    return &current;
+                }
+
+                auto operator++() -> Iterator& {
+                    ++index;
+                    if (index < completions->size()) {
+                        // the index-th completion in Gray code order differs from the previous one in the don't care position given by the least significant set bit of the index
+                        const auto pos = completions->dontCarePositions[static_cast<std::size_t>(std::countr_zero(index))];
+                        current.set(pos, !std::as_const(current)[pos].value_or(false));
+                    }
+                    return *this;
+                }
+                auto operator++(int) -> Iterator {
+                    auto it = *this;
+                    ++(*this);
+                    return it;
+                }
+
+                auto operator==(const Iterator& other) const -> bool {
+                    return index == other.index;
+                }
+
+            private:
+                const CubeCompletions* completions = nullptr;
+                std::uint64_t          index       = 0U;
+                Cube                   current;
+            };
+
+            explicit CubeCompletions(const Cube& cube);
+
+            [[nodiscard]] auto begin() const -> Iterator {
+                return {*this, 0U};
+            }
+            [[nodiscard]] auto end() const -> Iterator {
+                return {*this, size()};
+            }
+
+            // the number of completions, i.e. 2^k for a cube with k don't care positions
+            [[nodiscard]] auto size() const -> std::uint64_t {
+                return static_cast<std::uint64_t>(1U) << dontCarePositions.size();
+            }
+            [[nodiscard]] auto numDontCares() const -> std::size_t {
+                return dontCarePositions.size();
+            }
+
+        private:
+            // the completion assigning false to all don't care positions
+            Cube                     firstCompletion;
+            std::vector<std::size_t> dontCarePositions;
+        };
+
         using CubeMap      = std::map<Cube, Cube>;
         using CubeMultiMap = std::multimap<Cube, Cube>;
+        // the distinct outputs of a truth table in ascending order together with the number of entries mapping to each of them
+        using OutputHistogram = std::vector<std::pair<Cube, std::size_t>>;
+
+        /**
+         * An iterator over the (input, output) entries of a truth table in the order of the inputs.
+         *
+         * Since the inputs of a densely stored truth table are not stored explicitly, dereferencing the iterator yields a pair consisting of a copy of
+         * the input cube and a reference to the stored output cube.
+         */
+        template<bool IsConst>
+        class EntryIterator {
+            using MapIterator     = std::conditional_t<IsConst, CubeMap::const_iterator, CubeMap::iterator>;
+            using DenseOutputs    = std::conditional_t<IsConst, const std::vector<Cube>, std::vector<Cube>>;
+            using OutputReference = std::conditional_t<IsConst, const Cube&, Cube&>;
+
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using difference_type   = std::ptrdiff_t;
+            using value_type        = std::pair<const Cube, Cube>;
+            using reference         = std::pair<const Cube, OutputReference>;
+
+            class ArrowProxy {
+            public:
+                explicit ArrowProxy(reference entry):
+                    entry(std::move(entry)) {}
+
+                auto operator->() const -> const reference* {
+                    return &entry;
+                }
+
+            private:
+                reference entry;
+            };
+            using pointer = ArrowProxy;
+
+            EntryIterator() = default;
+
+            // allow the conversion of a mutable iterator to a const one
+            template<bool OtherIsConst, typename = std::enable_if_t<IsConst && !OtherIsConst>>
+            EntryIterator(const EntryIterator<OtherIsConst>& other): // NOLINT(google-explicit-constructor)
+                mapIt(other.mapIt), denseOutputs(other.denseOutputs), denseIndex(other.denseIndex), denseNumInputs(other.denseNumInputs) {}
+
+            auto operator*() const -> reference {
+                if (denseOutputs == nullptr) {
+                    return {mapIt->first, mapIt->second};
+                }
+                return {Cube::fromInteger(denseIndex, denseNumInputs), (*denseOutputs)[denseIndex]};
+            }
+
+            auto operator->() const -> pointer {
+                return ArrowProxy(**this);
+            }
+
+            auto operator++() -> EntryIterator& {
+                if (denseOutputs == nullptr) {
+                    ++mapIt;
+                } else {
+                    ++denseIndex;
+                }
+                return *this;
+            }
+
+            auto operator++(int) -> EntryIterator {
+                auto copy = *this;
+                ++*this;
+                return copy;
+            }
+
+            auto operator==(const EntryIterator& other) const -> bool {
+                return mapIt == other.mapIt && denseOutputs == other.denseOutputs && denseIndex == other.denseIndex;
+            }
+
+        private:
+            friend class TruthTable;
+            friend class EntryIterator<!IsConst>;
+
+            explicit EntryIterator(MapIterator mapIt):
+                mapIt(mapIt) {}
+
+            EntryIterator(DenseOutputs& denseOutputs, const std::uint64_t denseIndex, const std::size_t denseNumInputs):
+                denseOutputs(&denseOutputs), denseIndex(denseIndex), denseNumInputs(denseNumInputs) {}
+
+            MapIterator   mapIt{};
+            DenseOutputs* denseOutputs   = nullptr;
+            std::uint64_t denseIndex     = 0U;
+            std::size_t   denseNumInputs = 0U;
+        };
+
+        using Iterator      = EntryIterator<false>;
+        using ConstIterator = EntryIterator<true>;
 
     private:
-        CubeMap           cubeMap{};
+        // the entries of the truth table as long as it is not stored densely (in which case the map is empty)
+        CubeMap cubeMap{};
+        // the outputs of a completely specified truth table with the output for the input i being stored at index i (empty if the truth table is not stored densely)
+        std::vector<Cube> denseOutputs{};
+        std::size_t       denseNumInputs = 0U;
         std::vector<bool> constants;
         std::vector<bool> garbage;
+        // the output histogram determined by the last call of outputHistogram(), reset by every operation providing mutable access to the entries
+        mutable std::optional<OutputHistogram> cachedOutputHistogram;
+
+        auto invalidateOutputHistogram() -> void {
+            cachedOutputHistogram.reset();
+        }
+
+        // the input cube of the entry referenced by the iterator (the input of a densely stored truth table is constructed in the given buffer)
+        [[nodiscard]] static auto inputOfEntry(const ConstIterator& it, Cube& buffer) -> const Cube&;
+
+        // the output cube of the entry referenced by the iterator
+        [[nodiscard]] static auto outputOfEntry(const ConstIterator& it) -> const Cube&;
+
+        // the index of the given input in the dense storage, std::nullopt if the input cannot be stored in it
+        [[nodiscard]] auto denseIndexOf(const Cube& input) const -> std::optional<std::uint64_t> {
+            if (input.size() != denseNumInputs || !input.hasNoDontCares()) {
+                return std::nullopt;
+            }
+            return input.toInteger();
+        }
 
     public:
         auto setConstants(std::vector<bool> const& c) -> void {
@@ -296,40 +820,53 @@ namespace syrec {
             return garbage[n];
         }
 
-        auto operator==(const TruthTable& tt) const -> bool {
-            return (cubeMap == tt.cubeMap);
-        }
+        auto operator==(const TruthTable& tt) const -> bool;
 
         auto operator[](const Cube& key) -> Cube& {
+            invalidateOutputHistogram();
+            if (hasDenseStorage()) {
+                if (const auto denseIndex = denseIndexOf(key); denseIndex.has_value()) {
+                    return denseOutputs[*denseIndex];
+                }
+                useSparseStorage();
+            }
             return cubeMap[key];
         }
 
         auto operator[](Cube&& key) -> Cube& {
+            invalidateOutputHistogram();
+            if (hasDenseStorage()) {
+                if (const auto denseIndex = denseIndexOf(key); denseIndex.has_value()) {
+                    return denseOutputs[*denseIndex];
+                }
+                useSparseStorage();
+            }
             return cubeMap[std::move(key)];
         }
 
-        [[nodiscard]] auto begin() -> decltype(cubeMap.begin()) {
-            return cubeMap.begin();
+        [[nodiscard]] auto begin() -> Iterator {
+            invalidateOutputHistogram();
+            return hasDenseStorage() ? Iterator(denseOutputs, 0U, denseNumInputs) : Iterator(cubeMap.begin());
         }
 
-        [[nodiscard]] auto end() -> decltype(cubeMap.end()) {
-            return cubeMap.end();
+        [[nodiscard]] auto end() -> Iterator {
+            return hasDenseStorage() ? Iterator(denseOutputs, denseOutputs.size(), denseNumInputs) : Iterator(cubeMap.end());
         }
 
-        [[nodiscard]] auto begin() const -> decltype(cubeMap.begin()) {
-            return cubeMap.begin();
+        [[nodiscard]] auto begin() const -> ConstIterator {
+            return hasDenseStorage() ? ConstIterator(denseOutputs, 0U, denseNumInputs) : ConstIterator(cubeMap.begin());
         }
 
-        [[nodiscard]] auto end() const -> decltype(cubeMap.end()) {
-            return cubeMap.end();
+        [[nodiscard]] auto end() const -> ConstIterator {
+            return hasDenseStorage() ? ConstIterator(denseOutputs, denseOutputs.size(), denseNumInputs) : ConstIterator(cubeMap.end());
         }
 
         [[nodiscard]] auto empty() const -> bool {
-            return cubeMap.empty();
+            return cubeMap.empty() && denseOutputs.empty();
         }
 
         [[nodiscard]] auto size() const -> std::size_t {
-            return cubeMap.size();
+            return hasDenseStorage() ? denseOutputs.size() : cubeMap.size();
         }
 
         [[nodiscard]] auto max_size() const -> std::size_t { // NOLINT(readability-identifier-naming) keeping same Interface as std::vector
@@ -337,6 +874,9 @@ namespace syrec {
         }
 
         [[nodiscard]] auto nInputs() const -> std::size_t {
+            if (hasDenseStorage()) {
+                return denseNumInputs;
+            }
             if (cubeMap.empty()) {
                 return 0U;
             }
@@ -348,6 +888,9 @@ namespace syrec {
         }
 
         [[nodiscard]] auto nOutputs() const -> std::size_t {
+            if (hasDenseStorage()) {
+                return denseOutputs.front().size();
+            }
             if (cubeMap.empty()) {
                 return 0U;
             }
@@ -358,29 +901,59 @@ namespace syrec {
             return static_cast<std::size_t>(std::count(garbage.begin(), garbage.end(), false));
         }
 
+        // whether the outputs of the truth table are stored in a flat array indexed by the integer value of the inputs
+        [[nodiscard]] auto hasDenseStorage() const -> bool {
+            return !denseOutputs.empty();
+        }
+
+        // switches to the dense storage if the truth table is completely specified, i.e. contains an entry for every fully specified input (returns whether the dense storage is used)
+        auto useDenseStorageIfComplete() -> bool;
+
+        // switches back from the dense to the map based storage (if necessary)
+        auto useSparseStorage() -> void;
+
         auto extract(Cube const& key) -> CubeMap::node_type {
+            invalidateOutputHistogram();
+            useSparseStorage();
             return cubeMap.extract(key);
         }
 
         auto swap(TruthTable& other) noexcept -> void {
             cubeMap.swap(other.cubeMap);
+            denseOutputs.swap(other.denseOutputs);
+            std::swap(denseNumInputs, other.denseNumInputs);
+            cachedOutputHistogram.swap(other.cachedOutputHistogram);
         }
 
-        auto find(const std::uint64_t number, const std::size_t bw) -> decltype(cubeMap.cbegin()) {
-            return cubeMap.find(Cube::fromInteger(number, bw));
+        auto find(const std::uint64_t number, const std::size_t bw) -> Iterator {
+            invalidateOutputHistogram();
+            if (hasDenseStorage()) {
+                return bw == denseNumInputs && number < denseOutputs.size() ? Iterator(denseOutputs, number, denseNumInputs) : end();
+            }
+            return Iterator(cubeMap.find(Cube::fromInteger(number, bw)));
         }
 
-        auto find(const std::string& str) -> decltype(cubeMap.cbegin()) {
-            return cubeMap.find(Cube::fromString(str));
+        auto find(const std::string& str) -> Iterator {
+            return find(Cube::fromString(str));
         }
 
-        auto find(const Cube& c) -> decltype(cubeMap.cbegin()) {
-            return cubeMap.find(c);
+        auto find(const Cube& c) -> Iterator {
+            invalidateOutputHistogram();
+            if (hasDenseStorage()) {
+                const auto denseIndex = denseIndexOf(c);
+                return denseIndex.has_value() ? Iterator(denseOutputs, *denseIndex, denseNumInputs) : end();
+            }
+            return Iterator(cubeMap.find(c));
         }
 
-        template<class It>
-        auto erase(It elem) -> It {
-            return cubeMap.erase(elem);
+        auto erase(Iterator elem) -> Iterator {
+            invalidateOutputHistogram();
+            if (hasDenseStorage()) {
+                const auto input = elem->first;
+                useSparseStorage();
+                return Iterator(cubeMap.erase(cubeMap.find(input)));
+            }
+            return Iterator(cubeMap.erase(elem.mapIt));
         }
 
         // filters the inputs based on the number of primary inputs.
@@ -390,24 +963,251 @@ namespace syrec {
         [[nodiscard]] auto filteredOutput(const Cube& output) const -> Cube;
 
         auto try_emplace(const Cube& input, const Cube& output) -> void { // NOLINT(readability-identifier-naming) keeping same Interface as std::vector
-            assert(cubeMap.empty() || (input.size() == nInputs() && output.size() == nOutputs()));
+            assert(empty() || (input.size() == nInputs() && output.size() == nOutputs()));
+            invalidateOutputHistogram();
+            if (hasDenseStorage()) {
+                if (denseIndexOf(input).has_value()) {
+                    return;
+                }
+                useSparseStorage();
+            }
             cubeMap.try_emplace(input, output);
         }
         auto try_emplace(Cube&& input, Cube&& output) -> void { // NOLINT(readability-identifier-naming) keeping same Interface as std::vector
-            assert(cubeMap.empty() || (input.size() == nInputs() && output.size() == nOutputs()));
+            assert(empty() || (input.size() == nInputs() && output.size() == nOutputs()));
+            invalidateOutputHistogram();
+            if (hasDenseStorage()) {
+                if (denseIndexOf(input).has_value()) {
+                    return;
+                }
+                useSparseStorage();
+            }
             cubeMap.try_emplace(std::move(input), std::move(output));
         }
+        // behaves like try_emplace(...) but starts the search for the position of the entry at the end of the cube map, thus inserting entries in ascending order of their inputs takes amortized constant time per entry
+        auto try_emplace_back(Cube&& input, Cube&& output) -> void { // NOLINT(readability-identifier-naming) keeping same naming as try_emplace
+            assert(empty() || (input.size() == nInputs() && output.size() == nOutputs()));
+            invalidateOutputHistogram();
+            if (hasDenseStorage()) {
+                if (denseIndexOf(input).has_value()) {
+                    return;
+                }
+                useSparseStorage();
+            }
+            if (cubeMap.empty() || cubeMap.crbegin()->first < input) {
+                cubeMap.emplace_hint(cubeMap.cend(), std::move(input), std::move(output));
+            } else {
+                cubeMap.try_emplace(std::move(input), std::move(output));
+            }
+        }
 
         auto insert(CubeMap::node_type nh) -> void {
+            invalidateOutputHistogram();
+            useSparseStorage();
             cubeMap.insert(std::move(nh));
         }
 
-        static auto equal(TruthTable const& tt1, TruthTable const& tt2, bool equalityUpToDontCare = true) -> bool;
+        /**
+         * Checks whether the entries of both truth tables, in the order of their iteration, are equal when restricted to the primary inputs and outputs (the outputs being compared up to don't cares).
+         *
+         * The positions of the primary lines are determined once per truth table and the projected cubes are compared word-wise under the mask of these positions if both truth tables share the same
+         * constant and garbage lines (and position-wise otherwise), thus the comparison does not allocate per entry. The entries can be split into contiguous chunks that are compared in parallel.
+         *
+         * @param tt1 The first truth table.
+         * @param tt2 The second truth table.
+         * @param equalityUpToDontCare Whether the restriction to the primary lines and the equality up to don't cares is used (otherwise the truth tables are compared with operator==).
+         * @param numThreads The number of threads among which the entries are split (a number of threads equal to zero uses one thread per available hardware thread).
+         * @return Whether the truth tables are equal.
+         */
+        static auto equal(TruthTable const& tt1, TruthTable const& tt2, bool equalityUpToDontCare = true, std::size_t numThreads = 1U) -> bool;
+
+        /**
+         * Determine the distinct outputs of the truth table together with the number of entries mapping to each of them.
+         *
+         * The outputs are counted in an open addressing hash table keyed on their packed words with only the distinct outputs being sorted afterwards. The histogram is cached until the
+         * next operation providing mutable access to the entries (i.e. the mutable overloads of begin(), find() and operator[] as well as all operations inserting or erasing entries),
+         * thus it must be requested again after modifying an entry through a reference or iterator obtained prior to its determination. The caching is not thread-safe.
+         *
+         * @return The distinct outputs in ascending order together with their number of occurrences.
+         */
+        [[nodiscard]] auto outputHistogram() const -> const OutputHistogram&;
 
         [[nodiscard]] auto minimumAdditionalLinesRequired() const -> std::size_t;
 
         auto clear() -> void {
+            invalidateOutputHistogram();
             cubeMap.clear();
+            denseOutputs.clear();
+            denseNumInputs = 0U;
         }
+
+        /**
+         * Save the truth table in its binary format to the given file.
+         *
+         * The binary format consists of a header (storing the number of inputs, outputs and entries as well as the constant and garbage lines as bit masks) followed by the entries in the order of
+         * their iteration, i.e. sorted by their inputs. Every entry stores the packed value and don't care words of its input followed by the ones of its output (see Cube) with all words being stored
+         * in the native byte order of the platform. The file can be memory-mapped via mapFile(...).
+         *
+         * @param filename The name of the created file.
+         * @return Whether the file could be written, false if the file could not be opened or the sizes of the cubes of the truth table differ.
+         */
+        [[nodiscard]] auto save(const std::string& filename) const -> bool;
+
+        /**
+         * Memory-map a truth table stored in the binary format created by save(...).
+         *
+         * @param filename The name of the file.
+         * @return The mapped truth table, std::nullopt if the file could not be opened or is not a valid truth table in the binary format (also if it was created on a platform with a different byte order).
+         */
+        [[nodiscard]] static auto mapFile(const std::string& filename) -> std::optional<MappedTruthTable>;
+    };
+
+    /**
+     * A read-only truth table stored in the binary format created by TruthTable::save(...) whose entries are accessed in place in the memory-mapped file (see TruthTable::mapFile(...)).
+     *
+     * The entries are iterated in the order of their inputs with an entry only materializing its input and output cubes when requested. Since the entries are sorted, an entry is searched by a binary
+     * search comparing the packed words of the searched input with the ones stored in the file.
+     */
+    class MappedTruthTable {
+    public:
+        using Word = TruthTable::Cube::Word;
+
+        /**
+         * A view of an entry of a mapped truth table providing access to the packed words of its input and output.
+         */
+        class Entry {
+        public:
+            [[nodiscard]] auto getInputValueWord(const std::size_t k) const -> Word {
+                return words[k];
+            }
+            [[nodiscard]] auto getInputDontCareWord(const std::size_t k) const -> Word {
+                return words[table->numInputWords + k];
+            }
+            [[nodiscard]] auto getOutputValueWord(const std::size_t k) const -> Word {
+                return words[(2U * table->numInputWords) + k];
+            }
+            [[nodiscard]] auto getOutputDontCareWord(const std::size_t k) const -> Word {
+                return words[(2U * table->numInputWords) + table->numOutputWords + k];
+            }
+
+            // materialize the input cube of the entry
+            [[nodiscard]] auto input() const -> TruthTable::Cube {
+                return TruthTable::Cube::fromWords(table->numInputs, words, words + table->numInputWords);
+            }
+
+            // materialize the output cube of the entry
+            [[nodiscard]] auto output() const -> TruthTable::Cube {
+                return TruthTable::Cube::fromWords(table->numOutputs, words + (2U * table->numInputWords), words + (2U * table->numInputWords) + table->numOutputWords);
+            }
+
+        private:
+            friend class MappedTruthTable;
+
+            Entry(const MappedTruthTable* table, const Word* words):
+                table(table), words(words) {}
+
+            const MappedTruthTable* table;
+            const Word*             words;
+        };
+
+        class Iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using difference_type   = std::ptrdiff_t;
+            using value_type        = Entry;
+
+            Iterator() = default;
+
+            auto operator*() const -> Entry {
+                return table->at(index);
+            }
+
+            auto operator++() -> Iterator& {
+                ++index;
+                return *this;
+            }
+
+            auto operator++(int) -> Iterator {
+                auto it = *this;
+                ++index;
+                return it;
+            }
+
+            friend auto operator==(const Iterator& lhs, const Iterator& rhs) -> bool {
+                return lhs.table == rhs.table && lhs.index == rhs.index;
+            }
+
+        private:
+            friend class MappedTruthTable;
+
+            Iterator(const MappedTruthTable* table, const std::size_t index):
+                table(table), index(index) {}
+
+            const MappedTruthTable* table = nullptr;
+            std::size_t             index = 0U;
+        };
+
+        MappedTruthTable(MappedTruthTable&& other) noexcept;
+        MappedTruthTable& operator=(MappedTruthTable&& other) noexcept;
+        MappedTruthTable(const MappedTruthTable&)            = delete;
+        MappedTruthTable& operator=(const MappedTruthTable&) = delete;
+        ~MappedTruthTable();
+
+        [[nodiscard]] auto size() const -> std::size_t {
+            return numEntries;
+        }
+        [[nodiscard]] auto empty() const -> bool {
+            return numEntries == 0U;
+        }
+        [[nodiscard]] auto nInputs() const -> std::size_t {
+            return numInputs;
+        }
+        [[nodiscard]] auto nOutputs() const -> std::size_t {
+            return numOutputs;
+        }
+        [[nodiscard]] auto getConstants() const -> const std::vector<bool>& {
+            return constants;
+        }
+        [[nodiscard]] auto getGarbage() const -> const std::vector<bool>& {
+            return garbage;
+        }
+
+        [[nodiscard]] auto at(const std::size_t index) const -> Entry {
+            assert(index < numEntries);
+            return {this, entryWords + (index * numWordsPerEntry)};
+        }
+        [[nodiscard]] auto begin() const -> Iterator {
+            return {this, 0U};
+        }
+        [[nodiscard]] auto end() const -> Iterator {
+            return {this, numEntries};
+        }
+
+        /**
+         * Search the entry with the given input.
+         *
+         * @param input The input of the searched entry.
+         * @return The index of the entry, std::nullopt if no entry with the given input exists.
+         */
+        [[nodiscard]] auto find(const TruthTable::Cube& input) const -> std::optional<std::size_t>;
+
+        // copy the entries as well as the constant and garbage lines into a (modifiable) truth table
+        [[nodiscard]] auto toTruthTable() const -> TruthTable;
+
+    private:
+        friend class TruthTable;
+
+        MappedTruthTable() = default;
+
+        std::unique_ptr<MappedFile> file;
+        const Word*                 entryWords       = nullptr;
+        std::size_t                 numEntries       = 0U;
+        std::size_t                 numInputs        = 0U;
+        std::size_t                 numOutputs       = 0U;
+        std::size_t                 numInputWords    = 0U;
+        std::size_t                 numOutputWords   = 0U;
+        std::size_t                 numWordsPerEntry = 0U;
+        std::vector<bool>           constants;
+        std::vector<bool>           garbage;
     };
 } // namespace syrec
@@ -33,34 +33,178 @@ if sys.platform == "win32":  # noqa: RUF067 This is actually required on Windows
 
 from ._version import version as __version__
 from .pysyrec import (
+    adder_architecture,
+    ancillary_qubit_uncomputation_strategy,
     annotatable_quantum_computation,
+    background_task_state,
+    batch_simulation,
+    batch_synthesis,
+    build_task,
+    cancellation_token,
+    check_equivalence,
+    check_equivalence_symbolically,
+    checkpointed_simulation,
+    checkpointed_simulation_settings,
+    checkpointed_simulation_statement,
+    clifford_t_lowering_settings,
     configurable_options,
     cost_aware_synthesis,
+    determine_single_faults,
+    determine_t_count,
+    determine_t_depth,
+    diagnostics,
+    differential_verification,
+    differential_verification_mismatch,
+    differential_verification_result,
+    differential_verification_settings,
+    divider_architecture,
+    equivalence_checking_outcome,
+    equivalence_checking_result,
+    equivalence_checking_settings,
+    estimate_resources,
+    execution_limit_violation,
+    execution_limits,
+    fault_simulation,
+    fault_simulation_mode,
+    fault_simulation_result,
+    fault_simulation_settings,
+    frozen_quantum_computation,
+    hybrid_synthesis,
+    incremental_program_reader,
+    incremental_synthesis,
     inlined_qubit_information,
     integer_constant_truncation_operation,
+    interpret_program,
     line_aware_synthesis,
+    line_ordering_settings,
+    loop_optimization_pass_report,
+    loop_optimization_report,
+    loop_optimization_settings,
+    lower_to_clifford_t,
+    memory_usage,
+    multiplier_architecture,
     n_bit_values_container,
+    optimization_pass_manager,
+    optimization_pass_statistics,
+    optimize_loops,
     program,
+    program_cache,
+    program_reader,
+    progress_report,
+    quantum_operation_arrays,
+    quantum_operation_layout,
     qubit_inlining_stack,
     qubit_inlining_stack_entry,
     qubit_label_type,
+    random_stimulus_simulation,
+    reorder_qubits_to_reduce_nearest_neighbor_cost,
+    resource_estimate,
+    reversible_circuit_fault,
+    reversible_circuit_fault_kind,
     simple_simulation,
+    simplify_program,
+    simulate_batch,
+    simulation_program,
+    simulation_task,
     statistics,
+    stimulus_simulation_result,
+    stimulus_simulation_settings,
+    symbolic_simulation_settings,
+    symbolic_simulation_variable_order,
+    synthesis_algorithm,
+    synthesis_cost,
+    synthesis_result_cache,
+    synthesis_sweep,
+    synthesis_sweep_entry,
+    synthesis_sweep_result,
+    synthesized_statement_footprint,
 )
 
 __all__ = [
     "__version__",
+    "adder_architecture",
+    "ancillary_qubit_uncomputation_strategy",
     "annotatable_quantum_computation",
+    "background_task_state",
+    "batch_simulation",
+    "batch_synthesis",
+    "build_task",
+    "cancellation_token",
+    "check_equivalence",
+    "check_equivalence_symbolically",
+    "checkpointed_simulation",
+    "checkpointed_simulation_settings",
+    "checkpointed_simulation_statement",
+    "clifford_t_lowering_settings",
     "configurable_options",
     "cost_aware_synthesis",
+    "determine_single_faults",
+    "determine_t_count",
+    "determine_t_depth",
+    "diagnostics",
+    "differential_verification",
+    "differential_verification_mismatch",
+    "differential_verification_result",
+    "differential_verification_settings",
+    "divider_architecture",
+    "equivalence_checking_outcome",
+    "equivalence_checking_result",
+    "equivalence_checking_settings",
+    "estimate_resources",
+    "execution_limit_violation",
+    "execution_limits",
+    "fault_simulation",
+    "fault_simulation_mode",
+    "fault_simulation_result",
+    "fault_simulation_settings",
+    "frozen_quantum_computation",
+    "hybrid_synthesis",
+    "incremental_program_reader",
+    "incremental_synthesis",
     "inlined_qubit_information",
     "integer_constant_truncation_operation",
+    "interpret_program",
     "line_aware_synthesis",
+    "line_ordering_settings",
+    "loop_optimization_pass_report",
+    "loop_optimization_report",
+    "loop_optimization_settings",
+    "lower_to_clifford_t",
+    "memory_usage",
+    "multiplier_architecture",
     "n_bit_values_container",
+    "optimization_pass_manager",
+    "optimization_pass_statistics",
+    "optimize_loops",
     "program",
+    "program_cache",
+    "program_reader",
+    "progress_report",
+    "quantum_operation_arrays",
+    "quantum_operation_layout",
     "qubit_inlining_stack",
     "qubit_inlining_stack_entry",
     "qubit_label_type",
+    "random_stimulus_simulation",
+    "reorder_qubits_to_reduce_nearest_neighbor_cost",
+    "resource_estimate",
+    "reversible_circuit_fault",
+    "reversible_circuit_fault_kind",
     "simple_simulation",
+    "simplify_program",
+    "simulate_batch",
+    "simulation_program",
+    "simulation_task",
     "statistics",
+    "stimulus_simulation_result",
+    "stimulus_simulation_settings",
+    "symbolic_simulation_settings",
+    "symbolic_simulation_variable_order",
+    "synthesis_algorithm",
+    "synthesis_cost",
+    "synthesis_result_cache",
+    "synthesis_sweep",
+    "synthesis_sweep_entry",
+    "synthesis_sweep_result",
+    "synthesized_statement_footprint",
 ]
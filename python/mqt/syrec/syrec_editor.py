@@ -8,20 +8,35 @@
 
 from __future__ import annotations
 
+import math
 import re
-import sys
 from dataclasses import dataclass
-from io import StringIO
 from pathlib import Path
 from typing import TYPE_CHECKING, Any, cast
 
+import numpy as np
 from mqt.core.ir.operations import OpType
 from PyQt6 import QtCore, QtGui, QtWidgets
 
 from mqt import syrec
 
 if TYPE_CHECKING:
-    from collections.abc import Callable
+    from collections.abc import Callable, Sequence
+
+# The op types of the quantum operations exported via syrec.annotatable_quantum_computation.export_quantum_operations are stored as their integer values
+OP_TYPE_VALUE_X: int = OpType.x.value
+OP_TYPE_VALUE_SWAP: int = OpType.swap.value
+
+# The width of a column of gates and the distance between two qubit lines of the circuit view
+COLUMN_WIDTH: int = 30
+QUBIT_SPACING: int = 30
+# The gates of the viewport are only drawn individually if their columns are at least this wide (in pixels) and their number does not exceed the given limit, otherwise the gates of every few pixels are drawn as a single line
+MIN_COLUMN_WIDTH_IN_PIXELS_OF_DETAILED_GATES: float = 6.0
+MAX_NUM_DETAILED_GATES_IN_VIEWPORT: int = 5000
+PIXELS_PER_AGGREGATED_COLUMN_BUCKET: float = 2.0
+
+# The interval in which the progress and the partial results of the running build or simulation task are polled
+TASK_POLLING_INTERVAL_IN_MILLISECONDS: int = 50
 
 STRINGIFIED_CIRCUIT_VIEW_QUBIT_LABEL_COMPONENTS_EXTRACTOR_REGEX: re.Pattern[str] = re.compile(
     r"^Q:\s*(?P<q>\d+)\s*\|\s*(?P<label>.+)$"
@@ -62,71 +77,56 @@ def does_qubit_label_start_with_internal_qubit_label_prefix(qubit_label: str) ->
     return qubit_label.startswith("__q")
 
 
-class CircuitLineItem(QtWidgets.QGraphicsItemGroup):  # type: ignore[misc]
-    def __init__(self, index: int, width: int, parent: QtWidgets.QWidget | None = None) -> None:
-        QtWidgets.QGraphicsItemGroup.__init__(self, parent)
+class CircuitLineItem(QtWidgets.QGraphicsLineItem):  # type: ignore[misc]
+    def __init__(self, index: int, x_start: float, x_end: float, parent: QtWidgets.QWidget | None = None) -> None:
+        QtWidgets.QGraphicsLineItem.__init__(self, x_start, index * QUBIT_SPACING, x_end, index * QUBIT_SPACING, parent)
 
         # Tool Tip
         self.setToolTip(f'<b><font color="#606060">Line:</font></b> {index:d}')
 
-        # Create sub-lines
-        x = 0
-        for i in range(width + 1):
-            e_width = 15 if i in {0, width} else 30
-            self.addToGroup(QtWidgets.QGraphicsLineItem(x, index * 30, x + e_width, index * 30))
-            x += e_width
-
 
 class GateItem(QtWidgets.QGraphicsItemGroup):  # type: ignore[misc]
     def __init__(
         self,
-        annotatable_quantum_computation: syrec.annotatable_quantum_computation,
-        quantum_operation_index: int,
+        op_type: int,
+        targets: list[int],
+        controls: list[int],
+        tool_tip: str,
         parent: QtWidgets.QWidget | None = None,
     ) -> None:
         QtWidgets.QGraphicsItemGroup.__init__(self, parent)
         self.setFlag(QtWidgets.QGraphicsItem.GraphicsItemFlag.ItemIsSelectable)
+        self.setToolTip(tool_tip)
 
-        quantum_operation = annotatable_quantum_computation[quantum_operation_index]
-        qubits_of_operation = list(quantum_operation.targets)
-        qubits_of_operation.extend(control.qubit for control in quantum_operation.controls)
-        qubits_of_operation.sort()
-
-        quantum_operation_annotations = annotatable_quantum_computation.get_annotations_of_quantum_operation(
-            quantum_operation_index
-        ).items()
-
-        self.setToolTip(
-            "\n".join([f'<b><font color="#606060">{k}:</font></b> {v}' for (k, v) in quantum_operation_annotations])
-        )
-
+        qubits_of_operation = sorted(targets + controls)
         if len(qubits_of_operation) > 1:
             circuit_line = QtWidgets.QGraphicsLineItem(
                 0, qubits_of_operation[0] * 30, 0, qubits_of_operation[-1] * 30, self
             )
             self.addToGroup(circuit_line)
 
-        for t in quantum_operation.targets:
-            if quantum_operation.type_ == OpType.x:
+        for t in targets:
+            if op_type == OP_TYPE_VALUE_X:
                 target = QtWidgets.QGraphicsEllipseItem(-10, t * 30 - 10, 20, 20, self)
                 target_line = QtWidgets.QGraphicsLineItem(0, t * 30 - 10, 0, t * 30 + 10, self)
                 target_line2 = QtWidgets.QGraphicsLineItem(-10, t * 30, 10, t * 30, self)
                 self.addToGroup(target)
                 self.addToGroup(target_line)
                 self.addToGroup(target_line2)
-            if quantum_operation.type_ == OpType.swap:
+            if op_type == OP_TYPE_VALUE_SWAP:
                 cross_tl_br = QtWidgets.QGraphicsLineItem(-5, t * 30 - 5, 5, t * 30 + 5, self)
                 cross_tr_bl = QtWidgets.QGraphicsLineItem(5, t * 30 - 5, -5, t * 30 + 5, self)
                 self.addToGroup(cross_tl_br)
                 self.addToGroup(cross_tr_bl)
 
-        for c in quantum_operation.controls:
-            control = QtWidgets.QGraphicsEllipseItem(-5, c.qubit * 30 - 5, 10, 10, self)
+        for c in controls:
+            control = QtWidgets.QGraphicsEllipseItem(-5, c * 30 - 5, 10, 10, self)
             control.setBrush(QtGui.QColorConstants.Black)
             self.addToGroup(control)
 
 
 class CircuitView(QtWidgets.QGraphicsView):  # type: ignore[misc]
+    # Only the items of the gates, qubit lines and qubit labels located in the viewport are created, they are recreated whenever the viewport is scrolled, resized or zoomed
     qubit_label_clicked = QtCore.pyqtSignal(str, name="qubitLabelClicked")
 
     def __init__(
@@ -139,26 +139,70 @@ class CircuitView(QtWidgets.QGraphicsView):  # type: ignore[misc]
         # Scene
         self.setScene(QtWidgets.QGraphicsScene(self))
         self.scene().setBackgroundBrush(QtGui.QColorConstants.White)
+        # The scene rect is defined by the loaded circuit since the scene only contains the items of the viewport
+        self.scene().setItemIndexMethod(QtWidgets.QGraphicsScene.ItemIndexMethod.NoIndex)
+
+        # Multiple scroll, resize and zoom events of the same event loop iteration only trigger a single update of the items of the viewport
+        self.viewport_update_timer = QtCore.QTimer(self)
+        self.viewport_update_timer.setSingleShot(True)
+        self.viewport_update_timer.setInterval(0)
+        self.viewport_update_timer.timeout.connect(self.update_items_of_viewport)
+        self.horizontalScrollBar().valueChanged.connect(self.schedule_update_of_items_of_viewport)
+        self.verticalScrollBar().valueChanged.connect(self.schedule_update_of_items_of_viewport)
 
         # Load circuit
         self.annotatable_quantum_computation: syrec.annotatable_quantum_computation | None = None
         # We are assuming that the majority of the qubits in a quantum computation are either garbage or ancillary qubits, so checking whether a given qubit is ancillary or garbage is then
         # equal to whether the lookup does NOT contain an entry for the qubit (this should save us some memory since we only need to store the qubit labels of the non-ancillary and non-garbage qubits)
         self.non_ancillary_or_garbage_qubits_lookup: set[int] = set()
-        self.lines: list[CircuitLineItem] = []
-        self.inputs: list[QtWidgets.QGraphicsTextItem | None] = []
-        self.outputs: list[QtWidgets.QGraphicsTextItem | None] = []
+        self.qubit_labels: list[str] = []
+        self.is_qubit_ancillary: list[bool] = []
+        self.is_qubit_garbage: list[bool] = []
+        self.circuit_width: float = 0
+        self.items_of_viewport: list[QtWidgets.QGraphicsItem] = []
+
+        # The quantum operations and their layout are stored as NumPy arrays from which the items of the gates of the viewport are created on demand
+        self.op_types: np.ndarray | None = None
+        self.target_offsets: np.ndarray | None = None
+        self.target_qubits: np.ndarray | None = None
+        self.control_offsets: np.ndarray | None = None
+        self.control_qubits: np.ndarray | None = None
+        self.annotations_indices: np.ndarray | None = None
+        self.tool_tips: list[str] = []
+        self.quantum_operation_layout: syrec.quantum_operation_layout | None = None
+        self.column_per_gate: np.ndarray | None = None
+        self.min_qubit_per_gate: np.ndarray | None = None
+        self.max_qubit_per_gate: np.ndarray | None = None
+        self.column_offsets: np.ndarray | None = None
+        self.gates_ordered_by_column: np.ndarray | None = None
         if annotatable_quantum_computation is not None:
             self.load(annotatable_quantum_computation)
 
     def clear(self) -> None:
         self.scene().clear()
+        self.scene().setSceneRect(QtCore.QRectF())
 
         self.annotatable_quantum_computation = None
         self.non_ancillary_or_garbage_qubits_lookup.clear()
-        self.lines = []
-        self.inputs = []
-        self.outputs = []
+        self.qubit_labels = []
+        self.is_qubit_ancillary = []
+        self.is_qubit_garbage = []
+        self.circuit_width = 0
+        self.items_of_viewport = []
+
+        self.op_types = None
+        self.target_offsets = None
+        self.target_qubits = None
+        self.control_offsets = None
+        self.control_qubits = None
+        self.annotations_indices = None
+        self.tool_tips = []
+        self.quantum_operation_layout = None
+        self.column_per_gate = None
+        self.min_qubit_per_gate = None
+        self.max_qubit_per_gate = None
+        self.column_offsets = None
+        self.gates_ordered_by_column = None
 
     def mousePressEvent(self, event: QtWidgets.QGraphicsSceneMouseEvent) -> None:  # noqa: N802
         graphics_view_position_of_click: QtCore.QPoint = event.pos()
@@ -184,63 +228,190 @@ class CircuitView(QtWidgets.QGraphicsView):  # type: ignore[misc]
         self.clear()
 
         self.annotatable_quantum_computation = annotatable_quantum_computation
-        n_quantum_ops = self.annotatable_quantum_computation.num_ops
-        width = 30 * n_quantum_ops
-
+        internal_qubit_labels = self.annotatable_quantum_computation.get_qubit_labels(syrec.qubit_label_type.internal)
         for i in range(self.annotatable_quantum_computation.num_qubits):
-            line = CircuitLineItem(i, n_quantum_ops)
-            self.lines.append(line)
-            self.scene().addItem(line)
-
             circuit_view_qubit_label = CircuitViewQubitLabel(i, "")
-            internal_qubit_label: str | None = self.annotatable_quantum_computation.get_qubit_label(
-                i, syrec.qubit_label_type.internal
-            )
+            internal_qubit_label: str | None = internal_qubit_labels[i]
             circuit_view_qubit_label.internal_qubit_label = (
                 "<UNKNOWN>" if internal_qubit_label is None else internal_qubit_label
             )
+            self.qubit_labels.append(str(circuit_view_qubit_label))
+            self.is_qubit_ancillary.append(self.annotatable_quantum_computation.is_circuit_qubit_ancillary(i))
+            self.is_qubit_garbage.append(self.annotatable_quantum_computation.is_circuit_qubit_garbage(i))
 
             # Since the qubits generated for SyReC variables of type 'in' are also considered garbage we need to also filter the clickable qubits to only consider qubits whose label starts with the prefix "__q" (marking qubits generated for local variables of a SyReC module).
             should_qubit_line_text_be_clickable = (
-                self.annotatable_quantum_computation.is_circuit_qubit_ancillary(
-                    circuit_view_qubit_label.associated_qubit
-                )
-                or self.annotatable_quantum_computation.is_circuit_qubit_garbage(
-                    circuit_view_qubit_label.associated_qubit
-                )
+                self.is_qubit_ancillary[i] or self.is_qubit_garbage[i]
             ) and does_qubit_label_start_with_internal_qubit_label_prefix(circuit_view_qubit_label.internal_qubit_label)
             if not should_qubit_line_text_be_clickable:
                 self.non_ancillary_or_garbage_qubits_lookup.add(circuit_view_qubit_label.associated_qubit)
 
-            input_qubit_line_text_item = self.add_line_label(
-                0,
-                i * 30,
-                str(circuit_view_qubit_label),
-                QtCore.Qt.AlignmentFlag.AlignRight,
-                self.annotatable_quantum_computation.is_circuit_qubit_ancillary(i),
-                should_qubit_line_text_be_clickable,
+        # The quantum operations are fetched as a single struct of arrays instead of one Python object per quantum operation, the tool tip of every distinct set of annotations is only created once.
+        quantum_operations = self.annotatable_quantum_computation.export_quantum_operations()
+        self.op_types = quantum_operations.op_types
+        self.target_offsets = quantum_operations.target_offsets
+        self.target_qubits = quantum_operations.target_qubits
+        self.control_offsets = quantum_operations.control_offsets
+        self.control_qubits = quantum_operations.control_qubits
+        self.annotations_indices = quantum_operations.annotations_indices
+        self.tool_tips = [
+            "\n".join([f'<b><font color="#606060">{k}:</font></b> {v}' for (k, v) in annotations.items()])
+            for annotations in quantum_operations.distinct_annotations
+        ]
+
+        # The columns and spanned qubits of the gates are determined natively, the gates of a range of columns are then looked up without iterating over all gates.
+        self.quantum_operation_layout = self.annotatable_quantum_computation.determine_layout_of_quantum_operations()
+        self.column_per_gate = self.quantum_operation_layout.column_per_gate
+        self.min_qubit_per_gate = self.quantum_operation_layout.min_qubit_per_gate
+        self.max_qubit_per_gate = self.quantum_operation_layout.max_qubit_per_gate
+        self.column_offsets = self.quantum_operation_layout.column_offsets
+        self.gates_ordered_by_column = self.quantum_operation_layout.gates_ordered_by_column
+
+        self.circuit_width = COLUMN_WIDTH * max(1, self.quantum_operation_layout.num_columns)
+        font_metrics = QtGui.QFontMetricsF(self.scene().font())
+        max_label_width = max((font_metrics.horizontalAdvance(label) for label in self.qubit_labels), default=0.0) + 10
+        self.scene().setSceneRect(
+            -max_label_width,
+            -QUBIT_SPACING,
+            self.circuit_width + 2 * max_label_width,
+            QUBIT_SPACING * (len(self.qubit_labels) + 1),
+        )
+        self.schedule_update_of_items_of_viewport()
+
+    def schedule_update_of_items_of_viewport(self) -> None:
+        if self.annotatable_quantum_computation is not None:
+            self.viewport_update_timer.start()
+
+    def update_items_of_viewport(self) -> None:
+        for item in self.items_of_viewport:
+            self.scene().removeItem(item)
+        self.items_of_viewport = []
+        if self.annotatable_quantum_computation is None or not self.qubit_labels:
+            return
+
+        visible_rect = self.mapToScene(self.viewport().rect()).boundingRect()
+        first_visible_qubit = max(0, math.floor(visible_rect.top() / QUBIT_SPACING))
+        last_visible_qubit = min(len(self.qubit_labels) - 1, math.ceil(visible_rect.bottom() / QUBIT_SPACING))
+        if first_visible_qubit > last_visible_qubit:
+            return
+
+        line_start = max(0.0, visible_rect.left())
+        line_end = min(self.circuit_width, visible_rect.right())
+        for i in range(first_visible_qubit, last_visible_qubit + 1):
+            if line_start < line_end:
+                self.add_item_of_viewport(CircuitLineItem(i, line_start, line_end))
+
+            should_qubit_line_text_be_clickable = i not in self.non_ancillary_or_garbage_qubits_lookup
+            if visible_rect.left() < 0:
+                self.add_line_label(
+                    0,
+                    i * QUBIT_SPACING,
+                    self.qubit_labels[i],
+                    QtCore.Qt.AlignmentFlag.AlignRight,
+                    self.is_qubit_ancillary[i],
+                    should_qubit_line_text_be_clickable,
+                )
+            if visible_rect.right() > self.circuit_width:
+                self.add_line_label(
+                    self.circuit_width,
+                    i * QUBIT_SPACING,
+                    self.qubit_labels[i],
+                    QtCore.Qt.AlignmentFlag.AlignLeft,
+                    self.is_qubit_garbage[i],
+                    should_qubit_line_text_be_clickable,
+                )
+
+        if self.quantum_operation_layout is None or self.quantum_operation_layout.num_columns == 0:
+            return
+
+        # The gates are positioned at the center of their column which starts after the input labels
+        first_visible_column = max(0, math.floor((visible_rect.left() - COLUMN_WIDTH) / COLUMN_WIDTH))
+        last_visible_column = min(
+            self.quantum_operation_layout.num_columns - 1, math.ceil(visible_rect.right() / COLUMN_WIDTH)
+        )
+        if first_visible_column > last_visible_column:
+            return
+
+        column_width_in_pixels = COLUMN_WIDTH * self.transform().m11()
+        gates_of_visible_columns = self.gates_ordered_by_column[
+            self.column_offsets[first_visible_column] : self.column_offsets[last_visible_column + 1]
+        ]
+        visible_gates = gates_of_visible_columns[
+            (self.min_qubit_per_gate[gates_of_visible_columns] <= last_visible_qubit)
+            & (self.max_qubit_per_gate[gates_of_visible_columns] >= first_visible_qubit)
+        ]
+        if column_width_in_pixels >= MIN_COLUMN_WIDTH_IN_PIXELS_OF_DETAILED_GATES and (
+            len(visible_gates) <= MAX_NUM_DETAILED_GATES_IN_VIEWPORT
+        ):
+            self.add_detailed_gates_to_viewport(visible_gates)
+        else:
+            self.add_aggregated_gates_to_viewport(
+                first_visible_column,
+                last_visible_column,
+                first_visible_qubit,
+                last_visible_qubit,
+                column_width_in_pixels,
             )
-            self.inputs.append(input_qubit_line_text_item)
-
-            output_qubit_line_text_item = self.add_line_label(
-                width,
-                i * 30,
-                str(circuit_view_qubit_label),
-                QtCore.Qt.AlignmentFlag.AlignLeft,
-                self.annotatable_quantum_computation.is_circuit_qubit_garbage(i),
-                should_qubit_line_text_be_clickable,
+
+    def add_detailed_gates_to_viewport(self, gates: np.ndarray) -> None:
+        for i in gates.tolist():
+            gate = GateItem(
+                int(self.op_types[i]),
+                self.target_qubits[self.target_offsets[i] : self.target_offsets[i + 1]].tolist(),
+                self.control_qubits[self.control_offsets[i] : self.control_offsets[i + 1]].tolist(),
+                self.tool_tips[self.annotations_indices[i]],
             )
-            self.outputs.append(output_qubit_line_text_item)
+            gate.setPos(int(self.column_per_gate[i]) * COLUMN_WIDTH + COLUMN_WIDTH // 2, 0)
+            self.add_item_of_viewport(gate)
 
-        for i in range(n_quantum_ops):
-            gate = GateItem(self.annotatable_quantum_computation, i)
-            gate.setPos(i * 30 + 15, 0)
-            self.scene().addItem(gate)
+    def add_aggregated_gates_to_viewport(
+        self,
+        first_column: int,
+        last_column: int,
+        first_visible_qubit: int,
+        last_visible_qubit: int,
+        column_width_in_pixels: float,
+    ) -> None:
+        # When zoomed out, all gates of the columns covered by a few pixels of the viewport are drawn as a single line spanning the qubits of all of these gates. Since every column contains at least one gate, the spans of the columns
+        # and of the buckets of columns are determined with a segmented reduction over the gates ordered by their column.
+        num_columns_per_bucket = max(
+            1, math.ceil(PIXELS_PER_AGGREGATED_COLUMN_BUCKET / max(column_width_in_pixels, 1e-9))
+        )
+        first_gate = int(self.column_offsets[first_column])
+        gates = self.gates_ordered_by_column[first_gate : self.column_offsets[last_column + 1]]
+        # The offsets are stored as unsigned integers which cannot be safely cast to the index type of reduceat
+        offsets_of_columns = (self.column_offsets[first_column : last_column + 1] - first_gate).astype(np.intp)
+        min_qubit_per_column = np.minimum.reduceat(self.min_qubit_per_gate[gates], offsets_of_columns)
+        max_qubit_per_column = np.maximum.reduceat(self.max_qubit_per_gate[gates], offsets_of_columns)
+
+        offsets_of_buckets = np.arange(0, len(offsets_of_columns), num_columns_per_bucket, dtype=np.intp)
+        min_qubit_per_bucket = np.maximum(
+            np.minimum.reduceat(min_qubit_per_column, offsets_of_buckets), first_visible_qubit
+        )
+        max_qubit_per_bucket = np.minimum(
+            np.maximum.reduceat(max_qubit_per_column, offsets_of_buckets), last_visible_qubit
+        )
+
+        pen = QtGui.QPen(QtGui.QColorConstants.DarkGray)
+        pen.setCosmetic(True)
+        for bucket_offset, min_qubit, max_qubit in zip(
+            offsets_of_buckets.tolist(), min_qubit_per_bucket.tolist(), max_qubit_per_bucket.tolist(), strict=True
+        ):
+            if min_qubit > max_qubit:
+                continue
+            x = (first_column + bucket_offset) * COLUMN_WIDTH + COLUMN_WIDTH // 2
+            bucket_item = QtWidgets.QGraphicsLineItem(x, min_qubit * QUBIT_SPACING, x, max_qubit * QUBIT_SPACING)
+            bucket_item.setPen(pen)
+            self.add_item_of_viewport(bucket_item)
+
+    def add_item_of_viewport(self, item: QtWidgets.QGraphicsItem) -> None:
+        self.scene().addItem(item)
+        self.items_of_viewport.append(item)
 
     def add_line_label(
         self,
-        x: int,
-        y: int,
+        x: float,
+        y: float,
         text: str,
         align: QtCore.Qt.AlignmentFlag,
         is_ancillary_or_garbage_qubit: bool,
@@ -248,6 +419,7 @@ class CircuitView(QtWidgets.QGraphicsView):  # type: ignore[misc]
     ) -> QtWidgets.QGraphicsTextItem | None:
         text_item = self.scene().addText(text)
         text_item.setPlainText(text)
+        self.items_of_viewport.append(text_item)
 
         if is_ancillary_or_garbage_qubit:
             text_item.setDefaultTextColor(QtGui.QColorConstants.Red)
@@ -260,11 +432,16 @@ class CircuitView(QtWidgets.QGraphicsView):  # type: ignore[misc]
         text_item.setPos(x, y - 12)
         return text_item
 
+    def resizeEvent(self, event: QtGui.QResizeEvent) -> None:  # noqa: N802
+        super().resizeEvent(event)
+        self.schedule_update_of_items_of_viewport()
+
     def wheelEvent(self, event):  # noqa: N802
         factor = 1.2
         if event.angleDelta().y() < 0 or event.angleDelta().x() < 0:
             factor = 1.0 / factor
         self.scale(factor, factor)
+        self.schedule_update_of_items_of_viewport()
 
         return QtWidgets.QGraphicsView.wheelEvent(self, event)
 
@@ -276,6 +453,12 @@ class SyReCEditor(QtWidgets.QWidget):  # type: ignore[misc]
     before_build: Callable[[], None] | None = None
     parser_failed: Callable[[str], None] | None = None
     synthesis_failed: Callable[[str], None] | None = None
+    task_interrupted: Callable[[str], None] | None = None
+
+    # The progress of the running build and simulation task is reported as the number of processed and total work items
+    build_progress = QtCore.pyqtSignal(int, int, name="buildProgress")
+    simulation_progress = QtCore.pyqtSignal(int, int, name="simulationProgress")
+    task_finished = QtCore.pyqtSignal(name="taskFinished")
 
     cost_aware_synthesis = 0
     line_aware_synthesis = 0
@@ -298,7 +481,11 @@ class SyReCEditor(QtWidgets.QWidget):  # type: ignore[misc]
         self.setGeometry(self.left, self.top, self.width, self.height)
         self.layout = QtWidgets.QVBoxLayout()
 
-        self.table = QtWidgets.QTableWidget()
+        # The simulation results are displayed via a model only formatting the rows visible in the view
+        self.table = QtWidgets.QTableView()
+        self.table.verticalHeader().setVisible(False)
+        self.table.horizontalHeader().setSectionResizeMode(QtWidgets.QHeaderView.ResizeMode.Stretch)
+        self.simulation_results: SimulationResultsTableModel | None = None
         self.layout.addWidget(self.table)
         self.setLayout(self.layout)
 
@@ -309,6 +496,7 @@ class SyReCEditor(QtWidgets.QWidget):  # type: ignore[misc]
             QtGui.QIcon.fromTheme("x-office-spreadsheet"), "&Sim...", self.parent
         )  # system-run
         self.stat_action = QtGui.QAction(QtGui.QIcon.fromTheme("applications-other"), "&Stats...", self.parent)
+        self.cancel_action = QtGui.QAction(QtGui.QIcon.fromTheme("process-stop"), "&Cancel", self.parent)
 
         self.buttonCostAware = QtWidgets.QRadioButton("Cost-aware synthesis", self)
         self.buttonCostAware.toggled.connect(self.item_selected)
@@ -320,6 +508,7 @@ class SyReCEditor(QtWidgets.QWidget):  # type: ignore[misc]
 
         self.sim_action.setDisabled(True)
         self.stat_action.setDisabled(True)
+        self.cancel_action.setDisabled(True)
 
         self.open_action.triggered.connect(self.open_file)
 
@@ -329,8 +518,21 @@ class SyReCEditor(QtWidgets.QWidget):  # type: ignore[misc]
 
         self.stat_action.triggered.connect(self.stat)
 
+        self.cancel_action.triggered.connect(self.cancel_running_task)
+
+        # The build and simulation are performed by tasks running on a separate thread without holding the GIL, whose progress and partial results are polled by the GUI thread
+        self.running_task: syrec.build_task | syrec.simulation_task | None = None
+        self.running_task_progress: QtCore.pyqtBoundSignal | None = None
+        self.running_task_partial_results_handler: Callable[[Any], None] | None = None
+        self.running_task_finished_handler: Callable[[Any], None] | None = None
+        self.task_polling_timer = QtCore.QTimer(self)
+        self.task_polling_timer.setInterval(TASK_POLLING_INTERVAL_IN_MILLISECONDS)
+        self.task_polling_timer.timeout.connect(self.poll_running_task)
+
         self.configurable_parser_and_synthesis_options = syrec.configurable_options()
         self.configurable_parser_and_synthesis_options.generate_quantum_operation_annotations = True
+        # Successive builds of the edited program only re-parse the modules changed since the last build
+        self.program_reader = syrec.incremental_program_reader()
 
         self.configurable_parser_and_synthesis_options_update_button = QtWidgets.QPushButton(
             "Update configurable options", self
@@ -388,14 +590,82 @@ class SyReCEditor(QtWidgets.QWidget):  # type: ignore[misc]
             if self.before_build is not None:
                 self.before_build()
 
+    def start_task(
+        self,
+        task: syrec.build_task | syrec.simulation_task,
+        progress: QtCore.pyqtBoundSignal,
+        finished_handler: Callable[[Any], None],
+        partial_results_handler: Callable[[Any], None] | None = None,
+    ) -> None:
+        self.running_task = task
+        self.running_task_progress = progress
+        self.running_task_partial_results_handler = partial_results_handler
+        self.running_task_finished_handler = finished_handler
+
+        self.build_action.setDisabled(True)
+        self.sim_action.setDisabled(True)
+        self.stat_action.setDisabled(True)
+        self.cancel_action.setDisabled(False)
+        self.task_polling_timer.start()
+
+    def cancel_running_task(self) -> None:
+        if self.running_task is not None:
+            self.running_task.cancel()
+
+    def poll_running_task(self) -> None:
+        task = self.running_task
+        if task is None:
+            self.task_polling_timer.stop()
+            return
+
+        # The state is queried prior to the progress so that the progress of a finished task is final
+        is_finished = task.is_finished
+        if self.running_task_progress is not None:
+            self.running_task_progress.emit(task.num_processed_work_items, task.num_work_items)
+        if self.running_task_partial_results_handler is not None:
+            self.running_task_partial_results_handler(task)
+        if not is_finished:
+            return
+
+        finished_handler = self.running_task_finished_handler
+        self.task_polling_timer.stop()
+        self.running_task = None
+        self.running_task_progress = None
+        self.running_task_partial_results_handler = None
+        self.running_task_finished_handler = None
+        self.build_action.setDisabled(False)
+        self.cancel_action.setDisabled(True)
+        self.task_finished.emit()
+        if finished_handler is not None:
+            finished_handler(task)
+
     def build(self) -> None:
+        if self.running_task is not None:
+            return
+
         if self.before_build is not None:
             self.before_build()
 
-        self.prog = syrec.program()
+        self.annotatable_quantum_computation = None
+        synthesis_algorithm = (
+            syrec.synthesis_algorithm.cost_aware if self.cost_aware_synthesis else syrec.synthesis_algorithm.line_aware
+        )
+        # The configurable options are copied by the task, thus updating them during the build does not affect the running build
+        self.start_task(
+            syrec.build_task(
+                self.program_reader, self.getText(), self.configurable_parser_and_synthesis_options, synthesis_algorithm
+            ),
+            self.build_progress,
+            self.finish_build,
+        )
 
-        error_string = self.prog.read_from_string(self.getText(), self.configurable_parser_and_synthesis_options)
+    def finish_build(self, task: syrec.build_task) -> None:
+        if task.state == syrec.background_task_state.cancelled:
+            if self.task_interrupted is not None:
+                self.task_interrupted("Build was cancelled")
+            return
 
+        error_string = task.parser_errors
         if error_string == "PARSE_STRING_FAILED":
             if self.parser_failed is not None:
                 self.parser_failed("Editor is Empty")
@@ -406,35 +676,16 @@ class SyReCEditor(QtWidgets.QWidget):  # type: ignore[misc]
                 self.build_failed(error_string)
             return
 
-        self.annotatable_quantum_computation = syrec.annotatable_quantum_computation(
-            self.configurable_parser_and_synthesis_options.generate_quantum_operation_annotations
-        )
-
-        was_synthesis_successful: bool = False
-        # Since we are redirecting the C++ std::cerr outputstream to the current python sys.stderr when calling the synthesis functions a prior redirection of the sys.stderr stream to a StringIO object is needed to read the contents of the sys.stderr stream.
-        py_stderr_backup = sys.stderr
-        sys.stderr = StringIO()
-
-        aggregate_synthesis_error: str = ""
-        try:
-            if self.cost_aware_synthesis:
-                was_synthesis_successful = syrec.cost_aware_synthesis(
-                    self.annotatable_quantum_computation, self.prog, self.configurable_parser_and_synthesis_options
-                )
-            else:
-                was_synthesis_successful = syrec.line_aware_synthesis(
-                    self.annotatable_quantum_computation, self.prog, self.configurable_parser_and_synthesis_options
-                )
-        finally:
-            aggregate_synthesis_error = sys.stderr.getvalue()
-            sys.stderr = py_stderr_backup  # Restore the python sys.stderr to its original value
-
-        if not was_synthesis_successful:
-            self.annotatable_quantum_computation = None
+        # The synthesis errors are collected by the task since the synthesis does not hold the GIL and can thus not write to the python sys.stderr stream during the synthesis.
+        if task.state != syrec.background_task_state.succeeded:
             if self.synthesis_failed is not None:
-                self.synthesis_failed(aggregate_synthesis_error)
+                self.synthesis_failed("\n".join(task.error_messages))
             return
 
+        # The returned objects keep the task, which owns them, alive
+        self.prog = task.program
+        self.annotatable_quantum_computation = task.annotatable_quantum_computation
+
         self.sim_action.setDisabled(False)
         self.stat_action.setDisabled(False)
 
@@ -461,12 +712,30 @@ class SyReCEditor(QtWidgets.QWidget):  # type: ignore[misc]
         n_total_qubits = self.annotatable_quantum_computation.num_qubits
         quantum_cost_for_synthesis = self.annotatable_quantum_computation.get_quantum_cost_for_synthesis()
         transistor_cost_for_synthesis = self.annotatable_quantum_computation.get_transistor_cost_for_synthesis()
+        depth_analysis = self.annotatable_quantum_computation.analyze_depth()
 
-        temp = "Number of quantum operations:\t\t{}\nNumber of qubits:\t\t{}\nQuantum cost for synthesis:\t{}\nTransistor cost for synthesis:\t{}\n"
+        temp = "Number of quantum operations:\t\t{}\nNumber of qubits:\t\t{}\nQuantum cost for synthesis:\t{}\nTransistor cost for synthesis:\t{}\nDepth:\t\t\t\t{}\n"
 
         output = temp.format(
-            n_quantum_operations, n_total_qubits, quantum_cost_for_synthesis, transistor_cost_for_synthesis
+            n_quantum_operations,
+            n_total_qubits,
+            quantum_cost_for_synthesis,
+            transistor_cost_for_synthesis,
+            depth_analysis.depth,
+        )
+
+        # The statements contributing the most quantum operations to the critical path are listed in descending order of their contribution
+        critical_path_per_statement_line_number = sorted(
+            depth_analysis.num_quantum_operations_of_critical_path_per_statement_line_number.items(),
+            key=lambda entry: entry[1],
+            reverse=True,
         )
+        if critical_path_per_statement_line_number:
+            output += "\nQuantum operations of critical path per line:\n"
+            output += "".join(
+                f"Line {line_number}:\t\t\t\t{num_quantum_operations}\n"
+                for line_number, num_quantum_operations in critical_path_per_statement_line_number[:5]
+            )
 
         msg = QtWidgets.QMessageBox()
         msg.setBaseSize(QtCore.QSize(300, 200))
@@ -476,11 +745,12 @@ class SyReCEditor(QtWidgets.QWidget):  # type: ignore[misc]
         msg.exec()
 
     def sim(self) -> None:
+        if self.running_task is not None:
+            return
+
         bit1_mask = 0
 
         no_of_bits = self.annotatable_quantum_computation.num_qubits
-        all_inputs_bit_mask = 2**self.annotatable_quantum_computation.num_data_qubits - 1
-        input_list = [all_inputs_bit_mask & x for x in range(2**self.annotatable_quantum_computation.num_data_qubits)]
 
         n_ancilla_qubits = self.annotatable_quantum_computation.num_ancilla_qubits
         n_data_qubits = self.annotatable_quantum_computation.num_data_qubits
@@ -517,80 +787,125 @@ class SyReCEditor(QtWidgets.QWidget):  # type: ignore[misc]
                 ):
                     bit1_mask += 2**i
 
-        input_list_len = len(input_list)
+        # Every assignment of the data qubits is simulated with the ancillary qubits being initialized by the X gates at the start of the quantum computation.
+        # The rows are sorted by the value of the input states with the first qubit being the most significant bit, the input states are thus simulated in the order of their rows
+        # (i.e. with the bits of the row index being reversed) so that the partial results of the running simulation can be appended to the table without sorting them
+        row_indices = np.arange(2**n_data_qubits, dtype=np.uint64)
+        input_states = np.zeros_like(row_indices)
+        for i in range(n_data_qubits):
+            input_states |= ((row_indices >> np.uint64(n_data_qubits - 1 - i)) & np.uint64(1)) << np.uint64(i)
+
+        qubit_labels = []
+        # One could display the user declared qubit label for the qubits of the local variables of a module but since these variable identifiers could be identical to ones from a different module, we display the internal qubit label instead.
+        internal_qubit_labels = self.annotatable_quantum_computation.get_qubit_labels(syrec.qubit_label_type.internal)
+        for i in range(no_of_bits):
+            io_qubit_label: str | None = internal_qubit_labels[i]
+            # Fetching the matching label for a qubit of the annotatable quantum computation should not fail but in case it does, assume a default qubit label <UNKNOWN>.
+            # We still display the column in any case because otherwise the user would be shown a different number of qubits than the number of qubits that actual exist in the annotatable quantum computation.
+            qubit_labels.append(io_qubit_label if io_qubit_label is not None else "<UNKNOWN>")
 
-        combination_inp = []
-        combination_out = []
+        self.simulation_results = SimulationResultsTableModel(qubit_labels, input_states, bit1_mask, self.table)
+        self.table.setModel(self.simulation_results)
+        self.show()
 
-        final_inp = []
-        final_out = []
+        # The batch simulation of integer states, with the q-th bit of a state storing the value of qubit q, is limited to 64 qubits
+        if no_of_bits <= 64:
+            self.start_task(
+                syrec.simulation_task(self.annotatable_quantum_computation, input_states),
+                self.simulation_progress,
+                self.finish_simulation,
+                self.add_simulated_rows_to_table,
+            )
+            return
 
-        for i in input_list:
-            my_inp_bitset = syrec.n_bit_values_container(no_of_bits, i)
-            my_out_bitset = syrec.n_bit_values_container(no_of_bits)
-            syrec.simple_simulation(my_out_bitset, self.annotatable_quantum_computation, my_inp_bitset)
+        output_bit_values_containers = syrec.batch_simulation(
+            self.annotatable_quantum_computation,
+            [syrec.n_bit_values_container(no_of_bits, int(i)) for i in input_states],
+        )
+        if len(output_bit_values_containers) != len(input_states):
+            return
+        # The i-th character of a stringified container stores the value of qubit i
+        self.simulation_results.append_outputs([int(str(state)[::-1], 2) for state in output_bit_values_containers])
 
-            inp_bitset_with_ancillaes_set = syrec.n_bit_values_container(no_of_bits, i + bit1_mask)
-            combination_inp.append(str(inp_bitset_with_ancillaes_set))
-            combination_out.append(str(my_out_bitset))
+    def add_simulated_rows_to_table(self, task: syrec.simulation_task) -> None:
+        self.simulation_results.append_outputs(task.outputs)
 
-        sorted_ind = sorted(range(len(combination_inp)), key=lambda k: int(combination_inp[k], 2))
+    def finish_simulation(self, task: syrec.simulation_task) -> None:
+        self.sim_action.setDisabled(False)
+        self.stat_action.setDisabled(False)
+        if task.state == syrec.background_task_state.succeeded:
+            return
 
-        for i in sorted_ind:
-            final_inp.append(combination_inp[i])
-            final_out.append(combination_out[i])
+        if self.task_interrupted is not None:
+            if task.state == syrec.background_task_state.cancelled:
+                self.task_interrupted(
+                    f"Simulation was cancelled after {self.simulation_results.rowCount()} of {len(task.inputs)} input states"
+                )
+            else:
+                self.task_interrupted("\n".join(["Simulation failed", *task.error_messages]))
 
-        # Initiate table
-        self.table.clear()
-        self.table.setRowCount(0)
-        self.table.setColumnCount(0)
-        self.table.setRowCount(input_list_len + 2)
-        self.table.setColumnCount(2 * no_of_bits)
 
-        self.table.setSpan(0, 0, 1, no_of_bits)
-        header1 = QtWidgets.QTableWidgetItem("INPUTS")
-        header1.setTextAlignment(QtCore.Qt.AlignmentFlag.AlignCenter)
-        self.table.setItem(0, 0, header1)
+class SimulationResultsTableModel(QtCore.QAbstractTableModel):  # type: ignore[misc]
+    """Table of the simulated input states and their output states with the value of every qubit being displayed in its own column.
 
-        self.table.setSpan(0, no_of_bits, 1, no_of_bits)
-        header2 = QtWidgets.QTableWidgetItem("OUTPUTS")
-        header2.setTextAlignment(QtCore.Qt.AlignmentFlag.AlignCenter)
-        self.table.setItem(0, no_of_bits, header2)
+    The cells are only formatted when the view requests them, i.e. only the rows visible in the view are formatted while the states of all rows are stored as integers with the q-th bit of a state storing the value of qubit q.
+    """
 
-        self.table.horizontalHeader().setVisible(False)
-        self.table.verticalHeader().setVisible(False)
+    def __init__(
+        self,
+        qubit_labels: list[str],
+        input_states: Sequence[int],
+        ancilla_qubit_values_mask: int,
+        parent: QtCore.QObject | None = None,
+    ) -> None:
+        super().__init__(parent)
+        self.qubit_labels = qubit_labels
+        self.input_states = input_states
+        # The ancillary qubits are initialized by the quantum computation, their initial value is thus not part of the simulated input states
+        self.ancilla_qubit_values_mask = ancilla_qubit_values_mask
+        self.output_states: Sequence[int] = []
+
+    def append_outputs(self, output_states: Sequence[int]) -> None:
+        """Display the rows of the input states whose output states were not yet displayed, the given output states must start with the already displayed ones."""
+        num_rows = len(self.output_states)
+        if len(output_states) <= num_rows:
+            return
 
-        for i in range(no_of_bits):
-            # One could display the user declared qubit label for the qubits of the local variables of a module but since these variable identifiers could be identical to ones from a different module, we display the internal qubit label instead.
-            io_qubit_label: str | None = self.annotatable_quantum_computation.get_qubit_label(
-                i, syrec.qubit_label_type.internal
-            )
-            # Fetching the matching label for a qubit of the annotatable quantum computation should not fail but in case it does, assume a default qubit label <UNKNOWN>.
-            # We still display the column in any case because otherwise the user would be shown a different number of qubits than the number of qubits that actual exist in the annotatable quantum computation.
-            if io_qubit_label is None:
-                io_qubit_label = "<UNKNOWN>"
+        self.beginInsertRows(QtCore.QModelIndex(), num_rows, len(output_states) - 1)
+        self.output_states = output_states
+        self.endInsertRows()
 
-            input_signal = QtWidgets.QTableWidgetItem(io_qubit_label)
-            input_signal.setTextAlignment(QtCore.Qt.AlignmentFlag.AlignCenter)
-            self.table.setItem(1, i, QtWidgets.QTableWidgetItem(input_signal))
+    def rowCount(self, parent: QtCore.QModelIndex | None = None) -> int:  # noqa: N802
+        return 0 if parent is not None and parent.isValid() else len(self.output_states)
 
-            output_signal = QtWidgets.QTableWidgetItem(io_qubit_label)
-            output_signal.setTextAlignment(QtCore.Qt.AlignmentFlag.AlignCenter)
-            self.table.setItem(1, i + no_of_bits, QtWidgets.QTableWidgetItem(output_signal))
+    def columnCount(self, parent: QtCore.QModelIndex | None = None) -> int:  # noqa: N802
+        return 0 if parent is not None and parent.isValid() else 2 * len(self.qubit_labels)
 
-        for i in range(input_list_len):
-            for j in range(no_of_bits):
-                input_cell = QtWidgets.QTableWidgetItem(final_inp[i][j])
-                input_cell.setTextAlignment(QtCore.Qt.AlignmentFlag.AlignCenter)
-                self.table.setItem(i + 2, j, QtWidgets.QTableWidgetItem(input_cell))
+    def data(self, index: QtCore.QModelIndex, role: int = QtCore.Qt.ItemDataRole.DisplayRole) -> Any:
+        if not index.isValid():
+            return None
+        if role == QtCore.Qt.ItemDataRole.TextAlignmentRole:
+            return QtCore.Qt.AlignmentFlag.AlignCenter
+        if role != QtCore.Qt.ItemDataRole.DisplayRole:
+            return None
 
-                output_cell = QtWidgets.QTableWidgetItem(final_out[i][j])
-                output_cell.setTextAlignment(QtCore.Qt.AlignmentFlag.AlignCenter)
-                self.table.setItem(i + 2, j + no_of_bits, QtWidgets.QTableWidgetItem(output_cell))
+        row = index.row()
+        qubit = index.column()
+        if qubit < len(self.qubit_labels):
+            state = int(self.input_states[row]) | self.ancilla_qubit_values_mask
+        else:
+            state = int(self.output_states[row])
+            qubit -= len(self.qubit_labels)
+        return str((state >> qubit) & 1)
 
-        self.table.horizontalHeader().setStretchLastSection(True)
-        self.table.horizontalHeader().setSectionResizeMode(QtWidgets.QHeaderView.ResizeMode.Stretch)
-        self.show()
+    def headerData(  # noqa: N802
+        self, section: int, orientation: QtCore.Qt.Orientation, role: int = QtCore.Qt.ItemDataRole.DisplayRole
+    ) -> Any:
+        if role != QtCore.Qt.ItemDataRole.DisplayRole or orientation != QtCore.Qt.Orientation.Horizontal:
+            return None
+        if section < len(self.qubit_labels):
+            return f"IN {self.qubit_labels[section]}"
+        return f"OUT {self.qubit_labels[section - len(self.qubit_labels)]}"
 
 
 class SyReCHighlighter(QtGui.QSyntaxHighlighter):  # type: ignore[misc]
@@ -978,10 +1293,9 @@ class CircuitQubitsInformationLookup(QtWidgets.QWidget):  # type: ignore[misc]
         self.annotatable_quantum_computation = annotatable_quantum_computation
 
         sorted_qubit_labels: list[str] = []
+        internal_qubit_labels = self.annotatable_quantum_computation.get_qubit_labels(syrec.qubit_label_type.internal)
         for i in range(self.annotatable_quantum_computation.num_qubits):
-            internal_qubit_label: str | None = self.annotatable_quantum_computation.get_qubit_label(
-                i, syrec.qubit_label_type.internal
-            )
+            internal_qubit_label: str | None = internal_qubit_labels[i]
 
             # Fetching the internal qubit label for a valid qubit of the annotatable quantum computation should not fail but we handle the error case nevertheless.
             if internal_qubit_label is None:
@@ -1270,6 +1584,7 @@ class MainWindow(QtWidgets.QMainWindow):  # type: ignore[misc]
         self.setup_dock_widgets()
         self.setup_actions()
         self.setup_toolbar()
+        self.setup_status_bar()
 
     def setup_widgets(self) -> None:
         self.editor = QtSyReCEditor(self)
@@ -1301,6 +1616,7 @@ class MainWindow(QtWidgets.QMainWindow):  # type: ignore[misc]
         self.editor.parser_failed = self.logWidget.addMessage
         self.editor.build_failed = self.filter_and_record_parser_errors
         self.editor.synthesis_failed = self.filter_and_record_synthesis_errors
+        self.editor.task_interrupted = self.logWidget.addMessage
 
     def handle_qubit_label_click_of_circuit_view(self, stringified_circuit_view_qubit_label: str) -> None:
         destringified_circuit_view_qubit_label = CircuitViewQubitLabel.load_from_string(
@@ -1352,10 +1668,26 @@ class MainWindow(QtWidgets.QMainWindow):  # type: ignore[misc]
         toolbar.addAction(self.editor.build_action)
         toolbar.addAction(self.editor.sim_action)
         toolbar.addAction(self.editor.stat_action)
+        toolbar.addAction(self.editor.cancel_action)
         toolbar.addWidget(self.editor.buttonCostAware)
         toolbar.addWidget(self.editor.buttonLineAware)
         toolbar.addWidget(self.editor.configurable_parser_and_synthesis_options_update_button)
 
+    def setup_status_bar(self) -> None:
+        self.task_progress_bar = QtWidgets.QProgressBar(self)
+        self.task_progress_bar.setMaximumWidth(200)
+        self.task_progress_bar.hide()
+        self.statusBar().addPermanentWidget(self.task_progress_bar)
+
+        self.editor.buildProgress.connect(self.update_task_progress_bar)
+        self.editor.simulationProgress.connect(self.update_task_progress_bar)
+        self.editor.taskFinished.connect(self.task_progress_bar.hide)
+
+    def update_task_progress_bar(self, num_processed_work_items: int, num_work_items: int) -> None:
+        self.task_progress_bar.setMaximum(max(num_work_items, 1))
+        self.task_progress_bar.setValue(num_processed_work_items)
+        self.task_progress_bar.show()
+
 
 def main() -> int:
     a = QtWidgets.QApplication([])
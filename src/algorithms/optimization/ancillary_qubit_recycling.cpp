@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/optimization/ancillary_qubit_recycling.hpp"
+
+#include "algorithms/simulation/device_simulation_kernels.hpp"
+#include "algorithms/simulation/simple_simulation.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/operations/Control.hpp"
+#include "ir/operations/Operation.hpp"
+#include "ir/operations/StandardOperation.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <queue>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    constexpr std::size_t POSITION_OF_NOT_ACCESSED_QUBIT = std::numeric_limits<std::size_t>::max();
+
+    // The i-th input qubit stores the i-th bit of the index of the assignment simulated in a lane, the lanes of the last block repeat earlier assignments if there are less than 64 assignments.
+    void initializeLaneValuesOfBlock(const std::vector<qc::Qubit>& inputQubits, const std::size_t numQubits, const std::uint64_t block, std::vector<std::uint64_t>& laneValuesPerQubit) {
+        laneValuesPerQubit.assign(numQubits, 0U);
+        for (std::size_t i = 0; i < inputQubits.size(); ++i) {
+            laneValuesPerQubit[inputQubits[i]] = device::determineLaneValuesOfPrimaryInput(true, block, i, 0U);
+        }
+    }
+
+    [[nodiscard]] bool simulateBlock(const std::vector<const qc::Operation*>& quantumOperations, std::vector<std::uint64_t>& laneValuesPerQubit) {
+        return std::ranges::all_of(quantumOperations, [&](const qc::Operation* quantumOperation) { return coreOperationBatchSimulation(*quantumOperation, laneValuesPerQubit); });
+    }
+} // namespace
+
+std::size_t syrec::recycleAncillaryQubits(AnnotatableQuantumComputation& annotatableQuantumComputation, const AncillaryQubitRecyclingSettings& settings) {
+    const std::size_t numQubits = annotatableQuantumComputation.getNqubits();
+    if (annotatableQuantumComputation.getNumForwardedQuantumOperations() != 0U || numQubits == 0U) {
+        return 0U;
+    }
+
+    std::vector<const qc::Operation*> quantumOperations;
+    std::vector<std::size_t>          firstPositionPerQubit(numQubits, POSITION_OF_NOT_ACCESSED_QUBIT);
+    std::vector<std::size_t>          lastPositionPerQubit(numQubits, 0U);
+    quantumOperations.reserve(annotatableQuantumComputation.getNops());
+    for (std::size_t position = 0; position < annotatableQuantumComputation.getNops(); ++position) {
+        const qc::Operation* quantumOperation = annotatableQuantumComputation.at(position).get();
+        if (quantumOperation == nullptr || !quantumOperation->isStandardOperation()) {
+            return 0U;
+        }
+        quantumOperations.emplace_back(quantumOperation);
+
+        const auto recordAccessOfQubit = [&](const qc::Qubit qubit) {
+            firstPositionPerQubit[qubit] = std::min(firstPositionPerQubit[qubit], position);
+            lastPositionPerQubit[qubit]  = position;
+        };
+        if (std::ranges::any_of(quantumOperation->getTargets(), [&](const qc::Qubit qubit) { return qubit >= numQubits; }) || std::ranges::any_of(quantumOperation->getControls(), [&](const qc::Control& controlQubit) { return controlQubit.qubit >= numQubits; })) {
+            return 0U;
+        }
+        std::ranges::for_each(quantumOperation->getTargets(), recordAccessOfQubit);
+        std::ranges::for_each(quantumOperation->getControls(), [&](const qc::Control& controlQubit) { recordAccessOfQubit(controlQubit.qubit); });
+    }
+
+    // Since merging an ancillary qubit that is not restored for some assignment would change the quantum computation, the restoration is only decided (and the merged quantum computation verified) by simulating all assignments of the inputs.
+    std::vector<qc::Qubit> inputQubits;
+    for (qc::Qubit qubit = 0; qubit < numQubits; ++qubit) {
+        if (!annotatableQuantumComputation.logicalQubitIsAncillary(qubit)) {
+            inputQubits.emplace_back(qubit);
+        }
+    }
+    if (inputQubits.size() > settings.maxNumInputsOfExhaustiveCheck || inputQubits.size() >= 64U) {
+        return 0U;
+    }
+
+    // An ancillary qubit is only considered to be restored to zero if its value at the end of the quantum computation is zero for all assignments of the inputs.
+    const std::uint64_t        numBlocks = std::max<std::uint64_t>(1U, (static_cast<std::uint64_t>(1) << inputQubits.size()) / BATCH_SIMULATION_LANE_COUNT);
+    std::vector<bool>          isRestoredAncillaryQubit(numQubits, false);
+    std::vector<std::uint64_t> laneValuesPerQubit;
+    for (qc::Qubit qubit = 0; qubit < numQubits; ++qubit) {
+        isRestoredAncillaryQubit[qubit] = annotatableQuantumComputation.logicalQubitIsAncillary(qubit);
+    }
+
+    for (std::uint64_t block = 0; block < numBlocks; ++block) {
+        initializeLaneValuesOfBlock(inputQubits, numQubits, block, laneValuesPerQubit);
+        if (!simulateBlock(quantumOperations, laneValuesPerQubit)) {
+            return 0U;
+        }
+        for (qc::Qubit qubit = 0; qubit < numQubits; ++qubit) {
+            isRestoredAncillaryQubit[qubit] = isRestoredAncillaryQubit[qubit] && laneValuesPerQubit[qubit] == 0U;
+        }
+    }
+
+    // The restored ancillary qubits are assigned in the order of the start of their live range to the qubit whose last live range ended first, if the latter ended before the start of the live range of the assigned qubit.
+    std::vector<qc::Qubit> hostQubitPerQubit(numQubits);
+    std::iota(hostQubitPerQubit.begin(), hostQubitPerQubit.end(), 0U);
+
+    std::vector<qc::Qubit> restoredAncillaryQubits;
+    for (qc::Qubit qubit = 0; qubit < numQubits; ++qubit) {
+        if (isRestoredAncillaryQubit[qubit] && firstPositionPerQubit[qubit] != POSITION_OF_NOT_ACCESSED_QUBIT) {
+            restoredAncillaryQubits.emplace_back(qubit);
+        }
+    }
+    std::ranges::stable_sort(restoredAncillaryQubits, std::less{}, [&](const qc::Qubit qubit) { return firstPositionPerQubit[qubit]; });
+
+    std::priority_queue<std::pair<std::size_t, qc::Qubit>, std::vector<std::pair<std::size_t, qc::Qubit>>, std::greater<>> endOfLastLiveRangePerHostQubit;
+    for (const qc::Qubit qubit: restoredAncillaryQubits) {
+        if (!endOfLastLiveRangePerHostQubit.empty() && endOfLastLiveRangePerHostQubit.top().first < firstPositionPerQubit[qubit]) {
+            const qc::Qubit hostQubit = endOfLastLiveRangePerHostQubit.top().second;
+            endOfLastLiveRangePerHostQubit.pop();
+            hostQubitPerQubit[qubit] = hostQubit;
+            endOfLastLiveRangePerHostQubit.emplace(lastPositionPerQubit[qubit], hostQubit);
+        } else {
+            endOfLastLiveRangePerHostQubit.emplace(lastPositionPerQubit[qubit], qubit);
+        }
+    }
+
+    // Ancillary qubits not accessed by any quantum operation are removed by relocating them onto any remaining ancillary qubit.
+    std::optional<qc::Qubit> hostOfNotAccessedAncillaryQubits;
+    for (qc::Qubit qubit = 0; qubit < numQubits && !hostOfNotAccessedAncillaryQubits.has_value(); ++qubit) {
+        if (annotatableQuantumComputation.logicalQubitIsAncillary(qubit) && hostQubitPerQubit[qubit] == qubit && firstPositionPerQubit[qubit] != POSITION_OF_NOT_ACCESSED_QUBIT) {
+            hostOfNotAccessedAncillaryQubits = qubit;
+        }
+    }
+    for (qc::Qubit qubit = 0; qubit < numQubits; ++qubit) {
+        if (!annotatableQuantumComputation.logicalQubitIsAncillary(qubit) || firstPositionPerQubit[qubit] != POSITION_OF_NOT_ACCESSED_QUBIT) {
+            continue;
+        }
+        if (!hostOfNotAccessedAncillaryQubits.has_value()) {
+            hostOfNotAccessedAncillaryQubits = qubit;
+        } else {
+            hostQubitPerQubit[qubit] = *hostOfNotAccessedAncillaryQubits;
+        }
+    }
+
+    std::vector<qc::Qubit> newIndexPerQubit(numQubits);
+    std::size_t            numRemovedQubits   = 0;
+    qc::Qubit              numRemainingQubits = 0;
+    for (qc::Qubit qubit = 0; qubit < numQubits; ++qubit) {
+        const bool isQubitRemoved = hostQubitPerQubit[qubit] != qubit;
+        newIndexPerQubit[qubit]   = isQubitRemoved ? numRemainingQubits : numRemainingQubits++;
+        numRemovedQubits += isQubitRemoved ? 1U : 0U;
+    }
+    if (numRemovedQubits == 0U) {
+        return 0U;
+    }
+
+    // The merged quantum computation is verified against the original one for all assignments of the inputs prior to modifying the latter.
+    const auto relocateQubit = [&](const qc::Qubit qubit) { return newIndexPerQubit[hostQubitPerQubit[qubit]]; };
+
+    std::vector<std::unique_ptr<qc::Operation>> relocatedQuantumOperations;
+    std::vector<const qc::Operation*>           relocatedQuantumOperationReferences;
+    relocatedQuantumOperations.reserve(quantumOperations.size());
+    relocatedQuantumOperationReferences.reserve(quantumOperations.size());
+    for (const qc::Operation* quantumOperation: quantumOperations) {
+        qc::Controls relocatedControlQubits;
+        for (const qc::Control& controlQubit: quantumOperation->getControls()) {
+            relocatedControlQubits.emplace(qc::Control{relocateQubit(controlQubit.qubit), controlQubit.type});
+        }
+        qc::Targets relocatedTargetQubits;
+        std::ranges::transform(quantumOperation->getTargets(), std::back_inserter(relocatedTargetQubits), relocateQubit);
+        relocatedQuantumOperationReferences.emplace_back(relocatedQuantumOperations.emplace_back(std::make_unique<qc::StandardOperation>(relocatedControlQubits, relocatedTargetQubits, quantumOperation->getType(), quantumOperation->getParameter())).get());
+    }
+
+    std::vector<std::uint64_t> relocatedLaneValuesPerQubit;
+    for (std::uint64_t block = 0; block < numBlocks; ++block) {
+        initializeLaneValuesOfBlock(inputQubits, numQubits, block, laneValuesPerQubit);
+        relocatedLaneValuesPerQubit.assign(numRemainingQubits, 0U);
+        for (qc::Qubit qubit = 0; qubit < numQubits; ++qubit) {
+            if (hostQubitPerQubit[qubit] == qubit) {
+                relocatedLaneValuesPerQubit[newIndexPerQubit[qubit]] = laneValuesPerQubit[qubit];
+            }
+        }
+
+        if (!simulateBlock(quantumOperations, laneValuesPerQubit) || !simulateBlock(relocatedQuantumOperationReferences, relocatedLaneValuesPerQubit)) {
+            return 0U;
+        }
+        for (qc::Qubit qubit = 0; qubit < numQubits; ++qubit) {
+            if (hostQubitPerQubit[qubit] == qubit && relocatedLaneValuesPerQubit[newIndexPerQubit[qubit]] != laneValuesPerQubit[qubit]) {
+                return 0U;
+            }
+        }
+    }
+    return annotatableQuantumComputation.relocateAncillaryQubits(hostQubitPerQubit) ? numRemovedQubits : 0U;
+}
@@ -10,21 +10,304 @@
 
 #include "algorithms/optimization/esop_minimization.hpp"
 
+#include "core/hash_combine.hpp"
 #include "core/truthTable/truth_table.hpp"
 
 #include <algorithm>
+#include <bit>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <iterator>
+#include <map>
 #include <numeric>
+#include <optional>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace minbool {
 
-    void ImplicantTable::fill(const std::vector<MinTerm>& minterms) {
+    namespace {
+        // Position i of a packed cube is stored in bit i % 64 of the (i / 64)-th value word and the (i / 64)-th don't care word of the cube (similarly to syrec::TruthTable::Cube).
+        // While a packed minterm only consists of value words, a packed cube stores its value words followed by its don't care words.
+        using PackedWords = std::vector<std::uint64_t>;
+
+        class HeuristicMinimizer {
+        public:
+            static constexpr std::size_t MAX_NUM_ITERATIONS = 16U;
+
+            explicit HeuristicMinimizer(syrec::TruthTable::Cube::Set const& onSet):
+                nBits(onSet.begin()->size()), numWords(onSet.begin()->numWords()) {
+                // The minterms are stored in a single arena and are looked up via an open addressing hash table (using linear probing) storing the index of a minterm incremented by one.
+                numMinterms = onSet.size();
+                mintermWords.reserve(numMinterms * numWords);
+                slots.resize(std::bit_ceil(2U * numMinterms), 0U);
+                for (const auto& cube: onSet) {
+                    assert(cube.size() == nBits);
+                    assert(cube.hasNoDontCares());
+                    for (std::size_t k = 0U; k < numWords; ++k) {
+                        mintermWords.emplace_back(cube.getValueWord(k));
+                    }
+                    const auto mintermIndex = (mintermWords.size() / numWords) - 1U;
+                    auto       slot         = hashOf(mintermWords.data() + (mintermIndex * numWords)) & (slots.size() - 1U);
+                    while (slots[slot] != 0U) {
+                        slot = (slot + 1U) & (slots.size() - 1U);
+                    }
+                    slots[slot] = mintermIndex + 1U;
+                }
+            }
+
+            [[nodiscard]] std::vector<PackedWords> minimize() const {
+                std::vector<PackedWords> cover;
+                cover.reserve(numMinterms);
+                for (std::size_t i = 0U; i < numMinterms; ++i) {
+                    PackedWords cube(2U * numWords, 0U);
+                    std::copy_n(mintermWords.begin() + static_cast<std::ptrdiff_t>(i * numWords), numWords, cube.begin());
+                    cover.emplace_back(std::move(cube));
+                }
+
+                expand(cover, false);
+                irredundant(cover);
+
+                // Every reduction is followed by an expansion of the reduced cubes towards the other positions, the iteration stops once the cost of the cover did not decrease
+                // or after a fixed number of iterations (since the cost of large covers usually only decreases slightly in the later iterations).
+                auto bestCover                 = cover;
+                bool expandTowardsLastPosition = true;
+                for (std::size_t iteration = 0U; iteration < MAX_NUM_ITERATIONS; ++iteration, expandTowardsLastPosition = !expandTowardsLastPosition) {
+                    reduce(cover);
+                    expand(cover, expandTowardsLastPosition);
+                    irredundant(cover);
+                    if (costOf(cover) >= costOf(bestCover)) {
+                        break;
+                    }
+                    bestCover = cover;
+                }
+                return bestCover;
+            }
+
+            [[nodiscard]] syrec::TruthTable::Cube toCube(const PackedWords& packedCube) const {
+                syrec::TruthTable::Cube cube;
+                cube.reserve(nBits);
+                for (std::size_t i = 0U; i < nBits; ++i) {
+                    cube.emplace_back(isDontCare(packedCube, i) ? syrec::TruthTable::Cube::Value() : syrec::TruthTable::Cube::Value(testBit(packedCube, i)));
+                }
+                return cube;
+            }
+
+        private:
+            std::size_t                nBits;
+            std::size_t                numWords;
+            std::size_t                numMinterms = 0U;
+            std::vector<std::uint64_t> mintermWords;
+            std::vector<std::size_t>   slots;
+
+            [[nodiscard]] std::size_t hashOf(const std::uint64_t* minterm) const {
+                // The words are mixed by the finalizer of splitmix64 before being combined into the hash
+                std::size_t hashValue = 0U;
+                for (std::size_t k = 0U; k < numWords; ++k) {
+                    std::uint64_t word = minterm[k];
+                    word               = (word ^ (word >> 30U)) * 0xbf58476d1ce4e5b9ULL;
+                    word               = (word ^ (word >> 27U)) * 0x94d049bb133111ebULL;
+                    syrec::hashCombine(hashValue, word ^ (word >> 31U));
+                }
+                return hashValue;
+            }
+
+            [[nodiscard]] std::optional<std::size_t> findMinterm(const PackedWords& minterm) const {
+                for (auto slot = hashOf(minterm.data()) & (slots.size() - 1U); slots[slot] != 0U; slot = (slot + 1U) & (slots.size() - 1U)) {
+                    const auto mintermIndex = slots[slot] - 1U;
+                    if (std::equal(minterm.begin(), minterm.begin() + static_cast<std::ptrdiff_t>(numWords), mintermWords.begin() + static_cast<std::ptrdiff_t>(mintermIndex * numWords))) {
+                        return mintermIndex;
+                    }
+                }
+                return std::nullopt;
+            }
+
+            [[nodiscard]] static bool testBit(const PackedWords& words, const std::size_t position) {
+                return ((words[position / 64U] >> (position % 64U)) & 1U) != 0U;
+            }
+
+            static void flipBit(PackedWords& words, const std::size_t position) {
+                words[position / 64U] ^= static_cast<std::uint64_t>(1U) << (position % 64U);
+            }
+
+            [[nodiscard]] bool isDontCare(const PackedWords& packedCube, const std::size_t position) const {
+                return ((packedCube[numWords + (position / 64U)] >> (position % 64U)) & 1U) != 0U;
+            }
+
+            [[nodiscard]] bool containsMinterm(const PackedWords& packedCube, const PackedWords& minterm) const {
+                for (std::size_t k = 0U; k < numWords; ++k) {
+                    if (((packedCube[k] ^ minterm[k]) & ~packedCube[numWords + k]) != 0U) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            [[nodiscard]] std::size_t numDontCares(const PackedWords& packedCube) const {
+                std::size_t numDontCarePositions = 0U;
+                for (std::size_t k = 0U; k < numWords; ++k) {
+                    numDontCarePositions += popcount(packedCube[numWords + k]);
+                }
+                return numDontCarePositions;
+            }
+
+            // The cost of a cover is determined by its number of cubes followed by its number of literals.
+            [[nodiscard]] std::pair<std::size_t, std::size_t> costOf(const std::vector<PackedWords>& cover) const {
+                std::size_t numLiterals = 0U;
+                for (const auto& packedCube: cover) {
+                    numLiterals += nBits - numDontCares(packedCube);
+                }
+                return {cover.size(), numLiterals};
+            }
+
+            // Call the callback for every minterm of the cube (in gray code order) until the callback returns false, returns whether all minterms were visited.
+            template<typename F>
+            bool forEachMinterm(const PackedWords& packedCube, F f) const {
+                std::vector<std::size_t> dontCarePositions;
+                PackedWords              minterm(packedCube.begin(), packedCube.begin() + static_cast<std::ptrdiff_t>(numWords));
+                for (std::size_t i = 0U; i < nBits; ++i) {
+                    if (isDontCare(packedCube, i)) {
+                        dontCarePositions.emplace_back(i);
+                        if (testBit(minterm, i)) {
+                            flipBit(minterm, i);
+                        }
+                    }
+                }
+                // An implicant cannot cover more minterms than there are minterms in the on-set
+                if (dontCarePositions.size() >= 64U) {
+                    return false;
+                }
+
+                const auto numMinterms = static_cast<std::uint64_t>(1U) << dontCarePositions.size();
+                for (std::uint64_t i = 0U; i < numMinterms; ++i) {
+                    if (i != 0U) {
+                        flipBit(minterm, dontCarePositions[static_cast<std::size_t>(std::countr_zero(i))]);
+                    }
+                    if (!f(minterm)) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            [[nodiscard]] std::size_t indexOfMinterm(const PackedWords& minterm) const {
+                const auto mintermIndex = findMinterm(minterm);
+                assert(mintermIndex.has_value());
+                return *mintermIndex;
+            }
+
+            // The literal of a position of an implicant can be removed if the minterms of the implicant with the inverted value at said position are also part of the on-set.
+            [[nodiscard]] bool canRemoveLiteral(const PackedWords& packedCube, const std::size_t position) const {
+                return forEachMinterm(packedCube, [&](PackedWords& minterm) {
+                    flipBit(minterm, position);
+                    const bool isPartOfOnSet = findMinterm(minterm).has_value();
+                    flipBit(minterm, position);
+                    return isPartOfOnSet;
+                });
+            }
+
+            // Expand every cube to a prime implicant by removing its literals in the given order of positions, cubes that are covered by the previously expanded cubes are removed.
+            void expand(std::vector<PackedWords>& cover, const bool expandTowardsLastPosition) const {
+                std::ranges::stable_sort(cover, std::greater{}, [&](const PackedWords& packedCube) { return numDontCares(packedCube); });
+
+                std::vector<bool>        isMintermCovered(numMinterms, false);
+                std::vector<PackedWords> expandedCover;
+                for (auto& packedCube: cover) {
+                    if (forEachMinterm(packedCube, [&](const PackedWords& minterm) { return isMintermCovered[indexOfMinterm(minterm)]; })) {
+                        continue;
+                    }
+                    for (std::size_t j = 0U; j < nBits; ++j) {
+                        const auto position = expandTowardsLastPosition ? nBits - 1U - j : j;
+                        if (!isDontCare(packedCube, position) && canRemoveLiteral(packedCube, position)) {
+                            if (testBit(packedCube, position)) {
+                                flipBit(packedCube, position);
+                            }
+                            flipBit(packedCube, numWords * 64U + position);
+                        }
+                    }
+                    static_cast<void>(forEachMinterm(packedCube, [&](const PackedWords& minterm) {
+                        isMintermCovered[indexOfMinterm(minterm)] = true;
+                        return true;
+                    }));
+                    expandedCover.emplace_back(std::move(packedCube));
+                }
+                cover = std::move(expandedCover);
+            }
+
+            [[nodiscard]] std::vector<std::size_t> determineNumCoveringCubesPerMinterm(const std::vector<PackedWords>& cover) const {
+                std::vector<std::size_t> numCoveringCubesPerMinterm(numMinterms, 0U);
+                for (const auto& packedCube: cover) {
+                    static_cast<void>(forEachMinterm(packedCube, [&](const PackedWords& minterm) {
+                        ++numCoveringCubesPerMinterm[indexOfMinterm(minterm)];
+                        return true;
+                    }));
+                }
+                return numCoveringCubesPerMinterm;
+            }
+
+            // Remove the cubes whose minterms are all covered by other cubes, with smaller cubes being removed first.
+            void irredundant(std::vector<PackedWords>& cover) const {
+                auto numCoveringCubesPerMinterm = determineNumCoveringCubesPerMinterm(cover);
+                std::ranges::stable_sort(cover, std::less{}, [&](const PackedWords& packedCube) { return numDontCares(packedCube); });
+
+                std::vector<PackedWords> irredundantCover;
+                for (auto& packedCube: cover) {
+                    if (forEachMinterm(packedCube, [&](const PackedWords& minterm) { return numCoveringCubesPerMinterm[indexOfMinterm(minterm)] > 1U; })) {
+                        static_cast<void>(forEachMinterm(packedCube, [&](const PackedWords& minterm) {
+                            --numCoveringCubesPerMinterm[indexOfMinterm(minterm)];
+                            return true;
+                        }));
+                        continue;
+                    }
+                    irredundantCover.emplace_back(std::move(packedCube));
+                }
+                cover = std::move(irredundantCover);
+            }
+
+            // Reduce every cube, with larger cubes being reduced first, to the smallest cube containing the minterms that are not covered by any other cube.
+            void reduce(std::vector<PackedWords>& cover) const {
+                auto numCoveringCubesPerMinterm = determineNumCoveringCubesPerMinterm(cover);
+                std::ranges::stable_sort(cover, std::greater{}, [&](const PackedWords& packedCube) { return numDontCares(packedCube); });
+
+                for (auto& packedCube: cover) {
+                    std::optional<PackedWords> reducedCube;
+                    static_cast<void>(forEachMinterm(packedCube, [&](const PackedWords& minterm) {
+                        if (numCoveringCubesPerMinterm[indexOfMinterm(minterm)] != 1U) {
+                            return true;
+                        }
+                        if (!reducedCube.has_value()) {
+                            reducedCube = minterm;
+                            reducedCube->resize(2U * numWords, 0U);
+                            return true;
+                        }
+                        for (std::size_t k = 0U; k < numWords; ++k) {
+                            (*reducedCube)[numWords + k] |= (*reducedCube)[k] ^ minterm[k];
+                            (*reducedCube)[k] &= ~(*reducedCube)[numWords + k];
+                        }
+                        return true;
+                    }));
+                    // Since the irredundant cover does not contain cubes whose minterms are all covered by other cubes, every cube covers at least one minterm on its own
+                    if (!reducedCube.has_value()) {
+                        continue;
+                    }
+                    static_cast<void>(forEachMinterm(packedCube, [&](const PackedWords& minterm) {
+                        if (!containsMinterm(*reducedCube, minterm)) {
+                            --numCoveringCubesPerMinterm[indexOfMinterm(minterm)];
+                        }
+                        return true;
+                    }));
+                    packedCube = std::move(*reducedCube);
+                }
+            }
+        };
+    } // namespace
+
+    template<std::size_t NumWords>
+    void ImplicantTable<NumWords>::fill(const std::vector<BasicMinTerm<NumWords>>& minterms) {
         groups.resize(nBits + 2U, 0U);
         for (const auto& term: minterms) {
             ++groups[popcount(term.value)];
@@ -38,7 +321,8 @@ namespace minbool {
         }
     }
 
-    void ImplicantTable::combine(std::vector<MinTerm>& res) {
+    template<std::size_t NumWords>
+    void ImplicantTable<NumWords>::combine(std::vector<BasicMinTerm<NumWords>>& res) {
         for (std::size_t i = 0; i < nBits; ++i) {
             for (std::size_t j = groups[i]; j < groups[i + 1]; ++j) {
                 for (std::size_t k = groups[i + 1]; k < groups[i + 2]; ++k) {
@@ -54,9 +338,10 @@ namespace minbool {
         }
     }
 
-    void PrimeChart::fill(const std::vector<MinTerm>& primes) {
+    template<std::size_t NumWords>
+    void PrimeChart<NumWords>::fill(const std::vector<BasicMinTerm<NumWords>>& primes) {
         for (const auto& prime: primes) {
-            prime.foreachValue([this, &prime](const std::uint64_t value) {
+            prime.foreachValue([this, &prime](const MinTermWord<NumWords>& value) {
                 columns[value].emplace_back(prime);
             },
                                nBits);
@@ -66,7 +351,8 @@ namespace minbool {
         }
     }
 
-    bool PrimeChart::removeEssentials(std::vector<MinTerm>& essentials) {
+    template<std::size_t NumWords>
+    bool PrimeChart<NumWords>::removeEssentials(std::vector<BasicMinTerm<NumWords>>& essentials) {
         std::size_t const count = essentials.size();
         for (const auto& [first, second]: columns) {
             if (second.size() == 1U) {
@@ -80,8 +366,8 @@ namespace minbool {
         std::sort(essentials.begin() + static_cast<int>(count), essentials.end());
         essentials.erase(std::unique(essentials.begin() + static_cast<int>(count), essentials.end()), essentials.end());
 
-        std::for_each(essentials.begin() + static_cast<int>(count), essentials.end(), [&](const MinTerm& term) {
-            term.foreachValue([this](const std::uint64_t value) {
+        std::for_each(essentials.begin() + static_cast<int>(count), essentials.end(), [&](const BasicMinTerm<NumWords>& term) {
+            term.foreachValue([this](const MinTermWord<NumWords>& value) {
                 columns.erase(value);
             },
                               nBits);
@@ -89,17 +375,18 @@ namespace minbool {
         return true;
     }
 
-    void PrimeChart::removeHeuristic(std::vector<MinTerm>& solution) {
+    template<std::size_t NumWords>
+    void PrimeChart<NumWords>::removeHeuristic(std::vector<BasicMinTerm<NumWords>>& solution) {
         assert(size() > 0);
-        std::unordered_map<MinTerm, std::size_t> covers;
+        std::unordered_map<BasicMinTerm<NumWords>, std::size_t> covers;
         for (auto const& [first, second]: columns) {
             for (const auto& term: second) {
                 ++covers[term];
             }
         }
         // Heuristic: Remove the term that covers the most columns
-        std::size_t maxCovers = 0U;
-        MinTerm     term;
+        std::size_t            maxCovers = 0U;
+        BasicMinTerm<NumWords> term;
         for (auto const& [first, second]: covers) {
             if (second > maxCovers) {
                 maxCovers = second;
@@ -107,13 +394,14 @@ namespace minbool {
             }
         }
         solution.emplace_back(term);
-        term.foreachValue([this](const std::uint64_t value) {
+        term.foreachValue([this](const MinTermWord<NumWords>& value) {
             columns.erase(value);
         },
                           nBits);
     }
 
-    bool PrimeChart::simplify() {
+    template<std::size_t NumWords>
+    bool PrimeChart<NumWords>::simplify() {
         bool change = false;
 
         for (auto& [pair1First, pair1Second]: columns) {
@@ -132,7 +420,7 @@ namespace minbool {
             }
         }
         // Transpose columns → rows
-        std::unordered_map<MinTerm, std::vector<std::uint64_t>> rows;
+        std::unordered_map<BasicMinTerm<NumWords>, std::vector<MinTermWord<NumWords>>> rows;
         for (auto& [first, second]: columns) {
             for (auto const& term: second) {
                 rows[term].emplace_back(first);
@@ -170,11 +458,12 @@ namespace minbool {
         return change;
     }
 
-    std::vector<MinTerm> primeImplicants(std::vector<MinTerm>& terms, const std::size_t& n) {
-        std::vector<MinTerm> primes;
+    template<std::size_t NumWords>
+    std::vector<BasicMinTerm<NumWords>> primeImplicants(std::vector<BasicMinTerm<NumWords>>& terms, const std::size_t& n) {
+        std::vector<BasicMinTerm<NumWords>> primes;
 
         while (!terms.empty()) {
-            ImplicantTable table(n);
+            ImplicantTable<NumWords> table(n);
             table.fill(terms);
             terms.clear();
             table.combine(terms);
@@ -186,14 +475,16 @@ namespace minbool {
         return primes;
     }
 
-    bool evalBoolean(const std::vector<MinTerm>& solution, const std::uint64_t v, const std::size_t& n) {
+    template<std::size_t NumWords>
+    bool evalBoolean(const std::vector<BasicMinTerm<NumWords>>& solution, const MinTermWord<NumWords>& v, const std::size_t& n) {
+        using Value = typename BasicMinTerm<NumWords>::Value;
         for (const auto& term: solution) {
             bool prod = true;
             for (std::size_t i = 0U; i < n; ++i) {
-                bool const bit = ((v >> i) & 1) != 0;
-                if (term[i] == MinTerm::Value{true}) {
+                bool const bit = testBit(v, i);
+                if (term[i] == Value{true}) {
                     prod = prod && bit;
-                } else if (term[i] == MinTerm::Value{false}) {
+                } else if (term[i] == Value{false}) {
                     prod = prod && !bit;
                 }
             }
@@ -204,68 +495,323 @@ namespace minbool {
         return false;
     }
 
-    bool checkSolution(const std::vector<MinTerm>&              solution,
-                       const std::unordered_set<std::uint64_t>& onValues, const std::size_t& n) {
+    template<std::size_t NumWords>
+    bool checkSolution(const std::vector<BasicMinTerm<NumWords>>& solution, const std::unordered_set<MinTermWord<NumWords>>& onValues, const std::size_t& n) {
         for (const auto& v: onValues) {
             if (!evalBoolean(solution, v, n)) {
                 return false;
             }
         }
-        for (std::uint64_t i = (1 << n) - 1; i > 0U; --i) {
-            if (!onValues.contains(i) && evalBoolean(solution, i, n)) {
-                return false;
-            }
+        // the values covered by the terms of the solution are enumerated instead of all assignments since the number of the latter grows exponentially in the number of positions
+        bool onlyCoversOnValues = true;
+        for (const auto& term: solution) {
+            term.foreachValue([&](const MinTermWord<NumWords>& value) {
+                onlyCoversOnValues = onlyCoversOnValues && onValues.contains(value);
+            },
+                              n);
         }
-        return onValues.contains(0) || !evalBoolean(solution, 0U, n);
+        return onlyCoversOnValues;
     }
 
+    namespace {
+        // The first position of the cube is stored in the most significant bit of the minterm (as done by syrec::TruthTable::Cube::toInteger()).
+        template<std::size_t NumWords>
+        MinTermWord<NumWords> toMinTermWord(const syrec::TruthTable::Cube& cube) {
+            if constexpr (NumWords == 1U) {
+                return cube.toInteger();
+            } else {
+                MinTermWord<NumWords> word{};
+                const auto            n = cube.size();
+                for (std::size_t i = 0U; i < n; ++i) {
+                    assert(cube[i].has_value());
+                    if (*cube[i]) {
+                        word = withBit(word, n - 1U - i);
+                    }
+                }
+                return word;
+            }
+        }
+
+        template<std::size_t NumWords>
+        syrec::TruthTable::Cube::Set minimizeBooleanExactly(syrec::TruthTable::Cube::Set const& sigVec) {
+            std::unordered_set<MinTermWord<NumWords>> onValues;
+            onValues.reserve(sigVec.size());
+
+            for (const auto& onSig: sigVec) {
+                onValues.emplace(toMinTermWord<NumWords>(onSig));
+            }
+
+            std::vector<BasicMinTerm<NumWords>> init;
+            init.reserve(sigVec.size());
+
+            for (const auto& on: onValues) {
+                init.emplace_back(on);
+            }
+
+            const auto n      = sigVec.begin()->size();
+            const auto primes = primeImplicants(init, n);
+
+            PrimeChart<NumWords> chart(n);
+            chart.fill(primes);
+
+            std::vector<BasicMinTerm<NumWords>> solution;
+            while (chart.size() > 0) {
+                bool change = chart.removeEssentials(solution);
+                change      = change || chart.simplify();
+                if (!change && chart.size() > 0) {
+                    chart.removeHeuristic(solution);
+                }
+            }
+
+            assert(checkSolution(solution, onValues, n));
+
+            syrec::TruthTable::Cube::Set finalSigVec;
+
+            for (auto const& ctrlCube: solution) {
+                syrec::TruthTable::Cube c;
+                c.reserve(n);
+                for (int j = static_cast<int>(n) - 1; j >= 0; --j) {
+                    c.emplace_back(ctrlCube[static_cast<std::size_t>(j)]);
+                }
+                finalSigVec.emplace(c);
+            }
+
+            return finalSigVec;
+        }
+    } // namespace
+
     syrec::TruthTable::Cube::Set minimizeBoolean(syrec::TruthTable::Cube::Set const& sigVec) {
         if (sigVec.size() <= 1U) {
             return sigVec;
         }
+        // the on-sets of cubes with at most 64 positions, which are the most common ones, use the minterms stored in a single 64-bit integer
+        if (const auto n = sigVec.begin()->size(); sigVec.size() <= MAX_NUM_CUBES_OF_EXACTLY_MINIMIZED_ON_SET) {
+            if (n <= 64U) {
+                return minimizeBooleanExactly<1U>(sigVec);
+            }
+            if (n <= 64U * MAX_NUM_WORDS_OF_EXACTLY_MINIMIZED_ON_SET) {
+                return minimizeBooleanExactly<MAX_NUM_WORDS_OF_EXACTLY_MINIMIZED_ON_SET>(sigVec);
+            }
+        }
+        return minimizeBooleanHeuristically(sigVec);
+    }
 
-        std::unordered_set<std::uint64_t> onValues;
-        onValues.reserve(sigVec.size());
+    syrec::TruthTable::Cube::Set minimizeBooleanHeuristically(syrec::TruthTable::Cube::Set const& sigVec) {
+        if (sigVec.size() <= 1U) {
+            return sigVec;
+        }
 
-        for (const auto& onSig: sigVec) {
-            onValues.emplace(onSig.toInteger());
+        const HeuristicMinimizer     minimizer(sigVec);
+        syrec::TruthTable::Cube::Set finalSigVec;
+        for (const auto& packedCube: minimizer.minimize()) {
+            finalSigVec.emplace(minimizer.toCube(packedCube));
         }
+        return finalSigVec;
+    }
 
-        std::vector<MinTerm> init;
-        init.reserve(sigVec.size());
+    syrec::TruthTable::Cube::Set MinimizedExpressionCache::minimize(syrec::TruthTable::Cube::Set const& sigVec) {
+        std::size_t hashValue = std::hash<std::size_t>()(sigVec.size());
+        for (const auto& cube: sigVec) {
+            syrec::hashCombine(hashValue, cube.size());
+            for (std::size_t k = 0U; k < cube.numWords(); ++k) {
+                syrec::hashCombine(hashValue, cube.getValueWord(k));
+                syrec::hashCombine(hashValue, cube.getDontCareWord(k));
+            }
+        }
 
-        for (const auto& on: onValues) {
-            init.emplace_back(on);
+        auto& minimizedExpressionsOfOnSetsWithHash = minimizedExpressionsPerOnSetHash[hashValue];
+        if (const auto it = std::ranges::find_if(minimizedExpressionsOfOnSetsWithHash, [&sigVec](const auto& onSetAndMinimizedExpression) { return onSetAndMinimizedExpression.first == sigVec; }); it != minimizedExpressionsOfOnSetsWithHash.end()) {
+            return it->second;
         }
+        auto minimizedExpression = minimizeBoolean(sigVec);
+        minimizedExpressionsOfOnSetsWithHash.emplace_back(sigVec, minimizedExpression);
+        return minimizedExpression;
+    }
+
+    void subtractCube(const syrec::TruthTable::Cube& minuend, const syrec::TruthTable::Cube& subtrahend, syrec::TruthTable::Cube::Vector& difference) {
+        if (!syrec::TruthTable::Cube::checkCubeEquality(minuend, subtrahend)) {
+            difference.emplace_back(minuend);
+            return;
+        }
+        // The remainder is restricted to the subtrahend one position at a time, with the minterms excluded by every restriction forming a cube.
+        auto remainder = minuend;
+        for (std::size_t pos = 0U; pos < subtrahend.size(); ++pos) {
+            if (subtrahend[pos].has_value() && !remainder[pos].has_value()) {
+                auto excludedCube = remainder;
+                excludedCube[pos] = !*subtrahend[pos];
+                difference.emplace_back(std::move(excludedCube));
+                remainder[pos] = *subtrahend[pos];
+            }
+        }
+    }
+
+    syrec::TruthTable::Cube::Vector makeDisjoint(syrec::TruthTable::Cube::Vector cubes) {
+        const auto numDontCares = [](const syrec::TruthTable::Cube& cube) {
+            std::size_t count = 0U;
+            for (std::size_t k = 0U; k < cube.numWords(); ++k) {
+                count += static_cast<std::size_t>(std::popcount(cube.getDontCareWord(k)));
+            }
+            return count;
+        };
+        std::ranges::stable_sort(cubes, [&numDontCares](const syrec::TruthTable::Cube& lhs, const syrec::TruthTable::Cube& rhs) { return numDontCares(lhs) > numDontCares(rhs); });
+
+        syrec::TruthTable::Cube::Vector disjointCubes;
+        syrec::TruthTable::Cube::Vector uncoveredParts;
+        syrec::TruthTable::Cube::Vector remainingUncoveredParts;
+        for (auto& cube: cubes) {
+            uncoveredParts.assign(1U, std::move(cube));
+            for (std::size_t i = 0U; i < disjointCubes.size() && !uncoveredParts.empty(); ++i) {
+                remainingUncoveredParts.clear();
+                for (const auto& uncoveredPart: uncoveredParts) {
+                    subtractCube(uncoveredPart, disjointCubes[i], remainingUncoveredParts);
+                }
+                std::swap(uncoveredParts, remainingUncoveredParts);
+            }
+            std::ranges::move(uncoveredParts, std::back_inserter(disjointCubes));
+        }
+        return disjointCubes;
+    }
 
-        const auto n      = sigVec.begin()->size();
-        const auto primes = primeImplicants(init, n);
+    std::vector<EsopTerm> minimizeMultiOutputEsop(syrec::TruthTable const& tt) {
+        using Cube = syrec::TruthTable::Cube;
 
-        PrimeChart chart(n);
-        chart.fill(primes);
+        const auto nInputs  = tt.nInputs();
+        const auto nOutputs = tt.nOutputs();
 
-        std::vector<MinTerm> solution;
-        while (chart.size() > 0) {
-            bool change = chart.removeEssentials(solution);
-            change      = change || chart.simplify();
-            if (!change && chart.size() > 0) {
-                chart.removeHeuristic(solution);
+        // The outputs of a term are XOR-ed into the outputs of the term with the same cube, with terms without any output being removed.
+        std::map<Cube, std::vector<bool>> outputsPerCube;
+        const auto                        addTerm = [&outputsPerCube](const Cube& cube, const std::vector<bool>& outputs) {
+            if (std::ranges::find(outputs, true) == outputs.end()) {
+                return;
+            }
+            auto [it, inserted] = outputsPerCube.try_emplace(cube, outputs);
+            if (inserted) {
+                return;
+            }
+            for (std::size_t j = 0U; j < outputs.size(); ++j) {
+                it->second[j] = it->second[j] != outputs[j];
             }
+            if (std::ranges::find(it->second, true) == it->second.end()) {
+                outputsPerCube.erase(it);
+            }
+        };
+
+        // The inputs covered by several entries are assigned the outputs determined by syrec::extend(...), i.e. the first entry (in the order of the truth table) with don't cares in its input takes precedence
+        // while the outputs being 1 of a fully specified input are additionally set in the outputs of the entry with don't cares covering it (unless the latter are don't cares). Since the entries covering
+        // a fully specified input precede it in the order of the truth table, the entries with don't cares are split into disjoint cubes while the fully specified ones only toggle the outputs to be set.
+        std::vector<std::pair<Cube, Cube>> incompleteEntries;
+        Cube::Vector                       uncoveredParts;
+        Cube::Vector                       remainingUncoveredParts;
+        std::vector<bool>                  outputs(nOutputs);
+        for (const auto& [input, output]: tt) {
+            if (input.hasNoDontCares()) {
+                const auto coveringEntryIt = std::ranges::find_if(incompleteEntries, [&input](const auto& entry) { return syrec::TruthTable::Cube::checkCubeEquality(entry.first, input); });
+                for (std::size_t j = 0U; j < nOutputs; ++j) {
+                    outputs[j] = output[j] == Cube::Value{true} && (coveringEntryIt == incompleteEntries.end() || coveringEntryIt->second[j] == Cube::Value{false});
+                }
+                addTerm(input, outputs);
+                continue;
+            }
+
+            uncoveredParts.assign(1U, input);
+            for (std::size_t i = 0U; i < incompleteEntries.size() && !uncoveredParts.empty(); ++i) {
+                remainingUncoveredParts.clear();
+                for (const auto& uncoveredPart: uncoveredParts) {
+                    subtractCube(uncoveredPart, incompleteEntries[i].first, remainingUncoveredParts);
+                }
+                std::swap(uncoveredParts, remainingUncoveredParts);
+            }
+            for (std::size_t j = 0U; j < nOutputs; ++j) {
+                outputs[j] = output[j] == Cube::Value{true};
+            }
+            for (const auto& uncoveredPart: uncoveredParts) {
+                addTerm(uncoveredPart, outputs);
+            }
+            incompleteEntries.emplace_back(input, output);
         }
 
-        assert(checkSolution(solution, onValues, n));
+        // Every cube is checked for a term whose cube differs in exactly one position and which shares some of its outputs. The shared outputs are moved to the term of the merged cube, which reduces the
+        // number of multi-controlled X gates of the ESOP (i.e. the sum of the numbers of outputs of all terms) by the number of shared outputs and thus terminates. The modified terms are checked again.
+        std::vector<Cube> uncheckedCubes;
+        uncheckedCubes.reserve(outputsPerCube.size());
+        for (const auto& [cube, _]: outputsPerCube) {
+            uncheckedCubes.emplace_back(cube);
+        }
+        std::vector<bool> sharedOutputs(nOutputs);
+        std::vector<bool> remainingOutputs(nOutputs);
+        std::vector<bool> remainingOutputsOfNeighbour(nOutputs);
+        while (!uncheckedCubes.empty()) {
+            const auto cube = std::move(uncheckedCubes.back());
+            uncheckedCubes.pop_back();
+            const auto termIt = outputsPerCube.find(cube);
+            if (termIt == outputsPerCube.end()) {
+                continue;
+            }
 
-        syrec::TruthTable::Cube::Set finalSigVec;
+            bool merged = false;
+            for (std::size_t pos = 0U; pos < nInputs && !merged; ++pos) {
+                const auto value = cube[pos];
+                for (const auto& neighbourValue: {Cube::Value{}, Cube::Value{false}, Cube::Value{true}}) {
+                    if (neighbourValue == value) {
+                        continue;
+                    }
+                    auto neighbour = cube;
+                    neighbour[pos] = neighbourValue;
+                    const auto neighbourIt = outputsPerCube.find(neighbour);
+                    if (neighbourIt == outputsPerCube.end()) {
+                        continue;
+                    }
+                    bool anyOutputShared = false;
+                    for (std::size_t j = 0U; j < nOutputs; ++j) {
+                        sharedOutputs[j]               = termIt->second[j] && neighbourIt->second[j];
+                        remainingOutputs[j]            = termIt->second[j] && !sharedOutputs[j];
+                        remainingOutputsOfNeighbour[j] = neighbourIt->second[j] && !sharedOutputs[j];
+                        anyOutputShared                = anyOutputShared || sharedOutputs[j];
+                    }
+                    if (!anyOutputShared) {
+                        continue;
+                    }
 
-        for (auto const& ctrlCube: solution) {
-            syrec::TruthTable::Cube c;
-            for (int j = static_cast<int>(n) - 1; j >= 0; --j) {
-                c.emplace_back(ctrlCube[static_cast<std::size_t>(j)]);
+                    auto mergedCube = cube;
+                    if (!value.has_value()) {
+                        mergedCube[pos] = !*neighbourValue;
+                    } else if (!neighbourValue.has_value()) {
+                        mergedCube[pos] = !*value;
+                    } else {
+                        mergedCube[pos] = Cube::Value{};
+                    }
+                    outputsPerCube.erase(termIt);
+                    outputsPerCube.erase(neighbourIt);
+                    addTerm(cube, remainingOutputs);
+                    addTerm(neighbour, remainingOutputsOfNeighbour);
+                    addTerm(mergedCube, sharedOutputs);
+                    uncheckedCubes.emplace_back(cube);
+                    uncheckedCubes.emplace_back(std::move(neighbour));
+                    uncheckedCubes.emplace_back(std::move(mergedCube));
+                    merged = true;
+                    break;
+                }
             }
-            finalSigVec.emplace(c);
         }
 
-        return finalSigVec;
+        std::vector<EsopTerm> terms;
+        terms.reserve(outputsPerCube.size());
+        for (auto& [cube, outputs]: outputsPerCube) {
+            terms.emplace_back(EsopTerm{cube, std::move(outputs)});
+        }
+        return terms;
     }
 
+    // explicitly instantiate the templates for the supported numbers of words of a minterm.
+    template struct ImplicantTable<1U>;
+    template struct ImplicantTable<2U>;
+    template struct PrimeChart<1U>;
+    template struct PrimeChart<2U>;
+    template std::vector<BasicMinTerm<1U>> primeImplicants(std::vector<BasicMinTerm<1U>>& terms, const std::size_t& n);
+    template std::vector<BasicMinTerm<2U>> primeImplicants(std::vector<BasicMinTerm<2U>>& terms, const std::size_t& n);
+    template bool                          evalBoolean(const std::vector<BasicMinTerm<1U>>& solution, const MinTermWord<1U>& v, const std::size_t& n);
+    template bool                          evalBoolean(const std::vector<BasicMinTerm<2U>>& solution, const MinTermWord<2U>& v, const std::size_t& n);
+    template bool                          checkSolution(const std::vector<BasicMinTerm<1U>>& solution, const std::unordered_set<MinTermWord<1U>>& onValues, const std::size_t& n);
+    template bool                          checkSolution(const std::vector<BasicMinTerm<2U>>& solution, const std::unordered_set<MinTermWord<2U>>& onValues, const std::size_t& n);
+
 } // namespace minbool
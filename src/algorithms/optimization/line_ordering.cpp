@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/optimization/line_ordering.hpp"
+
+#include "core/annotatable_quantum_computation.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/operations/Control.hpp"
+#include "ir/operations/Operation.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    using CostMetricValue = AnnotatableQuantumComputation::SynthesisCostMetricValue;
+
+    constexpr std::size_t NUM_MOVES_DETERMINING_INITIAL_TEMPERATURE = 100U;
+    constexpr double      RATIO_OF_FINAL_TO_INITIAL_TEMPERATURE     = 1e-3;
+
+    /*
+     * The qubits accessed by the gates of the quantum computation, with gates operating on the same set of qubits being merged into a single interaction weighted by their number.
+     */
+    class InteractionsOfQubits {
+    public:
+        explicit InteractionsOfQubits(const std::size_t numQubits):
+            positionPerQubit(numQubits), interactionsPerQubit(numQubits) {
+            std::iota(positionPerQubit.begin(), positionPerQubit.end(), 0U);
+        }
+
+        void addInteractions(const std::map<std::vector<qc::Qubit>, CostMetricValue>& numGatesPerSetOfQubits) {
+            for (const auto& [qubits, numGates]: numGatesPerSetOfQubits) {
+                for (const qc::Qubit qubit: qubits) {
+                    interactionsPerQubit[qubit].emplace_back(qubitsPerInteraction.size());
+                }
+                qubitsPerInteraction.emplace_back(qubits);
+                weightPerInteraction.emplace_back(numGates);
+            }
+        }
+
+        [[nodiscard]] CostMetricValue determineCost() {
+            CostMetricValue cost = 0;
+            for (std::size_t interaction = 0; interaction < qubitsPerInteraction.size(); ++interaction) {
+                cost += determineCostOfInteraction(interaction);
+            }
+            return cost;
+        }
+
+        // Interactions containing both qubits are evaluated twice, which does not affect the difference of the costs prior to and after the exchange of the positions of the two qubits.
+        [[nodiscard]] CostMetricValue determineCostOfInteractionsOfQubits(const qc::Qubit lQubit, const qc::Qubit rQubit) {
+            CostMetricValue cost = 0;
+            for (const qc::Qubit qubit: {lQubit, rQubit}) {
+                for (const std::size_t interaction: interactionsPerQubit[qubit]) {
+                    cost += determineCostOfInteraction(interaction);
+                }
+            }
+            return cost;
+        }
+
+        void exchangePositions(const qc::Qubit lQubit, const qc::Qubit rQubit) {
+            std::swap(positionPerQubit[lQubit], positionPerQubit[rQubit]);
+        }
+
+        [[nodiscard]] const std::vector<qc::Qubit>& getPositionPerQubit() const noexcept {
+            return positionPerQubit;
+        }
+
+    private:
+        std::vector<qc::Qubit>                positionPerQubit;
+        std::vector<std::vector<std::size_t>> interactionsPerQubit;
+        std::vector<std::vector<qc::Qubit>>   qubitsPerInteraction;
+        std::vector<CostMetricValue>          weightPerInteraction;
+        std::vector<qc::Qubit>                sortedPositionsOfQubits;
+
+        [[nodiscard]] CostMetricValue determineCostOfInteraction(const std::size_t interaction) {
+            sortedPositionsOfQubits.clear();
+            std::ranges::transform(qubitsPerInteraction[interaction], std::back_inserter(sortedPositionsOfQubits), [&](const qc::Qubit qubit) { return positionPerQubit[qubit]; });
+            std::ranges::sort(sortedPositionsOfQubits);
+            return weightPerInteraction[interaction] * AnnotatableQuantumComputation::getNearestNeighborCostOfGate(sortedPositionsOfQubits);
+        }
+    };
+} // namespace
+
+AnnotatableQuantumComputation::SynthesisCostMetricValue syrec::reorderQubitsToReduceNearestNeighborCost(AnnotatableQuantumComputation& annotatableQuantumComputation, const LineOrderingSettings& settings) {
+    const std::size_t numQubits = annotatableQuantumComputation.getNqubits();
+    if (annotatableQuantumComputation.getNumForwardedQuantumOperations() != 0U || numQubits < 2U) {
+        return 0U;
+    }
+
+    std::map<std::vector<qc::Qubit>, CostMetricValue> numGatesPerSetOfQubits;
+    std::vector<qc::Qubit>                            qubitsOfGate;
+    for (std::size_t position = 0; position < annotatableQuantumComputation.getNops(); ++position) {
+        const qc::Operation* quantumOperation = annotatableQuantumComputation.at(position).get();
+        if (quantumOperation == nullptr || !quantumOperation->isStandardOperation()) {
+            return 0U;
+        }
+
+        qubitsOfGate.assign(quantumOperation->getTargets().cbegin(), quantumOperation->getTargets().cend());
+        std::ranges::transform(quantumOperation->getControls(), std::back_inserter(qubitsOfGate), [](const qc::Control& controlQubit) { return controlQubit.qubit; });
+        std::ranges::sort(qubitsOfGate);
+        qubitsOfGate.erase(std::ranges::unique(qubitsOfGate).begin(), qubitsOfGate.end());
+        if (!qubitsOfGate.empty() && qubitsOfGate.back() >= numQubits) {
+            return 0U;
+        }
+        // Gates operating on a single qubit never require SWAP gates.
+        if (qubitsOfGate.size() > 1U) {
+            ++numGatesPerSetOfQubits[qubitsOfGate];
+        }
+    }
+
+    InteractionsOfQubits interactionsOfQubits(numQubits);
+    interactionsOfQubits.addInteractions(numGatesPerSetOfQubits);
+    const CostMetricValue initialCost = interactionsOfQubits.determineCost();
+    if (initialCost == 0U) {
+        return 0U;
+    }
+
+    std::mt19937_64                          generator(settings.seed);
+    std::uniform_int_distribution<qc::Qubit> qubitDistribution(0U, static_cast<qc::Qubit>(numQubits - 1U));
+    std::uniform_real_distribution<double>   acceptanceDistribution(0.0, 1.0);
+    const auto                               selectMove = [&] {
+        const qc::Qubit lQubit = qubitDistribution(generator);
+        qc::Qubit       rQubit = qubitDistribution(generator);
+        while (rQubit == lQubit) {
+            rQubit = qubitDistribution(generator);
+        }
+        return std::make_pair(lQubit, rQubit);
+    };
+
+    // The initial temperature accepts the average cost increase of a random move with a probability of 1/e.
+    double      sumOfCostIncreases = 0.0;
+    std::size_t numCostIncreases   = 0;
+    for (std::size_t i = 0; i < NUM_MOVES_DETERMINING_INITIAL_TEMPERATURE; ++i) {
+        const auto [lQubit, rQubit]           = selectMove();
+        const CostMetricValue costPriorToMove = interactionsOfQubits.determineCostOfInteractionsOfQubits(lQubit, rQubit);
+        interactionsOfQubits.exchangePositions(lQubit, rQubit);
+        const CostMetricValue costAfterMove = interactionsOfQubits.determineCostOfInteractionsOfQubits(lQubit, rQubit);
+        interactionsOfQubits.exchangePositions(lQubit, rQubit);
+        if (costAfterMove > costPriorToMove) {
+            sumOfCostIncreases += static_cast<double>(costAfterMove - costPriorToMove);
+            ++numCostIncreases;
+        }
+    }
+    const double initialTemperature = numCostIncreases != 0U ? sumOfCostIncreases / static_cast<double>(numCostIncreases) : 1.0;
+
+    const std::size_t      numMoves     = settings.numMovesPerQubit * numQubits;
+    const double           coolingRatio = numMoves != 0U ? std::pow(RATIO_OF_FINAL_TO_INITIAL_TEMPERATURE, 1.0 / static_cast<double>(numMoves)) : 1.0;
+    double                 temperature  = initialTemperature;
+    CostMetricValue        currentCost  = initialCost;
+    CostMetricValue        lowestCost   = initialCost;
+    std::vector<qc::Qubit> positionPerQubitOfLowestCost;
+    for (std::size_t move = 0; move < numMoves; ++move, temperature *= coolingRatio) {
+        const auto [lQubit, rQubit]           = selectMove();
+        const CostMetricValue costPriorToMove = interactionsOfQubits.determineCostOfInteractionsOfQubits(lQubit, rQubit);
+        interactionsOfQubits.exchangePositions(lQubit, rQubit);
+        const CostMetricValue costAfterMove = interactionsOfQubits.determineCostOfInteractionsOfQubits(lQubit, rQubit);
+
+        if (costAfterMove > costPriorToMove && acceptanceDistribution(generator) >= std::exp(-static_cast<double>(costAfterMove - costPriorToMove) / temperature)) {
+            interactionsOfQubits.exchangePositions(lQubit, rQubit);
+            continue;
+        }
+
+        currentCost = currentCost + costAfterMove - costPriorToMove;
+        if (currentCost < lowestCost) {
+            lowestCost                   = currentCost;
+            positionPerQubitOfLowestCost = interactionsOfQubits.getPositionPerQubit();
+        }
+    }
+
+    if (lowestCost >= initialCost || !annotatableQuantumComputation.permuteQubits(positionPerQubitOfLowestCost)) {
+        return 0U;
+    }
+    return initialCost - lowestCost;
+}
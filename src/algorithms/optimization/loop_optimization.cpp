@@ -0,0 +1,574 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/optimization/loop_optimization.hpp"
+
+#include "algorithms/optimization/value_range_analysis.hpp"
+#include "algorithms/optimization/variable_usage_analysis.hpp"
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "algorithms/synthesis/resource_estimation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/syrec/expression.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/number.hpp"
+#include "core/syrec/parser/utils/syrec_operation_utils.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    /**
+     * @brief Determine the number of iterations of a loop with compile time constant start value, end value and step size.
+     * @return The start value, the end value and the step size of the loop, with omitted start values and step sizes defaulting to one, std::nullopt if any of them is not a compile time constant or the step size is zero.
+     */
+    [[nodiscard]] std::optional<std::array<unsigned, 3>> tryDetermineIterationsOfLoop(const ForStatement& loop) {
+        const std::optional<unsigned> startValue = loop.range.first != nullptr ? loop.range.first->tryEvaluate({}) : 1U;
+        const std::optional<unsigned> endValue   = loop.range.second != nullptr ? loop.range.second->tryEvaluate({}) : std::nullopt;
+        const std::optional<unsigned> stepSize   = loop.step != nullptr ? loop.step->tryEvaluate({}) : 1U;
+        if (!startValue.has_value() || !endValue.has_value() || !stepSize.has_value() || *stepSize == 0U) {
+            return std::nullopt;
+        }
+        return std::array<unsigned, 3>({*startValue, *endValue, *stepSize});
+    }
+
+    [[nodiscard]] std::size_t determineNumberOfIterationsOfLoop(const std::array<unsigned, 3>& iterationsOfLoop) {
+        const auto [startValue, endValue, stepSize] = iterationsOfLoop;
+        const unsigned distance                     = startValue < endValue ? endValue - startValue : startValue - endValue;
+        return (static_cast<std::size_t>(distance) + stepSize - 1U) / stepSize;
+    }
+
+    /**
+     * Replace every usage of a loop variable with another loop variable.
+     */
+    class LoopVariableRenamer {
+    public:
+        LoopVariableRenamer(std::string renamedLoopVariable, std::string newLoopVariable):
+            renamedLoopVariable(std::move(renamedLoopVariable)), newLoopVariable(std::move(newLoopVariable)) {}
+
+        [[nodiscard]] Statement::vec renameStatements(const Statement::vec& statements) const {
+            Statement::vec renamedStatements;
+            renamedStatements.reserve(statements.size());
+            for (const Statement::ptr& statement: statements) {
+                renamedStatements.emplace_back(renameStatement(statement));
+            }
+            return renamedStatements;
+        }
+
+    private:
+        std::string renamedLoopVariable;
+        std::string newLoopVariable;
+
+        [[nodiscard]] Number::ptr renameNumber(const Number::ptr& number) const {
+            if (number == nullptr) {
+                return number;
+            }
+            if (number->isLoopVariable()) {
+                return number->variableName() == renamedLoopVariable ? std::make_shared<Number>(newLoopVariable) : number;
+            }
+            if (number->isConstantExpression()) {
+                const Number::ConstantExpression constantExpression = *number->constantExpression();
+                const Number::ptr                renamedLhsOperand  = renameNumber(constantExpression.lhsOperand);
+                const Number::ptr                renamedRhsOperand  = renameNumber(constantExpression.rhsOperand);
+                if (renamedLhsOperand != constantExpression.lhsOperand || renamedRhsOperand != constantExpression.rhsOperand) {
+                    return std::make_shared<Number>(Number::ConstantExpression(renamedLhsOperand, constantExpression.operation, renamedRhsOperand));
+                }
+            }
+            return number;
+        }
+
+        [[nodiscard]] VariableAccess::ptr renameVariableAccess(const VariableAccess::ptr& variableAccess) const {
+            if (variableAccess == nullptr) {
+                return variableAccess;
+            }
+
+            bool                                               wasRenamed = false;
+            std::optional<std::pair<Number::ptr, Number::ptr>> renamedBitRange;
+            if (variableAccess->range.has_value()) {
+                renamedBitRange = std::make_pair(renameNumber(variableAccess->range->first), renameNumber(variableAccess->range->second));
+                wasRenamed      = renamedBitRange->first != variableAccess->range->first || renamedBitRange->second != variableAccess->range->second;
+            }
+
+            std::vector<Expression::ptr> renamedIndices;
+            renamedIndices.reserve(variableAccess->indexes.size());
+            for (const Expression::ptr& index: variableAccess->indexes) {
+                renamedIndices.emplace_back(renameExpression(index));
+                wasRenamed |= renamedIndices.back() != index;
+            }
+
+            if (!wasRenamed) {
+                return variableAccess;
+            }
+            auto renamedVariableAccess = std::make_shared<VariableAccess>();
+            renamedVariableAccess->setVar(variableAccess->var);
+            renamedVariableAccess->range   = renamedBitRange;
+            renamedVariableAccess->indexes = std::move(renamedIndices);
+            return renamedVariableAccess;
+        }
+
+        [[nodiscard]] Expression::ptr renameExpression(const Expression::ptr& expression) const {
+            if (const auto* const exprAsNumericExpr = expressionCast<NumericExpression>(expression.get()); exprAsNumericExpr != nullptr) {
+                const Number::ptr renamedValue = renameNumber(exprAsNumericExpr->value);
+                return renamedValue != exprAsNumericExpr->value ? std::make_shared<NumericExpression>(renamedValue, exprAsNumericExpr->bitwidth()) : expression;
+            }
+            if (const auto* const exprAsVariableExpr = expressionCast<VariableExpression>(expression.get()); exprAsVariableExpr != nullptr) {
+                const VariableAccess::ptr renamedVariableAccess = renameVariableAccess(exprAsVariableExpr->var);
+                return renamedVariableAccess != exprAsVariableExpr->var ? std::make_shared<VariableExpression>(renamedVariableAccess) : expression;
+            }
+            if (const auto* const exprAsBinaryExpr = expressionCast<BinaryExpression>(expression.get()); exprAsBinaryExpr != nullptr) {
+                const Expression::ptr renamedLhsOperand = renameExpression(exprAsBinaryExpr->lhs);
+                const Expression::ptr renamedRhsOperand = renameExpression(exprAsBinaryExpr->rhs);
+                return renamedLhsOperand != exprAsBinaryExpr->lhs || renamedRhsOperand != exprAsBinaryExpr->rhs ? std::make_shared<BinaryExpression>(renamedLhsOperand, exprAsBinaryExpr->binaryOperation, renamedRhsOperand) : expression;
+            }
+            if (const auto* const exprAsShiftExpr = expressionCast<ShiftExpression>(expression.get()); exprAsShiftExpr != nullptr) {
+                const Expression::ptr renamedToBeShiftedOperand = renameExpression(exprAsShiftExpr->lhs);
+                const Number::ptr     renamedShiftAmount        = renameNumber(exprAsShiftExpr->rhs);
+                return renamedToBeShiftedOperand != exprAsShiftExpr->lhs || renamedShiftAmount != exprAsShiftExpr->rhs ? std::make_shared<ShiftExpression>(renamedToBeShiftedOperand, exprAsShiftExpr->shiftOperation, renamedShiftAmount) : expression;
+            }
+            if (const auto* const exprAsUnaryExpr = expressionCast<UnaryExpression>(expression.get()); exprAsUnaryExpr != nullptr) {
+                const Expression::ptr renamedOperand = renameExpression(exprAsUnaryExpr->expr);
+                return renamedOperand != exprAsUnaryExpr->expr ? std::make_shared<UnaryExpression>(exprAsUnaryExpr->unaryOperation, renamedOperand) : expression;
+            }
+            return expression;
+        }
+
+        [[nodiscard]] Statement::ptr renameStatement(const Statement::ptr& statement) const {
+            Statement::ptr renamedStatement = statement;
+            if (const auto* const swapStmt = statementCast<SwapStatement>(statement.get()); swapStmt != nullptr) {
+                const VariableAccess::ptr renamedLhs = renameVariableAccess(swapStmt->lhs);
+                const VariableAccess::ptr renamedRhs = renameVariableAccess(swapStmt->rhs);
+                if (renamedLhs != swapStmt->lhs || renamedRhs != swapStmt->rhs) {
+                    renamedStatement = std::make_shared<SwapStatement>(renamedLhs, renamedRhs);
+                }
+            } else if (const auto* const unaryStmt = statementCast<UnaryStatement>(statement.get()); unaryStmt != nullptr) {
+                if (const VariableAccess::ptr renamedVariableAccess = renameVariableAccess(unaryStmt->var); renamedVariableAccess != unaryStmt->var) {
+                    renamedStatement = std::make_shared<UnaryStatement>(unaryStmt->unaryOperation, renamedVariableAccess);
+                }
+            } else if (const auto* const assignStmt = statementCast<AssignStatement>(statement.get()); assignStmt != nullptr) {
+                const VariableAccess::ptr renamedLhs = renameVariableAccess(assignStmt->lhs);
+                const Expression::ptr     renamedRhs = renameExpression(assignStmt->rhs);
+                if (renamedLhs != assignStmt->lhs || renamedRhs != assignStmt->rhs) {
+                    renamedStatement = std::make_shared<AssignStatement>(renamedLhs, assignStmt->assignOperation, renamedRhs);
+                }
+            } else if (const auto* const ifStmt = statementCast<IfStatement>(statement.get()); ifStmt != nullptr) {
+                auto renamedIfStmt = std::make_shared<IfStatement>();
+                renamedIfStmt->setCondition(renameExpression(ifStmt->condition));
+                renamedIfStmt->setFiCondition(renameExpression(ifStmt->fiCondition));
+                renamedIfStmt->thenStatements = renameStatements(ifStmt->thenStatements);
+                renamedIfStmt->elseStatements = renameStatements(ifStmt->elseStatements);
+                if (renamedIfStmt->condition != ifStmt->condition || renamedIfStmt->fiCondition != ifStmt->fiCondition || renamedIfStmt->thenStatements != ifStmt->thenStatements || renamedIfStmt->elseStatements != ifStmt->elseStatements) {
+                    renamedStatement = renamedIfStmt;
+                }
+            } else if (const auto* const forStmt = statementCast<ForStatement>(statement.get()); forStmt != nullptr) {
+                auto renamedForStmt          = std::make_shared<ForStatement>();
+                renamedForStmt->loopVariable = forStmt->loopVariable;
+                renamedForStmt->range        = std::make_pair(renameNumber(forStmt->range.first), renameNumber(forStmt->range.second));
+                renamedForStmt->step         = renameNumber(forStmt->step);
+                renamedForStmt->statements   = renameStatements(forStmt->statements);
+                if (renamedForStmt->range != forStmt->range || renamedForStmt->step != forStmt->step || renamedForStmt->statements != forStmt->statements) {
+                    renamedStatement = renamedForStmt;
+                }
+            }
+
+            if (renamedStatement != statement) {
+                renamedStatement->lineNumber = statement->lineNumber;
+            }
+            return renamedStatement;
+        }
+    };
+
+    class LoopFusion {
+    public:
+        std::size_t numFusedLoops = 0;
+
+        void fuseLoopsOfModule(const Module::ptr& module) {
+            if (module != nullptr) {
+                module->statements = fuseLoopsOfStatements(module->statements);
+            }
+        }
+
+    private:
+        /**
+         * @brief Determine whether all accesses of a variable access the same element of the variable selected by a loop variable.
+         *
+         * The indices of every access must either be the integer constants or the loop variable, with the loop variable being used in at least one index.
+         */
+        [[nodiscard]] static bool doAllAccessesSelectSameElementUsingLoopVariable(const std::vector<const VariableAccess*>& accesses, const std::string& loopVariable) {
+            // The value of an index is set to std::nullopt if the index is the loop variable.
+            std::optional<std::vector<std::optional<unsigned>>> indicesOfFirstAccess;
+            for (const VariableAccess* access: accesses) {
+                std::vector<std::optional<unsigned>> indices;
+                bool                                 isLoopVariableUsedAsIndex = false;
+                for (const Expression::ptr& index: access->indexes) {
+                    const auto* const indexAsNumericExpr = expressionCast<NumericExpression>(index.get());
+                    if (indexAsNumericExpr == nullptr || indexAsNumericExpr->value == nullptr) {
+                        return false;
+                    }
+                    if (indexAsNumericExpr->value->isLoopVariable() && indexAsNumericExpr->value->variableName() == loopVariable) {
+                        indices.emplace_back(std::nullopt);
+                        isLoopVariableUsedAsIndex = true;
+                    } else if (indexAsNumericExpr->value->isConstant()) {
+                        indices.emplace_back(indexAsNumericExpr->value->evaluate({}));
+                    } else {
+                        return false;
+                    }
+                }
+
+                if (!isLoopVariableUsedAsIndex || (indicesOfFirstAccess.has_value() && *indicesOfFirstAccess != indices)) {
+                    return false;
+                }
+                indicesOfFirstAccess = std::move(indices);
+            }
+            return true;
+        }
+
+        /**
+         * @brief Determine whether the iterations of two loop bodies, using the same loop variable, can be interleaved.
+         *
+         * An iteration of the second loop body can be executed before a later iteration of the first loop body if every variable modified in one loop body is either not accessed in the other loop body or all
+         * accesses of the variable in both loop bodies access the element selected by the loop variable, which is different in every iteration.
+         */
+        [[nodiscard]] static bool areLoopBodiesIndependent(const UsagesOfStatements& usagesOfFirstLoopBody, const UsagesOfStatements& usagesOfSecondLoopBody, const std::string& loopVariable) {
+            return std::ranges::all_of(usagesOfFirstLoopBody.variables, [&](const auto& usageOfVariableInFirstLoopBody) {
+                const auto& [variableIdentifier, usageInFirstLoopBody] = usageOfVariableInFirstLoopBody;
+                const auto& usageInSecondLoopBody                      = usagesOfSecondLoopBody.variables.find(variableIdentifier);
+                if (usageInSecondLoopBody == usagesOfSecondLoopBody.variables.end() || (!usageInFirstLoopBody.isModified && !usageInSecondLoopBody->second.isModified)) {
+                    return true;
+                }
+                if (loopVariable.empty() || usageInFirstLoopBody.isPassedToModule || usageInSecondLoopBody->second.isPassedToModule) {
+                    return false;
+                }
+
+                std::vector<const VariableAccess*> accesses = usageInFirstLoopBody.accesses;
+                accesses.insert(accesses.end(), usageInSecondLoopBody->second.accesses.cbegin(), usageInSecondLoopBody->second.accesses.cend());
+                return doAllAccessesSelectSameElementUsingLoopVariable(accesses, loopVariable);
+            });
+        }
+
+        [[nodiscard]] static bool canLoopVariableOfLoopBeReplaced(const std::string& loopVariable, const UsagesOfStatements& usagesOfLoopBody, const std::string& newLoopVariable) {
+            // Nested loops declaring either of the loop variables would shadow them, loops are also not fused if the new loop variable is used in the loop body to refer to a loop variable of an enclosing loop.
+            if ((!loopVariable.empty() && usagesOfLoopBody.declaredLoopVariables.contains(loopVariable)) || (!newLoopVariable.empty() && usagesOfLoopBody.declaredLoopVariables.contains(newLoopVariable))) {
+                return false;
+            }
+            return loopVariable == newLoopVariable || newLoopVariable.empty() || !usagesOfLoopBody.usedLoopVariables.contains(newLoopVariable);
+        }
+
+        [[nodiscard]] static std::shared_ptr<ForStatement> tryFuseLoops(const ForStatement& firstLoop, const ForStatement& secondLoop) {
+            const std::optional<std::array<unsigned, 3>> iterationsOfFirstLoop = tryDetermineIterationsOfLoop(firstLoop);
+            if (!iterationsOfFirstLoop.has_value() || iterationsOfFirstLoop != tryDetermineIterationsOfLoop(secondLoop)) {
+                return nullptr;
+            }
+
+            const std::string& fusedLoopVariable = !firstLoop.loopVariable.empty() ? firstLoop.loopVariable : secondLoop.loopVariable;
+            UsagesOfStatements usagesOfFirstLoopBody;
+            UsagesOfStatements usagesOfSecondLoopBody;
+            collectUsagesOfStatements(firstLoop.statements, usagesOfFirstLoopBody);
+            collectUsagesOfStatements(secondLoop.statements, usagesOfSecondLoopBody);
+            if (!canLoopVariableOfLoopBeReplaced(firstLoop.loopVariable, usagesOfFirstLoopBody, fusedLoopVariable) || !canLoopVariableOfLoopBeReplaced(secondLoop.loopVariable, usagesOfSecondLoopBody, fusedLoopVariable)) {
+                return nullptr;
+            }
+
+            Statement::vec renamedSecondLoopBody = secondLoop.statements;
+            if (!secondLoop.loopVariable.empty() && secondLoop.loopVariable != fusedLoopVariable) {
+                renamedSecondLoopBody  = LoopVariableRenamer(secondLoop.loopVariable, fusedLoopVariable).renameStatements(secondLoop.statements);
+                usagesOfSecondLoopBody = UsagesOfStatements();
+                collectUsagesOfStatements(renamedSecondLoopBody, usagesOfSecondLoopBody);
+            }
+            if (!areLoopBodiesIndependent(usagesOfFirstLoopBody, usagesOfSecondLoopBody, fusedLoopVariable)) {
+                return nullptr;
+            }
+
+            auto fusedLoop          = std::make_shared<ForStatement>();
+            fusedLoop->loopVariable = fusedLoopVariable;
+            fusedLoop->range        = firstLoop.range;
+            fusedLoop->step         = firstLoop.step;
+            fusedLoop->statements   = firstLoop.statements;
+            fusedLoop->statements.insert(fusedLoop->statements.end(), renamedSecondLoopBody.cbegin(), renamedSecondLoopBody.cend());
+            fusedLoop->lineNumber = firstLoop.lineNumber;
+            return fusedLoop;
+        }
+
+        [[nodiscard]] Statement::vec fuseLoopsOfStatements(const Statement::vec& statements) {
+            Statement::vec optimizedStatements;
+            optimizedStatements.reserve(statements.size());
+            for (const Statement::ptr& statement: statements) {
+                Statement::ptr optimizedStatement = statement;
+                if (const auto* const ifStmt = statementCast<IfStatement>(statement.get()); ifStmt != nullptr) {
+                    auto optimizedIfStmt = std::make_shared<IfStatement>();
+                    optimizedIfStmt->setCondition(ifStmt->condition);
+                    optimizedIfStmt->setFiCondition(ifStmt->fiCondition);
+                    optimizedIfStmt->thenStatements = fuseLoopsOfStatements(ifStmt->thenStatements);
+                    optimizedIfStmt->elseStatements = fuseLoopsOfStatements(ifStmt->elseStatements);
+                    if (optimizedIfStmt->thenStatements != ifStmt->thenStatements || optimizedIfStmt->elseStatements != ifStmt->elseStatements) {
+                        optimizedIfStmt->lineNumber = ifStmt->lineNumber;
+                        optimizedStatement          = optimizedIfStmt;
+                    }
+                } else if (const auto* const forStmt = statementCast<ForStatement>(statement.get()); forStmt != nullptr) {
+                    if (Statement::vec optimizedLoopBody = fuseLoopsOfStatements(forStmt->statements); optimizedLoopBody != forStmt->statements) {
+                        auto optimizedForStmt          = std::make_shared<ForStatement>();
+                        optimizedForStmt->loopVariable = forStmt->loopVariable;
+                        optimizedForStmt->range        = forStmt->range;
+                        optimizedForStmt->step         = forStmt->step;
+                        optimizedForStmt->statements   = std::move(optimizedLoopBody);
+                        optimizedForStmt->lineNumber   = forStmt->lineNumber;
+                        optimizedStatement             = optimizedForStmt;
+                    }
+
+                    if (const auto* const precedingForStmt = !optimizedStatements.empty() ? statementCast<ForStatement>(optimizedStatements.back().get()) : nullptr; precedingForStmt != nullptr) {
+                        if (const std::shared_ptr<ForStatement> fusedLoop = tryFuseLoops(*precedingForStmt, *statementCast<ForStatement>(optimizedStatement.get())); fusedLoop != nullptr) {
+                            optimizedStatements.back() = fusedLoop;
+                            ++numFusedLoops;
+                            continue;
+                        }
+                    }
+                }
+                optimizedStatements.emplace_back(optimizedStatement);
+            }
+            return optimizedStatements;
+        }
+    };
+
+    class LoopInvariantCodeMotion {
+    public:
+        /**
+         * The minimum number of iterations of a loop whose invariant expressions are hoisted.
+         */
+        static constexpr std::size_t MIN_NUM_ITERATIONS_OF_LOOP = 3;
+        std::size_t                  numHoistedExpressions      = 0;
+
+        explicit LoopInvariantCodeMotion(const utils::IntegerConstantTruncationOperation integerConstantTruncationOperation):
+            integerConstantTruncationOperation(integerConstantTruncationOperation) {}
+
+        void hoistLoopInvariantExpressionsOfModule(const Module::ptr& module) {
+            if (module == nullptr) {
+                return;
+            }
+            processedModule                             = module.get();
+            const std::size_t numPreviouslyHoistedExprs = numHoistedExpressions;
+            module->statements                          = hoistLoopInvariantExpressionsOfStatements(module->statements);
+            if (numHoistedExpressions != numPreviouslyHoistedExprs) {
+                module->assignDeclarationIndicesOfVariables();
+            }
+        }
+
+    private:
+        /**
+         * A hoisted expression whose result is stored in a local wire variable.
+         */
+        struct HoistedExpression {
+            Variable::ptr   wire;
+            Expression::ptr expression;
+        };
+
+        utils::IntegerConstantTruncationOperation integerConstantTruncationOperation;
+        Module*                                   processedModule = nullptr;
+
+        [[nodiscard]] static VariableAccess::ptr createAccessOfWire(const Variable::ptr& wire) {
+            auto variableAccess = std::make_shared<VariableAccess>();
+            variableAccess->setVar(wire);
+            variableAccess->indexes = {std::make_shared<NumericExpression>(std::make_shared<Number>(0U), 1U)};
+            return variableAccess;
+        }
+
+        [[nodiscard]] Variable::ptr createWire(const unsigned bitwidth) const {
+            std::string wireIdentifier;
+            for (std::size_t i = 0; wireIdentifier.empty() || processedModule->findParameterOrVariable(wireIdentifier).has_value(); ++i) {
+                wireIdentifier = "loopInvariantExpr" + std::to_string(i);
+            }
+            auto wire = std::make_shared<Variable>(Variable::Type::Wire, wireIdentifier, std::vector<unsigned>({1U}), bitwidth);
+            processedModule->variables.emplace_back(wire);
+            return wire;
+        }
+
+        [[nodiscard]] static bool isExpressionInvariantInLoopBody(const Expression::ptr& expression, const UsagesOfStatements& usagesOfLoopBody) {
+            UsagesOfStatements usagesOfExpression;
+            collectUsagesOfExpression(expression, usagesOfExpression);
+            return usagesOfExpression.usedLoopVariables.empty() && std::ranges::none_of(usagesOfExpression.variables, [&](const auto& usageOfVariable) {
+                       const auto& usageInLoopBody = usagesOfLoopBody.variables.find(usageOfVariable.first);
+                       return usageInLoopBody != usagesOfLoopBody.variables.end() && usageInLoopBody->second.isModified;
+                   });
+        }
+
+        [[nodiscard]] Expression::ptr hoistLoopInvariantSubexpressions(const Expression::ptr& expression, const UsagesOfStatements& usagesOfLoopBody, std::vector<HoistedExpression>& hoistedExpressions) {
+            const auto* const exprAsBinaryExpr = expressionCast<BinaryExpression>(expression.get());
+            const auto* const exprAsShiftExpr  = expressionCast<ShiftExpression>(expression.get());
+            const auto* const exprAsUnaryExpr  = expressionCast<UnaryExpression>(expression.get());
+            if (exprAsBinaryExpr == nullptr && exprAsShiftExpr == nullptr && exprAsUnaryExpr == nullptr) {
+                return expression;
+            }
+
+            // The bitwidth of the wire storing the result of the hoisted expression must match the bitwidth of the synthesized expression.
+            if (isExpressionInvariantInLoopBody(expression, usagesOfLoopBody)) {
+                if (const std::optional<ValueRange> valueRangeOfExpr = determineValueRangeOfExpression(*expression, {}, std::nullopt, integerConstantTruncationOperation); valueRangeOfExpr.has_value() && valueRangeOfExpr->bitwidth == expression->bitwidth() && valueRangeOfExpr->bitwidth != 0U) {
+                    const Variable::ptr wire = createWire(valueRangeOfExpr->bitwidth);
+                    hoistedExpressions.emplace_back(HoistedExpression{.wire = wire, .expression = expression});
+                    ++numHoistedExpressions;
+                    return std::make_shared<VariableExpression>(createAccessOfWire(wire));
+                }
+            }
+
+            if (exprAsBinaryExpr != nullptr) {
+                const Expression::ptr optimizedLhsOperand = hoistLoopInvariantSubexpressions(exprAsBinaryExpr->lhs, usagesOfLoopBody, hoistedExpressions);
+                const Expression::ptr optimizedRhsOperand = hoistLoopInvariantSubexpressions(exprAsBinaryExpr->rhs, usagesOfLoopBody, hoistedExpressions);
+                return optimizedLhsOperand != exprAsBinaryExpr->lhs || optimizedRhsOperand != exprAsBinaryExpr->rhs ? std::make_shared<BinaryExpression>(optimizedLhsOperand, exprAsBinaryExpr->binaryOperation, optimizedRhsOperand) : expression;
+            }
+            if (exprAsShiftExpr != nullptr) {
+                const Expression::ptr optimizedToBeShiftedOperand = hoistLoopInvariantSubexpressions(exprAsShiftExpr->lhs, usagesOfLoopBody, hoistedExpressions);
+                return optimizedToBeShiftedOperand != exprAsShiftExpr->lhs ? std::make_shared<ShiftExpression>(optimizedToBeShiftedOperand, exprAsShiftExpr->shiftOperation, exprAsShiftExpr->rhs) : expression;
+            }
+            const Expression::ptr optimizedOperand = hoistLoopInvariantSubexpressions(exprAsUnaryExpr->expr, usagesOfLoopBody, hoistedExpressions);
+            return optimizedOperand != exprAsUnaryExpr->expr ? std::make_shared<UnaryExpression>(exprAsUnaryExpr->unaryOperation, optimizedOperand) : expression;
+        }
+
+        [[nodiscard]] Statement::vec hoistLoopInvariantSubexpressionsOfStatements(const Statement::vec& statements, const UsagesOfStatements& usagesOfLoopBody, std::vector<HoistedExpression>& hoistedExpressions) {
+            Statement::vec optimizedStatements;
+            optimizedStatements.reserve(statements.size());
+            for (const Statement::ptr& statement: statements) {
+                Statement::ptr optimizedStatement = statement;
+                if (const auto* const assignStmt = statementCast<AssignStatement>(statement.get()); assignStmt != nullptr) {
+                    if (const Expression::ptr optimizedRhs = hoistLoopInvariantSubexpressions(assignStmt->rhs, usagesOfLoopBody, hoistedExpressions); optimizedRhs != assignStmt->rhs) {
+                        optimizedStatement = std::make_shared<AssignStatement>(assignStmt->lhs, assignStmt->assignOperation, optimizedRhs);
+                    }
+                } else if (const auto* const ifStmt = statementCast<IfStatement>(statement.get()); ifStmt != nullptr) {
+                    auto optimizedIfStmt = std::make_shared<IfStatement>();
+                    optimizedIfStmt->setCondition(ifStmt->condition);
+                    optimizedIfStmt->setFiCondition(ifStmt->fiCondition);
+                    optimizedIfStmt->thenStatements = hoistLoopInvariantSubexpressionsOfStatements(ifStmt->thenStatements, usagesOfLoopBody, hoistedExpressions);
+                    optimizedIfStmt->elseStatements = hoistLoopInvariantSubexpressionsOfStatements(ifStmt->elseStatements, usagesOfLoopBody, hoistedExpressions);
+                    if (optimizedIfStmt->thenStatements != ifStmt->thenStatements || optimizedIfStmt->elseStatements != ifStmt->elseStatements) {
+                        optimizedStatement = optimizedIfStmt;
+                    }
+                } else if (const auto* const forStmt = statementCast<ForStatement>(statement.get()); forStmt != nullptr) {
+                    if (Statement::vec optimizedLoopBody = hoistLoopInvariantSubexpressionsOfStatements(forStmt->statements, usagesOfLoopBody, hoistedExpressions); optimizedLoopBody != forStmt->statements) {
+                        auto optimizedForStmt          = std::make_shared<ForStatement>();
+                        optimizedForStmt->loopVariable = forStmt->loopVariable;
+                        optimizedForStmt->range        = forStmt->range;
+                        optimizedForStmt->step         = forStmt->step;
+                        optimizedForStmt->statements   = std::move(optimizedLoopBody);
+                        optimizedStatement             = optimizedForStmt;
+                    }
+                }
+
+                if (optimizedStatement != statement) {
+                    optimizedStatement->lineNumber = statement->lineNumber;
+                }
+                optimizedStatements.emplace_back(optimizedStatement);
+            }
+            return optimizedStatements;
+        }
+
+        [[nodiscard]] Statement::vec hoistLoopInvariantExpressionsOfStatements(const Statement::vec& statements) {
+            Statement::vec optimizedStatements;
+            optimizedStatements.reserve(statements.size());
+            for (const Statement::ptr& statement: statements) {
+                Statement::ptr optimizedStatement = statement;
+                if (const auto* const ifStmt = statementCast<IfStatement>(statement.get()); ifStmt != nullptr) {
+                    auto optimizedIfStmt = std::make_shared<IfStatement>();
+                    optimizedIfStmt->setCondition(ifStmt->condition);
+                    optimizedIfStmt->setFiCondition(ifStmt->fiCondition);
+                    optimizedIfStmt->thenStatements = hoistLoopInvariantExpressionsOfStatements(ifStmt->thenStatements);
+                    optimizedIfStmt->elseStatements = hoistLoopInvariantExpressionsOfStatements(ifStmt->elseStatements);
+                    if (optimizedIfStmt->thenStatements != ifStmt->thenStatements || optimizedIfStmt->elseStatements != ifStmt->elseStatements) {
+                        optimizedIfStmt->lineNumber = ifStmt->lineNumber;
+                        optimizedStatement          = optimizedIfStmt;
+                    }
+                    optimizedStatements.emplace_back(optimizedStatement);
+                    continue;
+                }
+
+                const auto* const forStmt = statementCast<ForStatement>(statement.get());
+                if (forStmt == nullptr) {
+                    optimizedStatements.emplace_back(optimizedStatement);
+                    continue;
+                }
+
+                // The outermost loop is processed first to hoist an invariant expression out of as many enclosing loops as possible.
+                std::vector<HoistedExpression> hoistedExpressions;
+                Statement::vec                 optimizedLoopBody = forStmt->statements;
+                if (const std::optional<std::array<unsigned, 3>> iterationsOfLoop = tryDetermineIterationsOfLoop(*forStmt); iterationsOfLoop.has_value() && determineNumberOfIterationsOfLoop(*iterationsOfLoop) >= MIN_NUM_ITERATIONS_OF_LOOP) {
+                    UsagesOfStatements usagesOfLoopBody;
+                    collectUsagesOfStatements(forStmt->statements, usagesOfLoopBody);
+                    optimizedLoopBody = hoistLoopInvariantSubexpressionsOfStatements(forStmt->statements, usagesOfLoopBody, hoistedExpressions);
+                }
+                optimizedLoopBody = hoistLoopInvariantExpressionsOfStatements(optimizedLoopBody);
+
+                if (optimizedLoopBody != forStmt->statements) {
+                    auto optimizedForStmt          = std::make_shared<ForStatement>();
+                    optimizedForStmt->loopVariable = forStmt->loopVariable;
+                    optimizedForStmt->range        = forStmt->range;
+                    optimizedForStmt->step         = forStmt->step;
+                    optimizedForStmt->statements   = std::move(optimizedLoopBody);
+                    optimizedForStmt->lineNumber   = forStmt->lineNumber;
+                    optimizedStatement             = optimizedForStmt;
+                }
+
+                // The hoisted expressions do not depend on each other, thus their results can be computed prior to the loop and reverted in reverse order after the loop.
+                for (const HoistedExpression& hoistedExpression: hoistedExpressions) {
+                    optimizedStatements.emplace_back(std::make_shared<AssignStatement>(createAccessOfWire(hoistedExpression.wire), AssignStatement::AssignOperation::Exor, hoistedExpression.expression));
+                    optimizedStatements.back()->lineNumber = forStmt->lineNumber;
+                }
+                optimizedStatements.emplace_back(optimizedStatement);
+                for (const HoistedExpression& hoistedExpression: hoistedExpressions | std::views::reverse) {
+                    optimizedStatements.emplace_back(std::make_shared<AssignStatement>(createAccessOfWire(hoistedExpression.wire), AssignStatement::AssignOperation::Exor, hoistedExpression.expression));
+                    optimizedStatements.back()->lineNumber = forStmt->lineNumber;
+                }
+            }
+            return optimizedStatements;
+        }
+    };
+
+    [[nodiscard]] std::optional<std::size_t> tryEstimateNumberOfQuantumOperations(const Program& program, const ConfigurableOptions& synthesisSettings, const SynthesisAlgorithm synthesisAlgorithm) {
+        ResourceEstimate estimate;
+        return estimateResourcesOfSynthesis(estimate, program, synthesisSettings, synthesisAlgorithm) ? std::make_optional(estimate.numQuantumOperations) : std::nullopt;
+    }
+} // namespace
+
+void syrec::optimizeLoopsOfProgram(Program& program, const LoopOptimizationSettings& settings, const ConfigurableOptions& synthesisSettings, const SynthesisAlgorithm synthesisAlgorithm, LoopOptimizationReport* optionalReport) {
+    if (settings.fuseAdjacentLoops) {
+        LoopFusion loopFusion;
+        if (optionalReport != nullptr) {
+            optionalReport->loopFusion.estimatedNumQuantumOperationsPriorToPass = tryEstimateNumberOfQuantumOperations(program, synthesisSettings, synthesisAlgorithm);
+        }
+        for (const Module::ptr& module: program.modules()) {
+            loopFusion.fuseLoopsOfModule(module);
+        }
+        if (optionalReport != nullptr) {
+            optionalReport->loopFusion.numTransformations                    = loopFusion.numFusedLoops;
+            optionalReport->loopFusion.estimatedNumQuantumOperationsAfterPass = tryEstimateNumberOfQuantumOperations(program, synthesisSettings, synthesisAlgorithm);
+        }
+    }
+
+    if (settings.hoistLoopInvariantExpressions) {
+        LoopInvariantCodeMotion loopInvariantCodeMotion(synthesisSettings.integerConstantTruncationOperation);
+        if (optionalReport != nullptr) {
+            optionalReport->loopInvariantCodeMotion.estimatedNumQuantumOperationsPriorToPass = tryEstimateNumberOfQuantumOperations(program, synthesisSettings, synthesisAlgorithm);
+        }
+        for (const Module::ptr& module: program.modules()) {
+            loopInvariantCodeMotion.hoistLoopInvariantExpressionsOfModule(module);
+        }
+        if (optionalReport != nullptr) {
+            optionalReport->loopInvariantCodeMotion.numTransformations                    = loopInvariantCodeMotion.numHoistedExpressions;
+            optionalReport->loopInvariantCodeMotion.estimatedNumQuantumOperationsAfterPass = tryEstimateNumberOfQuantumOperations(program, synthesisSettings, synthesisAlgorithm);
+        }
+    }
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/optimization/optimization_pass_manager.hpp"
+
+#include "algorithms/optimization/ancillary_qubit_recycling.hpp"
+#include "algorithms/simulation/equivalence_checking.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/diagnostics.hpp"
+#include "core/statistics.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <optional>
+#include <ostream>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    // The verification is performed after every pass, thus fewer assignments than in a standalone equivalence check are simulated by default.
+    constexpr std::size_t   DEFAULT_MAX_NUM_PRIMARY_INPUTS_OF_EXHAUSTIVE_VERIFICATION = 16U;
+    constexpr std::uint64_t DEFAULT_NUM_RANDOM_SAMPLES_OF_VERIFICATION                = static_cast<std::uint64_t>(1U) << 14U;
+} // namespace
+
+OptimizationPassManager::OptimizationPassManager(const ConfigurableOptions& settings):
+    maxNumIterations(settings.maxNumIterationsOfOptimizationPipeline), verifyPasses(settings.verifyPassesOfOptimizationPipeline) {
+    verificationSettings.maxNumPrimaryInputsOfExhaustiveCheck = DEFAULT_MAX_NUM_PRIMARY_INPUTS_OF_EXHAUSTIVE_VERIFICATION;
+    verificationSettings.numRandomSamples                     = DEFAULT_NUM_RANDOM_SAMPLES_OF_VERIFICATION;
+
+    registeredPasses.emplace(PROPAGATE_CONSTANT_QUBIT_VALUES_PASS, [](AnnotatableQuantumComputation& annotatableQuantumComputation) {
+        return annotatableQuantumComputation.propagateConstantQubitValues();
+    });
+    registeredPasses.emplace(APPLY_REVERSIBLE_CIRCUIT_TEMPLATES_PASS, [windowSize = settings.windowSizeOfReversibleCircuitTemplates, timeBudgetInMilliseconds = settings.timeBudgetOfReversibleCircuitTemplatesInMilliseconds](AnnotatableQuantumComputation& annotatableQuantumComputation) {
+        return annotatableQuantumComputation.applyReversibleCircuitTemplates(windowSize, timeBudgetInMilliseconds);
+    });
+    registeredPasses.emplace(CANCEL_ADJACENT_SELF_INVERSE_QUANTUM_OPERATIONS_PASS, [](AnnotatableQuantumComputation& annotatableQuantumComputation) {
+        return annotatableQuantumComputation.cancelAdjacentSelfInverseQuantumOperations();
+    });
+    registeredPasses.emplace(REORDER_QUANTUM_OPERATIONS_TO_REDUCE_DEPTH_PASS, [](AnnotatableQuantumComputation& annotatableQuantumComputation) {
+        return annotatableQuantumComputation.reorderQuantumOperationsToReduceDepth();
+    });
+    // The recycling does not modify quantum computations not satisfying its requirements (i.e. containing compound operations or forwarded quantum operations).
+    registeredPasses.emplace(RECYCLE_ANCILLARY_QUBITS_PASS, [](AnnotatableQuantumComputation& annotatableQuantumComputation) {
+        return annotatableQuantumComputation.isStreamingOfQuantumOperationsActive() ? 0U : recycleAncillaryQubits(annotatableQuantumComputation);
+    });
+}
+
+bool OptimizationPassManager::registerPass(const std::string& identifier, Pass pass) {
+    return pass != nullptr && registeredPasses.emplace(identifier, std::move(pass)).second;
+}
+
+bool OptimizationPassManager::isPassRegistered(const std::string_view identifier) const {
+    return registeredPasses.find(identifier) != registeredPasses.end();
+}
+
+std::vector<std::string> OptimizationPassManager::getIdentifiersOfRegisteredPasses() const {
+    std::vector<std::string> identifiersOfRegisteredPasses;
+    identifiersOfRegisteredPasses.reserve(registeredPasses.size());
+    for (const auto& identifier: registeredPasses | std::views::keys) {
+        identifiersOfRegisteredPasses.emplace_back(identifier);
+    }
+    return identifiersOfRegisteredPasses;
+}
+
+bool OptimizationPassManager::setPipeline(const std::vector<std::string>& identifiersOfPasses) {
+    if (!std::ranges::all_of(identifiersOfPasses, [&](const std::string& identifier) { return isPassRegistered(identifier); })) {
+        return false;
+    }
+    pipeline = identifiersOfPasses;
+    return true;
+}
+
+void OptimizationPassManager::setVerificationOfPasses(const bool verifyPasses, const EquivalenceCheckingSettings& verificationSettings) {
+    this->verifyPasses         = verifyPasses;
+    this->verificationSettings = verificationSettings;
+}
+
+bool OptimizationPassManager::run(AnnotatableQuantumComputation& annotatableQuantumComputation, Statistics* optionalRecordedStatistics) const {
+    std::map<std::string, OptimizationPassStatistics, std::less<>> statisticsPerPass;
+    std::size_t                                                    numIterations     = 0;
+    bool                                                           reachedFixedPoint = pipeline.empty();
+    bool                                                           passesOk          = true;
+    while (passesOk && !reachedFixedPoint && numIterations < maxNumIterations) {
+        ++numIterations;
+        reachedFixedPoint = true;
+        for (const std::string& identifierOfPass: pipeline) {
+            // The quantum operations already forwarded to a quantum operation sink are not available for the verification.
+            const std::optional<qc::QuantumComputation> quantumComputationPriorToPass = verifyPasses && annotatableQuantumComputation.getNumForwardedQuantumOperations() == 0U ? std::make_optional<qc::QuantumComputation>(annotatableQuantumComputation) : std::nullopt;
+            const std::size_t                           numQuantumOperationsPriorToPass = annotatableQuantumComputation.getNops();
+            const std::size_t                           numQubitsPriorToPass            = annotatableQuantumComputation.getNqubits();
+
+            const auto        passStartTime    = std::chrono::steady_clock::now();
+            const std::size_t numModifications = registeredPasses.find(identifierOfPass)->second(annotatableQuantumComputation);
+            const auto        passEndTime      = std::chrono::steady_clock::now();
+
+            OptimizationPassStatistics& statisticsOfPass = statisticsPerPass[identifierOfPass];
+            ++statisticsOfPass.numApplications;
+            statisticsOfPass.numModifications += numModifications;
+            statisticsOfPass.runtimeInNanoseconds += Statistics::toNanoseconds(passEndTime - passStartTime);
+            statisticsOfPass.numRemovedQuantumOperations += static_cast<std::int64_t>(numQuantumOperationsPriorToPass) - static_cast<std::int64_t>(annotatableQuantumComputation.getNops());
+            statisticsOfPass.numRemovedQubits += static_cast<std::int64_t>(numQubitsPriorToPass) - static_cast<std::int64_t>(annotatableQuantumComputation.getNqubits());
+            if (numModifications == 0U) {
+                continue;
+            }
+
+            reachedFixedPoint = false;
+            // Quantum computations containing gates not supported by the bit-parallel simulation are not verified.
+            if (quantumComputationPriorToPass.has_value() && checkEquivalence(*quantumComputationPriorToPass, annotatableQuantumComputation, verificationSettings).outcome == EquivalenceCheckingResult::Outcome::NotEquivalent) {
+                getErrorStream() << "Optimization pass " << identifierOfPass << " did not preserve the function of the quantum computation in iteration " << std::to_string(numIterations) << " of the optimization pipeline\n";
+                passesOk = false;
+                break;
+            }
+        }
+    }
+
+    if (optionalRecordedStatistics != nullptr) {
+        optionalRecordedStatistics->numIterationsOfOptimizationPipeline = numIterations;
+        optionalRecordedStatistics->statisticsPerOptimizationPass       = std::move(statisticsPerPass);
+    }
+    return passesOk;
+}
@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/optimization/program_simplification.hpp"
+
+#include "core/configurable_options.hpp"
+#include "core/syrec/expression.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/number.hpp"
+#include "core/syrec/parser/utils/syrec_operation_utils.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    class ProgramSimplifier {
+    public:
+        explicit ProgramSimplifier(const utils::IntegerConstantTruncationOperation integerConstantTruncationOperation):
+            integerConstantTruncationOperation(integerConstantTruncationOperation) {}
+
+        void simplifyModule(const Module::ptr& module) {
+            // Modules are simplified prior to the first call/uncall of them to be able to determine whether their body is empty. A recursive call of a module is not simplified again.
+            if (module == nullptr || !visitedModules.insert(module.get()).second) {
+                return;
+            }
+
+            // Loop variables are only defined inside of the body of a module.
+            Number::LoopVariableMapping loopVariableValuesOfCallerModule = std::move(loopVariableValueLookup);
+            loopVariableValueLookup.clear();
+
+            Statement::vec simplifiedStatements;
+            simplifyStatements(module->statements, simplifiedStatements);
+            module->statements      = std::move(simplifiedStatements);
+            loopVariableValueLookup = std::move(loopVariableValuesOfCallerModule);
+        }
+
+    private:
+        utils::IntegerConstantTruncationOperation integerConstantTruncationOperation;
+        Number::LoopVariableMapping               loopVariableValueLookup;
+        std::unordered_set<const Module*>         visitedModules;
+
+        [[nodiscard]] static std::optional<unsigned> tryGetConstantValueOfExpression(const Expression::ptr& expression) {
+            if (const auto* const exprAsNumericExpr = expressionCast<NumericExpression>(expression.get()); exprAsNumericExpr != nullptr && exprAsNumericExpr->value != nullptr && exprAsNumericExpr->value->isConstant()) {
+                return exprAsNumericExpr->value->evaluate({});
+            }
+            return std::nullopt;
+        }
+
+        [[nodiscard]] std::optional<bool> tryDetermineTruthValueOfGuardCondition(const Expression::ptr& guardCondition) const {
+            // The guard condition of an if statement is synthesized as a 1-bit expression, thus the truth value of an integer constant guard condition is determined by its truncated value.
+            if (const std::optional<unsigned> constantValueOfGuardCondition = tryGetConstantValueOfExpression(guardCondition); constantValueOfGuardCondition.has_value()) {
+                return utils::truncateConstantValueToExpectedBitwidth(*constantValueOfGuardCondition, 1U, integerConstantTruncationOperation) != 0U;
+            }
+            return std::nullopt;
+        }
+
+        [[nodiscard]] Number::ptr simplifyNumber(const Number::ptr& number) const {
+            if (number == nullptr || number->isConstant()) {
+                return number;
+            }
+            if (const std::optional<unsigned> compileTimeValueOfNumber = number->tryEvaluate(loopVariableValueLookup); compileTimeValueOfNumber.has_value()) {
+                return std::make_shared<Number>(*compileTimeValueOfNumber);
+            }
+            if (number->isConstantExpression()) {
+                const Number::ConstantExpression constantExpression  = *number->constantExpression();
+                const Number::ptr                simplifiedLhsOperand = simplifyNumber(constantExpression.lhsOperand);
+                const Number::ptr                simplifiedRhsOperand = simplifyNumber(constantExpression.rhsOperand);
+                if (simplifiedLhsOperand != constantExpression.lhsOperand || simplifiedRhsOperand != constantExpression.rhsOperand) {
+                    return std::make_shared<Number>(Number::ConstantExpression(simplifiedLhsOperand, constantExpression.operation, simplifiedRhsOperand));
+                }
+            }
+            return number;
+        }
+
+        [[nodiscard]] VariableAccess::ptr simplifyVariableAccess(const VariableAccess::ptr& variableAccess) const {
+            if (variableAccess == nullptr) {
+                return variableAccess;
+            }
+
+            bool                                               wasSimplified = false;
+            std::optional<std::pair<Number::ptr, Number::ptr>> simplifiedBitRange;
+            if (variableAccess->range.has_value()) {
+                simplifiedBitRange = std::make_pair(simplifyNumber(variableAccess->range->first), simplifyNumber(variableAccess->range->second));
+                wasSimplified      = simplifiedBitRange->first != variableAccess->range->first || simplifiedBitRange->second != variableAccess->range->second;
+            }
+
+            std::vector<Expression::ptr> simplifiedIndices;
+            simplifiedIndices.reserve(variableAccess->indexes.size());
+            for (const Expression::ptr& index: variableAccess->indexes) {
+                simplifiedIndices.emplace_back(simplifyExpression(index));
+                wasSimplified |= simplifiedIndices.back() != index;
+            }
+
+            if (!wasSimplified) {
+                return variableAccess;
+            }
+            auto simplifiedVariableAccess = std::make_shared<VariableAccess>();
+            simplifiedVariableAccess->setVar(variableAccess->var);
+            simplifiedVariableAccess->range   = simplifiedBitRange;
+            simplifiedVariableAccess->indexes = std::move(simplifiedIndices);
+            return simplifiedVariableAccess;
+        }
+
+        [[nodiscard]] Expression::ptr simplifyExpression(const Expression::ptr& expression) const {
+            if (const auto* const exprAsNumericExpr = expressionCast<NumericExpression>(expression.get()); exprAsNumericExpr != nullptr) {
+                const Number::ptr simplifiedValue = simplifyNumber(exprAsNumericExpr->value);
+                return simplifiedValue != exprAsNumericExpr->value ? std::make_shared<NumericExpression>(simplifiedValue, exprAsNumericExpr->bitwidth()) : expression;
+            }
+            if (const auto* const exprAsVariableExpr = expressionCast<VariableExpression>(expression.get()); exprAsVariableExpr != nullptr) {
+                const VariableAccess::ptr simplifiedVariableAccess = simplifyVariableAccess(exprAsVariableExpr->var);
+                return simplifiedVariableAccess != exprAsVariableExpr->var ? std::make_shared<VariableExpression>(simplifiedVariableAccess) : expression;
+            }
+            if (const auto* const exprAsBinaryExpr = expressionCast<BinaryExpression>(expression.get()); exprAsBinaryExpr != nullptr) {
+                const Expression::ptr simplifiedLhsOperand = simplifyExpression(exprAsBinaryExpr->lhs);
+                const Expression::ptr simplifiedRhsOperand = simplifyExpression(exprAsBinaryExpr->rhs);
+                if (const std::optional<unsigned> compileTimeValueOfExpr = utils::tryEvaluate(tryGetConstantValueOfExpression(simplifiedLhsOperand), exprAsBinaryExpr->binaryOperation, tryGetConstantValueOfExpression(simplifiedRhsOperand)); compileTimeValueOfExpr.has_value()) {
+                    return std::make_shared<NumericExpression>(std::make_shared<Number>(*compileTimeValueOfExpr), exprAsBinaryExpr->bitwidth());
+                }
+                return simplifiedLhsOperand != exprAsBinaryExpr->lhs || simplifiedRhsOperand != exprAsBinaryExpr->rhs ? std::make_shared<BinaryExpression>(simplifiedLhsOperand, exprAsBinaryExpr->binaryOperation, simplifiedRhsOperand) : expression;
+            }
+            if (const auto* const exprAsShiftExpr = expressionCast<ShiftExpression>(expression.get()); exprAsShiftExpr != nullptr) {
+                const Expression::ptr         simplifiedToBeShiftedOperand  = simplifyExpression(exprAsShiftExpr->lhs);
+                const Number::ptr             simplifiedShiftAmount         = simplifyNumber(exprAsShiftExpr->rhs);
+                const std::optional<unsigned> compileTimeValueOfShiftAmount = simplifiedShiftAmount != nullptr && simplifiedShiftAmount->isConstant() ? std::make_optional(simplifiedShiftAmount->evaluate({})) : std::nullopt;
+                if (const std::optional<unsigned> compileTimeValueOfExpr = utils::tryEvaluate(tryGetConstantValueOfExpression(simplifiedToBeShiftedOperand), exprAsShiftExpr->shiftOperation, compileTimeValueOfShiftAmount); compileTimeValueOfExpr.has_value()) {
+                    return std::make_shared<NumericExpression>(std::make_shared<Number>(*compileTimeValueOfExpr), exprAsShiftExpr->bitwidth());
+                }
+                return simplifiedToBeShiftedOperand != exprAsShiftExpr->lhs || simplifiedShiftAmount != exprAsShiftExpr->rhs ? std::make_shared<ShiftExpression>(simplifiedToBeShiftedOperand, exprAsShiftExpr->shiftOperation, simplifiedShiftAmount) : expression;
+            }
+            if (const auto* const exprAsUnaryExpr = expressionCast<UnaryExpression>(expression.get()); exprAsUnaryExpr != nullptr) {
+                const Expression::ptr simplifiedOperand = simplifyExpression(exprAsUnaryExpr->expr);
+                if (const std::optional<unsigned> compileTimeValueOfExpr = utils::tryEvaluate(exprAsUnaryExpr->unaryOperation, tryGetConstantValueOfExpression(simplifiedOperand)); compileTimeValueOfExpr.has_value()) {
+                    return std::make_shared<NumericExpression>(std::make_shared<Number>(*compileTimeValueOfExpr), exprAsUnaryExpr->bitwidth());
+                }
+                return simplifiedOperand != exprAsUnaryExpr->expr ? std::make_shared<UnaryExpression>(exprAsUnaryExpr->unaryOperation, simplifiedOperand) : expression;
+            }
+            return expression;
+        }
+
+        void simplifyStatements(const Statement::vec& statements, Statement::vec& simplifiedStatements) {
+            for (const Statement::ptr& statement: statements) {
+                simplifyStatement(statement, simplifiedStatements);
+            }
+        }
+
+        void simplifyStatement(const Statement::ptr& statement, Statement::vec& simplifiedStatements) {
+            if (statement == nullptr || statementCast<SkipStatement>(statement.get()) != nullptr) {
+                return;
+            }
+
+            Statement::ptr simplifiedStatement = statement;
+            if (const auto* const swapStmt = statementCast<SwapStatement>(statement.get()); swapStmt != nullptr) {
+                const VariableAccess::ptr simplifiedLhs = simplifyVariableAccess(swapStmt->lhs);
+                const VariableAccess::ptr simplifiedRhs = simplifyVariableAccess(swapStmt->rhs);
+                if (simplifiedLhs != swapStmt->lhs || simplifiedRhs != swapStmt->rhs) {
+                    simplifiedStatement = std::make_shared<SwapStatement>(simplifiedLhs, simplifiedRhs);
+                }
+            } else if (const auto* const unaryStmt = statementCast<UnaryStatement>(statement.get()); unaryStmt != nullptr) {
+                if (const VariableAccess::ptr simplifiedVariableAccess = simplifyVariableAccess(unaryStmt->var); simplifiedVariableAccess != unaryStmt->var) {
+                    simplifiedStatement = std::make_shared<UnaryStatement>(unaryStmt->unaryOperation, simplifiedVariableAccess);
+                }
+            } else if (const auto* const assignStmt = statementCast<AssignStatement>(statement.get()); assignStmt != nullptr) {
+                const Expression::ptr simplifiedRhs = simplifyExpression(assignStmt->rhs);
+                // Adding, subtracting or XOR-ing zero does not modify the assigned to variable.
+                if (const std::optional<unsigned> constantValueOfRhs = tryGetConstantValueOfExpression(simplifiedRhs); constantValueOfRhs.has_value() && *constantValueOfRhs == 0U) {
+                    return;
+                }
+                if (const VariableAccess::ptr simplifiedLhs = simplifyVariableAccess(assignStmt->lhs); simplifiedLhs != assignStmt->lhs || simplifiedRhs != assignStmt->rhs) {
+                    simplifiedStatement = std::make_shared<AssignStatement>(simplifiedLhs, assignStmt->assignOperation, simplifiedRhs);
+                }
+            } else if (const auto* const ifStmt = statementCast<IfStatement>(statement.get()); ifStmt != nullptr) {
+                const Expression::ptr simplifiedGuardCondition        = simplifyExpression(ifStmt->condition);
+                const Expression::ptr simplifiedClosingGuardCondition = simplifyExpression(ifStmt->fiCondition);
+
+                // The if statement can only be replaced by one of its branches if the closing guard condition, which is used as the guard condition of the inverted if statement, evaluates to the same truth value.
+                const std::optional<bool> truthValueOfGuardCondition        = tryDetermineTruthValueOfGuardCondition(simplifiedGuardCondition);
+                const std::optional<bool> truthValueOfClosingGuardCondition = tryDetermineTruthValueOfGuardCondition(simplifiedClosingGuardCondition);
+                if (truthValueOfGuardCondition.has_value() && truthValueOfGuardCondition == truthValueOfClosingGuardCondition) {
+                    simplifyStatements(*truthValueOfGuardCondition ? ifStmt->thenStatements : ifStmt->elseStatements, simplifiedStatements);
+                    return;
+                }
+
+                auto simplifiedIfStmt = std::make_shared<IfStatement>();
+                simplifiedIfStmt->setCondition(simplifiedGuardCondition);
+                simplifiedIfStmt->setFiCondition(simplifiedClosingGuardCondition);
+                simplifyStatements(ifStmt->thenStatements, simplifiedIfStmt->thenStatements);
+                simplifyStatements(ifStmt->elseStatements, simplifiedIfStmt->elseStatements);
+                if (simplifiedIfStmt->thenStatements.empty() && simplifiedIfStmt->elseStatements.empty()) {
+                    return;
+                }
+                if (simplifiedGuardCondition != ifStmt->condition || simplifiedClosingGuardCondition != ifStmt->fiCondition || simplifiedIfStmt->thenStatements != ifStmt->thenStatements || simplifiedIfStmt->elseStatements != ifStmt->elseStatements) {
+                    simplifiedStatement = simplifiedIfStmt;
+                }
+            } else if (const auto* const forStmt = statementCast<ForStatement>(statement.get()); forStmt != nullptr) {
+                const Number::ptr simplifiedStartValue = simplifyNumber(forStmt->range.first);
+                const Number::ptr simplifiedEndValue   = simplifyNumber(forStmt->range.second);
+                const Number::ptr simplifiedStepSize   = simplifyNumber(forStmt->step);
+
+                // Omitted start values and step sizes of a loop default to a value of one.
+                const std::optional<unsigned> startValue = simplifiedStartValue != nullptr ? (simplifiedStartValue->isConstant() ? std::make_optional(simplifiedStartValue->evaluate({})) : std::nullopt) : 1U;
+                const std::optional<unsigned> endValue   = simplifiedEndValue != nullptr && simplifiedEndValue->isConstant() ? std::make_optional(simplifiedEndValue->evaluate({})) : std::nullopt;
+                const std::optional<unsigned> stepSize   = simplifiedStepSize != nullptr ? (simplifiedStepSize->isConstant() ? std::make_optional(simplifiedStepSize->evaluate({})) : std::nullopt) : 1U;
+
+                const bool isNumberOfIterationsKnown = startValue.has_value() && endValue.has_value() && stepSize.has_value() && *stepSize != 0U;
+                if (isNumberOfIterationsKnown && *startValue == *endValue) {
+                    return;
+                }
+
+                // The loop variable is defined in the body of the loop while its value is only known if the loop performs a single iteration.
+                const bool              isSingleIterationLoop = isNumberOfIterationsKnown && (*startValue < *endValue ? *endValue - *startValue : *startValue - *endValue) <= *stepSize;
+                std::optional<unsigned> valueOfShadowedLoopVariable;
+                if (!forStmt->loopVariable.empty()) {
+                    if (const auto& shadowedLoopVariable = loopVariableValueLookup.find(forStmt->loopVariable); shadowedLoopVariable != loopVariableValueLookup.end()) {
+                        valueOfShadowedLoopVariable = shadowedLoopVariable->second;
+                        loopVariableValueLookup.erase(shadowedLoopVariable);
+                    }
+                    if (isSingleIterationLoop) {
+                        loopVariableValueLookup.emplace(forStmt->loopVariable, *startValue);
+                    }
+                }
+
+                Statement::vec simplifiedLoopBody;
+                simplifyStatements(forStmt->statements, simplifiedLoopBody);
+
+                if (!forStmt->loopVariable.empty()) {
+                    loopVariableValueLookup.erase(forStmt->loopVariable);
+                    if (valueOfShadowedLoopVariable.has_value()) {
+                        loopVariableValueLookup.emplace(forStmt->loopVariable, *valueOfShadowedLoopVariable);
+                    }
+                }
+
+                if (isSingleIterationLoop) {
+                    simplifiedStatements.insert(simplifiedStatements.end(), simplifiedLoopBody.cbegin(), simplifiedLoopBody.cend());
+                    return;
+                }
+                if (simplifiedLoopBody.empty()) {
+                    return;
+                }
+
+                if (simplifiedStartValue != forStmt->range.first || simplifiedEndValue != forStmt->range.second || simplifiedStepSize != forStmt->step || simplifiedLoopBody != forStmt->statements) {
+                    auto simplifiedForStmt          = std::make_shared<ForStatement>();
+                    simplifiedForStmt->loopVariable = forStmt->loopVariable;
+                    simplifiedForStmt->range        = std::make_pair(simplifiedStartValue, simplifiedEndValue);
+                    simplifiedForStmt->step         = simplifiedStepSize;
+                    simplifiedForStmt->statements   = std::move(simplifiedLoopBody);
+                    simplifiedStatement             = simplifiedForStmt;
+                }
+            } else if (const auto* const callStmt = statementCast<CallStatement>(statement.get()); callStmt != nullptr) {
+                simplifyModule(callStmt->target);
+                if (callStmt->target != nullptr && callStmt->target->statements.empty()) {
+                    return;
+                }
+            } else if (const auto* const uncallStmt = statementCast<UncallStatement>(statement.get()); uncallStmt != nullptr) {
+                simplifyModule(uncallStmt->target);
+                if (uncallStmt->target != nullptr && uncallStmt->target->statements.empty()) {
+                    return;
+                }
+            }
+
+            if (simplifiedStatement != statement) {
+                simplifiedStatement->lineNumber = statement->lineNumber;
+            }
+            simplifiedStatements.emplace_back(simplifiedStatement);
+        }
+    };
+} // namespace
+
+void syrec::simplifyProgram(Program& program, const ConfigurableOptions& settings) {
+    ProgramSimplifier programSimplifier(settings.integerConstantTruncationOperation);
+    for (const Module::ptr& module: program.modules()) {
+        programSimplifier.simplifyModule(module);
+    }
+}
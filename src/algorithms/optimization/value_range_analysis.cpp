@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/optimization/value_range_analysis.hpp"
+
+#include "core/syrec/expression.hpp"
+#include "core/syrec/number.hpp"
+#include "core/syrec/parser/utils/syrec_operation_utils.hpp"
+#include "core/syrec/variable.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+
+using namespace syrec;
+
+namespace {
+    [[nodiscard]] constexpr std::uint64_t determineMaxValueOfBitwidth(const unsigned bitwidth) noexcept {
+        return (std::uint64_t{1} << bitwidth) - 1U;
+    }
+
+    [[nodiscard]] constexpr ValueRange determineRangeOfAllValuesOfBitwidth(const unsigned bitwidth) noexcept {
+        return ValueRange{.minValue = 0, .maxValue = determineMaxValueOfBitwidth(bitwidth), .bitwidth = bitwidth};
+    }
+
+    [[nodiscard]] constexpr ValueRange determineRangeOfTruthValue(const std::optional<bool> truthValue) noexcept {
+        if (truthValue.has_value()) {
+            return ValueRange{.minValue = *truthValue ? 1U : 0U, .maxValue = *truthValue ? 1U : 0U, .bitwidth = 1U};
+        }
+        return determineRangeOfAllValuesOfBitwidth(1U);
+    }
+
+    [[nodiscard]] constexpr bool isBinaryOperationLogicalOperation(const BinaryExpression::BinaryOperation binaryOperation) noexcept {
+        return binaryOperation == BinaryExpression::BinaryOperation::LogicalAnd || binaryOperation == BinaryExpression::BinaryOperation::LogicalOr;
+    }
+
+    // See SyrecSynthesis::onExpression(const BinaryExpression&, ...).
+    [[nodiscard]] std::optional<unsigned> determineExpectedBitwidthOfOperands(const BinaryExpression& expression) {
+        if (isBinaryOperationLogicalOperation(expression.binaryOperation)) {
+            return 1U;
+        }
+
+        const bool isLhsOperandNumericExpr = expressionCast<NumericExpression>(expression.lhs.get()) != nullptr;
+        const bool isRhsOperandNumericExpr = expressionCast<NumericExpression>(expression.rhs.get()) != nullptr;
+        if (!isLhsOperandNumericExpr && isRhsOperandNumericExpr) {
+            return expression.lhs->bitwidth();
+        }
+        if (isLhsOperandNumericExpr && !isRhsOperandNumericExpr) {
+            return expression.rhs->bitwidth();
+        }
+        return std::nullopt;
+    }
+
+    [[nodiscard]] std::optional<unsigned> determineNumberOfAccessedBits(const VariableAccess& variableAccess, const Number::LoopVariableMapping& loopVariableValues) {
+        if (variableAccess.var == nullptr) {
+            return std::nullopt;
+        }
+        if (!variableAccess.range.has_value()) {
+            return variableAccess.var->bitwidth;
+        }
+
+        const std::optional<unsigned> bitrangeStart = variableAccess.range->first != nullptr ? variableAccess.range->first->tryEvaluate(loopVariableValues) : std::nullopt;
+        const std::optional<unsigned> bitrangeEnd   = variableAccess.range->second != nullptr ? variableAccess.range->second->tryEvaluate(loopVariableValues) : std::nullopt;
+        if (!bitrangeStart.has_value() || !bitrangeEnd.has_value()) {
+            return std::nullopt;
+        }
+        return std::max(*bitrangeStart, *bitrangeEnd) - std::min(*bitrangeStart, *bitrangeEnd) + 1U;
+    }
+
+    [[nodiscard]] std::optional<bool> tryDetermineTruthValueOfRelationalOperation(const BinaryExpression::BinaryOperation binaryOperation, const ValueRange& lhs, const ValueRange& rhs) {
+        switch (binaryOperation) {
+            case BinaryExpression::BinaryOperation::LessThan:
+                if (lhs.maxValue < rhs.minValue) {
+                    return true;
+                }
+                return lhs.minValue >= rhs.maxValue ? std::make_optional(false) : std::nullopt;
+            case BinaryExpression::BinaryOperation::GreaterThan:
+                return tryDetermineTruthValueOfRelationalOperation(BinaryExpression::BinaryOperation::LessThan, rhs, lhs);
+            case BinaryExpression::BinaryOperation::LessEquals:
+                if (const std::optional<bool> isGreater = tryDetermineTruthValueOfRelationalOperation(BinaryExpression::BinaryOperation::LessThan, rhs, lhs); isGreater.has_value()) {
+                    return !*isGreater;
+                }
+                return std::nullopt;
+            case BinaryExpression::BinaryOperation::GreaterEquals:
+                return tryDetermineTruthValueOfRelationalOperation(BinaryExpression::BinaryOperation::LessEquals, rhs, lhs);
+            case BinaryExpression::BinaryOperation::Equals:
+                if (lhs.isConstant() && lhs == rhs) {
+                    return true;
+                }
+                return lhs.maxValue < rhs.minValue || rhs.maxValue < lhs.minValue ? std::make_optional(false) : std::nullopt;
+            case BinaryExpression::BinaryOperation::NotEquals:
+                if (const std::optional<bool> isEqual = tryDetermineTruthValueOfRelationalOperation(BinaryExpression::BinaryOperation::Equals, lhs, rhs); isEqual.has_value()) {
+                    return !*isEqual;
+                }
+                return std::nullopt;
+            default:
+                return std::nullopt;
+        }
+    }
+
+    [[nodiscard]] ValueRange determineValueRangeOfBinaryOperation(const BinaryExpression::BinaryOperation binaryOperation, const ValueRange& lhs, const ValueRange& rhs) {
+        const unsigned      bitwidth = lhs.bitwidth;
+        const std::uint64_t maxValue = determineMaxValueOfBitwidth(bitwidth);
+        switch (binaryOperation) {
+            case BinaryExpression::BinaryOperation::Add:
+                if (lhs.maxValue + rhs.maxValue <= maxValue) {
+                    return ValueRange{.minValue = lhs.minValue + rhs.minValue, .maxValue = lhs.maxValue + rhs.maxValue, .bitwidth = bitwidth};
+                }
+                break;
+            case BinaryExpression::BinaryOperation::Subtract:
+                if (lhs.minValue >= rhs.maxValue) {
+                    return ValueRange{.minValue = lhs.minValue - rhs.maxValue, .maxValue = lhs.maxValue - rhs.minValue, .bitwidth = bitwidth};
+                }
+                break;
+            case BinaryExpression::BinaryOperation::Multiply:
+                if (lhs.maxValue * rhs.maxValue <= maxValue) {
+                    return ValueRange{.minValue = lhs.minValue * rhs.minValue, .maxValue = lhs.maxValue * rhs.maxValue, .bitwidth = bitwidth};
+                }
+                break;
+            // The result of a division by zero depends on the used divider, thus only divisors that cannot be zero are considered.
+            case BinaryExpression::BinaryOperation::Divide:
+                if (rhs.minValue > 0) {
+                    return ValueRange{.minValue = lhs.minValue / rhs.maxValue, .maxValue = lhs.maxValue / rhs.minValue, .bitwidth = bitwidth};
+                }
+                break;
+            case BinaryExpression::BinaryOperation::Modulo:
+                if (rhs.minValue > 0) {
+                    return ValueRange{.minValue = lhs.maxValue < rhs.minValue ? lhs.minValue : 0U, .maxValue = std::min(lhs.maxValue, rhs.maxValue - 1U), .bitwidth = bitwidth};
+                }
+                break;
+            case BinaryExpression::BinaryOperation::Exor:
+                return ValueRange{.minValue = 0, .maxValue = determineMaxValueOfBitwidth(std::max(lhs.getNumberOfSignificantBits(), rhs.getNumberOfSignificantBits())), .bitwidth = bitwidth};
+            case BinaryExpression::BinaryOperation::BitwiseAnd:
+                return ValueRange{.minValue = 0, .maxValue = std::min(lhs.maxValue, rhs.maxValue), .bitwidth = bitwidth};
+            case BinaryExpression::BinaryOperation::BitwiseOr:
+                return ValueRange{.minValue = std::max(lhs.minValue, rhs.minValue), .maxValue = determineMaxValueOfBitwidth(std::max(lhs.getNumberOfSignificantBits(), rhs.getNumberOfSignificantBits())), .bitwidth = bitwidth};
+            // Both operands of a logical operation are single bits.
+            case BinaryExpression::BinaryOperation::LogicalAnd:
+                return ValueRange{.minValue = lhs.minValue & rhs.minValue, .maxValue = lhs.maxValue & rhs.maxValue, .bitwidth = 1U};
+            case BinaryExpression::BinaryOperation::LogicalOr:
+                return ValueRange{.minValue = lhs.minValue | rhs.minValue, .maxValue = lhs.maxValue | rhs.maxValue, .bitwidth = 1U};
+            default:
+                return determineRangeOfTruthValue(tryDetermineTruthValueOfRelationalOperation(binaryOperation, lhs, rhs));
+        }
+        return determineRangeOfAllValuesOfBitwidth(bitwidth);
+    }
+
+    [[nodiscard]] std::optional<ValueRange> determineValueRangesOfOperands(const BinaryExpression& expression, const Number::LoopVariableMapping& loopVariableValues, const utils::IntegerConstantTruncationOperation integerConstantTruncationOperation, ValueRange& rangeOfRhsOperand) {
+        if (expression.lhs == nullptr || expression.rhs == nullptr) {
+            return std::nullopt;
+        }
+
+        const std::optional<unsigned>   expectedBitwidthOfOperands = determineExpectedBitwidthOfOperands(expression);
+        const std::optional<ValueRange> rangeOfLhsOperand          = determineValueRangeOfExpression(*expression.lhs, loopVariableValues, expectedBitwidthOfOperands, integerConstantTruncationOperation);
+        const std::optional<ValueRange> optionalRangeOfRhsOperand  = determineValueRangeOfExpression(*expression.rhs, loopVariableValues, expectedBitwidthOfOperands, integerConstantTruncationOperation);
+        if (!rangeOfLhsOperand.has_value() || !optionalRangeOfRhsOperand.has_value() || rangeOfLhsOperand->bitwidth != optionalRangeOfRhsOperand->bitwidth) {
+            return std::nullopt;
+        }
+        rangeOfRhsOperand = *optionalRangeOfRhsOperand;
+        return rangeOfLhsOperand;
+    }
+} // namespace
+
+std::optional<ValueRange> syrec::determineValueRangeOfExpression(const Expression& expression, const Number::LoopVariableMapping& loopVariableValues, const std::optional<unsigned>& expectedBitwidth, const utils::IntegerConstantTruncationOperation integerConstantTruncationOperation) {
+    if (const auto* const exprAsNumericExpr = expressionCast<NumericExpression>(&expression); exprAsNumericExpr != nullptr) {
+        const std::optional<unsigned> value = exprAsNumericExpr->value != nullptr ? exprAsNumericExpr->value->tryEvaluate(loopVariableValues) : std::nullopt;
+        if (!value.has_value()) {
+            return std::nullopt;
+        }
+        if (expectedBitwidth.has_value()) {
+            const unsigned truncatedValue = utils::truncateConstantValueToExpectedBitwidth(*value, *expectedBitwidth, integerConstantTruncationOperation);
+            return ValueRange{.minValue = truncatedValue, .maxValue = truncatedValue, .bitwidth = *expectedBitwidth};
+        }
+        return ValueRange{.minValue = *value, .maxValue = *value, .bitwidth = 32U};
+    }
+    if (const auto* const exprAsVariableExpr = expressionCast<VariableExpression>(&expression); exprAsVariableExpr != nullptr) {
+        const std::optional<unsigned> numAccessedBits = exprAsVariableExpr->var != nullptr ? determineNumberOfAccessedBits(*exprAsVariableExpr->var, loopVariableValues) : std::nullopt;
+        return numAccessedBits.has_value() ? std::make_optional(determineRangeOfAllValuesOfBitwidth(*numAccessedBits)) : std::nullopt;
+    }
+    if (const auto* const exprAsBinaryExpr = expressionCast<BinaryExpression>(&expression); exprAsBinaryExpr != nullptr) {
+        ValueRange                      rangeOfRhsOperand;
+        const std::optional<ValueRange> rangeOfLhsOperand = determineValueRangesOfOperands(*exprAsBinaryExpr, loopVariableValues, integerConstantTruncationOperation, rangeOfRhsOperand);
+        return rangeOfLhsOperand.has_value() ? std::make_optional(determineValueRangeOfBinaryOperation(exprAsBinaryExpr->binaryOperation, *rangeOfLhsOperand, rangeOfRhsOperand)) : std::nullopt;
+    }
+    if (const auto* const exprAsShiftExpr = expressionCast<ShiftExpression>(&expression); exprAsShiftExpr != nullptr) {
+        const std::optional<ValueRange> rangeOfShiftedOperand = exprAsShiftExpr->lhs != nullptr ? determineValueRangeOfExpression(*exprAsShiftExpr->lhs, loopVariableValues, std::nullopt, integerConstantTruncationOperation) : std::nullopt;
+        const std::optional<unsigned>   shiftAmount           = exprAsShiftExpr->rhs != nullptr ? exprAsShiftExpr->rhs->tryEvaluate(loopVariableValues) : std::nullopt;
+        if (!rangeOfShiftedOperand.has_value() || !shiftAmount.has_value()) {
+            return std::nullopt;
+        }
+
+        const unsigned bitwidth = rangeOfShiftedOperand->bitwidth;
+        if (*shiftAmount >= bitwidth) {
+            return ValueRange{.minValue = 0, .maxValue = 0, .bitwidth = bitwidth};
+        }
+        if (exprAsShiftExpr->shiftOperation == ShiftExpression::ShiftOperation::Right) {
+            return ValueRange{.minValue = rangeOfShiftedOperand->minValue >> *shiftAmount, .maxValue = rangeOfShiftedOperand->maxValue >> *shiftAmount, .bitwidth = bitwidth};
+        }
+        if ((rangeOfShiftedOperand->maxValue << *shiftAmount) <= determineMaxValueOfBitwidth(bitwidth)) {
+            return ValueRange{.minValue = rangeOfShiftedOperand->minValue << *shiftAmount, .maxValue = rangeOfShiftedOperand->maxValue << *shiftAmount, .bitwidth = bitwidth};
+        }
+        return determineRangeOfAllValuesOfBitwidth(bitwidth);
+    }
+    if (const auto* const exprAsUnaryExpr = expressionCast<UnaryExpression>(&expression); exprAsUnaryExpr != nullptr) {
+        const std::optional<ValueRange> rangeOfOperand = exprAsUnaryExpr->expr != nullptr ? determineValueRangeOfExpression(*exprAsUnaryExpr->expr, loopVariableValues, std::nullopt, integerConstantTruncationOperation) : std::nullopt;
+        if (!rangeOfOperand.has_value()) {
+            return std::nullopt;
+        }
+
+        const unsigned      bitwidth = exprAsUnaryExpr->unaryOperation == UnaryExpression::UnaryOperation::LogicalNegation ? 1U : rangeOfOperand->bitwidth;
+        const std::uint64_t maxValue = determineMaxValueOfBitwidth(bitwidth);
+        if (rangeOfOperand->maxValue > maxValue) {
+            return determineRangeOfAllValuesOfBitwidth(bitwidth);
+        }
+        return ValueRange{.minValue = maxValue - rangeOfOperand->maxValue, .maxValue = maxValue - rangeOfOperand->minValue, .bitwidth = bitwidth};
+    }
+    return std::nullopt;
+}
+
+std::optional<unsigned> syrec::determineNumberOfOperandBitsRequiredByBinaryOperation(const BinaryExpression& expression, const Number::LoopVariableMapping& loopVariableValues, const utils::IntegerConstantTruncationOperation integerConstantTruncationOperation) {
+    if (isBinaryOperationLogicalOperation(expression.binaryOperation)) {
+        return std::nullopt;
+    }
+
+    ValueRange                      rangeOfRhsOperand;
+    const std::optional<ValueRange> rangeOfLhsOperand = determineValueRangesOfOperands(expression, loopVariableValues, integerConstantTruncationOperation, rangeOfRhsOperand);
+    if (!rangeOfLhsOperand.has_value()) {
+        return std::nullopt;
+    }
+
+    const unsigned bitwidth                     = rangeOfLhsOperand->bitwidth;
+    const unsigned numSignificantBitsOfOperands = std::max(rangeOfLhsOperand->getNumberOfSignificantBits(), rangeOfRhsOperand.getNumberOfSignificantBits());
+    const auto     rangeOfResult                = determineValueRangeOfBinaryOperation(expression.binaryOperation, *rangeOfLhsOperand, rangeOfRhsOperand);
+
+    std::optional<unsigned> numRequiredBits;
+    switch (expression.binaryOperation) {
+        // The result of these operations can only wrap around if its range covers all values of its bitwidth, otherwise the result and both operands fit into the significant bits of the result and the operands.
+        case BinaryExpression::BinaryOperation::Add:
+        case BinaryExpression::BinaryOperation::Subtract:
+        case BinaryExpression::BinaryOperation::Multiply:
+            if (rangeOfResult.maxValue < determineMaxValueOfBitwidth(bitwidth)) {
+                numRequiredBits = std::max(numSignificantBitsOfOperands, rangeOfResult.getNumberOfSignificantBits());
+            }
+            break;
+        case BinaryExpression::BinaryOperation::Divide:
+        case BinaryExpression::BinaryOperation::Modulo:
+            if (rangeOfRhsOperand.minValue > 0) {
+                numRequiredBits = numSignificantBitsOfOperands;
+            }
+            break;
+        // A bit of the result of a bitwise AND is zero if the bit of one of its operands is zero.
+        case BinaryExpression::BinaryOperation::BitwiseAnd:
+            numRequiredBits = std::min(rangeOfLhsOperand->getNumberOfSignificantBits(), rangeOfRhsOperand.getNumberOfSignificantBits());
+            break;
+        default:
+            numRequiredBits = numSignificantBitsOfOperands;
+            break;
+    }
+
+    if (!numRequiredBits.has_value() || *numRequiredBits == 0 || *numRequiredBits >= bitwidth) {
+        return std::nullopt;
+    }
+    return numRequiredBits;
+}
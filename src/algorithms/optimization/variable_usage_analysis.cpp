@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/optimization/variable_usage_analysis.hpp"
+
+#include "core/syrec/expression.hpp"
+#include "core/syrec/number.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+
+#include <string>
+
+using namespace syrec;
+
+bool UsagesOfStatements::dependsOn(const UsagesOfStatements& other) const {
+    for (const auto& [variableIdentifier, usage]: variables) {
+        if (const auto& usageInOther = other.variables.find(variableIdentifier); usageInOther != other.variables.end() && (usage.isModified || usageInOther->second.isModified)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void syrec::collectUsagesOfNumber(const Number::ptr& number, UsagesOfStatements& usages) {
+    if (number == nullptr) {
+        return;
+    }
+    if (number->isLoopVariable()) {
+        usages.usedLoopVariables.emplace(number->variableName());
+    } else if (number->isConstantExpression()) {
+        const Number::ConstantExpression constantExpression = *number->constantExpression();
+        collectUsagesOfNumber(constantExpression.lhsOperand, usages);
+        collectUsagesOfNumber(constantExpression.rhsOperand, usages);
+    }
+}
+
+void syrec::collectUsagesOfVariableAccess(const VariableAccess::ptr& variableAccess, const bool isModified, UsagesOfStatements& usages) {
+    if (variableAccess == nullptr || variableAccess->var == nullptr) {
+        return;
+    }
+    VariableUsage& usage = usages.variables[variableAccess->var->name];
+    usage.isModified |= isModified;
+    usage.accesses.emplace_back(variableAccess.get());
+
+    if (variableAccess->range.has_value()) {
+        collectUsagesOfNumber(variableAccess->range->first, usages);
+        collectUsagesOfNumber(variableAccess->range->second, usages);
+    }
+    for (const Expression::ptr& index: variableAccess->indexes) {
+        collectUsagesOfExpression(index, usages);
+    }
+}
+
+void syrec::collectUsagesOfExpression(const Expression::ptr& expression, UsagesOfStatements& usages) {
+    if (const auto* const exprAsNumericExpr = expressionCast<NumericExpression>(expression.get()); exprAsNumericExpr != nullptr) {
+        collectUsagesOfNumber(exprAsNumericExpr->value, usages);
+    } else if (const auto* const exprAsVariableExpr = expressionCast<VariableExpression>(expression.get()); exprAsVariableExpr != nullptr) {
+        collectUsagesOfVariableAccess(exprAsVariableExpr->var, false, usages);
+    } else if (const auto* const exprAsBinaryExpr = expressionCast<BinaryExpression>(expression.get()); exprAsBinaryExpr != nullptr) {
+        collectUsagesOfExpression(exprAsBinaryExpr->lhs, usages);
+        collectUsagesOfExpression(exprAsBinaryExpr->rhs, usages);
+    } else if (const auto* const exprAsShiftExpr = expressionCast<ShiftExpression>(expression.get()); exprAsShiftExpr != nullptr) {
+        collectUsagesOfExpression(exprAsShiftExpr->lhs, usages);
+        collectUsagesOfNumber(exprAsShiftExpr->rhs, usages);
+    } else if (const auto* const exprAsUnaryExpr = expressionCast<UnaryExpression>(expression.get()); exprAsUnaryExpr != nullptr) {
+        collectUsagesOfExpression(exprAsUnaryExpr->expr, usages);
+    }
+}
+
+void syrec::collectUsagesOfStatements(const Statement::vec& statements, UsagesOfStatements& usages) {
+    for (const Statement::ptr& statement: statements) {
+        if (const auto* const swapStmt = statementCast<SwapStatement>(statement.get()); swapStmt != nullptr) {
+            collectUsagesOfVariableAccess(swapStmt->lhs, true, usages);
+            collectUsagesOfVariableAccess(swapStmt->rhs, true, usages);
+        } else if (const auto* const unaryStmt = statementCast<UnaryStatement>(statement.get()); unaryStmt != nullptr) {
+            collectUsagesOfVariableAccess(unaryStmt->var, true, usages);
+        } else if (const auto* const assignStmt = statementCast<AssignStatement>(statement.get()); assignStmt != nullptr) {
+            collectUsagesOfVariableAccess(assignStmt->lhs, true, usages);
+            collectUsagesOfExpression(assignStmt->rhs, usages);
+        } else if (const auto* const ifStmt = statementCast<IfStatement>(statement.get()); ifStmt != nullptr) {
+            collectUsagesOfExpression(ifStmt->condition, usages);
+            collectUsagesOfExpression(ifStmt->fiCondition, usages);
+            collectUsagesOfStatements(ifStmt->thenStatements, usages);
+            collectUsagesOfStatements(ifStmt->elseStatements, usages);
+        } else if (const auto* const forStmt = statementCast<ForStatement>(statement.get()); forStmt != nullptr) {
+            if (!forStmt->loopVariable.empty()) {
+                usages.declaredLoopVariables.emplace(forStmt->loopVariable);
+            }
+            collectUsagesOfNumber(forStmt->range.first, usages);
+            collectUsagesOfNumber(forStmt->range.second, usages);
+            collectUsagesOfNumber(forStmt->step, usages);
+            collectUsagesOfStatements(forStmt->statements, usages);
+        } else {
+            // The called module can modify any element of the variables passed as its parameters.
+            const auto* const callStmt   = statementCast<CallStatement>(statement.get());
+            const auto* const uncallStmt = statementCast<UncallStatement>(statement.get());
+            if (callStmt == nullptr && uncallStmt == nullptr) {
+                continue;
+            }
+            for (const std::string& parameter: callStmt != nullptr ? callStmt->parameters : uncallStmt->parameters) {
+                VariableUsage& usage   = usages.variables[parameter];
+                usage.isModified       = true;
+                usage.isPassedToModule = true;
+            }
+        }
+    }
+}
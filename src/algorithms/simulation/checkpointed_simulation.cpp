@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/checkpointed_simulation.hpp"
+
+#include "algorithms/simulation/simple_simulation.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/diagnostics.hpp"
+#include "core/n_bit_values_container.hpp"
+#include "core/statistics.hpp"
+#include "ir/operations/Operation.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    //Prefer the usage of std::chrono::steady_clock instead of std::chrono::system_clock since the former cannot decrease (due to time zone changes, etc.) and is most suitable for measuring intervals according to (https://en.cppreference.com/w/cpp/chrono/steady_clock)
+    using TimeStamp = std::chrono::time_point<std::chrono::steady_clock>;
+
+    [[nodiscard]] std::size_t determineDistance(const std::size_t lhs, const std::size_t rhs) noexcept {
+        return lhs > rhs ? lhs - rhs : rhs - lhs;
+    }
+} // namespace
+
+bool CheckpointedSimulation::simulate(const AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<NBitValuesContainer>& inputs, const CheckpointedSimulationSettings& settings, Statistics* optionalRecordedStatistics) {
+    reset();
+    if (annotatableQuantumComputation.getNumForwardedQuantumOperations() != 0) {
+        getErrorStream() << "Cannot simulate quantum computation whose first " << std::to_string(annotatableQuantumComputation.getNumForwardedQuantumOperations()) << " quantum operations were forwarded to a quantum operation sink\n";
+        return false;
+    }
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+        if (inputs[i].size() != annotatableQuantumComputation.getNqubits()) {
+            getErrorStream() << "Input state " << std::to_string(i) << " size (" << inputs[i].size() << ") must match number of qubits in the quantum computation (" << annotatableQuantumComputation.getNqubits() << ")\n";
+            return false;
+        }
+    }
+
+    const TimeStamp simulationStartTime = std::chrono::steady_clock::now();
+
+    numQubits                = annotatableQuantumComputation.getNqubits();
+    numInputs                = inputs.size();
+    numStatementsPerSnapshot = settings.numStatementsPerSnapshot;
+
+    const std::size_t numBlocks = (numInputs + BATCH_SIMULATION_LANE_COUNT - 1U) / BATCH_SIMULATION_LANE_COUNT;
+    currentLaneValues.assign(numBlocks * numQubits, 0U);
+    for (std::size_t i = 0; i < numInputs; ++i) {
+        const std::size_t lane              = i % BATCH_SIMULATION_LANE_COUNT;
+        std::uint64_t*    laneValuesOfBlock = currentLaneValues.data() + ((i / BATCH_SIMULATION_LANE_COUNT) * numQubits);
+        for (std::size_t qubit = 0; qubit < numQubits; ++qubit) {
+            laneValuesOfBlock[qubit] |= static_cast<std::uint64_t>(inputs[i].testUnchecked(qubit)) << lane;
+        }
+    }
+
+    for (std::size_t i = 0; i < annotatableQuantumComputation.getNops(); ++i) {
+        const std::optional<unsigned> statementLineNumber = annotatableQuantumComputation.getStatementLineNumberOfQuantumOperation(i);
+        if (statements.empty() || statements.back().statementLineNumber != statementLineNumber) {
+            statements.emplace_back(Statement{.statementLineNumber = statementLineNumber, .quantumOperations = AnnotatableQuantumComputation::QuantumOperationIndexRange{.indexOfFirstQuantumOperation = i, .numQuantumOperations = 0}});
+        }
+        ++statements.back().quantumOperations.numQuantumOperations;
+    }
+
+    snapshots.emplace_back(currentLaneValues);
+    firstDifferenceOfStatement.reserve(statements.size() + 1U);
+    firstDifferenceOfStatement.emplace_back(0U);
+
+    // Only the lanes of the qubits changed by a statement are recorded which, for a statement operating on a small subset of the qubits, is significantly smaller than a snapshot of all lanes.
+    std::vector<std::uint64_t> laneValuesPerQubit(numQubits, 0U);
+    for (std::size_t indexOfStatement = 0; indexOfStatement < statements.size(); ++indexOfStatement) {
+        const AnnotatableQuantumComputation::QuantumOperationIndexRange& quantumOperations = statements[indexOfStatement].quantumOperations;
+        for (std::size_t block = 0; block < numBlocks; ++block) {
+            const std::size_t indexOfFirstWordOfBlock = block * numQubits;
+            std::copy_n(currentLaneValues.cbegin() + static_cast<std::ptrdiff_t>(indexOfFirstWordOfBlock), numQubits, laneValuesPerQubit.begin());
+
+            for (std::size_t i = quantumOperations.indexOfFirstQuantumOperation; i < quantumOperations.indexOfFirstQuantumOperation + quantumOperations.numQuantumOperations; ++i) {
+                const qc::Operation* quantumOperation = annotatableQuantumComputation.getQuantumOperation(i);
+                if (quantumOperation == nullptr) {
+                    getErrorStream() << "Operation " << std::to_string(i) << " in quantum computation was NULL!\n";
+                    reset();
+                    return false;
+                }
+                if (!coreOperationBatchSimulation(*quantumOperation, laneValuesPerQubit)) {
+                    reset();
+                    return false;
+                }
+            }
+
+            for (std::size_t qubit = 0; qubit < numQubits; ++qubit) {
+                if (const std::uint64_t flippedLanes = laneValuesPerQubit[qubit] ^ currentLaneValues[indexOfFirstWordOfBlock + qubit]; flippedLanes != 0U) {
+                    differences.emplace_back(LaneDifference{.indexOfWord = indexOfFirstWordOfBlock + qubit, .flippedLanes = flippedLanes});
+                    currentLaneValues[indexOfFirstWordOfBlock + qubit] = laneValuesPerQubit[qubit];
+                }
+            }
+        }
+        firstDifferenceOfStatement.emplace_back(differences.size());
+
+        if (numStatementsPerSnapshot != 0 && (indexOfStatement + 1U) % numStatementsPerSnapshot == 0) {
+            snapshots.emplace_back(currentLaneValues);
+        }
+    }
+    currentLaneValues = snapshots.front();
+
+    const TimeStamp simulationEndTime = std::chrono::steady_clock::now();
+    if (optionalRecordedStatistics != nullptr) {
+        optionalRecordedStatistics->recordRuntime(simulationEndTime - simulationStartTime);
+    }
+    return true;
+}
+
+bool CheckpointedSimulation::stepForward() {
+    if (numSimulatedStatements >= statements.size()) {
+        return false;
+    }
+    applyDifferencesOfStatement(numSimulatedStatements);
+    ++numSimulatedStatements;
+    return true;
+}
+
+bool CheckpointedSimulation::stepBackward() {
+    if (numSimulatedStatements == 0) {
+        return false;
+    }
+    --numSimulatedStatements;
+    applyDifferencesOfStatement(numSimulatedStatements);
+    return true;
+}
+
+bool CheckpointedSimulation::seek(const std::size_t numStatements) {
+    if (numStatements > statements.size()) {
+        return false;
+    }
+
+    // The snapshot nearest to the requested statement is only restored if fewer statements need to be stepped from it than from the current states.
+    if (!snapshots.empty()) {
+        const std::size_t indexOfSnapshot    = numStatementsPerSnapshot != 0 ? std::min((numStatements + (numStatementsPerSnapshot / 2U)) / numStatementsPerSnapshot, snapshots.size() - 1U) : 0U;
+        const std::size_t positionOfSnapshot = indexOfSnapshot * numStatementsPerSnapshot;
+        if (determineDistance(positionOfSnapshot, numStatements) < determineDistance(numSimulatedStatements, numStatements)) {
+            currentLaneValues      = snapshots[indexOfSnapshot];
+            numSimulatedStatements = positionOfSnapshot;
+        }
+    }
+
+    while (numSimulatedStatements < numStatements) {
+        applyDifferencesOfStatement(numSimulatedStatements);
+        ++numSimulatedStatements;
+    }
+    while (numSimulatedStatements > numStatements) {
+        --numSimulatedStatements;
+        applyDifferencesOfStatement(numSimulatedStatements);
+    }
+    return true;
+}
+
+std::optional<NBitValuesContainer> CheckpointedSimulation::getState(const std::size_t indexOfInput) const {
+    if (indexOfInput >= numInputs) {
+        return std::nullopt;
+    }
+
+    const std::size_t    lane              = indexOfInput % BATCH_SIMULATION_LANE_COUNT;
+    const std::uint64_t* laneValuesOfBlock = currentLaneValues.data() + ((indexOfInput / BATCH_SIMULATION_LANE_COUNT) * numQubits);
+    NBitValuesContainer  state(numQubits);
+    for (std::size_t qubit = 0; qubit < numQubits; ++qubit) {
+        state.setUnchecked(qubit, ((laneValuesOfBlock[qubit] >> lane) & 1U) != 0U);
+    }
+    return state;
+}
+
+// BEGIN NON-PUBLIC FUNCTIONALITY
+void CheckpointedSimulation::reset() {
+    numQubits                = 0;
+    numInputs                = 0;
+    numSimulatedStatements   = 0;
+    numStatementsPerSnapshot = 0;
+    statements.clear();
+    currentLaneValues.clear();
+    snapshots.clear();
+    differences.clear();
+    firstDifferenceOfStatement.clear();
+}
+
+void CheckpointedSimulation::applyDifferencesOfStatement(const std::size_t indexOfStatement) {
+    // Since the differences store the flipped lanes, applying them reverts the quantum operations of the statement if they were already applied.
+    for (std::size_t i = firstDifferenceOfStatement[indexOfStatement]; i < firstDifferenceOfStatement[indexOfStatement + 1U]; ++i) {
+        currentLaneValues[differences[i].indexOfWord] ^= differences[i].flippedLanes;
+    }
+}
@@ -10,56 +10,330 @@
 
 #include "algorithms/simulation/circuit_to_truthtable.hpp"
 
+#include "algorithms/simulation/simple_simulation.hpp"
+#include "algorithms/simulation/simulation_program.hpp"
+#include "algorithms/synthesis/dd_package_settings.hpp"
+#include "core/execution_limits.hpp"
+#include "core/executor.hpp"
 #include "core/truthTable/truth_table.hpp"
+#include "dd/DDDefinitions.hpp"
+#include "dd/FunctionalityConstruction.hpp"
+#include "dd/Node.hpp"
 #include "dd/Package.hpp"
 #include "dd/Simulation.hpp"
 #include "dd/StateGeneration.hpp"
+#include "ir/Permutation.hpp"
 #include "ir/QuantumComputation.hpp"
 
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
 
 namespace syrec {
 
-    auto buildTruthTable(const qc::QuantumComputation& qc, TruthTable& tt) -> void {
+    namespace {
+        using TruthTableEntries = std::vector<std::pair<TruthTable::Cube, TruthTable::Cube>>;
+
+        // the number of inputs simulated by every thread before the entries of all threads are written by the streaming PLA writer
+        constexpr std::uint64_t NUM_STREAMED_INPUTS_PER_THREAD_AND_BLOCK = static_cast<std::uint64_t>(BATCH_SIMULATION_LANE_COUNT) * 64U;
+
+        auto isIdentityPermutation(const qc::Permutation& permutation) -> bool {
+            return std::ranges::all_of(permutation, [](const auto& mapping) { return mapping.first == mapping.second; });
+        }
+
+        /**
+         * Scatter the lowest bits of @p value into the set bit positions of @p mask (starting with the least significant one) with all other bits of the result being zero.
+         * Equivalent to the PDEP instruction of the BMI2 instruction set. Since the scatter is monotone in @p value, enumerating the values in ascending order will also enumerate the results in ascending order.
+         */
+        auto scatterBitsIntoMask(std::uint64_t value, std::uint64_t mask) -> std::uint64_t {
+#if defined(__BMI2__)
+            return _pdep_u64(value, mask);
+#else
+            std::uint64_t result = 0U;
+            for (; mask != 0U && value != 0U; mask &= mask - 1U, value >>= 1U) {
+                if ((value & 1U) != 0U) {
+                    result |= mask & (~mask + 1U);
+                }
+            }
+            return result;
+#endif
+        }
+
+        auto isAnyExecutionLimitViolated(ExecutionLimitsMonitor* optionalExecutionLimitsMonitor) -> bool {
+            return optionalExecutionLimitsMonitor != nullptr && optionalExecutionLimitsMonitor->isAnyLimitViolated();
+        }
+
+        auto extractEntriesUsingDdSimulation(const qc::QuantumComputation& qc, const std::size_t nBits, const std::uint64_t nonConstantLinesMask, const std::uint64_t firstAssignment, const std::uint64_t lastAssignment, const DDPackageSettings& ddPackageSettings, TruthTableEntries& entries, ExecutionLimitsMonitor* optionalExecutionLimitsMonitor) -> bool {
+            // The DD package is not thread-safe, thus every thread requires its own instance
+            auto dd = createDDPackage(nBits, ddPackageSettings);
+            entries.reserve(static_cast<std::size_t>(lastAssignment - firstAssignment));
+            for (std::uint64_t assignment = firstAssignment; assignment < lastAssignment; ++assignment) {
+                // The execution limits are checked once per batch of inputs of the same size as the one of the classical simulation
+                if ((assignment - firstAssignment) % BATCH_SIMULATION_LANE_COUNT == 0U && isAnyExecutionLimitViolated(optionalExecutionLimitsMonitor)) {
+                    return false;
+                }
+                auto       inCube    = TruthTable::Cube::fromInteger(scatterBitsIntoMask(assignment, nonConstantLinesMask), nBits);
+                auto const inEdge    = dd::makeBasisState(nBits, inCube.toBoolVec(), *dd);
+                const auto out       = dd::sample(qc, inEdge, *dd, 1);
+                const auto outString = out.begin()->first;
+                entries.emplace_back(std::move(inCube), TruthTable::Cube::fromString(outString));
+            }
+            return true;
+        }
+
+        /**
+         * Extract the entries of all inputs sharing the (already processed) values of the qubits [numRemainingQubits, nBits) by following their paths through the
+         * matrix DD of the functionality of the circuit, in which the successor (2 * row + column) of a node maps the column value of its qubit to the row value.
+         * An edge skipping the level of a qubit (e.g. a terminal edge above level 0) represents the identity on the skipped qubits.
+         *
+         * @return Whether every input is mapped to a basis state, i.e. whether exactly one of the two successors matching the input value of every visited node is non-zero.
+         */
+        auto extractEntriesFromFunctionality(const dd::mEdge& edge, const std::size_t nBits, const std::size_t numRemainingQubits, const std::uint64_t nonConstantLinesMask, const std::uint64_t input, const std::uint64_t output, TruthTableEntries& entries) -> bool {
+            if (numRemainingQubits == 0U) {
+                entries.emplace_back(TruthTable::Cube::fromInteger(input, nBits), TruthTable::Cube::fromInteger(output, nBits));
+                return true;
+            }
+
+            const auto          qubit           = numRemainingQubits - 1U;
+            const std::uint64_t qubitMask       = static_cast<std::uint64_t>(1U) << qubit;
+            const bool          isIdentityLevel = edge.isTerminal() || static_cast<std::size_t>(edge.p->v) < qubit;
+            // the constant lines are only enumerated with the value zero
+            const std::size_t maxInputValue = (nonConstantLinesMask & qubitMask) != 0U ? 1U : 0U;
+            for (std::size_t inputValue = 0U; inputValue <= maxInputValue; ++inputValue) {
+                const auto nextInput = inputValue != 0U ? input | qubitMask : input;
+                if (isIdentityLevel) {
+                    if (!extractEntriesFromFunctionality(edge, nBits, qubit, nonConstantLinesMask, nextInput, inputValue != 0U ? output | qubitMask : output, entries)) {
+                        return false;
+                    }
+                    continue;
+                }
+
+                const auto& successorWithRowZero = edge.p->e.at(inputValue);
+                const auto& successorWithRowOne  = edge.p->e.at(2U + inputValue);
+                const bool  isRowZeroReachable   = !successorWithRowZero.w.approximatelyZero();
+                const bool  isRowOneReachable    = !successorWithRowOne.w.approximatelyZero();
+                if (isRowZeroReachable == isRowOneReachable) {
+                    return false;
+                }
+                if (!extractEntriesFromFunctionality(isRowOneReachable ? successorWithRowOne : successorWithRowZero, nBits, qubit, nonConstantLinesMask, nextInput, isRowOneReachable ? output | qubitMask : output, entries)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        auto extractEntriesUsingFunctionalityDd(const qc::QuantumComputation& qc, const std::size_t nBits, const std::uint64_t nonConstantLinesMask, const DDPackageSettings& ddPackageSettings, TruthTableEntries& entries) -> bool {
+            if (!std::ranges::all_of(qc, [](const auto& operation) { return operation->isUnitary(); })) {
+                return false;
+            }
+            auto       dd            = createDDPackage(nBits, ddPackageSettings);
+            const auto functionality = dd::buildFunctionality(qc, *dd);
+            entries.reserve(static_cast<std::size_t>(static_cast<std::uint64_t>(1U) << std::popcount(nonConstantLinesMask)));
+            if (!extractEntriesFromFunctionality(functionality, nBits, nBits, nonConstantLinesMask, 0U, 0U, entries)) {
+                entries.clear();
+                return false;
+            }
+            return true;
+        }
+
+        auto extractEntriesUsingClassicalSimulation(const SimulationProgram& simulationProgram, const std::size_t nBits, const std::uint64_t nonConstantLinesMask, const std::uint64_t firstAssignment, const std::uint64_t lastAssignment, TruthTableEntries& entries, ExecutionLimitsMonitor* optionalExecutionLimitsMonitor) -> bool {
+            std::vector<std::uint64_t>                             laneValuesPerQubit(nBits, 0U);
+            std::array<std::uint64_t, BATCH_SIMULATION_LANE_COUNT> inputsOfLanes{};
+            entries.reserve(static_cast<std::size_t>(lastAssignment - firstAssignment));
+
+            for (std::uint64_t assignment = firstAssignment; assignment < lastAssignment;) {
+                if (isAnyExecutionLimitViolated(optionalExecutionLimitsMonitor)) {
+                    return false;
+                }
+                std::ranges::fill(laneValuesPerQubit, 0U);
+                std::size_t numUsedLanes = 0;
+                for (; assignment < lastAssignment && numUsedLanes < BATCH_SIMULATION_LANE_COUNT; ++assignment) {
+                    const std::uint64_t input = scatterBitsIntoMask(assignment, nonConstantLinesMask);
+                    for (std::size_t qubit = 0; qubit < nBits; ++qubit) {
+                        laneValuesPerQubit[qubit] |= ((input >> qubit) & 1U) << numUsedLanes;
+                    }
+                    inputsOfLanes[numUsedLanes++] = input;
+                }
+
+                [[maybe_unused]] const bool simulationOk = simulationProgram.simulate(laneValuesPerQubit);
+                assert(simulationOk);
+
+                for (std::size_t lane = 0; lane < numUsedLanes; ++lane) {
+                    std::uint64_t out = 0U;
+                    for (std::size_t qubit = 0; qubit < nBits; ++qubit) {
+                        out |= ((laneValuesPerQubit[qubit] >> lane) & 1U) << qubit;
+                    }
+                    entries.emplace_back(TruthTable::Cube::fromInteger(inputsOfLanes[lane], nBits), TruthTable::Cube::fromInteger(out, nBits));
+                }
+            }
+            return true;
+        }
+
+        auto extractEntries(const qc::QuantumComputation& qc, const std::optional<SimulationProgram>& simulationProgram, const std::size_t nBits, const std::uint64_t nonConstantLinesMask, const std::uint64_t firstAssignment, const std::uint64_t lastAssignment, const DDPackageSettings& ddPackageSettings, TruthTableEntries& entries, ExecutionLimitsMonitor* optionalExecutionLimitsMonitor) -> bool {
+            if (simulationProgram.has_value()) {
+                return extractEntriesUsingClassicalSimulation(*simulationProgram, nBits, nonConstantLinesMask, firstAssignment, lastAssignment, entries, optionalExecutionLimitsMonitor);
+            }
+            return extractEntriesUsingDdSimulation(qc, nBits, nonConstantLinesMask, firstAssignment, lastAssignment, ddPackageSettings, entries, optionalExecutionLimitsMonitor);
+        }
+
+        // The classical simulation does not consider the initial layout or output permutation of the quantum computation, thus it is only used if both are the identity
+        auto compileSimulationProgramIfApplicable(const qc::QuantumComputation& qc, const TruthTableExtractionSettings& settings) -> std::optional<SimulationProgram> {
+            if (settings.useClassicalSimulationForPermutationCircuits && isIdentityPermutation(qc.initialLayout) && isIdentityPermutation(qc.outputPermutation)) {
+                return SimulationProgram::compile(qc);
+            }
+            return std::nullopt;
+        }
+
+        // appends a PLA row consisting of the values of the given qubits of the input followed by the ones of the output (with the qubits being ordered from the most to the least significant one)
+        void appendPlaRow(std::string& rows, const std::uint64_t input, const std::uint64_t output, const std::vector<std::size_t>& primaryInputQubits, const std::vector<std::size_t>& primaryOutputQubits) {
+            for (const auto qubit: primaryInputQubits) {
+                rows.push_back(((input >> qubit) & 1U) != 0U ? '1' : '0');
+            }
+            rows.push_back(' ');
+            for (const auto qubit: primaryOutputQubits) {
+                rows.push_back(((output >> qubit) & 1U) != 0U ? '1' : '0');
+            }
+            rows.push_back('\n');
+        }
+    } // namespace
+
+    auto buildTruthTable(const qc::QuantumComputation& qc, TruthTable& tt, const TruthTableExtractionSettings& settings) -> bool {
         const auto nBits = qc.getNqubits();
 
         tt.setConstants(qc.getAncillary());
         tt.setGarbage(qc.getGarbage());
 
-        assert(nBits < 65U);
+        assert(nBits < 64U);
 
-        auto dd = std::make_unique<dd::Package>(nBits);
+        // Only the assignments of the non-constant lines are enumerated since the constant lines are required to be zero in any input
+        std::uint64_t nonConstantLinesMask = 0U;
+        for (auto i = 0U; i < nBits; i++) {
+            if (!tt.isConstant(i)) {
+                nonConstantLinesMask |= static_cast<std::uint64_t>(1U) << i;
+            }
+        }
 
-        const auto totalInputs = 1U << nBits;
+        const std::optional<SimulationProgram> simulationProgram = compileSimulationProgramIfApplicable(qc, settings);
 
-        std::uint64_t n = 0U;
+        // The monitor is shared by all threads extracting the entries, thus a violation detected by any thread stops all of them
+        std::optional<ExecutionLimitsMonitor> executionLimitsMonitor;
+        if (settings.executionLimits.isAnyLimitDefined()) {
+            executionLimitsMonitor.emplace(settings.executionLimits);
+        }
+        ExecutionLimitsMonitor* optionalExecutionLimitsMonitor = executionLimitsMonitor.has_value() ? &*executionLimitsMonitor : nullptr;
 
-        while (n < totalInputs) {
-            const auto inCube = TruthTable::Cube::fromInteger(n, nBits);
-            ++n;
+        const std::uint64_t totalInputs = static_cast<std::uint64_t>(1U) << std::popcount(nonConstantLinesMask);
+        if (TruthTableEntries entries; !simulationProgram.has_value() && settings.useFunctionalityDd && extractEntriesUsingFunctionalityDd(qc, nBits, nonConstantLinesMask, settings.ddPackageSettings, entries)) {
+            // The extraction from the functionality is not interruptible, thus its limits are only checked once it was completed
+            if (isAnyExecutionLimitViolated(optionalExecutionLimitsMonitor)) {
+                return false;
+            }
+            for (auto& [inCube, outCube]: entries) {
+                tt.try_emplace(std::move(inCube), std::move(outCube));
+            }
+            tt.useDenseStorageIfComplete();
+            return true;
+        }
 
-            const auto boolCube  = inCube.toBoolVec();
-            bool       nextInput = false;
+        std::size_t         numThreads  = Executor::determineNumThreads(settings.numThreads);
+        numThreads                      = static_cast<std::size_t>(std::min<std::uint64_t>(numThreads, totalInputs));
 
-            for (auto i = 0U; i < nBits; i++) {
-                if (tt.isConstant(i) && (boolCube[i])) {
-                    nextInput = true;
-                    break;
-                }
+        std::vector<TruthTableEntries> entriesPerThread(numThreads);
+        const std::uint64_t            numInputsPerThread = (totalInputs + numThreads - 1U) / numThreads;
+        Executor::getShared().parallelFor(numThreads, [&](const std::size_t i) {
+            const std::uint64_t firstAssignment = std::min(totalInputs, i * numInputsPerThread);
+            const std::uint64_t lastAssignment  = std::min(totalInputs, firstAssignment + numInputsPerThread);
+            static_cast<void>(extractEntries(qc, simulationProgram, nBits, nonConstantLinesMask, firstAssignment, lastAssignment, settings.ddPackageSettings, entriesPerThread[i], optionalExecutionLimitsMonitor));
+        }, numThreads);
+
+        // No entries are added to the truth table if the extraction was stopped by any thread
+        if (executionLimitsMonitor.has_value() && executionLimitsMonitor->getViolation() != ExecutionLimitViolation::None) {
+            return false;
+        }
+
+        for (auto& entries: entriesPerThread) {
+            for (auto& [inCube, outCube]: entries) {
+                tt.try_emplace(std::move(inCube), std::move(outCube));
             }
+        }
+        // a circuit without constant lines yields a complete truth table
+        tt.useDenseStorageIfComplete();
+        return true;
+    }
 
-            if (nextInput) {
-                continue;
+    auto writeTruthTableAsPla(const qc::QuantumComputation& qc, std::ostream& outputStream, const TruthTableExtractionSettings& settings) -> bool {
+        const auto nBits = qc.getNqubits();
+        assert(nBits < 64U);
+
+        // The lines are written from the most to the least significant qubit, i.e. in the order of the positions of the cubes of buildTruthTable(...)
+        std::uint64_t            nonConstantLinesMask = 0U;
+        std::vector<std::size_t> primaryInputQubits;
+        std::vector<std::size_t> primaryOutputQubits;
+        for (std::size_t qubit = nBits; qubit-- > 0U;) {
+            if (!qc.logicalQubitIsAncillary(static_cast<qc::Qubit>(qubit))) {
+                nonConstantLinesMask |= static_cast<std::uint64_t>(1U) << qubit;
+                primaryInputQubits.emplace_back(qubit);
             }
+            if (!qc.logicalQubitIsGarbage(static_cast<qc::Qubit>(qubit))) {
+                primaryOutputQubits.emplace_back(qubit);
+            }
+        }
 
-            auto const inEdge    = dd::makeBasisState(nBits, boolCube, *dd);
-            const auto out       = dd::sample(qc, inEdge, *dd, 1);
-            const auto outString = out.begin()->first;
+        const std::optional<SimulationProgram> simulationProgram = compileSimulationProgramIfApplicable(qc, settings);
 
-            tt.try_emplace(inCube, TruthTable::Cube::fromString(outString));
+        std::optional<ExecutionLimitsMonitor> executionLimitsMonitor;
+        if (settings.executionLimits.isAnyLimitDefined()) {
+            executionLimitsMonitor.emplace(settings.executionLimits);
+        }
+        ExecutionLimitsMonitor* optionalExecutionLimitsMonitor = executionLimitsMonitor.has_value() ? &*executionLimitsMonitor : nullptr;
+
+        const std::uint64_t totalInputs = static_cast<std::uint64_t>(1U) << std::popcount(nonConstantLinesMask);
+        outputStream << ".i " << primaryInputQubits.size() << "\n.o " << primaryOutputQubits.size() << "\n.p " << totalInputs << '\n';
+
+        // The inputs are processed in blocks whose entries are formatted into one buffer per thread, with the buffers being written in the order of the inputs before the next block is processed.
+        // The entries and buffers are reused by all blocks, thus the memory consumption only depends on the size of a block but not on the number of inputs.
+        const std::size_t              numThreads         = static_cast<std::size_t>(std::min<std::uint64_t>(Executor::determineNumThreads(settings.numThreads), totalInputs));
+        const std::uint64_t            numInputsPerThread = NUM_STREAMED_INPUTS_PER_THREAD_AND_BLOCK;
+        std::vector<TruthTableEntries> entriesPerThread(numThreads);
+        std::vector<std::string>       rowsPerThread(numThreads);
+        for (std::uint64_t firstAssignmentOfBlock = 0U; firstAssignmentOfBlock < totalInputs && outputStream.good(); firstAssignmentOfBlock += numThreads * numInputsPerThread) {
+            Executor::getShared().parallelFor(numThreads, [&](const std::size_t i) {
+                const std::uint64_t firstAssignment = std::min(totalInputs, firstAssignmentOfBlock + (i * numInputsPerThread));
+                const std::uint64_t lastAssignment  = std::min(totalInputs, firstAssignment + numInputsPerThread);
+                entriesPerThread[i].clear();
+                rowsPerThread[i].clear();
+                if (!extractEntries(qc, simulationProgram, nBits, nonConstantLinesMask, firstAssignment, lastAssignment, settings.ddPackageSettings, entriesPerThread[i], optionalExecutionLimitsMonitor)) {
+                    return;
+                }
+                for (const auto& [inCube, outCube]: entriesPerThread[i]) {
+                    appendPlaRow(rowsPerThread[i], inCube.toInteger(), outCube.toInteger(), primaryInputQubits, primaryOutputQubits);
+                }
+            }, numThreads);
+
+            if (executionLimitsMonitor.has_value() && executionLimitsMonitor->getViolation() != ExecutionLimitViolation::None) {
+                return false;
+            }
+            for (const auto& rows: rowsPerThread) {
+                outputStream.write(rows.data(), static_cast<std::streamsize>(rows.size()));
+            }
         }
+        outputStream << ".e\n";
+        outputStream.flush();
+        return outputStream.good();
     }
 
 } // namespace syrec
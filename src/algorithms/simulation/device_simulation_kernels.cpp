@@ -0,0 +1,24 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/device_simulation_kernels.hpp"
+
+// The kernels are defined in device_simulation_kernels.cu if the library is built with the MQT_SYREC_ENABLE_CUDA_SIMULATION option, otherwise no device is usable.
+#ifndef MQT_SYREC_ENABLE_CUDA_SIMULATION
+namespace syrec::device {
+    int determineNumDevices() noexcept {
+        return 0;
+    }
+
+    bool checkEquivalence([[maybe_unused]] const EquivalenceCheckProblem& problem, [[maybe_unused]] EquivalenceCheckOutcome& outcome) {
+        return false;
+    }
+} // namespace syrec::device
+#endif
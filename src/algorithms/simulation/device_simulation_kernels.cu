@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/device_simulation_kernels.hpp"
+#include "core/diagnostics.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cuda_runtime.h>
+#include <memory>
+#include <vector>
+
+namespace syrec::device {
+    namespace {
+        constexpr std::size_t LANES_PER_BLOCK   = 64U;
+        constexpr std::size_t THREADS_PER_BLOCK = 256U;
+        // The lane values of the qubits of every thread are stored in the global memory of the device, thus the number of threads is limited for gate programs with a large number of qubits.
+        constexpr std::size_t MAX_SIZE_OF_LANE_VALUES_IN_BYTES = static_cast<std::size_t>(256U) << 20U;
+
+        static_assert(sizeof(unsigned long long) == sizeof(std::uint64_t), "The atomic operations of the device operate on unsigned long long values");
+
+        struct DeviceMemoryDeleter {
+            void operator()(void* deviceMemory) const noexcept {
+                cudaFree(deviceMemory);
+            }
+        };
+
+        template<typename T>
+        using DeviceBuffer = std::unique_ptr<T, DeviceMemoryDeleter>;
+
+        [[nodiscard]] bool isCudaCallSuccessful(const cudaError_t result, const char* nameOfOperation) {
+            if (result != cudaSuccess) {
+                getErrorStream() << "CUDA " << nameOfOperation << " failed: " << cudaGetErrorString(result) << "\n";
+                return false;
+            }
+            return true;
+        }
+
+        template<typename T>
+        [[nodiscard]] bool allocateOnDevice(const std::size_t numElements, DeviceBuffer<T>& deviceBuffer) {
+            T* deviceMemory = nullptr;
+            if (!isCudaCallSuccessful(cudaMalloc(&deviceMemory, std::max<std::size_t>(1U, numElements) * sizeof(T)), "allocation")) {
+                return false;
+            }
+            deviceBuffer.reset(deviceMemory);
+            return true;
+        }
+
+        template<typename T>
+        [[nodiscard]] bool uploadToDevice(const T* hostMemory, const std::size_t numElements, DeviceBuffer<T>& deviceBuffer) {
+            return allocateOnDevice(numElements, deviceBuffer) && (numElements == 0U || isCudaCallSuccessful(cudaMemcpy(deviceBuffer.get(), hostMemory, numElements * sizeof(T), cudaMemcpyHostToDevice), "upload"));
+        }
+
+        /**
+         * The gate arrays of a gate program uploaded to the device which are freed on destruction.
+         */
+        struct UploadedGateArrays {
+            DeviceBuffer<std::uint8_t>  isSwapGate;
+            DeviceBuffer<std::uint32_t> firstTargetQubits;
+            DeviceBuffer<std::uint32_t> secondTargetQubits;
+            DeviceBuffer<std::uint32_t> controlOffsets;
+            DeviceBuffer<std::uint32_t> controlQubits;
+            DeviceBuffer<std::uint8_t>  controlPolarities;
+
+            [[nodiscard]] bool upload(const GateArraysView& hostGates, GateArraysView& deviceGates) {
+                if (!uploadToDevice(hostGates.isSwapGate, hostGates.numGates, isSwapGate) || !uploadToDevice(hostGates.firstTargetQubits, hostGates.numGates, firstTargetQubits) || !uploadToDevice(hostGates.secondTargetQubits, hostGates.numGates, secondTargetQubits) || !uploadToDevice(hostGates.controlOffsets, hostGates.numGates + 1U, controlOffsets) || !uploadToDevice(hostGates.controlQubits, hostGates.numControls, controlQubits) || !uploadToDevice(hostGates.controlPolarities, hostGates.numControls, controlPolarities)) {
+                    return false;
+                }
+                deviceGates                    = hostGates;
+                deviceGates.isSwapGate         = isSwapGate.get();
+                deviceGates.firstTargetQubits  = firstTargetQubits.get();
+                deviceGates.secondTargetQubits = secondTargetQubits.get();
+                deviceGates.controlOffsets     = controlOffsets.get();
+                deviceGates.controlQubits      = controlQubits.get();
+                deviceGates.controlPolarities  = controlPolarities.get();
+                return true;
+            }
+        };
+
+        __device__ void simulateGates(const GateArraysView& gates, std::uint64_t* laneValuesPerQubit, const std::size_t strideOfQubits) {
+            for (std::size_t gate = 0; gate < gates.numGates; ++gate) {
+                std::uint64_t activeLanes = ~static_cast<std::uint64_t>(0U);
+                for (std::uint32_t i = gates.controlOffsets[gate]; i < gates.controlOffsets[gate + 1U]; ++i) {
+                    const std::uint64_t lanesOfControlQubit = laneValuesPerQubit[gates.controlQubits[i] * strideOfQubits];
+                    activeLanes &= gates.controlPolarities[i] != 0U ? lanesOfControlQubit : ~lanesOfControlQubit;
+                }
+
+                std::uint64_t& lanesOfFirstTargetQubit = laneValuesPerQubit[gates.firstTargetQubits[gate] * strideOfQubits];
+                if (gates.isSwapGate[gate] != 0U) {
+                    std::uint64_t&      lanesOfSecondTargetQubit = laneValuesPerQubit[gates.secondTargetQubits[gate] * strideOfQubits];
+                    const std::uint64_t swappedLanes             = (lanesOfFirstTargetQubit ^ lanesOfSecondTargetQubit) & activeLanes;
+                    lanesOfFirstTargetQubit ^= swappedLanes;
+                    lanesOfSecondTargetQubit ^= swappedLanes;
+                } else {
+                    lanesOfFirstTargetQubit ^= activeLanes;
+                }
+            }
+        }
+
+        // Every thread simulates the blocks of assignments in a grid-stride loop with the mismatches being reduced via atomic operations in the global memory of the device.
+        __global__ void checkEquivalenceKernel(const EquivalenceCheckProblem problem, const std::uint64_t numBlocks, std::uint64_t* laneValues, unsigned long long* numMismatchingAssignmentsPerPrimaryOutput, unsigned long long* indexOfFirstMismatchingAssignment) {
+            const std::size_t numThreads = static_cast<std::size_t>(gridDim.x) * blockDim.x;
+            const std::size_t thread     = (static_cast<std::size_t>(blockIdx.x) * blockDim.x) + threadIdx.x;
+
+            // The lane values of a qubit are interleaved across the threads to coalesce the accesses of neighbouring threads to the same qubit.
+            std::uint64_t*      lhsLaneValues       = laneValues + thread;
+            std::uint64_t*      rhsLaneValues       = laneValues + (problem.lhs.numQubits * numThreads) + thread;
+            const std::uint64_t lanesOfPartialBlock = problem.isExhaustive ? problem.numAssignments % LANES_PER_BLOCK : 0U;
+
+            for (std::uint64_t block = thread; block < numBlocks; block += numThreads) {
+                for (std::size_t qubit = 0; qubit < problem.lhs.numQubits; ++qubit) {
+                    lhsLaneValues[qubit * numThreads] = 0U;
+                }
+                for (std::size_t qubit = 0; qubit < problem.rhs.numQubits; ++qubit) {
+                    rhsLaneValues[qubit * numThreads] = 0U;
+                }
+                for (std::size_t i = 0; i < problem.numPrimaryInputs; ++i) {
+                    const std::uint64_t laneValuesOfPrimaryInput                 = determineLaneValuesOfPrimaryInput(problem.isExhaustive, block, i, problem.seed);
+                    lhsLaneValues[problem.lhsPrimaryInputQubits[i] * numThreads] = laneValuesOfPrimaryInput;
+                    rhsLaneValues[problem.rhsPrimaryInputQubits[i] * numThreads] = laneValuesOfPrimaryInput;
+                }
+                simulateGates(problem.lhs, lhsLaneValues, numThreads);
+                simulateGates(problem.rhs, rhsLaneValues, numThreads);
+
+                const bool          isPartialBlock = block + 1U == numBlocks && lanesOfPartialBlock != 0U;
+                const std::uint64_t checkedLanes   = isPartialBlock ? (static_cast<std::uint64_t>(1U) << lanesOfPartialBlock) - 1U : ~static_cast<std::uint64_t>(0U);
+                std::uint64_t       differingLanes = 0U;
+                for (std::size_t j = 0; j < problem.numPrimaryOutputs; ++j) {
+                    const std::uint64_t differingLanesOfPrimaryOutput = (lhsLaneValues[problem.lhsPrimaryOutputQubits[j] * numThreads] ^ rhsLaneValues[problem.rhsPrimaryOutputQubits[j] * numThreads]) & checkedLanes;
+                    if (differingLanesOfPrimaryOutput != 0U) {
+                        atomicAdd(&numMismatchingAssignmentsPerPrimaryOutput[j], static_cast<unsigned long long>(__popcll(differingLanesOfPrimaryOutput)));
+                        differingLanes |= differingLanesOfPrimaryOutput;
+                    }
+                }
+                if (differingLanes != 0U) {
+                    atomicMin(indexOfFirstMismatchingAssignment, static_cast<unsigned long long>((block * LANES_PER_BLOCK) + static_cast<std::uint64_t>(__ffsll(static_cast<long long>(differingLanes)) - 1)));
+                }
+            }
+        }
+
+        [[nodiscard]] std::size_t determineNumThreads(const std::uint64_t numBlocks, const std::size_t numQubits) {
+            int device                      = 0;
+            int numMultiProcessors          = 1;
+            int maxThreadsPerMultiProcessor = static_cast<int>(THREADS_PER_BLOCK);
+            if (cudaGetDevice(&device) == cudaSuccess) {
+                cudaDeviceGetAttribute(&numMultiProcessors, cudaDevAttrMultiProcessorCount, device);
+                cudaDeviceGetAttribute(&maxThreadsPerMultiProcessor, cudaDevAttrMaxThreadsPerMultiProcessor, device);
+            }
+
+            // The number of threads is limited by the number of resident threads of the device, the size of the lane values and the number of blocks of assignments.
+            std::uint64_t numThreads = static_cast<std::uint64_t>(std::max(1, numMultiProcessors)) * static_cast<std::uint64_t>(std::max(1, maxThreadsPerMultiProcessor));
+            numThreads               = std::min<std::uint64_t>(numThreads, MAX_SIZE_OF_LANE_VALUES_IN_BYTES / (std::max<std::size_t>(1U, numQubits) * sizeof(std::uint64_t)));
+            numThreads               = std::min<std::uint64_t>(numThreads, numBlocks);
+            return static_cast<std::size_t>((std::max<std::uint64_t>(1U, numThreads) + THREADS_PER_BLOCK - 1U) / THREADS_PER_BLOCK * THREADS_PER_BLOCK);
+        }
+    } // namespace
+
+    int determineNumDevices() noexcept {
+        int numDevices = 0;
+        if (cudaGetDeviceCount(&numDevices) != cudaSuccess) {
+            return 0;
+        }
+        return numDevices;
+    }
+
+    bool checkEquivalence(const EquivalenceCheckProblem& problem, EquivalenceCheckOutcome& outcome) {
+        outcome = EquivalenceCheckOutcome();
+        outcome.numMismatchingAssignmentsPerPrimaryOutput.assign(problem.numPrimaryOutputs, 0U);
+
+        const std::uint64_t numBlocks = (problem.numAssignments + LANES_PER_BLOCK - 1U) / LANES_PER_BLOCK;
+        if (numBlocks == 0U) {
+            return true;
+        }
+
+        // The gate programs and primary lines are uploaded once and remain on the device until the simulation of all assignments is finished.
+        EquivalenceCheckProblem     deviceProblem = problem;
+        UploadedGateArrays          lhsGates;
+        UploadedGateArrays          rhsGates;
+        DeviceBuffer<std::uint32_t> lhsPrimaryInputQubits;
+        DeviceBuffer<std::uint32_t> rhsPrimaryInputQubits;
+        DeviceBuffer<std::uint32_t> lhsPrimaryOutputQubits;
+        DeviceBuffer<std::uint32_t> rhsPrimaryOutputQubits;
+        if (!lhsGates.upload(problem.lhs, deviceProblem.lhs) || !rhsGates.upload(problem.rhs, deviceProblem.rhs) || !uploadToDevice(problem.lhsPrimaryInputQubits, problem.numPrimaryInputs, lhsPrimaryInputQubits) || !uploadToDevice(problem.rhsPrimaryInputQubits, problem.numPrimaryInputs, rhsPrimaryInputQubits) || !uploadToDevice(problem.lhsPrimaryOutputQubits, problem.numPrimaryOutputs, lhsPrimaryOutputQubits) || !uploadToDevice(problem.rhsPrimaryOutputQubits, problem.numPrimaryOutputs, rhsPrimaryOutputQubits)) {
+            return false;
+        }
+        deviceProblem.lhsPrimaryInputQubits  = lhsPrimaryInputQubits.get();
+        deviceProblem.rhsPrimaryInputQubits  = rhsPrimaryInputQubits.get();
+        deviceProblem.lhsPrimaryOutputQubits = lhsPrimaryOutputQubits.get();
+        deviceProblem.rhsPrimaryOutputQubits = rhsPrimaryOutputQubits.get();
+
+        const std::size_t                numQubits  = problem.lhs.numQubits + problem.rhs.numQubits;
+        const std::size_t                numThreads = determineNumThreads(numBlocks, numQubits);
+        DeviceBuffer<std::uint64_t>      laneValues;
+        DeviceBuffer<unsigned long long> numMismatchingAssignmentsPerPrimaryOutput;
+        DeviceBuffer<unsigned long long> indexOfFirstMismatchingAssignment;
+        if (!allocateOnDevice(numThreads * numQubits, laneValues) || !allocateOnDevice(problem.numPrimaryOutputs, numMismatchingAssignmentsPerPrimaryOutput) || !allocateOnDevice(1U, indexOfFirstMismatchingAssignment) || !isCudaCallSuccessful(cudaMemset(numMismatchingAssignmentsPerPrimaryOutput.get(), 0, std::max<std::size_t>(1U, problem.numPrimaryOutputs) * sizeof(unsigned long long)), "initialization") || !isCudaCallSuccessful(cudaMemset(indexOfFirstMismatchingAssignment.get(), 0xFF, sizeof(unsigned long long)), "initialization")) {
+            return false;
+        }
+
+        checkEquivalenceKernel<<<static_cast<unsigned int>(numThreads / THREADS_PER_BLOCK), static_cast<unsigned int>(THREADS_PER_BLOCK)>>>(deviceProblem, numBlocks, laneValues.get(), numMismatchingAssignmentsPerPrimaryOutput.get(), indexOfFirstMismatchingAssignment.get());
+        if (!isCudaCallSuccessful(cudaGetLastError(), "kernel launch") || !isCudaCallSuccessful(cudaDeviceSynchronize(), "kernel execution")) {
+            return false;
+        }
+
+        unsigned long long indexOfFirstMismatch = 0U;
+        if (!isCudaCallSuccessful(cudaMemcpy(&indexOfFirstMismatch, indexOfFirstMismatchingAssignment.get(), sizeof(unsigned long long), cudaMemcpyDeviceToHost), "download") || (problem.numPrimaryOutputs != 0U && !isCudaCallSuccessful(cudaMemcpy(outcome.numMismatchingAssignmentsPerPrimaryOutput.data(), numMismatchingAssignmentsPerPrimaryOutput.get(), problem.numPrimaryOutputs * sizeof(unsigned long long), cudaMemcpyDeviceToHost), "download"))) {
+            return false;
+        }
+        outcome.indexOfFirstMismatchingAssignment = static_cast<std::uint64_t>(indexOfFirstMismatch);
+        return true;
+    }
+} // namespace syrec::device
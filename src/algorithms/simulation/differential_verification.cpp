@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/differential_verification.hpp"
+
+#include "algorithms/simulation/program_interpreter.hpp"
+#include "algorithms/simulation/simple_simulation.hpp"
+#include "algorithms/simulation/simulation_program.hpp"
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "algorithms/synthesis/syrec_hybrid_synthesis.hpp"
+#include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/diagnostics.hpp"
+#include "core/executor.hpp"
+#include "core/statistics.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/variable.hpp"
+#include "ir/Definitions.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <ostream>
+#include <ranges>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    using TimeStamp = std::chrono::time_point<std::chrono::steady_clock>;
+
+    /**
+     * The qubits storing the bits of a value of an assignment of the variables of the main module (see syrec::ProgramInterpreter).
+     */
+    struct QubitsOfValue {
+        std::vector<qc::Qubit> qubitPerBit;
+        // The qubits storing the bits of the value at the end of the quantum computation, which only differ from the former ones if an output permutation was recorded during the synthesis.
+        std::vector<qc::Qubit> outputQubitPerBit;
+        bool                   isRandomlyInitialized;
+        bool                   isCompared;
+    };
+
+    /**
+     * The first stimulus processed by a thread for which either a mismatch was found or the interpretation failed.
+     */
+    struct FirstEventOfThread {
+        std::optional<std::uint64_t>     indexOfStimulus;
+        bool                             didInterpretationFail = false;
+        DifferentialVerificationMismatch mismatch;
+        Diagnostics                      diagnostics;
+    };
+
+    // The counter-th output of the SplitMix64 generator started at the given seed, which allows every lane word to be generated independently of the order in which the blocks are processed.
+    [[nodiscard]] std::uint64_t generateRandomLaneWord(const std::uint64_t seed, const std::uint64_t counter) {
+        std::uint64_t z = seed + (counter + 1U) * 0x9E3779B97F4A7C15ULL;
+        z               = (z ^ (z >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+        z               = (z ^ (z >> 27U)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31U);
+    }
+
+    [[nodiscard]] std::uint64_t maskOfFirstLanes(const std::uint64_t numLanes) {
+        return numLanes >= BATCH_SIMULATION_LANE_COUNT ? ~static_cast<std::uint64_t>(0) : (static_cast<std::uint64_t>(1) << numLanes) - 1U;
+    }
+
+    [[nodiscard]] std::string determineLabelOfQubit(const AnnotatableQuantumComputation& annotatableQuantumComputation, const qc::Qubit qubit) {
+        // Only the qubits of local variables are labeled with the user declared identifier of their variable.
+        std::string qubitLabel;
+        if (!annotatableQuantumComputation.appendQubitLabel(qubit, AnnotatableQuantumComputation::QubitLabelType::UserDeclared, qubitLabel)) {
+            static_cast<void>(annotatableQuantumComputation.appendQubitLabel(qubit, AnnotatableQuantumComputation::QubitLabelType::Internal, qubitLabel));
+        }
+        return qubitLabel;
+    }
+
+    [[nodiscard]] bool determineQubitsOfValues(std::vector<QubitsOfValue>& qubitsPerValue, const AnnotatableQuantumComputation& annotatableQuantumComputation, const Module& mainModule) {
+        // Since the qubits of the variables of the main module are created prior to the qubits of any called module, the qubit with the smallest index is used for every label.
+        std::unordered_map<std::string, qc::Qubit> qubitPerLabel;
+        for (qc::Qubit qubit = 0; qubit < annotatableQuantumComputation.getNqubits(); ++qubit) {
+            qubitPerLabel.try_emplace(determineLabelOfQubit(annotatableQuantumComputation, qubit), qubit);
+        }
+
+        // The output permutation maps the qubit storing the value of a logical qubit at the end of the quantum computation to the latter.
+        std::unordered_map<qc::Qubit, qc::Qubit> outputQubitPerLogicalQubit;
+        for (const auto& [outputQubit, logicalQubit]: annotatableQuantumComputation.outputPermutation) {
+            outputQubitPerLogicalQubit.try_emplace(logicalQubit, outputQubit);
+        }
+
+        for (const Variable::vec* variables: {&mainModule.parameters, &mainModule.variables}) {
+            for (const Variable::ptr& variable: *variables) {
+                std::size_t numElements = 1U;
+                for (const unsigned numValuesOfDimension: variable->dimensions) {
+                    numElements *= numValuesOfDimension;
+                }
+
+                for (std::size_t element = 0; element < numElements; ++element) {
+                    // The elements of a multi-dimensional variable are stored in row-major order.
+                    std::string labelOfElement;
+                    std::size_t remainingIndex = element;
+                    for (const unsigned numValuesOfDimension: std::ranges::reverse_view(variable->dimensions)) {
+                        labelOfElement.insert(0, "[" + std::to_string(remainingIndex % numValuesOfDimension) + "]");
+                        remainingIndex /= numValuesOfDimension;
+                    }
+                    labelOfElement.insert(0, variable->name);
+
+                    QubitsOfValue& qubitsOfValue        = qubitsPerValue.emplace_back();
+                    qubitsOfValue.isRandomlyInitialized = variable->type == Variable::Type::In || variable->type == Variable::Type::Inout || variable->type == Variable::Type::State;
+                    qubitsOfValue.isCompared            = variable->type != Variable::Type::In && variable->type != Variable::Type::Wire;
+                    for (unsigned bit = 0; bit < variable->bitwidth; ++bit) {
+                        const auto matchingQubit = qubitPerLabel.find(labelOfElement + "." + std::to_string(bit));
+                        if (matchingQubit == qubitPerLabel.end()) {
+                            getErrorStream() << "Failed to determine the qubit of bit " << std::to_string(bit) << " of " << labelOfElement << " in the synthesized quantum computation\n";
+                            return false;
+                        }
+                        qubitsOfValue.qubitPerBit.emplace_back(matchingQubit->second);
+
+                        const auto matchingOutputQubit = outputQubitPerLogicalQubit.find(matchingQubit->second);
+                        qubitsOfValue.outputQubitPerBit.emplace_back(matchingOutputQubit != outputQubitPerLogicalQubit.end() ? matchingOutputQubit->second : matchingQubit->second);
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+    [[nodiscard]] std::vector<std::uint64_t> extractValuesOfLane(const std::vector<QubitsOfValue>& qubitsPerValue, const std::vector<std::uint64_t>& laneValuesPerQubit, const std::size_t lane, const bool extractOutputValues) {
+        std::vector<std::uint64_t> values(qubitsPerValue.size(), 0U);
+        for (std::size_t i = 0; i < qubitsPerValue.size(); ++i) {
+            const std::vector<qc::Qubit>& qubitPerBit = extractOutputValues ? qubitsPerValue[i].outputQubitPerBit : qubitsPerValue[i].qubitPerBit;
+            for (std::size_t bit = 0; bit < qubitPerBit.size(); ++bit) {
+                values[i] |= ((laneValuesPerQubit[qubitPerBit[bit]] >> lane) & 1U) << bit;
+            }
+        }
+        return values;
+    }
+
+    [[nodiscard]] std::optional<std::string> determineStatementLineNumberOfLastQuantumOperationTargetingQubit(const AnnotatableQuantumComputation& annotatableQuantumComputation, const qc::Qubit qubit) {
+        for (std::size_t i = annotatableQuantumComputation.getNumQuantumOperations(); i > annotatableQuantumComputation.getNumForwardedQuantumOperations(); --i) {
+            const qc::Operation* quantumOperation = annotatableQuantumComputation.getQuantumOperation(i - 1U);
+            if (quantumOperation == nullptr || std::ranges::find(quantumOperation->getTargets(), qubit) == quantumOperation->getTargets().end()) {
+                continue;
+            }
+
+            const std::optional<unsigned> statementLineNumber = annotatableQuantumComputation.getStatementLineNumberOfQuantumOperation(i - 1U);
+            return statementLineNumber.has_value() ? std::make_optional(std::to_string(*statementLineNumber)) : std::nullopt;
+        }
+        return std::nullopt;
+    }
+} // namespace
+
+bool syrec::differentialVerification(DifferentialVerificationResult& result, const Program& program, const ConfigurableOptions& synthesisSettings, const DifferentialVerificationSettings& settings, Statistics* optionalRecordedStatistics) {
+    result = DifferentialVerificationResult();
+
+    const TimeStamp verificationStartTime = std::chrono::steady_clock::now();
+
+    // The quantum operation annotations are required to determine the statement associated with a mismatch.
+    ConfigurableOptions settingsOfAnnotatedSynthesis                 = synthesisSettings;
+    settingsOfAnnotatedSynthesis.generateQuantumOperationAnnotations = true;
+
+    AnnotatableQuantumComputation annotatableQuantumComputation(true);
+    bool                          synthesisOk = false;
+    switch (settings.synthesisAlgorithm) {
+        case SynthesisAlgorithm::CostAware:
+            synthesisOk = CostAwareSynthesis::synthesize(annotatableQuantumComputation, program, settingsOfAnnotatedSynthesis);
+            break;
+        case SynthesisAlgorithm::LineAware:
+            synthesisOk = LineAwareSynthesis::synthesize(annotatableQuantumComputation, program, settingsOfAnnotatedSynthesis);
+            break;
+        case SynthesisAlgorithm::Hybrid:
+            synthesisOk = HybridSynthesis::synthesize(annotatableQuantumComputation, program, settingsOfAnnotatedSynthesis);
+            break;
+    }
+    if (!synthesisOk) {
+        getErrorStream() << "Failed to synthesize the program to verify\n";
+        return false;
+    }
+
+    const std::optional<SimulationProgram>  simulationProgram = SimulationProgram::compile(annotatableQuantumComputation);
+    const std::optional<ProgramInterpreter> interpreter       = simulationProgram.has_value() ? ProgramInterpreter::create(program, synthesisSettings) : std::nullopt;
+    if (!simulationProgram.has_value() || !interpreter.has_value()) {
+        return false;
+    }
+
+    std::vector<QubitsOfValue> qubitsPerValue;
+    if (!determineQubitsOfValues(qubitsPerValue, annotatableQuantumComputation, *interpreter->getMainModule())) {
+        return false;
+    }
+
+    std::uint64_t numRandomlyInitializedBits = 0U;
+    for (const QubitsOfValue& qubitsOfValue: qubitsPerValue) {
+        numRandomlyInitializedBits += qubitsOfValue.isRandomlyInitialized ? qubitsOfValue.qubitPerBit.size() : 0U;
+    }
+
+    const std::size_t   numQubits = simulationProgram->getNumQubits();
+    const std::uint64_t numBlocks = (settings.numStimuli + BATCH_SIMULATION_LANE_COUNT - 1U) / BATCH_SIMULATION_LANE_COUNT;
+
+    // The blocks following the one of the first known mismatch or failed interpretation are skipped by all threads.
+    std::atomic<std::uint64_t> indexOfFirstBlockWithEvent = std::numeric_limits<std::uint64_t>::max();
+    const auto                 verifyBlocks               = [&](const std::uint64_t firstBlock, const std::uint64_t lastBlock, FirstEventOfThread& firstEvent) {
+        const ScopedDiagnosticsCollection       diagnosticsCollection(firstEvent.diagnostics);
+        ProgramInterpreter                      interpreterOfThread = *interpreter;
+        std::vector<std::uint64_t>              inputLaneValuesPerQubit(numQubits, 0U);
+        std::vector<std::uint64_t>              laneValuesPerQubit(numQubits, 0U);
+        std::vector<std::vector<std::uint64_t>> assignmentPerLane(BATCH_SIMULATION_LANE_COUNT);
+
+        for (std::uint64_t block = firstBlock; block < lastBlock && block <= indexOfFirstBlockWithEvent; ++block) {
+            const std::uint64_t firstStimulus = block * BATCH_SIMULATION_LANE_COUNT;
+            const std::uint64_t numLanes      = std::min<std::uint64_t>(BATCH_SIMULATION_LANE_COUNT, settings.numStimuli - firstStimulus);
+            const std::uint64_t maskOfLanes   = maskOfFirstLanes(numLanes);
+
+            std::ranges::fill(inputLaneValuesPerQubit, 0U);
+            std::uint64_t counter = block * numRandomlyInitializedBits;
+            for (const QubitsOfValue& qubitsOfValue: qubitsPerValue) {
+                if (qubitsOfValue.isRandomlyInitialized) {
+                    for (const qc::Qubit qubit: qubitsOfValue.qubitPerBit) {
+                        inputLaneValuesPerQubit[qubit] = maskOfLanes & generateRandomLaneWord(settings.seed, counter++);
+                    }
+                }
+            }
+
+            laneValuesPerQubit = inputLaneValuesPerQubit;
+            if (!simulationProgram->simulate(laneValuesPerQubit)) {
+                getErrorStream() << "Simulation of the synthesized quantum computation for the stimuli of block " << std::to_string(block) << " failed\n";
+                firstEvent.indexOfStimulus       = firstStimulus;
+                firstEvent.didInterpretationFail = true;
+                return;
+            }
+
+            // The lanes following the first stimulus whose interpretation failed are not compared.
+            std::uint64_t numInterpretedLanes = 0;
+            for (; numInterpretedLanes < numLanes; ++numInterpretedLanes) {
+                assignmentPerLane[numInterpretedLanes] = extractValuesOfLane(qubitsPerValue, inputLaneValuesPerQubit, numInterpretedLanes, false);
+                if (!interpreterOfThread.execute(assignmentPerLane[numInterpretedLanes])) {
+                    getErrorStream() << "Interpretation of the program for the stimulus " << std::to_string(firstStimulus + numInterpretedLanes) << " failed\n";
+                    break;
+                }
+            }
+
+            std::uint64_t mismatchingLanes = 0U;
+            for (std::size_t i = 0; i < qubitsPerValue.size(); ++i) {
+                if (!qubitsPerValue[i].isCompared) {
+                    continue;
+                }
+                for (std::size_t bit = 0; bit < qubitsPerValue[i].qubitPerBit.size(); ++bit) {
+                    std::uint64_t expectedLaneValues = 0U;
+                    for (std::uint64_t lane = 0; lane < numInterpretedLanes; ++lane) {
+                        expectedLaneValues |= ((assignmentPerLane[lane][i] >> bit) & 1U) << lane;
+                    }
+                    mismatchingLanes |= (expectedLaneValues ^ laneValuesPerQubit[qubitsPerValue[i].outputQubitPerBit[bit]]) & maskOfFirstLanes(numInterpretedLanes);
+                }
+            }
+
+            if (mismatchingLanes == 0U && numInterpretedLanes == numLanes) {
+                continue;
+            }
+
+            if (mismatchingLanes == 0U) {
+                firstEvent.indexOfStimulus       = firstStimulus + numInterpretedLanes;
+                firstEvent.didInterpretationFail = true;
+            } else {
+                const auto lane            = static_cast<std::size_t>(std::countr_zero(mismatchingLanes));
+                firstEvent.indexOfStimulus = firstStimulus + lane;
+
+                DifferentialVerificationMismatch& mismatch = firstEvent.mismatch;
+                mismatch.indexOfStimulus                   = firstStimulus + lane;
+                mismatch.stimulus                          = extractValuesOfLane(qubitsPerValue, inputLaneValuesPerQubit, lane, false);
+                mismatch.expectedValues                    = assignmentPerLane[lane];
+                mismatch.actualValues                      = extractValuesOfLane(qubitsPerValue, laneValuesPerQubit, lane, true);
+
+                // The label of the mismatching bit is determined by its logical qubit while the last quantum operation modifying the bit targets its output qubit.
+                std::optional<qc::Qubit> mismatchingQubit;
+                std::optional<qc::Qubit> outputQubitOfMismatchingQubit;
+                for (std::size_t i = 0; i < qubitsPerValue.size(); ++i) {
+                    for (std::size_t bit = 0; qubitsPerValue[i].isCompared && bit < qubitsPerValue[i].qubitPerBit.size(); ++bit) {
+                        const qc::Qubit qubit = qubitsPerValue[i].qubitPerBit[bit];
+                        if ((((mismatch.expectedValues[i] ^ mismatch.actualValues[i]) >> bit) & 1U) != 0U && (!mismatchingQubit.has_value() || qubit < *mismatchingQubit)) {
+                            mismatchingQubit              = qubit;
+                            outputQubitOfMismatchingQubit = qubitsPerValue[i].outputQubitPerBit[bit];
+                        }
+                    }
+                }
+                mismatch.labelOfMismatchingQubit = determineLabelOfQubit(annotatableQuantumComputation, *mismatchingQubit);
+                mismatch.statementLineNumber     = determineStatementLineNumberOfLastQuantumOperationTargetingQubit(annotatableQuantumComputation, *outputQubitOfMismatchingQubit);
+            }
+
+            std::uint64_t expectedIndexOfFirstBlockWithEvent = indexOfFirstBlockWithEvent;
+            while (block < expectedIndexOfFirstBlockWithEvent && !indexOfFirstBlockWithEvent.compare_exchange_weak(expectedIndexOfFirstBlockWithEvent, block)) {}
+            return;
+        }
+    };
+
+    std::size_t numThreads = Executor::determineNumThreads(settings.numThreads);
+    numThreads             = static_cast<std::size_t>(std::max<std::uint64_t>(1U, std::min<std::uint64_t>(numThreads, numBlocks)));
+
+    std::vector<FirstEventOfThread> firstEventPerThread(numThreads);
+    const std::uint64_t             numBlocksPerThread = (numBlocks + numThreads - 1U) / numThreads;
+    Executor::getShared().parallelFor(numThreads, [&](const std::size_t i) {
+        const std::uint64_t firstBlock = std::min(numBlocks, i * numBlocksPerThread);
+        const std::uint64_t lastBlock  = std::min(numBlocks, firstBlock + numBlocksPerThread);
+        verifyBlocks(firstBlock, lastBlock, firstEventPerThread[i]);
+    }, numThreads);
+
+    // Every thread processes its blocks in ascending order, the event of the smallest stimulus is thus the first event of the generated stream of stimuli.
+    const FirstEventOfThread* firstEvent = nullptr;
+    for (const FirstEventOfThread& firstEventOfThread: firstEventPerThread) {
+        if (firstEventOfThread.indexOfStimulus.has_value() && (firstEvent == nullptr || *firstEventOfThread.indexOfStimulus < *firstEvent->indexOfStimulus)) {
+            firstEvent = &firstEventOfThread;
+        }
+    }
+
+    if (firstEvent != nullptr && firstEvent->didInterpretationFail) {
+        for (const std::string& errorMessage: firstEvent->diagnostics.getErrorMessages()) {
+            getErrorStream() << errorMessage << "\n";
+        }
+        return false;
+    }
+
+    result.numCheckedStimuli = firstEvent != nullptr ? *firstEvent->indexOfStimulus + 1U : settings.numStimuli;
+    if (firstEvent != nullptr) {
+        result.firstMismatch = firstEvent->mismatch;
+    }
+
+    const TimeStamp verificationEndTime = std::chrono::steady_clock::now();
+    if (optionalRecordedStatistics != nullptr) {
+        optionalRecordedStatistics->recordRuntime(verificationEndTime - verificationStartTime);
+    }
+    return true;
+}
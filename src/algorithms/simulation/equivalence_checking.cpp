@@ -0,0 +1,365 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/equivalence_checking.hpp"
+
+#include "algorithms/simulation/device_simulation_kernels.hpp"
+#include "algorithms/simulation/simple_simulation.hpp"
+#include "algorithms/simulation/simulation_program.hpp"
+#include "core/executor.hpp"
+#include "core/truthTable/truth_table.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace syrec {
+
+    namespace {
+        // the lane values of the first six primary inputs in a block of exhaustively enumerated assignments, i.e. the i-th bit of the lane index
+        constexpr std::array<std::uint64_t, 6U> EXHAUSTIVE_LANE_PATTERNS = {0xAAAAAAAAAAAAAAAAULL, 0xCCCCCCCCCCCCCCCCULL, 0xF0F0F0F0F0F0F0F0ULL, 0xFF00FF00FF00FF00ULL, 0xFFFF0000FFFF0000ULL, 0xFFFFFFFF00000000ULL};
+
+        /**
+         * The primary inputs (non-ancillary qubits) and primary outputs (non-garbage qubits) of a quantum computation ordered by descending qubit index.
+         */
+        struct PrimaryLines {
+            std::vector<qc::Qubit> inputQubits;
+            std::vector<qc::Qubit> outputQubits;
+        };
+
+        auto determinePrimaryLines(const qc::QuantumComputation& quantumComputation) -> PrimaryLines {
+            PrimaryLines primaryLines;
+            for (auto qubit = static_cast<qc::Qubit>(quantumComputation.getNqubits()); qubit-- > 0U;) {
+                if (!quantumComputation.logicalQubitIsAncillary(qubit)) {
+                    primaryLines.inputQubits.emplace_back(qubit);
+                }
+                if (!quantumComputation.logicalQubitIsGarbage(qubit)) {
+                    primaryLines.outputQubits.emplace_back(qubit);
+                }
+            }
+            return primaryLines;
+        }
+
+        /**
+         * A compiled quantum computation together with the lane values of its qubits, of which every thread requires its own instance.
+         */
+        struct LaneSimulation {
+            const SimulationProgram&   simulationProgram;
+            const PrimaryLines&        primaryLines;
+            std::vector<std::uint64_t> laneValuesPerQubit;
+
+            LaneSimulation(const SimulationProgram& simulationProgram, const PrimaryLines& primaryLines):
+                simulationProgram(simulationProgram), primaryLines(primaryLines), laneValuesPerQubit(simulationProgram.getNumQubits(), 0U) {}
+
+            // the ancillary qubits are initialized to zero
+            auto simulate(const std::vector<std::uint64_t>& laneValuesOfPrimaryInputs) -> void {
+                std::ranges::fill(laneValuesPerQubit, 0U);
+                for (std::size_t i = 0U; i < laneValuesOfPrimaryInputs.size(); ++i) {
+                    laneValuesPerQubit[primaryLines.inputQubits[i]] = laneValuesOfPrimaryInputs[i];
+                }
+                [[maybe_unused]] const bool simulationOk = simulationProgram.simulate(laneValuesPerQubit);
+            }
+
+            [[nodiscard]] auto laneValuesOfPrimaryOutput(const std::size_t primaryOutput) const -> std::uint64_t {
+                return laneValuesPerQubit[primaryLines.outputQubits[primaryOutput]];
+            }
+        };
+
+        struct ResultOfThread {
+            std::uint64_t                    numCheckedAssignments = 0U;
+            std::optional<std::vector<bool>> counterexample;
+        };
+
+        // the blocks are split into contiguous ranges among the threads which stop as soon as any thread found a counterexample
+        auto checkBlocksInParallel(const std::uint64_t numBlocks, const std::size_t requestedNumThreads, const std::function<void(std::size_t, std::uint64_t, std::uint64_t, const std::atomic<bool>&, ResultOfThread&)>& checkBlocks) -> ResultOfThread {
+            std::size_t numThreads = Executor::determineNumThreads(requestedNumThreads);
+            numThreads             = static_cast<std::size_t>(std::max<std::uint64_t>(1U, std::min<std::uint64_t>(numThreads, numBlocks)));
+
+            std::vector<ResultOfThread> resultsOfThreads(numThreads);
+            std::atomic<bool>           isCounterexampleFound = false;
+            const auto                  checkBlocksOfThread   = [&](const std::size_t thread, const std::uint64_t firstBlock, const std::uint64_t lastBlock) {
+                checkBlocks(thread, firstBlock, lastBlock, isCounterexampleFound, resultsOfThreads[thread]);
+                if (resultsOfThreads[thread].counterexample.has_value()) {
+                    isCounterexampleFound = true;
+                }
+            };
+
+            const std::uint64_t numBlocksPerThread = (numBlocks + numThreads - 1U) / numThreads;
+            Executor::getShared().parallelFor(numThreads, [&](const std::size_t i) {
+                const std::uint64_t firstBlock = std::min(numBlocks, i * numBlocksPerThread);
+                const std::uint64_t lastBlock  = std::min(numBlocks, firstBlock + numBlocksPerThread);
+                checkBlocksOfThread(i, firstBlock, lastBlock);
+            }, numThreads);
+
+            ResultOfThread result;
+            for (auto& resultOfThread: resultsOfThreads) {
+                result.numCheckedAssignments += resultOfThread.numCheckedAssignments;
+                if (!result.counterexample.has_value()) {
+                    result.counterexample = std::move(resultOfThread.counterexample);
+                }
+            }
+            return result;
+        }
+
+        auto valuesOfLane(const std::vector<std::uint64_t>& laneValuesOfPrimaryInputs, const std::size_t lane) -> std::vector<bool> {
+            std::vector<bool> values(laneValuesOfPrimaryInputs.size());
+            for (std::size_t i = 0U; i < laneValuesOfPrimaryInputs.size(); ++i) {
+                values[i] = ((laneValuesOfPrimaryInputs[i] >> lane) & 1U) != 0U;
+            }
+            return values;
+        }
+
+        auto viewOfGateArrays(const SimulationProgram::GateArrays& gateArrays, const std::size_t numQubits) -> device::GateArraysView {
+            device::GateArraysView view;
+            view.numQubits          = numQubits;
+            view.numGates           = gateArrays.isSwapGate.size();
+            view.numControls        = gateArrays.controlQubits.size();
+            view.isSwapGate         = gateArrays.isSwapGate.data();
+            view.firstTargetQubits  = gateArrays.firstTargetQubits.data();
+            view.secondTargetQubits = gateArrays.secondTargetQubits.data();
+            view.controlOffsets     = gateArrays.controlOffsets.data();
+            view.controlQubits      = gateArrays.controlQubits.data();
+            view.controlPolarities  = gateArrays.controlPolarities.data();
+            return view;
+        }
+
+        // the gate arrays are uploaded once and all blocks of assignments are simulated on the device, returns std::nullopt if the simulation on the device failed
+        auto checkEquivalenceOnDevice(const SimulationProgram& lhsSimulationProgram, const PrimaryLines& lhsPrimaryLines, const SimulationProgram& rhsSimulationProgram, const PrimaryLines& rhsPrimaryLines, const bool isExhaustive, const std::uint64_t numAssignments, const std::uint64_t seed) -> std::optional<EquivalenceCheckingResult> {
+            const SimulationProgram::GateArrays lhsGateArrays = lhsSimulationProgram.exportGateArrays();
+            const SimulationProgram::GateArrays rhsGateArrays = rhsSimulationProgram.exportGateArrays();
+
+            device::EquivalenceCheckProblem problem;
+            problem.lhs                    = viewOfGateArrays(lhsGateArrays, lhsSimulationProgram.getNumQubits());
+            problem.rhs                    = viewOfGateArrays(rhsGateArrays, rhsSimulationProgram.getNumQubits());
+            problem.lhsPrimaryInputQubits  = lhsPrimaryLines.inputQubits.data();
+            problem.rhsPrimaryInputQubits  = rhsPrimaryLines.inputQubits.data();
+            problem.lhsPrimaryOutputQubits = lhsPrimaryLines.outputQubits.data();
+            problem.rhsPrimaryOutputQubits = rhsPrimaryLines.outputQubits.data();
+            problem.numPrimaryInputs       = lhsPrimaryLines.inputQubits.size();
+            problem.numPrimaryOutputs      = lhsPrimaryLines.outputQubits.size();
+            problem.isExhaustive           = isExhaustive;
+            problem.numAssignments         = numAssignments;
+            problem.seed                   = seed;
+
+            device::EquivalenceCheckOutcome outcome;
+            if (!device::checkEquivalence(problem, outcome)) {
+                return std::nullopt;
+            }
+
+            EquivalenceCheckingResult result;
+            result.numCheckedAssignments                     = isExhaustive ? numAssignments : ((numAssignments + BATCH_SIMULATION_LANE_COUNT - 1U) / BATCH_SIMULATION_LANE_COUNT) * BATCH_SIMULATION_LANE_COUNT;
+            result.numMismatchingAssignmentsPerPrimaryOutput = std::move(outcome.numMismatchingAssignmentsPerPrimaryOutput);
+            if (outcome.indexOfFirstMismatchingAssignment != UINT64_MAX) {
+                const std::uint64_t block = outcome.indexOfFirstMismatchingAssignment / BATCH_SIMULATION_LANE_COUNT;
+                const std::uint64_t lane  = outcome.indexOfFirstMismatchingAssignment % BATCH_SIMULATION_LANE_COUNT;
+
+                result.outcome = EquivalenceCheckingResult::Outcome::NotEquivalent;
+                result.counterexample.resize(problem.numPrimaryInputs);
+                for (std::size_t i = 0U; i < problem.numPrimaryInputs; ++i) {
+                    result.counterexample[i] = ((device::determineLaneValuesOfPrimaryInput(isExhaustive, block, i, seed) >> lane) & 1U) != 0U;
+                }
+            }
+            return result;
+        }
+    } // namespace
+
+    auto isDeviceSimulationAvailable() -> bool {
+        return device::determineNumDevices() > 0;
+    }
+
+    auto checkEquivalence(const qc::QuantumComputation& lhs, const qc::QuantumComputation& rhs, const EquivalenceCheckingSettings& settings) -> EquivalenceCheckingResult {
+        EquivalenceCheckingResult result;
+
+        const auto lhsSimulationProgram = SimulationProgram::compile(lhs);
+        const auto rhsSimulationProgram = SimulationProgram::compile(rhs);
+        if (!lhsSimulationProgram.has_value() || !rhsSimulationProgram.has_value()) {
+            result.outcome = EquivalenceCheckingResult::Outcome::NotSupported;
+            return result;
+        }
+
+        const PrimaryLines lhsPrimaryLines = determinePrimaryLines(lhs);
+        const PrimaryLines rhsPrimaryLines = determinePrimaryLines(rhs);
+        if (lhsPrimaryLines.inputQubits.size() != rhsPrimaryLines.inputQubits.size() || lhsPrimaryLines.outputQubits.size() != rhsPrimaryLines.outputQubits.size()) {
+            result.outcome = EquivalenceCheckingResult::Outcome::NotEquivalent;
+            return result;
+        }
+
+        const std::size_t numPrimaryInputs    = lhsPrimaryLines.inputQubits.size();
+        const std::size_t numPrimaryOutputs   = lhsPrimaryLines.outputQubits.size();
+        const bool        isExhaustive        = numPrimaryInputs <= settings.maxNumPrimaryInputsOfExhaustiveCheck && numPrimaryInputs < 64U;
+        const auto        numAssignments      = isExhaustive ? static_cast<std::uint64_t>(1U) << numPrimaryInputs : settings.numRandomSamples;
+        const auto        numBlocks           = (numAssignments + BATCH_SIMULATION_LANE_COUNT - 1U) / BATCH_SIMULATION_LANE_COUNT;
+        // all lanes of the last block of random samples are checked while less than 64 assignments exist for less than six primary inputs
+        const auto lanesOfPartialBlock = isExhaustive ? numAssignments % BATCH_SIMULATION_LANE_COUNT : 0U;
+
+        std::optional<EquivalenceCheckingResult> resultOfDeviceCheck;
+        if (settings.useDeviceSimulation && isDeviceSimulationAvailable()) {
+            resultOfDeviceCheck = checkEquivalenceOnDevice(*lhsSimulationProgram, lhsPrimaryLines, *rhsSimulationProgram, rhsPrimaryLines, isExhaustive, numAssignments, settings.seed);
+        }
+
+        const auto checkBlocks = [&](const std::size_t thread, const std::uint64_t firstBlock, const std::uint64_t lastBlock, const std::atomic<bool>& isCounterexampleFound, ResultOfThread& resultOfThread) {
+            LaneSimulation             lhsSimulation(*lhsSimulationProgram, lhsPrimaryLines);
+            LaneSimulation             rhsSimulation(*rhsSimulationProgram, rhsPrimaryLines);
+            std::vector<std::uint64_t> laneValuesOfPrimaryInputs(numPrimaryInputs, 0U);
+            std::mt19937_64            generator(settings.seed + thread);
+
+            for (std::uint64_t block = firstBlock; block < lastBlock && !isCounterexampleFound; ++block) {
+                const std::uint64_t firstAssignment = block * BATCH_SIMULATION_LANE_COUNT;
+                for (std::size_t i = 0U; i < numPrimaryInputs; ++i) {
+                    if (!isExhaustive) {
+                        laneValuesOfPrimaryInputs[i] = generator();
+                    } else if (i < EXHAUSTIVE_LANE_PATTERNS.size()) {
+                        laneValuesOfPrimaryInputs[i] = EXHAUSTIVE_LANE_PATTERNS.at(i);
+                    } else {
+                        laneValuesOfPrimaryInputs[i] = ((firstAssignment >> i) & 1U) != 0U ? ~static_cast<std::uint64_t>(0U) : 0U;
+                    }
+                }
+                lhsSimulation.simulate(laneValuesOfPrimaryInputs);
+                rhsSimulation.simulate(laneValuesOfPrimaryInputs);
+
+                const bool          isPartialBlock = block + 1U == numBlocks && lanesOfPartialBlock != 0U;
+                const std::uint64_t checkedLanes   = isPartialBlock ? (static_cast<std::uint64_t>(1U) << lanesOfPartialBlock) - 1U : ~static_cast<std::uint64_t>(0U);
+                std::uint64_t       differingLanes = 0U;
+                for (std::size_t j = 0U; j < numPrimaryOutputs; ++j) {
+                    differingLanes |= lhsSimulation.laneValuesOfPrimaryOutput(j) ^ rhsSimulation.laneValuesOfPrimaryOutput(j);
+                }
+                differingLanes &= checkedLanes;
+
+                resultOfThread.numCheckedAssignments += static_cast<std::uint64_t>(std::popcount(checkedLanes));
+                if (differingLanes != 0U) {
+                    resultOfThread.counterexample = valuesOfLane(laneValuesOfPrimaryInputs, static_cast<std::size_t>(std::countr_zero(differingLanes)));
+                    return;
+                }
+            }
+        };
+
+        if (resultOfDeviceCheck.has_value()) {
+            result = std::move(*resultOfDeviceCheck);
+        } else {
+            auto resultOfCheck           = checkBlocksInParallel(numBlocks, settings.numThreads, checkBlocks);
+            result.numCheckedAssignments = resultOfCheck.numCheckedAssignments;
+            if (resultOfCheck.counterexample.has_value()) {
+                result.outcome        = EquivalenceCheckingResult::Outcome::NotEquivalent;
+                result.counterexample = std::move(*resultOfCheck.counterexample);
+            }
+        }
+
+        if (result.outcome == EquivalenceCheckingResult::Outcome::NotEquivalent) {
+            return result;
+        }
+        if (isExhaustive) {
+            result.outcome = EquivalenceCheckingResult::Outcome::Equivalent;
+        } else {
+            // the largest fraction p of non-equivalent assignments for which not detecting any of them in N samples, i.e. (1 - p)^N, is at least as likely as 1 - confidenceLevel
+            result.outcome                               = EquivalenceCheckingResult::Outcome::ProbablyEquivalent;
+            result.maxFractionOfNonEquivalentAssignments = result.numCheckedAssignments == 0U ? 1. : -std::expm1(std::log1p(-settings.confidenceLevel) / static_cast<double>(result.numCheckedAssignments));
+        }
+        return result;
+    }
+
+    auto checkEquivalence(const qc::QuantumComputation& quantumComputation, const TruthTable& tt, const EquivalenceCheckingSettings& settings) -> EquivalenceCheckingResult {
+        EquivalenceCheckingResult result;
+
+        const auto simulationProgram = SimulationProgram::compile(quantumComputation);
+        if (!simulationProgram.has_value()) {
+            result.outcome = EquivalenceCheckingResult::Outcome::NotSupported;
+            return result;
+        }
+
+        const PrimaryLines primaryLines = determinePrimaryLines(quantumComputation);
+        if (!tt.empty() && (tt.nPrimaryInputs() != primaryLines.inputQubits.size() || tt.nPrimaryOutputs() != primaryLines.outputQubits.size())) {
+            result.outcome = EquivalenceCheckingResult::Outcome::NotEquivalent;
+            return result;
+        }
+
+        // the entries assigning the value one to a constant line of the truth table do not specify the function on its primary inputs and are thus skipped
+        std::vector<std::pair<TruthTable::Cube, TruthTable::Cube>> entries;
+        entries.reserve(tt.size());
+        for (const auto& [input, output]: tt) {
+            bool isAnyConstantLineSet = false;
+            for (std::size_t i = 0U; i < input.size(); ++i) {
+                isAnyConstantLineSet |= tt.isConstant(input.size() - 1U - i) && input[i].value_or(false);
+            }
+            if (isAnyConstantLineSet) {
+                continue;
+            }
+            const auto filteredOutput = tt.filteredOutput(output);
+            for (const auto& completedInput: tt.filteredInput(input).completions()) {
+                entries.emplace_back(completedInput, filteredOutput);
+            }
+        }
+
+        const std::size_t numPrimaryInputs  = primaryLines.inputQubits.size();
+        const std::size_t numPrimaryOutputs = primaryLines.outputQubits.size();
+        const auto        numBlocks         = (static_cast<std::uint64_t>(entries.size()) + BATCH_SIMULATION_LANE_COUNT - 1U) / BATCH_SIMULATION_LANE_COUNT;
+
+        const auto checkBlocks = [&](const std::size_t, const std::uint64_t firstBlock, const std::uint64_t lastBlock, const std::atomic<bool>& isCounterexampleFound, ResultOfThread& resultOfThread) {
+            LaneSimulation             simulation(*simulationProgram, primaryLines);
+            std::vector<std::uint64_t> laneValuesOfPrimaryInputs(numPrimaryInputs, 0U);
+            std::vector<std::uint64_t> expectedLaneValuesOfPrimaryOutputs(numPrimaryOutputs, 0U);
+            std::vector<std::uint64_t> specifiedLanesOfPrimaryOutputs(numPrimaryOutputs, 0U);
+
+            for (std::uint64_t block = firstBlock; block < lastBlock && !isCounterexampleFound; ++block) {
+                std::ranges::fill(laneValuesOfPrimaryInputs, 0U);
+                std::ranges::fill(expectedLaneValuesOfPrimaryOutputs, 0U);
+                std::ranges::fill(specifiedLanesOfPrimaryOutputs, 0U);
+
+                const auto firstEntry = static_cast<std::size_t>(block * BATCH_SIMULATION_LANE_COUNT);
+                const auto numLanes   = std::min(BATCH_SIMULATION_LANE_COUNT, entries.size() - firstEntry);
+                for (std::size_t lane = 0U; lane < numLanes; ++lane) {
+                    const auto& [input, output] = entries[firstEntry + lane];
+                    for (std::size_t i = 0U; i < numPrimaryInputs; ++i) {
+                        laneValuesOfPrimaryInputs[i] |= static_cast<std::uint64_t>(input[i].value_or(false)) << lane;
+                    }
+                    for (std::size_t j = 0U; j < numPrimaryOutputs; ++j) {
+                        if (const auto value = output[j]; value.has_value()) {
+                            expectedLaneValuesOfPrimaryOutputs[j] |= static_cast<std::uint64_t>(*value) << lane;
+                            specifiedLanesOfPrimaryOutputs[j] |= static_cast<std::uint64_t>(1U) << lane;
+                        }
+                    }
+                }
+                simulation.simulate(laneValuesOfPrimaryInputs);
+
+                std::uint64_t differingLanes = 0U;
+                for (std::size_t j = 0U; j < numPrimaryOutputs; ++j) {
+                    differingLanes |= (simulation.laneValuesOfPrimaryOutput(j) ^ expectedLaneValuesOfPrimaryOutputs[j]) & specifiedLanesOfPrimaryOutputs[j];
+                }
+
+                resultOfThread.numCheckedAssignments += numLanes;
+                if (differingLanes != 0U) {
+                    resultOfThread.counterexample = valuesOfLane(laneValuesOfPrimaryInputs, static_cast<std::size_t>(std::countr_zero(differingLanes)));
+                    return;
+                }
+            }
+        };
+
+        auto resultOfCheck           = checkBlocksInParallel(numBlocks, settings.numThreads, checkBlocks);
+        result.numCheckedAssignments = resultOfCheck.numCheckedAssignments;
+        if (resultOfCheck.counterexample.has_value()) {
+            result.outcome        = EquivalenceCheckingResult::Outcome::NotEquivalent;
+            result.counterexample = std::move(*resultOfCheck.counterexample);
+        } else {
+            result.outcome = EquivalenceCheckingResult::Outcome::Equivalent;
+        }
+        return result;
+    }
+
+} // namespace syrec
@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/fault_simulation.hpp"
+
+#include "algorithms/simulation/simple_simulation.hpp"
+#include "algorithms/simulation/simulation_program.hpp"
+#include "core/diagnostics.hpp"
+#include "core/executor.hpp"
+#include "core/n_bit_values_container.hpp"
+#include "core/statistics.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    using TimeStamp = std::chrono::time_point<std::chrono::steady_clock>;
+
+    constexpr std::uint64_t ALL_LANES = ~static_cast<std::uint64_t>(0);
+
+    [[nodiscard]] std::uint64_t maskOfFirstLanes(const std::size_t numLanes) {
+        return numLanes >= BATCH_SIMULATION_LANE_COUNT ? ALL_LANES : (static_cast<std::uint64_t>(1) << numLanes) - 1U;
+    }
+
+    [[nodiscard]] bool isStuckAtFault(const ReversibleCircuitFault& fault) noexcept {
+        return fault.kind == ReversibleCircuitFault::Kind::StuckAtZero || fault.kind == ReversibleCircuitFault::Kind::StuckAtOne;
+    }
+
+    // Since X and SWAP gates are self-inverse, a gate repeated an even number of times has the same effect as a missing gate.
+    [[nodiscard]] bool isGateOfFaultNotApplied(const ReversibleCircuitFault& fault) noexcept {
+        return fault.kind == ReversibleCircuitFault::Kind::MissingGate || (fault.kind == ReversibleCircuitFault::Kind::RepeatedGate && fault.numRepetitions % 2U == 0U);
+    }
+
+    [[nodiscard]] bool isFaultValid(const ReversibleCircuitFault& fault, const SimulationProgram& simulationProgram) noexcept {
+        if (isStuckAtFault(fault)) {
+            return fault.gateIndex <= simulationProgram.getNumInstructions() && static_cast<std::size_t>(fault.qubit) < simulationProgram.getNumQubits();
+        }
+        return fault.gateIndex < simulationProgram.getNumInstructions() && (fault.kind != ReversibleCircuitFault::Kind::RepeatedGate || fault.numRepetitions != 0U);
+    }
+
+    void recordDetectingLanes(std::uint64_t detectingLanes, const std::size_t indexOfFirstLane, std::vector<std::size_t>& detectingIndices) {
+        for (; detectingLanes != 0U; detectingLanes &= detectingLanes - 1U) {
+            detectingIndices.emplace_back(indexOfFirstLane + static_cast<std::size_t>(std::countr_zero(detectingLanes)));
+        }
+    }
+
+    void packInputPatternsIntoLanes(const std::vector<NBitValuesContainer>& inputPatterns, const std::size_t firstPattern, const std::size_t numLanes, std::vector<std::uint64_t>& laneValuesPerQubit) {
+        std::ranges::fill(laneValuesPerQubit, 0U);
+        for (std::size_t lane = 0; lane < numLanes; ++lane) {
+            const NBitValuesContainer& inputPattern = inputPatterns[firstPattern + lane];
+            for (std::size_t qubit = 0; qubit < laneValuesPerQubit.size(); ++qubit) {
+                laneValuesPerQubit[qubit] |= static_cast<std::uint64_t>(inputPattern.testUnchecked(qubit)) << lane;
+            }
+        }
+    }
+
+    /**
+     * Simulate the faults of one thread (in ascending order of their gate index) for blocks of input patterns simulated in the lanes of a word. The state of the fault-free circuit is simulated up to the location
+     * of every fault, from which only the remainder of the faulty circuit needs to be simulated.
+     */
+    void simulateFaultsInParallelPatternMode(const SimulationProgram& simulationProgram, const std::vector<ReversibleCircuitFault>& faults, const std::vector<std::size_t>& indicesOfSimulatedFaults, const std::vector<NBitValuesContainer>& inputPatterns, FaultSimulationResult& result) {
+        const std::size_t          numQubits = simulationProgram.getNumQubits();
+        const std::size_t          numGates  = simulationProgram.getNumInstructions();
+        std::vector<std::uint64_t> inputLaneValuesPerQubit(numQubits, 0U);
+        std::vector<std::uint64_t> faultFreeOutputLaneValuesPerQubit(numQubits, 0U);
+        std::vector<std::uint64_t> faultFreeLaneValuesPerQubit(numQubits, 0U);
+        std::vector<std::uint64_t> faultyLaneValuesPerQubit(numQubits, 0U);
+
+        for (std::size_t firstPattern = 0; firstPattern < inputPatterns.size(); firstPattern += BATCH_SIMULATION_LANE_COUNT) {
+            const std::size_t   numLanes    = std::min(BATCH_SIMULATION_LANE_COUNT, inputPatterns.size() - firstPattern);
+            const std::uint64_t maskOfLanes = maskOfFirstLanes(numLanes);
+            packInputPatternsIntoLanes(inputPatterns, firstPattern, numLanes, inputLaneValuesPerQubit);
+
+            faultFreeOutputLaneValuesPerQubit = inputLaneValuesPerQubit;
+            for (std::size_t gateIndex = 0; gateIndex < numGates; ++gateIndex) {
+                simulationProgram.simulateInstruction(gateIndex, faultFreeOutputLaneValuesPerQubit, ALL_LANES);
+            }
+
+            faultFreeLaneValuesPerQubit = inputLaneValuesPerQubit;
+            std::size_t numSimulatedFaultFreeGates = 0;
+            for (const std::size_t faultIndex: indicesOfSimulatedFaults) {
+                const ReversibleCircuitFault& fault = faults[faultIndex];
+                for (; numSimulatedFaultFreeGates < fault.gateIndex; ++numSimulatedFaultFreeGates) {
+                    simulationProgram.simulateInstruction(numSimulatedFaultFreeGates, faultFreeLaneValuesPerQubit, ALL_LANES);
+                }
+
+                faultyLaneValuesPerQubit = faultFreeLaneValuesPerQubit;
+                std::size_t firstGateOfRemainder = fault.gateIndex;
+                if (isStuckAtFault(fault)) {
+                    faultyLaneValuesPerQubit[fault.qubit] = fault.kind == ReversibleCircuitFault::Kind::StuckAtOne ? ALL_LANES : 0U;
+                } else if (isGateOfFaultNotApplied(fault)) {
+                    ++firstGateOfRemainder;
+                }
+                for (std::size_t gateIndex = firstGateOfRemainder; gateIndex < numGates; ++gateIndex) {
+                    simulationProgram.simulateInstruction(gateIndex, faultyLaneValuesPerQubit, ALL_LANES);
+                }
+
+                std::uint64_t detectingLanes = 0U;
+                for (std::size_t qubit = 0; qubit < numQubits; ++qubit) {
+                    detectingLanes |= faultyLaneValuesPerQubit[qubit] ^ faultFreeOutputLaneValuesPerQubit[qubit];
+                }
+                recordDetectingLanes(detectingLanes & maskOfLanes, firstPattern, result.detectingPatternsPerFault[faultIndex]);
+            }
+        }
+    }
+
+    /**
+     * Simulate the faulty circuits of a group of up to 64 faults in the lanes of a word for every input pattern. A lane only applies a gate if its fault does not remove the latter while the
+     * value of a qubit stuck at a constant value is overwritten in the lanes of the stuck-at faults.
+     */
+    void simulateFaultsInParallelFaultMode(const SimulationProgram& simulationProgram, const std::vector<ReversibleCircuitFault>& faults, const std::size_t firstFaultOfGroup, const std::vector<NBitValuesContainer>& inputPatterns, const std::vector<NBitValuesContainer>& faultFreeOutputPatterns, FaultSimulationResult& result) {
+        struct StuckAtFaultOfLane {
+            std::size_t   gateIndex;
+            qc::Qubit     qubit;
+            std::uint64_t lanesStuckAtZero;
+            std::uint64_t lanesStuckAtOne;
+        };
+
+        const std::size_t   numQubits   = simulationProgram.getNumQubits();
+        const std::size_t   numGates    = simulationProgram.getNumInstructions();
+        const std::size_t   numLanes    = std::min(BATCH_SIMULATION_LANE_COUNT, faults.size() - firstFaultOfGroup);
+        const std::uint64_t maskOfLanes = maskOfFirstLanes(numLanes);
+
+        std::vector<std::uint64_t>        lanesApplyingGate(numGates, ALL_LANES);
+        std::vector<StuckAtFaultOfLane> stuckAtFaults;
+        for (std::size_t lane = 0; lane < numLanes; ++lane) {
+            const ReversibleCircuitFault& fault      = faults[firstFaultOfGroup + lane];
+            const std::uint64_t           maskOfLane  = static_cast<std::uint64_t>(1) << lane;
+            if (isGateOfFaultNotApplied(fault)) {
+                lanesApplyingGate[fault.gateIndex] &= ~maskOfLane;
+            } else if (isStuckAtFault(fault)) {
+                const bool isStuckAtOne = fault.kind == ReversibleCircuitFault::Kind::StuckAtOne;
+                stuckAtFaults.emplace_back(StuckAtFaultOfLane{.gateIndex = fault.gateIndex, .qubit = fault.qubit, .lanesStuckAtZero = isStuckAtOne ? 0U : maskOfLane, .lanesStuckAtOne = isStuckAtOne ? maskOfLane : 0U});
+            }
+        }
+        std::ranges::stable_sort(stuckAtFaults, {}, &StuckAtFaultOfLane::gateIndex);
+
+        std::vector<std::uint64_t> laneValuesPerQubit(numQubits, 0U);
+        for (std::size_t pattern = 0; pattern < inputPatterns.size(); ++pattern) {
+            for (std::size_t qubit = 0; qubit < numQubits; ++qubit) {
+                laneValuesPerQubit[qubit] = inputPatterns[pattern].testUnchecked(qubit) ? ALL_LANES : 0U;
+            }
+
+            auto nextStuckAtFault = stuckAtFaults.cbegin();
+            for (std::size_t gateIndex = 0; gateIndex <= numGates; ++gateIndex) {
+                for (; nextStuckAtFault != stuckAtFaults.cend() && nextStuckAtFault->gateIndex == gateIndex; ++nextStuckAtFault) {
+                    laneValuesPerQubit[nextStuckAtFault->qubit] = (laneValuesPerQubit[nextStuckAtFault->qubit] & ~nextStuckAtFault->lanesStuckAtZero) | nextStuckAtFault->lanesStuckAtOne;
+                }
+                if (gateIndex < numGates) {
+                    simulationProgram.simulateInstruction(gateIndex, laneValuesPerQubit, lanesApplyingGate[gateIndex]);
+                }
+            }
+
+            std::uint64_t detectingLanes = 0U;
+            for (std::size_t qubit = 0; qubit < numQubits; ++qubit) {
+                detectingLanes |= laneValuesPerQubit[qubit] ^ (faultFreeOutputPatterns[pattern].testUnchecked(qubit) ? ALL_LANES : 0U);
+            }
+            for (detectingLanes &= maskOfLanes; detectingLanes != 0U; detectingLanes &= detectingLanes - 1U) {
+                result.detectingPatternsPerFault[firstFaultOfGroup + static_cast<std::size_t>(std::countr_zero(detectingLanes))].emplace_back(pattern);
+            }
+        }
+    }
+} // namespace
+
+bool FaultSimulationResult::isFaultDetected(const std::size_t faultIndex) const {
+    return faultIndex < detectingPatternsPerFault.size() && !detectingPatternsPerFault[faultIndex].empty();
+}
+
+std::size_t FaultSimulationResult::getNumDetectedFaults() const {
+    return static_cast<std::size_t>(std::ranges::count_if(detectingPatternsPerFault, [](const std::vector<std::size_t>& detectingPatterns) { return !detectingPatterns.empty(); }));
+}
+
+std::vector<ReversibleCircuitFault> syrec::determineSingleFaults(const qc::QuantumComputation& quantumComputation) {
+    const std::optional<SimulationProgram> simulationProgram = SimulationProgram::compile(quantumComputation, false);
+    if (!simulationProgram.has_value()) {
+        return {};
+    }
+
+    const std::size_t                   numQubits = simulationProgram->getNumQubits();
+    const std::size_t                   numGates  = simulationProgram->getNumInstructions();
+    std::vector<ReversibleCircuitFault> faults;
+    faults.reserve(2U * numGates + 2U * numQubits * (numGates + 1U));
+    for (std::size_t gateIndex = 0; gateIndex <= numGates; ++gateIndex) {
+        for (std::size_t qubit = 0; qubit < numQubits; ++qubit) {
+            faults.emplace_back(ReversibleCircuitFault{.kind = ReversibleCircuitFault::Kind::StuckAtZero, .gateIndex = gateIndex, .qubit = static_cast<qc::Qubit>(qubit)});
+            faults.emplace_back(ReversibleCircuitFault{.kind = ReversibleCircuitFault::Kind::StuckAtOne, .gateIndex = gateIndex, .qubit = static_cast<qc::Qubit>(qubit)});
+        }
+        if (gateIndex < numGates) {
+            faults.emplace_back(ReversibleCircuitFault{.kind = ReversibleCircuitFault::Kind::MissingGate, .gateIndex = gateIndex});
+            faults.emplace_back(ReversibleCircuitFault{.kind = ReversibleCircuitFault::Kind::RepeatedGate, .gateIndex = gateIndex, .numRepetitions = 2U});
+        }
+    }
+    return faults;
+}
+
+bool syrec::faultSimulation(FaultSimulationResult& result, const qc::QuantumComputation& quantumComputation, const std::vector<ReversibleCircuitFault>& faults, const std::vector<NBitValuesContainer>& inputPatterns, const FaultSimulationSettings& settings, Statistics* optionalRecordedStatistics) {
+    result = FaultSimulationResult();
+
+    // Every gate is compiled into its own instruction since the faults are located at individual gates.
+    const std::optional<SimulationProgram> simulationProgram = SimulationProgram::compile(quantumComputation, false);
+    if (!simulationProgram.has_value()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < faults.size(); ++i) {
+        if (!isFaultValid(faults[i], *simulationProgram)) {
+            getErrorStream() << "Fault " << std::to_string(i) << " referenced a gate or qubit outside of the range of gates and qubits of the quantum computation\n";
+            return false;
+        }
+    }
+    for (std::size_t i = 0; i < inputPatterns.size(); ++i) {
+        if (inputPatterns[i].size() != simulationProgram->getNumQubits()) {
+            getErrorStream() << "Input pattern " << std::to_string(i) << " size (" << inputPatterns[i].size() << ") must match number of qubits of the quantum computation (" << simulationProgram->getNumQubits() << ")\n";
+            return false;
+        }
+    }
+
+    const TimeStamp simulationStartTime = std::chrono::steady_clock::now();
+    result.detectingPatternsPerFault.resize(faults.size());
+
+    const std::size_t numThreads = Executor::determineNumThreads(settings.numThreads);
+    if (settings.mode == FaultSimulationSettings::Mode::ParallelPattern) {
+        // The faults are assigned to the threads in a round-robin fashion to balance faults located at the start of the circuit, whose simulation is more expensive, between the threads.
+        const std::size_t numFaultPartitions = std::max<std::size_t>(1U, std::min(numThreads, faults.size()));
+        Executor::getShared().parallelFor(numFaultPartitions, [&](const std::size_t partition) {
+            std::vector<std::size_t> indicesOfSimulatedFaults;
+            for (std::size_t faultIndex = partition; faultIndex < faults.size(); faultIndex += numFaultPartitions) {
+                indicesOfSimulatedFaults.emplace_back(faultIndex);
+            }
+            std::ranges::stable_sort(indicesOfSimulatedFaults, {}, [&faults](const std::size_t faultIndex) { return faults[faultIndex].gateIndex; });
+            simulateFaultsInParallelPatternMode(*simulationProgram, faults, indicesOfSimulatedFaults, inputPatterns, result);
+        }, numFaultPartitions);
+    } else {
+        std::vector<NBitValuesContainer> faultFreeOutputPatterns = inputPatterns;
+        Executor::getShared().parallelFor(faultFreeOutputPatterns.size(), [&](const std::size_t pattern) { static_cast<void>(simulationProgram->simulate(faultFreeOutputPatterns[pattern])); }, numThreads);
+
+        const std::size_t numFaultGroups = (faults.size() + BATCH_SIMULATION_LANE_COUNT - 1U) / BATCH_SIMULATION_LANE_COUNT;
+        Executor::getShared().parallelFor(numFaultGroups, [&](const std::size_t faultGroup) { simulateFaultsInParallelFaultMode(*simulationProgram, faults, faultGroup * BATCH_SIMULATION_LANE_COUNT, inputPatterns, faultFreeOutputPatterns, result); }, numThreads);
+    }
+
+    const TimeStamp simulationEndTime = std::chrono::steady_clock::now();
+    if (optionalRecordedStatistics != nullptr) {
+        optionalRecordedStatistics->recordRuntime(simulationEndTime - simulationStartTime);
+    }
+    return true;
+}
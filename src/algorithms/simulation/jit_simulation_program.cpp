@@ -0,0 +1,499 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/jit_simulation_program.hpp"
+
+#include "algorithms/simulation/simulation_program.hpp"
+#include "core/hash_combine.hpp"
+#include "ir/Definitions.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#if defined(MQT_SYREC_ENABLE_JIT_SIMULATION) && defined(__x86_64__) && (defined(__linux__) || defined(__APPLE__))
+#define MQT_SYREC_JIT_SIMULATION_IS_SUPPORTED
+#include <cstring>
+#include <sys/mman.h>
+#endif
+
+using namespace syrec;
+
+namespace {
+    [[nodiscard]] std::uint64_t determineHashOfGates(const std::size_t numQubits, const SimulationProgram::GateArrays& gateArrays) {
+        std::size_t hash = std::hash<std::size_t>{}(numQubits);
+        for (std::size_t i = 0; i < gateArrays.isSwapGate.size(); ++i) {
+            hashCombine(hash, gateArrays.isSwapGate[i]);
+            hashCombine(hash, gateArrays.firstTargetQubits[i]);
+            hashCombine(hash, gateArrays.secondTargetQubits[i]);
+            hashCombine(hash, gateArrays.controlOffsets[i + 1]);
+        }
+        for (std::size_t i = 0; i < gateArrays.controlQubits.size(); ++i) {
+            hashCombine(hash, (static_cast<std::uint64_t>(gateArrays.controlQubits[i]) << 1U) | gateArrays.controlPolarities[i]);
+        }
+        return hash;
+    }
+
+#ifdef MQT_SYREC_JIT_SIMULATION_IS_SUPPORTED
+    /*
+     * The generated code uses the System V calling convention with the lane words of the qubits being addressed relative to the first argument (RDI). The lane words of qubit q are stored in the 256-bit value at [RDI + q * 32].
+     * Registers YMM0 to YMM12 store the lane values of qubits, YMM13 and YMM14 are scratch registers and YMM15 stores a value with all bits set.
+     */
+    constexpr unsigned NUM_QUBIT_REGISTERS       = 13U;
+    constexpr unsigned SCRATCH_REGISTER          = 13U;
+    constexpr unsigned CONDITION_REGISTER        = 14U;
+    constexpr unsigned ALL_BITS_SET_REGISTER     = 15U;
+    constexpr unsigned NUM_BYTES_OF_LANE_VALUES  = 32U;
+    constexpr auto     NO_FURTHER_USE_OF_QUBIT   = std::numeric_limits<std::size_t>::max();
+    constexpr auto     QUBIT_NOT_IN_ANY_REGISTER = std::numeric_limits<unsigned>::max();
+
+    // The opcodes (in the 0F opcode map) of the used VEX encoded AVX2 instructions
+    enum class VectorOperation : std::uint8_t {
+        Xor            = 0xEF,
+        And            = 0xDB,
+        AndNot         = 0xDF,
+        CompareEqual   = 0x76,
+        LoadUnaligned  = 0x6F,
+        StoreUnaligned = 0x7F,
+    };
+
+    /**
+     * An emitter of the few AVX2 instructions required to simulate the gates of a simulation program, all instructions operate on the 256-bit YMM registers and use a three byte VEX prefix.
+     */
+    class Avx2CodeEmitter {
+    public:
+        /**
+         * A second source operand of a vector operation that is either a YMM register or the lane values of a qubit in memory.
+         */
+        struct Operand {
+            bool      isRegister;
+            unsigned  vectorRegister;
+            qc::Qubit qubit;
+        };
+
+        void emitLoad(const unsigned destinationRegister, const qc::Qubit qubit) {
+            emitInstruction(VectorOperation::LoadUnaligned, true, destinationRegister, 0U, Operand{.isRegister = false, .vectorRegister = 0U, .qubit = qubit});
+        }
+
+        void emitStore(const qc::Qubit qubit, const unsigned sourceRegister) {
+            emitInstruction(VectorOperation::StoreUnaligned, true, sourceRegister, 0U, Operand{.isRegister = false, .vectorRegister = 0U, .qubit = qubit});
+        }
+
+        // destination = firstSource <op> secondSource, with AndNot computing ~firstSource & secondSource
+        void emitOperation(const VectorOperation operation, const unsigned destinationRegister, const unsigned firstSourceRegister, const Operand& secondSource) {
+            emitInstruction(operation, false, destinationRegister, firstSourceRegister, secondSource);
+        }
+
+        void emitEpilogue() {
+            // VZEROUPPER avoids the penalty of transitions between AVX and SSE code in the caller
+            code.insert(code.end(), {0xC5, 0xF8, 0x77, 0xC3});
+        }
+
+        [[nodiscard]] const std::vector<std::uint8_t>& getCode() const noexcept {
+            return code;
+        }
+
+    protected:
+        std::vector<std::uint8_t> code;
+
+        void emitInstruction(const VectorOperation operation, const bool isMove, const unsigned registerOperand, const unsigned firstSourceRegister, const Operand& operandOfModRm) {
+            const bool isExtendedRegisterOperand = registerOperand >= 8U;
+            const bool isExtendedModRmRegister   = operandOfModRm.isRegister && operandOfModRm.vectorRegister >= 8U;
+            // The R, X, B bits and the source register in the VEX prefix are stored in inverted form, moves use the implied F3 prefix (VMOVDQU) while all other operations use the implied 66 prefix.
+            code.emplace_back(0xC4);
+            code.emplace_back(static_cast<std::uint8_t>((isExtendedRegisterOperand ? 0x00U : 0x80U) | 0x40U | (isExtendedModRmRegister ? 0x00U : 0x20U) | 0x01U));
+            code.emplace_back(static_cast<std::uint8_t>(((~(isMove ? 0U : firstSourceRegister) & 0x0FU) << 3U) | 0x04U | (isMove ? 0x02U : 0x01U)));
+            code.emplace_back(static_cast<std::uint8_t>(operation));
+            if (operandOfModRm.isRegister) {
+                code.emplace_back(static_cast<std::uint8_t>(0xC0U | ((registerOperand & 0x07U) << 3U) | (operandOfModRm.vectorRegister & 0x07U)));
+                return;
+            }
+            // [RDI + disp32]
+            const auto displacement = static_cast<std::uint32_t>(operandOfModRm.qubit * NUM_BYTES_OF_LANE_VALUES);
+            code.emplace_back(static_cast<std::uint8_t>(0x80U | ((registerOperand & 0x07U) << 3U) | 0x07U));
+            for (unsigned i = 0; i < 4U; ++i) {
+                code.emplace_back(static_cast<std::uint8_t>((displacement >> (8U * i)) & 0xFFU));
+            }
+        }
+    };
+
+    /**
+     * The assignment of qubits to the YMM registers storing lane values, a qubit is evicted from the registers if all registers are occupied and none of the qubits stored in the registers is used
+     * later than the evicted qubit by the following gates (Belady's algorithm).
+     */
+    class QubitRegisterAllocator {
+    public:
+        QubitRegisterAllocator(Avx2CodeEmitter& emitter, const std::size_t numQubits, const SimulationProgram::GateArrays& gateArrays):
+            emitter(emitter), registerOfQubit(numQubits, QUBIT_NOT_IN_ANY_REGISTER), gatesUsingQubit(numQubits), indexOfNextUseOfQubit(numQubits, 0U) {
+            for (std::size_t gateIndex = 0; gateIndex < gateArrays.isSwapGate.size(); ++gateIndex) {
+                forEachQubitOfGate(gateArrays, gateIndex, [&](const qc::Qubit qubit) { gatesUsingQubit[qubit].emplace_back(gateIndex); });
+            }
+        }
+
+        /**
+         * Assign a register to a qubit used by the current gate, loading the lane values of the qubit if it was not stored in any register.
+         * @return The register storing the qubit, std::nullopt if all registers were pinned by the current gate.
+         */
+        [[nodiscard]] std::optional<unsigned> acquireRegister(const qc::Qubit qubit) {
+            if (registerOfQubit[qubit] != QUBIT_NOT_IN_ANY_REGISTER) {
+                isPinned[registerOfQubit[qubit]] = true;
+                return registerOfQubit[qubit];
+            }
+
+            const std::optional<unsigned> freeRegister = determineRegisterToEvict();
+            if (!freeRegister.has_value()) {
+                return std::nullopt;
+            }
+            evict(*freeRegister);
+            emitter.emitLoad(*freeRegister, qubit);
+            ++numMemoryAccesses;
+            qubitOfRegister[*freeRegister] = qubit;
+            registerOfQubit[qubit]         = *freeRegister;
+            isPinned[*freeRegister]        = true;
+            return *freeRegister;
+        }
+
+        /**
+         * Determine the operand of a control qubit of the current gate, the control qubit is only loaded into a register if it is used again earlier than any of the qubits that would need to be evicted.
+         */
+        [[nodiscard]] Avx2CodeEmitter::Operand determineOperandOfControlQubit(const qc::Qubit qubit) {
+            if (registerOfQubit[qubit] == QUBIT_NOT_IN_ANY_REGISTER) {
+                const std::optional<unsigned> registerToEvict = determineRegisterToEvict();
+                if (!registerToEvict.has_value() || (qubitOfRegister[*registerToEvict].has_value() && determineNextUseOfQubit(*qubitOfRegister[*registerToEvict]) <= determineUseOfQubitAfterCurrentGate(qubit))) {
+                    ++numMemoryAccesses;
+                    return Avx2CodeEmitter::Operand{.isRegister = false, .vectorRegister = 0U, .qubit = qubit};
+                }
+            }
+            // A register is available since the qubit was either already stored in a register or a register could be evicted.
+            return Avx2CodeEmitter::Operand{.isRegister = true, .vectorRegister = *acquireRegister(qubit), .qubit = qubit};
+        }
+
+        void markAsModified(const unsigned vectorRegister) {
+            isModified[vectorRegister] = true;
+        }
+
+        /**
+         * Exchange the qubits stored in two registers, which implements an uncontrolled SWAP gate without any instruction.
+         */
+        void exchangeQubitsOfRegisters(const unsigned firstRegister, const unsigned secondRegister) {
+            std::swap(qubitOfRegister[firstRegister], qubitOfRegister[secondRegister]);
+            registerOfQubit[*qubitOfRegister[firstRegister]]  = firstRegister;
+            registerOfQubit[*qubitOfRegister[secondRegister]] = secondRegister;
+            isModified[firstRegister]                         = true;
+            isModified[secondRegister]                        = true;
+        }
+
+        /**
+         * Unpin all registers and advance the next uses of the qubits of the current gate.
+         */
+        void completeGate(const SimulationProgram::GateArrays& gateArrays, const std::size_t gateIndex) {
+            isPinned.fill(false);
+            forEachQubitOfGate(gateArrays, gateIndex, [&](const qc::Qubit qubit) { ++indexOfNextUseOfQubit[qubit]; });
+        }
+
+        /**
+         * Store the lane values of all modified qubits stored in registers.
+         */
+        void storeModifiedQubits() {
+            for (unsigned vectorRegister = 0; vectorRegister < NUM_QUBIT_REGISTERS; ++vectorRegister) {
+                evict(vectorRegister);
+            }
+        }
+
+        [[nodiscard]] std::size_t getNumMemoryAccesses() const noexcept {
+            return numMemoryAccesses;
+        }
+
+    protected:
+        Avx2CodeEmitter&                                          emitter;
+        std::array<std::optional<qc::Qubit>, NUM_QUBIT_REGISTERS> qubitOfRegister{};
+        std::array<bool, NUM_QUBIT_REGISTERS>                     isModified{};
+        std::array<bool, NUM_QUBIT_REGISTERS>                     isPinned{};
+        std::vector<unsigned>                                     registerOfQubit;
+        std::vector<std::vector<std::size_t>>                     gatesUsingQubit;
+        std::vector<std::size_t>                                  indexOfNextUseOfQubit;
+        std::size_t                                               numMemoryAccesses = 0;
+
+        template<typename Callback>
+        static void forEachQubitOfGate(const SimulationProgram::GateArrays& gateArrays, const std::size_t gateIndex, const Callback& callback) {
+            callback(gateArrays.firstTargetQubits[gateIndex]);
+            if (gateArrays.isSwapGate[gateIndex] != 0U) {
+                callback(gateArrays.secondTargetQubits[gateIndex]);
+            }
+            for (std::uint32_t i = gateArrays.controlOffsets[gateIndex]; i < gateArrays.controlOffsets[gateIndex + 1]; ++i) {
+                callback(gateArrays.controlQubits[i]);
+            }
+        }
+
+        // The index of the next gate using a qubit not used by the current gate
+        [[nodiscard]] std::size_t determineNextUseOfQubit(const qc::Qubit qubit) const {
+            const std::vector<std::size_t>& gates = gatesUsingQubit[qubit];
+            return indexOfNextUseOfQubit[qubit] < gates.size() ? gates[indexOfNextUseOfQubit[qubit]] : NO_FURTHER_USE_OF_QUBIT;
+        }
+
+        // The index of the next gate using a qubit of the current gate after the latter
+        [[nodiscard]] std::size_t determineUseOfQubitAfterCurrentGate(const qc::Qubit qubit) const {
+            const std::vector<std::size_t>& gates = gatesUsingQubit[qubit];
+            return indexOfNextUseOfQubit[qubit] + 1U < gates.size() ? gates[indexOfNextUseOfQubit[qubit] + 1U] : NO_FURTHER_USE_OF_QUBIT;
+        }
+
+        [[nodiscard]] std::optional<unsigned> determineRegisterToEvict() const {
+            std::optional<unsigned> registerToEvict;
+            std::size_t             nextUseOfEvictedQubit = 0;
+            for (unsigned vectorRegister = 0; vectorRegister < NUM_QUBIT_REGISTERS; ++vectorRegister) {
+                if (!qubitOfRegister[vectorRegister].has_value()) {
+                    return vectorRegister;
+                }
+                if (isPinned[vectorRegister]) {
+                    continue;
+                }
+                if (const std::size_t nextUse = determineNextUseOfQubit(*qubitOfRegister[vectorRegister]); !registerToEvict.has_value() || nextUse > nextUseOfEvictedQubit) {
+                    registerToEvict       = vectorRegister;
+                    nextUseOfEvictedQubit = nextUse;
+                }
+            }
+            return registerToEvict;
+        }
+
+        void evict(const unsigned vectorRegister) {
+            if (!qubitOfRegister[vectorRegister].has_value()) {
+                return;
+            }
+            if (isModified[vectorRegister]) {
+                emitter.emitStore(*qubitOfRegister[vectorRegister], vectorRegister);
+                ++numMemoryAccesses;
+            }
+            registerOfQubit[*qubitOfRegister[vectorRegister]] = QUBIT_NOT_IN_ANY_REGISTER;
+            qubitOfRegister[vectorRegister].reset();
+            isModified[vectorRegister] = false;
+        }
+    };
+
+    /**
+     * Emit the conjunction of the controls of a gate into the condition register (or reuse the register of a single positive control qubit).
+     * @return The register storing the lanes in which all controls of the gate are satisfied.
+     */
+    [[nodiscard]] unsigned emitConditionOfGate(Avx2CodeEmitter& emitter, QubitRegisterAllocator& registerAllocator, const SimulationProgram::GateArrays& gateArrays, const std::size_t gateIndex) {
+        std::optional<unsigned> registerOfCondition;
+        // The positive controls are combined first since they can be used as memory operands while a negated control must be stored in a register.
+        for (const bool isPositiveControl: {true, false}) {
+            for (std::uint32_t i = gateArrays.controlOffsets[gateIndex]; i < gateArrays.controlOffsets[gateIndex + 1]; ++i) {
+                if ((gateArrays.controlPolarities[i] != 0U) != isPositiveControl) {
+                    continue;
+                }
+
+                const Avx2CodeEmitter::Operand controlOperand = registerAllocator.determineOperandOfControlQubit(gateArrays.controlQubits[i]);
+                if (isPositiveControl) {
+                    if (!registerOfCondition.has_value() && controlOperand.isRegister) {
+                        registerOfCondition = controlOperand.vectorRegister;
+                    } else if (!registerOfCondition.has_value()) {
+                        emitter.emitLoad(CONDITION_REGISTER, controlOperand.qubit);
+                        registerOfCondition = CONDITION_REGISTER;
+                    } else {
+                        emitter.emitOperation(VectorOperation::And, CONDITION_REGISTER, *registerOfCondition, controlOperand);
+                        registerOfCondition = CONDITION_REGISTER;
+                    }
+                    continue;
+                }
+
+                if (!registerOfCondition.has_value()) {
+                    emitter.emitOperation(VectorOperation::Xor, CONDITION_REGISTER, ALL_BITS_SET_REGISTER, controlOperand);
+                } else {
+                    unsigned registerOfControl = controlOperand.vectorRegister;
+                    if (!controlOperand.isRegister) {
+                        emitter.emitLoad(SCRATCH_REGISTER, controlOperand.qubit);
+                        registerOfControl = SCRATCH_REGISTER;
+                    }
+                    emitter.emitOperation(VectorOperation::AndNot, CONDITION_REGISTER, registerOfControl, Avx2CodeEmitter::Operand{.isRegister = true, .vectorRegister = *registerOfCondition, .qubit = 0U});
+                }
+                registerOfCondition = CONDITION_REGISTER;
+            }
+        }
+        return registerOfCondition.value_or(ALL_BITS_SET_REGISTER);
+    }
+
+    [[nodiscard]] std::optional<std::vector<std::uint8_t>> generateNativeCode(const std::size_t numQubits, const SimulationProgram::GateArrays& gateArrays, std::size_t& numMemoryAccesses) {
+        // The displacement of the lane values of every qubit must be representable as a signed 32-bit integer.
+        if (numQubits > static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max()) / NUM_BYTES_OF_LANE_VALUES) {
+            return std::nullopt;
+        }
+
+        Avx2CodeEmitter        emitter;
+        QubitRegisterAllocator registerAllocator(emitter, numQubits, gateArrays);
+        const auto             asRegisterOperand = [](const unsigned vectorRegister) { return Avx2CodeEmitter::Operand{.isRegister = true, .vectorRegister = vectorRegister, .qubit = 0U}; };
+
+        emitter.emitOperation(VectorOperation::CompareEqual, ALL_BITS_SET_REGISTER, ALL_BITS_SET_REGISTER, asRegisterOperand(ALL_BITS_SET_REGISTER));
+        for (std::size_t gateIndex = 0; gateIndex < gateArrays.isSwapGate.size(); ++gateIndex) {
+            const bool                    isSwapGate           = gateArrays.isSwapGate[gateIndex] != 0U;
+            const std::optional<unsigned> firstTargetRegister  = registerAllocator.acquireRegister(gateArrays.firstTargetQubits[gateIndex]);
+            const std::optional<unsigned> secondTargetRegister = isSwapGate ? registerAllocator.acquireRegister(gateArrays.secondTargetQubits[gateIndex]) : firstTargetRegister;
+            if (!firstTargetRegister.has_value() || !secondTargetRegister.has_value()) {
+                return std::nullopt;
+            }
+
+            const bool     isControlledGate    = gateArrays.controlOffsets[gateIndex] != gateArrays.controlOffsets[gateIndex + 1];
+            const unsigned registerOfCondition = emitConditionOfGate(emitter, registerAllocator, gateArrays, gateIndex);
+            if (!isSwapGate) {
+                emitter.emitOperation(VectorOperation::Xor, *firstTargetRegister, *firstTargetRegister, asRegisterOperand(registerOfCondition));
+                registerAllocator.markAsModified(*firstTargetRegister);
+            } else if (!isControlledGate) {
+                registerAllocator.exchangeQubitsOfRegisters(*firstTargetRegister, *secondTargetRegister);
+            } else {
+                // The lanes in which the values of the target qubits differ and the controls are satisfied are flipped in both target qubits.
+                emitter.emitOperation(VectorOperation::Xor, SCRATCH_REGISTER, *firstTargetRegister, asRegisterOperand(*secondTargetRegister));
+                emitter.emitOperation(VectorOperation::And, SCRATCH_REGISTER, SCRATCH_REGISTER, asRegisterOperand(registerOfCondition));
+                emitter.emitOperation(VectorOperation::Xor, *firstTargetRegister, *firstTargetRegister, asRegisterOperand(SCRATCH_REGISTER));
+                emitter.emitOperation(VectorOperation::Xor, *secondTargetRegister, *secondTargetRegister, asRegisterOperand(SCRATCH_REGISTER));
+                registerAllocator.markAsModified(*firstTargetRegister);
+                registerAllocator.markAsModified(*secondTargetRegister);
+            }
+            registerAllocator.completeGate(gateArrays, gateIndex);
+        }
+        registerAllocator.storeModifiedQubits();
+        emitter.emitEpilogue();
+
+        numMemoryAccesses = registerAllocator.getNumMemoryAccesses();
+        return emitter.getCode();
+    }
+
+    [[nodiscard]] std::shared_ptr<const void> createExecutableMemory(const std::vector<std::uint8_t>& code) {
+        void* memory = mmap(nullptr, code.size(), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (memory == MAP_FAILED) {
+            return nullptr;
+        }
+        std::memcpy(memory, code.data(), code.size());
+        const std::size_t sizeOfMemory = code.size();
+        if (mprotect(memory, sizeOfMemory, PROT_READ | PROT_EXEC) != 0) {
+            munmap(memory, sizeOfMemory);
+            return nullptr;
+        }
+        return {memory, [sizeOfMemory](const void* mappedMemory) { munmap(const_cast<void*>(mappedMemory), sizeOfMemory); }};
+    }
+#endif
+} // namespace
+
+JitSimulationProgram JitSimulationProgram::compile(const SimulationProgram& simulationProgram) {
+    JitSimulationProgram jitSimulationProgram(simulationProgram);
+#ifdef MQT_SYREC_JIT_SIMULATION_IS_SUPPORTED
+    if (!isNativeCodeGenerationAvailable()) {
+        return jitSimulationProgram;
+    }
+
+    std::size_t                                    numMemoryAccesses = 0;
+    const std::optional<std::vector<std::uint8_t>> code              = generateNativeCode(simulationProgram.getNumQubits(), simulationProgram.exportGateArrays(), numMemoryAccesses);
+    if (!code.has_value()) {
+        return jitSimulationProgram;
+    }
+    if (std::shared_ptr<const void> nativeCode = createExecutableMemory(*code); nativeCode != nullptr) {
+        jitSimulationProgram.nativeFunction                = reinterpret_cast<NativeFunction>(const_cast<void*>(nativeCode.get()));
+        jitSimulationProgram.nativeCode                    = std::move(nativeCode);
+        jitSimulationProgram.nativeCodeSize                = code->size();
+        jitSimulationProgram.numMemoryAccessesOfNativeCode = numMemoryAccesses;
+    }
+#endif
+    return jitSimulationProgram;
+}
+
+bool JitSimulationProgram::isNativeCodeGenerationAvailable() noexcept {
+#ifdef MQT_SYREC_JIT_SIMULATION_IS_SUPPORTED
+    return __builtin_cpu_supports("avx2") != 0;
+#else
+    return false;
+#endif
+}
+
+bool JitSimulationProgram::simulate(const std::span<std::uint64_t> laneWordsPerQubit) const {
+    const std::size_t numQubits = simulationProgram.getNumQubits();
+    if (laneWordsPerQubit.size() != numQubits * NUM_LANE_WORDS_PER_QUBIT) {
+        return false;
+    }
+    if (nativeFunction != nullptr) {
+        nativeFunction(laneWordsPerQubit.data());
+        return true;
+    }
+
+    // The translated simulation program is interpreted for every lane word separately.
+    std::vector<std::uint64_t> laneValuesPerQubit(numQubits, 0U);
+    for (std::size_t laneWord = 0; laneWord < NUM_LANE_WORDS_PER_QUBIT; ++laneWord) {
+        for (std::size_t qubit = 0; qubit < numQubits; ++qubit) {
+            laneValuesPerQubit[qubit] = laneWordsPerQubit[(qubit * NUM_LANE_WORDS_PER_QUBIT) + laneWord];
+        }
+        if (!simulationProgram.simulate(laneValuesPerQubit)) {
+            return false;
+        }
+        for (std::size_t qubit = 0; qubit < numQubits; ++qubit) {
+            laneWordsPerQubit[(qubit * NUM_LANE_WORDS_PER_QUBIT) + laneWord] = laneValuesPerQubit[qubit];
+        }
+    }
+    return true;
+}
+
+std::shared_ptr<const JitSimulationProgram> JitSimulationProgramCache::getOrCompile(const SimulationProgram& simulationProgram) {
+    SimulationProgram::GateArrays gateArrays        = simulationProgram.exportGateArrays();
+    const std::size_t             numQubits         = simulationProgram.getNumQubits();
+    const std::uint64_t           hash              = determineHashOfGates(numQubits, gateArrays);
+    const auto                    findCachedProgram = [&]() -> std::shared_ptr<const JitSimulationProgram> {
+        const auto cachedProgramsWithHash = cachedProgramsPerHash.find(hash);
+        if (cachedProgramsWithHash == cachedProgramsPerHash.end()) {
+            return nullptr;
+        }
+        const auto cachedProgram = std::ranges::find_if(cachedProgramsWithHash->second, [&](const CachedProgram& candidate) { return candidate.numQubits == numQubits && candidate.gateArrays == gateArrays; });
+        return cachedProgram != cachedProgramsWithHash->second.end() ? cachedProgram->program : nullptr;
+    };
+
+    {
+        const std::scoped_lock lock(mutex);
+        if (std::shared_ptr<const JitSimulationProgram> cachedProgram = findCachedProgram(); cachedProgram != nullptr) {
+            ++numCacheHits;
+            return cachedProgram;
+        }
+        ++numCacheMisses;
+    }
+
+    // The translation is performed without holding the lock, thus a program translated concurrently by another thread is preferred to keep a single program per hash and gates.
+    auto                   compiledProgram = std::make_shared<const JitSimulationProgram>(JitSimulationProgram::compile(simulationProgram));
+    const std::scoped_lock lock(mutex);
+    if (std::shared_ptr<const JitSimulationProgram> cachedProgram = findCachedProgram(); cachedProgram != nullptr) {
+        return cachedProgram;
+    }
+    cachedProgramsPerHash[hash].emplace_back(CachedProgram{.numQubits = numQubits, .gateArrays = std::move(gateArrays), .program = compiledProgram});
+    ++numCachedPrograms;
+    return compiledProgram;
+}
+
+void JitSimulationProgramCache::clear() {
+    const std::scoped_lock lock(mutex);
+    cachedProgramsPerHash.clear();
+    numCachedPrograms = 0;
+}
+
+std::size_t JitSimulationProgramCache::getNumCachedPrograms() const {
+    const std::scoped_lock lock(mutex);
+    return numCachedPrograms;
+}
+
+std::size_t JitSimulationProgramCache::getNumCacheHits() const {
+    const std::scoped_lock lock(mutex);
+    return numCacheHits;
+}
+
+std::size_t JitSimulationProgramCache::getNumCacheMisses() const {
+    const std::scoped_lock lock(mutex);
+    return numCacheMisses;
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/output_cone_simulation.hpp"
+
+#include "algorithms/simulation/simple_simulation.hpp"
+#include "algorithms/simulation/simulation_program.hpp"
+#include "core/n_bit_values_container.hpp"
+#include "core/statistics.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    using TimeStamp = std::chrono::time_point<std::chrono::steady_clock>;
+
+    [[nodiscard]] std::shared_ptr<const SimulationProgram> compileOutputCone(const qc::QuantumComputation& quantumComputation, const std::span<const qc::Qubit> outputQubits, OutputConeSimulationProgramCache* optionalCache) {
+        if (optionalCache != nullptr) {
+            return optionalCache->getOrCompile(quantumComputation, outputQubits);
+        }
+        std::optional<SimulationProgram> simulationProgram = SimulationProgram::compileOutputCone(quantumComputation, outputQubits);
+        return simulationProgram.has_value() ? std::make_shared<const SimulationProgram>(std::move(*simulationProgram)) : nullptr;
+    }
+} // namespace
+
+std::shared_ptr<const SimulationProgram> OutputConeSimulationProgramCache::getOrCompile(const qc::QuantumComputation& quantumComputation, const std::span<const qc::Qubit> outputQubits) {
+    CacheKey key{.quantumComputation = &quantumComputation, .numOperations = quantumComputation.getNops(), .outputQubits = std::vector<qc::Qubit>(outputQubits.begin(), outputQubits.end())};
+    std::ranges::sort(key.outputQubits);
+    const auto [firstDuplicate, lastDuplicate] = std::ranges::unique(key.outputQubits);
+    key.outputQubits.erase(firstDuplicate, lastDuplicate);
+
+    if (const auto cachedProgram = cachedPrograms.find(key); cachedProgram != cachedPrograms.end()) {
+        ++numCacheHits;
+        return cachedProgram->second;
+    }
+
+    ++numCacheMisses;
+    std::optional<SimulationProgram> simulationProgram = SimulationProgram::compileOutputCone(quantumComputation, key.outputQubits);
+    if (!simulationProgram.has_value()) {
+        return nullptr;
+    }
+    auto compiledProgram = std::make_shared<const SimulationProgram>(std::move(*simulationProgram));
+    cachedPrograms.emplace(std::move(key), compiledProgram);
+    return compiledProgram;
+}
+
+void OutputConeSimulationProgramCache::clear() {
+    cachedPrograms.clear();
+}
+
+void syrec::outputConeSimulation(NBitValuesContainer& output, const qc::QuantumComputation& quantumComputation, const NBitValuesContainer& input, const std::span<const qc::Qubit> outputQubits, OutputConeSimulationProgramCache* optionalCache, Statistics* optionalRecordedStatistics) {
+    const TimeStamp simulationStartTime = std::chrono::steady_clock::now();
+
+    const std::shared_ptr<const SimulationProgram> simulationProgram = compileOutputCone(quantumComputation, outputQubits, optionalCache);
+    if (simulationProgram == nullptr) {
+        return;
+    }
+    simpleSimulation(output, *simulationProgram, input);
+
+    const TimeStamp simulationEndTime = std::chrono::steady_clock::now();
+    if (optionalRecordedStatistics != nullptr) {
+        optionalRecordedStatistics->recordRuntime(simulationEndTime - simulationStartTime);
+    }
+}
+
+void syrec::outputConeBatchSimulation(std::vector<NBitValuesContainer>& outputs, const qc::QuantumComputation& quantumComputation, const std::vector<NBitValuesContainer>& inputs, const std::span<const qc::Qubit> outputQubits, OutputConeSimulationProgramCache* optionalCache, Statistics* optionalRecordedStatistics) {
+    outputs.clear();
+    const TimeStamp simulationStartTime = std::chrono::steady_clock::now();
+
+    const std::shared_ptr<const SimulationProgram> simulationProgram = compileOutputCone(quantumComputation, outputQubits, optionalCache);
+    if (simulationProgram == nullptr) {
+        return;
+    }
+    batchSimulation(outputs, *simulationProgram, inputs);
+
+    const TimeStamp simulationEndTime = std::chrono::steady_clock::now();
+    if (optionalRecordedStatistics != nullptr) {
+        optionalRecordedStatistics->recordRuntime(simulationEndTime - simulationStartTime);
+    }
+}
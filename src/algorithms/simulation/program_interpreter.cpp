@@ -0,0 +1,772 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/program_interpreter.hpp"
+
+#include "core/configurable_options.hpp"
+#include "core/diagnostics.hpp"
+#include "core/executor.hpp"
+#include "core/statistics.hpp"
+#include "core/syrec/expression.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/parser/utils/syrec_operation_utils.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <ostream>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    using TimeStamp = std::chrono::time_point<std::chrono::steady_clock>;
+
+    // The bitwidth assumed for an integer constant whose bitwidth is not restricted by the enclosing operation.
+    constexpr unsigned DEFAULT_BITWIDTH_OF_INTEGER_CONSTANTS = 32U;
+
+    [[nodiscard]] constexpr std::uint64_t determineBitmaskOfBitwidth(const unsigned bitwidth) noexcept {
+        return bitwidth >= 64U ? ~static_cast<std::uint64_t>(0) : (static_cast<std::uint64_t>(1) << bitwidth) - 1U;
+    }
+
+    [[nodiscard]] constexpr unsigned determineNumberOfBitsRequiredToStoreValue(const unsigned value) noexcept {
+        return std::max(1U, static_cast<unsigned>(std::bit_width(value)));
+    }
+
+    [[nodiscard]] std::size_t determineNumberOfElementsInVariable(const Variable& variable) {
+        std::size_t numElements = 1U;
+        for (const unsigned numValuesOfDimension: variable.dimensions) {
+            numElements *= numValuesOfDimension;
+        }
+        return numElements;
+    }
+
+    [[nodiscard]] constexpr bool isBinaryOperationLogicalOperation(const BinaryExpression::BinaryOperation binaryOperation) noexcept {
+        return binaryOperation == BinaryExpression::BinaryOperation::LogicalAnd || binaryOperation == BinaryExpression::BinaryOperation::LogicalOr;
+    }
+
+    [[nodiscard]] constexpr bool isBinaryOperationWithSingleBitResult(const BinaryExpression::BinaryOperation binaryOperation) noexcept {
+        switch (binaryOperation) {
+            case BinaryExpression::BinaryOperation::LogicalAnd:
+            case BinaryExpression::BinaryOperation::LogicalOr:
+            case BinaryExpression::BinaryOperation::LessThan:
+            case BinaryExpression::BinaryOperation::GreaterThan:
+            case BinaryExpression::BinaryOperation::Equals:
+            case BinaryExpression::BinaryOperation::NotEquals:
+            case BinaryExpression::BinaryOperation::LessEquals:
+            case BinaryExpression::BinaryOperation::GreaterEquals:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    /**
+     * Evaluate a binary operation whose operands have the given bitwidth. The fractional division is not supported since it cannot be synthesized either.
+     */
+    [[nodiscard]] std::optional<std::uint64_t> evaluateBinaryOperation(const std::uint64_t lhs, const BinaryExpression::BinaryOperation binaryOperation, const std::uint64_t rhs, const unsigned operandBitwidth) {
+        const std::uint64_t bitmask = determineBitmaskOfBitwidth(operandBitwidth);
+        switch (binaryOperation) {
+            case BinaryExpression::BinaryOperation::Add:
+                return (lhs + rhs) & bitmask;
+            case BinaryExpression::BinaryOperation::Subtract:
+                return (lhs - rhs) & bitmask;
+            case BinaryExpression::BinaryOperation::Exor:
+                return lhs ^ rhs;
+            case BinaryExpression::BinaryOperation::Multiply:
+                return (lhs * rhs) & bitmask;
+            case BinaryExpression::BinaryOperation::Divide:
+                return rhs != 0U ? lhs / rhs : bitmask;
+            case BinaryExpression::BinaryOperation::Modulo:
+                return rhs != 0U ? lhs % rhs : lhs;
+            case BinaryExpression::BinaryOperation::LogicalAnd:
+                return lhs & rhs & 1U;
+            case BinaryExpression::BinaryOperation::LogicalOr:
+                return (lhs | rhs) & 1U;
+            case BinaryExpression::BinaryOperation::BitwiseAnd:
+                return lhs & rhs;
+            case BinaryExpression::BinaryOperation::BitwiseOr:
+                return lhs | rhs;
+            case BinaryExpression::BinaryOperation::LessThan:
+                return static_cast<std::uint64_t>(lhs < rhs);
+            case BinaryExpression::BinaryOperation::GreaterThan:
+                return static_cast<std::uint64_t>(lhs > rhs);
+            case BinaryExpression::BinaryOperation::Equals:
+                return static_cast<std::uint64_t>(lhs == rhs);
+            case BinaryExpression::BinaryOperation::NotEquals:
+                return static_cast<std::uint64_t>(lhs != rhs);
+            case BinaryExpression::BinaryOperation::LessEquals:
+                return static_cast<std::uint64_t>(lhs <= rhs);
+            case BinaryExpression::BinaryOperation::GreaterEquals:
+                return static_cast<std::uint64_t>(lhs >= rhs);
+            default:
+                return std::nullopt;
+        }
+    }
+
+    [[nodiscard]] std::optional<std::size_t> determineIndexOfVariableInModule(const Module& module, const Variable& variable) {
+        const std::size_t numVariables = module.parameters.size() + module.variables.size();
+        const auto        getVariable  = [&module](const std::size_t index) { return index < module.parameters.size() ? module.parameters[index].get() : module.variables[index - module.parameters.size()].get(); };
+        if (variable.declarationIndexInModule.has_value() && *variable.declarationIndexInModule < numVariables && getVariable(*variable.declarationIndexInModule) == &variable) {
+            return variable.declarationIndexInModule;
+        }
+
+        // The declaration indices are only assigned by the parser, the variables of a programmatically created module are thus searched for.
+        for (std::size_t i = 0; i < numVariables; ++i) {
+            if (getVariable(i) == &variable) {
+                return i;
+            }
+        }
+        return std::nullopt;
+    }
+
+    [[nodiscard]] const Module::ptr* determineMainModule(const Program& program, const ConfigurableOptions& settings) {
+        const Module::vec& programModules = program.modules();
+        if (programModules.empty()) {
+            getErrorStream() << "A SyReC program must consist of at least one module\n";
+            return nullptr;
+        }
+
+        const std::string mainModuleIdentifier = settings.optionalProgramEntryPointModuleIdentifier.value_or("main");
+        const auto        numMatchingModules   = std::ranges::count_if(programModules, [&mainModuleIdentifier](const Module::ptr& programModule) { return programModule->name == mainModuleIdentifier; });
+        if (numMatchingModules == 0 && !settings.optionalProgramEntryPointModuleIdentifier.has_value()) {
+            return &programModules.back();
+        }
+        if (numMatchingModules != 1) {
+            getErrorStream() << "There must be exactly one module named '" << mainModuleIdentifier << "' that shall be used as the entry point of the SyReC program but " << std::to_string(numMatchingModules) << " were declared\n";
+            return nullptr;
+        }
+        return &*std::ranges::find_if(programModules, [&mainModuleIdentifier](const Module::ptr& programModule) { return programModule->name == mainModuleIdentifier; });
+    }
+} // namespace
+
+std::optional<ProgramInterpreter> ProgramInterpreter::create(const Program& program, const ConfigurableOptions& settings) {
+    const Module::ptr* mainModule = determineMainModule(program, settings);
+    if (mainModule == nullptr) {
+        return std::nullopt;
+    }
+
+    ProgramInterpreter interpreter;
+    interpreter.mainModule                         = *mainModule;
+    interpreter.integerConstantTruncationOperation = settings.integerConstantTruncationOperation;
+    for (const Variable::vec* variables: {&interpreter.mainModule->parameters, &interpreter.mainModule->variables}) {
+        for (const Variable::ptr& variable: *variables) {
+            if (variable == nullptr) {
+                getErrorStream() << "Variable of main module " << interpreter.mainModule->name << " cannot be NULL\n";
+                return std::nullopt;
+            }
+            interpreter.numValuesOfAssignment += determineNumberOfElementsInVariable(*variable);
+        }
+    }
+    return interpreter;
+}
+
+std::optional<std::size_t> ProgramInterpreter::getIndexOfFirstValueOfVariable(const std::string_view variableIdentifier) const {
+    std::size_t indexOfFirstValue = 0;
+    for (const Variable::vec* variables: {&mainModule->parameters, &mainModule->variables}) {
+        for (const Variable::ptr& variable: *variables) {
+            if (variable->name == variableIdentifier) {
+                return indexOfFirstValue;
+            }
+            indexOfFirstValue += determineNumberOfElementsInVariable(*variable);
+        }
+    }
+    return std::nullopt;
+}
+
+bool ProgramInterpreter::execute(std::vector<std::uint64_t>& assignment) {
+    if (assignment.size() != numValuesOfAssignment) {
+        getErrorStream() << "The assignment of the variables of the main module " << mainModule->name << " must consist of " << std::to_string(numValuesOfAssignment) << " values but " << std::to_string(assignment.size()) << " were provided\n";
+        return false;
+    }
+
+    std::size_t indexOfValue = 0;
+    for (const Variable::vec* variables: {&mainModule->parameters, &mainModule->variables}) {
+        for (const Variable::ptr& variable: *variables) {
+            const std::uint64_t bitmask     = determineBitmaskOfBitwidth(variable->bitwidth);
+            const std::size_t   numElements = determineNumberOfElementsInVariable(*variable);
+            for (std::size_t i = 0; i < numElements; ++i, ++indexOfValue) {
+                if ((assignment[indexOfValue] & ~bitmask) != 0U) {
+                    getErrorStream() << "The value " << std::to_string(assignment[indexOfValue]) << " of the element " << std::to_string(i) << " of variable " << variable->name << " cannot be stored in its bitwidth of " << std::to_string(variable->bitwidth) << "\n";
+                    return false;
+                }
+            }
+        }
+    }
+
+    // The values of the variables of the main module are stored at the start of the values of all active variables with the ones of the variables of a called module being appended to them.
+    // The stack frames of a previous failed execution are discarded.
+    valuesOfElements     = assignment;
+    numActiveStackFrames = 0;
+
+    std::vector<std::size_t> indexOfFirstElementPerParameter;
+    indexOfFirstElementPerParameter.reserve(mainModule->parameters.size());
+    std::size_t indexOfFirstElementOfParameter = 0;
+    for (const Variable::ptr& parameter: mainModule->parameters) {
+        indexOfFirstElementPerParameter.emplace_back(indexOfFirstElementOfParameter);
+        indexOfFirstElementOfParameter += determineNumberOfElementsInVariable(*parameter);
+    }
+
+    // The local variables of the main module are assigned the values of the assignment and are thus not appended to the values of the active variables.
+    valuesOfElements.resize(indexOfFirstElementOfParameter);
+    if (!pushStackFrame(*mainModule, indexOfFirstElementPerParameter)) {
+        return false;
+    }
+    std::ranges::copy(assignment.cbegin() + static_cast<std::ptrdiff_t>(indexOfFirstElementOfParameter), assignment.cend(), valuesOfElements.begin() + static_cast<std::ptrdiff_t>(indexOfFirstElementOfParameter));
+
+    static_cast<void>(loopVariableNumberEvaluator.exchangeLoopVariableValues({}));
+    if (!executeStatements(mainModule->statements)) {
+        return false;
+    }
+    std::copy_n(valuesOfElements.cbegin(), numValuesOfAssignment, assignment.begin());
+    return true;
+}
+
+bool ProgramInterpreter::pushStackFrame(const Module& module, const std::vector<std::size_t>& indexOfFirstElementPerParameter) {
+    if (indexOfFirstElementPerParameter.size() != module.parameters.size()) {
+        getErrorStream() << "Module " << module.name << " expects " << std::to_string(module.parameters.size()) << " parameters but " << std::to_string(indexOfFirstElementPerParameter.size()) << " were provided\n";
+        return false;
+    }
+
+    if (std::ranges::any_of(module.variables, [](const Variable::ptr& localVariable) { return localVariable == nullptr; })) {
+        getErrorStream() << "Local variable of module " << module.name << " cannot be NULL\n";
+        return false;
+    }
+
+    if (numActiveStackFrames == stackFrames.size()) {
+        stackFrames.emplace_back();
+    }
+    StackFrame& stackFrame = stackFrames[numActiveStackFrames++];
+    stackFrame.module      = &module;
+    stackFrame.indexOfFirstElementPerVariable.assign(indexOfFirstElementPerParameter.cbegin(), indexOfFirstElementPerParameter.cend());
+    for (const Variable::ptr& localVariable: module.variables) {
+        stackFrame.indexOfFirstElementPerVariable.emplace_back(valuesOfElements.size());
+        valuesOfElements.resize(valuesOfElements.size() + determineNumberOfElementsInVariable(*localVariable), 0U);
+    }
+    return true;
+}
+
+void ProgramInterpreter::popStackFrame() {
+    const StackFrame& stackFrame = stackFrames[--numActiveStackFrames];
+    if (!stackFrame.module->variables.empty()) {
+        valuesOfElements.resize(stackFrame.indexOfFirstElementPerVariable[stackFrame.module->parameters.size()]);
+    }
+}
+
+bool ProgramInterpreter::executeStatements(const Statement::vec& statements) {
+    return std::ranges::all_of(statements, [this](const Statement::ptr& statement) {
+        if (statement == nullptr) {
+            getErrorStream() << "Cannot execute a statement that is NULL\n";
+            return false;
+        }
+        return executeStatement(*statement);
+    });
+}
+
+bool ProgramInterpreter::executeStatement(const Statement& statement) {
+    switch (statement.getKind()) {
+        case Statement::Kind::Assign:
+            return executeStatement(static_cast<const AssignStatement&>(statement));
+        case Statement::Kind::Unary:
+            return executeStatement(static_cast<const UnaryStatement&>(statement));
+        case Statement::Kind::Swap:
+            return executeStatement(static_cast<const SwapStatement&>(statement));
+        case Statement::Kind::If:
+            return executeStatement(static_cast<const IfStatement&>(statement));
+        case Statement::Kind::For:
+            return executeStatement(static_cast<const ForStatement&>(statement));
+        case Statement::Kind::Call: {
+            const auto& callStatement = static_cast<const CallStatement&>(statement);
+            return executeModuleCall(callStatement.target, callStatement.parameters, false, statement.lineNumber);
+        }
+        case Statement::Kind::Uncall: {
+            const auto& uncallStatement = static_cast<const UncallStatement&>(statement);
+            return executeModuleCall(uncallStatement.target, uncallStatement.parameters, true, statement.lineNumber);
+        }
+        case Statement::Kind::Skip:
+            return true;
+    }
+    getErrorStream() << "Cannot execute statement of unknown type in line " << std::to_string(statement.lineNumber) << "\n";
+    return false;
+}
+
+bool ProgramInterpreter::executeStatement(const AssignStatement& statement) {
+    const std::optional<AccessedBitsOfElement> accessedBitsOfLhsOperand = evaluateVariableAccess(statement.lhs);
+    if (!accessedBitsOfLhsOperand.has_value()) {
+        return false;
+    }
+
+    const unsigned                      numAccessedBitsOfLhsOperand = accessedBitsOfLhsOperand->getNumberOfAccessedBits();
+    const std::optional<EvaluatedValue> rhsOperand                  = evaluateExpression(statement.rhs, numAccessedBitsOfLhsOperand);
+    if (!rhsOperand.has_value()) {
+        return false;
+    }
+    if (rhsOperand->bitwidth != numAccessedBitsOfLhsOperand) {
+        getErrorStream() << "The bitwidth of the right hand side (" << std::to_string(rhsOperand->bitwidth) << ") of the assignment in line " << std::to_string(statement.lineNumber) << " did not match the number of accessed bits (" << std::to_string(numAccessedBitsOfLhsOperand) << ") of the assigned to variable " << statement.lhs->var->name << "\n";
+        return false;
+    }
+
+    const std::uint64_t valueOfLhsOperand = readAccessedBits(*accessedBitsOfLhsOperand);
+    std::uint64_t       assignedValue     = 0;
+    switch (statement.assignOperation) {
+        case AssignStatement::AssignOperation::Add:
+            assignedValue = valueOfLhsOperand + rhsOperand->value;
+            break;
+        case AssignStatement::AssignOperation::Subtract:
+            assignedValue = valueOfLhsOperand - rhsOperand->value;
+            break;
+        case AssignStatement::AssignOperation::Exor:
+            assignedValue = valueOfLhsOperand ^ rhsOperand->value;
+            break;
+        default:
+            getErrorStream() << "Cannot execute assignment with unknown assignment operation in line " << std::to_string(statement.lineNumber) << "\n";
+            return false;
+    }
+    writeAccessedBits(*accessedBitsOfLhsOperand, assignedValue);
+    return true;
+}
+
+bool ProgramInterpreter::executeStatement(const UnaryStatement& statement) {
+    const std::optional<AccessedBitsOfElement> accessedBits = evaluateVariableAccess(statement.var);
+    if (!accessedBits.has_value()) {
+        return false;
+    }
+
+    const std::uint64_t currentValue = readAccessedBits(*accessedBits);
+    switch (statement.unaryOperation) {
+        case UnaryStatement::UnaryOperation::Invert:
+            writeAccessedBits(*accessedBits, ~currentValue);
+            return true;
+        case UnaryStatement::UnaryOperation::Increment:
+            writeAccessedBits(*accessedBits, currentValue + 1U);
+            return true;
+        case UnaryStatement::UnaryOperation::Decrement:
+            writeAccessedBits(*accessedBits, currentValue - 1U);
+            return true;
+        default:
+            getErrorStream() << "Cannot execute unary statement with unknown operation in line " << std::to_string(statement.lineNumber) << "\n";
+            return false;
+    }
+}
+
+bool ProgramInterpreter::executeStatement(const SwapStatement& statement) {
+    const std::optional<AccessedBitsOfElement> accessedBitsOfLhsOperand = evaluateVariableAccess(statement.lhs);
+    const std::optional<AccessedBitsOfElement> accessedBitsOfRhsOperand = accessedBitsOfLhsOperand.has_value() ? evaluateVariableAccess(statement.rhs) : std::nullopt;
+    if (!accessedBitsOfLhsOperand.has_value() || !accessedBitsOfRhsOperand.has_value()) {
+        return false;
+    }
+    if (accessedBitsOfLhsOperand->getNumberOfAccessedBits() != accessedBitsOfRhsOperand->getNumberOfAccessedBits()) {
+        getErrorStream() << "The number of accessed bits of the operands of the swap statement in line " << std::to_string(statement.lineNumber) << " did not match\n";
+        return false;
+    }
+
+    const std::uint64_t valueOfLhsOperand = readAccessedBits(*accessedBitsOfLhsOperand);
+    writeAccessedBits(*accessedBitsOfLhsOperand, readAccessedBits(*accessedBitsOfRhsOperand));
+    writeAccessedBits(*accessedBitsOfRhsOperand, valueOfLhsOperand);
+    return true;
+}
+
+bool ProgramInterpreter::executeStatement(const IfStatement& statement) {
+    const std::optional<EvaluatedValue> guardCondition = evaluateExpression(statement.condition, 1U);
+    if (!guardCondition.has_value()) {
+        return false;
+    }
+    if (guardCondition->bitwidth != 1U) {
+        getErrorStream() << "The guard condition of the if statement in line " << std::to_string(statement.lineNumber) << " must have a bitwidth of 1 but had a bitwidth of " << std::to_string(guardCondition->bitwidth) << "\n";
+        return false;
+    }
+
+    if (!executeStatements(guardCondition->value != 0U ? statement.thenStatements : statement.elseStatements)) {
+        return false;
+    }
+
+    // The synthesized quantum computation uses the fi-condition to uncompute the value of the guard condition, a fi-condition not matching the latter thus leaves the ancillary qubit storing the guard condition in a dirty state.
+    const std::optional<EvaluatedValue> fiCondition = evaluateExpression(statement.fiCondition, 1U);
+    if (!fiCondition.has_value()) {
+        return false;
+    }
+    if (fiCondition->bitwidth != 1U || fiCondition->value != guardCondition->value) {
+        getErrorStream() << "The fi-condition of the if statement in line " << std::to_string(statement.lineNumber) << " evaluated to " << std::to_string(fiCondition->value) << " after the execution of the " << (guardCondition->value != 0U ? "then" : "else") << " branch while the guard condition evaluated to " << std::to_string(guardCondition->value) << "\n";
+        return false;
+    }
+    return true;
+}
+
+bool ProgramInterpreter::executeStatement(const ForStatement& statement) {
+    // The iteration range is handled as in the synthesis, i.e. as the python range(<START>, <END>, <STEP>) function with the step being negated if the start value is larger than the end value.
+    const auto& [nFrom, nTo]                    = statement.range;
+    const std::optional<unsigned> from          = nFrom != nullptr ? loopVariableNumberEvaluator.tryEvaluate(nFrom) : std::make_optional(1U);
+    const std::optional<unsigned> to            = loopVariableNumberEvaluator.tryEvaluate(nTo);
+    const std::optional<unsigned> step          = statement.step != nullptr ? loopVariableNumberEvaluator.tryEvaluate(statement.step) : std::make_optional(1U);
+    if (!from.has_value() || !to.has_value() || !step.has_value()) {
+        getErrorStream() << "Failed to evaluate the iteration range of the loop in line " << std::to_string(statement.lineNumber) << "\n";
+        return false;
+    }
+    if (*from == *to) {
+        return true;
+    }
+    if (*step == 0U) {
+        getErrorStream() << "The loop in line " << std::to_string(statement.lineNumber) << " with a step size of zero does not terminate\n";
+        return false;
+    }
+
+    const std::string& loopVariable     = statement.loopVariable;
+    const std::size_t  loopVariableSlot = !loopVariable.empty() ? loopVariableNumberEvaluator.getLoopVariableSlot(loopVariable) : 0U;
+    const auto         fromSigned       = static_cast<std::int64_t>(*from);
+    const auto         toSigned         = static_cast<std::int64_t>(*to);
+    const auto         stepSigned       = *from < *to ? static_cast<std::int64_t>(*step) : -static_cast<std::int64_t>(*step);
+
+    bool executionOk = true;
+    for (auto i = fromSigned; executionOk && (*from < *to ? i < toSigned : i > toSigned); i += stepSigned) {
+        if (!loopVariable.empty()) {
+            loopVariableNumberEvaluator.setLoopVariableValue(loopVariableSlot, static_cast<unsigned>(i));
+        }
+        executionOk = executeStatements(statement.statements);
+    }
+
+    if (!loopVariable.empty()) {
+        loopVariableNumberEvaluator.setLoopVariableValue(loopVariableSlot, std::nullopt);
+    }
+    return executionOk;
+}
+
+bool ProgramInterpreter::executeModuleCall(const Module::ptr& targetModule, const std::vector<std::string>& callerArguments, const bool isUncall, const unsigned lineNumber) {
+    if (targetModule == nullptr) {
+        getErrorStream() << "The target module of the " << (isUncall ? "uncall" : "call") << " in line " << std::to_string(lineNumber) << " cannot be NULL\n";
+        return false;
+    }
+
+    // The parameters of the target module reference the elements of the caller arguments.
+    const StackFrame&        callerStackFrame = stackFrames[numActiveStackFrames - 1U];
+    std::vector<std::size_t> indexOfFirstElementPerParameter;
+    indexOfFirstElementPerParameter.reserve(callerArguments.size());
+    for (const std::string& callerArgument: callerArguments) {
+        const std::optional<Variable::ptr> matchingVariableOfCaller = callerStackFrame.module->findParameterOrVariable(callerArgument);
+        const std::optional<std::size_t>   indexOfVariable          = matchingVariableOfCaller.has_value() && *matchingVariableOfCaller != nullptr ? determineIndexOfVariableInModule(*callerStackFrame.module, **matchingVariableOfCaller) : std::nullopt;
+        if (!indexOfVariable.has_value()) {
+            getErrorStream() << "Failed to find matching parameter or variable of module " << callerStackFrame.module->name << " for argument '" << callerArgument << "' of the " << (isUncall ? "uncall" : "call") << " of module " << targetModule->name << " in line " << std::to_string(lineNumber) << "\n";
+            return false;
+        }
+        indexOfFirstElementPerParameter.emplace_back(callerStackFrame.indexOfFirstElementPerVariable[*indexOfVariable]);
+    }
+
+    const Statement::vec* executedStatements = &targetModule->statements;
+    if (isUncall) {
+        auto invertedStatements = invertedStatementsPerModule.find(targetModule.get());
+        if (invertedStatements == invertedStatementsPerModule.end()) {
+            Statement::vec containerForInvertedStatements;
+            invertedStatements = invertedStatementsPerModule.try_emplace(targetModule.get(), invertStatementBlock(targetModule->statements, containerForInvertedStatements) ? std::make_optional(std::move(containerForInvertedStatements)) : std::nullopt).first;
+        }
+        if (!invertedStatements->second.has_value()) {
+            getErrorStream() << "Failed to create the inverse of the statements of the uncalled module " << targetModule->name << " (UNCALL @ " << std::to_string(lineNumber) << ")\n";
+            return false;
+        }
+        executedStatements = &*invertedStatements->second;
+    }
+
+    if (!pushStackFrame(*targetModule, indexOfFirstElementPerParameter)) {
+        return false;
+    }
+
+    // Loop variables are only visible in the module declaring them, the loop variables of the caller are thus hidden during the execution of the module body.
+    const std::vector<std::optional<unsigned>> valuesOfLoopVariableSlotsOfCaller = loopVariableNumberEvaluator.exchangeLoopVariableValues({});
+    const bool                                 executionOk                       = executeStatements(*executedStatements);
+    static_cast<void>(loopVariableNumberEvaluator.exchangeLoopVariableValues(valuesOfLoopVariableSlotsOfCaller));
+    popStackFrame();
+    return executionOk;
+}
+
+std::optional<ProgramInterpreter::EvaluatedValue> ProgramInterpreter::evaluateExpression(const Expression::ptr& expression, const std::optional<unsigned> expectedBitwidth) {
+    if (expression == nullptr) {
+        getErrorStream() << "Cannot evaluate an expression that is NULL\n";
+        return std::nullopt;
+    }
+
+    const std::optional<EvaluatedValue> evaluatedValue = evaluateOperand(*expression);
+    if (!evaluatedValue.has_value()) {
+        return std::nullopt;
+    }
+    return truncateUnsizedConstant(*evaluatedValue, expectedBitwidth);
+}
+
+std::optional<ProgramInterpreter::EvaluatedValue> ProgramInterpreter::evaluateOperand(const Expression& expression) {
+    switch (expression.getKind()) {
+        case Expression::Kind::Numeric: {
+            const std::optional<unsigned> value = loopVariableNumberEvaluator.tryEvaluate(static_cast<const NumericExpression&>(expression).value);
+            if (!value.has_value()) {
+                getErrorStream() << "Failed to evaluate the value of a numeric expression\n";
+                return std::nullopt;
+            }
+            return EvaluatedValue{.value = *value, .bitwidth = DEFAULT_BITWIDTH_OF_INTEGER_CONSTANTS, .isUnsizedConstant = true};
+        }
+        case Expression::Kind::Variable: {
+            const std::optional<AccessedBitsOfElement> accessedBits = evaluateVariableAccess(static_cast<const VariableExpression&>(expression).var);
+            if (!accessedBits.has_value()) {
+                return std::nullopt;
+            }
+            return EvaluatedValue{.value = readAccessedBits(*accessedBits), .bitwidth = accessedBits->getNumberOfAccessedBits(), .isUnsizedConstant = false};
+        }
+        case Expression::Kind::Binary:
+            return evaluateOperand(static_cast<const BinaryExpression&>(expression));
+        case Expression::Kind::Shift:
+            return evaluateOperand(static_cast<const ShiftExpression&>(expression));
+        case Expression::Kind::Unary:
+            return evaluateOperand(static_cast<const UnaryExpression&>(expression));
+    }
+    getErrorStream() << "Cannot evaluate expression of unknown type\n";
+    return std::nullopt;
+}
+
+std::optional<ProgramInterpreter::EvaluatedValue> ProgramInterpreter::evaluateOperand(const BinaryExpression& expression) {
+    if (expression.lhs == nullptr || expression.rhs == nullptr) {
+        getErrorStream() << "Cannot evaluate a binary expression with an operand that is NULL\n";
+        return std::nullopt;
+    }
+
+    std::optional<EvaluatedValue> lhsOperand = evaluateOperand(*expression.lhs);
+    std::optional<EvaluatedValue> rhsOperand = lhsOperand.has_value() ? evaluateOperand(*expression.rhs) : std::nullopt;
+    if (!lhsOperand.has_value() || !rhsOperand.has_value()) {
+        return std::nullopt;
+    }
+
+    // Subexpressions consisting only of integer constants are evaluated as in the compile time simplifications performed by the synthesis.
+    if (lhsOperand->isUnsizedConstant && rhsOperand->isUnsizedConstant) {
+        const std::optional<unsigned> value = utils::tryEvaluate(static_cast<unsigned>(lhsOperand->value), expression.binaryOperation, static_cast<unsigned>(rhsOperand->value));
+        if (!value.has_value()) {
+            getErrorStream() << "Failed to evaluate binary expression whose operands are the integer constants " << std::to_string(lhsOperand->value) << " and " << std::to_string(rhsOperand->value) << "\n";
+            return std::nullopt;
+        }
+        return EvaluatedValue{.value = *value, .bitwidth = DEFAULT_BITWIDTH_OF_INTEGER_CONSTANTS, .isUnsizedConstant = true};
+    }
+
+    const unsigned expectedOperandBitwidth = isBinaryOperationLogicalOperation(expression.binaryOperation) ? 1U : (lhsOperand->isUnsizedConstant ? rhsOperand->bitwidth : lhsOperand->bitwidth);
+    lhsOperand                             = truncateUnsizedConstant(*lhsOperand, expectedOperandBitwidth);
+    rhsOperand                             = truncateUnsizedConstant(*rhsOperand, expectedOperandBitwidth);
+    if (lhsOperand->bitwidth != rhsOperand->bitwidth) {
+        getErrorStream() << "The bitwidths of the operands of a binary expression (lhs: " << std::to_string(lhsOperand->bitwidth) << ", rhs: " << std::to_string(rhsOperand->bitwidth) << ") must match\n";
+        return std::nullopt;
+    }
+
+    const std::optional<std::uint64_t> value = evaluateBinaryOperation(lhsOperand->value, expression.binaryOperation, rhsOperand->value, lhsOperand->bitwidth);
+    if (!value.has_value()) {
+        getErrorStream() << "Cannot evaluate binary expression with unsupported operation\n";
+        return std::nullopt;
+    }
+    return EvaluatedValue{.value = *value, .bitwidth = isBinaryOperationWithSingleBitResult(expression.binaryOperation) ? 1U : lhsOperand->bitwidth, .isUnsizedConstant = false};
+}
+
+std::optional<ProgramInterpreter::EvaluatedValue> ProgramInterpreter::evaluateOperand(const ShiftExpression& expression) {
+    if (expression.lhs == nullptr) {
+        getErrorStream() << "Cannot evaluate a shift expression whose shifted operand is NULL\n";
+        return std::nullopt;
+    }
+
+    const std::optional<EvaluatedValue> toBeShiftedOperand = evaluateOperand(*expression.lhs);
+    if (!toBeShiftedOperand.has_value()) {
+        return std::nullopt;
+    }
+    const std::optional<unsigned> shiftAmount = loopVariableNumberEvaluator.tryEvaluate(expression.rhs);
+    if (!shiftAmount.has_value()) {
+        getErrorStream() << "Failed to evaluate the shift amount of a shift expression\n";
+        return std::nullopt;
+    }
+
+    const unsigned bitwidth = toBeShiftedOperand->bitwidth;
+    if (*shiftAmount >= bitwidth) {
+        return EvaluatedValue{.value = 0U, .bitwidth = bitwidth, .isUnsizedConstant = toBeShiftedOperand->isUnsizedConstant};
+    }
+    const std::uint64_t value = expression.shiftOperation == ShiftExpression::ShiftOperation::Left ? (toBeShiftedOperand->value << *shiftAmount) & determineBitmaskOfBitwidth(bitwidth) : toBeShiftedOperand->value >> *shiftAmount;
+    return EvaluatedValue{.value = value, .bitwidth = bitwidth, .isUnsizedConstant = toBeShiftedOperand->isUnsizedConstant};
+}
+
+std::optional<ProgramInterpreter::EvaluatedValue> ProgramInterpreter::evaluateOperand(const UnaryExpression& expression) {
+    if (expression.expr == nullptr) {
+        getErrorStream() << "Cannot evaluate a unary expression whose operand is NULL\n";
+        return std::nullopt;
+    }
+
+    const std::optional<EvaluatedValue> operand = evaluateOperand(*expression.expr);
+    if (!operand.has_value()) {
+        return std::nullopt;
+    }
+    if (operand->isUnsizedConstant) {
+        const std::optional<unsigned> value = utils::tryEvaluate(expression.unaryOperation, static_cast<unsigned>(operand->value));
+        if (!value.has_value()) {
+            getErrorStream() << "Failed to evaluate unary expression whose operand is the integer constant " << std::to_string(operand->value) << "\n";
+            return std::nullopt;
+        }
+        return EvaluatedValue{.value = *value, .bitwidth = DEFAULT_BITWIDTH_OF_INTEGER_CONSTANTS, .isUnsizedConstant = true};
+    }
+
+    if (expression.unaryOperation == UnaryExpression::UnaryOperation::LogicalNegation) {
+        if (operand->bitwidth != 1U) {
+            getErrorStream() << "Logical negation operation can only be used for expressions with a bitwidth of 1\n";
+            return std::nullopt;
+        }
+        return EvaluatedValue{.value = operand->value ^ 1U, .bitwidth = 1U, .isUnsizedConstant = false};
+    }
+    return EvaluatedValue{.value = ~operand->value & determineBitmaskOfBitwidth(operand->bitwidth), .bitwidth = operand->bitwidth, .isUnsizedConstant = false};
+}
+
+ProgramInterpreter::EvaluatedValue ProgramInterpreter::truncateUnsizedConstant(const EvaluatedValue& evaluatedValue, const std::optional<unsigned> expectedBitwidth) const {
+    if (!evaluatedValue.isUnsizedConstant) {
+        return evaluatedValue;
+    }
+    if (!expectedBitwidth.has_value()) {
+        return EvaluatedValue{.value = evaluatedValue.value, .bitwidth = DEFAULT_BITWIDTH_OF_INTEGER_CONSTANTS, .isUnsizedConstant = false};
+    }
+    const unsigned truncatedValue = utils::truncateConstantValueToExpectedBitwidth(static_cast<unsigned>(evaluatedValue.value), *expectedBitwidth, integerConstantTruncationOperation);
+    return EvaluatedValue{.value = truncatedValue, .bitwidth = *expectedBitwidth, .isUnsizedConstant = false};
+}
+
+std::optional<ProgramInterpreter::AccessedBitsOfElement> ProgramInterpreter::evaluateVariableAccess(const VariableAccess::ptr& variableAccess) {
+    if (variableAccess == nullptr || variableAccess->var == nullptr) {
+        getErrorStream() << "Cannot evaluate a variable access that is NULL or in which the accessed variable is NULL\n";
+        return std::nullopt;
+    }
+
+    const Variable&                  accessedVariable = *variableAccess->var;
+    const StackFrame&                stackFrame       = stackFrames[numActiveStackFrames - 1U];
+    const std::optional<std::size_t> indexOfVariable  = determineIndexOfVariableInModule(*stackFrame.module, accessedVariable);
+    if (!indexOfVariable.has_value()) {
+        getErrorStream() << "Variable " << accessedVariable.name << " is neither a parameter nor a local variable of module " << stackFrame.module->name << "\n";
+        return std::nullopt;
+    }
+    if (variableAccess->indexes.size() != accessedVariable.dimensions.size()) {
+        getErrorStream() << "The number of indices (" << std::to_string(variableAccess->indexes.size()) << ") defined in a variable access must match the number of dimensions (" << std::to_string(accessedVariable.dimensions.size()) << ") of the accessed variable " << accessedVariable.name << "\n";
+        return std::nullopt;
+    }
+
+    // The elements of a multi-dimensional variable are stored in row-major order.
+    std::size_t indexOfElementInVariable = 0;
+    for (std::size_t dimensionIdx = 0; dimensionIdx < accessedVariable.dimensions.size(); ++dimensionIdx) {
+        const Expression::ptr& indexExpression     = variableAccess->indexes[dimensionIdx];
+        const unsigned         numValuesOfDimension = accessedVariable.dimensions[dimensionIdx];
+        // The value of a numeric expression is validated as is while the value of any other expression is computed in the bitwidth required to store the largest index of the dimension (as done by the synthesis).
+        const bool                          isIndexNumericExpression = expressionCast<NumericExpression>(indexExpression.get()) != nullptr;
+        const std::optional<EvaluatedValue> accessedIndex            = evaluateExpression(indexExpression, isIndexNumericExpression ? std::nullopt : std::make_optional(determineNumberOfBitsRequiredToStoreValue(numValuesOfDimension - 1U)));
+        if (!accessedIndex.has_value()) {
+            return std::nullopt;
+        }
+        if (accessedIndex->value >= numValuesOfDimension) {
+            getErrorStream() << "Access on value " << std::to_string(accessedIndex->value) << " of dimension " << std::to_string(dimensionIdx) << " was not within the valid range [0, " << std::to_string(numValuesOfDimension - 1U) << "] in access on variable " << accessedVariable.name << "\n";
+            return std::nullopt;
+        }
+        indexOfElementInVariable = indexOfElementInVariable * numValuesOfDimension + accessedIndex->value;
+    }
+
+    AccessedBitsOfElement accessedBits{.indexOfElement = stackFrame.indexOfFirstElementPerVariable[*indexOfVariable] + indexOfElementInVariable, .bitrangeStart = 0U, .bitrangeEnd = accessedVariable.bitwidth - 1U};
+    if (variableAccess->range.has_value()) {
+        const std::optional<unsigned> bitrangeStart = loopVariableNumberEvaluator.tryEvaluate(variableAccess->range->first);
+        const std::optional<unsigned> bitrangeEnd   = loopVariableNumberEvaluator.tryEvaluate(variableAccess->range->second);
+        if (!bitrangeStart.has_value() || !bitrangeEnd.has_value()) {
+            getErrorStream() << "Failed to determine value of bitrange in access on variable " << accessedVariable.name << "\n";
+            return std::nullopt;
+        }
+        if (*bitrangeStart >= accessedVariable.bitwidth || *bitrangeEnd >= accessedVariable.bitwidth) {
+            getErrorStream() << "User defined bitrange " << std::to_string(*bitrangeStart) << ":" << std::to_string(*bitrangeEnd) << " was not within the valid range [0, " << std::to_string(accessedVariable.bitwidth - 1U) << "] in bitrange access on variable " << accessedVariable.name << "\n";
+            return std::nullopt;
+        }
+        accessedBits.bitrangeStart = *bitrangeStart;
+        accessedBits.bitrangeEnd   = *bitrangeEnd;
+    }
+    return accessedBits;
+}
+
+std::uint64_t ProgramInterpreter::readAccessedBits(const AccessedBitsOfElement& accessedBits) const {
+    const std::uint64_t valueOfElement = valuesOfElements[accessedBits.indexOfElement];
+    if (accessedBits.bitrangeStart <= accessedBits.bitrangeEnd) {
+        return (valueOfElement >> accessedBits.bitrangeStart) & determineBitmaskOfBitwidth(accessedBits.getNumberOfAccessedBits());
+    }
+
+    // The bit at the start of a descending bitrange is the least significant bit of the accessed value.
+    std::uint64_t value = 0;
+    for (unsigned i = 0; i < accessedBits.getNumberOfAccessedBits(); ++i) {
+        value |= ((valueOfElement >> (accessedBits.bitrangeStart - i)) & 1U) << i;
+    }
+    return value;
+}
+
+void ProgramInterpreter::writeAccessedBits(const AccessedBitsOfElement& accessedBits, const std::uint64_t value) {
+    std::uint64_t& valueOfElement = valuesOfElements[accessedBits.indexOfElement];
+    if (accessedBits.bitrangeStart <= accessedBits.bitrangeEnd) {
+        const std::uint64_t bitmask = determineBitmaskOfBitwidth(accessedBits.getNumberOfAccessedBits()) << accessedBits.bitrangeStart;
+        valueOfElement              = (valueOfElement & ~bitmask) | ((value << accessedBits.bitrangeStart) & bitmask);
+        return;
+    }
+
+    for (unsigned i = 0; i < accessedBits.getNumberOfAccessedBits(); ++i) {
+        const std::uint64_t bitmaskOfBit = static_cast<std::uint64_t>(1) << (accessedBits.bitrangeStart - i);
+        valueOfElement                   = ((value >> i) & 1U) != 0U ? valueOfElement | bitmaskOfBit : valueOfElement & ~bitmaskOfBit;
+    }
+}
+
+bool syrec::interpretProgram(std::vector<std::vector<std::uint64_t>>& assignments, const Program& program, const ConfigurableOptions& settings, const std::size_t numThreads, Statistics* optionalRecordedStatistics) {
+    const TimeStamp interpretationStartTime = std::chrono::steady_clock::now();
+
+    const std::optional<ProgramInterpreter> interpreter = ProgramInterpreter::create(program, settings);
+    if (!interpreter.has_value()) {
+        return false;
+    }
+
+    // Every thread interprets a contiguous range of the assignments using its own copy of the interpreter with the errors of a thread being collected and reported on the error stream of the calling thread afterwards.
+    std::atomic<bool> interpretationOk = true;
+    const auto        interpretAssignments = [&](const std::size_t firstAssignment, const std::size_t lastAssignment, Diagnostics& diagnostics) {
+        const ScopedDiagnosticsCollection diagnosticsCollection(diagnostics);
+        ProgramInterpreter                interpreterOfThread = *interpreter;
+        for (std::size_t i = firstAssignment; i < lastAssignment && interpretationOk; ++i) {
+            if (!interpreterOfThread.execute(assignments[i])) {
+                getErrorStream() << "Interpretation of the program for the assignment " << std::to_string(i) << " failed\n";
+                interpretationOk = false;
+            }
+        }
+    };
+
+    if (settings.pinWorkerThreadsToCores) {
+        Executor::getShared().pinWorkerThreadsToCores();
+    }
+    std::size_t numWorkerThreads = Executor::determineNumThreads(numThreads != 0U ? numThreads : settings.maxNumThreads);
+    numWorkerThreads             = std::max<std::size_t>(1U, std::min(numWorkerThreads, assignments.size()));
+
+    std::vector<Diagnostics> diagnosticsPerThread(numWorkerThreads);
+    const std::size_t        numAssignmentsPerThread = (assignments.size() + numWorkerThreads - 1U) / numWorkerThreads;
+    Executor::getShared().parallelFor(numWorkerThreads, [&](const std::size_t i) {
+        const std::size_t firstAssignment = std::min(assignments.size(), i * numAssignmentsPerThread);
+        const std::size_t lastAssignment  = std::min(assignments.size(), firstAssignment + numAssignmentsPerThread);
+        interpretAssignments(firstAssignment, lastAssignment, diagnosticsPerThread[i]);
+    }, numWorkerThreads);
+
+    for (const Diagnostics& diagnostics: diagnosticsPerThread) {
+        for (const std::string& errorMessage: diagnostics.getErrorMessages()) {
+            getErrorStream() << errorMessage << "\n";
+        }
+    }
+    if (!interpretationOk) {
+        return false;
+    }
+
+    const TimeStamp interpretationEndTime = std::chrono::steady_clock::now();
+    if (optionalRecordedStatistics != nullptr) {
+        optionalRecordedStatistics->recordRuntime(interpretationEndTime - interpretationStartTime);
+    }
+    return true;
+}
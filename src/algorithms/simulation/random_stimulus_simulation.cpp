@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/random_stimulus_simulation.hpp"
+
+#include "algorithms/simulation/simple_simulation.hpp"
+#include "algorithms/simulation/simulation_program.hpp"
+#include "core/executor.hpp"
+#include "core/statistics.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    using TimeStamp = std::chrono::time_point<std::chrono::steady_clock>;
+
+    struct CoverageOfThread {
+        std::uint64_t              numSimulatedPatterns = 0U;
+        std::vector<std::uint64_t> numOnesPerQubit;
+        std::vector<std::uint64_t> numFlipsPerQubit;
+    };
+
+    /**
+     * The counter-th output of the SplitMix64 generator started at the given seed. Every lane word is generated independently of the others, thus the generated patterns do not depend on
+     * the order in which the blocks are simulated.
+     */
+    [[nodiscard]] std::uint64_t generateRandomLaneWord(const std::uint64_t seed, const std::uint64_t counter) {
+        std::uint64_t z = seed + (counter + 1U) * 0x9E3779B97F4A7C15ULL;
+        z               = (z ^ (z >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+        z               = (z ^ (z >> 27U)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31U);
+    }
+
+    [[nodiscard]] std::uint64_t maskOfFirstLanes(const std::uint64_t numLanes) {
+        return numLanes >= BATCH_SIMULATION_LANE_COUNT ? ~static_cast<std::uint64_t>(0) : (static_cast<std::uint64_t>(1) << numLanes) - 1U;
+    }
+
+    // The corner case patterns are numbered as: all data qubits zero (0), all data qubits one (1) and only the i-th data qubit set (2 + i).
+    [[nodiscard]] std::uint64_t determineCornerCaseLaneWord(const std::size_t indexOfDataQubit, const std::uint64_t firstPatternOfBlock, const std::uint64_t numLanes) {
+        const auto laneWordOfPattern = [&](const std::uint64_t pattern) {
+            return pattern >= firstPatternOfBlock && pattern < firstPatternOfBlock + numLanes ? static_cast<std::uint64_t>(1) << (pattern - firstPatternOfBlock) : 0U;
+        };
+        return laneWordOfPattern(1U) | laneWordOfPattern(2U + indexOfDataQubit);
+    }
+} // namespace
+
+bool StimulusSimulationResult::isQubitToggleCovered(const std::size_t qubit) const {
+    return qubit < numOnesPerQubit.size() && numOnesPerQubit[qubit] != 0U && numOnesPerQubit[qubit] != numSimulatedPatterns;
+}
+
+std::size_t StimulusSimulationResult::getNumToggleCoveredQubits() const {
+    std::size_t numToggleCoveredQubits = 0;
+    for (std::size_t qubit = 0; qubit < numOnesPerQubit.size(); ++qubit) {
+        numToggleCoveredQubits += isQubitToggleCovered(qubit) ? 1U : 0U;
+    }
+    return numToggleCoveredQubits;
+}
+
+bool syrec::randomStimulusSimulation(StimulusSimulationResult& result, const qc::QuantumComputation& quantumComputation, const StimulusSimulationSettings& settings, Statistics* optionalRecordedStatistics) {
+    result = StimulusSimulationResult();
+
+    const std::optional<SimulationProgram> simulationProgram = SimulationProgram::compile(quantumComputation);
+    if (!simulationProgram.has_value()) {
+        return false;
+    }
+
+    const TimeStamp simulationStartTime = std::chrono::steady_clock::now();
+
+    const std::size_t      numQubits = simulationProgram->getNumQubits();
+    std::vector<qc::Qubit> dataQubits;
+    for (std::size_t qubit = 0; qubit < numQubits; ++qubit) {
+        if (!quantumComputation.logicalQubitIsAncillary(static_cast<qc::Qubit>(qubit))) {
+            dataQubits.emplace_back(static_cast<qc::Qubit>(qubit));
+        }
+    }
+
+    const std::uint64_t numCornerCasePatterns = settings.simulateCornerCasePatterns ? 2U + dataQubits.size() : 0U;
+    const std::uint64_t numCornerCaseBlocks   = (numCornerCasePatterns + BATCH_SIMULATION_LANE_COUNT - 1U) / BATCH_SIMULATION_LANE_COUNT;
+    const std::uint64_t numRandomBlocks       = (settings.numRandomPatterns + BATCH_SIMULATION_LANE_COUNT - 1U) / BATCH_SIMULATION_LANE_COUNT;
+    const std::uint64_t numBlocks             = numCornerCaseBlocks + numRandomBlocks;
+
+    const auto simulateBlocks = [&](const std::uint64_t firstBlock, const std::uint64_t lastBlock, CoverageOfThread& coverage, std::atomic<bool>& simulationOk) {
+        coverage.numOnesPerQubit.assign(numQubits, 0U);
+        coverage.numFlipsPerQubit.assign(numQubits, 0U);
+        std::vector<std::uint64_t> inputLaneValuesPerQubit(numQubits, 0U);
+        std::vector<std::uint64_t> laneValuesPerQubit(numQubits, 0U);
+
+        for (std::uint64_t block = firstBlock; block < lastBlock; ++block) {
+            const bool          isCornerCaseBlock = block < numCornerCaseBlocks;
+            const std::uint64_t firstPattern      = (isCornerCaseBlock ? block : block - numCornerCaseBlocks) * BATCH_SIMULATION_LANE_COUNT;
+            const std::uint64_t numLanes          = std::min<std::uint64_t>(BATCH_SIMULATION_LANE_COUNT, (isCornerCaseBlock ? numCornerCasePatterns : settings.numRandomPatterns) - firstPattern);
+            const std::uint64_t maskOfLanes       = maskOfFirstLanes(numLanes);
+
+            // The ancillary qubits are initialized to zero
+            std::ranges::fill(inputLaneValuesPerQubit, 0U);
+            for (std::size_t i = 0; i < dataQubits.size(); ++i) {
+                inputLaneValuesPerQubit[dataQubits[i]] = maskOfLanes & (isCornerCaseBlock ? determineCornerCaseLaneWord(i, firstPattern, numLanes) : generateRandomLaneWord(settings.seed, (block - numCornerCaseBlocks) * dataQubits.size() + i));
+            }
+
+            laneValuesPerQubit = inputLaneValuesPerQubit;
+            if (!simulationProgram->simulate(laneValuesPerQubit)) {
+                simulationOk = false;
+                return;
+            }
+
+            coverage.numSimulatedPatterns += numLanes;
+            for (std::size_t qubit = 0; qubit < numQubits; ++qubit) {
+                coverage.numOnesPerQubit[qubit] += static_cast<std::uint64_t>(std::popcount(laneValuesPerQubit[qubit] & maskOfLanes));
+                coverage.numFlipsPerQubit[qubit] += static_cast<std::uint64_t>(std::popcount((laneValuesPerQubit[qubit] ^ inputLaneValuesPerQubit[qubit]) & maskOfLanes));
+            }
+        }
+    };
+
+    std::size_t numThreads = Executor::determineNumThreads(settings.numThreads);
+    numThreads             = static_cast<std::size_t>(std::max<std::uint64_t>(1U, std::min<std::uint64_t>(numThreads, numBlocks)));
+
+    std::vector<CoverageOfThread> coveragePerThread(numThreads);
+    std::atomic<bool>             simulationOk = true;
+    const std::uint64_t           numBlocksPerThread = (numBlocks + numThreads - 1U) / numThreads;
+    Executor::getShared().parallelFor(numThreads, [&](const std::size_t i) {
+        const std::uint64_t firstBlock = std::min(numBlocks, i * numBlocksPerThread);
+        const std::uint64_t lastBlock  = std::min(numBlocks, firstBlock + numBlocksPerThread);
+        simulateBlocks(firstBlock, lastBlock, coveragePerThread[i], simulationOk);
+    }, numThreads);
+    if (!simulationOk) {
+        return false;
+    }
+
+    result.numOnesPerQubit.assign(numQubits, 0U);
+    result.numFlipsPerQubit.assign(numQubits, 0U);
+    for (const CoverageOfThread& coverage: coveragePerThread) {
+        result.numSimulatedPatterns += coverage.numSimulatedPatterns;
+        for (std::size_t qubit = 0; qubit < numQubits; ++qubit) {
+            result.numOnesPerQubit[qubit] += coverage.numOnesPerQubit[qubit];
+            result.numFlipsPerQubit[qubit] += coverage.numFlipsPerQubit[qubit];
+        }
+    }
+
+    const TimeStamp simulationEndTime = std::chrono::steady_clock::now();
+    if (optionalRecordedStatistics != nullptr) {
+        optionalRecordedStatistics->recordRuntime(simulationEndTime - simulationStartTime);
+    }
+    return true;
+}
@@ -10,20 +10,30 @@
 
 #include "algorithms/simulation/simple_simulation.hpp"
 
+#include "algorithms/simulation/jit_simulation_program.hpp"
+#include "algorithms/simulation/simulation_program.hpp"
+#include "core/diagnostics.hpp"
+#include "core/frozen_quantum_computation.hpp"
 #include "core/n_bit_values_container.hpp"
 #include "core/statistics.hpp"
 #include "ir/Definitions.hpp"
 #include "ir/QuantumComputation.hpp"
+#include "ir/operations/CompoundOperation.hpp"
 #include "ir/operations/Control.hpp"
 #include "ir/operations/OpType.hpp"
 #include "ir/operations/Operation.hpp"
 
 #include <algorithm>
+#include <bit>
 #include <chrono>
 #include <cstddef>
-#include <iostream>
+#include <cstdint>
+#include <memory>
 #include <optional>
+#include <ostream>
+#include <span>
 #include <string>
+#include <vector>
 
 using namespace syrec;
 
@@ -31,12 +41,144 @@ namespace {
     //Prefer the usage of std::chrono::steady_clock instead of std::chrono::system_clock since the former cannot decrease (due to time zone changes, etc.) and is most suitable for measuring intervals according to (https://en.cppreference.com/w/cpp/chrono/steady_clock)
     using TimeStamp = std::chrono::time_point<std::chrono::steady_clock>;
 
+    // The progress of the bit-parallel simulation of integer states is reported after every 64 blocks of lanes.
+    constexpr std::size_t NUM_INPUTS_PER_PROGRESS_REPORT_OF_BATCH_SIMULATION = BATCH_SIMULATION_LANE_COUNT * 64U;
+
     bool areAllControlQubitsSetInState(const qc::Controls& controlQubits, const NBitValuesContainer& state) {
-        return controlQubits.empty() || std::ranges::all_of(controlQubits, [&state](const qc::Control& controlQubit) { return state.test(controlQubit.qubit).value_or(false); });
+        // A negative control qubit is only satisfied if it is not set.
+        return controlQubits.empty() || std::ranges::all_of(controlQubits, [&state](const qc::Control& controlQubit) {
+                   const std::optional<bool> valueOfControlQubit = state.test(controlQubit.qubit);
+                   return valueOfControlQubit.has_value() && *valueOfControlQubit == (controlQubit.type == qc::Control::Type::Pos);
+               });
+    }
+
+    /**
+     * Determine the lanes in which all control qubits are set (an operation without control qubits is applied in every lane).
+     */
+    [[nodiscard]] std::optional<std::uint64_t> determineLanesWithAllControlQubitsSet(const qc::Controls& controlQubits, const std::vector<std::uint64_t>& laneValuesPerQubit) {
+        std::uint64_t activeLanes = ~static_cast<std::uint64_t>(0);
+        for (const qc::Control& controlQubit: controlQubits) {
+            if (controlQubit.qubit >= laneValuesPerQubit.size()) {
+                return std::nullopt;
+            }
+            activeLanes &= controlQubit.type == qc::Control::Type::Pos ? laneValuesPerQubit[controlQubit.qubit] : ~laneValuesPerQubit[controlQubit.qubit];
+        }
+        return activeLanes;
+    }
+
+    [[nodiscard]] bool doInputStatesMatchNumberOfQubits(const std::vector<NBitValuesContainer>& inputs, const std::size_t numQubits) {
+        for (std::size_t i = 0; i < inputs.size(); ++i) {
+            if (inputs[i].size() != numQubits) {
+                getErrorStream() << "Input state " << std::to_string(i) << " size (" << inputs[i].size() << ") must match number of qubits of the simulation program (" << numQubits << ")\n";
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Bit-parallel simulation of the input states in blocks of NumLaneWordsPerQubit * 64 states, with the lane values of qubit q being stored in the words [q * NumLaneWordsPerQubit, (q + 1) * NumLaneWordsPerQubit) of the lane words passed to the simulation of a block.
+     */
+    template<std::size_t NumLaneWordsPerQubit, typename BlockSimulation>
+    [[nodiscard]] bool simulateInputStatesInBlocks(std::vector<NBitValuesContainer>& outputs, const std::size_t numQubits, const std::vector<NBitValuesContainer>& inputs, const BlockSimulation& simulateBlock) {
+        constexpr std::size_t numLanesPerBlock = NumLaneWordsPerQubit * BATCH_SIMULATION_LANE_COUNT;
+
+        outputs.resize(inputs.size(), NBitValuesContainer(numQubits));
+        std::vector<std::uint64_t> laneWordsPerQubit(numQubits * NumLaneWordsPerQubit, 0U);
+        for (std::size_t firstInputOfBlock = 0; firstInputOfBlock < inputs.size(); firstInputOfBlock += numLanesPerBlock) {
+            const std::size_t numInputsInBlock = std::min(numLanesPerBlock, inputs.size() - firstInputOfBlock);
+
+            std::ranges::fill(laneWordsPerQubit, 0U);
+            for (std::size_t lane = 0; lane < numInputsInBlock; ++lane) {
+                const NBitValuesContainer& input = inputs[firstInputOfBlock + lane];
+                for (std::size_t qubit = 0; qubit < numQubits; ++qubit) {
+                    laneWordsPerQubit[(qubit * NumLaneWordsPerQubit) + (lane / BATCH_SIMULATION_LANE_COUNT)] |= static_cast<std::uint64_t>(input.testUnchecked(qubit)) << (lane % BATCH_SIMULATION_LANE_COUNT);
+                }
+            }
+
+            if (!simulateBlock(laneWordsPerQubit)) {
+                outputs.clear();
+                return false;
+            }
+
+            for (std::size_t lane = 0; lane < numInputsInBlock; ++lane) {
+                NBitValuesContainer& output = outputs[firstInputOfBlock + lane];
+                for (std::size_t qubit = 0; qubit < numQubits; ++qubit) {
+                    output.setUnchecked(qubit, ((laneWordsPerQubit[(qubit * NumLaneWordsPerQubit) + (lane / BATCH_SIMULATION_LANE_COUNT)] >> (lane % BATCH_SIMULATION_LANE_COUNT)) & 1U) != 0U);
+                }
+            }
+        }
+        return true;
+    }
+
+    [[nodiscard]] bool doIntegerInputStatesMatchNumberOfQubits(const std::span<std::uint64_t> outputs, const std::size_t numQubits, const std::span<const std::uint64_t> inputs) {
+        if (numQubits > MAX_NUM_QUBITS_OF_INTEGER_BATCH_SIMULATION) {
+            getErrorStream() << "Number of qubits of the simulation program (" << numQubits << ") must not be larger than " << MAX_NUM_QUBITS_OF_INTEGER_BATCH_SIMULATION << " to store the input and output states as integers\n";
+            return false;
+        }
+        if (outputs.size() != inputs.size()) {
+            getErrorStream() << "Number of output states (" << outputs.size() << ") must match number of input states (" << inputs.size() << ")\n";
+            return false;
+        }
+
+        const std::uint64_t maskOfQubits = numQubits == MAX_NUM_QUBITS_OF_INTEGER_BATCH_SIMULATION ? ~static_cast<std::uint64_t>(0) : (static_cast<std::uint64_t>(1) << numQubits) - 1U;
+        for (std::size_t i = 0; i < inputs.size(); ++i) {
+            if ((inputs[i] & ~maskOfQubits) != 0U) {
+                getErrorStream() << "Input state " << std::to_string(i) << " (" << inputs[i] << ") sets bits not associated with any of the " << numQubits << " qubits of the simulation program\n";
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Bit-parallel simulation of integer input states in blocks of NumLaneWordsPerQubit * 64 states (see simulateInputStatesInBlocks(...)).
+     */
+    template<std::size_t NumLaneWordsPerQubit, typename BlockSimulation>
+    [[nodiscard]] bool simulateIntegerInputStatesInBlocks(const std::span<std::uint64_t> outputs, const std::size_t numQubits, const std::span<const std::uint64_t> inputs, const BatchSimulationProgressCallback& progressCallback, const BlockSimulation& simulateBlock) {
+        constexpr std::size_t numLanesPerBlock = NumLaneWordsPerQubit * BATCH_SIMULATION_LANE_COUNT;
+
+        std::vector<std::uint64_t> laneWordsPerQubit(numQubits * NumLaneWordsPerQubit, 0U);
+        for (std::size_t firstInputOfBlock = 0; firstInputOfBlock < inputs.size(); firstInputOfBlock += numLanesPerBlock) {
+            const std::size_t numInputsInBlock = std::min(numLanesPerBlock, inputs.size() - firstInputOfBlock);
+
+            // Only the set bits of the input and output states are transposed between the integers and the lanes of the qubits.
+            std::ranges::fill(laneWordsPerQubit, 0U);
+            for (std::size_t lane = 0; lane < numInputsInBlock; ++lane) {
+                for (std::uint64_t remainingSetQubits = inputs[firstInputOfBlock + lane]; remainingSetQubits != 0U; remainingSetQubits &= remainingSetQubits - 1U) {
+                    laneWordsPerQubit[(static_cast<std::size_t>(std::countr_zero(remainingSetQubits)) * NumLaneWordsPerQubit) + (lane / BATCH_SIMULATION_LANE_COUNT)] |= static_cast<std::uint64_t>(1) << (lane % BATCH_SIMULATION_LANE_COUNT);
+                }
+            }
+
+            if (!simulateBlock(laneWordsPerQubit)) {
+                return false;
+            }
+
+            std::fill_n(outputs.begin() + static_cast<std::ptrdiff_t>(firstInputOfBlock), numInputsInBlock, 0U);
+            for (std::size_t laneWord = 0; laneWord * BATCH_SIMULATION_LANE_COUNT < numInputsInBlock; ++laneWord) {
+                const std::size_t   numInputsInLaneWord  = std::min(BATCH_SIMULATION_LANE_COUNT, numInputsInBlock - (laneWord * BATCH_SIMULATION_LANE_COUNT));
+                const std::size_t   firstInputOfLaneWord = firstInputOfBlock + (laneWord * BATCH_SIMULATION_LANE_COUNT);
+                const std::uint64_t maskOfLanesInWord    = numInputsInLaneWord == BATCH_SIMULATION_LANE_COUNT ? ~static_cast<std::uint64_t>(0) : (static_cast<std::uint64_t>(1) << numInputsInLaneWord) - 1U;
+                for (std::size_t qubit = 0; qubit < numQubits; ++qubit) {
+                    for (std::uint64_t remainingSetLanes = laneWordsPerQubit[(qubit * NumLaneWordsPerQubit) + laneWord] & maskOfLanesInWord; remainingSetLanes != 0U; remainingSetLanes &= remainingSetLanes - 1U) {
+                        outputs[firstInputOfLaneWord + static_cast<std::size_t>(std::countr_zero(remainingSetLanes))] |= static_cast<std::uint64_t>(1) << qubit;
+                    }
+                }
+            }
+
+            if (const std::size_t numSimulatedInputs = firstInputOfBlock + numInputsInBlock; progressCallback && (numSimulatedInputs % NUM_INPUTS_PER_PROGRESS_REPORT_OF_BATCH_SIMULATION == 0U || numSimulatedInputs == inputs.size()) && !progressCallback(numSimulatedInputs, inputs.size())) {
+                return false;
+            }
+        }
+        return true;
     }
 } // namespace
 
 bool syrec::coreOperationSimulation(const qc::Operation& op, NBitValuesContainer& input) {
+    if (const auto* compoundOperation = dynamic_cast<const qc::CompoundOperation*>(&op); compoundOperation != nullptr) {
+        return std::ranges::all_of(*compoundOperation, [&input](const std::unique_ptr<qc::Operation>& nestedOperation) { return nestedOperation != nullptr && coreOperationSimulation(*nestedOperation, input); });
+    }
+
     const auto gateType = op.getType();
     if (gateType == qc::OpType::X) {
         if (areAllControlQubitsSetInState(op.getControls(), input)) {
@@ -49,21 +191,21 @@ bool syrec::coreOperationSimulation(const qc::Operation& op, NBitValuesContainer
             const qc::Qubit targetQubitOne = op.getTargets()[0];
             const qc::Qubit targetQubitTwo = op.getTargets()[1];
 
-            const bool valueOfTargetQubitOne = input[targetQubitOne];
+            // The bounds of both target qubits are validated by the checked accessor prior to the unchecked flip of their values
             if (input[targetQubitOne] != input[targetQubitTwo]) {
-                input.set(targetQubitOne, input[targetQubitTwo]);
-                input.set(targetQubitTwo, valueOfTargetQubitOne);
+                input.flipUnchecked(targetQubitOne);
+                input.flipUnchecked(targetQubitTwo);
             }
         }
         return true;
     }
-    std::cerr << "Cannot simulate gate of type " << std::to_string(gateType) << "\n";
+    getErrorStream() << "Cannot simulate gate of type " << std::to_string(gateType) << "\n";
     return false;
 }
 
 void syrec::simpleSimulation(NBitValuesContainer& output, const qc::QuantumComputation& quantumComputation, const NBitValuesContainer& input, Statistics* optionalRecordedStatistics) {
     if (input.size() != quantumComputation.getNqubits()) {
-        std::cerr << "Input state size (" << input.size() << ") must match number of qubits in the quantum computation (" << quantumComputation.getNqubits() << ")\n";
+        getErrorStream() << "Input state size (" << input.size() << ") must match number of qubits in the quantum computation (" << quantumComputation.getNqubits() << ")\n";
         return;
     }
 
@@ -76,14 +218,167 @@ void syrec::simpleSimulation(NBitValuesContainer& output, const qc::QuantumCompu
                 return;
             }
         } else {
-            std::cerr << "Operation " << std::to_string(i) + " in quantum computation was NULL!\n";
+            getErrorStream() << "Operation " << std::to_string(i) + " in quantum computation was NULL!\n";
             return;
         }
     }
 
     const TimeStamp simulationEndTime = std::chrono::steady_clock::now();
-    const auto      simulationRunTime = std::chrono::duration_cast<std::chrono::milliseconds>(simulationEndTime - simulationStartTime);
     if (optionalRecordedStatistics != nullptr) {
-        optionalRecordedStatistics->runtimeInMilliseconds = static_cast<double>(simulationRunTime.count());
+        optionalRecordedStatistics->recordRuntime(simulationEndTime - simulationStartTime);
+    }
+}
+
+bool syrec::coreOperationBatchSimulation(const qc::Operation& op, std::vector<std::uint64_t>& laneValuesPerQubit) {
+    if (const auto* compoundOperation = dynamic_cast<const qc::CompoundOperation*>(&op); compoundOperation != nullptr) {
+        return std::ranges::all_of(*compoundOperation, [&laneValuesPerQubit](const std::unique_ptr<qc::Operation>& nestedOperation) { return nestedOperation != nullptr && coreOperationBatchSimulation(*nestedOperation, laneValuesPerQubit); });
+    }
+
+    const auto gateType = op.getType();
+    if (gateType != qc::OpType::X && gateType != qc::OpType::SWAP) {
+        getErrorStream() << "Cannot simulate gate of type " << std::to_string(gateType) << "\n";
+        return false;
+    }
+
+    const std::optional<std::uint64_t> activeLanes = determineLanesWithAllControlQubitsSet(op.getControls(), laneValuesPerQubit);
+    if (!activeLanes.has_value() || std::ranges::any_of(op.getTargets(), [&laneValuesPerQubit](const qc::Qubit targetQubit) { return targetQubit >= laneValuesPerQubit.size(); })) {
+        getErrorStream() << "Qubit of operation was out of range of the simulated lane values\n";
+        return false;
+    }
+
+    if (gateType == qc::OpType::X) {
+        laneValuesPerQubit[op.getTargets().front()] ^= *activeLanes;
+        return true;
+    }
+
+    const qc::Qubit     targetQubitOne = op.getTargets()[0];
+    const qc::Qubit     targetQubitTwo = op.getTargets()[1];
+    const std::uint64_t swappedLanes   = (laneValuesPerQubit[targetQubitOne] ^ laneValuesPerQubit[targetQubitTwo]) & *activeLanes;
+    laneValuesPerQubit[targetQubitOne] ^= swappedLanes;
+    laneValuesPerQubit[targetQubitTwo] ^= swappedLanes;
+    return true;
+}
+
+void syrec::batchSimulation(std::vector<NBitValuesContainer>& outputs, const qc::QuantumComputation& quantumComputation, const std::vector<NBitValuesContainer>& inputs, Statistics* optionalRecordedStatistics) {
+    outputs.clear();
+    const TimeStamp simulationStartTime = std::chrono::steady_clock::now();
+
+    // Compiling the quantum computation once avoids the repeated evaluation of the accessors of every operation for each block of input states
+    const std::optional<SimulationProgram> simulationProgram = SimulationProgram::compile(quantumComputation);
+    if (!simulationProgram.has_value()) {
+        return;
+    }
+    batchSimulation(outputs, *simulationProgram, inputs);
+
+    const TimeStamp simulationEndTime = std::chrono::steady_clock::now();
+    if (optionalRecordedStatistics != nullptr) {
+        optionalRecordedStatistics->recordRuntime(simulationEndTime - simulationStartTime);
+    }
+}
+
+void syrec::batchSimulation(std::vector<NBitValuesContainer>& outputs, const FrozenQuantumComputation& frozenQuantumComputation, const std::vector<NBitValuesContainer>& inputs, Statistics* optionalRecordedStatistics) {
+    outputs.clear();
+    const TimeStamp simulationStartTime = std::chrono::steady_clock::now();
+
+    const std::optional<SimulationProgram> simulationProgram = SimulationProgram::compile(frozenQuantumComputation);
+    if (!simulationProgram.has_value()) {
+        return;
+    }
+    batchSimulation(outputs, *simulationProgram, inputs);
+
+    const TimeStamp simulationEndTime = std::chrono::steady_clock::now();
+    if (optionalRecordedStatistics != nullptr) {
+        optionalRecordedStatistics->recordRuntime(simulationEndTime - simulationStartTime);
+    }
+}
+
+void syrec::simpleSimulation(NBitValuesContainer& output, const SimulationProgram& simulationProgram, const NBitValuesContainer& input, Statistics* optionalRecordedStatistics) {
+    if (input.size() != simulationProgram.getNumQubits()) {
+        getErrorStream() << "Input state size (" << input.size() << ") must match number of qubits of the simulation program (" << simulationProgram.getNumQubits() << ")\n";
+        return;
+    }
+
+    const TimeStamp simulationStartTime = std::chrono::steady_clock::now();
+
+    output = input;
+    if (!simulationProgram.simulate(output)) {
+        return;
+    }
+
+    const TimeStamp simulationEndTime = std::chrono::steady_clock::now();
+    if (optionalRecordedStatistics != nullptr) {
+        optionalRecordedStatistics->recordRuntime(simulationEndTime - simulationStartTime);
+    }
+}
+
+void syrec::batchSimulation(std::vector<NBitValuesContainer>& outputs, const SimulationProgram& simulationProgram, const std::vector<NBitValuesContainer>& inputs, Statistics* optionalRecordedStatistics) {
+    outputs.clear();
+    const std::size_t numQubits = simulationProgram.getNumQubits();
+    if (!doInputStatesMatchNumberOfQubits(inputs, numQubits)) {
+        return;
+    }
+
+    const TimeStamp simulationStartTime = std::chrono::steady_clock::now();
+    if (!simulateInputStatesInBlocks<1U>(outputs, numQubits, inputs, [&simulationProgram](std::vector<std::uint64_t>& laneValuesPerQubit) { return simulationProgram.simulate(laneValuesPerQubit); })) {
+        return;
+    }
+
+    const TimeStamp simulationEndTime = std::chrono::steady_clock::now();
+    if (optionalRecordedStatistics != nullptr) {
+        optionalRecordedStatistics->recordRuntime(simulationEndTime - simulationStartTime);
+    }
+}
+
+bool syrec::batchSimulation(std::span<std::uint64_t> outputs, const SimulationProgram& simulationProgram, std::span<const std::uint64_t> inputs, Statistics* optionalRecordedStatistics, const BatchSimulationProgressCallback& progressCallback) {
+    const std::size_t numQubits = simulationProgram.getNumQubits();
+    if (!doIntegerInputStatesMatchNumberOfQubits(outputs, numQubits, inputs)) {
+        return false;
+    }
+
+    const TimeStamp simulationStartTime = std::chrono::steady_clock::now();
+    if (!simulateIntegerInputStatesInBlocks<1U>(outputs, numQubits, inputs, progressCallback, [&simulationProgram](std::vector<std::uint64_t>& laneValuesPerQubit) { return simulationProgram.simulate(laneValuesPerQubit); })) {
+        return false;
+    }
+
+    const TimeStamp simulationEndTime = std::chrono::steady_clock::now();
+    if (optionalRecordedStatistics != nullptr) {
+        optionalRecordedStatistics->recordRuntime(simulationEndTime - simulationStartTime);
+    }
+    return true;
+}
+
+void syrec::batchSimulation(std::vector<NBitValuesContainer>& outputs, const JitSimulationProgram& jitSimulationProgram, const std::vector<NBitValuesContainer>& inputs, Statistics* optionalRecordedStatistics) {
+    outputs.clear();
+    const std::size_t numQubits = jitSimulationProgram.getNumQubits();
+    if (!doInputStatesMatchNumberOfQubits(inputs, numQubits)) {
+        return;
+    }
+
+    const TimeStamp simulationStartTime = std::chrono::steady_clock::now();
+    if (!simulateInputStatesInBlocks<JitSimulationProgram::NUM_LANE_WORDS_PER_QUBIT>(outputs, numQubits, inputs, [&jitSimulationProgram](std::vector<std::uint64_t>& laneWordsPerQubit) { return jitSimulationProgram.simulate(laneWordsPerQubit); })) {
+        return;
+    }
+
+    const TimeStamp simulationEndTime = std::chrono::steady_clock::now();
+    if (optionalRecordedStatistics != nullptr) {
+        optionalRecordedStatistics->recordRuntime(simulationEndTime - simulationStartTime);
+    }
+}
+
+bool syrec::batchSimulation(std::span<std::uint64_t> outputs, const JitSimulationProgram& jitSimulationProgram, std::span<const std::uint64_t> inputs, Statistics* optionalRecordedStatistics, const BatchSimulationProgressCallback& progressCallback) {
+    const std::size_t numQubits = jitSimulationProgram.getNumQubits();
+    if (!doIntegerInputStatesMatchNumberOfQubits(outputs, numQubits, inputs)) {
+        return false;
+    }
+
+    const TimeStamp simulationStartTime = std::chrono::steady_clock::now();
+    if (!simulateIntegerInputStatesInBlocks<JitSimulationProgram::NUM_LANE_WORDS_PER_QUBIT>(outputs, numQubits, inputs, progressCallback, [&jitSimulationProgram](std::vector<std::uint64_t>& laneWordsPerQubit) { return jitSimulationProgram.simulate(laneWordsPerQubit); })) {
+        return false;
+    }
+
+    const TimeStamp simulationEndTime = std::chrono::steady_clock::now();
+    if (optionalRecordedStatistics != nullptr) {
+        optionalRecordedStatistics->recordRuntime(simulationEndTime - simulationStartTime);
     }
+    return true;
 }
@@ -0,0 +1,423 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/simulation_program.hpp"
+
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/diagnostics.hpp"
+#include "core/frozen_quantum_computation.hpp"
+#include "core/n_bit_values_container.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/CompoundOperation.hpp"
+#include "ir/operations/Control.hpp"
+#include "ir/operations/OpType.hpp"
+#include "ir/operations/Operation.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <string>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    constexpr std::size_t BITS_PER_WORD = NBitValuesContainer::BITS_PER_WORD;
+
+    [[nodiscard]] constexpr std::size_t determineWordIndexOfQubit(const qc::Qubit qubit) noexcept {
+        return static_cast<std::size_t>(qubit) / BITS_PER_WORD;
+    }
+
+    [[nodiscard]] constexpr std::uint64_t determineBitMaskOfQubitInWord(const qc::Qubit qubit) noexcept {
+        return static_cast<std::uint64_t>(1U) << (static_cast<std::size_t>(qubit) % BITS_PER_WORD);
+    }
+
+    [[nodiscard]] bool isQubitSetInState(const std::span<const std::uint64_t> stateWords, const qc::Qubit qubit) noexcept {
+        return (stateWords[determineWordIndexOfQubit(qubit)] & determineBitMaskOfQubitInWord(qubit)) != 0U;
+    }
+
+    /**
+     * Collect the gates of a quantum operation, with the gates of a (nested) compound operation being collected in their order in the latter.
+     */
+    [[nodiscard]] bool collectGatesOfQuantumOperation(const qc::Operation& quantumOperation, std::vector<const qc::Operation*>& gates) {
+        const auto* compoundOperation = dynamic_cast<const qc::CompoundOperation*>(&quantumOperation);
+        if (compoundOperation == nullptr) {
+            gates.emplace_back(&quantumOperation);
+            return true;
+        }
+        return std::ranges::all_of(*compoundOperation, [&gates](const std::unique_ptr<qc::Operation>& nestedQuantumOperation) { return nestedQuantumOperation != nullptr && collectGatesOfQuantumOperation(*nestedQuantumOperation, gates); });
+    }
+
+    /**
+     * Collect the gates of all quantum operations of a quantum computation, with the gates of compound operations being collected in place of the latter.
+     */
+    [[nodiscard]] bool collectGatesOfQuantumComputation(const qc::QuantumComputation& quantumComputation, std::vector<const qc::Operation*>& gates) {
+        gates.reserve(quantumComputation.getNops());
+        for (std::size_t i = 0; i < quantumComputation.getNops(); ++i) {
+            const auto& op = quantumComputation.at(i);
+            if (op == nullptr || !collectGatesOfQuantumOperation(*op, gates)) {
+                getErrorStream() << "Operation " << std::to_string(i) + " in quantum computation was NULL!\n";
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Records the qubits used in the currently fused sequence of CNOT gates to determine whether a further CNOT gate can be appended to said sequence.
+     */
+    class FusedCnotSequenceTracker {
+    public:
+        explicit FusedCnotSequenceTracker(const std::size_t numQubits):
+            isTargetOfSequence(numQubits, false), isControlOfSequence(numQubits, false) {}
+
+        [[nodiscard]] bool canBeAppended(const qc::Qubit controlQubit, const qc::Qubit targetQubit) const {
+            return !isTargetOfSequence[controlQubit] && !isTargetOfSequence[targetQubit] && !isControlOfSequence[targetQubit];
+        }
+
+        void append(const qc::Qubit controlQubit, const qc::Qubit targetQubit) {
+            isControlOfSequence[controlQubit] = true;
+            isTargetOfSequence[targetQubit]   = true;
+            qubitsOfSequence.emplace_back(controlQubit);
+            qubitsOfSequence.emplace_back(targetQubit);
+        }
+
+        void reset() {
+            for (const qc::Qubit qubit: qubitsOfSequence) {
+                isControlOfSequence[qubit] = false;
+                isTargetOfSequence[qubit]  = false;
+            }
+            qubitsOfSequence.clear();
+        }
+
+    protected:
+        std::vector<bool>      isTargetOfSequence;
+        std::vector<bool>      isControlOfSequence;
+        std::vector<qc::Qubit> qubitsOfSequence;
+    };
+    /**
+     * Provides the type, targets and controls of the gates of a quantum computation collected by collectGatesOfQuantumOperation(...).
+     */
+    struct QuantumComputationGateAccessor {
+        const std::vector<const qc::Operation*>& gates;
+
+        [[nodiscard]] qc::OpType getType(const std::size_t gateIndex) const {
+            return gates[gateIndex]->getType();
+        }
+
+        [[nodiscard]] const qc::Targets& getTargetQubits(const std::size_t gateIndex) const {
+            return gates[gateIndex]->getTargets();
+        }
+
+        [[nodiscard]] const qc::Controls& getControls(const std::size_t gateIndex) const {
+            return gates[gateIndex]->getControls();
+        }
+    };
+
+    /**
+     * Provides the type, targets and controls of the gates of a frozen quantum computation, the controls of a gate are stored in a buffer that is reused for every gate.
+     */
+    struct FrozenQuantumComputationGateAccessor {
+        const AnnotatableQuantumComputation::QuantumOperationArrays& quantumOperationArrays;
+        std::vector<qc::Control>                                     controlsOfGate;
+
+        [[nodiscard]] qc::OpType getType(const std::size_t gateIndex) const {
+            return static_cast<qc::OpType>(quantumOperationArrays.opTypes[gateIndex]);
+        }
+
+        [[nodiscard]] std::span<const qc::Qubit> getTargetQubits(const std::size_t gateIndex) const {
+            return std::span(quantumOperationArrays.targetQubits).subspan(quantumOperationArrays.targetOffsets[gateIndex], quantumOperationArrays.targetOffsets[gateIndex + 1] - quantumOperationArrays.targetOffsets[gateIndex]);
+        }
+
+        [[nodiscard]] const std::vector<qc::Control>& getControls(const std::size_t gateIndex) {
+            controlsOfGate.clear();
+            for (std::uint64_t i = quantumOperationArrays.controlOffsets[gateIndex]; i < quantumOperationArrays.controlOffsets[gateIndex + 1]; ++i) {
+                controlsOfGate.emplace_back(quantumOperationArrays.controlQubits[i], quantumOperationArrays.isControlPositive[i] != 0U ? qc::Control::Type::Pos : qc::Control::Type::Neg);
+            }
+            return controlsOfGate;
+        }
+    };
+} // namespace
+
+std::optional<SimulationProgram> SimulationProgram::compile(const qc::QuantumComputation& quantumComputation, const bool fuseCnotGates) {
+    std::vector<const qc::Operation*> gates;
+    if (!collectGatesOfQuantumComputation(quantumComputation, gates)) {
+        return std::nullopt;
+    }
+
+    QuantumComputationGateAccessor gateAccessor{.gates = gates};
+    return compileGates(quantumComputation.getNqubits(), gates.size(), fuseCnotGates, gateAccessor);
+}
+
+std::optional<SimulationProgram> SimulationProgram::compileOutputCone(const qc::QuantumComputation& quantumComputation, const std::span<const qc::Qubit> outputQubits, const bool fuseCnotGates) {
+    const std::size_t numQubits = quantumComputation.getNqubits();
+    if (const auto outputQubitOutOfRange = std::ranges::find_if(outputQubits, [numQubits](const qc::Qubit outputQubit) { return static_cast<std::size_t>(outputQubit) >= numQubits; }); outputQubitOutOfRange != outputQubits.end()) {
+        getErrorStream() << "Output qubit " << std::to_string(*outputQubitOutOfRange) << " must be smaller than the number of qubits of the quantum computation (" << numQubits << ")\n";
+        return std::nullopt;
+    }
+
+    std::vector<const qc::Operation*> gates;
+    if (!collectGatesOfQuantumComputation(quantumComputation, gates)) {
+        return std::nullopt;
+    }
+
+    std::vector<bool> isQubitInCone(numQubits, false);
+    for (const qc::Qubit outputQubit: outputQubits) {
+        isQubitInCone[outputQubit] = true;
+    }
+
+    // The gates are visited in reverse order with a gate being part of the cone if it modifies a qubit of the cone, whose value then also depends on the values of the controls (and both targets of a SWAP gate) prior to the gate.
+    // Gates that cannot be compiled are kept in the cone for their error to be reported by the compilation.
+    const auto isQubitInRange = [numQubits](const qc::Qubit qubit) {
+        return static_cast<std::size_t>(qubit) < numQubits;
+    };
+    std::vector<const qc::Operation*> gatesOfCone;
+    for (auto gate = gates.rbegin(); gate != gates.rend(); ++gate) {
+        const qc::OpType    gateType     = (*gate)->getType();
+        const qc::Targets&  targetQubits = (*gate)->getTargets();
+        const qc::Controls& controls     = (*gate)->getControls();
+        if ((gateType != qc::OpType::X && gateType != qc::OpType::SWAP) || !std::ranges::all_of(targetQubits, isQubitInRange) || !std::ranges::all_of(controls, [&isQubitInRange](const qc::Control& control) { return isQubitInRange(control.qubit); })) {
+            gatesOfCone.emplace_back(*gate);
+            continue;
+        }
+        if (std::ranges::none_of(targetQubits, [&isQubitInCone](const qc::Qubit targetQubit) { return isQubitInCone[targetQubit]; })) {
+            continue;
+        }
+
+        gatesOfCone.emplace_back(*gate);
+        for (const qc::Qubit targetQubit: targetQubits) {
+            isQubitInCone[targetQubit] = true;
+        }
+        for (const qc::Control& control: controls) {
+            isQubitInCone[control.qubit] = true;
+        }
+    }
+    std::ranges::reverse(gatesOfCone);
+
+    QuantumComputationGateAccessor gateAccessor{.gates = gatesOfCone};
+    return compileGates(numQubits, gatesOfCone.size(), fuseCnotGates, gateAccessor);
+}
+
+std::optional<SimulationProgram> SimulationProgram::compile(const FrozenQuantumComputation& frozenQuantumComputation, const bool fuseCnotGates) {
+    FrozenQuantumComputationGateAccessor gateAccessor{.quantumOperationArrays = frozenQuantumComputation.getQuantumOperationArrays(), .controlsOfGate = {}};
+    return compileGates(frozenQuantumComputation.getNqubits(), frozenQuantumComputation.getNumGates(), fuseCnotGates, gateAccessor);
+}
+
+template<typename GateAccessor>
+std::optional<SimulationProgram> SimulationProgram::compileGates(const std::size_t numQubits, const std::size_t numGates, const bool fuseCnotGates, GateAccessor& gateAccessor) {
+    SimulationProgram program;
+    program.numQubits = numQubits;
+    program.numGates  = numGates;
+
+    program.instructionKinds.reserve(program.numGates);
+    program.firstControlTripleOfInstruction.reserve(program.numGates + 1);
+    program.firstTargetQubitOfInstruction.reserve(program.numGates);
+    program.secondTargetQubitOfInstruction.reserve(program.numGates);
+    program.firstFusedCnotOfInstruction.reserve(program.numGates + 1);
+
+    FusedCnotSequenceTracker fusedCnotSequenceTracker(program.numQubits);
+    bool                     isLastInstructionFusedCnotSequence = false;
+
+    const auto isQubitInRange = [&program](const qc::Qubit qubit) {
+        return static_cast<std::size_t>(qubit) < program.numQubits;
+    };
+
+    for (std::size_t i = 0; i < numGates; ++i) {
+        const qc::OpType gateType = gateAccessor.getType(i);
+        if (gateType != qc::OpType::X && gateType != qc::OpType::SWAP) {
+            getErrorStream() << "Cannot simulate gate of type " << std::to_string(gateType) << "\n";
+            return std::nullopt;
+        }
+
+        const auto&       controlQubits           = gateAccessor.getControls(i);
+        const auto&       targetQubits            = gateAccessor.getTargetQubits(i);
+        const std::size_t expectedNumTargetQubits = gateType == qc::OpType::X ? 1U : 2U;
+        if (targetQubits.size() != expectedNumTargetQubits || !std::ranges::all_of(targetQubits, isQubitInRange) || !std::ranges::all_of(controlQubits, [&isQubitInRange](const qc::Control& controlQubit) { return isQubitInRange(controlQubit.qubit); })) {
+            getErrorStream() << "Operation " << std::to_string(i) << " in quantum computation referenced a qubit outside of the range of qubits of the quantum computation\n";
+            return std::nullopt;
+        }
+
+        if (fuseCnotGates && gateType == qc::OpType::X && controlQubits.size() == 1U) {
+            const qc::Control& controlQubit = *controlQubits.begin();
+            const qc::Qubit    targetQubit  = targetQubits.front();
+            if (!isLastInstructionFusedCnotSequence || !fusedCnotSequenceTracker.canBeAppended(controlQubit.qubit, targetQubit)) {
+                fusedCnotSequenceTracker.reset();
+                program.instructionKinds.emplace_back(InstructionKind::FusedCnots);
+                program.firstControlTripleOfInstruction.emplace_back(program.controlWordIndices.size());
+                program.firstTargetQubitOfInstruction.emplace_back(0);
+                program.secondTargetQubitOfInstruction.emplace_back(0);
+                program.firstFusedCnotOfInstruction.emplace_back(program.fusedCnotTargetQubits.size());
+                isLastInstructionFusedCnotSequence = true;
+            }
+            fusedCnotSequenceTracker.append(controlQubit.qubit, targetQubit);
+            program.fusedCnotControlQubits.emplace_back(controlQubit.qubit);
+            program.fusedCnotControlPolarities.emplace_back(controlQubit.type == qc::Control::Type::Pos);
+            program.fusedCnotTargetQubits.emplace_back(targetQubit);
+            continue;
+        }
+
+        isLastInstructionFusedCnotSequence = false;
+        program.instructionKinds.emplace_back(gateType == qc::OpType::X ? InstructionKind::Toggle : InstructionKind::Swap);
+        program.firstControlTripleOfInstruction.emplace_back(program.controlWordIndices.size());
+        program.firstTargetQubitOfInstruction.emplace_back(targetQubits.front());
+        program.secondTargetQubitOfInstruction.emplace_back(targetQubits.back());
+        program.firstFusedCnotOfInstruction.emplace_back(program.fusedCnotTargetQubits.size());
+
+        // Since the controls are ordered by their qubit index, all control qubits located in the same word of the state are visited consecutively.
+        const std::size_t firstControlTripleOfInstruction = program.controlWordIndices.size();
+        for (const qc::Control& controlQubit: controlQubits) {
+            const std::size_t   wordIndex = determineWordIndexOfQubit(controlQubit.qubit);
+            const std::uint64_t bitMask   = determineBitMaskOfQubitInWord(controlQubit.qubit);
+            if (program.controlWordIndices.size() == firstControlTripleOfInstruction || program.controlWordIndices.back() != wordIndex) {
+                program.controlWordIndices.emplace_back(wordIndex);
+                program.controlMasks.emplace_back(0U);
+                program.controlPolarityMasks.emplace_back(0U);
+            }
+            program.controlMasks.back() |= bitMask;
+            if (controlQubit.type == qc::Control::Type::Pos) {
+                program.controlPolarityMasks.back() |= bitMask;
+            }
+        }
+    }
+    program.firstControlTripleOfInstruction.emplace_back(program.controlWordIndices.size());
+    program.firstFusedCnotOfInstruction.emplace_back(program.fusedCnotTargetQubits.size());
+    return program;
+}
+
+bool SimulationProgram::simulate(NBitValuesContainer& state) const {
+    if (state.size() != numQubits) {
+        getErrorStream() << "Input state size (" << state.size() << ") must match number of qubits of the simulation program (" << numQubits << ")\n";
+        return false;
+    }
+
+    const std::span<std::uint64_t> stateWords = state.getWords();
+    const auto                     areControlsOfInstructionSatisfied = [&](const std::size_t instructionIndex) {
+        for (std::size_t i = firstControlTripleOfInstruction[instructionIndex]; i < firstControlTripleOfInstruction[instructionIndex + 1]; ++i) {
+            if ((stateWords[controlWordIndices[i]] & controlMasks[i]) != controlPolarityMasks[i]) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    for (std::size_t instructionIndex = 0; instructionIndex < instructionKinds.size(); ++instructionIndex) {
+        switch (instructionKinds[instructionIndex]) {
+            case InstructionKind::Toggle:
+                if (areControlsOfInstructionSatisfied(instructionIndex)) {
+                    const qc::Qubit targetQubit = firstTargetQubitOfInstruction[instructionIndex];
+                    stateWords[determineWordIndexOfQubit(targetQubit)] ^= determineBitMaskOfQubitInWord(targetQubit);
+                }
+                break;
+            case InstructionKind::Swap:
+                if (areControlsOfInstructionSatisfied(instructionIndex)) {
+                    const qc::Qubit targetQubitOne = firstTargetQubitOfInstruction[instructionIndex];
+                    const qc::Qubit targetQubitTwo = secondTargetQubitOfInstruction[instructionIndex];
+                    if (isQubitSetInState(stateWords, targetQubitOne) != isQubitSetInState(stateWords, targetQubitTwo)) {
+                        stateWords[determineWordIndexOfQubit(targetQubitOne)] ^= determineBitMaskOfQubitInWord(targetQubitOne);
+                        stateWords[determineWordIndexOfQubit(targetQubitTwo)] ^= determineBitMaskOfQubitInWord(targetQubitTwo);
+                    }
+                }
+                break;
+            case InstructionKind::FusedCnots:
+                // The targets of the fused CNOT gates are neither targets nor controls of any other gate in the sequence, thus the order of application does not matter.
+                for (std::size_t i = firstFusedCnotOfInstruction[instructionIndex]; i < firstFusedCnotOfInstruction[instructionIndex + 1]; ++i) {
+                    if (isQubitSetInState(stateWords, fusedCnotControlQubits[i]) == fusedCnotControlPolarities[i]) {
+                        stateWords[determineWordIndexOfQubit(fusedCnotTargetQubits[i])] ^= determineBitMaskOfQubitInWord(fusedCnotTargetQubits[i]);
+                    }
+                }
+                break;
+        }
+    }
+    return true;
+}
+
+bool SimulationProgram::simulate(std::vector<std::uint64_t>& laneValuesPerQubit) const {
+    if (laneValuesPerQubit.size() != numQubits) {
+        getErrorStream() << "Number of lane values (" << laneValuesPerQubit.size() << ") must match number of qubits of the simulation program (" << numQubits << ")\n";
+        return false;
+    }
+
+    for (std::size_t instructionIndex = 0; instructionIndex < instructionKinds.size(); ++instructionIndex) {
+        simulateInstruction(instructionIndex, laneValuesPerQubit, ~static_cast<std::uint64_t>(0));
+    }
+    return true;
+}
+
+void SimulationProgram::simulateInstruction(const std::size_t instructionIndex, std::vector<std::uint64_t>& laneValuesPerQubit, const std::uint64_t maskOfLanes) const {
+    const auto determineLanesWithControlsOfInstructionSatisfied = [&]() {
+        std::uint64_t activeLanes = maskOfLanes;
+        for (std::size_t i = firstControlTripleOfInstruction[instructionIndex]; i < firstControlTripleOfInstruction[instructionIndex + 1]; ++i) {
+            for (std::uint64_t remainingControls = controlMasks[i]; remainingControls != 0U; remainingControls &= remainingControls - 1U) {
+                const auto      bitIndexInWord = static_cast<std::size_t>(std::countr_zero(remainingControls));
+                const qc::Qubit controlQubit   = static_cast<qc::Qubit>((controlWordIndices[i] * BITS_PER_WORD) + bitIndexInWord);
+                activeLanes &= ((controlPolarityMasks[i] >> bitIndexInWord) & 1U) != 0U ? laneValuesPerQubit[controlQubit] : ~laneValuesPerQubit[controlQubit];
+            }
+        }
+        return activeLanes;
+    };
+
+    switch (instructionKinds[instructionIndex]) {
+        case InstructionKind::Toggle:
+            laneValuesPerQubit[firstTargetQubitOfInstruction[instructionIndex]] ^= determineLanesWithControlsOfInstructionSatisfied();
+            break;
+        case InstructionKind::Swap: {
+            std::uint64_t&      lanesOfTargetQubitOne = laneValuesPerQubit[firstTargetQubitOfInstruction[instructionIndex]];
+            std::uint64_t&      lanesOfTargetQubitTwo = laneValuesPerQubit[secondTargetQubitOfInstruction[instructionIndex]];
+            const std::uint64_t swappedLanes          = (lanesOfTargetQubitOne ^ lanesOfTargetQubitTwo) & determineLanesWithControlsOfInstructionSatisfied();
+            lanesOfTargetQubitOne ^= swappedLanes;
+            lanesOfTargetQubitTwo ^= swappedLanes;
+            break;
+        }
+        case InstructionKind::FusedCnots:
+            for (std::size_t i = firstFusedCnotOfInstruction[instructionIndex]; i < firstFusedCnotOfInstruction[instructionIndex + 1]; ++i) {
+                const std::uint64_t lanesOfControlQubit = laneValuesPerQubit[fusedCnotControlQubits[i]];
+                laneValuesPerQubit[fusedCnotTargetQubits[i]] ^= (fusedCnotControlPolarities[i] ? lanesOfControlQubit : ~lanesOfControlQubit) & maskOfLanes;
+            }
+            break;
+    }
+}
+
+SimulationProgram::GateArrays SimulationProgram::exportGateArrays() const {
+    GateArrays gateArrays;
+    const auto exportGate = [&gateArrays](const bool isSwapGate, const qc::Qubit firstTargetQubit, const qc::Qubit secondTargetQubit) {
+        gateArrays.isSwapGate.emplace_back(static_cast<std::uint8_t>(isSwapGate));
+        gateArrays.firstTargetQubits.emplace_back(firstTargetQubit);
+        gateArrays.secondTargetQubits.emplace_back(secondTargetQubit);
+        gateArrays.controlOffsets.emplace_back(static_cast<std::uint32_t>(gateArrays.controlQubits.size()));
+    };
+
+    for (std::size_t instructionIndex = 0; instructionIndex < instructionKinds.size(); ++instructionIndex) {
+        if (instructionKinds[instructionIndex] == InstructionKind::FusedCnots) {
+            for (std::size_t i = firstFusedCnotOfInstruction[instructionIndex]; i < firstFusedCnotOfInstruction[instructionIndex + 1]; ++i) {
+                gateArrays.controlQubits.emplace_back(fusedCnotControlQubits[i]);
+                gateArrays.controlPolarities.emplace_back(static_cast<std::uint8_t>(fusedCnotControlPolarities[i]));
+                exportGate(false, fusedCnotTargetQubits[i], fusedCnotTargetQubits[i]);
+            }
+            continue;
+        }
+
+        for (std::size_t i = firstControlTripleOfInstruction[instructionIndex]; i < firstControlTripleOfInstruction[instructionIndex + 1]; ++i) {
+            for (std::uint64_t remainingControls = controlMasks[i]; remainingControls != 0U; remainingControls &= remainingControls - 1U) {
+                const auto bitIndexInWord = static_cast<std::size_t>(std::countr_zero(remainingControls));
+                gateArrays.controlQubits.emplace_back(static_cast<qc::Qubit>((controlWordIndices[i] * BITS_PER_WORD) + bitIndexInWord));
+                gateArrays.controlPolarities.emplace_back(static_cast<std::uint8_t>((controlPolarityMasks[i] >> bitIndexInWord) & 1U));
+            }
+        }
+        const bool isSwapGate = instructionKinds[instructionIndex] == InstructionKind::Swap;
+        exportGate(isSwapGate, firstTargetQubitOfInstruction[instructionIndex], isSwapGate ? secondTargetQubitOfInstruction[instructionIndex] : firstTargetQubitOfInstruction[instructionIndex]);
+    }
+    return gateArrays;
+}
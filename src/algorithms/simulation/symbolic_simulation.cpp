@@ -0,0 +1,375 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/symbolic_simulation.hpp"
+
+#include "algorithms/simulation/equivalence_checking.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/CompoundOperation.hpp"
+#include "ir/operations/Control.hpp"
+#include "ir/operations/OpType.hpp"
+#include "ir/operations/Operation.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace syrec {
+
+    namespace {
+        // the number of entries of the (lossy) computed table of the BDD operations
+        constexpr std::size_t NUM_COMPUTED_TABLE_ENTRIES = static_cast<std::size_t>(1U) << 18U;
+
+        /**
+         * A reduced ordered binary decision diagram (BDD) package without complemented edges, whose nodes are referenced by their index with the indices 0 and 1 referencing the terminals.
+         *
+         * The nodes are never garbage collected, thus the number of nodes only grows during the symbolic simulation. Once the maximum number of nodes is reached, no further nodes are created and
+         * the results of all subsequent operations are invalid.
+         */
+        class BddPackage {
+        public:
+            using Node = std::uint32_t;
+
+            static constexpr Node ZERO = 0U;
+            static constexpr Node ONE  = 1U;
+
+            BddPackage(const std::size_t numVariables, const std::size_t maxNumNodes):
+                numVariables(static_cast<std::uint32_t>(numVariables)), maxNumNodes(std::min<std::size_t>(maxNumNodes, std::numeric_limits<Node>::max())), computedTable(NUM_COMPUTED_TABLE_ENTRIES) {
+                // the level of the terminals is larger than the one of any variable
+                nodes.emplace_back(NodeData{this->numVariables, ZERO, ZERO});
+                nodes.emplace_back(NodeData{this->numVariables, ONE, ONE});
+            }
+
+            [[nodiscard]] auto variable(const std::size_t level) -> Node {
+                return makeNode(static_cast<std::uint32_t>(level), ZERO, ONE);
+            }
+
+            [[nodiscard]] auto conjunction(const Node lhs, const Node rhs) -> Node {
+                return apply(Operation::Conjunction, lhs, rhs);
+            }
+
+            [[nodiscard]] auto exclusiveDisjunction(const Node lhs, const Node rhs) -> Node {
+                return apply(Operation::ExclusiveDisjunction, lhs, rhs);
+            }
+
+            [[nodiscard]] auto negation(const Node node) -> Node {
+                return apply(Operation::ExclusiveDisjunction, node, ONE);
+            }
+
+            [[nodiscard]] auto isLimitExceeded() const noexcept -> bool {
+                return limitExceeded;
+            }
+
+            // the values of the variables (indexed by their level) of an assignment for which the function of the node is one, with the variables not on the path to the terminal being zero.
+            [[nodiscard]] auto determineSatisfyingAssignment(Node node) const -> std::vector<bool> {
+                std::vector<bool> assignment(numVariables, false);
+                while (node != ONE && node != ZERO) {
+                    const auto& [level, low, high] = nodes[node];
+                    // the low successor of a node of a reduced BDD that is not the zero terminal has a path to the one terminal
+                    if (low != ZERO) {
+                        node = low;
+                    } else {
+                        assignment[level] = true;
+                        node              = high;
+                    }
+                }
+                return assignment;
+            }
+
+        private:
+            enum class Operation : std::uint8_t {
+                Conjunction,
+                ExclusiveDisjunction
+            };
+
+            struct NodeData {
+                std::uint32_t level;
+                Node          low;
+                Node          high;
+            };
+
+            struct NodeDataHash {
+                auto operator()(const NodeData& nodeData) const noexcept -> std::size_t {
+                    std::uint64_t hashValue = (static_cast<std::uint64_t>(nodeData.low) << 32U) | nodeData.high;
+                    hashValue ^= static_cast<std::uint64_t>(nodeData.level) * 0x9e3779b97f4a7c15ULL;
+                    hashValue = (hashValue ^ (hashValue >> 30U)) * 0xbf58476d1ce4e5b9ULL;
+                    hashValue = (hashValue ^ (hashValue >> 27U)) * 0x94d049bb133111ebULL;
+                    return static_cast<std::size_t>(hashValue ^ (hashValue >> 31U));
+                }
+            };
+
+            struct NodeDataEqual {
+                auto operator()(const NodeData& lhs, const NodeData& rhs) const noexcept -> bool {
+                    return lhs.level == rhs.level && lhs.low == rhs.low && lhs.high == rhs.high;
+                }
+            };
+
+            // an empty entry references the zero terminal, which never matches the operands of a non-terminal case
+            struct ComputedTableEntry {
+                Operation operation = Operation::Conjunction;
+                Node      lhs       = ZERO;
+                Node      rhs       = ZERO;
+                Node      result    = ZERO;
+            };
+
+            std::uint32_t                                                    numVariables;
+            std::size_t                                                      maxNumNodes;
+            bool                                                             limitExceeded = false;
+            std::vector<NodeData>                                            nodes;
+            std::unordered_map<NodeData, Node, NodeDataHash, NodeDataEqual> uniqueTable;
+            std::vector<ComputedTableEntry>                                  computedTable;
+
+            [[nodiscard]] auto makeNode(const std::uint32_t level, const Node low, const Node high) -> Node {
+                if (low == high) {
+                    return low;
+                }
+                const NodeData nodeData{level, low, high};
+                if (const auto it = uniqueTable.find(nodeData); it != uniqueTable.end()) {
+                    return it->second;
+                }
+                if (nodes.size() >= maxNumNodes) {
+                    limitExceeded = true;
+                    return ZERO;
+                }
+                const auto node = static_cast<Node>(nodes.size());
+                nodes.emplace_back(nodeData);
+                uniqueTable.emplace(nodeData, node);
+                return node;
+            }
+
+            [[nodiscard]] auto apply(const Operation operation, Node lhs, Node rhs) -> Node {
+                // both operations are commutative and the operands are thus ordered to improve the hit ratio of the computed table
+                if (lhs > rhs) {
+                    std::swap(lhs, rhs);
+                }
+                if (operation == Operation::Conjunction) {
+                    if (lhs == ZERO || lhs == rhs) {
+                        return lhs;
+                    }
+                    if (lhs == ONE) {
+                        return rhs;
+                    }
+                } else {
+                    if (lhs == rhs) {
+                        return ZERO;
+                    }
+                    if (lhs == ZERO) {
+                        return rhs;
+                    }
+                }
+                if (limitExceeded) {
+                    return ZERO;
+                }
+
+                const std::uint64_t key   = (static_cast<std::uint64_t>(lhs) << 32U | rhs) * 0x9e3779b97f4a7c15ULL + static_cast<std::uint64_t>(operation);
+                auto&               entry = computedTable[static_cast<std::size_t>(key >> 46U) & (NUM_COMPUTED_TABLE_ENTRIES - 1U)];
+                if (entry.operation == operation && entry.lhs == lhs && entry.rhs == rhs) {
+                    return entry.result;
+                }
+
+                const NodeData lhsData = nodes[lhs];
+                const NodeData rhsData = nodes[rhs];
+                const auto     level   = std::min(lhsData.level, rhsData.level);
+                const Node     low     = apply(operation, lhsData.level == level ? lhsData.low : lhs, rhsData.level == level ? rhsData.low : rhs);
+                const Node     high    = apply(operation, lhsData.level == level ? lhsData.high : lhs, rhsData.level == level ? rhsData.high : rhs);
+                const Node     result  = makeNode(level, low, high);
+                if (!limitExceeded) {
+                    entry = ComputedTableEntry{operation, lhs, rhs, result};
+                }
+                return result;
+            }
+        };
+
+        // the gates of a quantum operation, with the gates of a (nested) compound operation being collected in their order in the latter.
+        [[nodiscard]] auto collectGates(const qc::Operation& quantumOperation, std::vector<const qc::Operation*>& gates) -> bool {
+            const auto* compoundOperation = dynamic_cast<const qc::CompoundOperation*>(&quantumOperation);
+            if (compoundOperation == nullptr) {
+                gates.emplace_back(&quantumOperation);
+                return true;
+            }
+            return std::ranges::all_of(*compoundOperation, [&gates](const std::unique_ptr<qc::Operation>& nestedQuantumOperation) { return nestedQuantumOperation != nullptr && collectGates(*nestedQuantumOperation, gates); });
+        }
+
+        // the X and SWAP gates of the quantum computation, std::nullopt if it contains any other gate or a gate operating on a qubit outside of its range of qubits.
+        [[nodiscard]] auto collectSupportedGates(const qc::QuantumComputation& quantumComputation) -> std::optional<std::vector<const qc::Operation*>> {
+            std::vector<const qc::Operation*> gates;
+            for (const auto& quantumOperation: quantumComputation) {
+                if (quantumOperation == nullptr || !collectGates(*quantumOperation, gates)) {
+                    return std::nullopt;
+                }
+            }
+            const auto isQubitInRange = [&quantumComputation](const qc::Qubit qubit) {
+                return static_cast<std::size_t>(qubit) < quantumComputation.getNqubits();
+            };
+            for (const auto* gate: gates) {
+                const auto gateType = gate->getType();
+                if ((gateType != qc::OpType::X || gate->getTargets().size() != 1U) && (gateType != qc::OpType::SWAP || gate->getTargets().size() != 2U)) {
+                    return std::nullopt;
+                }
+                if (!std::ranges::all_of(gate->getTargets(), isQubitInRange) || !std::ranges::all_of(gate->getControls(), [&isQubitInRange](const qc::Control& control) { return isQubitInRange(control.qubit); })) {
+                    return std::nullopt;
+                }
+            }
+            return gates;
+        }
+
+        // the primary inputs (non-ancillary qubits) and primary outputs (non-garbage qubits) of a quantum computation ordered by descending qubit index.
+        auto determinePrimaryLines(const qc::QuantumComputation& quantumComputation, std::vector<qc::Qubit>& inputQubits, std::vector<qc::Qubit>& outputQubits) -> void {
+            for (auto qubit = static_cast<qc::Qubit>(quantumComputation.getNqubits()); qubit-- > 0U;) {
+                if (!quantumComputation.logicalQubitIsAncillary(qubit)) {
+                    inputQubits.emplace_back(qubit);
+                }
+                if (!quantumComputation.logicalQubitIsGarbage(qubit)) {
+                    outputQubits.emplace_back(qubit);
+                }
+            }
+        }
+
+        // the level of the variable associated with every primary input.
+        auto determineLevelPerPrimaryInput(const std::vector<const qc::Operation*>& gates, const std::vector<qc::Qubit>& inputQubits, const std::size_t numQubits, const SymbolicSimulationSettings::VariableOrder variableOrder) -> std::vector<std::size_t> {
+            const std::size_t        numPrimaryInputs = inputQubits.size();
+            std::vector<std::size_t> levelPerPrimaryInput(numPrimaryInputs);
+            if (variableOrder == SymbolicSimulationSettings::VariableOrder::PrimaryInputs) {
+                for (std::size_t i = 0U; i < numPrimaryInputs; ++i) {
+                    levelPerPrimaryInput[i] = i;
+                }
+                return levelPerPrimaryInput;
+            }
+
+            constexpr auto           unordered = std::numeric_limits<std::size_t>::max();
+            std::vector<std::size_t> primaryInputPerQubit(numQubits, unordered);
+            for (std::size_t i = 0U; i < numPrimaryInputs; ++i) {
+                primaryInputPerQubit[inputQubits[i]] = i;
+            }
+            std::ranges::fill(levelPerPrimaryInput, unordered);
+            std::size_t nextLevel = 0U;
+            const auto  order     = [&](const qc::Qubit qubit) {
+                if (const auto primaryInput = primaryInputPerQubit[qubit]; primaryInput != unordered && levelPerPrimaryInput[primaryInput] == unordered) {
+                    levelPerPrimaryInput[primaryInput] = nextLevel++;
+                }
+            };
+            for (const auto* gate: gates) {
+                for (const auto& control: gate->getControls()) {
+                    order(control.qubit);
+                }
+                for (const auto target: gate->getTargets()) {
+                    order(target);
+                }
+            }
+            for (auto& level: levelPerPrimaryInput) {
+                if (level == unordered) {
+                    level = nextLevel++;
+                }
+            }
+            return levelPerPrimaryInput;
+        }
+
+        // the BDDs of all qubits after the simulation of the gates, std::nullopt if the maximum number of nodes was exceeded.
+        [[nodiscard]] auto simulateSymbolically(BddPackage& bddPackage, const std::vector<const qc::Operation*>& gates, const std::size_t numQubits, const std::vector<qc::Qubit>& inputQubits, const std::vector<BddPackage::Node>& variablePerPrimaryInput) -> std::optional<std::vector<BddPackage::Node>> {
+            // the ancillary qubits are initialized to zero
+            std::vector<BddPackage::Node> nodePerQubit(numQubits, BddPackage::ZERO);
+            for (std::size_t i = 0U; i < inputQubits.size(); ++i) {
+                nodePerQubit[inputQubits[i]] = variablePerPrimaryInput[i];
+            }
+
+            for (const auto* gate: gates) {
+                auto condition = BddPackage::ONE;
+                for (const auto& control: gate->getControls()) {
+                    const auto valueOfControl = nodePerQubit[control.qubit];
+                    condition                 = bddPackage.conjunction(condition, control.type == qc::Control::Type::Pos ? valueOfControl : bddPackage.negation(valueOfControl));
+                }
+
+                const auto& targets = gate->getTargets();
+                if (gate->getType() == qc::OpType::X) {
+                    nodePerQubit[targets.front()] = bddPackage.exclusiveDisjunction(nodePerQubit[targets.front()], condition);
+                } else {
+                    // the values of both targets are XOR-ed with their difference for the assignments satisfying the controls
+                    const auto difference         = bddPackage.conjunction(condition, bddPackage.exclusiveDisjunction(nodePerQubit[targets[0]], nodePerQubit[targets[1]]));
+                    nodePerQubit[targets[0]] = bddPackage.exclusiveDisjunction(nodePerQubit[targets[0]], difference);
+                    nodePerQubit[targets[1]] = bddPackage.exclusiveDisjunction(nodePerQubit[targets[1]], difference);
+                }
+                if (bddPackage.isLimitExceeded()) {
+                    return std::nullopt;
+                }
+            }
+            return nodePerQubit;
+        }
+    } // namespace
+
+    auto checkEquivalenceSymbolically(const qc::QuantumComputation& lhs, const qc::QuantumComputation& rhs, const SymbolicSimulationSettings& settings) -> EquivalenceCheckingResult {
+        EquivalenceCheckingResult result;
+
+        const auto lhsGates = collectSupportedGates(lhs);
+        const auto rhsGates = collectSupportedGates(rhs);
+        if (!lhsGates.has_value() || !rhsGates.has_value()) {
+            result.outcome = EquivalenceCheckingResult::Outcome::NotSupported;
+            return result;
+        }
+
+        std::vector<qc::Qubit> lhsInputQubits;
+        std::vector<qc::Qubit> lhsOutputQubits;
+        std::vector<qc::Qubit> rhsInputQubits;
+        std::vector<qc::Qubit> rhsOutputQubits;
+        determinePrimaryLines(lhs, lhsInputQubits, lhsOutputQubits);
+        determinePrimaryLines(rhs, rhsInputQubits, rhsOutputQubits);
+        if (lhsInputQubits.size() != rhsInputQubits.size() || lhsOutputQubits.size() != rhsOutputQubits.size()) {
+            result.outcome = EquivalenceCheckingResult::Outcome::NotEquivalent;
+            return result;
+        }
+
+        const std::size_t numPrimaryInputs     = lhsInputQubits.size();
+        const auto        levelPerPrimaryInput = determineLevelPerPrimaryInput(*lhsGates, lhsInputQubits, lhs.getNqubits(), settings.variableOrder);
+
+        BddPackage                    bddPackage(numPrimaryInputs, settings.maxNumNodes);
+        std::vector<BddPackage::Node> variablePerPrimaryInput(numPrimaryInputs);
+        for (std::size_t i = 0U; i < numPrimaryInputs; ++i) {
+            variablePerPrimaryInput[i] = bddPackage.variable(levelPerPrimaryInput[i]);
+        }
+
+        const auto lhsNodePerQubit = simulateSymbolically(bddPackage, *lhsGates, lhs.getNqubits(), lhsInputQubits, variablePerPrimaryInput);
+        const auto rhsNodePerQubit = lhsNodePerQubit.has_value() ? simulateSymbolically(bddPackage, *rhsGates, rhs.getNqubits(), rhsInputQubits, variablePerPrimaryInput) : std::nullopt;
+        if (!rhsNodePerQubit.has_value() || bddPackage.isLimitExceeded()) {
+            result.outcome = EquivalenceCheckingResult::Outcome::LimitExceeded;
+            return result;
+        }
+
+        // the BDDs of both primary outputs are the same node iff they represent the same function
+        for (std::size_t j = 0U; j < lhsOutputQubits.size(); ++j) {
+            const auto lhsOutput = (*lhsNodePerQubit)[lhsOutputQubits[j]];
+            const auto rhsOutput = (*rhsNodePerQubit)[rhsOutputQubits[j]];
+            if (lhsOutput == rhsOutput) {
+                continue;
+            }
+
+            const auto difference = bddPackage.exclusiveDisjunction(lhsOutput, rhsOutput);
+            if (bddPackage.isLimitExceeded()) {
+                result.outcome = EquivalenceCheckingResult::Outcome::LimitExceeded;
+                return result;
+            }
+            const auto valuePerLevel = bddPackage.determineSatisfyingAssignment(difference);
+            result.outcome           = EquivalenceCheckingResult::Outcome::NotEquivalent;
+            result.counterexample.resize(numPrimaryInputs);
+            for (std::size_t i = 0U; i < numPrimaryInputs; ++i) {
+                result.counterexample[i] = valuePerLevel[levelPerPrimaryInput[i]];
+            }
+            return result;
+        }
+        result.outcome = EquivalenceCheckingResult::Outcome::Equivalent;
+        return result;
+    }
+
+} // namespace syrec
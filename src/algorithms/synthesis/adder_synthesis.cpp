@@ -0,0 +1,312 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/adder_synthesis.hpp"
+
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "ir/Definitions.hpp"
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    using ToffoliGate = std::array<qc::Qubit, 3>;
+
+    [[nodiscard]] std::size_t floorOfLog2(const std::size_t value) {
+        return value == 0 ? 0 : static_cast<std::size_t>(std::bit_width(value)) - 1U;
+    }
+
+    // The carry lookahead adder only determines the carries into the bits 1, ..., N - 1 of the operands if no carry out is computed since the carry into bit i only depends on the bits 0, ..., i - 1.
+    [[nodiscard]] std::size_t determineNumberOfBitsSpannedByCarryLookahead(const std::size_t bitwidth, const bool isCarryOutComputed) {
+        return isCarryOutComputed ? bitwidth : bitwidth - 1U;
+    }
+
+    [[nodiscard]] std::size_t determineNumberOfAncillaryQubitsStoringBlockPropagates(const std::size_t numBits) {
+        std::size_t numAncillaryQubits = 0;
+        for (std::size_t t = 1; t < floorOfLog2(numBits); ++t) {
+            numAncillaryQubits += (numBits >> t) - 1U;
+        }
+        return numAncillaryQubits;
+    }
+
+    // The number of Toffoli gates returned by determineGatesOfCarryLookaheadTree(...) for the given number of spanned bits.
+    [[nodiscard]] std::size_t determineNumberOfGatesOfCarryLookaheadTree(const std::size_t numBits) {
+        const std::size_t numLevels = floorOfLog2(numBits);
+
+        std::size_t numGatesOfPropagateRounds = 0;
+        for (std::size_t t = 1; t < numLevels; ++t) {
+            numGatesOfPropagateRounds += (numBits >> t) > 0 ? (numBits >> t) - 1U : 0U;
+        }
+
+        std::size_t numGates = 2U * numGatesOfPropagateRounds;
+        for (std::size_t t = 1; t <= numLevels; ++t) {
+            numGates += numBits >> t;
+        }
+        for (std::size_t t = floorOfLog2((2U * numBits) / 3U); t > 0; --t) {
+            const std::size_t blockSize = static_cast<std::size_t>(1U) << t;
+            numGates += (numBits - (blockSize / 2U)) / blockSize;
+        }
+        return numGates;
+    }
+
+    [[nodiscard]] bool addToffoliGates(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<ToffoliGate>& toffoliGates) {
+        bool synthesisOk = true;
+        for (std::size_t i = 0; i < toffoliGates.size() && synthesisOk; ++i) {
+            synthesisOk = annotatableQuantumComputation.addOperationsImplementingToffoliGate(toffoliGates[i][0], toffoliGates[i][1], toffoliGates[i][2]);
+        }
+        return synthesisOk;
+    }
+
+    [[nodiscard]] bool addToffoliGatesInReverseOrder(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<ToffoliGate>& toffoliGates) {
+        bool synthesisOk = true;
+        for (std::size_t i = toffoliGates.size(); i > 0 && synthesisOk; --i) {
+            synthesisOk = annotatableQuantumComputation.addOperationsImplementingToffoliGate(toffoliGates[i - 1][0], toffoliGates[i - 1][1], toffoliGates[i - 1][2]);
+        }
+        return synthesisOk;
+    }
+
+    [[nodiscard]] bool synthesizeRippleCarryAddition(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::span<const qc::Qubit> lhs, const std::span<const qc::Qubit> rhs, const std::optional<qc::Qubit>& optionalCarryOut) {
+        bool synthesisOk = true;
+        if (rhs.size() == 1) {
+            synthesisOk = annotatableQuantumComputation.addOperationsImplementingCnotGate(lhs.front(), rhs.front());
+            return synthesisOk;
+        }
+
+        const std::size_t bitwidth = rhs.size();
+        const auto&       a        = lhs;
+        const auto&       b        = rhs;
+
+        // Implementation of the addition algorithm (a + b) mod N (N > 1) defined in the paper "Quantum Addition Circuits and Unbounded Fan-Out" (https://arxiv.org/abs/0910.2530v1)
+        // based on a ripple-carry adder that requires no ancillary qubits. The sum of the two input operands 'a' and 'b' is stored in the qubits of the operand 'b'
+        // (i.e. the right-hand side operand of the expression (a + b)). We will use N to denote the bitwidth of the operands in the description of the steps of the algorithm.
+
+        // 1. Calculate the terms (a_i XOR b_i) for all 0 < i < N and store results in b_i as CNOT(control: a_i, target: b_i)
+        synthesisOk = annotatableQuantumComputation.addOperationsImplementingCnotGates(a.subspan(1, bitwidth - 1), b.subspan(1, bitwidth - 1));
+
+        // Optionally copy the value of the qubit a[N - 1] for the calculation of the carry out qubit
+        synthesisOk &= !optionalCarryOut.has_value() || annotatableQuantumComputation.addOperationsImplementingCnotGate(a[bitwidth - 1], *optionalCarryOut);
+
+        // 2. For every N > i > 0 store a backup of a_(i - 1) into a_i as CNOT(control: a_(i - 1), target: a_i)
+        for (std::size_t i = bitwidth - 1; i > 1 && synthesisOk; --i) {
+            synthesisOk = annotatableQuantumComputation.addOperationsImplementingCnotGate(a[i - 1], a[i]);
+        }
+
+        // 3. Calculate the carry bits and store them in a_i for every 0 <= i < (N - 1) as TOFFOLI(controls: {b_i, a_i}, target: a_(i + 1))
+        for (std::size_t i = 0; i < bitwidth - 1 && synthesisOk; ++i) {
+            synthesisOk = annotatableQuantumComputation.addOperationsImplementingToffoliGate(b[i], a[i], a[i + 1]);
+        }
+
+        // Optionally calculate the value of carry out qubit
+        synthesisOk &= !optionalCarryOut.has_value() || annotatableQuantumComputation.addOperationsImplementingToffoliGate(a[bitwidth - 1], b[bitwidth - 1], *optionalCarryOut);
+
+        // 4. Calculate term (b_i XOR c_i) of the final sum terms (a_i XOR b_i XOR c_i) and "remove" the carry bit values from the lines (a_(i - 1)) storing the backup values of a_i for all N > i > 0:
+        //    - CNOT(control: a_i, b_i)
+        //    - TOFFOLI(controls: {a_(i - 1), b_(i - 1)}, target: a_i)
+        for (std::size_t i = bitwidth - 1; i > 0 && synthesisOk; --i) {
+            synthesisOk = annotatableQuantumComputation.addOperationsImplementingCnotGate(a[i], b[i]) && annotatableQuantumComputation.addOperationsImplementingToffoliGate(a[i - 1], b[i - 1], a[i]);
+        }
+
+        // 5. Restore the backup values storing in (a_(i - 1)) back to a_i as: 0 < i < N - 1: CNOT(control: a_i, target: a_(i + 1))
+        for (std::size_t i = 1; i < bitwidth - 1 && synthesisOk; ++i) {
+            synthesisOk = annotatableQuantumComputation.addOperationsImplementingCnotGate(a[i], a[i + 1]);
+        }
+
+        // 6. Calculate the final sum terms as: N > i > 0: CNOT(control: a_i, b_i)
+        for (std::size_t i = bitwidth; i > 0 && synthesisOk; --i) {
+            synthesisOk = annotatableQuantumComputation.addOperationsImplementingCnotGate(a[i - 1], b[i - 1]);
+        }
+        return synthesisOk;
+    }
+
+    [[nodiscard]] bool synthesizeCuccaroAddition(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::span<const qc::Qubit> lhs, const std::span<const qc::Qubit> rhs, const qc::Qubit ancillaryQubitStoringCarryIn, const std::optional<qc::Qubit>& optionalCarryOut) {
+        // Implementation of the ripple-carry adder defined in the paper "A new quantum ripple-carry addition circuit" (https://arxiv.org/abs/quant-ph/0410184) using a chain of majority (MAJ) gates to compute
+        // the carry of every bit into the qubits of the operand 'a' followed by a chain of 'UnMajority and Add' (UMA) gates restoring the qubits of 'a' while storing the sum in the qubits of 'b'.
+        const auto majority = [&](const qc::Qubit carry, const qc::Qubit b, const qc::Qubit a) {
+            return annotatableQuantumComputation.addOperationsImplementingCnotGate(a, b) && annotatableQuantumComputation.addOperationsImplementingCnotGate(a, carry) && annotatableQuantumComputation.addOperationsImplementingToffoliGate(carry, b, a);
+        };
+        const auto unmajorityAndAdd = [&](const qc::Qubit carry, const qc::Qubit b, const qc::Qubit a) {
+            return annotatableQuantumComputation.addOperationsImplementingToffoliGate(carry, b, a) && annotatableQuantumComputation.addOperationsImplementingCnotGate(a, carry) && annotatableQuantumComputation.addOperationsImplementingCnotGate(carry, b);
+        };
+
+        const std::size_t bitwidth    = rhs.size();
+        bool              synthesisOk = majority(ancillaryQubitStoringCarryIn, rhs.front(), lhs.front());
+        for (std::size_t i = 1; i < bitwidth && synthesisOk; ++i) {
+            synthesisOk = majority(lhs[i - 1], rhs[i], lhs[i]);
+        }
+
+        synthesisOk &= !optionalCarryOut.has_value() || annotatableQuantumComputation.addOperationsImplementingCnotGate(lhs[bitwidth - 1], *optionalCarryOut);
+        for (std::size_t i = bitwidth - 1; i > 0 && synthesisOk; --i) {
+            synthesisOk = unmajorityAndAdd(lhs[i - 1], rhs[i], lhs[i]);
+        }
+        return synthesisOk && unmajorityAndAdd(ancillaryQubitStoringCarryIn, rhs.front(), lhs.front());
+    }
+
+    /*
+     * Determine the Toffoli gates of the logarithmic depth carry lookahead tree defined in the paper "A logarithmic-depth quantum carry-lookahead adder" (https://arxiv.org/abs/quant-ph/0406142) that,
+     * given the propagate p_i = a_i XOR b_i of every bit i stored in the qubit of 'b' and the generate g_i = a_i AND b_i stored in the carry qubit of bit i + 1, stores the carry into every bit i + 1 in its carry qubit.
+     * The propagate of the blocks of 2^t bits with t > 0 is computed into additional ancillary qubits which are reset by the last gates of the tree.
+     */
+    [[nodiscard]] std::vector<ToffoliGate> determineGatesOfCarryLookaheadTree(const std::span<const qc::Qubit> propagateQubits, const std::span<const qc::Qubit> ancillaryQubits) {
+        const std::size_t numBits   = propagateQubits.size();
+        const std::size_t numLevels = floorOfLog2(numBits);
+        // The carry out of bit i (i.e. the carry into bit i + 1) is stored in the ancillary qubit i.
+        const auto generateQubit = [&](const std::size_t bit) {
+            return ancillaryQubits[bit];
+        };
+
+        // The propagate of the block m of level t > 0 is only required for m > 0 with the ancillary qubits of the levels being stored after the carry qubits.
+        std::vector<std::size_t> offsetToPropagateQubitsPerLevel(numLevels, numBits);
+        for (std::size_t t = 2; t < numLevels; ++t) {
+            offsetToPropagateQubitsPerLevel[t] = offsetToPropagateQubitsPerLevel[t - 1] + (numBits >> (t - 1U)) - 1U;
+        }
+        const auto propagateQubit = [&](const std::size_t t, const std::size_t m) {
+            return t == 0 ? propagateQubits[m] : ancillaryQubits[offsetToPropagateQubitsPerLevel[t] + m - 1U];
+        };
+
+        std::vector<ToffoliGate> propagateRounds;
+        for (std::size_t t = 1; t < numLevels; ++t) {
+            for (std::size_t m = 1; m < (numBits >> t); ++m) {
+                propagateRounds.emplace_back(ToffoliGate{propagateQubit(t - 1U, 2U * m), propagateQubit(t - 1U, (2U * m) + 1U), propagateQubit(t, m)});
+            }
+        }
+
+        std::vector<ToffoliGate> gates = propagateRounds;
+        for (std::size_t t = 1; t <= numLevels; ++t) {
+            const std::size_t blockSize = static_cast<std::size_t>(1U) << t;
+            for (std::size_t m = 0; m < (numBits >> t); ++m) {
+                gates.emplace_back(ToffoliGate{generateQubit((blockSize * m) + (blockSize / 2U) - 1U), propagateQubit(t - 1U, (2U * m) + 1U), generateQubit((blockSize * m) + blockSize - 1U)});
+            }
+        }
+        for (std::size_t t = floorOfLog2((2U * numBits) / 3U); t > 0; --t) {
+            const std::size_t blockSize = static_cast<std::size_t>(1U) << t;
+            for (std::size_t m = 1; m <= (numBits - (blockSize / 2U)) / blockSize; ++m) {
+                gates.emplace_back(ToffoliGate{generateQubit((blockSize * m) - 1U), propagateQubit(t - 1U, 2U * m), generateQubit((blockSize * m) + (blockSize / 2U) - 1U)});
+            }
+        }
+        gates.insert(gates.end(), propagateRounds.crbegin(), propagateRounds.crend());
+        return gates;
+    }
+
+    [[nodiscard]] bool synthesizeCarryLookaheadAddition(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::span<const qc::Qubit> lhs, const std::span<const qc::Qubit> rhs, const std::span<const qc::Qubit> ancillaryQubits, const std::optional<qc::Qubit>& optionalCarryOut) {
+        const std::size_t bitwidth = rhs.size();
+        const std::size_t numBits  = determineNumberOfBitsSpannedByCarryLookahead(bitwidth, optionalCarryOut.has_value());
+        if (numBits == 0) {
+            return annotatableQuantumComputation.addOperationsImplementingCnotGate(lhs.front(), rhs.front());
+        }
+
+        const std::span<const qc::Qubit> spannedQubitsOfLhs        = lhs.first(numBits);
+        const std::span<const qc::Qubit> spannedQubitsOfRhs        = rhs.first(numBits);
+        const std::vector<ToffoliGate>   gatesOfCarryLookaheadTree = determineGatesOfCarryLookaheadTree(spannedQubitsOfRhs, ancillaryQubits);
+
+        // Compute the generate of every spanned bit into the carry qubits and the propagate of every spanned bit into the qubits of 'b'.
+        const auto computeGenerate = [&]() {
+            bool synthesisOk = true;
+            for (std::size_t i = 0; i < numBits && synthesisOk; ++i) {
+                synthesisOk = annotatableQuantumComputation.addOperationsImplementingToffoliGate(spannedQubitsOfLhs[i], spannedQubitsOfRhs[i], ancillaryQubits[i]);
+            }
+            return synthesisOk;
+        };
+        const auto computePropagate = [&]() {
+            return annotatableQuantumComputation.addOperationsImplementingCnotGates(spannedQubitsOfLhs, spannedQubitsOfRhs);
+        };
+        const auto negateSpannedQubitsOfRhs = [&]() {
+            bool synthesisOk = true;
+            for (std::size_t i = 0; i < numBits && synthesisOk; ++i) {
+                synthesisOk = annotatableQuantumComputation.addOperationsImplementingNotGate(spannedQubitsOfRhs[i]);
+            }
+            return synthesisOk;
+        };
+
+        bool synthesisOk = computeGenerate() && computePropagate() && addToffoliGates(annotatableQuantumComputation, gatesOfCarryLookaheadTree);
+        synthesisOk &= !optionalCarryOut.has_value() || annotatableQuantumComputation.addOperationsImplementingCnotGate(ancillaryQubits[bitwidth - 1U], *optionalCarryOut);
+
+        // The sum bit s_i = p_i XOR c_i with c_0 = 0, the propagate of the most significant bit is not computed if no carry out is computed.
+        for (std::size_t i = 1; i < bitwidth && synthesisOk; ++i) {
+            synthesisOk = annotatableQuantumComputation.addOperationsImplementingCnotGate(ancillaryQubits[i - 1U], rhs[i]);
+        }
+        synthesisOk &= numBits == bitwidth || annotatableQuantumComputation.addOperationsImplementingCnotGate(lhs[bitwidth - 1U], rhs[bitwidth - 1U]);
+
+        // The carries of the addition a + b are equal to the carries of the addition a + NOT(s), the carry qubits are thus reset by applying the inverse of the carry computation to the operands 'a' and 'NOT(s)'.
+        return synthesisOk && negateSpannedQubitsOfRhs() && computePropagate() && addToffoliGatesInReverseOrder(annotatableQuantumComputation, gatesOfCarryLookaheadTree) && computePropagate() && computeGenerate() && negateSpannedQubitsOfRhs();
+    }
+} // namespace
+
+std::size_t syrec::determineNumberOfAncillaryQubitsRequiredByAdder(const AdderArchitecture adderArchitecture, const std::size_t bitwidth, const bool isCarryOutComputed) {
+    if (bitwidth == 0) {
+        return 0;
+    }
+
+    switch (adderArchitecture) {
+        case AdderArchitecture::Cuccaro:
+            return 1;
+        case AdderArchitecture::CarryLookahead: {
+            const std::size_t numBits = determineNumberOfBitsSpannedByCarryLookahead(bitwidth, isCarryOutComputed);
+            return numBits + determineNumberOfAncillaryQubitsStoringBlockPropagates(numBits);
+        }
+        default:
+            return 0;
+    }
+}
+
+NumberOfQuantumOperationsOfAdder syrec::determineNumberOfQuantumOperationsOfAdder(const AdderArchitecture adderArchitecture, const std::size_t bitwidth, const bool isCarryOutComputed) {
+    if (bitwidth == 0) {
+        return {};
+    }
+
+    const auto numQuantumOperationsOfCarryOut = static_cast<std::size_t>(isCarryOutComputed);
+    switch (adderArchitecture) {
+        case AdderArchitecture::RippleCarry:
+            if (bitwidth == 1) {
+                return {.numCnotGates = 1};
+            }
+            return {.numCnotGates = (5U * bitwidth) - 6U + numQuantumOperationsOfCarryOut, .numToffoliGates = (2U * bitwidth) - 2U + numQuantumOperationsOfCarryOut};
+        case AdderArchitecture::Cuccaro:
+            return {.numCnotGates = (4U * bitwidth) + numQuantumOperationsOfCarryOut, .numToffoliGates = 2U * bitwidth};
+        case AdderArchitecture::CarryLookahead: {
+            const std::size_t numBits = determineNumberOfBitsSpannedByCarryLookahead(bitwidth, isCarryOutComputed);
+            if (numBits == 0) {
+                return {.numCnotGates = 1};
+            }
+            // The generates, propagates and the carry lookahead tree are computed and uncomputed while the sum bits and the optional carry out are computed in between.
+            const std::size_t numGatesOfCarryLookaheadTree = determineNumberOfGatesOfCarryLookaheadTree(numBits);
+            return {.numNotGates     = 2U * numBits,
+                    .numCnotGates    = (3U * numBits) + (bitwidth - 1U) + numQuantumOperationsOfCarryOut + static_cast<std::size_t>(numBits != bitwidth),
+                    .numToffoliGates = (2U * numBits) + (2U * numGatesOfCarryLookaheadTree)};
+        }
+    }
+    return {};
+}
+
+bool syrec::synthesizeInplaceAddition(AnnotatableQuantumComputation& annotatableQuantumComputation, const AdderArchitecture adderArchitecture, const std::span<const qc::Qubit> lhs, const std::span<const qc::Qubit> rhs, const std::span<const qc::Qubit> ancillaryQubits, const std::optional<qc::Qubit>& optionalCarryOut) {
+    if (lhs.size() != rhs.size() || ancillaryQubits.size() != determineNumberOfAncillaryQubitsRequiredByAdder(adderArchitecture, rhs.size(), optionalCarryOut.has_value())) {
+        return false;
+    }
+
+    if (rhs.empty()) {
+        return true;
+    }
+
+    switch (adderArchitecture) {
+        case AdderArchitecture::RippleCarry:
+            return synthesizeRippleCarryAddition(annotatableQuantumComputation, lhs, rhs, optionalCarryOut);
+        case AdderArchitecture::Cuccaro:
+            return synthesizeCuccaroAddition(annotatableQuantumComputation, lhs, rhs, ancillaryQubits.front(), optionalCarryOut);
+        case AdderArchitecture::CarryLookahead:
+            return synthesizeCarryLookaheadAddition(annotatableQuantumComputation, lhs, rhs, ancillaryQubits, optionalCarryOut);
+    }
+    return false;
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/ancillary_qubit_pool.hpp"
+
+#include "ir/Definitions.hpp"
+
+#include <optional>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+
+void AncillaryQubitPool::openScope() {
+    scopes.emplace_back();
+}
+
+bool AncillaryQubitPool::closeScope() {
+    if (scopes.size() < 2U) {
+        return false;
+    }
+    std::vector<qc::Qubit> qubitsOfClosedScope = std::move(scopes.back());
+    scopes.pop_back();
+    scopes.back().insert(scopes.back().end(), qubitsOfClosedScope.cbegin(), qubitsOfClosedScope.cend());
+    return true;
+}
+
+void AncillaryQubitPool::releaseQubits(const std::vector<qc::Qubit>& qubits) {
+    for (const qc::Qubit qubit: qubits) {
+        if (releasedQubits.insert(qubit).second) {
+            scopes.back().emplace_back(qubit);
+        }
+    }
+}
+
+std::optional<qc::Qubit> AncillaryQubitPool::tryBorrowQubit() {
+    if (scopes.back().empty()) {
+        return std::nullopt;
+    }
+    const qc::Qubit borrowedQubit = scopes.back().back();
+    scopes.back().pop_back();
+    releasedQubits.erase(borrowedQubit);
+    borrowedQubits.emplace_back(borrowedQubit);
+    return borrowedQubit;
+}
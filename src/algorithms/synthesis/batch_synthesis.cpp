@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/batch_synthesis.hpp"
+
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "algorithms/synthesis/syrec_hybrid_synthesis.hpp"
+#include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/diagnostics.hpp"
+#include "core/executor.hpp"
+
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace {
+    void synthesizeJob(const syrec::BatchSynthesisJob& job, const std::size_t jobIndex, syrec::BatchSynthesisResult& result) {
+        result.annotatableQuantumComputation = std::make_unique<syrec::AnnotatableQuantumComputation>(job.settings.generateQuantumOperationAnnotations);
+        const syrec::ScopedDiagnosticsCollection diagnosticsCollection(result.diagnostics);
+        if (job.program == nullptr) {
+            syrec::getErrorStream() << "Program of batch synthesis job " << std::to_string(jobIndex) << " cannot be NULL\n";
+            return;
+        }
+
+        // Exceptions must not escape the worker threads but should only cause the synthesis of the associated job to fail.
+        try {
+            switch (job.synthesisAlgorithm) {
+                case syrec::SynthesisAlgorithm::CostAware:
+                    result.synthesisOk = syrec::CostAwareSynthesis::synthesize(*result.annotatableQuantumComputation, *job.program, job.settings, &result.statistics);
+                    break;
+                case syrec::SynthesisAlgorithm::LineAware:
+                    result.synthesisOk = syrec::LineAwareSynthesis::synthesize(*result.annotatableQuantumComputation, *job.program, job.settings, &result.statistics);
+                    break;
+                case syrec::SynthesisAlgorithm::Hybrid:
+                    result.synthesisOk = syrec::HybridSynthesis::synthesize(*result.annotatableQuantumComputation, *job.program, job.settings, &result.statistics);
+                    break;
+            }
+        } catch (const std::exception& exception) {
+            syrec::getErrorStream() << "Synthesis of batch synthesis job " << std::to_string(jobIndex) << " failed with exception: " << exception.what() << "\n";
+            result.synthesisOk = false;
+        }
+    }
+} // namespace
+
+namespace syrec {
+    void batchSynthesis(std::vector<BatchSynthesisResult>& results, const std::vector<BatchSynthesisJob>& jobs, const std::size_t numThreads, const bool deterministic) {
+        results.clear();
+        results.resize(jobs.size());
+
+        // Unless a deterministic execution is requested, every thread claims the next not yet started job to balance the load between jobs with largely different synthesis times.
+        Executor::getShared().parallelFor(jobs.size(), [&](const std::size_t jobIndex) { synthesizeJob(jobs[jobIndex], jobIndex, results[jobIndex]); }, numThreads, deterministic);
+    }
+} // namespace syrec
@@ -0,0 +1,345 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/clifford_t_lowering.hpp"
+
+#include "core/diagnostics.hpp"
+#include "core/statistics.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/CompoundOperation.hpp"
+#include "ir/operations/Control.hpp"
+#include "ir/operations/OpType.hpp"
+#include "ir/operations/Operation.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    //Prefer the usage of std::chrono::steady_clock instead of std::chrono::system_clock since the former cannot decrease (due to time zone changes, etc.) and is most suitable for measuring intervals according to (https://en.cppreference.com/w/cpp/chrono/steady_clock)
+    using TimeStamp = std::chrono::time_point<std::chrono::steady_clock>;
+
+    /**
+     * Invoke a callback for a quantum operation or, if the quantum operation is a qc::CompoundOperation, for every of its gates in their order.
+     */
+    template<typename Callback>
+    [[nodiscard]] bool forEachGate(const qc::Operation& quantumOperation, const Callback& callback) {
+        if (const auto* compoundOperation = dynamic_cast<const qc::CompoundOperation*>(&quantumOperation); compoundOperation != nullptr) {
+            return std::ranges::all_of(*compoundOperation, [&callback](const std::unique_ptr<qc::Operation>& nestedOperation) { return nestedOperation != nullptr && forEachGate(*nestedOperation, callback); });
+        }
+        return callback(quantumOperation);
+    }
+
+    template<typename Callback>
+    [[nodiscard]] bool forEachGateOfQuantumComputation(const qc::QuantumComputation& quantumComputation, const Callback& callback) {
+        return std::ranges::all_of(quantumComputation, [&callback](const std::unique_ptr<qc::Operation>& quantumOperation) { return quantumOperation != nullptr && forEachGate(*quantumOperation, callback); });
+    }
+
+    [[nodiscard]] bool isTGate(const qc::Operation& gate) {
+        return gate.getType() == qc::OpType::T || gate.getType() == qc::OpType::Tdg;
+    }
+
+    /*
+     * Emit the decomposition of a Toffoli gate into seven T gates (see Nielsen and Chuang, Quantum Computation and Quantum Information, Figure 4.9).
+     */
+    void emitToffoliGate(qc::QuantumComputation& loweredQuantumComputation, const qc::Qubit firstControlQubit, const qc::Qubit secondControlQubit, const qc::Qubit targetQubit) {
+        loweredQuantumComputation.h(targetQubit);
+        loweredQuantumComputation.cx(secondControlQubit, targetQubit);
+        loweredQuantumComputation.tdg(targetQubit);
+        loweredQuantumComputation.cx(firstControlQubit, targetQubit);
+        loweredQuantumComputation.t(targetQubit);
+        loweredQuantumComputation.cx(secondControlQubit, targetQubit);
+        loweredQuantumComputation.tdg(targetQubit);
+        loweredQuantumComputation.cx(firstControlQubit, targetQubit);
+        loweredQuantumComputation.t(secondControlQubit);
+        loweredQuantumComputation.t(targetQubit);
+        loweredQuantumComputation.h(targetQubit);
+        loweredQuantumComputation.cx(firstControlQubit, secondControlQubit);
+        loweredQuantumComputation.t(firstControlQubit);
+        loweredQuantumComputation.tdg(secondControlQubit);
+        loweredQuantumComputation.cx(firstControlQubit, secondControlQubit);
+    }
+
+    /*
+     * Emit a Toffoli gate up to a relative phase depending on the values of its qubits using four T gates (see Maslov, Advantages of using relative-phase Toffoli gates with an application to multiple control Toffoli optimization).
+     * The emitted gates are self-inverse, the relative phase of the gate is thus cancelled by emitting the gate again after all gates in between left the values of its qubits unchanged.
+     */
+    void emitRelativePhaseToffoliGate(qc::QuantumComputation& loweredQuantumComputation, const qc::Qubit firstControlQubit, const qc::Qubit secondControlQubit, const qc::Qubit targetQubit) {
+        loweredQuantumComputation.h(targetQubit);
+        loweredQuantumComputation.t(targetQubit);
+        loweredQuantumComputation.cx(secondControlQubit, targetQubit);
+        loweredQuantumComputation.tdg(targetQubit);
+        loweredQuantumComputation.cx(firstControlQubit, targetQubit);
+        loweredQuantumComputation.t(targetQubit);
+        loweredQuantumComputation.cx(secondControlQubit, targetQubit);
+        loweredQuantumComputation.tdg(targetQubit);
+        loweredQuantumComputation.h(targetQubit);
+    }
+
+    class CliffordTLowering {
+    public:
+        CliffordTLowering(qc::QuantumComputation& loweredQuantumComputation, const qc::QuantumComputation& quantumComputation, const CliffordTLoweringSettings& settings):
+            loweredQuantumComputation(loweredQuantumComputation), numQubitsOfQuantumComputation(quantumComputation.getNqubits()), settings(settings) {
+            // Ancillary qubits are assumed to be initialized to zero while the values of all other qubits depend on the input state.
+            knownQubitValues.resize(numQubitsOfQuantumComputation);
+            for (std::size_t qubit = 0; qubit < numQubitsOfQuantumComputation; ++qubit) {
+                if (quantumComputation.logicalQubitIsAncillary(static_cast<qc::Qubit>(qubit))) {
+                    knownQubitValues[qubit] = false;
+                }
+            }
+        }
+
+        [[nodiscard]] bool lowerGate(const qc::Operation& gate) {
+            if (gate.getType() != qc::OpType::X && gate.getType() != qc::OpType::SWAP) {
+                getErrorStream() << "Cannot lower gate of type " << qc::toString(gate.getType()) << " to the Clifford+T gate set\n";
+                return false;
+            }
+            if (std::ranges::any_of(gate.getTargets(), [this](const qc::Qubit targetQubit) { return targetQubit >= numQubitsOfQuantumComputation; }) || std::ranges::any_of(gate.getControls(), [this](const qc::Control& controlQubit) { return controlQubit.qubit >= numQubitsOfQuantumComputation; })) {
+                getErrorStream() << "Qubit of operation was out of range of the qubits of the quantum computation\n";
+                return false;
+            }
+
+            std::vector<qc::Qubit> controlQubits;
+            std::vector<qc::Qubit> negativeControlQubits;
+            for (const qc::Control& controlQubit: gate.getControls()) {
+                controlQubits.emplace_back(controlQubit.qubit);
+                if (controlQubit.type == qc::Control::Type::Neg) {
+                    negativeControlQubits.emplace_back(controlQubit.qubit);
+                }
+            }
+
+            for (const qc::Qubit negativeControlQubit: negativeControlQubits) {
+                loweredQuantumComputation.x(negativeControlQubit);
+            }
+            bool wasGateLowered = false;
+            if (gate.getType() == qc::OpType::X) {
+                wasGateLowered = emitMultiControlledXGate(controlQubits, gate.getTargets().front());
+            } else {
+                // A SWAP of the qubits a and b is equal to CNOT(b, a) CNOT(a, b) CNOT(b, a) of which only the middle gate needs to be controlled.
+                const qc::Qubit firstTargetQubit  = gate.getTargets()[0];
+                const qc::Qubit secondTargetQubit = gate.getTargets()[1];
+                loweredQuantumComputation.cx(secondTargetQubit, firstTargetQubit);
+                controlQubits.emplace_back(firstTargetQubit);
+                wasGateLowered = emitMultiControlledXGate(controlQubits, secondTargetQubit);
+                loweredQuantumComputation.cx(secondTargetQubit, firstTargetQubit);
+            }
+            for (const qc::Qubit negativeControlQubit: negativeControlQubits) {
+                loweredQuantumComputation.x(negativeControlQubit);
+            }
+
+            propagateKnownQubitValues(gate);
+            return wasGateLowered;
+        }
+
+    protected:
+        qc::QuantumComputation&          loweredQuantumComputation;
+        std::size_t                      numQubitsOfQuantumComputation;
+        const CliffordTLoweringSettings& settings;
+        // The value of every qubit of the lowered quantum computation prior to the currently lowered gate, std::nullopt if the value depends on the input state.
+        std::vector<std::optional<bool>> knownQubitValues;
+
+        [[nodiscard]] bool emitMultiControlledXGate(const std::vector<qc::Qubit>& controlQubits, const qc::Qubit targetQubit) {
+            if (controlQubits.empty()) {
+                loweredQuantumComputation.x(targetQubit);
+                return true;
+            }
+            if (controlQubits.size() == 1U) {
+                loweredQuantumComputation.cx(controlQubits.front(), targetQubit);
+                return true;
+            }
+            if (controlQubits.size() == 2U) {
+                emitToffoliGate(loweredQuantumComputation, controlQubits[0], controlQubits[1], targetQubit);
+                return true;
+            }
+
+            const std::size_t numRequiredAncillaryQubits = controlQubits.size() - 2U;
+            const auto        isQubitOfGate              = [&controlQubits, targetQubit](const qc::Qubit qubit) {
+                return qubit == targetQubit || std::ranges::find(controlQubits, qubit) != controlQubits.cend();
+            };
+
+            std::vector<qc::Qubit> ancillaryQubits;
+            for (std::size_t qubit = 0; qubit < knownQubitValues.size() && ancillaryQubits.size() < numRequiredAncillaryQubits; ++qubit) {
+                if (knownQubitValues[qubit].has_value() && !*knownQubitValues[qubit] && !isQubitOfGate(static_cast<qc::Qubit>(qubit))) {
+                    ancillaryQubits.emplace_back(static_cast<qc::Qubit>(qubit));
+                }
+            }
+            if (ancillaryQubits.size() < numRequiredAncillaryQubits && settings.addCleanAncillaryQubits) {
+                const std::size_t numAddedAncillaryQubits  = numRequiredAncillaryQubits - ancillaryQubits.size();
+                const auto        firstAddedAncillaryQubit = static_cast<qc::Qubit>(loweredQuantumComputation.getNqubits());
+                loweredQuantumComputation.addAncillaryRegister(numAddedAncillaryQubits, "clifford_t_anc_" + std::to_string(firstAddedAncillaryQubit));
+                knownQubitValues.resize(loweredQuantumComputation.getNqubits(), false);
+                for (std::size_t i = 0; i < numAddedAncillaryQubits; ++i) {
+                    ancillaryQubits.emplace_back(firstAddedAncillaryQubit + static_cast<qc::Qubit>(i));
+                }
+            }
+            if (ancillaryQubits.size() == numRequiredAncillaryQubits) {
+                emitMultiControlledXGateUsingCleanAncillaryQubits(controlQubits, ancillaryQubits, targetQubit);
+                return true;
+            }
+
+            ancillaryQubits.clear();
+            for (std::size_t qubit = 0; qubit < loweredQuantumComputation.getNqubits() && ancillaryQubits.size() < numRequiredAncillaryQubits; ++qubit) {
+                if (!isQubitOfGate(static_cast<qc::Qubit>(qubit))) {
+                    ancillaryQubits.emplace_back(static_cast<qc::Qubit>(qubit));
+                }
+            }
+            if (ancillaryQubits.size() < numRequiredAncillaryQubits) {
+                getErrorStream() << "Cannot lower X gate with " << std::to_string(controlQubits.size()) << " control qubits without adding ancillary qubits since only " << std::to_string(ancillaryQubits.size()) << " idle qubits can be borrowed\n";
+                return false;
+            }
+            emitMultiControlledXGateUsingDirtyAncillaryQubits(controlQubits, ancillaryQubits, targetQubit);
+            return true;
+        }
+
+        void emitComputingToffoliGate(const qc::Qubit firstControlQubit, const qc::Qubit secondControlQubit, const qc::Qubit targetQubit) const {
+            if (settings.useRelativePhaseToffoliGates) {
+                emitRelativePhaseToffoliGate(loweredQuantumComputation, firstControlQubit, secondControlQubit, targetQubit);
+            } else {
+                emitToffoliGate(loweredQuantumComputation, firstControlQubit, secondControlQubit, targetQubit);
+            }
+        }
+
+        /*
+         * The i-th ancillary qubit stores the conjunction of the first i + 2 control qubits while the target qubit is flipped by a Toffoli gate controlled by the last control and ancillary qubit. Since the computing Toffoli gates
+         * are applied in reverse order after the latter, the relative phases of the relative-phase Toffoli gates are cancelled.
+         */
+        void emitMultiControlledXGateUsingCleanAncillaryQubits(const std::vector<qc::Qubit>& controlQubits, const std::vector<qc::Qubit>& ancillaryQubits, const qc::Qubit targetQubit) const {
+            const std::size_t numControlQubits = controlQubits.size();
+            emitComputingToffoliGate(controlQubits[0], controlQubits[1], ancillaryQubits[0]);
+            for (std::size_t i = 2; i + 1U < numControlQubits; ++i) {
+                emitComputingToffoliGate(controlQubits[i], ancillaryQubits[i - 2U], ancillaryQubits[i - 1U]);
+            }
+            emitToffoliGate(loweredQuantumComputation, controlQubits[numControlQubits - 1U], ancillaryQubits[numControlQubits - 3U], targetQubit);
+            for (std::size_t i = numControlQubits - 2U; i >= 2U; --i) {
+                emitComputingToffoliGate(controlQubits[i], ancillaryQubits[i - 2U], ancillaryQubits[i - 1U]);
+            }
+            emitComputingToffoliGate(controlQubits[0], controlQubits[1], ancillaryQubits[0]);
+        }
+
+        /*
+         * Barenco et al., Lemma 7.2: The target qubit is flipped by the Toffoli gate controlled by the last control and ancillary qubit before and after the values of the ancillary qubits were toggled by the conjunction of the
+         * control qubits, which restores the values of the ancillary qubits independent of their initial values. The sequence of Toffoli gates toggling the ancillary qubits is its own inverse.
+         */
+        void emitMultiControlledXGateUsingDirtyAncillaryQubits(const std::vector<qc::Qubit>& controlQubits, const std::vector<qc::Qubit>& ancillaryQubits, const qc::Qubit targetQubit) const {
+            const std::size_t numControlQubits = controlQubits.size();
+            for (std::size_t repetition = 0; repetition < 2U; ++repetition) {
+                emitToffoliGate(loweredQuantumComputation, controlQubits[numControlQubits - 1U], ancillaryQubits[numControlQubits - 3U], targetQubit);
+                for (std::size_t i = numControlQubits - 2U; i >= 2U; --i) {
+                    emitComputingToffoliGate(controlQubits[i], ancillaryQubits[i - 2U], ancillaryQubits[i - 1U]);
+                }
+                emitComputingToffoliGate(controlQubits[0], controlQubits[1], ancillaryQubits[0]);
+                for (std::size_t i = 2; i + 1U < numControlQubits; ++i) {
+                    emitComputingToffoliGate(controlQubits[i], ancillaryQubits[i - 2U], ancillaryQubits[i - 1U]);
+                }
+            }
+        }
+
+        /*
+         * Update the known values of the qubits accessed by a gate of the quantum computation. The decomposition of the gate restores the values of all ancillary qubits it used and thus does not need to be considered.
+         */
+        void propagateKnownQubitValues(const qc::Operation& gate) {
+            bool areAllControlQubitsKnownToBeSatisfied = true;
+            for (const qc::Control& controlQubit: gate.getControls()) {
+                const std::optional<bool>& valueOfControlQubit = knownQubitValues[controlQubit.qubit];
+                if (!valueOfControlQubit.has_value()) {
+                    areAllControlQubitsKnownToBeSatisfied = false;
+                } else if (*valueOfControlQubit != (controlQubit.type == qc::Control::Type::Pos)) {
+                    // The gate is never applied.
+                    return;
+                }
+            }
+
+            if (gate.getType() == qc::OpType::X) {
+                std::optional<bool>& valueOfTargetQubit = knownQubitValues[gate.getTargets().front()];
+                valueOfTargetQubit                      = areAllControlQubitsKnownToBeSatisfied && valueOfTargetQubit.has_value() ? std::make_optional(!*valueOfTargetQubit) : std::nullopt;
+                return;
+            }
+
+            std::optional<bool>& valueOfFirstTargetQubit  = knownQubitValues[gate.getTargets()[0]];
+            std::optional<bool>& valueOfSecondTargetQubit = knownQubitValues[gate.getTargets()[1]];
+            if (areAllControlQubitsKnownToBeSatisfied) {
+                std::swap(valueOfFirstTargetQubit, valueOfSecondTargetQubit);
+            } else if (!valueOfFirstTargetQubit.has_value() || valueOfFirstTargetQubit != valueOfSecondTargetQubit) {
+                valueOfFirstTargetQubit.reset();
+                valueOfSecondTargetQubit.reset();
+            }
+        }
+    };
+} // namespace
+
+bool syrec::lowerToCliffordT(qc::QuantumComputation& loweredQuantumComputation, const qc::QuantumComputation& quantumComputation, const CliffordTLoweringSettings& settings, Statistics* optionalRecordedStatistics) {
+    const TimeStamp loweringStartTime = std::chrono::steady_clock::now();
+
+    loweredQuantumComputation = qc::QuantumComputation(quantumComputation.getNqubits());
+    for (std::size_t qubit = 0; qubit < quantumComputation.getNqubits(); ++qubit) {
+        if (quantumComputation.logicalQubitIsAncillary(static_cast<qc::Qubit>(qubit))) {
+            loweredQuantumComputation.setLogicalQubitAncillary(static_cast<qc::Qubit>(qubit));
+        }
+        if (quantumComputation.logicalQubitIsGarbage(static_cast<qc::Qubit>(qubit))) {
+            loweredQuantumComputation.setLogicalQubitGarbage(static_cast<qc::Qubit>(qubit));
+        }
+    }
+
+    CliffordTLowering lowering(loweredQuantumComputation, quantumComputation, settings);
+    if (!forEachGateOfQuantumComputation(quantumComputation, [&lowering](const qc::Operation& gate) { return lowering.lowerGate(gate); })) {
+        loweredQuantumComputation = qc::QuantumComputation();
+        return false;
+    }
+
+    const TimeStamp loweringEndTime = std::chrono::steady_clock::now();
+    if (optionalRecordedStatistics != nullptr) {
+        optionalRecordedStatistics->recordRuntime(loweringEndTime - loweringStartTime);
+        optionalRecordedStatistics->numTGates = determineTCount(loweredQuantumComputation);
+        optionalRecordedStatistics->tDepth    = determineTDepth(loweredQuantumComputation);
+    }
+    return true;
+}
+
+std::size_t syrec::determineTCount(const qc::QuantumComputation& quantumComputation) {
+    std::size_t tCount = 0;
+    [[maybe_unused]] const bool wereAllGatesVisited = forEachGateOfQuantumComputation(quantumComputation, [&tCount](const qc::Operation& gate) {
+        tCount += isTGate(gate) ? 1U : 0U;
+        return true;
+    });
+    return tCount;
+}
+
+std::size_t syrec::determineTDepth(const qc::QuantumComputation& quantumComputation) {
+    std::vector<std::size_t>    tDepthPerQubit(quantumComputation.getNqubits(), 0U);
+    std::size_t                 tDepth              = 0;
+    [[maybe_unused]] const bool wereAllGatesVisited = forEachGateOfQuantumComputation(quantumComputation, [&tDepthPerQubit, &tDepth](const qc::Operation& gate) {
+        std::vector<qc::Qubit> qubitsOfGate(gate.getTargets().cbegin(), gate.getTargets().cend());
+        for (const qc::Control& controlQubit: gate.getControls()) {
+            qubitsOfGate.emplace_back(controlQubit.qubit);
+        }
+        std::erase_if(qubitsOfGate, [&tDepthPerQubit](const qc::Qubit qubit) { return qubit >= tDepthPerQubit.size(); });
+
+        std::size_t tDepthOfGate = 0;
+        for (const qc::Qubit qubit: qubitsOfGate) {
+            tDepthOfGate = std::max(tDepthOfGate, tDepthPerQubit[qubit]);
+        }
+        tDepthOfGate += isTGate(gate) ? 1U : 0U;
+        for (const qc::Qubit qubit: qubitsOfGate) {
+            tDepthPerQubit[qubit] = tDepthOfGate;
+        }
+        tDepth = std::max(tDepth, tDepthOfGate);
+        return true;
+    });
+    return tDepth;
+}
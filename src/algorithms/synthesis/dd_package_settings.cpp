@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/dd_package_settings.hpp"
+
+#include "dd/DDpackageConfig.hpp"
+#include "dd/Package.hpp"
+
+#include <cstddef>
+#include <memory>
+
+namespace syrec {
+
+    auto DDPackageSettings::toPackageConfig() const -> dd::DDPackageConfig {
+        dd::DDPackageConfig config{};
+        config.utVecNumBucket             = uniqueTableNumBuckets;
+        config.utMatNumBucket             = uniqueTableNumBuckets;
+        config.utVecInitialAllocationSize = uniqueTableInitialAllocationSize;
+        config.utMatInitialAllocationSize = uniqueTableInitialAllocationSize;
+        config.ctMatMatMultNumBucket      = multiplicationComputeTableNumBuckets;
+        config.ctMatVecMultNumBucket      = multiplicationComputeTableNumBuckets;
+        config.ctMatAddNumBucket          = additionComputeTableNumBuckets;
+        config.ctVecAddNumBucket          = additionComputeTableNumBuckets;
+        return config;
+    }
+
+    auto createDDPackage(const std::size_t nQubits, const DDPackageSettings& settings) -> std::unique_ptr<dd::Package> {
+        return std::make_unique<dd::Package>(nQubits, settings.toPackageConfig());
+    }
+
+} // namespace syrec
@@ -11,29 +11,57 @@
 #include "algorithms/synthesis/dd_synthesis.hpp"
 
 #include "algorithms/optimization/esop_minimization.hpp"
+#include "algorithms/synthesis/dd_package_settings.hpp"
 #include "algorithms/synthesis/encoding.hpp"
+#include "algorithms/synthesis/truth_table_pipeline.hpp"
+#include "core/execution_limits.hpp"
+#include "core/executor.hpp"
+#include "core/hash_combine.hpp"
+#include "core/progress_reporting.hpp"
 #include "core/truthTable/truth_table.hpp"
 #include "dd/DDDefinitions.hpp"
 #include "dd/Node.hpp"
 #include "dd/Operations.hpp"
 #include "dd/Package.hpp"
+#include "dd/statistics/PackageStatistics.hpp"
 #include "ir/Definitions.hpp"
 #include "ir/QuantumComputation.hpp"
 #include "ir/operations/Control.hpp"
+#include "ir/operations/OpType.hpp"
 
 #include <algorithm>
 #include <array>
 #include <cassert>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <map>
 #include <memory>
+#include <numeric>
+#include <optional>
 #include <queue>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 using namespace qc::literals;
 
 namespace syrec {
+    namespace {
+        // the range of the column offsets of the sub-tables an input position is added to, with a don't care being expanded symbolically by adding the entry to the sub-tables of both values.
+        auto inputOffsetsOf(const TruthTable::Cube::Value& value) -> std::pair<std::size_t, std::size_t> {
+            if (!value.has_value()) {
+                return {0U, 1U};
+            }
+            const auto offset = static_cast<std::size_t>(*value);
+            return {offset, offset};
+        }
+    } // namespace
+
     auto buildDD(const TruthTable& tt, std::unique_ptr<dd::Package>& dd) -> dd::mEdge {
         // truth table has to have the same number of inputs and outputs
         assert(tt.nInputs() == tt.nOutputs());
@@ -47,15 +75,15 @@ namespace syrec {
         // base case
         if (tt.nInputs() == 1U) {
             for (const auto& [input, output]: tt) {
-                // truth table has to be completely specified
-                const auto in = input[0].value();
-                if (output[0].has_value()) {
-                    const auto index = (static_cast<std::size_t>(*output[0]) * 2U) + static_cast<std::size_t>(in);
-                    edges.at(index)  = dd::mEdge::one();
-                } else {
-                    const auto offset     = in ? 1U : 0U;
-                    edges.at(0U + offset) = dd::mEdge::one();
-                    edges.at(2U + offset) = dd::mEdge::one();
+                const auto [firstOffset, lastOffset] = inputOffsetsOf(input[0]);
+                for (auto offset = firstOffset; offset <= lastOffset; ++offset) {
+                    if (output[0].has_value()) {
+                        const auto index = (static_cast<std::size_t>(*output[0]) * 2U) + offset;
+                        edges.at(index)  = dd::mEdge::one();
+                    } else {
+                        edges.at(0U + offset) = dd::mEdge::one();
+                        edges.at(2U + offset) = dd::mEdge::one();
+                    }
                 }
             }
             return dd->makeDDNode(0, edges);
@@ -64,19 +92,19 @@ namespace syrec {
         // generate sub-tables
         std::array<TruthTable, 4U> subTables{};
         for (const auto& [input, output]: tt) {
-            // truth table has to be completely specified
-            const auto in = input[0].value();
+            const auto [firstOffset, lastOffset] = inputOffsetsOf(input[0]);
 
             TruthTable::Cube reducedInput(input.begin() + 1, input.end());
             TruthTable::Cube reducedOutput(output.begin() + 1, output.end());
 
-            if (output[0].has_value()) {
-                const auto index = (static_cast<std::size_t>(*output[0]) * 2U) + static_cast<std::size_t>(in);
-                subTables.at(index).try_emplace(std::move(reducedInput), std::move(reducedOutput));
-            } else {
-                const auto offset = in ? 1U : 0U;
-                subTables.at(0 + offset).try_emplace(reducedInput, reducedOutput);
-                subTables.at(2 + offset).try_emplace(reducedInput, reducedOutput);
+            for (auto offset = firstOffset; offset <= lastOffset; ++offset) {
+                if (output[0].has_value()) {
+                    const auto index = (static_cast<std::size_t>(*output[0]) * 2U) + offset;
+                    subTables.at(index).try_emplace(reducedInput, reducedOutput);
+                } else {
+                    subTables.at(0 + offset).try_emplace(reducedInput, reducedOutput);
+                    subTables.at(2 + offset).try_emplace(reducedInput, reducedOutput);
+                }
             }
         }
         // recursively build the DD for each sub-table
@@ -90,6 +118,391 @@ namespace syrec {
         return dd->makeDDNode(label, edges);
     }
 
+    namespace {
+        // the sub-tables are stored as ranges of entry indices in a single arena, thus the sub-tables themselves are never copied
+        class MemoizedDDBuilder {
+        public:
+            MemoizedDDBuilder(std::vector<PackedTruthTableEntry> entries, std::unique_ptr<dd::Package>& dd):
+                entries(std::move(entries)), dd(dd) {
+                subTableEntryIndices.resize(this->entries.size());
+                for (std::size_t i = 0U; i < subTableEntryIndices.size(); ++i) {
+                    subTableEntryIndices[i] = i;
+                }
+            }
+
+            auto build(const std::size_t nBits) -> dd::mEdge {
+                return buildSubTable(0U, subTableEntryIndices.size(), nBits);
+            }
+
+        private:
+            struct MemoizedSubTable {
+                std::size_t firstEntryIndex;
+                std::size_t numEntries;
+                std::size_t nBits;
+                dd::mEdge   edge;
+            };
+
+            std::vector<PackedTruthTableEntry>                              entries;
+            std::unique_ptr<dd::Package>&                                   dd;
+            std::vector<std::size_t>                                        subTableEntryIndices;
+            std::unordered_map<std::size_t, std::vector<MemoizedSubTable>> memoizedSubTables;
+
+            [[nodiscard]] static auto reducedMaskOf(const std::size_t nBits) -> std::uint64_t {
+                return nBits >= 64U ? ~static_cast<std::uint64_t>(0U) : ((static_cast<std::uint64_t>(1U) << nBits) - 1U);
+            }
+
+            [[nodiscard]] auto hashOf(const std::size_t firstEntryIndex, const std::size_t numEntries, const std::size_t nBits) const -> std::size_t {
+                const auto  reducedMask = reducedMaskOf(nBits);
+                std::size_t hashValue   = std::hash<std::size_t>()(nBits);
+                for (std::size_t i = firstEntryIndex; i < firstEntryIndex + numEntries; ++i) {
+                    const auto& entry = entries[subTableEntryIndices[i]];
+                    hashCombine(hashValue, entry.input & reducedMask);
+                    hashCombine(hashValue, entry.outputValues & reducedMask);
+                    hashCombine(hashValue, entry.outputDontCares & reducedMask);
+                }
+                return hashValue;
+            }
+
+            [[nodiscard]] auto isSameSubTable(const MemoizedSubTable& memoizedSubTable, const std::size_t firstEntryIndex, const std::size_t numEntries, const std::size_t nBits) const -> bool {
+                if (memoizedSubTable.nBits != nBits || memoizedSubTable.numEntries != numEntries) {
+                    return false;
+                }
+                const auto reducedMask = reducedMaskOf(nBits);
+                for (std::size_t i = 0U; i < numEntries; ++i) {
+                    const auto& entry      = entries[subTableEntryIndices[firstEntryIndex + i]];
+                    const auto& otherEntry = entries[subTableEntryIndices[memoizedSubTable.firstEntryIndex + i]];
+                    if (((entry.input ^ otherEntry.input) & reducedMask) != 0U || ((entry.outputValues ^ otherEntry.outputValues) & reducedMask) != 0U || ((entry.outputDontCares ^ otherEntry.outputDontCares) & reducedMask) != 0U) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            auto buildSubTable(const std::size_t firstEntryIndex, const std::size_t numEntries, const std::size_t nBits) -> dd::mEdge {
+                if (numEntries == 0U || nBits == 0U) {
+                    return dd::mEdge::zero();
+                }
+
+                auto       edges       = std::array<dd::mEdge, 4U>{dd::mEdge::zero(), dd::mEdge::zero(), dd::mEdge::zero(), dd::mEdge::zero()};
+                const auto leadingMask = static_cast<std::uint64_t>(1U) << (nBits - 1U);
+
+                // base case
+                if (nBits == 1U) {
+                    for (std::size_t i = firstEntryIndex; i < firstEntryIndex + numEntries; ++i) {
+                        const auto& entry  = entries[subTableEntryIndices[i]];
+                        const auto  offset = (entry.input & leadingMask) != 0U ? 1U : 0U;
+                        if ((entry.outputDontCares & leadingMask) == 0U) {
+                            const auto index = ((entry.outputValues & leadingMask) != 0U ? 2U : 0U) + offset;
+                            edges.at(index)  = dd::mEdge::one();
+                        } else {
+                            edges.at(0U + offset) = dd::mEdge::one();
+                            edges.at(2U + offset) = dd::mEdge::one();
+                        }
+                    }
+                    return dd->makeDDNode(0, edges);
+                }
+
+                const auto hashValue = hashOf(firstEntryIndex, numEntries, nBits);
+                if (const auto memoizedSubTablesIt = memoizedSubTables.find(hashValue); memoizedSubTablesIt != memoizedSubTables.end()) {
+                    for (const auto& memoizedSubTable: memoizedSubTablesIt->second) {
+                        if (isSameSubTable(memoizedSubTable, firstEntryIndex, numEntries, nBits)) {
+                            return memoizedSubTable.edge;
+                        }
+                    }
+                }
+
+                // generate the sub-tables by appending the entry indices of each of them to the arena (which keeps the order of the entries)
+                std::array<std::size_t, 4U> firstEntryIndexOfSubTables{};
+                std::array<std::size_t, 4U> numEntriesOfSubTables{};
+                for (std::size_t subTable = 0U; subTable < 4U; ++subTable) {
+                    firstEntryIndexOfSubTables.at(subTable) = subTableEntryIndices.size();
+                    const bool inputOfSubTable              = (subTable % 2U) != 0U;
+                    const bool outputOfSubTable             = subTable >= 2U;
+                    for (std::size_t i = firstEntryIndex; i < firstEntryIndex + numEntries; ++i) {
+                        const auto  entryIndex = subTableEntryIndices[i];
+                        const auto& entry      = entries[entryIndex];
+                        if (((entry.input & leadingMask) != 0U) == inputOfSubTable && ((entry.outputDontCares & leadingMask) != 0U || ((entry.outputValues & leadingMask) != 0U) == outputOfSubTable)) {
+                            subTableEntryIndices.emplace_back(entryIndex);
+                        }
+                    }
+                    numEntriesOfSubTables.at(subTable) = subTableEntryIndices.size() - firstEntryIndexOfSubTables.at(subTable);
+                }
+
+                // recursively build the DD for each sub-table
+                for (std::size_t i = 0U; i < 4U; ++i) {
+                    edges.at(i) = buildSubTable(firstEntryIndexOfSubTables.at(i), numEntriesOfSubTables.at(i), nBits - 1U);
+                }
+
+                const auto edge = dd->makeDDNode(static_cast<dd::Qubit>(nBits - 1U), edges);
+                memoizedSubTables[hashValue].emplace_back(MemoizedSubTable{.firstEntryIndex = firstEntryIndex, .numEntries = numEntries, .nBits = nBits, .edge = edge});
+                return edge;
+            }
+        };
+    } // namespace
+
+    auto buildDDMemoized(const TruthTable& tt, std::unique_ptr<dd::Package>& dd) -> dd::mEdge {
+        // truth table has to have the same number of inputs and outputs
+        assert(tt.nInputs() == tt.nOutputs());
+
+        // truth table has to be completely specified with at most 64 inputs
+        const auto packedTt = TruthTablePipeline{}.apply(tt);
+        if (!packedTt.has_value()) {
+            return buildDD(tt, dd);
+        }
+        return buildDDMemoized(*packedTt, dd);
+    }
+
+    auto buildDDMemoized(const PackedTruthTable& tt, std::unique_ptr<dd::Package>& dd) -> dd::mEdge {
+        // truth table has to have the same number of inputs and outputs
+        assert(tt.nInputs == tt.nOutputs);
+
+        if (tt.nInputs == 0U) {
+            return dd::mEdge::zero();
+        }
+
+        MemoizedDDBuilder builder(tt.entries, dd);
+        return builder.build(tt.nInputs);
+    }
+
+    namespace {
+        // the first position of a packed cube is stored in the most significant bit of its bitwidth, thus the i-th position of the reordered cube is the bit `nBits - 1 - order[i]` of the given one
+        auto reorderPackedCube(const std::uint64_t packedCube, const std::vector<std::size_t>& order) -> std::uint64_t {
+            const auto    nBits         = order.size();
+            std::uint64_t reorderedCube = 0U;
+            for (std::size_t i = 0U; i < nBits; ++i) {
+                reorderedCube |= ((packedCube >> (nBits - 1U - order[i])) & 1U) << (nBits - 1U - i);
+            }
+            return reorderedCube;
+        }
+
+        // evaluates the number of nodes of the DD of a packed truth table for different orders of its lines, with all DDs being built in the same package
+        class LineOrderEvaluator {
+        public:
+            explicit LineOrderEvaluator(const PackedTruthTable& tt):
+                tt(tt), reorderedTt(tt), dd(std::make_unique<dd::Package>(tt.nInputs)) {}
+
+            auto numNodes(const std::vector<std::size_t>& order) -> std::size_t {
+                for (std::size_t i = 0U; i < tt.entries.size(); ++i) {
+                    reorderedTt.entries[i].input           = reorderPackedCube(tt.entries[i].input, order);
+                    reorderedTt.entries[i].outputValues    = reorderPackedCube(tt.entries[i].outputValues, order);
+                    reorderedTt.entries[i].outputDontCares = reorderPackedCube(tt.entries[i].outputDontCares, order);
+                }
+                const auto edge = buildDDMemoized(reorderedTt, dd);
+
+                std::unordered_set<const dd::mNode*> visitedNodes;
+                std::vector<const dd::mNode*>        nodesToVisit;
+                if (!edge.isTerminal()) {
+                    visitedNodes.emplace(edge.p);
+                    nodesToVisit.emplace_back(edge.p);
+                }
+                while (!nodesToVisit.empty()) {
+                    const auto* node = nodesToVisit.back();
+                    nodesToVisit.pop_back();
+                    for (const auto& e: node->e) {
+                        if (!e.isTerminal() && visitedNodes.emplace(e.p).second) {
+                            nodesToVisit.emplace_back(e.p);
+                        }
+                    }
+                }
+                // the DDs of the evaluated orders are not referenced and can thus be collected immediately
+                dd->garbageCollect(true);
+                return visitedNodes.size();
+            }
+
+        private:
+            const PackedTruthTable&      tt;
+            PackedTruthTable             reorderedTt;
+            std::unique_ptr<dd::Package> dd;
+        };
+
+        auto siftLines(LineOrderEvaluator& evaluator, std::vector<std::size_t>& order, std::size_t& numNodesOfOrder) -> bool {
+            bool isOrderImproved = false;
+            for (std::size_t line = 0U; line < order.size(); ++line) {
+                // the line is removed from the order and inserted at every position (keeping its current position in case of a tie)
+                const auto currentPosition = static_cast<std::size_t>(std::ranges::find(order, line) - order.begin());
+                auto       bestPosition    = currentPosition;
+                auto       candidateOrder  = order;
+                candidateOrder.erase(candidateOrder.begin() + static_cast<std::ptrdiff_t>(currentPosition));
+                for (std::size_t position = 0U; position < order.size(); ++position) {
+                    if (position == currentPosition) {
+                        continue;
+                    }
+                    candidateOrder.insert(candidateOrder.begin() + static_cast<std::ptrdiff_t>(position), line);
+                    if (const auto numNodes = evaluator.numNodes(candidateOrder); numNodes < numNodesOfOrder) {
+                        numNodesOfOrder = numNodes;
+                        bestPosition    = position;
+                    }
+                    candidateOrder.erase(candidateOrder.begin() + static_cast<std::ptrdiff_t>(position));
+                }
+                if (bestPosition != currentPosition) {
+                    candidateOrder.insert(candidateOrder.begin() + static_cast<std::ptrdiff_t>(bestPosition), line);
+                    order           = std::move(candidateOrder);
+                    isOrderImproved = true;
+                }
+            }
+            return isOrderImproved;
+        }
+
+        auto permuteWindowsOfLines(LineOrderEvaluator& evaluator, std::vector<std::size_t>& order, std::size_t& numNodesOfOrder, const std::size_t windowSize) -> bool {
+            bool isOrderImproved = false;
+            for (std::size_t windowStart = 0U; windowStart + windowSize <= order.size(); ++windowStart) {
+                const auto windowBegin    = order.begin() + static_cast<std::ptrdiff_t>(windowStart);
+                const auto windowEnd      = windowBegin + static_cast<std::ptrdiff_t>(windowSize);
+                auto       bestOrder      = order;
+                auto       candidateOrder = order;
+                const auto candidateBegin = candidateOrder.begin() + static_cast<std::ptrdiff_t>(windowStart);
+                const auto candidateEnd   = candidateBegin + static_cast<std::ptrdiff_t>(windowSize);
+                std::sort(candidateBegin, candidateEnd);
+                do {
+                    if (std::equal(candidateBegin, candidateEnd, windowBegin, windowEnd)) {
+                        continue;
+                    }
+                    if (const auto numNodes = evaluator.numNodes(candidateOrder); numNodes < numNodesOfOrder) {
+                        numNodesOfOrder = numNodes;
+                        bestOrder       = candidateOrder;
+                    }
+                } while (std::next_permutation(candidateBegin, candidateEnd));
+                if (bestOrder != order) {
+                    order           = std::move(bestOrder);
+                    isOrderImproved = true;
+                }
+            }
+            return isOrderImproved;
+        }
+    } // namespace
+
+    auto determineLineOrder(const TruthTable& tt, const LineReorderingSettings& settings) -> std::vector<std::size_t> {
+        std::vector<std::size_t> order(tt.nInputs());
+        std::iota(order.begin(), order.end(), 0U);
+        if (settings.strategy == LineReorderingSettings::Strategy::None || tt.nInputs() <= 1U || tt.nInputs() != tt.nOutputs()) {
+            return order;
+        }
+
+        const auto packedTt = TruthTablePipeline{}.apply(tt);
+        if (!packedTt.has_value()) {
+            return order;
+        }
+
+        LineOrderEvaluator evaluator(*packedTt);
+        std::size_t        numNodesOfOrder = evaluator.numNodes(order);
+        const auto         windowSize      = std::clamp<std::size_t>(settings.windowSize, 2U, order.size());
+        for (std::size_t pass = 0U; pass < settings.maxNumPasses; ++pass) {
+            const bool isOrderImproved = settings.strategy == LineReorderingSettings::Strategy::Sifting ? siftLines(evaluator, order, numNodesOfOrder) : permuteWindowsOfLines(evaluator, order, numNodesOfOrder, windowSize);
+            if (!isOrderImproved) {
+                break;
+            }
+        }
+        return order;
+    }
+
+    auto reorderLines(const TruthTable& tt, const std::vector<std::size_t>& order) -> TruthTable {
+        assert(order.size() == tt.nInputs() && tt.nInputs() == tt.nOutputs());
+        const auto nBits = order.size();
+
+        TruthTable reorderedTt{};
+        for (const auto& [input, output]: tt) {
+            TruthTable::Cube reorderedInput(nBits, false);
+            TruthTable::Cube reorderedOutput(nBits, false);
+            for (std::size_t i = 0U; i < nBits; ++i) {
+                reorderedInput.set(i, input[order[i]]);
+                reorderedOutput.set(i, output[order[i]]);
+            }
+            reorderedTt.try_emplace(std::move(reorderedInput), std::move(reorderedOutput));
+        }
+
+        // the i-th position of a cube is associated with the line `nBits - 1 - i`
+        const auto reorderLineFlags = [&](const std::vector<bool>& flags) {
+            if (flags.size() != nBits) {
+                return flags;
+            }
+            std::vector<bool> reorderedFlags(nBits, false);
+            for (std::size_t i = 0U; i < nBits; ++i) {
+                reorderedFlags[nBits - 1U - i] = flags[nBits - 1U - order[i]];
+            }
+            return reorderedFlags;
+        };
+        reorderedTt.setConstants(reorderLineFlags(tt.getConstants()));
+        reorderedTt.setGarbage(reorderLineFlags(tt.getGarbage()));
+        reorderedTt.useDenseStorageIfComplete();
+        return reorderedTt;
+    }
+
+    namespace {
+        // the first position of a packed cube is stored in the most significant bit of its bitwidth
+        auto unpackCubes(const std::vector<std::uint64_t>& packedCubes, const std::size_t bitwidth, TruthTable::Cube::Set& sigVec) -> void {
+            for (const auto packedCube: packedCubes) {
+                sigVec.emplace(TruthTable::Cube::fromInteger(packedCube, bitwidth));
+            }
+        }
+
+        auto sortAndRemoveDuplicates(std::vector<std::uint64_t>& packedCubes) -> void {
+            std::ranges::sort(packedCubes);
+            const auto duplicatePackedCubes = std::ranges::unique(packedCubes);
+            packedCubes.erase(duplicatePackedCubes.begin(), duplicatePackedCubes.end());
+        }
+    } // namespace
+
+    auto DDSynthesizer::PathSignatureCacheKeyHash::operator()(const PathSignatureCacheKey& key) const noexcept -> std::size_t {
+        std::size_t hashValue = std::hash<const dd::mNode*>()(key.node);
+        hashCombine(hashValue, key.level);
+        hashCombine(hashValue, key.destination);
+        hashCombine(hashValue, key.isIdentity);
+        return hashValue;
+    }
+
+    // Garbage collected nodes can be reused by the DD package for other nodes, thus all memoized paths are invalidated if any node was collected.
+    // Every collection also clears the compute tables of the DD package, thus the policy can defer the collection to keep the computed results of the next iterations.
+    auto DDSynthesizer::garbageCollect(const std::unique_ptr<dd::Package>& dd, const bool isEndOfIteration) -> void {
+        bool isCollectionForced = false;
+        switch (garbageCollectionPolicy.trigger) {
+            case GarbageCollectionPolicy::Trigger::PackageManaged:
+                break;
+            case GarbageCollectionPolicy::Trigger::NodeCountThreshold:
+                if (dd->mUniqueTable.getNumEntries() < garbageCollectionPolicy.nodeCountThreshold) {
+                    return;
+                }
+                isCollectionForced = true;
+                break;
+            case GarbageCollectionPolicy::Trigger::MemoryBudget:
+                if (dd::computeActiveMemoryMiB(*dd) <= garbageCollectionPolicy.memoryBudgetInMiB) {
+                    return;
+                }
+                isCollectionForced = true;
+                break;
+            case GarbageCollectionPolicy::Trigger::EveryKIterations:
+                if (!isEndOfIteration || ++numIterationsSinceGarbageCollection < std::max<std::size_t>(garbageCollectionPolicy.numIterationsBetweenCollections, 1U)) {
+                    return;
+                }
+                numIterationsSinceGarbageCollection = 0U;
+                isCollectionForced                  = true;
+                break;
+        }
+
+        if (dd->garbageCollect(isCollectionForced)) {
+            pathSignatureCache.clear();
+            ++statistics.numGarbageCollections;
+        }
+    }
+
+    auto DDSynthesizer::recordStatistics(const std::unique_ptr<dd::Package>& dd) -> void {
+        statistics.numNodes           = dd->mUniqueTable.getNumEntries();
+        statistics.peakNumNodes       = 0U;
+        statistics.uniqueTableLookups = 0U;
+        statistics.uniqueTableHits    = 0U;
+        for (const auto& uniqueTableStatistics: dd->mUniqueTable.getStats()) {
+            statistics.peakNumNodes += uniqueTableStatistics.peakNumEntries;
+            statistics.uniqueTableLookups += uniqueTableStatistics.lookups;
+            statistics.uniqueTableHits += uniqueTableStatistics.hits;
+        }
+        // the synthesis only multiplies the DDs of the synthesized operations with the DD to synthesize.
+        const auto& computeTableStatistics = dd->matrixMatrixMultiplication.getStats();
+        statistics.computeTableLookups     = computeTableStatistics.lookups;
+        statistics.computeTableHits        = computeTableStatistics.hits;
+        statistics.activeMemoryInMiB       = dd::computeActiveMemoryMiB(*dd);
+        statistics.peakMemoryInMiB         = dd::computePeakMemoryMiB(*dd);
+        statistics.effortMode              = effortMode;
+    }
+
     // This algorithm provides all paths with their signatures from the `src` node to the `current` node.
     // Refer to the control path section of http://www.informatik.uni-bremen.de/agra/doc/konf/12aspdac_qmdd_synth_rev.pdf
     auto DDSynthesizer::pathFromSrcDst(dd::mEdge const& src, dd::mNode* const& dst, TruthTable::Cube::Set& sigVec) -> void {
@@ -101,8 +514,12 @@ namespace syrec {
             }
             return;
         }
+        const auto pathLength = static_cast<std::size_t>(src.p->v - dst->v);
+        if (pathLength <= 64U) {
+            unpackCubes(packedPathsFromSrcDst(src, src.p->v, dst), pathLength, sigVec);
+            return;
+        }
         TruthTable::Cube cube{};
-        const auto       pathLength = static_cast<std::size_t>(src.p->v - dst->v);
         cube.reserve(pathLength);
         pathFromSrcDst(src, src.p->v, dst, sigVec, cube);
     }
@@ -141,6 +558,44 @@ namespace syrec {
         }
     }
 
+    // Memoized variant of pathFromSrcDst(...) determining the packed cubes of the paths from the `src` node on the given level to the `dst` node.
+    auto DDSynthesizer::packedPathsFromSrcDst(dd::mEdge const& src, const size_t level, dd::mNode* const& dst) -> const std::vector<std::uint64_t>& {
+        assert(!src.isTerminal());
+        assert(!dd::mNode::isTerminal(dst));
+
+        const PathSignatureCacheKey key{.node = src.p, .level = level, .destination = dst, .isIdentity = false};
+        if (const auto it = pathSignatureCache.find(key); it != pathSignatureCache.end()) {
+            return it->second;
+        }
+
+        std::vector<std::uint64_t> packedCubes;
+        if (src.p->v < level) {
+            // handle skipped nodes
+            const auto  leadingBit     = static_cast<std::uint64_t>(1U) << (level - static_cast<std::size_t>(dst->v) - 1U);
+            const auto& packedSuffixes = packedPathsFromSrcDst(src, level - 1, dst);
+            packedCubes.reserve(2U * packedSuffixes.size());
+            packedCubes.insert(packedCubes.end(), packedSuffixes.begin(), packedSuffixes.end());
+            for (const auto packedSuffix: packedSuffixes) {
+                packedCubes.emplace_back(leadingBit | packedSuffix);
+            }
+        } else if (level <= dst->v) {
+            if (src.p == dst) {
+                packedCubes.emplace_back(0U);
+            }
+        } else {
+            // the paths via the e[0] successor are ordered before the ones via the e[3] successor, thus the packed cubes remain sorted
+            const auto leadingBit = static_cast<std::uint64_t>(1U) << (level - static_cast<std::size_t>(dst->v) - 1U);
+            for (const auto i: {0U, 3U}) {
+                if (const auto& succ = src.p->e.at(i); !succ.isTerminal()) {
+                    for (const auto packedSuffix: packedPathsFromSrcDst(succ, level - 1, dst)) {
+                        packedCubes.emplace_back((i == 3U ? leadingBit : 0U) | packedSuffix);
+                    }
+                }
+            }
+        }
+        return pathSignatureCache.try_emplace(key, std::move(packedCubes)).first->second;
+    }
+
     //please refer to the second optimization approach introduced in https://www.cda.cit.tum.de/files/eda/2017_rc_improving_qmdd_synthesis_of_reversible_circuits.pdf
     auto DDSynthesizer::finalSrcPathSignature(dd::mEdge const& src, dd::mEdge const& current, TruthTable::Cube::Set const& p1SigVec, TruthTable::Cube::Set const& p2SigVec, bool const& changePaths, std::unique_ptr<dd::Package>& dd) -> TruthTable::Cube::Set {
         assert(!src.isTerminal());
@@ -153,6 +608,10 @@ namespace syrec {
 
         TruthTable::Cube::Set rootSigVec;
         pathFromSrcDst(src, current.p, rootSigVec);
+        // the fallback strategy and capped signatures only use the paths to the `current` node itself.
+        if (isSignatureSizeCapped(rootSigVec.size())) {
+            return rootSigVec;
+        }
 
         const auto  tables = dd->getUniqueTable<dd::mNode>().getTables();
         auto const& table  = tables[current.p->v];
@@ -187,6 +646,9 @@ namespace syrec {
                     TruthTable::Cube::Set rootSigVecTmp;
                     pathFromSrcDst(src, castedNode, rootSigVecTmp);
                     rootSigVec.merge(rootSigVecTmp);
+                    if (isSignatureSizeCapped(rootSigVec.size())) {
+                        break;
+                    }
                 }
             }
         }
@@ -206,6 +668,10 @@ namespace syrec {
         if (src.isZeroTerminal() || pathLength == 0) {
             return;
         }
+        if (pathLength <= 64U) {
+            unpackCubes(packedPathSignature(src, pathLength), pathLength, sigVec);
+            return;
+        }
         TruthTable::Cube cube{};
         cube.reserve(pathLength);
         pathSignature(src, pathLength, sigVec, cube);
@@ -258,6 +724,65 @@ namespace syrec {
         }
     }
 
+    // Memoized variant of pathSignature(...) determining the packed cubes of all paths of the given length starting at the `src` node.
+    auto DDSynthesizer::packedPathSignature(dd::mEdge const& src, const size_t pathLength) -> const std::vector<std::uint64_t>& {
+        assert(!src.isZeroTerminal());
+        assert(pathLength != 0);
+
+        const PathSignatureCacheKey key{.node = src.p, .level = pathLength, .destination = nullptr, .isIdentity = src.isIdentity()};
+        if (const auto it = pathSignatureCache.find(key); it != pathSignatureCache.end()) {
+            return it->second;
+        }
+
+        std::vector<std::uint64_t> packedCubes;
+        const auto                 leadingBit = static_cast<std::uint64_t>(1U) << (pathLength - 1U);
+        if (pathLength == 1) {
+            if (src.isIdentity()) {
+                packedCubes = {0U, 1U};
+            } else {
+                for (auto i = 0U; i < dd::NEDGE; ++i) {
+                    if (src.p->e.at(i).isOneTerminal()) {
+                        packedCubes.emplace_back((i == 1U || i == 3U) ? 1U : 0U);
+                    }
+                }
+                sortAndRemoveDuplicates(packedCubes);
+            }
+        } else if (src.isIdentity() || src.p->v < pathLength - 1) {
+            // handle identity and skipped nodes
+            const auto& packedSuffixes = packedPathSignature(src, pathLength - 1);
+            packedCubes.reserve(2U * packedSuffixes.size());
+            packedCubes.insert(packedCubes.end(), packedSuffixes.begin(), packedSuffixes.end());
+            for (const auto packedSuffix: packedSuffixes) {
+                packedCubes.emplace_back(leadingBit | packedSuffix);
+            }
+        } else {
+            assert(!src.isTerminal());
+            for (auto i = 0U; i < dd::NEDGE; ++i) {
+                const auto& succ = src.p->e[i];
+                if (succ.isZeroTerminal()) {
+                    continue;
+                }
+                for (const auto packedSuffix: packedPathSignature(succ, pathLength - 1)) {
+                    packedCubes.emplace_back(((i == 1U || i == 3U) ? leadingBit : 0U) | packedSuffix);
+                }
+            }
+            // the paths via the successors with the same leading bit can share their signature
+            sortAndRemoveDuplicates(packedCubes);
+        }
+        return pathSignatureCache.try_emplace(key, std::move(packedCubes)).first->second;
+    }
+
+    auto DDSynthesizer::isSignatureSizeCapped(const std::size_t signatureSize) const -> bool {
+        return effortMode == EffortMode::Fallback || (effortSettings.maxPathSignatureSize != 0U && signatureSize > effortSettings.maxPathSignatureSize);
+    }
+
+    auto DDSynthesizer::minimizeSignature(TruthTable::Cube::Set const& sigVec) -> TruthTable::Cube::Set {
+        if (isSignatureSizeCapped(sigVec.size())) {
+            return sigVec;
+        }
+        return minimizedExpressionCache.minimize(sigVec);
+    }
+
     auto DDSynthesizer::completeUniCubes(TruthTable::Cube::Set const& p1SigVec, TruthTable::Cube::Set const& p2SigVec, TruthTable::Cube::Set& uniqueCubeVec) -> void {
         for (const auto& p2Cube: p2SigVec) {
             if (const auto it = std::ranges::find(p1SigVec, p2Cube); it == p1SigVec.end()) {
@@ -308,7 +833,7 @@ namespace syrec {
         dd->incRef(tmp);
         dd->decRef(to);
         to = tmp;
-        dd->garbageCollect();
+        garbageCollect(dd);
         ++numGates;
     }
 
@@ -333,7 +858,7 @@ namespace syrec {
             }
 
             auto       rootSigVec   = finalSrcPathSignature(src, current, p1SigVec, p2SigVec, false, dd);
-            const auto rootSolution = minbool::minimizeBoolean(rootSigVec);
+            const auto rootSolution = minimizeSignature(rootSigVec);
 
             for (auto const& rootVec: rootSolution) {
                 qc::Controls ctrlFinal;
@@ -374,14 +899,16 @@ namespace syrec {
         }
 
         TruthTable::Cube::Set rootSigVec;
-        if (changePaths) {
+        if (effortSettings.greedyUniquePathSearch) {
+            pathFromSrcDst(src, current.p, rootSigVec);
+        } else if (changePaths) {
             rootSigVec = finalSrcPathSignature(src, current, p4SigVec, p3SigVec, changePaths, dd);
         } else {
             rootSigVec = finalSrcPathSignature(src, current, p1SigVec, p2SigVec, changePaths, dd);
         }
 
-        const auto rootSolution = minbool::minimizeBoolean(rootSigVec);
-        const auto uniSolution  = minbool::minimizeBoolean(uniqueCubeVec);
+        const auto rootSolution = minimizeSignature(rootSigVec);
+        const auto uniSolution  = minimizeSignature(uniqueCubeVec);
 
         for (auto const& uniCube: uniSolution) {
             qc::Controls ctrlNonRoot;
@@ -411,7 +938,7 @@ namespace syrec {
         assert(!current.isTerminal());
         TruthTable::Cube repeatedCube;
         for (auto const& p2Obj: p2SigVec) {
-            if (const auto it = std::ranges::find(p1SigVec, p2Obj); it != p1SigVec.end()) {
+            if (p1SigVec.contains(p2Obj)) {
                 repeatedCube = p2Obj;
             }
         }
@@ -440,7 +967,7 @@ namespace syrec {
 
         const auto rootSigVec = finalSrcPathSignature(src, current, p1SigVec, p2SigVec, changePaths, dd);
 
-        const auto rootSolution = minbool::minimizeBoolean(rootSigVec);
+        const auto rootSolution = minimizeSignature(rootSigVec);
 
         const auto targetSize = targetVec.size();
 
@@ -506,13 +1033,173 @@ namespace syrec {
         return unifyPath(src, current, p1SigVec, p2SigVec, changePaths, dd);
     }
 
+    namespace {
+        // the on-set of a line decoded by the ESOP network is only minimized via minbool::minimizeBoolean if its completion over the positions specified by any of its cubes consists of at most this number of minterms.
+        constexpr std::size_t MAX_NUM_MINTERMS_OF_MINIMIZED_DECODER_ON_SET = 1U << 12U;
+
+        // determines disjoint cubes (and thus an ESOP) covering the on-set, with the cubes being minimized if the completion of the on-set over the positions specified by any of its cubes is small enough.
+        auto determineDisjointCover(const TruthTable::Cube::Vector& onSet, minbool::MinimizedExpressionCache& minimizedExpressionCache) -> TruthTable::Cube::Vector {
+            auto disjointCover = minbool::makeDisjoint(onSet);
+            if (disjointCover.size() <= 1U) {
+                return disjointCover;
+            }
+
+            const auto               nPositions = disjointCover.front().size();
+            std::vector<std::size_t> specifiedPositions;
+            for (std::size_t pos = 0U; pos < nPositions; ++pos) {
+                if (std::ranges::any_of(disjointCover, [pos](const TruthTable::Cube& cube) { return cube[pos].has_value(); })) {
+                    specifiedPositions.emplace_back(pos);
+                }
+            }
+
+            // since the cubes are disjoint, the number of minterms of the on-set is the sum of the numbers of completions of its cubes.
+            std::size_t numMinterms = 0U;
+            for (const auto& cube: disjointCover) {
+                const auto nDontCares = static_cast<std::size_t>(std::ranges::count_if(specifiedPositions, [&cube](const std::size_t pos) { return !cube[pos].has_value(); }));
+                if (nDontCares >= std::numeric_limits<std::size_t>::digits - 1 || numMinterms + (static_cast<std::size_t>(1U) << nDontCares) > MAX_NUM_MINTERMS_OF_MINIMIZED_DECODER_ON_SET) {
+                    return disjointCover;
+                }
+                numMinterms += static_cast<std::size_t>(1U) << nDontCares;
+            }
+
+            TruthTable::Cube::Set mintermsOfOnSet;
+            for (const auto& cube: disjointCover) {
+                TruthTable::Cube projectedCube;
+                projectedCube.reserve(specifiedPositions.size());
+                for (const auto pos: specifiedPositions) {
+                    projectedCube.emplace_back(cube[pos]);
+                }
+                for (auto& minterm: projectedCube.completeCubes()) {
+                    mintermsOfOnSet.emplace(std::move(minterm));
+                }
+            }
+
+            TruthTable::Cube::Vector minimizedCover;
+            for (const auto& minimizedCube: minimizedExpressionCache.minimize(mintermsOfOnSet)) {
+                TruthTable::Cube cube(nPositions, TruthTable::Cube::Value{});
+                for (std::size_t i = 0U; i < specifiedPositions.size(); ++i) {
+                    cube[specifiedPositions[i]] = minimizedCube[i];
+                }
+                minimizedCover.emplace_back(std::move(cube));
+            }
+
+            // the cubes of the minimized cover may overlap and are thus split into disjoint cubes, which can result in more cubes than the disjoint cover of the on-set itself.
+            auto minimizedDisjointCover = minbool::makeDisjoint(std::move(minimizedCover));
+            return minimizedDisjointCover.size() < disjointCover.size() ? minimizedDisjointCover : disjointCover;
+        }
+    } // namespace
+
+    auto DDSynthesizer::decodeUsingEsopNetwork(std::vector<TruthTable::Cube>& currentValuePerCodeword, std::vector<TruthTable::Cube> const& decodedValuePerCodeword, std::vector<std::size_t> const& decodedPositions, std::vector<std::pair<qc::Controls, qc::Qubit>>& gates) -> bool {
+        // the decoded lines as well as the lines storing the same value for all codewords are not used as control lines since they do not distinguish the codewords.
+        std::vector<bool> isControlPosition(totalNoBits, true);
+        for (const auto pos: decodedPositions) {
+            isControlPosition[pos] = false;
+        }
+        for (std::size_t pos = 0U; pos < totalNoBits; ++pos) {
+            const auto& valueOfFirstCodeword = currentValuePerCodeword.front()[pos];
+            if (isControlPosition[pos] && valueOfFirstCodeword.has_value() && std::ranges::all_of(currentValuePerCodeword, [pos, &valueOfFirstCodeword](const TruthTable::Cube& currentValue) { return currentValue[pos] == valueOfFirstCodeword; })) {
+                isControlPosition[pos] = false;
+            }
+        }
+
+        std::vector<TruthTable::Cube> controlCubePerCodeword;
+        controlCubePerCodeword.reserve(currentValuePerCodeword.size());
+        for (const auto& currentValue: currentValuePerCodeword) {
+            auto& controlCube = controlCubePerCodeword.emplace_back(currentValue);
+            for (std::size_t pos = 0U; pos < totalNoBits; ++pos) {
+                if (!isControlPosition[pos]) {
+                    controlCube[pos] = TruthTable::Cube::Value{};
+                }
+            }
+        }
+
+        // the targets of cubes shared by the ESOPs of multiple decoded lines are grouped to emit the gates with the same controls consecutively.
+        std::map<TruthTable::Cube, std::vector<qc::Qubit>> targetsPerControlCube;
+        TruthTable::Cube::Vector                            flippedCodewords;
+        TruthTable::Cube::Vector                            unmodifiedCodewords;
+        for (const auto pos: decodedPositions) {
+            flippedCodewords.clear();
+            unmodifiedCodewords.clear();
+            for (std::size_t i = 0U; i < currentValuePerCodeword.size(); ++i) {
+                const auto currentValue = currentValuePerCodeword[i][pos];
+                const auto decodedValue = pos < decodedValuePerCodeword[i].size() ? decodedValuePerCodeword[i][pos] : TruthTable::Cube::Value{};
+                if (decodedValue.has_value() && !currentValue.has_value()) {
+                    return false;
+                }
+                (decodedValue.has_value() && *currentValue != *decodedValue ? flippedCodewords : unmodifiedCodewords).emplace_back(controlCubePerCodeword[i]);
+            }
+
+            // the gates flip the line for all lines matching the control cube of a flipped codeword (independent of the value of the line itself).
+            if (std::ranges::any_of(flippedCodewords, [&unmodifiedCodewords](const TruthTable::Cube& flippedCodeword) {
+                    return std::ranges::any_of(unmodifiedCodewords, [&flippedCodeword](const TruthTable::Cube& unmodifiedCodeword) { return TruthTable::Cube::checkCubeEquality(flippedCodeword, unmodifiedCodeword); });
+                })) {
+                return false;
+            }
+            if (flippedCodewords.empty()) {
+                continue;
+            }
+
+            const auto targetBit = static_cast<qc::Qubit>((totalNoBits - 1U) - pos);
+            for (auto& controlCube: determineDisjointCover(flippedCodewords, minimizedExpressionCache)) {
+                targetsPerControlCube[std::move(controlCube)].emplace_back(targetBit);
+            }
+        }
+
+        for (std::size_t i = 0U; i < currentValuePerCodeword.size(); ++i) {
+            for (const auto pos: decodedPositions) {
+                if (pos < decodedValuePerCodeword[i].size() && decodedValuePerCodeword[i][pos].has_value()) {
+                    currentValuePerCodeword[i][pos] = decodedValuePerCodeword[i][pos];
+                }
+            }
+        }
+
+        for (const auto& [controlCube, targetBits]: targetsPerControlCube) {
+            qc::Controls ctrl;
+            for (std::size_t pos = 0U; pos < totalNoBits; ++pos) {
+                if (controlCube[pos].has_value()) {
+                    ctrl.emplace(qc::Control{static_cast<qc::Qubit>((totalNoBits - 1U) - pos), *controlCube[pos] ? qc::Control::Type::Pos : qc::Control::Type::Neg});
+                }
+            }
+            for (const auto targetBit: targetBits) {
+                gates.emplace_back(ctrl, targetBit);
+            }
+        }
+        return true;
+    }
+
     // Refer to the decoder algorithm of https://www.cda.cit.tum.de/files/eda/2018_aspdac_coding_techniques_in_synthesis.pdf.
     template<class T>
-    auto DDSynthesizer::decoder(T const& codewords) -> void {
+    auto DDSynthesizer::decoder(T const& codewords, const DecoderMode decoderMode) -> void {
         const auto codeLength = codewords.begin()->second.size();
 
+        // the current value of the lines of every codeword with the r most significant lines storing zero and the remaining ones storing the codeword (used by the ESOP network).
+        std::vector<TruthTable::Cube> currentValuePerCodeword;
+        std::vector<TruthTable::Cube> decodedValuePerCodeword;
+        if (decoderMode == DecoderMode::EsopNetwork) {
+            for (const auto& [pattern, code]: codewords) {
+                auto& currentValue = currentValuePerCodeword.emplace_back(r, false);
+                for (auto i = 0U; i < codeLength; i++) {
+                    currentValue.emplace_back(code[i]);
+                }
+                decodedValuePerCodeword.emplace_back(pattern.begin(), pattern.begin() + static_cast<int>(std::min(m, pattern.size())));
+            }
+        }
+
+        const auto emitGates = [this](const std::vector<std::pair<qc::Controls, qc::Qubit>>& gates) {
+            for (const auto& [ctrl, targetBit]: gates) {
+                qc->mcx(ctrl, targetBit);
+                ++numGates;
+            }
+        };
+
         // decode the r most significant bits of the original output pattern.
-        if (r != 0U) {
+        std::vector<std::pair<qc::Controls, qc::Qubit>> gates;
+        std::vector<std::size_t>                        decodedPositions(r);
+        std::iota(decodedPositions.begin(), decodedPositions.end(), 0U);
+        // since the codewords are disjoint and the decoded lines store zero for all codewords, the ESOP network can always decode them.
+        if (r != 0U && decoderMode == DecoderMode::EsopNetwork && decodeUsingEsopNetwork(currentValuePerCodeword, decodedValuePerCodeword, decodedPositions, gates)) {
+            emitGates(gates);
+        } else if (r != 0U) {
             for (const auto& [pattern, code]: codewords) {
                 TruthTable::Cube targetCube(pattern.begin(), pattern.begin() + static_cast<int>(r));
 
@@ -543,6 +1230,19 @@ namespace syrec {
             return;
         }
 
+        // the remaining lines store the codewords and are thus decoded one at a time, with the gates only being emitted once all of them could be decoded by the ESOP network.
+        if (decoderMode == DecoderMode::EsopNetwork) {
+            gates.clear();
+            bool isDecoded = true;
+            for (auto pos = r; pos < m && isDecoded; ++pos) {
+                isDecoded = decodeUsingEsopNetwork(currentValuePerCodeword, decodedValuePerCodeword, {pos}, gates);
+            }
+            if (isDecoded) {
+                emitGates(gates);
+                return;
+            }
+        }
+
         TruthTable ttCorrection{};
 
         for (const auto& [pattern, code]: codewords) {
@@ -554,11 +1254,8 @@ namespace syrec {
                 inCube.emplace_back(code[i]);
             }
 
-            // Extend the dc in the inputs.
-            const auto completeInputs = inCube.completeCubes();
-            for (auto const& completeInput: completeInputs) {
-                ttCorrection.try_emplace(completeInput, outCube);
-            }
+            // the dc in the inputs are expanded symbolically by buildDD (the completions of the inputs of different codewords are disjoint).
+            ttCorrection.try_emplace(std::move(inCube), outCube);
         }
 
         const auto ttCorrectionDD = buildDD(ttCorrection, ddSynth);
@@ -573,6 +1270,8 @@ namespace syrec {
         }
 
         totalNoBits = static_cast<std::size_t>(src.p->v + 1);
+        pathSignatureCache.clear();
+        numIterationsSinceGarbageCollection = 0U;
 
         // construct qc only if it is pointing to null
         if (qc == nullptr) {
@@ -603,8 +1302,30 @@ namespace syrec {
 
         const auto start = std::chrono::steady_clock::now();
 
+        std::optional<ExecutionLimitsMonitor> executionLimitsMonitor;
+        if (executionLimits.isAnyLimitDefined()) {
+            executionLimitsMonitor.emplace(executionLimits);
+        }
+        executionLimitViolation = ExecutionLimitViolation::None;
+        effortMode              = effortSettings.isBounded() ? EffortMode::Bounded : EffortMode::Exhaustive;
+
+        ProgressReporter progressReporter(progressCallback, minDurationBetweenProgressReports);
+        ProgressReport   progress;
+        const auto       determineProgress = [&] {
+            progress.numEmittedQuantumOperations = qc->getNops();
+            return progress;
+        };
+
         // while there are nodes left to process.
         while (!queue.empty()) {
+            // the statistics are also recorded if the synthesis is stopped due to a violated execution limit.
+            if (executionLimitsMonitor.has_value() && executionLimitsMonitor->isAnyLimitViolated()) {
+                executionLimitViolation = executionLimitsMonitor->getViolation();
+                break;
+            }
+            if (effortMode != EffortMode::Fallback && effortSettings.timeBudget.count() != 0 && std::chrono::steady_clock::now() - start >= effortSettings.timeBudget) {
+                effortMode = EffortMode::Fallback;
+            }
             const auto current = queue.front();
 
             // if the garbageFlag is true, the synthesis is terminated once the garbage threshold is reached.
@@ -613,6 +1334,8 @@ namespace syrec {
             }
 
             queue.pop();
+            ++progress.numProcessedDdNodes;
+            progressReporter.reportIfDue(determineProgress);
 
             if (dcNodeCondition(current)) {
                 continue;
@@ -630,7 +1353,7 @@ namespace syrec {
 
             // decrement reference count of `src` node again and trigger garbage collection.
             dd->decRef(src);
-            dd->garbageCollect();
+            garbageCollect(dd, true);
 
             if (pathsShifted) {
                 // stopping criterion
@@ -654,8 +1377,10 @@ namespace syrec {
                 }
             }
         }
+        recordStatistics(dd);
         runtime = static_cast<double>((std::chrono::steady_clock::now() - start).count());
-        return qc;
+        progressReporter.report(determineProgress());
+        return executionLimitViolation == ExecutionLimitViolation::None ? qc : nullptr;
     }
 
     auto DDSynthesizer::initializeSynthesizer(TruthTable const& tt) -> void {
@@ -671,7 +1396,7 @@ namespace syrec {
 
         // construct ddSynth only if it is pointing to null
         if (ddSynth == nullptr) {
-            ddSynth = std::make_unique<dd::Package>(totalNoBits);
+            ddSynth = createDDPackage(totalNoBits, ddPackageSettings);
         }
 
         // construct qc only if it is pointing to null
@@ -680,40 +1405,71 @@ namespace syrec {
         }
     }
 
-    auto DDSynthesizer::buildAndSynthesize(TruthTable const& tt) -> void {
+    auto DDSynthesizer::buildAndSynthesize(TruthTable const& tt, const bool memoizeDDConstruction) -> void {
         // the garbage and constants stored in the tt must be equal to the garbage and constants stored in qc.
         assert(tt.getGarbage() == qc->getGarbage() && tt.getConstants() == qc->getAncillary());
         const auto start = std::chrono::steady_clock::now();
 
-        const auto src = buildDD(tt, ddSynth);
+        const auto src = memoizeDDConstruction ? buildDDMemoized(tt, ddSynth) : buildDD(tt, ddSynth);
         synthesize(src, ddSynth);
 
         runtime = static_cast<double>((std::chrono::steady_clock::now() - start).count());
     }
 
-    auto DDSynthesizer::synthesizeOnePassTT(TruthTable tt) -> std::shared_ptr<qc::QuantumComputation> {
+    auto DDSynthesizer::buildAndSynthesize(PackedTruthTable const& tt, const bool memoizeDDConstruction) -> void {
+        // the garbage and constants stored in the tt must be equal to the garbage and constants stored in qc.
+        assert(tt.garbage == qc->getGarbage() && tt.constants == qc->getAncillary());
+        const auto start = std::chrono::steady_clock::now();
+
+        const auto src = memoizeDDConstruction ? buildDDMemoized(tt, ddSynth) : buildDD(tt.toTruthTable(), ddSynth);
+        synthesize(src, ddSynth);
+
+        runtime = static_cast<double>((std::chrono::steady_clock::now() - start).count());
+    }
+
+    auto DDSynthesizer::synthesizeOnePassTT(TruthTable tt, const bool memoizeDDConstruction) -> std::shared_ptr<qc::QuantumComputation> {
         reset();
         initializeSynthesizer(tt);
 
         // Refer to the one-pass synthesis algorithm of https://www.cda.cit.tum.de/files/eda/2017_tcad_one_pass_synthesis_reversible_circuits.pdf.
 
+        TruthTablePipeline pipeline{};
         if (m > n) {
             for (auto i = 0U; i < m - n; i++) {
                 // corresponding bits are considered as ancillary bits.
                 qc->setLogicalQubitAncillary(static_cast<qc::Qubit>((totalNoBits - 1) - i));
             }
             // zeros are inserted to match the length of the output patterns.
-            augmentWithConstants(tt, m);
+            pipeline.augmentWithConstants(m);
         }
 
-        const auto oldPrimaryInputs  = tt.nInputs();
-        const auto oldPrimaryOutputs = tt.nOutputs();
-
         // based on the totalNoBits, zeros are appended to the inputs and the outputs.
-        augmentWithConstants(tt, totalNoBits, true);
+        pipeline.augmentWithConstants(totalNoBits, true);
+
+        // both augmentations are applied in a single pass over the packed entries of the truth table (if the augmented truth table can be packed).
+        std::optional<PackedTruthTable> packedTt;
+        if (!tt.empty()) {
+            packedTt = pipeline.apply(tt);
+        }
+
+        std::size_t nAncillaBits = 0U;
+        std::size_t nGarbageBits = 0U;
+        if (packedTt.has_value()) {
+            nAncillaBits = packedTt->nInputs - std::max(n, m);
+            nGarbageBits = packedTt->nOutputs - m;
+        } else {
+            if (m > n) {
+                augmentWithConstants(tt, m);
+            }
+
+            const auto oldPrimaryInputs  = tt.nInputs();
+            const auto oldPrimaryOutputs = tt.nOutputs();
 
-        const auto nAncillaBits = tt.nInputs() - oldPrimaryInputs;
-        const auto nGarbageBits = tt.nOutputs() - oldPrimaryOutputs;
+            augmentWithConstants(tt, totalNoBits, true);
+
+            nAncillaBits = tt.nInputs() - oldPrimaryInputs;
+            nGarbageBits = tt.nOutputs() - oldPrimaryOutputs;
+        }
 
         for (qc::Qubit i = 0U; i < nAncillaBits; i++) {
             // corresponding bits are considered as ancillary bits.
@@ -727,12 +1483,16 @@ namespace syrec {
         // If the one-pass synthesis is selected, the appended garbage bits need not be considered during the synthesis process.
         garbageFlag = true;
 
-        buildAndSynthesize(tt);
+        if (packedTt.has_value()) {
+            buildAndSynthesize(*packedTt, memoizeDDConstruction);
+        } else {
+            buildAndSynthesize(tt, memoizeDDConstruction);
+        }
 
         return qc;
     }
 
-    auto DDSynthesizer::synthesizeCodingTechniquesTT(TruthTable tt, bool withAdditionalLine) -> std::shared_ptr<qc::QuantumComputation> {
+    auto DDSynthesizer::synthesizeCodingTechniquesTT(TruthTable tt, bool withAdditionalLine, const DecoderMode decoderMode) -> std::shared_ptr<qc::QuantumComputation> {
         reset();
         initializeSynthesizer(tt);
 
@@ -760,19 +1520,248 @@ namespace syrec {
             qc->setLogicalQubitGarbage(i);
         }
 
-        buildAndSynthesize(tt);
+        buildAndSynthesize(tt, false);
 
         const auto start = std::chrono::steady_clock::now();
 
         // synthesizing the corresponding decoder circuit.
-        withAdditionalLine ? decoder(codewordWithAdditionalLine) : decoder(codewordWithoutAdditionalLine);
+        withAdditionalLine ? decoder(codewordWithAdditionalLine, decoderMode) : decoder(codewordWithoutAdditionalLine, decoderMode);
 
         runtime = runtime + static_cast<double>((std::chrono::steady_clock::now() - start).count());
         return qc;
     }
 
+    namespace {
+        // processes all indices in [0, count) with every worker claiming the next not yet processed index whenever it finished its previous one.
+        // the exception thrown for the smallest index is rethrown once all workers finished.
+        template<class Function>
+        auto forEachIndexInParallel(const std::size_t count, const std::size_t numThreads, const Function& function) -> void {
+            Executor::getShared().parallelFor(count, [&](const std::size_t index) { function(index); }, numThreads);
+        }
+
+        // an output depends on an input if two entries whose inputs only differ in the value of this input define different values for the output.
+        auto determineSupportPerOutput(TruthTable tt) -> std::vector<std::vector<bool>> {
+            const auto                     nInputs  = tt.nInputs();
+            const auto                     nOutputs = tt.nOutputs();
+            std::vector<std::vector<bool>> supportPerOutput(nOutputs, std::vector<bool>(nInputs, false));
+
+            const TruthTable& entries = tt;
+            for (const auto& [input, output]: entries) {
+                for (std::size_t i = 0U; i < nInputs; ++i) {
+                    // every pair of neighbouring entries is only considered once, i.e. from the entry with the input value being false.
+                    if (!input[i].has_value() || *input[i]) {
+                        continue;
+                    }
+
+                    auto neighbouringInput = input;
+                    neighbouringInput[i]   = true;
+                    const auto neighbour   = tt.find(neighbouringInput);
+                    if (neighbour == tt.end()) {
+                        continue;
+                    }
+
+                    const auto& neighbouringOutput = neighbour->second;
+                    for (std::size_t j = 0U; j < nOutputs; ++j) {
+                        if (output[j].has_value() && neighbouringOutput[j].has_value() && *output[j] != *neighbouringOutput[j]) {
+                            supportPerOutput[j][i] = true;
+                        }
+                    }
+                }
+            }
+            return supportPerOutput;
+        }
+
+        // greedily merges the partitions whose outputs share the most inputs (preferring the partitions with the smaller combined support) until at most `maxNumPartitions` partitions remain.
+        auto partitionOutputsByCone(const std::vector<std::vector<bool>>& supportPerOutput, const std::size_t maxNumPartitions) -> std::vector<std::vector<std::size_t>> {
+            std::vector<std::vector<std::size_t>> outputsPerPartition;
+            std::vector<std::vector<bool>>        supportPerPartition = supportPerOutput;
+            for (std::size_t j = 0U; j < supportPerOutput.size(); ++j) {
+                outputsPerPartition.push_back({j});
+            }
+
+            while (outputsPerPartition.size() > std::max<std::size_t>(maxNumPartitions, 1U)) {
+                std::size_t mergedPartition      = 0U;
+                std::size_t otherMergedPartition = 1U;
+                std::size_t maxSharedInputs      = 0U;
+                std::size_t minCombinedInputs    = std::numeric_limits<std::size_t>::max();
+                for (std::size_t a = 0U; a < outputsPerPartition.size(); ++a) {
+                    for (std::size_t b = a + 1U; b < outputsPerPartition.size(); ++b) {
+                        std::size_t sharedInputs   = 0U;
+                        std::size_t combinedInputs = 0U;
+                        for (std::size_t i = 0U; i < supportPerPartition[a].size(); ++i) {
+                            sharedInputs += supportPerPartition[a][i] && supportPerPartition[b][i] ? 1U : 0U;
+                            combinedInputs += supportPerPartition[a][i] || supportPerPartition[b][i] ? 1U : 0U;
+                        }
+                        if (sharedInputs > maxSharedInputs || (sharedInputs == maxSharedInputs && combinedInputs < minCombinedInputs)) {
+                            mergedPartition      = a;
+                            otherMergedPartition = b;
+                            maxSharedInputs      = sharedInputs;
+                            minCombinedInputs    = combinedInputs;
+                        }
+                    }
+                }
+
+                outputsPerPartition[mergedPartition].insert(outputsPerPartition[mergedPartition].end(), outputsPerPartition[otherMergedPartition].begin(), outputsPerPartition[otherMergedPartition].end());
+                std::ranges::sort(outputsPerPartition[mergedPartition]);
+                for (std::size_t i = 0U; i < supportPerPartition[mergedPartition].size(); ++i) {
+                    supportPerPartition[mergedPartition][i] = supportPerPartition[mergedPartition][i] || supportPerPartition[otherMergedPartition][i];
+                }
+                outputsPerPartition.erase(outputsPerPartition.begin() + static_cast<std::ptrdiff_t>(otherMergedPartition));
+                supportPerPartition.erase(supportPerPartition.begin() + static_cast<std::ptrdiff_t>(otherMergedPartition));
+            }
+            return outputsPerPartition;
+        }
+
+        // the truth table defining only the given outputs of `tt` for all inputs of `tt`.
+        auto projectOutputs(const TruthTable& tt, const std::vector<std::size_t>& outputs) -> TruthTable {
+            TruthTable projectedTt{};
+            projectedTt.getConstants().resize(tt.nInputs());
+            projectedTt.getGarbage().resize(outputs.size());
+            for (const auto& [input, output]: tt) {
+                TruthTable::Cube projectedOutput{};
+                projectedOutput.reserve(outputs.size());
+                for (const auto j: outputs) {
+                    projectedOutput.emplace_back(output[j]);
+                }
+                projectedTt.try_emplace(input, projectedOutput);
+            }
+            return projectedTt;
+        }
+
+        // the qubits of a quantum computation that are (not) marked as ancillary or garbage with the qubit storing the first position of a cube being the first qubit.
+        auto collectQubitsInCubeOrder(const std::vector<bool>& isMarkedPerQubit, const bool isMarked) -> std::vector<qc::Qubit> {
+            std::vector<qc::Qubit> qubits;
+            for (auto qubit = isMarkedPerQubit.size(); qubit-- > 0U;) {
+                if (isMarkedPerQubit[qubit] == isMarked) {
+                    qubits.emplace_back(static_cast<qc::Qubit>(qubit));
+                }
+            }
+            return qubits;
+        }
+
+        // the one-pass synthesis only generates multi-controlled X gates which are self-inverse, thus the inverse of a circuit is given by its gates in reverse order.
+        template<class OperationIt>
+        auto appendRemappedOperations(qc::QuantumComputation& composedQc, OperationIt first, OperationIt last, const std::vector<qc::Qubit>& composedQubitPerQubit) -> void {
+            for (; first != last; ++first) {
+                const auto& operation = *first;
+                assert(operation->getType() == qc::X && operation->getTargets().size() == 1U);
+
+                qc::Controls controls{};
+                for (const auto& control: operation->getControls()) {
+                    controls.emplace(qc::Control{composedQubitPerQubit[control.qubit], control.type});
+                }
+                composedQc.mcx(controls, composedQubitPerQubit[operation->getTargets().front()]);
+            }
+        }
+    } // namespace
+
+    auto DDSynthesizer::synthesizeOnePassBatch(const std::vector<TruthTable>& tts, const std::size_t numThreads, const bool memoizeDDConstruction) -> std::vector<std::shared_ptr<qc::QuantumComputation>> {
+        // every synthesis uses its own synthesizer and thus its own DD package since the DD package is not thread-safe.
+        std::vector<std::shared_ptr<qc::QuantumComputation>> synthesizedQcs(tts.size());
+        forEachIndexInParallel(tts.size(), numThreads, [&](const std::size_t i) {
+            synthesizedQcs[i] = synthesizeOnePass(tts[i], memoizeDDConstruction);
+        });
+        return synthesizedQcs;
+    }
+
+    auto DDSynthesizer::synthesizeOnePassPartitioned(const TruthTable& tt, const std::size_t maxNumPartitions, const std::size_t numThreads) -> std::shared_ptr<qc::QuantumComputation> {
+        const auto nInputs  = tt.nInputs();
+        const auto nOutputs = tt.nOutputs();
+        if (maxNumPartitions <= 1U || nOutputs <= 1U || tt.nPrimaryInputs() != nInputs || tt.nPrimaryOutputs() != nOutputs) {
+            return synthesizeOnePass(tt);
+        }
+
+        const auto outputsPerPartition = partitionOutputsByCone(determineSupportPerOutput(tt), maxNumPartitions);
+        if (outputsPerPartition.size() <= 1U) {
+            return synthesizeOnePass(tt);
+        }
+
+        std::vector<std::shared_ptr<qc::QuantumComputation>> qcPerPartition(outputsPerPartition.size());
+        forEachIndexInParallel(outputsPerPartition.size(), numThreads, [&](const std::size_t i) {
+            qcPerPartition[i] = synthesizeOnePass(projectOutputs(tt, outputsPerPartition[i]));
+        });
+
+        // the composed circuit consists of the primary inputs (stored in the upmost qubits), the ancillary qubits shared by the circuits of all partitions and the primary outputs (stored in the lowest qubits).
+        // the circuit of every partition computes its outputs which are then copied to the associated primary outputs, followed by the inverse of the circuit restoring the primary inputs and resetting the ancillary qubits to zero.
+        std::size_t nSharedAncillaQubits = 0U;
+        for (const auto& partitionQc: qcPerPartition) {
+            nSharedAncillaQubits = std::max(nSharedAncillaQubits, partitionQc->getNqubits() - nInputs);
+        }
+        const auto nQubits    = nInputs + nSharedAncillaQubits + nOutputs;
+        auto       composedQc = std::make_shared<qc::QuantumComputation>(nQubits, nQubits);
+
+        for (std::size_t i = 0U; i < qcPerPartition.size(); ++i) {
+            const auto& partitionQc        = *qcPerPartition[i];
+            const auto  inputQubits        = collectQubitsInCubeOrder(partitionQc.getAncillary(), false);
+            const auto  ancillaQubits      = collectQubitsInCubeOrder(partitionQc.getAncillary(), true);
+            const auto  outputQubits       = collectQubitsInCubeOrder(partitionQc.getGarbage(), false);
+            const auto& outputsOfPartition = outputsPerPartition[i];
+            assert(inputQubits.size() == nInputs && outputQubits.size() == outputsOfPartition.size());
+
+            std::vector<qc::Qubit> composedQubitPerQubit(partitionQc.getNqubits());
+            for (std::size_t j = 0U; j < inputQubits.size(); ++j) {
+                composedQubitPerQubit[inputQubits[j]] = static_cast<qc::Qubit>(nQubits - 1U - j);
+            }
+            for (std::size_t j = 0U; j < ancillaQubits.size(); ++j) {
+                composedQubitPerQubit[ancillaQubits[j]] = static_cast<qc::Qubit>(nOutputs + j);
+            }
+
+            appendRemappedOperations(*composedQc, partitionQc.begin(), partitionQc.end(), composedQubitPerQubit);
+            for (std::size_t j = 0U; j < outputQubits.size(); ++j) {
+                composedQc->cx(qc::Control{composedQubitPerQubit[outputQubits[j]]}, static_cast<qc::Qubit>(nOutputs - 1U - outputsOfPartition[j]));
+            }
+            // the inputs and ancillary qubits are garbage after the last partition and thus need not be restored.
+            if (i + 1U < qcPerPartition.size()) {
+                appendRemappedOperations(*composedQc, partitionQc.rbegin(), partitionQc.rend(), composedQubitPerQubit);
+            }
+        }
+
+        for (std::size_t qubit = 0U; qubit < nOutputs + nSharedAncillaQubits; ++qubit) {
+            composedQc->setLogicalQubitAncillary(static_cast<qc::Qubit>(qubit));
+        }
+        for (std::size_t qubit = nOutputs; qubit < nQubits; ++qubit) {
+            composedQc->setLogicalQubitGarbage(static_cast<qc::Qubit>(qubit));
+        }
+        return composedQc;
+    }
+
+    auto DDSynthesizer::synthesizeWithReorderedLinesTT(const TruthTable& tt, const LineReorderingSettings& settings) -> std::shared_ptr<qc::QuantumComputation> {
+        reset();
+        assert(tt.nInputs() == tt.nOutputs());
+        const auto start = std::chrono::steady_clock::now();
+
+        const auto order = determineLineOrder(tt, settings);
+        n                = order.size();
+        m                = order.size();
+        totalNoBits      = order.size();
+        ddSynth          = createDDPackage(std::max<std::size_t>(totalNoBits, 1U), ddPackageSettings);
+        qc               = std::make_shared<qc::QuantumComputation>(totalNoBits, totalNoBits);
+
+        // the qubit `totalNoBits - 1 - i` of the synthesized circuit is associated with the i-th position of the reordered cubes and thus with the qubit `totalNoBits - 1 - order[i]` of the truth table
+        for (std::size_t i = 0U; i < totalNoBits; ++i) {
+            const auto qubit             = static_cast<qc::Qubit>(totalNoBits - 1U - i);
+            const auto logicalQubit      = static_cast<qc::Qubit>(totalNoBits - 1U - order[i]);
+            qc->initialLayout[qubit]     = logicalQubit;
+            qc->outputPermutation[qubit] = logicalQubit;
+        }
+        for (std::size_t qubit = 0U; qubit < totalNoBits; ++qubit) {
+            if (qubit < tt.getConstants().size() && tt.getConstants()[qubit]) {
+                qc->setLogicalQubitAncillary(static_cast<qc::Qubit>(qubit));
+            }
+            if (qubit < tt.getGarbage().size() && tt.getGarbage()[qubit]) {
+                qc->setLogicalQubitGarbage(static_cast<qc::Qubit>(qubit));
+            }
+        }
+
+        const auto src = buildDDMemoized(reorderLines(tt, order), ddSynth);
+        synthesize(src, ddSynth);
+
+        runtime = static_cast<double>((std::chrono::steady_clock::now() - start).count());
+        return qc;
+    }
+
     // explicitly instantiate the template function decoder.
-    template void DDSynthesizer::decoder(TruthTable::CubeMap const& codewords);
+    template void DDSynthesizer::decoder(TruthTable::CubeMap const& codewords, DecoderMode decoderMode);
 
-    template void DDSynthesizer::decoder(TruthTable::CubeMultiMap const& codewords);
+    template void DDSynthesizer::decoder(TruthTable::CubeMultiMap const& codewords, DecoderMode decoderMode);
 } // namespace syrec
@@ -14,10 +14,9 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <cstddef>
 #include <map>
-#include <memory>
-#include <queue>
 #include <stack>
 #include <utility>
 #include <vector>
@@ -26,55 +25,76 @@ namespace syrec {
 
     template<class T>
     auto computeOutputFreq(TruthTable const& tt, T& outputFreq) -> void {
-        for (const auto& [input, output]: tt) {
-            auto it = outputFreq.find(output);
-            if (it == outputFreq.end()) {
-                outputFreq.emplace(output, 1U);
+        for (const auto& [output, freq]: tt.outputHistogram()) {
+            if (auto it = outputFreq.find(output); it == outputFreq.end()) {
+                outputFreq.emplace(output, freq);
             } else {
-                ++it->second;
+                it->second += freq;
             }
         }
     }
 
     template<class T>
-    auto topNodeOfHuffmanTree(T const& outputFreq) -> std::shared_ptr<MinHeapNode> {
-        // create a priority queue for building the Huffman tree
-        auto comp = [](const std::shared_ptr<MinHeapNode>& a, const std::shared_ptr<MinHeapNode>& b) {
-            return *a > *b;
+    auto huffmanCodewords(T const& outputFreq, std::vector<PackedCodeword>& codewords) -> std::size_t {
+        // the leaves are stored in the first positions of the node array followed by the inner nodes in the order of their creation.
+        struct HuffmanNode {
+            std::size_t weight{};
+            std::size_t left{};
+            std::size_t right{};
         };
 
-        std::priority_queue<std::shared_ptr<MinHeapNode>, std::vector<std::shared_ptr<MinHeapNode>>, decltype(comp)>
-                minHeap(comp);
-
         // initialize the leaves of the Huffman tree from the output frequencies
+        std::vector<std::size_t> indexPerLeaf;
+        std::vector<HuffmanNode> nodes;
+        indexPerLeaf.reserve(outputFreq.size());
+        nodes.reserve(2U * outputFreq.size());
         for (const auto& [output, freq]: outputFreq) {
-            const auto requiredGarbage = static_cast<std::size_t>(std::ceil(std::log2(freq)));
-            minHeap.emplace(std::make_shared<MinHeapNode>(output, requiredGarbage));
+            indexPerLeaf.emplace_back(nodes.size());
+            nodes.push_back({static_cast<std::size_t>(std::ceil(std::log2(freq))), 0U, 0U});
+        }
+        codewords.assign(outputFreq.size(), PackedCodeword{});
+        if (nodes.empty()) {
+            return 0U;
         }
 
+        // the leaves are processed in ascending order of their weight (and their output in case of equal weights since the outputs are already ordered).
+        std::ranges::stable_sort(indexPerLeaf, [&nodes](const std::size_t lhs, const std::size_t rhs) { return nodes[lhs].weight < nodes[rhs].weight; });
+
+        // since the weight of a parent exceeds the weights of its children, the inner nodes are created in ascending order of their weight.
+        // thus, the node with the smallest weight is either the next leaf or the next inner node and the tree is built in linear time.
+        // an inner node is preferred over a leaf of equal weight.
+        const auto  nLeaves       = indexPerLeaf.size();
+        std::size_t nextLeaf      = 0U;
+        std::size_t nextInnerNode = nLeaves;
+        const auto  popSmallest   = [&]() {
+            if (nextLeaf < nLeaves && (nextInnerNode == nodes.size() || nodes[indexPerLeaf[nextLeaf]].weight < nodes[nextInnerNode].weight)) {
+                return indexPerLeaf[nextLeaf++];
+            }
+            return nextInnerNode++;
+        };
+
         // combine the nodes with the smallest weights until there is only one node left
-        while (minHeap.size() > 1U) {
-            // pop the two nodes with the smallest weights
-            const auto left = minHeap.top();
-            minHeap.pop();
-            const auto right = minHeap.top();
-            minHeap.pop();
-            // compute appropriate frequency to cover both nodes
-            const auto freq = std::max(left->freq, right->freq) + 1U;
-            // create new parent node
-            auto top   = std::make_shared<MinHeapNode>(TruthTable::Cube{}, freq);
-            top->left  = left;
-            top->right = right;
-            // add node to queue
-            minHeap.emplace(std::move(top));
+        for (std::size_t i = 1U; i < nLeaves; ++i) {
+            const auto left  = popSmallest();
+            const auto right = popSmallest();
+            // compute appropriate weight to cover both nodes
+            nodes.push_back({std::max(nodes[left].weight, nodes[right].weight) + 1U, left, right});
         }
 
-        return minHeap.top();
+        // the children of every inner node are stored before their parent, thus the codewords are determined from the root downwards.
+        std::vector<PackedCodeword> codewordPerNode(nodes.size());
+        for (auto node = nodes.size(); node-- > nLeaves;) {
+            const auto& [bits, length]         = codewordPerNode[node];
+            codewordPerNode[nodes[node].left]  = {.bits = bits << 1U, .length = length + 1U};
+            codewordPerNode[nodes[node].right] = {.bits = (bits << 1U) | 1U, .length = length + 1U};
+        }
+        std::copy_n(codewordPerNode.begin(), nLeaves, codewords.begin());
+        return nodes.back().weight;
     }
 
     template<class T>
     auto alterTTAndCodewords(TruthTable& tt, T& encoding, std::size_t const& requiredGarbage) -> void {
-        // Minimum no. of additional lines required.
+        // Minimum no. of additional lines required (reusing the output histogram of the truth table determined during the encoding).
         const auto additionalLines = tt.minimumAdditionalLinesRequired();
         const auto nBits           = std::max(tt.nInputs(), tt.nOutputs() + additionalLines);
         const auto r               = nBits - requiredGarbage;
@@ -114,22 +134,24 @@ namespace syrec {
     }
 
     auto encodeWithAdditionalLine(TruthTable& tt) -> TruthTable::CubeMap {
-        std::map<TruthTable::Cube, std::size_t> outputFreq;
-
-        computeOutputFreq(tt, outputFreq);
+        // the output histogram is only accessed prior to encoding the outputs of the truth table (which invalidates it).
+        const auto& outputFreq = tt.outputHistogram();
 
         // if the truth table function is already reversible, no encoding is necessary
         if (outputFreq.size() == tt.size()) {
             return {};
         }
 
-        auto const& topNode = topNodeOfHuffmanTree(outputFreq);
-
         // determine encoding from Huffman tree
-        TruthTable::CubeMap encoding{};
-        topNode->traverse({}, encoding);
+        std::vector<PackedCodeword> codewords;
+        const auto                  requiredGarbage = huffmanCodewords(outputFreq, codewords);
 
-        const auto requiredGarbage = topNode->freq;
+        TruthTable::CubeMap encoding{};
+        auto                codeword = codewords.cbegin();
+        for (const auto& [output, freq]: outputFreq) {
+            encoding.emplace(output, TruthTable::Cube::fromInteger(codeword->bits, codeword->length));
+            ++codeword;
+        }
 
         // resize all outputs to the correct size (by adding don't care values)
         for (auto& [input, output]: encoding) {
@@ -139,7 +161,7 @@ namespace syrec {
         alterTTAndCodewords(tt, encoding, requiredGarbage);
 
         // encode all the outputs
-        for (auto& [input, output]: tt) {
+        for (auto&& [input, output]: tt) {
             output = encoding[output];
         }
 
@@ -178,13 +200,16 @@ namespace syrec {
             return {};
         }
 
-        auto const& topNode = topNodeOfHuffmanTree(outputFreq);
-
         // determine encoding from Huffman tree
-        TruthTable::CubeMultiMap encoding{};
-        topNode->traverse({}, encoding);
+        std::vector<PackedCodeword> codewords;
+        const auto                  requiredGarbage = huffmanCodewords(outputFreq, codewords);
 
-        const auto requiredGarbage = topNode->freq;
+        TruthTable::CubeMultiMap encoding{};
+        auto                     codeword = codewords.cbegin();
+        for (const auto& [output, freq]: outputFreq) {
+            encoding.emplace(output, TruthTable::Cube::fromInteger(codeword->bits, codeword->length));
+            ++codeword;
+        }
 
         std::map<TruthTable::Cube, std::stack<TruthTable::Cube>> encFreq;
         // resize all outputs to the correct size (by adding don't care values)
@@ -201,7 +226,7 @@ namespace syrec {
         alterTTAndCodewords(tt, encoding, requiredGarbage);
 
         // encode all the outputs
-        for (auto& [input, output]: tt) {
+        for (auto&& [input, output]: tt) {
             const auto out = output;
             output         = encFreq[out].top();
             encFreq[out].pop();
@@ -214,7 +239,9 @@ namespace syrec {
         const auto requiredOutConstants = nBits - tt.nOutputs();
         const auto requiredInConstants  = nBits - tt.nInputs();
 
-        for (auto& [input, output]: tt) {
+        // the inputs are replaced while iterating over the truth table which is only supported by the map based storage
+        tt.useSparseStorage();
+        for (auto&& [input, output]: tt) {
             const auto currentGarbageVecSize = tt.getGarbage().size();
 
             if (appendZero) {
@@ -276,11 +303,12 @@ namespace syrec {
     }
 
     // explicitly instantiate function templates.
-    template void                         computeOutputFreq(TruthTable const& tt, std::map<TruthTable::Cube, std::size_t>& outputFreq);
-    template void                         computeOutputFreq(TruthTable const& tt, std::multimap<TruthTable::Cube, std::size_t>& outputFreq);
-    template std::shared_ptr<MinHeapNode> topNodeOfHuffmanTree(std::map<TruthTable::Cube, std::size_t> const& outputFreq);
-    template std::shared_ptr<MinHeapNode> topNodeOfHuffmanTree(std::multimap<TruthTable::Cube, std::size_t> const& outputFreq);
-    template void                         alterTTAndCodewords(TruthTable& tt, TruthTable::CubeMap& encoding, std::size_t const& requiredGarbage);
-    template void                         alterTTAndCodewords(TruthTable& tt, TruthTable::CubeMultiMap& encoding, std::size_t const& requiredGarbage);
+    template void        computeOutputFreq(TruthTable const& tt, std::map<TruthTable::Cube, std::size_t>& outputFreq);
+    template void        computeOutputFreq(TruthTable const& tt, std::multimap<TruthTable::Cube, std::size_t>& outputFreq);
+    template std::size_t huffmanCodewords(std::map<TruthTable::Cube, std::size_t> const& outputFreq, std::vector<PackedCodeword>& codewords);
+    template std::size_t huffmanCodewords(std::multimap<TruthTable::Cube, std::size_t> const& outputFreq, std::vector<PackedCodeword>& codewords);
+    template std::size_t huffmanCodewords(TruthTable::OutputHistogram const& outputFreq, std::vector<PackedCodeword>& codewords);
+    template void        alterTTAndCodewords(TruthTable& tt, TruthTable::CubeMap& encoding, std::size_t const& requiredGarbage);
+    template void        alterTTAndCodewords(TruthTable& tt, TruthTable::CubeMultiMap& encoding, std::size_t const& requiredGarbage);
 
 } // namespace syrec
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/esop_synthesis.hpp"
+
+#include "algorithms/optimization/esop_minimization.hpp"
+#include "core/truthTable/truth_table.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+
+namespace syrec {
+
+    auto EsopSynthesizer::synthesizeTT(const TruthTable& tt) -> std::shared_ptr<qc::QuantumComputation> {
+        runtime         = 0.;
+        numGates        = 0U;
+        numProductTerms = 0U;
+
+        const auto start = std::chrono::steady_clock::now();
+
+        const auto nInputs  = tt.nInputs();
+        const auto nOutputs = tt.nOutputs();
+        const auto nQubits  = nInputs + nOutputs;
+        auto       qc       = std::make_shared<qc::QuantumComputation>(nQubits, nQubits);
+        for (std::size_t j = 0U; j < nOutputs; ++j) {
+            // the output lines are initialized with zero.
+            qc->setLogicalQubitAncillary(static_cast<qc::Qubit>(j));
+        }
+        for (std::size_t i = nOutputs; i < nQubits; ++i) {
+            // the input lines are not part of the outputs.
+            qc->setLogicalQubitGarbage(static_cast<qc::Qubit>(i));
+        }
+
+        const auto terms = minbool::minimizeMultiOutputEsop(tt);
+        numProductTerms  = terms.size();
+        for (const auto& [cube, outputs]: terms) {
+            qc::Controls ctrl{};
+            for (std::size_t pos = 0U; pos < nInputs; ++pos) {
+                if (cube[pos].has_value()) {
+                    ctrl.emplace(qc::Control{static_cast<qc::Qubit>((nQubits - 1U) - pos), *cube[pos] ? qc::Control::Type::Pos : qc::Control::Type::Neg});
+                }
+            }
+            for (std::size_t j = 0U; j < nOutputs; ++j) {
+                if (outputs[j]) {
+                    qc->mcx(ctrl, static_cast<qc::Qubit>((nOutputs - 1U) - j));
+                    ++numGates;
+                }
+            }
+        }
+
+        runtime = static_cast<double>((std::chrono::steady_clock::now() - start).count());
+        return qc;
+    }
+
+} // namespace syrec
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/expression_synthesis_cache.hpp"
+
+#include "core/hash_combine.hpp"
+#include "core/syrec/expression.hpp"
+#include "core/syrec/number.hpp"
+#include "core/syrec/variable.hpp"
+#include "ir/Definitions.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    [[nodiscard]] std::optional<unsigned> tryEvaluateNumber(const Number::ptr& number, const Number::LoopVariableMapping& loopVariableValueLookup) {
+        return number != nullptr ? number->tryEvaluate(loopVariableValueLookup) : std::nullopt;
+    }
+
+    // Numbers whose value cannot be determined are never considered to be identical.
+    [[nodiscard]] bool areNumbersIdentical(const Number::ptr& lNumber, const Number::ptr& rNumber, const Number::LoopVariableMapping& loopVariableValueLookup) {
+        const std::optional<unsigned> lNumberValue = tryEvaluateNumber(lNumber, loopVariableValueLookup);
+        return lNumberValue.has_value() && lNumberValue == tryEvaluateNumber(rNumber, loopVariableValueLookup);
+    }
+
+    [[nodiscard]] std::size_t determineStructuralHash(const Expression& expression, const Number::LoopVariableMapping& loopVariableValueLookup);
+
+    [[nodiscard]] std::size_t determineStructuralHash(const VariableAccess& variableAccess, const Number::LoopVariableMapping& loopVariableValueLookup) {
+        std::size_t hash = std::hash<const Variable*>{}(variableAccess.var.get());
+        for (const Expression::ptr& accessedValueOfDimension: variableAccess.indexes) {
+            hashCombine(hash, accessedValueOfDimension != nullptr ? determineStructuralHash(*accessedValueOfDimension, loopVariableValueLookup) : 0U);
+        }
+        if (variableAccess.range.has_value()) {
+            hashCombine(hash, std::hash<unsigned>{}(tryEvaluateNumber(variableAccess.range->first, loopVariableValueLookup).value_or(0U)));
+            hashCombine(hash, std::hash<unsigned>{}(tryEvaluateNumber(variableAccess.range->second, loopVariableValueLookup).value_or(0U)));
+        }
+        return hash;
+    }
+
+    std::size_t determineStructuralHash(const Expression& expression, const Number::LoopVariableMapping& loopVariableValueLookup) {
+        std::size_t hash = std::hash<unsigned>{}(expression.bitwidth());
+        hashCombine(hash, static_cast<std::size_t>(expression.getKind()));
+        if (const auto* exprAsNumericExpr = expressionCast<NumericExpression>(&expression); exprAsNumericExpr != nullptr) {
+            hashCombine(hash, std::hash<unsigned>{}(tryEvaluateNumber(exprAsNumericExpr->value, loopVariableValueLookup).value_or(0U)));
+        } else if (const auto* exprAsVariableExpr = expressionCast<VariableExpression>(&expression); exprAsVariableExpr != nullptr) {
+            hashCombine(hash, exprAsVariableExpr->var != nullptr ? determineStructuralHash(*exprAsVariableExpr->var, loopVariableValueLookup) : 0U);
+        } else if (const auto* exprAsBinaryExpr = expressionCast<BinaryExpression>(&expression); exprAsBinaryExpr != nullptr) {
+            hashCombine(hash, static_cast<std::size_t>(exprAsBinaryExpr->binaryOperation));
+            hashCombine(hash, exprAsBinaryExpr->lhs != nullptr ? determineStructuralHash(*exprAsBinaryExpr->lhs, loopVariableValueLookup) : 0U);
+            hashCombine(hash, exprAsBinaryExpr->rhs != nullptr ? determineStructuralHash(*exprAsBinaryExpr->rhs, loopVariableValueLookup) : 0U);
+        } else if (const auto* exprAsShiftExpr = expressionCast<ShiftExpression>(&expression); exprAsShiftExpr != nullptr) {
+            hashCombine(hash, static_cast<std::size_t>(exprAsShiftExpr->shiftOperation));
+            hashCombine(hash, exprAsShiftExpr->lhs != nullptr ? determineStructuralHash(*exprAsShiftExpr->lhs, loopVariableValueLookup) : 0U);
+            hashCombine(hash, std::hash<unsigned>{}(tryEvaluateNumber(exprAsShiftExpr->rhs, loopVariableValueLookup).value_or(0U)));
+        } else if (const auto* exprAsUnaryExpr = expressionCast<UnaryExpression>(&expression); exprAsUnaryExpr != nullptr) {
+            hashCombine(hash, static_cast<std::size_t>(exprAsUnaryExpr->unaryOperation));
+            hashCombine(hash, exprAsUnaryExpr->expr != nullptr ? determineStructuralHash(*exprAsUnaryExpr->expr, loopVariableValueLookup) : 0U);
+        }
+        return hash;
+    }
+
+    [[nodiscard]] bool areExpressionsStructurallyIdentical(const Expression& lExpr, const Expression& rExpr, const Number::LoopVariableMapping& loopVariableValueLookup);
+
+    [[nodiscard]] bool areExpressionsStructurallyIdentical(const Expression::ptr& lExpr, const Expression::ptr& rExpr, const Number::LoopVariableMapping& loopVariableValueLookup) {
+        return lExpr != nullptr && rExpr != nullptr && areExpressionsStructurallyIdentical(*lExpr, *rExpr, loopVariableValueLookup);
+    }
+
+    [[nodiscard]] bool areVariableAccessesStructurallyIdentical(const VariableAccess& lVariableAccess, const VariableAccess& rVariableAccess, const Number::LoopVariableMapping& loopVariableValueLookup) {
+        if (lVariableAccess.var == nullptr || lVariableAccess.var != rVariableAccess.var || lVariableAccess.indexes.size() != rVariableAccess.indexes.size() || lVariableAccess.range.has_value() != rVariableAccess.range.has_value()) {
+            return false;
+        }
+        if (lVariableAccess.range.has_value() && (!areNumbersIdentical(lVariableAccess.range->first, rVariableAccess.range->first, loopVariableValueLookup) || !areNumbersIdentical(lVariableAccess.range->second, rVariableAccess.range->second, loopVariableValueLookup))) {
+            return false;
+        }
+        return std::ranges::equal(lVariableAccess.indexes, rVariableAccess.indexes, [&loopVariableValueLookup](const Expression::ptr& lAccessedValueOfDimension, const Expression::ptr& rAccessedValueOfDimension) {
+            return areExpressionsStructurallyIdentical(lAccessedValueOfDimension, rAccessedValueOfDimension, loopVariableValueLookup);
+        });
+    }
+
+    bool areExpressionsStructurallyIdentical(const Expression& lExpr, const Expression& rExpr, const Number::LoopVariableMapping& loopVariableValueLookup) {
+        if (lExpr.getKind() != rExpr.getKind() || lExpr.bitwidth() != rExpr.bitwidth()) {
+            return false;
+        }
+
+        if (const auto* lExprAsNumericExpr = expressionCast<NumericExpression>(&lExpr); lExprAsNumericExpr != nullptr) {
+            const auto* rExprAsNumericExpr = expressionCast<NumericExpression>(&rExpr);
+            return rExprAsNumericExpr != nullptr && areNumbersIdentical(lExprAsNumericExpr->value, rExprAsNumericExpr->value, loopVariableValueLookup);
+        }
+        if (const auto* lExprAsVariableExpr = expressionCast<VariableExpression>(&lExpr); lExprAsVariableExpr != nullptr) {
+            const auto* rExprAsVariableExpr = expressionCast<VariableExpression>(&rExpr);
+            return rExprAsVariableExpr != nullptr && lExprAsVariableExpr->var != nullptr && rExprAsVariableExpr->var != nullptr && areVariableAccessesStructurallyIdentical(*lExprAsVariableExpr->var, *rExprAsVariableExpr->var, loopVariableValueLookup);
+        }
+        if (const auto* lExprAsBinaryExpr = expressionCast<BinaryExpression>(&lExpr); lExprAsBinaryExpr != nullptr) {
+            const auto* rExprAsBinaryExpr = expressionCast<BinaryExpression>(&rExpr);
+            return rExprAsBinaryExpr != nullptr && lExprAsBinaryExpr->binaryOperation == rExprAsBinaryExpr->binaryOperation && areExpressionsStructurallyIdentical(lExprAsBinaryExpr->lhs, rExprAsBinaryExpr->lhs, loopVariableValueLookup) && areExpressionsStructurallyIdentical(lExprAsBinaryExpr->rhs, rExprAsBinaryExpr->rhs, loopVariableValueLookup);
+        }
+        if (const auto* lExprAsShiftExpr = expressionCast<ShiftExpression>(&lExpr); lExprAsShiftExpr != nullptr) {
+            const auto* rExprAsShiftExpr = expressionCast<ShiftExpression>(&rExpr);
+            return rExprAsShiftExpr != nullptr && lExprAsShiftExpr->shiftOperation == rExprAsShiftExpr->shiftOperation && areExpressionsStructurallyIdentical(lExprAsShiftExpr->lhs, rExprAsShiftExpr->lhs, loopVariableValueLookup) && areNumbersIdentical(lExprAsShiftExpr->rhs, rExprAsShiftExpr->rhs, loopVariableValueLookup);
+        }
+        if (const auto* lExprAsUnaryExpr = expressionCast<UnaryExpression>(&lExpr); lExprAsUnaryExpr != nullptr) {
+            const auto* rExprAsUnaryExpr = expressionCast<UnaryExpression>(&rExpr);
+            return rExprAsUnaryExpr != nullptr && lExprAsUnaryExpr->unaryOperation == rExprAsUnaryExpr->unaryOperation && areExpressionsStructurallyIdentical(lExprAsUnaryExpr->expr, rExprAsUnaryExpr->expr, loopVariableValueLookup);
+        }
+        return false;
+    }
+
+    void collectAccessedVariables(const Expression& expression, std::vector<const Variable*>& accessedVariables) {
+        if (const auto* exprAsVariableExpr = expressionCast<VariableExpression>(&expression); exprAsVariableExpr != nullptr && exprAsVariableExpr->var != nullptr) {
+            if (std::ranges::find(accessedVariables, exprAsVariableExpr->var->var.get()) == accessedVariables.cend()) {
+                accessedVariables.emplace_back(exprAsVariableExpr->var->var.get());
+            }
+            for (const Expression::ptr& accessedValueOfDimension: exprAsVariableExpr->var->indexes) {
+                if (accessedValueOfDimension != nullptr) {
+                    collectAccessedVariables(*accessedValueOfDimension, accessedVariables);
+                }
+            }
+        } else if (const auto* exprAsBinaryExpr = expressionCast<BinaryExpression>(&expression); exprAsBinaryExpr != nullptr) {
+            if (exprAsBinaryExpr->lhs != nullptr) {
+                collectAccessedVariables(*exprAsBinaryExpr->lhs, accessedVariables);
+            }
+            if (exprAsBinaryExpr->rhs != nullptr) {
+                collectAccessedVariables(*exprAsBinaryExpr->rhs, accessedVariables);
+            }
+        } else if (const auto* exprAsShiftExpr = expressionCast<ShiftExpression>(&expression); exprAsShiftExpr != nullptr && exprAsShiftExpr->lhs != nullptr) {
+            collectAccessedVariables(*exprAsShiftExpr->lhs, accessedVariables);
+        } else if (const auto* exprAsUnaryExpr = expressionCast<UnaryExpression>(&expression); exprAsUnaryExpr != nullptr && exprAsUnaryExpr->expr != nullptr) {
+            collectAccessedVariables(*exprAsUnaryExpr->expr, accessedVariables);
+        }
+    }
+} // namespace
+
+bool ExpressionSynthesisCache::areExpressionsStructurallyIdentical(const Expression& lExpr, const Expression& rExpr, const Number::LoopVariableMapping& loopVariableValueLookup) {
+    return ::areExpressionsStructurallyIdentical(lExpr, rExpr, loopVariableValueLookup);
+}
+
+const std::vector<qc::Qubit>* ExpressionSynthesisCache::findSynthesisResult(const Expression& expression, const Number::LoopVariableMapping& loopVariableValueLookup) const {
+    if (cachedSynthesisResults.empty()) {
+        return nullptr;
+    }
+
+    const std::size_t structuralHash = determineStructuralHash(expression, loopVariableValueLookup);
+    for (const CachedSynthesisResult& cachedSynthesisResult: cachedSynthesisResults) {
+        if (cachedSynthesisResult.structuralHash == structuralHash && areExpressionsStructurallyIdentical(*cachedSynthesisResult.expression, expression, loopVariableValueLookup)) {
+            return &cachedSynthesisResult.qubitsStoringSynthesisResult;
+        }
+    }
+    return nullptr;
+}
+
+void ExpressionSynthesisCache::recordSynthesisResult(const Expression::ptr& expression, const Number::LoopVariableMapping& loopVariableValueLookup, const std::vector<qc::Qubit>& qubitsStoringSynthesisResult) {
+    if (expression == nullptr) {
+        return;
+    }
+
+    CachedSynthesisResult cachedSynthesisResult{.expression                   = expression,
+                                                .structuralHash               = determineStructuralHash(*expression, loopVariableValueLookup),
+                                                .accessedVariables            = {},
+                                                .qubitsStoringSynthesisResult = qubitsStoringSynthesisResult};
+    collectAccessedVariables(*expression, cachedSynthesisResult.accessedVariables);
+    cachedSynthesisResults.emplace_back(std::move(cachedSynthesisResult));
+}
+
+void ExpressionSynthesisCache::invalidateSynthesisResultsAccessingVariable(const Variable& variable) {
+    std::erase_if(cachedSynthesisResults, [&variable](const CachedSynthesisResult& cachedSynthesisResult) {
+        return std::ranges::find(cachedSynthesisResult.accessedVariables, &variable) != cachedSynthesisResult.accessedVariables.cend();
+    });
+}
+
+void ExpressionSynthesisCache::invalidateSynthesisResultsStoredInQubits(const std::unordered_set<qc::Qubit>& modifiedQubits) {
+    std::erase_if(cachedSynthesisResults, [&modifiedQubits](const CachedSynthesisResult& cachedSynthesisResult) {
+        return std::ranges::any_of(cachedSynthesisResult.qubitsStoringSynthesisResult, [&modifiedQubits](const qc::Qubit qubit) { return modifiedQubits.contains(qubit); });
+    });
+}
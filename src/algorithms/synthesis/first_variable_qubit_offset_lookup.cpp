@@ -10,21 +10,32 @@
 
 #include "algorithms/synthesis/first_variable_qubit_offset_lookup.hpp"
 
+#include "core/syrec/variable.hpp"
 #include "ir/Definitions.hpp"
 
+#include <cstddef>
 #include <optional>
+#include <span>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 using namespace syrec;
 
-void FirstVariableQubitOffsetLookup::openNewVariableQubitOffsetScope() {
-    recordedOffsetsToFirstQubitPerVariableScopes.emplace_back();
+void FirstVariableQubitOffsetLookup::openNewVariableQubitOffsetScope(const std::size_t numVariableSlotsToReserve) {
+    QubitOffsetScope& openedQubitOffsetScope            = recordedOffsetsToFirstQubitPerVariableScopes.emplace_back();
+    openedQubitOffsetScope.indexOfFirstVariableSlot     = variableSlotsOfScopes.size();
+    openedQubitOffsetScope.indexOfFirstIdentifierOffset = identifierOffsetsOfScopes.size();
+    variableSlotsOfScopes.resize(variableSlotsOfScopes.size() + numVariableSlotsToReserve);
 }
 
 bool FirstVariableQubitOffsetLookup::closeVariableQubitOffsetScope() {
     if (recordedOffsetsToFirstQubitPerVariableScopes.empty()) {
         return false;
     }
+    // Only the size of the flat arrays is reduced, the memory of the slots of the closed scope is thus reused for the next opened scope.
+    variableSlotsOfScopes.resize(recordedOffsetsToFirstQubitPerVariableScopes.back().indexOfFirstVariableSlot);
+    identifierOffsetsOfScopes.resize(recordedOffsetsToFirstQubitPerVariableScopes.back().indexOfFirstIdentifierOffset);
     recordedOffsetsToFirstQubitPerVariableScopes.pop_back();
     return true;
 }
@@ -33,7 +44,16 @@ bool FirstVariableQubitOffsetLookup::registerOrUpdateOffsetToFirstQubitOfVariabl
     if (variableIdentifier.empty() || recordedOffsetsToFirstQubitPerVariableScopes.empty()) {
         return false;
     }
-    recordedOffsetsToFirstQubitPerVariableScopes.back()[variableIdentifier] = offsetToFirstQubitOfVariable;
+
+    if (qc::Qubit* registeredOffset = findOffsetRegisteredForIdentifierInCurrentScope(variableIdentifier); registeredOffset != nullptr) {
+        if (*registeredOffset != offsetToFirstQubitOfVariable) {
+            // The cached qubits of any variable access could refer to the previous offset and are thus invalidated.
+            recordedOffsetsToFirstQubitPerVariableScopes.back().invalidateCachedQubitsOfVariableAccesses();
+        }
+        *registeredOffset = offsetToFirstQubitOfVariable;
+    } else {
+        identifierOffsetsOfScopes.emplace_back(VariableQubitOffsetOfIdentifier{.variableIdentifier = variableIdentifier, .offsetToFirstQubitOfVariable = offsetToFirstQubitOfVariable});
+    }
     return true;
 }
 
@@ -42,7 +62,84 @@ std::optional<qc::Qubit> FirstVariableQubitOffsetLookup::getOffsetToFirstQubitOf
         return std::nullopt;
     }
 
-    const QubitOffsetScope& lastOpenedQubitOffsetScope        = recordedOffsetsToFirstQubitPerVariableScopes.back();
-    const auto&             registrationForVariableIdentifier = lastOpenedQubitOffsetScope.find(variableIdentifier);
-    return registrationForVariableIdentifier != lastOpenedQubitOffsetScope.cend() ? std::make_optional(registrationForVariableIdentifier->second) : std::nullopt;
+    const qc::Qubit* registeredOffset = findOffsetRegisteredForIdentifierInCurrentScope(variableIdentifier);
+    return registeredOffset != nullptr ? std::make_optional(*registeredOffset) : std::nullopt;
+}
+
+bool FirstVariableQubitOffsetLookup::registerOrUpdateOffsetToFirstQubitOfVariableInCurrentScope(const Variable& variable, const qc::Qubit offsetToFirstQubitOfVariable) {
+    if (!variable.declarationIndexInModule.has_value()) {
+        return registerOrUpdateOffsetToFirstQubitOfVariableInCurrentScope(variable.name, offsetToFirstQubitOfVariable);
+    }
+    if (variable.name.empty() || recordedOffsetsToFirstQubitPerVariableScopes.empty()) {
+        return false;
+    }
+
+    QubitOffsetScope& lastOpenedQubitOffsetScope = recordedOffsetsToFirstQubitPerVariableScopes.back();
+    const std::size_t indexOfVariableSlot        = lastOpenedQubitOffsetScope.indexOfFirstVariableSlot + *variable.declarationIndexInModule;
+    if (indexOfVariableSlot >= variableSlotsOfScopes.size()) {
+        variableSlotsOfScopes.resize(indexOfVariableSlot + 1U);
+    }
+
+    VariableQubitOffsetSlot& variableSlot = variableSlotsOfScopes[indexOfVariableSlot];
+    if (variableSlot.variable != nullptr && variableSlot.offsetToFirstQubitOfVariable != offsetToFirstQubitOfVariable) {
+        lastOpenedQubitOffsetScope.invalidateCachedQubitsOfVariableAccesses();
+    }
+    variableSlot = VariableQubitOffsetSlot{.variable = &variable, .offsetToFirstQubitOfVariable = offsetToFirstQubitOfVariable};
+    return true;
+}
+
+std::optional<qc::Qubit> FirstVariableQubitOffsetLookup::getOffsetToFirstQubitOfVariableInCurrentScope(const Variable& variable) const {
+    if (recordedOffsetsToFirstQubitPerVariableScopes.empty()) {
+        return std::nullopt;
+    }
+
+    if (variable.declarationIndexInModule.has_value()) {
+        if (const std::size_t indexOfVariableSlot = recordedOffsetsToFirstQubitPerVariableScopes.back().indexOfFirstVariableSlot + *variable.declarationIndexInModule; indexOfVariableSlot < variableSlotsOfScopes.size() && variableSlotsOfScopes[indexOfVariableSlot].variable == &variable) {
+            return variableSlotsOfScopes[indexOfVariableSlot].offsetToFirstQubitOfVariable;
+        }
+    }
+    return getOffsetToFirstQubitOfVariableInCurrentScope(variable.name);
+}
+
+bool FirstVariableQubitOffsetLookup::cacheQubitsOfVariableAccessInCurrentScope(const VariableAccess::ptr& variableAccess, const std::vector<qc::Qubit>& accessedQubits) {
+    if (variableAccess == nullptr || recordedOffsetsToFirstQubitPerVariableScopes.empty()) {
+        return false;
+    }
+
+    QubitOffsetScope& lastOpenedQubitOffsetScope = recordedOffsetsToFirstQubitPerVariableScopes.back();
+    lastOpenedQubitOffsetScope.cachedQubitsPerVariableAccess.insert_or_assign(variableAccess.get(), CachedQubitsOfVariableAccess{.variableAccess = variableAccess, .offsetToFirstCachedQubit = lastOpenedQubitOffsetScope.cachedQubitsOfVariableAccesses.size(), .numCachedQubits = accessedQubits.size()});
+    lastOpenedQubitOffsetScope.cachedQubitsOfVariableAccesses.insert(lastOpenedQubitOffsetScope.cachedQubitsOfVariableAccesses.end(), accessedQubits.cbegin(), accessedQubits.cend());
+    return true;
+}
+
+std::optional<std::span<const qc::Qubit>> FirstVariableQubitOffsetLookup::getCachedQubitsOfVariableAccessInCurrentScope(const VariableAccess& variableAccess) const {
+    if (recordedOffsetsToFirstQubitPerVariableScopes.empty()) {
+        return std::nullopt;
+    }
+
+    const QubitOffsetScope& lastOpenedQubitOffsetScope = recordedOffsetsToFirstQubitPerVariableScopes.back();
+    const auto&             cachedQubitsOfAccess       = lastOpenedQubitOffsetScope.cachedQubitsPerVariableAccess.find(&variableAccess);
+    if (cachedQubitsOfAccess == lastOpenedQubitOffsetScope.cachedQubitsPerVariableAccess.cend()) {
+        return std::nullopt;
+    }
+    return std::span(lastOpenedQubitOffsetScope.cachedQubitsOfVariableAccesses).subspan(cachedQubitsOfAccess->second.offsetToFirstCachedQubit, cachedQubitsOfAccess->second.numCachedQubits);
+}
+
+qc::Qubit* FirstVariableQubitOffsetLookup::findOffsetRegisteredForIdentifierInCurrentScope(const std::string_view& variableIdentifier) {
+    return const_cast<qc::Qubit*>(std::as_const(*this).findOffsetRegisteredForIdentifierInCurrentScope(variableIdentifier));
+}
+
+const qc::Qubit* FirstVariableQubitOffsetLookup::findOffsetRegisteredForIdentifierInCurrentScope(const std::string_view& variableIdentifier) const {
+    const QubitOffsetScope& lastOpenedQubitOffsetScope = recordedOffsetsToFirstQubitPerVariableScopes.back();
+    for (std::size_t i = lastOpenedQubitOffsetScope.indexOfFirstVariableSlot; i < variableSlotsOfScopes.size(); ++i) {
+        if (variableSlotsOfScopes[i].variable != nullptr && variableSlotsOfScopes[i].variable->name == variableIdentifier) {
+            return &variableSlotsOfScopes[i].offsetToFirstQubitOfVariable;
+        }
+    }
+    for (std::size_t i = lastOpenedQubitOffsetScope.indexOfFirstIdentifierOffset; i < identifierOffsetsOfScopes.size(); ++i) {
+        if (identifierOffsetsOfScopes[i].variableIdentifier == variableIdentifier) {
+            return &identifierOffsetsOfScopes[i].offsetToFirstQubitOfVariable;
+        }
+    }
+    return nullptr;
 }
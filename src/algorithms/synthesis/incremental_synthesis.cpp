@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/incremental_synthesis.hpp"
+
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "algorithms/synthesis/internal_qubit_label_builder.hpp"
+#include "algorithms/synthesis/synthesis_result_cache.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "algorithms/synthesis/syrec_hybrid_synthesis.hpp"
+#include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/diagnostics.hpp"
+#include "core/execution_limits.hpp"
+#include "core/statistics.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/program_serialization.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+#include "ir/Definitions.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    [[nodiscard]] bool synthesizeUsingAlgorithm(AnnotatableQuantumComputation& annotatableQuantumComputation, const Program& program, const SynthesisAlgorithm synthesisAlgorithm, const ConfigurableOptions& settings, Statistics* optionalRecordedStatistics) {
+        switch (synthesisAlgorithm) {
+            case SynthesisAlgorithm::CostAware:
+                return CostAwareSynthesis::synthesize(annotatableQuantumComputation, program, settings, optionalRecordedStatistics);
+            case SynthesisAlgorithm::LineAware:
+                return LineAwareSynthesis::synthesize(annotatableQuantumComputation, program, settings, optionalRecordedStatistics);
+            case SynthesisAlgorithm::Hybrid:
+                return HybridSynthesis::synthesize(annotatableQuantumComputation, program, settings, optionalRecordedStatistics);
+        }
+        return false;
+    }
+
+    /*
+     * The main module is determined as done by SyrecSynthesis::synthesize(...), programs without a unique main module are synthesized from scratch with the synthesizer reporting the error.
+     */
+    [[nodiscard]] Module::ptr determineMainModule(const Program& program, const ConfigurableOptions& settings) {
+        if (program.modules().empty()) {
+            return nullptr;
+        }
+
+        const std::string identifierOfMainModule = settings.optionalProgramEntryPointModuleIdentifier.value_or(program.findModule("main") != nullptr ? "main" : program.modules().back()->name);
+        Module::ptr       mainModule;
+        std::size_t       numModulesMatchingIdentifier = 0;
+        for (const Module::ptr& programModule: program.modules()) {
+            if (programModule != nullptr && programModule->name == identifierOfMainModule) {
+                mainModule = programModule;
+                ++numModulesMatchingIdentifier;
+            }
+        }
+        return numModulesMatchingIdentifier == 1U ? mainModule : nullptr;
+    }
+
+    /*
+     * The main module is replaced by a copy only containing the given statements, thus the qubits of the parameters and local variables of the main module are identical in the quantum computations synthesized for all statements.
+     */
+    [[nodiscard]] Program buildProgramWithStatementsOfMainModule(const Program& program, const Module::ptr& mainModule, Statement::vec statements) {
+        const auto mainModuleWithStatements  = std::make_shared<Module>(mainModule->name);
+        mainModuleWithStatements->parameters = mainModule->parameters;
+        mainModuleWithStatements->variables  = mainModule->variables;
+        mainModuleWithStatements->statements = std::move(statements);
+
+        Program programWithStatements;
+        for (const Module::ptr& programModule: program.modules()) {
+            programWithStatements.addModule(programModule == mainModule ? mainModuleWithStatements : programModule);
+        }
+        return programWithStatements;
+    }
+
+    /*
+     * The quantum registers of the variables are created as done by SyrecSynthesis::createQuantumRegistersForSyrecVariables(...) for the main module, thus the qubits of the variables match the ones of the quantum computations synthesized for the statements.
+     */
+    [[nodiscard]] bool createQuantumRegistersForVariables(AnnotatableQuantumComputation& annotatableQuantumComputation, const Variable::vec& variables) {
+        for (const Variable::ptr& variable: variables) {
+            if (variable == nullptr) {
+                return false;
+            }
+
+            const bool                                                            areQubitsCreatedForVariableConsideredGarbage = variable->type == Variable::Type::In || variable->type == Variable::Type::Wire;
+            std::string                                                           quantumRegisterLabel                         = variable->name;
+            std::optional<AnnotatableQuantumComputation::InlinedQubitInformation> optionalQubitInliningInformation;
+            if (variable->type == Variable::Type::Wire || variable->type == Variable::Type::State) {
+                quantumRegisterLabel                                     = InternalQubitLabelBuilder::buildNonAncillaryQubitLabel(annotatableQuantumComputation.getQuantumRegisters().size());
+                optionalQubitInliningInformation                         = AnnotatableQuantumComputation::InlinedQubitInformation();
+                optionalQubitInliningInformation->userDeclaredQubitLabel = variable->name;
+            }
+
+            const auto variableLayoutInformation = AnnotatableQuantumComputation::AssociatedVariableLayoutInformation({.numValuesPerDimension = variable->dimensions, .bitwidth = variable->bitwidth});
+            if (!annotatableQuantumComputation.addQuantumRegisterForSyrecVariable(quantumRegisterLabel, variableLayoutInformation, areQubitsCreatedForVariableConsideredGarbage, optionalQubitInliningInformation).has_value()) {
+                getErrorStream() << "Failed to add quantum register for SyReC variable '" << variable->name << "'\n";
+                return false;
+            }
+        }
+        return true;
+    }
+} // namespace
+
+std::unique_ptr<AnnotatableQuantumComputation> IncrementalSynthesis::synthesize(const Program& program, const ConfigurableOptions& settings, Statistics* optionalRecordedStatistics) {
+    const auto synthesisStartTime = std::chrono::steady_clock::now();
+    footprintsOfStatements.clear();
+    numResynthesizedStatements = 0;
+    numReusedStatements        = 0;
+
+    const Module::ptr mainModule = canStatementsBeSynthesizedIncrementally(settings) ? determineMainModule(program, settings) : nullptr;
+    if (mainModule == nullptr) {
+        return synthesizeFromScratch(program, settings, optionalRecordedStatistics);
+    }
+
+    ConfigurableOptions settingsOfStatements                         = settings;
+    settingsOfStatements.synthesizeIndependentStatementsConcurrently = false;
+    settingsOfStatements.optionalProgramEntryPointModuleIdentifier   = mainModule->name;
+    settingsOfStatements.progressCallback                            = nullptr;
+
+    // Programs referencing IR nodes not serializable by syrec::serializeProgram(...), i.e. modules calling the main module, are synthesized from scratch.
+    const std::optional<std::string> serializedLayoutOfProgram = serializeProgram(buildProgramWithStatementsOfMainModule(program, mainModule, {}), true);
+    std::vector<std::string>         serializedStatements;
+    serializedStatements.reserve(mainModule->statements.size());
+    for (std::size_t i = 0; i < mainModule->statements.size() && serializedLayoutOfProgram.has_value(); ++i) {
+        std::optional<std::string> serializedStatement = serializeProgram(buildProgramWithStatementsOfMainModule(program, mainModule, {mainModule->statements[i]}), true);
+        if (!serializedStatement.has_value()) {
+            break;
+        }
+        serializedStatements.emplace_back(std::move(*serializedStatement));
+    }
+    if (!serializedLayoutOfProgram.has_value() || serializedStatements.size() != mainModule->statements.size()) {
+        return synthesizeFromScratch(program, settings, optionalRecordedStatistics);
+    }
+
+    // The quantum computations of the statements are only valid for the qubit layout and settings they were synthesized with.
+    if (std::string serializedLayout = *serializedLayoutOfProgram + SynthesisResultCache::serializeSynthesisRelevantSettings(synthesisAlgorithm, settingsOfStatements); serializedLayout != serializedLayoutOfSynthesizedProgram) {
+        synthesizedStatementLookup.clear();
+        serializedLayoutOfSynthesizedProgram = std::move(serializedLayout);
+    }
+
+    // Identical changed statements are only synthesized once.
+    std::unordered_map<std::string, std::size_t> jobIndexOfResynthesizedStatementLookup;
+    std::vector<std::size_t>                     indicesOfResynthesizedStatements;
+    for (std::size_t i = 0; i < serializedStatements.size(); ++i) {
+        if (!synthesizedStatementLookup.contains(serializedStatements[i]) && jobIndexOfResynthesizedStatementLookup.emplace(serializedStatements[i], indicesOfResynthesizedStatements.size()).second) {
+            indicesOfResynthesizedStatements.emplace_back(i);
+        }
+    }
+
+    std::vector<Program>           programsOfJobs;
+    std::vector<BatchSynthesisJob> jobs;
+    programsOfJobs.reserve(indicesOfResynthesizedStatements.size());
+    jobs.reserve(indicesOfResynthesizedStatements.size());
+    for (const std::size_t indexOfStatement: indicesOfResynthesizedStatements) {
+        programsOfJobs.emplace_back(buildProgramWithStatementsOfMainModule(program, mainModule, {mainModule->statements[indexOfStatement]}));
+        jobs.emplace_back(BatchSynthesisJob{.program = &programsOfJobs.back(), .settings = settingsOfStatements, .synthesisAlgorithm = synthesisAlgorithm});
+    }
+
+    std::vector<BatchSynthesisResult> results;
+    batchSynthesis(results, jobs, settings.numThreadsOfConcurrentSynthesis != 0U ? settings.numThreadsOfConcurrentSynthesis : settings.maxNumThreads, settings.deterministicParallelExecution);
+
+    bool synthesisOfStatementsOk = true;
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        BatchSynthesisResult& resultOfStatement = results[i];
+        for (const std::string& errorMessage: resultOfStatement.diagnostics.getErrorMessages()) {
+            getErrorStream() << errorMessage << "\n";
+        }
+        if (!resultOfStatement.synthesisOk || resultOfStatement.annotatableQuantumComputation == nullptr) {
+            getErrorStream() << "Failed to synthesize statement " << std::to_string(indicesOfResynthesizedStatements[i]) << " of module " << mainModule->name << "\n";
+            if (optionalRecordedStatistics != nullptr && resultOfStatement.statistics.executionLimitViolation != ExecutionLimitViolation::None) {
+                optionalRecordedStatistics->executionLimitViolation = resultOfStatement.statistics.executionLimitViolation;
+            }
+            synthesisOfStatementsOk = false;
+            continue;
+        }
+        synthesizedStatementLookup.insert_or_assign(serializedStatements[indicesOfResynthesizedStatements[i]], std::move(resultOfStatement.annotatableQuantumComputation));
+    }
+    if (!synthesisOfStatementsOk) {
+        return nullptr;
+    }
+    const auto synthesisOfStatementsEndTime = std::chrono::steady_clock::now();
+
+    auto annotatableQuantumComputation = std::make_unique<AnnotatableQuantumComputation>(false);
+    if (!createQuantumRegistersForVariables(*annotatableQuantumComputation, mainModule->parameters) || !createQuantumRegistersForVariables(*annotatableQuantumComputation, mainModule->variables)) {
+        getErrorStream() << "Failed to create qubits for the variables of main module " << mainModule->name << " of SyReC program\n";
+        return nullptr;
+    }
+
+    // The ancillary qubits of every statement are mapped to new ancillary qubits since the ancillary qubits of a statement are not necessarily reset after its synthesis.
+    const auto numQubitsOfVariables = static_cast<qc::Qubit>(annotatableQuantumComputation->getNqubits());
+
+    std::unordered_map<std::string, std::shared_ptr<const AnnotatableQuantumComputation>> synthesizedStatementsOfProgram;
+    footprintsOfStatements.reserve(serializedStatements.size());
+    for (std::size_t i = 0; i < serializedStatements.size(); ++i) {
+        const std::shared_ptr<const AnnotatableQuantumComputation>& quantumComputationOfStatement = synthesizedStatementLookup.at(serializedStatements[i]);
+        if (quantumComputationOfStatement->getNqubits() < numQubitsOfVariables) {
+            getErrorStream() << "Qubits of the quantum computation synthesized for statement " << std::to_string(i) << " did not match the variables of module " << mainModule->name << "\n";
+            footprintsOfStatements.clear();
+            return nullptr;
+        }
+
+        SynthesizedStatementFootprint                                      footprint{.quantumOperations = {.indexOfFirstQuantumOperation = annotatableQuantumComputation->getNumQuantumOperations(), .numQuantumOperations = 0}, .ancillaryQubits = std::nullopt, .wasResynthesized = jobIndexOfResynthesizedStatementLookup.contains(serializedStatements[i])};
+        std::vector<AnnotatableQuantumComputation::QubitIndexRangeMapping> qubitIndexRangeMappings;
+        if (const std::size_t numAncillaryQubitsOfStatement = quantumComputationOfStatement->getNqubits() - numQubitsOfVariables; numAncillaryQubitsOfStatement != 0U) {
+            const std::optional<qc::Qubit> firstAncillaryQubitOfStatement = annotatableQuantumComputation->addPreliminaryAncillaryRegisterOrAppendToAdjacentOne(InternalQubitLabelBuilder::buildAncillaryQubitLabel(annotatableQuantumComputation->getQuantumRegisters().size()), std::vector<bool>(numAncillaryQubitsOfStatement, false), AnnotatableQuantumComputation::InlinedQubitInformation());
+            if (!firstAncillaryQubitOfStatement.has_value()) {
+                getErrorStream() << "Failed to create the ancillary qubits of statement " << std::to_string(i) << " of module " << mainModule->name << "\n";
+                footprintsOfStatements.clear();
+                return nullptr;
+            }
+            footprint.ancillaryQubits = AnnotatableQuantumComputation::QubitIndexRange{.firstQubitIndex = *firstAncillaryQubitOfStatement, .lastQubitIndex = static_cast<qc::Qubit>(*firstAncillaryQubitOfStatement + numAncillaryQubitsOfStatement - 1U)};
+            qubitIndexRangeMappings.emplace_back(AnnotatableQuantumComputation::QubitIndexRangeMapping{.mappedQubitIndexRange = AnnotatableQuantumComputation::QubitIndexRange{.firstQubitIndex = numQubitsOfVariables, .lastQubitIndex = static_cast<qc::Qubit>(quantumComputationOfStatement->getNqubits() - 1U)}, .firstQubitIndexOfMappingTarget = *firstAncillaryQubitOfStatement});
+        }
+
+        if (!annotatableQuantumComputation->appendOperationsOfQuantumComputationWithRemappedQubits(*quantumComputationOfStatement, qubitIndexRangeMappings)) {
+            getErrorStream() << "Failed to append the quantum operations of statement " << std::to_string(i) << " of module " << mainModule->name << "\n";
+            footprintsOfStatements.clear();
+            return nullptr;
+        }
+        footprint.quantumOperations.numQuantumOperations = annotatableQuantumComputation->getNumQuantumOperations() - footprint.quantumOperations.indexOfFirstQuantumOperation;
+        footprintsOfStatements.emplace_back(footprint);
+        numResynthesizedStatements += static_cast<std::size_t>(footprint.wasResynthesized);
+        numReusedStatements += static_cast<std::size_t>(!footprint.wasResynthesized);
+        synthesizedStatementsOfProgram.emplace(serializedStatements[i], quantumComputationOfStatement);
+    }
+    annotatableQuantumComputation->promotePreliminaryAncillaryQubitsToDefinitiveAncillaryQubits();
+    // Only the quantum computations of the statements of the synthesized program are kept, thus the memory held by the synthesizer does not grow with the number of edits of the program.
+    synthesizedStatementLookup = std::move(synthesizedStatementsOfProgram);
+
+    if (optionalRecordedStatistics != nullptr) {
+        optionalRecordedStatistics->recordRuntime(std::chrono::steady_clock::now() - synthesisStartTime);
+        optionalRecordedStatistics->synthesisRuntimeInNanoseconds    = Statistics::toNanoseconds(synthesisOfStatementsEndTime - synthesisStartTime);
+        optionalRecordedStatistics->optimizationRuntimeInNanoseconds = 0;
+        optionalRecordedStatistics->numQubits                        = annotatableQuantumComputation->getNqubits();
+        optionalRecordedStatistics->numAncillaryQubits               = annotatableQuantumComputation->getNqubits() - numQubitsOfVariables;
+        optionalRecordedStatistics->numQuantumOperations             = annotatableQuantumComputation->getNumQuantumOperations();
+    }
+    return annotatableQuantumComputation;
+}
+
+void IncrementalSynthesis::clear() {
+    serializedLayoutOfSynthesizedProgram.clear();
+    synthesizedStatementLookup.clear();
+    footprintsOfStatements.clear();
+}
+
+/*
+ * Mirrors the restrictions of the concurrent synthesis of independent statements, whose annotations, inlined qubit information, qubit permutations and traces cannot be transferred to the assembled quantum computation, extended by
+ * the optimizations of the synthesized quantum computation that would change the footprints of the statements.
+ */
+bool IncrementalSynthesis::canStatementsBeSynthesizedIncrementally(const ConfigurableOptions& settings) {
+    return !settings.generateQuantumOperationAnnotations && !settings.generatedInlinedQubitDebugInformation && !settings.trackUnconditionalSwapsAsQubitPermutation && !settings.optionalSynthesisTraceFilePath.has_value() && !settings.qubitBudgetOfHybridSynthesis.has_value() && !settings.emitModuleCallsAsCompoundOperations && !settings.propagateConstantQubitValues && !settings.applyReversibleCircuitTemplates && !settings.cancelAdjacentSelfInverseQuantumOperations && !settings.reorderQuantumOperationsToReduceDepth && !settings.recycleAncillaryQubitsWithNonOverlappingLiveRanges && settings.optimizationPipeline.empty();
+}
+
+std::unique_ptr<AnnotatableQuantumComputation> IncrementalSynthesis::synthesizeFromScratch(const Program& program, const ConfigurableOptions& settings, Statistics* optionalRecordedStatistics) {
+    clear();
+    auto annotatableQuantumComputation = std::make_unique<AnnotatableQuantumComputation>(settings.generateQuantumOperationAnnotations);
+    if (!synthesizeUsingAlgorithm(*annotatableQuantumComputation, program, synthesisAlgorithm, settings, optionalRecordedStatistics)) {
+        return nullptr;
+    }
+    return annotatableQuantumComputation;
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/module_call_synthesis_cache.hpp"
+
+#include "core/hash_combine.hpp"
+#include "ir/Definitions.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+
+const ModuleCallSynthesisCache::ModuleCallTemplate* ModuleCallSynthesisCache::findTemplate(const ModuleCallContext& moduleCallContext) const {
+    const auto matchingTemplate = recordedTemplates.find(moduleCallContext);
+    return matchingTemplate != recordedTemplates.cend() ? &matchingTemplate->second : nullptr;
+}
+
+void ModuleCallSynthesisCache::startRecording(const ModuleCallContext& moduleCallContext, const std::vector<qc::Qubit>& firstQubitPerParameter, const qc::Qubit firstCreatedQubit, const std::size_t indexOfFirstQuantumOperation) {
+    activeRecordings.emplace_back(ActiveRecording{.moduleCallContext  = moduleCallContext,
+                                                  .moduleCallTemplate = ModuleCallTemplate{.firstQubitPerParameter                      = firstQubitPerParameter,
+                                                                                           .firstCreatedQubit                           = firstCreatedQubit,
+                                                                                           .numCreatedQubits                            = 0,
+                                                                                           .indexOfFirstQuantumOperation                = indexOfFirstQuantumOperation,
+                                                                                           .numQuantumOperations                        = 0,
+                                                                                           .quantumRegisterAllocations                  = {},
+                                                                                           .statementLineNumberAfterSynthesis = std::nullopt}});
+}
+
+void ModuleCallSynthesisCache::recordQuantumRegisterAllocation(const QuantumRegisterAllocation& quantumRegisterAllocation) {
+    for (auto& activeRecording: activeRecordings) {
+        activeRecording.moduleCallTemplate.quantumRegisterAllocations.emplace_back(quantumRegisterAllocation);
+    }
+}
+
+ModuleCallSynthesisCache::ModuleCallTemplate* ModuleCallSynthesisCache::getTemplateOfLastStartedRecording() {
+    return !activeRecordings.empty() ? &activeRecordings.back().moduleCallTemplate : nullptr;
+}
+
+bool ModuleCallSynthesisCache::stopLastStartedRecording(const bool shouldTemplateBeCached) {
+    if (activeRecordings.empty()) {
+        return false;
+    }
+
+    if (shouldTemplateBeCached) {
+        recordedTemplates.insert_or_assign(activeRecordings.back().moduleCallContext, std::move(activeRecordings.back().moduleCallTemplate));
+    }
+    activeRecordings.pop_back();
+    return true;
+}
+
+std::size_t ModuleCallSynthesisCache::removeTemplatesRecordedStartingAt(const std::size_t indexOfFirstQuantumOperation) {
+    return std::erase_if(recordedTemplates, [indexOfFirstQuantumOperation](const auto& recordedTemplate) { return recordedTemplate.second.indexOfFirstQuantumOperation >= indexOfFirstQuantumOperation; });
+}
+
+std::size_t ModuleCallSynthesisCache::ModuleCallContextHash::operator()(const ModuleCallContext& moduleCallContext) const noexcept {
+    std::size_t hash = std::hash<const Module*>{}(moduleCallContext.targetModule);
+    hashCombine(hash, moduleCallContext.statementExecutionOrder == StatementExecutionOrderStack::StatementExecutionOrder::InvertedAndInReverse);
+    for (const qc::Qubit propagatedControlQubit: moduleCallContext.propagatedControlQubits) {
+        hashCombine(hash, propagatedControlQubit);
+    }
+    return hash;
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/quantum_operation_sinks.hpp"
+
+#include "algorithms/simulation/simple_simulation.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/diagnostics.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/operations/Control.hpp"
+#include "ir/operations/OpType.hpp"
+#include "ir/operations/Operation.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+using namespace syrec;
+
+namespace {
+    [[nodiscard]] bool isSupportedQuantumOperation(const qc::Operation& quantumOperation) {
+        const qc::OpType gateType = quantumOperation.getType();
+        if (gateType != qc::OpType::X && gateType != qc::OpType::SWAP) {
+            getErrorStream() << "Quantum operation of type " << std::to_string(gateType) << " is not supported by the quantum operation sink\n";
+            return false;
+        }
+        return true;
+    }
+} // namespace
+
+bool RealFormatQuantumOperationSink::consumeQuantumOperation(const qc::Operation& quantumOperation, [[maybe_unused]] const QuantumOperationAnnotationsLookup& annotationsOfQuantumOperation) {
+    if (!isSupportedQuantumOperation(quantumOperation)) {
+        return false;
+    }
+
+    const bool isSwapGate = quantumOperation.getType() == qc::OpType::SWAP;
+    outputStream << (isSwapGate ? 'f' : 't') << quantumOperation.getNcontrols() + quantumOperation.getNtargets();
+    for (const qc::Control& controlQubit: quantumOperation.getControls()) {
+        outputStream << ' ' << (controlQubit.type == qc::Control::Type::Neg ? "-" : "") << 'q' << controlQubit.qubit;
+    }
+    for (const qc::Qubit targetQubit: quantumOperation.getTargets()) {
+        outputStream << " q" << targetQubit;
+    }
+    outputStream << '\n';
+    return static_cast<bool>(outputStream);
+}
+
+bool RealFormatQuantumOperationSink::finish([[maybe_unused]] std::size_t numQubits) {
+    outputStream << ".end\n";
+    outputStream.flush();
+    return static_cast<bool>(outputStream);
+}
+
+void RealFormatQuantumOperationSink::writeHeader(std::ostream& outputStream, const std::size_t numQubits) {
+    outputStream << ".version 2.0\n.numvars " << numQubits << "\n.variables";
+    for (std::size_t i = 0; i < numQubits; ++i) {
+        outputStream << " q" << i;
+    }
+    outputStream << "\n.begin\n";
+}
+
+bool BatchSimulationQuantumOperationSink::consumeQuantumOperation(const qc::Operation& quantumOperation, [[maybe_unused]] const QuantumOperationAnnotationsLookup& annotationsOfQuantumOperation) {
+    if (!isSupportedQuantumOperation(quantumOperation)) {
+        return false;
+    }
+
+    // Qubits added to the quantum computation after the simulation was started are initialized with zero in every simulated input pattern
+    qc::Qubit largestAccessedQubit = 0;
+    for (const qc::Control& controlQubit: quantumOperation.getControls()) {
+        largestAccessedQubit = std::max(largestAccessedQubit, controlQubit.qubit);
+    }
+    for (const qc::Qubit targetQubit: quantumOperation.getTargets()) {
+        largestAccessedQubit = std::max(largestAccessedQubit, targetQubit);
+    }
+    if (largestAccessedQubit >= laneValuesPerQubit.size()) {
+        laneValuesPerQubit.resize(static_cast<std::size_t>(largestAccessedQubit) + 1U, 0U);
+    }
+    return coreOperationBatchSimulation(quantumOperation, laneValuesPerQubit);
+}
+
+bool BatchSimulationQuantumOperationSink::finish(const std::size_t numQubits) {
+    if (laneValuesPerQubit.size() > numQubits) {
+        getErrorStream() << "Simulated lane values of " << std::to_string(laneValuesPerQubit.size()) << " qubits exceed the number of qubits " << std::to_string(numQubits) << " of the quantum computation\n";
+        return false;
+    }
+    laneValuesPerQubit.resize(numQubits, 0U);
+    return true;
+}
+
+bool SynthesisCostQuantumOperationSink::consumeQuantumOperation(const qc::Operation& quantumOperation, [[maybe_unused]] const QuantumOperationAnnotationsLookup& annotationsOfQuantumOperation) {
+    if (!isSupportedQuantumOperation(quantumOperation)) {
+        return false;
+    }
+
+    const std::size_t numControlQubits = quantumOperation.getNcontrols();
+    ++numConsumedGatesPerKind[{numControlQubits, quantumOperation.getType() == qc::OpType::SWAP}];
+    ++numConsumedQuantumOperations;
+    transistorCost += AnnotatableQuantumComputation::getTransistorCostForSynthesisOfGate(numControlQubits);
+    return true;
+}
+
+bool SynthesisCostQuantumOperationSink::finish(const std::size_t numQubits) {
+    quantumCost = 0;
+    for (const auto& [gateKind, numConsumedGates]: numConsumedGatesPerKind) {
+        quantumCost += AnnotatableQuantumComputation::getQuantumCostForSynthesisOfGate(gateKind.first, gateKind.second, numQubits) * numConsumedGates;
+    }
+    return true;
+}
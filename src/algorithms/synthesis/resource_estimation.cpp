@@ -0,0 +1,1147 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/resource_estimation.hpp"
+
+#include "algorithms/synthesis/adder_synthesis.hpp"
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "algorithms/synthesis/syrec_hybrid_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/diagnostics.hpp"
+#include "core/syrec/expression.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/number.hpp"
+#include "core/syrec/parser/utils/syrec_operation_utils.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace syrec {
+    namespace {
+        [[nodiscard]] unsigned determineNumberOfBitsRequiredToStoreValue(const unsigned value) {
+            return value == 0U ? 1U : static_cast<unsigned>(std::bit_width(value));
+        }
+
+        [[nodiscard]] unsigned determineNumberOfElementsInVariable(const Variable& variable) {
+            return std::accumulate(variable.dimensions.cbegin(), variable.dimensions.cend(), 1U, std::multiplies());
+        }
+
+        [[nodiscard]] std::size_t determineNumberOfSetBitsInValue(const unsigned value, const std::size_t bitwidth) {
+            const unsigned bitmask = bitwidth >= 32U ? ~0U : (1U << bitwidth) - 1U;
+            return static_cast<std::size_t>(std::popcount(value & bitmask));
+        }
+
+        [[nodiscard]] bool isBinaryOperationLogicalOperation(const BinaryExpression::BinaryOperation binaryOperation) {
+            return binaryOperation == BinaryExpression::BinaryOperation::LogicalAnd || binaryOperation == BinaryExpression::BinaryOperation::LogicalOr;
+        }
+
+        [[nodiscard]] std::optional<BinaryExpression::BinaryOperation> tryMapAssignmentToBinaryOperation(const AssignStatement::AssignOperation assignOperation) {
+            switch (assignOperation) {
+                case AssignStatement::AssignOperation::Add:
+                    return BinaryExpression::BinaryOperation::Add;
+                case AssignStatement::AssignOperation::Subtract:
+                    return BinaryExpression::BinaryOperation::Subtract;
+                case AssignStatement::AssignOperation::Exor:
+                    return BinaryExpression::BinaryOperation::Exor;
+                default:
+                    return std::nullopt;
+            }
+        }
+
+        /**
+         * Mirrors the traversal of a SyReC program performed by the SyrecSynthesis and its derived synthesizers while only counting the qubits and quantum operations (grouped by their number of control qubits) that would be synthesized.
+         *
+         * The qubits of an operand are only represented by their number, the function of this class estimating a synthesizer primitive thus validates the same bitwidth requirements as the primitive.
+         */
+        class ResourceEstimator {
+        public:
+            ResourceEstimator(const ConfigurableOptions& settings, const SynthesisAlgorithm synthesisAlgorithm):
+                settings(settings), synthesisAlgorithm(synthesisAlgorithm), isCostAwareSynthesisSelected(synthesisAlgorithm != SynthesisAlgorithm::LineAware) {}
+
+            [[nodiscard]] bool estimateModule(const Module& mainModule) {
+                for (const Variable::vec* variables: {&mainModule.parameters, &mainModule.variables}) {
+                    for (const Variable::ptr& variable: *variables) {
+                        numQubits += static_cast<std::size_t>(determineNumberOfElementsInVariable(*variable)) * variable->bitwidth;
+                    }
+                }
+                return std::ranges::all_of(mainModule.statements, [&](const Statement::ptr& statement) { return processStatement(statement); });
+            }
+
+            [[nodiscard]] ResourceEstimate getEstimate() const {
+                ResourceEstimate estimate;
+                estimate.numQubits            = numQubits;
+                estimate.numQuantumOperations = recordedQuantumOperations.numQuantumOperations;
+                estimate.transistorCost       = recordedQuantumOperations.transistorCost;
+                estimate.numStatements        = numStatements;
+                for (std::size_t numControlQubits = 0; numControlQubits < recordedQuantumOperations.numQuantumOperationsPerNumControlQubits.size(); ++numControlQubits) {
+                    estimate.quantumCost += AnnotatableQuantumComputation::getQuantumCostForSynthesisOfGate(numControlQubits, false, numQubits) * recordedQuantumOperations.numQuantumOperationsPerNumControlQubits[numControlQubits];
+                }
+                return estimate;
+            }
+
+        private:
+            /**
+             * The quantum operations recorded like in the AnnotatableQuantumComputation with the number of control qubits of a SWAP gate being incremented by one.
+             */
+            struct RecordedQuantumOperations {
+                std::vector<std::size_t>                                numQuantumOperationsPerNumControlQubits;
+                AnnotatableQuantumComputation::SynthesisCostMetricValue transistorCost       = 0;
+                std::size_t                                             numQuantumOperations = 0;
+            };
+
+            /**
+             * A subexpression synthesized like in the line aware synthesis that is reverted after the synthesis of the assignment (see SyrecSynthesis::expOpp, expLhss and expRhss).
+             */
+            struct LineAwareSubexpression {
+                BinaryExpression::BinaryOperation binaryOperation;
+                std::size_t                       lhsOperandBitwidth;
+                std::size_t                       rhsOperandBitwidth;
+            };
+
+            struct EvaluatedVariableAccess {
+                const Variable*                     accessedVariable;
+                const Expression::vec*              userDefinedDimensionAccess;
+                std::vector<std::optional<unsigned>> accessedValuePerDimension;
+                bool                                containedOnlyNumericExpressions;
+                std::size_t                         numAccessedBits;
+            };
+
+            const ConfigurableOptions&          settings;
+            SynthesisAlgorithm                  synthesisAlgorithm;
+            bool                                isCostAwareSynthesisSelected;
+            std::size_t                         numQubits                  = 0;
+            std::size_t                         numPropagatedControlQubits = 0;
+            std::size_t                         numStatements              = 0;
+            RecordedQuantumOperations           recordedQuantumOperations;
+            Number::LoopVariableMapping         loopMap;
+            std::vector<LineAwareSubexpression> lineAwareSubexpressions;
+            std::size_t                         numOperationsOfRhsOfAssignment = 0;
+
+            void addQuantumOperations(const std::size_t numQuantumOperations, const std::size_t numControlQubits, const bool isSwapGate = false) {
+                if (numQuantumOperations == 0) {
+                    return;
+                }
+                const std::size_t numControlQubitsIncludingPropagatedOnes = numControlQubits + numPropagatedControlQubits;
+                const std::size_t numControlQubitsOfQuantumCost            = numControlQubitsIncludingPropagatedOnes + static_cast<std::size_t>(isSwapGate);
+                if (recordedQuantumOperations.numQuantumOperationsPerNumControlQubits.size() <= numControlQubitsOfQuantumCost) {
+                    recordedQuantumOperations.numQuantumOperationsPerNumControlQubits.resize(numControlQubitsOfQuantumCost + 1U, 0);
+                }
+                recordedQuantumOperations.numQuantumOperationsPerNumControlQubits[numControlQubitsOfQuantumCost] += numQuantumOperations;
+                recordedQuantumOperations.transistorCost += AnnotatableQuantumComputation::getTransistorCostForSynthesisOfGate(numControlQubitsIncludingPropagatedOnes) * numQuantumOperations;
+                recordedQuantumOperations.numQuantumOperations += numQuantumOperations;
+            }
+
+            // The replay of recorded quantum operations (see AnnotatableQuantumComputation::replayOperationsAtGivenIndexRange(...)) adds copies of the quantum operations recorded between both snapshots.
+            void replayQuantumOperationsRecordedBetween(const RecordedQuantumOperations& from, const RecordedQuantumOperations& to) {
+                std::vector<std::size_t>& numQuantumOperationsPerNumControlQubits = recordedQuantumOperations.numQuantumOperationsPerNumControlQubits;
+                for (std::size_t i = 0; i < to.numQuantumOperationsPerNumControlQubits.size(); ++i) {
+                    numQuantumOperationsPerNumControlQubits[i] += to.numQuantumOperationsPerNumControlQubits[i] - (i < from.numQuantumOperationsPerNumControlQubits.size() ? from.numQuantumOperationsPerNumControlQubits[i] : 0);
+                }
+                recordedQuantumOperations.transistorCost += to.transistorCost - from.transistorCost;
+                recordedQuantumOperations.numQuantumOperations += to.numQuantumOperations - from.numQuantumOperations;
+            }
+
+            //**********************************************************************
+            //*****                        Statements                          *****
+            //**********************************************************************
+
+            [[nodiscard]] bool processStatement(const Statement::ptr& statement) {
+                if (statement == nullptr) {
+                    return false;
+                }
+                ++numStatements;
+                switch (synthesisAlgorithm) {
+                    case SynthesisAlgorithm::LineAware:
+                        return processStatementLineAware(statement);
+                    case SynthesisAlgorithm::Hybrid:
+                        return processStatementHybrid(statement);
+                    default:
+                        return onStatement(*statement);
+                }
+            }
+
+            [[nodiscard]] bool processStatementLineAware(const Statement::ptr& statement) {
+                // See LineAwareSynthesis::processStatement(...), the optimized synthesis of an assignment with repeated operands on its right-hand side is not modeled.
+                std::optional<bool> didStmtNotContainNonCompileTimeConstantIndex = true;
+                if (const auto* const unaryStmt = statementCast<UnaryStatement>(statement.get()); unaryStmt != nullptr) {
+                    didStmtNotContainNonCompileTimeConstantIndex = doesVariableAccessNotContainNonCompileTimeConstantIndex(unaryStmt->var);
+                } else if (const auto* const ifStmt = statementCast<IfStatement>(statement.get()); ifStmt != nullptr) {
+                    didStmtNotContainNonCompileTimeConstantIndex = doesExpressionNotContainNonCompileTimeConstantIndex(ifStmt->condition);
+                } else if (const auto* const swapStmt = statementCast<SwapStatement>(statement.get()); swapStmt != nullptr) {
+                    didStmtNotContainNonCompileTimeConstantIndex = doesVariableAccessNotContainNonCompileTimeConstantIndex(swapStmt->lhs);
+                    if (didStmtNotContainNonCompileTimeConstantIndex.has_value() && !*didStmtNotContainNonCompileTimeConstantIndex) {
+                        didStmtNotContainNonCompileTimeConstantIndex = doesVariableAccessNotContainNonCompileTimeConstantIndex(swapStmt->rhs);
+                    }
+                } else if (const auto* const assignmentStmt = statementCast<AssignStatement>(statement.get()); assignmentStmt != nullptr) {
+                    didStmtNotContainNonCompileTimeConstantIndex = doesVariableAccessNotContainNonCompileTimeConstantIndex(assignmentStmt->lhs);
+                    if (didStmtNotContainNonCompileTimeConstantIndex.has_value() && *didStmtNotContainNonCompileTimeConstantIndex) {
+                        didStmtNotContainNonCompileTimeConstantIndex = doesExpressionNotContainNonCompileTimeConstantIndex(assignmentStmt->rhs);
+                    }
+                }
+
+                if (didStmtNotContainNonCompileTimeConstantIndex.has_value() && !*didStmtNotContainNonCompileTimeConstantIndex) {
+                    getErrorStream() << "Line aware synthesis cannot synthesis a statement that contains a variable access that uses a non-compile time constant expression as index in its dimension access component\n";
+                    return false;
+                }
+                return onStatement(*statement);
+            }
+
+            [[nodiscard]] bool processStatementHybrid(const Statement::ptr& statement) {
+                // See HybridSynthesis::processStatement(...) and HybridSynthesis::selectCostAwareSynthesisOfAssignment(...).
+                const bool wasCostAwareSynthesisSelected = isCostAwareSynthesisSelected;
+                isCostAwareSynthesisSelected             = true;
+                if (const auto* const assignmentStmt = statementCast<AssignStatement>(statement.get()); assignmentStmt != nullptr) {
+                    const std::optional<bool> doesLhsNotContainNonCompileTimeConstantIndex = doesVariableAccessNotContainNonCompileTimeConstantIndex(assignmentStmt->lhs);
+                    const std::optional<bool> doesRhsNotContainNonCompileTimeConstantIndex = doesLhsNotContainNonCompileTimeConstantIndex.value_or(false) ? doesExpressionNotContainNonCompileTimeConstantIndex(assignmentStmt->rhs) : std::nullopt;
+                    if (assignmentStmt->rhs != nullptr && doesRhsNotContainNonCompileTimeConstantIndex.value_or(false)) {
+                        const HybridSynthesis::EstimatedSynthesisCost costAwareSynthesisCost = HybridSynthesis::estimateSynthesisCostOfAssignment(*assignmentStmt, true);
+                        const HybridSynthesis::EstimatedSynthesisCost lineAwareSynthesisCost = HybridSynthesis::estimateSynthesisCostOfAssignment(*assignmentStmt, false);
+                        isCostAwareSynthesisSelected                                         = costAwareSynthesisCost.numQuantumOperations < lineAwareSynthesisCost.numQuantumOperations && (!settings.qubitBudgetOfHybridSynthesis.has_value() || numQubits + costAwareSynthesisCost.numAncillaryQubits <= *settings.qubitBudgetOfHybridSynthesis);
+                    }
+                }
+
+                auto       recordedLineAwareSubexpressions = std::exchange(lineAwareSubexpressions, {});
+                const bool estimationOfStatementOk         = onStatement(*statement);
+                lineAwareSubexpressions                    = std::move(recordedLineAwareSubexpressions);
+                isCostAwareSynthesisSelected               = wasCostAwareSynthesisSelected;
+                return estimationOfStatementOk;
+            }
+
+            [[nodiscard]] bool onStatement(const Statement& statement) {
+                switch (statement.getKind()) {
+                    case Statement::Kind::Swap:
+                        return onStatement(static_cast<const SwapStatement&>(statement));
+                    case Statement::Kind::Unary:
+                        return onStatement(static_cast<const UnaryStatement&>(statement));
+                    case Statement::Kind::Assign:
+                        return onStatement(static_cast<const AssignStatement&>(statement));
+                    case Statement::Kind::If:
+                        return onStatement(static_cast<const IfStatement&>(statement));
+                    case Statement::Kind::For:
+                        return onStatement(static_cast<const ForStatement&>(statement));
+                    case Statement::Kind::Call:
+                        return onModuleCall(static_cast<const CallStatement&>(statement).target, true);
+                    case Statement::Kind::Uncall:
+                        return onModuleCall(static_cast<const UncallStatement&>(statement).target, false);
+                    case Statement::Kind::Skip:
+                        return true;
+                }
+                return false;
+            }
+
+            [[nodiscard]] bool onStatement(const SwapStatement& statement) {
+                const std::optional<EvaluatedVariableAccess> evaluatedLhsOperand = evaluateAndValidateVariableAccess(statement.lhs);
+                const std::optional<EvaluatedVariableAccess> evaluatedRhsOperand = evaluateAndValidateVariableAccess(statement.rhs);
+                if (!evaluatedLhsOperand.has_value() || !evaluatedRhsOperand.has_value()) {
+                    return false;
+                }
+
+                // The qubits of an operand containing a non-compile time constant index are swapped to ancillary qubits prior to and swapped back after the swap of both operands.
+                const std::size_t numQubitsSwapped = evaluatedLhsOperand->numAccessedBits;
+                const auto        extractOperand   = [&](const EvaluatedVariableAccess& evaluatedOperand, std::size_t& numQubitsOfOperand) {
+                    numQubitsOfOperand = evaluatedOperand.numAccessedBits;
+                    if (evaluatedOperand.containedOnlyNumericExpressions) {
+                        return true;
+                    }
+                    numQubitsOfOperand = numQubitsSwapped;
+                    return calculateSymbolicUnrolledIndexForElementInVariable(evaluatedOperand) && getConstantLines(numQubitsSwapped, 0U) && transferQubitsOfElementAtIndexInVariableToOtherQubits(evaluatedOperand, numQubitsSwapped, true);
+                };
+
+                std::size_t numQubitsOfLhsOperand = 0;
+                std::size_t numQubitsOfRhsOperand = 0;
+                return extractOperand(*evaluatedLhsOperand, numQubitsOfLhsOperand) && extractOperand(*evaluatedRhsOperand, numQubitsOfRhsOperand) && swap(numQubitsOfLhsOperand, numQubitsOfRhsOperand) && (evaluatedLhsOperand->containedOnlyNumericExpressions || transferQubitsOfElementAtIndexInVariableToOtherQubits(*evaluatedLhsOperand, numQubitsOfLhsOperand, true)) && (evaluatedRhsOperand->containedOnlyNumericExpressions || transferQubitsOfElementAtIndexInVariableToOtherQubits(*evaluatedRhsOperand, numQubitsOfRhsOperand, true));
+            }
+
+            [[nodiscard]] bool onStatement(const UnaryStatement& statement) {
+                const std::optional<EvaluatedVariableAccess> evaluatedVariableAccess = evaluateAndValidateVariableAccess(statement.var);
+                if (!evaluatedVariableAccess.has_value()) {
+                    return false;
+                }
+
+                const std::size_t numAccessedQubits = evaluatedVariableAccess->numAccessedBits;
+                bool              estimationOk      = evaluatedVariableAccess->containedOnlyNumericExpressions || (calculateSymbolicUnrolledIndexForElementInVariable(*evaluatedVariableAccess) && getConstantLines(numAccessedQubits, 0U) && transferQubitsOfElementAtIndexInVariableToOtherQubits(*evaluatedVariableAccess, numAccessedQubits, true));
+                switch (statement.unaryOperation) {
+                    case UnaryStatement::UnaryOperation::Invert:
+                        addQuantumOperations(numAccessedQubits, 0);
+                        break;
+                    case UnaryStatement::UnaryOperation::Increment:
+                    case UnaryStatement::UnaryOperation::Decrement:
+                        // The i-th quantum operation of the increment and decrement is controlled by the i less significant qubits of the operand.
+                        for (std::size_t i = 0; i < numAccessedQubits; ++i) {
+                            addQuantumOperations(1, i);
+                        }
+                        break;
+                    default:
+                        return false;
+                }
+                return estimationOk && (evaluatedVariableAccess->containedOnlyNumericExpressions || transferQubitsOfElementAtIndexInVariableToOtherQubits(*evaluatedVariableAccess, numAccessedQubits, true));
+            }
+
+            [[nodiscard]] bool onStatement(const AssignStatement& statement) {
+                const std::optional<EvaluatedVariableAccess> evaluatedLhsOperand = evaluateAndValidateVariableAccess(statement.lhs);
+                if (!evaluatedLhsOperand.has_value()) {
+                    return false;
+                }
+
+                const std::size_t numAccessedBitsInLhsOperand = evaluatedLhsOperand->numAccessedBits;
+                if (!evaluatedLhsOperand->containedOnlyNumericExpressions && (!calculateSymbolicUnrolledIndexForElementInVariable(*evaluatedLhsOperand) || !getConstantLines(numAccessedBitsInLhsOperand, 0U) || !transferQubitsOfElementAtIndexInVariableToOtherQubits(*evaluatedLhsOperand, numAccessedBitsInLhsOperand, true))) {
+                    return false;
+                }
+
+                // The number of binary expressions recorded by LineAwareSynthesis::opRhsLhsExpression(...) determines whether the synthesis of the operation of the right-hand side can be merged with the assignment operation.
+                numOperationsOfRhsOfAssignment = 0;
+                if (!isCostAwareSynthesisSelected) {
+                    static_cast<void>(countOperationsOfRhsOfAssignment(statement.rhs));
+                }
+
+                std::size_t                                            numQubitsOfRhs            = 0;
+                const std::optional<BinaryExpression::BinaryOperation> assignmentAsBinaryOperation = tryMapAssignmentToBinaryOperation(statement.assignOperation);
+                const bool                                             estimationOfRhsOk           = onExpression(statement.rhs, static_cast<unsigned>(numAccessedBitsInLhsOperand), numQubitsOfRhs, assignmentAsBinaryOperation);
+                numOperationsOfRhsOfAssignment                                                     = 0;
+                if (!estimationOfRhsOk || !assignmentAsBinaryOperation.has_value()) {
+                    return false;
+                }
+
+                const bool estimationOfAssignmentOk = isCostAwareSynthesisSelected ? applyInplaceOperation(*assignmentAsBinaryOperation, numQubitsOfRhs, numAccessedBitsInLhsOperand) : applyAssignmentOperationLineAware(*assignmentAsBinaryOperation, numQubitsOfRhs, numAccessedBitsInLhsOperand);
+                return estimationOfAssignmentOk && (evaluatedLhsOperand->containedOnlyNumericExpressions || transferQubitsOfElementAtIndexInVariableToOtherQubits(*evaluatedLhsOperand, numAccessedBitsInLhsOperand, true));
+            }
+
+            [[nodiscard]] bool onStatement(const IfStatement& statement) {
+                std::optional<BinaryExpression::BinaryOperation> guardExpressionTopLevelOperation;
+                if (const auto* const binary = expressionCast<BinaryExpression>(statement.condition.get()); binary != nullptr) {
+                    guardExpressionTopLevelOperation = binary->binaryOperation;
+                }
+
+                std::size_t numQubitsOfGuardExpression = 0;
+                if (!onExpression(statement.condition, 1U, numQubitsOfGuardExpression, guardExpressionTopLevelOperation)) {
+                    return false;
+                }
+
+                // The value of a guard expression stored in the qubit of a variable is copied to an ancillary qubit.
+                if (expressionCast<VariableExpression>(statement.condition.get()) != nullptr) {
+                    ++numQubits;
+                    addQuantumOperations(1, 1);
+                }
+
+                // The statements of both branches are controlled by the guard expression qubit that is toggled prior to and after the else branch.
+                ++numPropagatedControlQubits;
+                bool estimationOfBranchStatementsOk = std::ranges::all_of(statement.thenStatements, [&](const Statement::ptr& trueBranchStatement) { return processStatement(trueBranchStatement); });
+                --numPropagatedControlQubits;
+                addQuantumOperations(1, 0);
+                ++numPropagatedControlQubits;
+                estimationOfBranchStatementsOk &= std::ranges::all_of(statement.elseStatements, [&](const Statement::ptr& falseBranchStatement) { return processStatement(falseBranchStatement); });
+                --numPropagatedControlQubits;
+                addQuantumOperations(1, 0);
+                return estimationOfBranchStatementsOk;
+            }
+
+            [[nodiscard]] bool onStatement(const ForStatement& statement) {
+                const auto& [nfrom, nTo] = statement.range;
+                if (nTo == nullptr) {
+                    return false;
+                }
+
+                const std::optional<unsigned> from = nfrom != nullptr ? nfrom->tryEvaluate(loopMap) : std::make_optional(1U);
+                const std::optional<unsigned> to   = nTo->tryEvaluate(loopMap);
+                const std::optional<unsigned> step = statement.step != nullptr ? statement.step->tryEvaluate(loopMap) : std::make_optional(1U);
+                if (!from.has_value() || !to.has_value() || !step.has_value()) {
+                    getErrorStream() << "Failed to evaluate the range or step size of a loop\n";
+                    return false;
+                }
+                if (*from == *to) {
+                    return true;
+                }
+                if (*step == 0U) {
+                    getErrorStream() << "The step size of a loop whose range is not empty cannot be zero\n";
+                    return false;
+                }
+
+                const auto         fromSigned   = static_cast<std::int64_t>(*from);
+                const auto         toSigned     = static_cast<std::int64_t>(*to);
+                const auto         stepSigned   = *from < *to ? static_cast<std::int64_t>(*step) : -static_cast<std::int64_t>(*step);
+                const std::string& loopVariable = statement.loopVariable;
+                for (auto i = fromSigned; *from < *to ? i < toSigned : i > toSigned; i += stepSigned) {
+                    if (!loopVariable.empty()) {
+                        loopMap[loopVariable] = static_cast<unsigned>(i);
+                    }
+                    if (!std::ranges::all_of(statement.statements, [&](const Statement::ptr& stat) { return processStatement(stat); })) {
+                        return false;
+                    }
+                }
+                if (!loopVariable.empty()) {
+                    loopMap.erase(loopVariable);
+                }
+                return true;
+            }
+
+            [[nodiscard]] bool onModuleCall(const Module::ptr& targetModule, const bool isCall) {
+                if (targetModule == nullptr) {
+                    getErrorStream() << "Failed to estimate module call/uncall due to the called module being null\n";
+                    return false;
+                }
+
+                // The qubits of the local variables of the called module are created for every call while the values of the loop variables of the caller are not visible in the called module.
+                for (const Variable::ptr& localVariable: targetModule->variables) {
+                    numQubits += static_cast<std::size_t>(determineNumberOfElementsInVariable(*localVariable)) * localVariable->bitwidth;
+                }
+
+                Number::LoopVariableMapping loopMapOfCaller = std::exchange(loopMap, {});
+                bool                        estimationOk    = true;
+                if (isCall) {
+                    estimationOk = std::ranges::all_of(targetModule->statements, [&](const Statement::ptr& stat) { return processStatement(stat); });
+                } else {
+                    for (auto it = targetModule->statements.crbegin(); it != targetModule->statements.crend() && estimationOk; ++it) {
+                        const std::optional<Statement::ptr> reversedStatement = *it != nullptr ? it->get()->reverse() : std::nullopt;
+                        estimationOk                                          = reversedStatement.has_value() && processStatement(*reversedStatement);
+                    }
+                }
+                loopMap = std::move(loopMapOfCaller);
+                return estimationOk;
+            }
+
+            //**********************************************************************
+            //*****                        Expressions                         *****
+            //**********************************************************************
+
+            // See SyrecSynthesis::performCompileTimeSimplificationsOfExpression(...).
+            [[nodiscard]] std::optional<Expression::ptr> performCompileTimeSimplificationsOfExpression(const Expression::ptr& expression) const {
+                if (expression == nullptr) {
+                    return std::nullopt;
+                }
+
+                if (const auto* const exprAsNumericExpr = expressionCast<NumericExpression>(expression.get()); exprAsNumericExpr != nullptr) {
+                    if (exprAsNumericExpr->value->isConstant()) {
+                        return expression;
+                    }
+                    if (const std::optional<unsigned> compileTimeValue = exprAsNumericExpr->value->tryEvaluate(loopMap); compileTimeValue.has_value()) {
+                        return std::make_shared<NumericExpression>(std::make_shared<Number>(*compileTimeValue), 32U);
+                    }
+                } else if (expressionCast<VariableExpression>(expression.get()) != nullptr) {
+                    return expression;
+                } else if (const auto* const exprAsBinaryExpr = expressionCast<BinaryExpression>(expression.get()); exprAsBinaryExpr != nullptr) {
+                    const std::optional<Expression::ptr> simplifiedLhsOperand = performCompileTimeSimplificationsOfExpression(exprAsBinaryExpr->lhs);
+                    const std::optional<Expression::ptr> simplifiedRhsOperand = performCompileTimeSimplificationsOfExpression(exprAsBinaryExpr->rhs);
+                    if (!simplifiedLhsOperand.has_value() || !simplifiedRhsOperand.has_value()) {
+                        return std::nullopt;
+                    }
+
+                    const auto* const simplifiedLhsOperandAsNumericExpr = expressionCast<NumericExpression>(simplifiedLhsOperand->get());
+                    const auto* const simplifiedRhsOperandAsNumericExpr = expressionCast<NumericExpression>(simplifiedRhsOperand->get());
+                    if (simplifiedLhsOperandAsNumericExpr != nullptr || simplifiedRhsOperandAsNumericExpr != nullptr) {
+                        const std::optional<unsigned> valueOfLhsOperand = simplifiedLhsOperandAsNumericExpr != nullptr ? simplifiedLhsOperandAsNumericExpr->value->tryEvaluate(loopMap) : std::nullopt;
+                        const std::optional<unsigned> valueOfRhsOperand = simplifiedRhsOperandAsNumericExpr != nullptr ? simplifiedRhsOperandAsNumericExpr->value->tryEvaluate(loopMap) : std::nullopt;
+                        if (const std::optional<unsigned> compileTimeValue = utils::tryEvaluate(valueOfLhsOperand, exprAsBinaryExpr->binaryOperation, valueOfRhsOperand); compileTimeValue.has_value()) {
+                            return std::make_shared<NumericExpression>(std::make_shared<Number>(*compileTimeValue), 32U);
+                        }
+                    }
+                    if (*simplifiedLhsOperand != exprAsBinaryExpr->lhs || *simplifiedRhsOperand != exprAsBinaryExpr->rhs) {
+                        return std::make_shared<BinaryExpression>(*simplifiedLhsOperand, exprAsBinaryExpr->binaryOperation, *simplifiedRhsOperand);
+                    }
+                    return expression;
+                } else if (const auto* const exprAsShiftExpr = expressionCast<ShiftExpression>(expression.get()); exprAsShiftExpr != nullptr) {
+                    const std::optional<Expression::ptr> simplifiedToBeShiftedOperand = performCompileTimeSimplificationsOfExpression(exprAsShiftExpr->lhs);
+                    if (!simplifiedToBeShiftedOperand.has_value()) {
+                        return std::nullopt;
+                    }
+
+                    if (const auto* const simplifiedToBeShiftedOperandAsNumericExpr = expressionCast<NumericExpression>(simplifiedToBeShiftedOperand->get()); simplifiedToBeShiftedOperandAsNumericExpr != nullptr) {
+                        const std::optional<unsigned> valueOfToBeShiftedOperand = simplifiedToBeShiftedOperandAsNumericExpr->value->tryEvaluate(loopMap);
+                        const std::optional<unsigned> shiftAmount               = exprAsShiftExpr->rhs != nullptr ? exprAsShiftExpr->rhs->tryEvaluate(loopMap) : std::nullopt;
+                        if (const std::optional<unsigned> compileTimeValue = utils::tryEvaluate(valueOfToBeShiftedOperand, exprAsShiftExpr->shiftOperation, shiftAmount); compileTimeValue.has_value()) {
+                            return std::make_shared<NumericExpression>(std::make_shared<Number>(*compileTimeValue), 32U);
+                        }
+                    }
+                    if (*simplifiedToBeShiftedOperand != exprAsShiftExpr->lhs) {
+                        return std::make_shared<ShiftExpression>(*simplifiedToBeShiftedOperand, exprAsShiftExpr->shiftOperation, exprAsShiftExpr->rhs);
+                    }
+                    return expression;
+                } else if (const auto* const exprAsUnaryExpr = expressionCast<UnaryExpression>(expression.get()); exprAsUnaryExpr != nullptr) {
+                    const std::optional<Expression::ptr> simplifiedUnaryExprOperand = performCompileTimeSimplificationsOfExpression(exprAsUnaryExpr->expr);
+                    if (!simplifiedUnaryExprOperand.has_value()) {
+                        return std::nullopt;
+                    }
+
+                    if (const auto* const simplifiedUnaryExprOperandAsNumericExpr = expressionCast<NumericExpression>(simplifiedUnaryExprOperand->get()); simplifiedUnaryExprOperandAsNumericExpr != nullptr) {
+                        if (const std::optional<unsigned> compileTimeValue = utils::tryEvaluate(exprAsUnaryExpr->unaryOperation, simplifiedUnaryExprOperandAsNumericExpr->value->tryEvaluate(loopMap)); compileTimeValue.has_value()) {
+                            return std::make_shared<NumericExpression>(std::make_shared<Number>(*compileTimeValue), 32U);
+                        }
+                    }
+                    if (*simplifiedUnaryExprOperand != exprAsUnaryExpr->expr) {
+                        return std::make_shared<UnaryExpression>(exprAsUnaryExpr->unaryOperation, *simplifiedUnaryExprOperand);
+                    }
+                    return expression;
+                }
+                return std::nullopt;
+            }
+
+            /**
+             * Estimate the synthesis of an expression (see SyrecSynthesis::onExpression(...)).
+             * @param expression The expression to estimate.
+             * @param optionalExpectedOperandBitwidth The expected bitwidth of the expression used to truncate integer constants.
+             * @param numQubitsOfResult The number of qubits storing the result of the expression, zero if the synthesis of the expression was merged with the assignment operation in the line aware synthesis.
+             * @param mergedOperation The operation of the enclosing statement with which the top-most matching binary operation can be merged in the line aware synthesis.
+             * @return Whether the expression could be estimated.
+             */
+            [[nodiscard]] bool onExpression(const Expression::ptr& expression, const std::optional<unsigned>& optionalExpectedOperandBitwidth, std::size_t& numQubitsOfResult, const std::optional<BinaryExpression::BinaryOperation>& mergedOperation) {
+                const Expression::ptr simplifiedExpr = performCompileTimeSimplificationsOfExpression(expression).value_or(expression);
+                if (simplifiedExpr == nullptr) {
+                    return false;
+                }
+
+                switch (simplifiedExpr->getKind()) {
+                    case Expression::Kind::Numeric:
+                        return onExpression(static_cast<const NumericExpression&>(*simplifiedExpr), optionalExpectedOperandBitwidth, numQubitsOfResult);
+                    case Expression::Kind::Variable:
+                        return getVariables(static_cast<const VariableExpression&>(*simplifiedExpr).var, numQubitsOfResult);
+                    case Expression::Kind::Binary:
+                        return onExpression(static_cast<const BinaryExpression&>(*simplifiedExpr), numQubitsOfResult, mergedOperation);
+                    case Expression::Kind::Shift:
+                        return onExpression(static_cast<const ShiftExpression&>(*simplifiedExpr), numQubitsOfResult, mergedOperation);
+                    case Expression::Kind::Unary:
+                        return onExpression(static_cast<const UnaryExpression&>(*simplifiedExpr), numQubitsOfResult, mergedOperation);
+                }
+                return false;
+            }
+
+            [[nodiscard]] bool onExpression(const NumericExpression& expression, const std::optional<unsigned>& optionalExpectedOperandBitwidth, std::size_t& numQubitsOfResult) {
+                const std::optional<unsigned> compileTimeValue = expression.value != nullptr ? expression.value->tryEvaluate(loopMap) : std::nullopt;
+                if (!compileTimeValue.has_value()) {
+                    return false;
+                }
+
+                numQubitsOfResult = optionalExpectedOperandBitwidth.value_or(32U);
+                return getConstantLines(numQubitsOfResult, optionalExpectedOperandBitwidth.has_value() ? utils::truncateConstantValueToExpectedBitwidth(*compileTimeValue, *optionalExpectedOperandBitwidth, settings.integerConstantTruncationOperation) : *compileTimeValue);
+            }
+
+            [[nodiscard]] bool onExpression(const ShiftExpression& expression, std::size_t& numQubitsOfResult, const std::optional<BinaryExpression::BinaryOperation>& mergedOperation) {
+                std::size_t numQubitsOfToBeShiftedOperand = 0;
+                if (!onExpression(expression.lhs, std::nullopt, numQubitsOfToBeShiftedOperand, mergedOperation)) {
+                    return false;
+                }
+
+                const std::optional<unsigned> qubitIndexShiftAmount = expression.rhs != nullptr ? expression.rhs->tryEvaluate(loopMap) : std::nullopt;
+                if (!qubitIndexShiftAmount.has_value()) {
+                    getErrorStream() << "Failed to evaluate the shift amount of a shift expression\n";
+                    return false;
+                }
+                numQubitsOfResult = expression.bitwidth();
+                return getConstantLines(numQubitsOfResult, 0U) && shift(numQubitsOfResult, numQubitsOfToBeShiftedOperand, *qubitIndexShiftAmount);
+            }
+
+            [[nodiscard]] bool onExpression(const UnaryExpression& expression, std::size_t& numQubitsOfResult, const std::optional<BinaryExpression::BinaryOperation>& mergedOperation) {
+                std::size_t numQubitsOfInnerExpr = 0;
+                if (!onExpression(expression.expr, std::nullopt, numQubitsOfInnerExpr, mergedOperation)) {
+                    return false;
+                }
+
+                if (expression.unaryOperation == UnaryExpression::UnaryOperation::LogicalNegation && numQubitsOfInnerExpr != 1) {
+                    getErrorStream() << "Logical negation operation can only be used for expressions with a bitwidth of 1\n";
+                    return false;
+                }
+
+                // The result of the inner expression is copied to ancillary qubits which are negated afterwards.
+                numQubitsOfResult = expression.bitwidth();
+                if (numQubitsOfInnerExpr > numQubitsOfResult || !getConstantLines(numQubitsOfResult, 0U)) {
+                    return false;
+                }
+                addQuantumOperations(numQubitsOfInnerExpr, 1);
+                addQuantumOperations(numQubitsOfResult, 0);
+                return true;
+            }
+
+            [[nodiscard]] bool onExpression(const BinaryExpression& expression, std::size_t& numQubitsOfResult, const std::optional<BinaryExpression::BinaryOperation>& mergedOperation) {
+                if (expression.lhs == nullptr || expression.rhs == nullptr) {
+                    return false;
+                }
+
+                const auto* const lhsOperandAsNumericExpr = expressionCast<NumericExpression>(expression.lhs.get());
+                const auto* const rhsOperandAsNumericExpr = expressionCast<NumericExpression>(expression.rhs.get());
+                if (lhsOperandAsNumericExpr != nullptr && rhsOperandAsNumericExpr != nullptr) {
+                    return false;
+                }
+
+                std::optional<unsigned> expectedOperandsBitwidth;
+                if (isBinaryOperationLogicalOperation(expression.binaryOperation)) {
+                    expectedOperandsBitwidth = 1U;
+                } else if (lhsOperandAsNumericExpr == nullptr && rhsOperandAsNumericExpr != nullptr) {
+                    expectedOperandsBitwidth = expression.lhs->bitwidth();
+                } else if (lhsOperandAsNumericExpr != nullptr && rhsOperandAsNumericExpr == nullptr) {
+                    expectedOperandsBitwidth = expression.rhs->bitwidth();
+                }
+
+                std::size_t lhs = 0;
+                std::size_t rhs = 0;
+                if (!onExpression(expression.lhs, expectedOperandsBitwidth, lhs, mergedOperation) || !onExpression(expression.rhs, expectedOperandsBitwidth, rhs, mergedOperation) || lhs != rhs) {
+                    return false;
+                }
+
+                // Only the line aware synthesis reverts the recorded subexpressions, the remaining synthesizers thus never observe them.
+                if (!isCostAwareSynthesisSelected) {
+                    lineAwareSubexpressions.emplace_back(LineAwareSubexpression{.binaryOperation = expression.binaryOperation, .lhsOperandBitwidth = lhs, .rhsOperandBitwidth = rhs});
+                    if (lineAwareSubexpressions.size() == numOperationsOfRhsOfAssignment && mergedOperation.has_value() && expression.binaryOperation == *mergedOperation) {
+                        numQubitsOfResult = 0;
+                        return true;
+                    }
+                }
+
+                const unsigned bitwidth = expression.bitwidth();
+                numQubitsOfResult       = bitwidth;
+                switch (expression.binaryOperation) {
+                    case BinaryExpression::BinaryOperation::Add:
+                    case BinaryExpression::BinaryOperation::Subtract:
+                    case BinaryExpression::BinaryOperation::Exor: {
+                        if (!isCostAwareSynthesisSelected) {
+                            // The line aware synthesis stores the result in the qubits of the right-hand side operand.
+                            numQubitsOfResult = rhs;
+                            return applyInplaceOperationLineAware(expression.binaryOperation, lhs, rhs);
+                        }
+                        // The left-hand side operand is copied to the ancillary qubits storing the result to which the right-hand side operand is applied.
+                        return getConstantLines(bitwidth, 0U) && bitwiseCnot(bitwidth, lhs) && applyInplaceOperation(expression.binaryOperation, rhs, bitwidth);
+                    }
+                    case BinaryExpression::BinaryOperation::Multiply:
+                        return getConstantLines(bitwidth, 0U) && multiplication(bitwidth, lhs, rhs);
+                    case BinaryExpression::BinaryOperation::Divide:
+                    case BinaryExpression::BinaryOperation::Modulo:
+                        return getConstantLines(bitwidth, 0U) && getConstantLines(bitwidth, 0U) && division(lhs, rhs, bitwidth, bitwidth);
+                    case BinaryExpression::BinaryOperation::LogicalAnd:
+                        ++numQubits;
+                        addQuantumOperations(1, 2);
+                        return true;
+                    case BinaryExpression::BinaryOperation::LogicalOr:
+                        ++numQubits;
+                        addQuantumOperations(2, 1);
+                        addQuantumOperations(1, 2);
+                        return true;
+                    case BinaryExpression::BinaryOperation::BitwiseAnd:
+                    case BinaryExpression::BinaryOperation::BitwiseOr:
+                        if (!getConstantLines(bitwidth, 0U) || lhs < bitwidth || rhs < bitwidth) {
+                            return false;
+                        }
+                        if (expression.binaryOperation == BinaryExpression::BinaryOperation::BitwiseOr) {
+                            addQuantumOperations(2 * static_cast<std::size_t>(bitwidth), 1);
+                        }
+                        addQuantumOperations(bitwidth, 2);
+                        return true;
+                    case BinaryExpression::BinaryOperation::LessThan:
+                    case BinaryExpression::BinaryOperation::GreaterThan:
+                    case BinaryExpression::BinaryOperation::LessEquals:
+                    case BinaryExpression::BinaryOperation::GreaterEquals:
+                        // The ancillary qubit storing the result of the comparison is used as the carry out of the subtraction of both operands.
+                        ++numQubits;
+                        if (!decreaseWithCarry(lhs, rhs) || !inplaceAdd(rhs, lhs)) {
+                            return false;
+                        }
+                        if (expression.binaryOperation == BinaryExpression::BinaryOperation::LessEquals || expression.binaryOperation == BinaryExpression::BinaryOperation::GreaterEquals) {
+                            addQuantumOperations(1, 0);
+                        }
+                        return true;
+                    case BinaryExpression::BinaryOperation::Equals:
+                    case BinaryExpression::BinaryOperation::NotEquals:
+                        ++numQubits;
+                        if (rhs < lhs) {
+                            return false;
+                        }
+                        // The operands are compared bitwise by CNOT and X gates prior to and after the multi-controlled Toffoli gate computing the result.
+                        addQuantumOperations(2 * lhs, 0);
+                        addQuantumOperations(2 * lhs, 1);
+                        addQuantumOperations(1, lhs);
+                        if (expression.binaryOperation == BinaryExpression::BinaryOperation::NotEquals) {
+                            addQuantumOperations(1, 0);
+                        }
+                        return true;
+                    default:
+                        return false;
+                }
+            }
+
+            // See LineAwareSynthesis::opRhsLhsExpression(...).
+            [[nodiscard]] bool countOperationsOfRhsOfAssignment(const Expression::ptr& expression) {
+                if (const auto* const binary = expressionCast<BinaryExpression>(expression.get()); binary != nullptr) {
+                    if (!countOperationsOfRhsOfAssignment(binary->lhs) || !countOperationsOfRhsOfAssignment(binary->rhs)) {
+                        return false;
+                    }
+                    ++numOperationsOfRhsOfAssignment;
+                    return true;
+                }
+                if (const auto* const var = expressionCast<VariableExpression>(expression.get()); var != nullptr) {
+                    std::size_t numAccessedQubits = 0;
+                    return getVariables(var->var, numAccessedQubits);
+                }
+                return false;
+            }
+
+            //**********************************************************************
+            //*****                  Variable accesses                         *****
+            //**********************************************************************
+
+            // See SyrecSynthesis::evaluateAndValidateVariableAccess(...).
+            [[nodiscard]] std::optional<EvaluatedVariableAccess> evaluateAndValidateVariableAccess(const VariableAccess::ptr& variableAccess) const {
+                if (variableAccess == nullptr || variableAccess->var == nullptr) {
+                    getErrorStream() << "Cannot estimate variable access that is null or whose accessed variable is null\n";
+                    return std::nullopt;
+                }
+
+                const Variable& accessedVariable = *variableAccess->var;
+                if (variableAccess->indexes.size() != accessedVariable.dimensions.size()) {
+                    getErrorStream() << "The number of indices defined in a variable access must match the number of dimensions of the accessed variable " << accessedVariable.name << "\n";
+                    return std::nullopt;
+                }
+
+                EvaluatedVariableAccess evaluatedVariableAccess{.accessedVariable = &accessedVariable, .userDefinedDimensionAccess = &variableAccess->indexes, .accessedValuePerDimension = std::vector<std::optional<unsigned>>(accessedVariable.dimensions.size(), std::nullopt), .containedOnlyNumericExpressions = true, .numAccessedBits = accessedVariable.bitwidth};
+                for (std::size_t dimensionIdx = 0; dimensionIdx < variableAccess->indexes.size(); ++dimensionIdx) {
+                    const Expression::ptr& dimensionExpr = variableAccess->indexes[dimensionIdx];
+                    if (dimensionExpr == nullptr) {
+                        getErrorStream() << "Expression defining index for dimension " << std::to_string(dimensionIdx) << " in variable access on " << accessedVariable.name << " cannot be NULL\n";
+                        return std::nullopt;
+                    }
+                    const auto* const dimensionExprAsNumericExpr = expressionCast<NumericExpression>(dimensionExpr.get());
+                    if (dimensionExprAsNumericExpr == nullptr) {
+                        evaluatedVariableAccess.containedOnlyNumericExpressions = false;
+                        continue;
+                    }
+
+                    const std::optional<unsigned> accessedValueOfDimension = dimensionExprAsNumericExpr->value->tryEvaluate(loopMap);
+                    if (!accessedValueOfDimension.has_value() || *accessedValueOfDimension >= accessedVariable.dimensions[dimensionIdx]) {
+                        getErrorStream() << "Failed to evaluate index of dimension " << std::to_string(dimensionIdx) << " or index was out of range in variable access on " << accessedVariable.name << "\n";
+                        return std::nullopt;
+                    }
+                    evaluatedVariableAccess.accessedValuePerDimension[dimensionIdx] = accessedValueOfDimension;
+                }
+
+                if (variableAccess->range.has_value()) {
+                    const std::optional<unsigned> bitrangeStart = variableAccess->range->first != nullptr ? variableAccess->range->first->tryEvaluate(loopMap) : std::nullopt;
+                    const std::optional<unsigned> bitrangeEnd   = variableAccess->range->second != nullptr ? variableAccess->range->second->tryEvaluate(loopMap) : std::nullopt;
+                    if (!bitrangeStart.has_value() || !bitrangeEnd.has_value() || *bitrangeStart >= accessedVariable.bitwidth || *bitrangeEnd >= accessedVariable.bitwidth) {
+                        getErrorStream() << "Failed to evaluate bitrange or bitrange was out of range in variable access on " << accessedVariable.name << "\n";
+                        return std::nullopt;
+                    }
+                    evaluatedVariableAccess.numAccessedBits = (*bitrangeStart > *bitrangeEnd ? *bitrangeStart - *bitrangeEnd : *bitrangeEnd - *bitrangeStart) + 1U;
+                }
+                return evaluatedVariableAccess;
+            }
+
+            [[nodiscard]] std::optional<bool> doesVariableAccessNotContainNonCompileTimeConstantIndex(const VariableAccess::ptr& variableAccess) const {
+                const std::optional<EvaluatedVariableAccess> evaluatedVariableAccess = evaluateAndValidateVariableAccess(variableAccess);
+                return evaluatedVariableAccess.has_value() ? std::make_optional(evaluatedVariableAccess->containedOnlyNumericExpressions) : std::nullopt;
+            }
+
+            // See LineAwareSynthesis::doesExpressionNotContainVariableAccessWithCompileTimeConstantExpressions(...).
+            [[nodiscard]] std::optional<bool> doesExpressionNotContainNonCompileTimeConstantIndex(const Expression::ptr& expression) const {
+                if (expression == nullptr) {
+                    return std::nullopt;
+                }
+                if (const auto* const exprAsBinaryExpr = expressionCast<BinaryExpression>(expression.get()); exprAsBinaryExpr != nullptr) {
+                    const std::optional<bool> doesLhsOperandNotContainNonCompileTimeConstantIndex = doesExpressionNotContainNonCompileTimeConstantIndex(exprAsBinaryExpr->lhs);
+                    const std::optional<bool> doesRhsOperandNotContainNonCompileTimeConstantIndex = doesLhsOperandNotContainNonCompileTimeConstantIndex.has_value() ? doesExpressionNotContainNonCompileTimeConstantIndex(exprAsBinaryExpr->rhs) : std::nullopt;
+                    return doesLhsOperandNotContainNonCompileTimeConstantIndex.has_value() && doesRhsOperandNotContainNonCompileTimeConstantIndex.has_value() ? std::make_optional(*doesLhsOperandNotContainNonCompileTimeConstantIndex && *doesRhsOperandNotContainNonCompileTimeConstantIndex) : std::nullopt;
+                }
+                if (const auto* const exprAsUnaryExpr = expressionCast<UnaryExpression>(expression.get()); exprAsUnaryExpr != nullptr) {
+                    return doesExpressionNotContainNonCompileTimeConstantIndex(exprAsUnaryExpr->expr);
+                }
+                if (const auto* const exprAsShiftExpr = expressionCast<ShiftExpression>(expression.get()); exprAsShiftExpr != nullptr) {
+                    return doesExpressionNotContainNonCompileTimeConstantIndex(exprAsShiftExpr->lhs);
+                }
+                if (const auto* const exprAsVariableExpr = expressionCast<VariableExpression>(expression.get()); exprAsVariableExpr != nullptr) {
+                    return doesVariableAccessNotContainNonCompileTimeConstantIndex(exprAsVariableExpr->var);
+                }
+                return expressionCast<NumericExpression>(expression.get()) != nullptr;
+            }
+
+            // See SyrecSynthesis::getVariables(...), the value of a variable access containing a non-compile time constant index is copied to ancillary qubits.
+            [[nodiscard]] bool getVariables(const VariableAccess::ptr& variableAccess, std::size_t& numAccessedQubits) {
+                const std::optional<EvaluatedVariableAccess> evaluatedVariableAccess = evaluateAndValidateVariableAccess(variableAccess);
+                if (!evaluatedVariableAccess.has_value()) {
+                    return false;
+                }
+                numAccessedQubits = evaluatedVariableAccess->numAccessedBits;
+                return evaluatedVariableAccess->containedOnlyNumericExpressions || (getConstantLines(numAccessedQubits, 0U) && calculateSymbolicUnrolledIndexForElementInVariable(*evaluatedVariableAccess) && transferQubitsOfElementAtIndexInVariableToOtherQubits(*evaluatedVariableAccess, numAccessedQubits, false));
+            }
+
+            // See SyrecSynthesis::calculateSymbolicUnrolledIndexForElementInVariable(...).
+            [[nodiscard]] bool calculateSymbolicUnrolledIndexForElementInVariable(const EvaluatedVariableAccess& evaluatedVariableAccess) {
+                const Variable&       accessedVariable = *evaluatedVariableAccess.accessedVariable;
+                std::vector<unsigned> offsetToNextElementPerDimension(accessedVariable.dimensions.size(), 1U);
+                for (std::size_t i = accessedVariable.dimensions.size(); i > 1U; --i) {
+                    offsetToNextElementPerDimension[i - 2U] = offsetToNextElementPerDimension[i - 1U] * accessedVariable.dimensions[i - 1U];
+                }
+
+                const std::size_t numQubitsOfUnrolledIndex = determineNumberOfBitsRequiredToStoreValue(determineNumberOfElementsInVariable(accessedVariable) - 1U);
+                if (!getConstantLines(numQubitsOfUnrolledIndex, 0U)) {
+                    return false;
+                }
+
+                std::optional<unsigned> compileTimeValueOfUnrolledIndex = 0U;
+                for (std::size_t i = 0; i < accessedVariable.dimensions.size(); ++i) {
+                    const unsigned offsetToNextElement = offsetToNextElementPerDimension[i];
+                    if (expressionCast<NumericExpression>(evaluatedVariableAccess.userDefinedDimensionAccess->at(i).get()) != nullptr) {
+                        const unsigned truncatedValue = utils::truncateConstantValueToExpectedBitwidth(*evaluatedVariableAccess.accessedValuePerDimension[i], static_cast<unsigned>(numQubitsOfUnrolledIndex), settings.integerConstantTruncationOperation);
+                        const unsigned summand        = utils::truncateConstantValueToExpectedBitwidth(truncatedValue * offsetToNextElement, static_cast<unsigned>(numQubitsOfUnrolledIndex), settings.integerConstantTruncationOperation);
+                        if (compileTimeValueOfUnrolledIndex.has_value()) {
+                            compileTimeValueOfUnrolledIndex = *compileTimeValueOfUnrolledIndex + summand;
+                        } else if (summand != 0U) {
+                            // The summand is moved to and cleared from ancillary qubits prior to and after its addition to the unrolled index.
+                            const std::size_t numSetBitsOfSummand = determineNumberOfSetBitsInValue(summand, numQubitsOfUnrolledIndex);
+                            if (!getConstantLines(numQubitsOfUnrolledIndex, 0U)) {
+                                return false;
+                            }
+                            addQuantumOperations(numSetBitsOfSummand, 0);
+                            if (!assignAdd(numQubitsOfUnrolledIndex, numQubitsOfUnrolledIndex)) {
+                                return false;
+                            }
+                            addQuantumOperations(numSetBitsOfSummand, 0);
+                        }
+                        continue;
+                    }
+
+                    compileTimeValueOfUnrolledIndex.reset();
+                    const std::size_t                 numQubitsOfIndexOfDimension = determineNumberOfBitsRequiredToStoreValue(accessedVariable.dimensions[i] - 1U);
+                    const RecordedQuantumOperations   priorToSynthesisOfExpr      = recordedQuantumOperations;
+                    std::size_t                       numQubitsOfExpr             = 0;
+                    if (!onExpression(evaluatedVariableAccess.userDefinedDimensionAccess->at(i), static_cast<unsigned>(numQubitsOfIndexOfDimension), numQubitsOfExpr, BinaryExpression::BinaryOperation::Add) || numQubitsOfExpr > numQubitsOfIndexOfDimension) {
+                        getErrorStream() << "Failed to estimate index expression for dimension " << std::to_string(i) << " of dimension access for variable access on variable " << accessedVariable.name << "\n";
+                        return false;
+                    }
+                    const RecordedQuantumOperations afterSynthesisOfExpr = recordedQuantumOperations;
+                    if (numQubitsOfExpr < numQubitsOfUnrolledIndex && !getConstantLines(numQubitsOfUnrolledIndex - numQubitsOfExpr, 0U)) {
+                        return false;
+                    }
+
+                    std::optional<RecordedQuantumOperations> priorToSynthesisOfSummand;
+                    if (offsetToNextElement != 1U) {
+                        priorToSynthesisOfSummand = recordedQuantumOperations;
+                        if (std::has_single_bit(offsetToNextElement)) {
+                            if (!getConstantLines(numQubitsOfUnrolledIndex, 0U) || !shift(numQubitsOfUnrolledIndex, numQubitsOfUnrolledIndex, static_cast<unsigned>(std::countr_zero(offsetToNextElement)))) {
+                                return false;
+                            }
+                        } else if (!getConstantLines(numQubitsOfUnrolledIndex, 0U) || !getConstantLines(numQubitsOfUnrolledIndex, 0U)) {
+                            return false;
+                        } else {
+                            addQuantumOperations(determineNumberOfSetBitsInValue(offsetToNextElement, numQubitsOfUnrolledIndex), 0);
+                            if (!multiplication(numQubitsOfUnrolledIndex, numQubitsOfUnrolledIndex, numQubitsOfUnrolledIndex)) {
+                                return false;
+                            }
+                        }
+                    }
+                    const RecordedQuantumOperations afterSynthesisOfSummand = recordedQuantumOperations;
+                    if (!assignAdd(numQubitsOfUnrolledIndex, numQubitsOfUnrolledIndex)) {
+                        return false;
+                    }
+
+                    // The quantum operations computing the summand and the index expression are replayed to reset the ancillary qubits used by the latter.
+                    if (priorToSynthesisOfSummand.has_value() && priorToSynthesisOfSummand->numQuantumOperations > 0) {
+                        replayQuantumOperationsRecordedBetween(*priorToSynthesisOfSummand, afterSynthesisOfSummand);
+                    }
+                    if (priorToSynthesisOfExpr.numQuantumOperations > 0 && priorToSynthesisOfExpr.numQuantumOperations != afterSynthesisOfExpr.numQuantumOperations) {
+                        replayQuantumOperationsRecordedBetween(priorToSynthesisOfExpr, afterSynthesisOfExpr);
+                    }
+                }
+                return true;
+            }
+
+            // See SyrecSynthesis::transferQubitsOfElementAtIndexInVariableToOtherQubits(...), the index of every element of the variable is compared to the unrolled index to conditionally swap or copy the qubits of the element.
+            [[nodiscard]] bool transferQubitsOfElementAtIndexInVariableToOtherQubits(const EvaluatedVariableAccess& evaluatedVariableAccess, const std::size_t numQubitsStoringResultOfTransfer, const bool swapQubits) {
+                if (numQubitsStoringResultOfTransfer != evaluatedVariableAccess.numAccessedBits) {
+                    return false;
+                }
+
+                const unsigned    numElementsInVariable    = determineNumberOfElementsInVariable(*evaluatedVariableAccess.accessedVariable);
+                const std::size_t numQubitsOfUnrolledIndex = determineNumberOfBitsRequiredToStoreValue(numElementsInVariable - 1U);
+                if (!getConstantLines(numQubitsOfUnrolledIndex, 0U)) {
+                    return false;
+                }
+
+                for (unsigned i = 0; i < numElementsInVariable; ++i) {
+                    addQuantumOperations(numQubitsOfUnrolledIndex, 1);
+                    addQuantumOperations(numQubitsOfUnrolledIndex, 0);
+                    numPropagatedControlQubits += numQubitsOfUnrolledIndex;
+                    addQuantumOperations(numQubitsStoringResultOfTransfer, swapQubits ? 0 : 1, swapQubits);
+                    numPropagatedControlQubits -= numQubitsOfUnrolledIndex;
+                    addQuantumOperations(numQubitsOfUnrolledIndex, 0);
+                    addQuantumOperations(numQubitsOfUnrolledIndex, 1);
+                    for (std::size_t j = 0; j < numQubitsOfUnrolledIndex; ++j) {
+                        addQuantumOperations(1, j);
+                    }
+                }
+                addQuantumOperations(determineNumberOfSetBitsInValue(numElementsInVariable, numQubitsOfUnrolledIndex), 0);
+                return true;
+            }
+
+            //**********************************************************************
+            //*****                  Synthesizer primitives                    *****
+            //**********************************************************************
+
+            [[nodiscard]] bool getConstantLines(const std::size_t bitwidth, const unsigned value) {
+                if (bitwidth == 0 || bitwidth > 32U) {
+                    return false;
+                }
+                // The ancillary qubits are initialized to the given value by X gates.
+                numQubits += bitwidth;
+                addQuantumOperations(determineNumberOfSetBitsInValue(value, bitwidth), 0);
+                return true;
+            }
+
+            [[nodiscard]] bool inplaceAdd(const std::size_t lhs, const std::size_t rhs, const bool isCarryOutComputed = false) {
+                if (lhs != rhs) {
+                    return false;
+                }
+                numQubits += determineNumberOfAncillaryQubitsRequiredByAdder(settings.adderArchitecture, rhs, isCarryOutComputed);
+
+                const NumberOfQuantumOperationsOfAdder numQuantumOperationsOfAdder = determineNumberOfQuantumOperationsOfAdder(settings.adderArchitecture, rhs, isCarryOutComputed);
+                addQuantumOperations(numQuantumOperationsOfAdder.numNotGates, 0);
+                addQuantumOperations(numQuantumOperationsOfAdder.numCnotGates, 1);
+                addQuantumOperations(numQuantumOperationsOfAdder.numToffoliGates, 2);
+                return true;
+            }
+
+            [[nodiscard]] bool inplaceSubtract(const std::size_t lhs, const std::size_t rhs) {
+                addQuantumOperations(rhs, 0);
+                if (!inplaceAdd(lhs, rhs)) {
+                    return false;
+                }
+                addQuantumOperations(rhs, 0);
+                return true;
+            }
+
+            // See LineAwareSynthesis::decreaseNewAssign(...).
+            [[nodiscard]] bool decreaseNewAssign(const std::size_t lhs, const std::size_t rhs) {
+                if (lhs != rhs) {
+                    return false;
+                }
+                addQuantumOperations(lhs, 0);
+                const bool additionOk = inplaceAdd(lhs, rhs);
+                addQuantumOperations(2 * lhs, 0);
+                return additionOk;
+            }
+
+            // The carry out of the subtraction src - dest is stored in a qubit created by the caller.
+            [[nodiscard]] bool decreaseWithCarry(const std::size_t dest, const std::size_t src) {
+                if (dest < src) {
+                    return false;
+                }
+                addQuantumOperations(src, 0);
+                if (!inplaceAdd(src, dest, true)) {
+                    return false;
+                }
+                addQuantumOperations(src, 0);
+                return true;
+            }
+
+            [[nodiscard]] bool bitwiseCnot(const std::size_t dest, const std::size_t src) {
+                if (dest < src) {
+                    return false;
+                }
+                addQuantumOperations(src, 1);
+                return true;
+            }
+
+            [[nodiscard]] bool swap(const std::size_t dest1, const std::size_t dest2) {
+                if (dest2 < dest1) {
+                    return false;
+                }
+                addQuantumOperations(dest1, 0, true);
+                return true;
+            }
+
+            [[nodiscard]] bool shift(const std::size_t dest, const std::size_t toBeShiftedQubits, const unsigned qubitIndexShiftAmount) {
+                if (qubitIndexShiftAmount >= dest) {
+                    return true;
+                }
+                const std::size_t numQubitsShifted = dest - qubitIndexShiftAmount;
+                if (toBeShiftedQubits < numQubitsShifted) {
+                    return false;
+                }
+                addQuantumOperations(numQubitsShifted, 1);
+                return true;
+            }
+
+            // See SyrecSynthesis::multiplication(...).
+            [[nodiscard]] bool multiplication(const std::size_t dest, const std::size_t src1, const std::size_t src2) {
+                if (src1 == 0 || dest == 0) {
+                    return true;
+                }
+                if (src1 < dest || src2 < dest) {
+                    return false;
+                }
+
+                if (settings.multiplierArchitecture == MultiplierArchitecture::PartialProducts) {
+                    addQuantumOperations(dest, 2);
+                    numQubits += dest - 1U;
+                    for (std::size_t i = 1; i < dest; ++i) {
+                        addQuantumOperations(dest - i, 2);
+                        if (!inplaceAdd(dest - i, dest - i)) {
+                            return false;
+                        }
+                        addQuantumOperations(dest - i, 2);
+                    }
+                    return true;
+                }
+
+                // Every partial product is added to the product by an addition controlled by the corresponding qubit of the first operand.
+                ++numPropagatedControlQubits;
+                bool estimationOk = bitwiseCnot(dest, src2);
+                for (std::size_t i = 1; i < dest && estimationOk; ++i) {
+                    estimationOk = inplaceAdd(dest - i, dest - i);
+                }
+                --numPropagatedControlQubits;
+                return estimationOk;
+            }
+
+            // See SyrecSynthesis::division(...).
+            [[nodiscard]] bool division(const std::size_t dividend, const std::size_t divisor, const std::size_t quotient, const std::size_t remainder) {
+                const std::size_t operandBitwidth = dividend;
+                if (divisor != operandBitwidth || quotient != operandBitwidth || remainder != operandBitwidth) {
+                    return false;
+                }
+
+                addQuantumOperations(operandBitwidth, 1);
+                const bool isNonRestoringDivision = settings.dividerArchitecture == DividerArchitecture::NonRestoring;
+                for (std::size_t i = 1; i <= operandBitwidth; ++i) {
+                    if (isNonRestoringDivision) {
+                        // The partial remainder is complemented prior to and after the addition, controlled by the previously computed quotient bit except for the first iteration.
+                        const std::size_t numControlQubitsOfComplement = i > 1 ? 1 : 0;
+                        addQuantumOperations(operandBitwidth + 1U, numControlQubitsOfComplement);
+                        if (!inplaceAdd(operandBitwidth, operandBitwidth, true)) {
+                            return false;
+                        }
+                        addQuantumOperations(operandBitwidth + 1U, numControlQubitsOfComplement);
+                    } else {
+                        if (!decreaseWithCarry(operandBitwidth, operandBitwidth)) {
+                            return false;
+                        }
+                        ++numPropagatedControlQubits;
+                        const bool restoreOk = inplaceAdd(operandBitwidth, operandBitwidth);
+                        --numPropagatedControlQubits;
+                        if (!restoreOk) {
+                            return false;
+                        }
+                    }
+                    addQuantumOperations(1, 0);
+                }
+
+                if (isNonRestoringDivision && operandBitwidth > 0) {
+                    addQuantumOperations(1, 0);
+                    ++numPropagatedControlQubits;
+                    const bool restoreOk = inplaceAdd(operandBitwidth, operandBitwidth);
+                    --numPropagatedControlQubits;
+                    if (!restoreOk) {
+                        return false;
+                    }
+                    addQuantumOperations(1, 0);
+                }
+                addQuantumOperations(operandBitwidth, 0, true);
+                return true;
+            }
+
+            // The inplace addition, subtraction or bitwise XOR storing the result in the rhs operand (see CostAwareSynthesis::assignAdd(...), assignSubtract(...) and assignExor(...)).
+            [[nodiscard]] bool applyInplaceOperation(const BinaryExpression::BinaryOperation binaryOperation, const std::size_t lhs, const std::size_t rhs) {
+                switch (binaryOperation) {
+                    case BinaryExpression::BinaryOperation::Add:
+                        return inplaceAdd(lhs, rhs);
+                    case BinaryExpression::BinaryOperation::Subtract:
+                        return inplaceSubtract(lhs, rhs);
+                    case BinaryExpression::BinaryOperation::Exor:
+                        return bitwiseCnot(rhs, lhs);
+                    default:
+                        return false;
+                }
+            }
+
+            // See LineAwareSynthesis::expAdd(...), expSubtract(...) and expExor(...).
+            [[nodiscard]] bool applyInplaceOperationLineAware(const BinaryExpression::BinaryOperation binaryOperation, const std::size_t lhs, const std::size_t rhs) {
+                return binaryOperation == BinaryExpression::BinaryOperation::Subtract ? decreaseNewAssign(lhs, rhs) : applyInplaceOperation(binaryOperation, lhs, rhs);
+            }
+
+            // See LineAwareSynthesis::expressionOpInverse(...).
+            [[nodiscard]] bool revertLineAwareSubexpression(const LineAwareSubexpression& subexpression) {
+                switch (subexpression.binaryOperation) {
+                    case BinaryExpression::BinaryOperation::Add:
+                        return inplaceSubtract(subexpression.lhsOperandBitwidth, subexpression.rhsOperandBitwidth);
+                    case BinaryExpression::BinaryOperation::Subtract:
+                        return decreaseNewAssign(subexpression.lhsOperandBitwidth, subexpression.rhsOperandBitwidth);
+                    case BinaryExpression::BinaryOperation::Exor:
+                        return bitwiseCnot(subexpression.rhsOperandBitwidth, subexpression.lhsOperandBitwidth);
+                    default:
+                        return true;
+                }
+            }
+
+            // See LineAwareSynthesis::assignAdd(...), assignSubtract(...) and assignExor(...) which merge the top-most recorded subexpression with a matching assignment operation and revert all remaining recorded subexpressions.
+            [[nodiscard]] bool applyAssignmentOperationLineAware(const BinaryExpression::BinaryOperation assignmentOperation, const std::size_t rhs, const std::size_t lhs) {
+                bool estimationOk = true;
+                if (!lineAwareSubexpressions.empty() && lineAwareSubexpressions.back().binaryOperation == assignmentOperation) {
+                    const LineAwareSubexpression mergedSubexpression = lineAwareSubexpressions.back();
+                    lineAwareSubexpressions.pop_back();
+                    switch (assignmentOperation) {
+                        case BinaryExpression::BinaryOperation::Add:
+                            estimationOk = inplaceAdd(mergedSubexpression.lhsOperandBitwidth, lhs) && inplaceAdd(mergedSubexpression.rhsOperandBitwidth, lhs);
+                            break;
+                        case BinaryExpression::BinaryOperation::Subtract:
+                            estimationOk = inplaceSubtract(mergedSubexpression.lhsOperandBitwidth, lhs) && inplaceAdd(mergedSubexpression.rhsOperandBitwidth, lhs);
+                            break;
+                        default:
+                            estimationOk = bitwiseCnot(lhs, mergedSubexpression.lhsOperandBitwidth) && bitwiseCnot(lhs, mergedSubexpression.rhsOperandBitwidth);
+                            break;
+                    }
+                } else {
+                    estimationOk = applyInplaceOperation(assignmentOperation, rhs, lhs);
+                }
+
+                while (!lineAwareSubexpressions.empty() && estimationOk) {
+                    const LineAwareSubexpression revertedSubexpression = lineAwareSubexpressions.back();
+                    lineAwareSubexpressions.pop_back();
+                    estimationOk = revertLineAwareSubexpression(revertedSubexpression);
+                }
+                return estimationOk;
+            }
+
+            // The addition of a summand to the unrolled index of a variable access (see SyrecSynthesis::assignAdd(...)).
+            [[nodiscard]] bool assignAdd(const std::size_t lhs, const std::size_t rhs) {
+                return isCostAwareSynthesisSelected ? inplaceAdd(rhs, lhs) : applyAssignmentOperationLineAware(BinaryExpression::BinaryOperation::Add, rhs, lhs);
+            }
+        };
+    } // namespace
+
+    bool estimateResourcesOfSynthesis(ResourceEstimate& estimate, const Program& program, const ConfigurableOptions& settings, const SynthesisAlgorithm synthesisAlgorithm) {
+        const Module::vec& programModules = program.modules();
+        if (programModules.empty()) {
+            getErrorStream() << "A SyReC program must consist of at least one module\n";
+            return false;
+        }
+
+        // The entry point of the program is determined like in SyrecSynthesis::synthesize(...).
+        const std::string& expectedMainModuleIdentifier = settings.optionalProgramEntryPointModuleIdentifier.has_value() ? *settings.optionalProgramEntryPointModuleIdentifier : (program.findModule("main") != nullptr ? std::string("main") : programModules.back()->name);
+        if (std::ranges::count_if(programModules, [&](const Module::ptr& programModule) { return programModule->name == expectedMainModuleIdentifier; }) != 1) {
+            getErrorStream() << "There must be exactly one module named '" << expectedMainModuleIdentifier << "' that shall be used as the entry point of the SyReC program\n";
+            return false;
+        }
+        const auto mainModule = std::ranges::find_if(programModules, [&](const Module::ptr& programModule) { return programModule->name == expectedMainModuleIdentifier; });
+
+        ResourceEstimator estimator(settings, synthesisAlgorithm);
+        if (!estimator.estimateModule(**mainModule)) {
+            return false;
+        }
+        estimate = estimator.getEstimate();
+        return true;
+    }
+} // namespace syrec
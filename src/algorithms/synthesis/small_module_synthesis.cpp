@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/small_module_synthesis.hpp"
+
+#include "algorithms/simulation/program_interpreter.hpp"
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "algorithms/synthesis/dd_synthesis.hpp"
+#include "algorithms/synthesis/esop_synthesis.hpp"
+#include "algorithms/synthesis/synthesis_result_cache.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "algorithms/synthesis/syrec_hybrid_synthesis.hpp"
+#include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/statistics.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/program_serialization.hpp"
+#include "core/syrec/variable.hpp"
+#include "core/truthTable/truth_table.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/OpType.hpp"
+#include "ir/operations/Operation.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    // The value of an element of a variable of the main module stored in the bits [offset, offset + bitwidth) of the inputs or outputs of the truth table, with the most significant bit being stored at the position offset.
+    struct ElementOfTruthTable {
+        std::size_t indexOfValueInAssignment;
+        std::size_t offset;
+        unsigned    bitwidth;
+    };
+
+    [[nodiscard]] std::uint64_t determineBitmask(const unsigned bitwidth) noexcept {
+        return bitwidth >= 64U ? ~static_cast<std::uint64_t>(0U) : (static_cast<std::uint64_t>(1U) << bitwidth) - 1U;
+    }
+
+    [[nodiscard]] bool synthesizeUsingAlgorithm(AnnotatableQuantumComputation& annotatableQuantumComputation, const Program& program, const SynthesisAlgorithm synthesisAlgorithm, const ConfigurableOptions& settings, Statistics* optionalRecordedStatistics) {
+        switch (synthesisAlgorithm) {
+            case SynthesisAlgorithm::CostAware:
+                return CostAwareSynthesis::synthesize(annotatableQuantumComputation, program, settings, optionalRecordedStatistics);
+            case SynthesisAlgorithm::LineAware:
+                return LineAwareSynthesis::synthesize(annotatableQuantumComputation, program, settings, optionalRecordedStatistics);
+            case SynthesisAlgorithm::Hybrid:
+                return HybridSynthesis::synthesize(annotatableQuantumComputation, program, settings, optionalRecordedStatistics);
+        }
+        return false;
+    }
+
+    // The quantum cost of a quantum computation consisting only of (multi-)controlled X and SWAP gates, std::nullopt if it contains any other gate.
+    [[nodiscard]] std::optional<AnnotatableQuantumComputation::SynthesisCostMetricValue> determineQuantumCost(const qc::QuantumComputation& quantumComputation) {
+        AnnotatableQuantumComputation::SynthesisCostMetricValue quantumCost = 0;
+        const auto                                              accumulateQuantumCostOfGate = [&](const qc::Operation& gate) {
+            const bool isSwapGate = gate.getType() == qc::OpType::SWAP;
+            if (gate.getType() != qc::OpType::X && !isSwapGate) {
+                return false;
+            }
+            quantumCost += AnnotatableQuantumComputation::getQuantumCostForSynthesisOfGate(gate.getControls().size(), isSwapGate, quantumComputation.getNqubits());
+            return true;
+        };
+        for (const auto& quantumOperation: quantumComputation) {
+            if (quantumOperation == nullptr || !AnnotatableQuantumComputation::forEachGateOfQuantumOperation(*quantumOperation, accumulateQuantumCostOfGate)) {
+                return std::nullopt;
+            }
+        }
+        return quantumCost;
+    }
+
+    [[nodiscard]] std::shared_ptr<qc::QuantumComputation> synthesizeTruthTable(const TruthTable& tt, const TruthTableSynthesisEngine truthTableSynthesisEngine) {
+        switch (truthTableSynthesisEngine) {
+            case TruthTableSynthesisEngine::OnePassDD:
+                return DDSynthesizer::synthesizeOnePass(tt);
+            case TruthTableSynthesisEngine::Esop:
+                return EsopSynthesizer::synthesize(tt);
+        }
+        return nullptr;
+    }
+} // namespace
+
+bool syrec::buildTruthTableOfMainModule(TruthTable& tt, const Program& program, const ConfigurableOptions& settings, const std::size_t maxNumInputBits) {
+    tt.clear();
+    const std::optional<ProgramInterpreter> interpreter = ProgramInterpreter::create(program, settings);
+    if (!interpreter.has_value() || interpreter->getMainModule() == nullptr) {
+        return false;
+    }
+
+    std::vector<ElementOfTruthTable> inputElements;
+    std::vector<ElementOfTruthTable> outputElements;
+    std::size_t                      numInputBits  = 0;
+    std::size_t                      numOutputBits = 0;
+    const auto                       recordElementsOfVariables = [&](const Variable::vec& variables) {
+        for (const Variable::ptr& variable: variables) {
+            const std::optional<std::size_t> indexOfFirstValue = variable != nullptr ? interpreter->getIndexOfFirstValueOfVariable(variable->name) : std::nullopt;
+            if (!indexOfFirstValue.has_value()) {
+                return false;
+            }
+
+            const bool        isInput     = variable->type == Variable::Type::In || variable->type == Variable::Type::Inout;
+            const bool        isOutput    = variable->type == Variable::Type::Out || variable->type == Variable::Type::Inout || variable->type == Variable::Type::State;
+            const std::size_t numElements = std::accumulate(variable->dimensions.cbegin(), variable->dimensions.cend(), static_cast<std::size_t>(1), std::multiplies<>());
+            for (std::size_t i = 0; i < numElements; ++i) {
+                if (isInput) {
+                    inputElements.emplace_back(ElementOfTruthTable{.indexOfValueInAssignment = *indexOfFirstValue + i, .offset = numInputBits, .bitwidth = variable->bitwidth});
+                    numInputBits += variable->bitwidth;
+                }
+                if (isOutput) {
+                    outputElements.emplace_back(ElementOfTruthTable{.indexOfValueInAssignment = *indexOfFirstValue + i, .offset = numOutputBits, .bitwidth = variable->bitwidth});
+                    numOutputBits += variable->bitwidth;
+                }
+            }
+        }
+        return true;
+    };
+    const auto& mainModule = *interpreter->getMainModule();
+    if (!recordElementsOfVariables(mainModule.parameters) || !recordElementsOfVariables(mainModule.variables)) {
+        return false;
+    }
+    // The inputs are enumerated using a 64-bit integer
+    if (numInputBits == 0 || numInputBits > maxNumInputBits || numInputBits >= 64U || numOutputBits == 0) {
+        return false;
+    }
+
+    const std::uint64_t                     numAssignments = static_cast<std::uint64_t>(1U) << numInputBits;
+    std::vector<std::vector<std::uint64_t>> assignments(numAssignments, std::vector<std::uint64_t>(interpreter->getNumValuesOfAssignment(), 0U));
+    for (std::uint64_t input = 0; input < numAssignments; ++input) {
+        for (const auto& [indexOfValueInAssignment, offset, bitwidth]: inputElements) {
+            assignments[input][indexOfValueInAssignment] = (input >> (numInputBits - offset - bitwidth)) & determineBitmask(bitwidth);
+        }
+    }
+    if (!interpretProgram(assignments, program, settings)) {
+        return false;
+    }
+
+    for (std::uint64_t input = 0; input < numAssignments; ++input) {
+        TruthTable::Cube output(numOutputBits, false);
+        for (const auto& [indexOfValueInAssignment, offset, bitwidth]: outputElements) {
+            const std::uint64_t value = assignments[input][indexOfValueInAssignment];
+            for (unsigned j = 0; j < bitwidth; ++j) {
+                output.set(offset + j, ((value >> (bitwidth - 1U - j)) & 1U) == 1U);
+            }
+        }
+        tt.try_emplace(TruthTable::Cube::fromInteger(input, numInputBits), std::move(output));
+    }
+    return true;
+}
+
+std::optional<SmallModuleSynthesisResult> SmallModuleSynthesizer::synthesize(const Program& program, const SynthesisAlgorithm synthesisAlgorithm, const ConfigurableOptions& settings, Statistics* optionalRecordedStatistics) {
+    std::optional<std::string> signature = serializeProgram(program);
+    if (signature.has_value()) {
+        signature->append(SynthesisResultCache::serializeSynthesisRelevantSettings(synthesisAlgorithm, settings));
+    }
+
+    std::optional<SmallModuleSynthesisResult::Origin> cachedOrigin;
+    if (const auto cachedSelection = signature.has_value() ? originPerSignature.find(*signature) : originPerSignature.end(); cachedSelection != originPerSignature.end()) {
+        cachedOrigin = cachedSelection->second;
+        ++numCacheHits;
+    }
+
+    SmallModuleSynthesisResult statementWiseResult;
+    if (!cachedOrigin.has_value() || *cachedOrigin == SmallModuleSynthesisResult::Origin::StatementWise) {
+        auto annotatableQuantumComputation = std::make_shared<AnnotatableQuantumComputation>(settings.generateQuantumOperationAnnotations);
+        if (synthesizeUsingAlgorithm(*annotatableQuantumComputation, program, synthesisAlgorithm, settings, optionalRecordedStatistics)) {
+            statementWiseResult.quantumCostOfStatementWiseSynthesis = annotatableQuantumComputation->getQuantumCostForSynthesis();
+            statementWiseResult.quantumComputation                  = std::move(annotatableQuantumComputation);
+        }
+    }
+
+    SmallModuleSynthesisResult truthTableResult;
+    truthTableResult.origin = SmallModuleSynthesisResult::Origin::TruthTable;
+    if (TruthTable tt; (!cachedOrigin.has_value() || *cachedOrigin == SmallModuleSynthesisResult::Origin::TruthTable) && buildTruthTableOfMainModule(tt, program, settings, smallModuleSynthesisSettings.maxNumInputBits)) {
+        if (std::shared_ptr<qc::QuantumComputation> quantumComputation = synthesizeTruthTable(tt, smallModuleSynthesisSettings.truthTableSynthesisEngine); quantumComputation != nullptr) {
+            truthTableResult.quantumCostOfTruthTableSynthesis = determineQuantumCost(*quantumComputation);
+            if (truthTableResult.quantumCostOfTruthTableSynthesis.has_value()) {
+                truthTableResult.quantumComputation = std::move(quantumComputation);
+            }
+        }
+    }
+
+    if (statementWiseResult.quantumComputation == nullptr && truthTableResult.quantumComputation == nullptr) {
+        return std::nullopt;
+    }
+
+    const auto quantumCostOfStatementWiseSynthesis = statementWiseResult.quantumCostOfStatementWiseSynthesis;
+    const auto quantumCostOfTruthTableSynthesis    = truthTableResult.quantumCostOfTruthTableSynthesis;
+    const bool isStatementWiseSynthesisOk          = statementWiseResult.quantumComputation != nullptr;
+    const bool isTruthTableSynthesisSelected       = !isStatementWiseSynthesisOk || (truthTableResult.quantumComputation != nullptr && (*quantumCostOfTruthTableSynthesis < *quantumCostOfStatementWiseSynthesis || (*quantumCostOfTruthTableSynthesis == *quantumCostOfStatementWiseSynthesis && truthTableResult.quantumComputation->getNqubits() < statementWiseResult.quantumComputation->getNqubits())));
+
+    SmallModuleSynthesisResult selectedResult          = isTruthTableSynthesisSelected ? std::move(truthTableResult) : std::move(statementWiseResult);
+    selectedResult.quantumCostOfStatementWiseSynthesis = quantumCostOfStatementWiseSynthesis;
+    selectedResult.quantumCostOfTruthTableSynthesis    = quantumCostOfTruthTableSynthesis;
+
+    // The truth table of a program only depends on its signature while the statement-wise synthesis could also fail due to the execution limits of the settings, thus the selection is only cached if the latter succeeded
+    if (signature.has_value() && !cachedOrigin.has_value() && isStatementWiseSynthesisOk) {
+        originPerSignature.emplace(std::move(*signature), selectedResult.origin);
+    }
+    return selectedResult;
+}
@@ -0,0 +1,416 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/synthesis_result_cache.hpp"
+
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "algorithms/synthesis/syrec_hybrid_synthesis.hpp"
+#include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/statistics.hpp"
+#include "core/syrec/parser/utils/memory_mapped_file.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/program_serialization.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <iomanip>
+#include <memory>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+using namespace syrec;
+
+namespace {
+    constexpr std::uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+    constexpr std::uint64_t FNV_PRIME        = 1099511628211ULL;
+
+    // The version needs to be incremented whenever the format of the on-disk cache entries changes (changes of the format of the serialized program and quantum computation are detected by the latter).
+    constexpr std::string_view ON_DISK_CACHE_ENTRY_MAGIC     = "SYRECSC";
+    constexpr std::uint8_t     ON_DISK_CACHE_ENTRY_VERSION   = 1U;
+    constexpr std::string_view ON_DISK_CACHE_ENTRY_EXTENSION = ".syrecqc";
+
+    // 64-bit FNV-1a hash which, contrary to std::hash, is identical in all processes and thus usable to identify the entries of the on-disk cache.
+    [[nodiscard]] std::uint64_t determineStableHash(const std::string_view bytes) noexcept {
+        std::uint64_t hash = FNV_OFFSET_BASIS;
+        for (const char byte: bytes) {
+            hash = (hash ^ static_cast<unsigned char>(byte)) * FNV_PRIME;
+        }
+        return hash;
+    }
+
+    void appendInteger(std::string& buffer, const std::uint64_t value) {
+        for (std::size_t i = 0; i < sizeof(value); ++i) {
+            buffer.push_back(static_cast<char>(value >> (8U * i) & 0xFFU));
+        }
+    }
+
+    void appendString(std::string& buffer, const std::string_view value) {
+        appendInteger(buffer, value.size());
+        buffer.append(value);
+    }
+
+    void appendOptionalInteger(std::string& buffer, const std::optional<std::uint64_t>& value) {
+        appendInteger(buffer, static_cast<std::uint64_t>(value.has_value()));
+        appendInteger(buffer, value.value_or(0U));
+    }
+
+    // Any read beyond the end of the buffer marks the buffer as invalid with all further reads returning default values.
+    class BufferReader {
+    public:
+        explicit BufferReader(const std::string_view buffer):
+            buffer(buffer) {}
+
+        [[nodiscard]] bool readMagic(const std::string_view magic) {
+            isValid = isValid && buffer.substr(position, magic.size()) == magic;
+            position += isValid ? magic.size() : 0U;
+            return isValid;
+        }
+
+        [[nodiscard]] std::uint64_t readInteger() {
+            isValid = isValid && sizeof(std::uint64_t) <= buffer.size() - position;
+            if (!isValid) {
+                return 0U;
+            }
+            std::uint64_t value = 0;
+            for (std::size_t i = 0; i < sizeof(value); ++i) {
+                value |= static_cast<std::uint64_t>(static_cast<unsigned char>(buffer[position++])) << (8U * i);
+            }
+            return value;
+        }
+
+        [[nodiscard]] std::string readString() {
+            const std::uint64_t size = readInteger();
+            isValid                  = isValid && size <= buffer.size() - position;
+            if (!isValid) {
+                return {};
+            }
+            std::string value(buffer.substr(position, static_cast<std::size_t>(size)));
+            position += static_cast<std::size_t>(size);
+            return value;
+        }
+
+        [[nodiscard]] bool isValidSoFar() const noexcept {
+            return isValid;
+        }
+
+        [[nodiscard]] bool isFullyReadAndValid() const noexcept {
+            return isValid && position == buffer.size();
+        }
+
+    private:
+        std::string_view buffer;
+        std::size_t      position = 0;
+        bool             isValid  = true;
+    };
+
+    // The statistics recorded by the synthesis that only depend on the synthesized quantum computation (i.e. all but the runtimes and the peak resident set size) and are thus restored for cached results.
+    template<typename StatisticsType, typename Callback>
+    void forEachCachedStatistic(StatisticsType& statistics, Callback&& callback) {
+        callback(statistics.numReusedAncillaryQubits);
+        callback(statistics.numUncomputedExpressions);
+        callback(statistics.numQuantumOperationsOfUncomputedExpressions);
+        callback(statistics.numCancelledQuantumOperations);
+        callback(statistics.numQubits);
+        callback(statistics.numAncillaryQubits);
+        callback(statistics.numQuantumOperations);
+        callback(statistics.depth);
+        callback(statistics.numExpandedModuleCalls);
+        callback(statistics.numReusedModuleCalls);
+        callback(statistics.numUnrolledLoopIterations);
+        callback(statistics.numReplayedLoopIterations);
+        callback(statistics.numAssignmentsSynthesizedCostAware);
+        callback(statistics.numAssignmentsSynthesizedLineAware);
+        callback(statistics.estimatedNumQuantumOperationsSavedByHybridSynthesis);
+        callback(statistics.estimatedNumAncillaryQubitsSavedByHybridSynthesis);
+    }
+
+    void restoreCachedStatistics(Statistics& statistics, const Statistics& cachedStatistics) {
+        statistics.numReusedAncillaryQubits                            = cachedStatistics.numReusedAncillaryQubits;
+        statistics.numUncomputedExpressions                            = cachedStatistics.numUncomputedExpressions;
+        statistics.numQuantumOperationsOfUncomputedExpressions         = cachedStatistics.numQuantumOperationsOfUncomputedExpressions;
+        statistics.numCancelledQuantumOperations                       = cachedStatistics.numCancelledQuantumOperations;
+        statistics.numQubits                                           = cachedStatistics.numQubits;
+        statistics.numAncillaryQubits                                  = cachedStatistics.numAncillaryQubits;
+        statistics.numQuantumOperations                                = cachedStatistics.numQuantumOperations;
+        statistics.numQuantumOperationsPerGateType                     = cachedStatistics.numQuantumOperationsPerGateType;
+        statistics.depth                                               = cachedStatistics.depth;
+        statistics.numExpandedModuleCalls                              = cachedStatistics.numExpandedModuleCalls;
+        statistics.numReusedModuleCalls                                = cachedStatistics.numReusedModuleCalls;
+        statistics.numUnrolledLoopIterations                           = cachedStatistics.numUnrolledLoopIterations;
+        statistics.numReplayedLoopIterations                           = cachedStatistics.numReplayedLoopIterations;
+        statistics.numAssignmentsSynthesizedCostAware                  = cachedStatistics.numAssignmentsSynthesizedCostAware;
+        statistics.numAssignmentsSynthesizedLineAware                  = cachedStatistics.numAssignmentsSynthesizedLineAware;
+        statistics.estimatedNumQuantumOperationsSavedByHybridSynthesis = cachedStatistics.estimatedNumQuantumOperationsSavedByHybridSynthesis;
+        statistics.estimatedNumAncillaryQubitsSavedByHybridSynthesis   = cachedStatistics.estimatedNumAncillaryQubitsSavedByHybridSynthesis;
+    }
+
+    [[nodiscard]] bool synthesizeUsingAlgorithm(AnnotatableQuantumComputation& annotatableQuantumComputation, const Program& program, const SynthesisAlgorithm synthesisAlgorithm, const ConfigurableOptions& settings, Statistics* optionalRecordedStatistics) {
+        switch (synthesisAlgorithm) {
+            case SynthesisAlgorithm::CostAware:
+                return CostAwareSynthesis::synthesize(annotatableQuantumComputation, program, settings, optionalRecordedStatistics);
+            case SynthesisAlgorithm::LineAware:
+                return LineAwareSynthesis::synthesize(annotatableQuantumComputation, program, settings, optionalRecordedStatistics);
+            case SynthesisAlgorithm::Hybrid:
+                return HybridSynthesis::synthesize(annotatableQuantumComputation, program, settings, optionalRecordedStatistics);
+        }
+        return false;
+    }
+
+    [[nodiscard]] std::filesystem::path getPathOfOnDiskCacheEntry(const std::string& onDiskCacheDirectory, const std::uint64_t hash) {
+        std::ostringstream filename;
+        filename << std::hex << std::setw(16) << std::setfill('0') << hash << ON_DISK_CACHE_ENTRY_EXTENSION;
+        return std::filesystem::path(onDiskCacheDirectory) / filename.str();
+    }
+} // namespace
+
+SynthesisResultCache::SynthesisResultCache(const std::size_t maxNumCachedResults, std::optional<std::string> optionalOnDiskCacheDirectory):
+    maxNumCachedResults(maxNumCachedResults), optionalOnDiskCacheDirectory(std::move(optionalOnDiskCacheDirectory)) {
+    if (this->optionalOnDiskCacheDirectory.has_value()) {
+        std::error_code errorCode;
+        std::filesystem::create_directories(*this->optionalOnDiskCacheDirectory, errorCode);
+    }
+}
+
+std::unique_ptr<AnnotatableQuantumComputation> SynthesisResultCache::synthesize(const Program& program, const SynthesisAlgorithm synthesisAlgorithm, const ConfigurableOptions& settings, Statistics* optionalRecordedStatistics) {
+    const auto lookupStartTime = std::chrono::steady_clock::now();
+
+    std::optional<CacheKey> key = settings.optionalSynthesisTraceFilePath.has_value() ? std::nullopt : buildCacheKey(program, synthesisAlgorithm, settings);
+    if (const CacheEntry* cacheEntry = key.has_value() ? findCacheEntry(*key) : nullptr; cacheEntry != nullptr) {
+        if (std::unique_ptr<AnnotatableQuantumComputation> cachedQuantumComputation = AnnotatableQuantumComputation::deserialize(cacheEntry->serializedQuantumComputation); cachedQuantumComputation != nullptr) {
+            ++numCacheHits;
+            if (optionalRecordedStatistics != nullptr) {
+                restoreCachedStatistics(*optionalRecordedStatistics, cacheEntry->recordedStatistics);
+                optionalRecordedStatistics->recordRuntime(std::chrono::steady_clock::now() - lookupStartTime);
+                optionalRecordedStatistics->synthesisRuntimeInNanoseconds    = 0;
+                optionalRecordedStatistics->optimizationRuntimeInNanoseconds = 0;
+                optionalRecordedStatistics->recordPeakResidentSetSize();
+                recordCacheStatistics(optionalRecordedStatistics);
+            }
+            return cachedQuantumComputation;
+        }
+        // A corrupted cache entry loaded from the on-disk cache is replaced by the result of the synthesis.
+    }
+
+    ++numCacheMisses;
+    // The statistics stored in the cache entry are recorded even if the caller is not interested in them, the statistics not recorded by the synthesis (i.e. the runtimes of the parser) are kept.
+    Statistics recordedStatistics = optionalRecordedStatistics != nullptr ? *optionalRecordedStatistics : Statistics{};
+    auto       synthesizedQuantumComputation = std::make_unique<AnnotatableQuantumComputation>(settings.generateQuantumOperationAnnotations);
+    if (!synthesizeUsingAlgorithm(*synthesizedQuantumComputation, program, synthesisAlgorithm, settings, &recordedStatistics)) {
+        if (optionalRecordedStatistics != nullptr) {
+            *optionalRecordedStatistics = recordedStatistics;
+            recordCacheStatistics(optionalRecordedStatistics);
+        }
+        return nullptr;
+    }
+
+    if (std::optional<std::string> serializedQuantumComputation = key.has_value() ? synthesizedQuantumComputation->serialize() : std::nullopt; serializedQuantumComputation.has_value()) {
+        CacheEntry cacheEntry{.key = std::move(*key), .recordedStatistics = recordedStatistics, .serializedQuantumComputation = std::move(*serializedQuantumComputation)};
+        storeCacheEntryOnDisk(cacheEntry);
+        insertCacheEntry(std::move(cacheEntry));
+    }
+
+    if (optionalRecordedStatistics != nullptr) {
+        *optionalRecordedStatistics = std::move(recordedStatistics);
+        recordCacheStatistics(optionalRecordedStatistics);
+    }
+    return synthesizedQuantumComputation;
+}
+
+void SynthesisResultCache::clear() {
+    cacheEntryLookup.clear();
+    cacheEntries.clear();
+}
+
+std::optional<SynthesisResultCache::CacheKey> SynthesisResultCache::buildCacheKey(const Program& program, const SynthesisAlgorithm synthesisAlgorithm, const ConfigurableOptions& settings) {
+    // Programs referencing IR nodes not serializable by syrec::serializeProgram(...) are not cached
+    const std::optional<std::string> serializedProgram = serializeProgram(program);
+    if (!serializedProgram.has_value()) {
+        return std::nullopt;
+    }
+
+    std::string serializedKey;
+    appendString(serializedKey, *serializedProgram);
+    serializedKey.append(serializeSynthesisRelevantSettings(synthesisAlgorithm, settings));
+
+    const std::uint64_t hash = determineStableHash(serializedKey);
+    return CacheKey{.hash = hash, .serializedKey = std::move(serializedKey)};
+}
+
+std::string SynthesisResultCache::serializeSynthesisRelevantSettings(const SynthesisAlgorithm synthesisAlgorithm, const ConfigurableOptions& settings) {
+    std::string serializedSettings;
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(synthesisAlgorithm));
+    appendInteger(serializedSettings, settings.defaultBitwidth);
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.integerConstantTruncationOperation));
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.allowAccessOnAssignedToVariablePartsInDimensionAccessOfVariableAccess));
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.generatedInlinedQubitDebugInformation));
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.generateQuantumOperationAnnotations));
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.reuseSynthesizedModuleCalls));
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.replaySynthesizedLoopIterations));
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.shareSynthesizedCommonSubexpressions));
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.reuseAncillaryQubitsAcrossStatements));
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.ancillaryQubitUncomputationStrategy));
+    appendInteger(serializedSettings, settings.maxNumDeferredExpressionUncomputations);
+    appendOptionalInteger(serializedSettings, settings.qubitBudgetOfHybridSynthesis);
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.adderArchitecture));
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.multiplierArchitecture));
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.dividerArchitecture));
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.shareDividerOfQuotientAndRemainder));
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.shareComparatorOfRelationalOperations));
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.addConstantsWithoutAncillaryQubits));
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.specializeOperationsWithConstantOperand));
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.synthesizeShiftsByRelabelingQubits));
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.trackUnconditionalSwapsAsQubitPermutation));
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.foldNegationsIntoNegativeControls));
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.narrowOperationsUsingValueRangeAnalysis));
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.decodeNonConstantIndicesUsingUnaryIteration));
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.shareIndexDecodingOfNonConstantIndices));
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.padDimensionsOfUnrolledIndicesToPowersOfTwo));
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.reuseQubitOfGuardVariableNotAccessedInBranches));
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.combineGuardsOfNestedIfStatements));
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.liftControlQubitsOfModuleCalls));
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.propagateConstantQubitValues));
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.applyReversibleCircuitTemplates));
+    appendInteger(serializedSettings, settings.windowSizeOfReversibleCircuitTemplates);
+    appendOptionalInteger(serializedSettings, settings.timeBudgetOfReversibleCircuitTemplatesInMilliseconds);
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.cancelAdjacentSelfInverseQuantumOperations));
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.reorderQuantumOperationsToReduceDepth));
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.recycleAncillaryQubitsWithNonOverlappingLiveRanges));
+    appendInteger(serializedSettings, settings.optimizationPipeline.size());
+    for (const std::string& identifierOfOptimizationPass: settings.optimizationPipeline) {
+        appendString(serializedSettings, identifierOfOptimizationPass);
+    }
+    appendInteger(serializedSettings, settings.maxNumIterationsOfOptimizationPipeline);
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.verifyPassesOfOptimizationPipeline));
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.emitModuleCallsAsCompoundOperations));
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.synthesizeIndependentStatementsConcurrently));
+    appendInteger(serializedSettings, static_cast<std::uint64_t>(settings.optionalProgramEntryPointModuleIdentifier.has_value()));
+    appendString(serializedSettings, settings.optionalProgramEntryPointModuleIdentifier.value_or(""));
+    return serializedSettings;
+}
+
+const SynthesisResultCache::CacheEntry* SynthesisResultCache::findCacheEntry(const CacheKey& key) {
+    if (const auto cacheEntryLookupResult = cacheEntryLookup.find(key.hash); cacheEntryLookupResult != cacheEntryLookup.end() && cacheEntryLookupResult->second->key == key) {
+        cacheEntries.splice(cacheEntries.begin(), cacheEntries, cacheEntryLookupResult->second);
+        return &cacheEntries.front();
+    }
+
+    if (std::optional<CacheEntry> cacheEntryLoadedFromDisk = tryLoadCacheEntryFromDisk(key); cacheEntryLoadedFromDisk.has_value()) {
+        insertCacheEntry(std::move(*cacheEntryLoadedFromDisk));
+        if (!cacheEntries.empty() && cacheEntries.front().key == key) {
+            return &cacheEntries.front();
+        }
+    }
+    return nullptr;
+}
+
+void SynthesisResultCache::insertCacheEntry(CacheEntry cacheEntry) {
+    // Cache entries whose hash collides with the one of the inserted entry are replaced.
+    if (const auto cacheEntryLookupResult = cacheEntryLookup.find(cacheEntry.key.hash); cacheEntryLookupResult != cacheEntryLookup.end()) {
+        cacheEntries.erase(cacheEntryLookupResult->second);
+        cacheEntryLookup.erase(cacheEntryLookupResult);
+    }
+    if (maxNumCachedResults == 0) {
+        return;
+    }
+
+    while (cacheEntries.size() >= maxNumCachedResults) {
+        cacheEntryLookup.erase(cacheEntries.back().key.hash);
+        cacheEntries.pop_back();
+    }
+    const std::uint64_t hash = cacheEntry.key.hash;
+    cacheEntries.emplace_front(std::move(cacheEntry));
+    cacheEntryLookup.emplace(hash, cacheEntries.begin());
+}
+
+std::optional<SynthesisResultCache::CacheEntry> SynthesisResultCache::tryLoadCacheEntryFromDisk(const CacheKey& key) const {
+    if (!optionalOnDiskCacheDirectory.has_value()) {
+        return std::nullopt;
+    }
+
+    const std::optional<syrec_parser::MemoryMappedFile> onDiskCacheEntry = syrec_parser::MemoryMappedFile::open(getPathOfOnDiskCacheEntry(*optionalOnDiskCacheDirectory, key.hash).string());
+    if (!onDiskCacheEntry.has_value()) {
+        return std::nullopt;
+    }
+
+    BufferReader reader(onDiskCacheEntry->getContent());
+    if (!reader.readMagic(ON_DISK_CACHE_ENTRY_MAGIC) || reader.readInteger() != ON_DISK_CACHE_ENTRY_VERSION) {
+        return std::nullopt;
+    }
+
+    CacheEntry cacheEntry{.key = {.hash = key.hash, .serializedKey = reader.readString()}, .recordedStatistics = {}, .serializedQuantumComputation = {}};
+    forEachCachedStatistic(cacheEntry.recordedStatistics, [&reader](std::size_t& statistic) { statistic = static_cast<std::size_t>(reader.readInteger()); });
+    const std::uint64_t numGateTypes = reader.readInteger();
+    for (std::uint64_t i = 0; i < numGateTypes && reader.isValidSoFar(); ++i) {
+        std::string gateType                                                   = reader.readString();
+        cacheEntry.recordedStatistics.numQuantumOperationsPerGateType[gateType] = static_cast<std::size_t>(reader.readInteger());
+    }
+    cacheEntry.serializedQuantumComputation = reader.readString();
+
+    // On-disk cache entries of other programs or settings with the same hash are ignored.
+    if (!reader.isFullyReadAndValid() || cacheEntry.key != key) {
+        return std::nullopt;
+    }
+    return cacheEntry;
+}
+
+void SynthesisResultCache::storeCacheEntryOnDisk(const CacheEntry& cacheEntry) const {
+    if (!optionalOnDiskCacheDirectory.has_value()) {
+        return;
+    }
+
+    std::string serializedCacheEntry(ON_DISK_CACHE_ENTRY_MAGIC);
+    appendInteger(serializedCacheEntry, ON_DISK_CACHE_ENTRY_VERSION);
+    appendString(serializedCacheEntry, cacheEntry.key.serializedKey);
+    forEachCachedStatistic(cacheEntry.recordedStatistics, [&serializedCacheEntry](const std::size_t statistic) { appendInteger(serializedCacheEntry, statistic); });
+    appendInteger(serializedCacheEntry, cacheEntry.recordedStatistics.numQuantumOperationsPerGateType.size());
+    for (const auto& [gateType, numQuantumOperationsOfGateType]: cacheEntry.recordedStatistics.numQuantumOperationsPerGateType) {
+        appendString(serializedCacheEntry, gateType);
+        appendInteger(serializedCacheEntry, numQuantumOperationsOfGateType);
+    }
+    appendString(serializedCacheEntry, cacheEntry.serializedQuantumComputation);
+
+    // The cache entry is written to a uniquely named temporary file that is renamed once the entry was fully written, thus other processes will never read a partially written cache entry.
+    const std::filesystem::path pathOfCacheEntry = getPathOfOnDiskCacheEntry(*optionalOnDiskCacheDirectory, cacheEntry.key.hash);
+    std::filesystem::path       pathOfTemporaryFile(pathOfCacheEntry);
+    pathOfTemporaryFile += ".tmp" + std::to_string(std::random_device{}());
+
+    bool writeOk = false;
+    if (std::ofstream outputFileStream(pathOfTemporaryFile, std::ofstream::out | std::ofstream::binary | std::ofstream::trunc); outputFileStream.is_open()) {
+        outputFileStream.write(serializedCacheEntry.data(), static_cast<std::streamsize>(serializedCacheEntry.size()));
+        writeOk = static_cast<bool>(outputFileStream);
+    }
+
+    std::error_code errorCode;
+    if (writeOk) {
+        std::filesystem::rename(pathOfTemporaryFile, pathOfCacheEntry, errorCode);
+    }
+    if (!writeOk || errorCode) {
+        std::filesystem::remove(pathOfTemporaryFile, errorCode);
+    }
+}
+
+void SynthesisResultCache::recordCacheStatistics(Statistics* optionalRecordedStatistics) const {
+    if (optionalRecordedStatistics != nullptr) {
+        optionalRecordedStatistics->numSynthesisResultCacheHits   = numCacheHits;
+        optionalRecordedStatistics->numSynthesisResultCacheMisses = numCacheMisses;
+    }
+}
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/synthesis_sweep.hpp"
+
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "algorithms/synthesis/synthesis_result_cache.hpp"
+#include "core/configurable_options.hpp"
+#include "core/statistics.hpp"
+#include "core/syrec/parser/utils/syrec_operation_utils.hpp"
+#include "core/syrec/program.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+    // The fields of the settings influencing the result of the parser (see syrec::ProgramCache).
+    struct ParserRelevantSettings {
+        unsigned                                  defaultBitwidth;
+        utils::IntegerConstantTruncationOperation integerConstantTruncationOperation;
+        bool                                      allowAccessOnAssignedToVariablePartsInDimensionAccessOfVariableAccess;
+        std::optional<std::string>                optionalProgramEntryPointModuleIdentifier;
+        std::optional<std::size_t>                optionalMaxNumReportedParserErrors;
+        bool                                      pruneModulesNotReachableFromProgramEntryPoint;
+
+        [[nodiscard]] bool operator==(const ParserRelevantSettings& other) const = default;
+    };
+
+    struct ParsedProgram {
+        ParserRelevantSettings          parserRelevantSettings;
+        std::unique_ptr<syrec::Program> program;
+        std::string                     foundErrors;
+        syrec::Statistics               statistics;
+    };
+
+    [[nodiscard]] ParserRelevantSettings determineParserRelevantSettings(const syrec::ConfigurableOptions& settings) {
+        return ParserRelevantSettings{.defaultBitwidth                                                       = settings.defaultBitwidth,
+                                      .integerConstantTruncationOperation                                    = settings.integerConstantTruncationOperation,
+                                      .allowAccessOnAssignedToVariablePartsInDimensionAccessOfVariableAccess = settings.allowAccessOnAssignedToVariablePartsInDimensionAccessOfVariableAccess,
+                                      .optionalProgramEntryPointModuleIdentifier                             = settings.optionalProgramEntryPointModuleIdentifier,
+                                      .optionalMaxNumReportedParserErrors                                    = settings.optionalMaxNumReportedParserErrors,
+                                      .pruneModulesNotReachableFromProgramEntryPoint                         = settings.pruneModulesNotReachableFromProgramEntryPoint};
+    }
+
+    [[nodiscard]] bool isDominatedBy(const syrec::SynthesisSweepEntry& entry, const syrec::SynthesisSweepEntry& other) {
+        return other.statistics.numQubits <= entry.statistics.numQubits && other.quantumCost <= entry.quantumCost && (other.statistics.numQubits < entry.statistics.numQubits || other.quantumCost < entry.quantumCost);
+    }
+
+    void markParetoOptimalEntries(std::vector<syrec::SynthesisSweepEntry>& entries) {
+        for (auto& entry: entries) {
+            entry.isParetoOptimal = entry.synthesisOk && std::none_of(entries.cbegin(), entries.cend(), [&entry](const syrec::SynthesisSweepEntry& other) { return other.synthesisOk && isDominatedBy(entry, other); });
+        }
+    }
+} // namespace
+
+namespace syrec {
+    void synthesisSweep(SynthesisSweepResult& result, const std::string_view stringifiedProgram, const std::vector<SynthesisSweepVariant>& variants, const SynthesisSweepSettings& sweepSettings) {
+        result = SynthesisSweepResult{};
+        result.entries.resize(variants.size());
+
+        // The program is only parsed once per distinct combination of the parser relevant settings of the variants with a single reader reusing its lexer and parser instances for all of them.
+        ProgramReader              programReader;
+        std::vector<ParsedProgram> parsedPrograms;
+        std::vector<std::size_t>   indexOfParsedProgramPerVariant(variants.size(), 0);
+        for (std::size_t i = 0; i < variants.size(); ++i) {
+            ParserRelevantSettings parserRelevantSettings = determineParserRelevantSettings(variants[i].settings);
+            const auto             matchingParsedProgram  = std::find_if(parsedPrograms.cbegin(), parsedPrograms.cend(), [&parserRelevantSettings](const ParsedProgram& parsedProgram) { return parsedProgram.parserRelevantSettings == parserRelevantSettings; });
+            if (matchingParsedProgram != parsedPrograms.cend()) {
+                indexOfParsedProgramPerVariant[i] = static_cast<std::size_t>(std::distance(parsedPrograms.cbegin(), matchingParsedProgram));
+                continue;
+            }
+
+            ParsedProgram parsedProgram{.parserRelevantSettings = std::move(parserRelevantSettings), .program = std::make_unique<Program>(), .foundErrors = {}, .statistics = {}};
+            parsedProgram.foundErrors         = programReader.readFromString(*parsedProgram.program, stringifiedProgram, variants[i].settings, &parsedProgram.statistics);
+            indexOfParsedProgramPerVariant[i] = parsedPrograms.size();
+            parsedPrograms.emplace_back(std::move(parsedProgram));
+        }
+        result.numParsedPrograms = parsedPrograms.size();
+
+        // Variants of the same parsed program with the same synthesizer and synthesis relevant settings would synthesize the same quantum computation, thus only the first of them is synthesized.
+        std::vector<BatchSynthesisJob>               jobs;
+        std::vector<std::size_t>                     indexOfVariantPerJob;
+        std::unordered_map<std::string, std::size_t> indexOfSynthesizedVariantPerSynthesisKey;
+        for (std::size_t i = 0; i < variants.size(); ++i) {
+            const ParsedProgram& parsedProgram = parsedPrograms[indexOfParsedProgramPerVariant[i]];
+            SynthesisSweepEntry& entry         = result.entries[i];
+            entry.indexOfSynthesizedVariant    = i;
+            if (!parsedProgram.foundErrors.empty()) {
+                entry.statistics = parsedProgram.statistics;
+                entry.diagnostics.reportErrors(parsedProgram.foundErrors);
+                continue;
+            }
+
+            // Since the synthesis trace would not be recorded for a variant reusing the synthesis result of another variant, variants recording a trace are always synthesized.
+            if (!variants[i].settings.optionalSynthesisTraceFilePath.has_value()) {
+                std::string synthesisKey = std::to_string(indexOfParsedProgramPerVariant[i]) + '\0' + SynthesisResultCache::serializeSynthesisRelevantSettings(variants[i].synthesisAlgorithm, variants[i].settings);
+                if (const auto [synthesisKeyIterator, wasInserted] = indexOfSynthesizedVariantPerSynthesisKey.try_emplace(std::move(synthesisKey), i); !wasInserted) {
+                    entry.indexOfSynthesizedVariant = synthesisKeyIterator->second;
+                    continue;
+                }
+            }
+            jobs.emplace_back(BatchSynthesisJob{.program = parsedProgram.program.get(), .settings = variants[i].settings, .synthesisAlgorithm = variants[i].synthesisAlgorithm});
+            indexOfVariantPerJob.emplace_back(i);
+        }
+        result.numSynthesizedVariants = jobs.size();
+
+        std::vector<BatchSynthesisResult> batchSynthesisResults;
+        batchSynthesis(batchSynthesisResults, jobs, sweepSettings.numThreads, sweepSettings.deterministic);
+        for (std::size_t jobIndex = 0; jobIndex < jobs.size(); ++jobIndex) {
+            const std::size_t     variantIndex         = indexOfVariantPerJob[jobIndex];
+            const ParsedProgram&  parsedProgram        = parsedPrograms[indexOfParsedProgramPerVariant[variantIndex]];
+            BatchSynthesisResult& batchSynthesisResult = batchSynthesisResults[jobIndex];
+            SynthesisSweepEntry&  entry                = result.entries[variantIndex];
+
+            entry.synthesisOk                                  = batchSynthesisResult.synthesisOk;
+            entry.statistics                                   = std::move(batchSynthesisResult.statistics);
+            entry.statistics.parsingRuntimeInNanoseconds       = parsedProgram.statistics.parsingRuntimeInNanoseconds;
+            entry.statistics.semanticCheckRuntimeInNanoseconds = parsedProgram.statistics.semanticCheckRuntimeInNanoseconds;
+            entry.diagnostics                                  = std::move(batchSynthesisResult.diagnostics);
+            if (entry.synthesisOk && batchSynthesisResult.annotatableQuantumComputation != nullptr) {
+                entry.quantumCost                   = batchSynthesisResult.annotatableQuantumComputation->getQuantumCostForSynthesis();
+                entry.annotatableQuantumComputation = std::move(batchSynthesisResult.annotatableQuantumComputation);
+            }
+        }
+
+        for (std::size_t i = 0; i < variants.size(); ++i) {
+            SynthesisSweepEntry& entry = result.entries[i];
+            if (entry.indexOfSynthesizedVariant == i) {
+                continue;
+            }
+            const SynthesisSweepEntry& synthesizedEntry = result.entries[entry.indexOfSynthesizedVariant];
+            entry.synthesisOk                           = synthesizedEntry.synthesisOk;
+            entry.statistics                            = synthesizedEntry.statistics;
+            entry.quantumCost                           = synthesizedEntry.quantumCost;
+            entry.annotatableQuantumComputation         = synthesizedEntry.annotatableQuantumComputation;
+            entry.diagnostics                           = synthesizedEntry.diagnostics;
+        }
+
+        markParetoOptimalEntries(result.entries);
+        for (auto& entry: result.entries) {
+            if (!sweepSettings.keepParetoOptimalQuantumComputations || !entry.isParetoOptimal) {
+                entry.annotatableQuantumComputation.reset();
+            }
+        }
+    }
+} // namespace syrec
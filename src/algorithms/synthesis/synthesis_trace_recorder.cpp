@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/synthesis_trace_recorder.hpp"
+
+#include "core/annotatable_quantum_computation.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <ios>
+#include <optional>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+
+using namespace syrec;
+
+namespace {
+    void writeJsonString(std::ostream& outputStream, const std::string_view& stringToWrite) {
+        outputStream << '"';
+        for (const char character: stringToWrite) {
+            if (character == '"' || character == '\\') {
+                outputStream << '\\';
+            }
+            outputStream << character;
+        }
+        outputStream << '"';
+    }
+
+    // The timestamps and durations of the Chrome trace-event format are defined in microseconds but may be fractional.
+    void writeNanosecondsAsMicroseconds(std::ostream& outputStream, const std::uint64_t nanoseconds) {
+        outputStream << nanoseconds / 1000U << '.';
+        const std::uint64_t fractionalPart = nanoseconds % 1000U;
+        outputStream << (fractionalPart < 100U ? "0" : "") << (fractionalPart < 10U ? "0" : "") << fractionalPart;
+    }
+} // namespace
+
+void SynthesisTraceRecorder::recordEvent(const std::string_view category, std::string name, const std::optional<unsigned> lineNumber, const TimeStamp eventStartTime, const TimeStamp eventEndTime, const std::size_t numEmittedQuantumOperations) {
+    const auto toNanoseconds = [](const std::chrono::steady_clock::duration duration) {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    };
+    events.emplace_back(TraceEvent{.category = category, .name = std::move(name), .lineNumber = lineNumber, .startTimestampInNanoseconds = toNanoseconds(eventStartTime - startTime), .durationInNanoseconds = toNanoseconds(eventEndTime - eventStartTime), .numEmittedQuantumOperations = numEmittedQuantumOperations});
+}
+
+std::string SynthesisTraceRecorder::toChromeTraceEventJson() const {
+    std::ostringstream jsonStream;
+    jsonStream << "{\"traceEvents\":[";
+    for (std::size_t i = 0; i < events.size(); ++i) {
+        const TraceEvent& event = events[i];
+        jsonStream << (i != 0 ? ",\n" : "\n") << "{\"name\":";
+        writeJsonString(jsonStream, event.name);
+        jsonStream << ",\"cat\":";
+        writeJsonString(jsonStream, event.category);
+        jsonStream << ",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":";
+        writeNanosecondsAsMicroseconds(jsonStream, event.startTimestampInNanoseconds);
+        jsonStream << ",\"dur\":";
+        writeNanosecondsAsMicroseconds(jsonStream, event.durationInNanoseconds);
+        jsonStream << ",\"args\":{\"num_emitted_quantum_operations\":" << event.numEmittedQuantumOperations;
+        if (event.lineNumber.has_value()) {
+            jsonStream << ",\"line_number\":" << *event.lineNumber;
+        }
+        jsonStream << "}}";
+    }
+    jsonStream << "\n],\"displayTimeUnit\":\"ns\"}";
+    return jsonStream.str();
+}
+
+bool SynthesisTraceRecorder::writeChromeTraceEventJson(const std::string& filePath) const {
+    std::ofstream outputFileStream(filePath, std::ios_base::out | std::ios_base::trunc);
+    if (!outputFileStream.is_open()) {
+        return false;
+    }
+    outputFileStream << toChromeTraceEventJson();
+    return outputFileStream.good();
+}
+
+ScopedSynthesisTraceEvent::ScopedSynthesisTraceEvent(SynthesisTraceRecorder* traceRecorder, const AnnotatableQuantumComputation& annotatableQuantumComputation, const std::string_view category, const std::string_view name, const std::optional<unsigned> lineNumber):
+    traceRecorder(traceRecorder), annotatableQuantumComputation(annotatableQuantumComputation), category(category), lineNumber(lineNumber) {
+    if (traceRecorder != nullptr) {
+        this->name                  = name;
+        numQuantumOperationsAtStart = annotatableQuantumComputation.getNumQuantumOperations();
+        startTime                   = std::chrono::steady_clock::now();
+    }
+}
+
+ScopedSynthesisTraceEvent::~ScopedSynthesisTraceEvent() {
+    if (traceRecorder != nullptr) {
+        const SynthesisTraceRecorder::TimeStamp endTime                     = std::chrono::steady_clock::now();
+        const std::size_t                       numQuantumOperationsAtEnd   = annotatableQuantumComputation.getNumQuantumOperations();
+        const std::size_t                       numEmittedQuantumOperations = numQuantumOperationsAtEnd > numQuantumOperationsAtStart ? numQuantumOperationsAtEnd - numQuantumOperationsAtStart : 0U;
+        traceRecorder->recordEvent(category, std::move(name), lineNumber, startTime, endTime, numEmittedQuantumOperations);
+    }
+}
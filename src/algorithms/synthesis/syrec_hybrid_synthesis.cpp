@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/syrec_hybrid_synthesis.hpp"
+
+#include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
+#include "algorithms/synthesis/syrec_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/statistics.hpp"
+#include "core/syrec/expression.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/statement.hpp"
+#include "ir/Definitions.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace {
+    [[nodiscard]] bool isBinaryOperationSynthesizableLineAware(const syrec::BinaryExpression::BinaryOperation binaryOperation) {
+        return binaryOperation == syrec::BinaryExpression::BinaryOperation::Add || binaryOperation == syrec::BinaryExpression::BinaryOperation::Subtract || binaryOperation == syrec::BinaryExpression::BinaryOperation::Exor;
+    }
+
+    /**
+     * Estimate the number of quantum operations of an inplace addition, subtraction or bitwise XOR of two operands using the ripple-carry adder.
+     */
+    [[nodiscard]] std::size_t estimateNumQuantumOperationsOfInplaceOperation(const syrec::BinaryExpression::BinaryOperation binaryOperation, const std::size_t bitwidth) {
+        const std::size_t numQuantumOperationsOfAddition = bitwidth > 1 ? (7 * bitwidth) - 7 : bitwidth;
+        switch (binaryOperation) {
+            case syrec::BinaryExpression::BinaryOperation::Add:
+                return numQuantumOperationsOfAddition;
+            case syrec::BinaryExpression::BinaryOperation::Subtract:
+                // The inplace subtraction negates the qubits of one operand prior to and after the addition.
+                return numQuantumOperationsOfAddition + (2 * bitwidth);
+            case syrec::BinaryExpression::BinaryOperation::Exor:
+                return bitwidth;
+            default:
+                return 0;
+        }
+    }
+
+    /**
+     * Estimate the number of quantum operations to revert an inplace addition, subtraction or bitwise XOR of two operands in the line aware synthesis.
+     */
+    [[nodiscard]] std::size_t estimateNumQuantumOperationsOfInversionOfInplaceOperation(const syrec::BinaryExpression::BinaryOperation binaryOperation, const std::size_t bitwidth) {
+        switch (binaryOperation) {
+            case syrec::BinaryExpression::BinaryOperation::Add:
+                return estimateNumQuantumOperationsOfInplaceOperation(syrec::BinaryExpression::BinaryOperation::Subtract, bitwidth);
+            case syrec::BinaryExpression::BinaryOperation::Subtract:
+                return estimateNumQuantumOperationsOfInplaceOperation(syrec::BinaryExpression::BinaryOperation::Subtract, bitwidth) + bitwidth;
+            default:
+                return estimateNumQuantumOperationsOfInplaceOperation(binaryOperation, bitwidth);
+        }
+    }
+} // namespace
+
+namespace syrec {
+    bool HybridSynthesis::processStatement(const Statement::ptr& statement) {
+        if (statement == nullptr) {
+            return false;
+        }
+
+        // The selection is restored after the statement was synthesized since the synthesis of nested statements (e.g. of the branches of an IfStatement) performs its own selection.
+        const bool  wasCostAwareSynthesisSelected = isCostAwareSynthesisSelected;
+        const auto* stmtCastedAsAssignmentStmt    = statementCast<AssignStatement>(statement.get());
+        isCostAwareSynthesisSelected              = stmtCastedAsAssignmentStmt == nullptr || selectCostAwareSynthesisOfAssignment(*stmtCastedAsAssignmentStmt);
+
+        // The subexpressions recorded by the base class while synthesizing a statement like in the cost aware synthesis are never reverted and must thus neither be visible to a later assignment nor to an assignment nested in the statement
+        // (e.g. the subexpressions of the guard of an IfStatement) that is synthesized like in the line aware synthesis.
+        auto       recordedExpOpp         = std::exchange(expOpp, {});
+        auto       recordedExpLhss        = std::exchange(expLhss, {});
+        auto       recordedExpRhss        = std::exchange(expRhss, {});
+        const bool synthesisOfStatementOk = isCostAwareSynthesisSelected ? SyrecSynthesis::onStatement(statement) : LineAwareSynthesis::processStatement(statement);
+        expOpp                            = std::move(recordedExpOpp);
+        expLhss                           = std::move(recordedExpLhss);
+        expRhss                           = std::move(recordedExpRhss);
+        isCostAwareSynthesisSelected      = wasCostAwareSynthesisSelected;
+        return synthesisOfStatementOk;
+    }
+
+    bool HybridSynthesis::opRhsLhsExpression(const Expression::ptr& expression, std::vector<qc::Qubit>& v) {
+        return isCostAwareSynthesisSelected ? SyrecSynthesis::opRhsLhsExpression(expression, v) : LineAwareSynthesis::opRhsLhsExpression(expression, v);
+    }
+
+    bool HybridSynthesis::assignAdd(std::vector<qc::Qubit>& lhs, std::vector<qc::Qubit>& rhs, const AssignStatement::AssignOperation assignOperation) {
+        // The assignment lhs += rhs is synthesized using the inplace addition which stores the result of the addition in the qubits passed as the right hand side operand thus the operands of the assignment need to be passed in the reverse order.
+        return isCostAwareSynthesisSelected ? inplaceAdd(annotatableQuantumComputation, rhs, lhs) // NOLINT(readability-suspicious-call-argument)
+                                            : LineAwareSynthesis::assignAdd(lhs, rhs, assignOperation);
+    }
+
+    bool HybridSynthesis::assignSubtract(std::vector<qc::Qubit>& lhs, std::vector<qc::Qubit>& rhs, const AssignStatement::AssignOperation assignOperation) {
+        // The assignment lhs -= rhs is synthesized using the inplace subtraction which stores the result of the subtraction in the qubits passed as the right hand side operand thus the operands of the assignment need to be passed in the reverse order.
+        return isCostAwareSynthesisSelected ? inplaceSubtract(annotatableQuantumComputation, rhs, lhs) // NOLINT(readability-suspicious-call-argument)
+                                            : LineAwareSynthesis::assignSubtract(lhs, rhs, assignOperation);
+    }
+
+    bool HybridSynthesis::assignExor(std::vector<qc::Qubit>& lhs, std::vector<qc::Qubit>& rhs, const AssignStatement::AssignOperation assignOperation) {
+        return isCostAwareSynthesisSelected ? bitwiseCnot(annotatableQuantumComputation, lhs, rhs) : LineAwareSynthesis::assignExor(lhs, rhs, assignOperation);
+    }
+
+    bool HybridSynthesis::expAdd(const unsigned bitwidth, std::vector<qc::Qubit>& lines, const std::vector<qc::Qubit>& lhs, const std::vector<qc::Qubit>& rhs) {
+        if (!isCostAwareSynthesisSelected) {
+            return LineAwareSynthesis::expAdd(bitwidth, lines, lhs, rhs);
+        }
+        return getConstantLines(bitwidth, 0U, lines) && bitwiseCnot(annotatableQuantumComputation, lines, lhs) // duplicate lhs
+            && inplaceAdd(annotatableQuantumComputation, rhs, lines);                                          // NOLINT(readability-suspicious-call-argument)
+    }
+
+    bool HybridSynthesis::expSubtract(const unsigned bitwidth, std::vector<qc::Qubit>& lines, const std::vector<qc::Qubit>& lhs, const std::vector<qc::Qubit>& rhs) {
+        if (!isCostAwareSynthesisSelected) {
+            return LineAwareSynthesis::expSubtract(bitwidth, lines, lhs, rhs);
+        }
+        return getConstantLines(bitwidth, 0U, lines) && bitwiseCnot(annotatableQuantumComputation, lines, lhs) // duplicate lhs
+            && inplaceSubtract(annotatableQuantumComputation, rhs, lines);                                     // NOLINT(readability-suspicious-call-argument)
+    }
+
+    bool HybridSynthesis::expExor(const unsigned bitwidth, std::vector<qc::Qubit>& lines, const std::vector<qc::Qubit>& lhs, const std::vector<qc::Qubit>& rhs) {
+        if (!isCostAwareSynthesisSelected) {
+            return LineAwareSynthesis::expExor(bitwidth, lines, lhs, rhs);
+        }
+        return getConstantLines(bitwidth, 0U, lines) && bitwiseCnot(annotatableQuantumComputation, lines, lhs) // duplicate lhs
+            && bitwiseCnot(annotatableQuantumComputation, lines, rhs);
+    }
+
+    bool HybridSynthesis::expressionOpInverse(const BinaryExpression::BinaryOperation binaryOperation, const std::vector<qc::Qubit>& expLhs, const std::vector<qc::Qubit>& expRhs) {
+        return isCostAwareSynthesisSelected ? SyrecSynthesis::expressionOpInverse(binaryOperation, expLhs, expRhs) : LineAwareSynthesis::expressionOpInverse(binaryOperation, expLhs, expRhs);
+    }
+
+    bool HybridSynthesis::selectCostAwareSynthesisOfAssignment(const AssignStatement& assignmentStmt) {
+        // The line aware synthesis cannot synthesize an assignment containing a variable access that uses a non-compile time constant expression as index in its dimension access.
+        const std::optional<bool> doesLhsNotContainNonCompileTimeConstantIndex = doesVariableAccessNotContainCompileTimeconstantExpressions(assignmentStmt.lhs);
+        const std::optional<bool> doesRhsNotContainNonCompileTimeConstantIndex = doesLhsNotContainNonCompileTimeConstantIndex.value_or(false) ? doesExpressionNotContainVariableAccessWithCompileTimeConstantExpressions(assignmentStmt.rhs) : std::nullopt;
+        if (assignmentStmt.rhs == nullptr || !doesRhsNotContainNonCompileTimeConstantIndex.value_or(false)) {
+            ++numAssignmentsSynthesizedCostAware;
+            return true;
+        }
+
+        const EstimatedSynthesisCost costAwareSynthesisCost = estimateSynthesisCostOfAssignment(assignmentStmt, true);
+        const EstimatedSynthesisCost lineAwareSynthesisCost = estimateSynthesisCostOfAssignment(assignmentStmt, false);
+
+        const bool isCostAwareSynthesisCheaper      = costAwareSynthesisCost.numQuantumOperations < lineAwareSynthesisCost.numQuantumOperations;
+        const bool isCostAwareSynthesisWithinBudget = !qubitBudget.has_value() || annotatableQuantumComputation.getNqubits() + costAwareSynthesisCost.numAncillaryQubits <= *qubitBudget;
+        if (isCostAwareSynthesisCheaper && isCostAwareSynthesisWithinBudget) {
+            ++numAssignmentsSynthesizedCostAware;
+            estimatedNumQuantumOperationsSavedByHybridSynthesis += lineAwareSynthesisCost.numQuantumOperations - costAwareSynthesisCost.numQuantumOperations;
+            return true;
+        }
+
+        ++numAssignmentsSynthesizedLineAware;
+        if (costAwareSynthesisCost.numAncillaryQubits > lineAwareSynthesisCost.numAncillaryQubits) {
+            estimatedNumAncillaryQubitsSavedByHybridSynthesis += costAwareSynthesisCost.numAncillaryQubits - lineAwareSynthesisCost.numAncillaryQubits;
+        }
+        return false;
+    }
+
+    HybridSynthesis::EstimatedSynthesisCost HybridSynthesis::estimateSynthesisCostOfAssignment(const AssignStatement& assignmentStmt, const bool synthesizeCostAware) {
+        const std::optional<BinaryExpression::BinaryOperation> assignmentAsBinaryOperation      = tryMapAssignmentToBinaryOperation(assignmentStmt.assignOperation);
+        const std::size_t                                      bitwidth                         = assignmentStmt.rhs->bitwidth();
+        const std::size_t                                      numQuantumOperationsOfAssignment = assignmentAsBinaryOperation.has_value() ? estimateNumQuantumOperationsOfInplaceOperation(*assignmentAsBinaryOperation, bitwidth) : 0;
+
+        // The line aware synthesis merges the binary operation of the right-hand side with a matching assignment operation by applying both operands of the former to the assigned to qubits.
+        if (const auto* rhsAsBinaryExpr = expressionCast<BinaryExpression>(assignmentStmt.rhs.get()); !synthesizeCostAware && rhsAsBinaryExpr != nullptr && assignmentAsBinaryOperation.has_value() && rhsAsBinaryExpr->binaryOperation == *assignmentAsBinaryOperation) {
+            const EstimatedSynthesisCost lhsOperandCost = estimateSynthesisCostOfExpression(*rhsAsBinaryExpr->lhs, false);
+            const EstimatedSynthesisCost rhsOperandCost = estimateSynthesisCostOfExpression(*rhsAsBinaryExpr->rhs, false);
+            return {.numQuantumOperations = lhsOperandCost.numQuantumOperations + rhsOperandCost.numQuantumOperations + (2 * numQuantumOperationsOfAssignment), .numAncillaryQubits = lhsOperandCost.numAncillaryQubits + rhsOperandCost.numAncillaryQubits};
+        }
+
+        EstimatedSynthesisCost synthesisCost = estimateSynthesisCostOfExpression(*assignmentStmt.rhs, synthesizeCostAware);
+        synthesisCost.numQuantumOperations += numQuantumOperationsOfAssignment;
+        return synthesisCost;
+    }
+
+    HybridSynthesis::EstimatedSynthesisCost HybridSynthesis::estimateSynthesisCostOfExpression(const Expression& expression, const bool synthesizeCostAware) {
+        const std::size_t bitwidth = expression.bitwidth();
+        if (expressionCast<VariableExpression>(&expression) != nullptr) {
+            return {};
+        }
+
+        EstimatedSynthesisCost estimatedCostOfOperands;
+        if (const auto* exprAsBinaryExpr = expressionCast<BinaryExpression>(&expression); exprAsBinaryExpr != nullptr) {
+            const EstimatedSynthesisCost lhsOperandCost = estimateSynthesisCostOfExpression(*exprAsBinaryExpr->lhs, synthesizeCostAware);
+            const EstimatedSynthesisCost rhsOperandCost = estimateSynthesisCostOfExpression(*exprAsBinaryExpr->rhs, synthesizeCostAware);
+            estimatedCostOfOperands.numQuantumOperations = lhsOperandCost.numQuantumOperations + rhsOperandCost.numQuantumOperations;
+            estimatedCostOfOperands.numAncillaryQubits   = lhsOperandCost.numAncillaryQubits + rhsOperandCost.numAncillaryQubits;
+
+            if (isBinaryOperationSynthesizableLineAware(exprAsBinaryExpr->binaryOperation)) {
+                // The cost aware synthesis copies the left-hand side operand to ancillary qubits prior to applying the operation while the line aware synthesis applies the operation to the qubits of the right-hand side operand and reverts it after the assignment.
+                const std::size_t numQuantumOperationsOfOperation = estimateNumQuantumOperationsOfInplaceOperation(exprAsBinaryExpr->binaryOperation, bitwidth);
+                if (synthesizeCostAware) {
+                    return {.numQuantumOperations = estimatedCostOfOperands.numQuantumOperations + bitwidth + numQuantumOperationsOfOperation, .numAncillaryQubits = estimatedCostOfOperands.numAncillaryQubits + bitwidth};
+                }
+                return {.numQuantumOperations = estimatedCostOfOperands.numQuantumOperations + numQuantumOperationsOfOperation + estimateNumQuantumOperationsOfInversionOfInplaceOperation(exprAsBinaryExpr->binaryOperation, bitwidth), .numAncillaryQubits = estimatedCostOfOperands.numAncillaryQubits};
+            }
+        } else if (const auto* exprAsUnaryExpr = expressionCast<UnaryExpression>(&expression); exprAsUnaryExpr != nullptr) {
+            estimatedCostOfOperands = estimateSynthesisCostOfExpression(*exprAsUnaryExpr->expr, synthesizeCostAware);
+        } else if (const auto* exprAsShiftExpr = expressionCast<ShiftExpression>(&expression); exprAsShiftExpr != nullptr) {
+            estimatedCostOfOperands = estimateSynthesisCostOfExpression(*exprAsShiftExpr->lhs, synthesizeCostAware);
+        }
+
+        // All other expressions are synthesized by the base class in both variants and are assumed to store their result in ancillary qubits.
+        return {.numQuantumOperations = estimatedCostOfOperands.numQuantumOperations + bitwidth, .numAncillaryQubits = estimatedCostOfOperands.numAncillaryQubits + bitwidth};
+    }
+
+    void HybridSynthesis::accumulateStatisticsOfConcurrentlySynthesizedStatements(const Statistics& statistics) {
+        LineAwareSynthesis::accumulateStatisticsOfConcurrentlySynthesizedStatements(statistics);
+        numAssignmentsSynthesizedCostAware += statistics.numAssignmentsSynthesizedCostAware;
+        numAssignmentsSynthesizedLineAware += statistics.numAssignmentsSynthesizedLineAware;
+        estimatedNumQuantumOperationsSavedByHybridSynthesis += statistics.estimatedNumQuantumOperationsSavedByHybridSynthesis;
+        estimatedNumAncillaryQubitsSavedByHybridSynthesis += statistics.estimatedNumAncillaryQubitsSavedByHybridSynthesis;
+    }
+
+    bool HybridSynthesis::synthesize(AnnotatableQuantumComputation& annotatableQuantumComputation, const Program& program, const ConfigurableOptions& settings, Statistics* optionalRecordedStatistics) {
+        HybridSynthesis synthesizer(annotatableQuantumComputation);
+        synthesizer.qubitBudget = settings.qubitBudgetOfHybridSynthesis;
+        const bool synthesisOk  = SyrecSynthesis::synthesize(&synthesizer, program, settings, optionalRecordedStatistics);
+        if (synthesisOk && optionalRecordedStatistics != nullptr) {
+            optionalRecordedStatistics->numAssignmentsSynthesizedCostAware                  = synthesizer.numAssignmentsSynthesizedCostAware;
+            optionalRecordedStatistics->numAssignmentsSynthesizedLineAware                  = synthesizer.numAssignmentsSynthesizedLineAware;
+            optionalRecordedStatistics->estimatedNumQuantumOperationsSavedByHybridSynthesis = synthesizer.estimatedNumQuantumOperationsSavedByHybridSynthesis;
+            optionalRecordedStatistics->estimatedNumAncillaryQubitsSavedByHybridSynthesis   = synthesizer.estimatedNumAncillaryQubitsSavedByHybridSynthesis;
+        }
+        return synthesisOk;
+    }
+} // namespace syrec
@@ -10,9 +10,11 @@
 
 #include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
 
+#include "algorithms/synthesis/synthesis_trace_recorder.hpp"
 #include "algorithms/synthesis/syrec_synthesis.hpp"
 #include "core/annotatable_quantum_computation.hpp"
 #include "core/configurable_options.hpp"
+#include "core/diagnostics.hpp"
 #include "core/statistics.hpp"
 #include "core/syrec/expression.hpp"
 #include "core/syrec/program.hpp"
@@ -22,10 +24,9 @@
 
 #include <algorithm>
 #include <cstddef>
-#include <iostream>
 #include <memory>
 #include <optional>
-#include <string>
+#include <ostream>
 #include <vector>
 
 namespace syrec {
@@ -40,18 +41,18 @@ namespace syrec {
         // that contain a variable access using a non-CTCE as index in its dimension access.
         std::optional    didStmtNotContainVariableAccessUsingNonCompileTimeConstantExpressionAsIndex = true;
         const Statement* stmtReference                                                               = statement.get();
-        if (const auto* const stmtCastedAsUnaryStmt = dynamic_cast<const UnaryStatement*>(stmtReference); stmtCastedAsUnaryStmt != nullptr) {
+        if (const auto* const stmtCastedAsUnaryStmt = statementCast<UnaryStatement>(stmtReference); stmtCastedAsUnaryStmt != nullptr) {
             didStmtNotContainVariableAccessUsingNonCompileTimeConstantExpressionAsIndex = doesVariableAccessNotContainCompileTimeconstantExpressions(stmtCastedAsUnaryStmt->var);
-        } else if (const auto* const stmtCastedAsIfStmt = dynamic_cast<const IfStatement*>(stmtReference); stmtCastedAsIfStmt != nullptr) {
+        } else if (const auto* const stmtCastedAsIfStmt = statementCast<IfStatement>(stmtReference); stmtCastedAsIfStmt != nullptr) {
             didStmtNotContainVariableAccessUsingNonCompileTimeConstantExpressionAsIndex = doesExpressionNotContainVariableAccessWithCompileTimeConstantExpressions(stmtCastedAsIfStmt->condition);
-        } else if (const auto* const stmtCastedAsSwapStmt = dynamic_cast<const SwapStatement*>(stmtReference); stmtCastedAsSwapStmt != nullptr) {
+        } else if (const auto* const stmtCastedAsSwapStmt = statementCast<SwapStatement>(stmtReference); stmtCastedAsSwapStmt != nullptr) {
             didStmtNotContainVariableAccessUsingNonCompileTimeConstantExpressionAsIndex = doesVariableAccessNotContainCompileTimeconstantExpressions(stmtCastedAsSwapStmt->lhs);
             if (didStmtNotContainVariableAccessUsingNonCompileTimeConstantExpressionAsIndex.has_value() && !*didStmtNotContainVariableAccessUsingNonCompileTimeConstantExpressionAsIndex) {
                 didStmtNotContainVariableAccessUsingNonCompileTimeConstantExpressionAsIndex = doesVariableAccessNotContainCompileTimeconstantExpressions(stmtCastedAsSwapStmt->rhs);
             }
         }
 
-        const auto* const stmtCastedAsAssignmentStmt = dynamic_cast<const AssignStatement*>(statement.get());
+        const auto* const stmtCastedAsAssignmentStmt = statementCast<AssignStatement>(statement.get());
         if (stmtCastedAsAssignmentStmt != nullptr) {
             didStmtNotContainVariableAccessUsingNonCompileTimeConstantExpressionAsIndex = doesVariableAccessNotContainCompileTimeconstantExpressions(stmtCastedAsAssignmentStmt->lhs);
             if (didStmtNotContainVariableAccessUsingNonCompileTimeConstantExpressionAsIndex.has_value() && *didStmtNotContainVariableAccessUsingNonCompileTimeConstantExpressionAsIndex) {
@@ -60,7 +61,7 @@ namespace syrec {
         }
 
         if (didStmtNotContainVariableAccessUsingNonCompileTimeConstantExpressionAsIndex.has_value() && !*didStmtNotContainVariableAccessUsingNonCompileTimeConstantExpressionAsIndex) {
-            std::cerr << "Line aware synthesis cannot synthesis a statement that contains a variable access that uses a non-compile time constant expression as index in its dimension access component\n";
+            getErrorStream() << "Line aware synthesis cannot synthesis a statement that contains a variable access that uses a non-compile time constant expression as index in its dimension access component\n";
             return false;
         }
         // If we cannot determine whether the statement did not contain a variable access that used a non-compile time constant expression then either an error during the validation of an variable access used in the statement occurred
@@ -69,6 +70,7 @@ namespace syrec {
             return SyrecSynthesis::onStatement(statement);
         }
 
+        SYREC_SYNTHESIS_TRACE_SCOPE(synthesisTraceRecorder.get(), annotatableQuantumComputation, "statement", "AssignStatement", statement->lineNumber);
         const AssignStatement& assignmentStmt = *stmtCastedAsAssignmentStmt;
         std::vector<qc::Qubit> d;
         std::vector<qc::Qubit> dd;
@@ -88,7 +90,7 @@ namespace syrec {
         }
 
         // To be able to associate which gates are associated with a statement in the syrec-editor we need to set the appropriate annotation that will be added for each created gate
-        annotatableQuantumComputation.setOrUpdateGlobalQuantumOperationAnnotation(GATE_ANNOTATION_KEY_ASSOCIATED_STATEMENT_LINE_NUMBER, std::to_string(static_cast<std::size_t>(statement->lineNumber)));
+        annotatableQuantumComputation.setOrUpdateGlobalStatementLineNumber(statement->lineNumber);
 
         // Binaryexpression ADD=0, MINUS=1, EXOR=2
         // AssignOperation ADD=0, MINUS=1, EXOR=2
@@ -103,12 +105,12 @@ namespace syrec {
                 opVec.clear();
             } else {
                 if (assignmentStmt.assignOperation == AssignStatement::AssignOperation::Subtract) {
-                    synthesisOk = expressionSingleOp(BinaryExpression::BinaryOperation::Subtract, expLhsVector.at(0), statLhs) &&
-                                  expressionSingleOp(BinaryExpression::BinaryOperation::Subtract, expRhsVector.at(0), statLhs);
+                    synthesisOk = expressionSingleOp(BinaryExpression::BinaryOperation::Subtract, qubitSpanInterner.get(expLhsVector.at(0)), statLhs) &&
+                                  expressionSingleOp(BinaryExpression::BinaryOperation::Subtract, qubitSpanInterner.get(expRhsVector.at(0)), statLhs);
                 } else {
                     const std::optional<BinaryExpression::BinaryOperation> mappedToBinaryOperation = tryMapAssignmentToBinaryOperation(assignmentStmt.assignOperation);
-                    synthesisOk                                                                    = mappedToBinaryOperation.has_value() && expressionSingleOp(*mappedToBinaryOperation, expLhsVector.at(0), statLhs) &&
-                                  expressionSingleOp(expOpVector.at(0), expRhsVector.at(0), statLhs);
+                    synthesisOk                                                                    = mappedToBinaryOperation.has_value() && expressionSingleOp(*mappedToBinaryOperation, qubitSpanInterner.get(expLhsVector.at(0)), statLhs) &&
+                                  expressionSingleOp(expOpVector.at(0), qubitSpanInterner.get(expRhsVector.at(0)), statLhs);
                 }
                 expOpVector.clear();
                 assignOpVector.clear();
@@ -125,11 +127,11 @@ namespace syrec {
                 /// cancel out the signals
             } else if (expOpVector.at(0) != BinaryExpression::BinaryOperation::Subtract || expOpVector.at(0) != BinaryExpression::BinaryOperation::Exor) {
                 const std::optional<BinaryExpression::BinaryOperation> mappedToBinaryOperation = tryMapAssignmentToBinaryOperation(assignmentStmt.assignOperation);
-                synthesisOk                                                                    = mappedToBinaryOperation.has_value() && expressionSingleOp(*mappedToBinaryOperation, expLhsVector.at(0), statLhs) &&
-                              expressionSingleOp(expOpVector.at(0), expRhsVector.at(0), statLhs);
+                synthesisOk                                                                    = mappedToBinaryOperation.has_value() && expressionSingleOp(*mappedToBinaryOperation, qubitSpanInterner.get(expLhsVector.at(0)), statLhs) &&
+                              expressionSingleOp(expOpVector.at(0), qubitSpanInterner.get(expRhsVector.at(0)), statLhs);
             }
         } else {
-            synthesisOk = solver(statLhs, assignmentStmt.assignOperation, expLhsVector.at(0), expOpVector.at(0), expRhsVector.at(0));
+            synthesisOk = solver(statLhs, assignmentStmt.assignOperation, qubitSpanInterner.get(expLhsVector.at(0)), expOpVector.at(0), qubitSpanInterner.get(expRhsVector.at(0)));
         }
 
         const std::size_t z = (expOpVector.size() - static_cast<std::size_t>(expOpVector.size() % 2 == 0)) / 2;
@@ -156,32 +158,32 @@ namespace syrec {
         std::size_t j = 0;
         for (std::size_t i = 1; i <= expOpVector.size() - 1 && synthesisOk; i++) {
             /// when both rhs and lhs exist
-            if ((!expLhsVector.at(i).empty()) && (!expRhsVector.at(i).empty())) {
+            if ((expLhsVector.at(i) != QubitSpanInterner::EMPTY_SPAN_ID) && (expRhsVector.at(i) != QubitSpanInterner::EMPTY_SPAN_ID)) {
                 if (expLhsVector.at(i) == expRhsVector.at(i)) {
                     if (expOpVector.at(i) == BinaryExpression::BinaryOperation::Subtract || expOpVector.at(i) == BinaryExpression::BinaryOperation::Exor) {
                         /// cancel out the signals
                         j++;
                     } else if (expOpVector.at(i) != BinaryExpression::BinaryOperation::Subtract || expOpVector.at(i) != BinaryExpression::BinaryOperation::Exor) {
                         if (statAssignOp.at(j) == AssignStatement::AssignOperation::Subtract) {
-                            synthesisOk = expressionSingleOp(BinaryExpression::BinaryOperation::Subtract, expLhsVector.at(i), statLhs) &&
-                                          expressionSingleOp(BinaryExpression::BinaryOperation::Subtract, expRhsVector.at(i), statLhs);
+                            synthesisOk = expressionSingleOp(BinaryExpression::BinaryOperation::Subtract, qubitSpanInterner.get(expLhsVector.at(i)), statLhs) &&
+                                          expressionSingleOp(BinaryExpression::BinaryOperation::Subtract, qubitSpanInterner.get(expRhsVector.at(i)), statLhs);
                             j++;
                         } else {
                             const std::optional<BinaryExpression::BinaryOperation> mappedToBinaryOperation = tryMapAssignmentToBinaryOperation(statAssignOp.at(j));
-                            synthesisOk                                                                    = mappedToBinaryOperation.has_value() && expressionSingleOp(*mappedToBinaryOperation, expLhsVector.at(i), statLhs) &&
-                                          expressionSingleOp(expOpVector.at(i), expRhsVector.at(i), statLhs);
+                            synthesisOk                                                                    = mappedToBinaryOperation.has_value() && expressionSingleOp(*mappedToBinaryOperation, qubitSpanInterner.get(expLhsVector.at(i)), statLhs) &&
+                                          expressionSingleOp(expOpVector.at(i), qubitSpanInterner.get(expRhsVector.at(i)), statLhs);
                             j++;
                         }
                     }
                 } else {
-                    synthesisOk = solver(statLhs, statAssignOp.at(j), expLhsVector.at(i), expOpVector.at(i), expRhsVector.at(i));
+                    synthesisOk = solver(statLhs, statAssignOp.at(j), qubitSpanInterner.get(expLhsVector.at(i)), expOpVector.at(i), qubitSpanInterner.get(expRhsVector.at(i)));
                     j++;
                 }
             }
             /// when only lhs exists o rhs exists
-            else if (((expLhsVector.at(i).empty()) && !(expRhsVector.at(i).empty())) || ((!expLhsVector.at(i).empty()) && (expRhsVector.at(i).empty()))) {
+            else if (((expLhsVector.at(i) == QubitSpanInterner::EMPTY_SPAN_ID) && (expRhsVector.at(i) != QubitSpanInterner::EMPTY_SPAN_ID)) || ((expLhsVector.at(i) != QubitSpanInterner::EMPTY_SPAN_ID) && (expRhsVector.at(i) == QubitSpanInterner::EMPTY_SPAN_ID))) {
                 const std::optional<BinaryExpression::BinaryOperation> mappedToBinaryOperation = tryMapAssignmentToBinaryOperation(statAssignOp.at(j));
-                synthesisOk                                                                    = mappedToBinaryOperation.has_value() && expEvaluate(lines, *mappedToBinaryOperation, expRhsVector.at(i), statLhs);
+                synthesisOk                                                                    = mappedToBinaryOperation.has_value() && expEvaluate(lines, *mappedToBinaryOperation, qubitSpanInterner.get(expRhsVector.at(i)), statLhs);
                 j                                                                              = j + 1;
             }
         }
@@ -194,10 +196,10 @@ namespace syrec {
     }
 
     bool LineAwareSynthesis::flow(const Expression::ptr& expression, std::vector<qc::Qubit>& v) {
-        if (auto const* binary = dynamic_cast<BinaryExpression*>(expression.get())) {
+        if (auto const* binary = expressionCast<BinaryExpression>(expression.get())) {
             return (binary->binaryOperation == BinaryExpression::BinaryOperation::Add || binary->binaryOperation == BinaryExpression::BinaryOperation::Subtract || binary->binaryOperation == BinaryExpression::BinaryOperation::Exor) && flow(*binary, v);
         }
-        if (auto const* var = dynamic_cast<VariableExpression*>(expression.get())) {
+        if (auto const* var = expressionCast<VariableExpression>(expression.get())) {
             return flow(*var, v);
         }
         return false;
@@ -222,8 +224,8 @@ namespace syrec {
             return false;
         }
 
-        expLhsVector.push_back(lhs);
-        expRhsVector.push_back(rhs);
+        expLhsVector.push_back(qubitSpanInterner.intern(lhs));
+        expRhsVector.push_back(qubitSpanInterner.intern(rhs));
         expOpVector.push_back(expression.binaryOperation);
         return true;
     }
@@ -266,10 +268,10 @@ namespace syrec {
     }
 
     bool LineAwareSynthesis::opRhsLhsExpression(const Expression::ptr& expression, std::vector<qc::Qubit>& v) {
-        if (auto const* binary = dynamic_cast<BinaryExpression*>(expression.get())) {
+        if (auto const* binary = expressionCast<BinaryExpression>(expression.get())) {
             return opRhsLhsExpression(*binary, v);
         }
-        if (auto const* var = dynamic_cast<VariableExpression*>(expression.get())) {
+        if (auto const* var = expressionCast<VariableExpression>(expression.get())) {
             return opRhsLhsExpression(*var, v);
         }
         return false;
@@ -297,8 +299,16 @@ namespace syrec {
         expRhss.pop();
     }
 
+    bool LineAwareSynthesis::canSynthesisOfStatementsBeReused() const {
+        return !subFlag && expOpp.empty() && expLhss.empty() && expRhss.empty() && opVec.empty() && assignOpVector.empty() && expOpVector.empty() && expLhsVector.empty() && expRhsVector.empty();
+    }
+
+    bool LineAwareSynthesis::canSynthesizedResultsOfExpressionsBeShared() const {
+        return false;
+    }
+
     bool LineAwareSynthesis::inverse() {
-        const bool synthesisOfInversionOk = expressionOpInverse(expOpp.top(), expLhss.top(), expRhss.top());
+        const bool synthesisOfInversionOk = expressionOpInverse(expOpp.top(), qubitSpanInterner.get(expLhss.top()), qubitSpanInterner.get(expRhss.top()));
         subFlag                           = false;
         popExp();
         return synthesisOfInversionOk;
@@ -308,7 +318,7 @@ namespace syrec {
         bool synthesisOfAssignmentOk = true;
         if (const std::optional<BinaryExpression::BinaryOperation> mappedToBinaryOperation = !expOpp.empty() ? tryMapAssignmentToBinaryOperation(assignOperation) : std::nullopt;
             mappedToBinaryOperation.has_value() && *mappedToBinaryOperation == expOpp.top()) {
-            synthesisOfAssignmentOk = inplaceAdd(annotatableQuantumComputation, expLhss.top(), lhs) && inplaceAdd(annotatableQuantumComputation, expRhss.top(), lhs);
+            synthesisOfAssignmentOk = inplaceAdd(annotatableQuantumComputation, qubitSpanInterner.get(expLhss.top()), lhs) && inplaceAdd(annotatableQuantumComputation, qubitSpanInterner.get(expRhss.top()), lhs);
             popExp();
         } else {
             // The assignment lhs += rhs is synthesized using the inplace addition which stores the result of the addition in the qubits passed as the right hand side operand thus the operands of the assignment need to be passed in the reverse order.
@@ -325,8 +335,8 @@ namespace syrec {
         bool synthesisOfAssignmentOk = true;
         if (const std::optional<BinaryExpression::BinaryOperation> mappedToBinaryOperation = !expOpp.empty() ? tryMapAssignmentToBinaryOperation(assignOperation) : std::nullopt;
             mappedToBinaryOperation.has_value() && *mappedToBinaryOperation == expOpp.top()) {
-            synthesisOfAssignmentOk = inplaceSubtract(annotatableQuantumComputation, expLhss.top(), lhs) &&
-                                      inplaceAdd(annotatableQuantumComputation, expRhss.top(), lhs);
+            synthesisOfAssignmentOk = inplaceSubtract(annotatableQuantumComputation, qubitSpanInterner.get(expLhss.top()), lhs) &&
+                                      inplaceAdd(annotatableQuantumComputation, qubitSpanInterner.get(expRhss.top()), lhs);
             popExp();
         } else {
             // The assignment lhs -= rhs is synthesized using the inplace subtraction which stores the result of the subtraction in the qubits passed as the right hand side operand thus the operands of the assignment need to be passed in the reverse order.
@@ -343,7 +353,7 @@ namespace syrec {
         bool synthesisOfAssignmentOk = true;
         if (const std::optional<BinaryExpression::BinaryOperation> mappedToBinaryOperation = !expOpp.empty() ? tryMapAssignmentToBinaryOperation(assignOperation) : std::nullopt;
             mappedToBinaryOperation.has_value() && *mappedToBinaryOperation == expOpp.top()) {
-            synthesisOfAssignmentOk = bitwiseCnot(annotatableQuantumComputation, lhs, expLhss.top()) && bitwiseCnot(annotatableQuantumComputation, lhs, expRhss.top());
+            synthesisOfAssignmentOk = bitwiseCnot(annotatableQuantumComputation, lhs, qubitSpanInterner.get(expLhss.top())) && bitwiseCnot(annotatableQuantumComputation, lhs, qubitSpanInterner.get(expRhss.top()));
             popExp();
         } else {
             synthesisOfAssignmentOk = bitwiseCnot(annotatableQuantumComputation, lhs, rhs);
@@ -356,7 +366,7 @@ namespace syrec {
     }
 
     /// This function is used when input signals (rhs) are equal (just to solve statements individually)
-    bool LineAwareSynthesis::expEvaluate(std::vector<qc::Qubit>& lines, const BinaryExpression::BinaryOperation binaryOperation, const std::vector<qc::Qubit>& lhs, const std::vector<qc::Qubit>& rhs) const {
+    bool LineAwareSynthesis::expEvaluate(std::vector<qc::Qubit>& lines, const BinaryExpression::BinaryOperation binaryOperation, const std::vector<qc::Qubit>& lhs, const std::vector<qc::Qubit>& rhs) {
         bool synthesisOk = true;
         switch (binaryOperation) {
             case BinaryExpression::BinaryOperation::Add: // +
@@ -399,7 +409,7 @@ namespace syrec {
         return synthesisOfOperationOk;
     }
 
-    bool LineAwareSynthesis::expressionSingleOp(BinaryExpression::BinaryOperation binaryOperation, const std::vector<qc::Qubit>& expLhs, const std::vector<qc::Qubit>& expRhs) const {
+    bool LineAwareSynthesis::expressionSingleOp(BinaryExpression::BinaryOperation binaryOperation, const std::vector<qc::Qubit>& expLhs, const std::vector<qc::Qubit>& expRhs) {
         // With the return value we only propagate an error if the defined 'synthesis' operation for any of the handled operations fails. In all other cases, we assume that
         // no synthesis should be performed and simply return OK.
         switch (binaryOperation) {
@@ -435,7 +445,7 @@ namespace syrec {
     }
 
     std::optional<bool> LineAwareSynthesis::doesVariableAccessNotContainCompileTimeconstantExpressions(const VariableAccess::ptr& variableAccess) const {
-        const std::optional<EvaluatedVariableAccess> evaluatedVariableAccess = evaluateAndValidateVariableAccess(variableAccess, loopMap, firstVariableQubitOffsetLookup);
+        const std::optional<EvaluatedVariableAccess> evaluatedVariableAccess = evaluateAndValidateVariableAccess(variableAccess, firstVariableQubitOffsetLookup);
         return evaluatedVariableAccess.has_value() ? std::make_optional(evaluatedVariableAccess->evaluatedDimensionAccess.containedOnlyNumericExpressions) : std::nullopt;
     }
 
@@ -444,21 +454,21 @@ namespace syrec {
             return std::nullopt;
         }
 
-        if (const auto& exprCastedAsBinaryOne = std::dynamic_pointer_cast<BinaryExpression>(expr); exprCastedAsBinaryOne != nullptr) {
+        if (const auto& exprCastedAsBinaryOne = expressionPointerCast<BinaryExpression>(expr); exprCastedAsBinaryOne != nullptr) {
             const std::optional<bool> doesLhsOperandNotContainVariableAccessWithCompileTimeConstantExpression = doesExpressionNotContainVariableAccessWithCompileTimeConstantExpressions(exprCastedAsBinaryOne->lhs);
             const std::optional<bool> doesRhsOperandNotContainVariableAccessWithCompileTimeConstantExpression = doesLhsOperandNotContainVariableAccessWithCompileTimeConstantExpression.has_value() ? doesExpressionNotContainVariableAccessWithCompileTimeConstantExpressions(exprCastedAsBinaryOne->rhs) : std::nullopt;
             return doesLhsOperandNotContainVariableAccessWithCompileTimeConstantExpression.has_value() && doesRhsOperandNotContainVariableAccessWithCompileTimeConstantExpression ? std::make_optional(*doesLhsOperandNotContainVariableAccessWithCompileTimeConstantExpression && *doesRhsOperandNotContainVariableAccessWithCompileTimeConstantExpression) : std::nullopt;
         }
-        if (const auto& exprCastedAsUnaryOne = std::dynamic_pointer_cast<UnaryExpression>(expr); exprCastedAsUnaryOne != nullptr) {
+        if (const auto& exprCastedAsUnaryOne = expressionPointerCast<UnaryExpression>(expr); exprCastedAsUnaryOne != nullptr) {
             return doesExpressionNotContainVariableAccessWithCompileTimeConstantExpressions(exprCastedAsUnaryOne->expr);
         }
-        if (const auto& exprCastedAsShiftOne = std::dynamic_pointer_cast<ShiftExpression>(expr); exprCastedAsShiftOne != nullptr) {
+        if (const auto& exprCastedAsShiftOne = expressionPointerCast<ShiftExpression>(expr); exprCastedAsShiftOne != nullptr) {
             return doesExpressionNotContainVariableAccessWithCompileTimeConstantExpressions(exprCastedAsShiftOne->lhs);
         }
-        if (const auto& exprCastedAsVariableOne = std::dynamic_pointer_cast<VariableExpression>(expr); exprCastedAsVariableOne != nullptr) {
+        if (const auto& exprCastedAsVariableOne = expressionPointerCast<VariableExpression>(expr); exprCastedAsVariableOne != nullptr) {
             return doesVariableAccessNotContainCompileTimeconstantExpressions(exprCastedAsVariableOne->var);
         }
-        if (const auto& exprAsNumericOne = std::dynamic_pointer_cast<NumericExpression>(expr); exprAsNumericOne != nullptr) {
+        if (const auto& exprAsNumericOne = expressionPointerCast<NumericExpression>(expr); exprAsNumericOne != nullptr) {
             return true;
         }
         return false;
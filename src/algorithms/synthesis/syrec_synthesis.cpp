@@ -10,14 +10,31 @@
 
 #include "algorithms/synthesis/syrec_synthesis.hpp"
 
+#include "algorithms/optimization/ancillary_qubit_recycling.hpp"
+#include "algorithms/optimization/optimization_pass_manager.hpp"
+#include "algorithms/optimization/value_range_analysis.hpp"
+#include "algorithms/optimization/variable_usage_analysis.hpp"
+#include "algorithms/synthesis/adder_synthesis.hpp"
+#include "algorithms/synthesis/ancillary_qubit_pool.hpp"
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "algorithms/synthesis/expression_synthesis_cache.hpp"
 #include "algorithms/synthesis/first_variable_qubit_offset_lookup.hpp"
 #include "algorithms/synthesis/internal_qubit_label_builder.hpp"
+#include "algorithms/synthesis/module_call_synthesis_cache.hpp"
+#include "algorithms/synthesis/resource_estimation.hpp"
 #include "algorithms/synthesis/statement_execution_order_stack.hpp"
+#include "algorithms/synthesis/synthesis_trace_recorder.hpp"
 #include "core/annotatable_quantum_computation.hpp"
 #include "core/configurable_options.hpp"
+#include "core/diagnostics.hpp"
+#include "core/executor.hpp"
+#include "core/progress_reporting.hpp"
 #include "core/qubit_inlining_stack.hpp"
 #include "core/statistics.hpp"
+#include "core/syrec/compiled_number.hpp"
 #include "core/syrec/expression.hpp"
+#include "core/syrec/ir_memory_usage.hpp"
+#include "core/syrec/module.hpp"
 #include "core/syrec/number.hpp"
 #include "core/syrec/parser/utils/syrec_operation_utils.hpp"
 #include "core/syrec/program.hpp"
@@ -25,6 +42,8 @@
 #include "core/syrec/variable.hpp"
 #include "ir/Definitions.hpp"
 #include "ir/operations/Control.hpp"
+#include "ir/operations/OpType.hpp"
+#include "ir/operations/Operation.hpp"
 
 #include <algorithm>
 #include <bit>
@@ -34,17 +53,20 @@
 #include <cstdint>
 #include <functional>
 #include <ios>
-#include <iostream>
 #include <iterator>
+#include <map>
 #include <memory>
 #include <numeric>
 #include <optional>
+#include <ostream>
 #include <ranges>
 #include <regex>
+#include <span>
 #include <stack>
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -55,6 +77,43 @@ namespace {
      */
     using TimeStamp = std::chrono::time_point<std::chrono::steady_clock>;
 
+    /*
+     * Determine the gate type of a quantum operation as the name of its operation type prefixed by its control qubits (i.e. 'x', 'cx', 'ccx', 'c3x', ...).
+     */
+    [[nodiscard]] std::string determineGateTypeOfQuantumOperation(const qc::Operation& quantumOperation) {
+        const std::size_t numControlQubits = quantumOperation.getNcontrols();
+        const std::string nameOfOperationType = qc::toString(quantumOperation.getType());
+        if (numControlQubits <= 2U) {
+            return std::string(numControlQubits, 'c') + nameOfOperationType;
+        }
+        return "c" + std::to_string(numControlQubits) + nameOfOperationType;
+    }
+
+    /*
+     * Determine the kind of a statement used as the name of its event in the trace of the synthesis.
+     */
+    [[maybe_unused]] [[nodiscard]] std::string_view determineKindOfStatement(const syrec::Statement& statement) {
+        switch (statement.getKind()) {
+            case syrec::Statement::Kind::Assign:
+                return "AssignStatement";
+            case syrec::Statement::Kind::Unary:
+                return "UnaryStatement";
+            case syrec::Statement::Kind::Swap:
+                return "SwapStatement";
+            case syrec::Statement::Kind::If:
+                return "IfStatement";
+            case syrec::Statement::Kind::For:
+                return "ForStatement";
+            case syrec::Statement::Kind::Call:
+                return "CallStatement";
+            case syrec::Statement::Kind::Uncall:
+                return "UncallStatement";
+            case syrec::Statement::Kind::Skip:
+                return "SkipStatement";
+        }
+        return "Statement";
+    }
+
     [[nodiscard]] bool isMoreThanOneModuleMatchingIdentifierDeclared(const syrec::Module::vec& modulesToCheck, const std::string_view& moduleIdentifierToFind) {
         return std::ranges::count_if(modulesToCheck, [moduleIdentifierToFind](const syrec::Module::ptr& moduleToCheck) { return moduleToCheck->name == moduleIdentifierToFind; }) > 1;
     }
@@ -94,7 +153,7 @@ namespace {
 
     [[nodiscard]] bool checkIfQubitsMatchAndStoreResultInRhsOperandQubits(syrec::AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<qc::Qubit>& lhsOperand, const std::vector<qc::Qubit>& rhsOperand, bool clearResultFromRhsOperand = false) {
         if (lhsOperand.size() != rhsOperand.size()) {
-            std::cerr << "Can only compare two qubit sequences if they contained the same number of qubits, lhs operand contained: " << std::to_string(lhsOperand.size()) << " qubits while the rhs operand contained " << std::to_string(rhsOperand.size()) << "\n";
+            syrec::getErrorStream() << "Can only compare two qubit sequences if they contained the same number of qubits, lhs operand contained: " << std::to_string(lhsOperand.size()) << " qubits while the rhs operand contained " << std::to_string(rhsOperand.size()) << "\n";
             return false;
         }
         bool synthesisOk = true;
@@ -123,6 +182,30 @@ namespace {
         return binaryOperation == syrec::BinaryExpression::BinaryOperation::LogicalAnd || binaryOperation == syrec::BinaryExpression::BinaryOperation::LogicalOr;
     }
 
+    [[nodiscard]] constexpr bool isBinaryOperationSpecializedForConstantOperand(const syrec::BinaryExpression::BinaryOperation binaryOperation) {
+        switch (binaryOperation) {
+            case syrec::BinaryExpression::BinaryOperation::Multiply:
+            case syrec::BinaryExpression::BinaryOperation::Equals:
+            case syrec::BinaryExpression::BinaryOperation::NotEquals:
+            case syrec::BinaryExpression::BinaryOperation::LessThan:
+            case syrec::BinaryExpression::BinaryOperation::GreaterThan:
+            case syrec::BinaryExpression::BinaryOperation::LessEquals:
+            case syrec::BinaryExpression::BinaryOperation::GreaterEquals:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    [[nodiscard]] constexpr bool isBinaryOperationRelationalOperation(const syrec::BinaryExpression::BinaryOperation binaryOperation) {
+        return binaryOperation != syrec::BinaryExpression::BinaryOperation::Multiply && isBinaryOperationSpecializedForConstantOperand(binaryOperation);
+    }
+
+    // The line aware synthesis computes these operations in the qubits of their operands, which are reverted using all of their qubits.
+    [[nodiscard]] constexpr bool isBinaryOperationSynthesizedInQubitsOfOperands(const syrec::BinaryExpression::BinaryOperation binaryOperation) {
+        return binaryOperation == syrec::BinaryExpression::BinaryOperation::Add || binaryOperation == syrec::BinaryExpression::BinaryOperation::Subtract || binaryOperation == syrec::BinaryExpression::BinaryOperation::Exor;
+    }
+
     [[nodiscard]] std::optional<std::size_t> determinePositionOfFirstOneBitInValueStartingFromLSB(unsigned value) {
         if (value == 0) {
             return std::nullopt;
@@ -138,6 +221,271 @@ namespace {
         }
         return positionOfFirstOneBit;
     }
+
+    /**
+     * Determine whether the value of a number depends on the value of a loop variable.
+     * @param number The number to check.
+     * @param loopVariable The identifier of the loop variable.
+     * @return Whether the value of the number depends on the loop variable, std::nullopt if the value of the number is not an affine function of the loop variable.
+     */
+    [[nodiscard]] std::optional<bool> doesNumberDependAffinelyOnLoopVariable(const syrec::Number& number, const std::string& loopVariable) {
+        if (number.isConstant()) {
+            return false;
+        }
+        if (number.isLoopVariable()) {
+            return number.variableName() == loopVariable;
+        }
+
+        const std::optional<syrec::Number::ConstantExpression> constantExpression = number.isConstantExpression() ? number.constantExpression() : std::nullopt;
+        if (!constantExpression.has_value() || constantExpression->lhsOperand == nullptr || constantExpression->rhsOperand == nullptr) {
+            return std::nullopt;
+        }
+
+        const std::optional<bool> doesLhsOperandDependOnLoopVariable = doesNumberDependAffinelyOnLoopVariable(*constantExpression->lhsOperand, loopVariable);
+        const std::optional<bool> doesRhsOperandDependOnLoopVariable = doesNumberDependAffinelyOnLoopVariable(*constantExpression->rhsOperand, loopVariable);
+        if (!doesLhsOperandDependOnLoopVariable.has_value() || !doesRhsOperandDependOnLoopVariable.has_value()) {
+            return std::nullopt;
+        }
+
+        switch (constantExpression->operation) {
+            case syrec::Number::ConstantExpression::Operation::Addition:
+            case syrec::Number::ConstantExpression::Operation::Subtraction:
+                return *doesLhsOperandDependOnLoopVariable || *doesRhsOperandDependOnLoopVariable;
+            case syrec::Number::ConstantExpression::Operation::Multiplication:
+                return *doesLhsOperandDependOnLoopVariable && *doesRhsOperandDependOnLoopVariable ? std::nullopt : std::make_optional(*doesLhsOperandDependOnLoopVariable || *doesRhsOperandDependOnLoopVariable);
+            case syrec::Number::ConstantExpression::Operation::Division:
+                return *doesLhsOperandDependOnLoopVariable || *doesRhsOperandDependOnLoopVariable ? std::nullopt : std::make_optional(false);
+        }
+        return std::nullopt;
+    }
+
+    [[nodiscard]] bool isNumberIndependentOfLoopVariable(const syrec::Number& number, const std::string& loopVariable) {
+        const std::optional<bool> doesNumberDependOnLoopVariable = doesNumberDependAffinelyOnLoopVariable(number, loopVariable);
+        return doesNumberDependOnLoopVariable.has_value() && !*doesNumberDependOnLoopVariable;
+    }
+
+    [[nodiscard]] bool collectVariableAccessesWithLoopVariableOnlyUsedInAffineIndices(const syrec::Expression::ptr& expression, const std::string& loopVariable, std::vector<syrec::VariableAccess::ptr>& variableAccesses);
+
+    /**
+     * Collect a variable access, and the variable accesses defined in its indices, while checking that the loop variable is only used in the indices of the variable access evaluable at compile time as an affine function of the loop variable.
+     * @param variableAccess The variable access to check.
+     * @param loopVariable The identifier of the loop variable.
+     * @param variableAccesses The container storing the collected variable accesses.
+     * @return Whether the loop variable is only used as an affine function in the compile time constant indices of the variable access.
+     */
+    [[nodiscard]] bool collectVariableAccessesWithLoopVariableOnlyUsedInAffineIndices(const syrec::VariableAccess::ptr& variableAccess, const std::string& loopVariable, std::vector<syrec::VariableAccess::ptr>& variableAccesses) {
+        if (variableAccess == nullptr || variableAccess->var == nullptr) {
+            return false;
+        }
+        variableAccesses.emplace_back(variableAccess);
+
+        if (variableAccess->range.has_value() && (variableAccess->range->first == nullptr || variableAccess->range->second == nullptr || !doesNumberDependAffinelyOnLoopVariable(*variableAccess->range->first, loopVariable).has_value() || !doesNumberDependAffinelyOnLoopVariable(*variableAccess->range->second, loopVariable).has_value())) {
+            return false;
+        }
+
+        // The qubits of an element accessed with an index not evaluable at compile time are selected with quantum operations depending on the value of the compile time constant indices, thus the loop variable can only be used in the indices of the dimension access if all of them are evaluable at compile time.
+        const bool containsOnlyNumericIndices = std::ranges::all_of(variableAccess->indexes, [](const syrec::Expression::ptr& index) { return syrec::expressionPointerCast<syrec::NumericExpression>(index) != nullptr; });
+        return std::ranges::all_of(variableAccess->indexes, [&](const syrec::Expression::ptr& index) {
+            if (const auto& indexAsNumericExpression = syrec::expressionPointerCast<syrec::NumericExpression>(index); indexAsNumericExpression != nullptr) {
+                if (indexAsNumericExpression->value == nullptr) {
+                    return false;
+                }
+                return containsOnlyNumericIndices ? doesNumberDependAffinelyOnLoopVariable(*indexAsNumericExpression->value, loopVariable).has_value() : isNumberIndependentOfLoopVariable(*indexAsNumericExpression->value, loopVariable);
+            }
+            return collectVariableAccessesWithLoopVariableOnlyUsedInAffineIndices(index, loopVariable, variableAccesses);
+        });
+    }
+
+    /**
+     * Collect the variable accesses of an expression while checking that the loop variable is only used as an affine function in the compile time constant indices of said variable accesses.
+     * @param expression The expression to check.
+     * @param loopVariable The identifier of the loop variable.
+     * @param variableAccesses The container storing the collected variable accesses.
+     * @return Whether the loop variable is only used as an affine function in the compile time constant indices of the variable accesses of the expression.
+     */
+    [[nodiscard]] bool collectVariableAccessesWithLoopVariableOnlyUsedInAffineIndices(const syrec::Expression::ptr& expression, const std::string& loopVariable, std::vector<syrec::VariableAccess::ptr>& variableAccesses) {
+        if (const auto* const numericExpression = syrec::expressionCast<syrec::NumericExpression>(expression.get()); numericExpression != nullptr) {
+            return numericExpression->value != nullptr && isNumberIndependentOfLoopVariable(*numericExpression->value, loopVariable);
+        }
+        if (const auto* const variableExpression = syrec::expressionCast<syrec::VariableExpression>(expression.get()); variableExpression != nullptr) {
+            return collectVariableAccessesWithLoopVariableOnlyUsedInAffineIndices(variableExpression->var, loopVariable, variableAccesses);
+        }
+        if (const auto* const binaryExpression = syrec::expressionCast<syrec::BinaryExpression>(expression.get()); binaryExpression != nullptr) {
+            return collectVariableAccessesWithLoopVariableOnlyUsedInAffineIndices(binaryExpression->lhs, loopVariable, variableAccesses) && collectVariableAccessesWithLoopVariableOnlyUsedInAffineIndices(binaryExpression->rhs, loopVariable, variableAccesses);
+        }
+        if (const auto* const shiftExpression = syrec::expressionCast<syrec::ShiftExpression>(expression.get()); shiftExpression != nullptr) {
+            return shiftExpression->rhs != nullptr && isNumberIndependentOfLoopVariable(*shiftExpression->rhs, loopVariable) && collectVariableAccessesWithLoopVariableOnlyUsedInAffineIndices(shiftExpression->lhs, loopVariable, variableAccesses);
+        }
+        if (const auto* const unaryExpression = syrec::expressionCast<syrec::UnaryExpression>(expression.get()); unaryExpression != nullptr) {
+            return collectVariableAccessesWithLoopVariableOnlyUsedInAffineIndices(unaryExpression->expr, loopVariable, variableAccesses);
+        }
+        return false;
+    }
+
+    /**
+     * Collect the variable accesses of a statement while checking that the loop variable is only used as an affine function in the compile time constant indices of said variable accesses.
+     * @param statement The statement to check.
+     * @param loopVariable The identifier of the loop variable.
+     * @param variableAccesses The container storing the collected variable accesses.
+     * @return Whether the loop variable is only used as an affine function in the compile time constant indices of the variable accesses of the statement. Loops and calls/uncalls of modules are not supported.
+     */
+    [[nodiscard]] bool collectVariableAccessesWithLoopVariableOnlyUsedInAffineIndices(const syrec::Statement::ptr& statement, const std::string& loopVariable, std::vector<syrec::VariableAccess::ptr>& variableAccesses) {
+        if (syrec::statementCast<syrec::SkipStatement>(statement.get()) != nullptr) {
+            return true;
+        }
+        if (const auto* const swapStatement = syrec::statementCast<syrec::SwapStatement>(statement.get()); swapStatement != nullptr) {
+            return collectVariableAccessesWithLoopVariableOnlyUsedInAffineIndices(swapStatement->lhs, loopVariable, variableAccesses) && collectVariableAccessesWithLoopVariableOnlyUsedInAffineIndices(swapStatement->rhs, loopVariable, variableAccesses);
+        }
+        if (const auto* const unaryStatement = syrec::statementCast<syrec::UnaryStatement>(statement.get()); unaryStatement != nullptr) {
+            return collectVariableAccessesWithLoopVariableOnlyUsedInAffineIndices(unaryStatement->var, loopVariable, variableAccesses);
+        }
+        if (const auto* const assignStatement = syrec::statementCast<syrec::AssignStatement>(statement.get()); assignStatement != nullptr) {
+            return collectVariableAccessesWithLoopVariableOnlyUsedInAffineIndices(assignStatement->lhs, loopVariable, variableAccesses) && collectVariableAccessesWithLoopVariableOnlyUsedInAffineIndices(assignStatement->rhs, loopVariable, variableAccesses);
+        }
+        if (const auto* const ifStatement = syrec::statementCast<syrec::IfStatement>(statement.get()); ifStatement != nullptr) {
+            const auto collectVariableAccessesOfBranchStatement = [&](const syrec::Statement::ptr& branchStatement) { return collectVariableAccessesWithLoopVariableOnlyUsedInAffineIndices(branchStatement, loopVariable, variableAccesses); };
+            return collectVariableAccessesWithLoopVariableOnlyUsedInAffineIndices(ifStatement->condition, loopVariable, variableAccesses) && collectVariableAccessesWithLoopVariableOnlyUsedInAffineIndices(ifStatement->fiCondition, loopVariable, variableAccesses) && std::ranges::all_of(ifStatement->thenStatements, collectVariableAccessesOfBranchStatement) && std::ranges::all_of(ifStatement->elseStatements, collectVariableAccessesOfBranchStatement);
+        }
+        return false;
+    }
+
+    void collectIdentifiersOfAccessedVariables(const syrec::Expression::ptr& expression, std::unordered_set<std::string>& identifiersOfAccessedVariables);
+
+    void collectIdentifiersOfAccessedVariables(const syrec::VariableAccess::ptr& variableAccess, std::unordered_set<std::string>& identifiersOfAccessedVariables) {
+        if (variableAccess == nullptr || variableAccess->var == nullptr) {
+            return;
+        }
+        identifiersOfAccessedVariables.emplace(variableAccess->var->name);
+        for (const syrec::Expression::ptr& index: variableAccess->indexes) {
+            collectIdentifiersOfAccessedVariables(index, identifiersOfAccessedVariables);
+        }
+    }
+
+    void collectIdentifiersOfAccessedVariables(const syrec::Expression::ptr& expression, std::unordered_set<std::string>& identifiersOfAccessedVariables) {
+        if (const auto* const variableExpression = syrec::expressionCast<syrec::VariableExpression>(expression.get()); variableExpression != nullptr) {
+            collectIdentifiersOfAccessedVariables(variableExpression->var, identifiersOfAccessedVariables);
+        } else if (const auto* const binaryExpression = syrec::expressionCast<syrec::BinaryExpression>(expression.get()); binaryExpression != nullptr) {
+            collectIdentifiersOfAccessedVariables(binaryExpression->lhs, identifiersOfAccessedVariables);
+            collectIdentifiersOfAccessedVariables(binaryExpression->rhs, identifiersOfAccessedVariables);
+        } else if (const auto* const shiftExpression = syrec::expressionCast<syrec::ShiftExpression>(expression.get()); shiftExpression != nullptr) {
+            collectIdentifiersOfAccessedVariables(shiftExpression->lhs, identifiersOfAccessedVariables);
+        } else if (const auto* const unaryExpression = syrec::expressionCast<syrec::UnaryExpression>(expression.get()); unaryExpression != nullptr) {
+            collectIdentifiersOfAccessedVariables(unaryExpression->expr, identifiersOfAccessedVariables);
+        }
+    }
+
+    /**
+     * Collect the identifiers of the variables accessed by a statement, including the variables passed as arguments to a called/uncalled module and the variables accessed by nested statements.
+     * Variables that are only read are also collected since the synthesis of an expression can temporarily modify the qubits of its operands.
+     * @param statement The statement to check.
+     * @param identifiersOfAccessedVariables The container storing the collected identifiers.
+     * @return Whether the variables accessed by the statement could be determined.
+     */
+    [[nodiscard]] bool collectIdentifiersOfAccessedVariables(const syrec::Statement::ptr& statement, std::unordered_set<std::string>& identifiersOfAccessedVariables) {
+        const auto collectIdentifiersOfAccessedVariablesOfNestedStatement = [&](const syrec::Statement::ptr& nestedStatement) { return collectIdentifiersOfAccessedVariables(nestedStatement, identifiersOfAccessedVariables); };
+        if (syrec::statementCast<syrec::SkipStatement>(statement.get()) != nullptr) {
+            return true;
+        }
+        if (const auto* const swapStatement = syrec::statementCast<syrec::SwapStatement>(statement.get()); swapStatement != nullptr) {
+            collectIdentifiersOfAccessedVariables(swapStatement->lhs, identifiersOfAccessedVariables);
+            collectIdentifiersOfAccessedVariables(swapStatement->rhs, identifiersOfAccessedVariables);
+            return true;
+        }
+        if (const auto* const unaryStatement = syrec::statementCast<syrec::UnaryStatement>(statement.get()); unaryStatement != nullptr) {
+            collectIdentifiersOfAccessedVariables(unaryStatement->var, identifiersOfAccessedVariables);
+            return true;
+        }
+        if (const auto* const assignStatement = syrec::statementCast<syrec::AssignStatement>(statement.get()); assignStatement != nullptr) {
+            collectIdentifiersOfAccessedVariables(assignStatement->lhs, identifiersOfAccessedVariables);
+            collectIdentifiersOfAccessedVariables(assignStatement->rhs, identifiersOfAccessedVariables);
+            return true;
+        }
+        if (const auto* const ifStatement = syrec::statementCast<syrec::IfStatement>(statement.get()); ifStatement != nullptr) {
+            collectIdentifiersOfAccessedVariables(ifStatement->condition, identifiersOfAccessedVariables);
+            collectIdentifiersOfAccessedVariables(ifStatement->fiCondition, identifiersOfAccessedVariables);
+            return std::ranges::all_of(ifStatement->thenStatements, collectIdentifiersOfAccessedVariablesOfNestedStatement) && std::ranges::all_of(ifStatement->elseStatements, collectIdentifiersOfAccessedVariablesOfNestedStatement);
+        }
+        if (const auto* const forStatement = syrec::statementCast<syrec::ForStatement>(statement.get()); forStatement != nullptr) {
+            return std::ranges::all_of(forStatement->statements, collectIdentifiersOfAccessedVariablesOfNestedStatement);
+        }
+        // A called/uncalled module can only access the variables passed as arguments to its parameters.
+        if (const auto* const callStatement = syrec::statementCast<syrec::CallStatement>(statement.get()); callStatement != nullptr) {
+            identifiersOfAccessedVariables.insert(callStatement->parameters.cbegin(), callStatement->parameters.cend());
+            return true;
+        }
+        if (const auto* const uncallStatement = syrec::statementCast<syrec::UncallStatement>(statement.get()); uncallStatement != nullptr) {
+            identifiersOfAccessedVariables.insert(uncallStatement->parameters.cbegin(), uncallStatement->parameters.cend());
+            return true;
+        }
+        return false;
+    }
+
+    [[nodiscard]] bool doesVariableAccessOnlyConsistOfConstantIndices(const syrec::VariableAccess& variableAccess) {
+        const auto isConstantNumber = [](const syrec::Number::ptr& number) { return number != nullptr && number->isConstant(); };
+        if (variableAccess.range.has_value() && (!isConstantNumber(variableAccess.range->first) || !isConstantNumber(variableAccess.range->second))) {
+            return false;
+        }
+        return std::ranges::all_of(variableAccess.indexes, [&](const syrec::Expression::ptr& index) {
+            const auto* const indexAsNumericExpression = syrec::expressionCast<syrec::NumericExpression>(index.get());
+            return indexAsNumericExpression != nullptr && isConstantNumber(indexAsNumericExpression->value);
+        });
+    }
+
+    /*
+     * The annotations and the inlined qubit information of the quantum operations and qubits of a group of independent statements as well as the qubit permutations and traces recorded during the synthesis of the group
+     * cannot be transferred to the synthesized quantum computation while the qubit budget of the hybrid synthesis cannot be split between the groups.
+     */
+    [[nodiscard]] bool canIndependentStatementsBeSynthesizedConcurrently(const syrec::ConfigurableOptions& settings) {
+        return !settings.generateQuantumOperationAnnotations && !settings.generatedInlinedQubitDebugInformation && !settings.trackUnconditionalSwapsAsQubitPermutation && !settings.optionalSynthesisTraceFilePath.has_value() && !settings.qubitBudgetOfHybridSynthesis.has_value();
+    }
+
+    /*
+     * Partition statements into groups such that no statement of a group accesses a variable modified by a statement of another group. The groups are ordered by their first statement while the statements of a group are kept in their original order.
+     */
+    [[nodiscard]] std::vector<syrec::Statement::vec> determineGroupsOfIndependentStatements(const syrec::Statement::vec& statements) {
+        std::vector<syrec::UsagesOfStatements>       usagesPerStatement(statements.size());
+        std::unordered_map<std::string, std::size_t> firstStatementModifyingVariable;
+        for (std::size_t i = 0; i < statements.size(); ++i) {
+            syrec::collectUsagesOfStatements({statements[i]}, usagesPerStatement[i]);
+            for (const auto& [variableIdentifier, usage]: usagesPerStatement[i].variables) {
+                if (usage.isModified || usage.isPassedToModule) {
+                    firstStatementModifyingVariable.try_emplace(variableIdentifier, i);
+                }
+            }
+        }
+
+        // Every statement accessing a modified variable is merged with the group of the first statement modifying the variable, with the representative of a group being its first statement.
+        std::vector<std::size_t> representativeOfStatement(statements.size());
+        std::iota(representativeOfStatement.begin(), representativeOfStatement.end(), 0U);
+        const auto findRepresentative = [&representativeOfStatement](std::size_t statementIndex) {
+            while (representativeOfStatement[statementIndex] != statementIndex) {
+                representativeOfStatement[statementIndex] = representativeOfStatement[representativeOfStatement[statementIndex]];
+                statementIndex                            = representativeOfStatement[statementIndex];
+            }
+            return statementIndex;
+        };
+
+        for (std::size_t i = 0; i < statements.size(); ++i) {
+            for (const std::string& variableIdentifier: usagesPerStatement[i].variables | std::views::keys) {
+                if (const auto& firstModifyingStatement = firstStatementModifyingVariable.find(variableIdentifier); firstModifyingStatement != firstStatementModifyingVariable.end()) {
+                    const std::size_t representativeOfCurrentGroup   = findRepresentative(i);
+                    const std::size_t representativeOfModifyingGroup = findRepresentative(firstModifyingStatement->second);
+                    representativeOfStatement[std::max(representativeOfCurrentGroup, representativeOfModifyingGroup)] = std::min(representativeOfCurrentGroup, representativeOfModifyingGroup);
+                }
+            }
+        }
+
+        std::vector<syrec::Statement::vec>           groups;
+        std::unordered_map<std::size_t, std::size_t> groupIndexOfRepresentative;
+        for (std::size_t i = 0; i < statements.size(); ++i) {
+            const auto& [groupIndex, isNewGroup] = groupIndexOfRepresentative.try_emplace(findRepresentative(i), groups.size());
+            if (isNewGroup) {
+                groups.emplace_back();
+            }
+            groups[groupIndex->second].emplace_back(statements[i]);
+        }
+        return groups;
+    }
 } // namespace
 
 namespace syrec {
@@ -155,34 +503,34 @@ namespace syrec {
 
     bool SyrecSynthesis::synthesize(SyrecSynthesis* synthesizer, const Program& program, const ConfigurableOptions& settings, Statistics* optionalRecordedStatistics) {
         if (synthesizer == nullptr) {
-            std::cerr << "Please use a valid synthesizer instance when trying to synthesis a SyReC program\n";
+            getErrorStream() << "Please use a valid synthesizer instance when trying to synthesis a SyReC program\n";
             return false;
         }
 
-        if (synthesizer->annotatableQuantumComputation.getNops() != 0 || synthesizer->annotatableQuantumComputation.getNqubits() != 0) {
-            std::cerr << "Annotatable quantum computation must be empty prior to the synthesis of a SyReC program\n";
+        if (synthesizer->annotatableQuantumComputation.getNumQuantumOperations() != 0 || synthesizer->annotatableQuantumComputation.getNqubits() != 0) {
+            getErrorStream() << "Annotatable quantum computation must be empty prior to the synthesis of a SyReC program\n";
             return false;
         }
 
         if (settings.generateQuantumOperationAnnotations != synthesizer->annotatableQuantumComputation.isGenerationOfQuantumOperationAnnotationsEnabled()) {
             // We could have also used a simple function to stringify boolean values
-            std::cerr << "Configuration of generation of quantum gate annotations flag did not match between synthesizer (value: " << std::boolalpha << settings.generateQuantumOperationAnnotations << ") and annotatable quantum computation (value: " << synthesizer->annotatableQuantumComputation.isGenerationOfQuantumOperationAnnotationsEnabled() << std::noboolalpha << ")\n";
+            getErrorStream() << "Configuration of generation of quantum gate annotations flag did not match between synthesizer (value: " << std::boolalpha << settings.generateQuantumOperationAnnotations << ") and annotatable quantum computation (value: " << synthesizer->annotatableQuantumComputation.isGenerationOfQuantumOperationAnnotationsEnabled() << std::noboolalpha << ")\n";
             return false;
         }
 
         if (synthesizer->statementExecutionOrderStack->getCurrentAggregateStatementExecutionOrderState() != StatementExecutionOrderStack::StatementExecutionOrder::Sequential) {
-            std::cerr << "Execution order at start of synthesis should be sequential\n";
+            getErrorStream() << "Execution order at start of synthesis should be sequential\n";
             return false;
         }
 
         if (synthesizer->firstVariableQubitOffsetLookup == nullptr) {
-            std::cerr << "Internal lookup for offsets to first qubits of variables was not initialized correctly\n";
+            getErrorStream() << "Internal lookup for offsets to first qubits of variables was not initialized correctly\n";
             return false;
         }
 
         const Module::vec& programModules = program.modules();
         if (programModules.empty()) {
-            std::cerr << "A SyReC program must consist of at least one module\n";
+            getErrorStream() << "A SyReC program must consist of at least one module\n";
             return false;
         }
 
@@ -192,12 +540,12 @@ namespace syrec {
         if (settings.optionalProgramEntryPointModuleIdentifier.has_value()) {
             expectedMainModuleIdentifier = settings.optionalProgramEntryPointModuleIdentifier;
             if (expectedMainModuleIdentifier.value().empty()) {
-                std::cerr << "Expected main module identifier defined in synthesis settings must have a value\n";
+                getErrorStream() << "Expected main module identifier defined in synthesis settings must have a value\n";
                 return false;
             }
             const std::regex expectedMainModuleIdentifierValidationRegex("^(_|[a-zA-Z])+\\w*");
             if (!std::regex_match(*expectedMainModuleIdentifier, expectedMainModuleIdentifierValidationRegex)) {
-                std::cerr << "Expected main module identifier defined in synthesis settings '" << *expectedMainModuleIdentifier << "' did not defined a valid identifier according to the SyReC grammar, check your inputs!\n";
+                getErrorStream() << "Expected main module identifier defined in synthesis settings '" << *expectedMainModuleIdentifier << "' did not defined a valid identifier according to the SyReC grammar, check your inputs!\n";
                 return false;
             }
         } else {
@@ -208,7 +556,58 @@ namespace syrec {
             }
         }
 
-        synthesizer->integerConstantTruncationOperation = settings.integerConstantTruncationOperation;
+        synthesizer->integerConstantTruncationOperation             = settings.integerConstantTruncationOperation;
+        synthesizer->moduleCallSynthesisCache                       = settings.reuseSynthesizedModuleCalls ? std::make_unique<ModuleCallSynthesisCache>() : nullptr;
+        synthesizer->replaySynthesizedLoopIterations                = settings.replaySynthesizedLoopIterations;
+        synthesizer->decodeNonConstantIndicesUsingUnaryIteration    = settings.decodeNonConstantIndicesUsingUnaryIteration;
+        synthesizer->shareIndexDecodingOfNonConstantIndices         = settings.shareIndexDecodingOfNonConstantIndices && synthesizer->canSynthesizedResultsOfExpressionsBeShared();
+        synthesizer->padDimensionsOfUnrolledIndicesToPowersOfTwo    = settings.padDimensionsOfUnrolledIndicesToPowersOfTwo;
+        synthesizer->reuseQubitOfGuardVariableNotAccessedInBranches = settings.reuseQubitOfGuardVariableNotAccessedInBranches;
+        synthesizer->combineGuardsOfNestedIfStatements              = settings.combineGuardsOfNestedIfStatements;
+        synthesizer->liftControlQubitsOfModuleCalls                 = settings.liftControlQubitsOfModuleCalls;
+        synthesizer->adderArchitecture                              = settings.adderArchitecture;
+        synthesizer->addConstantsWithoutAncillaryQubits             = settings.addConstantsWithoutAncillaryQubits;
+        synthesizer->specializeOperationsWithConstantOperand        = settings.specializeOperationsWithConstantOperand;
+        synthesizer->synthesizeShiftsByRelabelingQubits             = settings.synthesizeShiftsByRelabelingQubits && synthesizer->canSynthesizedResultsOfExpressionsBeShared();
+        synthesizer->trackUnconditionalSwapsAsQubitPermutation      = settings.trackUnconditionalSwapsAsQubitPermutation;
+        synthesizer->foldNegationsIntoNegativeControls              = settings.foldNegationsIntoNegativeControls;
+        synthesizer->narrowOperationsUsingValueRangeAnalysis        = settings.narrowOperationsUsingValueRangeAnalysis;
+        synthesizer->multiplierArchitecture                         = settings.multiplierArchitecture;
+        synthesizer->dividerArchitecture                            = settings.dividerArchitecture;
+        synthesizer->shareDividerOfQuotientAndRemainder             = settings.shareDividerOfQuotientAndRemainder && synthesizer->canSynthesizedResultsOfExpressionsBeShared();
+        synthesizer->shareComparatorOfRelationalOperations          = settings.shareComparatorOfRelationalOperations && synthesizer->canSynthesizedResultsOfExpressionsBeShared();
+        synthesizer->ancillaryQubitUncomputationStrategy            = settings.ancillaryQubitUncomputationStrategy;
+        synthesizer->maxNumDeferredExpressionUncomputations         = settings.maxNumDeferredExpressionUncomputations;
+        synthesizer->expressionSynthesisCache                       = settings.shareSynthesizedCommonSubexpressions && synthesizer->canSynthesizedResultsOfExpressionsBeShared() ? std::make_unique<ExpressionSynthesisCache>() : nullptr;
+        // A reused ancillary qubit would keep the inlining information recorded for its first usage, the reuse of ancillary qubits is thus disabled if said information shall be generated.
+        synthesizer->ancillaryQubitPool                             = settings.reuseAncillaryQubitsAcrossStatements && !settings.generatedInlinedQubitDebugInformation && synthesizer->canSynthesizedResultsOfExpressionsBeShared() ? std::make_unique<AncillaryQubitPool>() : nullptr;
+        synthesizer->quantumOperationsPerModuleCall                 = settings.emitModuleCallsAsCompoundOperations && !settings.generateQuantumOperationAnnotations && !settings.synthesizeIndependentStatementsConcurrently && !synthesizer->annotatableQuantumComputation.isStreamingOfQuantumOperationsActive() ? std::make_optional(std::vector<AnnotatableQuantumComputation::QuantumOperationIndexRange>()) : std::nullopt;
+#ifdef MQT_SYREC_ENABLE_SYNTHESIS_TRACING
+        synthesizer->synthesisTraceRecorder = settings.optionalSynthesisTraceFilePath.has_value() ? std::make_unique<SynthesisTraceRecorder>() : nullptr;
+#else
+        if (settings.optionalSynthesisTraceFilePath.has_value()) {
+            getErrorStream() << "Tracing of the synthesis is not supported since the library was built without the MQT_SYREC_ENABLE_SYNTHESIS_TRACING option, no trace will be written to " << *settings.optionalSynthesisTraceFilePath << "\n";
+        }
+#endif
+        // The execution limits are checked prior to the synthesis of every statement and loop iteration.
+        synthesizer->executionLimitsMonitor = settings.executionLimits.isAnyLimitDefined() ? std::make_unique<ExecutionLimitsMonitor>(settings.executionLimits) : nullptr;
+        synthesizer->progressOfSynthesis    = ProgressReport();
+        synthesizer->progressReporter.reset();
+        if (settings.progressCallback) {
+            // The totals of the reported progress are predicted by the resource estimation whose errors are discarded since the synthesis reports the same errors itself.
+            Diagnostics      diagnosticsOfResourceEstimation;
+            ResourceEstimate resourceEstimate;
+            if (const ScopedDiagnosticsCollection diagnosticsCollection(diagnosticsOfResourceEstimation); estimateResourcesOfSynthesis(resourceEstimate, program, settings, synthesizer->getSynthesisAlgorithm())) {
+                synthesizer->progressOfSynthesis.estimatedNumStatements        = resourceEstimate.numStatements;
+                synthesizer->progressOfSynthesis.estimatedNumQuantumOperations = resourceEstimate.numQuantumOperations;
+            }
+            synthesizer->progressReporter.emplace(settings.progressCallback, std::chrono::milliseconds(settings.progressReportIntervalInMilliseconds));
+        }
+        // The resident set size is sampled after the synthesis of every statement if the memory usage of the synthesis is recorded.
+        synthesizer->residentSetSizeSampler.reset();
+        if (settings.recordMemoryUsage) {
+            synthesizer->residentSetSizeSampler.emplace();
+        }
         // Run-time measuring
         const TimeStamp simulationStartTime = std::chrono::steady_clock::now();
 
@@ -216,12 +615,12 @@ namespace syrec {
         Module::ptr main;
         if (expectedMainModuleIdentifier.has_value()) {
             if (isMoreThanOneModuleMatchingIdentifierDeclared(programModules, *expectedMainModuleIdentifier)) {
-                std::cerr << "There can be at most one module named '" << *expectedMainModuleIdentifier << "' that shall be used as the entry point of the SyReC program\n";
+                getErrorStream() << "There can be at most one module named '" << *expectedMainModuleIdentifier << "' that shall be used as the entry point of the SyReC program\n";
                 return false;
             }
             const auto& lastModuleMatchingIdentifier = std::ranges::find_if(std::ranges::reverse_view(programModules), [&expectedMainModuleIdentifier](const Module::ptr& programModule) { return programModule->name == *expectedMainModuleIdentifier; });
             if (lastModuleMatchingIdentifier == programModules.crend()) {
-                std::cerr << "If the expected main module identifier is defined using the synthesis settings ('" << *expectedMainModuleIdentifier << "') then there must be at least one module matching the defined identifier\n";
+                getErrorStream() << "If the expected main module identifier is defined using the synthesis settings ('" << *expectedMainModuleIdentifier << "') then there must be at least one module matching the defined identifier\n";
                 return false;
             }
             main = *lastModuleMatchingIdentifier;
@@ -229,7 +628,7 @@ namespace syrec {
             main = program.findModule(defaultMainModuleIdentifier);
             if (main != nullptr) {
                 if (isMoreThanOneModuleMatchingIdentifierDeclared(programModules, defaultMainModuleIdentifier)) {
-                    std::cerr << "There can be at most one module named 'main'\n";
+                    getErrorStream() << "There can be at most one module named 'main'\n";
                     return false;
                 }
             } else {
@@ -241,44 +640,203 @@ namespace syrec {
         // declare as top module
         synthesizer->setMainModule(main);
         if (settings.generatedInlinedQubitDebugInformation) {
-            auto mainModuleCallStackEntry         = QubitInliningStack::QubitInliningStackEntry();
-            mainModuleCallStackEntry.targetModule = main;
-
-            auto mainModuleInlineStack = std::make_shared<QubitInliningStack>();
-            mainModuleInlineStack->push(mainModuleCallStackEntry);
+            synthesizer->moduleCallTree                                = std::make_shared<ModuleCallTree>();
+            const std::optional<ModuleCallTree::NodeId> mainModuleNode = synthesizer->moduleCallTree->addNode(std::nullopt, main, std::nullopt, std::nullopt);
+            if (!mainModuleNode.has_value()) {
+                getErrorStream() << "Failed to create module call tree node for main module of SyReC program\n";
+                return false;
+            }
 
-            synthesizer->moduleCallStackInstances = std::vector<QubitInliningStack::ptr>();
-            synthesizer->moduleCallStackInstances->emplace_back(mainModuleInlineStack);
+            synthesizer->moduleCallStackInstances = std::vector<ModuleCallStackInstance>();
+            synthesizer->moduleCallStackInstances->emplace_back(ModuleCallStackInstance{.moduleCallTreeNodeId = *mainModuleNode, .inlineStack = std::make_shared<QubitInliningStack>(synthesizer->moduleCallTree, *mainModuleNode)});
         }
 
-        synthesizer->firstVariableQubitOffsetLookup->openNewVariableQubitOffsetScope();
+        synthesizer->firstVariableQubitOffsetLookup->openNewVariableQubitOffsetScope(main->parameters.size() + main->variables.size());
         if (!synthesizer->createQuantumRegistersForSyrecVariables(main->parameters)) {
-            std::cerr << "Failed to create qubits for parameters of main module of SyReC program\n";
+            getErrorStream() << "Failed to create qubits for parameters of main module of SyReC program\n";
             return false;
         }
 
         if (!synthesizer->createQuantumRegistersForSyrecVariables(main->variables)) {
-            std::cerr << "Failed to create qubits for local variables of main module of SyReC program\n";
+            getErrorStream() << "Failed to create qubits for local variables of main module of SyReC program\n";
             return false;
         }
 
         // synthesize the statements
-        const auto synthesisOfMainModuleOk = synthesizer->onModule(main);
+        const TimeStamp synthesisOfStatementsStartTime = std::chrono::steady_clock::now();
+        bool            synthesisOfMainModuleOk        = false;
+        {
+            SYREC_SYNTHESIS_TRACE_SCOPE(synthesizer->synthesisTraceRecorder.get(), synthesizer->annotatableQuantumComputation, "module", main->name);
+            const std::vector<Statement::vec> groupsOfIndependentStatements = settings.synthesizeIndependentStatementsConcurrently && canIndependentStatementsBeSynthesizedConcurrently(settings) ? determineGroupsOfIndependentStatements(main->statements) : std::vector<Statement::vec>();
+            synthesisOfMainModuleOk                                         = groupsOfIndependentStatements.size() > 1U ? synthesizer->synthesizeGroupsOfIndependentStatementsConcurrently(program, main, groupsOfIndependentStatements, settings) : synthesizer->onModule(main);
+        }
         synthesizer->annotatableQuantumComputation.promotePreliminaryAncillaryQubitsToDefinitiveAncillaryQubits();
+        if (synthesisOfMainModuleOk && synthesizer->trackUnconditionalSwapsAsQubitPermutation && !synthesizer->recordOutputPermutationOfVariablesOfMainModule(*main)) {
+            getErrorStream() << "Failed to record the output permutation of the variables of the main module " << main->name << "\n";
+            return false;
+        }
+        const TimeStamp synthesisOfStatementsEndTime = std::chrono::steady_clock::now();
 
         if (synthesisOfMainModuleOk && !synthesizer->firstVariableQubitOffsetLookup->closeVariableQubitOffsetScope()) {
-            std::cerr << "Failed to close qubit offset scope for parameters and local variables during cleanup after synthesis of main module " << main->name << "\n";
+            getErrorStream() << "Failed to close qubit offset scope for parameters and local variables during cleanup after synthesis of main module " << main->name << "\n";
+            return false;
+        }
+
+        // The quantum operations of the module calls are grouped prior to the cancellation and the reordering of the quantum operations since both of them change the indices of the recorded quantum operations of the module calls.
+        if (synthesisOfMainModuleOk && synthesizer->quantumOperationsPerModuleCall.has_value() && !synthesizer->annotatableQuantumComputation.groupQuantumOperationsIntoCompoundOperations(*synthesizer->quantumOperationsPerModuleCall)) {
+            getErrorStream() << "Failed to group the quantum operations synthesized for the module calls of the main module " << main->name << " into compound operations\n";
+            return false;
+        }
+
+        // The cancellation is only performed after the synthesis was completed since the synthesis records the indices of already synthesized quantum operations to be able to replay them.
+        std::size_t numCancelledQuantumOperations = 0;
+        Statistics  statisticsOfOptimizationPipeline;
+        if (synthesisOfMainModuleOk && !settings.optimizationPipeline.empty()) {
+            SYREC_SYNTHESIS_TRACE_SCOPE(synthesizer->synthesisTraceRecorder.get(), synthesizer->annotatableQuantumComputation, "optimization", "optimizationPipeline");
+            OptimizationPassManager optimizationPassManager(settings);
+            if (!optimizationPassManager.setPipeline(settings.optimizationPipeline)) {
+                getErrorStream() << "The optimization pipeline of the synthesis settings contains a pass that is not registered in the optimization pass manager\n";
+                return false;
+            }
+            if (!optimizationPassManager.run(synthesizer->annotatableQuantumComputation, &statisticsOfOptimizationPipeline)) {
+                getErrorStream() << "Failed to apply the optimization pipeline to the quantum computation synthesized for the main module " << main->name << "\n";
+                return false;
+            }
+            if (const auto statisticsOfCancellation = statisticsOfOptimizationPipeline.statisticsPerOptimizationPass.find(OptimizationPassManager::CANCEL_ADJACENT_SELF_INVERSE_QUANTUM_OPERATIONS_PASS); statisticsOfCancellation != statisticsOfOptimizationPipeline.statisticsPerOptimizationPass.end()) {
+                numCancelledQuantumOperations = statisticsOfCancellation->second.numModifications;
+            }
+        }
+        const bool applyOptimizationsEnabledByFlags = synthesisOfMainModuleOk && settings.optimizationPipeline.empty();
+        if (applyOptimizationsEnabledByFlags && settings.propagateConstantQubitValues) {
+            SYREC_SYNTHESIS_TRACE_SCOPE(synthesizer->synthesisTraceRecorder.get(), synthesizer->annotatableQuantumComputation, "optimization", "propagateConstantQubitValues");
+            static_cast<void>(synthesizer->annotatableQuantumComputation.propagateConstantQubitValues());
+        }
+        if (applyOptimizationsEnabledByFlags && settings.applyReversibleCircuitTemplates) {
+            SYREC_SYNTHESIS_TRACE_SCOPE(synthesizer->synthesisTraceRecorder.get(), synthesizer->annotatableQuantumComputation, "optimization", "applyReversibleCircuitTemplates");
+            static_cast<void>(synthesizer->annotatableQuantumComputation.applyReversibleCircuitTemplates(settings.windowSizeOfReversibleCircuitTemplates, settings.timeBudgetOfReversibleCircuitTemplatesInMilliseconds));
+        }
+        if (applyOptimizationsEnabledByFlags && settings.cancelAdjacentSelfInverseQuantumOperations) {
+            SYREC_SYNTHESIS_TRACE_SCOPE(synthesizer->synthesisTraceRecorder.get(), synthesizer->annotatableQuantumComputation, "optimization", "cancelAdjacentSelfInverseQuantumOperations");
+            numCancelledQuantumOperations = synthesizer->annotatableQuantumComputation.cancelAdjacentSelfInverseQuantumOperations();
+        }
+        if (applyOptimizationsEnabledByFlags && settings.reorderQuantumOperationsToReduceDepth) {
+            SYREC_SYNTHESIS_TRACE_SCOPE(synthesizer->synthesisTraceRecorder.get(), synthesizer->annotatableQuantumComputation, "optimization", "reorderQuantumOperationsToReduceDepth");
+            static_cast<void>(synthesizer->annotatableQuantumComputation.reorderQuantumOperationsToReduceDepth());
+        }
+        if (applyOptimizationsEnabledByFlags && settings.recycleAncillaryQubitsWithNonOverlappingLiveRanges && !synthesizer->quantumOperationsPerModuleCall.has_value() && !synthesizer->annotatableQuantumComputation.isStreamingOfQuantumOperationsActive()) {
+            SYREC_SYNTHESIS_TRACE_SCOPE(synthesizer->synthesisTraceRecorder.get(), synthesizer->annotatableQuantumComputation, "optimization", "recycleAncillaryQubits");
+            static_cast<void>(recycleAncillaryQubits(synthesizer->annotatableQuantumComputation));
+        }
+        const TimeStamp optimizationEndTime = std::chrono::steady_clock::now();
+
+        // The trace is also written if the synthesis failed to be able to determine up to which point the synthesis progressed.
+        if (synthesizer->synthesisTraceRecorder != nullptr && settings.optionalSynthesisTraceFilePath.has_value() && !synthesizer->synthesisTraceRecorder->writeChromeTraceEventJson(*settings.optionalSynthesisTraceFilePath)) {
+            getErrorStream() << "Failed to write the trace of the synthesis to " << *settings.optionalSynthesisTraceFilePath << "\n";
+            return false;
+        }
+
+        if (synthesisOfMainModuleOk && synthesizer->annotatableQuantumComputation.isStreamingOfQuantumOperationsActive() && !synthesizer->annotatableQuantumComputation.finishStreamingOfQuantumOperations()) {
+            getErrorStream() << "Failed to forward the remaining quantum operations to the quantum operation sink after the synthesis of the main module " << main->name << "\n";
             return false;
         }
 
         if (optionalRecordedStatistics != nullptr) {
-            const TimeStamp simulationEndTime                 = std::chrono::steady_clock::now();
-            const auto      simulationRunTime                 = std::chrono::duration_cast<std::chrono::milliseconds>(simulationEndTime - simulationStartTime);
-            optionalRecordedStatistics->runtimeInMilliseconds = static_cast<double>(simulationRunTime.count());
+            const TimeStamp simulationEndTime = std::chrono::steady_clock::now();
+            optionalRecordedStatistics->recordRuntime(simulationEndTime - simulationStartTime);
+            optionalRecordedStatistics->synthesisRuntimeInNanoseconds    = Statistics::toNanoseconds(synthesisOfStatementsEndTime - synthesisOfStatementsStartTime);
+            optionalRecordedStatistics->optimizationRuntimeInNanoseconds = Statistics::toNanoseconds(optimizationEndTime - synthesisOfStatementsEndTime);
+
+            optionalRecordedStatistics->numReusedAncillaryQubits            = synthesizer->ancillaryQubitPool != nullptr ? synthesizer->ancillaryQubitPool->getBorrowedQubits().size() : 0U;
+            optionalRecordedStatistics->numCancelledQuantumOperations       = numCancelledQuantumOperations;
+            optionalRecordedStatistics->numIterationsOfOptimizationPipeline = statisticsOfOptimizationPipeline.numIterationsOfOptimizationPipeline;
+            optionalRecordedStatistics->statisticsPerOptimizationPass       = std::move(statisticsOfOptimizationPipeline.statisticsPerOptimizationPass);
+            optionalRecordedStatistics->executionLimitViolation             = synthesizer->executionLimitsMonitor != nullptr ? synthesizer->executionLimitsMonitor->getViolation() : ExecutionLimitViolation::None;
+            synthesizer->recordStatisticsOfSynthesizedQuantumComputation(*optionalRecordedStatistics);
+            if (synthesizer->residentSetSizeSampler.has_value()) {
+                synthesizer->residentSetSizeSampler->sample();
+                optionalRecordedStatistics->memoryUsage.numBytesOfProgram                         = determineNumBytesOfIr(program.modules());
+                optionalRecordedStatistics->memoryUsage.residentSetSizeAtStartOfSynthesisInBytes  = synthesizer->residentSetSizeSampler->getResidentSetSizeAtStartInBytes();
+                optionalRecordedStatistics->memoryUsage.peakResidentSetSizeDuringSynthesisInBytes = synthesizer->residentSetSizeSampler->getPeakResidentSetSizeInBytes();
+                synthesizer->annotatableQuantumComputation.recordMemoryUsage(optionalRecordedStatistics->memoryUsage);
+            }
+        }
+        if (synthesizer->progressReporter.has_value()) {
+            synthesizer->progressOfSynthesis.numEmittedQuantumOperations = synthesizer->annotatableQuantumComputation.getNumQuantumOperations();
+            synthesizer->progressReporter->report(synthesizer->progressOfSynthesis);
         }
         return synthesisOfMainModuleOk;
     }
 
+    bool SyrecSynthesis::synthesizeGroupsOfIndependentStatementsConcurrently(const Program& program, const Module::ptr& module, const std::vector<Statement::vec>& groupsOfIndependentStatements, const ConfigurableOptions& settings) {
+        // Every group is synthesized as the statements of a copy of the module, thus the qubits of the parameters and local variables of the module are identical in the quantum computations of all groups and the synthesized quantum computation.
+        ConfigurableOptions settingsOfGroups                                = settings;
+        settingsOfGroups.synthesizeIndependentStatementsConcurrently        = false;
+        settingsOfGroups.propagateConstantQubitValues                       = false;
+        settingsOfGroups.applyReversibleCircuitTemplates                    = false;
+        settingsOfGroups.cancelAdjacentSelfInverseQuantumOperations         = false;
+        settingsOfGroups.reorderQuantumOperationsToReduceDepth              = false;
+        settingsOfGroups.recycleAncillaryQubitsWithNonOverlappingLiveRanges = false;
+        settingsOfGroups.optimizationPipeline.clear();
+        settingsOfGroups.emitModuleCallsAsCompoundOperations                = false;
+        settingsOfGroups.optionalProgramEntryPointModuleIdentifier          = module->name;
+        settingsOfGroups.progressCallback                                   = nullptr;
+
+        std::vector<Program>           programsOfGroups(groupsOfIndependentStatements.size());
+        std::vector<BatchSynthesisJob> jobs;
+        jobs.reserve(groupsOfIndependentStatements.size());
+        for (std::size_t i = 0; i < groupsOfIndependentStatements.size(); ++i) {
+            const auto moduleOfGroup  = std::make_shared<Module>(module->name);
+            moduleOfGroup->parameters = module->parameters;
+            moduleOfGroup->variables  = module->variables;
+            moduleOfGroup->statements = groupsOfIndependentStatements[i];
+            for (const Module::ptr& programModule: program.modules()) {
+                programsOfGroups[i].addModule(programModule == module ? moduleOfGroup : programModule);
+            }
+            jobs.emplace_back(BatchSynthesisJob{.program = &programsOfGroups[i], .settings = settingsOfGroups, .synthesisAlgorithm = getSynthesisAlgorithm()});
+        }
+
+        if (settings.pinWorkerThreadsToCores) {
+            Executor::getShared().pinWorkerThreadsToCores();
+        }
+        std::vector<BatchSynthesisResult> results;
+        batchSynthesis(results, jobs, settings.numThreadsOfConcurrentSynthesis != 0U ? settings.numThreadsOfConcurrentSynthesis : settings.maxNumThreads, settings.deterministicParallelExecution);
+
+        const auto numQubitsOfVariables = static_cast<qc::Qubit>(annotatableQuantumComputation.getNqubits());
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            const BatchSynthesisResult& resultOfGroup = results[i];
+            for (const std::string& errorMessage: resultOfGroup.diagnostics.getErrorMessages()) {
+                getErrorStream() << errorMessage << "\n";
+            }
+            if (!resultOfGroup.synthesisOk || resultOfGroup.annotatableQuantumComputation == nullptr || resultOfGroup.annotatableQuantumComputation->getNqubits() < numQubitsOfVariables) {
+                if (executionLimitsMonitor != nullptr && resultOfGroup.statistics.executionLimitViolation != ExecutionLimitViolation::None) {
+                    executionLimitsMonitor->adoptViolationOfNestedComputation(resultOfGroup.statistics.executionLimitViolation);
+                }
+                getErrorStream() << "Failed to synthesize group " << std::to_string(i) << " of independent statements of module " << module->name << "\n";
+                return false;
+            }
+
+            // The ancillary qubits of every group are mapped to new ancillary qubits since the ancillary qubits of a group are not necessarily reset after the synthesis of its statements. Ancillary qubits initialized to '1' were already toggled by a quantum operation of the group.
+            const AnnotatableQuantumComputation&                                annotatableQuantumComputationOfGroup = *resultOfGroup.annotatableQuantumComputation;
+            const std::size_t                                                   numAncillaryQubitsOfGroup            = annotatableQuantumComputationOfGroup.getNqubits() - numQubitsOfVariables;
+            std::vector<AnnotatableQuantumComputation::QubitIndexRangeMapping> qubitIndexRangeMappings;
+            if (numAncillaryQubitsOfGroup != 0U) {
+                const std::optional<qc::Qubit> firstAncillaryQubitOfGroup = annotatableQuantumComputation.addPreliminaryAncillaryRegisterOrAppendToAdjacentOne(InternalQubitLabelBuilder::buildAncillaryQubitLabel(annotatableQuantumComputation.getQuantumRegisters().size()), std::vector<bool>(numAncillaryQubitsOfGroup, false), AnnotatableQuantumComputation::InlinedQubitInformation());
+                if (!firstAncillaryQubitOfGroup.has_value()) {
+                    getErrorStream() << "Failed to create the ancillary qubits of group " << std::to_string(i) << " of independent statements of module " << module->name << "\n";
+                    return false;
+                }
+                qubitIndexRangeMappings.emplace_back(AnnotatableQuantumComputation::QubitIndexRangeMapping{.mappedQubitIndexRange = AnnotatableQuantumComputation::QubitIndexRange{.firstQubitIndex = numQubitsOfVariables, .lastQubitIndex = static_cast<qc::Qubit>(annotatableQuantumComputationOfGroup.getNqubits() - 1U)}, .firstQubitIndexOfMappingTarget = *firstAncillaryQubitOfGroup});
+            }
+
+            if (!annotatableQuantumComputation.appendOperationsOfQuantumComputationWithRemappedQubits(annotatableQuantumComputationOfGroup, qubitIndexRangeMappings)) {
+                getErrorStream() << "Failed to append the quantum operations of group " << std::to_string(i) << " of independent statements of module " << module->name << "\n";
+                return false;
+            }
+            accumulateStatisticsOfConcurrentlySynthesizedStatements(resultOfGroup.statistics);
+        }
+        return true;
+    }
+
     bool SyrecSynthesis::onModule(const Module::ptr& main) {
         bool              synthesisOfModuleStatementOk = true;
         const std::size_t nModuleStatements            = main->statements.size();
@@ -290,19 +848,16 @@ namespace syrec {
 
     /// If the input signals are repeated (i.e., rhs input signals are repeated)
     bool SyrecSynthesis::checkRepeats() {
-        std::vector checkLhsVec(expLhsVector.cbegin(), expLhsVector.cend());
-        std::vector checkRhsVec(expRhsVector.cbegin(), expRhsVector.cend());
-
-        std::erase_if(checkLhsVec, [](const std::vector<qc::Qubit>& linesContainer) { return linesContainer.empty(); });
-        std::erase_if(checkRhsVec, [](const std::vector<qc::Qubit>& linesContainer) { return linesContainer.empty(); });
-
-        bool foundRepeat = false;
-        for (std::size_t i = 0; i < checkRhsVec.size() && !foundRepeat; ++i) {
-            for (std::size_t j = i + 1; j < checkRhsVec.size() && !foundRepeat; ++j) {
-                foundRepeat = checkRhsVec[i] == checkRhsVec[j];
-            }
-            for (std::size_t k = 0; k < checkLhsVec.size() && !foundRepeat; ++k) {
-                foundRepeat = checkLhsVec[k] == checkRhsVec[i];
+        // Since equal operands share the same interned identifier, a repeated operand is detected by probing the identifiers of the previously visited non-empty operands.
+        std::unordered_set<QubitSpanInterner::Id> idsOfNonEmptyLhsOperands(expLhsVector.cbegin(), expLhsVector.cend());
+        idsOfNonEmptyLhsOperands.erase(QubitSpanInterner::EMPTY_SPAN_ID);
+
+        std::unordered_set<QubitSpanInterner::Id> idsOfVisitedRhsOperands;
+        bool                                      foundRepeat = false;
+        for (std::size_t i = 0; i < expRhsVector.size() && !foundRepeat; ++i) {
+            const QubitSpanInterner::Id idOfRhsOperand = expRhsVector[i];
+            if (idOfRhsOperand != QubitSpanInterner::EMPTY_SPAN_ID) {
+                foundRepeat = idsOfNonEmptyLhsOperands.contains(idOfRhsOperand) || !idsOfVisitedRhsOperands.emplace(idOfRhsOperand).second;
             }
         }
 
@@ -323,79 +878,98 @@ namespace syrec {
     }
 
     bool SyrecSynthesis::onStatement(const Statement::ptr& statement) {
+        if (executionLimitsMonitor != nullptr && executionLimitsMonitor->isAnyLimitViolated()) {
+            return false;
+        }
+        SYREC_SYNTHESIS_TRACE_SCOPE(synthesisTraceRecorder.get(), annotatableQuantumComputation, "statement", determineKindOfStatement(*statement), statement->lineNumber);
         stmts.push(statement);
 
-        annotatableQuantumComputation.setOrUpdateGlobalQuantumOperationAnnotation(GATE_ANNOTATION_KEY_ASSOCIATED_STATEMENT_LINE_NUMBER, std::to_string(static_cast<std::size_t>(statement->lineNumber)));
+        annotatableQuantumComputation.setOrUpdateGlobalStatementLineNumber(statement->lineNumber);
+        invalidateSharedSynthesisResultsOfExpressionsModifiedByStatement(*statement);
+        dividersSynthesizedForCurrentStatement.clear();
+        comparatorsSynthesizedForCurrentStatement.clear();
+        indexDecodingsSharedInCurrentStatement.clear();
+        // Only the variable accesses of statements without nested statements share the decodings of their unrolled indices since the latter are reset after the synthesis of the statement.
+        const Statement::Kind kindOfStatement = statement->getKind();
+        shareIndexDecodingsInCurrentStatement = shareIndexDecodingOfNonConstantIndices && (kindOfStatement == Statement::Kind::Assign || kindOfStatement == Statement::Kind::Swap || kindOfStatement == Statement::Kind::Unary);
 
         bool okay = true;
-        if (auto const* swapStat = dynamic_cast<SwapStatement*>(statement.get()); swapStat != nullptr) {
-            okay = onStatement(*swapStat);
-        } else if (auto const* unaryStat = dynamic_cast<UnaryStatement*>(statement.get()); unaryStat != nullptr) {
-            okay = onStatement(*unaryStat);
-        } else if (auto const* assignStat = dynamic_cast<AssignStatement*>(statement.get()); assignStat != nullptr) {
-            okay = onStatement(*assignStat);
-        } else if (auto const* ifStat = dynamic_cast<IfStatement*>(statement.get()); ifStat != nullptr) {
-            okay = onStatement(*ifStat);
-        } else if (auto const* forStat = dynamic_cast<ForStatement*>(statement.get()); forStat != nullptr) {
-            okay = onStatement(*forStat);
-        } else if (auto const* callStat = dynamic_cast<CallStatement*>(statement.get()); callStat != nullptr) {
-            if (!shouldQubitInlineInformationBeRecorded()) {
-                okay = onStatement(*callStat);
-            } else {
-                const std::optional<QubitInliningStack::ptr> lastCreatedQubitInlineStack = getLastCreatedModuleCallStackInstance();
-                // Our goal is to shared the current qubit inline stack for all qubits created for the local variables of the currently processed module as well as for all ancillary qubits generated while
-                // synthesizing the statements of the current module, thus we proceed as follows:
-                // I.   Create a copy of the current qubit inline stack
-                // II.  Push a new entry on the inline stack for the new called module and synthesize the statements of said module with the new call stack instance created in I.
-                // III. Discard the call stack instance of II. so the call stack prior to I. can be reused again for the remainder of the statements of the parent module that contained the currently processed CallStatement.
-                if (const std::optional<QubitInliningStack::ptr> optionalCopyOfLastCreatedQubitInlineStack = lastCreatedQubitInlineStack.has_value() ? createInsertAndGetCopyOfLastCreatedCallStackInstance() : std::nullopt; optionalCopyOfLastCreatedQubitInlineStack.has_value() && optionalCopyOfLastCreatedQubitInlineStack->get()->size() > 0) {
-                    const QubitInliningStack::ptr& copyOfLastCreatedQubitInlineStack = *optionalCopyOfLastCreatedQubitInlineStack;
-                    if (auto* lastPushedEntryOnInlineStack = copyOfLastCreatedQubitInlineStack->getStackEntryAt(lastCreatedQubitInlineStack.value()->size() - 1); lastPushedEntryOnInlineStack != nullptr) {
-                        lastPushedEntryOnInlineStack->lineNumberOfCallOfTargetModule    = statement->lineNumber;
-                        lastPushedEntryOnInlineStack->isTargetModuleAccessedViaCallStmt = true;
-                        okay                                                            = copyOfLastCreatedQubitInlineStack->push(QubitInliningStack::QubitInliningStackEntry({.lineNumberOfCallOfTargetModule = std::nullopt, .isTargetModuleAccessedViaCallStmt = std::nullopt, .targetModule = callStat->target})) && onStatement(*callStat);
-                    } else {
-                        // There must be at least one entry on the stack for the main module of the currently synthesized SyReC program
-                        okay = false;
-                    }
+        switch (statement->getKind()) {
+            case Statement::Kind::Swap:
+                okay = onStatement(static_cast<const SwapStatement&>(*statement));
+                break;
+            case Statement::Kind::Unary:
+                okay = onStatement(static_cast<const UnaryStatement&>(*statement));
+                break;
+            case Statement::Kind::Assign:
+                okay = onStatement(static_cast<const AssignStatement&>(*statement));
+                break;
+            case Statement::Kind::If:
+                okay = onStatement(static_cast<const IfStatement&>(*statement));
+                break;
+            case Statement::Kind::For:
+                okay = onStatement(static_cast<const ForStatement&>(*statement));
+                break;
+            case Statement::Kind::Call: {
+                const auto& callStat = static_cast<const CallStatement&>(*statement);
+                if (!shouldQubitInlineInformationBeRecorded()) {
+                    okay = onStatement(callStat);
+                } else if (createAndInsertModuleCallStackInstanceOfCalledModule(callStat.target, statement->lineNumber, true)) {
+                    // All qubits created for the local variables of the called module as well as all ancillary qubits generated while synthesizing the statements of the called module share the inline stack of
+                    // the new node in the module call tree, which is discarded after the synthesis of the called module so that the inline stack of the parent module is reused for its remaining statements.
+                    okay = onStatement(callStat);
                     discardLastCreateModuleCallStackInstance();
                 } else {
-                    // There must be at least one entry on the stack for the main module of the currently synthesized SyReC program
+                    // There must be at least one node in the module call tree for the main module of the currently synthesized SyReC program and the called module must be set
                     okay = false;
                 }
+                break;
             }
-        } else if (auto const* uncallStat = dynamic_cast<UncallStatement*>(statement.get()); uncallStat != nullptr) {
-            if (!shouldQubitInlineInformationBeRecorded()) {
-                okay = onStatement(*uncallStat);
-            } else {
-                const std::optional<QubitInliningStack::ptr> lastCreatedQubitInlineStack = getLastCreatedModuleCallStackInstance();
-                // The same logic applied for the CallStatement regarding the reuse of CallStack instances also applies to the handling of UncallStatements (for further details check the comment defined for the handling of the CallStatement)
-                if (const std::optional<QubitInliningStack::ptr> optionalCopyOfLastCreatedQubitInlineStack = lastCreatedQubitInlineStack.has_value() ? createInsertAndGetCopyOfLastCreatedCallStackInstance() : std::nullopt; optionalCopyOfLastCreatedQubitInlineStack.has_value() && optionalCopyOfLastCreatedQubitInlineStack->get()->size() > 0) {
-                    const QubitInliningStack::ptr& copyOfLastCreatedQubitInlineStack = *optionalCopyOfLastCreatedQubitInlineStack;
-                    if (auto* lastPushedEntryOnInlineStack = copyOfLastCreatedQubitInlineStack->getStackEntryAt(lastCreatedQubitInlineStack.value()->size() - 1); lastPushedEntryOnInlineStack != nullptr) {
-                        lastPushedEntryOnInlineStack->lineNumberOfCallOfTargetModule    = statement->lineNumber;
-                        lastPushedEntryOnInlineStack->isTargetModuleAccessedViaCallStmt = false;
-                        okay                                                            = copyOfLastCreatedQubitInlineStack->push(QubitInliningStack::QubitInliningStackEntry({.lineNumberOfCallOfTargetModule = std::nullopt, .isTargetModuleAccessedViaCallStmt = std::nullopt, .targetModule = uncallStat->target})) && onStatement(*uncallStat);
-                    } else {
-                        // There must be at least one entry on the stack for the main module of the currently synthesized SyReC program
-                        okay = false;
-                    }
+            case Statement::Kind::Uncall: {
+                const auto& uncallStat = static_cast<const UncallStatement&>(*statement);
+                if (!shouldQubitInlineInformationBeRecorded()) {
+                    okay = onStatement(uncallStat);
+                } else if (createAndInsertModuleCallStackInstanceOfCalledModule(uncallStat.target, statement->lineNumber, false)) {
+                    // The same logic applied for the CallStatement regarding the reuse of inline stacks also applies to the handling of UncallStatements (for further details check the comment defined for the handling of the CallStatement)
+                    okay = onStatement(uncallStat);
                     discardLastCreateModuleCallStackInstance();
                 } else {
-                    // There must be at least one entry on the stack for the main module of the currently synthesized SyReC program
+                    // There must be at least one node in the module call tree for the main module of the currently synthesized SyReC program and the uncalled module must be set
                     okay = false;
                 }
+                break;
             }
-        } else if (auto const* skipStat = dynamic_cast<SkipStatement*>(statement.get()); skipStat != nullptr) {
-            okay = onStatement(*skipStat);
-        } else {
-            okay = false;
+            case Statement::Kind::Skip:
+                okay = onStatement(static_cast<const SkipStatement&>(*statement));
+                break;
+        }
+
+        if (shareIndexDecodingsInCurrentStatement) {
+            okay &= resetIndexDecodingsSharedInCurrentStatement();
+            shareIndexDecodingsInCurrentStatement = false;
         }
 
+        // The shared synthesized results of expressions are invalidated prior to and after the synthesis of a statement since the variables accessed by the expressions of a statement can be modified by the statement itself.
+        invalidateSharedSynthesisResultsOfExpressionsModifiedByStatement(*statement);
         stmts.pop();
+
+        ++progressOfSynthesis.numProcessedStatements;
+        reportProgressIfDue();
+        if (residentSetSizeSampler.has_value()) {
+            residentSetSizeSampler->sampleIfDue();
+        }
         return okay;
     }
 
+    void SyrecSynthesis::reportProgressIfDue() {
+        if (progressReporter.has_value()) {
+            progressReporter->reportIfDue([&] {
+                progressOfSynthesis.numEmittedQuantumOperations = annotatableQuantumComputation.getNumQuantumOperations();
+                return progressOfSynthesis;
+            });
+        }
+    }
+
     // If both variable accesses of the SwapStatement contained only expressions evaluable at compile time in its dimension access component
     // then the accessed qubits of the both variables can be determined a compile time and the procedure below can be ignored for the synthesis of the swap statement.
     //
@@ -424,8 +998,8 @@ namespace syrec {
     // III. After the accessed qubits of both variable were determined, perform the synthesis of the swap operation.
     // IV.  Swap the qubits storing the accessed qubits of the variables back to the qubits of the accessed element in the variable for both operands of the swap operation.
     bool SyrecSynthesis::onStatement(const SwapStatement& statement) {
-        const std::optional<EvaluatedVariableAccess> evaluatedLhsOperand = evaluateAndValidateVariableAccess(statement.lhs, loopMap, firstVariableQubitOffsetLookup);
-        const std::optional<EvaluatedVariableAccess> evaluatedRhsOperand = evaluateAndValidateVariableAccess(statement.rhs, loopMap, firstVariableQubitOffsetLookup);
+        const std::optional<EvaluatedVariableAccess> evaluatedLhsOperand = evaluateAndValidateVariableAccess(statement.lhs, firstVariableQubitOffsetLookup);
+        const std::optional<EvaluatedVariableAccess> evaluatedRhsOperand = evaluateAndValidateVariableAccess(statement.rhs, firstVariableQubitOffsetLookup);
         if (!evaluatedLhsOperand.has_value() || !evaluatedRhsOperand.has_value()) {
             return false;
         }
@@ -443,6 +1017,11 @@ namespace syrec {
         const unsigned numQubitsSwapped = static_cast<unsigned>(dataOfEvaluatedLhsOperand.evaluatedBitrangeAccess.getIndicesOfAccessedBits().size());
         switch (aggregateOfWhetherOperandsContainedOnlyNumericExpressions) {
             case bothOperandsContainedOnlyCompileTimeConstantExpressionsInDimensionAccess: {
+                // Swapping the qubits associated with the variables requires no quantum operations, the resulting association of the qubits of the variables of the main module is recorded as the output permutation after the synthesis.
+                if (canSwapBeTrackedAsQubitPermutation(dataOfEvaluatedLhsOperand, dataOfEvaluatedRhsOperand)) {
+                    synthesisOk = firstVariableQubitOffsetLookup->registerOrUpdateOffsetToFirstQubitOfVariableInCurrentScope(dataOfEvaluatedLhsOperand.accessedVariable.get(), dataOfEvaluatedRhsOperand.offsetToFirstQubitOfVariable) && firstVariableQubitOffsetLookup->registerOrUpdateOffsetToFirstQubitOfVariableInCurrentScope(dataOfEvaluatedRhsOperand.accessedVariable.get(), dataOfEvaluatedLhsOperand.offsetToFirstQubitOfVariable);
+                    break;
+                }
                 std::vector<qc::Qubit> qubitsOfLhsOperand;
                 std::vector<qc::Qubit> qubitsOfRhsOperand;
                 synthesisOk = getQubitsForVariableAccessContainingOnlyIndicesEvaluableAtCompileTime(dataOfEvaluatedLhsOperand, qubitsOfLhsOperand) && getQubitsForVariableAccessContainingOnlyIndicesEvaluableAtCompileTime(dataOfEvaluatedRhsOperand, qubitsOfRhsOperand) && swap(annotatableQuantumComputation, qubitsOfLhsOperand, qubitsOfRhsOperand);
@@ -490,8 +1069,50 @@ namespace syrec {
         return synthesisOk;
     }
 
+    bool SyrecSynthesis::canSwapBeTrackedAsQubitPermutation(const EvaluatedVariableAccess& evaluatedLhsOperand, const EvaluatedVariableAccess& evaluatedRhsOperand) const {
+        // The qubits associated with the parameters of a called module refer to the variables of the caller, which is not aware of the swapped association, while the association of the qubits of the variables
+        // accessed in the body of a loop must not change between the replayed iterations of the latter. Conditional swaps require quantum operations controlled by the propagated control qubits.
+        if (!trackUnconditionalSwapsAsQubitPermutation || modules.size() != 1U || numEnclosingLoopBodies > 0U || !annotatableQuantumComputation.getAggregateOfPropagatedControlQubits().empty()) {
+            return false;
+        }
+
+        const Variable& lhsVariable = evaluatedLhsOperand.accessedVariable.get();
+        const Variable& rhsVariable = evaluatedRhsOperand.accessedVariable.get();
+        // Since the input qubits of a variable are marked as garbage based on the type of the variable, only the qubits of variables of the same type are swapped.
+        if (&lhsVariable == &rhsVariable || lhsVariable.type != rhsVariable.type || lhsVariable.bitwidth != rhsVariable.bitwidth || lhsVariable.bitwidth == 0U || evaluatedLhsOperand.offsetToFirstQubitOfVariable == evaluatedRhsOperand.offsetToFirstQubitOfVariable) {
+            return false;
+        }
+
+        const auto doesOperandAccessAllQubitsOfVariable = [](const EvaluatedVariableAccess& evaluatedOperand) {
+            const Variable& variable = evaluatedOperand.accessedVariable.get();
+            return std::ranges::all_of(variable.dimensions, [](const unsigned numValuesOfDimension) { return numValuesOfDimension == 1U; }) && evaluatedOperand.evaluatedBitrangeAccess.bitrangeStart == 0U && evaluatedOperand.evaluatedBitrangeAccess.bitrangeEnd + 1U == variable.bitwidth;
+        };
+        return doesOperandAccessAllQubitsOfVariable(evaluatedLhsOperand) && doesOperandAccessAllQubitsOfVariable(evaluatedRhsOperand);
+    }
+
+    bool SyrecSynthesis::recordOutputPermutationOfVariablesOfMainModule(const Module& mainModule) {
+        // The qubits of the variables of the main module are created prior to any other qubit in the order of the declaration of the variables, thus the first qubit initially associated with a variable is the number of qubits of all previously declared variables.
+        qc::Qubit offsetToFirstQubitInitiallyAssociatedWithVariable = 0;
+        for (const Variable::vec* variables: {&mainModule.parameters, &mainModule.variables}) {
+            for (const Variable::ptr& variable: *variables) {
+                const std::optional<qc::Qubit> offsetToFirstQubitAssociatedWithVariable = firstVariableQubitOffsetLookup->getOffsetToFirstQubitOfVariableInCurrentScope(*variable);
+                if (!offsetToFirstQubitAssociatedWithVariable.has_value()) {
+                    return false;
+                }
+
+                const qc::Qubit numQubitsOfVariable = std::accumulate(variable->dimensions.cbegin(), variable->dimensions.cend(), variable->bitwidth, std::multiplies());
+                // The output permutation maps the physical qubit storing the value of a logical qubit at the end of the quantum computation to the latter.
+                for (qc::Qubit i = 0; i < numQubitsOfVariable && *offsetToFirstQubitAssociatedWithVariable != offsetToFirstQubitInitiallyAssociatedWithVariable; ++i) {
+                    annotatableQuantumComputation.outputPermutation.insert_or_assign(*offsetToFirstQubitAssociatedWithVariable + i, offsetToFirstQubitInitiallyAssociatedWithVariable + i);
+                }
+                offsetToFirstQubitInitiallyAssociatedWithVariable += numQubitsOfVariable;
+            }
+        }
+        return true;
+    }
+
     bool SyrecSynthesis::onStatement(const UnaryStatement& statement) {
-        const std::optional<EvaluatedVariableAccess> evaluatedVariableAccess = evaluateAndValidateVariableAccess(statement.var, loopMap, firstVariableQubitOffsetLookup);
+        const std::optional<EvaluatedVariableAccess> evaluatedVariableAccess = evaluateAndValidateVariableAccess(statement.var, firstVariableQubitOffsetLookup);
         if (!evaluatedVariableAccess.has_value()) {
             return false;
         }
@@ -547,12 +1168,13 @@ namespace syrec {
     }
 
     bool SyrecSynthesis::onStatement(const AssignStatement& statement) {
-        const std::optional<EvaluatedVariableAccess> evaluatedLhsOperand = evaluateAndValidateVariableAccess(statement.lhs, loopMap, firstVariableQubitOffsetLookup);
+        const std::optional<EvaluatedVariableAccess> evaluatedLhsOperand = evaluateAndValidateVariableAccess(statement.lhs, firstVariableQubitOffsetLookup);
         if (!evaluatedLhsOperand.has_value()) {
             return false;
         }
 
-        bool                           synthesisOfAssignmentOk   = true;
+        // The deferred uncomputations are performed prior to the synthesis of the qubits of the assigned to variable access to prevent that the former are skipped due to the quantum operations of the latter.
+        bool                           synthesisOfAssignmentOk   = uncomputeDeferredExpressionsIfNoAncillaryQubitIsAvailable();
         const EvaluatedVariableAccess& dataOfEvaluatedLhsOperand = evaluatedLhsOperand.value();
         std::vector<qc::Qubit>         qubitsStoringIndexInUnrolledVariable;
         std::vector<qc::Qubit>         qubitsStoringSelectedValueOfVariable;
@@ -581,6 +1203,20 @@ namespace syrec {
             synthesisOfAssignmentOk &= calculateSymbolicUnrolledIndexForElementInVariable(dataOfEvaluatedLhsOperand, qubitsStoringIndexInUnrolledVariable) && getConstantLines(static_cast<unsigned>(dataOfEvaluatedLhsOperand.evaluatedBitrangeAccess.getIndicesOfAccessedBits().size()), 0U, qubitsStoringSelectedValueOfVariable) && transferQubitsOfElementAtIndexInVariableToOtherQubits(dataOfEvaluatedLhsOperand, qubitsStoringIndexInUnrolledVariable, qubitsStoringSelectedValueOfVariable, QubitTransferOperation::SwapQubits);
         }
 
+        // The addition (subtraction) of a constant can be synthesized by a sequence of increments (decrements) of the accessed qubits that does not require any ancillary qubits.
+        if (synthesisOfAssignmentOk && addConstantsWithoutAncillaryQubits && (statement.assignOperation == AssignStatement::AssignOperation::Add || statement.assignOperation == AssignStatement::AssignOperation::Subtract)) {
+            if (const auto* const rhsAsNumericExpression = expressionCast<NumericExpression>(statement.rhs.get()); rhsAsNumericExpression != nullptr) {
+                if (const std::optional<unsigned> constantValueOfRhs = loopVariableNumberEvaluator.tryEvaluate(rhsAsNumericExpression->value); constantValueOfRhs.has_value()) {
+                    const unsigned truncatedConstantValueOfRhs = utils::truncateConstantValueToExpectedBitwidth(*constantValueOfRhs, static_cast<unsigned>(qubitsStoringSelectedValueOfVariable.size()), integerConstantTruncationOperation);
+                    synthesisOfAssignmentOk                    = addConstantWithoutAncillaryQubits(qubitsStoringSelectedValueOfVariable, truncatedConstantValueOfRhs, statement.assignOperation == AssignStatement::AssignOperation::Subtract);
+                    if (synthesisOfAssignmentOk && !dataOfEvaluatedLhsOperand.evaluatedDimensionAccess.containedOnlyNumericExpressions) {
+                        synthesisOfAssignmentOk = transferQubitsOfElementAtIndexInVariableToOtherQubits(dataOfEvaluatedLhsOperand, qubitsStoringIndexInUnrolledVariable, qubitsStoringSelectedValueOfVariable, QubitTransferOperation::SwapQubits);
+                    }
+                    return synthesisOfAssignmentOk;
+                }
+            }
+        }
+
         // While a derviced class can fall back to the base class implementation to synthesis AssignStatements, the opRhsLhsExpression(...) call
         // of the derived class might not be able to handle the expression on the right-hand side of the assignment but since we are already using the base class
         // to synthesis the assignment (which should be able to handle all SyReC expression types) the return value of opRhsLhsExpression can be ignored.
@@ -595,7 +1231,9 @@ namespace syrec {
         // truncation of integer constant is performed. An example for such a case is the SyReC module 'module main(inout a(4)) for $i = 0 to 2 do a.$i:($i + 1) += 120 rof'.
         // The bitwidth of the assigned to variable parts is equal to 2 while the bitwidth of the right hand side of the expression is 32 due to the assumed bitwidth chosen for integer constants. To satisfy the invariant that both operands need
         // to have the same bitwidth, a truncation of the integer constant to the expected bitwidth of 2 needs to be performed.
+        const AncillaryQubitUsageMark ancillaryQubitUsagePriorToSynthesisOfRhs = markAncillaryQubitUsage();
         synthesisOfAssignmentOk &= SyrecSynthesis::onExpression(statement.rhs, numAccessedBitsInLhsOperand, rhs, qubitsStoringSelectedValueOfVariable, statement.assignOperation);
+        const AncillaryQubitUsageMark ancillaryQubitUsageAfterSynthesisOfRhs = markAncillaryQubitUsage();
         // We should validate that the invariant that both sides of the assignment have the same bitwidth is satisfied but due to some weird implementation details of the line aware synthesis, which might be modified to fix issue #280, this cannot be done without risking
         // that some assignment variants cannot be synthesized anymore. This hopefully changes in the future.
         opVec.clear();
@@ -621,16 +1259,21 @@ namespace syrec {
         if (synthesisOfAssignmentOk && !dataOfEvaluatedLhsOperand.evaluatedDimensionAccess.containedOnlyNumericExpressions) {
             synthesisOfAssignmentOk &= transferQubitsOfElementAtIndexInVariableToOtherQubits(dataOfEvaluatedLhsOperand, qubitsStoringIndexInUnrolledVariable, qubitsStoringSelectedValueOfVariable, QubitTransferOperation::SwapQubits);
         }
+
+        // The assignment does not modify the qubits storing the result of the expression on the right-hand side of the assignment, the ancillary qubits used by the latter can thus be reset and reused by later statements.
+        if (synthesisOfAssignmentOk) {
+            synthesisOfAssignmentOk = scheduleUncomputationOfExpression(ancillaryQubitUsagePriorToSynthesisOfRhs, ancillaryQubitUsageAfterSynthesisOfRhs);
+        }
         return synthesisOfAssignmentOk;
     }
 
     bool SyrecSynthesis::onStatement(const IfStatement& statement) {
         OperationVariant guardExpressionTopLevelOperation = BinaryExpression::BinaryOperation::Add;
-        if (auto const* binary = dynamic_cast<BinaryExpression*>(statement.condition.get()); binary != nullptr) {
+        if (auto const* binary = expressionCast<BinaryExpression>(statement.condition.get()); binary != nullptr) {
             guardExpressionTopLevelOperation = binary->binaryOperation;
-        } else if (auto const* shift = dynamic_cast<ShiftExpression*>(statement.condition.get()); shift != nullptr) {
+        } else if (auto const* shift = expressionCast<ShiftExpression>(statement.condition.get()); shift != nullptr) {
             guardExpressionTopLevelOperation = shift->shiftOperation;
-        } else if (auto const* unary = dynamic_cast<UnaryExpression*>(statement.condition.get()); unary != nullptr) {
+        } else if (auto const* unary = expressionCast<UnaryExpression>(statement.condition.get()); unary != nullptr) {
             guardExpressionTopLevelOperation = unary->unaryOperation;
         }
 
@@ -642,11 +1285,16 @@ namespace syrec {
         // We need to create the ancillary qubit used to store the synthesis result of the variable expression since the onExpression(...) function does not create this ancillary qubit
         // Additionally, a CNOT gate is required to transfer the value of the current qubit storing the synthesis result of the VariableExpression to the ancillary qubit.
         // The ancillary qubit is only required when the original qubit of the guard expression is used as a target qubit in any of the statements of the true
-        // or false branch of the IfStatement but since we cannot determine whether this case will happen (at this point of the synthesis) we are 'forced' to use the ancillary qubit.
-        if (auto const* variableExpr = dynamic_cast<VariableExpression*>(statement.condition.get()); variableExpr != nullptr && synthesisOfGuardExprOk) {
+        // or false branch of the IfStatement. If enabled, the ancillary qubit is omitted when no statement of either branch accesses any of the variables of the guard expression.
+        // Since the CNOT gate is controlled by the propagated control qubits, the ancillary qubit stores the conjunction of the latter and the guard expression qubit.
+        bool isGuardExpressionQubitConjunctionWithPropagatedControlQubits = false;
+        // A shift synthesized by relabeling qubits can also result in a qubit of a variable storing the value of the guard expression.
+        const bool isGuardExpressionQubitOfVariable = expressionCast<VariableExpression>(statement.condition.get()) != nullptr || (synthesizeShiftsByRelabelingQubits && statement.condition != nullptr && statement.condition->getKind() == Expression::Kind::Shift);
+        if (isGuardExpressionQubitOfVariable && synthesisOfGuardExprOk && !canQubitOfGuardVariableBeUsedAsControlQubitOfBranches(statement)) {
             if (const std::optional<qc::Qubit> generatedHelperLine = getConstantLine(false, getLastCreatedModuleCallStackInstance()); generatedHelperLine.has_value()) {
-                synthesisOfGuardExprOk   = annotatableQuantumComputation.addOperationsImplementingCnotGate(guardExpressionQubits.front(), *generatedHelperLine);
-                guardExpressionQubits[0] = *generatedHelperLine;
+                synthesisOfGuardExprOk                                        = annotatableQuantumComputation.addOperationsImplementingCnotGate(guardExpressionQubits.front(), *generatedHelperLine);
+                guardExpressionQubits[0]                                      = *generatedHelperLine;
+                isGuardExpressionQubitConjunctionWithPropagatedControlQubits = true;
             } else {
                 synthesisOfGuardExprOk = false;
             }
@@ -656,14 +1304,32 @@ namespace syrec {
             return false;
         }
 
-        // add new helper line
+        // The synthesized results of expressions synthesized prior to the statements of either branch cannot be shared with any expression of the latter since the quantum operations synthesized for the branches are controlled by the guard expression qubit.
+        if (expressionSynthesisCache != nullptr) {
+            expressionSynthesisCache->clear();
+        }
+
         const qc::Qubit guardExpressionQubit = guardExpressionQubits.front();
+        if (combineGuardsOfNestedIfStatements && !annotatableQuantumComputation.getAggregateOfPropagatedControlQubits().empty()) {
+            return synthesizeBranchesControlledByCombinedGuard(statement, guardExpressionQubit, isGuardExpressionQubitConjunctionWithPropagatedControlQubits);
+        }
+
+        // add new helper line
         annotatableQuantumComputation.activateControlQubitPropagationScope();
         bool synthesisOfBranchStatementsOk = annotatableQuantumComputation.registerControlQubitForPropagationInCurrentAndNestedScopes(guardExpressionQubit) && std::ranges::all_of(statement.thenStatements, [&](const Statement::ptr& trueBranchStatement) { return processStatement(trueBranchStatement); });
 
         // Toggle helper line.
         // We do not want to use the current helper line controlling the conditional execution of the statements
         // of both branches of the current IfStatement when negating the value of said helper line
+        if (expressionSynthesisCache != nullptr) {
+            expressionSynthesisCache->clear();
+        }
+        // If enabled, the statements of the else branch are controlled by the negative guard expression qubit instead of toggling the latter.
+        if (foldNegationsIntoNegativeControls) {
+            synthesisOfBranchStatementsOk &= annotatableQuantumComputation.registerControlQubitForPropagationInCurrentAndNestedScopes(guardExpressionQubit, qc::Control::Type::Neg) && std::ranges::all_of(statement.elseStatements, [&](const Statement::ptr& falseBranchStatement) { return processStatement(falseBranchStatement); });
+            annotatableQuantumComputation.deactivateControlQubitPropagationScope();
+            return synthesisOfBranchStatementsOk;
+        }
         synthesisOfBranchStatementsOk &= annotatableQuantumComputation.deregisterControlQubitFromPropagationInCurrentScope(guardExpressionQubit) && annotatableQuantumComputation.addOperationsImplementingNotGate(guardExpressionQubit) && annotatableQuantumComputation.registerControlQubitForPropagationInCurrentAndNestedScopes(guardExpressionQubit) && std::ranges::all_of(statement.elseStatements, [&](const Statement::ptr& falseBranchStatement) { return processStatement(falseBranchStatement); });
 
         // We do not want to use the current helper line controlling the conditional execution of the statements
@@ -673,63 +1339,353 @@ namespace syrec {
         return synthesisOfBranchStatementsOk;
     }
 
+    bool SyrecSynthesis::canQubitOfGuardVariableBeUsedAsControlQubitOfBranches(const IfStatement& statement) const {
+        if (!reuseQubitOfGuardVariableNotAccessedInBranches) {
+            return false;
+        }
+
+        std::unordered_set<std::string> identifiersOfVariablesAccessedInBranches;
+        const auto                      collectIdentifiersOfVariablesAccessedInBranchStatement = [&](const Statement::ptr& branchStatement) { return collectIdentifiersOfAccessedVariables(branchStatement, identifiersOfVariablesAccessedInBranches); };
+        if (!std::ranges::all_of(statement.thenStatements, collectIdentifiersOfVariablesAccessedInBranchStatement) || !std::ranges::all_of(statement.elseStatements, collectIdentifiersOfVariablesAccessedInBranchStatement)) {
+            return false;
+        }
+
+        // The variables accessed in the indices of the guard expression are also checked since they can determine which qubit stores the value of the guard expression.
+        std::unordered_set<std::string> identifiersOfVariablesOfGuardExpression;
+        collectIdentifiersOfAccessedVariables(statement.condition, identifiersOfVariablesOfGuardExpression);
+        return std::ranges::none_of(identifiersOfVariablesOfGuardExpression, [&](const std::string& identifier) { return identifiersOfVariablesAccessedInBranches.contains(identifier); });
+    }
+
+    bool SyrecSynthesis::synthesizeBranchesControlledByCombinedGuard(const IfStatement& statement, const qc::Qubit guardExpressionQubit, const bool isGuardExpressionQubitConjunctionWithPropagatedControlQubits) {
+        // The combined guard qubit stores the conjunction of the propagated control qubits of the enclosing statements and the guard expression qubit and is computed by a single quantum operation controlled by the former.
+        qc::Qubit combinedGuardQubit = guardExpressionQubit;
+        if (!isGuardExpressionQubitConjunctionWithPropagatedControlQubits) {
+            const std::optional<qc::Qubit> generatedCombinedGuardQubit = getConstantLine(false, getLastCreatedModuleCallStackInstance());
+            if (!generatedCombinedGuardQubit.has_value() || !annotatableQuantumComputation.addOperationsImplementingCnotGate(guardExpressionQubit, *generatedCombinedGuardQubit)) {
+                return false;
+            }
+            combinedGuardQubit = *generatedCombinedGuardQubit;
+        }
+
+        const std::unordered_set<qc::Qubit>& aggregateOfPropagatedControlQubits = annotatableQuantumComputation.getAggregateOfPropagatedControlQubits();
+        const std::vector<qc::Qubit>         controlQubitsOfEnclosingStatements(aggregateOfPropagatedControlQubits.cbegin(), aggregateOfPropagatedControlQubits.cend());
+
+        const auto synthesizeBranchControlledByCombinedGuard = [&](const Statement::vec& branchStatements) {
+            // A control qubit propagated from a parent scope can only be deregistered in the current scope if it was registered in the latter, with the deactivation of the scope propagating the control qubit again.
+            annotatableQuantumComputation.activateControlQubitPropagationScope();
+            const bool synthesisOfBranchStatementsOk = std::ranges::all_of(controlQubitsOfEnclosingStatements, [&](const qc::Qubit controlQubit) { return annotatableQuantumComputation.registerControlQubitForPropagationInCurrentAndNestedScopes(controlQubit) && annotatableQuantumComputation.deregisterControlQubitFromPropagationInCurrentScope(controlQubit); }) && annotatableQuantumComputation.registerControlQubitForPropagationInCurrentAndNestedScopes(combinedGuardQubit) && std::ranges::all_of(branchStatements, [&](const Statement::ptr& branchStatement) { return processStatement(branchStatement); });
+            annotatableQuantumComputation.deactivateControlQubitPropagationScope();
+
+            if (expressionSynthesisCache != nullptr) {
+                expressionSynthesisCache->clear();
+            }
+            return synthesisOfBranchStatementsOk;
+        };
+
+        // Toggling the combined guard qubit by a quantum operation controlled by the propagated control qubits of the enclosing statements sets it to the conjunction of the latter and the negated guard expression qubit (and vice versa).
+        // A combined guard qubit generated for the current IfStatement is reset afterwards.
+        return synthesizeBranchControlledByCombinedGuard(statement.thenStatements) && annotatableQuantumComputation.addOperationsImplementingNotGate(combinedGuardQubit) && synthesizeBranchControlledByCombinedGuard(statement.elseStatements) && annotatableQuantumComputation.addOperationsImplementingNotGate(combinedGuardQubit) && (isGuardExpressionQubitConjunctionWithPropagatedControlQubits || annotatableQuantumComputation.addOperationsImplementingCnotGate(guardExpressionQubit, combinedGuardQubit));
+    }
+
     bool SyrecSynthesis::onStatement(const ForStatement& statement) {
         const auto& [nfrom, nTo] = statement.range;
 
-        const unsigned     from         = nfrom ? nfrom->evaluate(loopMap) : 1U; // default value is 1u
-        const unsigned     to           = nTo->evaluate(loopMap);
-        const unsigned     step         = statement.step ? statement.step->evaluate(loopMap) : 1U; // default step is +1
-        const std::string& loopVariable = statement.loopVariable;
+        const unsigned     from             = nfrom ? nfrom->evaluate(loopMap) : 1U; // default value is 1u
+        const unsigned     to               = nTo->evaluate(loopMap);
+        const unsigned     step             = statement.step ? statement.step->evaluate(loopMap) : 1U; // default step is +1
+        const std::string& loopVariable     = statement.loopVariable;
+        const std::size_t  loopVariableSlot = !loopVariable.empty() ? loopVariableNumberEvaluator.getLoopVariableSlot(loopVariable) : 0U;
 
         if (from == to) {
             return true;
         }
 
-        if (from < to) {
-            for (unsigned i = from; i < to; i += step) {
-                // adjust loop variable if necessary
+        const auto fromSigned = static_cast<std::int64_t>(from);
+        const auto toSigned   = static_cast<std::int64_t>(to);
+        const auto stepSigned = from < to ? static_cast<std::int64_t>(step) : -static_cast<std::int64_t>(step);
 
-                if (!loopVariable.empty()) {
-                    loopMap[loopVariable] = i;
-                }
+        // The quantum operations synthesized for the first iterations of the loop body are compared to determine whether they can be replayed, with shifted qubits, for the remaining iterations of the loop instead of synthesizing the loop body again.
+        constexpr std::size_t numIterationsUsedToDetermineTemplate    = 3;
+        const std::size_t     numIterations                           = step != 0U ? static_cast<std::size_t>(((from < to ? toSigned - fromSigned : fromSigned - toSigned) + static_cast<std::int64_t>(step) - 1) / static_cast<std::int64_t>(step)) : 0U;
+        const auto            determineValueOfLoopVariableInIteration = [&](const std::size_t iterationIndex) {
+            return static_cast<unsigned>(fromSigned + (static_cast<std::int64_t>(iterationIndex) * stepSigned));
+        };
 
-                for (const auto& stat: statement.statements) {
-                    if (!processStatement(stat)) {
-                        return false;
-                    }
-                }
+        bool shouldIterationsOfLoopBodyBeReplayed = replaySynthesizedLoopIterations && numIterations > numIterationsUsedToDetermineTemplate && !shouldQubitInlineInformationBeRecorded() && canSynthesisOfStatementsBeReused() && canIterationsOfLoopBodyBeReplayed(statement, {determineValueOfLoopVariableInIteration(0), determineValueOfLoopVariableInIteration(1), determineValueOfLoopVariableInIteration(numIterations - 1U)});
+
+        std::array<std::size_t, numIterationsUsedToDetermineTemplate + 1U> indexOfFirstQuantumOperationPerIteration{};
+        std::array<qc::Qubit, numIterationsUsedToDetermineTemplate + 1U>   firstCreatedQubitPerIteration{};
+        std::optional<LoopBodyIterationTemplate>                            loopBodyIterationTemplate;
+        // The replay of an iteration counts as the synthesis of the same number of statements as the last unrolled iteration in the reported progress of the synthesis.
+        std::size_t numStatementsOfLastUnrolledIteration = 0;
+
+        std::size_t iterationIndex = 0;
+        for (auto i = fromSigned; from < to ? i < toSigned : i > toSigned; i += stepSigned, ++iterationIndex) {
+            // Replayed iterations do not synthesize any statement, thus the execution limits are also checked prior to every iteration.
+            if (executionLimitsMonitor != nullptr && executionLimitsMonitor->isAnyLimitViolated()) {
+                return false;
             }
-        } else {
-            const auto fromSigned = static_cast<std::int64_t>(from);
-            const auto toSigned   = static_cast<std::int64_t>(to);
-            const auto stepSigned = static_cast<std::int64_t>(step);
-            for (auto i = fromSigned; i > toSigned; i -= stepSigned) {
-                // adjust loop variable if necessary
-
-                if (!loopVariable.empty()) {
-                    loopMap[loopVariable] = static_cast<qc::Qubit>(i);
-                }
 
-                for (const auto& stat: statement.statements) {
-                    if (!processStatement(stat)) {
-                        return false;
-                    }
+            // The quantum operations of the template could have been forwarded to a quantum operation sink, in which case the remaining iterations of the loop body are synthesized again.
+            if (loopBodyIterationTemplate.has_value() && loopBodyIterationTemplate->indexOfFirstQuantumOperation < annotatableQuantumComputation.getNumForwardedQuantumOperations()) {
+                loopBodyIterationTemplate.reset();
+                shouldIterationsOfLoopBodyBeReplayed = false;
+            }
+
+            if (loopBodyIterationTemplate.has_value()) {
+                SYREC_SYNTHESIS_TRACE_SCOPE(synthesisTraceRecorder.get(), annotatableQuantumComputation, "loop", "replayed iteration", statement.lineNumber);
+                if (!replayLoopBodyIterationTemplate(*loopBodyIterationTemplate, iterationIndex)) {
+                    return false;
                 }
+                ++numReplayedLoopIterations;
+                progressOfSynthesis.numProcessedStatements += numStatementsOfLastUnrolledIteration;
+                reportProgressIfDue();
+                continue;
+            }
+
+            SYREC_SYNTHESIS_TRACE_SCOPE(synthesisTraceRecorder.get(), annotatableQuantumComputation, "loop", "unrolled iteration", statement.lineNumber);
+            if (shouldIterationsOfLoopBodyBeReplayed) {
+                indexOfFirstQuantumOperationPerIteration[iterationIndex] = annotatableQuantumComputation.getNumQuantumOperations();
+                firstCreatedQubitPerIteration[iterationIndex]            = static_cast<qc::Qubit>(annotatableQuantumComputation.getNqubits());
+            }
+
+            // adjust loop variable if necessary
+            if (!loopVariable.empty()) {
+                loopMap[loopVariable] = static_cast<unsigned>(i);
+                loopVariableNumberEvaluator.setLoopVariableValue(loopVariableSlot, static_cast<unsigned>(i));
+            }
+
+            // Every iteration of the loop body is synthesized without sharing the synthesized results of expressions of previous iterations to be able to replay the quantum operations synthesized for an iteration of the loop body.
+            if (expressionSynthesisCache != nullptr) {
+                expressionSynthesisCache->clear();
+            }
+
+            // Similarly, the ancillary qubits reset in an iteration of the loop body are only reused in the same iteration since the quantum operations synthesized for an iteration
+            // must only access ancillary qubits created during said iteration to be able to replay them with shifted qubits.
+            openAncillaryQubitPoolScope();
+            ++numEnclosingLoopBodies;
+            const std::size_t numProcessedStatementsPriorToIteration = progressOfSynthesis.numProcessedStatements;
+            const bool        synthesisOfLoopBodyOk                  = std::ranges::all_of(statement.statements, [&](const Statement::ptr& stat) { return processStatement(stat); });
+            numStatementsOfLastUnrolledIteration                     = progressOfSynthesis.numProcessedStatements - numProcessedStatementsPriorToIteration;
+            --numEnclosingLoopBodies;
+            closeAncillaryQubitPoolScope();
+
+            if (!synthesisOfLoopBodyOk) {
+                return false;
+            }
+            ++numUnrolledLoopIterations;
+
+            if (shouldIterationsOfLoopBodyBeReplayed && iterationIndex + 1U == numIterationsUsedToDetermineTemplate) {
+                indexOfFirstQuantumOperationPerIteration[numIterationsUsedToDetermineTemplate] = annotatableQuantumComputation.getNumQuantumOperations();
+                firstCreatedQubitPerIteration[numIterationsUsedToDetermineTemplate]            = static_cast<qc::Qubit>(annotatableQuantumComputation.getNqubits());
+                loopBodyIterationTemplate                                                      = canSynthesisOfStatementsBeReused() ? determineLoopBodyIterationTemplate(indexOfFirstQuantumOperationPerIteration, firstCreatedQubitPerIteration, numIterations) : std::nullopt;
+                shouldIterationsOfLoopBodyBeReplayed                                           = loopBodyIterationTemplate.has_value();
             }
         }
         // clear loop variable if necessary
         if (!loopVariable.empty()) {
             assert(loopMap.erase(loopVariable) == 1U);
+            loopVariableNumberEvaluator.setLoopVariableValue(loopVariableSlot, std::nullopt);
+        }
+        return true;
+    }
+
+    bool SyrecSynthesis::canIterationsOfLoopBodyBeReplayed(const ForStatement& statement, const std::array<unsigned, 3>& valuesOfLoopVariable) const {
+        std::vector<VariableAccess::ptr> variableAccesses;
+        if (!std::ranges::all_of(statement.statements, [&](const Statement::ptr& loopBodyStatement) { return collectVariableAccessesWithLoopVariableOnlyUsedInAffineIndices(loopBodyStatement, statement.loopVariable, variableAccesses); })) {
+            return false;
+        }
+
+        if (statement.loopVariable.empty()) {
+            return true;
+        }
+
+        const auto [firstValueOfLoopVariable, secondValueOfLoopVariable, lastValueOfLoopVariable] = valuesOfLoopVariable;
+
+        const std::int64_t numIterationsBetweenFirstAndLastIteration = (static_cast<std::int64_t>(lastValueOfLoopVariable) - static_cast<std::int64_t>(firstValueOfLoopVariable)) / (static_cast<std::int64_t>(secondValueOfLoopVariable) - static_cast<std::int64_t>(firstValueOfLoopVariable));
+
+        // All variable accesses on the same variable must be shifted by the same number of qubits per iteration to preserve the overlaps between the accessed qubits in all iterations of the loop.
+        std::unordered_map<qc::Qubit, std::int64_t> qubitIndexShiftPerIterationPerAccessedVariable;
+        const std::size_t                           loopVariableSlot            = loopVariableNumberEvaluator.getLoopVariableSlot(statement.loopVariable);
+        const std::optional<unsigned>               previousValueOfLoopVariable = loopVariableNumberEvaluator.getLoopVariableValue(loopVariableSlot);
+
+        const bool areAllVariableAccessesShiftedUniformly = [&] {
+            for (const VariableAccess::ptr& variableAccess: variableAccesses) {
+                std::array<std::int64_t, 3> firstAccessedQubitPerIteration{};
+                std::array<std::int64_t, 3> signedBitrangeLengthPerIteration{};
+                qc::Qubit                   offsetToFirstQubitOfVariable = 0;
+                for (std::size_t i = 0; i < valuesOfLoopVariable.size(); ++i) {
+                    loopVariableNumberEvaluator.setLoopVariableValue(loopVariableSlot, valuesOfLoopVariable.at(i));
+                    const std::optional<EvaluatedVariableAccess> evaluatedVariableAccess = evaluateAndValidateVariableAccess(variableAccess, firstVariableQubitOffsetLookup);
+                    if (!evaluatedVariableAccess.has_value()) {
+                        return false;
+                    }
+
+                    std::vector<qc::Qubit> accessedQubits;
+                    if (evaluatedVariableAccess->evaluatedDimensionAccess.containedOnlyNumericExpressions) {
+                        if (!getQubitsForVariableAccessContainingOnlyIndicesEvaluableAtCompileTime(*evaluatedVariableAccess, accessedQubits) || accessedQubits.empty()) {
+                            return false;
+                        }
+                        firstAccessedQubitPerIteration.at(i) = static_cast<std::int64_t>(accessedQubits.front());
+                    } else {
+                        firstAccessedQubitPerIteration.at(i) = static_cast<std::int64_t>(evaluatedVariableAccess->offsetToFirstQubitOfVariable) + static_cast<std::int64_t>(evaluatedVariableAccess->evaluatedBitrangeAccess.bitrangeStart);
+                    }
+                    signedBitrangeLengthPerIteration.at(i) = static_cast<std::int64_t>(evaluatedVariableAccess->evaluatedBitrangeAccess.bitrangeEnd) - static_cast<std::int64_t>(evaluatedVariableAccess->evaluatedBitrangeAccess.bitrangeStart);
+                    offsetToFirstQubitOfVariable           = evaluatedVariableAccess->offsetToFirstQubitOfVariable;
+                }
+
+                const std::int64_t qubitIndexShiftPerIteration = firstAccessedQubitPerIteration[1] - firstAccessedQubitPerIteration[0];
+                if (signedBitrangeLengthPerIteration[0] != signedBitrangeLengthPerIteration[1] || signedBitrangeLengthPerIteration[0] != signedBitrangeLengthPerIteration[2] || firstAccessedQubitPerIteration[2] - firstAccessedQubitPerIteration[0] != numIterationsBetweenFirstAndLastIteration * qubitIndexShiftPerIteration) {
+                    return false;
+                }
+
+                if (const auto& [recordedQubitIndexShift, wasInserted] = qubitIndexShiftPerIterationPerAccessedVariable.try_emplace(offsetToFirstQubitOfVariable, qubitIndexShiftPerIteration); !wasInserted && recordedQubitIndexShift->second != qubitIndexShiftPerIteration) {
+                    return false;
+                }
+            }
+            return true;
+        }();
+        loopVariableNumberEvaluator.setLoopVariableValue(loopVariableSlot, previousValueOfLoopVariable);
+        return areAllVariableAccessesShiftedUniformly;
+    }
+
+    std::optional<SyrecSynthesis::LoopBodyIterationTemplate> SyrecSynthesis::determineLoopBodyIterationTemplate(const std::array<std::size_t, 4>& indexOfFirstQuantumOperationPerIteration, const std::array<qc::Qubit, 4>& firstCreatedQubitPerIteration, const std::size_t numIterations) const {
+        const std::size_t numQuantumOperations = indexOfFirstQuantumOperationPerIteration[1] - indexOfFirstQuantumOperationPerIteration[0];
+        const qc::Qubit   numCreatedQubits     = firstCreatedQubitPerIteration[1] - firstCreatedQubitPerIteration[0];
+        for (std::size_t i = 1; i + 1U < indexOfFirstQuantumOperationPerIteration.size(); ++i) {
+            if (indexOfFirstQuantumOperationPerIteration.at(i + 1U) - indexOfFirstQuantumOperationPerIteration.at(i) != numQuantumOperations || firstCreatedQubitPerIteration.at(i + 1U) - firstCreatedQubitPerIteration.at(i) != numCreatedQubits) {
+                return std::nullopt;
+            }
+        }
+
+        // The qubits created in an iteration must be mapped to the ones created in the next iteration while all other qubits must remain within the qubits that existed prior to the synthesis of the loop in all iterations.
+        std::map<qc::Qubit, std::int64_t> qubitIndexShiftPerIteration;
+        const auto                        recordQubitIndexShift = [&](const std::array<qc::Qubit, 3>& qubitPerIteration) {
+            const std::int64_t qubitIndexShift = static_cast<std::int64_t>(qubitPerIteration[1]) - static_cast<std::int64_t>(qubitPerIteration[0]);
+            if (static_cast<std::int64_t>(qubitPerIteration[2]) - static_cast<std::int64_t>(qubitPerIteration[1]) != qubitIndexShift) {
+                return false;
+            }
+
+            if (qubitPerIteration[0] >= firstCreatedQubitPerIteration[0]) {
+                if (qubitPerIteration[0] >= firstCreatedQubitPerIteration[1] || qubitIndexShift != static_cast<std::int64_t>(numCreatedQubits)) {
+                    return false;
+                }
+            } else if (const std::int64_t qubitInLastIteration = static_cast<std::int64_t>(qubitPerIteration[0]) + (static_cast<std::int64_t>(numIterations - 1U) * qubitIndexShift); qubitInLastIteration < 0 || qubitInLastIteration >= static_cast<std::int64_t>(firstCreatedQubitPerIteration[0])) {
+                return false;
+            }
+
+            const auto& [recordedQubitIndexShift, wasInserted] = qubitIndexShiftPerIteration.try_emplace(qubitPerIteration[0], qubitIndexShift);
+            return wasInserted || recordedQubitIndexShift->second == qubitIndexShift;
+        };
+
+        for (std::size_t i = 0; i < numQuantumOperations; ++i) {
+            std::array<const qc::Operation*, 3> quantumOperationPerIteration{};
+            for (std::size_t j = 0; j < quantumOperationPerIteration.size(); ++j) {
+                quantumOperationPerIteration.at(j) = annotatableQuantumComputation.getQuantumOperation(indexOfFirstQuantumOperationPerIteration.at(j) + i);
+                if (quantumOperationPerIteration.at(j) == nullptr || !quantumOperationPerIteration.at(j)->isStandardOperation()) {
+                    return std::nullopt;
+                }
+            }
+
+            const auto& [firstIterationOperation, secondIterationOperation, thirdIterationOperation] = quantumOperationPerIteration;
+            for (const qc::Operation* laterIterationOperation: {secondIterationOperation, thirdIterationOperation}) {
+                if (laterIterationOperation->getType() != firstIterationOperation->getType() || laterIterationOperation->getParameter() != firstIterationOperation->getParameter() || laterIterationOperation->getTargets().size() != firstIterationOperation->getTargets().size() || laterIterationOperation->getControls().size() != firstIterationOperation->getControls().size()) {
+                    return std::nullopt;
+                }
+            }
+
+            for (std::size_t j = 0; j < firstIterationOperation->getTargets().size(); ++j) {
+                if (!recordQubitIndexShift({firstIterationOperation->getTargets().at(j), secondIterationOperation->getTargets().at(j), thirdIterationOperation->getTargets().at(j)})) {
+                    return std::nullopt;
+                }
+            }
+
+            auto secondIterationControlQubit = secondIterationOperation->getControls().cbegin();
+            auto thirdIterationControlQubit  = thirdIterationOperation->getControls().cbegin();
+            for (const qc::Control& firstIterationControlQubit: firstIterationOperation->getControls()) {
+                if (secondIterationControlQubit->type != firstIterationControlQubit.type || thirdIterationControlQubit->type != firstIterationControlQubit.type || !recordQubitIndexShift({firstIterationControlQubit.qubit, secondIterationControlQubit->qubit, thirdIterationControlQubit->qubit})) {
+                    return std::nullopt;
+                }
+                ++secondIterationControlQubit;
+                ++thirdIterationControlQubit;
+            }
+        }
+
+        // Two qubits shifted by a different offset per iteration must not be mapped to the same qubit in any iteration of the loop (e.g. the accessed qubits of a variable must not overlap with a propagated control qubit in any iteration).
+        for (auto qubitIndexShift = qubitIndexShiftPerIteration.cbegin(); qubitIndexShift != qubitIndexShiftPerIteration.cend() && qubitIndexShift->first < firstCreatedQubitPerIteration[0]; ++qubitIndexShift) {
+            for (auto otherQubitIndexShift = std::next(qubitIndexShift); otherQubitIndexShift != qubitIndexShiftPerIteration.cend() && otherQubitIndexShift->first < firstCreatedQubitPerIteration[0]; ++otherQubitIndexShift) {
+                const std::int64_t distanceBetweenQubits                    = static_cast<std::int64_t>(otherQubitIndexShift->first) - static_cast<std::int64_t>(qubitIndexShift->first);
+                const std::int64_t differenceBetweenQubitIndexShifts        = qubitIndexShift->second - otherQubitIndexShift->second;
+                const bool         areQubitsMappedToSameQubitInAnyIteration = differenceBetweenQubitIndexShifts != 0 && distanceBetweenQubits % differenceBetweenQubitIndexShifts == 0 && distanceBetweenQubits / differenceBetweenQubitIndexShifts >= 0 && distanceBetweenQubits / differenceBetweenQubitIndexShifts < static_cast<std::int64_t>(numIterations);
+                if (areQubitsMappedToSameQubitInAnyIteration) {
+                    return std::nullopt;
+                }
+            }
+        }
+
+        // Consecutive qubits with the same shift are merged into a single qubit index range to reduce the number of ranges that need to be checked while remapping the qubits of the replayed quantum operations.
+        LoopBodyIterationTemplate loopBodyIterationTemplate{.indexOfFirstQuantumOperation = indexOfFirstQuantumOperationPerIteration[0], .numQuantumOperations = numQuantumOperations, .firstCreatedQubit = firstCreatedQubitPerIteration[0], .numCreatedQubits = numCreatedQubits, .qubitIndexShiftsPerIteration = {}};
+        for (const auto& [qubit, qubitIndexShift]: qubitIndexShiftPerIteration) {
+            if (qubitIndexShift == 0) {
+                continue;
+            }
+
+            if (!loopBodyIterationTemplate.qubitIndexShiftsPerIteration.empty() && loopBodyIterationTemplate.qubitIndexShiftsPerIteration.back().second == qubitIndexShift && loopBodyIterationTemplate.qubitIndexShiftsPerIteration.back().first.lastQubitIndex + 1U == qubit) {
+                loopBodyIterationTemplate.qubitIndexShiftsPerIteration.back().first.lastQubitIndex = qubit;
+            } else {
+                loopBodyIterationTemplate.qubitIndexShiftsPerIteration.emplace_back(AnnotatableQuantumComputation::QubitIndexRange{.firstQubitIndex = qubit, .lastQubitIndex = qubit}, qubitIndexShift);
+            }
+        }
+        return loopBodyIterationTemplate;
+    }
+
+    bool SyrecSynthesis::replayLoopBodyIterationTemplate(const LoopBodyIterationTemplate& loopBodyIterationTemplate, const std::size_t iterationIndex) {
+        // The quantum operations initializing the ancillary qubits with their constant value are part of the recorded quantum operations, thus all ancillary qubits are recreated with an initial value of zero.
+        // The replayed quantum operations expect newly created ancillary qubits, an empty scope of the ancillary qubit pool prevents the reuse of ancillary qubits during their creation.
+        const auto             firstCreatedQubit = static_cast<qc::Qubit>(annotatableQuantumComputation.getNqubits());
+        std::vector<qc::Qubit> createdAncillaryQubits;
+        if (ancillaryQubitPool != nullptr) {
+            ancillaryQubitPool->openScope();
+        }
+        bool couldAncillaryQubitsBeCreated = true;
+        for (qc::Qubit numAncillaryQubitsToCreate = loopBodyIterationTemplate.numCreatedQubits; numAncillaryQubitsToCreate > 0U && couldAncillaryQubitsBeCreated;) {
+            const qc::Qubit numAncillaryQubitsInChunk = std::min(numAncillaryQubitsToCreate, 32U);
+            couldAncillaryQubitsBeCreated             = getConstantLines(numAncillaryQubitsInChunk, 0U, createdAncillaryQubits);
+            numAncillaryQubitsToCreate -= numAncillaryQubitsInChunk;
+        }
+        if (ancillaryQubitPool != nullptr) {
+            ancillaryQubitPool->closeScope();
+        }
+
+        if (!couldAncillaryQubitsBeCreated) {
+            return false;
+        }
+
+        if (const qc::Qubit expectedFirstCreatedQubit = loopBodyIterationTemplate.firstCreatedQubit + (static_cast<qc::Qubit>(iterationIndex) * loopBodyIterationTemplate.numCreatedQubits); loopBodyIterationTemplate.numCreatedQubits > 0U && firstCreatedQubit != expectedFirstCreatedQubit) {
+            getErrorStream() << "Expected the ancillary qubits of iteration " << std::to_string(iterationIndex) << " of the replayed loop body to start at qubit " << std::to_string(expectedFirstCreatedQubit) << " but they started at qubit " << std::to_string(firstCreatedQubit) << "\n";
+            return false;
+        }
+
+        std::vector<AnnotatableQuantumComputation::QubitIndexRangeMapping> qubitIndexRangeMappings;
+        qubitIndexRangeMappings.reserve(loopBodyIterationTemplate.qubitIndexShiftsPerIteration.size());
+        for (const auto& [shiftedQubitIndexRange, qubitIndexShift]: loopBodyIterationTemplate.qubitIndexShiftsPerIteration) {
+            const auto firstQubitIndexOfMappingTarget = static_cast<qc::Qubit>(static_cast<std::int64_t>(shiftedQubitIndexRange.firstQubitIndex) + (static_cast<std::int64_t>(iterationIndex) * qubitIndexShift));
+            qubitIndexRangeMappings.emplace_back(AnnotatableQuantumComputation::QubitIndexRangeMapping{.mappedQubitIndexRange = shiftedQubitIndexRange, .firstQubitIndexOfMappingTarget = firstQubitIndexOfMappingTarget});
+        }
+        const std::size_t indexOfFirstQuantumOperationOfIteration = annotatableQuantumComputation.getNumQuantumOperations();
+        if (!annotatableQuantumComputation.replayOperationsWithRemappedQubits(loopBodyIterationTemplate.indexOfFirstQuantumOperation, loopBodyIterationTemplate.numQuantumOperations, qubitIndexRangeMappings)) {
+            return false;
         }
+        recordModuleCallsOfCopiedQuantumOperations(loopBodyIterationTemplate.indexOfFirstQuantumOperation, loopBodyIterationTemplate.numQuantumOperations, indexOfFirstQuantumOperationOfIteration);
         return true;
     }
 
     bool SyrecSynthesis::onStatement(const CallStatement& statement) {
-        return synthesizeModuleCall(&statement);
+        return synthesizeAndRecordModuleCall(&statement);
     }
 
     bool SyrecSynthesis::onStatement(const UncallStatement& statement) {
-        return synthesizeModuleCall(&statement);
+        return synthesizeAndRecordModuleCall(&statement);
     }
 
     bool SyrecSynthesis::onStatement(const SkipStatement& statement [[maybe_unused]]) {
@@ -754,60 +1710,104 @@ namespace syrec {
         // The assumed bitwidth for integer constant values leads to a second problem, if no truncation is performed, that can be explained with the example 'module main(inout a(1), in b(4)) for $i = 0 to 2 step 1 do a += (b.$i:($i + 1) > 120) rof'.
         // Since the bitwidth of the operand 'b.$i:($i + 1)' is only known during synthesis no truncation of any integer constant value in the right hand side operand of the binary expression 'b.$i:($i + 1) > 120' is performed thus the bitwidth of the operand '120'
         // is assumed to be equal to 32 which in turn will lead to a synthesis error due to the operand bitwidths not being equal (lhs=2, rhs=32) if no truncation of integer constant values is performed during the evaluation of CTCEs.
-        const Expression::ptr simplifiedExpr = performCompileTimeSimplificationsOfExpression(expression, loopMap).value_or(expression);
+        const Expression::ptr simplifiedExpr = performCompileTimeSimplificationsOfExpression(expression).value_or(expression);
         if (simplifiedExpr == nullptr) {
             return false;
         }
-        if (auto const* exprAsNumericExpr = dynamic_cast<NumericExpression*>(simplifiedExpr.get()); exprAsNumericExpr != nullptr) {
-            return onExpression(*exprAsNumericExpr, optionalExpectedOperandBitwidth, lines);
+        if (simplifiedExpr->getKind() == Expression::Kind::Numeric) {
+            return onExpression(static_cast<const NumericExpression&>(*simplifiedExpr), optionalExpectedOperandBitwidth, lines);
         }
-        if (auto const* exprAsVariableExpr = dynamic_cast<VariableExpression*>(simplifiedExpr.get()); exprAsVariableExpr != nullptr) {
-            return onExpression(*exprAsVariableExpr, lines);
+        if (simplifiedExpr->getKind() == Expression::Kind::Variable) {
+            return onExpression(static_cast<const VariableExpression&>(*simplifiedExpr), lines);
         }
-        if (auto const* exprAsBinaryExpr = dynamic_cast<BinaryExpression*>(simplifiedExpr.get()); exprAsBinaryExpr != nullptr) {
-            return onExpression(*exprAsBinaryExpr, lines, lhsStat, operationVariant);
+
+        // Only the results of expressions stored in ancillary qubits are shared, the synthesis of numeric and variable expressions does not synthesize any quantum operations in most cases. The same applies to shifts synthesized by relabeling qubits.
+        const bool canSynthesisResultBeShared = expressionSynthesisCache != nullptr && !(synthesizeShiftsByRelabelingQubits && simplifiedExpr->getKind() == Expression::Kind::Shift);
+        if (canSynthesisResultBeShared) {
+            if (const std::vector<qc::Qubit>* sharedSynthesisResult = expressionSynthesisCache->findSynthesisResult(*simplifiedExpr, loopMap); sharedSynthesisResult != nullptr) {
+                lines.insert(lines.end(), sharedSynthesisResult->cbegin(), sharedSynthesisResult->cend());
+                return true;
+            }
         }
-        if (auto const* exprAsShiftExpr = dynamic_cast<ShiftExpression*>(simplifiedExpr.get()); exprAsShiftExpr != nullptr) {
-            return onExpression(*exprAsShiftExpr, lines, lhsStat, operationVariant);
+
+        const std::size_t numQubitsStoringResultPriorToSynthesis = lines.size();
+        bool              synthesisOfExprOk                       = false;
+        switch (simplifiedExpr->getKind()) {
+            case Expression::Kind::Binary:
+                synthesisOfExprOk = onExpression(static_cast<const BinaryExpression&>(*simplifiedExpr), lines, lhsStat, operationVariant);
+                break;
+            case Expression::Kind::Shift:
+                synthesisOfExprOk = onExpression(static_cast<const ShiftExpression&>(*simplifiedExpr), lines, lhsStat, operationVariant);
+                break;
+            case Expression::Kind::Unary:
+                synthesisOfExprOk = onExpression(static_cast<const UnaryExpression&>(*simplifiedExpr), lines, lhsStat, operationVariant);
+                break;
+            case Expression::Kind::Numeric:
+            case Expression::Kind::Variable:
+                break;
         }
-        if (auto const* exprAsUnaryExpr = dynamic_cast<UnaryExpression*>(simplifiedExpr.get()); exprAsUnaryExpr != nullptr) {
-            return onExpression(*exprAsUnaryExpr, lines, lhsStat, operationVariant);
+
+        if (synthesisOfExprOk && canSynthesisResultBeShared && lines.size() > numQubitsStoringResultPriorToSynthesis) {
+            expressionSynthesisCache->recordSynthesisResult(simplifiedExpr, loopMap, std::vector<qc::Qubit>(lines.cbegin() + static_cast<std::ptrdiff_t>(numQubitsStoringResultPriorToSynthesis), lines.cend()));
         }
-        return false;
+        return synthesisOfExprOk;
     }
 
     bool SyrecSynthesis::onExpression(const ShiftExpression& expression, std::vector<qc::Qubit>& lines, std::vector<qc::Qubit> const& lhsStat, const OperationVariant operationVariant) {
+        SYREC_SYNTHESIS_TRACE_SCOPE(synthesisTraceRecorder.get(), annotatableQuantumComputation, "expression", "ShiftExpression");
         std::vector<qc::Qubit> lhs;
         if (!onExpression(expression.lhs, std::nullopt, lhs, lhsStat, operationVariant)) {
             return false;
         }
 
-        const unsigned qubitIndexShiftAmount = expression.rhs->evaluate(loopMap);
+        const std::optional<unsigned> qubitIndexShiftAmount = loopVariableNumberEvaluator.tryEvaluate(expression.rhs);
+        if (!qubitIndexShiftAmount.has_value()) {
+            getErrorStream() << "Failed to evaluate the shift amount of a shift expression\n";
+            return false;
+        }
+        if (synthesizeShiftsByRelabelingQubits) {
+            return shiftByRelabelingQubits(expression.shiftOperation, expression.bitwidth(), lines, lhs, *qubitIndexShiftAmount);
+        }
         switch (expression.shiftOperation) {
             case ShiftExpression::ShiftOperation::Left: // <<
-                return getConstantLines(expression.bitwidth(), 0U, lines) && leftShift(annotatableQuantumComputation, lines, lhs, qubitIndexShiftAmount);
+                return getConstantLines(expression.bitwidth(), 0U, lines) && leftShift(annotatableQuantumComputation, lines, lhs, *qubitIndexShiftAmount);
             case ShiftExpression::ShiftOperation::Right: // <<
                 return getConstantLines(expression.bitwidth(), 0U, lines) &&
-                       rightShift(annotatableQuantumComputation, lines, lhs, qubitIndexShiftAmount);
+                       rightShift(annotatableQuantumComputation, lines, lhs, *qubitIndexShiftAmount);
             default:
                 return false;
         }
     }
 
     bool SyrecSynthesis::onExpression(const UnaryExpression& expression, std::vector<qc::Qubit>& lines, std::vector<qc::Qubit> const& lhsStat, const OperationVariant operationVariant) {
+        SYREC_SYNTHESIS_TRACE_SCOPE(synthesisTraceRecorder.get(), annotatableQuantumComputation, "expression", "UnaryExpression");
         std::vector<qc::Qubit> innerExprLines;
         if (!onExpression(expression.expr, std::nullopt, innerExprLines, lhsStat, operationVariant)) {
             return false;
         }
 
         if (expression.unaryOperation == UnaryExpression::UnaryOperation::LogicalNegation && innerExprLines.size() != 1) {
-            std::cerr << "Logical negation operation can only be used for expressions with a bitwidth of 1\n";
+            getErrorStream() << "Logical negation operation can only be used for expressions with a bitwidth of 1\n";
             return false;
         }
 
         const auto innerExprBitwidth = expression.bitwidth();
         bool       synthesisOk       = getConstantLines(innerExprBitwidth, 0U, lines);
 
+        if (foldNegationsIntoNegativeControls) {
+            // A quantum operation with a negative control qubit transfers the negated result of the inner expression to the ancillary qubits. Since a qubit can only be propagated with one polarity, the negation of a
+            // propagated control qubit is still synthesized by an X gate.
+            const std::unordered_set<qc::Qubit>& aggregateOfPropagatedControlQubits = annotatableQuantumComputation.getAggregateOfPropagatedControlQubits();
+            for (std::size_t i = 0; i < lines.size() && synthesisOk; ++i) {
+                if (i < innerExprLines.size() && !aggregateOfPropagatedControlQubits.contains(innerExprLines[i])) {
+                    synthesisOk = annotatableQuantumComputation.addOperationsImplementingMultiControlToffoliGate(qc::Controls{qc::Control{innerExprLines[i], qc::Control::Type::Neg}}, lines[i]);
+                } else {
+                    synthesisOk = (i >= innerExprLines.size() || annotatableQuantumComputation.addOperationsImplementingCnotGate(innerExprLines[i], lines[i])) && annotatableQuantumComputation.addOperationsImplementingNotGate(lines[i]);
+                }
+            }
+            return synthesisOk;
+        }
+
         // Transfer result of inner expression lines to ancillaes.
         for (std::size_t i = 0; i < innerExprLines.size() && synthesisOk; ++i) {
             synthesisOk = annotatableQuantumComputation.addOperationsImplementingCnotGate(innerExprLines.at(i), lines.at(i));
@@ -816,7 +1816,7 @@ namespace syrec {
     }
 
     bool SyrecSynthesis::onExpression(const NumericExpression& expression, const std::optional<unsigned>& optionalExpectedOperandBitwidth, std::vector<qc::Qubit>& lines) {
-        if (const std::optional<unsigned> compileTimeValueOfNumericExpression = expression.value->tryEvaluate(loopMap); compileTimeValueOfNumericExpression.has_value()) {
+        if (const std::optional<unsigned> compileTimeValueOfNumericExpression = loopVariableNumberEvaluator.tryEvaluate(expression.value); compileTimeValueOfNumericExpression.has_value()) {
             if (optionalExpectedOperandBitwidth.has_value()) {
                 const unsigned truncatedCompileTimeValue = utils::truncateConstantValueToExpectedBitwidth(*compileTimeValueOfNumericExpression, *optionalExpectedOperandBitwidth, integerConstantTruncationOperation);
                 return getConstantLines(*optionalExpectedOperandBitwidth, truncatedCompileTimeValue, lines);
@@ -827,16 +1827,18 @@ namespace syrec {
     }
 
     bool SyrecSynthesis::onExpression(const VariableExpression& expression, std::vector<qc::Qubit>& lines) {
+        SYREC_SYNTHESIS_TRACE_SCOPE(synthesisTraceRecorder.get(), annotatableQuantumComputation, "expression", "VariableExpression");
         return getVariables(expression.var, lines);
     }
 
     bool SyrecSynthesis::onExpression(const BinaryExpression& expression, std::vector<qc::Qubit>& lines, std::vector<qc::Qubit> const& lhsStat, const OperationVariant operationVariant) {
+        SYREC_SYNTHESIS_TRACE_SCOPE(synthesisTraceRecorder.get(), annotatableQuantumComputation, "expression", "BinaryExpression");
         if (expression.lhs == nullptr || expression.rhs == nullptr) {
             return false;
         }
 
-        const auto* const lhsOperandAsNumericExpr = dynamic_cast<const NumericExpression*>(expression.lhs.get());
-        const auto* const rhsOperandAsNumericExpr = dynamic_cast<const NumericExpression*>(expression.rhs.get());
+        const auto* const lhsOperandAsNumericExpr = expressionCast<NumericExpression>(expression.lhs.get());
+        const auto* const rhsOperandAsNumericExpr = expressionCast<NumericExpression>(expression.rhs.get());
         // Subexpressions containing only values evaluable during synthesis should have been simplified, otherwise 32 ancillary qubits are generated for an arbitrary integer constant value (the default bitwidth assumed for such a value)
         if (lhsOperandAsNumericExpr != nullptr && rhsOperandAsNumericExpr != nullptr) {
             return false;
@@ -853,14 +1855,35 @@ namespace syrec {
             expectedOperandsBitwidth = 1U;
         }
 
+        // A multiplication or relational operation with a constant operand, whose value is known at compile time, can be synthesized without storing the constant in ancillary qubits.
+        const NumericExpression* const constantOperand                   = lhsOperandAsNumericExpr != nullptr ? lhsOperandAsNumericExpr : rhsOperandAsNumericExpr;
+        const std::optional<unsigned>  valueOfSpecializedConstantOperand = specializeOperationsWithConstantOperand && constantOperand != nullptr && isBinaryOperationSpecializedForConstantOperand(expression.binaryOperation) ? loopVariableNumberEvaluator.tryEvaluate(constantOperand->value) : std::nullopt;
+
+        // The operands of an operation whose result is known at compile time are not synthesized, which is only possible if the operands are not reverted after the synthesis of the enclosing statement like in the line aware synthesis.
+        if (narrowOperationsUsingValueRangeAnalysis && canSynthesizedResultsOfExpressionsBeShared()) {
+            if (const std::optional<ValueRange> rangeOfResult = determineValueRangeOfExpression(expression, loopMap, std::nullopt, integerConstantTruncationOperation); rangeOfResult.has_value() && rangeOfResult->isConstant() && rangeOfResult->bitwidth == expression.bitwidth()) {
+                return getConstantLines(expression.bitwidth(), static_cast<qc::Qubit>(rangeOfResult->minValue), lines);
+            }
+        }
+
         std::vector<qc::Qubit> lhs;
         std::vector<qc::Qubit> rhs;
-        if (!onExpression(expression.lhs, expectedOperandsBitwidth, lhs, lhsStat, operationVariant) || !onExpression(expression.rhs, expectedOperandsBitwidth, rhs, lhsStat, operationVariant) || lhs.size() != rhs.size()) {
+        if (valueOfSpecializedConstantOperand.has_value()) {
+            std::vector<qc::Qubit>& nonConstantOperand = lhsOperandAsNumericExpr != nullptr ? rhs : lhs;
+            if (!onExpression(lhsOperandAsNumericExpr != nullptr ? expression.rhs : expression.lhs, expectedOperandsBitwidth, nonConstantOperand, lhsStat, operationVariant) || nonConstantOperand.empty()) {
+                return false;
+            }
+        } else if (!onExpression(expression.lhs, expectedOperandsBitwidth, lhs, lhsStat, operationVariant) || !onExpression(expression.rhs, expectedOperandsBitwidth, rhs, lhsStat, operationVariant) || lhs.size() != rhs.size()) {
+            return false;
+        }
+
+        // The synthesis of some binary operations temporarily modifies the qubits of one operand, which would also modify the other operand if the latter is a shift of the former synthesized by relabeling its qubits (e.g. 'a = (a << 1)').
+        if (synthesizeShiftsByRelabelingQubits && (!copyRelabeledQubitsOfShiftOperandSharedWithOtherOperand(lhs, rhs, *expression.lhs) || !copyRelabeledQubitsOfShiftOperandSharedWithOtherOperand(rhs, lhs, *expression.rhs))) {
             return false;
         }
 
-        expLhss.push(lhs);
-        expRhss.push(rhs);
+        expLhss.push(qubitSpanInterner.intern(lhs));
+        expRhss.push(qubitSpanInterner.intern(rhs));
         expOpp.push(expression.binaryOperation);
 
         // The previous implementation used unscoped enum declarations for both the operations of a BinaryExpression as well as for an AssignStatement.
@@ -877,30 +1900,67 @@ namespace syrec {
             }
         }
 
+        if (valueOfSpecializedConstantOperand.has_value()) {
+            const std::vector<qc::Qubit>& nonConstantOperand = lhsOperandAsNumericExpr != nullptr ? rhs : lhs;
+            const unsigned                truncatedConstant  = utils::truncateConstantValueToExpectedBitwidth(*valueOfSpecializedConstantOperand, static_cast<unsigned>(nonConstantOperand.size()), integerConstantTruncationOperation);
+            return synthesizeBinaryOperationWithConstantOperand(expression.binaryOperation, expression.bitwidth(), lines, nonConstantOperand, truncatedConstant, lhsOperandAsNumericExpr != nullptr);
+        }
+
+        // The omitted bits of the operands and of the result of an operation narrowed by the value range analysis are known to be zero, thus the ancillary qubits storing the omitted bits of the result are only allocated.
+        std::optional<unsigned> numRequiredOperandBits;
+        if (narrowOperationsUsingValueRangeAnalysis && (canSynthesizedResultsOfExpressionsBeShared() || !isBinaryOperationSynthesizedInQubitsOfOperands(expression.binaryOperation))) {
+            numRequiredOperandBits = determineNumberOfOperandBitsRequiredByBinaryOperation(expression, loopMap, integerConstantTruncationOperation);
+            if (numRequiredOperandBits.has_value() && *numRequiredOperandBits < lhs.size() && (isBinaryOperationRelationalOperation(expression.binaryOperation) || expression.bitwidth() == lhs.size())) {
+                lhs.resize(*numRequiredOperandBits);
+                rhs.resize(*numRequiredOperandBits);
+            } else {
+                numRequiredOperandBits.reset();
+            }
+        }
+        const unsigned synthesizedBitwidth          = numRequiredOperandBits.value_or(expression.bitwidth());
+        const auto     padResultOfNarrowedOperation = [&](std::vector<qc::Qubit>& result) {
+            return !numRequiredOperandBits.has_value() || getConstantLines(expression.bitwidth() - *numRequiredOperandBits, 0U, result);
+        };
+
+        if (shareComparatorOfRelationalOperations && isBinaryOperationRelationalOperation(expression.binaryOperation)) {
+            const std::optional<qc::Qubit> ancillaryQubitForIntermediateResult = getConstantLine(false, getLastCreatedModuleCallStackInstance());
+            if (!ancillaryQubitForIntermediateResult.has_value()) {
+                return false;
+            }
+            lines.emplace_back(*ancillaryQubitForIntermediateResult);
+            return synthesizeRelationalOperationUsingSharedComparator(expression.binaryOperation, lines.front(), lhs, rhs);
+        }
+
         bool synthesisOfExprOk = true;
         switch (expression.binaryOperation) {
             case BinaryExpression::BinaryOperation::Add: // +
-                synthesisOfExprOk = expAdd(expression.bitwidth(), lines, lhs, rhs);
+                synthesisOfExprOk = expAdd(synthesizedBitwidth, lines, lhs, rhs) && padResultOfNarrowedOperation(lines);
                 break;
             case BinaryExpression::BinaryOperation::Subtract: // -
-                synthesisOfExprOk = expSubtract(expression.bitwidth(), lines, lhs, rhs);
+                synthesisOfExprOk = expSubtract(synthesizedBitwidth, lines, lhs, rhs) && padResultOfNarrowedOperation(lines);
                 break;
             case BinaryExpression::BinaryOperation::Exor: // ^
-                synthesisOfExprOk = expExor(expression.bitwidth(), lines, lhs, rhs);
+                synthesisOfExprOk = expExor(synthesizedBitwidth, lines, lhs, rhs) && padResultOfNarrowedOperation(lines);
                 break;
             case BinaryExpression::BinaryOperation::Multiply: // *
-                synthesisOfExprOk = getConstantLines(expression.bitwidth(), 0U, lines) && multiplication(annotatableQuantumComputation, lines, lhs, rhs);
-                break;
-            case BinaryExpression::BinaryOperation::Divide: { // /
-                std::vector<qc::Qubit>  remainder;
-                std::vector<qc::Qubit>& quotient = lines;
-                synthesisOfExprOk                = getConstantLines(expression.bitwidth(), 0U, remainder) && getConstantLines(expression.bitwidth(), 0U, quotient) && division(annotatableQuantumComputation, lhs, rhs, quotient, remainder);
+                synthesisOfExprOk = getConstantLines(synthesizedBitwidth, 0U, lines) && multiplication(annotatableQuantumComputation, lines, lhs, rhs) && padResultOfNarrowedOperation(lines);
                 break;
-            }
+            case BinaryExpression::BinaryOperation::Divide:   // /
             case BinaryExpression::BinaryOperation::Modulo: { // %
-                std::vector<qc::Qubit>& remainder = lines;
-                std::vector<qc::Qubit>  quotient;
-                synthesisOfExprOk = getConstantLines(expression.bitwidth(), 0U, remainder) && getConstantLines(expression.bitwidth(), 0U, quotient) && modulo(annotatableQuantumComputation, lhs, rhs, quotient, remainder);
+                const bool isQuotientSynthesized = expression.binaryOperation == BinaryExpression::BinaryOperation::Divide;
+                if (const SynthesizedDivider* sharedDivider = findDividerSynthesizedForCurrentStatement(lhs, rhs); sharedDivider != nullptr) {
+                    const std::vector<qc::Qubit>& sharedSynthesisResult = isQuotientSynthesized ? sharedDivider->quotient : sharedDivider->remainder;
+                    lines.insert(lines.end(), sharedSynthesisResult.cbegin(), sharedSynthesisResult.cend());
+                    break;
+                }
+
+                std::vector<qc::Qubit> remainder;
+                std::vector<qc::Qubit> quotient;
+                synthesisOfExprOk = getConstantLines(synthesizedBitwidth, 0U, remainder) && getConstantLines(synthesizedBitwidth, 0U, quotient) && (isQuotientSynthesized ? division(annotatableQuantumComputation, lhs, rhs, quotient, remainder) : modulo(annotatableQuantumComputation, lhs, rhs, quotient, remainder)) && padResultOfNarrowedOperation(remainder) && padResultOfNarrowedOperation(quotient);
+                lines.insert(lines.end(), isQuotientSynthesized ? quotient.cbegin() : remainder.cbegin(), isQuotientSynthesized ? quotient.cend() : remainder.cend());
+                if (synthesisOfExprOk && shareDividerOfQuotientAndRemainder) {
+                    dividersSynthesizedForCurrentStatement.emplace_back(SynthesizedDivider{.dividend = lhs, .divisor = rhs, .quotient = quotient, .remainder = remainder});
+                }
                 break;
             }
             case BinaryExpression::BinaryOperation::LogicalAnd: { // &&
@@ -925,10 +1985,10 @@ namespace syrec {
                 break;
             }
             case BinaryExpression::BinaryOperation::BitwiseAnd: // &
-                synthesisOfExprOk = getConstantLines(expression.bitwidth(), 0U, lines) && bitwiseAnd(annotatableQuantumComputation, lines, lhs, rhs);
+                synthesisOfExprOk = getConstantLines(synthesizedBitwidth, 0U, lines) && bitwiseAnd(annotatableQuantumComputation, lines, lhs, rhs) && padResultOfNarrowedOperation(lines);
                 break;
             case BinaryExpression::BinaryOperation::BitwiseOr: // |
-                synthesisOfExprOk = getConstantLines(expression.bitwidth(), 0U, lines) && bitwiseOr(annotatableQuantumComputation, lines, lhs, rhs);
+                synthesisOfExprOk = getConstantLines(synthesizedBitwidth, 0U, lines) && bitwiseOr(annotatableQuantumComputation, lines, lhs, rhs) && padResultOfNarrowedOperation(lines);
                 break;
             case BinaryExpression::BinaryOperation::LessThan: { // <
                 const std::optional<qc::Qubit> ancillaryQubitForIntermediateResult = getConstantLine(false, getLastCreatedModuleCallStackInstance());
@@ -1053,11 +2113,7 @@ namespace syrec {
     }
 
     bool SyrecSynthesis::bitwiseCnot(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<qc::Qubit>& dest, const std::vector<qc::Qubit>& src) {
-        bool synthesisOk = dest.size() >= src.size();
-        for (std::size_t i = 0; i < src.size() && synthesisOk; ++i) {
-            synthesisOk = annotatableQuantumComputation.addOperationsImplementingCnotGate(src[i], dest[i]);
-        }
-        return synthesisOk;
+        return dest.size() >= src.size() && annotatableQuantumComputation.addOperationsImplementingCnotGates(src, std::span(dest).first(src.size()));
     }
 
     bool SyrecSynthesis::bitwiseOr(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<qc::Qubit>& dest, const std::vector<qc::Qubit>& src1, const std::vector<qc::Qubit>& src2) {
@@ -1095,14 +2151,10 @@ namespace syrec {
             return false;
         }
 
-        // Implementation of the division/modulo operation is based on the restoring division algorithm defined in the paper
-        // 'Quantum Circuit Designs of Integer Division Optimizing T-count and T-depth (arXiv:1809.09732v1)'. The non-restoring
-        // variant of the algorithm defined in the same paper requires less quantum gates in its implementation. Note that this algorithm
-        // assumes that the dividend and divisor are positive two complement numbers.
-        bool synthesisOk = true;
-        for (std::size_t i = 0; i < operandBitwidth && synthesisOk; ++i) {
-            synthesisOk = annotatableQuantumComputation.addOperationsImplementingCnotGate(dividend[i], quotient[i]);
-        }
+        // Implementation of the division/modulo operation is based on the restoring and non-restoring division algorithms defined in the paper
+        // 'Quantum Circuit Designs of Integer Division Optimizing T-count and T-depth (arXiv:1809.09732v1)'. Note that both algorithms
+        // assume that the dividend and divisor are positive two complement numbers.
+        bool synthesisOk = annotatableQuantumComputation.addOperationsImplementingCnotGates(dividend, quotient);
 
         std::vector<qc::Qubit> truncatedAggregateOfRemainderAndQuotientQubits(operandBitwidth, 0);
         // The aggregate variable V is a 'virtual' 2*N qubit variable that stores the combination of the remainder and quotient qubits in the form
@@ -1123,26 +2175,45 @@ namespace syrec {
 
             // The carry out bit of the subtraction operation is used to determine whether the resulting difference was < 0.
             const qc::Qubit signBitOfSubtraction = remainder[operandBitwidth - i];
-            // Y = Y - b
-            synthesisOk = decreaseWithCarry(annotatableQuantumComputation, truncatedAggregateOfRemainderAndQuotientQubits, divisor, signBitOfSubtraction);
+            if (dividerArchitecture == DividerArchitecture::NonRestoring) {
+                // The sign bit together with Y forms the N + 1 qubit partial remainder from which the divisor is subtracted if the previous partial remainder was not negative (i.e. the previously computed quotient bit is 1, which is assumed for the first iteration)
+                // and to which the divisor is added otherwise. The subtraction Y - b is synthesized as NOT(NOT(Y) + b) with the complement of the partial remainder being controlled by the previously computed quotient bit.
+                const std::optional<qc::Qubit> previouslyComputedQuotientBit = i > 1 ? std::make_optional(remainder[operandBitwidth - i + 1]) : std::nullopt;
+
+                const auto complementPartialRemainderIfDivisorIsSubtracted = [&]() {
+                    bool complementOk = previouslyComputedQuotientBit.has_value() ? annotatableQuantumComputation.addOperationsImplementingCnotGate(*previouslyComputedQuotientBit, signBitOfSubtraction) : annotatableQuantumComputation.addOperationsImplementingNotGate(signBitOfSubtraction);
+                    for (std::size_t j = 0; j < operandBitwidth && complementOk; ++j) {
+                        complementOk = previouslyComputedQuotientBit.has_value() ? annotatableQuantumComputation.addOperationsImplementingCnotGate(*previouslyComputedQuotientBit, truncatedAggregateOfRemainderAndQuotientQubits[j]) : annotatableQuantumComputation.addOperationsImplementingNotGate(truncatedAggregateOfRemainderAndQuotientQubits[j]);
+                    }
+                    return complementOk;
+                };
+                // Y = Y - b or Y = Y + b
+                synthesisOk = complementPartialRemainderIfDivisorIsSubtracted() && inplaceAdd(annotatableQuantumComputation, divisor, truncatedAggregateOfRemainderAndQuotientQubits, signBitOfSubtraction) && complementPartialRemainderIfDivisorIsSubtracted();
+            } else {
+                // Y = Y - b
+                synthesisOk = decreaseWithCarry(annotatableQuantumComputation, truncatedAggregateOfRemainderAndQuotientQubits, divisor, signBitOfSubtraction);
 
-            // The restore operation of the aggregate variable should only be performed when Y < 0.
-            synthesisOk &= annotatableQuantumComputation.registerControlQubitForPropagationInCurrentAndNestedScopes(signBitOfSubtraction);
+                // The restore operation of the aggregate variable should only be performed when Y < 0.
+                synthesisOk &= annotatableQuantumComputation.registerControlQubitForPropagationInCurrentAndNestedScopes(signBitOfSubtraction);
 
-            // Y = Y + divisor
-            synthesisOk &= inplaceAdd(annotatableQuantumComputation, divisor, truncatedAggregateOfRemainderAndQuotientQubits) && annotatableQuantumComputation.deregisterControlQubitFromPropagationInCurrentScope(signBitOfSubtraction);
+                // Y = Y + divisor
+                synthesisOk &= inplaceAdd(annotatableQuantumComputation, divisor, truncatedAggregateOfRemainderAndQuotientQubits) && annotatableQuantumComputation.deregisterControlQubitFromPropagationInCurrentScope(signBitOfSubtraction);
+            }
 
             // After the 'restoring' operation for the variable V was performed, the final value of the remainder qubit can be set (remainder[i] = NOT(sign bit)).
             synthesisOk &= annotatableQuantumComputation.addOperationsImplementingNotGate(signBitOfSubtraction);
         }
+
+        // The final partial remainder of the non-restoring division, stored in the quotient qubits, is restored by adding the divisor if it was negative (i.e. the last computed quotient bit is 0). Since the restored remainder is
+        // not negative, only its N least significant qubits need to be considered.
+        if (dividerArchitecture == DividerArchitecture::NonRestoring && !remainder.empty() && synthesisOk) {
+            synthesisOk = annotatableQuantumComputation.addOperationsImplementingNotGate(remainder.front()) && annotatableQuantumComputation.registerControlQubitForPropagationInCurrentAndNestedScopes(remainder.front()) && inplaceAdd(annotatableQuantumComputation, divisor, quotient) && annotatableQuantumComputation.deregisterControlQubitFromPropagationInCurrentScope(remainder.front()) && annotatableQuantumComputation.addOperationsImplementingNotGate(remainder.front());
+        }
         annotatableQuantumComputation.deactivateControlQubitPropagationScope();
 
         // While the description of the reference algorithm states that the qubits of the quotient and remainder at this point store the values of the quotient and remainder respectively,
         // manual executions of the algorithm resulted in the quotient qubits storing the value of the remainder and vice versa, thus a final swap of the quotient and remainder qubits is required.
-        for (std::size_t i = 0; i < operandBitwidth && synthesisOk; ++i) {
-            synthesisOk = annotatableQuantumComputation.addOperationsImplementingFredkinGate(quotient[i], remainder[i]);
-        }
-        return synthesisOk;
+        return synthesisOk && annotatableQuantumComputation.addOperationsImplementingFredkinGates(quotient, remainder);
     }
 
     bool SyrecSynthesis::equals(AnnotatableQuantumComputation& annotatableQuantumComputation, const qc::Qubit dest, const std::vector<qc::Qubit>& src1, const std::vector<qc::Qubit>& src2) {
@@ -1171,65 +2242,30 @@ namespace syrec {
         return lessThan(annotatableQuantumComputation, dest, src1, src2);
     }
 
-    bool SyrecSynthesis::inplaceAdd(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<qc::Qubit>& lhs, const std::vector<qc::Qubit>& rhs, const std::optional<qc::Qubit>& optionalCarryOut) {
+    bool SyrecSynthesis::inplaceAdd(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::span<const qc::Qubit> lhs, const std::span<const qc::Qubit> rhs, const std::optional<qc::Qubit>& optionalCarryOut) {
         if (lhs.size() != rhs.size()) {
             return false;
         }
 
-        if (rhs.empty()) {
-            return true;
-        }
-
-        bool synthesisOk = true;
-        if (rhs.size() == 1) {
-            synthesisOk = annotatableQuantumComputation.addOperationsImplementingCnotGate(lhs.front(), rhs.front());
-            return synthesisOk;
-        }
-
-        const std::size_t bitwidth = rhs.size();
-        const auto&       a        = lhs;
-        const auto&       b        = rhs;
-
-        // Implementation of the addition algorithm (a + b) mod N (N > 1) defined in the paper "Quantum Addition Circuits and Unbounded Fan-Out" (https://arxiv.org/abs/0910.2530v1)
-        // based on a ripple-carry adder that requires no ancillary qubits. The sum of the two input operands 'a' and 'b' is stored in the qubits of the operand 'b'
-        // (i.e. the right-hand side operand of the expression (a + b)). We will use N to denote the bitwidth of the operands in the description of the steps of the algorithm.
-
-        // 1. Calculate the terms (a_i XOR b_i) for all 0 < i < N and store results in b_i as CNOT(control: a_i, target: b_i)
-        for (std::size_t i = 1; i < bitwidth && synthesisOk; ++i) {
-            synthesisOk = annotatableQuantumComputation.addOperationsImplementingCnotGate(a[i], b[i]);
-        }
-
-        // Optionally copy the value of the qubit a[N - 1] for the calculation of the carry out qubit
-        synthesisOk &= !optionalCarryOut.has_value() || annotatableQuantumComputation.addOperationsImplementingCnotGate(a[bitwidth - 1], *optionalCarryOut);
-
-        // 2. For every N > i > 0 store a backup of a_(i - 1) into a_i as CNOT(control: a_(i - 1), target: a_i)
-        for (std::size_t i = bitwidth - 1; i > 1 && synthesisOk; --i) {
-            synthesisOk = annotatableQuantumComputation.addOperationsImplementingCnotGate(a[i - 1], a[i]);
-        }
-
-        // 3. Calculate the carry bits and store them in a_i for every 0 <= i < (N - 1) as TOFFOLI(controls: {b_i, a_i}, target: a_(i + 1))
-        for (std::size_t i = 0; i < bitwidth - 1 && synthesisOk; ++i) {
-            synthesisOk = annotatableQuantumComputation.addOperationsImplementingToffoliGate(b[i], a[i], a[i + 1]);
-        }
-
-        // Optionally calculate the value of carry out qubit
-        synthesisOk &= !optionalCarryOut.has_value() || annotatableQuantumComputation.addOperationsImplementingToffoliGate(a[bitwidth - 1], b[bitwidth - 1], *optionalCarryOut);
-
-        // 4. Calculate term (b_i XOR c_i) of the final sum terms (a_i XOR b_i XOR c_i) and "remove" the carry bit values from the lines (a_(i - 1)) storing the backup values of a_i for all N > i > 0:
-        //    - CNOT(control: a_i, b_i)
-        //    - TOFFOLI(controls: {a_(i - 1), b_(i - 1)}, target: a_i)
-        for (std::size_t i = bitwidth - 1; i > 0 && synthesisOk; --i) {
-            synthesisOk = annotatableQuantumComputation.addOperationsImplementingCnotGate(a[i], b[i]) && annotatableQuantumComputation.addOperationsImplementingToffoliGate(a[i - 1], b[i - 1], a[i]);
-        }
-
-        // 5. Restore the backup values storing in (a_(i - 1)) back to a_i as: 0 < i < N - 1: CNOT(control: a_i, target: a_(i + 1))
-        for (std::size_t i = 1; i < bitwidth - 1 && synthesisOk; ++i) {
-            synthesisOk = annotatableQuantumComputation.addOperationsImplementingCnotGate(a[i], a[i + 1]);
-        }
+        // All ancillary qubits required by the adder are reset to zero by the adder.
+        std::vector<qc::Qubit> ancillaryQubitsOfAdder;
+        return getZeroInitializedAncillaryQubits(determineNumberOfAncillaryQubitsRequiredByAdder(adderArchitecture, rhs.size(), optionalCarryOut.has_value()), ancillaryQubitsOfAdder) && synthesizeInplaceAddition(annotatableQuantumComputation, adderArchitecture, lhs, rhs, ancillaryQubitsOfAdder, optionalCarryOut);
+    }
 
-        // 6. Calculate the final sum terms as: N > i > 0: CNOT(control: a_i, b_i)
-        for (std::size_t i = bitwidth; i > 0 && synthesisOk; --i) {
-            synthesisOk = annotatableQuantumComputation.addOperationsImplementingCnotGate(a[i - 1], b[i - 1]);
+    bool SyrecSynthesis::addConstantWithoutAncillaryQubits(const std::vector<qc::Qubit>& qubits, const unsigned constant, const bool subtractConstant) {
+        // The constant is decomposed into its non-adjacent form (i.e. a sum of signed powers of two with no two adjacent non-zero digits) to minimize the number of required increments and decrements.
+        // Every non-zero digit at position k is synthesized as an increment (decrement) of the qubits starting at position k, whose direction is inverted for a subtraction.
+        bool          synthesisOk    = true;
+        std::uint64_t remainingValue = constant;
+        for (std::size_t k = 0; k < qubits.size() && remainingValue != 0 && synthesisOk; ++k, remainingValue >>= 1U) {
+            if ((remainingValue & 1U) == 0U) {
+                continue;
+            }
+            // The digit at the most significant position is always positive since the increment and decrement of a single qubit are equal.
+            const bool                   isDigitNegative = (remainingValue & 3U) == 3U && k + 1 < qubits.size();
+            const std::vector<qc::Qubit> incrementedQubits(qubits.begin() + static_cast<std::ptrdiff_t>(k), qubits.end());
+            synthesisOk    = isDigitNegative != subtractConstant ? decrement(annotatableQuantumComputation, incrementedQubits) : increment(annotatableQuantumComputation, incrementedQubits);
+            remainingValue = isDigitNegative ? remainingValue + 1U : remainingValue - 1U;
         }
         return synthesisOk;
     }
@@ -1267,16 +2303,37 @@ namespace syrec {
             return false;
         }
 
-        std::vector<qc::Qubit> sum     = dest;
-        std::vector<qc::Qubit> partial = src2;
+        // The i-th partial product (src1[i] * src2) shifted by i bits is added to the qubits dest[i..N) of the product with only the N - i least significant bits of src2 being relevant.
+        // The first partial product is copied to the product (which is zero at this point) instead of using an adder.
+        const std::span<const qc::Qubit> product(dest);
+        const std::span<const qc::Qubit> rhsOperand(src2);
+        if (multiplierArchitecture == MultiplierArchitecture::PartialProducts) {
+            bool synthesisOk = true;
+            for (std::size_t j = 0; j < dest.size() && synthesisOk; ++j) {
+                synthesisOk = annotatableQuantumComputation.addOperationsImplementingToffoliGate(src1.front(), src2[j], dest[j]);
+            }
+
+            std::vector<qc::Qubit> qubitsStoringPartialProduct;
+            synthesisOk &= getZeroInitializedAncillaryQubits(dest.size() - 1U, qubitsStoringPartialProduct);
+            const auto computePartialProduct = [&](const std::size_t i) {
+                bool synthesisOfPartialProductOk = true;
+                for (std::size_t j = 0; j < dest.size() - i && synthesisOfPartialProductOk; ++j) {
+                    synthesisOfPartialProductOk = annotatableQuantumComputation.addOperationsImplementingToffoliGate(src1[i], src2[j], qubitsStoringPartialProduct[j]);
+                }
+                return synthesisOfPartialProductOk;
+            };
+
+            for (std::size_t i = 1; i < dest.size() && synthesisOk; ++i) {
+                synthesisOk = computePartialProduct(i) && inplaceAdd(annotatableQuantumComputation, std::span<const qc::Qubit>(qubitsStoringPartialProduct).first(dest.size() - i), product.subspan(i)) && computePartialProduct(i);
+            }
+            return synthesisOk;
+        }
 
         annotatableQuantumComputation.activateControlQubitPropagationScope();
-        bool synthesisOk = annotatableQuantumComputation.registerControlQubitForPropagationInCurrentAndNestedScopes(src1.front()) && bitwiseCnot(annotatableQuantumComputation, sum, partial) && annotatableQuantumComputation.deregisterControlQubitFromPropagationInCurrentScope(src1.front());
+        bool synthesisOk = annotatableQuantumComputation.registerControlQubitForPropagationInCurrentAndNestedScopes(src1.front()) && bitwiseCnot(annotatableQuantumComputation, dest, src2) && annotatableQuantumComputation.deregisterControlQubitFromPropagationInCurrentScope(src1.front());
 
         for (std::size_t i = 1; i < dest.size() && synthesisOk; ++i) {
-            sum.erase(sum.begin());
-            partial.pop_back();
-            synthesisOk = annotatableQuantumComputation.registerControlQubitForPropagationInCurrentAndNestedScopes(src1[i]) && inplaceAdd(annotatableQuantumComputation, partial, sum) && annotatableQuantumComputation.deregisterControlQubitFromPropagationInCurrentScope(src1[i]);
+            synthesisOk = annotatableQuantumComputation.registerControlQubitForPropagationInCurrentAndNestedScopes(src1[i]) && inplaceAdd(annotatableQuantumComputation, rhsOperand.first(dest.size() - i), product.subspan(i)) && annotatableQuantumComputation.deregisterControlQubitFromPropagationInCurrentScope(src1[i]);
         }
         annotatableQuantumComputation.deactivateControlQubitPropagationScope();
         return synthesisOk;
@@ -1286,15 +2343,105 @@ namespace syrec {
         return equals(annotatableQuantumComputation, dest, src1, src2) && annotatableQuantumComputation.addOperationsImplementingNotGate(dest);
     }
 
-    // NOLINTNEXTLINE(cppcoreguidelines-noexcept-swap, performance-noexcept-swap, bugprone-exception-escape)
-    bool SyrecSynthesis::swap(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<qc::Qubit>& dest1, const std::vector<qc::Qubit>& dest2) {
-        bool synthesisOk = dest2.size() >= dest1.size();
-        for (std::size_t i = 0; i < dest1.size() && synthesisOk; ++i) {
-            synthesisOk = annotatableQuantumComputation.addOperationsImplementingFredkinGate(dest1[i], dest2[i]);
+    bool SyrecSynthesis::multiplicationByConstant(const std::vector<qc::Qubit>& dest, const std::vector<qc::Qubit>& src, const unsigned constant) {
+        if (src.size() < dest.size()) {
+            return false;
+        }
+
+        // Every non-zero digit at position k of the canonical signed digit representation (i.e. the non-adjacent form) of the constant adds/subtracts the operand shifted by k bits to/from the product.
+        // The first added shifted operand is copied to the product (which is zero at this point) instead of using an adder.
+        bool          synthesisOk    = true;
+        bool          isProductZero  = true;
+        std::uint64_t remainingValue = constant;
+        for (std::size_t k = 0; k < dest.size() && remainingValue != 0 && synthesisOk; ++k, remainingValue >>= 1U) {
+            if ((remainingValue & 1U) == 0U) {
+                continue;
+            }
+            const bool                   isDigitNegative = (remainingValue & 3U) == 3U && k + 1 < dest.size();
+            const std::vector<qc::Qubit> summandQubitsOfProduct(dest.begin() + static_cast<std::ptrdiff_t>(k), dest.end());
+            const std::vector<qc::Qubit> shiftedOperand(src.begin(), src.begin() + static_cast<std::ptrdiff_t>(summandQubitsOfProduct.size()));
+            if (isDigitNegative) {
+                synthesisOk = inplaceSubtract(annotatableQuantumComputation, shiftedOperand, summandQubitsOfProduct);
+            } else {
+                synthesisOk = isProductZero ? bitwiseCnot(annotatableQuantumComputation, summandQubitsOfProduct, shiftedOperand) : inplaceAdd(annotatableQuantumComputation, shiftedOperand, summandQubitsOfProduct);
+            }
+            isProductZero  = false;
+            remainingValue = isDigitNegative ? remainingValue + 1U : remainingValue - 1U;
+        }
+        return synthesisOk;
+    }
+
+    bool SyrecSynthesis::compareWithConstant(AnnotatableQuantumComputation& annotatableQuantumComputation, const qc::Qubit dest, const std::vector<qc::Qubit>& src, const unsigned constant, const bool checkLessThan) {
+        // The qubits of the operand at the positions of the '0' bits of the constant are negated so that every qubit of the operand is set iff its bit is equal to the one of the constant.
+        bool synthesisOk = true;
+        for (std::size_t i = 0; i < src.size() && synthesisOk; ++i) {
+            synthesisOk = ((constant >> i) & 1U) != 0U || annotatableQuantumComputation.addOperationsImplementingNotGate(src[i]);
+        }
+
+        // The comparison src < constant (src > constant) is decided at every position i with a '1' ('0') bit in the constant for which the bit of the operand differs while all more significant bits are equal.
+        // Since at most one such position exists for any value of the operand, the results for all positions can be combined by toggling the destination qubit.
+        for (std::size_t i = 0; i < src.size() && synthesisOk; ++i) {
+            if ((((constant >> i) & 1U) != 0U) != checkLessThan) {
+                continue;
+            }
+            synthesisOk = annotatableQuantumComputation.addOperationsImplementingNotGate(src[i]) && annotatableQuantumComputation.addOperationsImplementingMultiControlToffoliGate(qc::Controls(src.begin() + static_cast<std::ptrdiff_t>(i), src.end()), dest) && annotatableQuantumComputation.addOperationsImplementingNotGate(src[i]);
+        }
+
+        for (std::size_t i = 0; i < src.size() && synthesisOk; ++i) {
+            synthesisOk = ((constant >> i) & 1U) != 0U || annotatableQuantumComputation.addOperationsImplementingNotGate(src[i]);
+        }
+        return synthesisOk;
+    }
+
+    bool SyrecSynthesis::equalsConstant(AnnotatableQuantumComputation& annotatableQuantumComputation, const qc::Qubit dest, const std::vector<qc::Qubit>& src, const unsigned constant) {
+        bool synthesisOk = true;
+        for (std::size_t i = 0; i < src.size() && synthesisOk; ++i) {
+            synthesisOk = ((constant >> i) & 1U) != 0U || annotatableQuantumComputation.addOperationsImplementingNotGate(src[i]);
+        }
+
+        synthesisOk &= annotatableQuantumComputation.addOperationsImplementingMultiControlToffoliGate(qc::Controls(src.begin(), src.end()), dest);
+
+        for (std::size_t i = 0; i < src.size() && synthesisOk; ++i) {
+            synthesisOk = ((constant >> i) & 1U) != 0U || annotatableQuantumComputation.addOperationsImplementingNotGate(src[i]);
         }
         return synthesisOk;
     }
 
+    bool SyrecSynthesis::synthesizeBinaryOperationWithConstantOperand(const BinaryExpression::BinaryOperation binaryOperation, const unsigned expressionBitwidth, std::vector<qc::Qubit>& lines, const std::vector<qc::Qubit>& nonConstantOperand, const unsigned constant, const bool isConstantLhsOperand) {
+        if (binaryOperation == BinaryExpression::BinaryOperation::Multiply) {
+            return getConstantLines(expressionBitwidth, 0U, lines) && multiplicationByConstant(lines, nonConstantOperand, constant);
+        }
+
+        const std::optional<qc::Qubit> ancillaryQubitForResult = getConstantLine(false, getLastCreatedModuleCallStackInstance());
+        if (!ancillaryQubitForResult.has_value()) {
+            return false;
+        }
+        lines.emplace_back(*ancillaryQubitForResult);
+
+        // A relational operation with the constant as its left hand side operand is synthesized as the mirrored operation with the constant as its right hand side operand (i.e. 'c < x' is equal to 'x > c').
+        switch (binaryOperation) {
+            case BinaryExpression::BinaryOperation::Equals:
+                return equalsConstant(annotatableQuantumComputation, lines.front(), nonConstantOperand, constant);
+            case BinaryExpression::BinaryOperation::NotEquals:
+                return equalsConstant(annotatableQuantumComputation, lines.front(), nonConstantOperand, constant) && annotatableQuantumComputation.addOperationsImplementingNotGate(lines.front());
+            case BinaryExpression::BinaryOperation::LessThan:
+                return compareWithConstant(annotatableQuantumComputation, lines.front(), nonConstantOperand, constant, !isConstantLhsOperand);
+            case BinaryExpression::BinaryOperation::GreaterThan:
+                return compareWithConstant(annotatableQuantumComputation, lines.front(), nonConstantOperand, constant, isConstantLhsOperand);
+            case BinaryExpression::BinaryOperation::LessEquals:
+                return compareWithConstant(annotatableQuantumComputation, lines.front(), nonConstantOperand, constant, isConstantLhsOperand) && annotatableQuantumComputation.addOperationsImplementingNotGate(lines.front());
+            case BinaryExpression::BinaryOperation::GreaterEquals:
+                return compareWithConstant(annotatableQuantumComputation, lines.front(), nonConstantOperand, constant, !isConstantLhsOperand) && annotatableQuantumComputation.addOperationsImplementingNotGate(lines.front());
+            default:
+                return false;
+        }
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-noexcept-swap, performance-noexcept-swap, bugprone-exception-escape)
+    bool SyrecSynthesis::swap(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<qc::Qubit>& dest1, const std::vector<qc::Qubit>& dest2) {
+        return dest2.size() >= dest1.size() && annotatableQuantumComputation.addOperationsImplementingFredkinGates(dest1, std::span(dest2).first(dest1.size()));
+    }
+
     //**********************************************************************
     //*****                      Shift Operations                      *****
     //**********************************************************************
@@ -1305,12 +2452,8 @@ namespace syrec {
         }
 
         const std::size_t nQubitsShifted       = dest.size() - qubitIndexShiftAmount;
-        bool              synthesisOk          = toBeShiftedQubits.size() >= nQubitsShifted;
         const auto        targetLineBaseOffset = static_cast<std::size_t>(qubitIndexShiftAmount);
-        for (std::size_t i = 0; i < nQubitsShifted && synthesisOk; ++i) {
-            synthesisOk = annotatableQuantumComputation.addOperationsImplementingCnotGate(toBeShiftedQubits[i], dest[targetLineBaseOffset + i]);
-        }
-        return synthesisOk;
+        return toBeShiftedQubits.size() >= nQubitsShifted && annotatableQuantumComputation.addOperationsImplementingCnotGates(std::span(toBeShiftedQubits).first(nQubitsShifted), std::span(dest).subspan(targetLineBaseOffset, nQubitsShifted));
     }
 
     bool SyrecSynthesis::rightShift(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<qc::Qubit>& dest, const std::vector<qc::Qubit>& toBeShiftedQubits, const unsigned qubitIndexShiftAmount) {
@@ -1319,46 +2462,81 @@ namespace syrec {
         }
 
         const std::size_t nQubitsShifted        = dest.size() - qubitIndexShiftAmount;
-        bool              synthesisOk           = toBeShiftedQubits.size() >= nQubitsShifted;
         const auto        sourceQubitBaseOffset = static_cast<std::size_t>(qubitIndexShiftAmount);
-        for (std::size_t i = 0; i < nQubitsShifted && synthesisOk; ++i) {
-            synthesisOk = annotatableQuantumComputation.addOperationsImplementingCnotGate(toBeShiftedQubits[sourceQubitBaseOffset + i], dest[i]);
-        }
-        return synthesisOk;
+        return toBeShiftedQubits.size() >= sourceQubitBaseOffset + nQubitsShifted && annotatableQuantumComputation.addOperationsImplementingCnotGates(std::span(toBeShiftedQubits).subspan(sourceQubitBaseOffset, nQubitsShifted), std::span(dest).first(nQubitsShifted));
     }
 
-    bool SyrecSynthesis::expressionOpInverse([[maybe_unused]] const BinaryExpression::BinaryOperation binaryOperation, [[maybe_unused]] const std::vector<qc::Qubit>& expLhs, [[maybe_unused]] const std::vector<qc::Qubit>& expRhs) {
+    bool SyrecSynthesis::shiftByRelabelingQubits(const ShiftExpression::ShiftOperation shiftOperation, const unsigned expressionBitwidth, std::vector<qc::Qubit>& lines, const std::vector<qc::Qubit>& toBeShiftedQubits, const unsigned qubitIndexShiftAmount) {
+        const std::size_t numShiftedInQubits = std::min(static_cast<std::size_t>(qubitIndexShiftAmount), static_cast<std::size_t>(expressionBitwidth));
+        const std::size_t nQubitsShifted     = static_cast<std::size_t>(expressionBitwidth) - numShiftedInQubits;
+        // A right shift by k selects the shifted qubits starting at the k-th qubit of the shifted operand.
+        const std::size_t numRequiredToBeShiftedQubits = shiftOperation == ShiftExpression::ShiftOperation::Left || nQubitsShifted == 0 ? nQubitsShifted : nQubitsShifted + numShiftedInQubits;
+        if (toBeShiftedQubits.size() < numRequiredToBeShiftedQubits) {
+            return false;
+        }
+
+        std::vector<qc::Qubit> shiftedInQubits;
+        if (!getConstantLines(static_cast<unsigned>(numShiftedInQubits), 0U, shiftedInQubits)) {
+            return false;
+        }
+
+        // The shifted-in qubits are the least significant qubits of a left shift and the most significant qubits of a right shift.
+        const auto firstShiftedQubit = toBeShiftedQubits.cbegin() + static_cast<std::ptrdiff_t>(shiftOperation == ShiftExpression::ShiftOperation::Left ? 0U : numShiftedInQubits);
+        if (shiftOperation == ShiftExpression::ShiftOperation::Left) {
+            lines.insert(lines.end(), shiftedInQubits.cbegin(), shiftedInQubits.cend());
+        }
+        lines.insert(lines.end(), firstShiftedQubit, firstShiftedQubit + static_cast<std::ptrdiff_t>(nQubitsShifted));
+        if (shiftOperation == ShiftExpression::ShiftOperation::Right) {
+            lines.insert(lines.end(), shiftedInQubits.cbegin(), shiftedInQubits.cend());
+        }
         return true;
     }
 
-    std::optional<Expression::ptr> SyrecSynthesis::performCompileTimeSimplificationsOfExpression(const Expression::ptr& expression, const Number::LoopVariableMapping& loopVariableValueLookup) {
-        if (expression == nullptr) {
-            return std::nullopt;
+    bool SyrecSynthesis::copyRelabeledQubitsOfShiftOperandSharedWithOtherOperand(std::vector<qc::Qubit>& operand, const std::vector<qc::Qubit>& otherOperand, const Expression& operandExpression) {
+        if (operandExpression.getKind() != Expression::Kind::Shift || std::ranges::none_of(operand, [&](const qc::Qubit qubit) { return std::ranges::find(otherOperand, qubit) != otherOperand.cend(); })) {
+            return true;
         }
 
-        if (auto const* exprAsNumericExpr = dynamic_cast<NumericExpression*>(expression.get()); exprAsNumericExpr != nullptr) {
-            if (exprAsNumericExpr->value->isConstant()) {
-                return expression;
-            }
-            if (const std::optional<unsigned> compileTimeValueOfNumericExpression = exprAsNumericExpr->value->tryEvaluate(loopVariableValueLookup); compileTimeValueOfNumericExpression.has_value()) {
-                return std::make_shared<NumericExpression>(std::make_shared<Number>(*compileTimeValueOfNumericExpression), 32U);
+        std::vector<qc::Qubit> copyOfOperand;
+        if (!getConstantLines(static_cast<unsigned>(operand.size()), 0U, copyOfOperand) || !bitwiseCnot(annotatableQuantumComputation, copyOfOperand, operand)) {
+            return false;
+        }
+        operand = std::move(copyOfOperand);
+        return true;
+    }
+
+    bool SyrecSynthesis::expressionOpInverse([[maybe_unused]] const BinaryExpression::BinaryOperation binaryOperation, [[maybe_unused]] const std::vector<qc::Qubit>& expLhs, [[maybe_unused]] const std::vector<qc::Qubit>& expRhs) {
+        return true;
+    }
+
+    std::optional<Expression::ptr> SyrecSynthesis::performCompileTimeSimplificationsOfExpression(const Expression::ptr& expression) const {
+        if (expression == nullptr) {
+            return std::nullopt;
+        }
+
+        if (auto const* exprAsNumericExpr = expressionCast<NumericExpression>(expression.get()); exprAsNumericExpr != nullptr) {
+            if (exprAsNumericExpr->value->isConstant()) {
+                return expression;
+            }
+            if (const std::optional<unsigned> compileTimeValueOfNumericExpression = loopVariableNumberEvaluator.tryEvaluate(exprAsNumericExpr->value); compileTimeValueOfNumericExpression.has_value()) {
+                return std::make_shared<NumericExpression>(std::make_shared<Number>(*compileTimeValueOfNumericExpression), 32U);
             }
-        } else if (auto const* exprAsVariableExpr = dynamic_cast<VariableExpression*>(expression.get()); exprAsVariableExpr != nullptr) {
+        } else if (auto const* exprAsVariableExpr = expressionCast<VariableExpression>(expression.get()); exprAsVariableExpr != nullptr) {
             return expression;
-        } else if (auto const* exprAsBinaryExpr = dynamic_cast<BinaryExpression*>(expression.get()); exprAsBinaryExpr != nullptr) {
-            const std::optional<Expression::ptr> simplifiedLhsOperand = performCompileTimeSimplificationsOfExpression(exprAsBinaryExpr->lhs, loopVariableValueLookup);
-            const std::optional<Expression::ptr> simplifiedRhsOperand = performCompileTimeSimplificationsOfExpression(exprAsBinaryExpr->rhs, loopVariableValueLookup);
+        } else if (auto const* exprAsBinaryExpr = expressionCast<BinaryExpression>(expression.get()); exprAsBinaryExpr != nullptr) {
+            const std::optional<Expression::ptr> simplifiedLhsOperand = performCompileTimeSimplificationsOfExpression(exprAsBinaryExpr->lhs);
+            const std::optional<Expression::ptr> simplifiedRhsOperand = performCompileTimeSimplificationsOfExpression(exprAsBinaryExpr->rhs);
             if (!simplifiedLhsOperand.has_value() || !simplifiedRhsOperand.has_value()) {
                 return std::nullopt;
             }
 
             // In the future one could perform arithmetic or logical simplifications if only one of the operands evaluates to an integer constant at compile time.
             // Currently we the compile time value of the binary expression is only calculated if both operands evaluate to an integer constant at compile time.
-            const auto* const simplifiedLhsOperandAsNumericExpr = dynamic_cast<const NumericExpression*>(simplifiedLhsOperand.value().get());
-            const auto* const simplifiedRhsOperandAsNumericExpr = dynamic_cast<const NumericExpression*>(simplifiedRhsOperand.value().get());
+            const auto* const simplifiedLhsOperandAsNumericExpr = expressionCast<NumericExpression>(simplifiedLhsOperand.value().get());
+            const auto* const simplifiedRhsOperandAsNumericExpr = expressionCast<NumericExpression>(simplifiedRhsOperand.value().get());
             if (simplifiedLhsOperandAsNumericExpr != nullptr || simplifiedRhsOperandAsNumericExpr != nullptr) {
-                const std::optional<unsigned> compileTimeConstantValueOfLhsOperand = simplifiedLhsOperandAsNumericExpr != nullptr ? simplifiedLhsOperandAsNumericExpr->value.get()->tryEvaluate(loopVariableValueLookup) : std::nullopt;
-                const std::optional<unsigned> compileTimeConstantValueOfRhsOperand = simplifiedRhsOperandAsNumericExpr != nullptr ? simplifiedRhsOperandAsNumericExpr->value.get()->tryEvaluate(loopVariableValueLookup) : std::nullopt;
+                const std::optional<unsigned> compileTimeConstantValueOfLhsOperand = simplifiedLhsOperandAsNumericExpr != nullptr ? loopVariableNumberEvaluator.tryEvaluate(simplifiedLhsOperandAsNumericExpr->value) : std::nullopt;
+                const std::optional<unsigned> compileTimeConstantValueOfRhsOperand = simplifiedRhsOperandAsNumericExpr != nullptr ? loopVariableNumberEvaluator.tryEvaluate(simplifiedRhsOperandAsNumericExpr->value) : std::nullopt;
                 if (const std::optional<unsigned> compileTimeValueOfExpr = utils::tryEvaluate(compileTimeConstantValueOfLhsOperand, exprAsBinaryExpr->binaryOperation, compileTimeConstantValueOfRhsOperand); compileTimeValueOfExpr.has_value()) {
                     return std::make_shared<NumericExpression>(std::make_shared<Number>(*compileTimeValueOfExpr), 32U);
                 }
@@ -1368,15 +2546,15 @@ namespace syrec {
                 return std::make_shared<BinaryExpression>(*simplifiedLhsOperand, exprAsBinaryExpr->binaryOperation, *simplifiedRhsOperand);
             }
             return expression;
-        } else if (auto const* exprAsShiftExpr = dynamic_cast<ShiftExpression*>(expression.get()); exprAsShiftExpr != nullptr) {
-            const std::optional<Expression::ptr> simplifiedToBeShiftedOperand = performCompileTimeSimplificationsOfExpression(exprAsShiftExpr->lhs, loopVariableValueLookup);
+        } else if (auto const* exprAsShiftExpr = expressionCast<ShiftExpression>(expression.get()); exprAsShiftExpr != nullptr) {
+            const std::optional<Expression::ptr> simplifiedToBeShiftedOperand = performCompileTimeSimplificationsOfExpression(exprAsShiftExpr->lhs);
             if (!simplifiedToBeShiftedOperand.has_value()) {
                 return std::nullopt;
             }
 
-            if (const auto* const simplifiedToBeShiftedOperandAsNumericExpr = dynamic_cast<const NumericExpression*>(simplifiedToBeShiftedOperand.value().get()); simplifiedToBeShiftedOperandAsNumericExpr != nullptr) {
-                const std::optional<unsigned> compileTimeConstantValueOfToBeShiftedOperand = simplifiedToBeShiftedOperandAsNumericExpr->value->tryEvaluate(loopVariableValueLookup);
-                const std::optional<unsigned> compileTimeConstantValueOfShiftAmount        = exprAsShiftExpr->rhs->tryEvaluate(loopVariableValueLookup);
+            if (const auto* const simplifiedToBeShiftedOperandAsNumericExpr = expressionCast<NumericExpression>(simplifiedToBeShiftedOperand.value().get()); simplifiedToBeShiftedOperandAsNumericExpr != nullptr) {
+                const std::optional<unsigned> compileTimeConstantValueOfToBeShiftedOperand = loopVariableNumberEvaluator.tryEvaluate(simplifiedToBeShiftedOperandAsNumericExpr->value);
+                const std::optional<unsigned> compileTimeConstantValueOfShiftAmount        = loopVariableNumberEvaluator.tryEvaluate(exprAsShiftExpr->rhs);
                 if (const std::optional<unsigned> compileTimeValueOfExpr = utils::tryEvaluate(compileTimeConstantValueOfToBeShiftedOperand, exprAsShiftExpr->shiftOperation, compileTimeConstantValueOfShiftAmount); compileTimeValueOfExpr.has_value()) {
                     return std::make_shared<NumericExpression>(std::make_shared<Number>(*compileTimeValueOfExpr), 32U);
                 }
@@ -1386,14 +2564,14 @@ namespace syrec {
                 return std::make_shared<ShiftExpression>(*simplifiedToBeShiftedOperand, exprAsShiftExpr->shiftOperation, exprAsShiftExpr->rhs);
             }
             return expression;
-        } else if (auto const* exprAsUnaryExpr = dynamic_cast<UnaryExpression*>(expression.get()); exprAsUnaryExpr != nullptr) {
-            const std::optional<Expression::ptr> simplifiedUnaryExprOperand = performCompileTimeSimplificationsOfExpression(exprAsUnaryExpr->expr, loopVariableValueLookup);
+        } else if (auto const* exprAsUnaryExpr = expressionCast<UnaryExpression>(expression.get()); exprAsUnaryExpr != nullptr) {
+            const std::optional<Expression::ptr> simplifiedUnaryExprOperand = performCompileTimeSimplificationsOfExpression(exprAsUnaryExpr->expr);
             if (!simplifiedUnaryExprOperand.has_value()) {
                 return std::nullopt;
             }
 
-            if (const auto* const simplifiedUnaryEpxrAsNumericExpr = dynamic_cast<const NumericExpression*>(simplifiedUnaryExprOperand.value().get()); simplifiedUnaryEpxrAsNumericExpr != nullptr) {
-                const std::optional<unsigned> compileTimeConstantValueOfUnaryExprOperand = simplifiedUnaryEpxrAsNumericExpr->value->tryEvaluate(loopVariableValueLookup);
+            if (const auto* const simplifiedUnaryEpxrAsNumericExpr = expressionCast<NumericExpression>(simplifiedUnaryExprOperand.value().get()); simplifiedUnaryEpxrAsNumericExpr != nullptr) {
+                const std::optional<unsigned> compileTimeConstantValueOfUnaryExprOperand = loopVariableNumberEvaluator.tryEvaluate(simplifiedUnaryEpxrAsNumericExpr->value);
                 if (const std::optional<unsigned> compileTimeConstantValueOfUnaryExpr = utils::tryEvaluate(exprAsUnaryExpr->unaryOperation, compileTimeConstantValueOfUnaryExprOperand); compileTimeConstantValueOfUnaryExpr.has_value()) {
                     return std::make_shared<NumericExpression>(std::make_shared<Number>(*compileTimeConstantValueOfUnaryExpr), 32U);
                 }
@@ -1440,36 +2618,56 @@ namespace syrec {
             const auto                     variableLayoutInformation          = AnnotatableQuantumComputation::AssociatedVariableLayoutInformation({.numValuesPerDimension = variable->dimensions, .bitwidth = variable->bitwidth});
             const std::optional<qc::Qubit> indexToFirstQubitOfQuantumRegister = annotatableQuantumComputation.addQuantumRegisterForSyrecVariable(quantumRegisterLabel, variableLayoutInformation, areQubitsCreatedForVariableConsideredGarbage, optionalQubitInliningInformation);
             if (!indexToFirstQubitOfQuantumRegister.has_value()) {
-                std::cerr << "Failed to add quantum register for SyReC variable '" << variable->name << "'\n";
+                getErrorStream() << "Failed to add quantum register for SyReC variable '" << variable->name << "'\n";
                 return false;
             }
 
-            if (!firstVariableQubitOffsetLookup->registerOrUpdateOffsetToFirstQubitOfVariableInCurrentScope(variable->name, *indexToFirstQubitOfQuantumRegister)) {
-                std::cerr << "Failed to register offset to first qubit of quantum register for SyReC variable '" << variable->name << "'\n";
+            if (!firstVariableQubitOffsetLookup->registerOrUpdateOffsetToFirstQubitOfVariableInCurrentScope(*variable, *indexToFirstQubitOfQuantumRegister)) {
+                getErrorStream() << "Failed to register offset to first qubit of quantum register for SyReC variable '" << variable->name << "'\n";
                 return false;
             }
+
+            if (moduleCallSynthesisCache != nullptr) {
+                moduleCallSynthesisCache->recordQuantumRegisterAllocation(ModuleCallSynthesisCache::QuantumRegisterAllocation{.localVariable = variable, .numAncillaryQubits = 0U});
+            }
         }
         return true;
     }
 
     bool SyrecSynthesis::getVariables(const VariableAccess::ptr& variableAccess, std::vector<qc::Qubit>& lines) {
-        const std::optional<EvaluatedVariableAccess> evaluatedVariableAccess = evaluateAndValidateVariableAccess(variableAccess, loopMap, firstVariableQubitOffsetLookup);
+        // The qubits accessed by a variable access consisting only of constant indices do not change in the current variable qubit offset scope and are thus only determined once per scope.
+        if (const std::optional<std::span<const qc::Qubit>> cachedAccessedQubits = variableAccess != nullptr && firstVariableQubitOffsetLookup != nullptr ? firstVariableQubitOffsetLookup->getCachedQubitsOfVariableAccessInCurrentScope(*variableAccess) : std::nullopt; cachedAccessedQubits.has_value()) {
+            lines.assign(cachedAccessedQubits->begin(), cachedAccessedQubits->end());
+            return true;
+        }
+
+        const std::optional<EvaluatedVariableAccess> evaluatedVariableAccess = evaluateAndValidateVariableAccess(variableAccess, firstVariableQubitOffsetLookup);
         if (!evaluatedVariableAccess.has_value()) {
             return false;
         }
 
         // Bitrange and dimension access only contained expressions that could be evaluated at compile time.
         bool synthesisOfVariableAccessOk = evaluatedVariableAccess->evaluatedDimensionAccess.containedOnlyNumericExpressions ? getQubitsForVariableAccessContainingOnlyIndicesEvaluableAtCompileTime(*evaluatedVariableAccess, lines) : getQubitsForVariableAccessContainingIndicesNotEvaluableAtCompileTime(*evaluatedVariableAccess, lines);
+        if (synthesisOfVariableAccessOk && !lines.empty() && evaluatedVariableAccess->evaluatedDimensionAccess.containedOnlyNumericExpressions && doesVariableAccessOnlyConsistOfConstantIndices(*variableAccess)) {
+            firstVariableQubitOffsetLookup->cacheQubitsOfVariableAccessInCurrentScope(variableAccess, lines);
+        }
 
         // Check post condition that any qubit for variable access was fetched
         if (synthesisOfVariableAccessOk && lines.empty()) {
-            std::cerr << "Failed to determine accessed qubits for variable access on variable with identifier " << variableAccess->var->name << "\n";
+            getErrorStream() << "Failed to determine accessed qubits for variable access on variable with identifier " << variableAccess->var->name << "\n";
             synthesisOfVariableAccessOk = false;
         }
         return synthesisOfVariableAccessOk;
     }
 
     std::optional<qc::Qubit> SyrecSynthesis::getConstantLine(bool value, const std::optional<QubitInliningStack::ptr>& inlinedQubitModuleCallStack) const {
+        if (const std::optional<qc::Qubit> reusedAncillaryQubit = ancillaryQubitPool != nullptr ? ancillaryQubitPool->tryBorrowQubit() : std::nullopt; reusedAncillaryQubit.has_value()) {
+            if (value && !annotatableQuantumComputation.addOperationsImplementingNotGate(*reusedAncillaryQubit)) {
+                return std::nullopt;
+            }
+            return reusedAncillaryQubit;
+        }
+
         const auto        expectedAncillaryQubitIndex = static_cast<qc::Qubit>(annotatableQuantumComputation.getNqubits());
         const std::string quantumRegisterLabel        = InternalQubitLabelBuilder::buildAncillaryQubitLabel(annotatableQuantumComputation.getQuantumRegisters().size());
         auto              inliningInformation         = AnnotatableQuantumComputation::InlinedQubitInformation();
@@ -1478,7 +2676,14 @@ namespace syrec {
         }
 
         const std::optional<qc::Qubit> actualAncillaryQubitIndex = annotatableQuantumComputation.addPreliminaryAncillaryRegisterOrAppendToAdjacentOne(quantumRegisterLabel, {value}, inliningInformation);
-        return actualAncillaryQubitIndex.has_value() && *actualAncillaryQubitIndex == expectedAncillaryQubitIndex ? std::make_optional(expectedAncillaryQubitIndex) : std::nullopt;
+        if (!actualAncillaryQubitIndex.has_value() || *actualAncillaryQubitIndex != expectedAncillaryQubitIndex) {
+            return std::nullopt;
+        }
+
+        if (moduleCallSynthesisCache != nullptr) {
+            moduleCallSynthesisCache->recordQuantumRegisterAllocation(ModuleCallSynthesisCache::QuantumRegisterAllocation{.localVariable = nullptr, .numAncillaryQubits = 1U});
+        }
+        return expectedAncillaryQubitIndex;
     }
 
     bool SyrecSynthesis::getConstantLines(const unsigned bitwidth, const qc::Qubit value, std::vector<qc::Qubit>& lines) const {
@@ -1487,10 +2692,29 @@ namespace syrec {
             return false;
         }
 
+        // Ancillary qubits reset to zero after their last usage are reused before new ancillary qubits are generated for the remaining bits of the integer
+        unsigned numReusedAncillaryQubits = 0;
+        for (; ancillaryQubitPool != nullptr && numReusedAncillaryQubits < bitwidth; ++numReusedAncillaryQubits) {
+            const std::optional<qc::Qubit> reusedAncillaryQubit = ancillaryQubitPool->tryBorrowQubit();
+            if (!reusedAncillaryQubit.has_value()) {
+                break;
+            }
+
+            lines.emplace_back(*reusedAncillaryQubit);
+            if ((value & (1U << numReusedAncillaryQubits)) != 0U && !annotatableQuantumComputation.addOperationsImplementingNotGate(*reusedAncillaryQubit)) {
+                return false;
+            }
+        }
+
+        if (numReusedAncillaryQubits == bitwidth) {
+            return true;
+        }
+
         // Ancillary qubits generated for an integer larger than 1 all share the same origin and thus will reuse the same module call stack in its inline information
-        auto initialValuesOfAncillaryQubits = std::vector(bitwidth, false);
+        const unsigned numGeneratedAncillaryQubits    = bitwidth - numReusedAncillaryQubits;
+        auto           initialValuesOfAncillaryQubits = std::vector(numGeneratedAncillaryQubits, false);
         for (std::size_t i = 0; i < initialValuesOfAncillaryQubits.size(); ++i) {
-            initialValuesOfAncillaryQubits[i] = (value & (1U << i)) != 0U;
+            initialValuesOfAncillaryQubits[i] = (value & (1U << (i + numReusedAncillaryQubits))) != 0U;
         }
 
         const auto        expectedQubitIndexForFirstAddedAncillaryQubit = static_cast<qc::Qubit>(annotatableQuantumComputation.getNqubits());
@@ -1500,15 +2724,29 @@ namespace syrec {
 
         const std::optional<qc::Qubit> actualQubitIndexForFirstAddedAncillaryQubit = annotatableQuantumComputation.addPreliminaryAncillaryRegisterOrAppendToAdjacentOne(quantumRegisterLabel, initialValuesOfAncillaryQubits, inliningInformation);
         const bool                     couldAncillaryQubitsBeAdded                 = actualQubitIndexForFirstAddedAncillaryQubit.has_value() && *actualQubitIndexForFirstAddedAncillaryQubit == expectedQubitIndexForFirstAddedAncillaryQubit;
+        if (couldAncillaryQubitsBeAdded && moduleCallSynthesisCache != nullptr) {
+            moduleCallSynthesisCache->recordQuantumRegisterAllocation(ModuleCallSynthesisCache::QuantumRegisterAllocation{.localVariable = nullptr, .numAncillaryQubits = numGeneratedAncillaryQubits});
+        }
 
         const qc::Qubit firstGeneratedAncillaryQubitIndex = *actualQubitIndexForFirstAddedAncillaryQubit;
-        const qc::Qubit lastGeneratedAncillaryQubitIndex  = firstGeneratedAncillaryQubitIndex + (bitwidth - 1U);
+        const qc::Qubit lastGeneratedAncillaryQubitIndex  = firstGeneratedAncillaryQubitIndex + (numGeneratedAncillaryQubits - 1U);
         for (qc::Qubit generatedAncillaryQubitIndex = firstGeneratedAncillaryQubitIndex; generatedAncillaryQubitIndex <= lastGeneratedAncillaryQubitIndex; ++generatedAncillaryQubitIndex) {
             lines.emplace_back(generatedAncillaryQubitIndex);
         }
         return couldAncillaryQubitsBeAdded;
     }
 
+    bool SyrecSynthesis::getZeroInitializedAncillaryQubits(const std::size_t numQubits, std::vector<qc::Qubit>& lines) const {
+        for (std::size_t numRemainingQubits = numQubits; numRemainingQubits > 0;) {
+            const std::size_t numGeneratedQubits = std::min<std::size_t>(numRemainingQubits, 32U);
+            if (!getConstantLines(static_cast<unsigned>(numGeneratedQubits), 0U, lines)) {
+                return false;
+            }
+            numRemainingQubits -= numGeneratedQubits;
+        }
+        return true;
+    }
+
     std::optional<AssignStatement::AssignOperation> SyrecSynthesis::tryMapBinaryToAssignmentOperation(BinaryExpression::BinaryOperation binaryOperation) noexcept {
         switch (binaryOperation) {
             case BinaryExpression::BinaryOperation::Add:
@@ -1541,16 +2779,21 @@ namespace syrec {
         if (!shouldQubitInlineInformationBeRecorded() || moduleCallStackInstances->empty()) {
             return std::nullopt;
         }
-        return moduleCallStackInstances->back();
+        return moduleCallStackInstances->back().inlineStack;
     }
 
-    std::optional<QubitInliningStack::ptr> SyrecSynthesis::createInsertAndGetCopyOfLastCreatedCallStackInstance() {
-        if (const std::optional<QubitInliningStack::ptr> lastCreatedCallStackInstance = shouldQubitInlineInformationBeRecorded() ? getLastCreatedModuleCallStackInstance() : std::nullopt; lastCreatedCallStackInstance.has_value()) {
-            const auto newInlineStackInstance = std::make_shared<QubitInliningStack>(**lastCreatedCallStackInstance);
-            moduleCallStackInstances->emplace_back(newInlineStackInstance);
-            return moduleCallStackInstances->back();
+    bool SyrecSynthesis::createAndInsertModuleCallStackInstanceOfCalledModule(const Module::ptr& calledModule, const unsigned lineNumberOfCallStatement, const bool isCalledModuleAccessedViaCallStmt) {
+        if (!shouldQubitInlineInformationBeRecorded() || moduleCallStackInstances->empty() || moduleCallTree == nullptr) {
+            return false;
         }
-        return std::nullopt;
+
+        // Only a new node referencing the node of the calling module is added to the module call tree, the entries of the inline stack of the called module are only created on demand.
+        const std::optional<ModuleCallTree::NodeId> calledModuleNode = moduleCallTree->addNode(moduleCallStackInstances->back().moduleCallTreeNodeId, calledModule, lineNumberOfCallStatement, isCalledModuleAccessedViaCallStmt);
+        if (!calledModuleNode.has_value()) {
+            return false;
+        }
+        moduleCallStackInstances->emplace_back(ModuleCallStackInstance{.moduleCallTreeNodeId = *calledModuleNode, .inlineStack = std::make_shared<QubitInliningStack>(moduleCallTree, *calledModuleNode)});
+        return true;
     }
 
     bool SyrecSynthesis::shouldQubitInlineInformationBeRecorded() const {
@@ -1564,23 +2807,107 @@ namespace syrec {
         moduleCallStackInstances->pop_back();
     }
 
+    bool SyrecSynthesis::synthesizeAndRecordModuleCall(const std::variant<const CallStatement*, const UncallStatement*>& callStmtVariant) {
+        const CallStatement*   callStmt                                 = std::holds_alternative<const CallStatement*>(callStmtVariant) ? std::get<const CallStatement*>(callStmtVariant) : nullptr;
+        const UncallStatement* uncallStmt                               = std::holds_alternative<const UncallStatement*>(callStmtVariant) ? std::get<const UncallStatement*>(callStmtVariant) : nullptr;
+        const bool             shouldControlQubitsBeLifted              = (callStmt != nullptr && canControlQubitsOfModuleCallBeLifted(callStmt->parameters)) || (uncallStmt != nullptr && canControlQubitsOfModuleCallBeLifted(uncallStmt->parameters));
+        const std::size_t      indexOfFirstQuantumOperationOfModuleCall = annotatableQuantumComputation.getNumQuantumOperations();
+        if (!(shouldControlQubitsBeLifted ? synthesizeModuleCallWithLiftedControlQubits(callStmtVariant) : synthesizeModuleCall(callStmtVariant))) {
+            return false;
+        }
+        if (quantumOperationsPerModuleCall.has_value()) {
+            quantumOperationsPerModuleCall->emplace_back(AnnotatableQuantumComputation::QuantumOperationIndexRange{.indexOfFirstQuantumOperation = indexOfFirstQuantumOperationOfModuleCall, .numQuantumOperations = annotatableQuantumComputation.getNumQuantumOperations() - indexOfFirstQuantumOperationOfModuleCall});
+        }
+        return true;
+    }
+
+    bool SyrecSynthesis::canControlQubitsOfModuleCallBeLifted(const std::vector<std::string>& callerArguments) const {
+        // The replay of the quantum operations of an expression whose uncomputation was deferred could copy quantum operations of the module body prior to or after the control qubits were added to them.
+        const std::unordered_set<qc::Qubit>& aggregateOfPropagatedControlQubits = annotatableQuantumComputation.getAggregateOfPropagatedControlQubits();
+        if (!liftControlQubitsOfModuleCalls || aggregateOfPropagatedControlQubits.empty() || annotatableQuantumComputation.isStreamingOfQuantumOperationsActive() || (ancillaryQubitPool != nullptr && ancillaryQubitUncomputationStrategy != AncillaryQubitUncomputationStrategy::Eager) || firstVariableQubitOffsetLookup == nullptr || modules.empty()) {
+            return false;
+        }
+
+        // The quantum operations synthesized for the module body only operate on the qubits of the caller arguments and the qubits created during the synthesis of the module body, since the propagated control qubits are deregistered
+        // during the synthesis of the latter, none of them must be a qubit of a caller argument.
+        return std::ranges::all_of(callerArguments, [&](const std::string& callerArgument) {
+            const std::optional<Variable::ptr> variableOfCallerArgument = modules.top()->findParameterOrVariable(callerArgument);
+            if (!variableOfCallerArgument.has_value() || *variableOfCallerArgument == nullptr) {
+                return false;
+            }
+            const std::optional<qc::Qubit> firstQubitOfCallerArgument = firstVariableQubitOffsetLookup->getOffsetToFirstQubitOfVariableInCurrentScope(**variableOfCallerArgument);
+            if (!firstQubitOfCallerArgument.has_value()) {
+                return false;
+            }
+            const unsigned numQubitsOfCallerArgument = determineNumberOfElementsInVariable(**variableOfCallerArgument) * (*variableOfCallerArgument)->bitwidth;
+            return std::ranges::none_of(aggregateOfPropagatedControlQubits, [&](const qc::Qubit controlQubit) { return controlQubit >= *firstQubitOfCallerArgument && controlQubit - *firstQubitOfCallerArgument < numQubitsOfCallerArgument; });
+        });
+    }
+
+    bool SyrecSynthesis::synthesizeModuleCallWithLiftedControlQubits(const std::variant<const CallStatement*, const UncallStatement*>& callStmtVariant) {
+        const qc::Controls controlQubits                            = annotatableQuantumComputation.getPropagatedControlQubits();
+        const std::size_t  indexOfFirstQuantumOperationOfModuleCall = annotatableQuantumComputation.getNumQuantumOperations();
+
+        // The synthesized results of expressions cannot be shared between the module body and the statements surrounding the module call since the former is synthesized without the propagated control qubits.
+        if (expressionSynthesisCache != nullptr) {
+            expressionSynthesisCache->clear();
+        }
+        // A control qubit propagated from a parent scope can only be deregistered in the current scope if it was registered in the latter, with the deactivation of the scope propagating the control qubit again.
+        annotatableQuantumComputation.activateControlQubitPropagationScope();
+        const bool synthesisOfModuleCallOk = std::ranges::all_of(controlQubits, [&](const qc::Control& controlQubit) { return annotatableQuantumComputation.registerControlQubitForPropagationInCurrentAndNestedScopes(controlQubit.qubit) && annotatableQuantumComputation.deregisterControlQubitFromPropagationInCurrentScope(controlQubit.qubit); }) && synthesizeModuleCall(callStmtVariant);
+        annotatableQuantumComputation.deactivateControlQubitPropagationScope();
+        if (expressionSynthesisCache != nullptr) {
+            expressionSynthesisCache->clear();
+        }
+        // The templates recorded during the synthesis of the module body reference the uncontrolled quantum operations to which the control qubits are added below, thus they cannot be reused.
+        if (moduleCallSynthesisCache != nullptr) {
+            moduleCallSynthesisCache->removeTemplatesRecordedStartingAt(indexOfFirstQuantumOperationOfModuleCall);
+        }
+        if (!synthesisOfModuleCallOk) {
+            return false;
+        }
+
+        const std::size_t                      numQuantumOperationsOfModuleCall = annotatableQuantumComputation.getNumQuantumOperations() - indexOfFirstQuantumOperationOfModuleCall;
+        const std::optional<std::vector<bool>> quantumOperationsOfCore          = annotatableQuantumComputation.determineQuantumOperationsToControlInControlledSequence(indexOfFirstQuantumOperationOfModuleCall, numQuantumOperationsOfModuleCall);
+        if (!quantumOperationsOfCore.has_value()) {
+            getErrorStream() << "Failed to determine the core of the quantum operations synthesized for a module call with lifted control qubits\n";
+            return false;
+        }
+
+        // Controlling only the core of the synthesized quantum operations is never more expensive than controlling all of them, the latter is nonetheless kept if the lifting of the control qubits does not reduce the quantum cost.
+        const std::vector<bool>                                                      allQuantumOperations(numQuantumOperationsOfModuleCall, true);
+        const std::optional<AnnotatableQuantumComputation::SynthesisCostMetricValue> quantumCostOfControlledCore = annotatableQuantumComputation.determineQuantumCostOfControlledSequence(indexOfFirstQuantumOperationOfModuleCall, *quantumOperationsOfCore, controlQubits.size());
+        const std::optional<AnnotatableQuantumComputation::SynthesisCostMetricValue> quantumCostOfControlledBody = annotatableQuantumComputation.determineQuantumCostOfControlledSequence(indexOfFirstQuantumOperationOfModuleCall, allQuantumOperations, controlQubits.size());
+        if (!quantumCostOfControlledCore.has_value() || !quantumCostOfControlledBody.has_value()) {
+            return false;
+        }
+
+        const std::vector<bool>& controlledQuantumOperations = *quantumCostOfControlledCore < *quantumCostOfControlledBody ? *quantumOperationsOfCore : allQuantumOperations;
+        if (!annotatableQuantumComputation.addControlQubitsToQuantumOperations(indexOfFirstQuantumOperationOfModuleCall, controlledQuantumOperations, controlQubits)) {
+            getErrorStream() << "Failed to add the propagated control qubits to the quantum operations synthesized for a module call with lifted control qubits\n";
+            return false;
+        }
+        return true;
+    }
+
     bool SyrecSynthesis::synthesizeModuleCall(const std::variant<const CallStatement*, const UncallStatement*>& callStmtVariant) {
         const CallStatement*   callStmt   = std::holds_alternative<const CallStatement*>(callStmtVariant) ? std::get<const CallStatement*>(callStmtVariant) : nullptr;
         const UncallStatement* uncallStmt = std::holds_alternative<const UncallStatement*>(callStmtVariant) ? std::get<const UncallStatement*>(callStmtVariant) : nullptr;
         if (callStmt == nullptr && uncallStmt == nullptr) {
-            std::cerr << "Failed to synthesize module call/uncall due to IR entity of corresponding CallStatement/UncallStatement being null\n";
+            getErrorStream() << "Failed to synthesize module call/uncall due to IR entity of corresponding CallStatement/UncallStatement being null\n";
             return false;
         }
 
         if (firstVariableQubitOffsetLookup == nullptr) {
-            std::cerr << "Internal lookup of offsets to first qubits of variables was null\n";
+            getErrorStream() << "Internal lookup of offsets to first qubits of variables was null\n";
             return false;
         }
 
         const std::vector<std::string>& callerProvidedParameterValues = callStmt != nullptr ? callStmt->parameters : uncallStmt->parameters;
         const Module::ptr&              targetModule                  = callStmt != nullptr ? callStmt->target : uncallStmt->target;
 
-        std::unordered_map<std::string_view, qc::Qubit> offsetToFirstQubitPerFormalParameterOfTargetModule;
+        std::vector<qc::Qubit> firstQubitPerFormalParameterOfTargetModule;
+        firstQubitPerFormalParameterOfTargetModule.reserve(callerProvidedParameterValues.size());
 
         // 1. Adjust the references module's parameters to the call arguments
         for (std::size_t i = 0U; i < callerProvidedParameterValues.size(); ++i) {
@@ -1589,12 +2916,11 @@ namespace syrec {
             const std::string_view&             callerProvidedParameterVariableIdentifier  = callerProvidedParameterValues.at(i);
             const std::optional<Variable::ptr>& matchingParameterOrVariableOfCurrentModule = modules.top()->findParameterOrVariable(callerProvidedParameterVariableIdentifier);
             if (!matchingParameterOrVariableOfCurrentModule.has_value() || matchingParameterOrVariableOfCurrentModule.value() == nullptr) {
-                std::cerr << "Failed to find matching parameter or variable of module " << modules.top()->name << " for parameter '" << callerProvidedParameterVariableIdentifier << "' when setting references of parameters of " << (callStmt != nullptr ? "called" : "uncalled") << " module " << targetModule->name;
+                getErrorStream() << "Failed to find matching parameter or variable of module " << modules.top()->name << " for parameter '" << callerProvidedParameterVariableIdentifier << "' when setting references of parameters of " << (callStmt != nullptr ? "called" : "uncalled") << " module " << targetModule->name;
                 return false;
             }
 
-            const auto& formalModuleParameter                                               = targetModule->parameters.at(i);
-            offsetToFirstQubitPerFormalParameterOfTargetModule[formalModuleParameter->name] = 0;
+            const auto& formalModuleParameter = targetModule->parameters.at(i);
             // Since we have not opened a new variable qubit offset scope to register the offsets for the parameters as well as for the local variables of the called/uncalled module (target module) our search for the first qubits
             // of the caller provided arguments of the target module can be restricted to the current activate variable qubit offset lookup scope.
             // Additionally, due to the parser already verifying that all variable declarations inside of the target module are unique allows one to simply create the lookup information for the first qubits of the
@@ -1608,38 +2934,29 @@ namespace syrec {
             //
             //  module main(inout x(4))
             //    call add(x) // Using the identifier of the caller argument to determine the first qubit of the formal parameter 'a' in the called module would result in a name clash between the local variable and caller argument
-            const std::optional<qc::Qubit> offsetToFirstQubitOfParameterValue = firstVariableQubitOffsetLookup->getOffsetToFirstQubitOfVariableInCurrentScope(callerProvidedParameterVariableIdentifier);
+            const std::optional<qc::Qubit> offsetToFirstQubitOfParameterValue = firstVariableQubitOffsetLookup->getOffsetToFirstQubitOfVariableInCurrentScope(**matchingParameterOrVariableOfCurrentModule);
             if (!offsetToFirstQubitOfParameterValue.has_value()) {
-                std::cerr << "Failed to determine offset to first qubit of variable '" << callerProvidedParameterVariableIdentifier << "' while trying to set reference for parameter " << formalModuleParameter->name << " of " << (callStmt != nullptr ? "called" : "uncalled") << " module " << targetModule->name << "\n";
+                getErrorStream() << "Failed to determine offset to first qubit of variable '" << callerProvidedParameterVariableIdentifier << "' while trying to set reference for parameter " << formalModuleParameter->name << " of " << (callStmt != nullptr ? "called" : "uncalled") << " module " << targetModule->name << "\n";
                 return false;
             }
 
-            offsetToFirstQubitPerFormalParameterOfTargetModule[formalModuleParameter->name] = *offsetToFirstQubitOfParameterValue;
+            firstQubitPerFormalParameterOfTargetModule.emplace_back(*offsetToFirstQubitOfParameterValue);
         }
 
-        if (!offsetToFirstQubitPerFormalParameterOfTargetModule.empty()) {
-            firstVariableQubitOffsetLookup->openNewVariableQubitOffsetScope();
-            for (const auto& [formalParameterIdentifier, offsetToFirstQubit]: offsetToFirstQubitPerFormalParameterOfTargetModule) {
-                if (!firstVariableQubitOffsetLookup->registerOrUpdateOffsetToFirstQubitOfVariableInCurrentScope(formalParameterIdentifier, offsetToFirstQubit)) {
-                    std::cerr << "Failed to register offset to first qubit of module parameter '" << formalParameterIdentifier << "' of " << (callStmt != nullptr ? "called" : "uncalled") << " module " << targetModule->name << "\n";
-                    return false;
-                }
+        // The scope of the target module is always opened (even if the module has no parameters) to prevent its local variables from overwriting the registrations of the variables of the current module. Since the slots for all parameters
+        // and local variables of the target module are reserved when the scope is opened, the registration of their offsets only writes to said slots.
+        firstVariableQubitOffsetLookup->openNewVariableQubitOffsetScope(targetModule->parameters.size() + targetModule->variables.size());
+        for (std::size_t i = 0; i < firstQubitPerFormalParameterOfTargetModule.size(); ++i) {
+            const Variable& formalModuleParameter = *targetModule->parameters.at(i);
+            if (!firstVariableQubitOffsetLookup->registerOrUpdateOffsetToFirstQubitOfVariableInCurrentScope(formalModuleParameter, firstQubitPerFormalParameterOfTargetModule.at(i))) {
+                getErrorStream() << "Failed to register offset to first qubit of module parameter '" << formalModuleParameter.name << "' of " << (callStmt != nullptr ? "called" : "uncalled") << " module " << targetModule->name << "\n";
+                return false;
             }
         }
 
-        // 2. Create new lines for the module's variables
-        if (!createQuantumRegistersForSyrecVariables(targetModule->variables)) {
-            std::cerr << "Failed to create quantum registers for variables of called module " << targetModule->name << "\n";
-            return false;
-        }
-
-        modules.push(targetModule);
-        const auto& statements              = targetModule->statements;
-        bool        synthesisOfModuleBodyOk = true;
-
         const std::optional<StatementExecutionOrderStack::StatementExecutionOrder> currentStmtExecutionOrder = statementExecutionOrderStack->getCurrentAggregateStatementExecutionOrderState();
         if (!currentStmtExecutionOrder.has_value()) {
-            std::cerr << "Failed to determine current statement execution order\n";
+            getErrorStream() << "Failed to determine current statement execution order\n";
             return false;
         }
 
@@ -1660,39 +2977,564 @@ namespace syrec {
         const auto                                                  executionOrderToAddToAggregateState = currentStmtExecutionOrder.value() == StatementExecutionOrderStack::StatementExecutionOrder::Sequential ? defaultExecutionOrderOfModuleBody : !defaultExecutionOrderOfModuleBody;
         const StatementExecutionOrderStack::StatementExecutionOrder currentAggregateExecutionOrderState = statementExecutionOrderStack->addStatementExecutionOrderToAggregateState(executionOrderToAddToAggregateState);
 
-        if (currentAggregateExecutionOrderState == StatementExecutionOrderStack::StatementExecutionOrder::Sequential) {
-            synthesisOfModuleBodyOk = std::ranges::all_of(statements, [&](const Statement::ptr& stmt) { return processStatement(stmt); });
+        // 2. Reuse the quantum operations synthesized for a previous call/uncall of the target module in the same context by remapping their qubits to the ones of the current caller arguments.
+        // Note that the quantum operations synthesized for an uncall of a module cannot, in general, be derived by replaying the ones of a call of said module in reverse order since the ancillary qubits created during the synthesis of the module body
+        // are assumed to be initialized with their constant value at the start of the synthesis of the module body, thus calls and uncalls are recorded separately (using the aggregate statement execution order).
+        const std::optional<ModuleCallSynthesisCache::ModuleCallContext> moduleCallContext          = determineModuleCallContextForReuseOfSynthesis(*targetModule, firstQubitPerFormalParameterOfTargetModule, currentAggregateExecutionOrderState);
+        const ModuleCallSynthesisCache::ModuleCallTemplate*              moduleCallTemplate         = moduleCallContext.has_value() ? moduleCallSynthesisCache->findTemplate(*moduleCallContext) : nullptr;
+        const ModuleCallSynthesisCache::ModuleCallTemplate*              mirroredModuleCallTemplate = moduleCallContext.has_value() ? findTemplateOfMirroredModuleCall(*moduleCallContext, firstQubitPerFormalParameterOfTargetModule) : nullptr;
+        bool                                                             synthesisOfModuleBodyOk    = true;
+        // A template whose quantum operations were already forwarded to a quantum operation sink cannot be instantiated and is replaced by the template recorded for the current call/uncall.
+        if (moduleCallTemplate != nullptr && moduleCallTemplate->indexOfFirstQuantumOperation < annotatableQuantumComputation.getNumForwardedQuantumOperations()) {
+            moduleCallTemplate = nullptr;
+        }
+        if (mirroredModuleCallTemplate != nullptr) {
+            SYREC_SYNTHESIS_TRACE_SCOPE(synthesisTraceRecorder.get(), annotatableQuantumComputation, "mirrored module call", targetModule->name);
+            synthesisOfModuleBodyOk = replayMirroredModuleCallTemplate(*mirroredModuleCallTemplate);
+            if (!synthesisOfModuleBodyOk) {
+                getErrorStream() << "Failed to replay the quantum operations synthesized for a previous " << (callStmt != nullptr ? "uncall" : "call") << " of module " << targetModule->name << " in reverse order\n";
+            }
+            numReusedModuleCalls += static_cast<std::size_t>(synthesisOfModuleBodyOk);
+        } else if (moduleCallTemplate != nullptr) {
+            SYREC_SYNTHESIS_TRACE_SCOPE(synthesisTraceRecorder.get(), annotatableQuantumComputation, "reused module call", targetModule->name);
+            synthesisOfModuleBodyOk = instantiateModuleCallTemplate(*moduleCallTemplate, *targetModule, firstQubitPerFormalParameterOfTargetModule);
+            if (!synthesisOfModuleBodyOk) {
+                getErrorStream() << "Failed to reuse the quantum operations synthesized for a previous " << (callStmt != nullptr ? "call" : "uncall") << " of module " << targetModule->name << "\n";
+            }
+            numReusedModuleCalls += static_cast<std::size_t>(synthesisOfModuleBodyOk);
         } else {
-            for (auto it = statements.rbegin(); it != statements.rend() && synthesisOfModuleBodyOk; ++it) {
-                if (const auto& reverseStatement = (*it)->reverse(); reverseStatement.has_value()) {
-                    synthesisOfModuleBodyOk = processStatement(*reverseStatement);
-                } else {
-                    const auto        offsetFromLastStmtToCurrentlyProcessedOneInUncalledModule = static_cast<std::size_t>(std::distance(statements.rbegin(), it));
-                    const std::size_t idxOfStatementInSequentialExecutionOrder                  = statements.size() - 1U - offsetFromLastStmtToCurrentlyProcessedOneInUncalledModule;
-                    if (callStmt != nullptr) {
-                        std::cerr << "Failed to create inverse of statement at index " << std::to_string(idxOfStatementInSequentialExecutionOrder) << " in body of called module " << targetModule->name << "(CALL @ " << std::to_string(it->get()->lineNumber) << ")";
+            SYREC_SYNTHESIS_TRACE_SCOPE(synthesisTraceRecorder.get(), annotatableQuantumComputation, "expanded module call", targetModule->name);
+            ++numExpandedModuleCalls;
+            if (moduleCallContext.has_value()) {
+                moduleCallSynthesisCache->startRecording(*moduleCallContext, firstQubitPerFormalParameterOfTargetModule, static_cast<qc::Qubit>(annotatableQuantumComputation.getNqubits()), annotatableQuantumComputation.getNumQuantumOperations());
+            }
+
+            // 3. Create new lines for the module's variables
+            if (!createQuantumRegistersForSyrecVariables(targetModule->variables)) {
+                getErrorStream() << "Failed to create quantum registers for variables of called module " << targetModule->name << "\n";
+                if (moduleCallContext.has_value()) {
+                    moduleCallSynthesisCache->stopLastStartedRecording(false);
+                }
+                return false;
+            }
+
+            // Loop variables are only visible in the module declaring them, the loop variables of the caller are thus hidden during the synthesis of the module body (which also prevents the synthesis of the latter from overwriting the values of the former).
+            Number::LoopVariableMapping                loopVariableValuesOfCaller        = std::exchange(loopMap, {});
+            const std::vector<std::optional<unsigned>> valuesOfLoopVariableSlotsOfCaller = loopVariableNumberEvaluator.exchangeLoopVariableValues({});
+            modules.push(targetModule);
+            // The ancillary qubits reset during the synthesis of the module body are only reused in the module body since the quantum operations synthesized for the latter must only access ancillary qubits created in the module body
+            // to be able to reuse said quantum operations for further calls/uncalls of the module.
+            openAncillaryQubitPoolScope();
+            const auto& statements = targetModule->statements;
+            if (currentAggregateExecutionOrderState == StatementExecutionOrderStack::StatementExecutionOrder::Sequential) {
+                synthesisOfModuleBodyOk = std::ranges::all_of(statements, [&](const Statement::ptr& stmt) { return processStatement(stmt); });
+            } else {
+                for (auto it = statements.rbegin(); it != statements.rend() && synthesisOfModuleBodyOk; ++it) {
+                    if (const auto& reverseStatement = (*it)->reverse(); reverseStatement.has_value()) {
+                        synthesisOfModuleBodyOk = processStatement(*reverseStatement);
                     } else {
-                        std::cerr << "Failed to create inverse of statement at index " << std::to_string(idxOfStatementInSequentialExecutionOrder) << " in body of uncalled module " << targetModule->name << "(UNCALL @ " << std::to_string(it->get()->lineNumber) << ")";
+                        const auto        offsetFromLastStmtToCurrentlyProcessedOneInUncalledModule = static_cast<std::size_t>(std::distance(statements.rbegin(), it));
+                        const std::size_t idxOfStatementInSequentialExecutionOrder                  = statements.size() - 1U - offsetFromLastStmtToCurrentlyProcessedOneInUncalledModule;
+                        if (callStmt != nullptr) {
+                            getErrorStream() << "Failed to create inverse of statement at index " << std::to_string(idxOfStatementInSequentialExecutionOrder) << " in body of called module " << targetModule->name << "(CALL @ " << std::to_string(it->get()->lineNumber) << ")";
+                        } else {
+                            getErrorStream() << "Failed to create inverse of statement at index " << std::to_string(idxOfStatementInSequentialExecutionOrder) << " in body of uncalled module " << targetModule->name << "(UNCALL @ " << std::to_string(it->get()->lineNumber) << ")";
+                        }
+                        synthesisOfModuleBodyOk = false;
                     }
-                    synthesisOfModuleBodyOk = false;
                 }
             }
+            closeAncillaryQubitPoolScope();
+            modules.pop();
+            loopMap = std::move(loopVariableValuesOfCaller);
+            static_cast<void>(loopVariableNumberEvaluator.exchangeLoopVariableValues(valuesOfLoopVariableSlotsOfCaller));
+
+            if (moduleCallContext.has_value()) {
+                ModuleCallSynthesisCache::ModuleCallTemplate* recordedModuleCallTemplate = moduleCallSynthesisCache->getTemplateOfLastStartedRecording();
+                recordedModuleCallTemplate->numCreatedQubits                  = annotatableQuantumComputation.getNqubits() - recordedModuleCallTemplate->firstCreatedQubit;
+                recordedModuleCallTemplate->numQuantumOperations              = annotatableQuantumComputation.getNumQuantumOperations() - recordedModuleCallTemplate->indexOfFirstQuantumOperation;
+                recordedModuleCallTemplate->statementLineNumberAfterSynthesis = annotatableQuantumComputation.getGlobalStatementLineNumber();
+                moduleCallSynthesisCache->stopLastStartedRecording(synthesisOfModuleBodyOk && canSynthesisOfStatementsBeReused() && canQubitsOfModuleCallTemplateBeRemapped(*recordedModuleCallTemplate, *moduleCallContext, *targetModule));
+            }
         }
 
         if (!statementExecutionOrderStack->removeLastAddedStatementExecutionOrderFromAggregateState()) {
-            std::cerr << "Failed to remove last added statement execution order from internal stack\n";
+            getErrorStream() << "Failed to remove last added statement execution order from internal stack\n";
             synthesisOfModuleBodyOk = false;
         }
 
-        if (!offsetToFirstQubitPerFormalParameterOfTargetModule.empty() && !firstVariableQubitOffsetLookup->closeVariableQubitOffsetScope()) {
-            std::cerr << "Failed to close qubit offset scope for parameters and local variables during cleanup after synthesis of " << (callStmt != nullptr ? "called" : "uncalled") << " module " << targetModule->name << "\n";
+        if (!firstVariableQubitOffsetLookup->closeVariableQubitOffsetScope()) {
+            getErrorStream() << "Failed to close qubit offset scope for parameters and local variables during cleanup after synthesis of " << (callStmt != nullptr ? "called" : "uncalled") << " module " << targetModule->name << "\n";
             return false;
         }
-        modules.pop();
         return synthesisOfModuleBodyOk;
     }
 
-    [[nodiscard]] std::optional<SyrecSynthesis::EvaluatedBitrangeAccess> SyrecSynthesis::evaluateAndValidateBitrangeAccess(const VariableAccess& userDefinedVariableAccess, const Number::LoopVariableMapping& loopVariableValueLookup) {
+    void SyrecSynthesis::recordStatisticsOfSynthesizedQuantumComputation(Statistics& statistics) const {
+        statistics.numQubits            = annotatableQuantumComputation.getNqubits();
+        statistics.numAncillaryQubits   = 0;
+        statistics.numQuantumOperations = annotatableQuantumComputation.getNumForwardedQuantumOperations();
+        for (std::size_t qubit = 0; qubit < annotatableQuantumComputation.getNqubits(); ++qubit) {
+            statistics.numAncillaryQubits += static_cast<std::size_t>(annotatableQuantumComputation.logicalQubitIsAncillary(static_cast<qc::Qubit>(qubit)));
+        }
+
+        statistics.depth = annotatableQuantumComputation.analyzeDepth().depth;
+        statistics.numQuantumOperationsPerGateType.clear();
+        // The gates of a compound operation are counted instead of the latter.
+        for (std::size_t i = 0; i < annotatableQuantumComputation.getNops(); ++i) {
+            if (const qc::Operation* quantumOperation = annotatableQuantumComputation.at(i).get(); quantumOperation != nullptr) {
+                static_cast<void>(AnnotatableQuantumComputation::forEachGateOfQuantumOperation(*quantumOperation, [&](const qc::Operation& gate) {
+                    ++statistics.numQuantumOperationsPerGateType[determineGateTypeOfQuantumOperation(gate)];
+                    ++statistics.numQuantumOperations;
+                    return true;
+                }));
+            } else {
+                ++statistics.numQuantumOperations;
+            }
+        }
+
+        statistics.numExpandedModuleCalls                      = numExpandedModuleCalls;
+        statistics.numReusedModuleCalls                        = numReusedModuleCalls;
+        statistics.numUnrolledLoopIterations                   = numUnrolledLoopIterations;
+        statistics.numReplayedLoopIterations                   = numReplayedLoopIterations;
+        statistics.numUncomputedExpressions                    = numUncomputedExpressions;
+        statistics.numQuantumOperationsOfUncomputedExpressions = numQuantumOperationsOfUncomputedExpressions;
+        statistics.recordPeakResidentSetSize();
+    }
+
+    void SyrecSynthesis::accumulateStatisticsOfConcurrentlySynthesizedStatements(const Statistics& statistics) {
+        numExpandedModuleCalls += statistics.numExpandedModuleCalls;
+        numReusedModuleCalls += statistics.numReusedModuleCalls;
+        numUnrolledLoopIterations += statistics.numUnrolledLoopIterations;
+        numReplayedLoopIterations += statistics.numReplayedLoopIterations;
+        numUncomputedExpressions += statistics.numUncomputedExpressions;
+        numQuantumOperationsOfUncomputedExpressions += statistics.numQuantumOperationsOfUncomputedExpressions;
+    }
+
+    SyrecSynthesis::AncillaryQubitUsageMark SyrecSynthesis::markAncillaryQubitUsage() const {
+        return AncillaryQubitUsageMark{.numQuantumOperations = annotatableQuantumComputation.getNumQuantumOperations(), .numQubits = static_cast<qc::Qubit>(annotatableQuantumComputation.getNqubits()), .numBorrowedAncillaryQubits = ancillaryQubitPool != nullptr ? ancillaryQubitPool->getBorrowedQubits().size() : 0U};
+    }
+
+    bool SyrecSynthesis::resetAndReleaseAncillaryQubitsOfExpression(const AncillaryQubitUsageMark& priorToSynthesisOfExpression, const AncillaryQubitUsageMark& afterSynthesisOfExpression) {
+        // The ancillary qubits are not reset if the quantum operations of the expression were already forwarded to a quantum operation sink.
+        if (ancillaryQubitPool == nullptr || afterSynthesisOfExpression.numQuantumOperations == priorToSynthesisOfExpression.numQuantumOperations || priorToSynthesisOfExpression.numQuantumOperations < annotatableQuantumComputation.getNumForwardedQuantumOperations()) {
+            return true;
+        }
+
+        // The ancillary qubits initialized during the synthesis of the expression are the qubits created during its synthesis as well as the ones borrowed from the pool
+        std::vector<qc::Qubit> initializedAncillaryQubits;
+        for (qc::Qubit createdQubit = priorToSynthesisOfExpression.numQubits; createdQubit < afterSynthesisOfExpression.numQubits; ++createdQubit) {
+            initializedAncillaryQubits.emplace_back(createdQubit);
+        }
+        const std::vector<qc::Qubit>& borrowedAncillaryQubits = ancillaryQubitPool->getBorrowedQubits();
+        initializedAncillaryQubits.insert(initializedAncillaryQubits.end(), borrowedAncillaryQubits.cbegin() + static_cast<std::ptrdiff_t>(priorToSynthesisOfExpression.numBorrowedAncillaryQubits), borrowedAncillaryQubits.cbegin() + static_cast<std::ptrdiff_t>(afterSynthesisOfExpression.numBorrowedAncillaryQubits));
+        if (initializedAncillaryQubits.empty()) {
+            return true;
+        }
+
+        // The synthesis of an expression restores the value of all other qubits it uses, replaying its quantum operations in reverse order thus only resets the initialized ancillary qubits
+        // as long as none of the other used qubits were modified after the synthesis of the expression.
+        const std::unordered_set<qc::Qubit> initializedAncillaryQubitsLookup(initializedAncillaryQubits.cbegin(), initializedAncillaryQubits.cend());
+        std::unordered_set<qc::Qubit>       otherQubitsUsedByExpression;
+        for (std::size_t i = priorToSynthesisOfExpression.numQuantumOperations; i < afterSynthesisOfExpression.numQuantumOperations; ++i) {
+            const qc::Operation* quantumOperation = annotatableQuantumComputation.getQuantumOperation(i);
+            if (quantumOperation == nullptr) {
+                return false;
+            }
+            for (const qc::Control& controlQubit: quantumOperation->getControls()) {
+                if (!initializedAncillaryQubitsLookup.contains(controlQubit.qubit)) {
+                    otherQubitsUsedByExpression.emplace(controlQubit.qubit);
+                }
+            }
+            for (const qc::Qubit targetQubit: quantumOperation->getTargets()) {
+                if (!initializedAncillaryQubitsLookup.contains(targetQubit)) {
+                    otherQubitsUsedByExpression.emplace(targetQubit);
+                }
+            }
+        }
+
+        for (std::size_t i = afterSynthesisOfExpression.numQuantumOperations; i < annotatableQuantumComputation.getNumQuantumOperations(); ++i) {
+            const qc::Operation* quantumOperation = annotatableQuantumComputation.getQuantumOperation(i);
+            if (quantumOperation == nullptr) {
+                return false;
+            }
+            if (std::ranges::any_of(quantumOperation->getTargets(), [&](const qc::Qubit targetQubit) { return otherQubitsUsedByExpression.contains(targetQubit); })) {
+                return true;
+            }
+        }
+
+        if (!annotatableQuantumComputation.replayOperationsAtGivenIndexRange(afterSynthesisOfExpression.numQuantumOperations - 1U, priorToSynthesisOfExpression.numQuantumOperations)) {
+            return false;
+        }
+
+        if (expressionSynthesisCache != nullptr) {
+            expressionSynthesisCache->invalidateSynthesisResultsStoredInQubits(initializedAncillaryQubitsLookup);
+        }
+        // The replayed quantum operations of the expression also reset the index decodings synthesized for its variable accesses.
+        std::erase_if(indexDecodingsSharedInCurrentStatement, [&](const SharedIndexDecoding& sharedIndexDecoding) {
+            return std::ranges::any_of(sharedIndexDecoding.qubitsStoringOneHotIndex, [&](const qc::Qubit qubit) { return initializedAncillaryQubitsLookup.contains(qubit); }) || std::ranges::any_of(sharedIndexDecoding.qubitsStoringUnrolledIndex, [&](const qc::Qubit qubit) { return initializedAncillaryQubitsLookup.contains(qubit); });
+        });
+        ancillaryQubitPool->releaseQubits(initializedAncillaryQubits);
+        ++numUncomputedExpressions;
+        numQuantumOperationsOfUncomputedExpressions += afterSynthesisOfExpression.numQuantumOperations - priorToSynthesisOfExpression.numQuantumOperations;
+        return true;
+    }
+
+    bool SyrecSynthesis::scheduleUncomputationOfExpression(const AncillaryQubitUsageMark& priorToSynthesisOfExpression, const AncillaryQubitUsageMark& afterSynthesisOfExpression) {
+        if (ancillaryQubitPool == nullptr || ancillaryQubitUncomputationStrategy == AncillaryQubitUncomputationStrategy::Eager) {
+            return resetAndReleaseAncillaryQubitsOfExpression(priorToSynthesisOfExpression, afterSynthesisOfExpression);
+        }
+
+        std::vector<DeferredUncomputationOfExpression>& deferredUncomputationsOfScope = deferredUncomputationsOfExpressionsPerAncillaryQubitPoolScope.back();
+        deferredUncomputationsOfScope.emplace_back(DeferredUncomputationOfExpression{.priorToSynthesisOfExpression = priorToSynthesisOfExpression, .afterSynthesisOfExpression = afterSynthesisOfExpression});
+        if (ancillaryQubitUncomputationStrategy != AncillaryQubitUncomputationStrategy::Bennett || deferredUncomputationsOfScope.size() <= maxNumDeferredExpressionUncomputations) {
+            return true;
+        }
+
+        const DeferredUncomputationOfExpression oldestDeferredUncomputation = deferredUncomputationsOfScope.front();
+        deferredUncomputationsOfScope.erase(deferredUncomputationsOfScope.begin());
+        return resetAndReleaseAncillaryQubitsOfExpression(oldestDeferredUncomputation.priorToSynthesisOfExpression, oldestDeferredUncomputation.afterSynthesisOfExpression);
+    }
+
+    bool SyrecSynthesis::uncomputeDeferredExpressionsIfNoAncillaryQubitIsAvailable() {
+        std::vector<DeferredUncomputationOfExpression>& deferredUncomputationsOfScope = deferredUncomputationsOfExpressionsPerAncillaryQubitPoolScope.back();
+        if (ancillaryQubitPool == nullptr || deferredUncomputationsOfScope.empty() || ancillaryQubitPool->hasReleasedQubitsInLastOpenedScope()) {
+            return true;
+        }
+
+        // Expressions are uncomputed in reverse order of their synthesis since the uncomputation of an expression whose result was shared with a later expression would otherwise prevent the uncomputation of the latter.
+        bool synthesisOk = true;
+        for (auto deferredUncomputation = deferredUncomputationsOfScope.crbegin(); deferredUncomputation != deferredUncomputationsOfScope.crend() && synthesisOk; ++deferredUncomputation) {
+            synthesisOk = resetAndReleaseAncillaryQubitsOfExpression(deferredUncomputation->priorToSynthesisOfExpression, deferredUncomputation->afterSynthesisOfExpression);
+        }
+        deferredUncomputationsOfScope.clear();
+        return synthesisOk;
+    }
+
+    void SyrecSynthesis::openAncillaryQubitPoolScope() {
+        if (ancillaryQubitPool == nullptr) {
+            return;
+        }
+        ancillaryQubitPool->openScope();
+        deferredUncomputationsOfExpressionsPerAncillaryQubitPoolScope.emplace_back();
+    }
+
+    void SyrecSynthesis::closeAncillaryQubitPoolScope() {
+        if (ancillaryQubitPool == nullptr || !ancillaryQubitPool->closeScope()) {
+            return;
+        }
+        // The quantum operations uncomputing an expression of the closed scope are synthesized after the synthesized quantum operations of the scope, which can thus still be reused.
+        std::vector<DeferredUncomputationOfExpression> deferredUncomputationsOfClosedScope = std::move(deferredUncomputationsOfExpressionsPerAncillaryQubitPoolScope.back());
+        deferredUncomputationsOfExpressionsPerAncillaryQubitPoolScope.pop_back();
+        deferredUncomputationsOfExpressionsPerAncillaryQubitPoolScope.back().insert(deferredUncomputationsOfExpressionsPerAncillaryQubitPoolScope.back().end(), deferredUncomputationsOfClosedScope.cbegin(), deferredUncomputationsOfClosedScope.cend());
+    }
+
+    bool SyrecSynthesis::canSynthesisOfStatementsBeReused() const {
+        return true;
+    }
+
+    bool SyrecSynthesis::canSynthesizedResultsOfExpressionsBeShared() const {
+        return true;
+    }
+
+    void SyrecSynthesis::invalidateSharedSynthesisResultsOfExpressionsModifiedByStatement(const Statement& statement) const {
+        if (expressionSynthesisCache == nullptr) {
+            return;
+        }
+
+        if (const auto* stmtAsAssignStmt = statementCast<AssignStatement>(&statement); stmtAsAssignStmt != nullptr && stmtAsAssignStmt->lhs != nullptr && stmtAsAssignStmt->lhs->var != nullptr) {
+            expressionSynthesisCache->invalidateSynthesisResultsAccessingVariable(*stmtAsAssignStmt->lhs->var);
+        } else if (const auto* stmtAsUnaryStmt = statementCast<UnaryStatement>(&statement); stmtAsUnaryStmt != nullptr && stmtAsUnaryStmt->var != nullptr && stmtAsUnaryStmt->var->var != nullptr) {
+            expressionSynthesisCache->invalidateSynthesisResultsAccessingVariable(*stmtAsUnaryStmt->var->var);
+        } else if (const auto* stmtAsSwapStmt = statementCast<SwapStatement>(&statement); stmtAsSwapStmt != nullptr && stmtAsSwapStmt->lhs != nullptr && stmtAsSwapStmt->lhs->var != nullptr && stmtAsSwapStmt->rhs != nullptr && stmtAsSwapStmt->rhs->var != nullptr) {
+            expressionSynthesisCache->invalidateSynthesisResultsAccessingVariable(*stmtAsSwapStmt->lhs->var);
+            expressionSynthesisCache->invalidateSynthesisResultsAccessingVariable(*stmtAsSwapStmt->rhs->var);
+        } else if (statementCast<SkipStatement>(&statement) == nullptr) {
+            // The propagated control qubits change during the synthesis of an IfStatement while the variables modified by a loop or a call/uncall statement are not determined, all shared results are thus invalidated.
+            expressionSynthesisCache->clear();
+        }
+    }
+
+    void SyrecSynthesis::invalidateSharedSynthesisResultsOfExpressionsStoredInQubitsTargetedByQuantumOperations(const std::size_t indexOfFirstQuantumOperation, const std::size_t indexOfLastQuantumOperation) {
+        const bool areSharedResultsOfExpressionsCached = expressionSynthesisCache != nullptr && expressionSynthesisCache->getNumCachedSynthesisResults() != 0U;
+        if (!areSharedResultsOfExpressionsCached && dividersSynthesizedForCurrentStatement.empty() && comparatorsSynthesizedForCurrentStatement.empty() && indexDecodingsSharedInCurrentStatement.empty()) {
+            return;
+        }
+
+        // The qubits targeted by quantum operations already forwarded to a quantum operation sink are unknown.
+        if (indexOfFirstQuantumOperation < annotatableQuantumComputation.getNumForwardedQuantumOperations()) {
+            if (expressionSynthesisCache != nullptr) {
+                expressionSynthesisCache->clear();
+            }
+            dividersSynthesizedForCurrentStatement.clear();
+            comparatorsSynthesizedForCurrentStatement.clear();
+            indexDecodingsSharedInCurrentStatement.clear();
+            return;
+        }
+
+        std::unordered_set<qc::Qubit> targetedQubits;
+        for (std::size_t i = indexOfFirstQuantumOperation; i <= indexOfLastQuantumOperation && i < annotatableQuantumComputation.getNumQuantumOperations(); ++i) {
+            if (const qc::Operation* quantumOperation = annotatableQuantumComputation.getQuantumOperation(i); quantumOperation != nullptr) {
+                targetedQubits.insert(quantumOperation->getTargets().cbegin(), quantumOperation->getTargets().cend());
+            }
+        }
+        if (areSharedResultsOfExpressionsCached) {
+            expressionSynthesisCache->invalidateSynthesisResultsStoredInQubits(targetedQubits);
+        }
+
+        const auto isAnyQubitTargeted = [&](const std::vector<qc::Qubit>& qubits) {
+            return std::ranges::any_of(qubits, [&](const qc::Qubit qubit) { return targetedQubits.contains(qubit); });
+        };
+        std::erase_if(dividersSynthesizedForCurrentStatement, [&](const SynthesizedDivider& synthesizedDivider) {
+            return isAnyQubitTargeted(synthesizedDivider.dividend) || isAnyQubitTargeted(synthesizedDivider.divisor) || isAnyQubitTargeted(synthesizedDivider.quotient) || isAnyQubitTargeted(synthesizedDivider.remainder);
+        });
+        std::erase_if(comparatorsSynthesizedForCurrentStatement, [&](const SynthesizedComparator& synthesizedComparator) {
+            return isAnyQubitTargeted(synthesizedComparator.lhsOperand) || isAnyQubitTargeted(synthesizedComparator.rhsOperand) || targetedQubits.contains(synthesizedComparator.lessThanResult) || targetedQubits.contains(synthesizedComparator.equalityResult);
+        });
+        std::erase_if(indexDecodingsSharedInCurrentStatement, [&](const SharedIndexDecoding& sharedIndexDecoding) {
+            return isAnyQubitTargeted(sharedIndexDecoding.qubitsStoringUnrolledIndex) || isAnyQubitTargeted(sharedIndexDecoding.qubitsStoringOneHotIndex);
+        });
+    }
+
+    const SyrecSynthesis::SynthesizedDivider* SyrecSynthesis::findDividerSynthesizedForCurrentStatement(const std::vector<qc::Qubit>& dividend, const std::vector<qc::Qubit>& divisor) const {
+        const auto matchingDivider = std::ranges::find_if(dividersSynthesizedForCurrentStatement, [&](const SynthesizedDivider& synthesizedDivider) { return synthesizedDivider.dividend == dividend && synthesizedDivider.divisor == divisor; });
+        return matchingDivider != dividersSynthesizedForCurrentStatement.cend() ? &*matchingDivider : nullptr;
+    }
+
+    const SyrecSynthesis::SynthesizedComparator* SyrecSynthesis::findComparatorSynthesizedForCurrentStatement(const std::vector<qc::Qubit>& lhsOperand, const std::vector<qc::Qubit>& rhsOperand) const {
+        const auto matchingComparator = std::ranges::find_if(comparatorsSynthesizedForCurrentStatement, [&](const SynthesizedComparator& synthesizedComparator) { return synthesizedComparator.lhsOperand == lhsOperand && synthesizedComparator.rhsOperand == rhsOperand; });
+        return matchingComparator != comparatorsSynthesizedForCurrentStatement.cend() ? &*matchingComparator : nullptr;
+    }
+
+    bool SyrecSynthesis::synthesizeComparator(const std::vector<qc::Qubit>& lhsOperand, const std::vector<qc::Qubit>& rhsOperand) {
+        const std::optional<qc::Qubit> lessThanResult = getConstantLine(false, getLastCreatedModuleCallStackInstance());
+        const std::optional<qc::Qubit> equalityResult = getConstantLine(false, getLastCreatedModuleCallStackInstance());
+        if (!lessThanResult.has_value() || !equalityResult.has_value() || lhsOperand.size() != rhsOperand.size()) {
+            return false;
+        }
+
+        // The borrow of the subtraction lhs - rhs, computed in the qubits of the lhs operand, determines whether the lhs is less than the rhs operand while the operands are equal iff the difference is zero.
+        bool synthesisOk = decreaseWithCarry(annotatableQuantumComputation, lhsOperand, rhsOperand, *lessThanResult);
+        for (std::size_t i = 0; i < lhsOperand.size() && synthesisOk; ++i) {
+            synthesisOk = annotatableQuantumComputation.addOperationsImplementingNotGate(lhsOperand[i]);
+        }
+        synthesisOk &= annotatableQuantumComputation.addOperationsImplementingMultiControlToffoliGate(qc::Controls(lhsOperand.begin(), lhsOperand.end()), *equalityResult);
+        for (std::size_t i = 0; i < lhsOperand.size() && synthesisOk; ++i) {
+            synthesisOk = annotatableQuantumComputation.addOperationsImplementingNotGate(lhsOperand[i]);
+        }
+
+        synthesisOk &= inplaceAdd(annotatableQuantumComputation, rhsOperand, lhsOperand);
+        if (synthesisOk) {
+            comparatorsSynthesizedForCurrentStatement.emplace_back(SynthesizedComparator{.lhsOperand = lhsOperand, .rhsOperand = rhsOperand, .lessThanResult = *lessThanResult, .equalityResult = *equalityResult});
+        }
+        return synthesisOk;
+    }
+
+    bool SyrecSynthesis::synthesizeRelationalOperationUsingSharedComparator(BinaryExpression::BinaryOperation relationalOperation, const qc::Qubit dest, const std::vector<qc::Qubit>& lhsOperand, const std::vector<qc::Qubit>& rhsOperand) {
+        // A comparator synthesized for the swapped operands can be used by also swapping the operands of the relational operation (e.g. 'a < b' is equal to 'b > a').
+        const SynthesizedComparator* sharedComparator = findComparatorSynthesizedForCurrentStatement(lhsOperand, rhsOperand);
+        if (sharedComparator == nullptr) {
+            if (sharedComparator = findComparatorSynthesizedForCurrentStatement(rhsOperand, lhsOperand); sharedComparator != nullptr) {
+                switch (relationalOperation) {
+                    case BinaryExpression::BinaryOperation::LessThan:
+                        relationalOperation = BinaryExpression::BinaryOperation::GreaterThan;
+                        break;
+                    case BinaryExpression::BinaryOperation::GreaterThan:
+                        relationalOperation = BinaryExpression::BinaryOperation::LessThan;
+                        break;
+                    case BinaryExpression::BinaryOperation::LessEquals:
+                        relationalOperation = BinaryExpression::BinaryOperation::GreaterEquals;
+                        break;
+                    case BinaryExpression::BinaryOperation::GreaterEquals:
+                        relationalOperation = BinaryExpression::BinaryOperation::LessEquals;
+                        break;
+                    default:
+                        break;
+                }
+            } else if (synthesizeComparator(lhsOperand, rhsOperand)) {
+                sharedComparator = &comparatorsSynthesizedForCurrentStatement.back();
+            } else {
+                return false;
+            }
+        }
+
+        // Since the lhs operand can either be less than, equal to or greater than the rhs operand, the results of all relational operations can be determined from the two results of the comparator.
+        const bool isLessThanResultRequired = relationalOperation != BinaryExpression::BinaryOperation::Equals && relationalOperation != BinaryExpression::BinaryOperation::NotEquals;
+        const bool isEqualityResultRequired = relationalOperation != BinaryExpression::BinaryOperation::LessThan && relationalOperation != BinaryExpression::BinaryOperation::GreaterEquals;
+        const bool isResultNegated          = relationalOperation == BinaryExpression::BinaryOperation::GreaterThan || relationalOperation == BinaryExpression::BinaryOperation::GreaterEquals || relationalOperation == BinaryExpression::BinaryOperation::NotEquals;
+        return (!isLessThanResultRequired || annotatableQuantumComputation.addOperationsImplementingCnotGate(sharedComparator->lessThanResult, dest)) && (!isEqualityResultRequired || annotatableQuantumComputation.addOperationsImplementingCnotGate(sharedComparator->equalityResult, dest)) && (!isResultNegated || annotatableQuantumComputation.addOperationsImplementingNotGate(dest));
+    }
+
+    std::optional<ModuleCallSynthesisCache::ModuleCallContext> SyrecSynthesis::determineModuleCallContextForReuseOfSynthesis(const Module& targetModule, const std::vector<qc::Qubit>& firstQubitPerParameter, const StatementExecutionOrderStack::StatementExecutionOrder statementExecutionOrder) const {
+        // The inline information of the created qubits would reference the call stack of the module call in which the template was recorded, modules without parameters are not considered since the synthesis of their body would not open a new variable qubit offset scope.
+        if (moduleCallSynthesisCache == nullptr || shouldQubitInlineInformationBeRecorded() || targetModule.parameters.empty() || targetModule.parameters.size() != firstQubitPerParameter.size() || !canSynthesisOfStatementsBeReused()) {
+            return std::nullopt;
+        }
+
+        const std::unordered_set<qc::Qubit>& aggregateOfPropagatedControlQubits = annotatableQuantumComputation.getAggregateOfPropagatedControlQubits();
+        auto                                 moduleCallContext                  = ModuleCallSynthesisCache::ModuleCallContext{.targetModule = &targetModule, .statementExecutionOrder = statementExecutionOrder, .propagatedControlQubits = std::vector(aggregateOfPropagatedControlQubits.cbegin(), aggregateOfPropagatedControlQubits.cend())};
+        std::ranges::sort(moduleCallContext.propagatedControlQubits);
+
+        // The qubits of a template can only be remapped unambiguously if the qubits of the caller arguments neither overlap with each other (e.g. for a call 'call add(a, a)') nor with the propagated control qubits.
+        std::vector<std::pair<qc::Qubit, qc::Qubit>> qubitRangePerParameter;
+        qubitRangePerParameter.reserve(firstQubitPerParameter.size());
+        for (std::size_t i = 0; i < firstQubitPerParameter.size(); ++i) {
+            const unsigned numQubitsOfParameter = determineNumberOfElementsInVariable(*targetModule.parameters.at(i)) * targetModule.parameters.at(i)->bitwidth;
+            qubitRangePerParameter.emplace_back(firstQubitPerParameter.at(i), firstQubitPerParameter.at(i) + numQubitsOfParameter);
+        }
+        std::ranges::sort(qubitRangePerParameter);
+
+        for (std::size_t i = 0; i < qubitRangePerParameter.size(); ++i) {
+            const auto& [firstQubitOfParameter, qubitAfterLastOfParameter] = qubitRangePerParameter.at(i);
+            if (i + 1U < qubitRangePerParameter.size() && qubitRangePerParameter.at(i + 1U).first < qubitAfterLastOfParameter) {
+                return std::nullopt;
+            }
+
+            const auto firstPropagatedControlQubitNotSmallerThanParameterQubits = std::ranges::lower_bound(moduleCallContext.propagatedControlQubits, firstQubitOfParameter);
+            if (firstPropagatedControlQubitNotSmallerThanParameterQubits != moduleCallContext.propagatedControlQubits.cend() && *firstPropagatedControlQubitNotSmallerThanParameterQubits < qubitAfterLastOfParameter) {
+                return std::nullopt;
+            }
+        }
+        return moduleCallContext;
+    }
+
+    bool SyrecSynthesis::canQubitsOfModuleCallTemplateBeRemapped(const ModuleCallSynthesisCache::ModuleCallTemplate& moduleCallTemplate, const ModuleCallSynthesisCache::ModuleCallContext& moduleCallContext, const Module& targetModule) const {
+        if (moduleCallTemplate.firstQubitPerParameter.size() != targetModule.parameters.size()) {
+            return false;
+        }
+
+        const auto isQubitRemappable = [&](const qc::Qubit qubit) {
+            if (qubit >= moduleCallTemplate.firstCreatedQubit || std::ranges::binary_search(moduleCallContext.propagatedControlQubits, qubit)) {
+                return true;
+            }
+
+            for (std::size_t i = 0; i < targetModule.parameters.size(); ++i) {
+                const qc::Qubit firstQubitOfParameter = moduleCallTemplate.firstQubitPerParameter.at(i);
+                const unsigned  numQubitsOfParameter  = determineNumberOfElementsInVariable(*targetModule.parameters.at(i)) * targetModule.parameters.at(i)->bitwidth;
+                if (qubit >= firstQubitOfParameter && qubit - firstQubitOfParameter < numQubitsOfParameter) {
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        for (std::size_t i = 0; i < moduleCallTemplate.numQuantumOperations; ++i) {
+            const qc::Operation* recordedQuantumOperation = annotatableQuantumComputation.getQuantumOperation(moduleCallTemplate.indexOfFirstQuantumOperation + i);
+            if (recordedQuantumOperation == nullptr || !recordedQuantumOperation->isStandardOperation() || !std::ranges::all_of(recordedQuantumOperation->getTargets(), isQubitRemappable) || !std::ranges::all_of(recordedQuantumOperation->getControls(), [&](const qc::Control& controlQubit) { return isQubitRemappable(controlQubit.qubit); })) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void SyrecSynthesis::recordModuleCallsOfCopiedQuantumOperations(const std::size_t indexOfFirstCopiedQuantumOperation, const std::size_t numCopiedQuantumOperations, const std::size_t indexOfFirstQuantumOperationOfCopy, const bool isCopyInReverseOrder) {
+        if (!quantumOperationsPerModuleCall.has_value()) {
+            return;
+        }
+
+        // Since the module calls are recorded once their synthesis was completed, the end of the recorded sequences of quantum operations does not decrease and the search for the module calls of the copied sequence can stop at the
+        // first module call ending prior to the copied sequence.
+        std::vector<AnnotatableQuantumComputation::QuantumOperationIndexRange> copiedModuleCalls;
+        for (const AnnotatableQuantumComputation::QuantumOperationIndexRange& moduleCall: std::ranges::reverse_view(*quantumOperationsPerModuleCall)) {
+            if (moduleCall.indexOfFirstQuantumOperation + moduleCall.numQuantumOperations <= indexOfFirstCopiedQuantumOperation) {
+                break;
+            }
+            if (moduleCall.indexOfFirstQuantumOperation >= indexOfFirstCopiedQuantumOperation && moduleCall.indexOfFirstQuantumOperation + moduleCall.numQuantumOperations <= indexOfFirstCopiedQuantumOperation + numCopiedQuantumOperations) {
+                const std::size_t offsetOfModuleCallInCopy = isCopyInReverseOrder ? indexOfFirstCopiedQuantumOperation + numCopiedQuantumOperations - (moduleCall.indexOfFirstQuantumOperation + moduleCall.numQuantumOperations) : moduleCall.indexOfFirstQuantumOperation - indexOfFirstCopiedQuantumOperation;
+                copiedModuleCalls.emplace_back(AnnotatableQuantumComputation::QuantumOperationIndexRange{.indexOfFirstQuantumOperation = indexOfFirstQuantumOperationOfCopy + offsetOfModuleCallInCopy, .numQuantumOperations = moduleCall.numQuantumOperations});
+            }
+        }
+
+        if (!isCopyInReverseOrder) {
+            quantumOperationsPerModuleCall->insert(quantumOperationsPerModuleCall->end(), copiedModuleCalls.crbegin(), copiedModuleCalls.crend());
+            return;
+        }
+        // The order in which the synthesis of the copied module calls was completed is not preserved by a copy in reverse order, the copied module calls are thus ordered by the end of their quantum operations with a nested module call
+        // preceding the enclosing one.
+        std::ranges::sort(copiedModuleCalls, [](const AnnotatableQuantumComputation::QuantumOperationIndexRange& lhs, const AnnotatableQuantumComputation::QuantumOperationIndexRange& rhs) {
+            const std::size_t endOfLhs = lhs.indexOfFirstQuantumOperation + lhs.numQuantumOperations;
+            const std::size_t endOfRhs = rhs.indexOfFirstQuantumOperation + rhs.numQuantumOperations;
+            return endOfLhs != endOfRhs ? endOfLhs < endOfRhs : lhs.numQuantumOperations < rhs.numQuantumOperations;
+        });
+        quantumOperationsPerModuleCall->insert(quantumOperationsPerModuleCall->end(), copiedModuleCalls.cbegin(), copiedModuleCalls.cend());
+    }
+
+    const ModuleCallSynthesisCache::ModuleCallTemplate* SyrecSynthesis::findTemplateOfMirroredModuleCall(const ModuleCallSynthesisCache::ModuleCallContext& moduleCallContext, const std::vector<qc::Qubit>& firstQubitPerParameter) const {
+        ModuleCallSynthesisCache::ModuleCallContext mirroredModuleCallContext = moduleCallContext;
+        mirroredModuleCallContext.statementExecutionOrder                     = !moduleCallContext.statementExecutionOrder;
+
+        // Since the synthesized quantum operations are self-inverse, their replay in reverse order implements the inverse of the module body as long as no qubits were created during the synthesis of the latter. Otherwise, the replay would
+        // expect the created qubits to store the values left behind by the mirrored module call instead of their constant initial value assumed by the synthesis of the module body.
+        const ModuleCallSynthesisCache::ModuleCallTemplate* mirroredModuleCallTemplate = moduleCallSynthesisCache->findTemplate(mirroredModuleCallContext);
+        if (mirroredModuleCallTemplate == nullptr || mirroredModuleCallTemplate->numCreatedQubits != 0U || mirroredModuleCallTemplate->numQuantumOperations == 0U || mirroredModuleCallTemplate->firstQubitPerParameter != firstQubitPerParameter || mirroredModuleCallTemplate->indexOfFirstQuantumOperation < annotatableQuantumComputation.getNumForwardedQuantumOperations()) {
+            return nullptr;
+        }
+        return mirroredModuleCallTemplate;
+    }
+
+    bool SyrecSynthesis::replayMirroredModuleCallTemplate(const ModuleCallSynthesisCache::ModuleCallTemplate& mirroredModuleCallTemplate) {
+        const std::size_t indexOfFirstQuantumOperationOfReplay = annotatableQuantumComputation.getNumQuantumOperations();
+        if (!annotatableQuantumComputation.replayOperationsAtGivenIndexRange(mirroredModuleCallTemplate.indexOfFirstQuantumOperation + mirroredModuleCallTemplate.numQuantumOperations - 1U, mirroredModuleCallTemplate.indexOfFirstQuantumOperation)) {
+            return false;
+        }
+        recordModuleCallsOfCopiedQuantumOperations(mirroredModuleCallTemplate.indexOfFirstQuantumOperation, mirroredModuleCallTemplate.numQuantumOperations, indexOfFirstQuantumOperationOfReplay, true);
+        return true;
+    }
+
+    bool SyrecSynthesis::instantiateModuleCallTemplate(const ModuleCallSynthesisCache::ModuleCallTemplate& moduleCallTemplate, const Module& targetModule, const std::vector<qc::Qubit>& firstQubitPerParameter) {
+        if (moduleCallTemplate.firstQubitPerParameter.size() != firstQubitPerParameter.size() || targetModule.parameters.size() != firstQubitPerParameter.size()) {
+            return false;
+        }
+
+        std::vector<AnnotatableQuantumComputation::QubitIndexRangeMapping> qubitIndexRangeMappings;
+        qubitIndexRangeMappings.reserve(firstQubitPerParameter.size() + 1U);
+        for (std::size_t i = 0; i < firstQubitPerParameter.size(); ++i) {
+            const unsigned numQubitsOfParameter = determineNumberOfElementsInVariable(*targetModule.parameters.at(i)) * targetModule.parameters.at(i)->bitwidth;
+            if (numQubitsOfParameter > 0U && moduleCallTemplate.firstQubitPerParameter.at(i) != firstQubitPerParameter.at(i)) {
+                qubitIndexRangeMappings.emplace_back(AnnotatableQuantumComputation::QubitIndexRangeMapping{.mappedQubitIndexRange = {.firstQubitIndex = moduleCallTemplate.firstQubitPerParameter.at(i), .lastQubitIndex = moduleCallTemplate.firstQubitPerParameter.at(i) + numQubitsOfParameter - 1U}, .firstQubitIndexOfMappingTarget = firstQubitPerParameter.at(i)});
+            }
+        }
+
+        // The quantum operations initializing the ancillary qubits with their constant value are part of the recorded quantum operations, thus all ancillary qubits are recreated with an initial value of zero.
+        // Similar to the replay of a loop body iteration, the ancillary qubit pool must not provide any of the ancillary qubits expected to be created by the recorded quantum operations.
+        const auto             firstCreatedQubit = static_cast<qc::Qubit>(annotatableQuantumComputation.getNqubits());
+        std::vector<qc::Qubit> createdAncillaryQubits;
+        if (ancillaryQubitPool != nullptr) {
+            ancillaryQubitPool->openScope();
+        }
+        const bool couldQuantumRegistersBeCreated = std::ranges::all_of(moduleCallTemplate.quantumRegisterAllocations, [&](const ModuleCallSynthesisCache::QuantumRegisterAllocation& quantumRegisterAllocation) {
+            return quantumRegisterAllocation.localVariable != nullptr ? createQuantumRegistersForSyrecVariables(Variable::vec{quantumRegisterAllocation.localVariable}) : getConstantLines(quantumRegisterAllocation.numAncillaryQubits, 0U, createdAncillaryQubits);
+        });
+        if (ancillaryQubitPool != nullptr) {
+            ancillaryQubitPool->closeScope();
+        }
+
+        if (!couldQuantumRegistersBeCreated) {
+            return false;
+        }
+
+        if (annotatableQuantumComputation.getNqubits() - firstCreatedQubit != moduleCallTemplate.numCreatedQubits) {
+            getErrorStream() << "Expected " << std::to_string(moduleCallTemplate.numCreatedQubits) << " qubits to be created during the instantiation of the template for module " << targetModule.name << " but " << std::to_string(annotatableQuantumComputation.getNqubits() - firstCreatedQubit) << " qubits were created\n";
+            return false;
+        }
+
+        if (moduleCallTemplate.numCreatedQubits > 0U) {
+            qubitIndexRangeMappings.emplace_back(AnnotatableQuantumComputation::QubitIndexRangeMapping{.mappedQubitIndexRange = {.firstQubitIndex = moduleCallTemplate.firstCreatedQubit, .lastQubitIndex = moduleCallTemplate.firstCreatedQubit + static_cast<qc::Qubit>(moduleCallTemplate.numCreatedQubits) - 1U}, .firstQubitIndexOfMappingTarget = firstCreatedQubit});
+        }
+
+        const std::size_t indexOfFirstQuantumOperationOfInstantiation = annotatableQuantumComputation.getNumQuantumOperations();
+        if (!annotatableQuantumComputation.replayOperationsWithRemappedQubits(moduleCallTemplate.indexOfFirstQuantumOperation, moduleCallTemplate.numQuantumOperations, qubitIndexRangeMappings)) {
+            return false;
+        }
+        recordModuleCallsOfCopiedQuantumOperations(moduleCallTemplate.indexOfFirstQuantumOperation, moduleCallTemplate.numQuantumOperations, indexOfFirstQuantumOperationOfInstantiation);
+
+        if (moduleCallTemplate.statementLineNumberAfterSynthesis.has_value()) {
+            annotatableQuantumComputation.setOrUpdateGlobalStatementLineNumber(*moduleCallTemplate.statementLineNumberAfterSynthesis);
+        }
+        return true;
+    }
+
+    [[nodiscard]] std::optional<SyrecSynthesis::EvaluatedBitrangeAccess> SyrecSynthesis::evaluateAndValidateBitrangeAccess(const VariableAccess& userDefinedVariableAccess) const {
         assert(userDefinedVariableAccess.var != nullptr);
         const unsigned          accessedVariableBitwidth   = userDefinedVariableAccess.var->bitwidth;
         const std::string_view& accessedVariableIdentifier = userDefinedVariableAccess.var->name;
@@ -1703,37 +3545,37 @@ namespace syrec {
             return EvaluatedBitrangeAccess({.bitrangeStart = evaluatedBitrangeStartValue, .bitrangeEnd = evaluatedBitrangeEndValue});
         }
 
-        if (const std::optional<unsigned> evaluationResultOfBitrangeStart = userDefinedVariableAccess.range->first->tryEvaluate(loopVariableValueLookup); evaluationResultOfBitrangeStart.has_value()) {
+        if (const std::optional<unsigned> evaluationResultOfBitrangeStart = loopVariableNumberEvaluator.tryEvaluate(userDefinedVariableAccess.range->first); evaluationResultOfBitrangeStart.has_value()) {
             evaluatedBitrangeStartValue = *evaluationResultOfBitrangeStart;
         } else {
-            std::cerr << "Failed to determine value of bitrange start in access on variable " << accessedVariableIdentifier << "\n";
+            getErrorStream() << "Failed to determine value of bitrange start in access on variable " << accessedVariableIdentifier << "\n";
             return std::nullopt;
         }
 
         if (evaluatedBitrangeStartValue >= accessedVariableBitwidth) {
-            std::cerr << "User defined bitrange start value '" << std::to_string(evaluatedBitrangeStartValue) << "' was not within the valid range [0, " << std::to_string(accessedVariableBitwidth - 1U) << "] in bitrange access on variable " << accessedVariableIdentifier << "\n";
+            getErrorStream() << "User defined bitrange start value '" << std::to_string(evaluatedBitrangeStartValue) << "' was not within the valid range [0, " << std::to_string(accessedVariableBitwidth - 1U) << "] in bitrange access on variable " << accessedVariableIdentifier << "\n";
             return std::nullopt;
         }
 
-        if (const std::optional<unsigned> evaluationResultOfBitrangeEnd = userDefinedVariableAccess.range->second->tryEvaluate(loopVariableValueLookup); evaluationResultOfBitrangeEnd.has_value()) {
+        if (const std::optional<unsigned> evaluationResultOfBitrangeEnd = loopVariableNumberEvaluator.tryEvaluate(userDefinedVariableAccess.range->second); evaluationResultOfBitrangeEnd.has_value()) {
             evaluatedBitrangeEndValue = *evaluationResultOfBitrangeEnd;
         } else {
-            std::cerr << "Failed to determine value of bitrange start in access on variable " << accessedVariableIdentifier << "\n";
+            getErrorStream() << "Failed to determine value of bitrange start in access on variable " << accessedVariableIdentifier << "\n";
             return std::nullopt;
         }
 
         if (evaluatedBitrangeEndValue >= accessedVariableBitwidth) {
-            std::cerr << "User defined bitrange end value '" << std::to_string(evaluatedBitrangeEndValue) << "' was not within the valid range [0, " << std::to_string(accessedVariableBitwidth - 1U) << "] in bitrange access on variable " << accessedVariableIdentifier << "\n";
+            getErrorStream() << "User defined bitrange end value '" << std::to_string(evaluatedBitrangeEndValue) << "' was not within the valid range [0, " << std::to_string(accessedVariableBitwidth - 1U) << "] in bitrange access on variable " << accessedVariableIdentifier << "\n";
             return std::nullopt;
         }
         return EvaluatedBitrangeAccess({.bitrangeStart = evaluatedBitrangeStartValue, .bitrangeEnd = evaluatedBitrangeEndValue});
     }
 
-    [[nodiscard]] std::optional<SyrecSynthesis::EvaluatedDimensionAccess> SyrecSynthesis::evaluateAndValidateDimensionAccess(const VariableAccess& userDefinedVariableAccess, const Number::LoopVariableMapping& loopVariableValueLookup) {
+    [[nodiscard]] std::optional<SyrecSynthesis::EvaluatedDimensionAccess> SyrecSynthesis::evaluateAndValidateDimensionAccess(const VariableAccess& userDefinedVariableAccess) const {
         assert(userDefinedVariableAccess.var != nullptr);
         const std::string_view& accessedVariableIdentifier = userDefinedVariableAccess.var->name;
         if (userDefinedVariableAccess.indexes.size() != userDefinedVariableAccess.var->dimensions.size()) {
-            std::cerr << "The number of indices (" << std::to_string(userDefinedVariableAccess.indexes.size()) << ") defined in a variable access must match the number of dimensions (" << std::to_string(userDefinedVariableAccess.var->dimensions.size() - 1U) << ") of the accessed variable " << accessedVariableIdentifier << "\n";
+            getErrorStream() << "The number of indices (" << std::to_string(userDefinedVariableAccess.indexes.size()) << ") defined in a variable access must match the number of dimensions (" << std::to_string(userDefinedVariableAccess.var->dimensions.size() - 1U) << ") of the accessed variable " << accessedVariableIdentifier << "\n";
             return std::nullopt;
         }
 
@@ -1742,18 +3584,18 @@ namespace syrec {
 
         for (const auto& dimensionExpr: userDefinedVariableAccess.indexes) {
             if (dimensionExpr == nullptr) {
-                std::cerr << "Expression defining index for dimension " << std::to_string(dimensionIdx) << " in variable access on " << accessedVariableIdentifier << " cannot be NULL\n";
+                getErrorStream() << "Expression defining index for dimension " << std::to_string(dimensionIdx) << " in variable access on " << accessedVariableIdentifier << " cannot be NULL\n";
                 return std::nullopt;
             }
-            if (const auto& dimensionExprAsNumericExpr = std::dynamic_pointer_cast<NumericExpression>(dimensionExpr); dimensionExprAsNumericExpr != nullptr) {
-                if (const std::optional<unsigned> evaluatedDimensionExpr = dimensionExprAsNumericExpr->value != nullptr ? dimensionExprAsNumericExpr->value->tryEvaluate(loopVariableValueLookup) : std::nullopt; evaluatedDimensionExpr.has_value()) {
+            if (const auto& dimensionExprAsNumericExpr = expressionPointerCast<NumericExpression>(dimensionExpr); dimensionExprAsNumericExpr != nullptr) {
+                if (const std::optional<unsigned> evaluatedDimensionExpr = loopVariableNumberEvaluator.tryEvaluate(dimensionExprAsNumericExpr->value); evaluatedDimensionExpr.has_value()) {
                     if (*evaluatedDimensionExpr >= userDefinedVariableAccess.var->dimensions.at(dimensionIdx)) {
-                        std::cerr << "Access on value " << std::to_string(*evaluatedDimensionExpr) << " of dimension " << std::to_string(dimensionIdx) << " was not within the valid range [0, " << std::to_string(userDefinedVariableAccess.var->dimensions.at(dimensionIdx) - 1U) << "] in access on variable " << accessedVariableIdentifier << "\n";
+                        getErrorStream() << "Access on value " << std::to_string(*evaluatedDimensionExpr) << " of dimension " << std::to_string(dimensionIdx) << " was not within the valid range [0, " << std::to_string(userDefinedVariableAccess.var->dimensions.at(dimensionIdx) - 1U) << "] in access on variable " << accessedVariableIdentifier << "\n";
                         return std::nullopt;
                     }
                     evaluatedDimensionAccess.accessedValuePerDimension[dimensionIdx] = evaluatedDimensionExpr;
                 } else {
-                    std::cerr << "Failed to evaluate defined value for numeric expression defined in dimension " << std::to_string(dimensionIdx) << " in variable access on " << accessedVariableIdentifier << "\n";
+                    getErrorStream() << "Failed to evaluate defined value for numeric expression defined in dimension " << std::to_string(dimensionIdx) << " in variable access on " << accessedVariableIdentifier << "\n";
                     return std::nullopt;
                 }
             } else {
@@ -1764,26 +3606,26 @@ namespace syrec {
         return evaluatedDimensionAccess;
     }
 
-    std::optional<SyrecSynthesis::EvaluatedVariableAccess> SyrecSynthesis::evaluateAndValidateVariableAccess(const VariableAccess::ptr& userDefinedVariableAccess, const Number::LoopVariableMapping& loopVariableValueLookup, const std::unique_ptr<FirstVariableQubitOffsetLookup>& firstVariableQubitOffsetLookup) {
+    std::optional<SyrecSynthesis::EvaluatedVariableAccess> SyrecSynthesis::evaluateAndValidateVariableAccess(const VariableAccess::ptr& userDefinedVariableAccess, const std::unique_ptr<FirstVariableQubitOffsetLookup>& firstVariableQubitOffsetLookup) const {
         if (userDefinedVariableAccess == nullptr) {
-            std::cerr << "Cannot synthesis variable access that is null\n";
+            getErrorStream() << "Cannot synthesis variable access that is null\n";
             return std::nullopt;
         }
         if (userDefinedVariableAccess->var == nullptr) {
-            std::cerr << "Cannot synthesis variable access in which the accessed variable is null\n";
+            getErrorStream() << "Cannot synthesis variable access in which the accessed variable is null\n";
             return std::nullopt;
         }
 
         qc::Qubit offsetToFirstQubitOfVariable = 0;
-        if (const std::optional<qc::Qubit> determinedOffsetToFirstQubitOfVariableFromLookup = firstVariableQubitOffsetLookup != nullptr ? firstVariableQubitOffsetLookup->getOffsetToFirstQubitOfVariableInCurrentScope(userDefinedVariableAccess->var->name) : std::nullopt; determinedOffsetToFirstQubitOfVariableFromLookup.has_value()) {
+        if (const std::optional<qc::Qubit> determinedOffsetToFirstQubitOfVariableFromLookup = firstVariableQubitOffsetLookup != nullptr ? firstVariableQubitOffsetLookup->getOffsetToFirstQubitOfVariableInCurrentScope(*userDefinedVariableAccess->var) : std::nullopt; determinedOffsetToFirstQubitOfVariableFromLookup.has_value()) {
             offsetToFirstQubitOfVariable = *determinedOffsetToFirstQubitOfVariableFromLookup;
         } else {
-            std::cerr << "Failed to determine first qubit for variable with identifier " << userDefinedVariableAccess->var->name << "\n";
+            getErrorStream() << "Failed to determine first qubit for variable with identifier " << userDefinedVariableAccess->var->name << "\n";
             return std::nullopt;
         }
 
-        const std::optional<EvaluatedDimensionAccess> evaluatedDimensionAccess = evaluateAndValidateDimensionAccess(*userDefinedVariableAccess, loopVariableValueLookup);
-        const std::optional<EvaluatedBitrangeAccess>  evaluatedBitrangeAccess  = evaluateAndValidateBitrangeAccess(*userDefinedVariableAccess, loopVariableValueLookup);
+        const std::optional<EvaluatedDimensionAccess> evaluatedDimensionAccess = evaluateAndValidateDimensionAccess(*userDefinedVariableAccess);
+        const std::optional<EvaluatedBitrangeAccess>  evaluatedBitrangeAccess  = evaluateAndValidateBitrangeAccess(*userDefinedVariableAccess);
         if (evaluatedBitrangeAccess.has_value() && evaluatedDimensionAccess.has_value()) {
             return EvaluatedVariableAccess({.offsetToFirstQubitOfVariable = offsetToFirstQubitOfVariable, .accessedVariable = *userDefinedVariableAccess->var, .evaluatedBitrangeAccess = *evaluatedBitrangeAccess, .evaluatedDimensionAccess = *evaluatedDimensionAccess, .userDefinedDimensionAccess = userDefinedVariableAccess->indexes});
         }
@@ -1792,7 +3634,7 @@ namespace syrec {
 
     [[nodiscard]] bool SyrecSynthesis::getQubitsForVariableAccessContainingOnlyIndicesEvaluableAtCompileTime(const EvaluatedVariableAccess& evaluatedVariableAccess, std::vector<qc::Qubit>& containerForAccessedQubits) {
         if (!evaluatedVariableAccess.evaluatedDimensionAccess.containedOnlyNumericExpressions) {
-            std::cerr << "Synthesis of variable access containing only indices evaluable at compile time could not be performed due to evaluated variable access indicating that not all indices could be evaluated at compile time\n";
+            getErrorStream() << "Synthesis of variable access containing only indices evaluable at compile time could not be performed due to evaluated variable access indicating that not all indices could be evaluated at compile time\n";
             return false;
         }
 
@@ -1813,7 +3655,7 @@ namespace syrec {
         unsigned offsetToAccessedValue = 0U;
         for (std::size_t i = 0; i < accessedValuePerDimension.size(); ++i) {
             if (!accessedValuePerDimension.at(i).has_value()) {
-                std::cerr << "Failed to fetch accessed value of dimension " << std::to_string(i) << " in evaluated variable access that only contained compile time constant indices, this should not happen\n";
+                getErrorStream() << "Failed to fetch accessed value of dimension " << std::to_string(i) << " in evaluated variable access that only contained compile time constant indices, this should not happen\n";
                 return false;
             }
             offsetToAccessedValue += *accessedValuePerDimension.at(i) * containerForOffsetsToNextElementOfDimensionInNumberOfArrayElements.at(i);
@@ -1839,6 +3681,13 @@ namespace syrec {
 
     bool SyrecSynthesis::calculateSymbolicUnrolledIndexForElementInVariable(const EvaluatedVariableAccess& evaluatedVariableAccess, std::vector<qc::Qubit>& containerToStoreUnrolledIndex) {
         assert(containerToStoreUnrolledIndex.empty());
+        if (const SharedIndexDecoding* sharedIndexDecoding = findIndexDecodingSharedInCurrentStatement(evaluatedVariableAccess); sharedIndexDecoding != nullptr) {
+            containerToStoreUnrolledIndex = sharedIndexDecoding->qubitsStoringUnrolledIndex;
+            return true;
+        }
+        if (padDimensionsOfUnrolledIndicesToPowersOfTwo) {
+            return concatenateIndicesOfDimensionsToUnrolledIndex(evaluatedVariableAccess, containerToStoreUnrolledIndex);
+        }
 
         const Variable&        accessedVariable          = evaluatedVariableAccess.accessedVariable;
         const Expression::vec& accessedIndexPerDimension = evaluatedVariableAccess.userDefinedDimensionAccess;
@@ -1870,7 +3719,7 @@ namespace syrec {
             // if no bitwidth restriction exists (i.e. defined by the bitwidth of the assigned to variable of an assignment). However, to calculate the unrolled index one or more addition/multiplication operations need to be synthesized
             // with the addition operation requiring that both summands have the same bitwidth thus we need to truncate the bitwidth and value of the integer constant to the required bitwidth which is equal to the bitwidth required to
             // store the index to any value of the accessed variable (i.e. for a variable a[2][3](<BITWIDTH>) one would need 3 bits to store the maximum possible index value 5 [assuming zero-based indexing]).
-            if (const auto* userDefinedIndexExprAsNumericOne = dynamic_cast<NumericExpression*>(accessedIndexPerDimension.at(i).get()); userDefinedIndexExprAsNumericOne != nullptr) {
+            if (const auto* userDefinedIndexExprAsNumericOne = expressionCast<NumericExpression>(accessedIndexPerDimension.at(i).get()); userDefinedIndexExprAsNumericOne != nullptr) {
                 const std::optional<unsigned> constantValueOfExprEvaluatedToCompileTime = evaluatedVariableAccess.evaluatedDimensionAccess.accessedValuePerDimension.at(i);
                 assert(constantValueOfExprEvaluatedToCompileTime.has_value());
 
@@ -1887,20 +3736,20 @@ namespace syrec {
                 compileTimeValueOfUnrolledIndex.reset();
 
                 const auto             numQubitsRequiredToStoreAnyIndexForCurrentDimension = static_cast<std::size_t>(determineNumberOfBitsRequiredToStoreValue(accessedVariable.dimensions.at(i) - 1U));
-                const std::size_t      numOperationsPriorToSynthesisOfExpr                 = annotatableQuantumComputation.getNops();
+                const std::size_t      numOperationsPriorToSynthesisOfExpr                 = annotatableQuantumComputation.getNumQuantumOperations();
                 std::vector<qc::Qubit> qubitsStoringSynthesizedExprOfDimension;
                 // We do not need to manually generate ancillary qubits here since they are generated during the synthesis of the expression (or qubits of a variable simply copied to our container in case of a variable access with only compile time constant expressions)
                 if (!onExpression(accessedIndexPerDimension.at(i), numQubitsRequiredToStoreAnyIndexForCurrentDimension, qubitsStoringSynthesizedExprOfDimension, {}, BinaryExpression::BinaryOperation::Add)) {
-                    std::cerr << "Failed to synthesis index expression for dimension " << std::to_string(i) << " of dimension access for variable access on variable " << accessedVariable.name << "\n";
+                    getErrorStream() << "Failed to synthesis index expression for dimension " << std::to_string(i) << " of dimension access for variable access on variable " << accessedVariable.name << "\n";
                     return false;
                 }
 
-                const std::size_t numOperationsAfterSynthesisOfExpr = annotatableQuantumComputation.getNops();
+                const std::size_t numOperationsAfterSynthesisOfExpr = annotatableQuantumComputation.getNumQuantumOperations();
                 // The bitwidth of synthesized expression could be smaller/larger than both the bithwidth for storing the unrolled index as well as the maximum index for the currently processed dimension with the expression bitwidth needing to be truncated/enlarged so that the subsequent addition operation can be synthesized
                 // with the addition operation requiring the same operand bitwidth. Due to this condition, we think that bitwidth of the index expression should not be larger than the bitwidth required to store the unrolled index as well as the maximum index for the currently processed dimension.
                 // A smaller bitwidth should be allowed but needs to be padded to the required bitwidth.
                 if (qubitsStoringSynthesizedExprOfDimension.size() > numQubitsRequiredToStoreAnyIndexForCurrentDimension) { // An index out of range value should have been already detected during the evaluation and validation of the dimension access that is assumed to have been performed prior to this call.
-                    std::cerr << "Bitwidth of expression (" << std::to_string(qubitsStoringSynthesizedExprOfDimension.size()) << ") can be at most be as large as the number of qubits (" << std::to_string(numQubitsRequiredToStoreAnyIndexForCurrentDimension) << ") required to store the maximum index to an element in the " + std::to_string(i) + "-th dimension of the accessed variable " << accessedVariable.name << "\n";
+                    getErrorStream() << "Bitwidth of expression (" << std::to_string(qubitsStoringSynthesizedExprOfDimension.size()) << ") can be at most be as large as the number of qubits (" << std::to_string(numQubitsRequiredToStoreAnyIndexForCurrentDimension) << ") required to store the maximum index to an element in the " + std::to_string(i) + "-th dimension of the accessed variable " << accessedVariable.name << "\n";
                     return false;
                 }
 
@@ -1918,48 +3767,147 @@ namespace syrec {
                 if (offsetToNextElementOfDimensionInNumberOfArrayElements == 1) {
                     qubitsStoringSymbolicValueOfSummandOfDimensionForUnrolledIndex = qubitsStoringSynthesizedExprOfDimension;
                 } else if (std::has_single_bit(offsetToNextElementOfDimensionInNumberOfArrayElements)) {
-                    numOperationsPriorToSynthesisOfSummandInUnrolledIndexSum = annotatableQuantumComputation.getNops();
+                    numOperationsPriorToSynthesisOfSummandInUnrolledIndexSum = annotatableQuantumComputation.getNumQuantumOperations();
                     const auto shiftAmount                                   = static_cast<std::optional<unsigned>>(determinePositionOfFirstOneBitInValueStartingFromLSB(offsetToNextElementOfDimensionInNumberOfArrayElements));
                     synthesisOk &= shiftAmount.has_value() && getConstantLines(numQubitsRequiredToStoreIndexToAnyElementInAccessedVariable, 0U, qubitsStoringSymbolicValueOfSummandOfDimensionForUnrolledIndex) &&
                                    leftShift(annotatableQuantumComputation, qubitsStoringSymbolicValueOfSummandOfDimensionForUnrolledIndex, qubitsStoringSynthesizedExprOfDimension, *shiftAmount);
-                    numOperationsAfterSynthesisOfSummandInUnrolledIndexSum = annotatableQuantumComputation.getNops();
+                    numOperationsAfterSynthesisOfSummandInUnrolledIndexSum = annotatableQuantumComputation.getNumQuantumOperations();
+                } else if (specializeOperationsWithConstantOperand) {
+                    numOperationsPriorToSynthesisOfSummandInUnrolledIndexSum = annotatableQuantumComputation.getNumQuantumOperations();
+                    synthesisOk &= getConstantLines(numQubitsRequiredToStoreIndexToAnyElementInAccessedVariable, 0U, qubitsStoringSymbolicValueOfSummandOfDimensionForUnrolledIndex) && multiplicationByConstant(qubitsStoringSymbolicValueOfSummandOfDimensionForUnrolledIndex, qubitsStoringSynthesizedExprOfDimension, offsetToNextElementOfDimensionInNumberOfArrayElements);
+                    numOperationsAfterSynthesisOfSummandInUnrolledIndexSum = annotatableQuantumComputation.getNumQuantumOperations();
                 } else {
-                    numOperationsPriorToSynthesisOfSummandInUnrolledIndexSum = annotatableQuantumComputation.getNops();
+                    numOperationsPriorToSynthesisOfSummandInUnrolledIndexSum = annotatableQuantumComputation.getNumQuantumOperations();
                     std::vector<qc::Qubit> qubitsStoringOffsetToNextElementOfDimensionInNumberOfArrayElements;
                     synthesisOk &= getConstantLines(numQubitsRequiredToStoreIndexToAnyElementInAccessedVariable, 0U, qubitsStoringSymbolicValueOfSummandOfDimensionForUnrolledIndex) && getConstantLines(numQubitsRequiredToStoreIndexToAnyElementInAccessedVariable, 0U, qubitsStoringOffsetToNextElementOfDimensionInNumberOfArrayElements) && moveIntegerValueToAncillaryQubits(annotatableQuantumComputation, qubitsStoringOffsetToNextElementOfDimensionInNumberOfArrayElements, offsetToNextElementOfDimensionInNumberOfArrayElements) && multiplication(annotatableQuantumComputation, qubitsStoringSymbolicValueOfSummandOfDimensionForUnrolledIndex, qubitsStoringSynthesizedExprOfDimension, qubitsStoringOffsetToNextElementOfDimensionInNumberOfArrayElements);
-                    numOperationsAfterSynthesisOfSummandInUnrolledIndexSum = annotatableQuantumComputation.getNops();
+                    numOperationsAfterSynthesisOfSummandInUnrolledIndexSum = annotatableQuantumComputation.getNumQuantumOperations();
                 }
                 synthesisOk &= assignAdd(containerToStoreUnrolledIndex, qubitsStoringSymbolicValueOfSummandOfDimensionForUnrolledIndex, AssignStatement::AssignOperation::Add);
 
                 // We can reset the state of the ancillary qubits used to calculate the summand S = <offset_to_next_element> * <index_of_dimension> back to their initial state since they are no longer needed after the summand was added
                 // to the unrolled index by simply replaying the used operations in reverse order. This reset would allow for the ancillary qubits to be reused in future operation. We need to use the syrec::AnnotatableQuantumComputation::replayOperationsAtGivenIndexRange(...) to replay the
                 // operations instead of manually adding the qc::Operation via the qc::QuantumComputation base class since the former will add the required gate annotations to the replayed operations which the latter will not.
-                if (numOperationsPriorToSynthesisOfSummandInUnrolledIndexSum.has_value() && numOperationsPriorToSynthesisOfSummandInUnrolledIndexSum > 0) {
+                // The reset is skipped if the quantum operations to replay were already forwarded to a quantum operation sink.
+                if (numOperationsPriorToSynthesisOfSummandInUnrolledIndexSum.has_value() && numOperationsPriorToSynthesisOfSummandInUnrolledIndexSum > 0 && *numOperationsPriorToSynthesisOfSummandInUnrolledIndexSum >= annotatableQuantumComputation.getNumForwardedQuantumOperations()) {
                     if (!numOperationsAfterSynthesisOfSummandInUnrolledIndexSum.has_value()) {
-                        std::cerr << "Failed to undo quantum operations required to calculate summand of dimension " << std::to_string(i) << "for unrolled index sum\n";
+                        getErrorStream() << "Failed to undo quantum operations required to calculate summand of dimension " << std::to_string(i) << "for unrolled index sum\n";
                         return false;
                     }
 
                     const std::size_t idxOfFirstRelevantOperation = *numOperationsAfterSynthesisOfSummandInUnrolledIndexSum - 1;
                     const std::size_t idxOfLastRelevantOperation  = *numOperationsPriorToSynthesisOfSummandInUnrolledIndexSum;
                     synthesisOk &= annotatableQuantumComputation.replayOperationsAtGivenIndexRange(idxOfFirstRelevantOperation, idxOfLastRelevantOperation);
+                    invalidateSharedSynthesisResultsOfExpressionsStoredInQubitsTargetedByQuantumOperations(idxOfLastRelevantOperation, idxOfFirstRelevantOperation);
                 }
 
-                if (numOperationsPriorToSynthesisOfExpr > 0 && numOperationsPriorToSynthesisOfExpr != numOperationsAfterSynthesisOfExpr) {
+                if (numOperationsPriorToSynthesisOfExpr > 0 && numOperationsPriorToSynthesisOfExpr != numOperationsAfterSynthesisOfExpr && numOperationsPriorToSynthesisOfExpr >= annotatableQuantumComputation.getNumForwardedQuantumOperations()) {
                     // After the summand generated for the current dimension is added to the unrolled index (and the operations for the summand assumed to be reset at this point) one can also undo the operations required to synthesize the user-defined expression
                     // for the current dimension to reset the used ancillary qubits back to their initial state using the same procedure as for the summand.
                     const std::size_t idxOfFirstRelevantOperation = numOperationsAfterSynthesisOfExpr - 1;
                     const std::size_t idxOfLastRelevantOperation  = numOperationsPriorToSynthesisOfExpr;
                     synthesisOk &= annotatableQuantumComputation.replayOperationsAtGivenIndexRange(idxOfFirstRelevantOperation, idxOfLastRelevantOperation);
+                    invalidateSharedSynthesisResultsOfExpressionsStoredInQubitsTargetedByQuantumOperations(idxOfLastRelevantOperation, idxOfFirstRelevantOperation);
                 }
             }
         }
         return synthesisOk;
     }
 
+    bool SyrecSynthesis::concatenateIndicesOfDimensionsToUnrolledIndex(const EvaluatedVariableAccess& evaluatedVariableAccess, std::vector<qc::Qubit>& containerToStoreUnrolledIndex) {
+        assert(containerToStoreUnrolledIndex.empty());
+
+        const Variable&        accessedVariable          = evaluatedVariableAccess.accessedVariable;
+        const Expression::vec& accessedIndexPerDimension = evaluatedVariableAccess.userDefinedDimensionAccess;
+        assert(accessedIndexPerDimension.size() == accessedVariable.dimensions.size());
+
+        // The qubits of the unrolled index are ordered from the least to the most significant bit, the index of the last dimension is thus prepended first.
+        for (std::size_t i = accessedVariable.dimensions.size(); i-- > 0;) {
+            const unsigned         numQubitsRequiredToStoreAnyIndexForCurrentDimension = determineNumberOfBitsRequiredToStoreValue(accessedVariable.dimensions.at(i) - 1U);
+            std::vector<qc::Qubit> qubitsStoringIndexOfDimension;
+            if (expressionCast<NumericExpression>(accessedIndexPerDimension.at(i).get()) != nullptr) {
+                const std::optional<unsigned> constantValueOfExprEvaluatedToCompileTime = evaluatedVariableAccess.evaluatedDimensionAccess.accessedValuePerDimension.at(i);
+                if (!constantValueOfExprEvaluatedToCompileTime.has_value() || !getConstantLines(numQubitsRequiredToStoreAnyIndexForCurrentDimension, *constantValueOfExprEvaluatedToCompileTime, qubitsStoringIndexOfDimension)) {
+                    return false;
+                }
+            } else {
+                const std::size_t      numOperationsPriorToSynthesisOfExpr = annotatableQuantumComputation.getNumQuantumOperations();
+                std::vector<qc::Qubit> qubitsStoringSynthesizedExprOfDimension;
+                if (!onExpression(accessedIndexPerDimension.at(i), numQubitsRequiredToStoreAnyIndexForCurrentDimension, qubitsStoringSynthesizedExprOfDimension, {}, BinaryExpression::BinaryOperation::Add)) {
+                    getErrorStream() << "Failed to synthesis index expression for dimension " << std::to_string(i) << " of dimension access for variable access on variable " << accessedVariable.name << "\n";
+                    return false;
+                }
+                if (qubitsStoringSynthesizedExprOfDimension.size() > numQubitsRequiredToStoreAnyIndexForCurrentDimension) {
+                    getErrorStream() << "Bitwidth of expression (" << std::to_string(qubitsStoringSynthesizedExprOfDimension.size()) << ") can be at most be as large as the number of qubits (" << std::to_string(numQubitsRequiredToStoreAnyIndexForCurrentDimension) << ") required to store the maximum index to an element in the " + std::to_string(i) + "-th dimension of the accessed variable " << accessedVariable.name << "\n";
+                    return false;
+                }
+
+                // The index is copied, instead of using the qubits storing the synthesized expression, since the latter could be the qubits of a variable modified while the unrolled index is used and are reset below.
+                const std::size_t numOperationsAfterSynthesisOfExpr = annotatableQuantumComputation.getNumQuantumOperations();
+                if (!getConstantLines(numQubitsRequiredToStoreAnyIndexForCurrentDimension, 0U, qubitsStoringIndexOfDimension) || !annotatableQuantumComputation.addOperationsImplementingCnotGates(qubitsStoringSynthesizedExprOfDimension, std::span(qubitsStoringIndexOfDimension).first(qubitsStoringSynthesizedExprOfDimension.size()))) {
+                    return false;
+                }
+
+                // See SyrecSynthesis::calculateSymbolicUnrolledIndexForElementInVariable(...), the ancillary qubits used to synthesize the expression are reset by replaying the synthesized quantum operations in reverse order.
+                if (numOperationsPriorToSynthesisOfExpr > 0 && numOperationsPriorToSynthesisOfExpr != numOperationsAfterSynthesisOfExpr && numOperationsPriorToSynthesisOfExpr >= annotatableQuantumComputation.getNumForwardedQuantumOperations()) {
+                    const std::size_t idxOfFirstRelevantOperation = numOperationsAfterSynthesisOfExpr - 1;
+                    const std::size_t idxOfLastRelevantOperation  = numOperationsPriorToSynthesisOfExpr;
+                    if (!annotatableQuantumComputation.replayOperationsAtGivenIndexRange(idxOfFirstRelevantOperation, idxOfLastRelevantOperation)) {
+                        return false;
+                    }
+                    invalidateSharedSynthesisResultsOfExpressionsStoredInQubitsTargetedByQuantumOperations(idxOfLastRelevantOperation, idxOfFirstRelevantOperation);
+                }
+            }
+            containerToStoreUnrolledIndex.insert(containerToStoreUnrolledIndex.end(), qubitsStoringIndexOfDimension.cbegin(), qubitsStoringIndexOfDimension.cend());
+        }
+        return true;
+    }
+
+    unsigned SyrecSynthesis::determineNumberOfQubitsOfUnrolledIndex(const Variable& variable) const {
+        if (!padDimensionsOfUnrolledIndicesToPowersOfTwo) {
+            return determineNumberOfBitsRequiredToStoreValue(determineNumberOfElementsInVariable(variable) - 1U);
+        }
+        return std::accumulate(variable.dimensions.cbegin(), variable.dimensions.cend(), 0U, [](const unsigned numQubits, const unsigned numValuesOfDimension) { return numQubits + determineNumberOfBitsRequiredToStoreValue(numValuesOfDimension - 1U); });
+    }
+
+    std::size_t SyrecSynthesis::determineUnrolledIndexOfElement(const Variable& variable, std::size_t indexOfElement) const {
+        if (!padDimensionsOfUnrolledIndicesToPowersOfTwo) {
+            return indexOfElement;
+        }
+
+        std::size_t unrolledIndex           = 0;
+        std::size_t numQubitsOfLowerIndices = 0;
+        for (std::size_t i = variable.dimensions.size(); i-- > 0;) {
+            unrolledIndex |= (indexOfElement % variable.dimensions.at(i)) << numQubitsOfLowerIndices;
+            indexOfElement /= variable.dimensions.at(i);
+            numQubitsOfLowerIndices += determineNumberOfBitsRequiredToStoreValue(variable.dimensions.at(i) - 1U);
+        }
+        return unrolledIndex;
+    }
+
+    std::optional<std::size_t> SyrecSynthesis::determineElementAtUnrolledIndex(const Variable& variable, std::size_t unrolledIndex) const {
+        if (!padDimensionsOfUnrolledIndicesToPowersOfTwo) {
+            return unrolledIndex < determineNumberOfElementsInVariable(variable) ? std::make_optional(unrolledIndex) : std::nullopt;
+        }
+
+        std::size_t indexOfElement         = 0;
+        std::size_t numElementsOfLowerDims = 1;
+        for (std::size_t i = variable.dimensions.size(); i-- > 0;) {
+            const unsigned    numQubitsOfIndex = determineNumberOfBitsRequiredToStoreValue(variable.dimensions.at(i) - 1U);
+            const std::size_t indexOfDimension = unrolledIndex & ((static_cast<std::size_t>(1U) << numQubitsOfIndex) - 1U);
+            // The padding elements of a dimension do not select any element of the variable.
+            if (indexOfDimension >= variable.dimensions.at(i)) {
+                return std::nullopt;
+            }
+            indexOfElement += indexOfDimension * numElementsOfLowerDims;
+            numElementsOfLowerDims *= variable.dimensions.at(i);
+            unrolledIndex >>= numQubitsOfIndex;
+        }
+        return unrolledIndex == 0U ? std::make_optional(indexOfElement) : std::nullopt;
+    }
+
     bool SyrecSynthesis::transferQubitsOfElementAtIndexInVariableToOtherQubits(const EvaluatedVariableAccess& evaluatedVariableAccess, const std::vector<qc::Qubit>& qubitsStoringUnrolledIndexOfElementToSelect, const std::vector<qc::Qubit>& qubitsStoringResultOfTransferOperation, const QubitTransferOperation qubitTransferOperation) {
         if (qubitTransferOperation != QubitTransferOperation::SwapQubits && qubitTransferOperation != QubitTransferOperation::CopyValue) {
-            std::cerr << "Invalid qubit transfer operation defined\n";
+            getErrorStream() << "Invalid qubit transfer operation defined\n";
             return false;
         }
 
@@ -1968,13 +3916,27 @@ namespace syrec {
         const unsigned                 offsetToFirstQubitOfAccessedVariable = evaluatedVariableAccess.offsetToFirstQubitOfVariable;
 
         if (const std::size_t numQubitsAccessedByBitrange = evaluatedBitrangeAccess.getIndicesOfAccessedBits().size(); numQubitsAccessedByBitrange != qubitsStoringResultOfTransferOperation.size()) {
-            std::cerr << "Tried to perform a conditional swap of the " << std::to_string(numQubitsAccessedByBitrange) << " qubits of the accessed bitrange with the provided " << std::to_string(qubitsStoringResultOfTransferOperation.size()) << " qubits\n";
+            getErrorStream() << "Tried to perform a conditional swap of the " << std::to_string(numQubitsAccessedByBitrange) << " qubits of the accessed bitrange with the provided " << std::to_string(qubitsStoringResultOfTransferOperation.size()) << " qubits\n";
             return false;
         }
 
         bool              synthesisOk                                                 = true;
         const std::size_t numElementsInAccessedVariable                               = determineNumberOfElementsInVariable(accessedVariable);
-        const unsigned    numQubitsRequiredToStoreIndexToAnyElementInAccessedVariable = determineNumberOfBitsRequiredToStoreValue(static_cast<unsigned>(numElementsInAccessedVariable - 1U));
+        const unsigned    numQubitsRequiredToStoreIndexToAnyElementInAccessedVariable = determineNumberOfQubitsOfUnrolledIndex(accessedVariable);
+
+        if (shareIndexDecodingsInCurrentStatement) {
+            return transferQubitsOfElementUsingSharedIndexDecoding(evaluatedVariableAccess, qubitsStoringUnrolledIndexOfElementToSelect, qubitsStoringResultOfTransferOperation, qubitTransferOperation);
+        }
+
+        if (decodeNonConstantIndicesUsingUnaryIteration) {
+            if (qubitsStoringUnrolledIndexOfElementToSelect.size() != numQubitsRequiredToStoreIndexToAnyElementInAccessedVariable) {
+                getErrorStream() << "Expected the unrolled index of the accessed element to be stored in " << std::to_string(numQubitsRequiredToStoreIndexToAnyElementInAccessedVariable) << " qubits but " << std::to_string(qubitsStoringUnrolledIndexOfElementToSelect.size()) << " qubits were provided\n";
+                return false;
+            }
+            // One ancillary qubit per level of the unary iteration tree stores whether the currently visited node at said level is on the path selected by the unrolled index, with every qubit being reset after all nodes of its level were visited.
+            std::vector<qc::Qubit> ancillaryQubitsStoringActivationOfNodePerLevel;
+            return getConstantLines(numQubitsRequiredToStoreIndexToAnyElementInAccessedVariable, 0U, ancillaryQubitsStoringActivationOfNodePerLevel) && transferQubitsOfElementsInSubtreeOfUnaryIterationTree(evaluatedVariableAccess, qubitsStoringUnrolledIndexOfElementToSelect, ancillaryQubitsStoringActivationOfNodePerLevel, qubitsStoringResultOfTransferOperation, qubitTransferOperation, 0, 0, std::nullopt);
+        }
 
         std::vector<qc::Qubit> ancillaryQubitsStoringCurrentIndex;
         synthesisOk &= getConstantLines(numQubitsRequiredToStoreIndexToAnyElementInAccessedVariable, 0U, ancillaryQubitsStoringCurrentIndex);
@@ -1994,25 +3956,168 @@ namespace syrec {
             for (const qc::Control controlQubit: controlQubitsFromCompareOperation) {
                 synthesisOk &= annotatableQuantumComputation.registerControlQubitForPropagationInCurrentAndNestedScopes(controlQubit.qubit);
             }
+            synthesisOk &= transferAccessedQubitsOfElement(qubitOffsetToCurrentElementInAccessedVariable, relativeQubitOffsetForAccessedQubitsInElement, qubitsStoringResultOfTransferOperation, qubitTransferOperation);
+            qubitOffsetToCurrentElementInAccessedVariable += accessedVariable.bitwidth;
+            annotatableQuantumComputation.deactivateControlQubitPropagationScope();
 
-            for (std::size_t j = 0; j < relativeQubitOffsetForAccessedQubitsInElement.size() && synthesisOk; ++j) {
-                const qc::Qubit currAccessedQubitOfVariable = qubitOffsetToCurrentElementInAccessedVariable + relativeQubitOffsetForAccessedQubitsInElement.at(j);
+            // We reset the qubits originally storing the value of the accessed element in the variable by first reverting the operations used to compare the unrolled index to the index of the accessed element and then incrementing it
+            // to advance the index to the next element.
+            synthesisOk &= checkIfQubitsMatchAndStoreResultInRhsOperandQubits(annotatableQuantumComputation, qubitsStoringUnrolledIndexOfElementToSelect, ancillaryQubitsStoringCurrentIndex, true);
+            if (padDimensionsOfUnrolledIndicesToPowersOfTwo) {
+                // The unrolled indices of consecutive elements are not consecutive if the dimensions are padded, the bits differing from the unrolled index of the next element are toggled instead with the index being zeroed after the last element.
+                const std::size_t bitsDifferingFromNextUnrolledIndex = determineUnrolledIndexOfElement(accessedVariable, i) ^ (i + 1U < numElementsInAccessedVariable ? determineUnrolledIndexOfElement(accessedVariable, i + 1U) : 0U);
+                for (std::size_t j = 0; j < ancillaryQubitsStoringCurrentIndex.size() && synthesisOk; ++j) {
+                    if (((bitsDifferingFromNextUnrolledIndex >> j) & 1U) != 0U) {
+                        synthesisOk = annotatableQuantumComputation.addOperationsImplementingNotGate(ancillaryQubitsStoringCurrentIndex.at(j));
+                    }
+                }
+            } else {
+                synthesisOk &= increment(annotatableQuantumComputation, ancillaryQubitsStoringCurrentIndex);
+            }
+        }
+        // Clear the ancillary qubits storing the current index of the accessed element in the variable back to their initial state (i.e. zero them).
+        if (!padDimensionsOfUnrolledIndicesToPowersOfTwo) {
+            synthesisOk &= clearIntegerValueFromAncillaryQubits(annotatableQuantumComputation, ancillaryQubitsStoringCurrentIndex, static_cast<unsigned>(numElementsInAccessedVariable));
+        }
+        return synthesisOk;
+    }
 
-                if (qubitTransferOperation == QubitTransferOperation::SwapQubits) {
-                    synthesisOk &= annotatableQuantumComputation.addOperationsImplementingFredkinGate(currAccessedQubitOfVariable, qubitsStoringResultOfTransferOperation.at(j));
-                } else {
-                    synthesisOk &= annotatableQuantumComputation.addOperationsImplementingCnotGate(currAccessedQubitOfVariable, qubitsStoringResultOfTransferOperation.at(j));
+    const SyrecSynthesis::SharedIndexDecoding* SyrecSynthesis::findIndexDecodingSharedInCurrentStatement(const EvaluatedVariableAccess& evaluatedVariableAccess) const {
+        if (!shareIndexDecodingsInCurrentStatement) {
+            return nullptr;
+        }
+
+        const Variable&        accessedVariable          = evaluatedVariableAccess.accessedVariable;
+        const Expression::vec& accessedIndexPerDimension = evaluatedVariableAccess.userDefinedDimensionAccess;
+        const auto             matchingIndexDecoding     = std::ranges::find_if(indexDecodingsSharedInCurrentStatement, [&](const SharedIndexDecoding& sharedIndexDecoding) {
+            return sharedIndexDecoding.dimensionsOfAccessedVariable == accessedVariable.dimensions && sharedIndexDecoding.propagatedControlQubits == annotatableQuantumComputation.getPropagatedControlQubits() &&
+                   std::ranges::equal(sharedIndexDecoding.accessedIndexPerDimension, accessedIndexPerDimension, [&](const Expression::ptr& lAccessedIndex, const Expression::ptr& rAccessedIndex) {
+                       return lAccessedIndex != nullptr && rAccessedIndex != nullptr && ExpressionSynthesisCache::areExpressionsStructurallyIdentical(*lAccessedIndex, *rAccessedIndex, loopMap);
+                   });
+        });
+        return matchingIndexDecoding != indexDecodingsSharedInCurrentStatement.cend() ? &*matchingIndexDecoding : nullptr;
+    }
+
+    bool SyrecSynthesis::transferQubitsOfElementUsingSharedIndexDecoding(const EvaluatedVariableAccess& evaluatedVariableAccess, const std::vector<qc::Qubit>& qubitsStoringUnrolledIndexOfElementToSelect, const std::vector<qc::Qubit>& qubitsStoringResultOfTransferOperation, const QubitTransferOperation qubitTransferOperation) {
+        const Variable&   accessedVariable              = evaluatedVariableAccess.accessedVariable;
+        const std::size_t numElementsInAccessedVariable = determineNumberOfElementsInVariable(accessedVariable);
+
+        const SharedIndexDecoding* sharedIndexDecoding = nullptr;
+        if (const auto matchingIndexDecoding = std::ranges::find_if(indexDecodingsSharedInCurrentStatement, [&](const SharedIndexDecoding& recordedIndexDecoding) { return recordedIndexDecoding.qubitsStoringUnrolledIndex == qubitsStoringUnrolledIndexOfElementToSelect; });
+            matchingIndexDecoding != indexDecodingsSharedInCurrentStatement.cend()) {
+            sharedIndexDecoding = &*matchingIndexDecoding;
+        } else {
+            // Every element of the accessed variable is assigned a qubit that is only set if the unrolled index matches the index of the element, which is checked by a single multi-controlled X gate whose control qubits
+            // are the qubits of the unrolled index with the polarity of a control qubit being determined by the value of the corresponding bit of the index of the element.
+            std::vector<qc::Qubit> qubitsStoringOneHotIndex;
+            if (!getConstantLines(static_cast<unsigned>(numElementsInAccessedVariable), 0U, qubitsStoringOneHotIndex)) {
+                return false;
+            }
+
+            const std::size_t indexOfFirstDecodingOperation = annotatableQuantumComputation.getNumQuantumOperations();
+            bool              synthesisOk                   = true;
+            for (std::size_t i = 0; i < numElementsInAccessedVariable && synthesisOk; ++i) {
+                const std::size_t unrolledIndexOfElement = determineUnrolledIndexOfElement(accessedVariable, i);
+                qc::Controls      controlQubitsMatchingIndexOfElement;
+                for (std::size_t j = 0; j < qubitsStoringUnrolledIndexOfElementToSelect.size(); ++j) {
+                    controlQubitsMatchingIndexOfElement.emplace(qubitsStoringUnrolledIndexOfElementToSelect.at(j), ((unrolledIndexOfElement >> j) & 1U) != 0U ? qc::Control::Type::Pos : qc::Control::Type::Neg);
                 }
+                synthesisOk = controlQubitsMatchingIndexOfElement.empty() ? annotatableQuantumComputation.addOperationsImplementingNotGate(qubitsStoringOneHotIndex.at(i)) : annotatableQuantumComputation.addOperationsImplementingMultiControlToffoliGate(controlQubitsMatchingIndexOfElement, qubitsStoringOneHotIndex.at(i));
+            }
+            if (!synthesisOk) {
+                return false;
             }
+
+            indexDecodingsSharedInCurrentStatement.emplace_back(SharedIndexDecoding{.dimensionsOfAccessedVariable = accessedVariable.dimensions, .accessedIndexPerDimension = evaluatedVariableAccess.userDefinedDimensionAccess, .propagatedControlQubits = annotatableQuantumComputation.getPropagatedControlQubits(), .qubitsStoringUnrolledIndex = qubitsStoringUnrolledIndexOfElementToSelect, .qubitsStoringOneHotIndex = std::move(qubitsStoringOneHotIndex), .indexOfFirstDecodingOperation = indexOfFirstDecodingOperation, .indexOfLastDecodingOperation = annotatableQuantumComputation.getNumQuantumOperations() - 1U});
+            sharedIndexDecoding = &indexDecodingsSharedInCurrentStatement.back();
+        }
+
+        if (sharedIndexDecoding->qubitsStoringOneHotIndex.size() != numElementsInAccessedVariable) {
+            getErrorStream() << "Expected the shared decoding of the unrolled index to consist of " << std::to_string(numElementsInAccessedVariable) << " qubits but " << std::to_string(sharedIndexDecoding->qubitsStoringOneHotIndex.size()) << " qubits were recorded\n";
+            return false;
+        }
+
+        // The qubits are copied since the transfer of an element could invalidate the recorded decodings.
+        const std::vector<qc::Qubit> qubitsStoringOneHotIndex                      = sharedIndexDecoding->qubitsStoringOneHotIndex;
+        const std::vector<qc::Qubit> relativeQubitOffsetForAccessedQubitsInElement = evaluatedVariableAccess.evaluatedBitrangeAccess.getIndicesOfAccessedBits();
+        qc::Qubit                    qubitOffsetToCurrentElementInAccessedVariable = evaluatedVariableAccess.offsetToFirstQubitOfVariable;
+        bool                         synthesisOk                                   = true;
+        for (std::size_t i = 0; i < numElementsInAccessedVariable && synthesisOk; ++i) {
+            annotatableQuantumComputation.activateControlQubitPropagationScope();
+            synthesisOk = annotatableQuantumComputation.registerControlQubitForPropagationInCurrentAndNestedScopes(qubitsStoringOneHotIndex.at(i)) && transferAccessedQubitsOfElement(qubitOffsetToCurrentElementInAccessedVariable, relativeQubitOffsetForAccessedQubitsInElement, qubitsStoringResultOfTransferOperation, qubitTransferOperation);
+            annotatableQuantumComputation.deactivateControlQubitPropagationScope();
             qubitOffsetToCurrentElementInAccessedVariable += accessedVariable.bitwidth;
+        }
+        return synthesisOk;
+    }
+
+    bool SyrecSynthesis::resetIndexDecodingsSharedInCurrentStatement() {
+        const bool canIndexDecodingsBeReset = ancillaryQubitPool == nullptr || ancillaryQubitUncomputationStrategy == AncillaryQubitUncomputationStrategy::Eager;
+        bool       synthesisOk              = true;
+        for (auto sharedIndexDecoding = indexDecodingsSharedInCurrentStatement.crbegin(); canIndexDecodingsBeReset && sharedIndexDecoding != indexDecodingsSharedInCurrentStatement.crend() && synthesisOk; ++sharedIndexDecoding) {
+            // The reset is skipped if the quantum operations to replay were already forwarded to a quantum operation sink.
+            if (sharedIndexDecoding->indexOfFirstDecodingOperation >= annotatableQuantumComputation.getNumForwardedQuantumOperations()) {
+                synthesisOk = annotatableQuantumComputation.replayOperationsAtGivenIndexRange(sharedIndexDecoding->indexOfLastDecodingOperation, sharedIndexDecoding->indexOfFirstDecodingOperation);
+            }
+        }
+        indexDecodingsSharedInCurrentStatement.clear();
+        return synthesisOk;
+    }
+
+    bool SyrecSynthesis::transferQubitsOfElementsInSubtreeOfUnaryIterationTree(const EvaluatedVariableAccess& evaluatedVariableAccess, const std::vector<qc::Qubit>& qubitsStoringUnrolledIndexOfElementToSelect, const std::vector<qc::Qubit>& ancillaryQubitsStoringActivationOfNodePerLevel, const std::vector<qc::Qubit>& qubitsStoringResultOfTransferOperation, const QubitTransferOperation qubitTransferOperation, const std::size_t level, const std::size_t indexOfFirstElementInSubtree, const std::optional<qc::Qubit> qubitStoringActivationOfNode) {
+        const Variable&   accessedVariable = evaluatedVariableAccess.accessedVariable;
+        const std::size_t numLevels        = ancillaryQubitsStoringActivationOfNodePerLevel.size();
+        if (level == numLevels) {
+            // The activation qubit of a leaf was set only if the unrolled index matches the index of its element.
+            if (!qubitStoringActivationOfNode.has_value()) {
+                getErrorStream() << "Leaf of unary iteration tree for element at index " << std::to_string(indexOfFirstElementInSubtree) << " had no activation qubit\n";
+                return false;
+            }
+            // The leaf of a padding element of the variable does not select any element.
+            const std::optional<std::size_t> selectedElement = determineElementAtUnrolledIndex(accessedVariable, indexOfFirstElementInSubtree);
+            if (!selectedElement.has_value()) {
+                return true;
+            }
+            annotatableQuantumComputation.activateControlQubitPropagationScope();
+            const auto qubitOffsetToElement = static_cast<qc::Qubit>(evaluatedVariableAccess.offsetToFirstQubitOfVariable + (*selectedElement * accessedVariable.bitwidth));
+            const bool synthesisOk          = annotatableQuantumComputation.registerControlQubitForPropagationInCurrentAndNestedScopes(*qubitStoringActivationOfNode) && transferAccessedQubitsOfElement(qubitOffsetToElement, evaluatedVariableAccess.evaluatedBitrangeAccess.getIndicesOfAccessedBits(), qubitsStoringResultOfTransferOperation, qubitTransferOperation);
             annotatableQuantumComputation.deactivateControlQubitPropagationScope();
+            return synthesisOk;
+        }
 
-            // We reset the qubits originally storing the value of the accessed element in the variable by first reverting the operations used to compare the unrolled index to the index of the accessed element and then incrementing it
-            // to advance the index to the next element.
-            synthesisOk &= checkIfQubitsMatchAndStoreResultInRhsOperandQubits(annotatableQuantumComputation, qubitsStoringUnrolledIndexOfElementToSelect, ancillaryQubitsStoringCurrentIndex, true) && increment(annotatableQuantumComputation, ancillaryQubitsStoringCurrentIndex);
+        // The children of a node split the elements of its subtree based on the value of the index bit for its level, starting with the most significant bit at the root. The activation qubit of the left child (index bit is zero) is
+        // computed as 'p & !b' with 'p' being the activation qubit of the node ('p' is omitted at the root), toggling it by 'p' afterwards leads to the activation of the right child ('p & b') which is in turn reset by a Toffoli gate.
+        const qc::Qubit   indexBit                      = qubitsStoringUnrolledIndexOfElementToSelect.at(numLevels - 1U - level);
+        const qc::Qubit   qubitStoringActivationOfChild = ancillaryQubitsStoringActivationOfNodePerLevel.at(level);
+        const std::size_t numElementsInSubtreeOfChild   = static_cast<std::size_t>(1U) << (numLevels - 1U - level);
+        const auto        toggleActivationOfChild       = [&]() {
+            return qubitStoringActivationOfNode.has_value() ? annotatableQuantumComputation.addOperationsImplementingCnotGate(*qubitStoringActivationOfNode, qubitStoringActivationOfChild) : annotatableQuantumComputation.addOperationsImplementingNotGate(qubitStoringActivationOfChild);
+        };
+        const auto toggleActivationOfChildByIndexBit = [&]() {
+            return qubitStoringActivationOfNode.has_value() ? annotatableQuantumComputation.addOperationsImplementingToffoliGate(*qubitStoringActivationOfNode, indexBit, qubitStoringActivationOfChild) : annotatableQuantumComputation.addOperationsImplementingCnotGate(indexBit, qubitStoringActivationOfChild);
+        };
+
+        bool synthesisOk = toggleActivationOfChildByIndexBit() && toggleActivationOfChild() && transferQubitsOfElementsInSubtreeOfUnaryIterationTree(evaluatedVariableAccess, qubitsStoringUnrolledIndexOfElementToSelect, ancillaryQubitsStoringActivationOfNodePerLevel, qubitsStoringResultOfTransferOperation, qubitTransferOperation, level + 1U, indexOfFirstElementInSubtree, qubitStoringActivationOfChild);
+        // The right subtree is pruned if it does not contain any element of the variable.
+        if (const std::size_t indexOfFirstElementInRightSubtree = indexOfFirstElementInSubtree + numElementsInSubtreeOfChild; indexOfFirstElementInRightSubtree <= determineUnrolledIndexOfElement(accessedVariable, determineNumberOfElementsInVariable(accessedVariable) - 1U)) {
+            synthesisOk = synthesisOk && toggleActivationOfChild() && transferQubitsOfElementsInSubtreeOfUnaryIterationTree(evaluatedVariableAccess, qubitsStoringUnrolledIndexOfElementToSelect, ancillaryQubitsStoringActivationOfNodePerLevel, qubitsStoringResultOfTransferOperation, qubitTransferOperation, level + 1U, indexOfFirstElementInRightSubtree, qubitStoringActivationOfChild) && toggleActivationOfChildByIndexBit();
+        } else {
+            synthesisOk = synthesisOk && toggleActivationOfChild() && toggleActivationOfChildByIndexBit();
+        }
+        return synthesisOk;
+    }
+
+    bool SyrecSynthesis::transferAccessedQubitsOfElement(const qc::Qubit qubitOffsetToElement, const std::vector<qc::Qubit>& relativeQubitOffsetForAccessedQubitsInElement, const std::vector<qc::Qubit>& qubitsStoringResultOfTransferOperation, const QubitTransferOperation qubitTransferOperation) {
+        bool synthesisOk = true;
+        for (std::size_t j = 0; j < relativeQubitOffsetForAccessedQubitsInElement.size() && synthesisOk; ++j) {
+            const qc::Qubit currAccessedQubitOfVariable = qubitOffsetToElement + relativeQubitOffsetForAccessedQubitsInElement.at(j);
+
+            if (qubitTransferOperation == QubitTransferOperation::SwapQubits) {
+                synthesisOk &= annotatableQuantumComputation.addOperationsImplementingFredkinGate(currAccessedQubitOfVariable, qubitsStoringResultOfTransferOperation.at(j));
+            } else {
+                synthesisOk &= annotatableQuantumComputation.addOperationsImplementingCnotGate(currAccessedQubitOfVariable, qubitsStoringResultOfTransferOperation.at(j));
+            }
         }
-        // Clear the ancillary qubits storing the current index of the accessed element in the variable back to their initial state (i.e. zero them).
-        synthesisOk &= clearIntegerValueFromAncillaryQubits(annotatableQuantumComputation, ancillaryQubitsStoringCurrentIndex, static_cast<unsigned>(numElementsInAccessedVariable));
         return synthesisOk;
     }
 
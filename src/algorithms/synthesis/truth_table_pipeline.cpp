@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/truth_table_pipeline.hpp"
+
+#include "core/hash_combine.hpp"
+#include "core/truthTable/truth_table.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace syrec {
+    namespace {
+        constexpr std::size_t MAX_PACKED_BITWIDTH = 64U;
+
+        // the i-th position of a cube is stored in the bit i of its words while it is stored in the bit (bitwidth - 1 - i) of a packed cube
+        auto reverseBits(std::uint64_t word, const std::size_t bitwidth) -> std::uint64_t {
+            if (bitwidth == 0U) {
+                return 0U;
+            }
+            word = ((word >> 1U) & 0x5555555555555555ULL) | ((word & 0x5555555555555555ULL) << 1U);
+            word = ((word >> 2U) & 0x3333333333333333ULL) | ((word & 0x3333333333333333ULL) << 2U);
+            word = ((word >> 4U) & 0x0F0F0F0F0F0F0F0FULL) | ((word & 0x0F0F0F0F0F0F0F0FULL) << 4U);
+            word = ((word >> 8U) & 0x00FF00FF00FF00FFULL) | ((word & 0x00FF00FF00FF00FFULL) << 8U);
+            word = ((word >> 16U) & 0x0000FFFF0000FFFFULL) | ((word & 0x0000FFFF0000FFFFULL) << 16U);
+            word = (word >> 32U) | (word << 32U);
+            return word >> (MAX_PACKED_BITWIDTH - bitwidth);
+        }
+
+        auto unpackCube(const std::uint64_t values, const std::uint64_t dontCares, const std::size_t bitwidth) -> TruthTable::Cube {
+            auto cube = TruthTable::Cube::fromInteger(values, bitwidth);
+            for (auto remainingDontCares = dontCares; remainingDontCares != 0U; remainingDontCares &= remainingDontCares - 1U) {
+                cube[bitwidth - 1U - static_cast<std::size_t>(std::countr_zero(remainingDontCares))] = std::nullopt;
+            }
+            return cube;
+        }
+    } // namespace
+
+    auto TruthTablePipeline::PackedCubeHash::operator()(const PackedCube& cube) const noexcept -> std::size_t {
+        std::size_t hashValue = std::hash<std::uint64_t>()(cube.values);
+        hashCombine(hashValue, cube.dontCares);
+        return hashValue;
+    }
+
+    auto PackedTruthTable::toTruthTable() const -> TruthTable {
+        TruthTable tt{};
+        tt.getConstants() = constants;
+        tt.getGarbage()   = garbage;
+        for (const auto& entry: entries) {
+            tt.try_emplace(TruthTable::Cube::fromInteger(entry.input, nInputs), unpackCube(entry.outputValues, entry.outputDontCares, nOutputs));
+        }
+        tt.useDenseStorageIfComplete();
+        return tt;
+    }
+
+    auto TruthTablePipeline::completeDontCares() -> TruthTablePipeline& {
+        isDontCareCompletionEnabled = true;
+        return *this;
+    }
+
+    auto TruthTablePipeline::substituteOutputs(const TruthTable::CubeMap& codewords) -> TruthTablePipeline& {
+        Step step{};
+        step.kind = Step::Kind::Substitution;
+        if (!codewords.empty()) {
+            step.nOutputsOfCodewords = codewords.begin()->first.size();
+            step.nBitsOfCodewords    = codewords.begin()->second.size();
+        }
+        step.isPackable = step.nOutputsOfCodewords <= MAX_PACKED_BITWIDTH && step.nBitsOfCodewords <= MAX_PACKED_BITWIDTH;
+        for (const auto& [output, codeword]: codewords) {
+            if (!step.isPackable || output.size() != step.nOutputsOfCodewords || codeword.size() != step.nBitsOfCodewords) {
+                step.isPackable = false;
+                break;
+            }
+            step.codewords.emplace(PackedCube{.values = reverseBits(output.getValueWord(0U), output.size()), .dontCares = reverseBits(output.getDontCareWord(0U), output.size())},
+                                   PackedCube{.values = reverseBits(codeword.getValueWord(0U), codeword.size()), .dontCares = reverseBits(codeword.getDontCareWord(0U), codeword.size())});
+        }
+        steps.emplace_back(std::move(step));
+        return *this;
+    }
+
+    auto TruthTablePipeline::augmentWithConstants(const std::size_t nBits, const bool appendZero) -> TruthTablePipeline& {
+        Step step{};
+        step.kind       = Step::Kind::Augmentation;
+        step.nBits      = nBits;
+        step.appendZero = appendZero;
+        steps.emplace_back(std::move(step));
+        return *this;
+    }
+
+    auto TruthTablePipeline::apply(const TruthTable& tt) const -> std::optional<PackedTruthTable> {
+        PackedTruthTable packedTt{};
+        packedTt.nInputs   = tt.nInputs();
+        packedTt.nOutputs  = tt.nOutputs();
+        packedTt.constants = tt.getConstants();
+        packedTt.garbage   = tt.getGarbage();
+        if (packedTt.nInputs > MAX_PACKED_BITWIDTH || packedTt.nOutputs > MAX_PACKED_BITWIDTH || (isDontCareCompletionEnabled && packedTt.nInputs >= MAX_PACKED_BITWIDTH)) {
+            return std::nullopt;
+        }
+        const auto nInputsOfTt  = packedTt.nInputs;
+        const auto nOutputsOfTt = packedTt.nOutputs;
+
+        // the bitwidths as well as the constant and garbage lines are determined once per transformation, thus only the packed cubes of the entries are transformed per entry.
+        struct TransformationOfEntry {
+            const Step* step        = nullptr;
+            std::size_t inputShift  = 0U;
+            std::size_t outputShift = 0U;
+        };
+        std::vector<TransformationOfEntry> transformations;
+        transformations.reserve(steps.size());
+        for (const auto& step: steps) {
+            TransformationOfEntry transformation{.step = &step};
+            if (step.kind == Step::Kind::Substitution) {
+                if (!step.isPackable || (!tt.empty() && step.nOutputsOfCodewords != packedTt.nOutputs)) {
+                    return std::nullopt;
+                }
+                packedTt.nOutputs = step.nBitsOfCodewords;
+                transformations.emplace_back(transformation);
+                continue;
+            }
+
+            if (step.nBits > MAX_PACKED_BITWIDTH || step.nBits < packedTt.nOutputs) {
+                return std::nullopt;
+            }
+            const auto requiredOutConstants = step.nBits - packedTt.nOutputs;
+            const auto requiredInConstants  = step.nBits > packedTt.nInputs ? step.nBits - packedTt.nInputs : 0U;
+            if (!tt.empty()) {
+                // the constants are prepended (i.e. stored in the most significant positions) unless they are appended, with the garbage and constant lines being updated accordingly.
+                if (requiredOutConstants > 0U && packedTt.garbage.size() != step.nBits) {
+                    if (step.appendZero) {
+                        packedTt.garbage.insert(packedTt.garbage.begin(), requiredOutConstants, true);
+                    } else {
+                        packedTt.garbage.resize(step.nBits);
+                    }
+                }
+                if (requiredInConstants > 0U && packedTt.constants.size() != step.nBits) {
+                    if (step.appendZero) {
+                        packedTt.constants.insert(packedTt.constants.begin(), requiredInConstants, true);
+                    } else {
+                        packedTt.constants.insert(packedTt.constants.end(), requiredInConstants, true);
+                    }
+                }
+            }
+            if (step.appendZero) {
+                transformation.outputShift = requiredOutConstants;
+                transformation.inputShift  = requiredInConstants;
+            }
+            packedTt.nOutputs = step.nBits;
+            packedTt.nInputs  = std::max(packedTt.nInputs, step.nBits);
+            transformations.emplace_back(transformation);
+        }
+
+        bool       isEveryEntryTransformable = true;
+        const auto emitEntry                 = [&](PackedTruthTableEntry entry) {
+            for (const auto& [step, inputShift, outputShift]: transformations) {
+                if (step->kind == Step::Kind::Substitution) {
+                    const auto codeword = step->codewords.find(PackedCube{.values = entry.outputValues, .dontCares = entry.outputDontCares});
+                    if (codeword == step->codewords.end()) {
+                        isEveryEntryTransformable = false;
+                        return;
+                    }
+                    entry.outputValues    = codeword->second.values;
+                    entry.outputDontCares = codeword->second.dontCares;
+                    continue;
+                }
+                entry.input <<= inputShift;
+                entry.outputValues <<= outputShift;
+                entry.outputDontCares <<= outputShift;
+            }
+            packedTt.entries.emplace_back(entry);
+        };
+
+        if (!isDontCareCompletionEnabled) {
+            packedTt.entries.reserve(tt.size());
+            for (const auto& [input, output]: tt) {
+                if (!input.hasNoDontCares()) {
+                    return std::nullopt;
+                }
+                emitEntry(PackedTruthTableEntry{.input = reverseBits(input.getValueWord(0U), nInputsOfTt), .outputValues = reverseBits(output.getValueWord(0U), nOutputsOfTt), .outputDontCares = reverseBits(output.getDontCareWord(0U), nOutputsOfTt)});
+                if (!isEveryEntryTransformable) {
+                    return std::nullopt;
+                }
+            }
+            return packedTt;
+        }
+
+        // every input containing don't cares is replaced by all its completions with the entries of earlier inputs taking precedence over the ones of later inputs,
+        // except for a completely specified input whose output is combined with the one of the earlier completion of the same input (as done by extend(...)).
+        struct CompletedEntry {
+            PackedTruthTableEntry entry;
+            bool                  isCompletelySpecified = false;
+        };
+        std::vector<CompletedEntry> completedEntries;
+        completedEntries.reserve(tt.size());
+        for (const auto& [input, output]: tt) {
+            const auto inputValues     = reverseBits(input.getValueWord(0U), nInputsOfTt);
+            const auto inputDontCares  = reverseBits(input.getDontCareWord(0U), nInputsOfTt);
+            const auto outputValues    = reverseBits(output.getValueWord(0U), nOutputsOfTt);
+            const auto outputDontCares = reverseBits(output.getDontCareWord(0U), nOutputsOfTt);
+            // enumerate all subsets of the don't care positions of the input
+            for (std::uint64_t dontCareAssignment = 0U;; dontCareAssignment = (dontCareAssignment - inputDontCares) & inputDontCares) {
+                completedEntries.push_back({.entry = {.input = inputValues | dontCareAssignment, .outputValues = outputValues, .outputDontCares = outputDontCares}, .isCompletelySpecified = inputDontCares == 0U});
+                if (dontCareAssignment == inputDontCares) {
+                    break;
+                }
+            }
+        }
+        std::ranges::stable_sort(completedEntries, [](const CompletedEntry& lhs, const CompletedEntry& rhs) { return lhs.entry.input < rhs.entry.input; });
+
+        const std::uint64_t nCompletedInputs = static_cast<std::uint64_t>(1U) << nInputsOfTt;
+        packedTt.entries.reserve(static_cast<std::size_t>(nCompletedInputs));
+        std::uint64_t nextInput = 0U;
+        for (std::size_t i = 0U; i < completedEntries.size();) {
+            auto entry = completedEntries[i].entry;
+            for (++i; i < completedEntries.size() && completedEntries[i].entry.input == entry.input; ++i) {
+                if (completedEntries[i].isCompletelySpecified) {
+                    // clubbing the 1's of the new output with the old one
+                    entry.outputValues |= completedEntries[i].entry.outputValues & ~completedEntries[i].entry.outputDontCares & ~entry.outputDontCares;
+                }
+            }
+
+            // fill in all the missing inputs
+            for (; nextInput < entry.input; ++nextInput) {
+                emitEntry(PackedTruthTableEntry{.input = nextInput});
+            }
+            emitEntry(entry);
+            nextInput = entry.input + 1U;
+            if (!isEveryEntryTransformable) {
+                return std::nullopt;
+            }
+        }
+        // fill in the remaining missing inputs (if any)
+        for (; nextInput < nCompletedInputs; ++nextInput) {
+            emitEntry(PackedTruthTableEntry{.input = nextInput});
+        }
+        if (!isEveryEntryTransformable) {
+            return std::nullopt;
+        }
+        return packedTt;
+    }
+
+} // namespace syrec
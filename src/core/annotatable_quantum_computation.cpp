@@ -10,29 +10,53 @@
 
 #include "core/annotatable_quantum_computation.hpp"
 
+#include "core/frozen_quantum_computation.hpp"
+#include "core/hash_combine.hpp"
 #include "core/qubit_inlining_stack.hpp"
 #include "ir/Definitions.hpp"
+#include "ir/Permutation.hpp"
 #include "ir/QuantumComputation.hpp"
+#include "ir/operations/CompoundOperation.hpp"
 #include "ir/operations/Control.hpp"
 #include "ir/operations/OpType.hpp"
 #include "ir/operations/Operation.hpp"
+#include "ir/operations/StandardOperation.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <charconv>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <iterator>
+#include <map>
 #include <memory>
 #include <numeric>
 #include <optional>
 #include <ranges>
+#include <span>
 #include <string>
 #include <string_view>
+#include <system_error>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
 namespace {
+    /**
+     * Parse the value of a statement line number annotation.
+     * @param value The value of the annotation.
+     * @return The statement line number if the whole value was an unsigned integer, otherwise std::nullopt.
+     */
+    [[nodiscard]] std::optional<unsigned> tryParseStatementLineNumber(const std::string_view& value) {
+        unsigned   statementLineNumber = 0;
+        const auto parseResult         = std::from_chars(value.data(), value.data() + value.size(), statementLineNumber);
+        return !value.empty() && parseResult.ec == std::errc() && parseResult.ptr == value.data() + value.size() ? std::make_optional(statementLineNumber) : std::nullopt;
+    }
+
     /**
      * Find the index of the first qubit index range in the sorted collection that contains the given qubit.
      * @tparam ForwardIterator Template type parameter defining the type of elements in the searched through collection.
@@ -65,13 +89,8 @@ namespace {
     }
 
     bool isDataOfInlineStackOk(const syrec::QubitInliningStack::ptr& inlineStackToCheck) {
-        const std::size_t numElementsToCheck   = inlineStackToCheck != nullptr ? inlineStackToCheck->size() : 0;
-        bool              allStackEntriesValid = numElementsToCheck > 0;
-        for (std::size_t i = 0; i < numElementsToCheck && allStackEntriesValid; ++i) {
-            const syrec::QubitInliningStack::QubitInliningStackEntry* inlineStackEntryAtIdx = inlineStackToCheck->getStackEntryAt(i);
-            allStackEntriesValid                                                            = inlineStackEntryAtIdx != nullptr && inlineStackEntryAtIdx->targetModule != nullptr;
-        }
-        return allStackEntriesValid;
+        // The validation must not create the entries of an inline stack that is a view of a module call tree node since the inline stack is shared by all qubits created in the same invocation of a module.
+        return inlineStackToCheck != nullptr && inlineStackToCheck->size() > 0 && inlineStackToCheck->areTargetModulesOfAllStackEntriesSet();
     }
 
     bool validateVariableLayoutForSyrecVariable(const syrec::AnnotatableQuantumComputation::AssociatedVariableLayoutInformation& variableLayout, const std::optional<syrec::AnnotatableQuantumComputation::InlinedQubitInformation>& optionalInliningInformation) {
@@ -91,6 +110,91 @@ namespace {
     bool validateInlinedQubitInformationOfAncillaryQubit(const syrec::AnnotatableQuantumComputation::InlinedQubitInformation& inlinedQubitInformationOfAncillaryQubit) {
         return (!inlinedQubitInformationOfAncillaryQubit.inlineStack.has_value() || isDataOfInlineStackOk(inlinedQubitInformationOfAncillaryQubit.inlineStack.value())) && !inlinedQubitInformationOfAncillaryQubit.userDeclaredQubitLabel.has_value();
     }
+    bool isSelfInverseQuantumOperation(const qc::Operation& quantumOperation) {
+        return quantumOperation.isStandardOperation() && quantumOperation.getParameter().empty() && ((quantumOperation.getType() == qc::OpType::X && quantumOperation.getNtargets() == 1U) || (quantumOperation.getType() == qc::OpType::SWAP && quantumOperation.getNtargets() == 2U));
+    }
+
+    bool areSelfInverseQuantumOperationsIdentical(const qc::Operation& lQuantumOperation, const qc::Operation& rQuantumOperation) {
+        if (lQuantumOperation.getType() != rQuantumOperation.getType() || lQuantumOperation.getControls() != rQuantumOperation.getControls()) {
+            return false;
+        }
+
+        const qc::Targets& lTargetQubits = lQuantumOperation.getTargets();
+        const qc::Targets& rTargetQubits = rQuantumOperation.getTargets();
+        // The order of the target qubits of a SWAP gate is irrelevant.
+        return lTargetQubits == rTargetQubits || (lQuantumOperation.getType() == qc::OpType::SWAP && lTargetQubits.front() == rTargetQubits.back() && lTargetQubits.back() == rTargetQubits.front());
+    }
+
+    struct MergedMultiControlledXGates {
+        bool         doGatesCancel = false;
+        qc::Controls controlQubits;
+    };
+
+    /**
+     * Determine the single multi-controlled X gate implementing two adjacent multi-controlled X gates with the same target qubit using the templates:
+     * - X(C) X(C) = I
+     * - X(C + {x}) X(C + {!x}) = X(C)
+     * - X(C) X(C + {x}) = X(C + {!x})
+     */
+    std::optional<MergedMultiControlledXGates> mergeMultiControlledXGatesWithSameTargetQubit(const qc::Controls& lControlQubits, const qc::Controls& rControlQubits) {
+        if (lControlQubits == rControlQubits) {
+            return MergedMultiControlledXGates{.doGatesCancel = true, .controlQubits = {}};
+        }
+
+        const qc::Controls& largerControlQubits  = lControlQubits.size() >= rControlQubits.size() ? lControlQubits : rControlQubits;
+        const qc::Controls& smallerControlQubits = lControlQubits.size() >= rControlQubits.size() ? rControlQubits : lControlQubits;
+        if (largerControlQubits.size() - smallerControlQubits.size() > 1U) {
+            return std::nullopt;
+        }
+
+        std::vector<qc::Control> controlQubitsOnlyInLargerOne;
+        std::vector<qc::Control> controlQubitsOnlyInSmallerOne;
+        std::ranges::set_difference(largerControlQubits, smallerControlQubits, std::back_inserter(controlQubitsOnlyInLargerOne));
+        std::ranges::set_difference(smallerControlQubits, largerControlQubits, std::back_inserter(controlQubitsOnlyInSmallerOne));
+        if (controlQubitsOnlyInLargerOne.size() != 1U) {
+            return std::nullopt;
+        }
+
+        const qc::Control& differingControlQubit = controlQubitsOnlyInLargerOne.front();
+        qc::Controls       mergedControlQubits   = smallerControlQubits;
+        if (controlQubitsOnlyInSmallerOne.empty()) {
+            mergedControlQubits.emplace(qc::Control{differingControlQubit.qubit, differingControlQubit.type == qc::Control::Type::Pos ? qc::Control::Type::Neg : qc::Control::Type::Pos});
+            return MergedMultiControlledXGates{.doGatesCancel = false, .controlQubits = mergedControlQubits};
+        }
+        if (controlQubitsOnlyInSmallerOne.size() == 1U && controlQubitsOnlyInSmallerOne.front().qubit == differingControlQubit.qubit) {
+            mergedControlQubits.erase(controlQubitsOnlyInSmallerOne.front());
+            return MergedMultiControlledXGates{.doGatesCancel = false, .controlQubits = mergedControlQubits};
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * Estimate the number of bytes held by a quantum operation, including the quantum operations of a qc::CompoundOperation.
+     * @param quantumOperation The quantum operation.
+     * @return The estimated number of bytes.
+     */
+    [[nodiscard]] std::size_t determineNumBytesOfQuantumOperation(const qc::Operation& quantumOperation) {
+        std::size_t numBytes = syrec::memory_accounting::numBytesOfHeapStorage(quantumOperation.getTargets()) + syrec::memory_accounting::numBytesOfNodesOfOrderedContainer(quantumOperation.getControls());
+        if (const auto* compoundOperation = dynamic_cast<const qc::CompoundOperation*>(&quantumOperation); compoundOperation != nullptr) {
+            numBytes += sizeof(qc::CompoundOperation) + compoundOperation->size() * sizeof(std::unique_ptr<qc::Operation>);
+            for (const std::unique_ptr<qc::Operation>& nestedQuantumOperation: *compoundOperation) {
+                numBytes += nestedQuantumOperation != nullptr ? determineNumBytesOfQuantumOperation(*nestedQuantumOperation) : 0U;
+            }
+            return numBytes;
+        }
+        return numBytes + sizeof(qc::StandardOperation);
+    }
+
+    /**
+     * Append the decimal representation of an unsigned integer to a qubit label without creating a temporary string.
+     * @param qubitLabel The qubit label to which the value is appended.
+     * @param value The appended value.
+     */
+    void appendUnsignedIntegerToQubitLabel(std::string& qubitLabel, const std::uint64_t value) {
+        std::array<char, 20> digits{};
+        const auto           conversionResult = std::to_chars(digits.data(), digits.data() + digits.size(), value);
+        qubitLabel.append(digits.data(), conversionResult.ptr);
+    }
 } // namespace
 
 using namespace syrec;
@@ -104,12 +208,9 @@ bool AnnotatableQuantumComputation::addOperationsImplementingNotGate(const qc::Q
         return false;
     }
 
-    const qc::Controls gateControlQubits(aggregateOfPropagatedControlQubits.cbegin(), aggregateOfPropagatedControlQubits.cend());
-    const std::size_t  prevNumQuantumOperations = getNops();
-    mcx(gateControlQubits, targetQubit);
-
-    const std::size_t currNumQuantumOperations = getNops();
-    return currNumQuantumOperations > prevNumQuantumOperations && (!generateQuantumOperationAnnotations || annotateAllQuantumOperationsAtPositions(prevNumQuantumOperations, currNumQuantumOperations - 1U, {}));
+    const std::size_t prevNumQuantumOperations = getNops();
+    mcx(propagatedControlQubits, targetQubit);
+    return finalizeAddedQuantumOperations(prevNumQuantumOperations);
 }
 
 bool AnnotatableQuantumComputation::addOperationsImplementingCnotGate(const qc::Qubit controlQubit, const qc::Qubit targetQubit) {
@@ -117,14 +218,12 @@ bool AnnotatableQuantumComputation::addOperationsImplementingCnotGate(const qc::
         return false;
     }
 
-    qc::Controls gateControlQubits(aggregateOfPropagatedControlQubits.cbegin(), aggregateOfPropagatedControlQubits.cend());
-    gateControlQubits.emplace(controlQubit);
-
+    // The gate local control qubits are only temporarily added to the propagated ones to not have to create a copy of the latter for every added quantum operation.
+    propagatedControlQubits.emplace(controlQubit);
     const std::size_t prevNumQuantumOperations = getNops();
-    mcx(gateControlQubits, targetQubit);
-
-    const std::size_t currNumQuantumOperations = getNops();
-    return currNumQuantumOperations > prevNumQuantumOperations && (!generateQuantumOperationAnnotations || annotateAllQuantumOperationsAtPositions(prevNumQuantumOperations, currNumQuantumOperations - 1U, {}));
+    mcx(propagatedControlQubits, targetQubit);
+    removeGateLocalControlQubitFromPropagatedOnes(qc::Control{controlQubit});
+    return finalizeAddedQuantumOperations(prevNumQuantumOperations);
 }
 
 bool AnnotatableQuantumComputation::addOperationsImplementingToffoliGate(const qc::Qubit controlQubitOne, const qc::Qubit controlQubitTwo, const qc::Qubit targetQubit) {
@@ -132,15 +231,13 @@ bool AnnotatableQuantumComputation::addOperationsImplementingToffoliGate(const q
         return false;
     }
 
-    qc::Controls gateControlQubits(aggregateOfPropagatedControlQubits.cbegin(), aggregateOfPropagatedControlQubits.cend());
-    gateControlQubits.emplace(controlQubitOne);
-    gateControlQubits.emplace(controlQubitTwo);
-
+    propagatedControlQubits.emplace(controlQubitOne);
+    propagatedControlQubits.emplace(controlQubitTwo);
     const std::size_t prevNumQuantumOperations = getNops();
-    mcx(gateControlQubits, targetQubit);
-
-    const std::size_t currNumQuantumOperations = getNops();
-    return currNumQuantumOperations > prevNumQuantumOperations && (!generateQuantumOperationAnnotations || annotateAllQuantumOperationsAtPositions(prevNumQuantumOperations, currNumQuantumOperations - 1U, {}));
+    mcx(propagatedControlQubits, targetQubit);
+    removeGateLocalControlQubitFromPropagatedOnes(qc::Control{controlQubitOne});
+    removeGateLocalControlQubitFromPropagatedOnes(qc::Control{controlQubitTwo});
+    return finalizeAddedQuantumOperations(prevNumQuantumOperations);
 }
 
 bool AnnotatableQuantumComputation::addOperationsImplementingMultiControlToffoliGate(const qc::Controls& controlQubits, const qc::Qubit targetQubit) {
@@ -148,30 +245,71 @@ bool AnnotatableQuantumComputation::addOperationsImplementingMultiControlToffoli
         return false;
     }
 
-    qc::Controls gateControlQubits(aggregateOfPropagatedControlQubits.cbegin(), aggregateOfPropagatedControlQubits.cend());
-    gateControlQubits.insert(controlQubits.cbegin(), controlQubits.cend());
-    if (gateControlQubits.empty()) {
+    if (controlQubits.empty() && propagatedControlQubits.empty()) {
         return false;
     }
 
+    propagatedControlQubits.insert(controlQubits.cbegin(), controlQubits.cend());
     const std::size_t prevNumQuantumOperations = getNops();
-    mcx(gateControlQubits, targetQubit);
-
-    const std::size_t currNumQuantumOperations = getNops();
-    return currNumQuantumOperations > prevNumQuantumOperations && (!generateQuantumOperationAnnotations || annotateAllQuantumOperationsAtPositions(prevNumQuantumOperations, currNumQuantumOperations - 1U, {}));
+    mcx(propagatedControlQubits, targetQubit);
+    for (const qc::Control& controlQubit: controlQubits) {
+        removeGateLocalControlQubitFromPropagatedOnes(controlQubit);
+    }
+    return finalizeAddedQuantumOperations(prevNumQuantumOperations);
 }
 
 bool AnnotatableQuantumComputation::addOperationsImplementingFredkinGate(const qc::Qubit targetQubitOne, const qc::Qubit targetQubitTwo) {
     if (!isQubitWithinRange(targetQubitOne) || !isQubitWithinRange(targetQubitTwo) || targetQubitOne == targetQubitTwo || aggregateOfPropagatedControlQubits.contains(targetQubitOne) || aggregateOfPropagatedControlQubits.contains(targetQubitTwo)) {
         return false;
     }
-    const qc::Controls gateControlQubits(aggregateOfPropagatedControlQubits.cbegin(), aggregateOfPropagatedControlQubits.cend());
 
     const std::size_t prevNumQuantumOperations = getNops();
-    mcswap(gateControlQubits, targetQubitOne, targetQubitTwo);
+    mcswap(propagatedControlQubits, targetQubitOne, targetQubitTwo);
+    return finalizeAddedQuantumOperations(prevNumQuantumOperations);
+}
+
+bool AnnotatableQuantumComputation::addOperationsImplementingCnotGates(const std::span<const qc::Qubit> controlQubits, const std::span<const qc::Qubit> targetQubits) {
+    if (controlQubits.size() != targetQubits.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < controlQubits.size(); ++i) {
+        if (!isQubitWithinRange(controlQubits[i]) || !isQubitWithinRange(targetQubits[i]) || controlQubits[i] == targetQubits[i] || aggregateOfPropagatedControlQubits.contains(targetQubits[i])) {
+            return false;
+        }
+    }
+    if (controlQubits.empty()) {
+        return true;
+    }
+
+    const std::size_t prevNumQuantumOperations = getNops();
+    reserveStorageForAddedQuantumOperations(controlQubits.size());
+    for (std::size_t i = 0; i < controlQubits.size(); ++i) {
+        propagatedControlQubits.emplace(controlQubits[i]);
+        mcx(propagatedControlQubits, targetQubits[i]);
+        removeGateLocalControlQubitFromPropagatedOnes(qc::Control{controlQubits[i]});
+    }
+    return finalizeAddedQuantumOperations(prevNumQuantumOperations);
+}
+
+bool AnnotatableQuantumComputation::addOperationsImplementingFredkinGates(const std::span<const qc::Qubit> targetQubitsOne, const std::span<const qc::Qubit> targetQubitsTwo) {
+    if (targetQubitsOne.size() != targetQubitsTwo.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < targetQubitsOne.size(); ++i) {
+        if (!isQubitWithinRange(targetQubitsOne[i]) || !isQubitWithinRange(targetQubitsTwo[i]) || targetQubitsOne[i] == targetQubitsTwo[i] || aggregateOfPropagatedControlQubits.contains(targetQubitsOne[i]) || aggregateOfPropagatedControlQubits.contains(targetQubitsTwo[i])) {
+            return false;
+        }
+    }
+    if (targetQubitsOne.empty()) {
+        return true;
+    }
 
-    const std::size_t currNumQuantumOperations = getNops();
-    return currNumQuantumOperations > prevNumQuantumOperations && (!generateQuantumOperationAnnotations || annotateAllQuantumOperationsAtPositions(prevNumQuantumOperations, currNumQuantumOperations - 1U, {}));
+    const std::size_t prevNumQuantumOperations = getNops();
+    reserveStorageForAddedQuantumOperations(targetQubitsOne.size());
+    for (std::size_t i = 0; i < targetQubitsOne.size(); ++i) {
+        mcswap(propagatedControlQubits, targetQubitsOne[i], targetQubitsTwo[i]);
+    }
+    return finalizeAddedQuantumOperations(prevNumQuantumOperations);
 }
 
 std::optional<qc::Qubit> AnnotatableQuantumComputation::addQuantumRegisterForSyrecVariable(const std::string& quantumRegisterLabel, const AssociatedVariableLayoutInformation& associatedVariableLayoutInformation, const bool areGeneratedQubitsGarbage, const std::optional<InlinedQubitInformation>& optionalInliningInformation) {
@@ -198,6 +336,7 @@ std::optional<qc::Qubit> AnnotatableQuantumComputation::addQuantumRegisterForSyr
 
     const auto coveredQubitIndices = QubitIndexRange({.firstQubitIndex = addedQuantumRegister.getStartIndex(), .lastQubitIndex = addedQuantumRegister.getEndIndex()});
     quantumRegisterAssociatedVariableLayouts.emplace_back(std::make_unique<NonAncillaryQuantumRegisterVariableLayout>(coveredQubitIndices, quantumRegisterLabel, associatedVariableLayoutInformation.numValuesPerDimension, associatedVariableLayoutInformation.bitwidth, optionalInliningInformation));
+    indexOfVariableLayoutPerQubit.resize(getNqubits(), quantumRegisterAssociatedVariableLayouts.size() - 1U);
     return addedQuantumRegister.getStartIndex();
 }
 
@@ -246,6 +385,8 @@ std::optional<qc::Qubit> AnnotatableQuantumComputation::addPreliminaryAncillaryR
     } else {
         quantumRegisterAssociatedVariableLayouts.emplace_back(std::make_unique<AncillaryQuantumRegisterVariableLayout>(QubitIndexRange{.firstQubitIndex = addedQuantumRegister.getStartIndex(), .lastQubitIndex = addedQuantumRegister.getEndIndex()}, quantumRegisterLabel, sharedInliningInformation));
     }
+    // The added qubits are either stored in the newly created ancillary quantum register or were appended to the last added ancillary quantum register.
+    indexOfVariableLayoutPerQubit.resize(getNqubits(), quantumRegisterAssociatedVariableLayouts.size() - 1U);
 
     for (std::size_t ancillaryQubitOffsetInQuantumRegister = 0; ancillaryQubitOffsetInQuantumRegister < initialStateOfAncillaryQubits.size(); ++ancillaryQubitOffsetInQuantumRegister) {
         // Since ancillary qubits are assumed to have an initial value of
@@ -274,296 +415,1645 @@ void AnnotatableQuantumComputation::promotePreliminaryAncillaryQubitsToDefinitiv
     }
 }
 
-std::optional<std::string> AnnotatableQuantumComputation::getQubitLabel(const qc::Qubit qubit, const QubitLabelType qubitLabelType) const {
-    const std::optional<std::size_t>                                                  indexOfQuantumRegisterStoringQubit  = determineIndexOfQuantumRegisterStoringQubit(qubit);
-    const std::optional<BaseQuantumRegisterVariableLayout::QubitInVariableLayoutData> qubitInformationFromQuantumRegister = indexOfQuantumRegisterStoringQubit.has_value() ? quantumRegisterAssociatedVariableLayouts.at(*indexOfQuantumRegisterStoringQubit)->determineQubitInVariableLayoutData(qubit) : std::nullopt;
-    if (!qubitInformationFromQuantumRegister.has_value()) {
-        return std::nullopt;
+bool AnnotatableQuantumComputation::relocateAncillaryQubits(const std::vector<qc::Qubit>& hostQubitPerQubit) {
+    if (canQubitsBeAddedToQuantumComputation || hostQubitPerQubit.size() != getNqubits() || getNumForwardedQuantumOperations() != 0U || !qubitInVariableLayoutsPerQubit.empty()) {
+        return false;
     }
 
-    std::string inheritedQubitIdentifierFromQuantumRegister;
-    if (qubitLabelType == UserDeclared) {
-        if (!qubitInformationFromQuantumRegister->inlinedQubitInformation.has_value() || !qubitInformationFromQuantumRegister->inlinedQubitInformation->userDeclaredQubitLabel.has_value()) {
-            return std::nullopt;
+    std::vector<bool> isQubitRemoved(getNqubits(), false);
+    std::size_t       numRemovedQubits = 0;
+    for (qc::Qubit qubit = 0; qubit < getNqubits(); ++qubit) {
+        const qc::Qubit hostQubit = hostQubitPerQubit[qubit];
+        if (hostQubit == qubit) {
+            continue;
+        }
+
+        const std::optional<std::size_t> indexOfQuantumRegisterStoringQubit = determineIndexOfQuantumRegisterStoringQubit(qubit);
+        if (!isQubitWithinRange(hostQubit) || hostQubitPerQubit[hostQubit] != hostQubit || !logicalQubitIsAncillary(qubit) || !logicalQubitIsAncillary(hostQubit) || (indexOfQuantumRegisterStoringQubit.has_value() && dynamic_cast<const AncillaryQuantumRegisterVariableLayout*>(quantumRegisterAssociatedVariableLayouts[*indexOfQuantumRegisterStoringQubit].get()) == nullptr)) {
+            return false;
         }
-        inheritedQubitIdentifierFromQuantumRegister = *qubitInformationFromQuantumRegister->inlinedQubitInformation->userDeclaredQubitLabel;
-    } else if (qubitLabelType == Internal) {
-        inheritedQubitIdentifierFromQuantumRegister = quantumRegisterAssociatedVariableLayouts.at(*indexOfQuantumRegisterStoringQubit)->quantumRegisterLabel;
+        isQubitRemoved[qubit] = true;
+        ++numRemovedQubits;
     }
-    return buildQubitLabelForQubitOfVariableInQuantumRegister(inheritedQubitIdentifierFromQuantumRegister, qubitInformationFromQuantumRegister->accessedValuePerDimensionOfElementStoringQubit, qubitInformationFromQuantumRegister->relativeQubitIndexInElementStoringQubit);
-}
 
-const qc::Operation* AnnotatableQuantumComputation::getQuantumOperation(const std::size_t indexOfQuantumOperationInQuantumComputation) const {
-    if (indexOfQuantumOperationInQuantumComputation >= getNops()) {
-        return nullptr;
+    if (numRemovedQubits == 0U) {
+        return true;
     }
-    return at(indexOfQuantumOperationInQuantumComputation).get();
-}
 
-bool AnnotatableQuantumComputation::replayOperationsAtGivenIndexRange(const std::size_t indexOfFirstQuantumOperationToReplayInQuantumComputation, const std::size_t indexOfLastQuantumOperationToReplayInQuantumComputation) {
-    if (indexOfFirstQuantumOperationToReplayInQuantumComputation >= getNops() || indexOfLastQuantumOperationToReplayInQuantumComputation >= getNops()) {
-        return false;
+    // A removed qubit is assigned the index of the next remaining qubit, thus the new first qubit of a quantum register can be determined from its previous first qubit.
+    std::vector<qc::Qubit> newIndexPerQubit(getNqubits());
+    qc::Qubit              numRemainingQubits = 0;
+    for (qc::Qubit qubit = 0; qubit < getNqubits(); ++qubit) {
+        newIndexPerQubit[qubit] = isQubitRemoved[qubit] ? numRemainingQubits : numRemainingQubits++;
     }
+    const auto relocateQubit = [&](const qc::Qubit qubit) { return newIndexPerQubit[hostQubitPerQubit[qubit]]; };
 
-    std::size_t numQuantumOperationsToReplay = 0U;
-    // Since we have already validated that the provided indices are within range and under the assumption that only valid quantum operations are stored in the quantum computation (i.e. no nullptrs)
-    // then the result of the at(...) should return a valid quantum operation instance.
-    // After the operations were replayed with the emplace_back(..) call of qc::QuantumComputation, the number of operations will be larger than the number of gate annotations since the annotations for the replayed operations are only
-    // recorded in this derived class.
-    if (indexOfFirstQuantumOperationToReplayInQuantumComputation > indexOfLastQuantumOperationToReplayInQuantumComputation) {
-        numQuantumOperationsToReplay = (indexOfFirstQuantumOperationToReplayInQuantumComputation - indexOfLastQuantumOperationToReplayInQuantumComputation) + 1U;
-        for (std::size_t quantumOperationIdxOffset = 0; quantumOperationIdxOffset < numQuantumOperationsToReplay; ++quantumOperationIdxOffset) {
-            emplace_back(at(indexOfFirstQuantumOperationToReplayInQuantumComputation - quantumOperationIdxOffset)->clone());
+    std::vector<qc::Qubit> relocatedQubitsOfQuantumOperation;
+    for (const std::unique_ptr<qc::Operation>& quantumOperation: ops) {
+        if (quantumOperation == nullptr || !quantumOperation->isStandardOperation()) {
+            return false;
         }
-    } else {
-        numQuantumOperationsToReplay = (indexOfLastQuantumOperationToReplayInQuantumComputation - indexOfFirstQuantumOperationToReplayInQuantumComputation) + 1U;
-        for (std::size_t quantumOperationIdxOffset = 0; quantumOperationIdxOffset < numQuantumOperationsToReplay; ++quantumOperationIdxOffset) {
-            emplace_back(at(indexOfFirstQuantumOperationToReplayInQuantumComputation + quantumOperationIdxOffset)->clone());
+        relocatedQubitsOfQuantumOperation.clear();
+        std::ranges::transform(quantumOperation->getTargets(), std::back_inserter(relocatedQubitsOfQuantumOperation), relocateQubit);
+        std::ranges::transform(quantumOperation->getControls(), std::back_inserter(relocatedQubitsOfQuantumOperation), [&](const qc::Control& controlQubit) { return relocateQubit(controlQubit.qubit); });
+        std::ranges::sort(relocatedQubitsOfQuantumOperation);
+        if (std::ranges::adjacent_find(relocatedQubitsOfQuantumOperation) != relocatedQubitsOfQuantumOperation.end()) {
+            return false;
         }
     }
 
-    if (generateQuantumOperationAnnotations) {
-        const std::size_t idxOfFirstQuantumOperationToAnnotateAfterReplay = indexOfLastQuantumOperationToReplayInQuantumComputation + 1U;
-        const std::size_t idxOfLastQuantumOperationToAnnotateAfterReplay  = idxOfFirstQuantumOperationToAnnotateAfterReplay + (numQuantumOperationsToReplay - 1U);
-        return annotateAllQuantumOperationsAtPositions(idxOfFirstQuantumOperationToAnnotateAfterReplay, idxOfLastQuantumOperationToAnnotateAfterReplay, {});
-    }
-    return true;
-}
-
-AnnotatableQuantumComputation::QuantumOperationAnnotationsLookup AnnotatableQuantumComputation::getAnnotationsOfQuantumOperation(std::size_t indexOfQuantumOperationInQuantumComputation) const {
-    if (!generateQuantumOperationAnnotations || indexOfQuantumOperationInQuantumComputation >= annotationsPerQuantumOperation.size()) {
-        return {};
+    for (std::unique_ptr<qc::Operation>& quantumOperation: ops) {
+        qc::Controls relocatedControlQubits;
+        for (const qc::Control& controlQubit: quantumOperation->getControls()) {
+            relocatedControlQubits.emplace(qc::Control{relocateQubit(controlQubit.qubit), controlQubit.type});
+        }
+        qc::Targets relocatedTargetQubits;
+        relocatedTargetQubits.reserve(quantumOperation->getNtargets());
+        std::ranges::transform(quantumOperation->getTargets(), std::back_inserter(relocatedTargetQubits), relocateQubit);
+        quantumOperation = std::make_unique<qc::StandardOperation>(relocatedControlQubits, relocatedTargetQubits, quantumOperation->getType(), quantumOperation->getParameter());
     }
-    return annotationsPerQuantumOperation[indexOfQuantumOperationInQuantumComputation];
-}
 
-AnnotatableQuantumComputation::SynthesisCostMetricValue AnnotatableQuantumComputation::getQuantumCostForSynthesis() const {
-    SynthesisCostMetricValue cost = 0;
+    const auto determineRelocatedQubitIndexRange = [&](const QubitIndexRange& qubitIndexRange) -> std::optional<QubitIndexRange> {
+        qc::Qubit numRemainingQubitsInRange = 0;
+        for (qc::Qubit qubit = qubitIndexRange.firstQubitIndex; qubit <= qubitIndexRange.lastQubitIndex; ++qubit) {
+            numRemainingQubitsInRange += isQubitRemoved[qubit] ? 0U : 1U;
+        }
+        if (numRemainingQubitsInRange == 0U) {
+            return std::nullopt;
+        }
+        return QubitIndexRange{.firstQubitIndex = newIndexPerQubit[qubitIndexRange.firstQubitIndex], .lastQubitIndex = newIndexPerQubit[qubitIndexRange.firstQubitIndex] + numRemainingQubitsInRange - 1U};
+    };
 
-    const auto numQubits = getNqubits();
-    if (numQubits == 0) {
-        return cost;
+    qc::QuantumRegisterMap relocatedQuantumRegisters;
+    for (const auto& [quantumRegisterLabel, quantumRegister]: quantumRegisters) {
+        if (const std::optional<QubitIndexRange> relocatedQubitIndexRange = determineRelocatedQubitIndexRange(QubitIndexRange{.firstQubitIndex = quantumRegister.getStartIndex(), .lastQubitIndex = quantumRegister.getEndIndex()}); relocatedQubitIndexRange.has_value()) {
+            relocatedQuantumRegisters.try_emplace(quantumRegisterLabel, relocatedQubitIndexRange->firstQubitIndex, (relocatedQubitIndexRange->lastQubitIndex - relocatedQubitIndexRange->firstQubitIndex) + 1U, quantumRegisterLabel);
+        }
     }
+    quantumRegisters = std::move(relocatedQuantumRegisters);
 
-    for (const auto& quantumOperation: ops) {
-        const std::size_t c             = std::min(quantumOperation->getNcontrols() + static_cast<std::size_t>(quantumOperation->getType() == qc::OpType::SWAP), numQubits - 1);
-        const std::size_t numEmptyLines = numQubits - c - 1U;
+    // The inline information of the remaining ancillary qubits is preserved by relocating the qubit ranges sharing the same inline information together with their quantum register.
+    std::vector<std::size_t>                                        newIndexPerVariableLayout(quantumRegisterAssociatedVariableLayouts.size());
+    std::vector<std::unique_ptr<BaseQuantumRegisterVariableLayout>> relocatedVariableLayouts;
+    for (std::size_t i = 0; i < quantumRegisterAssociatedVariableLayouts.size(); ++i) {
+        std::unique_ptr<BaseQuantumRegisterVariableLayout>& variableLayout = quantumRegisterAssociatedVariableLayouts[i];
+        newIndexPerVariableLayout[i]                                       = relocatedVariableLayouts.size();
 
-        switch (c) {
-            case 0U:
-            case 1U:
-                cost += 1ULL;
-                break;
-            case 2U:
-                cost += 5ULL;
-                break;
-            case 3U:
-                cost += 13ULL;
-                break;
-            case 4U:
-                cost += (numEmptyLines >= 2U) ? 26ULL : 29ULL;
-                break;
-            case 5U:
-                if (numEmptyLines >= 3U) {
-                    cost += 38ULL;
-                } else if (numEmptyLines >= 1U) {
-                    cost += 52ULL;
-                } else {
-                    cost += 61ULL;
-                }
-                break;
-            case 6U:
-                if (numEmptyLines >= 4U) {
-                    cost += 50ULL;
-                } else if (numEmptyLines >= 1U) {
-                    cost += 80ULL;
-                } else {
-                    cost += 125ULL;
-                }
-                break;
-            case 7U:
-                if (numEmptyLines >= 5U) {
-                    cost += 62ULL;
-                } else if (numEmptyLines >= 1U) {
-                    cost += 100ULL;
-                } else {
-                    cost += 253ULL;
-                }
-                break;
-            default:
-                if (numEmptyLines >= c - 2U) {
-                    cost += 12ULL * c - 22ULL;
-                } else if (numEmptyLines >= 1U) {
-                    cost += 24ULL * c - 87ULL;
-                } else {
-                    cost += (1ULL << (c + 1ULL)) - 3ULL;
+        const std::optional<QubitIndexRange> relocatedQubitIndexRange = determineRelocatedQubitIndexRange(variableLayout->storedQubitIndices);
+        if (!relocatedQubitIndexRange.has_value()) {
+            continue;
+        }
+        variableLayout->storedQubitIndices = *relocatedQubitIndexRange;
+
+        if (auto* ancillaryVariableLayout = dynamic_cast<AncillaryQuantumRegisterVariableLayout*>(variableLayout.get()); ancillaryVariableLayout != nullptr) {
+            std::vector<AncillaryQuantumRegisterVariableLayout::SharedQubitRangeInlineInformation> relocatedSharedQubitRangeInlineInformation;
+            for (const AncillaryQuantumRegisterVariableLayout::SharedQubitRangeInlineInformation& sharedQubitRangeInlineInformation: ancillaryVariableLayout->sharedQubitRangeInlineInformationLookup) {
+                if (const std::optional<QubitIndexRange> relocatedSharedQubitIndexRange = determineRelocatedQubitIndexRange(sharedQubitRangeInlineInformation.coveredQubitIndexRange); relocatedSharedQubitIndexRange.has_value()) {
+                    relocatedSharedQubitRangeInlineInformation.emplace_back(*relocatedSharedQubitIndexRange, sharedQubitRangeInlineInformation.inlinedQubitInformation);
                 }
+            }
+            ancillaryVariableLayout->sharedQubitRangeInlineInformationLookup = std::move(relocatedSharedQubitRangeInlineInformation);
         }
+        relocatedVariableLayouts.emplace_back(std::move(variableLayout));
     }
-    return cost;
-}
-
-AnnotatableQuantumComputation::SynthesisCostMetricValue AnnotatableQuantumComputation::getTransistorCostForSynthesis() const {
-    SynthesisCostMetricValue cost = 0;
-    for (const auto& quantumOperation: ops) {
-        cost += quantumOperation->getNcontrols() * 8;
+    quantumRegisterAssociatedVariableLayouts = std::move(relocatedVariableLayouts);
+
+    // Qubits not stored in any variable layout reference an arbitrary variable layout whose qubit range does not contain them, the index of such a variable layout is thus only required to be valid.
+    std::vector<std::size_t> relocatedIndexOfVariableLayoutPerQubit;
+    relocatedIndexOfVariableLayoutPerQubit.reserve(numRemainingQubits);
+    for (qc::Qubit qubit = 0; qubit < indexOfVariableLayoutPerQubit.size() && !quantumRegisterAssociatedVariableLayouts.empty(); ++qubit) {
+        if (!isQubitRemoved[qubit]) {
+            relocatedIndexOfVariableLayoutPerQubit.emplace_back(std::min(newIndexPerVariableLayout[indexOfVariableLayoutPerQubit[qubit]], quantumRegisterAssociatedVariableLayouts.size() - 1U));
+        }
     }
-    return cost;
-}
-
-void AnnotatableQuantumComputation::activateControlQubitPropagationScope() {
-    controlQubitPropagationScopes.emplace_back();
+    indexOfVariableLayoutPerQubit = std::move(relocatedIndexOfVariableLayoutPerQubit);
+
+    const auto relocatePermutation = [&](const qc::Permutation& permutation) {
+        qc::Permutation relocatedPermutation;
+        for (const auto& [fromQubit, toQubit]: permutation) {
+            if (fromQubit < isQubitRemoved.size() && toQubit < isQubitRemoved.size() && !isQubitRemoved[fromQubit] && !isQubitRemoved[toQubit]) {
+                relocatedPermutation.insert_or_assign(newIndexPerQubit[fromQubit], newIndexPerQubit[toQubit]);
+            }
+        }
+        return relocatedPermutation;
+    };
+    initialLayout     = relocatePermutation(initialLayout);
+    outputPermutation = relocatePermutation(outputPermutation);
+
+    std::vector<bool> relocatedIsAncillaryPerQubit;
+    std::vector<bool> relocatedIsGarbagePerQubit;
+    for (qc::Qubit qubit = 0; qubit < getNqubits(); ++qubit) {
+        if (!isQubitRemoved[qubit]) {
+            relocatedIsAncillaryPerQubit.emplace_back(ancillary[qubit]);
+            relocatedIsGarbagePerQubit.emplace_back(garbage[qubit]);
+        }
+    }
+    ancillary = std::move(relocatedIsAncillaryPerQubit);
+    garbage   = std::move(relocatedIsGarbagePerQubit);
+    nancillae -= numRemovedQubits;
+    return true;
 }
 
-void AnnotatableQuantumComputation::deactivateControlQubitPropagationScope() {
-    if (controlQubitPropagationScopes.empty()) {
-        return;
+bool AnnotatableQuantumComputation::permuteQubits(const std::vector<qc::Qubit>& newIndexPerQubit) {
+    if (canQubitsBeAddedToQuantumComputation || newIndexPerQubit.size() != getNqubits() || getNumForwardedQuantumOperations() != 0U) {
+        return false;
     }
 
-    const auto& localControlLineScope = controlQubitPropagationScopes.back();
-    for (const auto [controlLine, wasControlLineActiveInParentScope]: localControlLineScope) {
-        if (wasControlLineActiveInParentScope) {
-            // Control lines registered prior to the local scope and deactivated by the latter should still be registered in the parent
-            // scope after the local one was deactivated.
-            aggregateOfPropagatedControlQubits.emplace(controlLine);
-        } else {
-            aggregateOfPropagatedControlQubits.erase(controlLine);
+    std::vector<bool> isNewIndexAssigned(getNqubits(), false);
+    for (qc::Qubit qubit = 0; qubit < getNqubits(); ++qubit) {
+        const qc::Qubit newIndex = newIndexPerQubit[qubit];
+        if (!isQubitWithinRange(newIndex) || isNewIndexAssigned[newIndex] || !determineIndexOfQuantumRegisterStoringQubit(determineQubitInVariableLayouts(qubit)).has_value()) {
+            return false;
         }
+        isNewIndexAssigned[newIndex] = true;
     }
-    controlQubitPropagationScopes.pop_back();
-}
-
-bool AnnotatableQuantumComputation::deregisterControlQubitFromPropagationInCurrentScope(const qc::Qubit controlQubit) {
-    if (controlQubitPropagationScopes.empty() || !isQubitWithinRange(controlQubit)) {
+    if (std::ranges::any_of(ops, [](const std::unique_ptr<qc::Operation>& quantumOperation) { return quantumOperation == nullptr || !quantumOperation->isStandardOperation(); })) {
         return false;
     }
 
-    auto& localControlLineScope = controlQubitPropagationScopes.back();
-    if (!localControlLineScope.contains(controlQubit)) {
-        return false;
+    const auto permuteQubit = [&newIndexPerQubit](const qc::Qubit qubit) { return newIndexPerQubit[qubit]; };
+    for (std::unique_ptr<qc::Operation>& quantumOperation: ops) {
+        qc::Controls permutedControlQubits;
+        for (const qc::Control& controlQubit: quantumOperation->getControls()) {
+            permutedControlQubits.emplace(qc::Control{permuteQubit(controlQubit.qubit), controlQubit.type});
+        }
+        qc::Targets permutedTargetQubits;
+        permutedTargetQubits.reserve(quantumOperation->getNtargets());
+        std::ranges::transform(quantumOperation->getTargets(), std::back_inserter(permutedTargetQubits), permuteQubit);
+        quantumOperation = std::make_unique<qc::StandardOperation>(permutedControlQubits, permutedTargetQubits, quantumOperation->getType(), quantumOperation->getParameter());
     }
 
-    aggregateOfPropagatedControlQubits.erase(controlQubit);
+    const auto permutePermutation = [&](const qc::Permutation& permutation) {
+        qc::Permutation permutedPermutation;
+        for (const auto& [fromQubit, toQubit]: permutation) {
+            if (isQubitWithinRange(fromQubit) && isQubitWithinRange(toQubit)) {
+                permutedPermutation.insert_or_assign(permuteQubit(fromQubit), permuteQubit(toQubit));
+            }
+        }
+        return permutedPermutation;
+    };
+    initialLayout     = permutePermutation(initialLayout);
+    outputPermutation = permutePermutation(outputPermutation);
+
+    std::vector<bool>      permutedIsAncillaryPerQubit(getNqubits());
+    std::vector<bool>      permutedIsGarbagePerQubit(getNqubits());
+    std::vector<qc::Qubit> permutedQubitInVariableLayoutsPerQubit(getNqubits());
+    for (qc::Qubit qubit = 0; qubit < getNqubits(); ++qubit) {
+        permutedIsAncillaryPerQubit[newIndexPerQubit[qubit]]            = ancillary[qubit];
+        permutedIsGarbagePerQubit[newIndexPerQubit[qubit]]              = garbage[qubit];
+        permutedQubitInVariableLayoutsPerQubit[newIndexPerQubit[qubit]] = determineQubitInVariableLayouts(qubit);
+    }
+    ancillary = std::move(permutedIsAncillaryPerQubit);
+    garbage   = std::move(permutedIsGarbagePerQubit);
+
+    // The identity is not stored to keep the lookup of the qubits in the variable layouts free of any indirection if a permutation was reverted.
+    const bool isIdentity          = std::ranges::all_of(std::views::iota(qc::Qubit{0}, static_cast<qc::Qubit>(getNqubits())), [&](const qc::Qubit qubit) { return permutedQubitInVariableLayoutsPerQubit[qubit] == qubit; });
+    qubitInVariableLayoutsPerQubit = isIdentity ? std::vector<qc::Qubit>() : std::move(permutedQubitInVariableLayoutsPerQubit);
+    splitQuantumRegistersOfPermutedQubits();
     return true;
 }
 
-bool AnnotatableQuantumComputation::registerControlQubitForPropagationInCurrentAndNestedScopes(const qc::Qubit controlQubit) {
-    if (!isQubitWithinRange(controlQubit)) {
-        return false;
+std::optional<std::string> AnnotatableQuantumComputation::getQubitLabel(const qc::Qubit qubit, const QubitLabelType qubitLabelType) const {
+    std::string qubitLabel;
+    if (!appendQubitLabel(qubit, qubitLabelType, qubitLabel)) {
+        return std::nullopt;
     }
+    return qubitLabel;
+}
 
-    if (controlQubitPropagationScopes.empty()) {
-        activateControlQubitPropagationScope();
+bool AnnotatableQuantumComputation::appendQubitLabel(const qc::Qubit qubit, const QubitLabelType qubitLabelType, std::string& qubitLabel) const {
+    const qc::Qubit                  qubitInVariableLayouts             = determineQubitInVariableLayouts(qubit);
+    const std::optional<std::size_t> indexOfQuantumRegisterStoringQubit = determineIndexOfQuantumRegisterStoringQubit(qubitInVariableLayouts);
+    return indexOfQuantumRegisterStoringQubit.has_value() && appendQubitLabelOfQubitInQuantumRegister(*quantumRegisterAssociatedVariableLayouts[*indexOfQuantumRegisterStoringQubit], qubitInVariableLayouts, qubitLabelType, qubitLabel);
+}
+
+std::vector<std::optional<std::string>> AnnotatableQuantumComputation::getQubitLabels(const QubitLabelType qubitLabelType) const {
+    // Since the quantum registers cover disjoint qubit ranges, the qubits of every quantum register can be labeled without looking up the quantum register storing each qubit. The buffer storing the label of the current qubit is reused to only
+    // allocate the storage of the returned labels.
+    std::vector<std::optional<std::string>> qubitLabels(getNqubits());
+    std::string                             qubitLabel;
+    for (const std::unique_ptr<BaseQuantumRegisterVariableLayout>& quantumRegisterVariableLayout: quantumRegisterAssociatedVariableLayouts) {
+        for (qc::Qubit qubit = quantumRegisterVariableLayout->storedQubitIndices.firstQubitIndex; qubit <= quantumRegisterVariableLayout->storedQubitIndices.lastQubitIndex && qubit < qubitLabels.size(); ++qubit) {
+            qubitLabel.clear();
+            if (appendQubitLabelOfQubitInQuantumRegister(*quantumRegisterVariableLayout, qubit, qubitLabelType, qubitLabel)) {
+                qubitLabels[qubit].emplace(qubitLabel);
+            }
+        }
     }
 
-    auto& localControlLineScope = controlQubitPropagationScopes.back();
-    // If an entry for the to be registered control line already exists in the current scope then the previously determine value of the flag indicating whether the control line existed in the parent scope
-    // should have the same value that it had when the control line was initially added to the current scope
+    if (qubitInVariableLayoutsPerQubit.empty()) {
+        return qubitLabels;
+    }
+    std::vector<std::optional<std::string>> labelsOfPermutedQubits(qubitLabels.size());
+    for (qc::Qubit qubit = 0; qubit < labelsOfPermutedQubits.size(); ++qubit) {
+        labelsOfPermutedQubits[qubit] = std::move(qubitLabels[determineQubitInVariableLayouts(qubit)]);
+    }
+    return labelsOfPermutedQubits;
+}
 
-    if (!localControlLineScope.contains(controlQubit)) {
-        localControlLineScope.emplace(std::make_pair(controlQubit, aggregateOfPropagatedControlQubits.contains(controlQubit)));
+const qc::Operation* AnnotatableQuantumComputation::getQuantumOperation(const std::size_t indexOfQuantumOperationInQuantumComputation) const {
+    const std::optional<std::size_t> positionOfQuantumOperation = determinePositionOfRetainedQuantumOperation(indexOfQuantumOperationInQuantumComputation);
+    if (!positionOfQuantumOperation.has_value()) {
+        return nullptr;
     }
-    aggregateOfPropagatedControlQubits.emplace(controlQubit);
-    return true;
+    return at(*positionOfQuantumOperation).get();
 }
 
-bool AnnotatableQuantumComputation::setOrUpdateGlobalQuantumOperationAnnotation(const std::string_view& key, const std::string& value) {
-    if (!generateQuantumOperationAnnotations) {
+bool AnnotatableQuantumComputation::replayOperationsAtGivenIndexRange(const std::size_t indexOfFirstQuantumOperationToReplayInQuantumComputation, const std::size_t indexOfLastQuantumOperationToReplayInQuantumComputation) {
+    const std::optional<std::size_t> positionOfFirstQuantumOperationToReplay = determinePositionOfRetainedQuantumOperation(indexOfFirstQuantumOperationToReplayInQuantumComputation);
+    const std::optional<std::size_t> positionOfLastQuantumOperationToReplay  = determinePositionOfRetainedQuantumOperation(indexOfLastQuantumOperationToReplayInQuantumComputation);
+    if (!positionOfFirstQuantumOperationToReplay.has_value() || !positionOfLastQuantumOperationToReplay.has_value()) {
         return false;
     }
 
-    auto existingAnnotationForKey = activateGlobalQuantumOperationAnnotations.find(key);
-    if (existingAnnotationForKey != activateGlobalQuantumOperationAnnotations.end()) {
-        existingAnnotationForKey->second = value;
-        return true;
-    }
-    activateGlobalQuantumOperationAnnotations.emplace(static_cast<std::string>(key), value);
-    return false;
-}
+    // Since we have already validated that the provided indices are within range and under the assumption that only valid quantum operations are stored in the quantum computation (i.e. no nullptrs)
+    // then the result of the at(...) should return a valid quantum operation instance.
+    // After the operations were replayed with the emplace_back(..) call of qc::QuantumComputation, the number of operations will be larger than the number of gate annotations since the annotations for the replayed operations are only
+    // recorded in this derived class.
+    const bool        areQuantumOperationsReplayedInReverseOrder = *positionOfFirstQuantumOperationToReplay > *positionOfLastQuantumOperationToReplay;
+    const std::size_t numQuantumOperationsToReplay               = (areQuantumOperationsReplayedInReverseOrder ? *positionOfFirstQuantumOperationToReplay - *positionOfLastQuantumOperationToReplay : *positionOfLastQuantumOperationToReplay - *positionOfFirstQuantumOperationToReplay) + 1U;
 
-bool AnnotatableQuantumComputation::removeGlobalQuantumOperationAnnotation(const std::string_view& key) {
-    if (!generateQuantumOperationAnnotations) {
-        return false;
+    // The storage for the replayed quantum operations is reserved upfront since the synthesis of an uncomputation can replay long sequences whose incremental appending would otherwise repeatedly reallocate the container of the quantum operations.
+    reserveStorageForAddedQuantumOperations(numQuantumOperationsToReplay);
+    for (std::size_t quantumOperationIdxOffset = 0; quantumOperationIdxOffset < numQuantumOperationsToReplay; ++quantumOperationIdxOffset) {
+        emplace_back(at(areQuantumOperationsReplayedInReverseOrder ? *positionOfFirstQuantumOperationToReplay - quantumOperationIdxOffset : *positionOfFirstQuantumOperationToReplay + quantumOperationIdxOffset)->clone());
     }
 
-    // We utilize the ability to use a std::string_view to erase a matching element
-    // of std::string in a std::map<std::string, ...> without needing to cast the
-    // std::string_view to std::string for the std::map<>::erase() operation
-    // (see further: https://www.open-std.org/jtc1/sc22/wg21/docs/papers/2021/p2077r3.html)
-    auto existingAnnotationForKey = activateGlobalQuantumOperationAnnotations.find(key);
-    if (existingAnnotationForKey != activateGlobalQuantumOperationAnnotations.end()) {
-        activateGlobalQuantumOperationAnnotations.erase(existingAnnotationForKey);
-        return true;
+    if (generateQuantumOperationAnnotations) {
+        // The replayed quantum operations were appended to the quantum computation regardless of the order in which they were replayed
+        const std::size_t idxOfFirstQuantumOperationToAnnotateAfterReplay = getNops() - numQuantumOperationsToReplay;
+        const std::size_t idxOfLastQuantumOperationToAnnotateAfterReplay  = idxOfFirstQuantumOperationToAnnotateAfterReplay + (numQuantumOperationsToReplay - 1U);
+        const bool        couldQuantumOperationsBeAnnotated               = annotateAllQuantumOperationsAtPositions(idxOfFirstQuantumOperationToAnnotateAfterReplay, idxOfLastQuantumOperationToAnnotateAfterReplay, {});
+        recordSynthesisCostOfAddedQuantumOperations(idxOfFirstQuantumOperationToAnnotateAfterReplay);
+        return couldQuantumOperationsBeAnnotated && forwardQuantumOperationsNotInReplayWindowToSink();
     }
-    return false;
+    recordSynthesisCostOfAddedQuantumOperations(getNops() - numQuantumOperationsToReplay);
+    return forwardQuantumOperationsNotInReplayWindowToSink();
 }
 
-bool AnnotatableQuantumComputation::setOrUpdateAnnotationOfQuantumOperation(std::size_t indexOfQuantumOperationInQuantumComputation, const std::string_view& annotationKey, const std::string& annotationValue) {
-    if (!generateQuantumOperationAnnotations || indexOfQuantumOperationInQuantumComputation >= annotationsPerQuantumOperation.size()) {
+bool AnnotatableQuantumComputation::addCopyOfQuantumOperationWithRemappedQubits(const qc::Operation* quantumOperation, const std::vector<QubitIndexRangeMapping>& qubitIndexRangeMappings) {
+    if (quantumOperation == nullptr || !quantumOperation->isStandardOperation()) {
         return false;
     }
+    const auto* quantumOperationToCopy = static_cast<const qc::StandardOperation*>(quantumOperation);
+
+    // The number of mapped qubit index ranges is assumed to be small, thus a linear search is used to determine the mapping of a qubit.
+    const auto remapQubit = [&qubitIndexRangeMappings](const qc::Qubit qubit) {
+        for (const auto& [mappedQubitIndexRange, firstQubitIndexOfMappingTarget]: qubitIndexRangeMappings) {
+            if (qubit >= mappedQubitIndexRange.firstQubitIndex && qubit <= mappedQubitIndexRange.lastQubitIndex) {
+                return firstQubitIndexOfMappingTarget + (qubit - mappedQubitIndexRange.firstQubitIndex);
+            }
+        }
+        return qubit;
+    };
 
-    auto& annotationsForQuantumOperation = annotationsPerQuantumOperation[indexOfQuantumOperationInQuantumComputation];
-    if (auto matchingEntryForKey = annotationsForQuantumOperation.find(annotationKey); matchingEntryForKey != annotationsForQuantumOperation.end()) {
-        matchingEntryForKey->second = annotationValue;
-    } else {
-        annotationsForQuantumOperation.emplace(std::string(annotationKey), annotationValue);
+    qc::Controls remappedControlQubits;
+    for (const qc::Control& controlQubit: quantumOperationToCopy->getControls()) {
+        remappedControlQubits.emplace(qc::Control{remapQubit(controlQubit.qubit), controlQubit.type});
     }
+
+    qc::Targets remappedTargetQubits;
+    remappedTargetQubits.reserve(quantumOperationToCopy->getTargets().size());
+    std::ranges::transform(quantumOperationToCopy->getTargets(), std::back_inserter(remappedTargetQubits), remapQubit);
+
+    if (std::ranges::any_of(remappedTargetQubits, [&](const qc::Qubit qubit) { return !isQubitWithinRange(qubit); }) || std::ranges::any_of(remappedControlQubits, [&](const qc::Control& controlQubit) { return !isQubitWithinRange(controlQubit.qubit); })) {
+        return false;
+    }
+    emplace_back<qc::StandardOperation>(remappedControlQubits, remappedTargetQubits, quantumOperationToCopy->getType(), quantumOperationToCopy->getParameter());
     return true;
 }
 
-std::optional<AnnotatableQuantumComputation::InlinedQubitInformation> AnnotatableQuantumComputation::getInlinedQubitInformation(const qc::Qubit qubit) const {
-    const std::optional<std::size_t>                                                  indexOfQuantumRegisterContainingQubit           = determineIndexOfQuantumRegisterStoringQubit(qubit);
-    const std::optional<BaseQuantumRegisterVariableLayout::QubitInVariableLayoutData> associatedVariableForQubitDataInQuantumRegister = indexOfQuantumRegisterContainingQubit.has_value() ? quantumRegisterAssociatedVariableLayouts.at(*indexOfQuantumRegisterContainingQubit)->determineQubitInVariableLayoutData(qubit) : std::nullopt;
-    if (!associatedVariableForQubitDataInQuantumRegister.has_value() || !associatedVariableForQubitDataInQuantumRegister->inlinedQubitInformation.has_value()) {
-        return std::nullopt;
+bool AnnotatableQuantumComputation::replayOperationsWithRemappedQubits(const std::size_t indexOfFirstQuantumOperationToReplayInQuantumComputation, const std::size_t numQuantumOperationsToReplay, const std::vector<QubitIndexRangeMapping>& qubitIndexRangeMappings) {
+    if (numQuantumOperationsToReplay == 0U) {
+        return true;
     }
 
-    InlinedQubitInformation qubitInlineInformation = associatedVariableForQubitDataInQuantumRegister->inlinedQubitInformation.value();
-    // The user declared qubit label stored in the qubit inline information of the quantum register only stores the identifier of the associated SyReC variable but no information about where in the variable the qubit is stored.
-    qubitInlineInformation.userDeclaredQubitLabel = getQubitLabel(qubit, UserDeclared);
-    return qubitInlineInformation;
-}
+    const std::optional<std::size_t> positionOfFirstQuantumOperationToReplay = determinePositionOfRetainedQuantumOperation(indexOfFirstQuantumOperationToReplayInQuantumComputation);
+    if (!positionOfFirstQuantumOperationToReplay.has_value() || numQuantumOperationsToReplay > getNops() - *positionOfFirstQuantumOperationToReplay) {
+        return false;
+    }
 
-// BEGIN NON-PUBLIC FUNCTIONALITY
-bool AnnotatableQuantumComputation::isQubitWithinRange(const qc::Qubit qubit) const noexcept {
-    return qubit < getNqubits();
-}
+    const std::size_t prevNumQuantumOperations = getNops();
+    for (std::size_t quantumOperationIdxOffset = 0; quantumOperationIdxOffset < numQuantumOperationsToReplay; ++quantumOperationIdxOffset) {
+        if (!addCopyOfQuantumOperationWithRemappedQubits(at(*positionOfFirstQuantumOperationToReplay + quantumOperationIdxOffset).get(), qubitIndexRangeMappings)) {
+            recordSynthesisCostOfAddedQuantumOperations(prevNumQuantumOperations);
+            return false;
+        }
+    }
 
-bool AnnotatableQuantumComputation::isQubitIndexRangeImmediateSuccessorOfCoveredRangeOfLastAddedQuantumRegister(const QubitIndexRange& toBeCheckedQubitIndexRange) const noexcept {
-    return quantumRegisterAssociatedVariableLayouts.empty() || toBeCheckedQubitIndexRange.firstQubitIndex == quantumRegisterAssociatedVariableLayouts.back()->storedQubitIndices.lastQubitIndex + 1U;
+    if (generateQuantumOperationAnnotations) {
+        annotationsPerQuantumOperation.resize(getNops());
+        annotationsPerQuantumOperation.copyAnnotationsOfQuantumOperations(*positionOfFirstQuantumOperationToReplay, prevNumQuantumOperations, numQuantumOperationsToReplay);
+    }
+    recordSynthesisCostOfAddedQuantumOperations(prevNumQuantumOperations);
+    return forwardQuantumOperationsNotInReplayWindowToSink();
 }
 
-bool AnnotatableQuantumComputation::annotateAllQuantumOperationsAtPositions(const std::size_t fromQuantumOperationIndex, const std::size_t toQuantumOperationIndex, const QuantumOperationAnnotationsLookup& userProvidedAnnotationsPerQuantumOperation) {
-    if (!generateQuantumOperationAnnotations || fromQuantumOperationIndex >= getNops() || toQuantumOperationIndex >= getNops()) {
+bool AnnotatableQuantumComputation::appendOperationsOfQuantumComputationWithRemappedQubits(const AnnotatableQuantumComputation& other, const std::vector<QubitIndexRangeMapping>& qubitIndexRangeMappings) {
+    if (other.getNumForwardedQuantumOperations() != 0U) {
         return false;
     }
 
-    std::size_t idxOfFirstGateToAnnotate = 0U;
-    std::size_t idxOfLastGateToAnnotate  = 0U;
-    if (fromQuantumOperationIndex <= toQuantumOperationIndex) {
-        if (toQuantumOperationIndex >= annotationsPerQuantumOperation.size()) {
-            annotationsPerQuantumOperation.resize(toQuantumOperationIndex + 1U);
-        }
-        idxOfFirstGateToAnnotate = fromQuantumOperationIndex;
-        idxOfLastGateToAnnotate  = toQuantumOperationIndex;
-    } else {
-        if (fromQuantumOperationIndex >= annotationsPerQuantumOperation.size()) {
-            annotationsPerQuantumOperation.resize(fromQuantumOperationIndex + 1U);
+    const std::size_t prevNumQuantumOperations = getNops();
+    for (std::size_t quantumOperationIdx = 0; quantumOperationIdx < other.getNops(); ++quantumOperationIdx) {
+        if (!addCopyOfQuantumOperationWithRemappedQubits(other.at(quantumOperationIdx).get(), qubitIndexRangeMappings)) {
+            recordSynthesisCostOfAddedQuantumOperations(prevNumQuantumOperations);
+            return false;
         }
-        idxOfFirstGateToAnnotate = toQuantumOperationIndex;
-        idxOfLastGateToAnnotate  = fromQuantumOperationIndex;
     }
 
-    for (std::size_t i = idxOfFirstGateToAnnotate; i <= idxOfLastGateToAnnotate; ++i) {
-        for (const auto& [activateGlobalAnnotationKey, activateGlobalAnnotationValue]: activateGlobalQuantumOperationAnnotations) {
-            annotationsPerQuantumOperation.at(i).insert_or_assign(activateGlobalAnnotationKey, activateGlobalAnnotationValue);
-        }
-        for (const auto& [userProvidedAnnotationKey, userProvidedAnnotationValue]: userProvidedAnnotationsPerQuantumOperation) {
-            annotationsPerQuantumOperation.at(i).insert_or_assign(userProvidedAnnotationKey, userProvidedAnnotationValue);
+    if (getNops() == prevNumQuantumOperations) {
+        return true;
+    }
+
+    if (generateQuantumOperationAnnotations) {
+        if (!annotateAllQuantumOperationsAtPositions(prevNumQuantumOperations, getNops() - 1U, {})) {
+            recordSynthesisCostOfAddedQuantumOperations(prevNumQuantumOperations);
+            return false;
         }
     }
-    return true;
+    recordSynthesisCostOfAddedQuantumOperations(prevNumQuantumOperations);
+    return forwardQuantumOperationsNotInReplayWindowToSink();
+}
+
+std::size_t AnnotatableQuantumComputation::propagateConstantQubitValues() {
+    if (getNumForwardedQuantumOperations() != 0U) {
+        return 0U;
+    }
+
+    // Only the ancillary qubits are known to be initialized to zero while the value of every other qubit depends on the input state of the quantum computation.
+    std::vector<std::optional<bool>> knownValuePerQubit(getNqubits());
+    for (qc::Qubit qubit = 0; qubit < getNqubits(); ++qubit) {
+        if (logicalQubitIsAncillary(qubit)) {
+            knownValuePerQubit[qubit] = false;
+        }
+    }
+
+    std::vector<bool> isQuantumOperationRemoved(getNops(), false);
+    qc::Controls      controlQubitsKnownToBeSatisfied;
+    std::size_t       numRemovedQuantumOperations    = 0;
+    std::size_t       numSimplifiedQuantumOperations = 0;
+    for (std::size_t position = 0; position < getNops(); ++position) {
+        qc::Operation* quantumOperation = ops[position].get();
+        // Quantum operations that are not standard operations could modify other qubits than their target qubits, thus the values of all qubits are unknown after such a quantum operation.
+        if (quantumOperation == nullptr || !quantumOperation->isStandardOperation() || std::ranges::any_of(quantumOperation->getTargets(), [&](const qc::Qubit qubit) { return !isQubitWithinRange(qubit); }) || std::ranges::any_of(quantumOperation->getControls(), [&](const qc::Control& controlQubit) { return !isQubitWithinRange(controlQubit.qubit); })) {
+            std::ranges::fill(knownValuePerQubit, std::nullopt);
+            continue;
+        }
+
+        bool isAnyControlQubitKnownToNotBeSatisfied = false;
+        bool areValuesOfAllControlQubitsKnown       = true;
+        controlQubitsKnownToBeSatisfied.clear();
+        for (const qc::Control& controlQubit: quantumOperation->getControls()) {
+            const std::optional<bool>& valueOfControlQubit = knownValuePerQubit[controlQubit.qubit];
+            if (!valueOfControlQubit.has_value()) {
+                areValuesOfAllControlQubitsKnown = false;
+            } else if (*valueOfControlQubit == (controlQubit.type == qc::Control::Type::Pos)) {
+                controlQubitsKnownToBeSatisfied.emplace(controlQubit);
+            } else {
+                isAnyControlQubitKnownToNotBeSatisfied = true;
+            }
+        }
+
+        const qc::Targets& targetQubits                        = quantumOperation->getTargets();
+        const bool         isSelfInverse                       = isSelfInverseQuantumOperation(*quantumOperation);
+        const bool         isSwapOfQubitsKnownToStoreSameValue = isSelfInverse && quantumOperation->getType() == qc::OpType::SWAP && knownValuePerQubit[targetQubits.front()].has_value() && knownValuePerQubit[targetQubits.front()] == knownValuePerQubit[targetQubits.back()];
+        if (isAnyControlQubitKnownToNotBeSatisfied || isSwapOfQubitsKnownToStoreSameValue) {
+            updateRecordedSynthesisCostOfQuantumOperation(position, false);
+            isQuantumOperationRemoved[position] = true;
+            ++numRemovedQuantumOperations;
+            continue;
+        }
+
+        if (!controlQubitsKnownToBeSatisfied.empty()) {
+            updateRecordedSynthesisCostOfQuantumOperation(position, false);
+            for (const qc::Control& controlQubit: controlQubitsKnownToBeSatisfied) {
+                quantumOperation->removeControl(controlQubit);
+            }
+            updateRecordedSynthesisCostOfQuantumOperation(position, true);
+            ++numSimplifiedQuantumOperations;
+        }
+
+        // The values of the target qubits can only be determined if the quantum operation is known to be applied.
+        if (!isSelfInverse || !areValuesOfAllControlQubitsKnown) {
+            for (const qc::Qubit targetQubit: targetQubits) {
+                knownValuePerQubit[targetQubit].reset();
+            }
+        } else if (quantumOperation->getType() == qc::OpType::X) {
+            if (std::optional<bool>& valueOfTargetQubit = knownValuePerQubit[targetQubits.front()]; valueOfTargetQubit.has_value()) {
+                valueOfTargetQubit = !*valueOfTargetQubit;
+            }
+        } else {
+            std::swap(knownValuePerQubit[targetQubits.front()], knownValuePerQubit[targetQubits.back()]);
+        }
+    }
+
+    if (numRemovedQuantumOperations != 0U) {
+        std::size_t numRemainingQuantumOperations = 0;
+        for (std::size_t position = 0; position < getNops(); ++position) {
+            if (!isQuantumOperationRemoved[position]) {
+                ops[numRemainingQuantumOperations++] = std::move(ops[position]);
+            }
+        }
+        ops.resize(numRemainingQuantumOperations);
+        annotationsPerQuantumOperation.eraseQuantumOperations(isQuantumOperationRemoved);
+    }
+    return numRemovedQuantumOperations + numSimplifiedQuantumOperations;
+}
+
+std::size_t AnnotatableQuantumComputation::applyReversibleCircuitTemplates(const std::size_t windowSize, const std::optional<std::uint64_t> timeBudgetInMilliseconds) {
+    if (getNumForwardedQuantumOperations() != 0U || windowSize == 0U) {
+        return 0U;
+    }
+
+    using Clock = std::chrono::steady_clock;
+
+    const std::optional<Clock::time_point> deadline                                  = timeBudgetInMilliseconds.has_value() ? std::make_optional(Clock::now() + std::chrono::milliseconds(*timeBudgetInMilliseconds)) : std::nullopt;
+    constexpr std::size_t                  numQuantumOperationsBetweenDeadlineChecks = 1024U;
+
+    // The per qubit positions are stored offset by one with a value of zero indicating that no previous quantum operation accessed the qubit.
+    std::vector<std::size_t>              lastPositionAsControlQubitPerQubit;
+    std::vector<std::size_t>              lastPositionAsTargetQubitOfXGatePerQubit;
+    std::vector<std::size_t>              lastPositionAsOtherTargetQubitPerQubit;
+    std::vector<std::vector<std::size_t>> positionsOfXGatesPerTargetQubit;
+    std::vector<bool>                     isQuantumOperationRemoved;
+
+    std::size_t numRemovedQuantumOperations = 0;
+    bool        wasDeadlineReached          = false;
+    for (std::size_t numRemovedQuantumOperationsInPass = 1; numRemovedQuantumOperationsInPass != 0U && !wasDeadlineReached;) {
+        numRemovedQuantumOperationsInPass = 0;
+        lastPositionAsControlQubitPerQubit.assign(getNqubits(), 0U);
+        lastPositionAsTargetQubitOfXGatePerQubit.assign(getNqubits(), 0U);
+        lastPositionAsOtherTargetQubitPerQubit.assign(getNqubits(), 0U);
+        positionsOfXGatesPerTargetQubit.assign(getNqubits(), {});
+        isQuantumOperationRemoved.assign(getNops(), false);
+
+        std::size_t firstPositionAfterLastBarrier = 0;
+        for (std::size_t position = 0; position < getNops(); ++position) {
+            if (deadline.has_value() && position % numQuantumOperationsBetweenDeadlineChecks == 0U && Clock::now() >= *deadline) {
+                wasDeadlineReached = true;
+                break;
+            }
+
+            const qc::Operation* quantumOperation = ops[position].get();
+            // Quantum operations that are not standard operations could access other qubits than their control and target qubits and thus no quantum operation is moved across them.
+            if (quantumOperation == nullptr || !quantumOperation->isStandardOperation() || std::ranges::any_of(quantumOperation->getTargets(), [&](const qc::Qubit qubit) { return !isQubitWithinRange(qubit); }) || std::ranges::any_of(quantumOperation->getControls(), [&](const qc::Control& controlQubit) { return !isQubitWithinRange(controlQubit.qubit); })) {
+                firstPositionAfterLastBarrier = position + 1U;
+                continue;
+            }
+
+            if (!isSelfInverseQuantumOperation(*quantumOperation) || quantumOperation->getType() != qc::OpType::X) {
+                for (const qc::Control& controlQubit: quantumOperation->getControls()) {
+                    lastPositionAsControlQubitPerQubit[controlQubit.qubit] = position + 1U;
+                }
+                for (const qc::Qubit targetQubit: quantumOperation->getTargets()) {
+                    lastPositionAsOtherTargetQubitPerQubit[targetQubit] = position + 1U;
+                }
+                continue;
+            }
+
+            // The multi-controlled X gate can be moved in front of all previous quantum operations it commutes with, i.e. up to the last quantum operation modifying one of its control qubits or accessing its target qubit other than as the target qubit of a multi-controlled X gate.
+            const qc::Qubit targetQubit                               = quantumOperation->getTargets().front();
+            std::size_t     firstPositionOfCommutingQuantumOperations = std::max({firstPositionAfterLastBarrier, lastPositionAsControlQubitPerQubit[targetQubit], lastPositionAsOtherTargetQubitPerQubit[targetQubit]});
+            for (const qc::Control& controlQubit: quantumOperation->getControls()) {
+                firstPositionOfCommutingQuantumOperations = std::max({firstPositionOfCommutingQuantumOperations, lastPositionAsTargetQubitOfXGatePerQubit[controlQubit.qubit], lastPositionAsOtherTargetQubitPerQubit[controlQubit.qubit]});
+            }
+
+            // Only the last multi-controlled X gates with the same target qubit within the window are considered as the partner of the current one.
+            std::vector<std::size_t>& positionsOfXGatesWithSameTargetQubit = positionsOfXGatesPerTargetQubit[targetQubit];
+            std::size_t               numConsideredQuantumOperations       = 0;
+            bool                      wasQuantumOperationMerged            = false;
+            for (auto candidatePositionIt = positionsOfXGatesWithSameTargetQubit.rbegin(); candidatePositionIt != positionsOfXGatesWithSameTargetQubit.rend() && *candidatePositionIt >= firstPositionOfCommutingQuantumOperations && numConsideredQuantumOperations < windowSize; ++candidatePositionIt) {
+                const std::size_t candidatePosition = *candidatePositionIt;
+                if (isQuantumOperationRemoved[candidatePosition]) {
+                    continue;
+                }
+                ++numConsideredQuantumOperations;
+
+                const std::optional<MergedMultiControlledXGates> mergedQuantumOperation = mergeMultiControlledXGatesWithSameTargetQubit(ops[candidatePosition]->getControls(), quantumOperation->getControls());
+                if (!mergedQuantumOperation.has_value()) {
+                    continue;
+                }
+
+                updateRecordedSynthesisCostOfQuantumOperation(candidatePosition, false);
+                updateRecordedSynthesisCostOfQuantumOperation(position, false);
+                isQuantumOperationRemoved[position] = true;
+                if (mergedQuantumOperation->doGatesCancel) {
+                    isQuantumOperationRemoved[candidatePosition] = true;
+                    numRemovedQuantumOperationsInPass += 2U;
+                } else {
+                    ops[candidatePosition] = std::make_unique<qc::StandardOperation>(mergedQuantumOperation->controlQubits, targetQubit, qc::OpType::X);
+                    updateRecordedSynthesisCostOfQuantumOperation(candidatePosition, true);
+                    for (const qc::Control& controlQubit: mergedQuantumOperation->controlQubits) {
+                        lastPositionAsControlQubitPerQubit[controlQubit.qubit] = std::max(lastPositionAsControlQubitPerQubit[controlQubit.qubit], candidatePosition + 1U);
+                    }
+                    ++numRemovedQuantumOperationsInPass;
+                }
+                wasQuantumOperationMerged = true;
+                break;
+            }
+
+            if (!wasQuantumOperationMerged) {
+                for (const qc::Control& controlQubit: quantumOperation->getControls()) {
+                    lastPositionAsControlQubitPerQubit[controlQubit.qubit] = position + 1U;
+                }
+                lastPositionAsTargetQubitOfXGatePerQubit[targetQubit] = position + 1U;
+                positionsOfXGatesWithSameTargetQubit.emplace_back(position);
+            }
+        }
+
+        if (numRemovedQuantumOperationsInPass != 0U) {
+            std::size_t numRemainingQuantumOperations = 0;
+            for (std::size_t position = 0; position < getNops(); ++position) {
+                if (!isQuantumOperationRemoved[position]) {
+                    ops[numRemainingQuantumOperations++] = std::move(ops[position]);
+                }
+            }
+            ops.resize(numRemainingQuantumOperations);
+            annotationsPerQuantumOperation.eraseQuantumOperations(isQuantumOperationRemoved);
+            numRemovedQuantumOperations += numRemovedQuantumOperationsInPass;
+        }
+    }
+    return numRemovedQuantumOperations;
+}
+
+std::size_t AnnotatableQuantumComputation::cancelAdjacentSelfInverseQuantumOperations() {
+    // The indices of the not removed quantum operations accessing a qubit are recorded per qubit in the order of their occurrence in the quantum computation, an identical self-inverse quantum operation can only be cancelled
+    // by the current (self-inverse) quantum operation if the former is the last recorded quantum operation for all qubits of the latter.
+    std::vector<std::vector<std::size_t>> quantumOperationsAccessingQubit(getNqubits());
+    std::vector<bool>                     isQuantumOperationCancelled(getNops(), false);
+    std::vector<qc::Qubit>                qubitsOfQuantumOperation;
+
+    std::size_t numCancelledQuantumOperations = 0;
+    for (std::size_t quantumOperationIdx = 0; quantumOperationIdx < getNops(); ++quantumOperationIdx) {
+        const qc::Operation& quantumOperation = *ops[quantumOperationIdx];
+        qubitsOfQuantumOperation.assign(quantumOperation.getTargets().cbegin(), quantumOperation.getTargets().cend());
+        std::ranges::transform(quantumOperation.getControls(), std::back_inserter(qubitsOfQuantumOperation), [](const qc::Control& controlQubit) { return controlQubit.qubit; });
+
+        // Quantum operations that are not standard operations could access other qubits than their control and target qubits and thus prevent the cancellation of any pair of quantum operations surrounding them.
+        if (!quantumOperation.isStandardOperation() || std::ranges::any_of(qubitsOfQuantumOperation, [&](const qc::Qubit qubit) { return !isQubitWithinRange(qubit); })) {
+            for (auto& quantumOperationsOfQubit: quantumOperationsAccessingQubit) {
+                quantumOperationsOfQubit.clear();
+            }
+            continue;
+        }
+
+        if (isSelfInverseQuantumOperation(quantumOperation) && !quantumOperationsAccessingQubit[qubitsOfQuantumOperation.front()].empty()) {
+            const std::size_t indexOfCancellationCandidate = quantumOperationsAccessingQubit[qubitsOfQuantumOperation.front()].back();
+            if (areSelfInverseQuantumOperationsIdentical(*ops[indexOfCancellationCandidate], quantumOperation) && std::ranges::all_of(qubitsOfQuantumOperation, [&](const qc::Qubit qubit) { return quantumOperationsAccessingQubit[qubit].back() == indexOfCancellationCandidate; })) {
+                for (const qc::Qubit qubit: qubitsOfQuantumOperation) {
+                    quantumOperationsAccessingQubit[qubit].pop_back();
+                }
+                isQuantumOperationCancelled[indexOfCancellationCandidate] = true;
+                isQuantumOperationCancelled[quantumOperationIdx]          = true;
+                numCancelledQuantumOperations += 2U;
+                continue;
+            }
+        }
+
+        for (const qc::Qubit qubit: qubitsOfQuantumOperation) {
+            quantumOperationsAccessingQubit[qubit].emplace_back(quantumOperationIdx);
+        }
+    }
+
+    if (numCancelledQuantumOperations == 0U) {
+        return 0U;
+    }
+
+    std::size_t numRemainingQuantumOperations = 0;
+    for (std::size_t quantumOperationIdx = 0; quantumOperationIdx < getNops(); ++quantumOperationIdx) {
+        if (isQuantumOperationCancelled[quantumOperationIdx]) {
+            updateRecordedSynthesisCostOfQuantumOperation(quantumOperationIdx, false);
+        } else {
+            ops[numRemainingQuantumOperations++] = std::move(ops[quantumOperationIdx]);
+        }
+    }
+    ops.resize(numRemainingQuantumOperations);
+    annotationsPerQuantumOperation.eraseQuantumOperations(isQuantumOperationCancelled);
+    return numCancelledQuantumOperations;
+}
+
+std::size_t AnnotatableQuantumComputation::reorderQuantumOperationsToReduceDepth() {
+    const std::size_t depthPriorToReordering = analyzeDepth().depth;
+
+    // The number of layers up to and including the last layer containing a quantum operation using a qubit as control qubit, as target qubit of a (multi-controlled) X gate or as target qubit of any other quantum operation is recorded per qubit.
+    // The earliest layer of a quantum operation is located after the last layer of every previous quantum operation not commuting with it, with two multi-controlled X gates commuting if the target qubit of neither of them is a control qubit of the other.
+    std::vector<std::size_t>       numLayersUntilLastUsageAsControlQubitPerQubit(getNqubits(), 0);
+    std::vector<std::size_t>       numLayersUntilLastUsageAsTargetQubitOfXGatePerQubit(getNqubits(), 0);
+    std::vector<std::size_t>       numLayersUntilLastUsageAsOtherTargetQubitPerQubit(getNqubits(), 0);
+    std::vector<std::vector<bool>> isLayerOccupiedPerQubit(getNqubits());
+    std::vector<std::size_t>       layerPerQuantumOperation(getNops(), 0);
+    std::size_t                    numLayers                          = 0;
+    std::size_t                    firstLayerAfterLastBarrier         = 0;
+    const auto                     isLayerOccupiedForQubit            = [&](const qc::Qubit qubit, const std::size_t layer) { return layer < isLayerOccupiedPerQubit[qubit].size() && isLayerOccupiedPerQubit[qubit][layer]; };
+    const auto                     doesQuantumOperationAccessAnyQubit = [&](const qc::Operation& quantumOperation, const auto& predicate) {
+        return std::ranges::any_of(quantumOperation.getTargets(), predicate) || std::ranges::any_of(quantumOperation.getControls(), [&](const qc::Control& controlQubit) { return predicate(controlQubit.qubit); });
+    };
+
+    for (std::size_t position = 0; position < getNops(); ++position) {
+        const qc::Operation* quantumOperation = ops[position].get();
+        // Quantum operations that are not standard operations could access other qubits than their control and target qubits and are thus not reordered with respect to any other quantum operation.
+        if (quantumOperation == nullptr || !quantumOperation->isStandardOperation() || doesQuantumOperationAccessAnyQubit(*quantumOperation, [&](const qc::Qubit qubit) { return !isQubitWithinRange(qubit); })) {
+            layerPerQuantumOperation[position] = numLayers;
+            firstLayerAfterLastBarrier         = ++numLayers;
+            continue;
+        }
+
+        const bool  isXGate                 = quantumOperation->getType() == qc::OpType::X && quantumOperation->getParameter().empty();
+        std::size_t layerOfQuantumOperation = firstLayerAfterLastBarrier;
+        for (const qc::Control& controlQubit: quantumOperation->getControls()) {
+            layerOfQuantumOperation = std::max({layerOfQuantumOperation, numLayersUntilLastUsageAsTargetQubitOfXGatePerQubit[controlQubit.qubit], numLayersUntilLastUsageAsOtherTargetQubitPerQubit[controlQubit.qubit]});
+        }
+        for (const qc::Qubit targetQubit: quantumOperation->getTargets()) {
+            layerOfQuantumOperation = std::max({layerOfQuantumOperation, numLayersUntilLastUsageAsControlQubitPerQubit[targetQubit], numLayersUntilLastUsageAsOtherTargetQubitPerQubit[targetQubit], isXGate ? 0U : numLayersUntilLastUsageAsTargetQubitOfXGatePerQubit[targetQubit]});
+        }
+
+        // The quantum operations of a layer must operate on disjoint qubits, thus the quantum operation is placed in the earliest layer not containing a commuting quantum operation sharing a qubit with it.
+        while (doesQuantumOperationAccessAnyQubit(*quantumOperation, [&](const qc::Qubit qubit) { return isLayerOccupiedForQubit(qubit, layerOfQuantumOperation); })) {
+            ++layerOfQuantumOperation;
+        }
+
+        const auto markLayerAsOccupied = [&](const qc::Qubit qubit) {
+            if (isLayerOccupiedPerQubit[qubit].size() <= layerOfQuantumOperation) {
+                isLayerOccupiedPerQubit[qubit].resize(layerOfQuantumOperation + 1U, false);
+            }
+            isLayerOccupiedPerQubit[qubit][layerOfQuantumOperation] = true;
+            return false;
+        };
+        static_cast<void>(doesQuantumOperationAccessAnyQubit(*quantumOperation, markLayerAsOccupied));
+
+        for (const qc::Control& controlQubit: quantumOperation->getControls()) {
+            numLayersUntilLastUsageAsControlQubitPerQubit[controlQubit.qubit] = std::max(numLayersUntilLastUsageAsControlQubitPerQubit[controlQubit.qubit], layerOfQuantumOperation + 1U);
+        }
+        std::vector<std::size_t>& numLayersUntilLastUsageAsTargetQubitPerQubit = isXGate ? numLayersUntilLastUsageAsTargetQubitOfXGatePerQubit : numLayersUntilLastUsageAsOtherTargetQubitPerQubit;
+        for (const qc::Qubit targetQubit: quantumOperation->getTargets()) {
+            numLayersUntilLastUsageAsTargetQubitPerQubit[targetQubit] = std::max(numLayersUntilLastUsageAsTargetQubitPerQubit[targetQubit], layerOfQuantumOperation + 1U);
+        }
+        layerPerQuantumOperation[position] = layerOfQuantumOperation;
+        numLayers                          = std::max(numLayers, layerOfQuantumOperation + 1U);
+    }
+
+    // Sorting the quantum operations by their layer (while keeping the order of the quantum operations of the same layer) preserves the order of every pair of quantum operations that do not commute.
+    std::vector<std::size_t> previousPositionPerPosition(getNops());
+    std::iota(previousPositionPerPosition.begin(), previousPositionPerPosition.end(), 0U);
+    std::ranges::stable_sort(previousPositionPerPosition, std::less{}, [&](const std::size_t position) { return layerPerQuantumOperation[position]; });
+    if (std::ranges::is_sorted(previousPositionPerPosition)) {
+        return 0U;
+    }
+
+    std::vector<std::unique_ptr<qc::Operation>> reorderedQuantumOperations;
+    reorderedQuantumOperations.reserve(getNops());
+    for (const std::size_t previousPosition: previousPositionPerPosition) {
+        reorderedQuantumOperations.emplace_back(std::move(ops[previousPosition]));
+    }
+    ops = std::move(reorderedQuantumOperations);
+    if (generateQuantumOperationAnnotations) {
+        annotationsPerQuantumOperation.reorderQuantumOperations(previousPositionPerPosition);
+    }
+
+    const std::size_t depthAfterReordering = analyzeDepth().depth;
+    return depthPriorToReordering - std::min(depthPriorToReordering, depthAfterReordering);
+}
+
+bool AnnotatableQuantumComputation::groupQuantumOperationsIntoCompoundOperations(const std::vector<QuantumOperationIndexRange>& quantumOperationIndexRanges) {
+    if (generateQuantumOperationAnnotations) {
+        return false;
+    }
+
+    // The sequences are converted to half-open ranges of positions of retained quantum operations and sorted such that a containing range precedes all ranges contained in it.
+    std::vector<std::pair<std::size_t, std::size_t>> positionRanges;
+    positionRanges.reserve(quantumOperationIndexRanges.size());
+    for (const QuantumOperationIndexRange& quantumOperationIndexRange: quantumOperationIndexRanges) {
+        if (quantumOperationIndexRange.numQuantumOperations == 0U) {
+            continue;
+        }
+        const std::optional<std::size_t> positionOfFirstQuantumOperation = determinePositionOfRetainedQuantumOperation(quantumOperationIndexRange.indexOfFirstQuantumOperation);
+        if (!positionOfFirstQuantumOperation.has_value() || quantumOperationIndexRange.numQuantumOperations > getNops() - *positionOfFirstQuantumOperation) {
+            return false;
+        }
+        positionRanges.emplace_back(*positionOfFirstQuantumOperation, *positionOfFirstQuantumOperation + quantumOperationIndexRange.numQuantumOperations);
+    }
+    std::ranges::sort(positionRanges, [](const std::pair<std::size_t, std::size_t>& lRange, const std::pair<std::size_t, std::size_t>& rRange) {
+        return lRange.first != rRange.first ? lRange.first < rRange.first : lRange.second > rRange.second;
+    });
+
+    std::vector<std::size_t> endPositionsOfOpenRanges;
+    for (const auto& [firstPosition, endPosition]: positionRanges) {
+        while (!endPositionsOfOpenRanges.empty() && endPositionsOfOpenRanges.back() <= firstPosition) {
+            endPositionsOfOpenRanges.pop_back();
+        }
+        if (!endPositionsOfOpenRanges.empty() && endPosition > endPositionsOfOpenRanges.back()) {
+            return false;
+        }
+        endPositionsOfOpenRanges.emplace_back(endPosition);
+    }
+    if (positionRanges.empty()) {
+        return true;
+    }
+
+    // The quantum operations of every open range are collected until the end of the range is reached, the compound operation of a closed range is then added to the innermost enclosing open range.
+    std::vector<std::pair<std::size_t, std::vector<std::unique_ptr<qc::Operation>>>> openCompoundOperations;
+    std::vector<std::unique_ptr<qc::Operation>>                                      groupedQuantumOperations;
+    const auto                                                                      getQuantumOperationsOfInnermostOpenRange = [&]() -> std::vector<std::unique_ptr<qc::Operation>>& {
+        return openCompoundOperations.empty() ? groupedQuantumOperations : openCompoundOperations.back().second;
+    };
+
+    auto nextPositionRange = positionRanges.cbegin();
+    for (std::size_t position = 0; position < getNops(); ++position) {
+        for (; nextPositionRange != positionRanges.cend() && nextPositionRange->first == position; ++nextPositionRange) {
+            openCompoundOperations.emplace_back(nextPositionRange->second, std::vector<std::unique_ptr<qc::Operation>>());
+        }
+        getQuantumOperationsOfInnermostOpenRange().emplace_back(std::move(ops[position]));
+        while (!openCompoundOperations.empty() && openCompoundOperations.back().first == position + 1U) {
+            auto compoundOperation = std::make_unique<qc::CompoundOperation>(std::move(openCompoundOperations.back().second));
+            openCompoundOperations.pop_back();
+            getQuantumOperationsOfInnermostOpenRange().emplace_back(std::move(compoundOperation));
+        }
+    }
+    ops = std::move(groupedQuantumOperations);
+    return true;
+}
+
+std::size_t AnnotatableQuantumComputation::flattenCompoundOperations() {
+    if (generateQuantumOperationAnnotations || std::ranges::none_of(ops, [](const std::unique_ptr<qc::Operation>& quantumOperation) { return quantumOperation != nullptr && quantumOperation->isCompoundOperation(); })) {
+        return 0U;
+    }
+
+    std::size_t                                                numFlattenedCompoundOperations = 0;
+    std::vector<std::unique_ptr<qc::Operation>>                flattenedQuantumOperations;
+    std::function<void(std::unique_ptr<qc::Operation>&&)> appendFlattenedQuantumOperation = [&](std::unique_ptr<qc::Operation>&& quantumOperation) {
+        auto* compoundOperation = dynamic_cast<qc::CompoundOperation*>(quantumOperation.get());
+        if (compoundOperation == nullptr) {
+            flattenedQuantumOperations.emplace_back(std::move(quantumOperation));
+            return;
+        }
+        ++numFlattenedCompoundOperations;
+        for (std::unique_ptr<qc::Operation>& nestedQuantumOperation: *compoundOperation) {
+            appendFlattenedQuantumOperation(std::move(nestedQuantumOperation));
+        }
+    };
+    for (std::unique_ptr<qc::Operation>& quantumOperation: ops) {
+        appendFlattenedQuantumOperation(std::move(quantumOperation));
+    }
+    ops = std::move(flattenedQuantumOperations);
+    return numFlattenedCompoundOperations;
+}
+
+std::optional<std::vector<bool>> AnnotatableQuantumComputation::determineQuantumOperationsToControlInControlledSequence(const std::size_t indexOfFirstQuantumOperation, const std::size_t numQuantumOperations) const {
+    if (numQuantumOperations == 0U) {
+        return std::vector<bool>();
+    }
+
+    const std::optional<std::size_t> positionOfFirstQuantumOperation = determinePositionOfRetainedQuantumOperation(indexOfFirstQuantumOperation);
+    if (!positionOfFirstQuantumOperation.has_value() || numQuantumOperations > getNops() - *positionOfFirstQuantumOperation || std::ranges::any_of(ops.cbegin() + static_cast<std::ptrdiff_t>(*positionOfFirstQuantumOperation), ops.cbegin() + static_cast<std::ptrdiff_t>(*positionOfFirstQuantumOperation + numQuantumOperations), [](const std::unique_ptr<qc::Operation>& quantumOperation) { return quantumOperation == nullptr; })) {
+        return std::nullopt;
+    }
+
+    // The offsets of the self-inverse quantum operations in the sequence are recorded in ascending order per hash of their type and qubits, the target qubits are sorted prior to hashing them since the order of the target qubits of a SWAP gate is irrelevant.
+    const auto determineHashOfQuantumOperation = [](const qc::Operation& quantumOperation) {
+        std::size_t hash               = std::hash<int>{}(static_cast<int>(quantumOperation.getType()));
+        qc::Targets sortedTargetQubits = quantumOperation.getTargets();
+        std::ranges::sort(sortedTargetQubits);
+        for (const qc::Qubit targetQubit: sortedTargetQubits) {
+            hashCombine(hash, targetQubit);
+        }
+        for (const qc::Control& controlQubit: quantumOperation.getControls()) {
+            hashCombine(hash, controlQubit.qubit);
+            hashCombine(hash, controlQubit.type == qc::Control::Type::Pos);
+        }
+        return hash;
+    };
+
+    std::vector<std::optional<std::size_t>>                   hashPerOffset(numQuantumOperations);
+    std::unordered_map<std::size_t, std::vector<std::size_t>> offsetsPerHash;
+    for (std::size_t offset = 0; offset < numQuantumOperations; ++offset) {
+        if (const qc::Operation& quantumOperation = *ops[*positionOfFirstQuantumOperation + offset]; isSelfInverseQuantumOperation(quantumOperation)) {
+            hashPerOffset[offset] = determineHashOfQuantumOperation(quantumOperation);
+            offsetsPerHash[*hashPerOffset[offset]].emplace_back(offset);
+        }
+    }
+
+    // Every segment [first, end) of the sequence is processed from left to right with a quantum operation being paired with the last identical quantum operation of the segment, the quantum operations between both are processed as a nested segment.
+    std::vector<bool>                                shouldQuantumOperationBeControlled(numQuantumOperations, true);
+    std::vector<std::pair<std::size_t, std::size_t>> unprocessedSegments{{0U, numQuantumOperations}};
+    while (!unprocessedSegments.empty()) {
+        auto [offset, endOffsetOfSegment] = unprocessedSegments.back();
+        unprocessedSegments.pop_back();
+
+        while (offset < endOffsetOfSegment) {
+            std::optional<std::size_t> offsetOfPairedQuantumOperation;
+            if (hashPerOffset[offset].has_value()) {
+                const qc::Operation&            quantumOperation           = *ops[*positionOfFirstQuantumOperation + offset];
+                const std::vector<std::size_t>& offsetsOfCandidates        = offsetsPerHash.at(*hashPerOffset[offset]);
+                for (auto candidate = std::ranges::lower_bound(offsetsOfCandidates, endOffsetOfSegment); candidate != offsetsOfCandidates.cbegin();) {
+                    --candidate;
+                    if (*candidate <= offset) {
+                        break;
+                    }
+                    if (areSelfInverseQuantumOperationsIdentical(quantumOperation, *ops[*positionOfFirstQuantumOperation + *candidate])) {
+                        offsetOfPairedQuantumOperation = *candidate;
+                        break;
+                    }
+                }
+            }
+
+            if (!offsetOfPairedQuantumOperation.has_value()) {
+                ++offset;
+                continue;
+            }
+            shouldQuantumOperationBeControlled[offset]                          = false;
+            shouldQuantumOperationBeControlled[*offsetOfPairedQuantumOperation] = false;
+            unprocessedSegments.emplace_back(offset + 1U, *offsetOfPairedQuantumOperation);
+            offset = *offsetOfPairedQuantumOperation + 1U;
+        }
+    }
+    return shouldQuantumOperationBeControlled;
+}
+
+std::optional<AnnotatableQuantumComputation::SynthesisCostMetricValue> AnnotatableQuantumComputation::determineQuantumCostOfControlledSequence(const std::size_t indexOfFirstQuantumOperation, const std::vector<bool>& shouldQuantumOperationBeControlled, const std::size_t numAdditionalControlQubits) const {
+    if (shouldQuantumOperationBeControlled.empty()) {
+        return 0U;
+    }
+
+    const std::optional<std::size_t> positionOfFirstQuantumOperation = determinePositionOfRetainedQuantumOperation(indexOfFirstQuantumOperation);
+    if (!positionOfFirstQuantumOperation.has_value() || shouldQuantumOperationBeControlled.size() > getNops() - *positionOfFirstQuantumOperation) {
+        return std::nullopt;
+    }
+
+    SynthesisCostMetricValue cost = 0;
+    for (std::size_t offset = 0; offset < shouldQuantumOperationBeControlled.size(); ++offset) {
+        const qc::Operation* quantumOperation = ops[*positionOfFirstQuantumOperation + offset].get();
+        if (quantumOperation == nullptr) {
+            return std::nullopt;
+        }
+        const std::size_t numControlQubits = quantumOperation->getNcontrols() + (shouldQuantumOperationBeControlled[offset] ? numAdditionalControlQubits : 0U);
+        cost += getQuantumCostForSynthesisOfGate(numControlQubits, quantumOperation->getType() == qc::OpType::SWAP, getNqubits());
+    }
+    return cost;
+}
+
+bool AnnotatableQuantumComputation::addControlQubitsToQuantumOperations(const std::size_t indexOfFirstQuantumOperation, const std::vector<bool>& shouldQuantumOperationBeControlled, const qc::Controls& controlQubits) {
+    if (shouldQuantumOperationBeControlled.empty() || controlQubits.empty()) {
+        return true;
+    }
+
+    const std::optional<std::size_t> positionOfFirstQuantumOperation = determinePositionOfRetainedQuantumOperation(indexOfFirstQuantumOperation);
+    if (!positionOfFirstQuantumOperation.has_value() || shouldQuantumOperationBeControlled.size() > getNops() - *positionOfFirstQuantumOperation || std::ranges::any_of(controlQubits, [&](const qc::Control& controlQubit) { return !isQubitWithinRange(controlQubit.qubit); })) {
+        return false;
+    }
+
+    const auto isControlQubit = [&](const qc::Qubit qubit) { return std::ranges::any_of(controlQubits, [qubit](const qc::Control& controlQubit) { return controlQubit.qubit == qubit; }); };
+    for (std::size_t offset = 0; offset < shouldQuantumOperationBeControlled.size(); ++offset) {
+        const qc::Operation* quantumOperation = ops[*positionOfFirstQuantumOperation + offset].get();
+        if (quantumOperation == nullptr || !quantumOperation->isStandardOperation() || std::ranges::any_of(quantumOperation->getTargets(), isControlQubit)) {
+            return false;
+        }
+        if (shouldQuantumOperationBeControlled[offset] && std::ranges::any_of(quantumOperation->getControls(), [&](const qc::Control& controlQubit) { return isControlQubit(controlQubit.qubit); })) {
+            return false;
+        }
+    }
+
+    for (std::size_t offset = 0; offset < shouldQuantumOperationBeControlled.size(); ++offset) {
+        if (!shouldQuantumOperationBeControlled[offset]) {
+            continue;
+        }
+        const std::size_t position = *positionOfFirstQuantumOperation + offset;
+        updateRecordedSynthesisCostOfQuantumOperation(position, false);
+        for (const qc::Control& controlQubit: controlQubits) {
+            ops[position]->addControl(controlQubit);
+        }
+        updateRecordedSynthesisCostOfQuantumOperation(position, true);
+    }
+    return true;
+}
+
+bool AnnotatableQuantumComputation::streamQuantumOperationsToSink(const QuantumOperationSink::ptr& quantumOperationSink, const std::size_t numRetainedQuantumOperations) {
+    if (quantumOperationSink == nullptr || this->quantumOperationSink != nullptr) {
+        return false;
+    }
+    this->quantumOperationSink                 = quantumOperationSink;
+    numRetainedQuantumOperationsInReplayWindow = numRetainedQuantumOperations;
+    return forwardQuantumOperationsNotInReplayWindowToSink();
+}
+
+bool AnnotatableQuantumComputation::finishStreamingOfQuantumOperations() {
+    if (quantumOperationSink == nullptr) {
+        return false;
+    }
+    const bool couldQuantumOperationsBeForwarded = forwardOldestRetainedQuantumOperationsToSink(getNops());
+    const bool couldSinkFinishProcessing         = quantumOperationSink->finish(getNqubits());
+    quantumOperationSink.reset();
+    return couldQuantumOperationsBeForwarded && couldSinkFinishProcessing;
+}
+
+bool AnnotatableQuantumComputation::isStreamingOfQuantumOperationsActive() const noexcept {
+    return quantumOperationSink != nullptr;
+}
+
+std::size_t AnnotatableQuantumComputation::getNumQuantumOperations() const noexcept {
+    return numForwardedQuantumOperations + getNops();
+}
+
+std::size_t AnnotatableQuantumComputation::getNumForwardedQuantumOperations() const noexcept {
+    return numForwardedQuantumOperations;
+}
+
+AnnotatableQuantumComputation::QuantumOperationAnnotationsLookup AnnotatableQuantumComputation::getAnnotationsOfQuantumOperation(std::size_t indexOfQuantumOperationInQuantumComputation) const {
+    const std::optional<std::size_t> positionOfQuantumOperation = determinePositionOfRetainedQuantumOperation(indexOfQuantumOperationInQuantumComputation);
+    if (!generateQuantumOperationAnnotations || !positionOfQuantumOperation.has_value() || *positionOfQuantumOperation >= annotationsPerQuantumOperation.size()) {
+        return {};
+    }
+    return determineAnnotationsOfRetainedQuantumOperation(*positionOfQuantumOperation);
+}
+
+std::optional<unsigned> AnnotatableQuantumComputation::getStatementLineNumberOfQuantumOperation(const std::size_t indexOfQuantumOperationInQuantumComputation) const {
+    const std::optional<std::size_t> positionOfQuantumOperation = determinePositionOfRetainedQuantumOperation(indexOfQuantumOperationInQuantumComputation);
+    if (!generateQuantumOperationAnnotations || !positionOfQuantumOperation.has_value()) {
+        return std::nullopt;
+    }
+    return annotationsPerQuantumOperation.getStatementLineNumberOfQuantumOperation(*positionOfQuantumOperation);
+}
+
+AnnotatableQuantumComputation::QuantumOperationArrays AnnotatableQuantumComputation::exportQuantumOperationsAsArrays() const {
+    QuantumOperationArrays quantumOperationArrays;
+    quantumOperationArrays.indexOfFirstQuantumOperation = numForwardedQuantumOperations;
+    quantumOperationArrays.opTypes.reserve(getNops());
+    quantumOperationArrays.targetOffsets.reserve(getNops() + 1U);
+    quantumOperationArrays.controlOffsets.reserve(getNops() + 1U);
+    quantumOperationArrays.annotationsIndices.reserve(getNops());
+
+    // Only the sets of annotations referenced by the retained quantum operations are exported with their index being determined by their first occurrence. Since the statement line number is not part of the set of annotations of a
+    // quantum operation, quantum operations with the same set of annotations but different statement line numbers reference different exported sets of annotations.
+    std::map<std::pair<std::size_t, std::optional<unsigned>>, std::size_t> exportedIndexPerAnnotations;
+    for (std::size_t position = 0; position < getNops(); ++position) {
+        const std::size_t             annotationsId       = generateQuantumOperationAnnotations ? annotationsPerQuantumOperation.getAnnotationsIdOfQuantumOperation(position) : 0U;
+        const std::optional<unsigned> statementLineNumber = generateQuantumOperationAnnotations ? annotationsPerQuantumOperation.getStatementLineNumberOfQuantumOperation(position) : std::nullopt;
+        const auto [exportedIndexOfAnnotations, wereAnnotationsInserted] = exportedIndexPerAnnotations.try_emplace(std::make_pair(annotationsId, statementLineNumber), quantumOperationArrays.distinctAnnotations.size());
+        if (wereAnnotationsInserted) {
+            quantumOperationArrays.distinctAnnotations.emplace_back(generateQuantumOperationAnnotations ? determineAnnotationsOfRetainedQuantumOperation(position) : QuantumOperationAnnotationsLookup());
+        }
+
+        // The gates of a compound operation share the annotations of the latter.
+        static_cast<void>(forEachGateOfQuantumOperation(*at(position), [&](const qc::Operation& gate) {
+            quantumOperationArrays.opTypes.emplace_back(static_cast<std::uint8_t>(gate.getType()));
+            quantumOperationArrays.targetQubits.insert(quantumOperationArrays.targetQubits.end(), gate.getTargets().cbegin(), gate.getTargets().cend());
+            quantumOperationArrays.targetOffsets.emplace_back(quantumOperationArrays.targetQubits.size());
+            for (const qc::Control& control: gate.getControls()) {
+                quantumOperationArrays.controlQubits.emplace_back(control.qubit);
+                quantumOperationArrays.isControlPositive.emplace_back(control.type == qc::Control::Type::Pos ? 1U : 0U);
+            }
+            quantumOperationArrays.controlOffsets.emplace_back(quantumOperationArrays.controlQubits.size());
+            quantumOperationArrays.annotationsIndices.emplace_back(exportedIndexOfAnnotations->second);
+            return true;
+        }));
+    }
+    return quantumOperationArrays;
+}
+
+std::shared_ptr<const FrozenQuantumComputation> AnnotatableQuantumComputation::freeze() const {
+    // The constructor of the snapshot is only accessible to this class, thus std::make_shared cannot be used.
+    std::shared_ptr<FrozenQuantumComputation> frozenQuantumComputation(new FrozenQuantumComputation());
+    frozenQuantumComputation->numQubits              = getNqubits();
+    frozenQuantumComputation->quantumOperationArrays = exportQuantumOperationsAsArrays();
+    frozenQuantumComputation->gateOffsets.reserve(getNops() + 1U);
+    for (const std::unique_ptr<qc::Operation>& quantumOperation: ops) {
+        std::uint64_t numGates = 0;
+        if (quantumOperation != nullptr) {
+            static_cast<void>(forEachGateOfQuantumOperation(*quantumOperation, [&numGates](const qc::Operation&) {
+                ++numGates;
+                return true;
+            }));
+        }
+        frozenQuantumComputation->gateOffsets.emplace_back(frozenQuantumComputation->gateOffsets.back() + numGates);
+    }
+
+    frozenQuantumComputation->statementLineNumberPerDistinctAnnotations.reserve(frozenQuantumComputation->quantumOperationArrays.distinctAnnotations.size());
+    for (const QuantumOperationAnnotationsLookup& annotations: frozenQuantumComputation->quantumOperationArrays.distinctAnnotations) {
+        const auto statementLineNumberAnnotation = annotations.find(QUANTUM_OPERATION_ANNOTATION_KEY_ASSOCIATED_STATEMENT_LINE_NUMBER);
+        frozenQuantumComputation->statementLineNumberPerDistinctAnnotations.emplace_back(statementLineNumberAnnotation != annotations.end() ? tryParseStatementLineNumber(statementLineNumberAnnotation->second) : std::nullopt);
+    }
+
+    frozenQuantumComputation->internalQubitLabels                 = getQubitLabels(QubitLabelType::Internal);
+    frozenQuantumComputation->userDeclaredQubitLabels             = getQubitLabels(QubitLabelType::UserDeclared);
+    frozenQuantumComputation->ancillary                           = getAncillary();
+    frozenQuantumComputation->garbage                             = getGarbage();
+    frozenQuantumComputation->quantumCost                         = getQuantumCostForSynthesis();
+    frozenQuantumComputation->transistorCost                      = getTransistorCostForSynthesis();
+    frozenQuantumComputation->synthesisCostPerStatementLineNumber = getSynthesisCostPerStatementLineNumber();
+    return frozenQuantumComputation;
+}
+
+void AnnotatableQuantumComputation::recordMemoryUsage(MemoryUsage& memoryUsage) const {
+    memoryUsage.numBytesOfQuantumOperations = memory_accounting::numBytesOfHeapStorage(ops);
+    for (const std::unique_ptr<qc::Operation>& quantumOperation: ops) {
+        memoryUsage.numBytesOfQuantumOperations += quantumOperation != nullptr ? determineNumBytesOfQuantumOperation(*quantumOperation) : 0U;
+    }
+    memoryUsage.numBytesOfQuantumOperationAnnotations = annotationsPerQuantumOperation.determineNumBytes();
+
+    // The inline stacks are shared by the qubits of a quantum register or qubit range and thus only counted once per distinct stack.
+    std::unordered_set<const QubitInliningStack*> countedInlineStacks;
+    std::size_t                                   numBytesOfQuantumRegisterLayouts = memory_accounting::numBytesOfHeapStorage(quantumRegisterAssociatedVariableLayouts) + memory_accounting::numBytesOfHeapStorage(indexOfVariableLayoutPerQubit) + memory_accounting::numBytesOfHeapStorage(qubitInVariableLayoutsPerQubit);
+    std::size_t                                   numBytesOfInlineStacks           = 0;
+    const auto                                    countInlinedQubitInformation     = [&](const InlinedQubitInformation& inlinedQubitInformation) {
+        numBytesOfQuantumRegisterLayouts += inlinedQubitInformation.userDeclaredQubitLabel.has_value() ? memory_accounting::numBytesOfHeapStorage(*inlinedQubitInformation.userDeclaredQubitLabel) : 0U;
+        if (inlinedQubitInformation.inlineStack.has_value() && *inlinedQubitInformation.inlineStack != nullptr && countedInlineStacks.emplace(inlinedQubitInformation.inlineStack->get()).second) {
+            numBytesOfInlineStacks += (*inlinedQubitInformation.inlineStack)->determineNumBytes() + memory_accounting::NUM_BYTES_OF_SHARED_POINTER_CONTROL_BLOCK;
+        }
+    };
+
+    for (const std::unique_ptr<BaseQuantumRegisterVariableLayout>& quantumRegisterVariableLayout: quantumRegisterAssociatedVariableLayouts) {
+        numBytesOfQuantumRegisterLayouts += memory_accounting::numBytesOfHeapStorage(quantumRegisterVariableLayout->quantumRegisterLabel);
+        if (const auto* nonAncillaryVariableLayout = dynamic_cast<const NonAncillaryQuantumRegisterVariableLayout*>(quantumRegisterVariableLayout.get()); nonAncillaryVariableLayout != nullptr) {
+            numBytesOfQuantumRegisterLayouts += sizeof(NonAncillaryQuantumRegisterVariableLayout) + memory_accounting::numBytesOfHeapStorage(nonAncillaryVariableLayout->numValuesPerDimensionOfVariable) + memory_accounting::numBytesOfHeapStorage(nonAncillaryVariableLayout->offsetToNextElementInDimensionMeasuredInNumberOfVariableBitwidths);
+            if (nonAncillaryVariableLayout->optionalSharedInlinedQubitInformation.has_value()) {
+                countInlinedQubitInformation(*nonAncillaryVariableLayout->optionalSharedInlinedQubitInformation);
+            }
+        } else if (const auto* ancillaryVariableLayout = dynamic_cast<const AncillaryQuantumRegisterVariableLayout*>(quantumRegisterVariableLayout.get()); ancillaryVariableLayout != nullptr) {
+            numBytesOfQuantumRegisterLayouts += sizeof(AncillaryQuantumRegisterVariableLayout) + memory_accounting::numBytesOfHeapStorage(ancillaryVariableLayout->sharedQubitRangeInlineInformationLookup);
+            for (const AncillaryQuantumRegisterVariableLayout::SharedQubitRangeInlineInformation& sharedQubitRangeInlineInformation: ancillaryVariableLayout->sharedQubitRangeInlineInformationLookup) {
+                countInlinedQubitInformation(sharedQubitRangeInlineInformation.inlinedQubitInformation);
+            }
+        }
+    }
+    memoryUsage.numBytesOfQuantumRegisterLayouts = numBytesOfQuantumRegisterLayouts;
+    memoryUsage.numBytesOfInlineStacks           = numBytesOfInlineStacks;
+}
+
+AnnotatableQuantumComputation::SynthesisCostMetricValue AnnotatableQuantumComputation::getQuantumCostForSynthesis() const {
+    return recordedSynthesisCostOfRetainedQuantumOperations.determineQuantumCost(getNqubits());
+}
+
+AnnotatableQuantumComputation::SynthesisCostMetricValue AnnotatableQuantumComputation::getTransistorCostForSynthesis() const {
+    return recordedSynthesisCostOfRetainedQuantumOperations.transistorCost;
+}
+
+std::map<std::string, AnnotatableQuantumComputation::SynthesisCost, std::less<>> AnnotatableQuantumComputation::getSynthesisCostPerStatementLineNumber() const {
+    std::map<std::string, SynthesisCost, std::less<>> synthesisCostPerStatementLineNumber;
+    for (const auto& [statementLineNumber, recordedSynthesisCost]: recordedSynthesisCostPerStatementLineNumber) {
+        synthesisCostPerStatementLineNumber.emplace(std::to_string(statementLineNumber), SynthesisCost{.quantumCost = recordedSynthesisCost.determineQuantumCost(getNqubits()), .transistorCost = recordedSynthesisCost.transistorCost});
+    }
+    return synthesisCostPerStatementLineNumber;
+}
+
+AnnotatableQuantumComputation::DepthAnalysis AnnotatableQuantumComputation::analyzeDepth() const {
+    DepthAnalysis depthAnalysis;
+    depthAnalysis.numQuantumOperationsPerQubit.resize(getNqubits(), 0);
+    depthAnalysis.layerPerQuantumOperation.reserve(getNops());
+
+    // The number of layers and the position of the last quantum operation operating on every qubit are recorded, the predecessor of a quantum operation on the critical path is the last quantum operation of the qubit determining its layer.
+    std::vector<std::size_t>                numLayersPerQubit(getNqubits(), 0);
+    std::vector<std::optional<std::size_t>> positionOfLastQuantumOperationPerQubit(getNqubits(), std::nullopt);
+    std::vector<std::optional<std::size_t>> positionOfPredecessorOnLongestPathPerQuantumOperation(getNops(), std::nullopt);
+    std::vector<qc::Qubit>                  qubitsOfQuantumOperation;
+    std::optional<std::size_t>              positionOfLastQuantumOperationOfCriticalPath;
+
+    for (std::size_t position = 0; position < getNops(); ++position) {
+        qubitsOfQuantumOperation.clear();
+        if (const qc::Operation* quantumOperation = ops[position].get(); quantumOperation != nullptr) {
+            static_cast<void>(forEachGateOfQuantumOperation(*quantumOperation, [&](const qc::Operation& gate) {
+                qubitsOfQuantumOperation.insert(qubitsOfQuantumOperation.end(), gate.getTargets().cbegin(), gate.getTargets().cend());
+                std::ranges::transform(gate.getControls(), std::back_inserter(qubitsOfQuantumOperation), [](const qc::Control& controlQubit) { return controlQubit.qubit; });
+                return true;
+            }));
+            std::erase_if(qubitsOfQuantumOperation, [&](const qc::Qubit qubit) { return !isQubitWithinRange(qubit); });
+            if (quantumOperation->isCompoundOperation()) {
+                std::ranges::sort(qubitsOfQuantumOperation);
+                qubitsOfQuantumOperation.erase(std::ranges::unique(qubitsOfQuantumOperation).begin(), qubitsOfQuantumOperation.end());
+            }
+        }
+
+        std::size_t layerOfQuantumOperation = 0;
+        for (const qc::Qubit qubit: qubitsOfQuantumOperation) {
+            if (numLayersPerQubit[qubit] > layerOfQuantumOperation) {
+                layerOfQuantumOperation                                         = numLayersPerQubit[qubit];
+                positionOfPredecessorOnLongestPathPerQuantumOperation[position] = positionOfLastQuantumOperationPerQubit[qubit];
+            }
+        }
+        for (const qc::Qubit qubit: qubitsOfQuantumOperation) {
+            numLayersPerQubit[qubit]                      = layerOfQuantumOperation + 1U;
+            positionOfLastQuantumOperationPerQubit[qubit] = position;
+            ++depthAnalysis.numQuantumOperationsPerQubit[qubit];
+        }
+        depthAnalysis.layerPerQuantumOperation.emplace_back(layerOfQuantumOperation);
+
+        if (layerOfQuantumOperation + 1U > depthAnalysis.depth) {
+            depthAnalysis.depth                          = layerOfQuantumOperation + 1U;
+            positionOfLastQuantumOperationOfCriticalPath = position;
+        }
+    }
+
+    for (std::optional<std::size_t> position = positionOfLastQuantumOperationOfCriticalPath; position.has_value(); position = positionOfPredecessorOnLongestPathPerQuantumOperation[*position]) {
+        depthAnalysis.indicesOfQuantumOperationsOfCriticalPath.emplace_back(*position + numForwardedQuantumOperations);
+        if (!generateQuantumOperationAnnotations) {
+            continue;
+        }
+
+        if (const std::optional<unsigned> statementLineNumber = annotationsPerQuantumOperation.getStatementLineNumberOfQuantumOperation(*position); statementLineNumber.has_value()) {
+            ++depthAnalysis.numQuantumOperationsOfCriticalPathPerStatementLineNumber[std::to_string(*statementLineNumber)];
+        }
+    }
+    std::ranges::reverse(depthAnalysis.indicesOfQuantumOperationsOfCriticalPath);
+    return depthAnalysis;
+}
+
+AnnotatableQuantumComputation::QuantumOperationLayout AnnotatableQuantumComputation::determineLayoutOfQuantumOperations() const {
+    QuantumOperationLayout layout;
+    layout.columnPerGate.reserve(getNops());
+    layout.minQubitPerGate.reserve(getNops());
+    layout.maxQubitPerGate.reserve(getNops());
+
+    // The first column in which a gate spanning a qubit can be placed is recorded for every qubit, a gate is placed in the largest of these columns over all qubits of its span.
+    std::vector<std::uint64_t> firstFreeColumnPerQubit(getNqubits(), 0);
+    for (const auto& quantumOperation: ops) {
+        if (quantumOperation == nullptr) {
+            continue;
+        }
+
+        static_cast<void>(forEachGateOfQuantumOperation(*quantumOperation, [&](const qc::Operation& gate) {
+            std::optional<qc::Qubit> minQubit;
+            std::optional<qc::Qubit> maxQubit;
+            const auto               extendSpan = [&](const qc::Qubit qubit) {
+                if (isQubitWithinRange(qubit)) {
+                    minQubit = std::min(qubit, minQubit.value_or(qubit));
+                    maxQubit = std::max(qubit, maxQubit.value_or(qubit));
+                }
+            };
+            std::ranges::for_each(gate.getTargets(), extendSpan);
+            std::ranges::for_each(gate.getControls(), [&](const qc::Control& controlQubit) { extendSpan(controlQubit.qubit); });
+
+            std::uint64_t column = 0;
+            if (minQubit.has_value() && maxQubit.has_value()) {
+                const auto spannedQubits = std::ranges::subrange(firstFreeColumnPerQubit.begin() + *minQubit, firstFreeColumnPerQubit.begin() + *maxQubit + 1);
+                column                   = std::ranges::max(spannedQubits);
+                std::ranges::fill(spannedQubits, column + 1U);
+            }
+            layout.columnPerGate.emplace_back(column);
+            layout.minQubitPerGate.emplace_back(minQubit.value_or(0U));
+            layout.maxQubitPerGate.emplace_back(maxQubit.value_or(0U));
+            layout.numColumns = std::max(layout.numColumns, static_cast<std::size_t>(column) + 1U);
+            return true;
+        }));
+    }
+
+    // The gates are ordered by their column using a counting sort, with the gates of a column retaining their relative order in the quantum computation.
+    layout.columnOffsets.assign(layout.numColumns + 1U, 0U);
+    for (const std::uint64_t column: layout.columnPerGate) {
+        ++layout.columnOffsets[column + 1U];
+    }
+    std::partial_sum(layout.columnOffsets.cbegin(), layout.columnOffsets.cend(), layout.columnOffsets.begin());
+
+    std::vector<std::uint64_t> nextPositionPerColumn(layout.columnOffsets.cbegin(), layout.columnOffsets.cend() - 1);
+    layout.gatesOrderedByColumn.resize(layout.columnPerGate.size());
+    for (std::size_t gateIndex = 0; gateIndex < layout.columnPerGate.size(); ++gateIndex) {
+        layout.gatesOrderedByColumn[nextPositionPerColumn[layout.columnPerGate[gateIndex]]++] = gateIndex;
+    }
+    return layout;
+}
+
+AnnotatableQuantumComputation::SynthesisCostMetricValue AnnotatableQuantumComputation::determineNearestNeighborCost() const {
+    SynthesisCostMetricValue nearestNeighborCost = 0;
+    std::vector<qc::Qubit>   qubitsOfGate;
+    for (const auto& quantumOperation: ops) {
+        if (quantumOperation == nullptr) {
+            continue;
+        }
+
+        static_cast<void>(forEachGateOfQuantumOperation(*quantumOperation, [&](const qc::Operation& gate) {
+            qubitsOfGate.assign(gate.getTargets().cbegin(), gate.getTargets().cend());
+            std::ranges::transform(gate.getControls(), std::back_inserter(qubitsOfGate), [](const qc::Control& controlQubit) { return controlQubit.qubit; });
+            std::ranges::sort(qubitsOfGate);
+            qubitsOfGate.erase(std::ranges::unique(qubitsOfGate).begin(), qubitsOfGate.end());
+            nearestNeighborCost += getNearestNeighborCostOfGate(qubitsOfGate);
+            return true;
+        }));
+    }
+    return nearestNeighborCost;
+}
+
+bool AnnotatableQuantumComputation::forEachGateOfQuantumOperation(const qc::Operation& quantumOperation, const std::function<bool(const qc::Operation&)>& callback) {
+    const auto* compoundOperation = dynamic_cast<const qc::CompoundOperation*>(&quantumOperation);
+    if (compoundOperation == nullptr) {
+        return callback(quantumOperation);
+    }
+    return std::ranges::all_of(*compoundOperation, [&](const std::unique_ptr<qc::Operation>& nestedQuantumOperation) { return nestedQuantumOperation != nullptr && forEachGateOfQuantumOperation(*nestedQuantumOperation, callback); });
+}
+
+AnnotatableQuantumComputation::SynthesisCostMetricValue AnnotatableQuantumComputation::getQuantumCostForSynthesisOfGate(const std::size_t numControlQubits, const bool isSwapGate, const std::size_t numQubits) {
+    if (numQubits == 0) {
+        return 0;
+    }
+
+    SynthesisCostMetricValue cost          = 0;
+    const std::size_t        c             = std::min(numControlQubits + static_cast<std::size_t>(isSwapGate), numQubits - 1);
+    const std::size_t        numEmptyLines = numQubits - c - 1U;
+
+    switch (c) {
+        case 0U:
+        case 1U:
+            cost += 1ULL;
+            break;
+        case 2U:
+            cost += 5ULL;
+            break;
+        case 3U:
+            cost += 13ULL;
+            break;
+        case 4U:
+            cost += (numEmptyLines >= 2U) ? 26ULL : 29ULL;
+            break;
+        case 5U:
+            if (numEmptyLines >= 3U) {
+                cost += 38ULL;
+            } else if (numEmptyLines >= 1U) {
+                cost += 52ULL;
+            } else {
+                cost += 61ULL;
+            }
+            break;
+        case 6U:
+            if (numEmptyLines >= 4U) {
+                cost += 50ULL;
+            } else if (numEmptyLines >= 1U) {
+                cost += 80ULL;
+            } else {
+                cost += 125ULL;
+            }
+            break;
+        case 7U:
+            if (numEmptyLines >= 5U) {
+                cost += 62ULL;
+            } else if (numEmptyLines >= 1U) {
+                cost += 100ULL;
+            } else {
+                cost += 253ULL;
+            }
+            break;
+        default:
+            if (numEmptyLines >= c - 2U) {
+                cost += 12ULL * c - 22ULL;
+            } else if (numEmptyLines >= 1U) {
+                cost += 24ULL * c - 87ULL;
+            } else {
+                cost += (1ULL << (c + 1ULL)) - 3ULL;
+            }
+    }
+    return cost;
+}
+
+AnnotatableQuantumComputation::SynthesisCostMetricValue AnnotatableQuantumComputation::getTransistorCostForSynthesisOfGate(const std::size_t numControlQubits) {
+    return numControlQubits * 8;
+}
+
+AnnotatableQuantumComputation::SynthesisCostMetricValue AnnotatableQuantumComputation::getNearestNeighborCostOfGate(const std::span<const qc::Qubit> sortedPositionsOfQubits) {
+    if (sortedPositionsOfQubits.size() < 2U) {
+        return 0;
+    }
+
+    // Moving the i-th qubit to the position m + i requires |p_i - i - m| SWAP gates, the sum of which is minimal for m being the median of the values p_i - i (which are sorted since the positions are distinct).
+    const auto               offsetOfQubit = [&](const std::size_t i) { return static_cast<SynthesisCostMetricValue>(sortedPositionsOfQubits[i]) - i; };
+    const auto               medianOffset  = offsetOfQubit(sortedPositionsOfQubits.size() / 2U);
+    SynthesisCostMetricValue cost          = 0;
+    for (std::size_t i = 0; i < sortedPositionsOfQubits.size(); ++i) {
+        const SynthesisCostMetricValue offset = offsetOfQubit(i);
+        cost += offset > medianOffset ? offset - medianOffset : medianOffset - offset;
+    }
+    return cost;
+}
+
+void AnnotatableQuantumComputation::activateControlQubitPropagationScope() {
+    controlQubitPropagationScopes.emplace_back();
+}
+
+void AnnotatableQuantumComputation::deactivateControlQubitPropagationScope() {
+    if (controlQubitPropagationScopes.empty()) {
+        return;
+    }
+
+    const auto& localControlLineScope = controlQubitPropagationScopes.back();
+    for (const auto& [controlLine, polarityOfControlLineInParentScope]: localControlLineScope) {
+        removeControlQubitFromPropagatedOnes(controlLine);
+        if (polarityOfControlLineInParentScope.has_value()) {
+            // Control lines registered prior to the local scope and deactivated by the latter should still be registered, with their previous polarity, in the parent
+            // scope after the local one was deactivated.
+            aggregateOfPropagatedControlQubits.emplace(controlLine);
+            propagatedControlQubits.emplace(qc::Control{controlLine, *polarityOfControlLineInParentScope});
+            if (*polarityOfControlLineInParentScope == qc::Control::Type::Neg) {
+                negativePropagatedControlQubits.emplace(controlLine);
+            }
+        }
+    }
+    controlQubitPropagationScopes.pop_back();
+}
+
+bool AnnotatableQuantumComputation::deregisterControlQubitFromPropagationInCurrentScope(const qc::Qubit controlQubit) {
+    if (controlQubitPropagationScopes.empty() || !isQubitWithinRange(controlQubit)) {
+        return false;
+    }
+
+    auto& localControlLineScope = controlQubitPropagationScopes.back();
+    if (!localControlLineScope.contains(controlQubit)) {
+        return false;
+    }
+
+    removeControlQubitFromPropagatedOnes(controlQubit);
+    return true;
+}
+
+bool AnnotatableQuantumComputation::registerControlQubitForPropagationInCurrentAndNestedScopes(const qc::Qubit controlQubit, const qc::Control::Type controlQubitType) {
+    if (!isQubitWithinRange(controlQubit)) {
+        return false;
+    }
+
+    if (controlQubitPropagationScopes.empty()) {
+        activateControlQubitPropagationScope();
+    }
+
+    auto& localControlLineScope = controlQubitPropagationScopes.back();
+    // If an entry for the to be registered control line already exists in the current scope then the previously determine value of the flag indicating whether the control line existed in the parent scope
+    // should have the same value that it had when the control line was initially added to the current scope
+
+    if (!localControlLineScope.contains(controlQubit)) {
+        localControlLineScope.emplace(controlQubit, getPolarityOfPropagatedControlQubit(controlQubit));
+    }
+    removeControlQubitFromPropagatedOnes(controlQubit);
+    aggregateOfPropagatedControlQubits.emplace(controlQubit);
+    propagatedControlQubits.emplace(qc::Control{controlQubit, controlQubitType});
+    if (controlQubitType == qc::Control::Type::Neg) {
+        negativePropagatedControlQubits.emplace(controlQubit);
+    }
+    return true;
+}
+
+const std::unordered_set<qc::Qubit>& AnnotatableQuantumComputation::getAggregateOfPropagatedControlQubits() const noexcept {
+    return aggregateOfPropagatedControlQubits;
+}
+
+const qc::Controls& AnnotatableQuantumComputation::getPropagatedControlQubits() const noexcept {
+    return propagatedControlQubits;
+}
+
+void AnnotatableQuantumComputation::removeGateLocalControlQubitFromPropagatedOnes(const qc::Control& gateLocalControlQubit) {
+    if (getPolarityOfPropagatedControlQubit(gateLocalControlQubit.qubit) != gateLocalControlQubit.type) {
+        propagatedControlQubits.erase(gateLocalControlQubit);
+    }
+}
+
+std::optional<qc::Control::Type> AnnotatableQuantumComputation::getPolarityOfPropagatedControlQubit(const qc::Qubit controlQubit) const {
+    if (!aggregateOfPropagatedControlQubits.contains(controlQubit)) {
+        return std::nullopt;
+    }
+    return negativePropagatedControlQubits.contains(controlQubit) ? qc::Control::Type::Neg : qc::Control::Type::Pos;
+}
+
+void AnnotatableQuantumComputation::removeControlQubitFromPropagatedOnes(const qc::Qubit controlQubit) {
+    aggregateOfPropagatedControlQubits.erase(controlQubit);
+    negativePropagatedControlQubits.erase(controlQubit);
+    propagatedControlQubits.erase(qc::Control{controlQubit, qc::Control::Type::Pos});
+    propagatedControlQubits.erase(qc::Control{controlQubit, qc::Control::Type::Neg});
+}
+
+bool AnnotatableQuantumComputation::setOrUpdateGlobalQuantumOperationAnnotation(const std::string_view& key, const std::string& value) {
+    if (!generateQuantumOperationAnnotations) {
+        return false;
+    }
+    if (key == QUANTUM_OPERATION_ANNOTATION_KEY_ASSOCIATED_STATEMENT_LINE_NUMBER) {
+        const std::optional<unsigned> statementLineNumber = tryParseStatementLineNumber(value);
+        return statementLineNumber.has_value() && setOrUpdateGlobalStatementLineNumber(*statementLineNumber);
+    }
+
+    auto existingAnnotationForKey = activateGlobalQuantumOperationAnnotations.find(key);
+    if (existingAnnotationForKey != activateGlobalQuantumOperationAnnotations.end()) {
+        existingAnnotationForKey->second = value;
+        return true;
+    }
+    activateGlobalQuantumOperationAnnotations.emplace(static_cast<std::string>(key), value);
+    return false;
+}
+
+bool AnnotatableQuantumComputation::removeGlobalQuantumOperationAnnotation(const std::string_view& key) {
+    if (!generateQuantumOperationAnnotations) {
+        return false;
+    }
+    if (key == QUANTUM_OPERATION_ANNOTATION_KEY_ASSOCIATED_STATEMENT_LINE_NUMBER) {
+        return removeGlobalStatementLineNumber();
+    }
+
+    // We utilize the ability to use a std::string_view to erase a matching element
+    // of std::string in a std::map<std::string, ...> without needing to cast the
+    // std::string_view to std::string for the std::map<>::erase() operation
+    // (see further: https://www.open-std.org/jtc1/sc22/wg21/docs/papers/2021/p2077r3.html)
+    auto existingAnnotationForKey = activateGlobalQuantumOperationAnnotations.find(key);
+    if (existingAnnotationForKey != activateGlobalQuantumOperationAnnotations.end()) {
+        activateGlobalQuantumOperationAnnotations.erase(existingAnnotationForKey);
+        return true;
+    }
+    return false;
+}
+
+std::optional<std::string> AnnotatableQuantumComputation::getGlobalQuantumOperationAnnotation(const std::string_view& key) const {
+    if (!generateQuantumOperationAnnotations) {
+        return std::nullopt;
+    }
+    if (key == QUANTUM_OPERATION_ANNOTATION_KEY_ASSOCIATED_STATEMENT_LINE_NUMBER) {
+        return activeGlobalStatementLineNumber.has_value() ? std::make_optional(std::to_string(*activeGlobalStatementLineNumber)) : std::nullopt;
+    }
+
+    const auto existingAnnotationForKey = activateGlobalQuantumOperationAnnotations.find(key);
+    return existingAnnotationForKey != activateGlobalQuantumOperationAnnotations.cend() ? std::make_optional(existingAnnotationForKey->second) : std::nullopt;
+}
+
+bool AnnotatableQuantumComputation::setOrUpdateGlobalStatementLineNumber(const unsigned statementLineNumber) {
+    if (!generateQuantumOperationAnnotations) {
+        return false;
+    }
+
+    const bool wasExistingStatementLineNumberUpdated = activeGlobalStatementLineNumber.has_value();
+    activeGlobalStatementLineNumber                  = statementLineNumber;
+    return wasExistingStatementLineNumberUpdated;
+}
+
+bool AnnotatableQuantumComputation::removeGlobalStatementLineNumber() {
+    if (!generateQuantumOperationAnnotations || !activeGlobalStatementLineNumber.has_value()) {
+        return false;
+    }
+    activeGlobalStatementLineNumber.reset();
+    return true;
+}
+
+std::optional<unsigned> AnnotatableQuantumComputation::getGlobalStatementLineNumber() const {
+    return generateQuantumOperationAnnotations ? activeGlobalStatementLineNumber : std::nullopt;
+}
+
+bool AnnotatableQuantumComputation::setOrUpdateAnnotationOfQuantumOperation(std::size_t indexOfQuantumOperationInQuantumComputation, const std::string_view& annotationKey, const std::string& annotationValue) {
+    const std::optional<std::size_t> positionOfQuantumOperation = determinePositionOfRetainedQuantumOperation(indexOfQuantumOperationInQuantumComputation);
+    if (!generateQuantumOperationAnnotations || !positionOfQuantumOperation.has_value() || *positionOfQuantumOperation >= annotationsPerQuantumOperation.size()) {
+        return false;
+    }
+    if (annotationKey == QUANTUM_OPERATION_ANNOTATION_KEY_ASSOCIATED_STATEMENT_LINE_NUMBER) {
+        // The synthesis cost attributed to the previous statement line number of the quantum operation needs to be moved to the new one.
+        const std::optional<unsigned> statementLineNumber = tryParseStatementLineNumber(annotationValue);
+        if (!statementLineNumber.has_value()) {
+            return false;
+        }
+        updateRecordedSynthesisCostOfQuantumOperation(*positionOfQuantumOperation, false);
+        annotationsPerQuantumOperation.setOrUpdateAnnotationsOfQuantumOperations(*positionOfQuantumOperation, *positionOfQuantumOperation, {}, {}, statementLineNumber);
+        updateRecordedSynthesisCostOfQuantumOperation(*positionOfQuantumOperation, true);
+        return true;
+    }
+
+    return annotationsPerQuantumOperation.setOrUpdateAnnotationOfQuantumOperation(*positionOfQuantumOperation, annotationKey, annotationValue);
+}
+
+std::optional<AnnotatableQuantumComputation::InlinedQubitInformation> AnnotatableQuantumComputation::getInlinedQubitInformation(const qc::Qubit qubit) const {
+    const qc::Qubit                                                                   qubitInVariableLayouts                          = determineQubitInVariableLayouts(qubit);
+    const std::optional<std::size_t>                                                  indexOfQuantumRegisterContainingQubit           = determineIndexOfQuantumRegisterStoringQubit(qubitInVariableLayouts);
+    const std::optional<BaseQuantumRegisterVariableLayout::QubitInVariableLayoutData> associatedVariableForQubitDataInQuantumRegister = indexOfQuantumRegisterContainingQubit.has_value() ? quantumRegisterAssociatedVariableLayouts.at(*indexOfQuantumRegisterContainingQubit)->determineQubitInVariableLayoutData(qubitInVariableLayouts) : std::nullopt;
+    if (!associatedVariableForQubitDataInQuantumRegister.has_value() || !associatedVariableForQubitDataInQuantumRegister->inlinedQubitInformation.has_value()) {
+        return std::nullopt;
+    }
+
+    InlinedQubitInformation qubitInlineInformation = associatedVariableForQubitDataInQuantumRegister->inlinedQubitInformation.value();
+    // The user declared qubit label stored in the qubit inline information of the quantum register only stores the identifier of the associated SyReC variable but no information about where in the variable the qubit is stored.
+    qubitInlineInformation.userDeclaredQubitLabel = getQubitLabel(qubit, UserDeclared);
+    return qubitInlineInformation;
+}
+
+// BEGIN NON-PUBLIC FUNCTIONALITY
+bool AnnotatableQuantumComputation::isQubitWithinRange(const qc::Qubit qubit) const noexcept {
+    return qubit < getNqubits();
+}
+
+AnnotatableQuantumComputation::QuantumOperationAnnotationsLookup AnnotatableQuantumComputation::determineAnnotationsOfRetainedQuantumOperation(const std::size_t position) const {
+    QuantumOperationAnnotationsLookup annotations = annotationsPerQuantumOperation.getAnnotationsOfQuantumOperation(position);
+    if (const std::optional<unsigned> statementLineNumber = annotationsPerQuantumOperation.getStatementLineNumberOfQuantumOperation(position); statementLineNumber.has_value()) {
+        annotations.insert_or_assign(std::string(QUANTUM_OPERATION_ANNOTATION_KEY_ASSOCIATED_STATEMENT_LINE_NUMBER), std::to_string(*statementLineNumber));
+    }
+    return annotations;
+}
+
+std::optional<std::size_t> AnnotatableQuantumComputation::determinePositionOfRetainedQuantumOperation(const std::size_t indexOfQuantumOperationInQuantumComputation) const noexcept {
+    if (indexOfQuantumOperationInQuantumComputation < numForwardedQuantumOperations || indexOfQuantumOperationInQuantumComputation - numForwardedQuantumOperations >= getNops()) {
+        return std::nullopt;
+    }
+    return indexOfQuantumOperationInQuantumComputation - numForwardedQuantumOperations;
+}
+
+bool AnnotatableQuantumComputation::forwardQuantumOperationsNotInReplayWindowToSink() {
+    // Forwarding the quantum operations in batches prevents the shift of all retained quantum operations whenever a single quantum operation is added to the quantum computation.
+    if (quantumOperationSink == nullptr || getNops() <= 2U * numRetainedQuantumOperationsInReplayWindow) {
+        return true;
+    }
+    return forwardOldestRetainedQuantumOperationsToSink(getNops() - numRetainedQuantumOperationsInReplayWindow);
+}
+
+bool AnnotatableQuantumComputation::forwardOldestRetainedQuantumOperationsToSink(const std::size_t numQuantumOperationsToForward) {
+    if (quantumOperationSink == nullptr || numQuantumOperationsToForward == 0U) {
+        return true;
+    }
+
+    // Consecutive quantum operations usually share both their annotations and statement line number, thus the annotations forwarded to the sink are only determined again if either of them changed.
+    bool                                                           couldQuantumOperationsBeConsumed = true;
+    std::optional<std::pair<std::size_t, std::optional<unsigned>>> annotationsOfLastForwardedQuantumOperationKey;
+    QuantumOperationAnnotationsLookup                              annotationsOfLastForwardedQuantumOperation;
+    for (std::size_t i = 0; i < numQuantumOperationsToForward && couldQuantumOperationsBeConsumed; ++i) {
+        const auto annotationsKey = std::make_pair(annotationsPerQuantumOperation.getAnnotationsIdOfQuantumOperation(i), annotationsPerQuantumOperation.getStatementLineNumberOfQuantumOperation(i));
+        if (annotationsKey != annotationsOfLastForwardedQuantumOperationKey) {
+            annotationsOfLastForwardedQuantumOperation    = determineAnnotationsOfRetainedQuantumOperation(i);
+            annotationsOfLastForwardedQuantumOperationKey = annotationsKey;
+        }
+        couldQuantumOperationsBeConsumed = ops[i] != nullptr && quantumOperationSink->consumeQuantumOperation(*ops[i], annotationsOfLastForwardedQuantumOperation);
+    }
+    for (std::size_t i = 0; i < numQuantumOperationsToForward; ++i) {
+        updateRecordedSynthesisCostOfQuantumOperation(i, false);
+    }
+
+    ops.erase(ops.begin(), std::next(ops.begin(), static_cast<std::ptrdiff_t>(numQuantumOperationsToForward)));
+    annotationsPerQuantumOperation.eraseFirstQuantumOperations(numQuantumOperationsToForward);
+    numForwardedQuantumOperations += numQuantumOperationsToForward;
+    return couldQuantumOperationsBeConsumed;
+}
+
+void AnnotatableQuantumComputation::recordSynthesisCostOfAddedQuantumOperations(const std::size_t positionOfFirstAddedQuantumOperation) {
+    for (std::size_t position = positionOfFirstAddedQuantumOperation; position < getNops(); ++position) {
+        updateRecordedSynthesisCostOfQuantumOperation(position, true);
+    }
+}
+
+void AnnotatableQuantumComputation::reserveStorageForAddedQuantumOperations(const std::size_t numQuantumOperationsToAdd) {
+    if (const std::size_t requiredCapacity = ops.size() + numQuantumOperationsToAdd; requiredCapacity > ops.capacity()) {
+        ops.reserve(std::max(requiredCapacity, 2U * ops.capacity()));
+    }
+}
+
+bool AnnotatableQuantumComputation::finalizeAddedQuantumOperations(const std::size_t positionOfFirstAddedQuantumOperation) {
+    const std::size_t currNumQuantumOperations          = getNops();
+    const bool        couldQuantumOperationsBeAnnotated = currNumQuantumOperations > positionOfFirstAddedQuantumOperation && (!generateQuantumOperationAnnotations || annotateAllQuantumOperationsAtPositions(positionOfFirstAddedQuantumOperation, currNumQuantumOperations - 1U, {}));
+    recordSynthesisCostOfAddedQuantumOperations(positionOfFirstAddedQuantumOperation);
+    return couldQuantumOperationsBeAnnotated && forwardQuantumOperationsNotInReplayWindowToSink();
+}
+
+void AnnotatableQuantumComputation::updateRecordedSynthesisCostOfQuantumOperation(const std::size_t position, const bool wasQuantumOperationAdded) {
+    if (position >= getNops() || ops[position] == nullptr) {
+        return;
+    }
+
+    const qc::Operation&           quantumOperation            = *ops[position];
+    const std::size_t              numControlQubitsOfOperation = quantumOperation.getNcontrols() + static_cast<std::size_t>(quantumOperation.getType() == qc::OpType::SWAP);
+    const SynthesisCostMetricValue transistorCostOfOperation   = getTransistorCostForSynthesisOfGate(quantumOperation.getNcontrols());
+
+    const auto updateRecordedSynthesisCost = [&](RecordedSynthesisCost& recordedSynthesisCost) {
+        if (wasQuantumOperationAdded) {
+            ++recordedSynthesisCost.numQuantumOperationsPerNumControlQubits[numControlQubitsOfOperation];
+            recordedSynthesisCost.transistorCost += transistorCostOfOperation;
+            return;
+        }
+
+        // Empty entries are removed to keep the number of entries, and thus the cost of determining the quantum cost, proportional to the number of distinct gate kinds
+        if (auto entryOfNumControlQubits = recordedSynthesisCost.numQuantumOperationsPerNumControlQubits.find(numControlQubitsOfOperation); entryOfNumControlQubits != recordedSynthesisCost.numQuantumOperationsPerNumControlQubits.end() && --entryOfNumControlQubits->second == 0U) {
+            recordedSynthesisCost.numQuantumOperationsPerNumControlQubits.erase(entryOfNumControlQubits);
+        }
+        recordedSynthesisCost.transistorCost -= std::min(recordedSynthesisCost.transistorCost, transistorCostOfOperation);
+    };
+    updateRecordedSynthesisCost(recordedSynthesisCostOfRetainedQuantumOperations);
+
+    const std::optional<unsigned> statementLineNumber = annotationsPerQuantumOperation.getStatementLineNumberOfQuantumOperation(position);
+    if (!statementLineNumber.has_value()) {
+        return;
+    }
+
+    if (wasQuantumOperationAdded) {
+        updateRecordedSynthesisCost(recordedSynthesisCostPerStatementLineNumber[*statementLineNumber]);
+    } else if (auto entryOfStatement = recordedSynthesisCostPerStatementLineNumber.find(*statementLineNumber); entryOfStatement != recordedSynthesisCostPerStatementLineNumber.end()) {
+        updateRecordedSynthesisCost(entryOfStatement->second);
+        if (entryOfStatement->second.numQuantumOperationsPerNumControlQubits.empty()) {
+            recordedSynthesisCostPerStatementLineNumber.erase(entryOfStatement);
+        }
+    }
+}
+
+AnnotatableQuantumComputation::SynthesisCostMetricValue AnnotatableQuantumComputation::RecordedSynthesisCost::determineQuantumCost(const std::size_t numQubits) const {
+    SynthesisCostMetricValue cost = 0;
+    for (const auto& [numControlQubits, numQuantumOperations]: numQuantumOperationsPerNumControlQubits) {
+        cost += getQuantumCostForSynthesisOfGate(numControlQubits, false, numQubits) * numQuantumOperations;
+    }
+    return cost;
+}
+
+bool AnnotatableQuantumComputation::isQubitIndexRangeImmediateSuccessorOfCoveredRangeOfLastAddedQuantumRegister(const QubitIndexRange& toBeCheckedQubitIndexRange) const noexcept {
+    return quantumRegisterAssociatedVariableLayouts.empty() || toBeCheckedQubitIndexRange.firstQubitIndex == quantumRegisterAssociatedVariableLayouts.back()->storedQubitIndices.lastQubitIndex + 1U;
+}
+
+bool AnnotatableQuantumComputation::annotateAllQuantumOperationsAtPositions(const std::size_t fromQuantumOperationIndex, const std::size_t toQuantumOperationIndex, const QuantumOperationAnnotationsLookup& userProvidedAnnotationsPerQuantumOperation) {
+    if (!generateQuantumOperationAnnotations || fromQuantumOperationIndex >= getNops() || toQuantumOperationIndex >= getNops()) {
+        return false;
+    }
+
+    const std::size_t idxOfFirstGateToAnnotate = std::min(fromQuantumOperationIndex, toQuantumOperationIndex);
+    const std::size_t idxOfLastGateToAnnotate  = std::max(fromQuantumOperationIndex, toQuantumOperationIndex);
+    if (idxOfLastGateToAnnotate >= annotationsPerQuantumOperation.size()) {
+        annotationsPerQuantumOperation.resize(idxOfLastGateToAnnotate + 1U);
+    }
+    return annotationsPerQuantumOperation.setOrUpdateAnnotationsOfQuantumOperations(idxOfFirstGateToAnnotate, idxOfLastGateToAnnotate, activateGlobalQuantumOperationAnnotations, userProvidedAnnotationsPerQuantumOperation, activeGlobalStatementLineNumber);
 }
 
 // BEGIN Quantum register variable layout functionality
@@ -595,42 +2085,54 @@ std::optional<AnnotatableQuantumComputation::BaseQuantumRegisterVariableLayout::
                                       .inlinedQubitInformation                        = optionalSharedInlinedQubitInformation});
 }
 
+bool AnnotatableQuantumComputation::NonAncillaryQuantumRegisterVariableLayout::appendAccessOfQubitInVariableLayout(const qc::Qubit qubit, std::string& qubitLabel) const {
+    if (storedQubitIndices.firstQubitIndex > qubit || storedQubitIndices.lastQubitIndex < qubit || offsetToNextElementInDimensionMeasuredInNumberOfVariableBitwidths.size() < numValuesPerDimensionOfVariable.size() || numValuesPerDimensionOfVariable.empty() || elementQubitSize == 0) {
+        return false;
+    }
+
+    // The accessed value of each dimension is determined as in getRequiredValuesPerDimensionToAccessQubitOfVariable(...) but directly appended to the label instead of being collected in a temporary container.
+    const std::size_t lengthOfQubitLabelPriorToAppend     = qubitLabel.size();
+    qc::Qubit         relativeQubitIndexInAccessedElement = qubit - storedQubitIndices.firstQubitIndex;
+    for (std::size_t i = 0; i < numValuesPerDimensionOfVariable.size(); ++i) {
+        const qc::Qubit qubitOffsetToNextElementInDimension = offsetToNextElementInDimensionMeasuredInNumberOfVariableBitwidths[i] * elementQubitSize;
+        const qc::Qubit accessedValueOfDimension            = qubitOffsetToNextElementInDimension != 0 ? relativeQubitIndexInAccessedElement / qubitOffsetToNextElementInDimension : 0U;
+        if (qubitOffsetToNextElementInDimension == 0 || accessedValueOfDimension >= numValuesPerDimensionOfVariable[i]) {
+            qubitLabel.resize(lengthOfQubitLabelPriorToAppend);
+            return false;
+        }
+        qubitLabel += '[';
+        appendUnsignedIntegerToQubitLabel(qubitLabel, accessedValueOfDimension);
+        qubitLabel += ']';
+        relativeQubitIndexInAccessedElement -= accessedValueOfDimension * qubitOffsetToNextElementInDimension;
+    }
+    qubitLabel += '.';
+    appendUnsignedIntegerToQubitLabel(qubitLabel, relativeQubitIndexInAccessedElement);
+    return true;
+}
+
+const AnnotatableQuantumComputation::InlinedQubitInformation* AnnotatableQuantumComputation::NonAncillaryQuantumRegisterVariableLayout::findInlinedQubitInformation(const qc::Qubit qubit) const {
+    return storedQubitIndices.firstQubitIndex <= qubit && storedQubitIndices.lastQubitIndex >= qubit && optionalSharedInlinedQubitInformation.has_value() ? &*optionalSharedInlinedQubitInformation : nullptr;
+}
+
 [[nodiscard]] std::optional<std::vector<unsigned>> AnnotatableQuantumComputation::NonAncillaryQuantumRegisterVariableLayout::getRequiredValuesPerDimensionToAccessQubitOfVariable(const qc::Qubit qubit) const {
     if (offsetToNextElementInDimensionMeasuredInNumberOfVariableBitwidths.empty() || numValuesPerDimensionOfVariable.empty() || std::ranges::any_of(numValuesPerDimensionOfVariable, [](const unsigned numValuesOfDimension) { return numValuesOfDimension == 0; }) || elementQubitSize == 0 || storedQubitIndices.firstQubitIndex > qubit) {
         return std::nullopt;
     }
 
-    // I. Calculate the offset to the next element in the current dimension
-    // II. For each dimension perform a binary search to determine which element contains the qubit
-    // III. Add determined index in current dimension to build full index (as one would define in a syrec::VariableAccess) to access the element containing the search for qubit.
+    // Since all elements of a dimension cover the same number of qubits, the accessed value of each dimension can be determined by dividing the offset of the qubit relative to the first qubit of the element accessed in the previous dimensions
+    // by the number of qubits covered by an element of the current dimension.
     bool            couldRequiredValuePerDimensionBeDetermined = true;
     auto            requiredValuesPerDimension                 = std::vector(numValuesPerDimensionOfVariable.size(), 0U);
     const qc::Qubit qubitSizeOfElements                        = elementQubitSize;
+    qc::Qubit       relativeQubitIndexInAccessedElement        = qubit - storedQubitIndices.firstQubitIndex;
 
     for (std::size_t i = 0; i < requiredValuesPerDimension.size() && couldRequiredValuePerDimensionBeDetermined; ++i) {
-        const unsigned qubitOffsetToNextElementInDimension = offsetToNextElementInDimensionMeasuredInNumberOfVariableBitwidths[i] * qubitSizeOfElements;
-
-        // For each element in the current dimension determine its covered qubit index range.
-        auto firstQubitIndexPerElementInDimension = std::vector(numValuesPerDimensionOfVariable.at(i), qubitOffsetToNextElementInDimension);
-        // Initialize the first covered qubit of the first element of the current dimension to the first qubit covered by the current quantum register.
-        firstQubitIndexPerElementInDimension[0] = storedQubitIndices.firstQubitIndex;
-        // Additionally, add the offset from the accessed value of the previous dimension/s.
-        for (std::size_t j = 0; j < i; ++j) {
-            firstQubitIndexPerElementInDimension[0] += (requiredValuesPerDimension[j] * offsetToNextElementInDimensionMeasuredInNumberOfVariableBitwidths[j]) * qubitSizeOfElements;
-        }
-
-        // We have now determine the value of the first qubit of the first element of the current dimension (based on the accessed values of the previous dimension) and can now simply
-        // determine the value of the first qubit for the remaining elements of the current dimension as: first_qubit[j] = first_qubit[j - 1] + offset_to_next_element_in_current_dimension.
-        // Note that we have initialized the vector storing the first qubit for each element with the offset to the next element in the current dimension.
-        for (std::size_t j = 1; j < firstQubitIndexPerElementInDimension.size(); ++j) {
-            firstQubitIndexPerElementInDimension[j] += firstQubitIndexPerElementInDimension[j - 1];
-        }
-
-        const auto                       qubitIndexRangePerElementOfCollection = firstQubitIndexPerElementInDimension | std::views::transform([qubitOffsetToNextElementInDimension](const qc::Qubit firstQubitOfElement) { return QubitIndexRange{.firstQubitIndex = firstQubitOfElement, .lastQubitIndex = (firstQubitOfElement + qubitOffsetToNextElementInDimension) - 1U}; });
-        const std::optional<std::size_t> indexOfElementContainingQubit         = findIndexOfElementContainingQubit(qubitIndexRangePerElementOfCollection.begin(), qubitIndexRangePerElementOfCollection.end(), qubit);
+        const qc::Qubit qubitOffsetToNextElementInDimension = offsetToNextElementInDimensionMeasuredInNumberOfVariableBitwidths[i] * qubitSizeOfElements;
+        const qc::Qubit accessedValueOfDimension            = relativeQubitIndexInAccessedElement / qubitOffsetToNextElementInDimension;
 
-        couldRequiredValuePerDimensionBeDetermined = indexOfElementContainingQubit.has_value();
-        requiredValuesPerDimension[i]              = static_cast<unsigned>(indexOfElementContainingQubit.value_or(0U));
+        couldRequiredValuePerDimensionBeDetermined = accessedValueOfDimension < numValuesPerDimensionOfVariable[i];
+        requiredValuesPerDimension[i]              = couldRequiredValuePerDimensionBeDetermined ? static_cast<unsigned>(accessedValueOfDimension) : 0U;
+        relativeQubitIndexInAccessedElement -= accessedValueOfDimension * qubitOffsetToNextElementInDimension;
     }
     return couldRequiredValuePerDimensionBeDetermined ? std::make_optional(requiredValuesPerDimension) : std::nullopt;
 }
@@ -660,6 +2162,25 @@ std::optional<AnnotatableQuantumComputation::BaseQuantumRegisterVariableLayout::
                                       .inlinedQubitInformation                        = sharedQubitRangeInlineInformationLookup.at(*indexOfQubitRangeStoringQubit).inlinedQubitInformation});
 }
 
+bool AnnotatableQuantumComputation::AncillaryQuantumRegisterVariableLayout::appendAccessOfQubitInVariableLayout(const qc::Qubit qubit, std::string& qubitLabel) const {
+    if (findInlinedQubitInformation(qubit) == nullptr) {
+        return false;
+    }
+    qubitLabel += "[0].";
+    appendUnsignedIntegerToQubitLabel(qubitLabel, qubit - storedQubitIndices.firstQubitIndex);
+    return true;
+}
+
+const AnnotatableQuantumComputation::InlinedQubitInformation* AnnotatableQuantumComputation::AncillaryQuantumRegisterVariableLayout::findInlinedQubitInformation(const qc::Qubit qubit) const {
+    if (storedQubitIndices.firstQubitIndex > qubit || storedQubitIndices.lastQubitIndex < qubit) {
+        return nullptr;
+    }
+
+    const auto&                      nonOverlappingQubitIndexRanges = sharedQubitRangeInlineInformationLookup | std::views::transform([](const SharedQubitRangeInlineInformation& sharedQubitRangeInlineInformation) { return sharedQubitRangeInlineInformation.coveredQubitIndexRange; });
+    const std::optional<std::size_t> indexOfQubitRangeStoringQubit  = findIndexOfElementContainingQubit(nonOverlappingQubitIndexRanges.begin(), nonOverlappingQubitIndexRanges.end(), qubit);
+    return indexOfQubitRangeStoringQubit.has_value() ? &sharedQubitRangeInlineInformationLookup[*indexOfQubitRangeStoringQubit].inlinedQubitInformation : nullptr;
+}
+
 bool AnnotatableQuantumComputation::AncillaryQuantumRegisterVariableLayout::appendQubitRange(const QubitIndexRange qubitIndexRange, const InlinedQubitInformation& sharedInlinedQubitInformation) {
     if (sharedQubitRangeInlineInformationLookup.empty() || qubitIndexRange.firstQubitIndex != storedQubitIndices.lastQubitIndex + 1 || qubitIndexRange.firstQubitIndex > qubitIndexRange.lastQubitIndex) {
         return false;
@@ -672,17 +2193,63 @@ bool AnnotatableQuantumComputation::AncillaryQuantumRegisterVariableLayout::appe
 }
 // END Quantum register variable layout functionality
 
-std::string AnnotatableQuantumComputation::buildQubitLabelForQubitOfVariableInQuantumRegister(const std::string& quantumRegisterLabel, const std::vector<unsigned>& accessedValuePerDimension, const std::size_t relativeQubitIndexInElement) {
-    std::string generatedQubitLabel = quantumRegisterLabel;
-    for (const auto accessedValueOfDimension: accessedValuePerDimension) {
-        generatedQubitLabel += "[" + std::to_string(accessedValueOfDimension) + "]";
+bool AnnotatableQuantumComputation::appendQubitLabelOfQubitInQuantumRegister(const BaseQuantumRegisterVariableLayout& quantumRegisterVariableLayout, const qc::Qubit qubit, const QubitLabelType qubitLabelType, std::string& qubitLabel) {
+    const InlinedQubitInformation* inlinedQubitInformation = quantumRegisterVariableLayout.findInlinedQubitInformation(qubit);
+    const std::string*             identifierOfQubitLabel  = &quantumRegisterVariableLayout.quantumRegisterLabel;
+    if (qubitLabelType == UserDeclared) {
+        if (inlinedQubitInformation == nullptr || !inlinedQubitInformation->userDeclaredQubitLabel.has_value()) {
+            return false;
+        }
+        identifierOfQubitLabel = &*inlinedQubitInformation->userDeclaredQubitLabel;
     }
-    generatedQubitLabel += "." + std::to_string(relativeQubitIndexInElement);
-    return generatedQubitLabel;
+
+    const std::size_t lengthOfQubitLabelPriorToAppend = qubitLabel.size();
+    qubitLabel += *identifierOfQubitLabel;
+    if (!quantumRegisterVariableLayout.appendAccessOfQubitInVariableLayout(qubit, qubitLabel)) {
+        qubitLabel.resize(lengthOfQubitLabelPriorToAppend);
+        return false;
+    }
+    return true;
 }
 
 std::optional<std::size_t> AnnotatableQuantumComputation::determineIndexOfQuantumRegisterStoringQubit(const qc::Qubit qubit) const {
-    const auto qubitRangeOfQuantumRegisters = quantumRegisterAssociatedVariableLayouts | std::views::transform([](const std::unique_ptr<BaseQuantumRegisterVariableLayout>& quantumRegisterVariableLayout) { return quantumRegisterVariableLayout->storedQubitIndices; });
-    return findIndexOfElementContainingQubit(qubitRangeOfQuantumRegisters.begin(), qubitRangeOfQuantumRegisters.end(), qubit);
+    if (qubit >= indexOfVariableLayoutPerQubit.size()) {
+        return std::nullopt;
+    }
+
+    // Qubits added to the quantum computation without being stored in a quantum register variable layout (i.e. by failing to append them to an existing ancillary quantum register) are detected by validating the covered qubit range of the looked up variable layout.
+    const std::size_t      indexOfVariableLayout      = indexOfVariableLayoutPerQubit[qubit];
+    const QubitIndexRange& qubitRangeOfVariableLayout = quantumRegisterAssociatedVariableLayouts[indexOfVariableLayout]->storedQubitIndices;
+    return qubitRangeOfVariableLayout.firstQubitIndex <= qubit && qubitRangeOfVariableLayout.lastQubitIndex >= qubit ? std::make_optional(indexOfVariableLayout) : std::nullopt;
+}
+
+qc::Qubit AnnotatableQuantumComputation::determineQubitInVariableLayouts(const qc::Qubit qubit) const noexcept {
+    return qubit < qubitInVariableLayoutsPerQubit.size() ? qubitInVariableLayoutsPerQubit[qubit] : qubit;
+}
+
+void AnnotatableQuantumComputation::splitQuantumRegistersOfPermutedQubits() {
+    std::vector<qc::Qubit> qubitPerQubitInVariableLayouts(getNqubits());
+    for (qc::Qubit qubit = 0; qubit < getNqubits(); ++qubit) {
+        qubitPerQubitInVariableLayouts[determineQubitInVariableLayouts(qubit)] = qubit;
+    }
+
+    qc::QuantumRegisterMap splitQuantumRegisters;
+    for (const std::unique_ptr<BaseQuantumRegisterVariableLayout>& variableLayout: quantumRegisterAssociatedVariableLayouts) {
+        const QubitIndexRange& storedQubitIndices = variableLayout->storedQubitIndices;
+        qc::Qubit              firstQubitOfRange  = storedQubitIndices.firstQubitIndex;
+        for (qc::Qubit qubit = storedQubitIndices.firstQubitIndex + 1U; qubit <= storedQubitIndices.lastQubitIndex + 1U; ++qubit) {
+            if (qubit <= storedQubitIndices.lastQubitIndex && qubitPerQubitInVariableLayouts[qubit] == qubitPerQubitInVariableLayouts[qubit - 1U] + 1U) {
+                continue;
+            }
+
+            std::string labelOfRange = variableLayout->quantumRegisterLabel;
+            if (firstQubitOfRange != storedQubitIndices.firstQubitIndex || qubit <= storedQubitIndices.lastQubitIndex) {
+                labelOfRange += "_" + std::to_string(firstQubitOfRange - storedQubitIndices.firstQubitIndex);
+            }
+            splitQuantumRegisters.try_emplace(labelOfRange, qubitPerQubitInVariableLayouts[firstQubitOfRange], qubit - firstQubitOfRange, labelOfRange);
+            firstQubitOfRange = qubit;
+        }
+    }
+    quantumRegisters = std::move(splitQuantumRegisters);
 }
 // END NON-PUBLIC FUNCTIONALITY
@@ -0,0 +1,715 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/io/mapped_file.hpp"
+#include "core/qubit_inlining_stack.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/variable.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/Permutation.hpp"
+#include "ir/operations/Control.hpp"
+#include "ir/operations/OpType.hpp"
+#include "ir/operations/Operation.hpp"
+#include "ir/operations/StandardOperation.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    using Word = std::uint64_t;
+
+    constexpr Word BINARY_FORMAT_MAGIC   = 0x3143514345525953U; // "SYRECQC1" if stored in little endian byte order
+    constexpr Word BYTE_ORDER_MARK       = 0x0102030405060708U;
+    constexpr Word BINARY_FORMAT_VERSION = 2U;
+
+    constexpr Word FLAG_GENERATE_QUANTUM_OPERATION_ANNOTATIONS = 1U;
+    constexpr Word FLAG_CAN_QUBITS_BE_ADDED                    = 2U;
+
+    constexpr Word INLINED_QUBIT_INFORMATION_IS_SET           = 1U;
+    constexpr Word INLINED_QUBIT_INFORMATION_HAS_USER_LABEL   = 2U;
+    constexpr Word INLINED_QUBIT_INFORMATION_HAS_INLINE_STACK = 4U;
+
+    constexpr Word INLINE_STACK_ENTRY_HAS_LINE_NUMBER      = 1U;
+    constexpr Word INLINE_STACK_ENTRY_HAS_ACCESS_KIND      = 2U;
+    constexpr Word INLINE_STACK_ENTRY_IS_ACCESSED_VIA_CALL = 4U;
+
+    constexpr Word NON_ANCILLARY_QUANTUM_REGISTER_VARIABLE_LAYOUT = 0U;
+    constexpr Word ANCILLARY_QUANTUM_REGISTER_VARIABLE_LAYOUT     = 1U;
+
+    [[nodiscard]] std::size_t numPaddingBytes(const std::size_t numBytes) {
+        return (sizeof(Word) - (numBytes % sizeof(Word))) % sizeof(Word);
+    }
+
+    /**
+     * Appends words and word aligned arrays to the buffer storing a serialized quantum computation.
+     */
+    class BinaryWriter {
+    public:
+        void appendWord(const Word word) {
+            appendBytes(&word, sizeof(Word));
+        }
+
+        void appendString(const std::string_view& string) {
+            appendWord(string.size());
+            appendBytes(string.data(), string.size());
+        }
+
+        // An array is stored as the number of its elements followed by the elements in their in-memory representation, allowing a reader to access the elements of the array in place.
+        template<typename T>
+        void appendArray(const std::vector<T>& elements) {
+            static_assert(std::is_trivially_copyable_v<T> && sizeof(T) <= sizeof(Word));
+            appendWord(elements.size());
+            appendBytes(elements.data(), elements.size() * sizeof(T));
+        }
+
+        [[nodiscard]] std::string release() {
+            return std::move(buffer);
+        }
+
+    private:
+        std::string buffer;
+
+        void appendBytes(const void* bytes, const std::size_t numBytes) {
+            buffer.append(static_cast<const char*>(bytes), numBytes);
+            buffer.append(numPaddingBytes(numBytes), '\0');
+        }
+    };
+
+    /**
+     * Reads the words and arrays appended by the BinaryWriter with every read checking that the serialized quantum computation contains the read bytes.
+     */
+    class BinaryReader {
+    public:
+        explicit BinaryReader(const std::string_view& content):
+            content(content) {}
+
+        [[nodiscard]] bool readWord(Word& word) {
+            return readBytes(&word, sizeof(Word));
+        }
+
+        // A word used as the number of elements of a container is limited by the number of remaining bytes to not allocate memory for more elements than the serialized quantum computation could contain.
+        [[nodiscard]] bool readCount(std::size_t& count) {
+            Word word = 0;
+            if (!readWord(word) || word > content.size() - offset) {
+                return false;
+            }
+            count = static_cast<std::size_t>(word);
+            return true;
+        }
+
+        [[nodiscard]] bool readString(std::string& string) {
+            std::size_t length = 0;
+            if (!readCount(length)) {
+                return false;
+            }
+            string.resize(length);
+            return readBytes(string.data(), length);
+        }
+
+        template<typename T>
+        [[nodiscard]] bool readArray(std::vector<T>& elements) {
+            static_assert(std::is_trivially_copyable_v<T> && sizeof(T) <= sizeof(Word));
+            std::size_t numElements = 0;
+            if (!readCount(numElements)) {
+                return false;
+            }
+            elements.resize(numElements);
+            return readBytes(elements.data(), numElements * sizeof(T));
+        }
+
+        [[nodiscard]] bool isAtEnd() const noexcept {
+            return offset == content.size();
+        }
+
+    private:
+        std::string_view content;
+        std::size_t      offset = 0;
+
+        // The bytes are copied instead of being accessed via a reinterpret_cast since the serialized quantum computation is not required to be aligned (i.e. if it was not memory-mapped).
+        [[nodiscard]] bool readBytes(void* bytes, const std::size_t numBytes) {
+            const std::size_t numPaddedBytes = numBytes + numPaddingBytes(numBytes);
+            if (numPaddedBytes > content.size() - offset) {
+                return false;
+            }
+            if (numBytes != 0U) {
+                std::memcpy(bytes, content.data() + offset, numBytes);
+            }
+            offset += numPaddedBytes;
+            return true;
+        }
+    };
+
+    [[nodiscard]] bool isSupportedGate(const qc::Operation& gate) {
+        return gate.isStandardOperation() && gate.getParameter().empty() && ((gate.getType() == qc::OpType::X && gate.getNtargets() == 1U) || (gate.getType() == qc::OpType::SWAP && gate.getNtargets() == 2U));
+    }
+
+    [[nodiscard]] std::optional<unsigned> tryParseStatementLineNumber(const std::string_view& value) {
+        unsigned   statementLineNumber = 0;
+        const auto parseResult         = std::from_chars(value.data(), value.data() + value.size(), statementLineNumber);
+        return !value.empty() && parseResult.ec == std::errc() && parseResult.ptr == value.data() + value.size() ? std::make_optional(statementLineNumber) : std::nullopt;
+    }
+
+    /**
+     * The target modules and inline stacks referenced by the inlined qubit information of the quantum registers, with every module and inline stack shared by multiple qubits only being serialized once.
+     */
+    class InlineStackTable {
+    public:
+        [[nodiscard]] bool internInlinedQubitInformation(const std::optional<AnnotatableQuantumComputation::InlinedQubitInformation>& inlinedQubitInformation) {
+            return !inlinedQubitInformation.has_value() || !inlinedQubitInformation->inlineStack.has_value() || internInlineStack(*inlinedQubitInformation->inlineStack).has_value();
+        }
+
+        void appendInlinedQubitInformation(BinaryWriter& writer, const std::optional<AnnotatableQuantumComputation::InlinedQubitInformation>& inlinedQubitInformation) const {
+            if (!inlinedQubitInformation.has_value()) {
+                writer.appendWord(0U);
+                return;
+            }
+            writer.appendWord(INLINED_QUBIT_INFORMATION_IS_SET | (inlinedQubitInformation->userDeclaredQubitLabel.has_value() ? INLINED_QUBIT_INFORMATION_HAS_USER_LABEL : 0U) | (inlinedQubitInformation->inlineStack.has_value() ? INLINED_QUBIT_INFORMATION_HAS_INLINE_STACK : 0U));
+            if (inlinedQubitInformation->userDeclaredQubitLabel.has_value()) {
+                writer.appendString(*inlinedQubitInformation->userDeclaredQubitLabel);
+            }
+            if (inlinedQubitInformation->inlineStack.has_value()) {
+                writer.appendWord(indexPerInlineStack.at(inlinedQubitInformation->inlineStack->get()));
+            }
+        }
+
+        void appendModulesAndInlineStacks(BinaryWriter& writer) const {
+            writer.appendWord(modules.size());
+            for (const Module* module: modules) {
+                writer.appendString(module->name);
+                writer.appendWord(module->parameters.size());
+                for (const Variable::ptr& parameter: module->parameters) {
+                    writer.appendWord(static_cast<Word>(parameter->type));
+                    writer.appendString(parameter->name);
+                    writer.appendArray(parameter->dimensions);
+                    writer.appendWord(parameter->bitwidth);
+                }
+            }
+
+            writer.appendWord(inlineStackEntries.size());
+            for (const std::vector<QubitInliningStack::QubitInliningStackEntry>& entriesOfInlineStack: inlineStackEntries) {
+                writer.appendWord(entriesOfInlineStack.size());
+                for (const QubitInliningStack::QubitInliningStackEntry& entry: entriesOfInlineStack) {
+                    writer.appendWord((entry.lineNumberOfCallOfTargetModule.has_value() ? INLINE_STACK_ENTRY_HAS_LINE_NUMBER : 0U) | (entry.isTargetModuleAccessedViaCallStmt.has_value() ? INLINE_STACK_ENTRY_HAS_ACCESS_KIND : 0U) | (entry.isTargetModuleAccessedViaCallStmt.value_or(false) ? INLINE_STACK_ENTRY_IS_ACCESSED_VIA_CALL : 0U));
+                    writer.appendWord(entry.lineNumberOfCallOfTargetModule.value_or(0U));
+                    writer.appendWord(indexPerModule.at(entry.targetModule.get()));
+                }
+            }
+        }
+
+    private:
+        std::vector<const Module*>                                            modules;
+        std::unordered_map<const Module*, std::size_t>                        indexPerModule;
+        std::vector<std::vector<QubitInliningStack::QubitInliningStackEntry>> inlineStackEntries;
+        std::unordered_map<const QubitInliningStack*, std::size_t>            indexPerInlineStack;
+
+        [[nodiscard]] std::optional<std::size_t> internInlineStack(const QubitInliningStack::ptr& inlineStack) {
+            if (inlineStack == nullptr) {
+                return std::nullopt;
+            }
+            if (const auto existingEntry = indexPerInlineStack.find(inlineStack.get()); existingEntry != indexPerInlineStack.end()) {
+                return existingEntry->second;
+            }
+
+            std::vector<QubitInliningStack::QubitInliningStackEntry> entriesOfInlineStack;
+            entriesOfInlineStack.reserve(inlineStack->size());
+            for (std::size_t i = 0; i < inlineStack->size(); ++i) {
+                const QubitInliningStack::QubitInliningStackEntry* entry = inlineStack->getStackEntryAt(i);
+                if (entry == nullptr || entry->targetModule == nullptr || std::ranges::any_of(entry->targetModule->parameters, [](const Variable::ptr& parameter) { return parameter == nullptr; })) {
+                    return std::nullopt;
+                }
+                if (indexPerModule.try_emplace(entry->targetModule.get(), modules.size()).second) {
+                    modules.emplace_back(entry->targetModule.get());
+                }
+                entriesOfInlineStack.emplace_back(*entry);
+            }
+            indexPerInlineStack.emplace(inlineStack.get(), inlineStackEntries.size());
+            inlineStackEntries.emplace_back(std::move(entriesOfInlineStack));
+            return inlineStackEntries.size() - 1U;
+        }
+    };
+
+    [[nodiscard]] bool readInlinedQubitInformation(BinaryReader& reader, const std::vector<QubitInliningStack::ptr>& inlineStacks, std::optional<AnnotatableQuantumComputation::InlinedQubitInformation>& inlinedQubitInformation) {
+        Word flags = 0;
+        if (!reader.readWord(flags) || flags > (INLINED_QUBIT_INFORMATION_IS_SET | INLINED_QUBIT_INFORMATION_HAS_USER_LABEL | INLINED_QUBIT_INFORMATION_HAS_INLINE_STACK)) {
+            return false;
+        }
+        if ((flags & INLINED_QUBIT_INFORMATION_IS_SET) == 0U) {
+            inlinedQubitInformation.reset();
+            return flags == 0U;
+        }
+
+        inlinedQubitInformation = AnnotatableQuantumComputation::InlinedQubitInformation{};
+        if ((flags & INLINED_QUBIT_INFORMATION_HAS_USER_LABEL) != 0U && !reader.readString(inlinedQubitInformation->userDeclaredQubitLabel.emplace())) {
+            return false;
+        }
+        if ((flags & INLINED_QUBIT_INFORMATION_HAS_INLINE_STACK) != 0U) {
+            Word indexOfInlineStack = 0;
+            if (!reader.readWord(indexOfInlineStack) || indexOfInlineStack >= inlineStacks.size()) {
+                return false;
+            }
+            inlinedQubitInformation->inlineStack = inlineStacks[indexOfInlineStack];
+        }
+        return true;
+    }
+
+    // The modules are restored as their declaration, i.e. their identifier and parameters, since only the latter are referenced by the entries of an inline stack.
+    [[nodiscard]] bool readModulesAndInlineStacks(BinaryReader& reader, std::vector<QubitInliningStack::ptr>& inlineStacks) {
+        std::size_t numModules = 0;
+        if (!reader.readCount(numModules)) {
+            return false;
+        }
+        std::vector<Module::ptr> modules;
+        for (std::size_t i = 0; i < numModules; ++i) {
+            std::string moduleIdentifier;
+            std::size_t numParameters = 0;
+            if (!reader.readString(moduleIdentifier) || !reader.readCount(numParameters)) {
+                return false;
+            }
+            auto module = std::make_shared<Module>(std::move(moduleIdentifier));
+            for (std::size_t j = 0; j < numParameters; ++j) {
+                Word                  parameterType = 0;
+                std::string           parameterIdentifier;
+                std::vector<unsigned> parameterDimensions;
+                Word                  parameterBitwidth = 0;
+                if (!reader.readWord(parameterType) || parameterType > static_cast<Word>(Variable::Type::Wire) || !reader.readString(parameterIdentifier) || !reader.readArray(parameterDimensions) || !reader.readWord(parameterBitwidth) || parameterBitwidth > std::numeric_limits<unsigned>::max()) {
+                    return false;
+                }
+                module->addParameter(std::make_shared<Variable>(static_cast<Variable::Type>(parameterType), std::move(parameterIdentifier), std::move(parameterDimensions), static_cast<unsigned>(parameterBitwidth)));
+            }
+            modules.emplace_back(std::move(module));
+        }
+
+        std::size_t numInlineStacks = 0;
+        if (!reader.readCount(numInlineStacks)) {
+            return false;
+        }
+        for (std::size_t i = 0; i < numInlineStacks; ++i) {
+            std::size_t numEntries = 0;
+            if (!reader.readCount(numEntries)) {
+                return false;
+            }
+            auto inlineStack = std::make_shared<QubitInliningStack>();
+            for (std::size_t j = 0; j < numEntries; ++j) {
+                Word flags         = 0;
+                Word lineNumber    = 0;
+                Word indexOfModule = 0;
+                if (!reader.readWord(flags) || !reader.readWord(lineNumber) || !reader.readWord(indexOfModule) || indexOfModule >= modules.size() || lineNumber > std::numeric_limits<unsigned>::max()) {
+                    return false;
+                }
+                QubitInliningStack::QubitInliningStackEntry entry{.lineNumberOfCallOfTargetModule = std::nullopt, .isTargetModuleAccessedViaCallStmt = std::nullopt, .targetModule = modules[indexOfModule]};
+                if ((flags & INLINE_STACK_ENTRY_HAS_LINE_NUMBER) != 0U) {
+                    entry.lineNumberOfCallOfTargetModule = static_cast<unsigned>(lineNumber);
+                }
+                if ((flags & INLINE_STACK_ENTRY_HAS_ACCESS_KIND) != 0U) {
+                    entry.isTargetModuleAccessedViaCallStmt = (flags & INLINE_STACK_ENTRY_IS_ACCESSED_VIA_CALL) != 0U;
+                }
+                inlineStack->push(entry);
+            }
+            inlineStacks.emplace_back(std::move(inlineStack));
+        }
+        return true;
+    }
+
+    template<typename T>
+    [[nodiscard]] bool areOffsetsValid(const std::vector<std::uint64_t>& offsets, const std::size_t numQuantumOperations, const std::vector<T>& offsetElements) {
+        if (offsets.size() != numQuantumOperations + 1U || offsets.front() != 0U || offsets.back() != offsetElements.size()) {
+            return false;
+        }
+        return std::ranges::is_sorted(offsets);
+    }
+} // namespace
+
+std::optional<std::string> AnnotatableQuantumComputation::serialize() const {
+    if (numForwardedQuantumOperations != 0U) {
+        return std::nullopt;
+    }
+    for (const std::unique_ptr<qc::Operation>& quantumOperation: ops) {
+        if (quantumOperation == nullptr || !forEachGateOfQuantumOperation(*quantumOperation, isSupportedGate)) {
+            return std::nullopt;
+        }
+    }
+
+    InlineStackTable inlineStackTable;
+    std::size_t      numQubitsInQuantumRegisters = 0;
+    for (const std::unique_ptr<BaseQuantumRegisterVariableLayout>& variableLayout: quantumRegisterAssociatedVariableLayouts) {
+        if (variableLayout->storedQubitIndices.firstQubitIndex != numQubitsInQuantumRegisters) {
+            return std::nullopt;
+        }
+        numQubitsInQuantumRegisters += variableLayout->getNumberOfQubitsInQuantumRegister();
+
+        if (const auto* nonAncillaryVariableLayout = dynamic_cast<const NonAncillaryQuantumRegisterVariableLayout*>(variableLayout.get()); nonAncillaryVariableLayout != nullptr) {
+            if (!inlineStackTable.internInlinedQubitInformation(nonAncillaryVariableLayout->optionalSharedInlinedQubitInformation)) {
+                return std::nullopt;
+            }
+        } else if (const auto* ancillaryVariableLayout = dynamic_cast<const AncillaryQuantumRegisterVariableLayout*>(variableLayout.get()); ancillaryVariableLayout != nullptr) {
+            for (const AncillaryQuantumRegisterVariableLayout::SharedQubitRangeInlineInformation& sharedQubitRangeInlineInformation: ancillaryVariableLayout->sharedQubitRangeInlineInformationLookup) {
+                if (!inlineStackTable.internInlinedQubitInformation(sharedQubitRangeInlineInformation.inlinedQubitInformation)) {
+                    return std::nullopt;
+                }
+            }
+        } else {
+            return std::nullopt;
+        }
+    }
+    if (numQubitsInQuantumRegisters != getNqubits()) {
+        return std::nullopt;
+    }
+
+    BinaryWriter writer;
+    writer.appendWord(BINARY_FORMAT_MAGIC);
+    writer.appendWord(BYTE_ORDER_MARK);
+    writer.appendWord(BINARY_FORMAT_VERSION);
+    writer.appendWord((generateQuantumOperationAnnotations ? FLAG_GENERATE_QUANTUM_OPERATION_ANNOTATIONS : 0U) | (canQubitsBeAddedToQuantumComputation ? FLAG_CAN_QUBITS_BE_ADDED : 0U));
+    writer.appendWord(getNqubits());
+
+    std::vector<std::uint8_t> isAncillaryPerQubit(getNqubits(), 0U);
+    std::vector<std::uint8_t> isGarbagePerQubit(getNqubits(), 0U);
+    for (qc::Qubit qubit = 0; qubit < getNqubits(); ++qubit) {
+        isAncillaryPerQubit[qubit] = logicalQubitIsAncillary(qubit) ? 1U : 0U;
+        isGarbagePerQubit[qubit]   = logicalQubitIsGarbage(qubit) ? 1U : 0U;
+    }
+    writer.appendArray(isAncillaryPerQubit);
+    writer.appendArray(isGarbagePerQubit);
+
+    // A permutation is stored as the flattened pairs of its mapped qubits.
+    const auto appendPermutation = [&writer](const qc::Permutation& permutation) {
+        std::vector<qc::Qubit> mappedQubits;
+        mappedQubits.reserve(2U * permutation.size());
+        for (const auto& [fromQubit, toQubit]: permutation) {
+            mappedQubits.emplace_back(fromQubit);
+            mappedQubits.emplace_back(toQubit);
+        }
+        writer.appendArray(mappedQubits);
+    };
+    appendPermutation(initialLayout);
+    appendPermutation(outputPermutation);
+
+    inlineStackTable.appendModulesAndInlineStacks(writer);
+    writer.appendWord(quantumRegisterAssociatedVariableLayouts.size());
+    for (const std::unique_ptr<BaseQuantumRegisterVariableLayout>& variableLayout: quantumRegisterAssociatedVariableLayouts) {
+        const auto* nonAncillaryVariableLayout = dynamic_cast<const NonAncillaryQuantumRegisterVariableLayout*>(variableLayout.get());
+        writer.appendWord(nonAncillaryVariableLayout != nullptr ? NON_ANCILLARY_QUANTUM_REGISTER_VARIABLE_LAYOUT : ANCILLARY_QUANTUM_REGISTER_VARIABLE_LAYOUT);
+        writer.appendString(variableLayout->quantumRegisterLabel);
+        writer.appendWord(variableLayout->storedQubitIndices.firstQubitIndex);
+        writer.appendWord(variableLayout->storedQubitIndices.lastQubitIndex);
+        if (nonAncillaryVariableLayout != nullptr) {
+            writer.appendWord(nonAncillaryVariableLayout->elementQubitSize);
+            writer.appendArray(nonAncillaryVariableLayout->numValuesPerDimensionOfVariable);
+            inlineStackTable.appendInlinedQubitInformation(writer, nonAncillaryVariableLayout->optionalSharedInlinedQubitInformation);
+            continue;
+        }
+
+        const auto& sharedQubitRangeInlineInformationLookup = dynamic_cast<const AncillaryQuantumRegisterVariableLayout&>(*variableLayout).sharedQubitRangeInlineInformationLookup;
+        writer.appendWord(sharedQubitRangeInlineInformationLookup.size());
+        for (const AncillaryQuantumRegisterVariableLayout::SharedQubitRangeInlineInformation& sharedQubitRangeInlineInformation: sharedQubitRangeInlineInformationLookup) {
+            writer.appendWord(sharedQubitRangeInlineInformation.coveredQubitIndexRange.firstQubitIndex);
+            writer.appendWord(sharedQubitRangeInlineInformation.coveredQubitIndexRange.lastQubitIndex);
+            inlineStackTable.appendInlinedQubitInformation(writer, sharedQubitRangeInlineInformation.inlinedQubitInformation);
+        }
+    }
+    writer.appendArray(qubitInVariableLayoutsPerQubit);
+
+    const QuantumOperationArrays quantumOperationArrays = exportQuantumOperationsAsArrays();
+    writer.appendWord(quantumOperationArrays.distinctAnnotations.size());
+    for (const QuantumOperationAnnotationsLookup& annotations: quantumOperationArrays.distinctAnnotations) {
+        writer.appendWord(annotations.size());
+        for (const auto& [key, value]: annotations) {
+            writer.appendString(key);
+            writer.appendString(value);
+        }
+    }
+    writer.appendArray(quantumOperationArrays.opTypes);
+    writer.appendArray(quantumOperationArrays.targetOffsets);
+    writer.appendArray(quantumOperationArrays.targetQubits);
+    writer.appendArray(quantumOperationArrays.controlOffsets);
+    writer.appendArray(quantumOperationArrays.controlQubits);
+    writer.appendArray(quantumOperationArrays.isControlPositive);
+    writer.appendArray(quantumOperationArrays.annotationsIndices);
+    return writer.release();
+}
+
+std::unique_ptr<AnnotatableQuantumComputation> AnnotatableQuantumComputation::deserialize(const std::string_view serializedQuantumComputation) {
+    BinaryReader reader(serializedQuantumComputation);
+    Word         magic     = 0;
+    Word         byteOrder = 0;
+    Word         version   = 0;
+    Word         flags     = 0;
+    Word         numQubits = 0;
+    if (!reader.readWord(magic) || magic != BINARY_FORMAT_MAGIC || !reader.readWord(byteOrder) || byteOrder != BYTE_ORDER_MARK || !reader.readWord(version) || version != BINARY_FORMAT_VERSION || !reader.readWord(flags) || !reader.readWord(numQubits) || numQubits > std::numeric_limits<qc::Qubit>::max()) {
+        return nullptr;
+    }
+
+    std::vector<std::uint8_t> isAncillaryPerQubit;
+    std::vector<std::uint8_t> isGarbagePerQubit;
+    std::vector<qc::Qubit>    initialLayoutQubits;
+    std::vector<qc::Qubit>    outputPermutationQubits;
+    if (!reader.readArray(isAncillaryPerQubit) || isAncillaryPerQubit.size() != numQubits || !reader.readArray(isGarbagePerQubit) || isGarbagePerQubit.size() != numQubits || !reader.readArray(initialLayoutQubits) || !reader.readArray(outputPermutationQubits)) {
+        return nullptr;
+    }
+
+    std::vector<QubitInliningStack::ptr> inlineStacks;
+    if (!readModulesAndInlineStacks(reader, inlineStacks)) {
+        return nullptr;
+    }
+
+    auto        annotatableQuantumComputation = std::make_unique<AnnotatableQuantumComputation>((flags & FLAG_GENERATE_QUANTUM_OPERATION_ANNOTATIONS) != 0U);
+    std::size_t numVariableLayouts            = 0;
+    if (!reader.readCount(numVariableLayouts)) {
+        return nullptr;
+    }
+
+    // The quantum registers are added to the base quantum computation in the order of their variable layouts, with no gaps being allowed between the qubits of consecutive quantum registers.
+    for (std::size_t i = 0; i < numVariableLayouts; ++i) {
+        Word        kindOfVariableLayout = 0;
+        std::string quantumRegisterLabel;
+        Word        firstQubit = 0;
+        Word        lastQubit  = 0;
+        if (!reader.readWord(kindOfVariableLayout) || !reader.readString(quantumRegisterLabel) || !reader.readWord(firstQubit) || !reader.readWord(lastQubit) || quantumRegisterLabel.empty() || annotatableQuantumComputation->getQuantumRegisters().contains(quantumRegisterLabel) || firstQubit != annotatableQuantumComputation->getNqubits() || lastQubit < firstQubit || lastQubit >= numQubits) {
+            return nullptr;
+        }
+
+        const auto coveredQubitIndices = QubitIndexRange{.firstQubitIndex = static_cast<qc::Qubit>(firstQubit), .lastQubitIndex = static_cast<qc::Qubit>(lastQubit)};
+        if (kindOfVariableLayout == NON_ANCILLARY_QUANTUM_REGISTER_VARIABLE_LAYOUT) {
+            Word                                   elementQubitSize = 0;
+            std::vector<unsigned>                  numValuesPerDimension;
+            std::optional<InlinedQubitInformation> sharedInlinedQubitInformation;
+            if (!reader.readWord(elementQubitSize) || elementQubitSize == 0U || elementQubitSize > numQubits || !reader.readArray(numValuesPerDimension) || numValuesPerDimension.empty() || !readInlinedQubitInformation(reader, inlineStacks, sharedInlinedQubitInformation)) {
+                return nullptr;
+            }
+
+            Word numQubitsOfVariable = elementQubitSize;
+            for (const unsigned numValuesOfDimension: numValuesPerDimension) {
+                numQubitsOfVariable *= numValuesOfDimension;
+                if (numValuesOfDimension == 0U || numQubitsOfVariable > numQubits) {
+                    return nullptr;
+                }
+            }
+            if (numQubitsOfVariable != (lastQubit - firstQubit) + 1U) {
+                return nullptr;
+            }
+            annotatableQuantumComputation->quantumRegisterAssociatedVariableLayouts.emplace_back(std::make_unique<NonAncillaryQuantumRegisterVariableLayout>(coveredQubitIndices, quantumRegisterLabel, numValuesPerDimension, static_cast<unsigned>(elementQubitSize), sharedInlinedQubitInformation));
+        } else if (kindOfVariableLayout == ANCILLARY_QUANTUM_REGISTER_VARIABLE_LAYOUT) {
+            std::size_t numSharedQubitRanges = 0;
+            if (!reader.readCount(numSharedQubitRanges) || numSharedQubitRanges == 0U) {
+                return nullptr;
+            }
+
+            std::unique_ptr<AncillaryQuantumRegisterVariableLayout> ancillaryVariableLayout;
+            for (std::size_t j = 0; j < numSharedQubitRanges; ++j) {
+                Word                                   firstQubitOfRange = 0;
+                Word                                   lastQubitOfRange  = 0;
+                std::optional<InlinedQubitInformation> inlinedQubitInformation;
+                if (!reader.readWord(firstQubitOfRange) || !reader.readWord(lastQubitOfRange) || !readInlinedQubitInformation(reader, inlineStacks, inlinedQubitInformation) || !inlinedQubitInformation.has_value() || lastQubitOfRange < firstQubitOfRange || lastQubitOfRange > lastQubit) {
+                    return nullptr;
+                }
+
+                const auto coveredQubitIndicesOfRange = QubitIndexRange{.firstQubitIndex = static_cast<qc::Qubit>(firstQubitOfRange), .lastQubitIndex = static_cast<qc::Qubit>(lastQubitOfRange)};
+                if (ancillaryVariableLayout == nullptr) {
+                    if (firstQubitOfRange != firstQubit) {
+                        return nullptr;
+                    }
+                    ancillaryVariableLayout = std::make_unique<AncillaryQuantumRegisterVariableLayout>(coveredQubitIndicesOfRange, quantumRegisterLabel, *inlinedQubitInformation);
+                } else if (!ancillaryVariableLayout->appendQubitRange(coveredQubitIndicesOfRange, *inlinedQubitInformation)) {
+                    return nullptr;
+                }
+            }
+            if (ancillaryVariableLayout->storedQubitIndices.lastQubitIndex != lastQubit) {
+                return nullptr;
+            }
+            annotatableQuantumComputation->quantumRegisterAssociatedVariableLayouts.emplace_back(std::move(ancillaryVariableLayout));
+        } else {
+            return nullptr;
+        }
+
+        static_cast<void>(annotatableQuantumComputation->addQubitRegister((lastQubit - firstQubit) + 1U, quantumRegisterLabel));
+        annotatableQuantumComputation->indexOfVariableLayoutPerQubit.resize(annotatableQuantumComputation->getNqubits(), annotatableQuantumComputation->quantumRegisterAssociatedVariableLayouts.size() - 1U);
+    }
+    if (annotatableQuantumComputation->getNqubits() != numQubits) {
+        return nullptr;
+    }
+
+    // The quantum registers were added for the qubits of the variable layouts and need to be split if the qubits of the quantum computation were permuted.
+    std::vector<qc::Qubit> qubitInVariableLayoutsPerQubit;
+    if (!reader.readArray(qubitInVariableLayoutsPerQubit) || (!qubitInVariableLayoutsPerQubit.empty() && qubitInVariableLayoutsPerQubit.size() != numQubits)) {
+        return nullptr;
+    }
+    std::vector<bool> isQubitInVariableLayoutsAssigned(qubitInVariableLayoutsPerQubit.size(), false);
+    for (const qc::Qubit qubitInVariableLayouts: qubitInVariableLayoutsPerQubit) {
+        if (qubitInVariableLayouts >= numQubits || isQubitInVariableLayoutsAssigned[qubitInVariableLayouts]) {
+            return nullptr;
+        }
+        isQubitInVariableLayoutsAssigned[qubitInVariableLayouts] = true;
+    }
+    if (!qubitInVariableLayoutsPerQubit.empty()) {
+        annotatableQuantumComputation->qubitInVariableLayoutsPerQubit = std::move(qubitInVariableLayoutsPerQubit);
+        annotatableQuantumComputation->splitQuantumRegistersOfPermutedQubits();
+    }
+
+    // The ancillary qubits can only be marked once all quantum registers were added to the base quantum computation.
+    for (qc::Qubit qubit = 0; qubit < numQubits; ++qubit) {
+        if (isAncillaryPerQubit[qubit] != 0U) {
+            annotatableQuantumComputation->setLogicalQubitsAncillary(qubit, qubit);
+        }
+        if (isGarbagePerQubit[qubit] != 0U) {
+            annotatableQuantumComputation->setLogicalQubitsGarbage(qubit, qubit);
+        }
+    }
+    annotatableQuantumComputation->canQubitsBeAddedToQuantumComputation = (flags & FLAG_CAN_QUBITS_BE_ADDED) != 0U;
+
+    const auto readPermutation = [numQubits](const std::vector<qc::Qubit>& mappedQubits) -> std::optional<qc::Permutation> {
+        if (mappedQubits.size() % 2U != 0U) {
+            return std::nullopt;
+        }
+        qc::Permutation permutation;
+        for (std::size_t i = 0; i < mappedQubits.size(); i += 2U) {
+            if (mappedQubits[i] >= numQubits || mappedQubits[i + 1U] >= numQubits) {
+                return std::nullopt;
+            }
+            permutation.insert_or_assign(mappedQubits[i], mappedQubits[i + 1U]);
+        }
+        return permutation;
+    };
+    std::optional<qc::Permutation> deserializedInitialLayout     = readPermutation(initialLayoutQubits);
+    std::optional<qc::Permutation> deserializedOutputPermutation = readPermutation(outputPermutationQubits);
+    if (!deserializedInitialLayout.has_value() || !deserializedOutputPermutation.has_value()) {
+        return nullptr;
+    }
+    annotatableQuantumComputation->initialLayout     = std::move(*deserializedInitialLayout);
+    annotatableQuantumComputation->outputPermutation = std::move(*deserializedOutputPermutation);
+
+    std::size_t numDistinctAnnotations = 0;
+    if (!reader.readCount(numDistinctAnnotations)) {
+        return nullptr;
+    }
+    std::vector<QuantumOperationAnnotationsLookup> distinctAnnotations(numDistinctAnnotations);
+    std::vector<std::optional<unsigned>>           statementLineNumberOfDistinctAnnotations(numDistinctAnnotations);
+    for (std::size_t i = 0; i < numDistinctAnnotations; ++i) {
+        std::size_t numAnnotations = 0;
+        if (!reader.readCount(numAnnotations)) {
+            return nullptr;
+        }
+        for (std::size_t j = 0; j < numAnnotations; ++j) {
+            std::string key;
+            std::string value;
+            if (!reader.readString(key) || !reader.readString(value)) {
+                return nullptr;
+            }
+            // The statement line number is not stored as an annotation (see QUANTUM_OPERATION_ANNOTATION_KEY_ASSOCIATED_STATEMENT_LINE_NUMBER).
+            if (key == QUANTUM_OPERATION_ANNOTATION_KEY_ASSOCIATED_STATEMENT_LINE_NUMBER) {
+                statementLineNumberOfDistinctAnnotations[i] = tryParseStatementLineNumber(value);
+                if (!statementLineNumberOfDistinctAnnotations[i].has_value()) {
+                    return nullptr;
+                }
+            } else {
+                distinctAnnotations[i].insert_or_assign(std::move(key), std::move(value));
+            }
+        }
+    }
+
+    QuantumOperationArrays quantumOperationArrays;
+    if (!reader.readArray(quantumOperationArrays.opTypes) || !reader.readArray(quantumOperationArrays.targetOffsets) || !reader.readArray(quantumOperationArrays.targetQubits) || !reader.readArray(quantumOperationArrays.controlOffsets) || !reader.readArray(quantumOperationArrays.controlQubits) || !reader.readArray(quantumOperationArrays.isControlPositive) || !reader.readArray(quantumOperationArrays.annotationsIndices) || !reader.isAtEnd()) {
+        return nullptr;
+    }
+
+    const std::size_t numQuantumOperations = quantumOperationArrays.opTypes.size();
+    if (!areOffsetsValid(quantumOperationArrays.targetOffsets, numQuantumOperations, quantumOperationArrays.targetQubits) || !areOffsetsValid(quantumOperationArrays.controlOffsets, numQuantumOperations, quantumOperationArrays.controlQubits) || quantumOperationArrays.isControlPositive.size() != quantumOperationArrays.controlQubits.size() || quantumOperationArrays.annotationsIndices.size() != numQuantumOperations) {
+        return nullptr;
+    }
+
+    annotatableQuantumComputation->ops.reserve(numQuantumOperations);
+    for (std::size_t i = 0; i < numQuantumOperations; ++i) {
+        const auto opType = static_cast<qc::OpType>(quantumOperationArrays.opTypes[i]);
+        if (quantumOperationArrays.annotationsIndices[i] >= numDistinctAnnotations || (opType != qc::OpType::X && opType != qc::OpType::SWAP)) {
+            return nullptr;
+        }
+
+        qc::Targets targetQubits(std::next(quantumOperationArrays.targetQubits.cbegin(), static_cast<std::ptrdiff_t>(quantumOperationArrays.targetOffsets[i])), std::next(quantumOperationArrays.targetQubits.cbegin(), static_cast<std::ptrdiff_t>(quantumOperationArrays.targetOffsets[i + 1U])));
+        qc::Controls controlQubits;
+        for (std::uint64_t j = quantumOperationArrays.controlOffsets[i]; j < quantumOperationArrays.controlOffsets[i + 1U]; ++j) {
+            controlQubits.emplace(qc::Control{quantumOperationArrays.controlQubits[j], quantumOperationArrays.isControlPositive[j] != 0U ? qc::Control::Type::Pos : qc::Control::Type::Neg});
+        }
+
+        // The qubits of a gate must be distinct qubits of the quantum computation.
+        const std::size_t             expectedNumTargetQubits = opType == qc::OpType::X ? 1U : 2U;
+        std::unordered_set<qc::Qubit> qubitsOfGate(targetQubits.cbegin(), targetQubits.cend());
+        for (const qc::Control& controlQubit: controlQubits) {
+            qubitsOfGate.emplace(controlQubit.qubit);
+        }
+        if (targetQubits.size() != expectedNumTargetQubits || controlQubits.size() != quantumOperationArrays.controlOffsets[i + 1U] - quantumOperationArrays.controlOffsets[i] || qubitsOfGate.size() != targetQubits.size() + controlQubits.size() || std::ranges::any_of(qubitsOfGate, [numQubits](const qc::Qubit qubit) { return qubit >= numQubits; })) {
+            return nullptr;
+        }
+        annotatableQuantumComputation->emplace_back<qc::StandardOperation>(controlQubits, targetQubits, opType);
+    }
+
+    // Consecutive quantum operations usually share their annotations, thus the annotations are assigned to every range of quantum operations referencing the same distinct annotations.
+    if (annotatableQuantumComputation->generateQuantumOperationAnnotations && numQuantumOperations != 0U) {
+        annotatableQuantumComputation->annotationsPerQuantumOperation.resize(numQuantumOperations);
+        std::size_t firstPositionOfRange = 0;
+        for (std::size_t position = 1; position <= numQuantumOperations; ++position) {
+            if (position < numQuantumOperations && quantumOperationArrays.annotationsIndices[position] == quantumOperationArrays.annotationsIndices[firstPositionOfRange]) {
+                continue;
+            }
+            const std::uint64_t indexOfAnnotations = quantumOperationArrays.annotationsIndices[firstPositionOfRange];
+            annotatableQuantumComputation->annotationsPerQuantumOperation.setOrUpdateAnnotationsOfQuantumOperations(firstPositionOfRange, position - 1U, distinctAnnotations[indexOfAnnotations], {}, statementLineNumberOfDistinctAnnotations[indexOfAnnotations]);
+            firstPositionOfRange = position;
+        }
+    }
+    annotatableQuantumComputation->recordSynthesisCostOfAddedQuantumOperations(0U);
+    return annotatableQuantumComputation;
+}
+
+bool AnnotatableQuantumComputation::save(const std::string& filename) const {
+    const std::optional<std::string> serializedQuantumComputation = serialize();
+    if (!serializedQuantumComputation.has_value()) {
+        return false;
+    }
+
+    std::ofstream os(filename, std::ofstream::out | std::ofstream::binary | std::ofstream::trunc);
+    if (!os.good()) {
+        std::cerr << "Cannot open " + filename << '\n';
+        return false;
+    }
+    os.write(serializedQuantumComputation->data(), static_cast<std::streamsize>(serializedQuantumComputation->size()));
+    return os.good();
+}
+
+std::unique_ptr<AnnotatableQuantumComputation> AnnotatableQuantumComputation::load(const std::string& filename) {
+    const MappedFile file(filename, MappedFile::AccessPattern::Sequential);
+    if (!file.isOpen()) {
+        std::cerr << "Cannot open " + filename << '\n';
+        return nullptr;
+    }
+
+    std::unique_ptr<AnnotatableQuantumComputation> annotatableQuantumComputation = deserialize(file.getContent());
+    if (annotatableQuantumComputation == nullptr) {
+        std::cerr << filename + " is not a quantum computation in the binary format" << '\n';
+    }
+    return annotatableQuantumComputation;
+}
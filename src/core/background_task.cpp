@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/background_task.hpp"
+
+#include "core/diagnostics.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+
+BackgroundTask::BackgroundTask(Work work):
+    work(std::move(work)), worker([this] { execute(); }) {}
+
+BackgroundTask::~BackgroundTask() {
+    requestCancellation();
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
+
+void BackgroundTask::reportProgress(const std::size_t numProcessedWorkItems, const std::size_t numWorkItems) noexcept {
+    this->numWorkItems.store(numWorkItems, std::memory_order_relaxed);
+    this->numProcessedWorkItems.store(numProcessedWorkItems, std::memory_order_release);
+}
+
+bool BackgroundTask::wait(const std::optional<std::chrono::milliseconds>& optionalTimeout) const {
+    std::unique_lock terminationLock(terminationMutex);
+    if (!optionalTimeout.has_value()) {
+        terminationCondition.wait(terminationLock, [this] { return isFinished(); });
+        return true;
+    }
+    return terminationCondition.wait_for(terminationLock, *optionalTimeout, [this] { return isFinished(); });
+}
+
+std::vector<std::string> BackgroundTask::getErrorMessages() const {
+    return isFinished() ? diagnostics.getErrorMessages() : std::vector<std::string>();
+}
+
+void BackgroundTask::execute() {
+    bool workOk = false;
+    {
+        const ScopedDiagnosticsCollection diagnosticsCollection(diagnostics);
+        // An exception must not escape the worker thread since it would terminate the process.
+        try {
+            workOk = work != nullptr && work(*this);
+        } catch (const std::exception& exception) {
+            getErrorStream() << "Background task failed with an unexpected exception: " << exception.what() << "\n";
+        }
+    }
+
+    const State finalState = workOk ? State::Succeeded : (isCancellationRequested() ? State::Cancelled : State::Failed);
+    {
+        // The state is updated while holding the mutex to not miss the notification of a waiting thread that checked the state before it was updated.
+        const std::scoped_lock terminationLock(terminationMutex);
+        state.store(finalState, std::memory_order_release);
+    }
+    terminationCondition.notify_all();
+}
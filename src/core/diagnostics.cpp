@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/diagnostics.hpp"
+
+#include <cstddef>
+#include <iostream>
+#include <ostream>
+#include <string>
+
+using namespace syrec;
+
+namespace {
+    thread_local std::ostream* errorStreamOfCurrentThread = nullptr;
+} // namespace
+
+void Diagnostics::reportErrors(const std::string& text) {
+    std::size_t startOfLine = 0;
+    while (startOfLine < text.size()) {
+        std::size_t endOfLine = text.find('\n', startOfLine);
+        if (endOfLine == std::string::npos) {
+            endOfLine = text.size();
+        }
+        if (endOfLine > startOfLine) {
+            errorMessages.emplace_back(text.substr(startOfLine, endOfLine - startOfLine));
+        }
+        startOfLine = endOfLine + 1U;
+    }
+}
+
+std::ostream& syrec::getErrorStream() noexcept {
+    return errorStreamOfCurrentThread != nullptr ? *errorStreamOfCurrentThread : std::cerr;
+}
+
+ScopedDiagnosticsCollection::ScopedDiagnosticsCollection(Diagnostics& diagnostics):
+    diagnostics(diagnostics), errorStreamOfEnclosingCollection(errorStreamOfCurrentThread) {
+    errorStreamOfCurrentThread = &collectedErrors;
+}
+
+ScopedDiagnosticsCollection::~ScopedDiagnosticsCollection() {
+    errorStreamOfCurrentThread = errorStreamOfEnclosingCollection;
+    diagnostics.reportErrors(collectedErrors.str());
+}
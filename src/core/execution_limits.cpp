@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/execution_limits.hpp"
+
+#include "core/diagnostics.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#if _WIN32
+#include <windows.h>
+// The psapi header must be included after the windows header.
+#include <psapi.h>
+#elif __APPLE__
+#include <mach/mach.h>
+#elif __linux__
+#include <fstream>
+#include <unistd.h>
+#endif
+
+using namespace syrec;
+
+namespace {
+    constexpr double                    NUM_BYTES_PER_MIB = 1024. * 1024.;
+    constexpr std::chrono::milliseconds MIN_DURATION_BETWEEN_MEMORY_SAMPLES{1};
+} // namespace
+
+std::string_view syrec::stringifyExecutionLimitViolation(const ExecutionLimitViolation violation) noexcept {
+    switch (violation) {
+        case ExecutionLimitViolation::None:
+            return "none";
+        case ExecutionLimitViolation::Cancelled:
+            return "cancelled";
+        case ExecutionLimitViolation::TimeLimitExceeded:
+            return "time_limit_exceeded";
+        case ExecutionLimitViolation::MemoryBudgetExceeded:
+            return "memory_budget_exceeded";
+    }
+    return "none";
+}
+
+std::optional<std::uint64_t> syrec::determineResidentSetSizeInBytes() {
+#if _WIN32
+    PROCESS_MEMORY_COUNTERS processMemoryCounters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &processMemoryCounters, sizeof(processMemoryCounters)) == 0) {
+        return std::nullopt;
+    }
+    return static_cast<std::uint64_t>(processMemoryCounters.WorkingSetSize);
+#elif __APPLE__
+    mach_task_basic_info_data_t taskInfo{};
+    mach_msg_type_number_t      taskInfoCount = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&taskInfo), &taskInfoCount) != KERN_SUCCESS) {
+        return std::nullopt;
+    }
+    return static_cast<std::uint64_t>(taskInfo.resident_size);
+#elif __linux__
+    // The second field of the statm file stores the resident set size in pages.
+    std::ifstream statmFile("/proc/self/statm");
+    std::uint64_t numPagesOfProgram = 0;
+    std::uint64_t numResidentPages  = 0;
+    const long    pageSizeInBytes   = sysconf(_SC_PAGESIZE);
+    if (!(statmFile >> numPagesOfProgram >> numResidentPages) || pageSizeInBytes <= 0) {
+        return std::nullopt;
+    }
+    return numResidentPages * static_cast<std::uint64_t>(pageSizeInBytes);
+#else
+    return std::nullopt;
+#endif
+}
+
+ExecutionLimitsMonitor::ExecutionLimitsMonitor(ExecutionLimits executionLimits):
+    executionLimits(std::move(executionLimits)), startTime(std::chrono::steady_clock::now()) {}
+
+bool ExecutionLimitsMonitor::isAnyLimitViolated() {
+    if (getViolation() != ExecutionLimitViolation::None) {
+        return true;
+    }
+    if (executionLimits.optionalCancellationToken.has_value() && executionLimits.optionalCancellationToken->isCancellationRequested()) {
+        recordViolation(ExecutionLimitViolation::Cancelled);
+        return true;
+    }
+    if (!executionLimits.timeLimitInMilliseconds.has_value() && !executionLimits.memoryBudgetInMiB.has_value()) {
+        return false;
+    }
+
+    const auto elapsedTime = std::chrono::steady_clock::now() - startTime;
+    if (executionLimits.timeLimitInMilliseconds.has_value() && elapsedTime >= std::chrono::milliseconds(*executionLimits.timeLimitInMilliseconds)) {
+        recordViolation(ExecutionLimitViolation::TimeLimitExceeded);
+        return true;
+    }
+    if (!executionLimits.memoryBudgetInMiB.has_value()) {
+        return false;
+    }
+
+    // Only the thread advancing the time of the next sample determines the resident set size.
+    const auto   elapsedTimeInNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsedTime).count();
+    std::int64_t nextSampleInNanoseconds  = nextSampleOfResidentSetSizeInNanoseconds.load(std::memory_order_relaxed);
+    if (elapsedTimeInNanoseconds < nextSampleInNanoseconds || !nextSampleOfResidentSetSizeInNanoseconds.compare_exchange_strong(nextSampleInNanoseconds, elapsedTimeInNanoseconds + std::chrono::nanoseconds(MIN_DURATION_BETWEEN_MEMORY_SAMPLES).count(), std::memory_order_relaxed)) {
+        return false;
+    }
+    if (const std::optional<std::uint64_t> residentSetSizeInBytes = determineResidentSetSizeInBytes(); residentSetSizeInBytes.has_value() && static_cast<double>(*residentSetSizeInBytes) / NUM_BYTES_PER_MIB > *executionLimits.memoryBudgetInMiB) {
+        recordViolation(ExecutionLimitViolation::MemoryBudgetExceeded);
+        return true;
+    }
+    return false;
+}
+
+void ExecutionLimitsMonitor::recordViolation(const ExecutionLimitViolation detectedViolation) {
+    ExecutionLimitViolation expectedViolation = ExecutionLimitViolation::None;
+    if (!violation.compare_exchange_strong(expectedViolation, detectedViolation, std::memory_order_acq_rel)) {
+        return;
+    }
+
+    switch (detectedViolation) {
+        case ExecutionLimitViolation::Cancelled:
+            getErrorStream() << "Computation was cancelled\n";
+            break;
+        case ExecutionLimitViolation::TimeLimitExceeded:
+            getErrorStream() << "Computation exceeded its time limit of " << std::to_string(*executionLimits.timeLimitInMilliseconds) << "ms\n";
+            break;
+        case ExecutionLimitViolation::MemoryBudgetExceeded:
+            getErrorStream() << "Computation exceeded its memory budget of " << std::to_string(*executionLimits.memoryBudgetInMiB) << "MiB\n";
+            break;
+        case ExecutionLimitViolation::None:
+            break;
+    }
+}
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/executor.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+using namespace syrec;
+
+namespace {
+    // The executor and the index of the task queue owned by the calling thread if the latter is a worker thread of an executor.
+    thread_local const Executor* executorOfCurrentThread         = nullptr;
+    thread_local std::size_t     indexOfTaskQueueOfCurrentThread = 0;
+
+    // The state of a parallel loop shared by its calling thread and the tasks submitted to the worker threads, with the latter only accessing the executed function while being registered as an active participant.
+    class ParallelLoopState {
+    public:
+        ParallelLoopState(const std::size_t count, const std::size_t numGroups, const bool deterministic, const std::function<void(std::size_t)>& function):
+            count(count), numGroups(numGroups), deterministic(deterministic), function(&function) {}
+
+        // Participants starting after the calling thread stopped waiting for the loop would find no unclaimed index but must not access the function anymore.
+        void participate() {
+            {
+                const std::scoped_lock lock(mutex);
+                if (isFinished) {
+                    return;
+                }
+                ++numActiveParticipants;
+            }
+
+            if (deterministic) {
+                for (std::size_t group = nextClaimable.fetch_add(1U, std::memory_order_relaxed); group < numGroups; group = nextClaimable.fetch_add(1U, std::memory_order_relaxed)) {
+                    for (std::size_t index = group; index < count; index += numGroups) {
+                        execute(index);
+                    }
+                }
+            } else {
+                for (std::size_t index = nextClaimable.fetch_add(1U, std::memory_order_relaxed); index < count; index = nextClaimable.fetch_add(1U, std::memory_order_relaxed)) {
+                    execute(index);
+                }
+            }
+
+            const std::scoped_lock lock(mutex);
+            if (--numActiveParticipants == 0U) {
+                participantsFinished.notify_all();
+            }
+        }
+
+        // Called by the calling thread after its own participation, at which point all indices were claimed.
+        void waitForActiveParticipants() {
+            std::unique_lock lock(mutex);
+            isFinished = true;
+            participantsFinished.wait(lock, [this] { return numActiveParticipants == 0U; });
+        }
+
+        void rethrowFirstException() const {
+            if (firstException != nullptr) {
+                std::rethrow_exception(firstException);
+            }
+        }
+
+    private:
+        std::size_t                             count;
+        std::size_t                             numGroups;
+        bool                                    deterministic;
+        const std::function<void(std::size_t)>* function;
+        std::atomic<std::size_t>                nextClaimable = 0;
+        std::mutex                              mutex;
+        std::condition_variable                 participantsFinished;
+        std::size_t                             numActiveParticipants = 0;
+        bool                                    isFinished            = false;
+        std::exception_ptr                      firstException;
+        std::size_t                             indexOfFirstException = 0;
+
+        void execute(const std::size_t index) {
+            try {
+                (*function)(index);
+            } catch (...) {
+                const std::scoped_lock lock(mutex);
+                if (firstException == nullptr || index < indexOfFirstException) {
+                    firstException        = std::current_exception();
+                    indexOfFirstException = index;
+                }
+            }
+        }
+    };
+} // namespace
+
+Executor::Executor(const std::size_t numWorkerThreads) {
+    taskQueues.reserve(numWorkerThreads);
+    for (std::size_t i = 0; i < numWorkerThreads; ++i) {
+        taskQueues.emplace_back(std::make_unique<TaskQueue>());
+    }
+    // All task queues must exist before the first worker thread tries to steal from them.
+    workers.reserve(numWorkerThreads);
+    for (std::size_t i = 0; i < numWorkerThreads; ++i) {
+        workers.emplace_back([this, i] { runWorker(i); });
+    }
+}
+
+Executor::~Executor() {
+    {
+        const std::scoped_lock lock(idleMutex);
+        stopRequested = true;
+    }
+    idleCondition.notify_all();
+    for (auto& worker: workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+Executor& Executor::getShared() {
+    static Executor sharedExecutor(determineNumThreads(0U) - 1U);
+    return sharedExecutor;
+}
+
+std::size_t Executor::determineNumThreads(const std::size_t requestedNumThreads) noexcept {
+    return requestedNumThreads == 0U ? std::max(1U, std::thread::hardware_concurrency()) : requestedNumThreads;
+}
+
+void Executor::pinWorkerThreadsToCores() {
+    std::call_once(pinningOfWorkerThreads, [this] {
+#if defined(__linux__)
+        const std::size_t numCores = determineNumThreads(0U);
+        for (std::size_t i = 0; i < workers.size(); ++i) {
+            // The first core is left to the calling threads which also participate in the parallel loops.
+            cpu_set_t cores;
+            CPU_ZERO(&cores);
+            CPU_SET((i + 1U) % numCores, &cores);
+            pthread_setaffinity_np(workers[i].native_handle(), sizeof(cpu_set_t), &cores);
+        }
+#endif
+    });
+}
+
+void Executor::parallelFor(const std::size_t count, const std::function<void(std::size_t)>& function, const std::size_t maxNumThreads, const bool deterministic) {
+    if (count == 0U) {
+        return;
+    }
+
+    const std::size_t numThreads = std::min(count, determineNumThreads(maxNumThreads));
+    const auto        state      = std::make_shared<ParallelLoopState>(count, numThreads, deterministic, function);
+    const std::size_t numHelpers = std::min(numThreads - 1U, workers.size());
+    for (std::size_t i = 0; i < numHelpers; ++i) {
+        submit([state] { state->participate(); });
+    }
+    state->participate();
+    state->waitForActiveParticipants();
+    state->rethrowFirstException();
+}
+
+void Executor::submit(Task task) {
+    const std::scoped_lock idleLock(idleMutex);
+    const std::size_t      indexOfTaskQueue = executorOfCurrentThread == this ? indexOfTaskQueueOfCurrentThread : nextTaskQueue++ % taskQueues.size();
+    {
+        TaskQueue&             taskQueue = *taskQueues[indexOfTaskQueue];
+        const std::scoped_lock queueLock(taskQueue.mutex);
+        taskQueue.tasks.emplace_back(std::move(task));
+    }
+    ++numQueuedTasks;
+    idleCondition.notify_one();
+}
+
+bool Executor::tryTakeTask(const std::size_t indexOfOwnTaskQueue, Task& task) {
+    for (std::size_t i = 0; i < taskQueues.size(); ++i) {
+        const bool             isOwnTaskQueue = i == 0U;
+        TaskQueue&             taskQueue      = *taskQueues[(indexOfOwnTaskQueue + i) % taskQueues.size()];
+        const std::scoped_lock queueLock(taskQueue.mutex);
+        if (taskQueue.tasks.empty()) {
+            continue;
+        }
+        // The most recently submitted task of the own queue is taken while the oldest task of the queue of another worker is stolen.
+        if (isOwnTaskQueue) {
+            task = std::move(taskQueue.tasks.back());
+            taskQueue.tasks.pop_back();
+        } else {
+            task = std::move(taskQueue.tasks.front());
+            taskQueue.tasks.pop_front();
+        }
+        return true;
+    }
+    return false;
+}
+
+void Executor::runWorker(const std::size_t indexOfOwnTaskQueue) {
+    executorOfCurrentThread         = this;
+    indexOfTaskQueueOfCurrentThread = indexOfOwnTaskQueue;
+    while (true) {
+        {
+            std::unique_lock idleLock(idleMutex);
+            idleCondition.wait(idleLock, [this] { return stopRequested || numQueuedTasks > 0U; });
+            if (stopRequested) {
+                return;
+            }
+        }
+
+        // Another worker might have taken the queued task in the meantime.
+        if (Task task; tryTakeTask(indexOfOwnTaskQueue, task)) {
+            {
+                const std::scoped_lock idleLock(idleMutex);
+                --numQueuedTasks;
+            }
+            task();
+        }
+    }
+}
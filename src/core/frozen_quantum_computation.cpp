@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/frozen_quantum_computation.hpp"
+
+#include "core/annotatable_quantum_computation.hpp"
+#include "ir/Definitions.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <string>
+#include <vector>
+
+using namespace syrec;
+
+const FrozenQuantumComputation::QuantumOperationAnnotationsLookup* FrozenQuantumComputation::getAnnotationsOfQuantumOperation(const std::size_t indexOfQuantumOperationInQuantumComputation) const {
+    const std::optional<std::size_t> position = determinePositionOfQuantumOperation(indexOfQuantumOperationInQuantumComputation);
+    if (!position.has_value() || gateOffsets[*position] == gateOffsets[*position + 1]) {
+        return nullptr;
+    }
+    return &quantumOperationArrays.distinctAnnotations[quantumOperationArrays.annotationsIndices[gateOffsets[*position]]];
+}
+
+std::optional<unsigned> FrozenQuantumComputation::getStatementLineNumberOfQuantumOperation(const std::size_t indexOfQuantumOperationInQuantumComputation) const {
+    const std::optional<std::size_t> position = determinePositionOfQuantumOperation(indexOfQuantumOperationInQuantumComputation);
+    if (!position.has_value() || gateOffsets[*position] == gateOffsets[*position + 1]) {
+        return std::nullopt;
+    }
+    return statementLineNumberPerDistinctAnnotations[quantumOperationArrays.annotationsIndices[gateOffsets[*position]]];
+}
+
+FrozenQuantumComputation::DepthAnalysis FrozenQuantumComputation::analyzeDepth() const {
+    DepthAnalysis depthAnalysis;
+    depthAnalysis.numQuantumOperationsPerQubit.resize(numQubits, 0);
+    depthAnalysis.layerPerQuantumOperation.reserve(getNops());
+
+    std::vector<std::size_t>                numLayersPerQubit(numQubits, 0);
+    std::vector<std::optional<std::size_t>> positionOfLastQuantumOperationPerQubit(numQubits, std::nullopt);
+    std::vector<std::optional<std::size_t>> positionOfPredecessorOnLongestPathPerQuantumOperation(getNops(), std::nullopt);
+    std::vector<qc::Qubit>                  qubitsOfQuantumOperation;
+    std::optional<std::size_t>              positionOfLastQuantumOperationOfCriticalPath;
+
+    for (std::size_t position = 0; position < getNops(); ++position) {
+        collectQubitsOfQuantumOperation(position, qubitsOfQuantumOperation);
+
+        std::size_t layerOfQuantumOperation = 0;
+        for (const qc::Qubit qubit: qubitsOfQuantumOperation) {
+            if (numLayersPerQubit[qubit] > layerOfQuantumOperation) {
+                layerOfQuantumOperation                                         = numLayersPerQubit[qubit];
+                positionOfPredecessorOnLongestPathPerQuantumOperation[position] = positionOfLastQuantumOperationPerQubit[qubit];
+            }
+        }
+        for (const qc::Qubit qubit: qubitsOfQuantumOperation) {
+            numLayersPerQubit[qubit]                      = layerOfQuantumOperation + 1U;
+            positionOfLastQuantumOperationPerQubit[qubit] = position;
+            ++depthAnalysis.numQuantumOperationsPerQubit[qubit];
+        }
+        depthAnalysis.layerPerQuantumOperation.emplace_back(layerOfQuantumOperation);
+
+        if (layerOfQuantumOperation + 1U > depthAnalysis.depth) {
+            depthAnalysis.depth                          = layerOfQuantumOperation + 1U;
+            positionOfLastQuantumOperationOfCriticalPath = position;
+        }
+    }
+
+    for (std::optional<std::size_t> position = positionOfLastQuantumOperationOfCriticalPath; position.has_value(); position = positionOfPredecessorOnLongestPathPerQuantumOperation[*position]) {
+        depthAnalysis.indicesOfQuantumOperationsOfCriticalPath.emplace_back(*position + getIndexOfFirstQuantumOperation());
+        if (const std::optional<unsigned> statementLineNumber = getStatementLineNumberOfQuantumOperation(*position + getIndexOfFirstQuantumOperation()); statementLineNumber.has_value()) {
+            ++depthAnalysis.numQuantumOperationsOfCriticalPathPerStatementLineNumber[std::to_string(*statementLineNumber)];
+        }
+    }
+    std::ranges::reverse(depthAnalysis.indicesOfQuantumOperationsOfCriticalPath);
+    return depthAnalysis;
+}
+
+FrozenQuantumComputation::QuantumOperationLayout FrozenQuantumComputation::determineLayoutOfQuantumOperations() const {
+    QuantumOperationLayout layout;
+    layout.columnPerGate.reserve(getNumGates());
+    layout.minQubitPerGate.reserve(getNumGates());
+    layout.maxQubitPerGate.reserve(getNumGates());
+
+    std::vector<std::uint64_t> firstFreeColumnPerQubit(numQubits, 0);
+    for (std::size_t gateIndex = 0; gateIndex < getNumGates(); ++gateIndex) {
+        std::optional<qc::Qubit> minQubit;
+        std::optional<qc::Qubit> maxQubit;
+        const auto               extendSpan = [&](const qc::Qubit qubit) {
+            if (isQubitWithinRange(qubit)) {
+                minQubit = std::min(qubit, minQubit.value_or(qubit));
+                maxQubit = std::max(qubit, maxQubit.value_or(qubit));
+            }
+        };
+        std::ranges::for_each(getTargetQubitsOfGate(gateIndex), extendSpan);
+        std::ranges::for_each(getControlQubitsOfGate(gateIndex), extendSpan);
+
+        std::uint64_t column = 0;
+        if (minQubit.has_value() && maxQubit.has_value()) {
+            const auto spannedQubits = std::ranges::subrange(firstFreeColumnPerQubit.begin() + *minQubit, firstFreeColumnPerQubit.begin() + *maxQubit + 1);
+            column                   = std::ranges::max(spannedQubits);
+            std::ranges::fill(spannedQubits, column + 1U);
+        }
+        layout.columnPerGate.emplace_back(column);
+        layout.minQubitPerGate.emplace_back(minQubit.value_or(0U));
+        layout.maxQubitPerGate.emplace_back(maxQubit.value_or(0U));
+        layout.numColumns = std::max(layout.numColumns, static_cast<std::size_t>(column) + 1U);
+    }
+
+    layout.columnOffsets.assign(layout.numColumns + 1U, 0U);
+    for (const std::uint64_t column: layout.columnPerGate) {
+        ++layout.columnOffsets[column + 1U];
+    }
+    std::partial_sum(layout.columnOffsets.cbegin(), layout.columnOffsets.cend(), layout.columnOffsets.begin());
+
+    std::vector<std::uint64_t> nextPositionPerColumn(layout.columnOffsets.cbegin(), layout.columnOffsets.cend() - 1);
+    layout.gatesOrderedByColumn.resize(layout.columnPerGate.size());
+    for (std::size_t gateIndex = 0; gateIndex < layout.columnPerGate.size(); ++gateIndex) {
+        layout.gatesOrderedByColumn[nextPositionPerColumn[layout.columnPerGate[gateIndex]]++] = gateIndex;
+    }
+    return layout;
+}
+
+FrozenQuantumComputation::SynthesisCostMetricValue FrozenQuantumComputation::determineNearestNeighborCost() const {
+    SynthesisCostMetricValue nearestNeighborCost = 0;
+    std::vector<qc::Qubit>   qubitsOfGate;
+    for (std::size_t gateIndex = 0; gateIndex < getNumGates(); ++gateIndex) {
+        const std::span<const qc::Qubit> targetQubits  = getTargetQubitsOfGate(gateIndex);
+        const std::span<const qc::Qubit> controlQubits = getControlQubitsOfGate(gateIndex);
+        qubitsOfGate.assign(targetQubits.begin(), targetQubits.end());
+        qubitsOfGate.insert(qubitsOfGate.end(), controlQubits.begin(), controlQubits.end());
+        std::ranges::sort(qubitsOfGate);
+        qubitsOfGate.erase(std::ranges::unique(qubitsOfGate).begin(), qubitsOfGate.end());
+        nearestNeighborCost += AnnotatableQuantumComputation::getNearestNeighborCostOfGate(qubitsOfGate);
+    }
+    return nearestNeighborCost;
+}
+
+// BEGIN NON-PUBLIC FUNCTIONALITY
+std::optional<std::size_t> FrozenQuantumComputation::determinePositionOfQuantumOperation(const std::size_t indexOfQuantumOperationInQuantumComputation) const noexcept {
+    if (indexOfQuantumOperationInQuantumComputation < getIndexOfFirstQuantumOperation() || indexOfQuantumOperationInQuantumComputation - getIndexOfFirstQuantumOperation() >= getNops()) {
+        return std::nullopt;
+    }
+    return indexOfQuantumOperationInQuantumComputation - getIndexOfFirstQuantumOperation();
+}
+
+bool FrozenQuantumComputation::isQubitWithinRange(const qc::Qubit qubit) const noexcept {
+    return qubit < numQubits;
+}
+
+void FrozenQuantumComputation::collectQubitsOfQuantumOperation(const std::size_t position, std::vector<qc::Qubit>& qubits) const {
+    qubits.clear();
+    for (std::uint64_t gateIndex = gateOffsets[position]; gateIndex < gateOffsets[position + 1]; ++gateIndex) {
+        const std::span<const qc::Qubit> targetQubits  = getTargetQubitsOfGate(gateIndex);
+        const std::span<const qc::Qubit> controlQubits = getControlQubitsOfGate(gateIndex);
+        qubits.insert(qubits.end(), targetQubits.begin(), targetQubits.end());
+        qubits.insert(qubits.end(), controlQubits.begin(), controlQubits.end());
+    }
+    std::erase_if(qubits, [&](const qc::Qubit qubit) { return !isQubitWithinRange(qubit); });
+    if (gateOffsets[position + 1] - gateOffsets[position] > 1U) {
+        std::ranges::sort(qubits);
+        qubits.erase(std::ranges::unique(qubits).begin(), qubits.end());
+    }
+}
@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/io/circuit_writers.hpp"
+
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/diagnostics.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/operations/Control.hpp"
+#include "ir/operations/OpType.hpp"
+#include "ir/operations/Operation.hpp"
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    // formats the written content into a buffer that is only written to the output stream once it is full (or explicitly flushed)
+    class BufferedWriter {
+    public:
+        explicit BufferedWriter(std::ostream& outputStream):
+            outputStream(outputStream), buffer(BUFFER_SIZE) {}
+
+        BufferedWriter(const BufferedWriter&)            = delete;
+        BufferedWriter& operator=(const BufferedWriter&) = delete;
+
+        void append(const char character) {
+            reserve(1U);
+            buffer[numBufferedCharacters++] = character;
+        }
+
+        void append(const std::string_view& characters) {
+            if (characters.size() > BUFFER_SIZE) {
+                flushBuffer();
+                outputStream.write(characters.data(), static_cast<std::streamsize>(characters.size()));
+                hasWriteFailed |= !outputStream;
+                return;
+            }
+            reserve(characters.size());
+            std::memcpy(buffer.data() + numBufferedCharacters, characters.data(), characters.size());
+            numBufferedCharacters += characters.size();
+        }
+
+        void append(const std::uint64_t value) {
+            // the decimal representation of a 64-bit number consists of at most 20 digits
+            reserve(20U);
+            const auto [endOfValue, errorCode] = std::to_chars(buffer.data() + numBufferedCharacters, buffer.data() + buffer.size(), value);
+            numBufferedCharacters              = static_cast<std::size_t>(endOfValue - buffer.data());
+        }
+
+        // returns whether all content written so far (and not only the one of the last flush) was written successfully to the output stream
+        [[nodiscard]] bool flush() {
+            flushBuffer();
+            return !hasWriteFailed;
+        }
+
+    private:
+        constexpr static std::size_t BUFFER_SIZE = static_cast<std::size_t>(1U) << 16U;
+
+        std::ostream&     outputStream;
+        std::vector<char> buffer;
+        std::size_t       numBufferedCharacters = 0U;
+        bool              hasWriteFailed        = false;
+
+        void flushBuffer() {
+            if (numBufferedCharacters != 0U) {
+                outputStream.write(buffer.data(), static_cast<std::streamsize>(numBufferedCharacters));
+                numBufferedCharacters = 0U;
+            }
+            hasWriteFailed |= !outputStream;
+        }
+
+        void reserve(const std::size_t numCharacters) {
+            if (numBufferedCharacters + numCharacters > buffer.size()) {
+                flushBuffer();
+            }
+        }
+    };
+
+    enum class CircuitFormat : std::uint8_t {
+        Real,
+        OpenQasm3
+    };
+
+    [[nodiscard]] std::string_view commentPrefixOf(const CircuitFormat circuitFormat) {
+        return circuitFormat == CircuitFormat::Real ? "# " : "// ";
+    }
+
+    void appendQubit(BufferedWriter& writer, const CircuitFormat circuitFormat, const qc::Qubit qubit) {
+        if (circuitFormat == CircuitFormat::Real) {
+            writer.append('q');
+            writer.append(static_cast<std::uint64_t>(qubit));
+        } else {
+            writer.append(std::string_view("q["));
+            writer.append(static_cast<std::uint64_t>(qubit));
+            writer.append(']');
+        }
+    }
+
+    void appendGateInRealFormat(BufferedWriter& writer, const qc::Operation& gate) {
+        writer.append(gate.getType() == qc::OpType::SWAP ? 'f' : 't');
+        writer.append(static_cast<std::uint64_t>(gate.getNcontrols() + gate.getNtargets()));
+        for (const qc::Control& controlQubit: gate.getControls()) {
+            writer.append(controlQubit.type == qc::Control::Type::Neg ? std::string_view(" -") : std::string_view(" "));
+            appendQubit(writer, CircuitFormat::Real, controlQubit.qubit);
+        }
+        for (const qc::Qubit targetQubit: gate.getTargets()) {
+            writer.append(' ');
+            appendQubit(writer, CircuitFormat::Real, targetQubit);
+        }
+        writer.append('\n');
+    }
+
+    void appendGateInOpenQasm3Format(BufferedWriter& writer, const qc::Operation& gate) {
+        const bool        isSwapGate                  = gate.getType() == qc::OpType::SWAP;
+        const std::size_t numControlQubits            = gate.getNcontrols();
+        bool              areAllControlQubitsPositive = true;
+        for (const qc::Control& controlQubit: gate.getControls()) {
+            areAllControlQubitsPositive &= controlQubit.type == qc::Control::Type::Pos;
+        }
+
+        // gates with at most two (one for SWAP gates) positive control qubits are written as the associated gate of the standard library
+        if (areAllControlQubitsPositive && numControlQubits <= (isSwapGate ? 1U : 2U)) {
+            writer.append(std::string_view(numControlQubits == 2U ? "cc" : (numControlQubits == 1U ? "c" : "")));
+            writer.append(isSwapGate ? std::string_view("swap ") : std::string_view("x "));
+        } else if (areAllControlQubitsPositive) {
+            writer.append(std::string_view("ctrl("));
+            writer.append(static_cast<std::uint64_t>(numControlQubits));
+            writer.append(std::string_view(") @ "));
+            writer.append(isSwapGate ? std::string_view("swap ") : std::string_view("x "));
+        } else {
+            // every ctrl and negctrl modifier consumes the next qubit argument, thus the modifiers are written in the order of the control qubits
+            for (const qc::Control& controlQubit: gate.getControls()) {
+                writer.append(controlQubit.type == qc::Control::Type::Neg ? std::string_view("negctrl @ ") : std::string_view("ctrl @ "));
+            }
+            writer.append(isSwapGate ? std::string_view("swap ") : std::string_view("x "));
+        }
+
+        bool       isFirstQubitArgument = true;
+        const auto appendQubitArgument  = [&](const qc::Qubit qubit) {
+            if (!isFirstQubitArgument) {
+                writer.append(std::string_view(", "));
+            }
+            isFirstQubitArgument = false;
+            appendQubit(writer, CircuitFormat::OpenQasm3, qubit);
+        };
+        for (const qc::Control& controlQubit: gate.getControls()) {
+            appendQubitArgument(controlQubit.qubit);
+        }
+        for (const qc::Qubit targetQubit: gate.getTargets()) {
+            appendQubitArgument(targetQubit);
+        }
+        writer.append(std::string_view(";\n"));
+    }
+
+    void appendHeader(BufferedWriter& writer, const AnnotatableQuantumComputation& annotatableQuantumComputation, const CircuitFormat circuitFormat, const CircuitWriterSettings& settings) {
+        const std::size_t numQubits = annotatableQuantumComputation.getNqubits();
+        if (circuitFormat == CircuitFormat::Real) {
+            writer.append(std::string_view(".version 2.0\n.numvars "));
+            writer.append(static_cast<std::uint64_t>(numQubits));
+            writer.append(std::string_view("\n.variables"));
+            for (qc::Qubit qubit = 0; qubit < numQubits; ++qubit) {
+                writer.append(' ');
+                appendQubit(writer, CircuitFormat::Real, qubit);
+            }
+            writer.append(std::string_view("\n.constants "));
+            for (qc::Qubit qubit = 0; qubit < numQubits; ++qubit) {
+                writer.append(annotatableQuantumComputation.logicalQubitIsAncillary(qubit) ? '0' : '-');
+            }
+            writer.append(std::string_view("\n.garbage "));
+            for (qc::Qubit qubit = 0; qubit < numQubits; ++qubit) {
+                writer.append(annotatableQuantumComputation.logicalQubitIsGarbage(qubit) ? '1' : '-');
+            }
+            writer.append('\n');
+        } else {
+            writer.append(std::string_view("OPENQASM 3.0;\ninclude \"stdgates.inc\";\nqubit["));
+            writer.append(static_cast<std::uint64_t>(numQubits));
+            writer.append(std::string_view("] q;\n"));
+        }
+
+        if (settings.writeQubitLabels) {
+            std::string qubitLabel;
+            for (qc::Qubit qubit = 0; qubit < numQubits; ++qubit) {
+                qubitLabel.clear();
+                if (annotatableQuantumComputation.appendQubitLabel(qubit, AnnotatableQuantumComputation::QubitLabelType::UserDeclared, qubitLabel) || annotatableQuantumComputation.appendQubitLabel(qubit, AnnotatableQuantumComputation::QubitLabelType::Internal, qubitLabel)) {
+                    writer.append(commentPrefixOf(circuitFormat));
+                    appendQubit(writer, circuitFormat, qubit);
+                    writer.append(std::string_view(": "));
+                    writer.append(qubitLabel);
+                    writer.append('\n');
+                }
+            }
+        }
+
+        if (circuitFormat == CircuitFormat::Real) {
+            writer.append(std::string_view(".begin\n"));
+        }
+    }
+
+    [[nodiscard]] bool writeCircuit(const AnnotatableQuantumComputation& annotatableQuantumComputation, std::ostream& outputStream, const CircuitFormat circuitFormat, const CircuitWriterSettings& settings) {
+        if (annotatableQuantumComputation.getNumForwardedQuantumOperations() != 0U) {
+            getErrorStream() << "Cannot write a quantum computation whose quantum operations were already forwarded to a quantum operation sink\n";
+            return false;
+        }
+
+        BufferedWriter writer(outputStream);
+        appendHeader(writer, annotatableQuantumComputation, circuitFormat, settings);
+
+        // the comment of the annotations is only written if the annotations differ from the ones of the previous quantum operation
+        std::optional<AnnotatableQuantumComputation::QuantumOperationAnnotationsLookup> annotationsOfPreviousQuantumOperation;
+        std::optional<unsigned>                                                         statementLineNumberOfPreviousQuantumOperation;
+        for (std::size_t position = 0; position < annotatableQuantumComputation.getNops(); ++position) {
+            const qc::Operation* quantumOperation = annotatableQuantumComputation.at(position).get();
+            if (quantumOperation == nullptr) {
+                getErrorStream() << "Quantum operation " << std::to_string(position) << " of the quantum computation was NULL\n";
+                return false;
+            }
+
+            if (settings.writeQuantumOperationAnnotations) {
+                if (AnnotatableQuantumComputation::QuantumOperationAnnotationsLookup annotations = annotatableQuantumComputation.getAnnotationsOfQuantumOperation(position); !annotations.empty() && annotations != annotationsOfPreviousQuantumOperation) {
+                    writer.append(commentPrefixOf(circuitFormat));
+                    bool isFirstAnnotation = true;
+                    for (const auto& [key, value]: annotations) {
+                        writer.append(isFirstAnnotation ? std::string_view("") : std::string_view(", "));
+                        writer.append(key);
+                        writer.append('=');
+                        writer.append(value);
+                        isFirstAnnotation = false;
+                    }
+                    writer.append('\n');
+                    annotationsOfPreviousQuantumOperation = std::move(annotations);
+                }
+            } else if (settings.writeStatementLineNumbers) {
+                if (const std::optional<unsigned> statementLineNumber = annotatableQuantumComputation.getStatementLineNumberOfQuantumOperation(position); statementLineNumber.has_value() && statementLineNumber != statementLineNumberOfPreviousQuantumOperation) {
+                    writer.append(commentPrefixOf(circuitFormat));
+                    writer.append(AnnotatableQuantumComputation::QUANTUM_OPERATION_ANNOTATION_KEY_ASSOCIATED_STATEMENT_LINE_NUMBER);
+                    writer.append(' ');
+                    writer.append(static_cast<std::uint64_t>(*statementLineNumber));
+                    writer.append('\n');
+                    statementLineNumberOfPreviousQuantumOperation = statementLineNumber;
+                }
+            }
+
+            const bool wereAllGatesWritten = AnnotatableQuantumComputation::forEachGateOfQuantumOperation(*quantumOperation, [&](const qc::Operation& gate) {
+                if (gate.getType() != qc::OpType::X && gate.getType() != qc::OpType::SWAP) {
+                    getErrorStream() << "Quantum operation of type " << std::to_string(gate.getType()) << " cannot be written\n";
+                    return false;
+                }
+                if (circuitFormat == CircuitFormat::Real) {
+                    appendGateInRealFormat(writer, gate);
+                } else {
+                    appendGateInOpenQasm3Format(writer, gate);
+                }
+                return true;
+            });
+            if (!wereAllGatesWritten) {
+                return false;
+            }
+        }
+
+        if (circuitFormat == CircuitFormat::Real) {
+            writer.append(std::string_view(".end\n"));
+        }
+        if (!writer.flush()) {
+            getErrorStream() << "Failed to write the quantum computation to the output stream\n";
+            return false;
+        }
+        return true;
+    }
+
+    [[nodiscard]] bool writeCircuitToFile(const AnnotatableQuantumComputation& annotatableQuantumComputation, const std::string& filename, const CircuitFormat circuitFormat, const CircuitWriterSettings& settings) {
+        std::ofstream outputStream(filename, std::ofstream::out | std::ofstream::binary | std::ofstream::trunc);
+        if (!outputStream.good()) {
+            getErrorStream() << "Cannot open " << filename << "\n";
+            return false;
+        }
+        return writeCircuit(annotatableQuantumComputation, outputStream, circuitFormat, settings);
+    }
+} // namespace
+
+bool syrec::writeRealFormat(const AnnotatableQuantumComputation& annotatableQuantumComputation, std::ostream& outputStream, const CircuitWriterSettings& settings) {
+    return writeCircuit(annotatableQuantumComputation, outputStream, CircuitFormat::Real, settings);
+}
+
+bool syrec::writeOpenQasm3(const AnnotatableQuantumComputation& annotatableQuantumComputation, std::ostream& outputStream, const CircuitWriterSettings& settings) {
+    return writeCircuit(annotatableQuantumComputation, outputStream, CircuitFormat::OpenQasm3, settings);
+}
+
+bool syrec::writeRealFormatToFile(const AnnotatableQuantumComputation& annotatableQuantumComputation, const std::string& filename, const CircuitWriterSettings& settings) {
+    return writeCircuitToFile(annotatableQuantumComputation, filename, CircuitFormat::Real, settings);
+}
+
+bool syrec::writeOpenQasm3ToFile(const AnnotatableQuantumComputation& annotatableQuantumComputation, const std::string& filename, const CircuitWriterSettings& settings) {
+    return writeCircuitToFile(annotatableQuantumComputation, filename, CircuitFormat::OpenQasm3, settings);
+}
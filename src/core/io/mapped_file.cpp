@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/io/mapped_file.hpp"
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#if _WIN32
+#include <fstream>
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace syrec;
+
+#if _WIN32
+// memory-mapping is not supported on this platform, thus the content of the file is read into a buffer instead
+MappedFile::MappedFile(const std::string& filename, [[maybe_unused]] const AccessPattern accessPattern) {
+    if (std::ifstream is(filename, std::ifstream::in | std::ifstream::binary); is.good()) {
+        buffer.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+        opened = !is.bad();
+    }
+}
+
+MappedFile::~MappedFile() = default;
+
+std::string_view MappedFile::getContent() const {
+    return buffer;
+}
+#else
+MappedFile::MappedFile(const std::string& filename, const AccessPattern accessPattern):
+    fileDescriptor(open(filename.c_str(), O_RDONLY)) {
+    struct stat fileStatus{};
+    if (fileDescriptor == -1 || fstat(fileDescriptor, &fileStatus) == -1 || !S_ISREG(fileStatus.st_mode)) {
+        return;
+    }
+    mappedSize = static_cast<std::size_t>(fileStatus.st_size);
+    // an empty file cannot be mapped
+    if (mappedSize == 0U) {
+        opened = true;
+        return;
+    }
+    mappedContent = mmap(nullptr, mappedSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    if (mappedContent == MAP_FAILED) {
+        mappedContent = nullptr;
+        return;
+    }
+    madvise(mappedContent, mappedSize, accessPattern == AccessPattern::Sequential ? MADV_SEQUENTIAL : MADV_RANDOM);
+    opened = true;
+}
+
+MappedFile::~MappedFile() {
+    if (mappedContent != nullptr) {
+        munmap(mappedContent, mappedSize);
+    }
+    if (fileDescriptor != -1) {
+        close(fileDescriptor);
+    }
+}
+
+std::string_view MappedFile::getContent() const {
+    return mappedContent != nullptr ? std::string_view(static_cast<const char*>(mappedContent), mappedSize) : std::string_view();
+}
+#endif
@@ -10,93 +10,422 @@
 
 #include "core/io/pla_parser.hpp"
 
+#include "core/executor.hpp"
+#include "core/io/mapped_file.hpp"
 #include "core/truthTable/truth_table.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <bit>
 #include <cassert>
+#include <charconv>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
+#include <exception>
 #include <iostream>
 #include <istream>
-#include <regex>
-#include <sstream>
+#include <iterator>
+#include <mutex>
+#include <queue>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
 #include <vector>
 
+namespace {
+    using Word = syrec::TruthTable::Cube::Word;
+
+    // the progress callback is invoked after every chunk of the given number of bytes was processed
+    constexpr std::size_t PROGRESS_REPORT_INTERVAL_IN_BYTES = static_cast<std::size_t>(1U) << 20U;
+    // the minimum number of bytes of the body of a PLA parsed by a single task of the parallel parser
+    constexpr std::size_t MIN_NUM_BYTES_PER_CHUNK = static_cast<std::size_t>(1U) << 16U;
+    // the body of a PLA is split into more chunks than threads to balance the load between the threads if the density of the cubes varies throughout the body
+    constexpr std::size_t NUM_CHUNKS_PER_THREAD = 4U;
+
+    [[nodiscard]] bool isPlaWhitespace(const char c) {
+        return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+    }
+
+    // returns the next whitespace separated token of the line and removes it (as well as any leading whitespace) from the line
+    std::string_view nextToken(std::string_view& line) {
+        std::size_t tokenStart = 0U;
+        while (tokenStart < line.size() && isPlaWhitespace(line[tokenStart])) {
+            ++tokenStart;
+        }
+        std::size_t tokenEnd = tokenStart;
+        while (tokenEnd < line.size() && !isPlaWhitespace(line[tokenEnd])) {
+            ++tokenEnd;
+        }
+        const auto token = line.substr(tokenStart, tokenEnd - tokenStart);
+        line.remove_prefix(tokenEnd);
+        return token;
+    }
+
+    std::size_t parseDeclaredNumberOfLines(std::string_view line) {
+        nextToken(line);
+        const auto  declaredNumberOfLines = nextToken(line);
+        std::size_t numberOfLines         = 0U;
+        if (const auto [ptr, errorCode] = std::from_chars(declaredNumberOfLines.data(), declaredNumberOfLines.data() + declaredNumberOfLines.size(), numberOfLines); errorCode != std::errc() || declaredNumberOfLines.empty()) {
+            throw std::invalid_argument("Invalid number of lines " + std::string("(") + std::string(declaredNumberOfLines) + std::string(")"));
+        }
+        return numberOfLines;
+    }
+
+    void setCubeValues(syrec::TruthTable::Cube& cube, const std::string_view values) {
+        for (std::size_t i = 0U; i < values.size(); ++i) {
+            cube.set(i, syrec::TruthTable::Cube::getValue(values[i]));
+        }
+    }
+
+    enum class PlaLineKind : std::uint8_t {
+        Ignored,
+        NumberOfInputs,
+        NumberOfOutputs,
+        End,
+        Cube
+    };
+
+    // removes the leading and trailing whitespace of the line and determines its kind
+    PlaLineKind classifyLine(std::string_view& line) {
+        while (!line.empty() && isPlaWhitespace(line.front())) {
+            line.remove_prefix(1U);
+        }
+        while (!line.empty() && isPlaWhitespace(line.back())) {
+            line.remove_suffix(1U);
+        }
+        if ((line.empty()) || (line.starts_with('#')) || (line.starts_with(".ilb")) || (line.starts_with(".ob")) || (line.starts_with(".p")) || (line.starts_with(".type "))) {
+            return PlaLineKind::Ignored;
+        }
+        if (line.starts_with(".i")) {
+            return PlaLineKind::NumberOfInputs;
+        }
+        if (line.starts_with(".o")) {
+            return PlaLineKind::NumberOfOutputs;
+        }
+        if (line == ".e") {
+            return PlaLineKind::End;
+        }
+        return PlaLineKind::Cube;
+    }
+
+    // returns the input and output columns of a (trimmed) cube line after validating them against the declared number of inputs and outputs
+    std::pair<std::string_view, std::string_view> splitCubeLine(std::string_view line, const std::size_t nInputs, const std::size_t nOutputs) {
+        assert((line[0] == '0' || line[0] == '1' || line[0] == '-' || line[0] == '~'));
+
+        const auto  inputMapping  = nextToken(line);
+        const auto  outputMapping = nextToken(line);
+        std::size_t numColumns    = (inputMapping.empty() ? 0U : 1U) + (outputMapping.empty() ? 0U : 1U);
+        while (!nextToken(line).empty()) {
+            ++numColumns;
+        }
+
+        if (numColumns != 2) {
+            throw std::invalid_argument("Expected exactly 2 columns (input and output), received " + std::to_string(numColumns) + std::string(" columns"));
+        }
+
+        if (inputMapping.size() != nInputs) {
+            throw std::invalid_argument(".i " + std::string("(") + std::to_string(nInputs) + std::string(")") + std::string(" not equal to received number of inputs ") + std::string("(") + std::to_string(inputMapping.size()) + std::string(")"));
+        }
+
+        if (outputMapping.size() != nOutputs) {
+            throw std::invalid_argument(".o " + std::string("(") + std::to_string(nOutputs) + std::string(")") + std::string(" not equal to received number of outputs ") + std::string("(") + std::to_string(outputMapping.size()) + std::string(")"));
+        }
+        return {inputMapping, outputMapping};
+    }
+
+    // writes the values of a column into the packed representation of a cube consisting of numWords value words followed by numWords don't care words (which are expected to be zero)
+    void packCubeValues(Word* words, const std::size_t numWords, const std::string_view values) {
+        constexpr auto BITS_PER_WORD = syrec::TruthTable::Cube::BITS_PER_WORD;
+        for (std::size_t i = 0U; i < values.size(); ++i) {
+            const auto value   = syrec::TruthTable::Cube::getValue(values[i]);
+            const auto bitMask = static_cast<Word>(1U) << (i % BITS_PER_WORD);
+            if (!value.has_value()) {
+                words[numWords + (i / BITS_PER_WORD)] |= bitMask;
+            } else if (*value) {
+                words[i / BITS_PER_WORD] |= bitMask;
+            }
+        }
+    }
+
+    // compares two packed cubes of the same size like syrec::TruthTable::Cube::compare(...), i.e. lexicographically using the ordering of std::optional<bool> per position
+    int comparePackedCubes(const Word* lhs, const Word* rhs, const std::size_t numWords) {
+        for (std::size_t k = 0U; k < numWords; ++k) {
+            if (const Word differingPositions = (lhs[k] ^ rhs[k]) | (lhs[numWords + k] ^ rhs[numWords + k]); differingPositions != 0U) {
+                // map the first differing position to its rank in the ordering of std::optional<bool> (don't care: 0, false: 1, true: 2)
+                const Word bitMask = static_cast<Word>(1U) << static_cast<unsigned>(std::countr_zero(differingPositions));
+                const auto rankOf  = [&](const Word* words) { return (words[numWords + k] & bitMask) != 0U ? 0 : ((words[k] & bitMask) != 0U ? 2 : 1); };
+                return rankOf(lhs) - rankOf(rhs);
+            }
+        }
+        return 0;
+    }
+
+    // the cubes of a contiguous chunk of the body of a PLA, with every cube line being stored as a record consisting of the value and don't care words of its input followed by those of its output
+    struct ParsedChunk {
+        std::vector<Word> records;
+        // the indices of the records sorted by their inputs, with records with the same input being ordered by their index (i.e. the order of their lines)
+        std::vector<std::size_t> sortedRecordIndices;
+        // whether the chunk contains the end of the PLA (.e), the lines following it were not parsed
+        bool isEndOfPlaReached = false;
+        // whether the chunk contains a declaration of the number of inputs or outputs, the lines following it were not parsed
+        bool containsDeclaration = false;
+        // the exception thrown for the first invalid line of the chunk, the lines following it were not parsed
+        std::exception_ptr exception;
+    };
+
+    // the progress of the parallel parser shared by all threads, the callback is only invoked by one thread at a time
+    struct ParallelParsingProgress {
+        ParallelParsingProgress(const syrec::PlaParsingProgressCallback& callback, const std::size_t totalBytes, const std::size_t initiallyProcessedBytes):
+            callback(callback), totalBytes(totalBytes), processedBytes(initiallyProcessedBytes) {}
+
+        const syrec::PlaParsingProgressCallback& callback;
+        std::size_t                              totalBytes;
+        std::atomic<std::size_t>                 processedBytes;
+        std::atomic<bool>                        isCancelled    = false;
+        std::mutex                               callbackMutex;
+
+        bool reportProcessedBytes(const std::size_t numBytes) {
+            const auto processedBytesSoFar = processedBytes.fetch_add(numBytes, std::memory_order_relaxed) + numBytes;
+            if (callback) {
+                const std::scoped_lock lock(callbackMutex);
+                if (!isCancelled.load(std::memory_order_relaxed) && !callback(std::min(processedBytesSoFar, totalBytes), totalBytes)) {
+                    isCancelled = true;
+                }
+            }
+            return !isCancelled.load(std::memory_order_relaxed);
+        }
+    };
+
+    void parseChunk(ParsedChunk& chunk, const std::string_view content, const std::size_t nInputs, const std::size_t nOutputs, ParallelParsingProgress& progress) {
+        const std::size_t numInputWords  = (nInputs + syrec::TruthTable::Cube::BITS_PER_WORD - 1U) / syrec::TruthTable::Cube::BITS_PER_WORD;
+        const std::size_t numOutputWords = (nOutputs + syrec::TruthTable::Cube::BITS_PER_WORD - 1U) / syrec::TruthTable::Cube::BITS_PER_WORD;
+        const std::size_t recordSize     = 2U * (numInputWords + numOutputWords);
+
+        std::size_t lastProgressReport = 0U;
+        std::size_t lineStart          = 0U;
+        try {
+            while (lineStart < content.size()) {
+                const auto lineEnd = std::min(content.find('\n', lineStart), content.size());
+                auto       line    = content.substr(lineStart, lineEnd - lineStart);
+                lineStart          = lineEnd + 1U;
+
+                if (lineStart - lastProgressReport >= PROGRESS_REPORT_INTERVAL_IN_BYTES) {
+                    if (!progress.reportProcessedBytes(lineStart - lastProgressReport)) {
+                        return;
+                    }
+                    lastProgressReport = lineStart;
+                }
+
+                const auto lineKind = classifyLine(line);
+                if (lineKind == PlaLineKind::End) {
+                    chunk.isEndOfPlaReached = true;
+                    break;
+                }
+                if (lineKind == PlaLineKind::NumberOfInputs || lineKind == PlaLineKind::NumberOfOutputs) {
+                    chunk.containsDeclaration = true;
+                    break;
+                }
+                if (lineKind == PlaLineKind::Cube) {
+                    const auto [inputMapping, outputMapping] = splitCubeLine(line, nInputs, nOutputs);
+                    const std::size_t recordOffset           = chunk.records.size();
+                    chunk.records.resize(recordOffset + recordSize, 0U);
+                    packCubeValues(chunk.records.data() + recordOffset, numInputWords, inputMapping);
+                    packCubeValues(chunk.records.data() + recordOffset + (2U * numInputWords), numOutputWords, outputMapping);
+                    chunk.sortedRecordIndices.emplace_back(chunk.sortedRecordIndices.size());
+                }
+            }
+        } catch (...) {
+            chunk.exception = std::current_exception();
+            return;
+        }
+        progress.reportProcessedBytes(std::min(lineStart, content.size()) - lastProgressReport);
+
+        const auto inputOfRecord = [&](const std::size_t recordIndex) { return chunk.records.data() + (recordIndex * recordSize); };
+        std::stable_sort(chunk.sortedRecordIndices.begin(), chunk.sortedRecordIndices.end(), [&](const std::size_t lhs, const std::size_t rhs) {
+            return comparePackedCubes(inputOfRecord(lhs), inputOfRecord(rhs), numInputWords) < 0;
+        });
+    }
+
+} // namespace
+
 namespace syrec {
 
     void parsePla(TruthTable& tt, std::istream& in) {
-        std::string      line;
-        std::size_t      nInputs  = 0;
-        std::size_t      nOutputs = 0;
-        std::regex const whitespace("\\s+");
-
-        while (in.good() && getline(in, line)) {
-            trim(line);
-            line = std::regex_replace(line, whitespace, " ");
-            if ((line.empty()) || (line.starts_with('#')) || (line.starts_with(".ilb")) || (line.starts_with(".ob")) || (line.starts_with(".p")) || (line.starts_with(".type "))) {
+        const std::string content{std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+        parsePla(tt, content);
+    }
+
+    bool parsePla(TruthTable& tt, const std::string_view content, const PlaParsingProgressCallback& progressCallback) {
+        std::size_t nInputs  = 0;
+        std::size_t nOutputs = 0;
+
+        // the cubes of the current line are written directly into these cubes whose storage is reused for all lines
+        TruthTable::Cube cubeIn;
+        TruthTable::Cube cubeOut;
+
+        std::size_t nextProgressReport = PROGRESS_REPORT_INTERVAL_IN_BYTES;
+        std::size_t lineStart          = 0U;
+        while (lineStart < content.size()) {
+            const auto lineEnd = std::min(content.find('\n', lineStart), content.size());
+            auto       line    = content.substr(lineStart, lineEnd - lineStart);
+            lineStart          = lineEnd + 1U;
+
+            if (progressCallback && lineStart >= nextProgressReport) {
+                if (!progressCallback(std::min(lineStart, content.size()), content.size())) {
+                    return false;
+                }
+                nextProgressReport = lineStart + PROGRESS_REPORT_INTERVAL_IN_BYTES;
+            }
+
+            const auto lineKind = classifyLine(line);
+            if (lineKind == PlaLineKind::Ignored) {
                 continue;
             }
 
-            if (line.starts_with(".i")) {
-                nInputs = static_cast<std::size_t>(std::stoi(line.substr(3)));
+            if (lineKind == PlaLineKind::NumberOfInputs) {
+                nInputs = parseDeclaredNumberOfLines(line);
                 // resize the tt constants.
                 tt.getConstants().resize(nInputs);
+                cubeIn.resize(nInputs);
             }
 
-            else if (line.starts_with(".o")) {
-                nOutputs = static_cast<std::size_t>(std::stoi(line.substr(3)));
+            else if (lineKind == PlaLineKind::NumberOfOutputs) {
+                nOutputs = parseDeclaredNumberOfLines(line);
                 // resize the tt garbage.
                 tt.getGarbage().resize(nOutputs);
+                cubeOut.resize(nOutputs);
             }
 
-            else if (line == ".e") {
+            else if (lineKind == PlaLineKind::End) {
                 break;
             }
 
             else {
-                assert((line[0] == '0' || line[0] == '1' || line[0] == '-' || line[0] == '~'));
-
-                std::vector<std::string> inputOutputMapping;
+                const auto [inputMapping, outputMapping] = splitCubeLine(line, nInputs, nOutputs);
+                setCubeValues(cubeIn, inputMapping);
+                setCubeValues(cubeOut, outputMapping);
+                tt.try_emplace(cubeIn, cubeOut);
+            }
+        }
 
-                auto        lineString = std::stringstream(line);
-                std::string tokenString;
-                while (std::getline(lineString, tokenString, ' ')) {
-                    inputOutputMapping.emplace_back(tokenString);
-                }
+        if (progressCallback) {
+            return progressCallback(content.size(), content.size());
+        }
+        return true;
+    }
 
-                if (inputOutputMapping.size() != 2) {
-                    throw std::invalid_argument("Expected exactly 2 columns (input and output), received " + std::to_string(inputOutputMapping.size()) + std::string(" columns"));
-                }
+    bool parsePlaInParallel(TruthTable& tt, const std::string_view content, const std::size_t numThreads, const PlaParsingProgressCallback& progressCallback) {
+        if (Executor::determineNumThreads(numThreads) == 1U || content.size() < 2U * MIN_NUM_BYTES_PER_CHUNK) {
+            return parsePla(tt, content, progressCallback);
+        }
 
-                if (inputOutputMapping[0].size() != nInputs) {
-                    throw std::invalid_argument(".i " + std::string("(") + std::to_string(nInputs) + std::string(")") + std::string(" not equal to received number of inputs ") + std::string("(") + std::to_string(inputOutputMapping[0].size()) + std::string(")"));
-                }
+        // the declarations preceding the first cube line are parsed sequentially
+        std::size_t nInputs   = 0;
+        std::size_t nOutputs  = 0;
+        std::size_t bodyStart = content.size();
+        std::size_t lineStart = 0U;
+        while (lineStart < content.size()) {
+            const auto lineEnd  = std::min(content.find('\n', lineStart), content.size());
+            auto       line     = content.substr(lineStart, lineEnd - lineStart);
+            const auto lineKind = classifyLine(line);
+            if (lineKind == PlaLineKind::Cube) {
+                bodyStart = lineStart;
+                break;
+            }
+            lineStart = lineEnd + 1U;
+            if (lineKind == PlaLineKind::NumberOfInputs) {
+                nInputs = parseDeclaredNumberOfLines(line);
+                tt.getConstants().resize(nInputs);
+            } else if (lineKind == PlaLineKind::NumberOfOutputs) {
+                nOutputs = parseDeclaredNumberOfLines(line);
+                tt.getGarbage().resize(nOutputs);
+            } else if (lineKind == PlaLineKind::End) {
+                break;
+            }
+        }
 
-                if (inputOutputMapping[1].size() != nOutputs) {
-                    throw std::invalid_argument(".o " + std::string("(") + std::to_string(nOutputs) + std::string(")") + std::string(" not equal to received number of outputs ") + std::string("(") + std::to_string(inputOutputMapping[1].size()) + std::string(")"));
+        // the body is split at line boundaries into chunks of roughly the same size
+        const std::size_t             bodySize  = content.size() - bodyStart;
+        const std::size_t             numChunks = std::clamp<std::size_t>(bodySize / MIN_NUM_BYTES_PER_CHUNK, 1U, Executor::determineNumThreads(numThreads) * NUM_CHUNKS_PER_THREAD);
+        std::vector<std::string_view> contentPerChunk;
+        contentPerChunk.reserve(numChunks);
+        std::size_t chunkStart = bodyStart;
+        for (std::size_t i = 1U; i <= numChunks && chunkStart < content.size(); ++i) {
+            std::size_t chunkEnd = content.size();
+            if (i < numChunks) {
+                if (const auto newline = content.find('\n', std::max(chunkStart, bodyStart + ((i * bodySize) / numChunks))); newline != std::string_view::npos) {
+                    chunkEnd = newline + 1U;
                 }
+            }
+            contentPerChunk.emplace_back(content.substr(chunkStart, chunkEnd - chunkStart));
+            chunkStart = chunkEnd;
+        }
 
-                TruthTable::Cube cubeIn;
-                cubeIn.reserve(nInputs);
-
-                for (auto s: inputOutputMapping[0]) {
-                    cubeIn.emplace_back(TruthTable::Cube::getValue(s));
-                }
+        ParallelParsingProgress  progress(progressCallback, content.size(), bodyStart);
+        std::vector<ParsedChunk> chunks(contentPerChunk.size());
+        Executor::getShared().parallelFor(chunks.size(), [&](const std::size_t chunk) {
+            parseChunk(chunks[chunk], contentPerChunk[chunk], nInputs, nOutputs, progress);
+        }, numThreads);
+        if (progress.isCancelled) {
+            return false;
+        }
 
-                TruthTable::Cube cubeOut;
-                cubeOut.reserve(nOutputs);
+        // the chunks following the end of the PLA are ignored while the first invalid line in the order of the lines is reported like in the sequential parser
+        std::size_t numMergedChunks = 0U;
+        while (numMergedChunks < chunks.size()) {
+            const auto& chunk = chunks[numMergedChunks++];
+            if (chunk.exception != nullptr) {
+                std::rethrow_exception(chunk.exception);
+            }
+            if (chunk.containsDeclaration) {
+                // redeclaring the number of inputs or outputs in the body changes the interpretation of the following lines, which is only supported by the sequential parser
+                return parsePla(tt, content, progressCallback);
+            }
+            if (chunk.isEndOfPlaReached) {
+                break;
+            }
+        }
 
-                for (auto s: inputOutputMapping[1]) {
-                    cubeOut.emplace_back(TruthTable::Cube::getValue(s));
-                }
+        // the sorted records of all chunks are merged in ascending order of their inputs, with the record of the earliest line being kept for equal inputs (like try_emplace(...) in the sequential parser)
+        const std::size_t numInputWords  = (nInputs + TruthTable::Cube::BITS_PER_WORD - 1U) / TruthTable::Cube::BITS_PER_WORD;
+        const std::size_t numOutputWords = (nOutputs + TruthTable::Cube::BITS_PER_WORD - 1U) / TruthTable::Cube::BITS_PER_WORD;
+        const std::size_t recordSize     = 2U * (numInputWords + numOutputWords);
+        using MergeCursor                = std::pair<std::size_t, std::size_t>;
+        const auto recordOf              = [&](const MergeCursor& cursor) {
+            return chunks[cursor.first].records.data() + (chunks[cursor.first].sortedRecordIndices[cursor.second] * recordSize);
+        };
+        const auto isMergedLater = [&](const MergeCursor& lhs, const MergeCursor& rhs) {
+            const auto comparisonResult = comparePackedCubes(recordOf(lhs), recordOf(rhs), numInputWords);
+            return comparisonResult != 0 ? comparisonResult > 0 : lhs.first > rhs.first;
+        };
+        std::priority_queue<MergeCursor, std::vector<MergeCursor>, decltype(isMergedLater)> cursors(isMergedLater);
+        for (std::size_t chunk = 0U; chunk < numMergedChunks; ++chunk) {
+            if (!chunks[chunk].sortedRecordIndices.empty()) {
+                cursors.emplace(chunk, 0U);
+            }
+        }
 
-                tt.try_emplace(cubeIn, cubeOut);
+        const Word* inputOfPreviousRecord = nullptr;
+        while (!cursors.empty()) {
+            const auto cursor = cursors.top();
+            cursors.pop();
+            if (const Word* record = recordOf(cursor); inputOfPreviousRecord == nullptr || comparePackedCubes(inputOfPreviousRecord, record, numInputWords) != 0) {
+                const Word* output = record + (2U * numInputWords);
+                tt.try_emplace_back(TruthTable::Cube::fromWords(nInputs, record, record + numInputWords), TruthTable::Cube::fromWords(nOutputs, output, output + numOutputWords));
+                inputOfPreviousRecord = record;
             }
+            if (cursor.second + 1U < chunks[cursor.first].sortedRecordIndices.size()) {
+                cursors.emplace(cursor.first, cursor.second + 1U);
+            }
+        }
+
+        if (progressCallback) {
+            return progressCallback(content.size(), content.size());
         }
+        return true;
     }
 
     auto extend(TruthTable& tt) -> void {
@@ -108,10 +437,8 @@ namespace syrec {
         TruthTable newTT{};
 
         for (auto const& [input, output]: tt) {
-            // compute the complete cubes for the input
-            auto completeInputs = input.completeCubes();
-            // move all the complete cubes to the new cube map
-            for (auto const& completeInput: completeInputs) {
+            // move all the complete cubes of the input to the new cube map (without materializing all of them at once)
+            for (auto const& completeInput: input.completions()) {
                 const auto inputIt = newTT.find(input);
 
                 if (inputIt != newTT.end()) {
@@ -153,18 +480,22 @@ namespace syrec {
         for (std::uint64_t i = pos; i < max; ++i) {
             tt[TruthTable::Cube::fromInteger(i, tt.nInputs())] = output;
         }
+        tt.useDenseStorageIfComplete();
     }
 
-    bool readPla(TruthTable& tt, const std::string& filename) {
-        std::ifstream is;
-        is.open(filename.c_str(), std::ifstream::in);
+    bool readPla(TruthTable& tt, const std::string& filename, const PlaParsingProgressCallback& progressCallback, const std::size_t numThreads) {
+        const MappedFile plaFile(filename);
 
-        if (!is.good()) {
+        if (!plaFile.isOpen()) {
             std::cerr << "Cannot open " + filename << '\n';
             return false;
         }
 
-        parsePla(tt, is);
+        if (!parsePlaInParallel(tt, plaFile.getContent(), numThreads, progressCallback)) {
+            // the parsing was cancelled
+            tt.clear();
+            return false;
+        }
 
         // extending the truth table.
         extend(tt);
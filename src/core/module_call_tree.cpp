@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/module_call_tree.hpp"
+
+#include "core/syrec/module.hpp"
+
+#include <cstddef>
+#include <optional>
+
+using namespace syrec;
+
+std::optional<ModuleCallTree::NodeId> ModuleCallTree::addNode(const std::optional<NodeId>& parentNodeId, const Module::ptr& targetModule, const std::optional<unsigned int>& lineNumberOfCallOfTargetModule, const std::optional<bool>& isTargetModuleAccessedViaCallStmt) {
+    const Node* parentNode = parentNodeId.has_value() ? getNode(*parentNodeId) : nullptr;
+    if (targetModule == nullptr || (parentNodeId.has_value() && parentNode == nullptr)) {
+        return std::nullopt;
+    }
+
+    const std::size_t depth = parentNode != nullptr ? parentNode->depth + 1U : 1U;
+    nodes.emplace_back(Node{.parentNodeId = parentNodeId, .lineNumberOfCallOfTargetModule = lineNumberOfCallOfTargetModule, .isTargetModuleAccessedViaCallStmt = isTargetModuleAccessedViaCallStmt, .targetModule = targetModule, .depth = depth});
+    return nodes.size() - 1U;
+}
+
+const ModuleCallTree::Node* ModuleCallTree::getNode(const NodeId nodeId) const {
+    return nodeId < nodes.size() ? &nodes[nodeId] : nullptr;
+}
+
+std::size_t ModuleCallTree::getNumNodes() const {
+    return nodes.size();
+}
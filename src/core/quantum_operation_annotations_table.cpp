@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/quantum_operation_annotations_table.hpp"
+
+#include "core/memory_accounting.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    constexpr std::size_t ID_OF_EMPTY_ANNOTATIONS = 0U;
+} // namespace
+
+QuantumOperationAnnotationsTable::QuantumOperationAnnotationsTable() {
+    [[maybe_unused]] const std::size_t idOfEmptyAnnotations = internAnnotations({});
+}
+
+void QuantumOperationAnnotationsTable::resize(const std::size_t numQuantumOperations) {
+    if (numQuantumOperations > this->numQuantumOperations) {
+        const AnnotationsRange rangeOfNewlyCoveredPositions{.firstPosition = this->numQuantumOperations, .annotationsId = ID_OF_EMPTY_ANNOTATIONS, .statementLineNumber = std::nullopt};
+        if (annotationsRanges.empty() || !annotationsRanges.back().hasSameAnnotationsAs(rangeOfNewlyCoveredPositions)) {
+            annotationsRanges.emplace_back(rangeOfNewlyCoveredPositions);
+        }
+    } else {
+        const auto firstRemovedRange = std::ranges::lower_bound(annotationsRanges, numQuantumOperations, std::less{}, &AnnotationsRange::firstPosition);
+        annotationsRanges.erase(firstRemovedRange, annotationsRanges.end());
+    }
+    this->numQuantumOperations = numQuantumOperations;
+}
+
+const QuantumOperationAnnotationsTable::QuantumOperationAnnotationsLookup& QuantumOperationAnnotationsTable::getAnnotationsOfQuantumOperation(const std::size_t position) const {
+    return getAnnotationsWithId(getAnnotationsIdOfQuantumOperation(position));
+}
+
+std::size_t QuantumOperationAnnotationsTable::getAnnotationsIdOfQuantumOperation(const std::size_t position) const {
+    if (position >= numQuantumOperations) {
+        return ID_OF_EMPTY_ANNOTATIONS;
+    }
+    return annotationsRanges[determineIndexOfRangeContainingPosition(position)].annotationsId;
+}
+
+const QuantumOperationAnnotationsTable::QuantumOperationAnnotationsLookup& QuantumOperationAnnotationsTable::getAnnotationsWithId(const std::size_t annotationsId) const {
+    return *annotationsPerId[annotationsId < annotationsPerId.size() ? annotationsId : ID_OF_EMPTY_ANNOTATIONS];
+}
+
+std::optional<unsigned> QuantumOperationAnnotationsTable::getStatementLineNumberOfQuantumOperation(const std::size_t position) const {
+    if (position >= numQuantumOperations) {
+        return std::nullopt;
+    }
+    return annotationsRanges[determineIndexOfRangeContainingPosition(position)].statementLineNumber;
+}
+
+bool QuantumOperationAnnotationsTable::setOrUpdateAnnotationOfQuantumOperation(const std::size_t position, const std::string_view& annotationKey, const std::string& annotationValue) {
+    if (position >= numQuantumOperations) {
+        return false;
+    }
+
+    QuantumOperationAnnotationsLookup annotations = getAnnotationsOfQuantumOperation(position);
+    annotations.insert_or_assign(std::string(annotationKey), annotationValue);
+    assignAnnotationsToPositions(position, position + 1U, internAnnotations(std::move(annotations)), getStatementLineNumberOfQuantumOperation(position));
+    return true;
+}
+
+bool QuantumOperationAnnotationsTable::setOrUpdateAnnotationsOfQuantumOperations(const std::size_t firstPosition, const std::size_t lastPosition, const QuantumOperationAnnotationsLookup& firstAnnotationsToApply, const QuantumOperationAnnotationsLookup& secondAnnotationsToApply, const std::optional<unsigned>& statementLineNumberToApply) {
+    if (firstPosition > lastPosition || lastPosition >= numQuantumOperations) {
+        return false;
+    }
+
+    const bool areAnnotationsModified = !firstAnnotationsToApply.empty() || !secondAnnotationsToApply.empty();
+    if (!areAnnotationsModified && !statementLineNumberToApply.has_value()) {
+        return true;
+    }
+
+    // The annotations are only determined once for each range of quantum operations with identical annotations overlapping the annotated positions. If only the statement line number is applied, the existing set of annotations of
+    // each range is reused without creating a new set of annotations.
+    std::size_t position = firstPosition;
+    while (position <= lastPosition) {
+        const std::size_t             indexOfRange        = determineIndexOfRangeContainingPosition(position);
+        const std::size_t             endPosition         = std::min(determineEndOfRange(indexOfRange), lastPosition + 1U);
+        const std::optional<unsigned> statementLineNumber = statementLineNumberToApply.has_value() ? statementLineNumberToApply : annotationsRanges[indexOfRange].statementLineNumber;
+
+        std::size_t annotationsId = annotationsRanges[indexOfRange].annotationsId;
+        if (areAnnotationsModified) {
+            QuantumOperationAnnotationsLookup annotations = *annotationsPerId[annotationsId];
+            for (const auto& [annotationKey, annotationValue]: firstAnnotationsToApply) {
+                annotations.insert_or_assign(annotationKey, annotationValue);
+            }
+            for (const auto& [annotationKey, annotationValue]: secondAnnotationsToApply) {
+                annotations.insert_or_assign(annotationKey, annotationValue);
+            }
+            annotationsId = internAnnotations(std::move(annotations));
+        }
+        assignAnnotationsToPositions(position, endPosition, annotationsId, statementLineNumber);
+        position = endPosition;
+    }
+    return true;
+}
+
+bool QuantumOperationAnnotationsTable::copyAnnotationsOfQuantumOperations(const std::size_t firstSourcePosition, const std::size_t firstTargetPosition, const std::size_t numQuantumOperations) {
+    if (firstSourcePosition + numQuantumOperations > this->numQuantumOperations || firstTargetPosition + numQuantumOperations > this->numQuantumOperations) {
+        return false;
+    }
+
+    // The ranges of the source positions are determined prior to the modification of the target positions since both could overlap. The first position of each range is stored relative to the first source position.
+    std::vector<AnnotationsRange> copiedAnnotationsRanges;
+    std::size_t                   position = firstSourcePosition;
+    while (position < firstSourcePosition + numQuantumOperations) {
+        const std::size_t indexOfRange = determineIndexOfRangeContainingPosition(position);
+        copiedAnnotationsRanges.emplace_back(AnnotationsRange{.firstPosition = position - firstSourcePosition, .annotationsId = annotationsRanges[indexOfRange].annotationsId, .statementLineNumber = annotationsRanges[indexOfRange].statementLineNumber});
+        position = std::min(determineEndOfRange(indexOfRange), firstSourcePosition + numQuantumOperations);
+    }
+
+    for (std::size_t i = 0; i < copiedAnnotationsRanges.size(); ++i) {
+        const std::size_t endOfCopiedRange = i + 1U < copiedAnnotationsRanges.size() ? copiedAnnotationsRanges[i + 1U].firstPosition : numQuantumOperations;
+        assignAnnotationsToPositions(firstTargetPosition + copiedAnnotationsRanges[i].firstPosition, firstTargetPosition + endOfCopiedRange, copiedAnnotationsRanges[i].annotationsId, copiedAnnotationsRanges[i].statementLineNumber);
+    }
+    return true;
+}
+
+void QuantumOperationAnnotationsTable::eraseFirstQuantumOperations(const std::size_t numQuantumOperations) {
+    if (numQuantumOperations >= this->numQuantumOperations) {
+        annotationsRanges.clear();
+        this->numQuantumOperations = 0;
+        return;
+    }
+    if (numQuantumOperations == 0U) {
+        return;
+    }
+
+    const std::size_t indexOfFirstRemainingRange = determineIndexOfRangeContainingPosition(numQuantumOperations);
+    annotationsRanges.erase(annotationsRanges.begin(), std::next(annotationsRanges.begin(), static_cast<std::ptrdiff_t>(indexOfFirstRemainingRange)));
+    annotationsRanges.front().firstPosition = numQuantumOperations;
+    for (AnnotationsRange& annotationsRange: annotationsRanges) {
+        annotationsRange.firstPosition -= numQuantumOperations;
+    }
+    this->numQuantumOperations -= numQuantumOperations;
+}
+
+void QuantumOperationAnnotationsTable::eraseQuantumOperations(const std::vector<bool>& isQuantumOperationRemoved) {
+    std::vector<AnnotationsRange> remainingAnnotationsRanges;
+    std::size_t                   numRemainingQuantumOperations = 0;
+    for (std::size_t indexOfRange = 0; indexOfRange < annotationsRanges.size(); ++indexOfRange) {
+        const AnnotationsRange& annotationsRange = annotationsRanges[indexOfRange];
+        for (std::size_t position = annotationsRange.firstPosition; position < determineEndOfRange(indexOfRange); ++position) {
+            if (position < isQuantumOperationRemoved.size() && isQuantumOperationRemoved[position]) {
+                continue;
+            }
+            if (remainingAnnotationsRanges.empty() || !remainingAnnotationsRanges.back().hasSameAnnotationsAs(annotationsRange)) {
+                remainingAnnotationsRanges.emplace_back(AnnotationsRange{.firstPosition = numRemainingQuantumOperations, .annotationsId = annotationsRange.annotationsId, .statementLineNumber = annotationsRange.statementLineNumber});
+            }
+            ++numRemainingQuantumOperations;
+        }
+    }
+    annotationsRanges    = std::move(remainingAnnotationsRanges);
+    numQuantumOperations = numRemainingQuantumOperations;
+}
+
+bool QuantumOperationAnnotationsTable::reorderQuantumOperations(const std::vector<std::size_t>& previousPositionPerPosition) {
+    if (previousPositionPerPosition.size() != numQuantumOperations) {
+        return false;
+    }
+
+    std::vector<bool> isPreviousPositionReordered(numQuantumOperations, false);
+    for (const std::size_t previousPosition: previousPositionPerPosition) {
+        if (previousPosition >= numQuantumOperations || isPreviousPositionReordered[previousPosition]) {
+            return false;
+        }
+        isPreviousPositionReordered[previousPosition] = true;
+    }
+
+    std::vector<AnnotationsRange> reorderedAnnotationsRanges;
+    for (std::size_t position = 0; position < numQuantumOperations; ++position) {
+        const AnnotationsRange& previousAnnotationsRange = annotationsRanges[determineIndexOfRangeContainingPosition(previousPositionPerPosition[position])];
+        if (reorderedAnnotationsRanges.empty() || !reorderedAnnotationsRanges.back().hasSameAnnotationsAs(previousAnnotationsRange)) {
+            reorderedAnnotationsRanges.emplace_back(AnnotationsRange{.firstPosition = position, .annotationsId = previousAnnotationsRange.annotationsId, .statementLineNumber = previousAnnotationsRange.statementLineNumber});
+        }
+    }
+    annotationsRanges = std::move(reorderedAnnotationsRanges);
+    return true;
+}
+
+std::size_t QuantumOperationAnnotationsTable::determineNumBytes() const {
+    std::size_t numBytes = memory_accounting::numBytesOfNodesOfOrderedContainer(idPerAnnotations) + memory_accounting::numBytesOfHeapStorage(annotationsPerId) + memory_accounting::numBytesOfHeapStorage(annotationsRanges);
+    for (const auto& [annotations, annotationsId]: idPerAnnotations) {
+        numBytes += memory_accounting::numBytesOfNodesOfOrderedContainer(annotations);
+        for (const auto& [annotationKey, annotationValue]: annotations) {
+            numBytes += memory_accounting::numBytesOfHeapStorage(annotationKey) + memory_accounting::numBytesOfHeapStorage(annotationValue);
+        }
+    }
+    return numBytes;
+}
+
+std::size_t QuantumOperationAnnotationsTable::internAnnotations(QuantumOperationAnnotationsLookup annotations) {
+    // The keys of a std::map are not relocated by the insertion of further elements, thus a pointer to the key can be used to access the set of annotations by its id.
+    const auto [entryOfAnnotations, wasInserted] = idPerAnnotations.try_emplace(std::move(annotations), annotationsPerId.size());
+    if (wasInserted) {
+        annotationsPerId.emplace_back(&entryOfAnnotations->first);
+    }
+    return entryOfAnnotations->second;
+}
+
+std::size_t QuantumOperationAnnotationsTable::determineIndexOfRangeContainingPosition(const std::size_t position) const {
+    const auto rangeAfterPosition = std::ranges::upper_bound(annotationsRanges, position, std::less{}, &AnnotationsRange::firstPosition);
+    return static_cast<std::size_t>(std::distance(annotationsRanges.begin(), rangeAfterPosition)) - 1U;
+}
+
+std::size_t QuantumOperationAnnotationsTable::determineEndOfRange(const std::size_t indexOfRange) const noexcept {
+    return indexOfRange + 1U < annotationsRanges.size() ? annotationsRanges[indexOfRange + 1U].firstPosition : numQuantumOperations;
+}
+
+void QuantumOperationAnnotationsTable::assignAnnotationsToPositions(const std::size_t firstPosition, const std::size_t endPosition, const std::size_t annotationsId, const std::optional<unsigned>& statementLineNumber) {
+    if (firstPosition >= endPosition || endPosition > numQuantumOperations) {
+        return;
+    }
+
+    // The quantum operations after the assigned positions keep their annotations, thus a new range needs to be created for them if their range started within the assigned positions.
+    const std::optional<AnnotationsRange> rangeAfterAssignedPositions = endPosition < numQuantumOperations ? std::make_optional(annotationsRanges[determineIndexOfRangeContainingPosition(endPosition)]) : std::nullopt;
+    const AnnotationsRange                assignedRange{.firstPosition = firstPosition, .annotationsId = annotationsId, .statementLineNumber = statementLineNumber};
+
+    const auto firstReplacedRange   = std::ranges::lower_bound(annotationsRanges, firstPosition, std::less{}, &AnnotationsRange::firstPosition);
+    const auto endOfReplacedRanges  = std::ranges::lower_bound(annotationsRanges, endPosition, std::less{}, &AnnotationsRange::firstPosition);
+    const auto insertPosition       = annotationsRanges.erase(firstReplacedRange, endOfReplacedRanges);
+    const auto indexOfAssignedRange = static_cast<std::size_t>(std::distance(annotationsRanges.begin(), annotationsRanges.insert(insertPosition, assignedRange)));
+
+    const std::size_t indexOfNextRange = indexOfAssignedRange + 1U;
+    if (rangeAfterAssignedPositions.has_value() && (indexOfNextRange == annotationsRanges.size() || annotationsRanges[indexOfNextRange].firstPosition != endPosition)) {
+        annotationsRanges.insert(std::next(annotationsRanges.begin(), static_cast<std::ptrdiff_t>(indexOfNextRange)), AnnotationsRange{.firstPosition = endPosition, .annotationsId = rangeAfterAssignedPositions->annotationsId, .statementLineNumber = rangeAfterAssignedPositions->statementLineNumber});
+    }
+
+    if (indexOfNextRange < annotationsRanges.size() && annotationsRanges[indexOfNextRange].hasSameAnnotationsAs(assignedRange)) {
+        annotationsRanges.erase(std::next(annotationsRanges.begin(), static_cast<std::ptrdiff_t>(indexOfNextRange)));
+    }
+    if (indexOfAssignedRange > 0U && annotationsRanges[indexOfAssignedRange - 1U].hasSameAnnotationsAs(assignedRange)) {
+        annotationsRanges.erase(std::next(annotationsRanges.begin(), static_cast<std::ptrdiff_t>(indexOfAssignedRange)));
+    }
+}
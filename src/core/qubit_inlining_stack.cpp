@@ -10,11 +10,16 @@
 
 #include "core/qubit_inlining_stack.hpp"
 
+#include "core/memory_accounting.hpp"
+#include "core/module_call_tree.hpp"
 #include "core/syrec/variable.hpp"
 
+#include <algorithm>
 #include <cstddef>
+#include <memory>
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 using namespace syrec;
@@ -71,15 +76,20 @@ std::optional<std::string> QubitInliningStack::QubitInliningStackEntry::stringif
     return stringifiedCalledModuleSignature;
 }
 
+QubitInliningStack::QubitInliningStack(std::shared_ptr<const ModuleCallTree> moduleCallTree, const ModuleCallTree::NodeId moduleCallTreeNodeId):
+    moduleCallTree(moduleCallTree != nullptr && moduleCallTree->getNode(moduleCallTreeNodeId) != nullptr ? std::move(moduleCallTree) : nullptr), moduleCallTreeNodeId(moduleCallTreeNodeId) {}
+
 bool QubitInliningStack::push(const QubitInliningStackEntry& inlineStackEntry) {
     if (inlineStackEntry.targetModule == nullptr) {
         return false;
     }
+    createStackEntriesFromModuleCallTree();
     stackEntries.push_back(inlineStackEntry);
     return true;
 }
 
 bool QubitInliningStack::pop() {
+    createStackEntriesFromModuleCallTree();
     if (!stackEntries.empty()) {
         stackEntries.pop_back();
         return true;
@@ -88,9 +98,39 @@ bool QubitInliningStack::pop() {
 }
 
 std::size_t QubitInliningStack::size() const {
-    return stackEntries.size();
+    return moduleCallTree != nullptr ? moduleCallTree->getNode(moduleCallTreeNodeId)->depth : stackEntries.size();
 }
 
 QubitInliningStack::QubitInliningStackEntry* QubitInliningStack::getStackEntryAt(std::size_t idx) {
+    createStackEntriesFromModuleCallTree();
     return idx < size() ? &stackEntries[idx] : nullptr;
 }
+
+bool QubitInliningStack::areTargetModulesOfAllStackEntriesSet() const {
+    // The module call tree does not allow the creation of nodes without a target module
+    return moduleCallTree != nullptr || std::ranges::all_of(stackEntries, [](const QubitInliningStackEntry& stackEntry) { return stackEntry.targetModule != nullptr; });
+}
+
+void QubitInliningStack::createStackEntriesFromModuleCallTree() {
+    if (moduleCallTree == nullptr) {
+        return;
+    }
+
+    const ModuleCallTree::Node* moduleCallTreeNode = moduleCallTree->getNode(moduleCallTreeNodeId);
+    stackEntries.resize(moduleCallTreeNode->depth);
+    // The nodes are visited from the referenced node to the root node while the call information of the visited node is stored in the stack entry of its parent.
+    std::optional<unsigned int> lineNumberOfCallOfCalledModule;
+    std::optional<bool>         isCalledModuleAccessedViaCallStmt;
+    for (std::size_t i = stackEntries.size(); i > 0 && moduleCallTreeNode != nullptr; --i) {
+        stackEntries[i - 1] = QubitInliningStackEntry({.lineNumberOfCallOfTargetModule = lineNumberOfCallOfCalledModule, .isTargetModuleAccessedViaCallStmt = isCalledModuleAccessedViaCallStmt, .targetModule = moduleCallTreeNode->targetModule});
+
+        lineNumberOfCallOfCalledModule    = moduleCallTreeNode->lineNumberOfCallOfTargetModule;
+        isCalledModuleAccessedViaCallStmt = moduleCallTreeNode->isTargetModuleAccessedViaCallStmt;
+        moduleCallTreeNode                = moduleCallTreeNode->parentNodeId.has_value() ? moduleCallTree->getNode(*moduleCallTreeNode->parentNodeId) : nullptr;
+    }
+    moduleCallTree.reset();
+}
+
+std::size_t QubitInliningStack::determineNumBytes() const {
+    return sizeof(QubitInliningStack) + memory_accounting::numBytesOfHeapStorage(stackEntries);
+}
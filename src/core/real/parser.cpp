@@ -18,6 +18,7 @@
 #include "ir/operations/StandardOperation.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cctype>
 #include <cstddef>
 #include <cstdint>
@@ -26,10 +27,10 @@
 #include <initializer_list>
 #include <iostream>
 #include <istream>
+#include <iterator>
 #include <limits>
 #include <map>
 #include <optional>
-#include <regex>
 #include <set>
 #include <sstream>
 #include <stdexcept>
@@ -41,23 +42,241 @@
 
 namespace syrec {
     namespace {
-        std::optional<qc::Qubit> getQubitForVariableIdentFromAnyLookup(
-                const std::string& variableIdent, const qc::QuantumRegisterMap& dataQubits,
+        /// Transparent hash enabling lookups of std::string keys via std::string_view
+        struct VariableIdentHash {
+            using is_transparent = void;
+
+            std::size_t operator()(const std::string_view& variableIdent) const noexcept {
+                return std::hash<std::string_view>{}(variableIdent);
+            }
+        };
+
+        using VariableIdentQubitLookup = std::unordered_map<std::string, qc::Qubit, VariableIdentHash, std::equal_to<>>;
+
+        /// Build a flat lookup of the qubit of every variable ident with variable qubits being either data or ancillary qubits
+        /// (with a data qubit being preferred if both registers define a variable with the same ident).
+        /// @param dataQubits The registers of the data qubits
+        /// @param ancillaryQubits The registers of the ancillary qubits
+        /// @return The lookup of the qubit of every variable ident
+        VariableIdentQubitLookup buildVariableIdentQubitLookup(
+                const qc::QuantumRegisterMap& dataQubits,
                 const qc::QuantumRegisterMap& ancillaryQubits) {
-            if (const auto& matchingEntryInDataQubits = dataQubits.find(variableIdent);
-                matchingEntryInDataQubits != dataQubits.end()) {
-                return matchingEntryInDataQubits->second.getStartIndex();
+            VariableIdentQubitLookup lookup;
+            lookup.reserve(dataQubits.size() + ancillaryQubits.size());
+            for (const auto& [variableIdent, quantumRegister]: dataQubits) {
+                lookup.emplace(variableIdent, quantumRegister.getStartIndex());
+            }
+            for (const auto& [variableIdent, quantumRegister]: ancillaryQubits) {
+                lookup.emplace(variableIdent, quantumRegister.getStartIndex());
             }
+            return lookup;
+        }
 
-            if (const auto& matchingEntryInAncillaryQubits =
-                        ancillaryQubits.find(variableIdent);
-                matchingEntryInAncillaryQubits != ancillaryQubits.end()) {
-                return matchingEntryInAncillaryQubits->second.getStartIndex();
+        std::optional<qc::Qubit> getQubitForVariableIdentFromLookup(
+                const std::string_view& variableIdent, const VariableIdentQubitLookup& lookup) {
+            if (const auto& matchingEntry = lookup.find(variableIdent);
+                matchingEntry != lookup.end()) {
+                return matchingEntry->second;
             }
+            return std::nullopt;
+        }
 
+        /// The components of a gate declaration of the form
+        /// (r[xyz]|i[df]|q|[0a-z](?:[+ip])?)(\d+)?(?::([-+]?[0-9]+[.]?[0-9]*(?:[eE][-+]?[0-9]+)?))?
+        /// with a component being empty if it was not defined.
+        struct GateDeclaration {
+            std::string_view identifier;
+            std::string_view numberOfGateLines;
+            std::string_view parameter;
+        };
+
+        bool isDigit(const char character) noexcept {
+            return character >= '0' && character <= '9';
+        }
+
+        /// Determine whether the whole given value matches [-+]?[0-9]+[.]?[0-9]*(?:[eE][-+]?[0-9]+)?
+        bool isValidGateParameter(const std::string_view& value) noexcept {
+            std::size_t idx = 0;
+            if (idx < value.size() && (value[idx] == '-' || value[idx] == '+')) {
+                ++idx;
+            }
+            const std::size_t firstDigitIdx = idx;
+            while (idx < value.size() && isDigit(value[idx])) {
+                ++idx;
+            }
+            if (idx == firstDigitIdx) {
+                return false;
+            }
+            if (idx < value.size() && value[idx] == '.') {
+                ++idx;
+            }
+            while (idx < value.size() && isDigit(value[idx])) {
+                ++idx;
+            }
+            if (idx < value.size() && (value[idx] == 'e' || value[idx] == 'E')) {
+                ++idx;
+                if (idx < value.size() && (value[idx] == '-' || value[idx] == '+')) {
+                    ++idx;
+                }
+                const std::size_t firstExponentDigitIdx = idx;
+                while (idx < value.size() && isDigit(value[idx])) {
+                    ++idx;
+                }
+                if (idx == firstExponentDigitIdx) {
+                    return false;
+                }
+            }
+            return idx == value.size();
+        }
+
+        /// Match a gate declaration without the need to evaluate a std::regex, the alternatives of the identifier are tried in the same order as
+        /// by the regular expression documented at GateDeclaration.
+        /// @param gateDeclaration The lower-case gate declaration
+        /// @return The components of the gate declaration, std::nullopt if the declaration is invalid
+        std::optional<GateDeclaration> matchGateDeclaration(const std::string_view& gateDeclaration) {
+            std::array<std::size_t, 3> identifierLengthCandidates{};
+            std::size_t                numIdentifierLengthCandidates = 0;
+
+            const auto startsWithAnyOf = [&gateDeclaration](const char first, const std::string_view& seconds) {
+                return gateDeclaration.size() >= 2 && gateDeclaration[0] == first && seconds.find(gateDeclaration[1]) != std::string_view::npos;
+            };
+            if (startsWithAnyOf('r', "xyz") || startsWithAnyOf('i', "df")) {
+                identifierLengthCandidates.at(numIdentifierLengthCandidates++) = 2;
+            } else if (gateDeclaration.starts_with('q')) {
+                identifierLengthCandidates.at(numIdentifierLengthCandidates++) = 1;
+            }
+            if (!gateDeclaration.empty() && (gateDeclaration[0] == '0' || (gateDeclaration[0] >= 'a' && gateDeclaration[0] <= 'z'))) {
+                if (gateDeclaration.size() >= 2 && std::string_view("+ip").find(gateDeclaration[1]) != std::string_view::npos) {
+                    identifierLengthCandidates.at(numIdentifierLengthCandidates++) = 2;
+                }
+                identifierLengthCandidates.at(numIdentifierLengthCandidates++) = 1;
+            }
+
+            for (std::size_t i = 0; i < numIdentifierLengthCandidates; ++i) {
+                const auto  identifierLength = identifierLengthCandidates.at(i);
+                std::size_t idx              = identifierLength;
+                while (idx < gateDeclaration.size() && isDigit(gateDeclaration[idx])) {
+                    ++idx;
+                }
+                GateDeclaration components{.identifier        = gateDeclaration.substr(0, identifierLength),
+                                           .numberOfGateLines = gateDeclaration.substr(identifierLength, idx - identifierLength),
+                                           .parameter         = std::string_view()};
+                if (idx == gateDeclaration.size()) {
+                    return components;
+                }
+                if (gateDeclaration[idx] == ':' && isValidGateParameter(gateDeclaration.substr(idx + 1))) {
+                    components.parameter = gateDeclaration.substr(idx + 1);
+                    return components;
+                }
+            }
             return std::nullopt;
         }
 
+        bool isStreamWhitespace(const char character) noexcept {
+            return static_cast<bool>(std::isspace(static_cast<unsigned char>(character)));
+        }
+
+        /// Count the number of gate declarations in the gate section of a .real file, i.e. the number of lines that are neither empty nor comments
+        /// prior to the .end command, which is used to reserve the operations of the quantum computation.
+        std::size_t countGateDeclarations(const std::string_view& gateSection) {
+            std::size_t numGateDeclarations = 0;
+            std::size_t lineStart           = 0;
+            while (lineStart < gateSection.size()) {
+                const auto lineEnd = std::min(gateSection.find('\n', lineStart), gateSection.size());
+                auto       line    = gateSection.substr(lineStart, lineEnd - lineStart);
+                lineStart          = lineEnd + 1;
+
+                while (!line.empty() && isStreamWhitespace(line.front())) {
+                    line.remove_prefix(1);
+                }
+                if (line.empty() || line.front() == '#') {
+                    continue;
+                }
+                if (line.size() >= 4 && line[0] == '.' && std::tolower(static_cast<unsigned char>(line[1])) == 'e' && std::tolower(static_cast<unsigned char>(line[2])) == 'n' && std::tolower(static_cast<unsigned char>(line[3])) == 'd') {
+                    break;
+                }
+                ++numGateDeclarations;
+            }
+            return numGateDeclarations;
+        }
+
+        /// Reader of the gate section of a .real file that was read into a buffer providing the same semantics as the equivalently
+        /// named operations of a std::istream (i.e. operator>>, std::getline and std::istream::ignore) without the overhead of the latter.
+        class GateSectionReader {
+        public:
+            GateSectionReader(std::string buffer, const bool reachedEndOfStream):
+                buffer(std::move(buffer)), reachedEndOfStream(reachedEndOfStream) {}
+
+            [[nodiscard]] std::string_view getContent() const noexcept {
+                return buffer;
+            }
+
+            [[nodiscard]] bool eof() const noexcept {
+                return reachedEndOfStream;
+            }
+
+            /// Read the next whitespace separated token (equivalent to is >> token)
+            bool readToken(std::string& token) {
+                if (reachedEndOfStream) {
+                    return false;
+                }
+                while (position < buffer.size() && isStreamWhitespace(buffer[position])) {
+                    ++position;
+                }
+                if (position == buffer.size()) {
+                    reachedEndOfStream = true;
+                    return false;
+                }
+                const std::size_t tokenStart = position;
+                while (position < buffer.size() && !isStreamWhitespace(buffer[position])) {
+                    ++position;
+                }
+                reachedEndOfStream = position == buffer.size();
+                token.assign(buffer, tokenStart, position - tokenStart);
+                return true;
+            }
+
+            /// Read the remaining characters of the current line (equivalent to std::getline(is, line))
+            bool readRestOfLine(std::string& line) {
+                if (reachedEndOfStream) {
+                    return false;
+                }
+                if (position == buffer.size()) {
+                    reachedEndOfStream = true;
+                    return false;
+                }
+                const std::size_t lineEnd = buffer.find('\n', position);
+                if (lineEnd == std::string::npos) {
+                    line.assign(buffer, position);
+                    position           = buffer.size();
+                    reachedEndOfStream = true;
+                    return true;
+                }
+                line.assign(buffer, position, lineEnd - position);
+                position = lineEnd + 1;
+                return true;
+            }
+
+            /// Skip the remaining characters of the current line (equivalent to is.ignore(std::numeric_limits<std::streamsize>::max(), '\n'))
+            void skipRestOfLine() {
+                if (reachedEndOfStream) {
+                    return;
+                }
+                const std::size_t lineEnd = buffer.find('\n', position);
+                if (lineEnd == std::string::npos) {
+                    position           = buffer.size();
+                    reachedEndOfStream = true;
+                    return;
+                }
+                position = lineEnd + 1;
+            }
+
+        private:
+            std::string buffer;
+            std::size_t position = 0;
+            bool        reachedEndOfStream;
+        };
+
         /// Determine whether the given io name value, which is not enclosed in quotes,
         /// consists of only letters, digits, and underscore characters.
         /// @param ioName The name to validate
@@ -663,17 +882,28 @@ namespace syrec {
 
     void RealParser::readRealGateDescriptions(std::istream& is,
                                               int           line) const {
-        const std::regex gateRegex =
-                std::regex("(r[xyz]|i[df]|q|[0a-z](?:[+ip])?)(\\d+)?(?::([-+]?[0-9]+[.]?["
-                           "0-9]*(?:[eE][-+]?[0-9]+)?))?");
-        std::smatch m;
         std::string cmd;
 
-        static const std::map<std::string, OpType> IDENTIFIER_MAP{
+        static const std::map<std::string, OpType, std::less<>> IDENTIFIER_MAP{
                 {"0", I}, {"id", I}, {"h", H}, {"n", X}, {"c", X}, {"x", X}, {"y", Y}, {"z", Z}, {"s", S}, {"si", Sdg}, {"sp", Sdg}, {"s+", Sdg}, {"v", V}, {"vi", Vdg}, {"vp", Vdg}, {"v+", Vdg}, {"rx", RX}, {"ry", RY}, {"rz", RZ}, {"f", SWAP}, {"if", SWAP}, {"p", Peres}, {"pi", Peresdg}, {"p+", Peresdg}, {"q", P}};
 
-        while (!is.eof()) {
-            if (!static_cast<bool>(is >> cmd)) {
+        // The remaining content of the stream is read at once with all further reads operating on the buffer instead of the stream.
+        const bool        reachedEndOfStream = is.eof();
+        GateSectionReader reader(reachedEndOfStream ? std::string() : std::string(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>()), reachedEndOfStream);
+        qc->reserve(qc->getNops() + countGateDeclarations(reader.getContent()));
+
+        // The variables of the circuit are not changed while processing the gate declarations, thus the lookups can be built once
+        // instead of for every gate. The entries of the creg register map prefixed with 'c_' determine the declared variable idents
+        // in the .variable entry
+        const auto                      variableIdentQubitLookup = buildVariableIdentQubitLookup(qc->getQuantumRegisters(), qc->getAncillaRegisters());
+        std::unordered_set<std::string> validVariableIdentLookup;
+        for (const auto& qregNameAndQubitIndexPair: qc->getClassicalRegisters()) {
+            validVariableIdentLookup.emplace(
+                    qregNameAndQubitIndexPair.first.substr(2));
+        }
+
+        while (!reader.eof()) {
+            if (!reader.readToken(cmd)) {
                 throw std::runtime_error("[real parser] l:" + std::to_string(line) +
                                          " msg: Failed to read command");
             }
@@ -683,7 +913,7 @@ namespace syrec {
             ++line;
 
             if (cmd.front() == '#') {
-                is.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                reader.skipRestOfLine();
                 continue;
             }
 
@@ -692,28 +922,29 @@ namespace syrec {
             }
 
             // match gate declaration
-            if (!std::regex_match(cmd, m, gateRegex)) {
+            const auto gateDeclaration = matchGateDeclaration(cmd);
+            if (!gateDeclaration.has_value()) {
                 throw std::runtime_error("[real parser] l:" + std::to_string(line) +
                                          " msg: Unsupported gate detected: " + cmd);
             }
 
             // extract gate information (identifier, #controls, divisor)
             OpType gate{};
-            if (m.str(1) == "t") { // special treatment of t(offoli) for real format
+            if (gateDeclaration->identifier == "t") { // special treatment of t(offoli) for real format
                 gate = X;
             } else {
-                auto it = IDENTIFIER_MAP.find(m.str(1));
+                auto it = IDENTIFIER_MAP.find(gateDeclaration->identifier);
                 if (it == IDENTIFIER_MAP.end()) {
                     throw std::runtime_error("[real parser] l:" + std::to_string(line) +
-                                             " msg: Unknown gate identifier: " + m.str(1));
+                                             " msg: Unknown gate identifier: " + std::string(gateDeclaration->identifier));
                 }
                 gate = (*it).second;
             }
             auto ncontrols =
-                    m.str(2).empty() ? 0 : std::stoul(m.str(2), nullptr, 0) - 1;
-            const fp lambda = m.str(3).empty() ? static_cast<fp>(0L) : static_cast<fp>(std::stold(m.str(3)));
+                    gateDeclaration->numberOfGateLines.empty() ? 0 : std::stoul(std::string(gateDeclaration->numberOfGateLines), nullptr, 0) - 1;
+            const fp lambda = gateDeclaration->parameter.empty() ? static_cast<fp>(0L) : static_cast<fp>(std::stold(std::string(gateDeclaration->parameter)));
 
-            if (gate == V || gate == Vdg || m.str(1) == "c") {
+            if (gate == V || gate == Vdg || gateDeclaration->identifier == "c") {
                 ncontrols = 1;
             } else if (gate == Peres || gate == Peresdg) {
                 ncontrols = 2;
@@ -727,7 +958,7 @@ namespace syrec {
             }
 
             std::string qubits;
-            if (!getline(is, qubits)) {
+            if (!reader.readRestOfLine(qubits)) {
                 throw std::runtime_error("[real parser] l:" + std::to_string(line) +
                                          " msg: Failed read in gate definition");
             }
@@ -738,10 +969,10 @@ namespace syrec {
             // number of gate lines) we assume that the number of whitespaces left of
             // the gate type define the number of gate lines.
             std::size_t numberOfGateLines = 0;
-            if (const std::string& stringifiedNumberOfGateLines = m.str(2);
+            if (const std::string_view& stringifiedNumberOfGateLines = gateDeclaration->numberOfGateLines;
                 !stringifiedNumberOfGateLines.empty()) {
                 numberOfGateLines = static_cast<std::size_t>(
-                        std::stoul(stringifiedNumberOfGateLines, nullptr, 0));
+                        std::stoul(std::string(stringifiedNumberOfGateLines), nullptr, 0));
             } else {
                 numberOfGateLines = static_cast<std::size_t>(
                         std::count(qubits.cbegin(), qubits.cend(), ' '));
@@ -761,16 +992,8 @@ namespace syrec {
                 ncontrols = static_cast<uint32_t>(numberOfGateLines - 2);
             }
 
-            std::vector<Control>            controls(ncontrols, Qubit());
-            const auto&                     gateLines = qubits.empty() ? "" : qubits.substr(1);
-            std::unordered_set<std::string> validVariableIdentLookup;
-
-            // Use the entries of the creg register map prefixed with 'c_' to determine
-            // the declared variable idents in the .variable entry
-            for (const auto& qregNameAndQubitIndexPair: qc->getClassicalRegisters()) {
-                validVariableIdentLookup.emplace(
-                        qregNameAndQubitIndexPair.first.substr(2));
-            }
+            std::vector<Control> controls(ncontrols, Qubit());
+            const auto&          gateLines = qubits.empty() ? "" : qubits.substr(1);
 
             // We will ignore the prefix '-' when validating a given gate line ident
             auto processedGateLines = parseVariableNames(
@@ -788,8 +1011,7 @@ namespace syrec {
                 // Since variable qubits can either be data or ancillary qubits our search
                 // will have to be conducted in both lookups
                 if (const std::optional<Qubit> controlLineQubit =
-                            getQubitForVariableIdentFromAnyLookup(
-                                    std::string(gateIdent), qc->getQuantumRegisters(), qc->getAncillaRegisters());
+                            getQubitForVariableIdentFromLookup(gateIdent, variableIdentQubitLookup);
                     controlLineQubit.has_value()) {
                     controls[i] =
                             Control(*controlLineQubit,
@@ -808,8 +1030,7 @@ namespace syrec {
                 // Since variable qubits can either be data or ancillary qubits our search
                 // will have to be conducted in both lookups
                 if (const std::optional<Qubit> targetLineQubit =
-                            getQubitForVariableIdentFromAnyLookup(
-                                    targetLineIdent, qc->getQuantumRegisters(), qc->getAncillaRegisters());
+                            getQubitForVariableIdentFromLookup(targetLineIdent, variableIdentQubitLookup);
                     targetLineQubit.has_value()) {
                     targetLineQubits[i] = *targetLineQubit;
                 } else {
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/statistics.hpp"
+
+#include "core/execution_limits.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+#if _WIN32
+#include <windows.h>
+// The psapi header must be included after the windows header.
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+using namespace syrec;
+
+namespace {
+    [[nodiscard]] std::size_t determinePeakResidentSetSizeInBytes() {
+#if _WIN32
+        PROCESS_MEMORY_COUNTERS processMemoryCounters;
+        if (GetProcessMemoryInfo(GetCurrentProcess(), &processMemoryCounters, sizeof(processMemoryCounters)) == 0) {
+            return 0;
+        }
+        return static_cast<std::size_t>(processMemoryCounters.PeakWorkingSetSize);
+#else
+        rusage resourceUsage{};
+        if (getrusage(RUSAGE_SELF, &resourceUsage) != 0 || resourceUsage.ru_maxrss < 0) {
+            return 0;
+        }
+#if __APPLE__
+        // The maximum resident set size is reported in bytes on macOS while other unix-like systems report it in kilobytes.
+        return static_cast<std::size_t>(resourceUsage.ru_maxrss);
+#else
+        return static_cast<std::size_t>(resourceUsage.ru_maxrss) * 1024U;
+#endif
+#endif
+    }
+
+    void writeJsonString(std::ostream& outputStream, const std::string_view& stringToWrite) {
+        outputStream << '"';
+        for (const char character: stringToWrite) {
+            if (character == '"' || character == '\\') {
+                outputStream << '\\';
+            }
+            outputStream << character;
+        }
+        outputStream << '"';
+    }
+} // namespace
+
+void Statistics::recordRuntime(const std::chrono::steady_clock::duration runtime) {
+    runtimeInNanoseconds  = toNanoseconds(runtime);
+    runtimeInMilliseconds = std::chrono::duration<double, std::milli>(runtime).count();
+}
+
+void Statistics::recordPeakResidentSetSize() {
+    peakResidentSetSizeInBytes = determinePeakResidentSetSizeInBytes();
+}
+
+std::string Statistics::toJson() const {
+    std::ostringstream jsonStream;
+    jsonStream << "{\"runtime_in_milliseconds\":" << runtimeInMilliseconds
+               << ",\"runtime_in_nanoseconds\":" << runtimeInNanoseconds
+               << ",\"parsing_runtime_in_nanoseconds\":" << parsingRuntimeInNanoseconds
+               << ",\"semantic_check_runtime_in_nanoseconds\":" << semanticCheckRuntimeInNanoseconds
+               << ",\"synthesis_runtime_in_nanoseconds\":" << synthesisRuntimeInNanoseconds
+               << ",\"optimization_runtime_in_nanoseconds\":" << optimizationRuntimeInNanoseconds
+               << ",\"num_reused_ancillary_qubits\":" << numReusedAncillaryQubits
+               << ",\"num_uncomputed_expressions\":" << numUncomputedExpressions
+               << ",\"num_quantum_operations_of_uncomputed_expressions\":" << numQuantumOperationsOfUncomputedExpressions
+               << ",\"num_cancelled_quantum_operations\":" << numCancelledQuantumOperations
+               << ",\"num_qubits\":" << numQubits
+               << ",\"num_ancillary_qubits\":" << numAncillaryQubits
+               << ",\"num_quantum_operations\":" << numQuantumOperations
+               << ",\"num_quantum_operations_per_gate_type\":{";
+    bool isFirstGateType = true;
+    for (const auto& [gateType, numQuantumOperationsOfGateType]: numQuantumOperationsPerGateType) {
+        if (!isFirstGateType) {
+            jsonStream << ',';
+        }
+        writeJsonString(jsonStream, gateType);
+        jsonStream << ':' << numQuantumOperationsOfGateType;
+        isFirstGateType = false;
+    }
+    jsonStream << "},\"depth\":" << depth
+               << ",\"num_expanded_module_calls\":" << numExpandedModuleCalls
+               << ",\"num_reused_module_calls\":" << numReusedModuleCalls
+               << ",\"num_unrolled_loop_iterations\":" << numUnrolledLoopIterations
+               << ",\"num_replayed_loop_iterations\":" << numReplayedLoopIterations
+               << ",\"num_assignments_synthesized_cost_aware\":" << numAssignmentsSynthesizedCostAware
+               << ",\"num_assignments_synthesized_line_aware\":" << numAssignmentsSynthesizedLineAware
+               << ",\"estimated_num_quantum_operations_saved_by_hybrid_synthesis\":" << estimatedNumQuantumOperationsSavedByHybridSynthesis
+               << ",\"estimated_num_ancillary_qubits_saved_by_hybrid_synthesis\":" << estimatedNumAncillaryQubitsSavedByHybridSynthesis
+               << ",\"num_iterations_of_optimization_pipeline\":" << numIterationsOfOptimizationPipeline
+               << ",\"statistics_per_optimization_pass\":{";
+    bool isFirstOptimizationPass = true;
+    for (const auto& [optimizationPass, optimizationPassStatistics]: statisticsPerOptimizationPass) {
+        if (!isFirstOptimizationPass) {
+            jsonStream << ',';
+        }
+        writeJsonString(jsonStream, optimizationPass);
+        jsonStream << ":{\"num_applications\":" << optimizationPassStatistics.numApplications
+                   << ",\"num_modifications\":" << optimizationPassStatistics.numModifications
+                   << ",\"runtime_in_nanoseconds\":" << optimizationPassStatistics.runtimeInNanoseconds
+                   << ",\"num_removed_quantum_operations\":" << optimizationPassStatistics.numRemovedQuantumOperations
+                   << ",\"num_removed_qubits\":" << optimizationPassStatistics.numRemovedQubits << '}';
+        isFirstOptimizationPass = false;
+    }
+    jsonStream << "},\"num_synthesis_result_cache_hits\":" << numSynthesisResultCacheHits
+               << ",\"num_synthesis_result_cache_misses\":" << numSynthesisResultCacheMisses
+               << ",\"num_t_gates\":" << numTGates
+               << ",\"t_depth\":" << tDepth
+               << ",\"peak_resident_set_size_in_bytes\":" << peakResidentSetSizeInBytes
+               << ",\"memory_usage\":{\"num_bytes_of_program\":" << memoryUsage.numBytesOfProgram
+               << ",\"num_bytes_of_symbol_tables\":" << memoryUsage.numBytesOfSymbolTables
+               << ",\"num_bytes_of_quantum_operations\":" << memoryUsage.numBytesOfQuantumOperations
+               << ",\"num_bytes_of_quantum_operation_annotations\":" << memoryUsage.numBytesOfQuantumOperationAnnotations
+               << ",\"num_bytes_of_quantum_register_layouts\":" << memoryUsage.numBytesOfQuantumRegisterLayouts
+               << ",\"num_bytes_of_inline_stacks\":" << memoryUsage.numBytesOfInlineStacks
+               << ",\"resident_set_size_at_start_of_synthesis_in_bytes\":" << memoryUsage.residentSetSizeAtStartOfSynthesisInBytes
+               << ",\"peak_resident_set_size_during_synthesis_in_bytes\":" << memoryUsage.peakResidentSetSizeDuringSynthesisInBytes
+               << "},\"execution_limit_violation\":";
+    writeJsonString(jsonStream, stringifyExecutionLimitViolation(executionLimitViolation));
+    jsonStream << '}';
+    return jsonStream.str();
+}
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/syrec/compiled_number.hpp"
+
+#include "core/syrec/number.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    [[nodiscard]] std::size_t getOrAddLoopVariableSlot(const std::string& loopVariableIdentifier, std::vector<std::string>& identifierPerLoopVariableSlot) {
+        // The number of simultaneously active loop variables is small, thus a linear search is sufficient.
+        if (const auto matchingSlot = std::ranges::find(identifierPerLoopVariableSlot, loopVariableIdentifier); matchingSlot != identifierPerLoopVariableSlot.end()) {
+            return static_cast<std::size_t>(std::distance(identifierPerLoopVariableSlot.begin(), matchingSlot));
+        }
+        identifierPerLoopVariableSlot.emplace_back(loopVariableIdentifier);
+        return identifierPerLoopVariableSlot.size() - 1U;
+    }
+
+    [[nodiscard]] std::optional<unsigned> getValueOfLoopVariableSlot(const std::span<const std::optional<unsigned>> valuePerLoopVariableSlot, const std::size_t loopVariableSlot) {
+        return loopVariableSlot < valuePerLoopVariableSlot.size() ? valuePerLoopVariableSlot[loopVariableSlot] : std::nullopt;
+    }
+
+    [[nodiscard]] unsigned getValueOfConstant(const Number& number) {
+        return number.evaluate({});
+    }
+} // namespace
+
+CompiledNumber::CompiledNumber(const Number& number, std::vector<std::string>& identifierPerLoopVariableSlot) {
+    affineForm = tryLowerToAffineForm(number, identifierPerLoopVariableSlot);
+    if (!affineForm.has_value()) {
+        isEvaluable = lowerToInstructions(number, identifierPerLoopVariableSlot, 0);
+    }
+}
+
+std::optional<unsigned> CompiledNumber::tryEvaluate(const std::span<const std::optional<unsigned>> valuePerLoopVariableSlot) const {
+    if (!isEvaluable) {
+        return std::nullopt;
+    }
+
+    if (affineForm.has_value()) {
+        if (!affineForm->loopVariableSlot.has_value()) {
+            return affineForm->offset;
+        }
+        const std::optional<unsigned> valueOfLoopVariable = getValueOfLoopVariableSlot(valuePerLoopVariableSlot, *affineForm->loopVariableSlot);
+        return valueOfLoopVariable.has_value() ? std::make_optional((affineForm->coefficient * *valueOfLoopVariable) + affineForm->offset) : std::nullopt;
+    }
+
+    std::array<unsigned, MAX_INLINE_OPERAND_STACK_SIZE> inlineOperandStack{};
+    std::vector<unsigned>                               allocatedOperandStack;
+    if (maxOperandStackSize > MAX_INLINE_OPERAND_STACK_SIZE) {
+        allocatedOperandStack.resize(maxOperandStackSize);
+    }
+    const std::span<unsigned> operandStack = maxOperandStackSize > MAX_INLINE_OPERAND_STACK_SIZE ? std::span<unsigned>(allocatedOperandStack) : std::span<unsigned>(inlineOperandStack);
+
+    std::size_t operandStackSize = 0;
+    for (const auto& [opcode, operand]: instructions) {
+        switch (opcode) {
+            case Opcode::PushConstant:
+                operandStack[operandStackSize++] = static_cast<unsigned>(operand);
+                continue;
+            case Opcode::PushLoopVariable:
+                if (const std::optional<unsigned> valueOfLoopVariable = getValueOfLoopVariableSlot(valuePerLoopVariableSlot, operand); valueOfLoopVariable.has_value()) {
+                    operandStack[operandStackSize++] = *valueOfLoopVariable;
+                    continue;
+                }
+                return std::nullopt;
+            default:
+                break;
+        }
+
+        const unsigned rhsOperand = operandStack[--operandStackSize];
+        unsigned&      lhsOperand = operandStack[operandStackSize - 1U];
+        switch (opcode) {
+            case Opcode::Add:
+                lhsOperand += rhsOperand;
+                break;
+            case Opcode::Subtract:
+                lhsOperand -= rhsOperand;
+                break;
+            case Opcode::Multiply:
+                lhsOperand *= rhsOperand;
+                break;
+            case Opcode::Divide:
+                if (rhsOperand == 0U) {
+                    return std::nullopt;
+                }
+                lhsOperand /= rhsOperand;
+                break;
+            default:
+                return std::nullopt;
+        }
+    }
+    return operandStackSize == 1U ? std::make_optional(operandStack.front()) : std::nullopt;
+}
+
+std::optional<CompiledNumber::AffineForm> CompiledNumber::tryLowerToAffineForm(const Number& number, std::vector<std::string>& identifierPerLoopVariableSlot) {
+    if (number.isConstant()) {
+        return AffineForm{.coefficient = 0U, .offset = getValueOfConstant(number), .loopVariableSlot = std::nullopt};
+    }
+    if (number.isLoopVariable()) {
+        return AffineForm{.coefficient = 1U, .offset = 0U, .loopVariableSlot = getOrAddLoopVariableSlot(number.variableName(), identifierPerLoopVariableSlot)};
+    }
+    if (!number.isConstantExpression()) {
+        return std::nullopt;
+    }
+
+    const Number::ConstantExpression constantExpression = *number.constantExpression();
+    if (constantExpression.lhsOperand == nullptr || constantExpression.rhsOperand == nullptr || constantExpression.operation == Number::ConstantExpression::Operation::Division) {
+        return std::nullopt;
+    }
+
+    const std::optional<AffineForm> lhsOperand = tryLowerToAffineForm(*constantExpression.lhsOperand, identifierPerLoopVariableSlot);
+    const std::optional<AffineForm> rhsOperand = lhsOperand.has_value() ? tryLowerToAffineForm(*constantExpression.rhsOperand, identifierPerLoopVariableSlot) : std::nullopt;
+    if (!lhsOperand.has_value() || !rhsOperand.has_value() || (lhsOperand->loopVariableSlot.has_value() && rhsOperand->loopVariableSlot.has_value() && (*lhsOperand->loopVariableSlot != *rhsOperand->loopVariableSlot || constantExpression.operation == Number::ConstantExpression::Operation::Multiplication))) {
+        return std::nullopt;
+    }
+
+    const std::optional<std::size_t> loopVariableSlot = lhsOperand->loopVariableSlot.has_value() ? lhsOperand->loopVariableSlot : rhsOperand->loopVariableSlot;
+    switch (constantExpression.operation) {
+        case Number::ConstantExpression::Operation::Addition:
+            return AffineForm{.coefficient = lhsOperand->coefficient + rhsOperand->coefficient, .offset = lhsOperand->offset + rhsOperand->offset, .loopVariableSlot = loopVariableSlot};
+        case Number::ConstantExpression::Operation::Subtraction:
+            return AffineForm{.coefficient = lhsOperand->coefficient - rhsOperand->coefficient, .offset = lhsOperand->offset - rhsOperand->offset, .loopVariableSlot = loopVariableSlot};
+        case Number::ConstantExpression::Operation::Multiplication: {
+            // At most one of the operands references a loop variable, the other one is thus a constant.
+            const AffineForm& affineOperand   = lhsOperand->loopVariableSlot.has_value() ? *lhsOperand : *rhsOperand;
+            const unsigned    constantOperand = lhsOperand->loopVariableSlot.has_value() ? rhsOperand->offset : lhsOperand->offset;
+            return AffineForm{.coefficient = affineOperand.coefficient * constantOperand, .offset = affineOperand.offset * constantOperand, .loopVariableSlot = loopVariableSlot};
+        }
+        default:
+            return std::nullopt;
+    }
+}
+
+bool CompiledNumber::lowerToInstructions(const Number& number, std::vector<std::string>& identifierPerLoopVariableSlot, const std::size_t operandStackSize) {
+    if (number.isConstant() || number.isLoopVariable()) {
+        instructions.emplace_back(number.isConstant() ? Instruction{.opcode = Opcode::PushConstant, .operand = getValueOfConstant(number)} : Instruction{.opcode = Opcode::PushLoopVariable, .operand = getOrAddLoopVariableSlot(number.variableName(), identifierPerLoopVariableSlot)});
+        maxOperandStackSize = std::max(maxOperandStackSize, operandStackSize + 1U);
+        return true;
+    }
+    if (!number.isConstantExpression()) {
+        return false;
+    }
+
+    const Number::ConstantExpression constantExpression = *number.constantExpression();
+    if (constantExpression.lhsOperand == nullptr || constantExpression.rhsOperand == nullptr || !lowerToInstructions(*constantExpression.lhsOperand, identifierPerLoopVariableSlot, operandStackSize) || !lowerToInstructions(*constantExpression.rhsOperand, identifierPerLoopVariableSlot, operandStackSize + 1U)) {
+        return false;
+    }
+
+    switch (constantExpression.operation) {
+        case Number::ConstantExpression::Operation::Addition:
+            instructions.emplace_back(Instruction{.opcode = Opcode::Add, .operand = 0U});
+            return true;
+        case Number::ConstantExpression::Operation::Subtraction:
+            instructions.emplace_back(Instruction{.opcode = Opcode::Subtract, .operand = 0U});
+            return true;
+        case Number::ConstantExpression::Operation::Multiplication:
+            instructions.emplace_back(Instruction{.opcode = Opcode::Multiply, .operand = 0U});
+            return true;
+        case Number::ConstantExpression::Operation::Division:
+            instructions.emplace_back(Instruction{.opcode = Opcode::Divide, .operand = 0U});
+            return true;
+    }
+    return false;
+}
+
+std::size_t CompiledNumberEvaluator::getLoopVariableSlot(const std::string& loopVariableIdentifier) {
+    const std::size_t loopVariableSlot = getOrAddLoopVariableSlot(loopVariableIdentifier, identifierPerLoopVariableSlot);
+    valuePerLoopVariableSlot.resize(identifierPerLoopVariableSlot.size());
+    return loopVariableSlot;
+}
+
+std::vector<std::optional<unsigned>> CompiledNumberEvaluator::exchangeLoopVariableValues(std::vector<std::optional<unsigned>> values) {
+    values.resize(identifierPerLoopVariableSlot.size());
+    return std::exchange(valuePerLoopVariableSlot, std::move(values));
+}
+
+std::optional<unsigned> CompiledNumberEvaluator::tryEvaluate(const Number::ptr& number) {
+    if (number == nullptr) {
+        return std::nullopt;
+    }
+    // Constants are not lowered since numbers storing a constant are frequently created during the synthesis (e.g. by compile time simplifications of expressions) and would otherwise grow the cache of compiled numbers.
+    if (number->isConstant()) {
+        return getValueOfConstant(*number);
+    }
+
+    auto compiledNumber = compiledNumbers.find(number.get());
+    if (compiledNumber == compiledNumbers.end()) {
+        compiledNumber = compiledNumbers.try_emplace(number.get(), number, CompiledNumber(*number, identifierPerLoopVariableSlot)).first;
+        valuePerLoopVariableSlot.resize(identifierPerLoopVariableSlot.size());
+    }
+    return compiledNumber->second.second.tryEvaluate(valuePerLoopVariableSlot);
+}
+
+void CompiledNumberEvaluator::clear() {
+    identifierPerLoopVariableSlot.clear();
+    valuePerLoopVariableSlot.clear();
+    compiledNumbers.clear();
+}
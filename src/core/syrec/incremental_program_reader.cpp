@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/syrec/incremental_program_reader.hpp"
+
+#include "core/configurable_options.hpp"
+#include "core/statistics.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/parser/utils/ascii_char_stream_view.hpp"
+#include "core/syrec/parser/utils/symbolTable/base_symbol_table.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace {
+    using ResolvedCallTarget = std::pair<std::shared_ptr<syrec::Module>*, syrec::Module::ptr>;
+
+    [[nodiscard]] std::size_t countLines(const std::string_view& text) {
+        return static_cast<std::size_t>(std::count(text.cbegin(), text.cend(), '\n'));
+    }
+
+    void shiftLineNumbersOfStatements(const syrec::Statement::vec& statements, const std::ptrdiff_t lineOffset) {
+        for (const syrec::Statement::ptr& statement: statements) {
+            statement->lineNumber = static_cast<unsigned>(static_cast<std::ptrdiff_t>(statement->lineNumber) + lineOffset);
+            if (const auto* ifStatement = syrec::statementCast<syrec::IfStatement>(statement.get()); ifStatement != nullptr) {
+                shiftLineNumbersOfStatements(ifStatement->thenStatements, lineOffset);
+                shiftLineNumbersOfStatements(ifStatement->elseStatements, lineOffset);
+            } else if (const auto* forStatement = syrec::statementCast<syrec::ForStatement>(statement.get()); forStatement != nullptr) {
+                shiftLineNumbersOfStatements(forStatement->statements, lineOffset);
+            }
+        }
+    }
+
+    [[nodiscard]] syrec::Variable::ptr findVariableOfModule(const syrec::Module& module, const std::string& variableIdentifier) {
+        for (const syrec::Variable::vec* variables: {&module.parameters, &module.variables}) {
+            if (const auto matchingVariable = std::find_if(variables->cbegin(), variables->cend(), [&variableIdentifier](const syrec::Variable::ptr& variable) { return variable->name == variableIdentifier; }); matchingVariable != variables->cend()) {
+                return *matchingVariable;
+            }
+        }
+        return nullptr;
+    }
+
+    [[nodiscard]] bool resolveCallTarget(std::shared_ptr<syrec::Module>& target, const std::vector<std::string>& callerArgumentIdentifiers, const syrec::Module& callingModule, const utils::BaseSymbolTable& symbolTable, const std::string& programEntryPointModuleIdentifier, std::vector<ResolvedCallTarget>& resolvedCallTargets) {
+        if (target == nullptr) {
+            return false;
+        }
+
+        syrec::Variable::vec callerArguments;
+        callerArguments.reserve(callerArgumentIdentifiers.size());
+        for (const std::string& callerArgumentIdentifier: callerArgumentIdentifiers) {
+            syrec::Variable::ptr callerArgument = findVariableOfModule(callingModule, callerArgumentIdentifier);
+            if (callerArgument == nullptr) {
+                return false;
+            }
+            callerArguments.emplace_back(std::move(callerArgument));
+        }
+
+        // Calls of the program entry point are reported as errors by the parser, which are only recorded by a full parse of the program.
+        const utils::BaseSymbolTable::ModuleOverloadResolutionResult overloadResolutionResult = symbolTable.getModulesMatchingSignature(target->name, callerArguments);
+        if (overloadResolutionResult.resolutionResult != utils::BaseSymbolTable::ModuleOverloadResolutionResult::Result::SingleMatchFound || !overloadResolutionResult.moduleMatchingSignature.has_value() || overloadResolutionResult.moduleMatchingSignature->get()->name == programEntryPointModuleIdentifier) {
+            return false;
+        }
+        resolvedCallTargets.emplace_back(&target, *overloadResolutionResult.moduleMatchingSignature);
+        return true;
+    }
+
+    [[nodiscard]] bool resolveCallTargetsOfStatements(const syrec::Statement::vec& statements, const syrec::Module& callingModule, const utils::BaseSymbolTable& symbolTable, const std::string& programEntryPointModuleIdentifier, std::vector<ResolvedCallTarget>& resolvedCallTargets) {
+        return std::all_of(statements.cbegin(), statements.cend(), [&](const syrec::Statement::ptr& statement) {
+            if (const auto* ifStatement = syrec::statementCast<syrec::IfStatement>(statement.get()); ifStatement != nullptr) {
+                return resolveCallTargetsOfStatements(ifStatement->thenStatements, callingModule, symbolTable, programEntryPointModuleIdentifier, resolvedCallTargets) && resolveCallTargetsOfStatements(ifStatement->elseStatements, callingModule, symbolTable, programEntryPointModuleIdentifier, resolvedCallTargets);
+            }
+            if (const auto* forStatement = syrec::statementCast<syrec::ForStatement>(statement.get()); forStatement != nullptr) {
+                return resolveCallTargetsOfStatements(forStatement->statements, callingModule, symbolTable, programEntryPointModuleIdentifier, resolvedCallTargets);
+            }
+            if (auto* callStatement = syrec::statementCast<syrec::CallStatement>(statement.get()); callStatement != nullptr) {
+                return resolveCallTarget(callStatement->target, callStatement->parameters, callingModule, symbolTable, programEntryPointModuleIdentifier, resolvedCallTargets);
+            }
+            if (auto* uncallStatement = syrec::statementCast<syrec::UncallStatement>(statement.get()); uncallStatement != nullptr) {
+                return resolveCallTarget(uncallStatement->target, uncallStatement->parameters, callingModule, symbolTable, programEntryPointModuleIdentifier, resolvedCallTargets);
+            }
+            return true;
+        });
+    }
+} // namespace
+
+namespace syrec {
+    std::string IncrementalProgramReader::readFromString(Program& program, const std::string_view& stringifiedProgram, const ConfigurableOptions& settings, Statistics* optionalRecordedStatistics) {
+        wasLastReadPerformedIncrementally = false;
+        if (!syrec_parser::AsciiCharStreamView::isAsciiText(stringifiedProgram)) {
+            return readFully(program, stringifiedProgram, std::nullopt, settings, optionalRecordedStatistics);
+        }
+
+        const std::optional<std::vector<std::size_t>> offsetsOfModuleDeclarations = reader.findOffsetsOfModuleDeclarations(stringifiedProgram);
+        if (!offsetsOfModuleDeclarations.has_value() || offsetsOfModuleDeclarations->empty()) {
+            return readFully(program, stringifiedProgram, std::nullopt, settings, optionalRecordedStatistics);
+        }
+
+        const std::vector<std::string_view> moduleDeclarations = ProgramReader::splitIntoModuleDeclarations(stringifiedProgram, *offsetsOfModuleDeclarations);
+        // The modules reachable from the program entry point can only be determined by a full parse of the program.
+        if (!settings.pruneModulesNotReachableFromProgramEntryPoint && parserRelevantOptionsOfLastRead == getParserRelevantOptions(settings) && tryReadIncrementally(program, stringifiedProgram, moduleDeclarations, settings, optionalRecordedStatistics)) {
+            wasLastReadPerformedIncrementally = true;
+            return {};
+        }
+        return readFully(program, stringifiedProgram, moduleDeclarations, settings, optionalRecordedStatistics);
+    }
+
+    void IncrementalProgramReader::reset() {
+        parserRelevantOptionsOfLastRead.reset();
+        moduleDeclarationsOfLastRead.clear();
+    }
+
+    IncrementalProgramReader::ParserRelevantOptions IncrementalProgramReader::getParserRelevantOptions(const ConfigurableOptions& settings) {
+        return ParserRelevantOptions{settings.defaultBitwidth, settings.integerConstantTruncationOperation, settings.allowAccessOnAssignedToVariablePartsInDimensionAccessOfVariableAccess, settings.optionalProgramEntryPointModuleIdentifier, settings.allocateIrNodesInArena, settings.optionalMaxNumReportedParserErrors};
+    }
+
+    bool IncrementalProgramReader::tryReadIncrementally(Program& program, const std::string_view& stringifiedProgram, const std::vector<std::string_view>& moduleDeclarations, const ConfigurableOptions& settings, Statistics* optionalRecordedStatistics) {
+        // The declarations of the last read revision matching the ones at the start and end of the current revision are unchanged, every declaration in between these two ranges is re-parsed.
+        const std::size_t maxNumUnchangedDeclarations     = std::min(moduleDeclarations.size(), moduleDeclarationsOfLastRead.size());
+        std::size_t       numUnchangedLeadingDeclarations = 0;
+        while (numUnchangedLeadingDeclarations < maxNumUnchangedDeclarations && moduleDeclarations[numUnchangedLeadingDeclarations] == moduleDeclarationsOfLastRead[numUnchangedLeadingDeclarations].text) {
+            ++numUnchangedLeadingDeclarations;
+        }
+        std::size_t numUnchangedTrailingDeclarations = 0;
+        while (numUnchangedLeadingDeclarations + numUnchangedTrailingDeclarations < maxNumUnchangedDeclarations && moduleDeclarations[moduleDeclarations.size() - 1 - numUnchangedTrailingDeclarations] == moduleDeclarationsOfLastRead[moduleDeclarationsOfLastRead.size() - 1 - numUnchangedTrailingDeclarations].text) {
+            ++numUnchangedTrailingDeclarations;
+        }
+
+        const std::size_t indexOfFirstTrailingDeclarationOfLastRead = moduleDeclarationsOfLastRead.size() - numUnchangedTrailingDeclarations;
+        const std::size_t numChangedDeclarations                    = moduleDeclarations.size() - numUnchangedLeadingDeclarations - numUnchangedTrailingDeclarations;
+
+        Module::vec modulesOfUnchangedDeclarations;
+        modulesOfUnchangedDeclarations.reserve(numUnchangedLeadingDeclarations + numUnchangedTrailingDeclarations);
+        for (std::size_t i = 0; i < moduleDeclarationsOfLastRead.size(); ++i) {
+            if (i < numUnchangedLeadingDeclarations || i >= indexOfFirstTrailingDeclarationOfLastRead) {
+                modulesOfUnchangedDeclarations.emplace_back(moduleDeclarationsOfLastRead[i].module);
+            }
+        }
+
+        const auto changedDeclarationsStart = static_cast<std::size_t>(numChangedDeclarations != 0 ? moduleDeclarations[numUnchangedLeadingDeclarations].data() - stringifiedProgram.data() : 0);
+        const auto changedDeclarationsEnd   = static_cast<std::size_t>(numChangedDeclarations != 0 ? moduleDeclarations[numUnchangedLeadingDeclarations + numChangedDeclarations - 1].data() - stringifiedProgram.data() + moduleDeclarations[numUnchangedLeadingDeclarations + numChangedDeclarations - 1].size() : 0);
+        Program   programOfChangedDeclarations;
+        if (numChangedDeclarations != 0) {
+            // The changed declarations are prefixed with whitespace to retain the positions of their tokens (and thus the line numbers of their statements) in the whole program.
+            const std::string_view textPrecedingChangedDeclarations = stringifiedProgram.substr(0, changedDeclarationsStart);
+            const std::size_t      endOfPrecedingLine               = textPrecedingChangedDeclarations.rfind('\n');
+            const std::size_t      startOfLineOfChangedDeclarations = endOfPrecedingLine == std::string_view::npos ? 0 : endOfPrecedingLine + 1;
+            std::string            paddedChangedDeclarations(countLines(textPrecedingChangedDeclarations), '\n');
+            paddedChangedDeclarations.append(changedDeclarationsStart - startOfLineOfChangedDeclarations, ' ');
+            paddedChangedDeclarations.append(stringifiedProgram.substr(changedDeclarationsStart, changedDeclarationsEnd - changedDeclarationsStart));
+
+            if (!reader.readProgramFromContent(programOfChangedDeclarations, paddedChangedDeclarations, "", settings, optionalRecordedStatistics, modulesOfUnchangedDeclarations).empty() || programOfChangedDeclarations.modules().size() != numChangedDeclarations) {
+                return false;
+            }
+        } else if (optionalRecordedStatistics != nullptr) {
+            optionalRecordedStatistics->parsingRuntimeInNanoseconds       = 0;
+            optionalRecordedStatistics->semanticCheckRuntimeInNanoseconds = 0;
+        }
+
+        Module::vec updatedModules;
+        updatedModules.reserve(moduleDeclarations.size());
+        updatedModules.insert(updatedModules.end(), modulesOfUnchangedDeclarations.cbegin(), std::next(modulesOfUnchangedDeclarations.cbegin(), static_cast<std::ptrdiff_t>(numUnchangedLeadingDeclarations)));
+        updatedModules.insert(updatedModules.end(), programOfChangedDeclarations.modules().cbegin(), programOfChangedDeclarations.modules().cend());
+        updatedModules.insert(updatedModules.end(), std::next(modulesOfUnchangedDeclarations.cbegin(), static_cast<std::ptrdiff_t>(numUnchangedLeadingDeclarations)), modulesOfUnchangedDeclarations.cend());
+
+        // Both the parsed declarations and a full parse of the program select the same program entry point only if its identifier is unique in the program.
+        const std::string programEntryPointModuleIdentifier = settings.optionalProgramEntryPointModuleIdentifier.value_or("main");
+        if (std::count_if(updatedModules.cbegin(), updatedModules.cend(), [&programEntryPointModuleIdentifier](const Module::ptr& module) { return module->name == programEntryPointModuleIdentifier; }) != 1) {
+            return false;
+        }
+
+        utils::BaseSymbolTable symbolTable;
+        for (const Module::ptr& module: updatedModules) {
+            if (!symbolTable.insertModule(module)) {
+                return false;
+            }
+        }
+
+        // The callees of the unchanged modules could have been replaced or their signatures changed, thus the overload resolution of their calls is repeated for the updated program.
+        std::vector<ResolvedCallTarget> resolvedCallTargets;
+        for (const Module::ptr& module: modulesOfUnchangedDeclarations) {
+            if (!resolveCallTargetsOfStatements(module->statements, *module, symbolTable, programEntryPointModuleIdentifier, resolvedCallTargets)) {
+                return false;
+            }
+        }
+        for (auto& [target, resolvedTarget]: resolvedCallTargets) {
+            *target = std::move(resolvedTarget);
+        }
+
+        if (numUnchangedTrailingDeclarations != 0) {
+            const std::size_t    indexOfFirstTrailingDeclaration       = moduleDeclarations.size() - numUnchangedTrailingDeclarations;
+            const std::size_t    numLinesPrecedingTrailingDeclarations = countLines(stringifiedProgram.substr(0, static_cast<std::size_t>(moduleDeclarations[indexOfFirstTrailingDeclaration].data() - stringifiedProgram.data())));
+            const std::ptrdiff_t lineOffset                            = static_cast<std::ptrdiff_t>(numLinesPrecedingTrailingDeclarations) - static_cast<std::ptrdiff_t>(moduleDeclarationsOfLastRead[indexOfFirstTrailingDeclarationOfLastRead].numPrecedingLines);
+            if (lineOffset != 0) {
+                for (std::size_t i = indexOfFirstTrailingDeclarationOfLastRead; i < moduleDeclarationsOfLastRead.size(); ++i) {
+                    shiftLineNumbersOfStatements(moduleDeclarationsOfLastRead[i].module->statements, lineOffset);
+                }
+            }
+        }
+
+        numParsedModulesOfLastRead = numChangedDeclarations;
+        recordModuleDeclarations(moduleDeclarations, updatedModules);
+        program = Program();
+        for (const Module::ptr& module: updatedModules) {
+            program.addModule(module);
+        }
+        return true;
+    }
+
+    std::string IncrementalProgramReader::readFully(Program& program, const std::string_view& stringifiedProgram, const std::optional<std::vector<std::string_view>>& moduleDeclarations, const ConfigurableOptions& settings, Statistics* optionalRecordedStatistics) {
+        reset();
+        Program     parsedProgram;
+        std::string foundErrors    = reader.readFromString(parsedProgram, stringifiedProgram, settings, optionalRecordedStatistics);
+        numParsedModulesOfLastRead = parsedProgram.modules().size();
+        if (!foundErrors.empty()) {
+            return foundErrors;
+        }
+
+        // Only the revisions whose modules can be mapped to their declarations are used as the basis for successive incremental reads.
+        if (moduleDeclarations.has_value() && moduleDeclarations->size() == parsedProgram.modules().size()) {
+            parserRelevantOptionsOfLastRead = getParserRelevantOptions(settings);
+            recordModuleDeclarations(*moduleDeclarations, parsedProgram.modules());
+        }
+        program = std::move(parsedProgram);
+        return foundErrors;
+    }
+
+    void IncrementalProgramReader::recordModuleDeclarations(const std::vector<std::string_view>& moduleDeclarations, const Module::vec& modules) {
+        std::vector<ModuleDeclaration> recordedModuleDeclarations;
+        recordedModuleDeclarations.reserve(moduleDeclarations.size());
+        std::size_t numPrecedingLines = 0;
+        for (std::size_t i = 0; i < moduleDeclarations.size(); ++i) {
+            recordedModuleDeclarations.emplace_back(ModuleDeclaration{std::string(moduleDeclarations[i]), numPrecedingLines, modules[i]});
+            numPrecedingLines += countLines(moduleDeclarations[i]);
+        }
+        moduleDeclarationsOfLastRead = std::move(recordedModuleDeclarations);
+    }
+} // namespace syrec
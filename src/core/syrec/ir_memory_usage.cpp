@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/syrec/ir_memory_usage.hpp"
+
+#include "core/memory_accounting.hpp"
+#include "core/syrec/expression.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/number.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+using namespace syrec;
+using namespace syrec::memory_accounting;
+
+namespace {
+    class IrMemoryUsageEstimator {
+    public:
+        [[nodiscard]] std::size_t getNumBytes() const noexcept {
+            return numBytes;
+        }
+
+        void countModules(const Module::vec& modules) {
+            numBytes += numBytesOfHeapStorage(modules);
+            for (const Module::ptr& module: modules) {
+                countModule(module);
+            }
+        }
+
+    private:
+        std::size_t                     numBytes = 0;
+        std::unordered_set<const void*> countedSharedNodes;
+
+        // Returns whether the shared node was not counted yet, in which case the size of the node and of the control block of its std::shared_ptr is counted.
+        template<typename T>
+        [[nodiscard]] bool countSharedNodeOnce(const T* node) {
+            if (node == nullptr || !countedSharedNodes.emplace(node).second) {
+                return false;
+            }
+            numBytes += sizeof(T) + NUM_BYTES_OF_SHARED_POINTER_CONTROL_BLOCK;
+            return true;
+        }
+
+        void countModule(const Module::ptr& module) {
+            if (!countSharedNodeOnce(module.get())) {
+                return;
+            }
+            numBytes += numBytesOfHeapStorage(module->name) + numBytesOfHeapStorage(module->parameters) + numBytesOfHeapStorage(module->variables);
+            for (const Variable::vec* declaredVariables: {&module->parameters, &module->variables}) {
+                for (const Variable::ptr& declaredVariable: *declaredVariables) {
+                    countVariable(declaredVariable);
+                }
+            }
+            countStatements(module->statements);
+        }
+
+        void countVariable(const Variable::ptr& variable) {
+            if (countSharedNodeOnce(variable.get())) {
+                numBytes += numBytesOfHeapStorage(variable->name) + numBytesOfHeapStorage(variable->dimensions);
+            }
+        }
+
+        void countNumber(const Number::ptr& number) {
+            if (!countSharedNodeOnce(number.get())) {
+                return;
+            }
+            if (number->isLoopVariable()) {
+                numBytes += numBytesOfHeapStorage(number->variableName());
+            } else if (number->isConstantExpression()) {
+                const std::optional<Number::ConstantExpression> constantExpression = number->constantExpression();
+                countNumber(constantExpression->lhsOperand);
+                countNumber(constantExpression->rhsOperand);
+            }
+        }
+
+        void countVariableAccess(const VariableAccess::ptr& variableAccess) {
+            if (!countSharedNodeOnce(variableAccess.get())) {
+                return;
+            }
+            countVariable(variableAccess->var);
+            if (variableAccess->range.has_value()) {
+                countNumber(variableAccess->range->first);
+                countNumber(variableAccess->range->second);
+            }
+            numBytes += numBytesOfHeapStorage(variableAccess->indexes);
+            for (const Expression::ptr& index: variableAccess->indexes) {
+                countExpression(index);
+            }
+        }
+
+        void countExpression(const Expression::ptr& expression) {
+            if (expression == nullptr) {
+                return;
+            }
+            if (const auto* numericExpression = expressionCast<NumericExpression>(expression.get()); numericExpression != nullptr) {
+                if (countSharedNodeOnce(numericExpression)) {
+                    countNumber(numericExpression->value);
+                }
+            } else if (const auto* variableExpression = expressionCast<VariableExpression>(expression.get()); variableExpression != nullptr) {
+                if (countSharedNodeOnce(variableExpression)) {
+                    countVariableAccess(variableExpression->var);
+                }
+            } else if (const auto* binaryExpression = expressionCast<BinaryExpression>(expression.get()); binaryExpression != nullptr) {
+                if (countSharedNodeOnce(binaryExpression)) {
+                    countExpression(binaryExpression->lhs);
+                    countExpression(binaryExpression->rhs);
+                }
+            } else if (const auto* shiftExpression = expressionCast<ShiftExpression>(expression.get()); shiftExpression != nullptr) {
+                if (countSharedNodeOnce(shiftExpression)) {
+                    countExpression(shiftExpression->lhs);
+                    countNumber(shiftExpression->rhs);
+                }
+            } else if (const auto* unaryExpression = expressionCast<UnaryExpression>(expression.get()); unaryExpression != nullptr) {
+                if (countSharedNodeOnce(unaryExpression)) {
+                    countExpression(unaryExpression->expr);
+                }
+            }
+        }
+
+        void countStatements(const Statement::vec& statements) {
+            numBytes += numBytesOfHeapStorage(statements);
+            for (const Statement::ptr& statement: statements) {
+                countStatement(statement);
+            }
+        }
+
+        void countCalledModule(const Module::ptr& calledModule, const std::vector<std::string>& callerArguments) {
+            countModule(calledModule);
+            numBytes += numBytesOfHeapStorage(callerArguments);
+            for (const std::string& callerArgument: callerArguments) {
+                numBytes += numBytesOfHeapStorage(callerArgument);
+            }
+        }
+
+        void countStatement(const Statement::ptr& statement) {
+            if (statement == nullptr) {
+                return;
+            }
+            if (const auto* skipStatement = statementCast<SkipStatement>(statement.get()); skipStatement != nullptr) {
+                static_cast<void>(countSharedNodeOnce(skipStatement));
+            } else if (const auto* swapStatement = statementCast<SwapStatement>(statement.get()); swapStatement != nullptr) {
+                if (countSharedNodeOnce(swapStatement)) {
+                    countVariableAccess(swapStatement->lhs);
+                    countVariableAccess(swapStatement->rhs);
+                }
+            } else if (const auto* unaryStatement = statementCast<UnaryStatement>(statement.get()); unaryStatement != nullptr) {
+                if (countSharedNodeOnce(unaryStatement)) {
+                    countVariableAccess(unaryStatement->var);
+                }
+            } else if (const auto* assignStatement = statementCast<AssignStatement>(statement.get()); assignStatement != nullptr) {
+                if (countSharedNodeOnce(assignStatement)) {
+                    countVariableAccess(assignStatement->lhs);
+                    countExpression(assignStatement->rhs);
+                }
+            } else if (const auto* ifStatement = statementCast<IfStatement>(statement.get()); ifStatement != nullptr) {
+                if (countSharedNodeOnce(ifStatement)) {
+                    countExpression(ifStatement->condition);
+                    countStatements(ifStatement->thenStatements);
+                    countStatements(ifStatement->elseStatements);
+                    countExpression(ifStatement->fiCondition);
+                }
+            } else if (const auto* forStatement = statementCast<ForStatement>(statement.get()); forStatement != nullptr) {
+                if (countSharedNodeOnce(forStatement)) {
+                    numBytes += numBytesOfHeapStorage(forStatement->loopVariable);
+                    countNumber(forStatement->range.first);
+                    countNumber(forStatement->range.second);
+                    countNumber(forStatement->step);
+                    countStatements(forStatement->statements);
+                }
+            } else if (const auto* callStatement = statementCast<CallStatement>(statement.get()); callStatement != nullptr) {
+                if (countSharedNodeOnce(callStatement)) {
+                    countCalledModule(callStatement->target, callStatement->parameters);
+                }
+            } else if (const auto* uncallStatement = statementCast<UncallStatement>(statement.get()); uncallStatement != nullptr) {
+                if (countSharedNodeOnce(uncallStatement)) {
+                    countCalledModule(uncallStatement->target, uncallStatement->parameters);
+                }
+            }
+        }
+    };
+} // namespace
+
+std::size_t syrec::determineNumBytesOfIr(const Module::vec& modules) {
+    IrMemoryUsageEstimator estimator;
+    estimator.countModules(modules);
+    return estimator.getNumBytes();
+}
@@ -96,12 +96,11 @@ namespace {
         // errors in a user provided .syrec file using the generated syntax error messages of the lexer/parser.
         auto staticData = std::make_unique<TSyrecParserStaticData>(
                 std::vector<std::string>{
-                        "number", "program", "module", "parameterList", "parameter", "signalList",
-                        "signalDeclaration", "statementList", "statement", "callStatement",
+                        "number", "atomicNumber", "program", "module", "parameterList", "parameter",
+                        "signalList", "signalDeclaration", "statementList", "statement", "callStatement",
                         "loopVariableDefinition", "loopStepsizeDefinition", "forStatement",
                         "ifStatement", "unaryStatement", "assignStatement", "swapStatement",
-                        "skipStatement", "signal", "expression", "binaryExpression", "unaryExpression",
-                        "shiftExpression"},
+                        "skipStatement", "signal", "expression", "binaryExpression", "unaryExpression"},
                 std::vector<std::string>{
                         "", "'++='", "'--='", "'~='", "'+='", "'-='", "'^='", "'+'", "'-'",
                         "'*'", "'*>'", "'/'", "'%'", "'<<'", "'>>'", "'<=>'", "'>='", "'<='",
@@ -127,83 +126,81 @@ namespace {
                         "BITRANGE_END_PREFIX", "SKIPABLEWHITSPACES", "LINE_COMMENT", "MULTI_LINE_COMMENT",
                         "IDENT", "HEX_LITERAL", "BINARY_LITERAL", "INT"});
         // Auto-generated constants that should not be changed except for when changes in the TSyrecParser.g4 file were made
-        static std::array<int32_t, 2064> serializedATNSegment = {
+        static std::array<int32_t, 2068> serializedATNSegment = {
                 4, 1, 63, 237, 2, 0, 7, 0, 2, 1, 7, 1, 2, 2, 7, 2, 2, 3, 7, 3, 2, 4, 7, 4, 2, 5, 7, 5, 2, 6, 7, 6, 2,
                 7, 7, 7, 2, 8, 7, 8, 2, 9, 7, 9, 2, 10, 7, 10, 2, 11, 7, 11, 2, 12, 7, 12, 2, 13, 7, 13, 2, 14, 7,
-                14, 2, 15, 7, 15, 2, 16, 7, 16, 2, 17, 7, 17, 2, 18, 7, 18, 2, 19, 7, 19, 2, 20, 7, 20, 2, 21, 7,
-                21, 2, 22, 7, 22, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 3, 0,
-                60, 8, 0, 1, 1, 4, 1, 63, 8, 1, 11, 1, 12, 1, 64, 1, 1, 1, 1, 1, 2, 1, 2, 1, 2, 1, 2, 3, 2, 73, 8, 2,
-                1, 2, 1, 2, 5, 2, 77, 8, 2, 10, 2, 12, 2, 80, 9, 2, 1, 2, 1, 2, 1, 3, 1, 3, 1, 3, 5, 3, 87, 8, 3, 10,
-                3, 12, 3, 90, 9, 3, 1, 4, 1, 4, 1, 4, 1, 5, 1, 5, 1, 5, 1, 5, 5, 5, 99, 8, 5, 10, 5, 12, 5, 102, 9,
-                5, 1, 6, 1, 6, 1, 6, 1, 6, 5, 6, 108, 8, 6, 10, 6, 12, 6, 111, 9, 6, 1, 6, 1, 6, 1, 6, 3, 6, 116, 8,
-                6, 1, 7, 1, 7, 1, 7, 5, 7, 121, 8, 7, 10, 7, 12, 7, 124, 9, 7, 1, 8, 1, 8, 1, 8, 1, 8, 1, 8, 1, 8, 1,
-                8, 3, 8, 133, 8, 8, 1, 9, 1, 9, 1, 9, 1, 9, 1, 9, 1, 9, 5, 9, 141, 8, 9, 10, 9, 12, 9, 144, 9, 9, 1,
-                9, 1, 9, 1, 10, 1, 10, 1, 10, 1, 10, 1, 11, 1, 11, 3, 11, 154, 8, 11, 1, 11, 1, 11, 1, 12, 1, 12,
-                3, 12, 160, 8, 12, 1, 12, 1, 12, 1, 12, 3, 12, 165, 8, 12, 1, 12, 1, 12, 3, 12, 169, 8, 12, 1,
-                12, 1, 12, 1, 12, 1, 12, 1, 13, 1, 13, 1, 13, 1, 13, 1, 13, 1, 13, 1, 13, 1, 13, 1, 13, 1, 14, 1,
-                14, 1, 14, 1, 15, 1, 15, 1, 15, 1, 15, 1, 16, 1, 16, 1, 16, 1, 16, 1, 17, 1, 17, 1, 18, 1, 18, 1,
-                18, 1, 18, 1, 18, 5, 18, 202, 8, 18, 10, 18, 12, 18, 205, 9, 18, 1, 18, 1, 18, 1, 18, 1, 18, 3,
-                18, 211, 8, 18, 3, 18, 213, 8, 18, 1, 19, 1, 19, 1, 19, 1, 19, 1, 19, 3, 19, 220, 8, 19, 1, 20,
-                1, 20, 1, 20, 1, 20, 1, 20, 1, 20, 1, 21, 1, 21, 1, 21, 1, 22, 1, 22, 1, 22, 1, 22, 1, 22, 1, 22,
-                1, 22, 0, 0, 23, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40,
-                42, 44, 0, 9, 2, 0, 7, 9, 11, 11, 1, 0, 31, 33, 1, 0, 34, 35, 1, 0, 29, 30, 1, 0, 1, 3, 1, 0, 4, 6,
-                4, 0, 7, 12, 16, 23, 25, 25, 27, 28, 2, 0, 24, 24, 26, 26, 1, 0, 13, 14, 244, 0, 59, 1, 0, 0, 0,
-                2, 62, 1, 0, 0, 0, 4, 68, 1, 0, 0, 0, 6, 83, 1, 0, 0, 0, 8, 91, 1, 0, 0, 0, 10, 94, 1, 0, 0, 0, 12,
-                103, 1, 0, 0, 0, 14, 117, 1, 0, 0, 0, 16, 132, 1, 0, 0, 0, 18, 134, 1, 0, 0, 0, 20, 147, 1, 0, 0,
-                0, 22, 151, 1, 0, 0, 0, 24, 157, 1, 0, 0, 0, 26, 174, 1, 0, 0, 0, 28, 183, 1, 0, 0, 0, 30, 186,
-                1, 0, 0, 0, 32, 190, 1, 0, 0, 0, 34, 194, 1, 0, 0, 0, 36, 196, 1, 0, 0, 0, 38, 219, 1, 0, 0, 0, 40,
-                221, 1, 0, 0, 0, 42, 227, 1, 0, 0, 0, 44, 230, 1, 0, 0, 0, 46, 60, 5, 61, 0, 0, 47, 60, 5, 62, 0,
-                0, 48, 60, 5, 63, 0, 0, 49, 50, 5, 37, 0, 0, 50, 60, 5, 60, 0, 0, 51, 52, 5, 36, 0, 0, 52, 60, 5,
-                60, 0, 0, 53, 54, 5, 40, 0, 0, 54, 55, 3, 0, 0, 0, 55, 56, 7, 0, 0, 0, 56, 57, 3, 0, 0, 0, 57, 58,
-                5, 41, 0, 0, 58, 60, 1, 0, 0, 0, 59, 46, 1, 0, 0, 0, 59, 47, 1, 0, 0, 0, 59, 48, 1, 0, 0, 0, 59, 49,
-                1, 0, 0, 0, 59, 51, 1, 0, 0, 0, 59, 53, 1, 0, 0, 0, 60, 1, 1, 0, 0, 0, 61, 63, 3, 4, 2, 0, 62, 61,
-                1, 0, 0, 0, 63, 64, 1, 0, 0, 0, 64, 62, 1, 0, 0, 0, 64, 65, 1, 0, 0, 0, 65, 66, 1, 0, 0, 0, 66, 67,
-                5, 0, 0, 1, 67, 3, 1, 0, 0, 0, 68, 69, 5, 44, 0, 0, 69, 70, 5, 60, 0, 0, 70, 72, 5, 40, 0, 0, 71,
-                73, 3, 6, 3, 0, 72, 71, 1, 0, 0, 0, 72, 73, 1, 0, 0, 0, 73, 74, 1, 0, 0, 0, 74, 78, 5, 41, 0, 0, 75,
-                77, 3, 10, 5, 0, 76, 75, 1, 0, 0, 0, 77, 80, 1, 0, 0, 0, 78, 76, 1, 0, 0, 0, 78, 79, 1, 0, 0, 0, 79,
-                81, 1, 0, 0, 0, 80, 78, 1, 0, 0, 0, 81, 82, 3, 14, 7, 0, 82, 5, 1, 0, 0, 0, 83, 88, 3, 8, 4, 0, 84,
-                85, 5, 39, 0, 0, 85, 87, 3, 8, 4, 0, 86, 84, 1, 0, 0, 0, 87, 90, 1, 0, 0, 0, 88, 86, 1, 0, 0, 0, 88,
-                89, 1, 0, 0, 0, 89, 7, 1, 0, 0, 0, 90, 88, 1, 0, 0, 0, 91, 92, 7, 1, 0, 0, 92, 93, 3, 12, 6, 0, 93,
-                9, 1, 0, 0, 0, 94, 95, 7, 2, 0, 0, 95, 100, 3, 12, 6, 0, 96, 97, 5, 39, 0, 0, 97, 99, 3, 12, 6, 0,
-                98, 96, 1, 0, 0, 0, 99, 102, 1, 0, 0, 0, 100, 98, 1, 0, 0, 0, 100, 101, 1, 0, 0, 0, 101, 11, 1,
-                0, 0, 0, 102, 100, 1, 0, 0, 0, 103, 109, 5, 60, 0, 0, 104, 105, 5, 42, 0, 0, 105, 106, 5, 63,
-                0, 0, 106, 108, 5, 43, 0, 0, 107, 104, 1, 0, 0, 0, 108, 111, 1, 0, 0, 0, 109, 107, 1, 0, 0, 0,
-                109, 110, 1, 0, 0, 0, 110, 115, 1, 0, 0, 0, 111, 109, 1, 0, 0, 0, 112, 113, 5, 40, 0, 0, 113,
-                114, 5, 63, 0, 0, 114, 116, 5, 41, 0, 0, 115, 112, 1, 0, 0, 0, 115, 116, 1, 0, 0, 0, 116, 13,
-                1, 0, 0, 0, 117, 122, 3, 16, 8, 0, 118, 119, 5, 38, 0, 0, 119, 121, 3, 16, 8, 0, 120, 118, 1,
-                0, 0, 0, 121, 124, 1, 0, 0, 0, 122, 120, 1, 0, 0, 0, 122, 123, 1, 0, 0, 0, 123, 15, 1, 0, 0, 0,
-                124, 122, 1, 0, 0, 0, 125, 133, 3, 18, 9, 0, 126, 133, 3, 24, 12, 0, 127, 133, 3, 26, 13, 0,
-                128, 133, 3, 28, 14, 0, 129, 133, 3, 30, 15, 0, 130, 133, 3, 32, 16, 0, 131, 133, 3, 34, 17,
-                0, 132, 125, 1, 0, 0, 0, 132, 126, 1, 0, 0, 0, 132, 127, 1, 0, 0, 0, 132, 128, 1, 0, 0, 0, 132,
-                129, 1, 0, 0, 0, 132, 130, 1, 0, 0, 0, 132, 131, 1, 0, 0, 0, 133, 17, 1, 0, 0, 0, 134, 135, 7,
-                3, 0, 0, 135, 136, 5, 60, 0, 0, 136, 137, 5, 40, 0, 0, 137, 142, 5, 60, 0, 0, 138, 139, 5, 39,
-                0, 0, 139, 141, 5, 60, 0, 0, 140, 138, 1, 0, 0, 0, 141, 144, 1, 0, 0, 0, 142, 140, 1, 0, 0, 0,
-                142, 143, 1, 0, 0, 0, 143, 145, 1, 0, 0, 0, 144, 142, 1, 0, 0, 0, 145, 146, 5, 41, 0, 0, 146,
-                19, 1, 0, 0, 0, 147, 148, 5, 36, 0, 0, 148, 149, 5, 60, 0, 0, 149, 150, 5, 20, 0, 0, 150, 21,
-                1, 0, 0, 0, 151, 153, 5, 48, 0, 0, 152, 154, 5, 8, 0, 0, 153, 152, 1, 0, 0, 0, 153, 154, 1, 0,
-                0, 0, 154, 155, 1, 0, 0, 0, 155, 156, 3, 0, 0, 0, 156, 23, 1, 0, 0, 0, 157, 164, 5, 45, 0, 0, 158,
-                160, 3, 20, 10, 0, 159, 158, 1, 0, 0, 0, 159, 160, 1, 0, 0, 0, 160, 161, 1, 0, 0, 0, 161, 162,
-                3, 0, 0, 0, 162, 163, 5, 47, 0, 0, 163, 165, 1, 0, 0, 0, 164, 159, 1, 0, 0, 0, 164, 165, 1, 0,
-                0, 0, 165, 166, 1, 0, 0, 0, 166, 168, 3, 0, 0, 0, 167, 169, 3, 22, 11, 0, 168, 167, 1, 0, 0, 0,
-                168, 169, 1, 0, 0, 0, 169, 170, 1, 0, 0, 0, 170, 171, 5, 46, 0, 0, 171, 172, 3, 14, 7, 0, 172,
-                173, 5, 49, 0, 0, 173, 25, 1, 0, 0, 0, 174, 175, 5, 50, 0, 0, 175, 176, 3, 38, 19, 0, 176, 177,
-                5, 51, 0, 0, 177, 178, 3, 14, 7, 0, 178, 179, 5, 52, 0, 0, 179, 180, 3, 14, 7, 0, 180, 181, 5,
-                53, 0, 0, 181, 182, 3, 38, 19, 0, 182, 27, 1, 0, 0, 0, 183, 184, 7, 4, 0, 0, 184, 185, 3, 36,
-                18, 0, 185, 29, 1, 0, 0, 0, 186, 187, 3, 36, 18, 0, 187, 188, 7, 5, 0, 0, 188, 189, 3, 38, 19,
-                0, 189, 31, 1, 0, 0, 0, 190, 191, 3, 36, 18, 0, 191, 192, 5, 15, 0, 0, 192, 193, 3, 36, 18, 0,
-                193, 33, 1, 0, 0, 0, 194, 195, 5, 54, 0, 0, 195, 35, 1, 0, 0, 0, 196, 203, 5, 60, 0, 0, 197, 198,
-                5, 42, 0, 0, 198, 199, 3, 38, 19, 0, 199, 200, 5, 43, 0, 0, 200, 202, 1, 0, 0, 0, 201, 197, 1,
-                0, 0, 0, 202, 205, 1, 0, 0, 0, 203, 201, 1, 0, 0, 0, 203, 204, 1, 0, 0, 0, 204, 212, 1, 0, 0, 0,
-                205, 203, 1, 0, 0, 0, 206, 207, 5, 55, 0, 0, 207, 210, 3, 0, 0, 0, 208, 209, 5, 56, 0, 0, 209,
-                211, 3, 0, 0, 0, 210, 208, 1, 0, 0, 0, 210, 211, 1, 0, 0, 0, 211, 213, 1, 0, 0, 0, 212, 206, 1,
-                0, 0, 0, 212, 213, 1, 0, 0, 0, 213, 37, 1, 0, 0, 0, 214, 220, 3, 0, 0, 0, 215, 220, 3, 36, 18,
-                0, 216, 220, 3, 40, 20, 0, 217, 220, 3, 42, 21, 0, 218, 220, 3, 44, 22, 0, 219, 214, 1, 0, 0,
-                0, 219, 215, 1, 0, 0, 0, 219, 216, 1, 0, 0, 0, 219, 217, 1, 0, 0, 0, 219, 218, 1, 0, 0, 0, 220,
-                39, 1, 0, 0, 0, 221, 222, 5, 40, 0, 0, 222, 223, 3, 38, 19, 0, 223, 224, 7, 6, 0, 0, 224, 225,
-                3, 38, 19, 0, 225, 226, 5, 41, 0, 0, 226, 41, 1, 0, 0, 0, 227, 228, 7, 7, 0, 0, 228, 229, 3, 38,
-                19, 0, 229, 43, 1, 0, 0, 0, 230, 231, 5, 40, 0, 0, 231, 232, 3, 38, 19, 0, 232, 233, 7, 8, 0,
-                0, 233, 234, 3, 0, 0, 0, 234, 235, 5, 41, 0, 0, 235, 45, 1, 0, 0, 0, 19, 59, 64, 72, 78, 88, 100,
-                109, 115, 122, 132, 142, 153, 159, 164, 168, 203, 210, 212, 219};
+                14, 2, 15, 7, 15, 2, 16, 7, 16, 2, 17, 7, 17, 2, 18, 7, 18, 2, 19, 7, 19, 2, 20, 7, 20, 2, 21, 7, 21,
+                2, 22, 7, 22, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 3, 0, 54, 8, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 3, 1, 63, 8, 1, 1, 2, 4, 2, 66, 8, 2, 11, 2, 12, 2, 67, 1, 2, 1, 2, 1, 3, 1, 3, 1, 3, 1,
+                3, 3, 3, 76, 8, 3, 1, 3, 1, 3, 5, 3, 80, 8, 3, 10, 3, 12, 3, 83, 9, 3, 1, 3, 1, 3, 1, 4, 1, 4, 1, 4,
+                5, 4, 90, 8, 4, 10, 4, 12, 4, 93, 9, 4, 1, 5, 1, 5, 1, 5, 1, 6, 1, 6, 1, 6, 1, 6, 5, 6, 102, 8, 6,
+                10, 6, 12, 6, 105, 9, 6, 1, 7, 1, 7, 1, 7, 1, 7, 5, 7, 111, 8, 7, 10, 7, 12, 7, 114, 9, 7, 1, 7, 1,
+                7, 1, 7, 3, 7, 119, 8, 7, 1, 8, 1, 8, 1, 8, 5, 8, 124, 8, 8, 10, 8, 12, 8, 127, 9, 8, 1, 9, 1, 9, 1,
+                9, 1, 9, 1, 9, 1, 9, 1, 9, 3, 9, 136, 8, 9, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 5, 10, 144, 8,
+                10, 10, 10, 12, 10, 147, 9, 10, 1, 10, 1, 10, 1, 11, 1, 11, 1, 11, 1, 11, 1, 12, 1, 12, 3, 12, 157,
+                8, 12, 1, 12, 1, 12, 1, 13, 1, 13, 3, 13, 163, 8, 13, 1, 13, 1, 13, 1, 13, 3, 13, 168, 8, 13, 1, 13,
+                1, 13, 3, 13, 172, 8, 13, 1, 13, 1, 13, 1, 13, 1, 13, 1, 14, 1, 14, 1, 14, 1, 14, 1, 14, 1, 14, 1,
+                14, 1, 14, 1, 14, 1, 15, 1, 15, 1, 15, 1, 16, 1, 16, 1, 16, 1, 16, 1, 17, 1, 17, 1, 17, 1, 17, 1, 18,
+                1, 18, 1, 19, 1, 19, 1, 19, 1, 19, 1, 19, 5, 19, 205, 8, 19, 10, 19, 12, 19, 208, 9, 19, 1, 19, 1,
+                19, 1, 19, 1, 19, 3, 19, 214, 8, 19, 3, 19, 216, 8, 19, 1, 20, 1, 20, 1, 20, 1, 20, 3, 20, 222, 8,
+                20, 1, 21, 1, 21, 1, 21, 1, 21, 1, 21, 1, 21, 3, 21, 230, 8, 21, 1, 21, 1, 21, 1, 22, 1, 22, 1, 22,
+                1, 22, 0, 0, 23, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42,
+                44, 0, 9, 2, 0, 7, 9, 11, 11, 1, 0, 31, 33, 1, 0, 34, 35, 1, 0, 29, 30, 1, 0, 1, 3, 1, 0, 4, 6, 4, 0,
+                7, 12, 16, 23, 25, 25, 27, 28, 1, 0, 13, 14, 2, 0, 24, 24, 26, 26, 244, 0, 53, 1, 0, 0, 0, 2, 62, 1,
+                0, 0, 0, 4, 65, 1, 0, 0, 0, 6, 71, 1, 0, 0, 0, 8, 86, 1, 0, 0, 0, 10, 94, 1, 0, 0, 0, 12, 97, 1, 0,
+                0, 0, 14, 106, 1, 0, 0, 0, 16, 120, 1, 0, 0, 0, 18, 135, 1, 0, 0, 0, 20, 137, 1, 0, 0, 0, 22, 150, 1,
+                0, 0, 0, 24, 154, 1, 0, 0, 0, 26, 160, 1, 0, 0, 0, 28, 177, 1, 0, 0, 0, 30, 186, 1, 0, 0, 0, 32, 189,
+                1, 0, 0, 0, 34, 193, 1, 0, 0, 0, 36, 197, 1, 0, 0, 0, 38, 199, 1, 0, 0, 0, 40, 221, 1, 0, 0, 0, 42,
+                223, 1, 0, 0, 0, 44, 233, 1, 0, 0, 0, 46, 54, 3, 2, 1, 0, 47, 48, 5, 40, 0, 0, 48, 49, 3, 0, 0, 0,
+                49, 50, 7, 0, 0, 0, 50, 51, 3, 0, 0, 0, 51, 52, 5, 41, 0, 0, 52, 54, 1, 0, 0, 0, 53, 46, 1, 0, 0, 0,
+                53, 47, 1, 0, 0, 0, 54, 1, 1, 0, 0, 0, 55, 63, 5, 61, 0, 0, 56, 63, 5, 62, 0, 0, 57, 63, 5, 63, 0, 0,
+                58, 59, 5, 37, 0, 0, 59, 63, 5, 60, 0, 0, 60, 61, 5, 36, 0, 0, 61, 63, 5, 60, 0, 0, 62, 55, 1, 0, 0,
+                0, 62, 56, 1, 0, 0, 0, 62, 57, 1, 0, 0, 0, 62, 58, 1, 0, 0, 0, 62, 60, 1, 0, 0, 0, 63, 3, 1, 0, 0, 0,
+                64, 66, 3, 6, 3, 0, 65, 64, 1, 0, 0, 0, 66, 67, 1, 0, 0, 0, 67, 65, 1, 0, 0, 0, 67, 68, 1, 0, 0, 0,
+                68, 69, 1, 0, 0, 0, 69, 70, 5, 0, 0, 1, 70, 5, 1, 0, 0, 0, 71, 72, 5, 44, 0, 0, 72, 73, 5, 60, 0, 0,
+                73, 75, 5, 40, 0, 0, 74, 76, 3, 8, 4, 0, 75, 74, 1, 0, 0, 0, 75, 76, 1, 0, 0, 0, 76, 77, 1, 0, 0, 0,
+                77, 81, 5, 41, 0, 0, 78, 80, 3, 12, 6, 0, 79, 78, 1, 0, 0, 0, 80, 83, 1, 0, 0, 0, 81, 79, 1, 0, 0, 0,
+                81, 82, 1, 0, 0, 0, 82, 84, 1, 0, 0, 0, 83, 81, 1, 0, 0, 0, 84, 85, 3, 16, 8, 0, 85, 7, 1, 0, 0, 0,
+                86, 91, 3, 10, 5, 0, 87, 88, 5, 39, 0, 0, 88, 90, 3, 10, 5, 0, 89, 87, 1, 0, 0, 0, 90, 93, 1, 0, 0,
+                0, 91, 89, 1, 0, 0, 0, 91, 92, 1, 0, 0, 0, 92, 9, 1, 0, 0, 0, 93, 91, 1, 0, 0, 0, 94, 95, 7, 1, 0, 0,
+                95, 96, 3, 14, 7, 0, 96, 11, 1, 0, 0, 0, 97, 98, 7, 2, 0, 0, 98, 103, 3, 14, 7, 0, 99, 100, 5, 39, 0,
+                0, 100, 102, 3, 14, 7, 0, 101, 99, 1, 0, 0, 0, 102, 105, 1, 0, 0, 0, 103, 101, 1, 0, 0, 0, 103, 104,
+                1, 0, 0, 0, 104, 13, 1, 0, 0, 0, 105, 103, 1, 0, 0, 0, 106, 112, 5, 60, 0, 0, 107, 108, 5, 42, 0, 0,
+                108, 109, 5, 63, 0, 0, 109, 111, 5, 43, 0, 0, 110, 107, 1, 0, 0, 0, 111, 114, 1, 0, 0, 0, 112, 110,
+                1, 0, 0, 0, 112, 113, 1, 0, 0, 0, 113, 118, 1, 0, 0, 0, 114, 112, 1, 0, 0, 0, 115, 116, 5, 40, 0, 0,
+                116, 117, 5, 63, 0, 0, 117, 119, 5, 41, 0, 0, 118, 115, 1, 0, 0, 0, 118, 119, 1, 0, 0, 0, 119, 15, 1,
+                0, 0, 0, 120, 125, 3, 18, 9, 0, 121, 122, 5, 38, 0, 0, 122, 124, 3, 18, 9, 0, 123, 121, 1, 0, 0, 0,
+                124, 127, 1, 0, 0, 0, 125, 123, 1, 0, 0, 0, 125, 126, 1, 0, 0, 0, 126, 17, 1, 0, 0, 0, 127, 125, 1,
+                0, 0, 0, 128, 136, 3, 20, 10, 0, 129, 136, 3, 26, 13, 0, 130, 136, 3, 28, 14, 0, 131, 136, 3, 30, 15,
+                0, 132, 136, 3, 32, 16, 0, 133, 136, 3, 34, 17, 0, 134, 136, 3, 36, 18, 0, 135, 128, 1, 0, 0, 0, 135,
+                129, 1, 0, 0, 0, 135, 130, 1, 0, 0, 0, 135, 131, 1, 0, 0, 0, 135, 132, 1, 0, 0, 0, 135, 133, 1, 0, 0,
+                0, 135, 134, 1, 0, 0, 0, 136, 19, 1, 0, 0, 0, 137, 138, 7, 3, 0, 0, 138, 139, 5, 60, 0, 0, 139, 140,
+                5, 40, 0, 0, 140, 145, 5, 60, 0, 0, 141, 142, 5, 39, 0, 0, 142, 144, 5, 60, 0, 0, 143, 141, 1, 0, 0,
+                0, 144, 147, 1, 0, 0, 0, 145, 143, 1, 0, 0, 0, 145, 146, 1, 0, 0, 0, 146, 148, 1, 0, 0, 0, 147, 145,
+                1, 0, 0, 0, 148, 149, 5, 41, 0, 0, 149, 21, 1, 0, 0, 0, 150, 151, 5, 36, 0, 0, 151, 152, 5, 60, 0, 0,
+                152, 153, 5, 20, 0, 0, 153, 23, 1, 0, 0, 0, 154, 156, 5, 48, 0, 0, 155, 157, 5, 8, 0, 0, 156, 155, 1,
+                0, 0, 0, 156, 157, 1, 0, 0, 0, 157, 158, 1, 0, 0, 0, 158, 159, 3, 0, 0, 0, 159, 25, 1, 0, 0, 0, 160,
+                167, 5, 45, 0, 0, 161, 163, 3, 22, 11, 0, 162, 161, 1, 0, 0, 0, 162, 163, 1, 0, 0, 0, 163, 164, 1, 0,
+                0, 0, 164, 165, 3, 0, 0, 0, 165, 166, 5, 47, 0, 0, 166, 168, 1, 0, 0, 0, 167, 162, 1, 0, 0, 0, 167,
+                168, 1, 0, 0, 0, 168, 169, 1, 0, 0, 0, 169, 171, 3, 0, 0, 0, 170, 172, 3, 24, 12, 0, 171, 170, 1, 0,
+                0, 0, 171, 172, 1, 0, 0, 0, 172, 173, 1, 0, 0, 0, 173, 174, 5, 46, 0, 0, 174, 175, 3, 16, 8, 0, 175,
+                176, 5, 49, 0, 0, 176, 27, 1, 0, 0, 0, 177, 178, 5, 50, 0, 0, 178, 179, 3, 40, 20, 0, 179, 180, 5,
+                51, 0, 0, 180, 181, 3, 16, 8, 0, 181, 182, 5, 52, 0, 0, 182, 183, 3, 16, 8, 0, 183, 184, 5, 53, 0, 0,
+                184, 185, 3, 40, 20, 0, 185, 29, 1, 0, 0, 0, 186, 187, 7, 4, 0, 0, 187, 188, 3, 38, 19, 0, 188, 31,
+                1, 0, 0, 0, 189, 190, 3, 38, 19, 0, 190, 191, 7, 5, 0, 0, 191, 192, 3, 40, 20, 0, 192, 33, 1, 0, 0,
+                0, 193, 194, 3, 38, 19, 0, 194, 195, 5, 15, 0, 0, 195, 196, 3, 38, 19, 0, 196, 35, 1, 0, 0, 0, 197,
+                198, 5, 54, 0, 0, 198, 37, 1, 0, 0, 0, 199, 206, 5, 60, 0, 0, 200, 201, 5, 42, 0, 0, 201, 202, 3, 40,
+                20, 0, 202, 203, 5, 43, 0, 0, 203, 205, 1, 0, 0, 0, 204, 200, 1, 0, 0, 0, 205, 208, 1, 0, 0, 0, 206,
+                204, 1, 0, 0, 0, 206, 207, 1, 0, 0, 0, 207, 215, 1, 0, 0, 0, 208, 206, 1, 0, 0, 0, 209, 210, 5, 55,
+                0, 0, 210, 213, 3, 0, 0, 0, 211, 212, 5, 56, 0, 0, 212, 214, 3, 0, 0, 0, 213, 211, 1, 0, 0, 0, 213,
+                214, 1, 0, 0, 0, 214, 216, 1, 0, 0, 0, 215, 209, 1, 0, 0, 0, 215, 216, 1, 0, 0, 0, 216, 39, 1, 0, 0,
+                0, 217, 222, 3, 2, 1, 0, 218, 222, 3, 38, 19, 0, 219, 222, 3, 42, 21, 0, 220, 222, 3, 44, 22, 0, 221,
+                217, 1, 0, 0, 0, 221, 218, 1, 0, 0, 0, 221, 219, 1, 0, 0, 0, 221, 220, 1, 0, 0, 0, 222, 41, 1, 0, 0,
+                0, 223, 224, 5, 40, 0, 0, 224, 229, 3, 40, 20, 0, 225, 226, 7, 6, 0, 0, 226, 230, 3, 40, 20, 0, 227,
+                228, 7, 7, 0, 0, 228, 230, 3, 0, 0, 0, 229, 225, 1, 0, 0, 0, 229, 227, 1, 0, 0, 0, 230, 231, 1, 0, 0,
+                0, 231, 232, 5, 41, 0, 0, 232, 43, 1, 0, 0, 0, 233, 234, 7, 8, 0, 0, 234, 235, 3, 40, 20, 0, 235, 45,
+                1, 0, 0, 0, 21, 53, 62, 67, 75, 81, 91, 103, 112, 118, 125, 135, 145, 156, 162, 167, 171, 206, 213,
+                215, 221, 229};
         staticData->serializedATN = atn::SerializedATNView(serializedATNSegment.data(), serializedATNSegment.size());
 
         const atn::ATNDeserializer deserializer;
@@ -271,13 +268,122 @@ void TSyrecParser::NumberContext::copyFrom(NumberContext* ctx) {
     ParserRuleContext::copyFrom(ctx);
 }
 
+//----------------- NumberFromAtomicNumberContext ------------------------------------------------------------------
+
+TSyrecParser::AtomicNumberContext* TSyrecParser::NumberFromAtomicNumberContext::atomicNumber() const {
+    return getRuleContext<AtomicNumberContext>(0);
+}
+
+TSyrecParser::NumberFromAtomicNumberContext::NumberFromAtomicNumberContext(NumberContext* ctx) {
+    copyFrom(ctx);
+}
+//----------------- NumberFromExpressionContext ------------------------------------------------------------------
+
+std::vector<TSyrecParser::NumberContext*> TSyrecParser::NumberFromExpressionContext::number() const {
+    return getRuleContexts<NumberContext>();
+}
+
+tree::TerminalNode* TSyrecParser::NumberFromExpressionContext::literalOpPlus() const {
+    return getToken(OpPlus, 0);
+}
+
+tree::TerminalNode* TSyrecParser::NumberFromExpressionContext::literalOpMinus() const {
+    return getToken(OpMinus, 0);
+}
+
+tree::TerminalNode* TSyrecParser::NumberFromExpressionContext::literalOpMultiply() const {
+    return getToken(OpMultiply, 0);
+}
+
+tree::TerminalNode* TSyrecParser::NumberFromExpressionContext::literalOpDivision() const {
+    return getToken(OpDivision, 0);
+}
+
+TSyrecParser::NumberFromExpressionContext::NumberFromExpressionContext(NumberContext* ctx) {
+    copyFrom(ctx);
+}
+
+TSyrecParser::NumberContext* TSyrecParser::number() {
+    auto* localCtx = _tracker.createInstance<NumberContext>(_ctx, getState());
+    enterRule(localCtx, 0, RuleNumber);
+
+    auto onExit = finally([&] {
+        exitRule();
+    });
+
+    try {
+        setState(53);
+        _errHandler->sync(this);
+        switch (_input->LA(1)) {
+            case LoopVariablePrefix:
+            case SignalWidthPrefix:
+            case HexLiteral:
+            case BinaryLiteral:
+            case Int: {
+                localCtx = _tracker.createInstance<NumberFromAtomicNumberContext>(localCtx);
+                enterOuterAlt(localCtx, 1);
+                setState(46);
+                atomicNumber();
+                break;
+            }
+
+            case OpenRBracket: {
+                localCtx = _tracker.createInstance<NumberFromExpressionContext>(localCtx);
+                enterOuterAlt(localCtx, 2);
+                setState(47);
+                match(OpenRBracket);
+                setState(48);
+                antlrcpp::downCast<NumberFromExpressionContext*>(localCtx)->lhsOperand = number();
+                setState(49);
+                antlrcpp::downCast<NumberFromExpressionContext*>(localCtx)->op = _input->LT(1);
+                const std::size_t lookahead                                    = _input->LA(1);
+                if (!((((lookahead & ~0x3fULL) == 0) && ((1ULL << lookahead) & 2944) != 0))) {
+                    antlrcpp::downCast<NumberFromExpressionContext*>(localCtx)->op = _errHandler->recoverInline(this);
+                } else {
+                    _errHandler->reportMatch(this);
+                    consume();
+                }
+                setState(50);
+                antlrcpp::downCast<NumberFromExpressionContext*>(localCtx)->rhsOperand = number();
+                setState(51);
+                match(CloseRBracket);
+                break;
+            }
+
+            default:
+                throw NoViableAltException(this);
+        }
+
+    } catch (RecognitionException& e) {
+        _errHandler->reportError(this, e);
+        localCtx->exception = std::current_exception();
+        _errHandler->recover(this, localCtx->exception);
+    }
+
+    return localCtx;
+}
+
+//----------------- AtomicNumberContext ------------------------------------------------------------------
+
+TSyrecParser::AtomicNumberContext::AtomicNumberContext(ParserRuleContext* parent, size_t invokingState):
+    ParserRuleContext(parent, invokingState) {
+}
+
+size_t TSyrecParser::AtomicNumberContext::getRuleIndex() const {
+    return RuleAtomicNumber;
+}
+
+void TSyrecParser::AtomicNumberContext::copyFrom(AtomicNumberContext* ctx) {
+    ParserRuleContext::copyFrom(ctx);
+}
+
 //----------------- NumberFromHexLiteralContext ------------------------------------------------------------------
 
 tree::TerminalNode* TSyrecParser::NumberFromHexLiteralContext::hexLiteral() const {
     return getToken(HexLiteral, 0);
 }
 
-TSyrecParser::NumberFromHexLiteralContext::NumberFromHexLiteralContext(NumberContext* ctx) {
+TSyrecParser::NumberFromHexLiteralContext::NumberFromHexLiteralContext(AtomicNumberContext* ctx) {
     copyFrom(ctx);
 }
 
@@ -287,7 +393,7 @@ tree::TerminalNode* TSyrecParser::NumberFromBinaryLiteralContext::binaryLiteral(
     return getToken(BinaryLiteral, 0);
 }
 
-TSyrecParser::NumberFromBinaryLiteralContext::NumberFromBinaryLiteralContext(NumberContext* ctx) {
+TSyrecParser::NumberFromBinaryLiteralContext::NumberFromBinaryLiteralContext(AtomicNumberContext* ctx) {
     copyFrom(ctx);
 }
 
@@ -301,7 +407,7 @@ tree::TerminalNode* TSyrecParser::NumberFromSignalwidthContext::literalIdent() c
     return getToken(Ident, 0);
 }
 
-TSyrecParser::NumberFromSignalwidthContext::NumberFromSignalwidthContext(NumberContext* ctx) {
+TSyrecParser::NumberFromSignalwidthContext::NumberFromSignalwidthContext(AtomicNumberContext* ctx) {
     copyFrom(ctx);
 }
 //----------------- NumberFromLoopVariableContext ------------------------------------------------------------------
@@ -314,60 +420,35 @@ tree::TerminalNode* TSyrecParser::NumberFromLoopVariableContext::literalIdent()
     return getToken(Ident, 0);
 }
 
-TSyrecParser::NumberFromLoopVariableContext::NumberFromLoopVariableContext(NumberContext* ctx) {
+TSyrecParser::NumberFromLoopVariableContext::NumberFromLoopVariableContext(AtomicNumberContext* ctx) {
     copyFrom(ctx);
 }
-//----------------- NumberFromConstantContext ------------------------------------------------------------------
+//----------------- NumberFromIntegerContext ------------------------------------------------------------------
 
 tree::TerminalNode* TSyrecParser::NumberFromIntegerContext::integerLiteral() const {
     return getToken(Int, 0);
 }
 
-TSyrecParser::NumberFromIntegerContext::NumberFromIntegerContext(NumberContext* ctx) {
-    copyFrom(ctx);
-}
-//----------------- NumberFromExpressionContext ------------------------------------------------------------------
-
-std::vector<TSyrecParser::NumberContext*> TSyrecParser::NumberFromExpressionContext::number() const {
-    return getRuleContexts<NumberContext>();
-}
-
-tree::TerminalNode* TSyrecParser::NumberFromExpressionContext::literalOpPlus() const {
-    return getToken(OpPlus, 0);
-}
-
-tree::TerminalNode* TSyrecParser::NumberFromExpressionContext::literalOpMinus() const {
-    return getToken(OpMinus, 0);
-}
-
-tree::TerminalNode* TSyrecParser::NumberFromExpressionContext::literalOpMultiply() const {
-    return getToken(OpMultiply, 0);
-}
-
-tree::TerminalNode* TSyrecParser::NumberFromExpressionContext::literalOpDivision() const {
-    return getToken(OpDivision, 0);
-}
-
-TSyrecParser::NumberFromExpressionContext::NumberFromExpressionContext(NumberContext* ctx) {
+TSyrecParser::NumberFromIntegerContext::NumberFromIntegerContext(AtomicNumberContext* ctx) {
     copyFrom(ctx);
 }
 
-TSyrecParser::NumberContext* TSyrecParser::number() {
-    auto* localCtx = _tracker.createInstance<NumberContext>(_ctx, getState());
-    enterRule(localCtx, 0, RuleNumber);
+TSyrecParser::AtomicNumberContext* TSyrecParser::atomicNumber() {
+    auto* localCtx = _tracker.createInstance<AtomicNumberContext>(_ctx, getState());
+    enterRule(localCtx, 2, RuleAtomicNumber);
 
     auto onExit = finally([&] {
         exitRule();
     });
 
     try {
-        setState(59);
+        setState(62);
         _errHandler->sync(this);
         switch (_input->LA(1)) {
             case HexLiteral: {
                 localCtx = _tracker.createInstance<NumberFromHexLiteralContext>(localCtx);
                 enterOuterAlt(localCtx, 1);
-                setState(46);
+                setState(55);
                 match(HexLiteral);
                 break;
             }
@@ -375,14 +456,14 @@ TSyrecParser::NumberContext* TSyrecParser::number() {
             case BinaryLiteral: {
                 localCtx = _tracker.createInstance<NumberFromBinaryLiteralContext>(localCtx);
                 enterOuterAlt(localCtx, 2);
-                setState(47);
+                setState(56);
                 match(BinaryLiteral);
                 break;
             }
             case Int: {
                 localCtx = _tracker.createInstance<NumberFromIntegerContext>(localCtx);
                 enterOuterAlt(localCtx, 3);
-                setState(48);
+                setState(57);
                 match(Int);
                 break;
             }
@@ -390,9 +471,9 @@ TSyrecParser::NumberContext* TSyrecParser::number() {
             case SignalWidthPrefix: {
                 localCtx = _tracker.createInstance<NumberFromSignalwidthContext>(localCtx);
                 enterOuterAlt(localCtx, 4);
-                setState(49);
+                setState(58);
                 match(SignalWidthPrefix);
-                setState(50);
+                setState(59);
                 match(Ident);
                 break;
             }
@@ -400,36 +481,13 @@ TSyrecParser::NumberContext* TSyrecParser::number() {
             case LoopVariablePrefix: {
                 localCtx = _tracker.createInstance<NumberFromLoopVariableContext>(localCtx);
                 enterOuterAlt(localCtx, 5);
-                setState(51);
+                setState(60);
                 match(LoopVariablePrefix);
-                setState(52);
+                setState(61);
                 match(Ident);
                 break;
             }
 
-            case OpenRBracket: {
-                localCtx = _tracker.createInstance<NumberFromExpressionContext>(localCtx);
-                enterOuterAlt(localCtx, 6);
-                setState(53);
-                match(OpenRBracket);
-                setState(54);
-                antlrcpp::downCast<NumberFromExpressionContext*>(localCtx)->lhsOperand = number();
-                setState(55);
-                antlrcpp::downCast<NumberFromExpressionContext*>(localCtx)->op = _input->LT(1);
-                const std::size_t lookahead                                    = _input->LA(1);
-                if (!((((lookahead & ~0x3fULL) == 0) && ((1ULL << lookahead) & 2944) != 0))) {
-                    antlrcpp::downCast<NumberFromExpressionContext*>(localCtx)->op = _errHandler->recoverInline(this);
-                } else {
-                    _errHandler->reportMatch(this);
-                    consume();
-                }
-                setState(56);
-                antlrcpp::downCast<NumberFromExpressionContext*>(localCtx)->rhsOperand = number();
-                setState(57);
-                match(CloseRBracket);
-                break;
-            }
-
             default:
                 throw NoViableAltException(this);
         }
@@ -459,7 +517,7 @@ size_t TSyrecParser::ProgramContext::getRuleIndex() const {
 
 TSyrecParser::ProgramContext* TSyrecParser::program() {
     auto* localCtx = _tracker.createInstance<ProgramContext>(_ctx, getState());
-    enterRule(localCtx, 2, RuleProgram);
+    enterRule(localCtx, 4, RuleProgram);
 
     auto onExit = finally([&] {
         exitRule();
@@ -467,18 +525,18 @@ TSyrecParser::ProgramContext* TSyrecParser::program() {
 
     try {
         enterOuterAlt(localCtx, 1);
-        setState(62);
+        setState(65);
         _errHandler->sync(this);
 
         size_t lookahead = KeywordModule;
         while (lookahead == KeywordModule) {
-            setState(61);
-            module();
             setState(64);
+            module();
+            setState(67);
             _errHandler->sync(this);
             lookahead = _input->LA(1);
         }
-        setState(66);
+        setState(69);
         match(EOF);
 
     } catch (RecognitionException& e) {
@@ -518,7 +576,7 @@ size_t TSyrecParser::ModuleContext::getRuleIndex() const {
 
 TSyrecParser::ModuleContext* TSyrecParser::module() {
     auto* localCtx = _tracker.createInstance<ModuleContext>(_ctx, getState());
-    enterRule(localCtx, 4, RuleModule);
+    enterRule(localCtx, 6, RuleModule);
 
     auto onExit = finally([&] {
         exitRule();
@@ -527,33 +585,33 @@ TSyrecParser::ModuleContext* TSyrecParser::module() {
     try {
         size_t lookahead = 0;
         enterOuterAlt(localCtx, 1);
-        setState(68);
+        setState(71);
         match(KeywordModule);
-        setState(69);
+        setState(72);
         match(Ident);
-        setState(70);
+        setState(73);
         match(OpenRBracket);
-        setState(72);
+        setState(75);
         _errHandler->sync(this);
 
         lookahead = _input->LA(1);
         if ((((lookahead & ~0x3fULL) == 0) && ((1ULL << lookahead) & 15032385536) != 0)) {
-            setState(71);
+            setState(74);
             parameterList();
         }
-        setState(74);
+        setState(77);
         match(CloseRBracket);
-        setState(78);
+        setState(81);
         _errHandler->sync(this);
         lookahead = _input->LA(1);
         while (lookahead == VarTypeWire || lookahead == VarTypeState) {
-            setState(75);
+            setState(78);
             signalList();
-            setState(80);
+            setState(83);
             _errHandler->sync(this);
             lookahead = _input->LA(1);
         }
-        setState(81);
+        setState(84);
         statementList();
 
     } catch (RecognitionException& e) {
@@ -581,7 +639,7 @@ size_t TSyrecParser::ParameterListContext::getRuleIndex() const {
 
 TSyrecParser::ParameterListContext* TSyrecParser::parameterList() {
     auto* localCtx = _tracker.createInstance<ParameterListContext>(_ctx, getState());
-    enterRule(localCtx, 6, RuleParameterList);
+    enterRule(localCtx, 8, RuleParameterList);
 
     auto onExit = finally([&] {
         exitRule();
@@ -589,17 +647,17 @@ TSyrecParser::ParameterListContext* TSyrecParser::parameterList() {
 
     try {
         enterOuterAlt(localCtx, 1);
-        setState(83);
+        setState(86);
         parameter();
-        setState(88);
+        setState(91);
         _errHandler->sync(this);
         std::size_t lookahead = _input->LA(1);
         while (lookahead == ParameterDelimiter) {
-            setState(84);
+            setState(87);
             match(ParameterDelimiter);
-            setState(85);
+            setState(88);
             parameter();
-            setState(90);
+            setState(93);
             _errHandler->sync(this);
             lookahead = _input->LA(1);
         }
@@ -641,7 +699,7 @@ size_t TSyrecParser::ParameterContext::getRuleIndex() const {
 
 TSyrecParser::ParameterContext* TSyrecParser::parameter() {
     auto* localCtx = _tracker.createInstance<ParameterContext>(_ctx, getState());
-    enterRule(localCtx, 8, RuleParameter);
+    enterRule(localCtx, 10, RuleParameter);
 
     auto onExit = finally([&] {
         exitRule();
@@ -649,7 +707,7 @@ TSyrecParser::ParameterContext* TSyrecParser::parameter() {
 
     try {
         enterOuterAlt(localCtx, 1);
-        setState(91);
+        setState(94);
         const std::size_t lookahead = _input->LA(1);
         if (!((((lookahead & ~0x3fULL) == 0) && ((1ULL << lookahead) & 15032385536) != 0))) {
             _errHandler->recoverInline(this);
@@ -657,7 +715,7 @@ TSyrecParser::ParameterContext* TSyrecParser::parameter() {
             _errHandler->reportMatch(this);
             consume();
         }
-        setState(92);
+        setState(95);
         signalDeclaration();
 
     } catch (RecognitionException& e) {
@@ -693,7 +751,7 @@ size_t TSyrecParser::SignalListContext::getRuleIndex() const {
 
 TSyrecParser::SignalListContext* TSyrecParser::signalList() {
     auto* localCtx = _tracker.createInstance<SignalListContext>(_ctx, getState());
-    enterRule(localCtx, 10, RuleSignalList);
+    enterRule(localCtx, 12, RuleSignalList);
 
     auto onExit = finally([&] {
         exitRule();
@@ -701,7 +759,7 @@ TSyrecParser::SignalListContext* TSyrecParser::signalList() {
 
     try {
         enterOuterAlt(localCtx, 1);
-        setState(94);
+        setState(97);
         std::size_t lookahead = _input->LA(1);
         if (lookahead != VarTypeWire && lookahead != VarTypeState) {
             _errHandler->recoverInline(this);
@@ -709,17 +767,17 @@ TSyrecParser::SignalListContext* TSyrecParser::signalList() {
             _errHandler->reportMatch(this);
             consume();
         }
-        setState(95);
+        setState(98);
         signalDeclaration();
-        setState(100);
+        setState(103);
         _errHandler->sync(this);
         lookahead = _input->LA(1);
         while (lookahead == ParameterDelimiter) {
-            setState(96);
+            setState(99);
             match(ParameterDelimiter);
-            setState(97);
+            setState(100);
             signalDeclaration();
-            setState(102);
+            setState(105);
             _errHandler->sync(this);
             lookahead = _input->LA(1);
         }
@@ -749,7 +807,7 @@ size_t TSyrecParser::SignalDeclarationContext::getRuleIndex() const {
 
 TSyrecParser::SignalDeclarationContext* TSyrecParser::signalDeclaration() {
     auto* localCtx = _tracker.createInstance<SignalDeclarationContext>(_ctx, getState());
-    enterRule(localCtx, 12, RuleSignalDeclaration);
+    enterRule(localCtx, 14, RuleSignalDeclaration);
 
     auto onExit = finally([&] {
         exitRule();
@@ -757,33 +815,33 @@ TSyrecParser::SignalDeclarationContext* TSyrecParser::signalDeclaration() {
 
     try {
         enterOuterAlt(localCtx, 1);
-        setState(103);
+        setState(106);
         match(Ident);
-        setState(109);
+        setState(112);
         _errHandler->sync(this);
         std::size_t lookahead = _input->LA(1);
         while (lookahead == OpenSBracket) {
-            setState(104);
+            setState(107);
             match(OpenSBracket);
-            setState(105);
+            setState(108);
             antlrcpp::downCast<SignalDeclarationContext*>(localCtx)->intToken = match(Int);
             antlrcpp::downCast<SignalDeclarationContext*>(localCtx)->dimensionTokens.push_back(antlrcpp::downCast<SignalDeclarationContext*>(localCtx)->intToken);
-            setState(106);
+            setState(109);
             match(CloseSBracket);
-            setState(111);
+            setState(114);
             _errHandler->sync(this);
             lookahead = _input->LA(1);
         }
-        setState(115);
+        setState(118);
         _errHandler->sync(this);
 
         lookahead = _input->LA(1);
         if (lookahead == OpenRBracket) {
-            setState(112);
+            setState(115);
             match(OpenRBracket);
-            setState(113);
+            setState(116);
             antlrcpp::downCast<SignalDeclarationContext*>(localCtx)->signalWidthToken = match(Int);
-            setState(114);
+            setState(117);
             match(CloseRBracket);
         }
 
@@ -808,7 +866,7 @@ size_t TSyrecParser::StatementListContext::getRuleIndex() const {
 
 TSyrecParser::StatementListContext* TSyrecParser::statementList() {
     auto* localCtx = _tracker.createInstance<StatementListContext>(_ctx, getState());
-    enterRule(localCtx, 14, RuleStatementList);
+    enterRule(localCtx, 16, RuleStatementList);
 
     auto onExit = finally([&] {
         exitRule();
@@ -816,19 +874,19 @@ TSyrecParser::StatementListContext* TSyrecParser::statementList() {
 
     try {
         enterOuterAlt(localCtx, 1);
-        setState(117);
+        setState(120);
         antlrcpp::downCast<StatementListContext*>(localCtx)->statementContext = statement();
         antlrcpp::downCast<StatementListContext*>(localCtx)->stmts.push_back(antlrcpp::downCast<StatementListContext*>(localCtx)->statementContext);
-        setState(122);
+        setState(125);
         _errHandler->sync(this);
         std::size_t lookahead = _input->LA(1);
         while (lookahead == StatementDelimiter) {
-            setState(118);
+            setState(121);
             match(StatementDelimiter);
-            setState(119);
+            setState(122);
             antlrcpp::downCast<StatementListContext*>(localCtx)->statementContext = statement();
             antlrcpp::downCast<StatementListContext*>(localCtx)->stmts.push_back(antlrcpp::downCast<StatementListContext*>(localCtx)->statementContext);
-            setState(124);
+            setState(127);
             _errHandler->sync(this);
             lookahead = _input->LA(1);
         }
@@ -882,55 +940,55 @@ size_t TSyrecParser::StatementContext::getRuleIndex() const {
 
 TSyrecParser::StatementContext* TSyrecParser::statement() {
     auto* localCtx = _tracker.createInstance<StatementContext>(_ctx, getState());
-    enterRule(localCtx, 16, RuleStatement);
+    enterRule(localCtx, 18, RuleStatement);
 
     auto onExit = finally([&] {
         exitRule();
     });
 
     try {
-        setState(132);
+        setState(135);
         _errHandler->sync(this);
-        switch (getInterpreter<atn::ParserATNSimulator>()->adaptivePredict(_input, 9, _ctx)) {
+        switch (getInterpreter<atn::ParserATNSimulator>()->adaptivePredict(_input, 10, _ctx)) {
             case 1: {
                 enterOuterAlt(localCtx, 1);
-                setState(125);
+                setState(128);
                 callStatement();
                 break;
             }
             case 2: {
                 enterOuterAlt(localCtx, 2);
-                setState(126);
+                setState(129);
                 forStatement();
                 break;
             }
             case 3: {
                 enterOuterAlt(localCtx, 3);
-                setState(127);
+                setState(130);
                 ifStatement();
                 break;
             }
             case 4: {
                 enterOuterAlt(localCtx, 4);
-                setState(128);
+                setState(131);
                 unaryStatement();
                 break;
             }
             case 5: {
                 enterOuterAlt(localCtx, 5);
-                setState(129);
+                setState(132);
                 assignStatement();
                 break;
             }
             case 6: {
                 enterOuterAlt(localCtx, 6);
-                setState(130);
+                setState(133);
                 swapStatement();
                 break;
             }
             case 7: {
                 enterOuterAlt(localCtx, 7);
-                setState(131);
+                setState(134);
                 skipStatement();
                 break;
             }
@@ -967,7 +1025,7 @@ size_t TSyrecParser::CallStatementContext::getRuleIndex() const {
 
 TSyrecParser::CallStatementContext* TSyrecParser::callStatement() {
     auto* localCtx = _tracker.createInstance<CallStatementContext>(_ctx, getState());
-    enterRule(localCtx, 18, RuleCallStatement);
+    enterRule(localCtx, 20, RuleCallStatement);
 
     auto onExit = finally([&] {
         exitRule();
@@ -975,7 +1033,7 @@ TSyrecParser::CallStatementContext* TSyrecParser::callStatement() {
 
     try {
         enterOuterAlt(localCtx, 1);
-        setState(134);
+        setState(137);
         std::size_t lookahead = _input->LA(1);
         if (lookahead != OpCall && lookahead != OpUncall) {
             _errHandler->recoverInline(this);
@@ -983,27 +1041,27 @@ TSyrecParser::CallStatementContext* TSyrecParser::callStatement() {
             _errHandler->reportMatch(this);
             consume();
         }
-        setState(135);
+        setState(138);
         antlrcpp::downCast<CallStatementContext*>(localCtx)->moduleIdent = match(Ident);
-        setState(136);
+        setState(139);
         match(OpenRBracket);
-        setState(137);
+        setState(140);
         antlrcpp::downCast<CallStatementContext*>(localCtx)->identToken = match(Ident);
         antlrcpp::downCast<CallStatementContext*>(localCtx)->callerArguments.push_back(antlrcpp::downCast<CallStatementContext*>(localCtx)->identToken);
-        setState(142);
+        setState(145);
         _errHandler->sync(this);
         lookahead = _input->LA(1);
         while (lookahead == ParameterDelimiter) {
-            setState(138);
+            setState(141);
             match(ParameterDelimiter);
-            setState(139);
+            setState(142);
             antlrcpp::downCast<CallStatementContext*>(localCtx)->identToken = match(Ident);
             antlrcpp::downCast<CallStatementContext*>(localCtx)->callerArguments.push_back(antlrcpp::downCast<CallStatementContext*>(localCtx)->identToken);
-            setState(144);
+            setState(147);
             _errHandler->sync(this);
             lookahead = _input->LA(1);
         }
-        setState(145);
+        setState(148);
         match(CloseRBracket);
 
     } catch (RecognitionException& e) {
@@ -1031,7 +1089,7 @@ size_t TSyrecParser::LoopVariableDefinitionContext::getRuleIndex() const {
 
 TSyrecParser::LoopVariableDefinitionContext* TSyrecParser::loopVariableDefinition() {
     auto* localCtx = _tracker.createInstance<LoopVariableDefinitionContext>(_ctx, getState());
-    enterRule(localCtx, 20, RuleLoopVariableDefinition);
+    enterRule(localCtx, 22, RuleLoopVariableDefinition);
 
     auto onExit = finally([&] {
         exitRule();
@@ -1039,11 +1097,11 @@ TSyrecParser::LoopVariableDefinitionContext* TSyrecParser::loopVariableDefinitio
 
     try {
         enterOuterAlt(localCtx, 1);
-        setState(147);
+        setState(150);
         match(LoopVariablePrefix);
-        setState(148);
+        setState(151);
         antlrcpp::downCast<LoopVariableDefinitionContext*>(localCtx)->variableIdent = match(Ident);
-        setState(149);
+        setState(152);
         match(OpEqual);
 
     } catch (RecognitionException& e) {
@@ -1075,7 +1133,7 @@ size_t TSyrecParser::LoopStepsizeDefinitionContext::getRuleIndex() const {
 
 TSyrecParser::LoopStepsizeDefinitionContext* TSyrecParser::loopStepsizeDefinition() {
     auto* localCtx = _tracker.createInstance<LoopStepsizeDefinitionContext>(_ctx, getState());
-    enterRule(localCtx, 22, RuleLoopStepsizeDefinition);
+    enterRule(localCtx, 24, RuleLoopStepsizeDefinition);
 
     auto onExit = finally([&] {
         exitRule();
@@ -1083,15 +1141,15 @@ TSyrecParser::LoopStepsizeDefinitionContext* TSyrecParser::loopStepsizeDefinitio
 
     try {
         enterOuterAlt(localCtx, 1);
-        setState(151);
+        setState(154);
         match(KeywordStep);
-        setState(153);
+        setState(156);
         _errHandler->sync(this);
         if (const std::size_t lookahead = _input->LA(1); lookahead == OpMinus) {
-            setState(152);
+            setState(155);
             match(OpMinus);
         }
-        setState(155);
+        setState(158);
         number();
 
     } catch (RecognitionException& e) {
@@ -1131,7 +1189,7 @@ size_t TSyrecParser::ForStatementContext::getRuleIndex() const {
 
 TSyrecParser::ForStatementContext* TSyrecParser::forStatement() {
     auto* localCtx = _tracker.createInstance<ForStatementContext>(_ctx, getState());
-    enterRule(localCtx, 24, RuleForStatement);
+    enterRule(localCtx, 26, RuleForStatement);
 
     auto onExit = finally([&] {
         exitRule();
@@ -1139,38 +1197,38 @@ TSyrecParser::ForStatementContext* TSyrecParser::forStatement() {
 
     try {
         enterOuterAlt(localCtx, 1);
-        setState(157);
+        setState(160);
         match(KeywordFor);
-        setState(164);
+        setState(167);
         _errHandler->sync(this);
 
-        if (getInterpreter<atn::ParserATNSimulator>()->adaptivePredict(_input, 13, _ctx) == 1) {
-            setState(159);
+        if (getInterpreter<atn::ParserATNSimulator>()->adaptivePredict(_input, 14, _ctx) == 1) {
+            setState(162);
             _errHandler->sync(this);
 
-            if (getInterpreter<atn::ParserATNSimulator>()->adaptivePredict(_input, 12, _ctx) == 1) {
-                setState(158);
+            if (getInterpreter<atn::ParserATNSimulator>()->adaptivePredict(_input, 13, _ctx) == 1) {
+                setState(161);
                 loopVariableDefinition();
             }
-            setState(161);
+            setState(164);
             antlrcpp::downCast<ForStatementContext*>(localCtx)->startValue = number();
-            setState(162);
+            setState(165);
             match(KeywordTo);
         }
-        setState(166);
+        setState(169);
         antlrcpp::downCast<ForStatementContext*>(localCtx)->endValue = number();
-        setState(168);
+        setState(171);
         _errHandler->sync(this);
 
         if (const std::size_t lookahead = _input->LA(1); lookahead == KeywordStep) {
-            setState(167);
+            setState(170);
             loopStepsizeDefinition();
         }
-        setState(170);
+        setState(173);
         match(KeywordDo);
-        setState(171);
+        setState(174);
         statementList();
-        setState(172);
+        setState(175);
         match(KeywordRof);
 
     } catch (RecognitionException& e) {
@@ -1194,7 +1252,7 @@ size_t TSyrecParser::IfStatementContext::getRuleIndex() const {
 
 TSyrecParser::IfStatementContext* TSyrecParser::ifStatement() {
     auto* localCtx = _tracker.createInstance<IfStatementContext>(_ctx, getState());
-    enterRule(localCtx, 26, RuleIfStatement);
+    enterRule(localCtx, 28, RuleIfStatement);
 
     auto onExit = finally([&] {
         exitRule();
@@ -1202,21 +1260,21 @@ TSyrecParser::IfStatementContext* TSyrecParser::ifStatement() {
 
     try {
         enterOuterAlt(localCtx, 1);
-        setState(174);
+        setState(177);
         match(KeywordIf);
-        setState(175);
+        setState(178);
         antlrcpp::downCast<IfStatementContext*>(localCtx)->guardCondition = expression();
-        setState(176);
+        setState(179);
         match(KeywordThen);
-        setState(177);
+        setState(180);
         antlrcpp::downCast<IfStatementContext*>(localCtx)->trueBranchStmts = statementList();
-        setState(178);
+        setState(181);
         match(KeywordElse);
-        setState(179);
+        setState(182);
         antlrcpp::downCast<IfStatementContext*>(localCtx)->falseBranchStmts = statementList();
-        setState(180);
+        setState(183);
         match(KeywordFi);
-        setState(181);
+        setState(184);
         antlrcpp::downCast<IfStatementContext*>(localCtx)->matchingGuardExpression = expression();
 
     } catch (RecognitionException& e) {
@@ -1256,7 +1314,7 @@ size_t TSyrecParser::UnaryStatementContext::getRuleIndex() const {
 
 TSyrecParser::UnaryStatementContext* TSyrecParser::unaryStatement() {
     auto* localCtx = _tracker.createInstance<UnaryStatementContext>(_ctx, getState());
-    enterRule(localCtx, 28, RuleUnaryStatement);
+    enterRule(localCtx, 30, RuleUnaryStatement);
 
     auto onExit = finally([&] {
         exitRule();
@@ -1264,7 +1322,7 @@ TSyrecParser::UnaryStatementContext* TSyrecParser::unaryStatement() {
 
     try {
         enterOuterAlt(localCtx, 1);
-        setState(183);
+        setState(186);
         antlrcpp::downCast<UnaryStatementContext*>(localCtx)->unaryOp = _input->LT(1);
         const std::size_t lookahead                                   = _input->LA(1);
         if (!((((lookahead & ~0x3fULL) == 0) && ((1ULL << lookahead) & 14) != 0))) {
@@ -1273,7 +1331,7 @@ TSyrecParser::UnaryStatementContext* TSyrecParser::unaryStatement() {
             _errHandler->reportMatch(this);
             consume();
         }
-        setState(184);
+        setState(187);
         signal();
 
     } catch (RecognitionException& e) {
@@ -1317,7 +1375,7 @@ size_t TSyrecParser::AssignStatementContext::getRuleIndex() const {
 
 TSyrecParser::AssignStatementContext* TSyrecParser::assignStatement() {
     auto* localCtx = _tracker.createInstance<AssignStatementContext>(_ctx, getState());
-    enterRule(localCtx, 30, RuleAssignStatement);
+    enterRule(localCtx, 32, RuleAssignStatement);
 
     auto onExit = finally([&] {
         exitRule();
@@ -1325,9 +1383,9 @@ TSyrecParser::AssignStatementContext* TSyrecParser::assignStatement() {
 
     try {
         enterOuterAlt(localCtx, 1);
-        setState(186);
+        setState(189);
         signal();
-        setState(187);
+        setState(190);
         antlrcpp::downCast<AssignStatementContext*>(localCtx)->assignmentOp = _input->LT(1);
         const std::size_t lookahead                                         = _input->LA(1);
         if (!((((lookahead & ~0x3fULL) == 0) && ((1ULL << lookahead) & 112) != 0))) {
@@ -1336,7 +1394,7 @@ TSyrecParser::AssignStatementContext* TSyrecParser::assignStatement() {
             _errHandler->reportMatch(this);
             consume();
         }
-        setState(188);
+        setState(191);
         expression();
 
     } catch (RecognitionException& e) {
@@ -1360,7 +1418,7 @@ size_t TSyrecParser::SwapStatementContext::getRuleIndex() const {
 
 TSyrecParser::SwapStatementContext* TSyrecParser::swapStatement() {
     auto* localCtx = _tracker.createInstance<SwapStatementContext>(_ctx, getState());
-    enterRule(localCtx, 32, RuleSwapStatement);
+    enterRule(localCtx, 34, RuleSwapStatement);
 
     auto onExit = finally([&] {
         exitRule();
@@ -1368,11 +1426,11 @@ TSyrecParser::SwapStatementContext* TSyrecParser::swapStatement() {
 
     try {
         enterOuterAlt(localCtx, 1);
-        setState(190);
+        setState(193);
         antlrcpp::downCast<SwapStatementContext*>(localCtx)->lhsOperand = signal();
-        setState(191);
+        setState(194);
         match(OpSwap);
-        setState(192);
+        setState(195);
         antlrcpp::downCast<SwapStatementContext*>(localCtx)->rhsOperand = signal();
 
     } catch (RecognitionException& e) {
@@ -1396,7 +1454,7 @@ size_t TSyrecParser::SkipStatementContext::getRuleIndex() const {
 
 TSyrecParser::SkipStatementContext* TSyrecParser::skipStatement() {
     auto* localCtx = _tracker.createInstance<SkipStatementContext>(_ctx, getState());
-    enterRule(localCtx, 34, RuleSkipStatement);
+    enterRule(localCtx, 36, RuleSkipStatement);
 
     auto onExit = finally([&] {
         exitRule();
@@ -1404,7 +1462,7 @@ TSyrecParser::SkipStatementContext* TSyrecParser::skipStatement() {
 
     try {
         enterOuterAlt(localCtx, 1);
-        setState(194);
+        setState(197);
         match(KeywordSkip);
 
     } catch (RecognitionException& e) {
@@ -1432,7 +1490,7 @@ size_t TSyrecParser::SignalContext::getRuleIndex() const {
 
 TSyrecParser::SignalContext* TSyrecParser::signal() {
     auto* localCtx = _tracker.createInstance<SignalContext>(_ctx, getState());
-    enterRule(localCtx, 36, RuleSignal);
+    enterRule(localCtx, 38, RuleSignal);
 
     auto onExit = finally([&] {
         exitRule();
@@ -1440,40 +1498,40 @@ TSyrecParser::SignalContext* TSyrecParser::signal() {
 
     try {
         enterOuterAlt(localCtx, 1);
-        setState(196);
+        setState(199);
         match(Ident);
-        setState(203);
+        setState(206);
         _errHandler->sync(this);
         std::size_t lookahead = _input->LA(1);
         while (lookahead == OpenSBracket) {
-            setState(197);
+            setState(200);
             match(OpenSBracket);
-            setState(198);
+            setState(201);
             antlrcpp::downCast<SignalContext*>(localCtx)->expressionContext = expression();
             antlrcpp::downCast<SignalContext*>(localCtx)->accessedDimensions.push_back(antlrcpp::downCast<SignalContext*>(localCtx)->expressionContext);
-            setState(199);
+            setState(202);
             match(CloseSBracket);
-            setState(205);
+            setState(208);
             _errHandler->sync(this);
             lookahead = _input->LA(1);
         }
-        setState(212);
+        setState(215);
         _errHandler->sync(this);
 
         lookahead = _input->LA(1);
         if (lookahead == BitrangeStartPrefix) {
-            setState(206);
+            setState(209);
             match(BitrangeStartPrefix);
-            setState(207);
-            antlrcpp::downCast<SignalContext*>(localCtx)->bitStart = number();
             setState(210);
+            antlrcpp::downCast<SignalContext*>(localCtx)->bitStart = number();
+            setState(213);
             _errHandler->sync(this);
 
             lookahead = _input->LA(1);
             if (lookahead == BitrangEndPrefix) {
-                setState(208);
+                setState(211);
                 match(BitrangEndPrefix);
-                setState(209);
+                setState(212);
                 antlrcpp::downCast<SignalContext*>(localCtx)->bitRangeEnd = number();
             }
         }
@@ -1521,8 +1579,8 @@ TSyrecParser::ExpressionFromBinaryExpressionContext::ExpressionFromBinaryExpress
 }
 //----------------- ExpressionFromNumberContext ------------------------------------------------------------------
 
-TSyrecParser::NumberContext* TSyrecParser::ExpressionFromNumberContext::number() const {
-    return getRuleContext<NumberContext>(0);
+TSyrecParser::AtomicNumberContext* TSyrecParser::ExpressionFromNumberContext::atomicNumber() const {
+    return getRuleContext<AtomicNumberContext>(0);
 }
 
 TSyrecParser::ExpressionFromNumberContext::ExpressionFromNumberContext(ExpressionContext* ctx) {
@@ -1537,70 +1595,58 @@ TSyrecParser::UnaryExpressionContext* TSyrecParser::ExpressionFromUnaryExpressio
 TSyrecParser::ExpressionFromUnaryExpressionContext::ExpressionFromUnaryExpressionContext(ExpressionContext* ctx) {
     copyFrom(ctx);
 }
-//----------------- ExpressionFromShiftExpressionContext ------------------------------------------------------------------
-
-TSyrecParser::ShiftExpressionContext* TSyrecParser::ExpressionFromShiftExpressionContext::shiftExpression() const {
-    return getRuleContext<ShiftExpressionContext>(0);
-}
-
-TSyrecParser::ExpressionFromShiftExpressionContext::ExpressionFromShiftExpressionContext(ExpressionContext* ctx) {
-    copyFrom(ctx);
-}
 
 TSyrecParser::ExpressionContext* TSyrecParser::expression() {
     auto* localCtx = _tracker.createInstance<ExpressionContext>(_ctx, getState());
-    enterRule(localCtx, 38, RuleExpression);
+    enterRule(localCtx, 40, RuleExpression);
 
     auto onExit = finally([&] {
         exitRule();
     });
 
     try {
-        setState(219);
+        setState(221);
         _errHandler->sync(this);
-        switch (getInterpreter<atn::ParserATNSimulator>()->adaptivePredict(_input, 18, _ctx)) {
-            case 1: {
+        switch (_input->LA(1)) {
+            case LoopVariablePrefix:
+            case SignalWidthPrefix:
+            case HexLiteral:
+            case BinaryLiteral:
+            case Int: {
                 localCtx = _tracker.createInstance<ExpressionFromNumberContext>(localCtx);
                 enterOuterAlt(localCtx, 1);
-                setState(214);
-                number();
+                setState(217);
+                atomicNumber();
                 break;
             }
 
-            case 2: {
+            case Ident: {
                 localCtx = _tracker.createInstance<ExpressionFromSignalContext>(localCtx);
                 enterOuterAlt(localCtx, 2);
-                setState(215);
+                setState(218);
                 signal();
                 break;
             }
 
-            case 3: {
+            case OpenRBracket: {
                 localCtx = _tracker.createInstance<ExpressionFromBinaryExpressionContext>(localCtx);
                 enterOuterAlt(localCtx, 3);
-                setState(216);
+                setState(219);
                 binaryExpression();
                 break;
             }
 
-            case 4: {
+            case OpLogicalNegation:
+            case OpBitwiseNegation: {
                 localCtx = _tracker.createInstance<ExpressionFromUnaryExpressionContext>(localCtx);
                 enterOuterAlt(localCtx, 4);
-                setState(217);
+                setState(220);
                 unaryExpression();
                 break;
             }
 
-            case 5: {
-                localCtx = _tracker.createInstance<ExpressionFromShiftExpressionContext>(localCtx);
-                enterOuterAlt(localCtx, 5);
-                setState(218);
-                shiftExpression();
-                break;
-            }
-
             default:
-                break;
+                throw NoViableAltException(this);
         }
 
     } catch (RecognitionException& e) {
@@ -1686,13 +1732,25 @@ tree::TerminalNode* TSyrecParser::BinaryExpressionContext::literalOpGreaterOrEqu
     return getToken(OpGreaterOrEqual, 0);
 }
 
+tree::TerminalNode* TSyrecParser::BinaryExpressionContext::literalOpRightShift() const {
+    return getToken(OpRightShift, 0);
+}
+
+tree::TerminalNode* TSyrecParser::BinaryExpressionContext::literalOpLeftShift() const {
+    return getToken(OpLeftShift, 0);
+}
+
+TSyrecParser::NumberContext* TSyrecParser::BinaryExpressionContext::number() const {
+    return getRuleContext<NumberContext>(0);
+}
+
 size_t TSyrecParser::BinaryExpressionContext::getRuleIndex() const {
     return RuleBinaryExpression;
 }
 
 TSyrecParser::BinaryExpressionContext* TSyrecParser::binaryExpression() {
     auto* localCtx = _tracker.createInstance<BinaryExpressionContext>(_ctx, getState());
-    enterRule(localCtx, 40, RuleBinaryExpression);
+    enterRule(localCtx, 42, RuleBinaryExpression);
 
     auto onExit = finally([&] {
         exitRule();
@@ -1700,22 +1758,63 @@ TSyrecParser::BinaryExpressionContext* TSyrecParser::binaryExpression() {
 
     try {
         enterOuterAlt(localCtx, 1);
-        setState(221);
+        setState(223);
         match(OpenRBracket);
-        setState(222);
+        setState(224);
         antlrcpp::downCast<BinaryExpressionContext*>(localCtx)->lhsOperand = expression();
-        setState(223);
-        antlrcpp::downCast<BinaryExpressionContext*>(localCtx)->binaryOperation = _input->LT(1);
-        const std::size_t lookahead                                             = _input->LA(1);
-        if (!((((lookahead & ~0x3fULL) == 0) && ((1ULL << lookahead) & 452927360) != 0))) {
-            antlrcpp::downCast<BinaryExpressionContext*>(localCtx)->binaryOperation = _errHandler->recoverInline(this);
-        } else {
-            _errHandler->reportMatch(this);
-            consume();
+        setState(229);
+        _errHandler->sync(this);
+        switch (_input->LA(1)) {
+            case OpPlus:
+            case OpMinus:
+            case OpMultiply:
+            case OpUpperBitMultiply:
+            case OpDivision:
+            case OpModulo:
+            case OpGreaterOrEqual:
+            case OpLessOrEqual:
+            case OpGreaterThan:
+            case OpLessThan:
+            case OpEqual:
+            case OpNotEqual:
+            case OpLogicalAnd:
+            case OpLogicalOr:
+            case OpBitwiseAnd:
+            case OpBitwiseOr:
+            case OpBitwiseXor: {
+                setState(225);
+                antlrcpp::downCast<BinaryExpressionContext*>(localCtx)->binaryOperation = _input->LT(1);
+                const std::size_t lookahead                                             = _input->LA(1);
+                if (!((((lookahead & ~0x3fULL) == 0) && ((1ULL << lookahead) & 452927360) != 0))) {
+                    antlrcpp::downCast<BinaryExpressionContext*>(localCtx)->binaryOperation = _errHandler->recoverInline(this);
+                } else {
+                    _errHandler->reportMatch(this);
+                    consume();
+                }
+                setState(226);
+                antlrcpp::downCast<BinaryExpressionContext*>(localCtx)->rhsOperand = expression();
+                break;
+            }
+
+            case OpLeftShift:
+            case OpRightShift: {
+                setState(227);
+                antlrcpp::downCast<BinaryExpressionContext*>(localCtx)->shiftOperation = _input->LT(1);
+                if (const std::size_t lookahead = _input->LA(1); lookahead != OpLeftShift && lookahead != OpRightShift) {
+                    antlrcpp::downCast<BinaryExpressionContext*>(localCtx)->shiftOperation = _errHandler->recoverInline(this);
+                } else {
+                    _errHandler->reportMatch(this);
+                    consume();
+                }
+                setState(228);
+                antlrcpp::downCast<BinaryExpressionContext*>(localCtx)->shiftAmount = number();
+                break;
+            }
+
+            default:
+                throw NoViableAltException(this);
         }
-        setState(224);
-        antlrcpp::downCast<BinaryExpressionContext*>(localCtx)->rhsOperand = expression();
-        setState(225);
+        setState(231);
         match(CloseRBracket);
 
     } catch (RecognitionException& e) {
@@ -1751,7 +1850,7 @@ size_t TSyrecParser::UnaryExpressionContext::getRuleIndex() const {
 
 TSyrecParser::UnaryExpressionContext* TSyrecParser::unaryExpression() {
     auto* localCtx = _tracker.createInstance<UnaryExpressionContext>(_ctx, getState());
-    enterRule(localCtx, 42, RuleUnaryExpression);
+    enterRule(localCtx, 44, RuleUnaryExpression);
 
     auto onExit = finally([&] {
         exitRule();
@@ -1759,7 +1858,7 @@ TSyrecParser::UnaryExpressionContext* TSyrecParser::unaryExpression() {
 
     try {
         enterOuterAlt(localCtx, 1);
-        setState(227);
+        setState(233);
         antlrcpp::downCast<UnaryExpressionContext*>(localCtx)->unaryOperation = _input->LT(1);
         const std::size_t lookahead                                           = _input->LA(1);
         if (lookahead != OpLogicalNegation && lookahead != OpBitwiseNegation) {
@@ -1768,7 +1867,7 @@ TSyrecParser::UnaryExpressionContext* TSyrecParser::unaryExpression() {
             _errHandler->reportMatch(this);
             consume();
         }
-        setState(228);
+        setState(234);
         expression();
 
     } catch (RecognitionException& e) {
@@ -1780,68 +1879,6 @@ TSyrecParser::UnaryExpressionContext* TSyrecParser::unaryExpression() {
     return localCtx;
 }
 
-//----------------- ShiftExpressionContext ------------------------------------------------------------------
-
-TSyrecParser::ShiftExpressionContext::ShiftExpressionContext(ParserRuleContext* parent, size_t invokingState):
-    ParserRuleContext(parent, invokingState) {
-}
-
-TSyrecParser::ExpressionContext* TSyrecParser::ShiftExpressionContext::expression() const {
-    return getRuleContext<ExpressionContext>(0);
-}
-
-TSyrecParser::NumberContext* TSyrecParser::ShiftExpressionContext::number() const {
-    return getRuleContext<NumberContext>(0);
-}
-
-tree::TerminalNode* TSyrecParser::ShiftExpressionContext::literalOpRightShift() const {
-    return getToken(OpRightShift, 0);
-}
-
-tree::TerminalNode* TSyrecParser::ShiftExpressionContext::literalOpLeftShift() const {
-    return getToken(OpLeftShift, 0);
-}
-
-size_t TSyrecParser::ShiftExpressionContext::getRuleIndex() const {
-    return RuleShiftExpression;
-}
-
-TSyrecParser::ShiftExpressionContext* TSyrecParser::shiftExpression() {
-    auto* localCtx = _tracker.createInstance<ShiftExpressionContext>(_ctx, getState());
-    enterRule(localCtx, 44, RuleShiftExpression);
-
-    auto onExit = finally([&] {
-        exitRule();
-    });
-
-    try {
-        enterOuterAlt(localCtx, 1);
-        setState(230);
-        match(OpenRBracket);
-        setState(231);
-        expression();
-        setState(232);
-        antlrcpp::downCast<ShiftExpressionContext*>(localCtx)->shiftOperation = _input->LT(1);
-        if (const std::size_t lookahead = _input->LA(1); lookahead != OpLeftShift && lookahead != OpRightShift) {
-            antlrcpp::downCast<ShiftExpressionContext*>(localCtx)->shiftOperation = _errHandler->recoverInline(this);
-        } else {
-            _errHandler->reportMatch(this);
-            consume();
-        }
-        setState(233);
-        number();
-        setState(233);
-        match(CloseRBracket);
-
-    } catch (RecognitionException& e) {
-        _errHandler->reportError(this, e);
-        localCtx->exception = std::current_exception();
-        _errHandler->recover(this, localCtx->exception);
-    }
-
-    return localCtx;
-}
-
 void TSyrecParser::initialize() {
     call_once(parserSingletonInitializationSyncFlag, initializeStaticParserData);
 }
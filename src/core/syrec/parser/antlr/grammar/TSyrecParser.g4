@@ -14,14 +14,18 @@ options {
 	tokenVocab = TSyrecLexer;
 }
 
-/* Number production */
+/* Number productions */
 number:
+	atomicNumber					# NumberFromAtomicNumber
+	| ( OPEN_RBRACKET lhsOperand=number op=( OP_PLUS | OP_MINUS | OP_MULTIPLY | OP_DIVISION ) rhsOperand=number CLOSE_RBRACKET ) # NumberFromExpression
+	;
+
+atomicNumber:
     HEX_LITERAL                     # NumberFromHexLiteral
     | BINARY_LITERAL                # NumberFromBinaryLiteral
 	| INT							# NumberFromInteger
 	| SIGNAL_WIDTH_PREFIX IDENT		# NumberFromSignalwidth
 	| LOOP_VARIABLE_PREFIX IDENT	# NumberFromLoopVariable
-	| ( OPEN_RBRACKET lhsOperand=number op=( OP_PLUS | OP_MINUS | OP_MULTIPLY | OP_DIVISION ) rhsOperand=number CLOSE_RBRACKET ) # NumberFromExpression
 	;
 
 /* Program and modules productions */
@@ -104,15 +108,15 @@ signal: IDENT ( OPEN_SBRACKET accessedDimensions+=expression CLOSE_SBRACKET )* (
 /* Expression productions */
 
 expression:
-	number						# ExpressionFromNumber
+	atomicNumber				# ExpressionFromNumber
 	| signal					# ExpressionFromSignal
 	| binaryExpression			# ExpressionFromBinaryExpression
 	| unaryExpression			# ExpressionFromUnaryExpression
-	| shiftExpression			# ExpressionFromShiftExpression
 	;
 
 binaryExpression:
 	OPEN_RBRACKET lhsOperand=expression
+	(
 		binaryOperation=( OP_PLUS
 		| OP_MINUS
 		| OP_MULTIPLY
@@ -131,9 +135,10 @@ binaryExpression:
 		| OP_LESS_OR_EQUAL
 		| OP_GREATER_OR_EQUAL
 		)
-	rhsOperand=expression  CLOSE_RBRACKET
+		rhsOperand=expression
+		| shiftOperation=( OP_RIGHT_SHIFT | OP_LEFT_SHIFT ) shiftAmount=number
+	)
+	CLOSE_RBRACKET
 	;
 
 unaryExpression: unaryOperation=( OP_LOGICAL_NEGATION | OP_BITWISE_NEGATION ) expression ;
-
-shiftExpression: OPEN_RBRACKET expression shiftOperation=( OP_RIGHT_SHIFT | OP_LEFT_SHIFT ) number CLOSE_RBRACKET ;
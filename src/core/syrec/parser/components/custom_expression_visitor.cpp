@@ -41,11 +41,20 @@ std::optional<syrec::Expression::ptr> CustomExpressionVisitor::visitExpressionTy
     }
 
     if (const auto* const binaryExpressionContext = dynamic_cast<const TSyrecParser::ExpressionFromBinaryExpressionContext*>(context); binaryExpressionContext != nullptr) {
+        // The grammar does not distinguish between binary, shift and constant expressions (i.e. binary expressions whose operands are only numbers and which use one of the operations
+        // allowed in a number) since all of them start with an opening bracket followed by an expression. Said distinction is instead performed here to keep the expression productions
+        // of the grammar decidable with a single token of lookahead.
+        if (binaryExpressionContext->binaryExpression() != nullptr && binaryExpressionContext->binaryExpression()->shiftOperation != nullptr) {
+            return visitShiftExpressionTyped(binaryExpressionContext->binaryExpression(), optionalDeterminedOperandBitwidth);
+        }
+        if (isConstantExpression(binaryExpressionContext)) {
+            if (const auto& generatedNumberContainer = visitConstantExpressionTyped(binaryExpressionContext->binaryExpression()); generatedNumberContainer.has_value()) {
+                return makeIrNode<syrec::NumericExpression>(*generatedNumberContainer, DEFAULT_EXPRESSION_BITWIDTH);
+            }
+            return std::nullopt;
+        }
         return visitBinaryExpressionTyped(binaryExpressionContext->binaryExpression(), optionalDeterminedOperandBitwidth);
     }
-    if (const auto* const shiftExpressionContext = dynamic_cast<const TSyrecParser::ExpressionFromShiftExpressionContext*>(context); shiftExpressionContext != nullptr) {
-        return visitShiftExpressionTyped(shiftExpressionContext->shiftExpression(), optionalDeterminedOperandBitwidth);
-    }
     if (const auto* const unaryExpressionContext = dynamic_cast<const TSyrecParser::ExpressionFromUnaryExpressionContext*>(context); unaryExpressionContext != nullptr) {
         return visitUnaryExpressionTyped(unaryExpressionContext->unaryExpression(), optionalDeterminedOperandBitwidth);
     }
@@ -181,23 +190,23 @@ std::optional<syrec::Expression::ptr> CustomExpressionVisitor::visitBinaryExpres
         // expression and needs to be propagate to any parent expression
         if (const std::optional<syrec::Expression::ptr> simplifiedBinaryExpr = trySimplifyBinaryExpression(syrec::BinaryExpression(*lhsOperand, *mappedToBinaryOperation, *rhsOperand), expectedBitwidthOfOperandsInExpression, nullptr); simplifiedBinaryExpr.has_value()) {
             // If the binary expression evaluated to a numeric expression then the expected operand bitwidth needs to be reset since we cannot assume the expected bitwidth for such an expression.
-            if (const auto& simplifiedBinaryExprAsNumericOne = optionalDeterminedOperandBitwidth.has_value() ? std::dynamic_pointer_cast<syrec::NumericExpression>(*simplifiedBinaryExpr) : nullptr; simplifiedBinaryExprAsNumericOne != nullptr) {
+            if (const auto& simplifiedBinaryExprAsNumericOne = optionalDeterminedOperandBitwidth.has_value() ? syrec::expressionPointerCast<syrec::NumericExpression>(*simplifiedBinaryExpr) : nullptr; simplifiedBinaryExprAsNumericOne != nullptr) {
                 optionalDeterminedOperandBitwidth.reset();
             }
             return simplifiedBinaryExpr;
         }
-        return std::make_shared<syrec::BinaryExpression>(*lhsOperand, *mappedToBinaryOperation, *rhsOperand);
+        return makeIrNode<syrec::BinaryExpression>(*lhsOperand, *mappedToBinaryOperation, *rhsOperand);
     }
     return std::nullopt;
 }
 
-std::optional<syrec::Expression::ptr> CustomExpressionVisitor::visitShiftExpressionTyped(const TSyrecParser::ShiftExpressionContext* context, std::optional<DeterminedExpressionOperandBitwidthInformation>& optionalDeterminedOperandBitwidth) {
+std::optional<syrec::Expression::ptr> CustomExpressionVisitor::visitShiftExpressionTyped(const TSyrecParser::BinaryExpressionContext* context, std::optional<DeterminedExpressionOperandBitwidthInformation>& optionalDeterminedOperandBitwidth) {
     if (context == nullptr) {
         return std::nullopt;
     }
 
     recordExpressionComponent(utils::IfStatementExpressionComponentsRecorder::ExpressionBracketKind::Opening);
-    std::optional<syrec::Expression::ptr>                       toBeShiftedOperand     = visitExpressionTyped(context->expression(), optionalDeterminedOperandBitwidth);
+    std::optional<syrec::Expression::ptr>                       toBeShiftedOperand     = visitExpressionTyped(context->lhsOperand, optionalDeterminedOperandBitwidth);
     const std::optional<syrec::ShiftExpression::ShiftOperation> mappedToShiftOperation = context->shiftOperation != nullptr ? mapTokenToShiftOperation(*context) : std::nullopt;
     if (context->shiftOperation != nullptr && !mappedToShiftOperation.has_value()) {
         recordSemanticError<SemanticError::UnhandledOperationFromGrammarInParser>(mapTokenPositionToMessagePosition(*context->shiftOperation), context->shiftOperation->getText());
@@ -207,7 +216,7 @@ std::optional<syrec::Expression::ptr> CustomExpressionVisitor::visitShiftExpress
         recordExpressionComponent(*mappedToShiftOperation);
     }
 
-    const std::optional<syrec::Number::ptr> shiftAmount = visitNumberTyped(context->number());
+    const std::optional<syrec::Number::ptr> shiftAmount = visitNumberTyped(context->shiftAmount);
     recordExpressionComponent(utils::IfStatementExpressionComponentsRecorder::ExpressionBracketKind::Closing);
     if (!mappedToShiftOperation.has_value()) {
         return std::nullopt;
@@ -221,12 +230,12 @@ std::optional<syrec::Expression::ptr> CustomExpressionVisitor::visitShiftExpress
         const std::optional<unsigned int> expectedBitwidthOfOperandsInLhsOperand = optionalDeterminedOperandBitwidth.has_value() ? std::make_optional(optionalDeterminedOperandBitwidth->operandBitwidth) : std::nullopt;
         if (const std::optional<syrec::Expression::ptr> optionalSimplifiedShiftExpr = trySimplifyShiftExpression(syrec::ShiftExpression(*toBeShiftedOperand, *mappedToShiftOperation, *shiftAmount), expectedBitwidthOfOperandsInLhsOperand); optionalSimplifiedShiftExpr.has_value()) {
             // If the shift expression evaluated to a numeric expression then the expected operand bitwidth needs to be reset since we cannot assume the expected bitwidth for such an expression.
-            if (const auto& simplifiedShiftExprAsNumericOne = optionalDeterminedOperandBitwidth.has_value() ? std::dynamic_pointer_cast<syrec::NumericExpression>(*optionalSimplifiedShiftExpr) : nullptr; simplifiedShiftExprAsNumericOne != nullptr) {
+            if (const auto& simplifiedShiftExprAsNumericOne = optionalDeterminedOperandBitwidth.has_value() ? syrec::expressionPointerCast<syrec::NumericExpression>(*optionalSimplifiedShiftExpr) : nullptr; simplifiedShiftExprAsNumericOne != nullptr) {
                 optionalDeterminedOperandBitwidth.reset();
             }
             return optionalSimplifiedShiftExpr;
         }
-        return std::make_shared<syrec::ShiftExpression>(*toBeShiftedOperand, *mappedToShiftOperation, *shiftAmount);
+        return makeIrNode<syrec::ShiftExpression>(*toBeShiftedOperand, *mappedToShiftOperation, *shiftAmount);
     }
     return std::nullopt;
 }
@@ -289,23 +298,23 @@ std::optional<syrec::Expression::ptr> CustomExpressionVisitor::visitUnaryExpress
         const std::optional<unsigned> constantValueOfUnaryOperand = tryGetConstantValueOf(**unaryExpressionOperand);
         if (const std::optional<unsigned> evaluatedValueOfUnaryExpr = utils::tryEvaluate(*mappedToUnaryOperation, constantValueOfUnaryOperand); evaluatedValueOfUnaryExpr.has_value()) {
             optionalDeterminedOperandBitwidth.reset();
-            return std::make_shared<syrec::NumericExpression>(std::make_shared<syrec::Number>(*evaluatedValueOfUnaryExpr), optionalDeterminedOperandBitwidth.has_value() ? optionalDeterminedOperandBitwidth->operandBitwidth : DEFAULT_EXPRESSION_BITWIDTH);
+            return makeIrNode<syrec::NumericExpression>(makeIrNode<syrec::Number>(*evaluatedValueOfUnaryExpr), optionalDeterminedOperandBitwidth.has_value() ? optionalDeterminedOperandBitwidth->operandBitwidth : DEFAULT_EXPRESSION_BITWIDTH);
         }
-        return std::make_shared<syrec::UnaryExpression>(*mappedToUnaryOperation, *unaryExpressionOperand);
+        return makeIrNode<syrec::UnaryExpression>(*mappedToUnaryOperation, *unaryExpressionOperand);
     }
     return std::nullopt;
 }
 
 std::optional<syrec::Expression::ptr> CustomExpressionVisitor::visitExpressionFromNumberTyped(const TSyrecParser::ExpressionFromNumberContext* context) const {
-    if (const auto& generatedNumberContainer = context != nullptr ? visitNumberTyped(context->number()) : std::nullopt; generatedNumberContainer.has_value()) {
-        return std::make_shared<syrec::NumericExpression>(*generatedNumberContainer, DEFAULT_EXPRESSION_BITWIDTH);
+    if (const auto& generatedNumberContainer = context != nullptr ? visitAtomicNumberTyped(context->atomicNumber()) : std::nullopt; generatedNumberContainer.has_value()) {
+        return makeIrNode<syrec::NumericExpression>(*generatedNumberContainer, DEFAULT_EXPRESSION_BITWIDTH);
     }
     return std::nullopt;
 }
 
 std::optional<syrec::Expression::ptr> CustomExpressionVisitor::visitExpressionFromSignalTyped(const TSyrecParser::ExpressionFromSignalContext* context, std::optional<DeterminedExpressionOperandBitwidthInformation>& optionalDeterminedOperandBitwidth) {
     if (const auto& generatedSignalContainer = context != nullptr ? visitSignalTyped(context->signal(), &optionalDeterminedOperandBitwidth) : std::nullopt; generatedSignalContainer.has_value()) {
-        return std::make_shared<syrec::VariableExpression>(*generatedSignalContainer);
+        return makeIrNode<syrec::VariableExpression>(*generatedSignalContainer);
     }
     return std::nullopt;
 }
@@ -315,6 +324,26 @@ std::optional<syrec::Number::ptr> CustomExpressionVisitor::visitNumberTyped(cons
         return std::nullopt;
     }
 
+    if (const auto* const numberFromAtomicNumberContext = dynamic_cast<const TSyrecParser::NumberFromAtomicNumberContext*>(context); numberFromAtomicNumberContext != nullptr) {
+        return visitAtomicNumberTyped(numberFromAtomicNumberContext->atomicNumber());
+    }
+    if (const auto* const numberFromExpressionContext = dynamic_cast<const TSyrecParser::NumberFromExpressionContext*>(context); numberFromExpressionContext != nullptr) {
+        return visitNumberFromExpressionTyped(numberFromExpressionContext);
+    }
+    // We should not have to report an error at this position since the tokenizer should already report an error if the currently processed token is
+    // not in the union of the FIRST sets of the potential alternatives. However, if the defined variant is not handled by the visitor then this check could help to detect this issue
+    // which normally should not happen. Note that a syntax error in the given number can also trigger this branch since the parser might be "forced" to call this visitor function
+    // since it is the only alternative at the current position in the processed non-terminal symbol of the grammar with the syntax error causing the number to not match any
+    // of the defined alternatives.
+    //recordCustomError(mapTokenPositionToMessagePosition(*context->getStart()), "Unhandled number context variant. This should not happen");
+    return std::nullopt;
+}
+
+std::optional<syrec::Number::ptr> CustomExpressionVisitor::visitAtomicNumberTyped(const TSyrecParser::AtomicNumberContext* context) const {
+    if (context == nullptr) {
+        return std::nullopt;
+    }
+
     if (const auto* const numberFromConstantContext = dynamic_cast<const TSyrecParser::NumberFromIntegerContext*>(context); numberFromConstantContext != nullptr) {
         return visitNumberFromIntegerTyped(numberFromConstantContext);
     }
@@ -324,21 +353,13 @@ std::optional<syrec::Number::ptr> CustomExpressionVisitor::visitNumberTyped(cons
     if (const auto* const numberFromBinaryLiteralContext = dynamic_cast<const TSyrecParser::NumberFromBinaryLiteralContext*>(context); numberFromBinaryLiteralContext != nullptr) {
         return visitNumberFromBinaryLiteralTyped(numberFromBinaryLiteralContext);
     }
-    if (const auto* const numberFromExpressionContext = dynamic_cast<const TSyrecParser::NumberFromExpressionContext*>(context); numberFromExpressionContext != nullptr) {
-        return visitNumberFromExpressionTyped(numberFromExpressionContext);
-    }
     if (const auto* const numberFromLoopVariableContext = dynamic_cast<const TSyrecParser::NumberFromLoopVariableContext*>(context); numberFromLoopVariableContext != nullptr) {
         return visitNumberFromLoopVariableTyped(numberFromLoopVariableContext);
     }
     if (const auto* const numberFromSignalWidthContext = dynamic_cast<const TSyrecParser::NumberFromSignalwidthContext*>(context); numberFromSignalWidthContext != nullptr) {
         return visitNumberFromSignalwidthTyped(numberFromSignalWidthContext);
     }
-    // We should not have to report an error at this position since the tokenizer should already report an error if the currently processed token is
-    // not in the union of the FIRST sets of the potential alternatives. However, if the defined variant is not handled by the visitor then this check could help to detect this issue
-    // which normally should not happen. Note that a syntax error in the given number can also trigger this branch since the parser might be "forced" to call this visitor function
-    // since it is the only alternative at the current position in the processed non-terminal symbol of the grammar with the syntax error causing the number to not match any
-    // of the defined alternatives.
-    //recordCustomError(mapTokenPositionToMessagePosition(*context->getStart()), "Unhandled number context variant. This should not happen");
+    // See the comment in visitNumberTyped(...) on why no error is reported for an unhandled variant.
     return std::nullopt;
 }
 
@@ -408,60 +429,32 @@ std::optional<syrec::Number::ptr> CustomExpressionVisitor::visitNumberFromExpres
     std::optional<syrec::Number::ptr> rhsOperand = visitNumberTyped(context->rhsOperand);
     recordExpressionComponent(utils::IfStatementExpressionComponentsRecorder::ExpressionBracketKind::Closing);
 
-    const std::optional<unsigned int> evaluationResultOfLhsOperand = lhsOperand.has_value() && *lhsOperand ? lhsOperand->get()->tryEvaluate({}) : std::nullopt;
-    const std::optional<unsigned int> evaluationResultOfRhsOperand = rhsOperand.has_value() && *rhsOperand ? rhsOperand->get()->tryEvaluate({}) : std::nullopt;
+    return trySimplifyConstantExpression(lhsOperand, operation, rhsOperand, context->rhsOperand);
+}
 
-    if (operation.has_value()) {
-        switch (*operation) {
-            case syrec::Number::ConstantExpression::Operation::Addition: {
-                if (evaluationResultOfLhsOperand.has_value() && *evaluationResultOfLhsOperand == 0U) {
-                    return rhsOperand;
-                }
-                if (evaluationResultOfRhsOperand.has_value() && *evaluationResultOfRhsOperand == 0U) {
-                    return lhsOperand;
-                }
-                break;
-            }
-            case syrec::Number::ConstantExpression::Operation::Subtraction: {
-                if (evaluationResultOfRhsOperand.has_value() && *evaluationResultOfRhsOperand == 0) {
-                    return lhsOperand;
-                }
-                break;
-            }
-            case syrec::Number::ConstantExpression::Operation::Multiplication: {
-                if (evaluationResultOfLhsOperand.has_value() && *evaluationResultOfLhsOperand == 1) {
-                    return rhsOperand;
-                }
+std::optional<syrec::Number::ptr> CustomExpressionVisitor::visitConstantExpressionTyped(const TSyrecParser::BinaryExpressionContext* context) const {
+    if (context == nullptr) {
+        return std::nullopt;
+    }
 
-                if (evaluationResultOfRhsOperand.has_value() && *evaluationResultOfRhsOperand == 1) {
-                    return lhsOperand;
-                }
-                break;
-            }
-            case syrec::Number::ConstantExpression::Operation::Division: {
-                if (evaluationResultOfRhsOperand.has_value()) {
-                    if (*evaluationResultOfRhsOperand == 0) {
-                        recordSemanticError<SemanticError::ExpressionEvaluationFailedDueToDivisionByZero>(mapTokenPositionToMessagePosition(*context->rhsOperand->getStart()));
-                        return std::nullopt;
-                    }
-                    if (*evaluationResultOfRhsOperand == 1) {
-                        return lhsOperand;
-                    }
-                }
+    recordExpressionComponent(utils::IfStatementExpressionComponentsRecorder::ExpressionBracketKind::Opening);
+    const std::optional<syrec::Number::ptr> lhsOperand = visitConstantExpressionOperandTyped(context->lhsOperand);
+    if (const std::optional<syrec::BinaryExpression::BinaryOperation> mappedToBinaryOperation = context->binaryOperation != nullptr ? mapTokenToBinaryOperation(*context) : std::nullopt; mappedToBinaryOperation.has_value()) {
+        recordExpressionComponent(*mappedToBinaryOperation);
+    }
+    const std::optional<syrec::Number::ptr> rhsOperand = visitConstantExpressionOperandTyped(context->rhsOperand);
+    recordExpressionComponent(utils::IfStatementExpressionComponentsRecorder::ExpressionBracketKind::Closing);
 
-                if (evaluationResultOfLhsOperand.has_value() && *evaluationResultOfLhsOperand == 0) {
-                    return std::make_shared<syrec::Number>(0);
-                }
-            }
-        }
+    const std::optional<syrec::Number::ConstantExpression::Operation> operation = context->binaryOperation != nullptr ? mapTokenToConstantExpressionOperation(*context) : std::nullopt;
+    return trySimplifyConstantExpression(lhsOperand, operation, rhsOperand, context->rhsOperand);
+}
 
-        if (lhsOperand.has_value() && rhsOperand.has_value()) {
-            const auto constantExpression = syrec::Number::ConstantExpression(*lhsOperand, *operation, *rhsOperand);
-            if (const std::optional<unsigned int> evaluatedConstantExpressionValue = constantExpression.tryEvaluate({}); evaluatedConstantExpressionValue.has_value()) {
-                return std::make_shared<syrec::Number>(*evaluatedConstantExpressionValue);
-            }
-            return std::make_shared<syrec::Number>(constantExpression);
-        }
+std::optional<syrec::Number::ptr> CustomExpressionVisitor::visitConstantExpressionOperandTyped(const TSyrecParser::ExpressionContext* context) const {
+    if (const auto* const expressionFromNumberContext = dynamic_cast<const TSyrecParser::ExpressionFromNumberContext*>(context); expressionFromNumberContext != nullptr) {
+        return visitAtomicNumberTyped(expressionFromNumberContext->atomicNumber());
+    }
+    if (const auto* const binaryExpressionContext = dynamic_cast<const TSyrecParser::ExpressionFromBinaryExpressionContext*>(context); binaryExpressionContext != nullptr) {
+        return visitConstantExpressionTyped(binaryExpressionContext->binaryExpression());
     }
     return std::nullopt;
 }
@@ -483,7 +476,7 @@ std::optional<syrec::Number::ptr> CustomExpressionVisitor::visitNumberFromLoopVa
             recordSemanticError<SemanticError::ValueOfLoopVariableNotUsableInItsInitialValueDeclaration>(mapTokenPositionToMessagePosition(*context->literalLoopVariablePrefix()->getSymbol()), loopVariableIdentifier);
         }
         if (const std::optional<unsigned int> valueOfLoopVariable = activeVariableScopeInSymbolTable->get()->getValueOfLoopVariable(loopVariableIdentifier); valueOfLoopVariable.has_value()) {
-            return std::make_shared<syrec::Number>(*valueOfLoopVariable);
+            return makeIrNode<syrec::Number>(*valueOfLoopVariable);
         }
         if (const std::optional<syrec::Number::ptr>& symbolTableEntryForLoopVariable = matchingLoopVariableForIdentifier->get()->getLoopVariableData(); symbolTableEntryForLoopVariable.has_value()) {
             return symbolTableEntryForLoopVariable;
@@ -514,7 +507,7 @@ std::optional<syrec::Number::ptr> CustomExpressionVisitor::visitNumberFromSignal
     recordExpressionComponent(context->literalSignalWidthPrefix()->getSymbol()->getText() + variableIdentifier);
     if (const std::optional<utils::TemporaryVariableScope::ScopeEntry::readOnlyPtr> matchingVariableForIdentifier = activeVariableScopeInSymbolTable->get()->getVariableByName(variableIdentifier); matchingVariableForIdentifier.has_value()) {
         if (matchingVariableForIdentifier->get()->getDeclaredVariableBitwidth().has_value()) {
-            return std::make_shared<syrec::Number>(*matchingVariableForIdentifier->get()->getDeclaredVariableBitwidth());
+            return makeIrNode<syrec::Number>(*matchingVariableForIdentifier->get()->getDeclaredVariableBitwidth());
         }
         return std::nullopt;
     }
@@ -548,7 +541,7 @@ std::optional<syrec::VariableAccess::ptr> CustomExpressionVisitor::visitSignalTy
     }
 
     const std::size_t          numUserAccessedDimensions = context->accessedDimensions.size();
-    syrec::VariableAccess::ptr generatedVariableAccess   = std::make_shared<syrec::VariableAccess>();
+    syrec::VariableAccess::ptr generatedVariableAccess   = makeIrNode<syrec::VariableAccess>();
     generatedVariableAccess->indexes                     = syrec::Expression::vec(numUserAccessedDimensions, nullptr);
 
     std::optional<bool> backupOfStatusWhetherDimensionAccessIsCurrentlyProcessed;
@@ -600,7 +593,7 @@ std::optional<syrec::VariableAccess::ptr> CustomExpressionVisitor::visitSignalTy
 
         if (numUserAccessedDimensions == 0) {
             if (declaredValuesPerDimensionOfReferenceVariable.size() == 1 && declaredValuesPerDimensionOfReferenceVariable.front() == 1) {
-                generatedVariableAccess->indexes.emplace_back(std::make_shared<syrec::NumericExpression>(std::make_shared<syrec::Number>(0), 1));
+                generatedVariableAccess->indexes.emplace_back(makeIrNode<syrec::NumericExpression>(makeIrNode<syrec::Number>(0), 1));
             } else {
                 recordSemanticError<SemanticError::OmittingDimensionAccessOnlyPossibleFor1DSignalWithSingleValue>(mapTokenPositionToMessagePosition(*context->literalIdent()->getSymbol()));
             }
@@ -676,7 +669,7 @@ std::optional<syrec::VariableAccess::ptr> CustomExpressionVisitor::visitSignalTy
 
     // Since the error reported when defining an overlapping variable access is reported at the position of the variable identifier, this check needs to be performed prior
     // to the check for matching operand bitwidths (if no internal ordering of the reported errors is performed [which is currently the case])
-    if (const std::optional<utils::VariableAccessOverlapCheckResult>& overlapCheckResultWithRestrictedVariableParts = optionalRestrictionOnVariableAccesses.has_value() && *optionalRestrictionOnVariableAccesses && (!isCurrentlyProcessingDimensionAccessOfVariableAccess() || !parserConfiguration.allowAccessOnAssignedToVariablePartsInDimensionAccessOfVariableAccess) ? utils::checkOverlapBetweenVariableAccesses(**optionalRestrictionOnVariableAccesses, *generatedVariableAccess) : std::nullopt;
+    if (const std::optional<utils::VariableAccessOverlapCheckResult>& overlapCheckResultWithRestrictedVariableParts = optionalRestrictionOnVariableAccesses.has_value() && (!isCurrentlyProcessingDimensionAccessOfVariableAccess() || !parserConfiguration.allowAccessOnAssignedToVariablePartsInDimensionAccessOfVariableAccess) ? optionalRestrictionOnVariableAccesses->checkOverlapWith(*generatedVariableAccess) : std::nullopt;
         overlapCheckResultWithRestrictedVariableParts.has_value() && overlapCheckResultWithRestrictedVariableParts->overlapState == utils::VariableAccessOverlapCheckResult::OverlapState::Overlapping) {
         if (!overlapCheckResultWithRestrictedVariableParts->overlappingIndicesInformation.has_value()) {
             recordCustomError(mapTokenPositionToMessagePosition(*context->literalIdent()->getSymbol()), "Overlap with restricted variable parts detected but no further information about overlap available. This should not happen");
@@ -763,7 +756,8 @@ bool CustomExpressionVisitor::setRestrictionOnVariableAccesses(const syrec::Vari
         })) {
         return false;
     }
-    optionalRestrictionOnVariableAccesses = notAccessiblePartsForFutureVariableAccesses;
+    // The restricted variable parts are only evaluated once instead of for every variable access checked against them
+    optionalRestrictionOnVariableAccesses.emplace(*notAccessiblePartsForFutureVariableAccesses);
     return true;
 }
 
@@ -771,13 +765,13 @@ bool CustomExpressionVisitor::isCurrentlyProcessingDimensionAccessOfVariableAcce
     return isCurrentlyProcessingDimensionAccessOfVariableAccessFlag;
 }
 
-bool CustomExpressionVisitor::truncateConstantValuesInExpression(syrec::Expression::ptr& expression, unsigned int expectedBitwidthOfOperandsInExpression, const utils::IntegerConstantTruncationOperation truncationOperationToUseForIntegerConstants, bool* detectedDivisionByZero) {
+bool CustomExpressionVisitor::truncateConstantValuesInExpression(syrec::Expression::ptr& expression, unsigned int expectedBitwidthOfOperandsInExpression, const utils::IntegerConstantTruncationOperation truncationOperationToUseForIntegerConstants, bool* detectedDivisionByZero) const {
     if (expression == nullptr) {
         return false;
     }
 
     bool wasOriginalExprModified = false;
-    if (auto* const exprAsBinaryExpr = dynamic_cast<syrec::BinaryExpression*>(&*expression); exprAsBinaryExpr != nullptr) {
+    if (auto* const exprAsBinaryExpr = syrec::expressionCast<syrec::BinaryExpression>(&*expression); exprAsBinaryExpr != nullptr) {
         if (isBinaryOperationARelationalOrLogicalOne(exprAsBinaryExpr->binaryOperation)) {
             return false;
         }
@@ -790,12 +784,12 @@ bool CustomExpressionVisitor::truncateConstantValuesInExpression(syrec::Expressi
                 return true;
             }
         }
-    } else if (auto* const exprAsShiftExpr = dynamic_cast<syrec::ShiftExpression*>(&*expression); exprAsShiftExpr != nullptr) {
+    } else if (auto* const exprAsShiftExpr = syrec::expressionCast<syrec::ShiftExpression>(&*expression); exprAsShiftExpr != nullptr) {
         wasOriginalExprModified = truncateConstantValuesInExpression(exprAsShiftExpr->lhs, expectedBitwidthOfOperandsInExpression, truncationOperationToUseForIntegerConstants, detectedDivisionByZero);
         if (const std::optional<syrec::Expression::ptr> simplfifiedShiftExpr = trySimplifyShiftExpression(*exprAsShiftExpr, expectedBitwidthOfOperandsInExpression); simplfifiedShiftExpr.has_value()) {
             expression = *simplfifiedShiftExpr;
         }
-    } else if (auto* const exprAsNumericExpr = dynamic_cast<syrec::NumericExpression*>(&*expression); exprAsNumericExpr != nullptr) {
+    } else if (auto* const exprAsNumericExpr = syrec::expressionCast<syrec::NumericExpression>(&*expression); exprAsNumericExpr != nullptr) {
         if (exprAsNumericExpr->value == nullptr) {
             return false;
         }
@@ -806,7 +800,7 @@ bool CustomExpressionVisitor::truncateConstantValuesInExpression(syrec::Expressi
         }
 
         if (const std::optional<unsigned int> constantValueOfNumericExpr = exprAsNumericExpr->value->tryEvaluate({}); constantValueOfNumericExpr.has_value()) {
-            exprAsNumericExpr->value  = std::make_shared<syrec::Number>(truncateConstantValueToExpectedBitwidth(*constantValueOfNumericExpr, expectedBitwidthOfOperandsInExpression, truncationOperationToUseForIntegerConstants));
+            exprAsNumericExpr->value  = makeIrNode<syrec::Number>(truncateConstantValueToExpectedBitwidth(*constantValueOfNumericExpr, expectedBitwidthOfOperandsInExpression, truncationOperationToUseForIntegerConstants));
             exprAsNumericExpr->bwidth = expectedBitwidthOfOperandsInExpression;
             wasOriginalExprModified   = true;
         }
@@ -826,7 +820,7 @@ std::optional<syrec::Number::ptr> CustomExpressionVisitor::tryParseNumberFromStr
     bool didDeserializationFailDueToOverflow = false;
     if (const std::optional<unsigned int> constantValue = deserializeConstantFromString(stringifiedNumber, &didDeserializationFailDueToOverflow, expectedBaseOfStringifiedNumber); constantValue.has_value() && !didDeserializationFailDueToOverflow) {
         recordExpressionComponent(*constantValue);
-        return std::make_shared<syrec::Number>(*constantValue);
+        return makeIrNode<syrec::Number>(*constantValue);
     }
 
     if (didDeserializationFailDueToOverflow) {
@@ -893,7 +887,7 @@ std::optional<syrec::BinaryExpression::BinaryOperation> CustomExpressionVisitor:
     return std::nullopt;
 }
 
-std::optional<syrec::ShiftExpression::ShiftOperation> CustomExpressionVisitor::mapTokenToShiftOperation(const TSyrecParser::ShiftExpressionContext& shiftExpressionContext) {
+std::optional<syrec::ShiftExpression::ShiftOperation> CustomExpressionVisitor::mapTokenToShiftOperation(const TSyrecParser::BinaryExpressionContext& shiftExpressionContext) {
     if (shiftExpressionContext.literalOpLeftShift() != nullptr) {
         return syrec::ShiftExpression::ShiftOperation::Left;
     }
@@ -919,6 +913,34 @@ std::optional<syrec::Number::ConstantExpression::Operation> CustomExpressionVisi
     return std::nullopt;
 }
 
+std::optional<syrec::Number::ConstantExpression::Operation> CustomExpressionVisitor::mapTokenToConstantExpressionOperation(const TSyrecParser::BinaryExpressionContext& constantExpressionContext) {
+    if (constantExpressionContext.literalOpPlus() != nullptr) {
+        return syrec::Number::ConstantExpression::Operation::Addition;
+    }
+    if (constantExpressionContext.literalOpMinus() != nullptr) {
+        return syrec::Number::ConstantExpression::Operation::Subtraction;
+    }
+    if (constantExpressionContext.literalOpMultiply() != nullptr) {
+        return syrec::Number::ConstantExpression::Operation::Multiplication;
+    }
+    if (constantExpressionContext.literalOpDivision() != nullptr) {
+        return syrec::Number::ConstantExpression::Operation::Division;
+    }
+    return std::nullopt;
+}
+
+bool CustomExpressionVisitor::isConstantExpression(const TSyrecParser::ExpressionContext* expressionContext) {
+    if (dynamic_cast<const TSyrecParser::ExpressionFromNumberContext*>(expressionContext) != nullptr) {
+        return true;
+    }
+    const auto* const binaryExpressionContext = dynamic_cast<const TSyrecParser::ExpressionFromBinaryExpressionContext*>(expressionContext);
+    if (binaryExpressionContext == nullptr || binaryExpressionContext->binaryExpression() == nullptr) {
+        return false;
+    }
+    const TSyrecParser::BinaryExpressionContext& binaryExpression = *binaryExpressionContext->binaryExpression();
+    return binaryExpression.binaryOperation != nullptr && mapTokenToConstantExpressionOperation(binaryExpression).has_value() && isConstantExpression(binaryExpression.lhsOperand) && isConstantExpression(binaryExpression.rhsOperand);
+}
+
 std::optional<syrec::UnaryExpression::UnaryOperation> CustomExpressionVisitor::mapTokenToUnaryOperation(const TSyrecParser::UnaryExpressionContext& unaryExpressionContext) {
     if (unaryExpressionContext.literalOpLogicalNegation() != nullptr) {
         return syrec::UnaryExpression::UnaryOperation::LogicalNegation;
@@ -929,7 +951,66 @@ std::optional<syrec::UnaryExpression::UnaryOperation> CustomExpressionVisitor::m
     return std::nullopt;
 }
 
-std::optional<syrec::Expression::ptr> CustomExpressionVisitor::trySimplifyBinaryExpressionWithConstantValueOfOneOperandKnown(unsigned int knownOperandValue, syrec::BinaryExpression::BinaryOperation binaryOperation, const syrec::Expression::ptr& unknownOperandValue, bool isValueOfLhsOperandKnown) {
+std::optional<syrec::Number::ptr> CustomExpressionVisitor::trySimplifyConstantExpression(const std::optional<syrec::Number::ptr>& lhsOperand, const std::optional<syrec::Number::ConstantExpression::Operation>& operation, const std::optional<syrec::Number::ptr>& rhsOperand, const antlr4::ParserRuleContext* rhsOperandContext) const {
+    const std::optional<unsigned int> evaluationResultOfLhsOperand = lhsOperand.has_value() && *lhsOperand ? lhsOperand->get()->tryEvaluate({}) : std::nullopt;
+    const std::optional<unsigned int> evaluationResultOfRhsOperand = rhsOperand.has_value() && *rhsOperand ? rhsOperand->get()->tryEvaluate({}) : std::nullopt;
+
+    if (operation.has_value()) {
+        switch (*operation) {
+            case syrec::Number::ConstantExpression::Operation::Addition: {
+                if (evaluationResultOfLhsOperand.has_value() && *evaluationResultOfLhsOperand == 0U) {
+                    return rhsOperand;
+                }
+                if (evaluationResultOfRhsOperand.has_value() && *evaluationResultOfRhsOperand == 0U) {
+                    return lhsOperand;
+                }
+                break;
+            }
+            case syrec::Number::ConstantExpression::Operation::Subtraction: {
+                if (evaluationResultOfRhsOperand.has_value() && *evaluationResultOfRhsOperand == 0) {
+                    return lhsOperand;
+                }
+                break;
+            }
+            case syrec::Number::ConstantExpression::Operation::Multiplication: {
+                if (evaluationResultOfLhsOperand.has_value() && *evaluationResultOfLhsOperand == 1) {
+                    return rhsOperand;
+                }
+
+                if (evaluationResultOfRhsOperand.has_value() && *evaluationResultOfRhsOperand == 1) {
+                    return lhsOperand;
+                }
+                break;
+            }
+            case syrec::Number::ConstantExpression::Operation::Division: {
+                if (evaluationResultOfRhsOperand.has_value()) {
+                    if (*evaluationResultOfRhsOperand == 0) {
+                        recordSemanticError<SemanticError::ExpressionEvaluationFailedDueToDivisionByZero>(mapTokenPositionToMessagePosition(*rhsOperandContext->getStart()));
+                        return std::nullopt;
+                    }
+                    if (*evaluationResultOfRhsOperand == 1) {
+                        return lhsOperand;
+                    }
+                }
+
+                if (evaluationResultOfLhsOperand.has_value() && *evaluationResultOfLhsOperand == 0) {
+                    return makeIrNode<syrec::Number>(0);
+                }
+            }
+        }
+
+        if (lhsOperand.has_value() && rhsOperand.has_value()) {
+            const auto constantExpression = syrec::Number::ConstantExpression(*lhsOperand, *operation, *rhsOperand);
+            if (const std::optional<unsigned int> evaluatedConstantExpressionValue = constantExpression.tryEvaluate({}); evaluatedConstantExpressionValue.has_value()) {
+                return makeIrNode<syrec::Number>(*evaluatedConstantExpressionValue);
+            }
+            return makeIrNode<syrec::Number>(constantExpression);
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<syrec::Expression::ptr> CustomExpressionVisitor::trySimplifyBinaryExpressionWithConstantValueOfOneOperandKnown(unsigned int knownOperandValue, syrec::BinaryExpression::BinaryOperation binaryOperation, const syrec::Expression::ptr& unknownOperandValue, bool isValueOfLhsOperandKnown) const {
     if (knownOperandValue > 1) {
         return std::nullopt;
     }
@@ -940,9 +1021,9 @@ std::optional<syrec::Expression::ptr> CustomExpressionVisitor::trySimplifyBinary
             case syrec::BinaryExpression::BinaryOperation::FracDivide:
                 return unknownOperandValue;
             case syrec::BinaryExpression::BinaryOperation::Modulo:
-                return isValueOfLhsOperandKnown ? std::make_shared<syrec::NumericExpression>(std::make_shared<syrec::Number>(1), 1) : std::make_shared<syrec::NumericExpression>(std::make_shared<syrec::Number>(0), 1);
+                return isValueOfLhsOperandKnown ? makeIrNode<syrec::NumericExpression>(makeIrNode<syrec::Number>(1), 1) : makeIrNode<syrec::NumericExpression>(makeIrNode<syrec::Number>(0), 1);
             case syrec::BinaryExpression::BinaryOperation::LogicalOr:
-                return std::make_shared<syrec::NumericExpression>(std::make_shared<syrec::Number>(1), 1);
+                return makeIrNode<syrec::NumericExpression>(makeIrNode<syrec::Number>(1), 1);
             case syrec::BinaryExpression::BinaryOperation::Divide:
                 return !isValueOfLhsOperandKnown ? std::make_optional(unknownOperandValue) : std::nullopt;
             default:
@@ -955,7 +1036,7 @@ std::optional<syrec::Expression::ptr> CustomExpressionVisitor::trySimplifyBinary
         case syrec::BinaryExpression::BinaryOperation::LogicalAnd:
         case syrec::BinaryExpression::BinaryOperation::BitwiseAnd:
         case syrec::BinaryExpression::BinaryOperation::Multiply:
-            return std::make_shared<syrec::NumericExpression>(std::make_shared<syrec::Number>(0), 1);
+            return makeIrNode<syrec::NumericExpression>(makeIrNode<syrec::Number>(0), 1);
         case syrec::BinaryExpression::BinaryOperation::LogicalOr:
         case syrec::BinaryExpression::BinaryOperation::BitwiseOr:
         case syrec::BinaryExpression::BinaryOperation::Add:
@@ -967,14 +1048,14 @@ std::optional<syrec::Expression::ptr> CustomExpressionVisitor::trySimplifyBinary
         case syrec::BinaryExpression::BinaryOperation::Divide:
         case syrec::BinaryExpression::BinaryOperation::FracDivide:
         case syrec::BinaryExpression::BinaryOperation::Modulo:
-            return isValueOfLhsOperandKnown ? std::make_optional(std::make_shared<syrec::NumericExpression>(std::make_shared<syrec::Number>(0), 1)) : std::nullopt;
+            return isValueOfLhsOperandKnown ? std::make_optional(makeIrNode<syrec::NumericExpression>(makeIrNode<syrec::Number>(0), 1)) : std::nullopt;
         default:
             break;
     }
     return std::nullopt;
 }
 
-std::optional<syrec::Expression::ptr> CustomExpressionVisitor::trySimplifyShiftExpression(const syrec::ShiftExpression& shiftExpr, const std::optional<unsigned int>& optionalBitwidthOfOperandsInExpression) {
+std::optional<syrec::Expression::ptr> CustomExpressionVisitor::trySimplifyShiftExpression(const syrec::ShiftExpression& shiftExpr, const std::optional<unsigned int>& optionalBitwidthOfOperandsInExpression) const {
     syrec::Expression::ptr   toBeShiftedOperand = shiftExpr.lhs;
     const syrec::Number::ptr shiftAmount        = shiftExpr.rhs;
 
@@ -992,16 +1073,16 @@ std::optional<syrec::Expression::ptr> CustomExpressionVisitor::trySimplifyShiftE
     }
     if (constantValueOfToBeShiftedOperand.has_value()) {
         if (const std::optional<unsigned int> evaluationResultOfShiftOperation = utils::tryEvaluate(constantValueOfToBeShiftedOperand, shiftExpr.shiftOperation, constantValueOfShiftAmount); evaluationResultOfShiftOperation.has_value()) {
-            return std::make_shared<syrec::NumericExpression>(std::make_shared<syrec::Number>(*evaluationResultOfShiftOperation), optionalBitwidthOfOperandsInExpression.value_or(DEFAULT_EXPRESSION_BITWIDTH));
+            return makeIrNode<syrec::NumericExpression>(makeIrNode<syrec::Number>(*evaluationResultOfShiftOperation), optionalBitwidthOfOperandsInExpression.value_or(DEFAULT_EXPRESSION_BITWIDTH));
         }
     }
     if (*constantValueOfShiftAmount >= optionalBitwidthOfOperandsInExpression.value_or(MAX_SUPPORTED_SIGNAL_BITWIDTH)) {
-        return std::make_shared<syrec::NumericExpression>(std::make_shared<syrec::Number>(0), optionalBitwidthOfOperandsInExpression.value_or(1));
+        return makeIrNode<syrec::NumericExpression>(makeIrNode<syrec::Number>(0), optionalBitwidthOfOperandsInExpression.value_or(1));
     }
     return std::nullopt;
 }
 
-std::optional<syrec::Expression::ptr> CustomExpressionVisitor::trySimplifyBinaryExpression(const syrec::BinaryExpression& binaryExpr, const std::optional<unsigned int>& optionalBitwidthOfOperandsInExpression, bool* detectedDivisionByZero) {
+std::optional<syrec::Expression::ptr> CustomExpressionVisitor::trySimplifyBinaryExpression(const syrec::BinaryExpression& binaryExpr, const std::optional<unsigned int>& optionalBitwidthOfOperandsInExpression, bool* detectedDivisionByZero) const {
     const std::optional<unsigned int> constantValueOfLhsOperand = binaryExpr.lhs != nullptr ? tryGetConstantValueOf(*binaryExpr.lhs) : std::nullopt;
     const std::optional<unsigned int> constantValueOfRhsOperand = binaryExpr.rhs != nullptr ? tryGetConstantValueOf(*binaryExpr.rhs) : std::nullopt;
     if (detectedDivisionByZero != nullptr) {
@@ -1013,7 +1094,7 @@ std::optional<syrec::Expression::ptr> CustomExpressionVisitor::trySimplifyBinary
 
     if (constantValueOfLhsOperand.has_value() && constantValueOfRhsOperand.has_value()) {
         if (const std::optional<unsigned int> evaluationResultOfExpr = utils::tryEvaluate(constantValueOfLhsOperand, binaryExpr.binaryOperation, constantValueOfRhsOperand); evaluationResultOfExpr.has_value()) {
-            return std::make_shared<syrec::NumericExpression>(std::make_shared<syrec::Number>(*evaluationResultOfExpr), optionalBitwidthOfOperandsInExpression.value_or(DEFAULT_EXPRESSION_BITWIDTH));
+            return makeIrNode<syrec::NumericExpression>(makeIrNode<syrec::Number>(*evaluationResultOfExpr), optionalBitwidthOfOperandsInExpression.value_or(DEFAULT_EXPRESSION_BITWIDTH));
         }
     }
 
@@ -29,24 +29,65 @@
 #include <optional>
 #include <regex>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <variant>
 #include <vector>
 
 using namespace syrec_parser;
 
+namespace {
+    void collectIdentifiersOfCalledModules(const TSyrecParser::StatementListContext* context, std::vector<std::string>& identifiersOfCalledModules) {
+        if (context == nullptr) {
+            return;
+        }
+        for (const TSyrecParser::StatementContext* antlrStatementContext: context->stmts) {
+            if (antlrStatementContext == nullptr) {
+                continue;
+            }
+            if (const TSyrecParser::CallStatementContext* callStatementContext = antlrStatementContext->callStatement(); callStatementContext != nullptr && callStatementContext->moduleIdent != nullptr) {
+                identifiersOfCalledModules.emplace_back(callStatementContext->moduleIdent->getText());
+            } else if (const TSyrecParser::ForStatementContext* forStatementContext = antlrStatementContext->forStatement(); forStatementContext != nullptr) {
+                collectIdentifiersOfCalledModules(forStatementContext->statementList(), identifiersOfCalledModules);
+            } else if (const TSyrecParser::IfStatementContext* ifStatementContext = antlrStatementContext->ifStatement(); ifStatementContext != nullptr) {
+                collectIdentifiersOfCalledModules(ifStatementContext->trueBranchStmts, identifiersOfCalledModules);
+                collectIdentifiersOfCalledModules(ifStatementContext->falseBranchStmts, identifiersOfCalledModules);
+            }
+        }
+    }
+} // namespace
+
 std::optional<std::shared_ptr<syrec::Program>> CustomModuleVisitor::parseProgram(const TSyrecParser::ProgramContext* context) const {
     return visitProgramTyped(context);
 }
 
+std::optional<std::shared_ptr<syrec::Program>> CustomModuleVisitor::parseModuleLibrary(const TSyrecParser::ProgramContext* context) {
+    isParsingModuleLibrary                                             = true;
+    const std::optional<std::shared_ptr<syrec::Program>> parsedLibrary = visitProgramTyped(context);
+    isParsingModuleLibrary                                             = false;
+    return parsedLibrary;
+}
+
+void CustomModuleVisitor::declareModulesDefinedOutsideOfProgram(const syrec::Module::vec& modules) const {
+    for (const syrec::Module::ptr& module: modules) {
+        symbolTable->insertModule(module);
+    }
+}
+
 // START OF NON-PUBLIC FUNCTIONALITY
 std::optional<std::shared_ptr<syrec::Program>> CustomModuleVisitor::visitProgramTyped(const TSyrecParser::ProgramContext* context) const {
     if (context == nullptr) {
         return std::nullopt;
     }
 
-    std::shared_ptr<const syrec::Module> lastProcessedUserDefinedModule = nullptr;
-    auto                                 generatedProgram               = std::make_shared<syrec::Program>();
+    const std::optional<std::unordered_set<std::string>> identifiersOfReachableModules  = parserConfiguration.pruneModulesNotReachableFromProgramEntryPoint && !isParsingModuleLibrary ? determineIdentifiersOfModulesReachableFromProgramEntryPoint(context) : std::nullopt;
+    std::shared_ptr<const syrec::Module>                 lastProcessedUserDefinedModule = nullptr;
+    auto                                                 generatedProgram               = std::make_shared<syrec::Program>();
     for (const auto& antlrModuleContext: context->module()) {
+        // Modules not reachable from the program entry point were only validated syntactically by the parser.
+        if (identifiersOfReachableModules.has_value() && antlrModuleContext != nullptr && antlrModuleContext->literalIdent() != nullptr && !identifiersOfReachableModules->contains(antlrModuleContext->literalIdent()->getText())) {
+            continue;
+        }
         if (const std::optional<syrec::Module::ptr>& parsedModule = visitModuleTyped(antlrModuleContext); parsedModule.has_value()) {
             generatedProgram->addModule(*parsedModule);
             lastProcessedUserDefinedModule = *parsedModule;
@@ -54,11 +95,104 @@ std::optional<std::shared_ptr<syrec::Program>> CustomModuleVisitor::visitProgram
             lastProcessedUserDefinedModule.reset();
         }
     }
+    resolveOverloadsOfCallStatements(lastProcessedUserDefinedModule, statementVisitorInstance->getCallStatementsWithNotPerformedOverloadResolution());
+    return generatedProgram;
+}
+
+std::optional<std::unordered_set<std::string>> CustomModuleVisitor::determineIdentifiersOfModulesReachableFromProgramEntryPoint(const TSyrecParser::ProgramContext* context) const {
+    std::unordered_map<std::string, std::vector<const TSyrecParser::ModuleContext*>> moduleDeclarationsPerIdentifier;
+    const TSyrecParser::ModuleContext*                                               lastDeclaredModule = nullptr;
+    for (const TSyrecParser::ModuleContext* antlrModuleContext: context->module()) {
+        if (antlrModuleContext == nullptr || antlrModuleContext->literalIdent() == nullptr) {
+            return std::nullopt;
+        }
+        moduleDeclarationsPerIdentifier[antlrModuleContext->literalIdent()->getText()].emplace_back(antlrModuleContext);
+        lastDeclaredModule = antlrModuleContext;
+    }
+
+    // The program entry point is determined as in resolveOverloadsOfCallStatements(...), the semantic errors of a program without a matching entry point are only reported if all modules are checked.
+    std::string programEntryPointModuleIdentifier = parserConfiguration.optionalProgramEntryPointModuleIdentifier.value_or("main");
+    if (!parserConfiguration.optionalProgramEntryPointModuleIdentifier.has_value() && !moduleDeclarationsPerIdentifier.contains(programEntryPointModuleIdentifier) && lastDeclaredModule != nullptr) {
+        programEntryPointModuleIdentifier = lastDeclaredModule->literalIdent()->getText();
+    }
+    if (!moduleDeclarationsPerIdentifier.contains(programEntryPointModuleIdentifier)) {
+        return std::nullopt;
+    }
 
+    // Since the overload resolution of call-/uncall statements requires the semantic checks of the caller arguments, all overloads of a called module identifier are considered reachable.
+    std::unordered_set<std::string> identifiersOfReachableModules{programEntryPointModuleIdentifier};
+    std::vector<std::string>        identifiersOfModulesToProcess{programEntryPointModuleIdentifier};
+    std::vector<std::string>        identifiersOfCalledModules;
+    while (!identifiersOfModulesToProcess.empty()) {
+        const std::string moduleIdentifier = std::move(identifiersOfModulesToProcess.back());
+        identifiersOfModulesToProcess.pop_back();
+
+        identifiersOfCalledModules.clear();
+        for (const TSyrecParser::ModuleContext* moduleDeclaration: moduleDeclarationsPerIdentifier[moduleIdentifier]) {
+            collectIdentifiersOfCalledModules(moduleDeclaration->statementList(), identifiersOfCalledModules);
+        }
+        for (std::string& identifierOfCalledModule: identifiersOfCalledModules) {
+            if (moduleDeclarationsPerIdentifier.contains(identifierOfCalledModule) && identifiersOfReachableModules.emplace(identifierOfCalledModule).second) {
+                identifiersOfModulesToProcess.emplace_back(std::move(identifierOfCalledModule));
+            }
+        }
+    }
+    return identifiersOfReachableModules;
+}
+
+std::optional<CustomModuleVisitor::ModulesWithNotPerformedOverloadResolution> CustomModuleVisitor::parseModulesWithoutOverloadResolution(const TSyrecParser::ProgramContext* context) const {
+    if (context == nullptr) {
+        return std::nullopt;
+    }
+
+    ModulesWithNotPerformedOverloadResolution parsedModules;
+    for (const auto& antlrModuleContext: context->module()) {
+        if (const std::optional<syrec::Module::ptr>& parsedModule = visitModuleTyped(antlrModuleContext); parsedModule.has_value()) {
+            parsedModules.modules.emplace_back(*parsedModule);
+        }
+    }
+    parsedModules.callStatementsWithNotPerformedOverloadResolution = statementVisitorInstance->getCallStatementsWithNotPerformedOverloadResolution();
+    return parsedModules;
+}
+
+std::optional<std::shared_ptr<syrec::Program>> CustomModuleVisitor::joinModulesOfParts(const std::vector<ModulesWithNotPerformedOverloadResolution>& modulesOfParts) const {
+    // The modules are registered in the same order and checked for the same duplicate declarations as during the visit of a whole program in visitModuleTyped(...).
+    const std::string& mainModuleIdentifier = parserConfiguration.optionalProgramEntryPointModuleIdentifier.value_or("main");
+    auto               joinedProgram        = std::make_shared<syrec::Program>();
+
+    std::vector<CustomStatementVisitor::NotOverloadResolutedCallStatementScope> callStatementsScopeForWhichOverloadResolutionShouldBePerformed;
+    for (const ModulesWithNotPerformedOverloadResolution& modulesOfPart: modulesOfParts) {
+        for (const syrec::Module::ptr& module: modulesOfPart.modules) {
+            if (module->name == mainModuleIdentifier ? symbolTable->existsModuleForName(module->name) : isModuleSignatureAlreadyDeclared(module->name, module->parameters, !module->parameters.empty())) {
+                return std::nullopt;
+            }
+            symbolTable->insertModule(module);
+            joinedProgram->addModule(module);
+        }
+        callStatementsScopeForWhichOverloadResolutionShouldBePerformed.insert(callStatementsScopeForWhichOverloadResolutionShouldBePerformed.end(), modulesOfPart.callStatementsWithNotPerformedOverloadResolution.cbegin(), modulesOfPart.callStatementsWithNotPerformedOverloadResolution.cend());
+    }
+
+    const std::shared_ptr<const syrec::Module> lastProcessedUserDefinedModule = joinedProgram->modules().empty() ? nullptr : joinedProgram->modules().back();
+    resolveOverloadsOfCallStatements(lastProcessedUserDefinedModule, callStatementsScopeForWhichOverloadResolutionShouldBePerformed);
+    return joinedProgram;
+}
+
+bool CustomModuleVisitor::isModuleSignatureAlreadyDeclared(const std::string& moduleIdentifier, const syrec::Variable::vec& parameters, const bool declaresParameters) const {
+    auto moduleOverloadResolutionCall = utils::BaseSymbolTable::ModuleOverloadResolutionResult(utils::BaseSymbolTable::ModuleOverloadResolutionResult::NoMatchFound, std::nullopt);
+    if (declaresParameters) {
+        moduleOverloadResolutionCall = symbolTable->getModulesMatchingSignature(moduleIdentifier, parameters);
+    } else {
+        moduleOverloadResolutionCall = utils::BaseSymbolTable::ModuleOverloadResolutionResult(symbolTable->existsModuleForName(moduleIdentifier) ? utils::BaseSymbolTable::ModuleOverloadResolutionResult::Result::SingleMatchFound : utils::BaseSymbolTable::ModuleOverloadResolutionResult::Result::NoMatchFound, std::nullopt);
+    }
+    return moduleOverloadResolutionCall.resolutionResult != utils::BaseSymbolTable::ModuleOverloadResolutionResult::Result::CallerArgumentsInvalid && moduleOverloadResolutionCall.resolutionResult != utils::BaseSymbolTable::ModuleOverloadResolutionResult::NoMatchFound;
+}
+
+void CustomModuleVisitor::resolveOverloadsOfCallStatements(const std::shared_ptr<const syrec::Module>& lastProcessedUserDefinedModule, const std::vector<CustomStatementVisitor::NotOverloadResolutedCallStatementScope>& callStatementsScopeForWhichOverloadResolutionShouldBePerformed) const {
     std::string                          programEntryPointModuleIdentifier;
     std::shared_ptr<const syrec::Module> definedMainModule = nullptr;
 
-    if (parserConfiguration.optionalProgramEntryPointModuleIdentifier.has_value()) {
+    // A module library does not define a program entry point, the entry point of a program linking the library is determined once the program is parsed.
+    if (parserConfiguration.optionalProgramEntryPointModuleIdentifier.has_value() && !isParsingModuleLibrary) {
         const auto userDefinedMainModuleIdentifierSemanticErrorPosition = Message::Position(0, 0);
 
         const std::string userDefinedProgramEntryPointModuleIdentifier = parserConfiguration.optionalProgramEntryPointModuleIdentifier.value();
@@ -73,7 +207,7 @@ std::optional<std::shared_ptr<syrec::Program>> CustomModuleVisitor::visitProgram
                 definedMainModule = modulesMatchingIdentifier.back();
             }
         }
-    } else {
+    } else if (!isParsingModuleLibrary) {
         if (const syrec::Module::vec modulesMatchingIdentifier = symbolTable->getModulesByName("main"); !modulesMatchingIdentifier.empty()) {
             definedMainModule = modulesMatchingIdentifier.front();
         } else {
@@ -82,7 +216,6 @@ std::optional<std::shared_ptr<syrec::Program>> CustomModuleVisitor::visitProgram
     }
 
     // We are not requiring a C89 style def-before use for both call-/uncall statements, thus we need to perform overload resolution for any of these statements after the whole program was processed.
-    const std::vector<CustomStatementVisitor::NotOverloadResolutedCallStatementScope> callStatementsScopeForWhichOverloadResolutionShouldBePerformed = statementVisitorInstance->getCallStatementsWithNotPerformedOverloadResolution();
     for (const auto& scope: callStatementsScopeForWhichOverloadResolutionShouldBePerformed) {
         for (const CustomStatementVisitor::NotOverloadResolutedCallStatementScope::CallStatementData& callStatementVariant: scope.callStatementsToPerformOverloadResolutionOn) {
             // The current module overload resolution algorithm uses the variable type to determine whether the user provided argument is assignable to the formal module parameter, thus a variable of type 'in' is not assignable
@@ -124,7 +257,6 @@ std::optional<std::shared_ptr<syrec::Program>> CustomModuleVisitor::visitProgram
             }
         }
     }
-    return generatedProgram;
 }
 
 std::optional<syrec::Module::ptr> CustomModuleVisitor::visitModuleTyped(const TSyrecParser::ModuleContext* context) const {
@@ -147,7 +279,7 @@ std::optional<syrec::Module::ptr> CustomModuleVisitor::visitModuleTyped(const TS
         }
     }
 
-    auto generatedModule = std::make_shared<syrec::Module>(moduleIdentifier.value_or(""));
+    auto generatedModule = makeIrNode<syrec::Module>(moduleIdentifier.value_or(""));
     symbolTable->openTemporaryScope();
     generatedModule->parameters = visitParameterListTyped(context->parameterList()).value_or(syrec::Variable::vec());
 
@@ -156,21 +288,14 @@ std::optional<syrec::Module::ptr> CustomModuleVisitor::visitModuleTyped(const TS
             generatedModule->variables.insert(generatedModule->variables.end(), localVariableDefinitions->cbegin(), localVariableDefinitions->cend());
         }
     }
+    generatedModule->assignDeclarationIndicesOfVariables();
 
     statementVisitorInstance->openNewScopeToRecordCallStatementsInModule(CustomStatementVisitor::NotOverloadResolutedCallStatementScope::DeclaredModuleSignature(generatedModule->name, generatedModule->parameters));
     generatedModule->statements = visitStatementListTyped(context->statementList()).value_or(syrec::Statement::vec());
 
     if (moduleIdentifier.has_value()) {
-        if (*moduleIdentifier != mainModuleIdentifier) {
-            auto moduleOverloadResolutionCall = utils::BaseSymbolTable::ModuleOverloadResolutionResult(utils::BaseSymbolTable::ModuleOverloadResolutionResult::NoMatchFound, std::nullopt);
-            if (context->parameterList() != nullptr && !context->parameterList()->parameter().empty()) {
-                moduleOverloadResolutionCall = symbolTable->getModulesMatchingSignature(*moduleIdentifier, generatedModule->parameters);
-            } else {
-                moduleOverloadResolutionCall = utils::BaseSymbolTable::ModuleOverloadResolutionResult(symbolTable->existsModuleForName(*moduleIdentifier) ? utils::BaseSymbolTable::ModuleOverloadResolutionResult::Result::SingleMatchFound : utils::BaseSymbolTable::ModuleOverloadResolutionResult::Result::NoMatchFound, std::nullopt);
-            }
-            if (moduleOverloadResolutionCall.resolutionResult != utils::BaseSymbolTable::ModuleOverloadResolutionResult::Result::CallerArgumentsInvalid && moduleOverloadResolutionCall.resolutionResult != utils::BaseSymbolTable::ModuleOverloadResolutionResult::NoMatchFound) {
-                recordSemanticError<SemanticError::DuplicateModuleDeclaration>(mapTokenPositionToMessagePosition(*context->literalIdent()->getSymbol()), *moduleIdentifier);
-            }
+        if (*moduleIdentifier != mainModuleIdentifier && isModuleSignatureAlreadyDeclared(*moduleIdentifier, generatedModule->parameters, context->parameterList() != nullptr && !context->parameterList()->parameter().empty())) {
+            recordSemanticError<SemanticError::DuplicateModuleDeclaration>(mapTokenPositionToMessagePosition(*context->literalIdent()->getSymbol()), *moduleIdentifier);
         }
         if (generatedModule != nullptr) {
             symbolTable->insertModule(generatedModule);
@@ -345,7 +470,7 @@ std::optional<syrec::Variable::ptr> CustomModuleVisitor::visitSignalDeclarationT
     }
 
     if (variableIdentifier.has_value() && !declaredNumberOfValuesPerDimension.empty()) {
-        return std::make_shared<syrec::Variable>(syrec::Variable::Type::In, *variableIdentifier, declaredNumberOfValuesPerDimension, variableBitwidth);
+        return makeIrNode<syrec::Variable>(syrec::Variable::Type::In, *variableIdentifier, declaredNumberOfValuesPerDimension, variableBitwidth);
     }
     return std::nullopt;
 }
@@ -99,7 +99,7 @@ std::optional<syrec::Statement::ptr> CustomStatementVisitor::visitAssignStatemen
 
     bool detectedSemanticErrorAfterOperandsWhereProcessed = false;
     if (expectedBitwidthOfAssignmentLhsOperand.has_value() && assignmentRhsOperand.has_value()) {
-        CustomExpressionVisitor::truncateConstantValuesInExpression(*assignmentRhsOperand, expectedBitwidthOfAssignmentLhsOperand->operandBitwidth, parserConfiguration.integerConstantTruncationOperation, &detectedSemanticErrorAfterOperandsWhereProcessed);
+        expressionVisitorInstance->truncateConstantValuesInExpression(*assignmentRhsOperand, expectedBitwidthOfAssignmentLhsOperand->operandBitwidth, parserConfiguration.integerConstantTruncationOperation, &detectedSemanticErrorAfterOperandsWhereProcessed);
         if (detectedSemanticErrorAfterOperandsWhereProcessed) {
             recordSemanticError<SemanticError::ExpressionEvaluationFailedDueToDivisionByZero>(mapTokenPositionToMessagePosition(*context->expression()->getStart()));
         } else if (expectedBitwidthOfAssignmentRhsOperand.has_value() && expectedBitwidthOfAssignmentLhsOperand->operandBitwidth != expectedBitwidthOfAssignmentRhsOperand->operandBitwidth) {
@@ -114,7 +114,7 @@ std::optional<syrec::Statement::ptr> CustomStatementVisitor::visitAssignStatemen
         }
     }
     expressionVisitorInstance->clearRestrictionOnVariableAccesses();
-    return !detectedSemanticErrorAfterOperandsWhereProcessed && assignmentLhsOperand.has_value() && assignmentOperation.has_value() && assignmentRhsOperand.has_value() ? std::optional(std::make_shared<syrec::AssignStatement>(*assignmentLhsOperand, *assignmentOperation, *assignmentRhsOperand)) : std::nullopt;
+    return !detectedSemanticErrorAfterOperandsWhereProcessed && assignmentLhsOperand.has_value() && assignmentOperation.has_value() && assignmentRhsOperand.has_value() ? std::optional(makeIrNode<syrec::AssignStatement>(*assignmentLhsOperand, *assignmentOperation, *assignmentRhsOperand)) : std::nullopt;
 }
 
 std::optional<syrec::Statement::ptr> CustomStatementVisitor::visitUnaryStatementTyped(const TSyrecParser::UnaryStatementContext* context) const {
@@ -130,7 +130,7 @@ std::optional<syrec::Statement::ptr> CustomStatementVisitor::visitUnaryStatement
     expressionVisitorInstance->clearRestrictionOnVariableAccesses();
 
     const std::optional<syrec::UnaryStatement::UnaryOperation> assignmentOperation = mapAntlrTokenToUnaryAssignmentOperation(*context);
-    return assignedToVariable.has_value() && assignmentOperation.has_value() ? std::make_optional(std::make_shared<syrec::UnaryStatement>(*assignmentOperation, *assignedToVariable)) : std::nullopt;
+    return assignedToVariable.has_value() && assignmentOperation.has_value() ? std::make_optional(makeIrNode<syrec::UnaryStatement>(*assignmentOperation, *assignedToVariable)) : std::nullopt;
 }
 
 std::optional<syrec::Statement::ptr> CustomStatementVisitor::visitSwapStatementTyped(const TSyrecParser::SwapStatementContext* context) const {
@@ -166,11 +166,11 @@ std::optional<syrec::Statement::ptr> CustomStatementVisitor::visitSwapStatementT
         recordSemanticError<SemanticError::ExpressionBitwidthMismatches>(mapTokenPositionToMessagePosition(*context->rhsOperand->literalIdent()->getSymbol()), expectedBitwidthOfAssignmentLhsOperand->operandBitwidth, expectedBitwidthOfAssignmentRhsOperand->operandBitwidth);
         return std::nullopt;
     }
-    return swapLhsOperand.has_value() && swapRhsOperand.has_value() ? std::make_optional(std::make_shared<syrec::SwapStatement>(*swapLhsOperand, *swapRhsOperand)) : std::nullopt;
+    return swapLhsOperand.has_value() && swapRhsOperand.has_value() ? std::make_optional(makeIrNode<syrec::SwapStatement>(*swapLhsOperand, *swapRhsOperand)) : std::nullopt;
 }
 
-std::optional<syrec::Statement::ptr> CustomStatementVisitor::visitSkipStatementTyped([[maybe_unused]] const TSyrecParser::SkipStatementContext* context) {
-    return std::make_shared<syrec::SkipStatement>();
+std::optional<syrec::Statement::ptr> CustomStatementVisitor::visitSkipStatementTyped([[maybe_unused]] const TSyrecParser::SkipStatementContext* context) const {
+    return makeIrNode<syrec::SkipStatement>();
 }
 
 std::optional<syrec::Statement::ptr> CustomStatementVisitor::visitCallStatementTyped(const TSyrecParser::CallStatementContext* context) {
@@ -199,7 +199,7 @@ std::optional<syrec::Statement::ptr> CustomStatementVisitor::visitCallStatementT
         callerArgumentVariableIdentifiers.emplace_back(antlrCallerArgumentToken->getText());
         if (const std::optional<utils::TemporaryVariableScope::ScopeEntry::readOnlyPtr> matchingSymbolTableEntryForCallerArgument = activeSymbolTableScope->get()->getVariableByName(antlrCallerArgumentToken->getText()); matchingSymbolTableEntryForCallerArgument.has_value()) {
             if (matchingSymbolTableEntryForCallerArgument->get()->getVariableData().has_value()) {
-                symbolTableEntryPerCallerArgument.emplace_back(std::make_shared<syrec::Variable>(**matchingSymbolTableEntryForCallerArgument->get()->getVariableData()));
+                symbolTableEntryPerCallerArgument.emplace_back(makeIrNode<syrec::Variable>(**matchingSymbolTableEntryForCallerArgument->get()->getVariableData()));
             }
         } else {
             recordSemanticError<SemanticError::NoVariableMatchingIdentifier>(mapTokenPositionToMessagePosition(*antlrCallerArgumentToken), antlrCallerArgumentToken->getText());
@@ -213,9 +213,9 @@ std::optional<syrec::Statement::ptr> CustomStatementVisitor::visitCallStatementT
     NotOverloadResolutedCallStatementScope*                                             activeModuleScopeRecordingCallStatements = getActiveModuleScopeRecordingCallStatements();
     std::optional<NotOverloadResolutedCallStatementScope::CallStatementInstanceVariant> callStatementInstanceVariant;
     if (context->literalOpCall() != nullptr) {
-        callStatementInstanceVariant = std::make_shared<syrec::CallStatement>(nullptr, callerArgumentVariableIdentifiers);
+        callStatementInstanceVariant = makeIrNode<syrec::CallStatement>(nullptr, callerArgumentVariableIdentifiers);
     } else if (context->literalOpUncall() != nullptr) {
-        callStatementInstanceVariant = std::make_shared<syrec::UncallStatement>(nullptr, callerArgumentVariableIdentifiers);
+        callStatementInstanceVariant = makeIrNode<syrec::UncallStatement>(nullptr, callerArgumentVariableIdentifiers);
     }
 
     if (callStatementInstanceVariant.has_value()) {
@@ -246,7 +246,7 @@ std::optional<syrec::Statement::ptr> CustomStatementVisitor::visitIfStatementTyp
     if (context == nullptr) {
         return std::nullopt;
     }
-    auto generatedIfStatement = std::make_shared<syrec::IfStatement>();
+    auto generatedIfStatement = makeIrNode<syrec::IfStatement>();
 
     // A note regarding the reporting of semantic errors, if the guard condition evaluates to a constant value at compile time, semantic errors in the statements of the not taken branch will still be reported
     // (we will follow the behaviour found in other compilers [see https://godbolt.org/z/nM419obo4]).
@@ -262,7 +262,7 @@ std::optional<syrec::Statement::ptr> CustomStatementVisitor::visitIfStatementTyp
     generatedIfStatement->setCondition(expressionVisitorInstance->visitExpressionTyped(context->guardCondition, determinedOperandBitwidthOfGuardConditionExpression).value_or(nullptr));
 
     if (generatedIfStatement->condition != nullptr) {
-        CustomExpressionVisitor::truncateConstantValuesInExpression(generatedIfStatement->condition, 1, parserConfiguration.integerConstantTruncationOperation, &detectedSemanticErrorAfterOperandsOfGuardAndClosingGuardConditionWhereProcessed);
+        expressionVisitorInstance->truncateConstantValuesInExpression(generatedIfStatement->condition, 1, parserConfiguration.integerConstantTruncationOperation, &detectedSemanticErrorAfterOperandsOfGuardAndClosingGuardConditionWhereProcessed);
         if (detectedSemanticErrorAfterOperandsOfGuardAndClosingGuardConditionWhereProcessed) {
             recordSemanticError<SemanticError::ExpressionEvaluationFailedDueToDivisionByZero>(mapTokenPositionToMessagePosition(*context->guardCondition->getStart()));
         } else if (determinedOperandBitwidthOfGuardConditionExpression.has_value() && determinedOperandBitwidthOfGuardConditionExpression->operandBitwidth != 1) {
@@ -284,7 +284,7 @@ std::optional<syrec::Statement::ptr> CustomStatementVisitor::visitIfStatementTyp
 
     if (generatedIfStatement->fiCondition != nullptr) {
         bool detectedDivisionByZeroDuringTruncationOfConstantValues = false;
-        CustomExpressionVisitor::truncateConstantValuesInExpression(generatedIfStatement->fiCondition, 1, parserConfiguration.integerConstantTruncationOperation, &detectedDivisionByZeroDuringTruncationOfConstantValues);
+        expressionVisitorInstance->truncateConstantValuesInExpression(generatedIfStatement->fiCondition, 1, parserConfiguration.integerConstantTruncationOperation, &detectedDivisionByZeroDuringTruncationOfConstantValues);
         if (detectedDivisionByZeroDuringTruncationOfConstantValues) {
             recordSemanticError<SemanticError::ExpressionEvaluationFailedDueToDivisionByZero>(mapTokenPositionToMessagePosition(*context->matchingGuardExpression->getStart()));
             detectedSemanticErrorAfterOperandsOfGuardAndClosingGuardConditionWhereProcessed = true;
@@ -316,7 +316,7 @@ std::optional<syrec::Statement::ptr> CustomStatementVisitor::visitForStatementTy
     const std::optional<std::string>                        loopVariableIdentifier = visitLoopVariableDefinitionTyped(context->loopVariableDefinition());
     if (loopVariableIdentifier.has_value()) {
         if (activeSymbolTableScope.has_value()) {
-            activeSymbolTableScope->get()->recordLoopVariable(std::make_shared<syrec::Number>(*loopVariableIdentifier));
+            activeSymbolTableScope->get()->recordLoopVariable(makeIrNode<syrec::Number>(*loopVariableIdentifier));
         }
         expressionVisitorInstance->setRestrictionOnLoopVariablesUsableInFutureLoopVariableValueInitializations(*loopVariableIdentifier);
     }
@@ -332,14 +332,14 @@ std::optional<syrec::Statement::ptr> CustomStatementVisitor::visitForStatementTy
     const std::optional<syrec::Number::ptr> iterationRangeEndValue   = expressionVisitorInstance->visitNumberTyped(context->endValue);
     const std::optional<unsigned int>       valueOfIterationRangeEnd = iterationRangeEndValue.has_value() && *iterationRangeEndValue != nullptr ? tryGetConstantValueOf(**iterationRangeEndValue) : std::nullopt;
 
-    const syrec::Number::ptr iterationRangeStepSizeValue = visitLoopStepsizeDefinitionTyped(context->loopStepsizeDefinition()).value_or(std::make_shared<syrec::Number>(1));
-    auto                     generatedForStatement       = std::make_shared<syrec::ForStatement>();
+    const syrec::Number::ptr iterationRangeStepSizeValue = visitLoopStepsizeDefinitionTyped(context->loopStepsizeDefinition()).value_or(makeIrNode<syrec::Number>(1));
+    auto                     generatedForStatement       = makeIrNode<syrec::ForStatement>();
     generatedForStatement->loopVariable                  = loopVariableIdentifier.value_or("");
 
     if (iterationRangeStartValue.has_value()) {
         generatedForStatement->range = context->endValue != nullptr ? std::make_pair(*iterationRangeStartValue, iterationRangeEndValue.value_or(nullptr)) : std::make_pair(*iterationRangeStartValue, *iterationRangeStartValue);
     } else if (iterationRangeEndValue.has_value()) {
-        generatedForStatement->range = std::make_pair(std::make_shared<syrec::Number>(0), *iterationRangeEndValue);
+        generatedForStatement->range = std::make_pair(makeIrNode<syrec::Number>(0), *iterationRangeEndValue);
         valueOfIterationRangeStart   = 0;
     }
 
@@ -411,12 +411,12 @@ std::optional<syrec::Number::ptr> CustomStatementVisitor::visitLoopStepsizeDefin
 
     if (context->literalOpMinus() != nullptr) {
         if (const std::optional<unsigned int> evaluatedValueForStepsize = userDefinedStepsizeValue.value()->tryEvaluate({}); evaluatedValueForStepsize.has_value()) {
-            return std::make_shared<syrec::Number>(-*evaluatedValueForStepsize);
+            return makeIrNode<syrec::Number>(-*evaluatedValueForStepsize);
         }
 
         // Since we cannot store an 'expression' of the form -(<Number>) in the IR representation, a constant expression (0 - <Number>) is used instead.
-        return std::make_shared<syrec::Number>(syrec::Number::ConstantExpression(
-                std::make_shared<syrec::Number>(0),
+        return makeIrNode<syrec::Number>(syrec::Number::ConstantExpression(
+                makeIrNode<syrec::Number>(0),
                 syrec::Number::ConstantExpression::Operation::Subtraction,
                 *userDefinedStepsizeValue));
     }
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/syrec/parser/utils/ascii_char_stream_view.hpp"
+
+#include "Exceptions.h"
+#include "IntStream.h"
+#include "misc/Interval.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+using namespace syrec_parser;
+
+// The semantics of the functions of the character stream match the ones of antlr4::ANTLRInputStream.
+bool AsciiCharStreamView::isAsciiText(const std::string_view text) noexcept {
+    return std::ranges::all_of(text, [](const char character) { return static_cast<unsigned char>(character) < 0x80U; });
+}
+
+void AsciiCharStreamView::consume() {
+    if (position >= text.size()) {
+        throw antlr4::IllegalStateException("cannot consume EOF");
+    }
+    ++position;
+}
+
+std::size_t AsciiCharStreamView::LA(ssize_t i) {
+    if (i == 0) {
+        return 0;
+    }
+
+    const auto currentPosition = static_cast<ssize_t>(position);
+    if (i < 0) {
+        // e.g., translate LA(-1) to use offset i=0; then data[p+0-1]
+        ++i;
+        if (currentPosition + i - 1 < 0) {
+            return antlr4::IntStream::EOF;
+        }
+    }
+    if (currentPosition + i - 1 >= static_cast<ssize_t>(text.size())) {
+        return antlr4::IntStream::EOF;
+    }
+    return static_cast<unsigned char>(text[static_cast<std::size_t>(currentPosition + i - 1)]);
+}
+
+ssize_t AsciiCharStreamView::mark() {
+    return -1;
+}
+
+void AsciiCharStreamView::release(ssize_t /* marker */) {}
+
+std::size_t AsciiCharStreamView::index() {
+    return position;
+}
+
+void AsciiCharStreamView::seek(const std::size_t index) {
+    // Seeking forward is equal to consuming the characters up to the given index while the stream is not consumed beyond its end.
+    position = std::min(index, text.size());
+}
+
+std::size_t AsciiCharStreamView::size() {
+    return text.size();
+}
+
+std::string AsciiCharStreamView::getSourceName() const {
+    return sourceName.empty() ? antlr4::IntStream::UNKNOWN_SOURCE_NAME : sourceName;
+}
+
+std::string AsciiCharStreamView::getText(const antlr4::misc::Interval& interval) {
+    if (interval.a < 0 || interval.b < 0) {
+        return {};
+    }
+
+    const auto start = static_cast<std::size_t>(interval.a);
+    auto       stop  = static_cast<std::size_t>(interval.b);
+    if (stop >= text.size()) {
+        stop = text.size() - 1U;
+    }
+    if (start >= text.size() || start > stop) {
+        return {};
+    }
+    return std::string(text.substr(start, stop - start + 1U));
+}
+
+std::string AsciiCharStreamView::toString() const {
+    return std::string(text);
+}
@@ -91,40 +91,24 @@ bool BaseSyrecIrEntityStringifier::stringify(std::ostream& outputStream, const s
         return false;
     }
 
-    const auto& statementInstancePointer = statement.get();
-    // Since a syrec::SkipStatement is defined using an 'using syrec::SkipStatement = syrec::Statement' declaration,
-    // no dynamic_cast<> check can be performed to determine whether the statement instance is a skip statement. Thus, we must
-    // compare the typeid to perform said check.
-    if (const auto& statementInstance = *statementInstancePointer; typeid(statementInstance) == typeid(syrec::SkipStatement)) {
-        return stringifySkipStatement(outputStream);
-    }
-
-    // Conflicting information regarding the correct implementation of a down case to handle a polymorphic class have been found
-    // ranging from the visitor pattern, the usage of dynamic_cast<> as well as custom RTTI implementations.
-    // The Cpp guidelines "recommend" the usage of dynamic_cast<> when traversal of the class hierarchy is required at runtime (https://isocpp.github.io/CppCoreGuidelines/CppCoreGuidelines#Rh-dynamic_cast)
-    // An alternative approach utilizing std::visit could be in the form of: https://quuxplusone.github.io/blog/2020/09/29/oop-visit/
-    // OR: https://www.oreilly.com/library/view/c-software-design/9781098113155/ch04.html (utilizing std::visit which in turn requires ownership of the object and thus seems no usable with the current function signature).
-    // 16.12.2024: We currently follow the Cpp guidelines but further research needs to be done on whether a better performing solution can be found or whether the overhead incurred by the dynamic_cast<> is acceptable.
-    if (const auto& stmtCastedAsAssignment = dynamic_cast<const syrec::AssignStatement*>(statementInstancePointer); stmtCastedAsAssignment != nullptr) {
-        return stringify(outputStream, *stmtCastedAsAssignment);
-    }
-    if (const auto& stmtCastedAsModuleCall = dynamic_cast<const syrec::CallStatement*>(statementInstancePointer); stmtCastedAsModuleCall != nullptr) {
-        return stringify(outputStream, *stmtCastedAsModuleCall);
-    }
-    if (const auto& stmtCastedAsForStmt = dynamic_cast<const syrec::ForStatement*>(statementInstancePointer); stmtCastedAsForStmt != nullptr) {
-        return stringify(outputStream, *stmtCastedAsForStmt);
-    }
-    if (const auto& stmtCastedAsIfStmt = dynamic_cast<const syrec::IfStatement*>(statementInstancePointer); stmtCastedAsIfStmt != nullptr) {
-        return stringify(outputStream, *stmtCastedAsIfStmt);
-    }
-    if (const auto& stmtCastedAsSwapStmt = dynamic_cast<const syrec::SwapStatement*>(statementInstancePointer); stmtCastedAsSwapStmt != nullptr) {
-        return stringify(outputStream, *stmtCastedAsSwapStmt);
-    }
-    if (const auto& stmtCastedAsUnaryStmt = dynamic_cast<const syrec::UnaryStatement*>(statementInstancePointer); stmtCastedAsUnaryStmt != nullptr) {
-        return stringify(outputStream, *stmtCastedAsUnaryStmt);
-    }
-    if (const auto& stmtCastedAsModuleUncall = dynamic_cast<const syrec::UncallStatement*>(statementInstancePointer); stmtCastedAsModuleUncall != nullptr) {
-        return stringify(outputStream, *stmtCastedAsModuleUncall);
+    // The kind of a statement determines its derived type, thus a switch is used instead of a cascade of dynamic_cast<> checks.
+    switch (const auto& statementInstance = *statement; statementInstance.getKind()) {
+        case syrec::Statement::Kind::Skip:
+            return stringifySkipStatement(outputStream);
+        case syrec::Statement::Kind::Assign:
+            return stringify(outputStream, static_cast<const syrec::AssignStatement&>(statementInstance));
+        case syrec::Statement::Kind::Call:
+            return stringify(outputStream, static_cast<const syrec::CallStatement&>(statementInstance));
+        case syrec::Statement::Kind::For:
+            return stringify(outputStream, static_cast<const syrec::ForStatement&>(statementInstance));
+        case syrec::Statement::Kind::If:
+            return stringify(outputStream, static_cast<const syrec::IfStatement&>(statementInstance));
+        case syrec::Statement::Kind::Swap:
+            return stringify(outputStream, static_cast<const syrec::SwapStatement&>(statementInstance));
+        case syrec::Statement::Kind::Unary:
+            return stringify(outputStream, static_cast<const syrec::UnaryStatement&>(statementInstance));
+        case syrec::Statement::Kind::Uncall:
+            return stringify(outputStream, static_cast<const syrec::UncallStatement&>(statementInstance));
     }
     return false;
 }
@@ -189,20 +173,17 @@ bool BaseSyrecIrEntityStringifier::stringify(std::ostream& outputStream, const s
     if (!outputStream.good()) {
         return setStreamInFailedState(outputStream);
     }
-    if (const auto& castedToBinaryExpr = dynamic_cast<const syrec::BinaryExpression*>(&expression); castedToBinaryExpr != nullptr) {
-        return stringify(outputStream, *castedToBinaryExpr);
-    }
-    if (const auto& castedToNumericExpr = dynamic_cast<const syrec::NumericExpression*>(&expression); castedToNumericExpr != nullptr) {
-        return stringify(outputStream, *castedToNumericExpr);
-    }
-    if (const auto& castedToVariableExpr = dynamic_cast<const syrec::VariableExpression*>(&expression); castedToVariableExpr != nullptr) {
-        return stringify(outputStream, *castedToVariableExpr);
-    }
-    if (const auto& castedToShiftExpr = dynamic_cast<const syrec::ShiftExpression*>(&expression); castedToShiftExpr != nullptr) {
-        return stringify(outputStream, *castedToShiftExpr);
-    }
-    if (const auto& casedToUnaryExpr = dynamic_cast<const syrec::UnaryExpression*>(&expression); casedToUnaryExpr != nullptr) {
-        return stringify(outputStream, *casedToUnaryExpr);
+    switch (expression.getKind()) {
+        case syrec::Expression::Kind::Binary:
+            return stringify(outputStream, static_cast<const syrec::BinaryExpression&>(expression));
+        case syrec::Expression::Kind::Numeric:
+            return stringify(outputStream, static_cast<const syrec::NumericExpression&>(expression));
+        case syrec::Expression::Kind::Variable:
+            return stringify(outputStream, static_cast<const syrec::VariableExpression&>(expression));
+        case syrec::Expression::Kind::Shift:
+            return stringify(outputStream, static_cast<const syrec::ShiftExpression&>(expression));
+        case syrec::Expression::Kind::Unary:
+            return stringify(outputStream, static_cast<const syrec::UnaryExpression&>(expression));
     }
     return false;
 }
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/syrec/parser/utils/memory_mapped_file.hpp"
+
+#include <cstddef>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <utility>
+
+#if _WIN32
+#include <limits>
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace syrec_parser;
+
+namespace {
+    struct MappedRegion {
+        const char* content;
+        std::size_t size;
+    };
+
+    /*
+     * Map a regular file into memory. An empty file is reported as a successfully mapped region without content while std::nullopt is returned if the file could not be mapped.
+     */
+    [[nodiscard]] std::optional<MappedRegion> tryMapFileIntoMemory(const std::string& filename) {
+#if _WIN32
+        const HANDLE fileHandle = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE) {
+            return std::nullopt;
+        }
+
+        LARGE_INTEGER fileSize;
+        if (GetFileSizeEx(fileHandle, &fileSize) == 0 || fileSize.QuadPart < 0 || static_cast<unsigned long long>(fileSize.QuadPart) > std::numeric_limits<std::size_t>::max()) {
+            CloseHandle(fileHandle);
+            return std::nullopt;
+        }
+        if (fileSize.QuadPart == 0) {
+            CloseHandle(fileHandle);
+            return MappedRegion{.content = nullptr, .size = 0U};
+        }
+
+        // The view of the file keeps the underlying file mapping alive, thus both handles can be closed once the view was created.
+        const HANDLE fileMappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(fileHandle);
+        if (fileMappingHandle == nullptr) {
+            return std::nullopt;
+        }
+        const void* mappedView = MapViewOfFile(fileMappingHandle, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(fileMappingHandle);
+        if (mappedView == nullptr) {
+            return std::nullopt;
+        }
+        return MappedRegion{.content = static_cast<const char*>(mappedView), .size = static_cast<std::size_t>(fileSize.QuadPart)};
+#else
+        const int fileDescriptor = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fileDescriptor < 0) {
+            return std::nullopt;
+        }
+
+        struct stat fileStatus{};
+        if (fstat(fileDescriptor, &fileStatus) != 0 || !S_ISREG(fileStatus.st_mode) || fileStatus.st_size < 0) {
+            close(fileDescriptor);
+            return std::nullopt;
+        }
+        if (fileStatus.st_size == 0) {
+            close(fileDescriptor);
+            return MappedRegion{.content = nullptr, .size = 0U};
+        }
+
+        // The mapping stays valid after the file descriptor was closed.
+        const auto  fileSize   = static_cast<std::size_t>(fileStatus.st_size);
+        void*       mappedView = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        close(fileDescriptor);
+        if (mappedView == MAP_FAILED) {
+            return std::nullopt;
+        }
+#ifdef POSIX_MADV_SEQUENTIAL
+        // The lexer processes the content of the file sequentially from its start to its end.
+        static_cast<void>(posix_madvise(mappedView, fileSize, POSIX_MADV_SEQUENTIAL));
+#endif
+        return MappedRegion{.content = static_cast<const char*>(mappedView), .size = fileSize};
+#endif
+    }
+} // namespace
+
+std::optional<MemoryMappedFile> MemoryMappedFile::open(const std::string& filename, std::string* foundFileHandlingErrors) {
+    MemoryMappedFile memoryMappedFile;
+    if (const std::optional<MappedRegion> mappedRegion = tryMapFileIntoMemory(filename); mappedRegion.has_value()) {
+        memoryMappedFile.mappedContent     = mappedRegion->content;
+        memoryMappedFile.mappedContentSize = mappedRegion->size;
+        return memoryMappedFile;
+    }
+
+    // Files that cannot be mapped into memory are read into a buffer whose size is only known after the whole file content was read.
+    // We cannot pass the filename as a std::string_view since the std::ifstream constructor or any of the underlying functions
+    // will expect a null-terminated std::string argument to function correctly.
+    if (std::ifstream inputFileStream(filename, std::ifstream::in | std::ifstream::binary); inputFileStream.is_open()) {
+        memoryMappedFile.fallbackContentBuffer.assign(std::istreambuf_iterator<char>(inputFileStream), std::istreambuf_iterator<char>());
+        if (!inputFileStream.bad()) {
+            return memoryMappedFile;
+        }
+        if (foundFileHandlingErrors != nullptr) {
+            *foundFileHandlingErrors = "Error while reading content from file @ " + filename;
+        }
+    } else if (foundFileHandlingErrors != nullptr) {
+        *foundFileHandlingErrors = "Cannot open given circuit file @ " + filename;
+    }
+    return std::nullopt;
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+    unmap();
+}
+
+MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& other) noexcept:
+    mappedContent(std::exchange(other.mappedContent, nullptr)), mappedContentSize(std::exchange(other.mappedContentSize, 0U)), fallbackContentBuffer(std::move(other.fallbackContentBuffer)) {}
+
+MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile&& other) noexcept {
+    if (this != &other) {
+        unmap();
+        mappedContent         = std::exchange(other.mappedContent, nullptr);
+        mappedContentSize     = std::exchange(other.mappedContentSize, 0U);
+        fallbackContentBuffer = std::move(other.fallbackContentBuffer);
+    }
+    return *this;
+}
+
+void MemoryMappedFile::unmap() noexcept {
+    if (mappedContent == nullptr) {
+        return;
+    }
+#if _WIN32
+    UnmapViewOfFile(mappedContent);
+#else
+    munmap(const_cast<char*>(mappedContent), mappedContentSize); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+#endif
+    mappedContent     = nullptr;
+    mappedContentSize = 0;
+}
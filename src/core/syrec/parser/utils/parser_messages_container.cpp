@@ -11,23 +11,66 @@
 #include "core/syrec/parser/utils/parser_messages_container.hpp"
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
+#include <variant>
 #include <vector>
 
 using namespace syrec_parser;
 
+std::string Message::getMessage() const {
+    if (messageFormat.empty()) {
+        return message;
+    }
+
+    // Every replacement field of the format is replaced by the next argument, which is sufficient for the '{:d}' and '{:s}' replacement fields used by the formats of the semantic errors.
+    std::string formattedMessage;
+    formattedMessage.reserve(messageFormat.size());
+    std::size_t indexOfNextArgument = 0;
+    for (std::size_t i = 0; i < messageFormat.size(); ++i) {
+        const std::size_t endOfReplacementField = messageFormat[i] == '{' ? messageFormat.find('}', i) : std::string_view::npos;
+        if (endOfReplacementField == std::string_view::npos || indexOfNextArgument >= messageArguments.size()) {
+            formattedMessage.push_back(messageFormat[i]);
+            continue;
+        }
+
+        const Argument& argument = messageArguments[indexOfNextArgument++];
+        if (const auto* stringArgument = std::get_if<std::string>(&argument); stringArgument != nullptr) {
+            formattedMessage.append(*stringArgument);
+        } else if (const auto* signedArgument = std::get_if<std::int64_t>(&argument); signedArgument != nullptr) {
+            formattedMessage.append(std::to_string(*signedArgument));
+        } else {
+            formattedMessage.append(std::to_string(std::get<std::uint64_t>(argument)));
+        }
+        i = endOfReplacementField;
+    }
+    return formattedMessage;
+}
+
 void ParserMessagesContainer::recordMessage(std::unique_ptr<Message> message) {
     if (message->type != Message::Type::Error || (temporaryFilterForToBeRecordedMessages.has_value() && temporaryFilterForToBeRecordedMessages.value() != message->id)) {
         return;
     }
 
-    messagesPerType[message->type].emplace_back(std::move(message));
+    if (recordedMessages.contains(message.get())) {
+        return;
+    }
+    std::vector<Message::ptr>& messagesOfType = messagesPerType[message->type];
+    if (optionalMaxNumRecordedErrors.has_value() && messagesOfType.size() >= *optionalMaxNumRecordedErrors) {
+        ++numNotRecordedErrors;
+        return;
+    }
+    recordedMessages.emplace(message.get());
+    messagesOfType.emplace_back(std::move(message));
 }
 
-std::vector<Message::ptr> ParserMessagesContainer::getMessagesOfType(Message::Type messageType) const {
-    return messagesPerType.contains(messageType) ? messagesPerType.at(messageType) : std::vector<Message::ptr>();
+const std::vector<Message::ptr>& ParserMessagesContainer::getMessagesOfType(Message::Type messageType) const {
+    static const std::vector<Message::ptr> NO_MESSAGES;
+    const auto                             messagesOfType = messagesPerType.find(messageType);
+    return messagesOfType != messagesPerType.end() ? messagesOfType->second : NO_MESSAGES;
 }
 
 bool ParserMessagesContainer::setFilterForToBeRecordedMessages(const std::string& messageIdToPassFilter) {
@@ -10,15 +10,21 @@
 
 #include "core/syrec/parser/utils/symbolTable/base_symbol_table.hpp"
 
+#include "core/memory_accounting.hpp"
 #include "core/syrec/module.hpp"
+#include "core/syrec/parser/utils/symbolTable/flat_identifier_map.hpp"
 #include "core/syrec/parser/utils/symbolTable/temporary_variable_scope.hpp"
 #include "core/syrec/parser/utils/variable_assignability_check.hpp"
 #include "core/syrec/variable.hpp"
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <optional>
+#include <string>
 #include <string_view>
+#include <utility>
 
 bool utils::BaseSymbolTable::insertModule(const syrec::Module::ptr& module) {
     if (module == nullptr || module->name.empty() || !std::all_of(module->parameters.cbegin(), module->parameters.cend(), [](const syrec::Variable::ptr& moduleParameter) { return moduleParameter && !moduleParameter->name.empty(); })) {
@@ -32,51 +38,61 @@ bool utils::BaseSymbolTable::insertModule(const syrec::Module::ptr& module) {
     // * (in, out) and vice versa
     // * (inout, in) and vice versa
     //
-    const syrec::Module::vec& modulesMatchingIdentifier = getModulesByName(module->name);
-    if (std::ranges::any_of(
-                modulesMatchingIdentifier,
-                [&module](const syrec::Module::ptr& existingModuleMatchingIdentifier) {
-                    return existingModuleMatchingIdentifier->parameters.size() == module->parameters.size() && std::equal(
-                                                                                                                       existingModuleMatchingIdentifier->parameters.cbegin(),
-                                                                                                                       existingModuleMatchingIdentifier->parameters.cend(),
-                                                                                                                       module->parameters.cbegin(),
-                                                                                                                       module->parameters.cend(),
-                                                                                                                       [](const syrec::Variable::ptr& symTabModuleParameter, const syrec::Variable::ptr& userModuleParameter) {
-                                                                                                                           return doVariableStructuresMatch(*symTabModuleParameter, *userModuleParameter) ? doesVariableTypePairCreateOverloadResolutionAmbiguity(symTabModuleParameter->type, userModuleParameter->type) : false;
-                                                                                                                       });
-                })) {
+    // Since only modules with the same structure of their parameters need to be checked, the check is limited to the declared modules sharing said structure.
+    DeclaredModulesOfIdentifier& declaredModulesOfIdentifier = *declaredModules.tryEmplace(module->name, DeclaredModulesOfIdentifier()).first;
+    std::string                  parameterStructureKey       = buildParameterStructureKey(module->parameters);
+    if (const auto modulesMatchingParameterStructure = declaredModulesOfIdentifier.modulesByParameterStructure.find(parameterStructureKey); modulesMatchingParameterStructure != declaredModulesOfIdentifier.modulesByParameterStructure.end() && std::ranges::any_of(modulesMatchingParameterStructure->second, [&module](const syrec::Module::ptr& existingModuleMatchingIdentifier) {
+            return std::ranges::equal(
+                    existingModuleMatchingIdentifier->parameters,
+                    module->parameters,
+                    [](const syrec::Variable::ptr& symTabModuleParameter, const syrec::Variable::ptr& userModuleParameter) {
+                        return doesVariableTypePairCreateOverloadResolutionAmbiguity(symTabModuleParameter->type, userModuleParameter->type);
+                    });
+        })) {
         return false;
     }
 
-    if (!declaredModules.contains(module->name)) {
-        declaredModules.insert({module->name, syrec::Module::vec()});
-    }
-    declaredModules.at(module->name).emplace_back(module);
+    declaredModulesOfIdentifier.modules.emplace_back(module);
+    declaredModulesOfIdentifier.modulesByParameterStructure[std::move(parameterStructureKey)].emplace_back(module);
+    cachedModuleOverloadResolutionResults.clear();
     return true;
 }
 
 syrec::Module::vec utils::BaseSymbolTable::getModulesByName(const std::string_view& accessedModuleIdentifier) const {
-    auto modulesMatchingIdentifier = declaredModules.find(accessedModuleIdentifier);
-    if (modulesMatchingIdentifier == declaredModules.end()) {
+    const DeclaredModulesOfIdentifier* modulesMatchingIdentifier = declaredModules.find(accessedModuleIdentifier);
+    if (modulesMatchingIdentifier == nullptr) {
         return {};
     }
-    return modulesMatchingIdentifier->second;
+    return modulesMatchingIdentifier->modules;
 }
 
 bool utils::BaseSymbolTable::existsModuleForName(const std::string_view& accessedModuleIdentifier) const {
-    return !getModulesByName(accessedModuleIdentifier).empty();
+    const DeclaredModulesOfIdentifier* modulesMatchingIdentifier = declaredModules.find(accessedModuleIdentifier);
+    return modulesMatchingIdentifier != nullptr && !modulesMatchingIdentifier->modules.empty();
 }
 
 utils::BaseSymbolTable::ModuleOverloadResolutionResult utils::BaseSymbolTable::getModulesMatchingSignature(const std::string_view& accessedModuleIdentifier, const syrec::Variable::vec& callerArguments) const {
     return getModulesMatchingSignature(accessedModuleIdentifier, callerArguments, true);
 }
 
+std::shared_ptr<utils::BaseSymbolTable> utils::BaseSymbolTable::createSnapshotOfDeclaredModules() const {
+    auto snapshot                                   = std::make_shared<BaseSymbolTable>();
+    snapshot->declaredModules                       = declaredModules;
+    snapshot->cachedModuleOverloadResolutionResults = cachedModuleOverloadResolutionResults;
+    return snapshot;
+}
+
 std::optional<utils::TemporaryVariableScope::ptr> utils::BaseSymbolTable::getActiveTemporaryScope() const {
     return temporaryVariableScopes.empty() ? std::nullopt : std::make_optional(temporaryVariableScopes.back());
 }
 
 utils::TemporaryVariableScope::ptr utils::BaseSymbolTable::openTemporaryScope() {
-    temporaryVariableScopes.emplace_back(std::make_shared<utils::TemporaryVariableScope>());
+    if (reusableTemporaryVariableScopes.empty()) {
+        temporaryVariableScopes.emplace_back(std::make_shared<utils::TemporaryVariableScope>());
+    } else {
+        temporaryVariableScopes.emplace_back(std::move(reusableTemporaryVariableScopes.back()));
+        reusableTemporaryVariableScopes.pop_back();
+    }
     return temporaryVariableScopes.back();
 }
 
@@ -84,6 +100,11 @@ std::optional<utils::TemporaryVariableScope::ptr> utils::BaseSymbolTable::closeT
     if (temporaryVariableScopes.empty()) {
         return std::nullopt;
     }
+    // A closed scope still referenced by a caller must not be modified, all other closed scopes are cleared and reused.
+    if (TemporaryVariableScope::ptr& closedScope = temporaryVariableScopes.back(); closedScope.use_count() == 1) {
+        closedScope->clear();
+        reusableTemporaryVariableScopes.emplace_back(std::move(closedScope));
+    }
     temporaryVariableScopes.pop_back();
     return getActiveTemporaryScope();
 }
@@ -100,30 +121,93 @@ utils::BaseSymbolTable::ModuleOverloadResolutionResult utils::BaseSymbolTable::g
         }
     }
 
-    syrec::Module::vec modulesMatchingIdentifier = getModulesByName(accessedModuleIdentifier);
-    std::erase_if(
-            modulesMatchingIdentifier,
-            [&callerArguments](const syrec::Module::ptr& moduleMatchingIdentifier) {
-                return moduleMatchingIdentifier->parameters.size() != callerArguments.size() || !std::ranges::equal(
-                                                                                                        moduleMatchingIdentifier->parameters,
-                                                                                                        callerArguments,
-                                                                                                        [](const syrec::Variable::ptr& moduleParameter, const syrec::Variable::ptr& callerArgument) {
-                                                                                                            return variable_assignability_check::doesModuleParameterTypeAllowAssignmentFromVariableType(moduleParameter->type, callerArgument->type) && doVariableStructuresMatch(*moduleParameter, *callerArgument);
-                                                                                                        });
-            });
-
-    if (modulesMatchingIdentifier.empty()) {
+    const DeclaredModulesOfIdentifier* modulesMatchingIdentifier = !accessedModuleIdentifier.empty() ? declaredModules.find(accessedModuleIdentifier) : nullptr;
+    if (modulesMatchingIdentifier == nullptr) {
         return ModuleOverloadResolutionResult(ModuleOverloadResolutionResult::Result::NoMatchFound, std::nullopt);
     }
 
-    return modulesMatchingIdentifier.size() == 1 ? ModuleOverloadResolutionResult(ModuleOverloadResolutionResult::SingleMatchFound, modulesMatchingIdentifier.front()) : ModuleOverloadResolutionResult(ModuleOverloadResolutionResult::MultipleMatchesFound, std::nullopt);
+    std::string parameterStructureKey = buildParameterStructureKey(callerArguments);
+    // Call statements with identical structures and types of their caller arguments (i.e. repeated calls with the same caller arguments) share the result of the overload resolution.
+    std::string overloadResolutionResultKey = std::string(accessedModuleIdentifier);
+    overloadResolutionResultKey.push_back('\0');
+    overloadResolutionResultKey.append(parameterStructureKey);
+    for (const syrec::Variable::ptr& callerArgument: callerArguments) {
+        overloadResolutionResultKey.push_back(static_cast<char>(callerArgument->type));
+    }
+    if (const auto cachedOverloadResolutionResult = cachedModuleOverloadResolutionResults.find(overloadResolutionResultKey); cachedOverloadResolutionResult != cachedModuleOverloadResolutionResults.end()) {
+        return cachedOverloadResolutionResult->second;
+    }
+
+    std::optional<syrec::Module::ptr> singleModuleMatchingSignature;
+    std::size_t                       numModulesMatchingSignature = 0;
+    if (const auto modulesMatchingParameterStructure = modulesMatchingIdentifier->modulesByParameterStructure.find(parameterStructureKey); modulesMatchingParameterStructure != modulesMatchingIdentifier->modulesByParameterStructure.end()) {
+        for (const syrec::Module::ptr& moduleMatchingParameterStructure: modulesMatchingParameterStructure->second) {
+            if (std::ranges::equal(
+                        moduleMatchingParameterStructure->parameters,
+                        callerArguments,
+                        [](const syrec::Variable::ptr& moduleParameter, const syrec::Variable::ptr& callerArgument) {
+                            return variable_assignability_check::doesModuleParameterTypeAllowAssignmentFromVariableType(moduleParameter->type, callerArgument->type);
+                        })) {
+                singleModuleMatchingSignature = moduleMatchingParameterStructure;
+                ++numModulesMatchingSignature;
+            }
+        }
+    }
+
+    ModuleOverloadResolutionResult overloadResolutionResult(ModuleOverloadResolutionResult::Result::NoMatchFound, std::nullopt);
+    if (numModulesMatchingSignature == 1) {
+        overloadResolutionResult = ModuleOverloadResolutionResult(ModuleOverloadResolutionResult::SingleMatchFound, singleModuleMatchingSignature);
+    } else if (numModulesMatchingSignature > 1) {
+        overloadResolutionResult = ModuleOverloadResolutionResult(ModuleOverloadResolutionResult::MultipleMatchesFound, std::nullopt);
+    }
+    cachedModuleOverloadResolutionResults.emplace(std::move(overloadResolutionResultKey), overloadResolutionResult);
+    return overloadResolutionResult;
 }
 
-bool utils::BaseSymbolTable::doVariableStructuresMatch(const syrec::Variable& lVariable, const syrec::Variable& rVariable) noexcept {
-    return lVariable.bitwidth == rVariable.bitwidth && std::ranges::equal(
-                                                               lVariable.dimensions,
-                                                               rVariable.dimensions,
-                                                               [](const auto moduleParameterNumValuesOfDimension, const auto callerArgumentNumValuesOfDimension) {
-                                                                   return moduleParameterNumValuesOfDimension == callerArgumentNumValuesOfDimension;
-                                                               });
+std::string utils::BaseSymbolTable::buildParameterStructureKey(const syrec::Variable::vec& variables) {
+    // Every number is encoded with a fixed width, thus the keys of two structures are only equal if all of their encoded numbers are equal.
+    std::string parameterStructureKey;
+    const auto  appendNumber = [&parameterStructureKey](const std::size_t value) {
+        const auto encodedValue = static_cast<std::uint32_t>(value);
+        for (std::size_t i = 0; i < sizeof(encodedValue); ++i) {
+            parameterStructureKey.push_back(static_cast<char>(encodedValue >> (8U * i) & 0xFFU));
+        }
+    };
+
+    appendNumber(variables.size());
+    for (const syrec::Variable::ptr& variable: variables) {
+        appendNumber(variable->bitwidth);
+        appendNumber(variable->dimensions.size());
+        for (const unsigned numValuesOfDimension: variable->dimensions) {
+            appendNumber(numValuesOfDimension);
+        }
+    }
+    return parameterStructureKey;
+}
+
+std::size_t utils::BaseSymbolTable::determineNumBytes() const {
+    using namespace syrec::memory_accounting;
+    std::size_t numBytes = declaredModules.determineNumBytesOfStorage();
+    for (const auto& declaredModulesOfIdentifier: declaredModules) {
+        numBytes += numBytesOfHeapStorage(declaredModulesOfIdentifier.value.modules) + numBytesOfNodesOfUnorderedContainer(declaredModulesOfIdentifier.value.modulesByParameterStructure);
+        for (const auto& [parameterStructureKey, modulesWithParameterStructure]: declaredModulesOfIdentifier.value.modulesByParameterStructure) {
+            numBytes += numBytesOfHeapStorage(parameterStructureKey) + numBytesOfHeapStorage(modulesWithParameterStructure);
+        }
+    }
+
+    numBytes += numBytesOfNodesOfUnorderedContainer(cachedModuleOverloadResolutionResults);
+    for (const auto& [overloadResolutionResultKey, overloadResolutionResult]: cachedModuleOverloadResolutionResults) {
+        numBytes += numBytesOfHeapStorage(overloadResolutionResultKey);
+    }
+
+    // The variables referenced by the entries of the scopes are part of the IR of the parsed program, thus only the entries themselves are counted.
+    numBytes += numBytesOfHeapStorage(temporaryVariableScopes) + numBytesOfHeapStorage(reusableTemporaryVariableScopes);
+    for (const std::vector<TemporaryVariableScope::ptr>* scopes: {&temporaryVariableScopes, &reusableTemporaryVariableScopes}) {
+        for (const TemporaryVariableScope::ptr& scope: *scopes) {
+            if (scope != nullptr) {
+                numBytes += sizeof(TemporaryVariableScope) + NUM_BYTES_OF_SHARED_POINTER_CONTROL_BLOCK + scope->signalIdentifierLookup.determineNumBytesOfStorage() + scope->signalIdentifierLookup.size() * (sizeof(TemporaryVariableScope::ScopeEntry) + NUM_BYTES_OF_SHARED_POINTER_CONTROL_BLOCK);
+            }
+        }
+    }
+    return numBytes;
 }
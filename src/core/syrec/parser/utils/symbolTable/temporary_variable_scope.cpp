@@ -64,15 +64,15 @@ std::optional<syrec::Number::ptr> utils::TemporaryVariableScope::ScopeEntry::get
 }
 
 bool utils::TemporaryVariableScope::existsVariableForName(const std::string_view& signalIdentifier) const {
-    return getVariableByName(signalIdentifier).has_value();
+    return !signalIdentifier.empty() && signalIdentifierLookup.contains(signalIdentifier);
 }
 
 std::optional<utils::TemporaryVariableScope::ScopeEntry::readOnlyPtr> utils::TemporaryVariableScope::getVariableByName(const std::string_view& signalIdentifier) const {
-    const auto scopeEntryMatchingSignalIdentifier = !signalIdentifier.empty() ? signalIdentifierLookup.find(signalIdentifier) : signalIdentifierLookup.end();
-    if (scopeEntryMatchingSignalIdentifier == signalIdentifierLookup.end()) {
+    const IdentifierLookupEntry* scopeEntryMatchingSignalIdentifier = !signalIdentifier.empty() ? signalIdentifierLookup.find(signalIdentifier) : nullptr;
+    if (scopeEntryMatchingSignalIdentifier == nullptr) {
         return std::nullopt;
     }
-    return scopeEntryMatchingSignalIdentifier->second;
+    return scopeEntryMatchingSignalIdentifier->scopeEntry;
 }
 
 std::vector<utils::TemporaryVariableScope::ScopeEntry::readOnlyPtr> utils::TemporaryVariableScope::getVariablesMatchingType(const std::unordered_set<syrec::Variable::Type>& lookedForVariableTypes) const {
@@ -81,72 +81,51 @@ std::vector<utils::TemporaryVariableScope::ScopeEntry::readOnlyPtr> utils::Tempo
     }
 
     std::vector<ScopeEntry::readOnlyPtr> variablesMatchingType;
-
-    auto       signalsIterator   = signalIdentifierLookup.begin();
-    const auto endSignalIterator = signalIdentifierLookup.end();
-    while (signalsIterator != endSignalIterator) {
-        if (const std::shared_ptr<const syrec::Variable> variableData = signalsIterator->second->getVariableData().value_or(nullptr);
+    for (const auto& [signalIdentifier, signalIdentifierHash, identifierLookupEntry]: signalIdentifierLookup) {
+        if (const std::shared_ptr<const syrec::Variable> variableData = identifierLookupEntry.scopeEntry->getVariableData().value_or(nullptr);
             variableData != nullptr && lookedForVariableTypes.contains(variableData->type)) {
-            variablesMatchingType.emplace_back(signalsIterator->second);
+            variablesMatchingType.emplace_back(identifierLookupEntry.scopeEntry);
         }
-        ++signalsIterator;
     }
     return variablesMatchingType;
 }
 
 bool utils::TemporaryVariableScope::recordVariable(const syrec::Variable::ptr& signal) {
-    if (signal == nullptr || signal->name.empty() || existsVariableForName(signal->name)) {
+    if (signal == nullptr || signal->name.empty()) {
         return false;
     }
-    auto scopeEntryForSignal = std::make_shared<ScopeEntry>(signal);
-    signalIdentifierLookup.insert({signal->name, scopeEntryForSignal});
-    return true;
+    return signalIdentifierLookup.tryEmplace(signal->name, IdentifierLookupEntry{std::make_shared<ScopeEntry>(signal), std::nullopt}).second;
 }
 
 bool utils::TemporaryVariableScope::recordLoopVariable(const syrec::Number::ptr& loopVariable) {
-    if (loopVariable == nullptr || !loopVariable->isLoopVariable() || loopVariable->variableName().empty() || loopVariable->variableName().front() != '$' || existsVariableForName(loopVariable->variableName())) {
+    if (loopVariable == nullptr || !loopVariable->isLoopVariable() || loopVariable->variableName().empty() || loopVariable->variableName().front() != '$') {
         return false;
     }
-    auto scopeEntryForSignal = std::make_shared<ScopeEntry>(loopVariable);
-    signalIdentifierLookup.insert({loopVariable->variableName(), scopeEntryForSignal});
-    return true;
+    return signalIdentifierLookup.tryEmplace(loopVariable->variableName(), IdentifierLookupEntry{std::make_shared<ScopeEntry>(loopVariable), std::nullopt}).second;
 }
 
 bool utils::TemporaryVariableScope::removeVariable(const std::string_view& signalIdentifier) {
-    const auto scopeEntryMatchingSignalIdentifier = !signalIdentifier.empty() ? signalIdentifierLookup.find(signalIdentifier) : signalIdentifierLookup.end();
-    if (scopeEntryMatchingSignalIdentifier == signalIdentifierLookup.end()) {
-        return false;
-    }
-    signalIdentifierLookup.erase(scopeEntryMatchingSignalIdentifier);
-    if (const auto& entryForVariableInKnownLoopVariableValueLookup = knownLoopVariableValues.find(signalIdentifier); entryForVariableInKnownLoopVariableValueLookup != knownLoopVariableValues.end()) {
-        knownLoopVariableValues.erase(entryForVariableInKnownLoopVariableValueLookup);
-    }
-    return true;
+    return !signalIdentifier.empty() && signalIdentifierLookup.erase(signalIdentifier);
 }
 
 bool utils::TemporaryVariableScope::updateValueOfLoopVariable(const std::string_view& loopVariableIdentifier, const std::optional<unsigned int>& newValue) {
-    if (signalIdentifierLookup.count(loopVariableIdentifier) == 0) {
+    IdentifierLookupEntry* entryForLoopVariable = signalIdentifierLookup.find(loopVariableIdentifier);
+    if (entryForLoopVariable == nullptr) {
         return false;
     }
 
     if (newValue.has_value()) {
-        knownLoopVariableValues.insert_or_assign(std::string(loopVariableIdentifier), *newValue);
+        entryForLoopVariable->knownLoopVariableValue = *newValue;
         return true;
     }
-    if (const auto& entryForLoopVariable = knownLoopVariableValues.find(loopVariableIdentifier); entryForLoopVariable != knownLoopVariableValues.end()) {
-        knownLoopVariableValues.erase(entryForLoopVariable);
+    if (entryForLoopVariable->knownLoopVariableValue.has_value()) {
+        entryForLoopVariable->knownLoopVariableValue.reset();
         return true;
     }
     return false;
 }
 
 std::optional<unsigned> utils::TemporaryVariableScope::getValueOfLoopVariable(const std::string_view& loopVariableIdentifier) {
-    if (signalIdentifierLookup.count(loopVariableIdentifier) == 0 || knownLoopVariableValues.count(loopVariableIdentifier) == 0) {
-        return std::nullopt;
-    }
-
-    if (const auto& entryForLoopVariable = knownLoopVariableValues.find(loopVariableIdentifier); entryForLoopVariable != knownLoopVariableValues.end()) {
-        return knownLoopVariableValues.find(loopVariableIdentifier)->second;
-    }
-    return std::nullopt;
+    const IdentifierLookupEntry* entryForLoopVariable = signalIdentifierLookup.find(loopVariableIdentifier);
+    return entryForLoopVariable != nullptr ? entryForLoopVariable->knownLoopVariableValue : std::nullopt;
 }
@@ -0,0 +1,501 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/syrec/parser/utils/syrec_ir_entity_buffer_stringifier.hpp"
+
+#include "core/syrec/expression.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/number.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace utils;
+
+namespace {
+    // The operator tables are indexed by the value of the corresponding operation enum, thus the order of their entries must match the order of the enum values.
+    constexpr std::array<std::string_view, 5>  VARIABLE_TYPE_IDENTS                 = {"in", "out", "inout", "state", "wire"};
+    constexpr std::array<std::string_view, 17> BINARY_OPERATION_IDENTS              = {"+", "-", "^", "*", "/", "%", "*>", "&&", "||", "&", "|", "<", ">", "=", "!=", "<=", ">="};
+    constexpr std::array<std::string_view, 2>  SHIFT_OPERATION_IDENTS               = {"<<", ">>"};
+    constexpr std::array<std::string_view, 2>  UNARY_EXPRESSION_OPERATION_IDENTS    = {"!", "~"};
+    constexpr std::array<std::string_view, 3>  UNARY_STATEMENT_OPERATION_IDENTS     = {"~=", "++=", "--="};
+    constexpr std::array<std::string_view, 3>  ASSIGN_OPERATION_IDENTS              = {"+=", "-=", "^="};
+    constexpr std::array<std::string_view, 4>  CONSTANT_EXPRESSION_OPERATION_IDENTS = {"+", "-", "*", "/"};
+
+    template<std::size_t N, typename Operation>
+    [[nodiscard]] std::optional<std::string_view> lookupIdentOfOperation(const std::array<std::string_view, N>& operationIdents, const Operation operation) noexcept {
+        const auto index = static_cast<std::size_t>(operation);
+        if (index >= N) {
+            return std::nullopt;
+        }
+        return operationIdents[index];
+    }
+
+    [[nodiscard]] bool appendIdentOfOperation(std::string& buffer, const std::optional<std::string_view>& identOfOperation) {
+        if (!identOfOperation.has_value()) {
+            return false;
+        }
+        buffer += *identOfOperation;
+        return true;
+    }
+} // namespace
+
+SyrecIrEntityBufferStringifier::SyrecIrEntityBufferStringifier(const std::optional<AdditionalFormattingOptions>& additionalFormattingOptions):
+    additionalFormattingOptions(additionalFormattingOptions.value_or(AdditionalFormattingOptions())) {
+#if _WIN32
+    newlineSequence = this->additionalFormattingOptions.optionalCustomNewlineCharacterSequence.value_or("\r\n");
+#else
+    newlineSequence = this->additionalFormattingOptions.optionalCustomNewlineCharacterSequence.value_or("\n");
+#endif
+    indentationSequencePerLevel = this->additionalFormattingOptions.optionalCustomIndentationCharacterSequence.value_or("\t");
+}
+
+bool SyrecIrEntityBufferStringifier::stringify(std::string& buffer, const syrec::Program& program) {
+    indentationSequence.clear();
+
+    const syrec::Module::vec& modules = program.modules();
+    for (std::size_t i = 0; i < modules.size(); ++i) {
+        if (i != 0) {
+            appendNewline(buffer);
+        }
+        if (modules[i] == nullptr || !stringify(buffer, *modules[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::optional<std::string_view> SyrecIrEntityBufferStringifier::stringifySignatureOfModule(const syrec::Module& programModule) {
+    if (const auto memoizedSignature = memoizedSignaturePerModule.find(&programModule); memoizedSignature != memoizedSignaturePerModule.end()) {
+        return memoizedSignature->second;
+    }
+
+    std::optional<std::string>& signature = memoizedSignaturePerModule[&programModule];
+    if (programModule.name.empty()) {
+        return std::nullopt;
+    }
+
+    std::string stringifiedSignature = "module ";
+    stringifiedSignature += programModule.name;
+    stringifiedSignature += '(';
+    for (std::size_t i = 0; i < programModule.parameters.size(); ++i) {
+        const syrec::Variable::ptr& parameter = programModule.parameters[i];
+        if (parameter == nullptr || parameter->name.empty() || parameter->dimensions.empty() || (parameter->type != syrec::Variable::Type::In && parameter->type != syrec::Variable::Type::Out && parameter->type != syrec::Variable::Type::Inout)) {
+            return std::nullopt;
+        }
+
+        if (i != 0) {
+            stringifiedSignature += ", ";
+        }
+        stringifiedSignature += VARIABLE_TYPE_IDENTS[static_cast<std::size_t>(parameter->type)];
+        stringifiedSignature += ' ';
+        stringifiedSignature += parameter->name;
+        for (const unsigned numValuesOfDimension: parameter->dimensions) {
+            stringifiedSignature += '[';
+            appendNumber(stringifiedSignature, numValuesOfDimension);
+            stringifiedSignature += ']';
+        }
+        stringifiedSignature += '(';
+        appendNumber(stringifiedSignature, parameter->bitwidth);
+        stringifiedSignature += ')';
+    }
+    stringifiedSignature += ')';
+    signature = std::move(stringifiedSignature);
+    return signature;
+}
+
+// START OF NON-PUBLIC INTERFACE
+void SyrecIrEntityBufferStringifier::incrementIndentationLevel() {
+    indentationSequence += indentationSequencePerLevel;
+}
+
+void SyrecIrEntityBufferStringifier::decrementIndentationLevel() noexcept {
+    if (!indentationSequence.empty()) {
+        indentationSequence.pop_back();
+    }
+}
+
+bool SyrecIrEntityBufferStringifier::stringify(std::string& buffer, const syrec::Module& programModule) {
+    if (programModule.name.empty() || programModule.statements.empty()) {
+        return false;
+    }
+
+    buffer += "module ";
+    buffer += programModule.name;
+    buffer += '(';
+    if (!stringify(buffer, programModule.parameters, true)) {
+        return false;
+    }
+    buffer += ')';
+
+    if (!programModule.variables.empty()) {
+        appendNewline(buffer);
+    }
+    incrementIndentationLevel();
+    if (!stringify(buffer, programModule.variables, !additionalFormattingOptions.omitVariableTypeSharedBySequenceOfLocalVariables)) {
+        return false;
+    }
+    appendNewline(buffer);
+    if (!stringify(buffer, programModule.statements)) {
+        return false;
+    }
+    decrementIndentationLevel();
+    return true;
+}
+
+bool SyrecIrEntityBufferStringifier::stringify(std::string& buffer, const syrec::Variable& variable, const bool stringifyVariableType) const {
+    if (stringifyVariableType) {
+        if (!appendIdentOfOperation(buffer, lookupIdentOfOperation(VARIABLE_TYPE_IDENTS, variable.type))) {
+            return false;
+        }
+        buffer += ' ';
+    }
+    if (variable.name.empty() || variable.dimensions.empty()) {
+        return false;
+    }
+    buffer += variable.name;
+
+    // See BaseSyrecIrEntityStringifier for the reasoning why the dimensions of a 1D signal with a single value are always stringified uniformly.
+    if (variable.dimensions.size() != 1 || variable.dimensions.front() != 1 || !additionalFormattingOptions.omitNumberOfDimensionsDeclarationFor1DVariablesWithSingleValue) {
+        for (const unsigned numValuesOfDimension: variable.dimensions) {
+            buffer += '[';
+            appendNumber(buffer, numValuesOfDimension);
+            buffer += ']';
+        }
+    }
+    buffer += '(';
+    appendNumber(buffer, variable.bitwidth);
+    buffer += ')';
+    return true;
+}
+
+bool SyrecIrEntityBufferStringifier::stringify(std::string& buffer, const syrec::Statement::ptr& statement) {
+    if (statement == nullptr) {
+        return false;
+    }
+    buffer += indentationSequence;
+
+    switch (const auto& statementInstance = *statement; statementInstance.getKind()) {
+        case syrec::Statement::Kind::Skip:
+            buffer += "skip";
+            return true;
+        case syrec::Statement::Kind::Assign:
+            return stringify(buffer, static_cast<const syrec::AssignStatement&>(statementInstance));
+        case syrec::Statement::Kind::Call: {
+            const auto& callStatement = static_cast<const syrec::CallStatement&>(statementInstance);
+            return callStatement.target && stringifyModuleCallVariant(buffer, "call", *callStatement.target, callStatement.parameters);
+        }
+        case syrec::Statement::Kind::For:
+            return stringify(buffer, static_cast<const syrec::ForStatement&>(statementInstance));
+        case syrec::Statement::Kind::If:
+            return stringify(buffer, static_cast<const syrec::IfStatement&>(statementInstance));
+        case syrec::Statement::Kind::Swap:
+            return stringify(buffer, static_cast<const syrec::SwapStatement&>(statementInstance));
+        case syrec::Statement::Kind::Unary:
+            return stringify(buffer, static_cast<const syrec::UnaryStatement&>(statementInstance));
+        case syrec::Statement::Kind::Uncall: {
+            const auto& uncallStatement = static_cast<const syrec::UncallStatement&>(statementInstance);
+            return uncallStatement.target && stringifyModuleCallVariant(buffer, "uncall", *uncallStatement.target, uncallStatement.parameters);
+        }
+    }
+    return false;
+}
+
+bool SyrecIrEntityBufferStringifier::stringify(std::string& buffer, const syrec::AssignStatement& assignStatement) const {
+    return assignStatement.lhs && assignStatement.rhs && stringify(buffer, *assignStatement.lhs) && appendOperatorOfBinaryOperation(buffer, lookupIdentOfOperation(ASSIGN_OPERATION_IDENTS, assignStatement.assignOperation).value_or("")) && stringify(buffer, *assignStatement.rhs);
+}
+
+bool SyrecIrEntityBufferStringifier::stringify(std::string& buffer, const syrec::ForStatement& forStatement) {
+    if (!forStatement.range.first || !forStatement.range.second || !forStatement.step) {
+        return false;
+    }
+
+    buffer += "for ";
+    if (!forStatement.loopVariable.empty()) {
+        // The indentation sequence preceding the loop variable is also generated by the BaseSyrecIrEntityStringifier.
+        buffer += indentationSequence;
+        buffer += forStatement.loopVariable;
+        buffer += additionalFormattingOptions.useWhitespaceBetweenOperandsOfBinaryOperation ? " = " : "=";
+    }
+    if (!stringify(buffer, *forStatement.range.first)) {
+        return false;
+    }
+    buffer += " to ";
+    if (forStatement.range.first != forStatement.range.second && !stringify(buffer, *forStatement.range.second)) {
+        return false;
+    }
+    buffer += " step ";
+    if (!stringify(buffer, *forStatement.step)) {
+        return false;
+    }
+    buffer += " do";
+    appendNewline(buffer);
+    incrementIndentationLevel();
+    if (!stringify(buffer, forStatement.statements)) {
+        return false;
+    }
+    appendNewline(buffer);
+    decrementIndentationLevel();
+    buffer += indentationSequence;
+    buffer += "rof";
+    return true;
+}
+
+bool SyrecIrEntityBufferStringifier::stringify(std::string& buffer, const syrec::IfStatement& ifStatement) {
+    if (!ifStatement.condition || !ifStatement.fiCondition) {
+        return false;
+    }
+
+    buffer += "if ";
+    if (!stringify(buffer, *ifStatement.condition)) {
+        return false;
+    }
+    buffer += " then";
+    appendNewline(buffer);
+    incrementIndentationLevel();
+    if (!stringify(buffer, ifStatement.thenStatements)) {
+        return false;
+    }
+    // The indentation level is decremented twice to match the output of the BaseSyrecIrEntityStringifier.
+    decrementIndentationLevel();
+    appendNewline(buffer);
+    decrementIndentationLevel();
+    buffer += indentationSequence;
+    buffer += "else";
+    appendNewline(buffer);
+    incrementIndentationLevel();
+    if (!stringify(buffer, ifStatement.elseStatements)) {
+        return false;
+    }
+    appendNewline(buffer);
+    decrementIndentationLevel();
+    buffer += indentationSequence;
+    buffer += "fi ";
+    return stringify(buffer, *ifStatement.fiCondition);
+}
+
+bool SyrecIrEntityBufferStringifier::stringify(std::string& buffer, const syrec::SwapStatement& swapStatement) const {
+    return swapStatement.lhs && swapStatement.rhs && stringify(buffer, *swapStatement.lhs) && appendOperatorOfBinaryOperation(buffer, "<=>") && stringify(buffer, *swapStatement.rhs);
+}
+
+bool SyrecIrEntityBufferStringifier::stringify(std::string& buffer, const syrec::UnaryStatement& unaryAssignStatement) const {
+    if (!unaryAssignStatement.var || !appendIdentOfOperation(buffer, lookupIdentOfOperation(UNARY_STATEMENT_OPERATION_IDENTS, unaryAssignStatement.unaryOperation))) {
+        return false;
+    }
+    if (additionalFormattingOptions.useWhitespaceBetweenOperandsOfBinaryOperation) {
+        buffer += ' ';
+    }
+    return stringify(buffer, *unaryAssignStatement.var);
+}
+
+bool SyrecIrEntityBufferStringifier::stringify(std::string& buffer, const syrec::Expression& expression) const {
+    switch (expression.getKind()) {
+        case syrec::Expression::Kind::Binary: {
+            const auto& binaryExpression = static_cast<const syrec::BinaryExpression&>(expression);
+            if (!binaryExpression.lhs || !binaryExpression.rhs) {
+                return false;
+            }
+            buffer += '(';
+            if (!stringify(buffer, *binaryExpression.lhs) || !appendOperatorOfBinaryOperation(buffer, lookupIdentOfOperation(BINARY_OPERATION_IDENTS, binaryExpression.binaryOperation).value_or("")) || !stringify(buffer, *binaryExpression.rhs)) {
+                return false;
+            }
+            buffer += ')';
+            return true;
+        }
+        case syrec::Expression::Kind::Numeric: {
+            const auto& numericExpression = static_cast<const syrec::NumericExpression&>(expression);
+            return numericExpression.value && stringify(buffer, *numericExpression.value);
+        }
+        case syrec::Expression::Kind::Variable: {
+            const auto& variableExpression = static_cast<const syrec::VariableExpression&>(expression);
+            return variableExpression.var && stringify(buffer, *variableExpression.var);
+        }
+        case syrec::Expression::Kind::Shift: {
+            const auto& shiftExpression = static_cast<const syrec::ShiftExpression&>(expression);
+            if (!shiftExpression.lhs || !shiftExpression.rhs) {
+                return false;
+            }
+            buffer += '(';
+            if (!stringify(buffer, *shiftExpression.lhs) || !appendOperatorOfBinaryOperation(buffer, lookupIdentOfOperation(SHIFT_OPERATION_IDENTS, shiftExpression.shiftOperation).value_or("")) || !stringify(buffer, *shiftExpression.rhs)) {
+                return false;
+            }
+            buffer += ')';
+            return true;
+        }
+        case syrec::Expression::Kind::Unary: {
+            const auto& unaryExpression = static_cast<const syrec::UnaryExpression&>(expression);
+            return unaryExpression.expr && appendIdentOfOperation(buffer, lookupIdentOfOperation(UNARY_EXPRESSION_OPERATION_IDENTS, unaryExpression.unaryOperation)) && stringify(buffer, *unaryExpression.expr);
+        }
+    }
+    return false;
+}
+
+bool SyrecIrEntityBufferStringifier::stringify(std::string& buffer, const syrec::VariableAccess& variableAccess) const {
+    if (!variableAccess.var || variableAccess.var->name.empty() || (variableAccess.range.has_value() && (!variableAccess.range->first || !variableAccess.range->second))) {
+        return false;
+    }
+    buffer += variableAccess.var->name;
+
+    for (const auto& expressionDefiningAccessedValueOfDimension: variableAccess.indexes) {
+        if (!expressionDefiningAccessedValueOfDimension) {
+            return false;
+        }
+        buffer += '[';
+        if (!stringify(buffer, *expressionDefiningAccessedValueOfDimension)) {
+            return false;
+        }
+        buffer += ']';
+    }
+
+    if (variableAccess.range.has_value()) {
+        buffer += '.';
+        if (!stringify(buffer, *variableAccess.range->first)) {
+            return false;
+        }
+        if (variableAccess.range->first != variableAccess.range->second) {
+            buffer += ':';
+            return stringify(buffer, *variableAccess.range->second);
+        }
+    }
+    return true;
+}
+
+bool SyrecIrEntityBufferStringifier::stringify(std::string& buffer, const syrec::Number& number) const {
+    if (number.isConstant()) {
+        appendNumber(buffer, number.evaluate({}));
+        return true;
+    }
+    if (number.isLoopVariable()) {
+        buffer += number.variableName();
+        return true;
+    }
+    if (number.isConstantExpression()) {
+        const std::optional<syrec::Number::ConstantExpression>& constantExpressionData = number.constantExpression();
+        if (!constantExpressionData.has_value() || !constantExpressionData->lhsOperand || !constantExpressionData->rhsOperand) {
+            return false;
+        }
+        buffer += '(';
+        if (!stringify(buffer, *constantExpressionData->lhsOperand) || !appendOperatorOfBinaryOperation(buffer, lookupIdentOfOperation(CONSTANT_EXPRESSION_OPERATION_IDENTS, constantExpressionData->operation).value_or("")) || !stringify(buffer, *constantExpressionData->rhsOperand)) {
+            return false;
+        }
+        buffer += ')';
+        return true;
+    }
+    return false;
+}
+
+bool SyrecIrEntityBufferStringifier::stringify(std::string& buffer, const syrec::Variable::vec& variables, const bool stringifyVariableTypeForEveryEntry) const {
+    if (variables.empty()) {
+        return true;
+    }
+
+    const std::string_view parameterSeparator = additionalFormattingOptions.useWhitespaceAfterAfterModuleParameterDeclaration ? ", " : ",";
+    if (!stringifyVariableTypeForEveryEntry) {
+        buffer += indentationSequence;
+    }
+
+    for (std::size_t i = 0; i < variables.size(); ++i) {
+        if (variables[i] == nullptr) {
+            return false;
+        }
+
+        const bool variableTypeGroupChange = !stringifyVariableTypeForEveryEntry && i > 0 && variables[i - 1] != nullptr && variables[i]->type != variables[i - 1]->type;
+        if (variableTypeGroupChange) {
+            appendNewline(buffer);
+            buffer += indentationSequence;
+        } else if (i != 0) {
+            buffer += parameterSeparator;
+        }
+
+        if (!stringify(buffer, *variables[i], stringifyVariableTypeForEveryEntry || i == 0 || variableTypeGroupChange)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SyrecIrEntityBufferStringifier::stringify(std::string& buffer, const syrec::Statement::vec& statements) {
+    if (statements.empty()) {
+        return false;
+    }
+
+    // Similar to the BaseSyrecIrEntityStringifier, the indentation sequence is prepended to every statement in addition to the one generated for the statement itself.
+    for (std::size_t i = 0; i < statements.size(); ++i) {
+        if (statements[i] == nullptr) {
+            return false;
+        }
+        buffer += indentationSequence;
+        if (!stringify(buffer, statements[i])) {
+            return false;
+        }
+        if (i + 1 != statements.size()) {
+            buffer += ';';
+            appendNewline(buffer);
+        }
+    }
+    return true;
+}
+
+bool SyrecIrEntityBufferStringifier::appendOperatorOfBinaryOperation(std::string& buffer, const std::string_view stringifiedOperator) const {
+    if (stringifiedOperator.empty()) {
+        return false;
+    }
+
+    if (additionalFormattingOptions.useWhitespaceBetweenOperandsOfBinaryOperation) {
+        buffer += ' ';
+        buffer += stringifiedOperator;
+        buffer += ' ';
+    } else {
+        buffer += stringifiedOperator;
+    }
+    return true;
+}
+
+void SyrecIrEntityBufferStringifier::appendNewline(std::string& buffer) const {
+    buffer += newlineSequence;
+}
+
+void SyrecIrEntityBufferStringifier::appendNumber(std::string& buffer, const unsigned number) {
+    std::array<char, std::numeric_limits<unsigned>::digits10 + 1> digits{};
+    const auto [endOfDigits, errorCode]                            = std::to_chars(digits.data(), digits.data() + digits.size(), number);
+    static_cast<void>(errorCode);
+    buffer.append(digits.data(), endOfDigits);
+}
+
+bool SyrecIrEntityBufferStringifier::stringifyModuleCallVariant(std::string& buffer, const std::string_view moduleCallVariantKeyword, const syrec::Module& callTarget, const std::vector<std::string>& callerArguments) {
+    if (callTarget.name.empty() || callerArguments.size() != callTarget.parameters.size()) {
+        return false;
+    }
+
+    buffer += moduleCallVariantKeyword;
+    buffer += ' ';
+    buffer += callTarget.name;
+    buffer += '(';
+    for (std::size_t i = 0; i < callerArguments.size(); ++i) {
+        if (callerArguments[i].empty()) {
+            return false;
+        }
+        if (i != 0) {
+            buffer += ", ";
+        }
+        buffer += callerArguments[i];
+    }
+    buffer += ')';
+    return true;
+}
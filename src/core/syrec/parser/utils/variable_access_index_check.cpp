@@ -52,7 +52,7 @@ std::optional<VariableAccessIndicesValidity> utils::validateVariableAccessIndice
             continue;
         }
 
-        const auto& accessedValueOfDimensionExprCasted = std::dynamic_pointer_cast<syrec::NumericExpression>(accessedValueOfDimension);
+        const auto& accessedValueOfDimensionExprCasted = syrec::expressionPointerCast<syrec::NumericExpression>(accessedValueOfDimension);
         if (accessedValueOfDimensionExprCasted == nullptr || accessedValueOfDimensionExprCasted->value == nullptr || !accessedValueOfDimensionExprCasted->value->isConstant()) {
             continue;
         }
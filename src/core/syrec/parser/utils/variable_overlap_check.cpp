@@ -33,7 +33,7 @@ namespace {
     }
 
     std::optional<unsigned int> tryEvaluateNumericExpr(const syrec::Expression& expression) {
-        if (const auto& numericExprOfContainerToEvaluate = dynamic_cast<const syrec::NumericExpression*>(&expression); numericExprOfContainerToEvaluate != nullptr) {
+        if (const auto& numericExprOfContainerToEvaluate = syrec::expressionCast<syrec::NumericExpression>(&expression); numericExprOfContainerToEvaluate != nullptr) {
             return tryEvaluateNumber(numericExprOfContainerToEvaluate->value);
         }
         return std::nullopt;
@@ -53,36 +53,59 @@ std::string VariableAccessOverlapCheckResult::stringifyOverlappingIndicesInforma
     return stringificationBuffer;
 }
 
-[[nodiscard]] std::optional<VariableAccessOverlapCheckResult> utils::checkOverlapBetweenVariableAccesses(const syrec::VariableAccess& lVariableAccess, const syrec::VariableAccess& rVariableAccess) {
-    const syrec::Variable::ptr& lVarPtr = lVariableAccess.getVar();
-    const syrec::Variable::ptr& rVarPtr = rVariableAccess.getVar();
-    if (lVarPtr == nullptr || rVarPtr == nullptr || !doReferenceVariablesMatch(*lVarPtr, *rVarPtr)) {
+std::optional<VariableAccessOverlapCheckResult> utils::checkOverlapBetweenVariableAccesses(const syrec::VariableAccess& lVariableAccess, const syrec::VariableAccess& rVariableAccess) {
+    return VariableAccessOverlapChecker(lVariableAccess).checkOverlapWith(rVariableAccess);
+}
+
+VariableAccessOverlapChecker::VariableAccessOverlapChecker(const syrec::VariableAccess& fixedVariableAccess):
+    fixedVariableAccess(evaluateVariableAccess(fixedVariableAccess)) {}
+
+std::optional<VariableAccessOverlapCheckResult> VariableAccessOverlapChecker::checkOverlapWith(const syrec::VariableAccess& variableAccess) const {
+    if (fixedVariableAccess.var == nullptr || variableAccess.getVar() == nullptr || !doReferenceVariablesMatch(*fixedVariableAccess.var, *variableAccess.getVar())) {
         return std::nullopt;
     }
+    return checkOverlapBetweenEvaluatedVariableAccesses(fixedVariableAccess, evaluateVariableAccess(variableAccess));
+}
+
+VariableAccessOverlapChecker::EvaluatedVariableAccess VariableAccessOverlapChecker::evaluateVariableAccess(const syrec::VariableAccess& variableAccess) {
+    EvaluatedVariableAccess evaluatedVariableAccess{.var = variableAccess.getVar(), .numDefinedIndices = variableAccess.indexes.size(), .constantValuePerDimension = {}, .accessedValueOfFirstDimension = std::nullopt, .bitRangeStart = std::nullopt, .bitRangeEnd = std::nullopt};
+    if (evaluatedVariableAccess.var == nullptr) {
+        return evaluatedVariableAccess;
+    }
+    const syrec::Variable& var = *evaluatedVariableAccess.var;
+
+    // Null indices and indices with a non-constant value are both treated as an index with an unknown value
+    evaluatedVariableAccess.constantValuePerDimension.reserve(variableAccess.indexes.size());
+    for (const syrec::Expression::ptr& exprDefiningAccessedValueOfDimension: variableAccess.indexes) {
+        evaluatedVariableAccess.constantValuePerDimension.emplace_back(exprDefiningAccessedValueOfDimension != nullptr ? tryEvaluateNumericExpr(*exprDefiningAccessedValueOfDimension) : std::nullopt);
+    }
+
+    if (const auto& exprDefiningAccessedValueOfFirstDimension = !variableAccess.indexes.empty() ? variableAccess.indexes.front() : nullptr; exprDefiningAccessedValueOfFirstDimension == nullptr) {
+        evaluatedVariableAccess.accessedValueOfFirstDimension = var.dimensions.size() == 1 && var.dimensions.front() == 1 ? std::make_optional(0) : std::nullopt;
+    } else {
+        evaluatedVariableAccess.accessedValueOfFirstDimension = evaluatedVariableAccess.constantValuePerDimension.front();
+    }
+
+    // The caller does not need to explicitly define the accessed bit range in the variable access if he wishes to access the whole variable bitwidth
+    evaluatedVariableAccess.bitRangeStart = 0;
+    evaluatedVariableAccess.bitRangeEnd   = var.bitwidth - 1;
+    if (variableAccess.range.has_value()) {
+        evaluatedVariableAccess.bitRangeStart = tryEvaluateNumber(variableAccess.range->first);
+        evaluatedVariableAccess.bitRangeEnd   = variableAccess.range->first == variableAccess.range->second ? evaluatedVariableAccess.bitRangeStart : tryEvaluateNumber(variableAccess.range->second);
+    }
+    return evaluatedVariableAccess;
+}
 
-    const syrec::Variable& lVar = *lVarPtr;
-    const syrec::Variable& rVar = *rVarPtr;
+std::optional<VariableAccessOverlapCheckResult> VariableAccessOverlapChecker::checkOverlapBetweenEvaluatedVariableAccesses(const EvaluatedVariableAccess& lVariableAccess, const EvaluatedVariableAccess& rVariableAccess) {
+    const syrec::Variable& lVar = *lVariableAccess.var;
+    const syrec::Variable& rVar = *rVariableAccess.var;
 
-    const std::size_t         numDimensionsToCheck = std::min({lVar.dimensions.size(), lVariableAccess.indexes.size(),
-                                                               rVar.dimensions.size(), rVariableAccess.indexes.size()});
+    const std::size_t         numDimensionsToCheck = std::min({lVar.dimensions.size(), lVariableAccess.numDefinedIndices,
+                                                               rVar.dimensions.size(), rVariableAccess.numDefinedIndices});
     std::vector<unsigned int> constantIndicesOfAccessedValuesPerDimension;
     if (numDimensionsToCheck == 0) {
-        const auto& exprDefiningAccessedValueOfDimensionInLVar = !lVariableAccess.indexes.empty() ? lVariableAccess.indexes.front() : nullptr;
-        const auto& exprDefiningAccessedValueOfDimensionInRVar = !rVariableAccess.indexes.empty() ? rVariableAccess.indexes.front() : nullptr;
-
-        std::optional<unsigned int> accessedValueInLVar;
-        std::optional<unsigned int> accessedValueInRVar;
-        if (exprDefiningAccessedValueOfDimensionInLVar == nullptr) {
-            accessedValueInLVar = lVar.dimensions.size() == 1 && lVar.dimensions.front() == 1 ? std::make_optional(0) : std::nullopt;
-        } else {
-            accessedValueInLVar = tryEvaluateNumericExpr(*exprDefiningAccessedValueOfDimensionInLVar);
-        }
-
-        if (exprDefiningAccessedValueOfDimensionInRVar == nullptr) {
-            accessedValueInRVar = rVar.dimensions.size() == 1 && rVar.dimensions.front() == 1 ? std::make_optional(0) : std::nullopt;
-        } else {
-            accessedValueInRVar = tryEvaluateNumericExpr(*exprDefiningAccessedValueOfDimensionInRVar);
-        }
+        const std::optional<unsigned int>& accessedValueInLVar = lVariableAccess.accessedValueOfFirstDimension;
+        const std::optional<unsigned int>& accessedValueInRVar = rVariableAccess.accessedValueOfFirstDimension;
 
         // If one were to assume that all indices provided in the two variable accesses are within range of the formal bounds of the accessed variable, an index with an non-constant value
         // could be assumed to be overlapping for a dimension that has only one value. However, we do not assume in-range indices and thus can only report a potential overlap. The same reasoning
@@ -99,14 +122,8 @@ std::string VariableAccessOverlapCheckResult::stringifyOverlappingIndicesInforma
     }
 
     for (std::size_t i = 0; i < numDimensionsToCheck; ++i) {
-        const auto& exprDefiningAccessedValueOfDimensionInLVar = lVariableAccess.indexes.at(i);
-        const auto& exprDefiningAccessedValueOfDimensionInRVar = rVariableAccess.indexes.at(i);
-        if (exprDefiningAccessedValueOfDimensionInLVar == nullptr || exprDefiningAccessedValueOfDimensionInRVar == nullptr) {
-            return VariableAccessOverlapCheckResult(VariableAccessOverlapCheckResult::OverlapState::MaybeOverlapping);
-        }
-
-        const std::optional<unsigned int> accessedValueInLVar = exprDefiningAccessedValueOfDimensionInLVar != nullptr ? tryEvaluateNumericExpr(*exprDefiningAccessedValueOfDimensionInLVar) : std::nullopt;
-        const std::optional<unsigned int> accessedValueInRVar = exprDefiningAccessedValueOfDimensionInRVar != nullptr ? tryEvaluateNumericExpr(*exprDefiningAccessedValueOfDimensionInRVar) : std::nullopt;
+        const std::optional<unsigned int>& accessedValueInLVar = lVariableAccess.constantValuePerDimension[i];
+        const std::optional<unsigned int>& accessedValueInRVar = rVariableAccess.constantValuePerDimension[i];
 
         // If one were to assume that all indices provided in the two variable accesses are within range of the formal bounds of the accessed variable, an index with an non-constant value
         // could be assumed to be overlapping for a dimension that has only one value. However, we do not assume in-range indices and thus can only report a potential overlap. The same reasoning
@@ -120,21 +137,10 @@ std::string VariableAccessOverlapCheckResult::stringifyOverlappingIndicesInforma
         constantIndicesOfAccessedValuesPerDimension.emplace_back(accessedValueInLVar.value());
     }
 
-    // The caller does not need to explicitly define the accessed bit range in the variable access if he wishes to access the whole variable bitwidth
-    std::optional<unsigned int> evaluatedLVarBitRangeStart = 0;
-    std::optional               evaluatedLVarBitRangeEnd   = lVariableAccess.var->bitwidth - 1;
-    if (lVariableAccess.range.has_value()) {
-        evaluatedLVarBitRangeStart = tryEvaluateNumber(lVariableAccess.range->first);
-        evaluatedLVarBitRangeEnd   = lVariableAccess.range->first == lVariableAccess.range->second ? evaluatedLVarBitRangeStart : tryEvaluateNumber(lVariableAccess.range->second);
-    }
-
-    std::optional<unsigned int> evaluatedRVarBitRangeStart = 0;
-    std::optional               evaluatedRVarBitRangeEnd   = rVariableAccess.var->bitwidth - 1;
-    if (rVariableAccess.range.has_value()) {
-        evaluatedRVarBitRangeStart = tryEvaluateNumber(rVariableAccess.range->first);
-        evaluatedRVarBitRangeEnd   = rVariableAccess.range->first == rVariableAccess.range->second ? evaluatedRVarBitRangeStart : tryEvaluateNumber(rVariableAccess.range->second);
-    }
-
+    const std::optional<unsigned int>& evaluatedLVarBitRangeStart = lVariableAccess.bitRangeStart;
+    const std::optional<unsigned int>& evaluatedLVarBitRangeEnd   = lVariableAccess.bitRangeEnd;
+    const std::optional<unsigned int>& evaluatedRVarBitRangeStart = rVariableAccess.bitRangeStart;
+    const std::optional<unsigned int>& evaluatedRVarBitRangeEnd   = rVariableAccess.bitRangeEnd;
     if ((!evaluatedLVarBitRangeStart.has_value() && !evaluatedLVarBitRangeEnd.has_value()) || (!evaluatedRVarBitRangeStart.has_value() && !evaluatedRVarBitRangeEnd.has_value())) {
         return VariableAccessOverlapCheckResult(VariableAccessOverlapCheckResult::OverlapState::MaybeOverlapping);
     }
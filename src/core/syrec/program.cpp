@@ -10,107 +10,409 @@
 
 #include "core/syrec/program.hpp"
 
+#include "ANTLRErrorListener.h"
 #include "ANTLRInputStream.h"
+#include "BailErrorStrategy.h"
+#include "CharStream.h"
 #include "CommonTokenStream.h"
+#include "ConsoleErrorListener.h"
+#include "DefaultErrorStrategy.h"
+#include "Exceptions.h"
 #include "TSyrecLexer.h"
 #include "TSyrecParser.h"
+#include "Token.h"
+#include "atn/ParserATNSimulator.h"
+#include "atn/PredictionMode.h"
 #include "core/configurable_options.hpp"
+#include "core/executor.hpp"
+#include "core/statistics.hpp"
+#include "core/syrec/ir_memory_usage.hpp"
+#include "core/syrec/module.hpp"
 #include "core/syrec/parser/components/custom_error_listener.hpp"
 #include "core/syrec/parser/components/custom_module_visitor.hpp"
+#include "core/syrec/parser/utils/ascii_char_stream_view.hpp"
+#include "core/syrec/parser/utils/memory_mapped_file.hpp"
 #include "core/syrec/parser/utils/parser_messages_container.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
-#include <fstream>
-#include <ios>
-#include <limits>
 #include <memory>
 #include <optional>
-#include <sstream>
 #include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
+
+namespace {
+    /*
+     * Detach the lexer, token stream and parser of a reader from the processed character stream once the processing of a SyReC program finished (or failed with an exception), since the lexer
+     * will access its current character stream when it is attached to the next one. Detaching the token stream and parser also releases the tokens and parse tree of the processed program.
+     */
+    class ScopedCharStreamAttachment {
+    public:
+        ScopedCharStreamAttachment(syrec_parser::TSyrecLexer& lexer, antlr4::CommonTokenStream& tokens, syrec_parser::TSyrecParser& parser, antlr4::CharStream& charStream, antlr4::CharStream& detachedCharStream):
+            lexer(lexer), tokens(tokens), parser(parser), detachedCharStream(detachedCharStream) {
+            lexer.setInputStream(&charStream);
+            tokens.setTokenSource(&lexer);
+            parser.setTokenStream(&tokens);
+        }
+
+        ~ScopedCharStreamAttachment() {
+            parser.setTokenStream(&tokens);
+            lexer.setInputStream(&detachedCharStream);
+            tokens.setTokenSource(&lexer);
+        }
+
+        ScopedCharStreamAttachment(const ScopedCharStreamAttachment&)            = delete;
+        ScopedCharStreamAttachment(ScopedCharStreamAttachment&&)                 = delete;
+        ScopedCharStreamAttachment& operator=(const ScopedCharStreamAttachment&) = delete;
+        ScopedCharStreamAttachment& operator=(ScopedCharStreamAttachment&&)      = delete;
+
+    private:
+        syrec_parser::TSyrecLexer&  lexer;
+        antlr4::CommonTokenStream&  tokens;
+        syrec_parser::TSyrecParser& parser;
+        antlr4::CharStream&         detachedCharStream;
+    };
+
+    /*
+     * Parse a SyReC program using the two-stage parsing strategy of ANTLR. The faster SLL prediction mode, which does not fall back to full-context predictions, is able to parse almost all
+     * SyReC programs. Only if the SLL prediction fails, which either indicates a syntax error or a program requiring a full-context prediction, the program is parsed again using the LL
+     * prediction mode. The error listener is only notified about the syntax errors found in the second stage since the first stage is aborted at the first prediction error.
+     */
+    [[nodiscard]] syrec_parser::TSyrecParser::ProgramContext* parseProgramInTwoStages(syrec_parser::TSyrecParser& parser, antlr4::CommonTokenStream& tokens, antlr4::ANTLRErrorListener& errorListener) {
+        auto* const predictionSimulator = parser.getInterpreter<antlr4::atn::ParserATNSimulator>();
+        parser.removeErrorListeners();
+        parser.setErrorHandler(std::make_shared<antlr4::BailErrorStrategy>());
+        predictionSimulator->setPredictionMode(antlr4::atn::PredictionMode::SLL);
+        try {
+            return parser.program();
+        } catch (const antlr4::ParseCancellationException&) {
+            // The tokens already fetched from the lexer during the first stage are reused by the second stage.
+            tokens.seek(0);
+            parser.reset();
+        }
+
+        parser.addErrorListener(&antlr4::ConsoleErrorListener::INSTANCE);
+        parser.addErrorListener(&errorListener);
+        parser.setErrorHandler(std::make_shared<antlr4::DefaultErrorStrategy>());
+        predictionSimulator->setPredictionMode(antlr4::atn::PredictionMode::LL);
+        syrec_parser::TSyrecParser::ProgramContext* parsedProgramTree = parser.program();
+        parser.removeErrorListener(&errorListener);
+        return parsedProgramTree;
+    }
+
+    /*
+     * Parse a part of the module declarations of a SyReC program starting at the given position of the program using only the SLL prediction mode, the part is parsed again as part of a sequential parse of the whole program
+     * if it contains any lexer, syntax or semantic error or requires a full-context prediction. The overload resolution of the call-/uncall statements of the part is only performed once all parts were joined.
+     */
+    [[nodiscard]] std::optional<syrec_parser::CustomModuleVisitor::ModulesWithNotPerformedOverloadResolution> parsePartOfModuleDeclarations(syrec_parser::TSyrecLexer& lexer, antlr4::CommonTokenStream& tokens, syrec_parser::TSyrecParser& parser, antlr4::CharStream& detachedCharStream, const std::string_view& part, const std::size_t lineOfPart, const std::size_t charPositionInLineOfPart, const syrec::ConfigurableOptions& settings) {
+        syrec_parser::AsciiCharStreamView charStream(part);
+        const ScopedCharStreamAttachment  charStreamAttachment(lexer, tokens, parser, charStream, detachedCharStream);
+        // The line and column of the first token of the part are defined relative to the whole program to generate the same line numbers of the statements as a sequential parse.
+        lexer.setLine(lineOfPart);
+        lexer.setCharPositionInLine(charPositionInLineOfPart);
+
+        lexer.removeErrorListener(&antlr4::ConsoleErrorListener::INSTANCE);
+        parser.removeErrorListeners();
+        parser.setErrorHandler(std::make_shared<antlr4::BailErrorStrategy>());
+        parser.getInterpreter<antlr4::atn::ParserATNSimulator>()->setPredictionMode(antlr4::atn::PredictionMode::SLL);
+
+        const std::size_t                           numLexerErrorsPriorToParsing = lexer.getNumberOfSyntaxErrors();
+        syrec_parser::TSyrecParser::ProgramContext* parsedPartTree               = nullptr;
+        try {
+            parsedPartTree = parser.program();
+        } catch (const antlr4::ParseCancellationException&) {
+            // Syntax errors and full-context predictions are handled by the sequential parse of the whole program.
+        }
+        const bool foundLexerErrors = lexer.getNumberOfSyntaxErrors() != numLexerErrorsPriorToParsing;
+        lexer.addErrorListener(&antlr4::ConsoleErrorListener::INSTANCE);
+        if (parsedPartTree == nullptr || foundLexerErrors) {
+            return std::nullopt;
+        }
+
+        const auto parserMessageGenerator = std::make_shared<syrec_parser::ParserMessagesContainer>(settings.optionalMaxNumReportedParserErrors);
+        const auto customVisitor          = std::make_unique<syrec_parser::CustomModuleVisitor>(parserMessageGenerator, settings);
+        auto       parsedModules          = customVisitor->parseModulesWithoutOverloadResolution(parsedPartTree);
+        if (!parserMessageGenerator->getMessagesOfType(syrec_parser::Message::Type::Error).empty() || parserMessageGenerator->getNumNotRecordedErrors() != 0) {
+            return std::nullopt;
+        }
+        return parsedModules;
+    }
+
+    // A SyReC program using every production of the grammar (but not necessarily a semantically valid one) which is used to populate the prediction caches shared by all parser instances.
+    constexpr std::string_view PREDICTION_CACHE_WARM_UP_PROGRAM = R"(module warmUp(in a(4), inout b[2](4), out c(4))
+  wire w(4), v[2][1](4)
+  state s(4)
+  for $i = 0 to 1 step 1 do
+    c.0:1 ^= ((a + b[$i]) * #a)
+  rof;
+  for (4 - 2) step - 1 do
+    skip
+  rof;
+  if ((a > 0x1) && !(a = (2 * 0b1))) then
+    b[0] <=> b[1].0:3;
+    ++= w;
+    --= v[1][0];
+    ~= w.1;
+    w += ((a << 2) | ~b[1].1)
+  else
+    c -= ((a % 2) >> 1)
+  fi ((a > 0x1) && !(a = (2 * 0b1)))
+module main(in a(4), inout b[2](4), out c(4))
+  call warmUp(a, b, c);
+  uncall warmUp(a, b, c))";
+} // namespace
 
 namespace syrec {
-    std::string Program::read(const std::string& filename, const ConfigurableOptions& settings) {
+    struct ProgramReader::ParserInstances {
+        // The lexer is never attached to a destroyed character stream since it is attached to this empty stream whenever no SyReC program is processed.
+        syrec_parser::AsciiCharStreamView detachedCharStream{std::string_view()};
+        syrec_parser::TSyrecLexer         lexer{&detachedCharStream};
+        antlr4::CommonTokenStream         tokens{&lexer};
+        syrec_parser::TSyrecParser        parser{&tokens};
+    };
+
+    ProgramReader::ProgramReader():
+        parserInstances(std::make_unique<ParserInstances>()) {}
+
+    ProgramReader::~ProgramReader()                                   = default;
+    ProgramReader::ProgramReader(ProgramReader&&) noexcept            = default;
+    ProgramReader& ProgramReader::operator=(ProgramReader&&) noexcept = default;
+
+    void ProgramReader::warmUpPredictionCaches() {
+        ProgramReader reader;
+        Program       warmUpProgram;
+        static_cast<void>(reader.readFromString(warmUpProgram, PREDICTION_CACHE_WARM_UP_PROGRAM));
+    }
+
+    std::string ProgramReader::read(Program& program, const std::string& filename, const ConfigurableOptions& settings, Statistics* optionalRecordedStatistics) {
         std::string foundErrorWhileReadingFileContent;
-        if (const std::optional<std::string> readFileContent = tryReadFileContent(filename, &foundErrorWhileReadingFileContent); readFileContent.has_value() && foundErrorWhileReadingFileContent.empty()) {
-            readProgramFromString(*readFileContent, settings, foundErrorWhileReadingFileContent);
+        if (const std::optional<syrec_parser::MemoryMappedFile> memoryMappedFile = syrec_parser::MemoryMappedFile::open(filename, &foundErrorWhileReadingFileContent); memoryMappedFile.has_value() && foundErrorWhileReadingFileContent.empty()) {
+            foundErrorWhileReadingFileContent = readProgramFromContent(program, memoryMappedFile->getContent(), filename, settings, optionalRecordedStatistics);
         }
         return foundErrorWhileReadingFileContent;
     }
 
-    std::string Program::readFromString(const std::string_view& stringifiedProgram, const ConfigurableOptions& settings) {
+    std::string ProgramReader::readFromString(Program& program, const std::string_view& stringifiedProgram, const ConfigurableOptions& settings, Statistics* optionalRecordedStatistics) {
+        return readProgramFromContent(program, stringifiedProgram, "", settings, optionalRecordedStatistics);
+    }
+
+    std::string ProgramReader::read(Program& program, const std::string& filename, const ModuleLibrary& linkedLibrary, const ConfigurableOptions& settings, Statistics* optionalRecordedStatistics) {
         std::string foundErrorWhileReadingFileContent;
-        readProgramFromString(stringifiedProgram, settings, foundErrorWhileReadingFileContent);
+        if (const std::optional<syrec_parser::MemoryMappedFile> memoryMappedFile = syrec_parser::MemoryMappedFile::open(filename, &foundErrorWhileReadingFileContent); memoryMappedFile.has_value() && foundErrorWhileReadingFileContent.empty()) {
+            foundErrorWhileReadingFileContent = readProgramFromContent(program, memoryMappedFile->getContent(), filename, settings, optionalRecordedStatistics, {}, &linkedLibrary);
+        }
         return foundErrorWhileReadingFileContent;
     }
 
-    bool Program::readFile(const std::string& filename, const ConfigurableOptions& settings, std::string& error) {
-        error = read(filename, settings);
-        return error.empty();
+    std::string ProgramReader::readFromString(Program& program, const std::string_view& stringifiedProgram, const ModuleLibrary& linkedLibrary, const ConfigurableOptions& settings, Statistics* optionalRecordedStatistics) {
+        return readProgramFromContent(program, stringifiedProgram, "", settings, optionalRecordedStatistics, {}, &linkedLibrary);
     }
 
-    bool Program::readProgramFromString(const std::string_view& content, const ConfigurableOptions& settings, std::string& error) {
-        antlr4::ANTLRInputStream   input(content);
-        syrec_parser::TSyrecLexer  lexer(&input);
-        antlr4::CommonTokenStream  tokens(&lexer);
-        syrec_parser::TSyrecParser antlrParser(&tokens);
+    std::string ProgramReader::readModuleLibrary(ModuleLibrary::ptr& library, const std::string& filename, const ConfigurableOptions& settings) {
+        std::string foundErrorWhileReadingFileContent;
+        if (const std::optional<syrec_parser::MemoryMappedFile> memoryMappedFile = syrec_parser::MemoryMappedFile::open(filename, &foundErrorWhileReadingFileContent); memoryMappedFile.has_value() && foundErrorWhileReadingFileContent.empty()) {
+            Program modulesOfLibrary;
+            foundErrorWhileReadingFileContent = readProgramFromContent(modulesOfLibrary, memoryMappedFile->getContent(), filename, settings, nullptr, {}, nullptr, &library);
+        }
+        return foundErrorWhileReadingFileContent;
+    }
 
-        auto       parserMessageGenerator = std::make_shared<syrec_parser::ParserMessagesContainer>();
-        const auto customVisitor          = std::make_unique<syrec_parser::CustomModuleVisitor>(parserMessageGenerator, settings);
+    std::string ProgramReader::readModuleLibraryFromString(ModuleLibrary::ptr& library, const std::string_view& stringifiedLibrary, const ConfigurableOptions& settings) {
+        Program modulesOfLibrary;
+        return readProgramFromContent(modulesOfLibrary, stringifiedLibrary, "", settings, nullptr, {}, nullptr, &library);
+    }
+
+    std::string ProgramReader::readProgramFromContent(Program& program, const std::string_view& content, const std::string& sourceName, const ConfigurableOptions& settings, Statistics* optionalRecordedStatistics, const Module::vec& modulesDeclaredOutsideOfContent, const ModuleLibrary* optionalLinkedLibrary, ModuleLibrary::ptr* optionalParsedLibrary) {
+        // Only the characters of ASCII encoded content can be read without decoding them, all other content is decoded into a UTF-32 encoded copy as before.
+        const bool isAsciiContent = syrec_parser::AsciiCharStreamView::isAsciiText(content);
+        if (settings.parseModuleDeclarationsConcurrently && !settings.pruneModulesNotReachableFromProgramEntryPoint && isAsciiContent && modulesDeclaredOutsideOfContent.empty() && optionalLinkedLibrary == nullptr && optionalParsedLibrary == nullptr && tryReadModuleDeclarationsConcurrently(program, content, settings, optionalRecordedStatistics)) {
+            return {};
+        }
+
+        std::optional<syrec_parser::AsciiCharStreamView> asciiCharStream;
+        std::optional<antlr4::ANTLRInputStream>          decodedCharStream;
+        antlr4::CharStream*                              charStream = nullptr;
+        if (isAsciiContent) {
+            charStream = &asciiCharStream.emplace(content, sourceName);
+        } else {
+            charStream = &decodedCharStream.emplace(content);
+        }
+
+        syrec_parser::TSyrecLexer&        lexer       = parserInstances->lexer;
+        syrec_parser::TSyrecParser&       antlrParser = parserInstances->parser;
+        const ScopedCharStreamAttachment charStreamAttachment(lexer, parserInstances->tokens, antlrParser, *charStream, parserInstances->detachedCharStream);
+
+        auto       parserMessageGenerator = std::make_shared<syrec_parser::ParserMessagesContainer>(settings.optionalMaxNumReportedParserErrors);
+        const auto customVisitor          = std::make_unique<syrec_parser::CustomModuleVisitor>(parserMessageGenerator, settings, optionalLinkedLibrary != nullptr ? optionalLinkedLibrary->symbolTableSnapshot : nullptr);
         const auto customErrorListener    = std::make_unique<syrec_parser::CustomErrorListener>(parserMessageGenerator);
+        customVisitor->declareModulesDefinedOutsideOfProgram(modulesDeclaredOutsideOfContent);
         lexer.addErrorListener(customErrorListener.get());
-        antlrParser.addErrorListener(customErrorListener.get());
 
-        const std::optional<std::shared_ptr<Program>> parsedSyrecProgram = customVisitor->parseProgram(antlrParser.program());
+        const auto                                        parsingStartTime     = std::chrono::steady_clock::now();
+        const syrec_parser::TSyrecParser::ProgramContext* parsedProgramTree    = parseProgramInTwoStages(antlrParser, parserInstances->tokens, *customErrorListener);
+        const auto                                        parsingEndTime       = std::chrono::steady_clock::now();
+        const std::optional<std::shared_ptr<Program>>     parsedSyrecProgram   = optionalParsedLibrary != nullptr ? customVisitor->parseModuleLibrary(parsedProgramTree) : customVisitor->parseProgram(parsedProgramTree);
+        const auto                                        semanticCheckEndTime = std::chrono::steady_clock::now();
+        if (optionalRecordedStatistics != nullptr) {
+            optionalRecordedStatistics->parsingRuntimeInNanoseconds       = Statistics::toNanoseconds(parsingEndTime - parsingStartTime);
+            optionalRecordedStatistics->semanticCheckRuntimeInNanoseconds = Statistics::toNanoseconds(semanticCheckEndTime - parsingEndTime);
+            if (settings.recordMemoryUsage) {
+                optionalRecordedStatistics->memoryUsage.numBytesOfSymbolTables = customVisitor->determineNumBytesOfSymbolTable();
+                optionalRecordedStatistics->memoryUsage.numBytesOfProgram      = parsedSyrecProgram.has_value() && *parsedSyrecProgram != nullptr ? determineNumBytesOfIr((*parsedSyrecProgram)->modules()) : 0U;
+            }
+        }
 
         lexer.removeErrorListener(customErrorListener.get());
-        antlrParser.removeErrorListener(customErrorListener.get());
 
         // In some cases the parser generates semantic errors at positions that were already processed or prior to already recorded errors (i.e. index out of range errors are reported during
         // the processing of the operands of an binary expression while an overlap between the left and right-hand side of an assignment can only be reported if the full expression on the right-hand
         // side of assignment were processed.
         // Since the parser currently only generates errors, sorting of the recorded error messages is sufficient.
         parserMessageGenerator->sortRecordedMessagesOfTypeInAscendingOrder(syrec_parser::Message::Type::Error);
-        if (const auto& generatedErrorMessages = parserMessageGenerator->getMessagesOfType(syrec_parser::Message::Type::Error); !generatedErrorMessages.empty()) {
-            std::stringstream concatenatedErrorMessageContainer;
-            for (std::size_t i = 0; i < generatedErrorMessages.size() - 1; ++i) {
-                concatenatedErrorMessageContainer << generatedErrorMessages.at(i)->stringify();
+        const std::vector<syrec_parser::Message::ptr>& generatedErrorMessages = parserMessageGenerator->getMessagesOfType(syrec_parser::Message::Type::Error);
+        const std::size_t                              numNotReportedErrors   = parserMessageGenerator->getNumNotRecordedErrors();
+        if (!generatedErrorMessages.empty() || numNotReportedErrors != 0) {
 #if _WIN32
-                concatenatedErrorMessageContainer << "\r\n";
+            constexpr std::string_view messageDelimiter = "\r\n";
 #else
-                concatenatedErrorMessageContainer << "\n";
+            constexpr std::string_view messageDelimiter = "\n";
 #endif
+            std::string concatenatedErrorMessages;
+            for (std::size_t i = 0; i < generatedErrorMessages.size(); ++i) {
+                if (i != 0) {
+                    concatenatedErrorMessages.append(messageDelimiter);
+                }
+                concatenatedErrorMessages.append(generatedErrorMessages[i]->stringify());
             }
-            concatenatedErrorMessageContainer << generatedErrorMessages.back()->stringify();
-            error = concatenatedErrorMessageContainer.str();
-            return false;
+            if (numNotReportedErrors != 0) {
+                if (!concatenatedErrorMessages.empty()) {
+                    concatenatedErrorMessages.append(messageDelimiter);
+                }
+                concatenatedErrorMessages.append("-- " + std::to_string(numNotReportedErrors) + " further errors were not reported");
+            }
+            return concatenatedErrorMessages;
         }
         if (parsedSyrecProgram.has_value() && *parsedSyrecProgram != nullptr) {
-            modulesVec = parsedSyrecProgram->get()->modulesVec;
+            program.modulesVec = parsedSyrecProgram->get()->modulesVec;
+            if (optionalLinkedLibrary != nullptr) {
+                program.modulesVec.insert(program.modulesVec.begin(), optionalLinkedLibrary->modulesVec.cbegin(), optionalLinkedLibrary->modulesVec.cend());
+            }
+            if (optionalParsedLibrary != nullptr) {
+                *optionalParsedLibrary = std::shared_ptr<const ModuleLibrary>(new ModuleLibrary(program.modulesVec, customVisitor->createSnapshotOfSymbolTable()));
+            }
         }
-        return true;
+        return {};
     }
 
-    std::optional<std::string> Program::tryReadFileContent(const std::string& filename, std::string* foundFileHandlingErrors) {
-        // We cannot pass the filename as a std::string_view since the std::ifstream constructor or any of the underlying functions
-        // will expect a null-terminated std::string argument to function correctly.
-        if (std::ifstream inputFileStream(filename, std::ifstream::in | std::ifstream::binary); inputFileStream.is_open()) {
-            inputFileStream.ignore(std::numeric_limits<std::streamsize>::max());
-            const std::streamsize fileContentLength = inputFileStream.gcount();
-            inputFileStream.clear(); //  Since ignore will have set eof.
-            inputFileStream.seekg(0, std::ios_base::beg);
+    std::optional<std::vector<std::size_t>> ProgramReader::findOffsetsOfModuleDeclarations(const std::string_view& asciiContent) {
+        syrec_parser::AsciiCharStreamView charStream(asciiContent);
+        syrec_parser::TSyrecLexer&        lexer = parserInstances->lexer;
+        const ScopedCharStreamAttachment  charStreamAttachment(lexer, parserInstances->tokens, parserInstances->parser, charStream, parserInstances->detachedCharStream);
 
-            std::string fileContentBuffer(static_cast<std::string::size_type>(fileContentLength), ' ');
-            inputFileStream.read(fileContentBuffer.data(), fileContentLength);
-            if (!inputFileStream.bad()) {
-                return std::make_optional(fileContentBuffer);
+        // Lexer errors are reported by the subsequent parse of the program, thus they are not printed while only looking for the module declarations.
+        lexer.removeErrorListener(&antlr4::ConsoleErrorListener::INSTANCE);
+        const std::size_t        numSyntaxErrorsPriorToLexing = lexer.getNumberOfSyntaxErrors();
+        std::vector<std::size_t> offsetsOfModuleDeclarations;
+        for (std::unique_ptr<antlr4::Token> token = lexer.nextToken(); token->getType() != antlr4::Token::EOF; token = lexer.nextToken()) {
+            if (token->getType() == syrec_parser::TSyrecLexer::KEYWORD_MODULE && token->getChannel() == antlr4::Token::DEFAULT_CHANNEL) {
+                offsetsOfModuleDeclarations.emplace_back(token->getStartIndex());
             }
-            if (foundFileHandlingErrors != nullptr) {
-                *foundFileHandlingErrors = "Error while reading content from file @ " + std::string(filename);
+        }
+        const bool foundLexerErrors = lexer.getNumberOfSyntaxErrors() != numSyntaxErrorsPriorToLexing;
+        lexer.addErrorListener(&antlr4::ConsoleErrorListener::INSTANCE);
+
+        if (foundLexerErrors) {
+            return std::nullopt;
+        }
+        return offsetsOfModuleDeclarations;
+    }
+
+    std::vector<std::string_view> ProgramReader::splitIntoModuleDeclarations(const std::string_view& asciiContent, const std::vector<std::size_t>& offsetsOfModuleDeclarations) {
+        std::vector<std::string_view> moduleDeclarations;
+        moduleDeclarations.reserve(offsetsOfModuleDeclarations.size());
+        for (std::size_t i = 0; i < offsetsOfModuleDeclarations.size(); ++i) {
+            const std::size_t declarationStart = i == 0 ? 0 : offsetsOfModuleDeclarations[i];
+            const std::size_t declarationEnd   = i + 1 < offsetsOfModuleDeclarations.size() ? offsetsOfModuleDeclarations[i + 1] : asciiContent.size();
+            moduleDeclarations.emplace_back(asciiContent.substr(declarationStart, declarationEnd - declarationStart));
+        }
+        return moduleDeclarations;
+    }
+
+    bool ProgramReader::tryReadModuleDeclarationsConcurrently(Program& program, const std::string_view& asciiContent, const ConfigurableOptions& settings, Statistics* optionalRecordedStatistics) {
+        const auto                                    parsingStartTime            = std::chrono::steady_clock::now();
+        const std::optional<std::vector<std::size_t>> offsetsOfModuleDeclarations = findOffsetsOfModuleDeclarations(asciiContent);
+        if (!offsetsOfModuleDeclarations.has_value() || offsetsOfModuleDeclarations->size() < 2) {
+            return false;
+        }
+
+        // The declarations are grouped into contiguous parts of roughly the same number of characters with every thread being able to claim multiple parts to balance the load between parts with largely different parsing times.
+        const std::vector<std::string_view> moduleDeclarations = splitIntoModuleDeclarations(asciiContent, *offsetsOfModuleDeclarations);
+        const std::size_t                   numParts           = std::min(moduleDeclarations.size(), 4U * Executor::determineNumThreads(settings.maxNumThreads));
+        std::vector<std::size_t>            offsetsOfParts;
+        offsetsOfParts.reserve(numParts + 1);
+        for (std::size_t i = 0, numCharactersOfPrecedingDeclarations = 0; i < moduleDeclarations.size(); numCharactersOfPrecedingDeclarations += moduleDeclarations[i].size(), ++i) {
+            if (numCharactersOfPrecedingDeclarations * numParts >= offsetsOfParts.size() * asciiContent.size()) {
+                offsetsOfParts.emplace_back(numCharactersOfPrecedingDeclarations);
             }
-        } else if (foundFileHandlingErrors != nullptr) {
-            *foundFileHandlingErrors = "Cannot open given circuit file @ " + std::string(filename);
         }
-        return std::nullopt;
+        offsetsOfParts.emplace_back(asciiContent.size());
+
+        std::vector<std::optional<syrec_parser::CustomModuleVisitor::ModulesWithNotPerformedOverloadResolution>> modulesOfParts(offsetsOfParts.size() - 1);
+        Executor::getShared().parallelFor(modulesOfParts.size(), [&](const std::size_t partIndex) {
+            // Every thread reuses its own parser instances for all parts it parses, the prediction caches are shared by all parser instances.
+            thread_local ProgramReader readerOfThread;
+            ParserInstances&           parserInstancesOfThread = *readerOfThread.parserInstances;
+
+            const std::string_view precedingContent         = asciiContent.substr(0, offsetsOfParts[partIndex]);
+            const std::size_t      startOfLineOfPart        = precedingContent.rfind('\n') == std::string_view::npos ? 0U : precedingContent.rfind('\n') + 1U;
+            const std::size_t      lineOfPart               = 1U + static_cast<std::size_t>(std::count(precedingContent.cbegin(), precedingContent.cend(), '\n'));
+            const std::size_t      charPositionInLineOfPart = precedingContent.size() - startOfLineOfPart;
+            modulesOfParts[partIndex]                       = parsePartOfModuleDeclarations(parserInstancesOfThread.lexer, parserInstancesOfThread.tokens, parserInstancesOfThread.parser, parserInstancesOfThread.detachedCharStream, asciiContent.substr(offsetsOfParts[partIndex], offsetsOfParts[partIndex + 1] - offsetsOfParts[partIndex]), lineOfPart, charPositionInLineOfPart, settings);
+        }, settings.maxNumThreads, settings.deterministicParallelExecution);
+        const auto parsingEndTime = std::chrono::steady_clock::now();
+
+        std::vector<syrec_parser::CustomModuleVisitor::ModulesWithNotPerformedOverloadResolution> parsedParts;
+        parsedParts.reserve(modulesOfParts.size());
+        for (std::optional<syrec_parser::CustomModuleVisitor::ModulesWithNotPerformedOverloadResolution>& modulesOfPart: modulesOfParts) {
+            if (!modulesOfPart.has_value()) {
+                return false;
+            }
+            parsedParts.emplace_back(std::move(*modulesOfPart));
+        }
+
+        const auto                                    parserMessageGenerator = std::make_shared<syrec_parser::ParserMessagesContainer>(settings.optionalMaxNumReportedParserErrors);
+        const auto                                    customVisitor          = std::make_unique<syrec_parser::CustomModuleVisitor>(parserMessageGenerator, settings);
+        const std::optional<std::shared_ptr<Program>> joinedSyrecProgram     = customVisitor->joinModulesOfParts(parsedParts);
+        const auto                                    semanticCheckEndTime   = std::chrono::steady_clock::now();
+        if (!joinedSyrecProgram.has_value() || *joinedSyrecProgram == nullptr || !parserMessageGenerator->getMessagesOfType(syrec_parser::Message::Type::Error).empty() || parserMessageGenerator->getNumNotRecordedErrors() != 0) {
+            return false;
+        }
+
+        if (optionalRecordedStatistics != nullptr) {
+            optionalRecordedStatistics->parsingRuntimeInNanoseconds       = Statistics::toNanoseconds(parsingEndTime - parsingStartTime);
+            optionalRecordedStatistics->semanticCheckRuntimeInNanoseconds = Statistics::toNanoseconds(semanticCheckEndTime - parsingEndTime);
+            if (settings.recordMemoryUsage) {
+                optionalRecordedStatistics->memoryUsage.numBytesOfSymbolTables = customVisitor->determineNumBytesOfSymbolTable();
+                optionalRecordedStatistics->memoryUsage.numBytesOfProgram      = determineNumBytesOfIr((*joinedSyrecProgram)->modules());
+            }
+        }
+        program.modulesVec = joinedSyrecProgram->get()->modulesVec;
+        return true;
+    }
+
+    std::string Program::read(const std::string& filename, const ConfigurableOptions& settings, Statistics* optionalRecordedStatistics) {
+        return ProgramReader().read(*this, filename, settings, optionalRecordedStatistics);
+    }
+
+    std::string Program::readFromString(const std::string_view& stringifiedProgram, const ConfigurableOptions& settings, Statistics* optionalRecordedStatistics) {
+        return ProgramReader().readFromString(*this, stringifiedProgram, settings, optionalRecordedStatistics);
+    }
+
+    bool Program::readFile(const std::string& filename, const ConfigurableOptions& settings, std::string& error) {
+        error = read(filename, settings);
+        return error.empty();
     }
 } // namespace syrec
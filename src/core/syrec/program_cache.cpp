@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/syrec/program_cache.hpp"
+
+#include "core/configurable_options.hpp"
+#include "core/statistics.hpp"
+#include "core/syrec/ir_node_arena.hpp"
+#include "core/syrec/parser/utils/memory_mapped_file.hpp"
+#include "core/syrec/parser/utils/syrec_operation_utils.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/program_serialization.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <iomanip>
+#include <memory>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+using namespace syrec;
+
+namespace {
+    constexpr std::uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+    constexpr std::uint64_t FNV_PRIME        = 1099511628211ULL;
+
+    // The version needs to be incremented whenever the format of the on-disk cache entries changes (changes of the format of the serialized program are detected by the latter).
+    constexpr std::string_view ON_DISK_CACHE_ENTRY_MAGIC     = "SYRECPC";
+    constexpr std::uint8_t     ON_DISK_CACHE_ENTRY_VERSION   = 3U;
+    constexpr std::string_view ON_DISK_CACHE_ENTRY_EXTENSION = ".syrecprog";
+
+    // 64-bit FNV-1a hash which, contrary to std::hash, is identical in all processes and thus usable to identify the entries of the on-disk cache.
+    class StableHasher {
+    public:
+        void addBytes(const std::string_view bytes) noexcept {
+            for (const char byte: bytes) {
+                hash = (hash ^ static_cast<unsigned char>(byte)) * FNV_PRIME;
+            }
+        }
+
+        void addInteger(const std::uint64_t value) noexcept {
+            for (std::size_t i = 0; i < sizeof(value); ++i) {
+                hash = (hash ^ (value >> (8U * i) & 0xFFU)) * FNV_PRIME;
+            }
+        }
+
+        [[nodiscard]] std::uint64_t getHash() const noexcept {
+            return hash;
+        }
+
+    private:
+        std::uint64_t hash = FNV_OFFSET_BASIS;
+    };
+
+    void appendInteger(std::string& buffer, const std::uint64_t value) {
+        for (std::size_t i = 0; i < sizeof(value); ++i) {
+            buffer.push_back(static_cast<char>(value >> (8U * i) & 0xFFU));
+        }
+    }
+
+    void appendString(std::string& buffer, const std::string_view value) {
+        appendInteger(buffer, value.size());
+        buffer.append(value);
+    }
+
+    // Any read beyond the end of the buffer marks the buffer as invalid with all further reads returning default values.
+    class BufferReader {
+    public:
+        explicit BufferReader(const std::string_view buffer):
+            buffer(buffer) {}
+
+        [[nodiscard]] bool readMagic(const std::string_view magic) {
+            isValid = isValid && buffer.substr(position, magic.size()) == magic;
+            position += isValid ? magic.size() : 0U;
+            return isValid;
+        }
+
+        [[nodiscard]] std::uint64_t readInteger() {
+            isValid = isValid && sizeof(std::uint64_t) <= buffer.size() - position;
+            if (!isValid) {
+                return 0U;
+            }
+            std::uint64_t value = 0;
+            for (std::size_t i = 0; i < sizeof(value); ++i) {
+                value |= static_cast<std::uint64_t>(static_cast<unsigned char>(buffer[position++])) << (8U * i);
+            }
+            return value;
+        }
+
+        [[nodiscard]] std::string readString() {
+            const std::uint64_t size = readInteger();
+            isValid                  = isValid && size <= buffer.size() - position;
+            if (!isValid) {
+                return {};
+            }
+            std::string value(buffer.substr(position, static_cast<std::size_t>(size)));
+            position += static_cast<std::size_t>(size);
+            return value;
+        }
+
+        [[nodiscard]] bool isFullyReadAndValid() const noexcept {
+            return isValid && position == buffer.size();
+        }
+
+    private:
+        std::string_view buffer;
+        std::size_t      position = 0;
+        bool             isValid  = true;
+    };
+
+    [[nodiscard]] std::filesystem::path getPathOfOnDiskCacheEntry(const std::string& onDiskCacheDirectory, const std::uint64_t hash) {
+        std::ostringstream filename;
+        filename << std::hex << std::setw(16) << std::setfill('0') << hash << ON_DISK_CACHE_ENTRY_EXTENSION;
+        return std::filesystem::path(onDiskCacheDirectory) / filename.str();
+    }
+} // namespace
+
+ProgramCache::ProgramCache(const std::size_t maxNumCachedPrograms, std::optional<std::string> optionalOnDiskCacheDirectory):
+    maxNumCachedPrograms(maxNumCachedPrograms), optionalOnDiskCacheDirectory(std::move(optionalOnDiskCacheDirectory)) {
+    if (this->optionalOnDiskCacheDirectory.has_value()) {
+        std::error_code errorCode;
+        std::filesystem::create_directories(*this->optionalOnDiskCacheDirectory, errorCode);
+    }
+}
+
+std::string ProgramCache::read(Program& program, const std::string& filename, const ConfigurableOptions& settings, Statistics* optionalRecordedStatistics) {
+    std::string foundErrorWhileReadingFileContent;
+    if (const std::optional<syrec_parser::MemoryMappedFile> memoryMappedFile = syrec_parser::MemoryMappedFile::open(filename, &foundErrorWhileReadingFileContent); memoryMappedFile.has_value() && foundErrorWhileReadingFileContent.empty()) {
+        foundErrorWhileReadingFileContent = readFromString(program, memoryMappedFile->getContent(), settings, optionalRecordedStatistics);
+    }
+    return foundErrorWhileReadingFileContent;
+}
+
+std::string ProgramCache::readFromString(Program& program, const std::string_view& stringifiedProgram, const ConfigurableOptions& settings, Statistics* optionalRecordedStatistics) {
+    CacheKey key = buildCacheKey(stringifiedProgram, settings);
+    if (const CacheEntry* cacheEntry = findCacheEntry(key); cacheEntry != nullptr) {
+        // The program is only modified if the deserialization of the cached program was successful.
+        Program deserializedProgram;
+        if (!cacheEntry->foundErrors.empty() || deserializeProgram(deserializedProgram, cacheEntry->serializedProgram, settings.allocateIrNodesInArena ? std::make_shared<IrNodeArena>() : nullptr)) {
+            ++numCacheHits;
+            if (optionalRecordedStatistics != nullptr) {
+                optionalRecordedStatistics->parsingRuntimeInNanoseconds       = 0;
+                optionalRecordedStatistics->semanticCheckRuntimeInNanoseconds = 0;
+            }
+            if (!cacheEntry->foundErrors.empty()) {
+                return cacheEntry->foundErrors;
+            }
+            program = std::move(deserializedProgram);
+            return {};
+        }
+        // A corrupted cache entry loaded from the on-disk cache is replaced by the result of the parser.
+    }
+
+    ++numCacheMisses;
+    Program     parsedProgram;
+    std::string foundErrors = reader.readFromString(parsedProgram, stringifiedProgram, settings, optionalRecordedStatistics);
+
+    // Programs referencing IR nodes not serializable by syrec::serializeProgram(...) are not cached
+    std::optional<std::string> serializedProgram = foundErrors.empty() ? serializeProgram(parsedProgram) : std::string();
+    if (foundErrors.empty()) {
+        program = std::move(parsedProgram);
+    }
+    if (serializedProgram.has_value()) {
+        CacheEntry cacheEntry{.key = std::move(key), .foundErrors = foundErrors, .serializedProgram = std::move(*serializedProgram)};
+        storeCacheEntryOnDisk(cacheEntry);
+        insertCacheEntry(std::move(cacheEntry));
+    }
+    return foundErrors;
+}
+
+void ProgramCache::clear() {
+    cacheEntryLookup.clear();
+    cacheEntries.clear();
+}
+
+ProgramCache::CacheKey ProgramCache::buildCacheKey(const std::string_view& stringifiedProgram, const ConfigurableOptions& settings) {
+    StableHasher hasher;
+    hasher.addBytes(stringifiedProgram);
+    hasher.addInteger(settings.defaultBitwidth);
+    hasher.addInteger(static_cast<std::uint64_t>(settings.integerConstantTruncationOperation));
+    hasher.addInteger(static_cast<std::uint64_t>(settings.allowAccessOnAssignedToVariablePartsInDimensionAccessOfVariableAccess));
+    hasher.addInteger(static_cast<std::uint64_t>(settings.optionalProgramEntryPointModuleIdentifier.has_value()));
+    hasher.addBytes(settings.optionalProgramEntryPointModuleIdentifier.value_or(""));
+    hasher.addInteger(static_cast<std::uint64_t>(settings.optionalMaxNumReportedParserErrors.has_value()));
+    hasher.addInteger(settings.optionalMaxNumReportedParserErrors.value_or(0));
+    hasher.addInteger(static_cast<std::uint64_t>(settings.pruneModulesNotReachableFromProgramEntryPoint));
+
+    return CacheKey{.hash                                                                  = hasher.getHash(),
+                    .stringifiedProgram                                                    = std::string(stringifiedProgram),
+                    .defaultBitwidth                                                       = settings.defaultBitwidth,
+                    .integerConstantTruncationOperation                                    = settings.integerConstantTruncationOperation,
+                    .allowAccessOnAssignedToVariablePartsInDimensionAccessOfVariableAccess = settings.allowAccessOnAssignedToVariablePartsInDimensionAccessOfVariableAccess,
+                    .optionalProgramEntryPointModuleIdentifier                             = settings.optionalProgramEntryPointModuleIdentifier,
+                    .optionalMaxNumReportedParserErrors                                    = settings.optionalMaxNumReportedParserErrors,
+                    .pruneModulesNotReachableFromProgramEntryPoint                         = settings.pruneModulesNotReachableFromProgramEntryPoint};
+}
+
+const ProgramCache::CacheEntry* ProgramCache::findCacheEntry(const CacheKey& key) {
+    if (const auto cacheEntryLookupResult = cacheEntryLookup.find(key.hash); cacheEntryLookupResult != cacheEntryLookup.end() && cacheEntryLookupResult->second->key == key) {
+        cacheEntries.splice(cacheEntries.begin(), cacheEntries, cacheEntryLookupResult->second);
+        return &cacheEntries.front();
+    }
+
+    if (std::optional<CacheEntry> cacheEntryLoadedFromDisk = tryLoadCacheEntryFromDisk(key); cacheEntryLoadedFromDisk.has_value()) {
+        insertCacheEntry(std::move(*cacheEntryLoadedFromDisk));
+        if (!cacheEntries.empty() && cacheEntries.front().key == key) {
+            return &cacheEntries.front();
+        }
+    }
+    return nullptr;
+}
+
+void ProgramCache::insertCacheEntry(CacheEntry cacheEntry) {
+    // Cache entries whose hash collides with the one of the inserted entry are replaced.
+    if (const auto cacheEntryLookupResult = cacheEntryLookup.find(cacheEntry.key.hash); cacheEntryLookupResult != cacheEntryLookup.end()) {
+        cacheEntries.erase(cacheEntryLookupResult->second);
+        cacheEntryLookup.erase(cacheEntryLookupResult);
+    }
+    if (maxNumCachedPrograms == 0) {
+        return;
+    }
+
+    while (cacheEntries.size() >= maxNumCachedPrograms) {
+        cacheEntryLookup.erase(cacheEntries.back().key.hash);
+        cacheEntries.pop_back();
+    }
+    const std::uint64_t hash = cacheEntry.key.hash;
+    cacheEntries.emplace_front(std::move(cacheEntry));
+    cacheEntryLookup.emplace(hash, cacheEntries.begin());
+}
+
+std::optional<ProgramCache::CacheEntry> ProgramCache::tryLoadCacheEntryFromDisk(const CacheKey& key) const {
+    if (!optionalOnDiskCacheDirectory.has_value()) {
+        return std::nullopt;
+    }
+
+    const std::optional<syrec_parser::MemoryMappedFile> onDiskCacheEntry = syrec_parser::MemoryMappedFile::open(getPathOfOnDiskCacheEntry(*optionalOnDiskCacheDirectory, key.hash).string());
+    if (!onDiskCacheEntry.has_value()) {
+        return std::nullopt;
+    }
+
+    BufferReader reader(onDiskCacheEntry->getContent());
+    if (!reader.readMagic(ON_DISK_CACHE_ENTRY_MAGIC) || reader.readInteger() != ON_DISK_CACHE_ENTRY_VERSION) {
+        return std::nullopt;
+    }
+
+    CacheEntry cacheEntry{.key = key, .foundErrors = {}, .serializedProgram = {}};
+    cacheEntry.key.stringifiedProgram                                                    = reader.readString();
+    cacheEntry.key.defaultBitwidth                                                       = static_cast<unsigned>(reader.readInteger());
+    cacheEntry.key.integerConstantTruncationOperation                                    = static_cast<utils::IntegerConstantTruncationOperation>(reader.readInteger());
+    cacheEntry.key.allowAccessOnAssignedToVariablePartsInDimensionAccessOfVariableAccess = reader.readInteger() != 0U;
+    const bool hasProgramEntryPointModuleIdentifier                                      = reader.readInteger() != 0U;
+    std::string programEntryPointModuleIdentifier                                        = reader.readString();
+    cacheEntry.key.optionalProgramEntryPointModuleIdentifier                             = hasProgramEntryPointModuleIdentifier ? std::make_optional(std::move(programEntryPointModuleIdentifier)) : std::nullopt;
+    const bool hasMaxNumReportedParserErrors                                             = reader.readInteger() != 0U;
+    const auto maxNumReportedParserErrors                                                = static_cast<std::size_t>(reader.readInteger());
+    cacheEntry.key.optionalMaxNumReportedParserErrors                                    = hasMaxNumReportedParserErrors ? std::make_optional(maxNumReportedParserErrors) : std::nullopt;
+    cacheEntry.key.pruneModulesNotReachableFromProgramEntryPoint                         = reader.readInteger() != 0U;
+    cacheEntry.foundErrors                                                               = reader.readString();
+    cacheEntry.serializedProgram                                                         = reader.readString();
+
+    // On-disk cache entries of other programs with the same hash are ignored.
+    if (!reader.isFullyReadAndValid() || cacheEntry.key != key) {
+        return std::nullopt;
+    }
+    return cacheEntry;
+}
+
+void ProgramCache::storeCacheEntryOnDisk(const CacheEntry& cacheEntry) const {
+    if (!optionalOnDiskCacheDirectory.has_value()) {
+        return;
+    }
+
+    std::string serializedCacheEntry(ON_DISK_CACHE_ENTRY_MAGIC);
+    appendInteger(serializedCacheEntry, ON_DISK_CACHE_ENTRY_VERSION);
+    appendString(serializedCacheEntry, cacheEntry.key.stringifiedProgram);
+    appendInteger(serializedCacheEntry, cacheEntry.key.defaultBitwidth);
+    appendInteger(serializedCacheEntry, static_cast<std::uint64_t>(cacheEntry.key.integerConstantTruncationOperation));
+    appendInteger(serializedCacheEntry, static_cast<std::uint64_t>(cacheEntry.key.allowAccessOnAssignedToVariablePartsInDimensionAccessOfVariableAccess));
+    appendInteger(serializedCacheEntry, static_cast<std::uint64_t>(cacheEntry.key.optionalProgramEntryPointModuleIdentifier.has_value()));
+    appendString(serializedCacheEntry, cacheEntry.key.optionalProgramEntryPointModuleIdentifier.value_or(""));
+    appendInteger(serializedCacheEntry, static_cast<std::uint64_t>(cacheEntry.key.optionalMaxNumReportedParserErrors.has_value()));
+    appendInteger(serializedCacheEntry, cacheEntry.key.optionalMaxNumReportedParserErrors.value_or(0));
+    appendInteger(serializedCacheEntry, static_cast<std::uint64_t>(cacheEntry.key.pruneModulesNotReachableFromProgramEntryPoint));
+    appendString(serializedCacheEntry, cacheEntry.foundErrors);
+    appendString(serializedCacheEntry, cacheEntry.serializedProgram);
+
+    // The cache entry is written to a uniquely named temporary file that is renamed once the entry was fully written, thus other processes will never read a partially written cache entry.
+    const std::filesystem::path pathOfCacheEntry = getPathOfOnDiskCacheEntry(*optionalOnDiskCacheDirectory, cacheEntry.key.hash);
+    std::filesystem::path       pathOfTemporaryFile(pathOfCacheEntry);
+    pathOfTemporaryFile += ".tmp" + std::to_string(std::random_device{}());
+
+    bool writeOk = false;
+    if (std::ofstream outputFileStream(pathOfTemporaryFile, std::ofstream::out | std::ofstream::binary | std::ofstream::trunc); outputFileStream.is_open()) {
+        outputFileStream.write(serializedCacheEntry.data(), static_cast<std::streamsize>(serializedCacheEntry.size()));
+        writeOk = static_cast<bool>(outputFileStream);
+    }
+
+    std::error_code errorCode;
+    if (writeOk) {
+        std::filesystem::rename(pathOfTemporaryFile, pathOfCacheEntry, errorCode);
+    }
+    if (!writeOk || errorCode) {
+        std::filesystem::remove(pathOfTemporaryFile, errorCode);
+    }
+}
@@ -0,0 +1,685 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/syrec/program_serialization.hpp"
+
+#include "core/configurable_options.hpp"
+#include "core/syrec/expression.hpp"
+#include "core/syrec/ir_node_arena.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/number.hpp"
+#include "core/syrec/parser/utils/memory_mapped_file.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    // The version needs to be incremented whenever the serialized representation of any IR node changes.
+    constexpr std::string_view SERIALIZED_PROGRAM_MAGIC   = "SYRECIR";
+    constexpr std::uint8_t     SERIALIZED_PROGRAM_VERSION = 2U;
+
+    enum class NumberTag : std::uint8_t {
+        Null,
+        Constant,
+        LoopVariable,
+        ConstantExpression
+    };
+
+    enum class ExpressionTag : std::uint8_t {
+        Null,
+        Numeric,
+        Variable,
+        Binary,
+        Shift,
+        Unary
+    };
+
+    enum class StatementTag : std::uint8_t {
+        Null,
+        Skip,
+        Swap,
+        Unary,
+        Assign,
+        If,
+        For,
+        Call,
+        Uncall
+    };
+
+    /*
+     * The serialized program consists of a header, the table of the interned identifiers (i.e. of modules, variables and loop variables) and the modules of the program referencing the
+     * identifiers by their index in the table. Integers are serialized as variable-length unsigned LEB128 values, thus independent of the byte order of the platform.
+     */
+    class ProgramSerializer {
+    public:
+        explicit ProgramSerializer(const bool omitLineNumbers):
+            omitLineNumbers(omitLineNumbers) {}
+
+        [[nodiscard]] bool writeProgram(const Program& program) {
+            const Module::vec& modules = program.modules();
+            writeUnsigned(modules.size());
+            for (std::size_t moduleIndex = 0; moduleIndex < modules.size(); ++moduleIndex) {
+                if (modules[moduleIndex] == nullptr) {
+                    return false;
+                }
+                moduleIndexLookup.emplace(modules[moduleIndex].get(), moduleIndex);
+
+                const Module& module = *modules[moduleIndex];
+                writeIdentifier(module.name);
+                writeVariables(module.parameters);
+                writeVariables(module.variables);
+            }
+
+            bool serializationOk = true;
+            for (std::size_t moduleIndex = 0; moduleIndex < modules.size() && serializationOk; ++moduleIndex) {
+                // Variables are referenced by their index in the concatenation of the parameters and local variables of the module.
+                variableIndexLookup.clear();
+                for (const Variable::vec* declaredVariables: {&modules[moduleIndex]->parameters, &modules[moduleIndex]->variables}) {
+                    for (const Variable::ptr& declaredVariable: *declaredVariables) {
+                        variableIndexLookup.emplace(declaredVariable.get(), variableIndexLookup.size());
+                    }
+                }
+                serializationOk = writeStatements(modules[moduleIndex]->statements);
+            }
+            return serializationOk;
+        }
+
+        [[nodiscard]] std::string buildSerializedProgram() const {
+            std::string serializedProgram(SERIALIZED_PROGRAM_MAGIC);
+            serializedProgram.push_back(static_cast<char>(SERIALIZED_PROGRAM_VERSION));
+            appendUnsigned(serializedProgram, internedIdentifiers.size());
+            for (const std::string_view identifier: internedIdentifiers) {
+                appendUnsigned(serializedProgram, identifier.size());
+                serializedProgram.append(identifier);
+            }
+            serializedProgram.append(buffer);
+            return serializedProgram;
+        }
+
+    private:
+        bool                                                  omitLineNumbers;
+        std::string                                           buffer;
+        std::unordered_map<const Module*, std::size_t>        moduleIndexLookup;
+        std::unordered_map<const Variable*, std::size_t>      variableIndexLookup;
+        std::vector<std::string_view>                         internedIdentifiers;
+        std::unordered_map<std::string_view, std::size_t>     internedIdentifierIndexLookup;
+
+        static void appendUnsigned(std::string& target, std::uint64_t value) {
+            while (value >= 0x80U) {
+                target.push_back(static_cast<char>((value & 0x7FU) | 0x80U));
+                value >>= 7U;
+            }
+            target.push_back(static_cast<char>(value));
+        }
+
+        void writeUnsigned(const std::uint64_t value) {
+            appendUnsigned(buffer, value);
+        }
+
+        template<typename TEnum>
+        void writeEnum(const TEnum value) {
+            buffer.push_back(static_cast<char>(value));
+        }
+
+        void writeBool(const bool value) {
+            buffer.push_back(static_cast<char>(value ? 1U : 0U));
+        }
+
+        // The interned identifiers reference the strings of the serialized IR nodes which outlive the serializer.
+        void writeIdentifier(const std::string_view identifier) {
+            const auto [internedIdentifier, wasInserted] = internedIdentifierIndexLookup.try_emplace(identifier, internedIdentifiers.size());
+            if (wasInserted) {
+                internedIdentifiers.emplace_back(identifier);
+            }
+            writeUnsigned(internedIdentifier->second);
+        }
+
+        void writeVariables(const Variable::vec& variables) {
+            writeUnsigned(variables.size());
+            for (const Variable::ptr& variable: variables) {
+                writeEnum(variable->type);
+                writeIdentifier(variable->name);
+                writeUnsigned(variable->dimensions.size());
+                for (const unsigned numValuesOfDimension: variable->dimensions) {
+                    writeUnsigned(numValuesOfDimension);
+                }
+                writeUnsigned(variable->bitwidth);
+                writeBool(variable->declarationIndexInModule.has_value());
+                writeUnsigned(variable->declarationIndexInModule.value_or(0U));
+            }
+        }
+
+        void writeNumber(const Number::ptr& number) {
+            if (number == nullptr) {
+                writeEnum(NumberTag::Null);
+            } else if (number->isConstant()) {
+                writeEnum(NumberTag::Constant);
+                writeUnsigned(number->evaluate({}));
+            } else if (number->isLoopVariable()) {
+                writeEnum(NumberTag::LoopVariable);
+                writeIdentifier(number->variableName());
+            } else {
+                const Number::ConstantExpression constantExpression = *number->constantExpression();
+                writeEnum(NumberTag::ConstantExpression);
+                writeEnum(constantExpression.operation);
+                writeNumber(constantExpression.lhsOperand);
+                writeNumber(constantExpression.rhsOperand);
+            }
+        }
+
+        [[nodiscard]] bool writeVariableAccess(const VariableAccess::ptr& variableAccess) {
+            writeBool(variableAccess != nullptr);
+            if (variableAccess == nullptr) {
+                return true;
+            }
+
+            // The index of the accessed variable is offset by one with zero representing an access without a variable.
+            if (variableAccess->var == nullptr) {
+                writeUnsigned(0U);
+            } else if (const auto variableIndex = variableIndexLookup.find(variableAccess->var.get()); variableIndex != variableIndexLookup.end()) {
+                writeUnsigned(variableIndex->second + 1U);
+            } else {
+                return false;
+            }
+
+            writeBool(variableAccess->range.has_value());
+            if (variableAccess->range.has_value()) {
+                writeNumber(variableAccess->range->first);
+                writeNumber(variableAccess->range->second);
+            }
+            writeUnsigned(variableAccess->indexes.size());
+            bool serializationOk = true;
+            for (std::size_t i = 0; i < variableAccess->indexes.size() && serializationOk; ++i) {
+                serializationOk = writeExpression(variableAccess->indexes[i]);
+            }
+            return serializationOk;
+        }
+
+        [[nodiscard]] bool writeExpression(const Expression::ptr& expression) {
+            if (expression == nullptr) {
+                writeEnum(ExpressionTag::Null);
+                return true;
+            }
+            if (const auto* numericExpression = expressionCast<NumericExpression>(expression.get()); numericExpression != nullptr) {
+                writeEnum(ExpressionTag::Numeric);
+                writeNumber(numericExpression->value);
+                writeUnsigned(numericExpression->bwidth);
+                return true;
+            }
+            if (const auto* variableExpression = expressionCast<VariableExpression>(expression.get()); variableExpression != nullptr) {
+                writeEnum(ExpressionTag::Variable);
+                return writeVariableAccess(variableExpression->var);
+            }
+            if (const auto* binaryExpression = expressionCast<BinaryExpression>(expression.get()); binaryExpression != nullptr) {
+                writeEnum(ExpressionTag::Binary);
+                writeEnum(binaryExpression->binaryOperation);
+                return writeExpression(binaryExpression->lhs) && writeExpression(binaryExpression->rhs);
+            }
+            if (const auto* shiftExpression = expressionCast<ShiftExpression>(expression.get()); shiftExpression != nullptr) {
+                writeEnum(ExpressionTag::Shift);
+                writeEnum(shiftExpression->shiftOperation);
+                writeNumber(shiftExpression->rhs);
+                return writeExpression(shiftExpression->lhs);
+            }
+            if (const auto* unaryExpression = expressionCast<UnaryExpression>(expression.get()); unaryExpression != nullptr) {
+                writeEnum(ExpressionTag::Unary);
+                writeEnum(unaryExpression->unaryOperation);
+                return writeExpression(unaryExpression->expr);
+            }
+            return false;
+        }
+
+        [[nodiscard]] bool writeStatements(const Statement::vec& statements) {
+            writeUnsigned(statements.size());
+            bool serializationOk = true;
+            for (std::size_t i = 0; i < statements.size() && serializationOk; ++i) {
+                serializationOk = writeStatement(statements[i]);
+            }
+            return serializationOk;
+        }
+
+        [[nodiscard]] bool writeCalledModule(const std::shared_ptr<Module>& calledModule, const std::vector<std::string>& callerArguments) {
+            const auto calledModuleIndex = moduleIndexLookup.find(calledModule.get());
+            if (calledModuleIndex == moduleIndexLookup.end()) {
+                return false;
+            }
+            writeUnsigned(calledModuleIndex->second);
+            writeUnsigned(callerArguments.size());
+            for (const std::string& callerArgument: callerArguments) {
+                writeIdentifier(callerArgument);
+            }
+            return true;
+        }
+
+        [[nodiscard]] bool writeStatement(const Statement::ptr& statement) {
+            if (statement == nullptr) {
+                writeEnum(StatementTag::Null);
+                return true;
+            }
+
+            const auto writeTagAndLineNumber = [&](const StatementTag tag) {
+                writeEnum(tag);
+                writeUnsigned(omitLineNumbers ? 0U : statement->lineNumber);
+            };
+            if (statementCast<SkipStatement>(statement.get()) != nullptr) {
+                writeTagAndLineNumber(StatementTag::Skip);
+                return true;
+            }
+            if (const auto* swapStatement = statementCast<SwapStatement>(statement.get()); swapStatement != nullptr) {
+                writeTagAndLineNumber(StatementTag::Swap);
+                return writeVariableAccess(swapStatement->lhs) && writeVariableAccess(swapStatement->rhs);
+            }
+            if (const auto* unaryStatement = statementCast<UnaryStatement>(statement.get()); unaryStatement != nullptr) {
+                writeTagAndLineNumber(StatementTag::Unary);
+                writeEnum(unaryStatement->unaryOperation);
+                return writeVariableAccess(unaryStatement->var);
+            }
+            if (const auto* assignStatement = statementCast<AssignStatement>(statement.get()); assignStatement != nullptr) {
+                writeTagAndLineNumber(StatementTag::Assign);
+                writeEnum(assignStatement->assignOperation);
+                return writeVariableAccess(assignStatement->lhs) && writeExpression(assignStatement->rhs);
+            }
+            if (const auto* ifStatement = statementCast<IfStatement>(statement.get()); ifStatement != nullptr) {
+                writeTagAndLineNumber(StatementTag::If);
+                return writeExpression(ifStatement->condition) && writeStatements(ifStatement->thenStatements) && writeStatements(ifStatement->elseStatements) && writeExpression(ifStatement->fiCondition);
+            }
+            if (const auto* forStatement = statementCast<ForStatement>(statement.get()); forStatement != nullptr) {
+                writeTagAndLineNumber(StatementTag::For);
+                writeIdentifier(forStatement->loopVariable);
+                writeNumber(forStatement->range.first);
+                writeNumber(forStatement->range.second);
+                writeNumber(forStatement->step);
+                return writeStatements(forStatement->statements);
+            }
+            if (const auto* callStatement = statementCast<CallStatement>(statement.get()); callStatement != nullptr) {
+                writeTagAndLineNumber(StatementTag::Call);
+                return writeCalledModule(callStatement->target, callStatement->parameters);
+            }
+            if (const auto* uncallStatement = statementCast<UncallStatement>(statement.get()); uncallStatement != nullptr) {
+                writeTagAndLineNumber(StatementTag::Uncall);
+                return writeCalledModule(uncallStatement->target, uncallStatement->parameters);
+            }
+            return false;
+        }
+    };
+
+    /*
+     * Any read beyond the end of the serialized program or of an invalid value marks the serialized program as invalid with all further reads returning default values.
+     */
+    class ProgramDeserializer {
+    public:
+        ProgramDeserializer(const std::string_view serializedProgram, IrNodeArena::ptr irNodeArena):
+            serializedProgram(serializedProgram), irNodeArena(std::move(irNodeArena)) {}
+
+        [[nodiscard]] std::optional<Module::vec> readProgram() {
+            if (serializedProgram.substr(0, SERIALIZED_PROGRAM_MAGIC.size()) != SERIALIZED_PROGRAM_MAGIC) {
+                return std::nullopt;
+            }
+            position = SERIALIZED_PROGRAM_MAGIC.size();
+            if (readByte() != SERIALIZED_PROGRAM_VERSION) {
+                return std::nullopt;
+            }
+
+            // The interned identifiers reference the serialized program and are only copied when they are assigned to an IR node.
+            const std::size_t numInternedIdentifiers = readCollectionSize();
+            internedIdentifiers.reserve(numInternedIdentifiers);
+            for (std::size_t i = 0; i < numInternedIdentifiers && isValid; ++i) {
+                const std::size_t identifierLength = readSize();
+                if (canReadBytes(identifierLength)) {
+                    internedIdentifiers.emplace_back(serializedProgram.substr(position, identifierLength));
+                    position += identifierLength;
+                }
+            }
+
+            const std::size_t numModules = readCollectionSize();
+            for (std::size_t i = 0; i < numModules && isValid; ++i) {
+                auto module = IrNodeArena::makeNode<Module>(irNodeArena, readIdentifier());
+                readVariables(module->parameters);
+                readVariables(module->variables);
+                modules.emplace_back(std::move(module));
+            }
+            for (std::size_t i = 0; i < modules.size() && isValid; ++i) {
+                currentModule = modules[i].get();
+                readStatements(modules[i]->statements);
+            }
+
+            if (!isValid || position != serializedProgram.size()) {
+                return std::nullopt;
+            }
+            return std::move(modules);
+        }
+
+    private:
+        std::string_view serializedProgram;
+        IrNodeArena::ptr irNodeArena;
+        std::size_t      position = 0;
+        bool             isValid  = true;
+        Module::vec      modules;
+        const Module*    currentModule = nullptr;
+
+        std::vector<std::string_view> internedIdentifiers;
+
+        [[nodiscard]] bool canReadBytes(const std::size_t numBytes) {
+            isValid = isValid && numBytes <= serializedProgram.size() - position;
+            return isValid;
+        }
+
+        [[nodiscard]] std::uint8_t readByte() {
+            if (!canReadBytes(1U)) {
+                return 0U;
+            }
+            return static_cast<std::uint8_t>(serializedProgram[position++]);
+        }
+
+        [[nodiscard]] std::uint64_t readUnsigned() {
+            std::uint64_t value = 0;
+            for (unsigned shift = 0; shift < 64U && isValid; shift += 7U) {
+                const std::uint8_t byte = readByte();
+                value |= static_cast<std::uint64_t>(byte & 0x7FU) << shift;
+                if ((byte & 0x80U) == 0U) {
+                    return value;
+                }
+            }
+            isValid = false;
+            return 0U;
+        }
+
+        [[nodiscard]] unsigned readUnsigned32() {
+            const std::uint64_t value = readUnsigned();
+            isValid                   = isValid && value <= std::numeric_limits<unsigned>::max();
+            return isValid ? static_cast<unsigned>(value) : 0U;
+        }
+
+        [[nodiscard]] bool readBool() {
+            const std::uint8_t value = readByte();
+            isValid                  = isValid && value <= 1U;
+            return value == 1U;
+        }
+
+        template<typename TEnum>
+        [[nodiscard]] TEnum readEnum(const TEnum maxValue) {
+            const std::uint8_t value = readByte();
+            isValid                  = isValid && value <= static_cast<std::uint8_t>(maxValue);
+            return isValid ? static_cast<TEnum>(value) : TEnum{};
+        }
+
+        [[nodiscard]] std::size_t readSize() {
+            const std::uint64_t value = readUnsigned();
+            isValid                   = isValid && value <= std::numeric_limits<std::size_t>::max();
+            return isValid ? static_cast<std::size_t>(value) : 0U;
+        }
+
+        [[nodiscard]] std::size_t readCollectionSize() {
+            // Every element of a collection requires at least one byte, thus the number of remaining bytes can be used to detect corrupted sizes prior to any allocation.
+            const std::size_t size = readSize();
+            return canReadBytes(size) ? size : 0U;
+        }
+
+        [[nodiscard]] std::string readIdentifier() {
+            const std::size_t identifierIndex = readSize();
+            isValid                           = isValid && identifierIndex < internedIdentifiers.size();
+            return isValid ? std::string(internedIdentifiers[identifierIndex]) : std::string();
+        }
+
+        void readVariables(Variable::vec& variables) {
+            const std::size_t numVariables = readCollectionSize();
+            variables.reserve(numVariables);
+            for (std::size_t i = 0; i < numVariables && isValid; ++i) {
+                const auto            type          = readEnum(Variable::Type::Wire);
+                std::string           name          = readIdentifier();
+                const std::size_t     numDimensions = readCollectionSize();
+                std::vector<unsigned> dimensions(numDimensions, 0U);
+                for (unsigned& numValuesOfDimension: dimensions) {
+                    numValuesOfDimension = readUnsigned32();
+                }
+                const auto bitwidth                    = readUnsigned32();
+                const bool hasDeclarationIndexInModule = readBool();
+                const auto declarationIndexInModule    = readSize();
+
+                auto variable = IrNodeArena::makeNode<Variable>(irNodeArena, type, std::move(name), std::move(dimensions), bitwidth);
+                if (hasDeclarationIndexInModule) {
+                    variable->declarationIndexInModule = declarationIndexInModule;
+                }
+                variables.emplace_back(std::move(variable));
+            }
+        }
+
+        [[nodiscard]] Number::ptr readNumber() {
+            switch (readEnum(NumberTag::ConstantExpression)) {
+                case NumberTag::Constant:
+                    return IrNodeArena::makeNode<Number>(irNodeArena, readUnsigned32());
+                case NumberTag::LoopVariable:
+                    return IrNodeArena::makeNode<Number>(irNodeArena, readIdentifier());
+                case NumberTag::ConstantExpression: {
+                    const auto  operation  = readEnum(Number::ConstantExpression::Operation::Division);
+                    Number::ptr lhsOperand = readNumber();
+                    Number::ptr rhsOperand = readNumber();
+                    return IrNodeArena::makeNode<Number>(irNodeArena, Number::ConstantExpression(std::move(lhsOperand), operation, std::move(rhsOperand)));
+                }
+                default:
+                    return nullptr;
+            }
+        }
+
+        [[nodiscard]] VariableAccess::ptr readVariableAccess() {
+            if (!readBool() || !isValid) {
+                return nullptr;
+            }
+
+            auto variableAccess = IrNodeArena::makeNode<VariableAccess>(irNodeArena);
+            if (const std::size_t variableIndexOffsetByOne = readSize(); variableIndexOffsetByOne != 0U) {
+                const std::size_t variableIndex = variableIndexOffsetByOne - 1U;
+                const std::size_t numParameters = currentModule->parameters.size();
+                if (variableIndex < numParameters) {
+                    variableAccess->setVar(currentModule->parameters[variableIndex]);
+                } else if (variableIndex - numParameters < currentModule->variables.size()) {
+                    variableAccess->setVar(currentModule->variables[variableIndex - numParameters]);
+                } else {
+                    isValid = false;
+                }
+            }
+
+            if (readBool()) {
+                Number::ptr rangeStart = readNumber();
+                Number::ptr rangeEnd   = readNumber();
+                variableAccess->range  = std::make_pair(std::move(rangeStart), std::move(rangeEnd));
+            }
+            const std::size_t numIndexes = readCollectionSize();
+            variableAccess->indexes.reserve(numIndexes);
+            for (std::size_t i = 0; i < numIndexes && isValid; ++i) {
+                variableAccess->indexes.emplace_back(readExpression());
+            }
+            return variableAccess;
+        }
+
+        [[nodiscard]] Expression::ptr readExpression() {
+            switch (readEnum(ExpressionTag::Unary)) {
+                case ExpressionTag::Numeric: {
+                    Number::ptr value    = readNumber();
+                    const auto  bitwidth = readUnsigned32();
+                    return IrNodeArena::makeNode<NumericExpression>(irNodeArena, std::move(value), bitwidth);
+                }
+                case ExpressionTag::Variable:
+                    return IrNodeArena::makeNode<VariableExpression>(irNodeArena, readVariableAccess());
+                case ExpressionTag::Binary: {
+                    const auto      operation = readEnum(BinaryExpression::BinaryOperation::GreaterEquals);
+                    Expression::ptr lhs       = readExpression();
+                    Expression::ptr rhs       = readExpression();
+                    return IrNodeArena::makeNode<BinaryExpression>(irNodeArena, std::move(lhs), operation, std::move(rhs));
+                }
+                case ExpressionTag::Shift: {
+                    const auto  operation = readEnum(ShiftExpression::ShiftOperation::Right);
+                    Number::ptr rhs       = readNumber();
+                    return IrNodeArena::makeNode<ShiftExpression>(irNodeArena, readExpression(), operation, std::move(rhs));
+                }
+                case ExpressionTag::Unary: {
+                    const auto operation = readEnum(UnaryExpression::UnaryOperation::BitwiseNegation);
+                    return IrNodeArena::makeNode<UnaryExpression>(irNodeArena, operation, readExpression());
+                }
+                default:
+                    return nullptr;
+            }
+        }
+
+        void readStatements(Statement::vec& statements) {
+            const std::size_t numStatements = readCollectionSize();
+            statements.reserve(numStatements);
+            for (std::size_t i = 0; i < numStatements && isValid; ++i) {
+                statements.emplace_back(readStatement());
+            }
+        }
+
+        [[nodiscard]] std::shared_ptr<Module> readCalledModule(std::vector<std::string>& callerArguments) {
+            const std::size_t calledModuleIndex = readSize();
+            isValid                             = isValid && calledModuleIndex < modules.size();
+
+            const std::size_t numCallerArguments = readCollectionSize();
+            callerArguments.reserve(numCallerArguments);
+            for (std::size_t i = 0; i < numCallerArguments && isValid; ++i) {
+                callerArguments.emplace_back(readIdentifier());
+            }
+            return isValid ? modules[calledModuleIndex] : nullptr;
+        }
+
+        [[nodiscard]] Statement::ptr readStatement() {
+            const auto tag = readEnum(StatementTag::Uncall);
+            if (tag == StatementTag::Null) {
+                return nullptr;
+            }
+
+            const auto     lineNumber = readUnsigned32();
+            Statement::ptr statement;
+            switch (tag) {
+                case StatementTag::Skip:
+                    statement = IrNodeArena::makeNode<SkipStatement>(irNodeArena);
+                    break;
+                case StatementTag::Swap: {
+                    VariableAccess::ptr lhs = readVariableAccess();
+                    VariableAccess::ptr rhs = readVariableAccess();
+                    statement               = IrNodeArena::makeNode<SwapStatement>(irNodeArena, std::move(lhs), std::move(rhs));
+                    break;
+                }
+                case StatementTag::Unary: {
+                    const auto operation = readEnum(UnaryStatement::UnaryOperation::Decrement);
+                    statement            = IrNodeArena::makeNode<UnaryStatement>(irNodeArena, operation, readVariableAccess());
+                    break;
+                }
+                case StatementTag::Assign: {
+                    const auto          operation = readEnum(AssignStatement::AssignOperation::Exor);
+                    VariableAccess::ptr lhs       = readVariableAccess();
+                    Expression::ptr     rhs       = readExpression();
+                    statement                     = IrNodeArena::makeNode<AssignStatement>(irNodeArena, std::move(lhs), operation, std::move(rhs));
+                    break;
+                }
+                case StatementTag::If: {
+                    auto ifStatement = IrNodeArena::makeNode<IfStatement>(irNodeArena);
+                    ifStatement->setCondition(readExpression());
+                    readStatements(ifStatement->thenStatements);
+                    readStatements(ifStatement->elseStatements);
+                    ifStatement->setFiCondition(readExpression());
+                    statement = std::move(ifStatement);
+                    break;
+                }
+                case StatementTag::For: {
+                    auto forStatement          = IrNodeArena::makeNode<ForStatement>(irNodeArena);
+                    forStatement->loopVariable = readIdentifier();
+                    forStatement->range.first  = readNumber();
+                    forStatement->range.second = readNumber();
+                    forStatement->step         = readNumber();
+                    readStatements(forStatement->statements);
+                    statement = std::move(forStatement);
+                    break;
+                }
+                case StatementTag::Call: {
+                    std::vector<std::string> callerArguments;
+                    std::shared_ptr<Module>  calledModule = readCalledModule(callerArguments);
+                    statement                             = IrNodeArena::makeNode<CallStatement>(irNodeArena, std::move(calledModule), std::move(callerArguments));
+                    break;
+                }
+                case StatementTag::Uncall: {
+                    std::vector<std::string> callerArguments;
+                    std::shared_ptr<Module>  calledModule = readCalledModule(callerArguments);
+                    statement                             = IrNodeArena::makeNode<UncallStatement>(irNodeArena, std::move(calledModule), std::move(callerArguments));
+                    break;
+                }
+                default:
+                    return nullptr;
+            }
+            statement->lineNumber = lineNumber;
+            return statement;
+        }
+    };
+} // namespace
+
+std::optional<std::string> syrec::serializeProgram(const Program& program, const bool omitLineNumbers) {
+    ProgramSerializer serializer(omitLineNumbers);
+    if (!serializer.writeProgram(program)) {
+        return std::nullopt;
+    }
+    return serializer.buildSerializedProgram();
+}
+
+bool syrec::deserializeProgram(Program& program, const std::string_view serializedProgram, const IrNodeArena::ptr& irNodeArena) {
+    std::optional<Module::vec> deserializedModules = ProgramDeserializer(serializedProgram, irNodeArena).readProgram();
+    if (!deserializedModules.has_value()) {
+        return false;
+    }
+    for (const Module::ptr& module: *deserializedModules) {
+        program.addModule(module);
+    }
+    return true;
+}
+
+std::string Program::save(const std::string& filename) const {
+    const std::optional<std::string> serializedProgram = serializeProgram(*this);
+    if (!serializedProgram.has_value()) {
+        return "Program references a variable or module not declared in the program and cannot be saved";
+    }
+
+    std::ofstream outputFileStream(filename, std::ofstream::out | std::ofstream::binary | std::ofstream::trunc);
+    if (!outputFileStream.is_open()) {
+        return "Cannot open given file @ " + filename;
+    }
+    outputFileStream.write(serializedProgram->data(), static_cast<std::streamsize>(serializedProgram->size()));
+    outputFileStream.close();
+    if (!outputFileStream) {
+        return "Error while writing content to file @ " + filename;
+    }
+    return {};
+}
+
+std::string Program::load(const std::string& filename, const ConfigurableOptions& settings) {
+    std::string                                         foundErrorWhileReadingFileContent;
+    const std::optional<syrec_parser::MemoryMappedFile> memoryMappedFile = syrec_parser::MemoryMappedFile::open(filename, &foundErrorWhileReadingFileContent);
+    if (!memoryMappedFile.has_value() || !foundErrorWhileReadingFileContent.empty()) {
+        return foundErrorWhileReadingFileContent;
+    }
+
+    Program loadedProgram;
+    if (!deserializeProgram(loadedProgram, memoryMappedFile->getContent(), settings.allocateIrNodesInArena ? std::make_shared<IrNodeArena>() : nullptr)) {
+        return "File @ " + filename + " does not contain a valid saved program";
+    }
+    modulesVec = std::move(loadedProgram.modulesVec);
+    return {};
+}
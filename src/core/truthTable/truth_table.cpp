@@ -10,23 +10,153 @@
 
 #include "core/truthTable/truth_table.hpp"
 
+#include "core/executor.hpp"
+#include "core/io/mapped_file.hpp"
+
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
 #include <cassert>
 #include <cmath>
 #include <cstddef>
-#include <map>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
 #include <utility>
 #include <vector>
 
 namespace syrec {
+    namespace {
+        // the minimum number of entries compared per thread by TruthTable::equal
+        constexpr std::size_t MIN_NUM_ENTRIES_PER_THREAD = 4096U;
+
+        // the positions of the cubes of a truth table associated with primary lines (the i-th position of a cube of size n being associated with the line n - 1 - i) as well as their per word mask
+        struct ProjectionOntoPrimaryLines {
+            std::vector<std::size_t>            positions;
+            std::vector<TruthTable::Cube::Word> maskWords;
+
+            // lines without an entry in the given flags are considered to be primary lines
+            ProjectionOntoPrimaryLines(const std::size_t numPositions, const std::vector<bool>& isNonPrimaryLine):
+                maskWords((numPositions + TruthTable::Cube::BITS_PER_WORD - 1U) / TruthTable::Cube::BITS_PER_WORD, 0U) {
+                positions.reserve(numPositions);
+                for (std::size_t position = 0U; position < numPositions; ++position) {
+                    if (const auto line = numPositions - 1U - position; line >= isNonPrimaryLine.size() || !isNonPrimaryLine[line]) {
+                        positions.emplace_back(position);
+                        maskWords[position / TruthTable::Cube::BITS_PER_WORD] |= static_cast<TruthTable::Cube::Word>(1U) << (position % TruthTable::Cube::BITS_PER_WORD);
+                    }
+                }
+            }
+        };
+
+        // compares two cubes restricted to the positions of the given projections, the comparison is either performed word-wise if both projections share the same mask or position-wise otherwise
+        auto projectedCubesAreEqual(const TruthTable::Cube& c1, const ProjectionOntoPrimaryLines& projection1, const TruthTable::Cube& c2, const ProjectionOntoPrimaryLines& projection2, const bool haveSameLayout, const bool equalityUpToDontCare) -> bool {
+            if (haveSameLayout && c1.size() == c2.size()) {
+                for (std::size_t k = 0U; k < projection1.maskWords.size(); ++k) {
+                    const auto dontCares1 = c1.getDontCareWord(k);
+                    const auto dontCares2 = c2.getDontCareWord(k);
+                    if (equalityUpToDontCare) {
+                        if (((c1.getValueWord(k) ^ c2.getValueWord(k)) & ~(dontCares1 | dontCares2) & projection1.maskWords[k]) != 0U) {
+                            return false;
+                        }
+                    } else if ((((c1.getValueWord(k) ^ c2.getValueWord(k)) | (dontCares1 ^ dontCares2)) & projection1.maskWords[k]) != 0U) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            for (std::size_t i = 0U; i < projection1.positions.size(); ++i) {
+                const auto value1 = c1[projection1.positions[i]];
+                const auto value2 = c2[projection2.positions[i]];
+                if (equalityUpToDontCare ? (value1.has_value() && value2.has_value() && *value1 != *value2) : value1 != value2) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        using Word = TruthTable::Cube::Word;
+
+        // the header of the binary format of a truth table consists of the following words followed by the mask words of the constant and the garbage lines
+        constexpr Word BINARY_FORMAT_MAGIC   = 0x3154544345525953U; // "SYRECTT1" if stored in little endian byte order
+        constexpr Word BYTE_ORDER_MARK       = 0x0102030405060708U;
+        constexpr Word BINARY_FORMAT_VERSION = 1U;
+
+        enum HeaderWord : std::size_t {
+            Magic,
+            ByteOrderMark,
+            Version,
+            NumInputs,
+            NumOutputs,
+            NumEntries,
+            NumConstants,
+            NumGarbage,
+            NumHeaderWords
+        };
+
+        [[nodiscard]] auto numWordsOfPositions(const std::size_t numPositions) -> std::size_t {
+            return (numPositions + TruthTable::Cube::BITS_PER_WORD - 1U) / TruthTable::Cube::BITS_PER_WORD;
+        }
+
+        auto appendMaskWords(std::vector<Word>& words, const std::vector<bool>& flags) -> void {
+            const auto firstWord = words.size();
+            words.resize(firstWord + numWordsOfPositions(flags.size()), 0U);
+            for (std::size_t i = 0U; i < flags.size(); ++i) {
+                if (flags[i]) {
+                    words[firstWord + (i / TruthTable::Cube::BITS_PER_WORD)] |= static_cast<Word>(1U) << (i % TruthTable::Cube::BITS_PER_WORD);
+                }
+            }
+        }
+
+        [[nodiscard]] auto flagsOfMaskWords(const Word* maskWords, const std::size_t numFlags) -> std::vector<bool> {
+            std::vector<bool> flags(numFlags, false);
+            for (std::size_t i = 0U; i < numFlags; ++i) {
+                flags[i] = ((maskWords[i / TruthTable::Cube::BITS_PER_WORD] >> (i % TruthTable::Cube::BITS_PER_WORD)) & 1U) != 0U;
+            }
+            return flags;
+        }
+
+        auto appendPackedCube(std::vector<Word>& words, const TruthTable::Cube& cube) -> void {
+            for (std::size_t k = 0U; k < cube.numWords(); ++k) {
+                words.emplace_back(cube.getValueWord(k));
+            }
+            for (std::size_t k = 0U; k < cube.numWords(); ++k) {
+                words.emplace_back(cube.getDontCareWord(k));
+            }
+        }
+
+        auto writeWords(std::ostream& os, const std::vector<Word>& words) -> void {
+            os.write(reinterpret_cast<const char*>(words.data()), static_cast<std::streamsize>(words.size() * sizeof(Word))); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        }
+
+        // three-way comparison of a packed cube with the given one (of the same size) consistent with the ordering of the cubes
+        [[nodiscard]] auto comparePackedCube(const Word* valueWords, const Word* dontCareWords, const TruthTable::Cube& cube) -> int {
+            for (std::size_t k = 0U; k < cube.numWords(); ++k) {
+                if (const Word differingPositions = (valueWords[k] ^ cube.getValueWord(k)) | (dontCareWords[k] ^ cube.getDontCareWord(k)); differingPositions != 0U) {
+                    // map the lowest differing position to its rank in the ordering of std::optional<bool> (don't care: 0, false: 1, true: 2)
+                    const Word positionMask = differingPositions & (~differingPositions + 1U);
+                    const auto rankOf       = [positionMask](const Word valueWord, const Word dontCareWord) { return (dontCareWord & positionMask) != 0U ? 0 : ((valueWord & positionMask) != 0U ? 2 : 1); };
+                    return rankOf(valueWords[k], dontCareWords[k]) - rankOf(cube.getValueWord(k), cube.getDontCareWord(k));
+                }
+            }
+            return 0;
+        }
+    } // namespace
+
 
     auto TruthTable::Cube::completeCubes() const -> Vector {
         std::vector<std::size_t> dcPositions;
         dcPositions.reserve(size());
-        for (auto pos = 0U; pos < size(); pos++) {
-            if (!cube[pos].has_value()) // if DC
-            {
-                dcPositions.emplace_back(pos);
+        for (std::size_t k = 0U; k < numWords(); ++k) {
+            for (auto remainingDcs = getDontCareWord(k); remainingDcs != 0U; remainingDcs &= remainingDcs - 1U) {
+                dcPositions.emplace_back((k * BITS_PER_WORD) + static_cast<std::size_t>(std::countr_zero(remainingDcs)));
             }
         }
 
@@ -34,85 +164,370 @@ namespace syrec {
         const auto dcVecSize = dcPositions.size();
         const auto dcSize    = 1U << dcVecSize;
         result.reserve(dcSize);
-        Cube dcCube(cube);
+        Cube dcCube(*this);
 
         for (auto i = 0U; i < dcSize; ++i) {
             for (auto j = 0U; j < dcVecSize; ++j) {
                 const auto localBit = (i & (1U << (dcVecSize - j - 1))) != 0;
 
-                dcCube[dcPositions[j]] = localBit;
+                dcCube.set(dcPositions[j], localBit);
             }
             result.emplace_back(dcCube);
         }
         return result;
     }
 
+    auto TruthTable::Cube::completions() const -> CubeCompletions {
+        return CubeCompletions(*this);
+    }
+
+    TruthTable::CubeCompletions::CubeCompletions(const Cube& cube):
+        firstCompletion(cube) {
+        for (std::size_t k = 0U; k < cube.numWords(); ++k) {
+            for (auto remainingDcs = cube.getDontCareWord(k); remainingDcs != 0U; remainingDcs &= remainingDcs - 1U) {
+                const auto pos = (k * Cube::BITS_PER_WORD) + static_cast<std::size_t>(std::countr_zero(remainingDcs));
+                dontCarePositions.emplace_back(pos);
+                firstCompletion.set(pos, false);
+            }
+        }
+        // the number of completions has to be representable
+        assert(dontCarePositions.size() < Cube::BITS_PER_WORD);
+    }
+
+    auto TruthTable::operator==(const TruthTable& tt) const -> bool {
+        if (hasDenseStorage() == tt.hasDenseStorage()) {
+            return cubeMap == tt.cubeMap && denseNumInputs == tt.denseNumInputs && denseOutputs == tt.denseOutputs;
+        }
+        if (size() != tt.size()) {
+            return false;
+        }
+        for (auto it = begin(), ttIt = tt.begin(); it != end(); ++it, ++ttIt) {
+            const auto& [input, output]     = *it;
+            const auto& [ttInput, ttOutput] = *ttIt;
+            if (input != ttInput || output != ttOutput) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    auto TruthTable::useDenseStorageIfComplete() -> bool {
+        if (hasDenseStorage()) {
+            return true;
+        }
+        // the inputs of a complete truth table are all 2^n fully specified cubes of size n and the map iterates over them in the order of their integer values
+        const auto numInputs = nInputs();
+        if (cubeMap.empty() || numInputs >= 64U || cubeMap.size() != (static_cast<std::uint64_t>(1U) << numInputs)) {
+            return false;
+        }
+        if (!std::ranges::all_of(cubeMap, [numInputs](const auto& entry) { return entry.first.size() == numInputs && entry.first.hasNoDontCares(); })) {
+            return false;
+        }
+
+        denseOutputs.reserve(cubeMap.size());
+        for (auto& [input, output]: cubeMap) {
+            denseOutputs.emplace_back(std::move(output));
+        }
+        denseNumInputs = numInputs;
+        cubeMap.clear();
+        return true;
+    }
+
+    auto TruthTable::useSparseStorage() -> void {
+        if (!hasDenseStorage()) {
+            return;
+        }
+        for (std::uint64_t i = 0U; i < denseOutputs.size(); ++i) {
+            cubeMap.emplace_hint(cubeMap.end(), Cube::fromInteger(i, denseNumInputs), std::move(denseOutputs[i]));
+        }
+        denseOutputs.clear();
+        denseOutputs.shrink_to_fit();
+        denseNumInputs = 0U;
+    }
+
+    auto TruthTable::inputOfEntry(const ConstIterator& it, Cube& buffer) -> const Cube& {
+        if (it.denseOutputs == nullptr) {
+            return it.mapIt->first;
+        }
+        buffer = Cube::fromInteger(it.denseIndex, it.denseNumInputs);
+        return buffer;
+    }
+
+    auto TruthTable::outputOfEntry(const ConstIterator& it) -> const Cube& {
+        return it.denseOutputs == nullptr ? it.mapIt->second : (*it.denseOutputs)[it.denseIndex];
+    }
+
     auto TruthTable::filteredInput(const Cube& input) const -> Cube {
         // the size of the provided input should be the same as the constants stored in the tt.
         assert(input.size() == constants.size());
-        const auto inputSize = input.size();
+        const ProjectionOntoPrimaryLines projection(input.size(), constants);
 
         Cube filteredInput{};
-        filteredInput.reserve(nPrimaryInputs());
-        for (auto i = 0U; i < inputSize; i++) {
-            if (!isConstant(inputSize - 1 - i)) {
-                filteredInput.emplace_back(input[i]);
-            }
+        filteredInput.reserve(projection.positions.size());
+        for (const auto position: projection.positions) {
+            filteredInput.emplace_back(input[position]);
         }
-
         return filteredInput;
     }
 
     auto TruthTable::filteredOutput(const Cube& output) const -> Cube {
         // the size of the provided output should be the same as the garbage stored in the tt.
         assert(output.size() == garbage.size());
-        const auto outputSize = output.size();
+        const ProjectionOntoPrimaryLines projection(output.size(), garbage);
 
         Cube filteredOutput{};
-        filteredOutput.reserve(nPrimaryOutputs());
-        for (auto i = 0U; i < outputSize; i++) {
-            if (!isGarbage(outputSize - 1 - i)) {
-                filteredOutput.emplace_back(output[i]);
-            }
+        filteredOutput.reserve(projection.positions.size());
+        for (const auto position: projection.positions) {
+            filteredOutput.emplace_back(output[position]);
         }
         return filteredOutput;
     }
 
-    auto TruthTable::equal(TruthTable const& tt1, TruthTable const& tt2, bool equalityUpToDontCare) -> bool {
+    auto TruthTable::equal(TruthTable const& tt1, TruthTable const& tt2, bool equalityUpToDontCare, std::size_t numThreads) -> bool {
         if (!equalityUpToDontCare) {
             return (tt1 == tt2);
         }
+        if (tt1.size() != tt2.size()) {
+            return false;
+        }
 
         // the number of primary inputs and outputs should be equal for both the truth tables.
-        if (tt1.nPrimaryInputs() != tt2.nPrimaryInputs() && tt1.nPrimaryOutputs() != tt2.nPrimaryOutputs()) {
+        const ProjectionOntoPrimaryLines inputProjection1(tt1.nInputs(), tt1.constants);
+        const ProjectionOntoPrimaryLines inputProjection2(tt2.nInputs(), tt2.constants);
+        const ProjectionOntoPrimaryLines outputProjection1(tt1.nOutputs(), tt1.garbage);
+        const ProjectionOntoPrimaryLines outputProjection2(tt2.nOutputs(), tt2.garbage);
+        if (inputProjection1.positions.size() != inputProjection2.positions.size() || outputProjection1.positions.size() != outputProjection2.positions.size()) {
             return false;
         }
 
+        const bool haveSameInputLayout  = inputProjection1.maskWords == inputProjection2.maskWords;
+        const bool haveSameOutputLayout = outputProjection1.maskWords == outputProjection2.maskWords;
+
+        std::atomic<bool> isMismatchFound = false;
+        const auto        compareEntries  = [&](ConstIterator tt1It, ConstIterator tt2It, const std::size_t numEntries) {
+            Cube inputBuffer1;
+            Cube inputBuffer2;
+            for (std::size_t i = 0U; i < numEntries && !isMismatchFound.load(std::memory_order_relaxed); ++i, ++tt1It, ++tt2It) {
+                const auto& input1 = inputOfEntry(tt1It, inputBuffer1);
+                const auto& input2 = inputOfEntry(tt2It, inputBuffer2);
+                if (!projectedCubesAreEqual(input1, inputProjection1, input2, inputProjection2, haveSameInputLayout, false) || !projectedCubesAreEqual(outputOfEntry(tt1It), outputProjection1, outputOfEntry(tt2It), outputProjection2, haveSameOutputLayout, true)) {
+                    isMismatchFound = true;
+                }
+            }
+        };
+
+        const std::size_t numEntries = tt1.size();
+        numThreads                   = Executor::determineNumThreads(numThreads);
+        numThreads                   = std::max<std::size_t>(1U, std::min(numThreads, numEntries / MIN_NUM_ENTRIES_PER_THREAD));
+        if (numThreads == 1U) {
+            compareEntries(tt1.begin(), tt2.begin(), numEntries);
+            return !isMismatchFound;
+        }
+
+        // the iterators to the first entry of every chunk are determined by a single pass over both truth tables
+        const std::size_t                                    numEntriesPerThread = (numEntries + numThreads - 1U) / numThreads;
+        std::vector<std::pair<ConstIterator, ConstIterator>> firstEntryPerChunk;
+        firstEntryPerChunk.reserve(numThreads);
         auto tt1It = tt1.begin();
         auto tt2It = tt2.begin();
+        for (std::size_t firstEntry = 0U; firstEntry < numEntries; firstEntry += numEntriesPerThread) {
+            firstEntryPerChunk.emplace_back(tt1It, tt2It);
+            const std::size_t numEntriesOfThread = std::min(numEntriesPerThread, numEntries - firstEntry);
+            std::advance(tt1It, numEntriesOfThread);
+            std::advance(tt2It, numEntriesOfThread);
+        }
+        Executor::getShared().parallelFor(firstEntryPerChunk.size(), [&](const std::size_t chunk) {
+            compareEntries(firstEntryPerChunk[chunk].first, firstEntryPerChunk[chunk].second, std::min(numEntriesPerThread, numEntries - chunk * numEntriesPerThread));
+        }, numThreads);
+        return !isMismatchFound;
+    }
 
-        while (tt1It != tt1.end() || tt2It != tt2.end()) {
-            const auto& [input1, output1] = *tt1It;
-            const auto& [input2, output2] = *tt2It;
-            if ((tt1.filteredInput(input1) != tt2.filteredInput(input2)) || (!TruthTable::Cube::checkCubeEquality(tt1.filteredOutput(output1), tt2.filteredOutput(output2)))) {
-                return false;
+    auto TruthTable::outputHistogram() const -> const OutputHistogram& {
+        if (cachedOutputHistogram.has_value()) {
+            return *cachedOutputHistogram;
+        }
+
+        // the distinct outputs are located via an open addressing table storing the index of the distinct output for every slot, with the number of slots being a power of two that is at least twice the number of distinct outputs
+        constexpr std::size_t EMPTY_SLOT = std::numeric_limits<std::size_t>::max();
+
+        OutputHistogram          histogram;
+        std::vector<std::size_t> hashPerDistinctOutput;
+        std::vector<std::size_t> indexTable(16U, EMPTY_SLOT);
+        const auto               findSlot = [&](const Cube& output, const std::size_t hash) {
+            const std::size_t slotMask = indexTable.size() - 1U;
+            std::size_t       slot     = hash & slotMask;
+            while (indexTable[slot] != EMPTY_SLOT && (hashPerDistinctOutput[indexTable[slot]] != hash || histogram[indexTable[slot]].first != output)) {
+                slot = (slot + 1U) & slotMask;
+            }
+            return slot;
+        };
+
+        for (auto it = begin(); it != end(); ++it) {
+            const Cube&       output = outputOfEntry(it);
+            const std::size_t hash   = output.hash();
+            if (const std::size_t slot = findSlot(output, hash); indexTable[slot] != EMPTY_SLOT) {
+                ++histogram[indexTable[slot]].second;
+                continue;
             }
-            ++tt1It;
-            ++tt2It;
+
+            if ((histogram.size() + 1U) * 2U > indexTable.size()) {
+                indexTable.assign(indexTable.size() * 2U, EMPTY_SLOT);
+                for (std::size_t i = 0U; i < histogram.size(); ++i) {
+                    indexTable[findSlot(histogram[i].first, hashPerDistinctOutput[i])] = i;
+                }
+            }
+            indexTable[findSlot(output, hash)] = histogram.size();
+            histogram.emplace_back(output, 1U);
+            hashPerDistinctOutput.emplace_back(hash);
         }
 
-        return true;
+        std::ranges::sort(histogram, [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+        return cachedOutputHistogram.emplace(std::move(histogram));
     }
 
     auto TruthTable::minimumAdditionalLinesRequired() const -> std::size_t {
-        // calculate the frequency of each unique output pattern.
-        std::map<TruthTable::Cube, std::size_t> outputFreq;
-        for (const auto& [input, output]: cubeMap) {
-            outputFreq[output]++;
+        // the number of additional lines is determined by the most frequent output pattern.
+        const auto& histogram = outputHistogram();
+        if (histogram.empty()) {
+            return 0U;
         }
 
-        const auto maxPair = std::ranges::max_element(outputFreq, [](const std::pair<TruthTable::Cube, std::size_t>& p1, const std::pair<TruthTable::Cube, std::size_t>& p2) { return p1.second < p2.second; });
-
+        const auto maxPair = std::ranges::max_element(histogram, [](const auto& p1, const auto& p2) { return p1.second < p2.second; });
         return static_cast<std::size_t>(std::ceil(std::log2(maxPair->second)));
     }
+
+    auto TruthTable::save(const std::string& filename) const -> bool {
+        const std::size_t numInputs  = nInputs();
+        const std::size_t numOutputs = nOutputs();
+
+        std::vector<Word> words(NumHeaderWords, 0U);
+        words[Magic]         = BINARY_FORMAT_MAGIC;
+        words[ByteOrderMark] = BYTE_ORDER_MARK;
+        words[Version]       = BINARY_FORMAT_VERSION;
+        words[NumInputs]     = numInputs;
+        words[NumOutputs]    = numOutputs;
+        words[NumEntries]    = size();
+        words[NumConstants]  = constants.size();
+        words[NumGarbage]    = garbage.size();
+        appendMaskWords(words, constants);
+        appendMaskWords(words, garbage);
+
+        std::ofstream os(filename, std::ofstream::out | std::ofstream::binary | std::ofstream::trunc);
+        if (!os.good()) {
+            std::cerr << "Cannot open " + filename << '\n';
+            return false;
+        }
+        writeWords(os, words);
+
+        // the entries are written in chunks to avoid a write call per entry
+        constexpr std::size_t NUM_ENTRIES_PER_CHUNK = 4096U;
+        words.clear();
+        Cube inputBuffer;
+        for (auto it = begin(); it != end(); ++it) {
+            const Cube& input  = inputOfEntry(it, inputBuffer);
+            const Cube& output = outputOfEntry(it);
+            if (input.size() != numInputs || output.size() != numOutputs) {
+                return false;
+            }
+            appendPackedCube(words, input);
+            appendPackedCube(words, output);
+            if (words.size() >= NUM_ENTRIES_PER_CHUNK * 2U * (numWordsOfPositions(numInputs) + numWordsOfPositions(numOutputs))) {
+                writeWords(os, words);
+                words.clear();
+            }
+        }
+        writeWords(os, words);
+        return os.good();
+    }
+
+    auto TruthTable::mapFile(const std::string& filename) -> std::optional<MappedTruthTable> {
+        auto file = std::make_unique<MappedFile>(filename, MappedFile::AccessPattern::Random);
+        if (!file->isOpen()) {
+            std::cerr << "Cannot open " + filename << '\n';
+            return std::nullopt;
+        }
+
+        const auto content             = file->getContent();
+        const auto reportInvalidFormat = [&filename]() -> std::optional<MappedTruthTable> {
+            std::cerr << filename + " is not a truth table in the binary format" << '\n';
+            return std::nullopt;
+        };
+        if (content.size() < NumHeaderWords * sizeof(Word) || content.size() % sizeof(Word) != 0U || reinterpret_cast<std::uintptr_t>(content.data()) % alignof(Word) != 0U) { // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            return reportInvalidFormat();
+        }
+        std::array<Word, NumHeaderWords> header{};
+        std::memcpy(header.data(), content.data(), header.size() * sizeof(Word));
+
+        // the number of positions declared in the header cannot exceed the number of bits of the file (which also prevents overflows while determining the expected size of the file)
+        const auto*       words        = reinterpret_cast<const Word*>(content.data()); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        const std::size_t numWords     = content.size() / sizeof(Word);
+        const auto        isValidCount = [numWords](const Word count) { return count <= numWords * Cube::BITS_PER_WORD; };
+        if (header[Magic] != BINARY_FORMAT_MAGIC || header[ByteOrderMark] != BYTE_ORDER_MARK || header[Version] != BINARY_FORMAT_VERSION || !isValidCount(header[NumInputs]) || !isValidCount(header[NumOutputs]) || !isValidCount(header[NumConstants]) || !isValidCount(header[NumGarbage])) {
+            return reportInvalidFormat();
+        }
+
+        MappedTruthTable mappedTable;
+        mappedTable.numInputs        = header[NumInputs];
+        mappedTable.numOutputs       = header[NumOutputs];
+        mappedTable.numEntries       = header[NumEntries];
+        mappedTable.numInputWords    = numWordsOfPositions(mappedTable.numInputs);
+        mappedTable.numOutputWords   = numWordsOfPositions(mappedTable.numOutputs);
+        mappedTable.numWordsPerEntry = 2U * (mappedTable.numInputWords + mappedTable.numOutputWords);
+
+        const std::size_t numMaskWords = numWordsOfPositions(header[NumConstants]) + numWordsOfPositions(header[NumGarbage]);
+        if (NumHeaderWords + numMaskWords > numWords) {
+            return reportInvalidFormat();
+        }
+        // only a single entry can consist of an input and output without any positions
+        const std::size_t numEntryWords = numWords - NumHeaderWords - numMaskWords;
+        if (mappedTable.numWordsPerEntry == 0U ? (numEntryWords != 0U || mappedTable.numEntries > 1U) : (numEntryWords % mappedTable.numWordsPerEntry != 0U || numEntryWords / mappedTable.numWordsPerEntry != mappedTable.numEntries)) {
+            return reportInvalidFormat();
+        }
+
+        mappedTable.constants  = flagsOfMaskWords(words + NumHeaderWords, header[NumConstants]);
+        mappedTable.garbage    = flagsOfMaskWords(words + NumHeaderWords + numWordsOfPositions(header[NumConstants]), header[NumGarbage]);
+        mappedTable.entryWords = words + NumHeaderWords + numMaskWords;
+        mappedTable.file       = std::move(file);
+        return mappedTable;
+    }
+
+    MappedTruthTable::MappedTruthTable(MappedTruthTable&& other) noexcept            = default;
+    MappedTruthTable& MappedTruthTable::operator=(MappedTruthTable&& other) noexcept = default;
+    MappedTruthTable::~MappedTruthTable()                                            = default;
+
+    auto MappedTruthTable::find(const TruthTable::Cube& input) const -> std::optional<std::size_t> {
+        if (input.size() != numInputs) {
+            return std::nullopt;
+        }
+
+        // binary search of the first entry whose input is not smaller than the searched one
+        std::size_t first = 0U;
+        std::size_t count = numEntries;
+        while (count > 0U) {
+            const std::size_t step        = count / 2U;
+            const Word*       entryInput = entryWords + ((first + step) * numWordsPerEntry);
+            if (comparePackedCube(entryInput, entryInput + numInputWords, input) < 0) {
+                first += step + 1U;
+                count -= step + 1U;
+            } else {
+                count = step;
+            }
+        }
+        if (first == numEntries) {
+            return std::nullopt;
+        }
+        const Word* entryInput = entryWords + (first * numWordsPerEntry);
+        return comparePackedCube(entryInput, entryInput + numInputWords, input) == 0 ? std::make_optional(first) : std::nullopt;
+    }
+
+    auto MappedTruthTable::toTruthTable() const -> TruthTable {
+        TruthTable tt{};
+        for (const auto& entry: *this) {
+            tt.try_emplace(entry.input(), entry.output());
+        }
+        tt.setConstants(constants);
+        tt.setGarbage(garbage);
+        tt.useDenseStorageIfComplete();
+        return tt;
+    }
 } // namespace syrec
@@ -9,9 +9,13 @@
 from __future__ import annotations
 
 import json
+import pickle
+from concurrent.futures import ThreadPoolExecutor
+from multiprocessing.shared_memory import SharedMemory
 from pathlib import Path
 from typing import Any
 
+import numpy as np
 import pytest
 
 from mqt import syrec
@@ -75,6 +79,308 @@ def test_parser(data_line_aware_synthesis: dict[str, Any]) -> None:
         assert not error
 
 
+def test_program_reader_reads_multiple_programs(data_line_aware_synthesis: dict[str, Any]) -> None:
+    syrec.program_reader.warm_up_prediction_caches()
+    reader = syrec.program_reader()
+    for file_name in data_line_aware_synthesis:
+        annotatable_quantum_computation = syrec.annotatable_quantum_computation()
+        prog = syrec.program()
+        error = reader.read(prog, str(circuit_dir / (file_name + ".src")))
+
+        assert not error
+        assert syrec.line_aware_synthesis(annotatable_quantum_computation, prog)
+        assert data_line_aware_synthesis[file_name]["num_gates"] == annotatable_quantum_computation.num_ops
+
+
+def test_program_cache_skips_parsing_of_repeatedly_read_programs(
+    data_line_aware_synthesis: dict[str, Any], tmp_path: Path
+) -> None:
+    cache = syrec.program_cache(on_disk_cache_directory=str(tmp_path))
+    for _ in range(2):
+        for file_name in data_line_aware_synthesis:
+            annotatable_quantum_computation = syrec.annotatable_quantum_computation()
+            prog = syrec.program()
+            error = cache.read(prog, str(circuit_dir / (file_name + ".src")))
+
+            assert not error
+            assert syrec.line_aware_synthesis(annotatable_quantum_computation, prog)
+            assert data_line_aware_synthesis[file_name]["num_gates"] == annotatable_quantum_computation.num_ops
+
+    # Circuits with identical content are only parsed once
+    assert cache.num_cache_misses <= len(data_line_aware_synthesis)
+    assert cache.num_cache_hits + cache.num_cache_misses == 2 * len(data_line_aware_synthesis)
+
+
+def test_synthesis_result_cache_skips_synthesis_of_repeatedly_synthesized_programs(
+    data_line_aware_synthesis: dict[str, Any], tmp_path: Path
+) -> None:
+    cache = syrec.synthesis_result_cache(on_disk_cache_directory=str(tmp_path))
+    for _ in range(2):
+        for file_name in data_line_aware_synthesis:
+            prog = syrec.program()
+            error = prog.read(str(circuit_dir / (file_name + ".src")))
+            assert not error
+
+            stat = syrec.statistics()
+            annotatable_quantum_computation = cache.synthesize(
+                prog, syrec.synthesis_algorithm.line_aware, optional_recorded_statistics=stat
+            )
+            assert annotatable_quantum_computation is not None
+            assert data_line_aware_synthesis[file_name]["num_gates"] == annotatable_quantum_computation.num_ops
+            assert stat.num_synthesis_result_cache_hits == cache.num_cache_hits
+
+    # Programs with identical IR are only synthesized once
+    assert cache.num_cache_misses <= len(data_line_aware_synthesis)
+    assert cache.num_cache_hits + cache.num_cache_misses == 2 * len(data_line_aware_synthesis)
+
+
+def test_optimization_pass_manager_applies_custom_pass() -> None:
+    prog = syrec.program()
+    assert not prog.read(str(circuit_dir / "alu_2.src"))
+    annotatable_quantum_computation = syrec.annotatable_quantum_computation()
+    assert syrec.cost_aware_synthesis(annotatable_quantum_computation, prog)
+    num_ops_prior_to_pipeline = annotatable_quantum_computation.num_ops
+
+    applied_passes = []
+
+    def record_pass(quantum_computation: syrec.annotatable_quantum_computation) -> int:
+        applied_passes.append(quantum_computation.num_ops)
+        return 0
+
+    pass_manager = syrec.optimization_pass_manager()
+    assert pass_manager.register_pass("record", record_pass)
+    assert not pass_manager.set_pipeline(["record", "not_registered"])
+    assert pass_manager.set_pipeline(["cancel_adjacent_self_inverse_quantum_operations", "record"])
+    pass_manager.max_num_iterations = 4
+
+    stat = syrec.statistics()
+    assert pass_manager.run(annotatable_quantum_computation, stat)
+    assert annotatable_quantum_computation.num_ops <= num_ops_prior_to_pipeline
+    assert len(applied_passes) == stat.num_iterations_of_optimization_pipeline
+    assert stat.statistics_per_optimization_pass["record"].num_applications == len(applied_passes)
+
+
+def test_incremental_program_reader_only_reparses_changed_modules() -> None:
+    callee = "module inc(inout a(4))\n  ++= a\n"
+    main = "module main(inout a(4))\n  call inc(a)"
+    reader = syrec.incremental_program_reader()
+    prog = syrec.program()
+    assert not reader.read_from_string(prog, callee + main)
+    assert not reader.was_last_read_incremental
+
+    changed_program = "module inc(inout a(4))\n  ++= a;\n  ++= a\n" + main
+    assert not reader.read_from_string(prog, changed_program)
+    assert reader.was_last_read_incremental
+    assert reader.num_parsed_modules_of_last_read == 1
+
+    expected_prog = syrec.program()
+    assert not expected_prog.read_from_string(changed_program)
+    expected_computation = syrec.annotatable_quantum_computation()
+    actual_computation = syrec.annotatable_quantum_computation()
+    assert syrec.line_aware_synthesis(expected_computation, expected_prog)
+    assert syrec.line_aware_synthesis(actual_computation, prog)
+    assert expected_computation.num_ops == actual_computation.num_ops
+
+
+def test_incremental_synthesis_only_resynthesizes_changed_statements() -> None:
+    synthesizer = syrec.incremental_synthesis()
+    prog = syrec.program()
+    assert not prog.read_from_string("module main(inout a(4), in b(4))\n  a += b;\n  a ^= b;\n  ++= a")
+    assert synthesizer.synthesize(prog) is not None
+    assert synthesizer.num_resynthesized_statements == 3
+
+    changed_prog = syrec.program()
+    assert not changed_prog.read_from_string("module main(inout a(4), in b(4))\n  a += b;\n  a -= b;\n  ++= a")
+    actual_computation = synthesizer.synthesize(changed_prog)
+    assert actual_computation is not None
+    assert synthesizer.num_resynthesized_statements == 1
+    assert synthesizer.num_reused_statements == 2
+    assert [footprint.was_resynthesized for footprint in synthesizer.footprints_of_statements] == [False, True, False]
+    assert sum(footprint.num_quantum_operations for footprint in synthesizer.footprints_of_statements) == (
+        actual_computation.num_ops
+    )
+
+
+def test_checkpointed_simulation_steps_through_statements() -> None:
+    prog = syrec.program()
+    assert not prog.read_from_string("module main(inout a(4), in b(4))\n  a += b;\n  a ^= b;\n  ++= a")
+    annotatable_quantum_computation = syrec.annotatable_quantum_computation(True)
+    settings = syrec.configurable_options()
+    settings.generate_quantum_operation_annotations = True
+    assert syrec.cost_aware_synthesis(annotatable_quantum_computation, prog, settings)
+
+    inputs = [syrec.n_bit_values_container(annotatable_quantum_computation.num_qubits, value) for value in range(16)]
+    simulation = syrec.checkpointed_simulation()
+    assert simulation.simulate(annotatable_quantum_computation, inputs)
+    assert [statement.statement_line_number for statement in simulation.statements] == [2, 3, 4]
+
+    assert simulation.seek(len(simulation.statements))
+    expected_output = syrec.n_bit_values_container(annotatable_quantum_computation.num_qubits)
+    syrec.simple_simulation(expected_output, annotatable_quantum_computation, inputs[5])
+    assert str(simulation.get_state(5)) == str(expected_output)
+
+    while simulation.step_backward():
+        pass
+    assert simulation.num_simulated_statements == 0
+    assert str(simulation.get_state(5)) == str(inputs[5])
+
+
+def test_clifford_t_lowering_of_synthesized_program() -> None:
+    prog = syrec.program()
+    assert not prog.read_from_string("module main(inout a(3), in b(3))\n  a += b")
+    annotatable_quantum_computation = syrec.annotatable_quantum_computation()
+    assert syrec.cost_aware_synthesis(annotatable_quantum_computation, prog)
+
+    statistics = syrec.statistics()
+    lowered_quantum_computation = syrec.lower_to_clifford_t(annotatable_quantum_computation, optional_recorded_statistics=statistics)
+    assert lowered_quantum_computation is not None
+    assert lowered_quantum_computation.num_qubits >= annotatable_quantum_computation.num_qubits
+    assert statistics.num_t_gates == syrec.determine_t_count(lowered_quantum_computation)
+    assert statistics.num_t_gates > 0
+    assert 0 < statistics.t_depth <= statistics.num_t_gates
+    assert statistics.t_depth == syrec.determine_t_depth(lowered_quantum_computation)
+
+
+def test_reordering_of_qubits_reduces_nearest_neighbor_cost() -> None:
+    prog = syrec.program()
+    assert not prog.read_from_string("module main(inout a(3), in b(3), out c(3))\n  c ^= (a & b);\n  a += b")
+    annotatable_quantum_computation = syrec.annotatable_quantum_computation()
+    assert syrec.cost_aware_synthesis(annotatable_quantum_computation, prog)
+
+    qubit_labels = annotatable_quantum_computation.get_qubit_labels(syrec.qubit_label_type.internal)
+    cost_prior_to_reordering = annotatable_quantum_computation.determine_nearest_neighbor_cost()
+    settings = syrec.line_ordering_settings()
+    settings.seed = 7
+    cost_reduction = syrec.reorder_qubits_to_reduce_nearest_neighbor_cost(annotatable_quantum_computation, settings)
+    assert annotatable_quantum_computation.determine_nearest_neighbor_cost() == cost_prior_to_reordering - cost_reduction
+    assert sorted(annotatable_quantum_computation.get_qubit_labels(syrec.qubit_label_type.internal), key=str) == sorted(qubit_labels, key=str)
+
+
+def test_parser_errors_exceeding_limit_are_only_counted() -> None:
+    options = syrec.configurable_options()
+    options.max_num_reported_parser_errors = 1
+    prog = syrec.program()
+    error = prog.read_from_string("module main(inout a(4)) ++= b; ++= c; ++= d", options)
+
+    assert len(error.splitlines()) == 2
+    assert error.endswith("-- 2 further errors were not reported")
+
+
+def test_concurrently_parsed_module_declarations_match_sequential_parse(data_line_aware_synthesis: dict[str, Any]) -> None:
+    options = syrec.configurable_options()
+    options.parse_module_declarations_concurrently = True
+    for file_name in data_line_aware_synthesis:
+        expected_prog = syrec.program()
+        assert not expected_prog.read(str(circuit_dir / (file_name + ".src")))
+        prog = syrec.program()
+        assert not prog.read(str(circuit_dir / (file_name + ".src")), options)
+
+        expected_computation = syrec.annotatable_quantum_computation()
+        actual_computation = syrec.annotatable_quantum_computation()
+        assert syrec.line_aware_synthesis(expected_computation, expected_prog)
+        assert syrec.line_aware_synthesis(actual_computation, prog)
+        assert expected_computation.num_ops == actual_computation.num_ops
+
+
+def test_saved_program_is_loaded_without_parsing(data_line_aware_synthesis: dict[str, Any], tmp_path: Path) -> None:
+    for file_name in data_line_aware_synthesis:
+        prog = syrec.program()
+        assert not prog.read(str(circuit_dir / (file_name + ".src")))
+        saved_program_path = str(tmp_path / (file_name + ".syrecir"))
+        assert not prog.save(saved_program_path)
+
+        annotatable_quantum_computation = syrec.annotatable_quantum_computation()
+        loaded_prog = syrec.program()
+        error = loaded_prog.load(saved_program_path)
+
+        assert not error
+        assert syrec.line_aware_synthesis(annotatable_quantum_computation, loaded_prog)
+        assert data_line_aware_synthesis[file_name]["num_gates"] == annotatable_quantum_computation.num_ops
+
+
+def test_pickled_program_is_synthesized_without_parsing(data_line_aware_synthesis: dict[str, Any]) -> None:
+    for file_name in data_line_aware_synthesis:
+        prog = syrec.program()
+        assert not prog.read(str(circuit_dir / (file_name + ".src")))
+
+        unpickled_prog = pickle.loads(pickle.dumps(prog))
+        annotatable_quantum_computation = syrec.annotatable_quantum_computation()
+        assert syrec.line_aware_synthesis(annotatable_quantum_computation, unpickled_prog)
+        assert data_line_aware_synthesis[file_name]["num_gates"] == annotatable_quantum_computation.num_ops
+
+
+def test_serialized_program_and_quantum_computation_are_deserialized_from_shared_memory() -> None:
+    prog = syrec.program()
+    assert not prog.read_from_string("module main(inout a(4), out b(4)) b ^= (a + 1)")
+    annotatable_quantum_computation = syrec.annotatable_quantum_computation()
+    assert syrec.cost_aware_synthesis(annotatable_quantum_computation, prog)
+
+    serialized_program = prog.serialize()
+    serialized_quantum_computation = annotatable_quantum_computation.serialize()
+    assert serialized_program is not None
+    assert serialized_quantum_computation is not None
+
+    shared_memory = SharedMemory(create=True, size=len(serialized_program) + len(serialized_quantum_computation))
+    try:
+        shared_memory.buf[: len(serialized_program)] = serialized_program
+        shared_memory.buf[len(serialized_program) :] = serialized_quantum_computation
+
+        deserialized_prog = syrec.program.deserialize(shared_memory.buf[: len(serialized_program)])
+        deserialized_quantum_computation = syrec.annotatable_quantum_computation.deserialize(
+            shared_memory.buf[len(serialized_program) :]
+        )
+        assert deserialized_prog is not None
+        assert deserialized_quantum_computation is not None
+        assert deserialized_quantum_computation.num_ops == annotatable_quantum_computation.num_ops
+
+        resynthesized_quantum_computation = syrec.annotatable_quantum_computation()
+        assert syrec.cost_aware_synthesis(resynthesized_quantum_computation, deserialized_prog)
+        assert resynthesized_quantum_computation.num_ops == annotatable_quantum_computation.num_ops
+        del deserialized_prog, deserialized_quantum_computation
+    finally:
+        shared_memory.close()
+        shared_memory.unlink()
+
+    assert syrec.program.deserialize(b"invalid") is None
+
+
+def test_saved_quantum_computation_is_loaded_with_its_annotations(
+    data_line_aware_synthesis: dict[str, Any], tmp_path: Path
+) -> None:
+    for file_name in data_line_aware_synthesis:
+        prog = syrec.program()
+        assert not prog.read(str(circuit_dir / (file_name + ".src")))
+        annotatable_quantum_computation = syrec.annotatable_quantum_computation(True)
+        assert syrec.line_aware_synthesis(annotatable_quantum_computation, prog)
+
+        saved_quantum_computation_path = str(tmp_path / (file_name + ".syrecqc"))
+        assert annotatable_quantum_computation.save(saved_quantum_computation_path)
+        loaded_quantum_computation = syrec.annotatable_quantum_computation.load(saved_quantum_computation_path)
+
+        assert loaded_quantum_computation is not None
+        assert annotatable_quantum_computation.num_qubits == loaded_quantum_computation.num_qubits
+        assert annotatable_quantum_computation.num_ops == loaded_quantum_computation.num_ops
+        assert (
+            annotatable_quantum_computation.get_quantum_cost_for_synthesis()
+            == loaded_quantum_computation.get_quantum_cost_for_synthesis()
+        )
+        for i in range(annotatable_quantum_computation.num_ops):
+            assert annotatable_quantum_computation.get_annotations_of_quantum_operation(
+                i
+            ) == loaded_quantum_computation.get_annotations_of_quantum_operation(i)
+        for qubit in range(annotatable_quantum_computation.num_qubits):
+            assert annotatable_quantum_computation.get_qubit_label(
+                qubit, syrec.qubit_label_type.internal
+            ) == loaded_quantum_computation.get_qubit_label(qubit, syrec.qubit_label_type.internal)
+        assert annotatable_quantum_computation.get_qubit_labels(syrec.qubit_label_type.internal) == [
+            annotatable_quantum_computation.get_qubit_label(qubit, syrec.qubit_label_type.internal)
+            for qubit in range(annotatable_quantum_computation.num_qubits)
+        ]
+
+        unpickled_quantum_computation = pickle.loads(pickle.dumps(annotatable_quantum_computation))
+        assert annotatable_quantum_computation.num_ops == unpickled_quantum_computation.num_ops
+
+
 def test_synthesis_no_lines(data_line_aware_synthesis: dict[str, Any]) -> None:
     for file_name in data_line_aware_synthesis:
         annotatable_quantum_computation = syrec.annotatable_quantum_computation()
@@ -115,6 +421,154 @@ def test_synthesis_add_lines(data_cost_aware_synthesis: dict[str, Any]) -> None:
         )
 
 
+def test_estimated_resources_match_synthesis_result() -> None:
+    prog = syrec.program()
+    assert not prog.read_from_string("module main(in a(4), inout b(4), out c(4)) c ^= (a * b); b += (a ^ c); c -= (a - b)")
+
+    for synthesis_algorithm, synthesize in (
+        (syrec.synthesis_algorithm.cost_aware, syrec.cost_aware_synthesis),
+        (syrec.synthesis_algorithm.line_aware, syrec.line_aware_synthesis),
+        (syrec.synthesis_algorithm.hybrid, syrec.hybrid_synthesis),
+    ):
+        annotatable_quantum_computation = syrec.annotatable_quantum_computation()
+        assert synthesize(annotatable_quantum_computation, prog)
+
+        estimate = syrec.estimate_resources(prog, synthesis_algorithm=synthesis_algorithm)
+        assert estimate is not None
+        assert estimate.num_qubits == annotatable_quantum_computation.num_qubits
+        assert estimate.num_quantum_operations == annotatable_quantum_computation.num_ops
+        assert estimate.quantum_cost == annotatable_quantum_computation.get_quantum_cost_for_synthesis()
+        assert estimate.transistor_cost == annotatable_quantum_computation.get_transistor_cost_for_synthesis()
+
+
+def test_loop_optimizations_report_removed_quantum_operations() -> None:
+    prog = syrec.program()
+    assert not prog.read_from_string(
+        "module main(in a[4](4), inout b[4](4), in c(4), in d(4)) for $i = 0 to 4 step 1 do b[$i] += (a[$i] ^ (c + d)) rof"
+    )
+
+    report = syrec.optimize_loops(prog)
+    assert report.loop_fusion.num_transformations == 0
+    assert report.loop_invariant_code_motion.num_transformations == 1
+    assert report.loop_invariant_code_motion.estimated_num_removed_quantum_operations > 0
+
+
+def test_synthesis_errors_are_collected_in_diagnostics() -> None:
+    annotatable_quantum_computation = syrec.annotatable_quantum_computation()
+    prog = syrec.program()
+    assert not prog.read_from_string("module main(inout a(2)) ++= a")
+
+    diagnostics = syrec.diagnostics()
+    assert syrec.cost_aware_synthesis(annotatable_quantum_computation, prog, optional_diagnostics=diagnostics)
+    assert not diagnostics.has_errors
+    # A second synthesis into the same, no longer empty, annotatable quantum computation fails
+    assert not syrec.cost_aware_synthesis(annotatable_quantum_computation, prog, optional_diagnostics=diagnostics)
+    assert diagnostics.error_messages == [
+        "Annotatable quantum computation must be empty prior to the synthesis of a SyReC program"
+    ]
+
+    diagnostics.clear()
+    assert not diagnostics.has_errors
+
+
+def test_concurrent_synthesis_from_multiple_threads(data_cost_aware_synthesis: dict[str, Any]) -> None:
+    programs = {}
+    for file_name in data_cost_aware_synthesis:
+        prog = syrec.program()
+        error = prog.read(str(circuit_dir / (file_name + ".src")))
+        assert not error
+        programs[file_name] = prog
+
+    def synthesize(file_name: str) -> tuple[bool, syrec.annotatable_quantum_computation, syrec.diagnostics]:
+        annotatable_quantum_computation = syrec.annotatable_quantum_computation()
+        diagnostics = syrec.diagnostics()
+        synthesis_ok = syrec.cost_aware_synthesis(
+            annotatable_quantum_computation, programs[file_name], optional_diagnostics=diagnostics
+        )
+        return synthesis_ok, annotatable_quantum_computation, diagnostics
+
+    with ThreadPoolExecutor(max_workers=4) as executor:
+        results = list(executor.map(synthesize, programs))
+
+    for file_name, (synthesis_ok, annotatable_quantum_computation, diagnostics) in zip(programs, results):
+        assert synthesis_ok
+        assert not diagnostics.has_errors
+        assert data_cost_aware_synthesis[file_name]["num_gates"] == annotatable_quantum_computation.num_ops
+        assert data_cost_aware_synthesis[file_name]["lines"] == annotatable_quantum_computation.num_qubits
+
+
+def test_batch_synthesis_matches_cost_aware_synthesis(data_cost_aware_synthesis: dict[str, Any]) -> None:
+    programs = []
+    for file_name in data_cost_aware_synthesis:
+        prog = syrec.program()
+        error = prog.read(str(circuit_dir / (file_name + ".src")))
+
+        assert not error
+        programs.append(prog)
+
+    jobs = [(prog, syrec.configurable_options(), syrec.synthesis_algorithm.cost_aware) for prog in programs]
+    results = syrec.batch_synthesis(jobs, num_threads=4)
+    assert len(results) == len(jobs)
+
+    for file_name, (synthesis_ok, annotatable_quantum_computation, _, diagnostics) in zip(
+        data_cost_aware_synthesis, results
+    ):
+        assert synthesis_ok
+        assert not diagnostics.has_errors
+        assert data_cost_aware_synthesis[file_name]["num_gates"] == annotatable_quantum_computation.num_ops
+        assert data_cost_aware_synthesis[file_name]["lines"] == annotatable_quantum_computation.num_qubits
+        assert (
+            data_cost_aware_synthesis[file_name]["quantum_costs"]
+            == annotatable_quantum_computation.get_quantum_cost_for_synthesis()
+        )
+
+
+def test_synthesis_sweep_parses_program_once_and_keeps_pareto_optimal_quantum_computations() -> None:
+    variants = []
+    for synthesis_algorithm in (syrec.synthesis_algorithm.cost_aware, syrec.synthesis_algorithm.line_aware):
+        for adder_architecture in (syrec.adder_architecture.ripple_carry, syrec.adder_architecture.carry_lookahead):
+            settings = syrec.configurable_options()
+            settings.adder_architecture = adder_architecture
+            variants.append((settings, synthesis_algorithm))
+
+    result = syrec.synthesis_sweep(
+        "module main(inout a(4), in b(4), out c(4)) c ^= (a + b); a += b",
+        variants,
+        keep_pareto_optimal_quantum_computations=True,
+    )
+    assert result.num_parsed_programs == 1
+    assert result.num_synthesized_variants == len(variants)
+    assert len(result.entries) == len(variants)
+    assert any(entry.is_pareto_optimal for entry in result.entries)
+    for entry in result.entries:
+        assert entry.synthesis_ok
+        assert not entry.diagnostics.has_errors
+        if entry.is_pareto_optimal:
+            assert entry.annotatable_quantum_computation.num_qubits == entry.statistics.num_qubits
+            assert entry.annotatable_quantum_computation.get_quantum_cost_for_synthesis() == entry.quantum_cost
+        else:
+            assert entry.annotatable_quantum_computation is None
+
+
+def test_simplified_program_does_not_require_more_gates(data_cost_aware_synthesis: dict[str, Any]) -> None:
+    for file_name in data_cost_aware_synthesis:
+        prog = syrec.program()
+        error = prog.read(str(circuit_dir / (file_name + ".src")))
+        assert not error
+
+        simplified_prog = syrec.program()
+        error = simplified_prog.read(str(circuit_dir / (file_name + ".src")))
+        assert not error
+        syrec.simplify_program(simplified_prog)
+
+        annotatable_quantum_computation = syrec.annotatable_quantum_computation()
+        simplified_annotatable_quantum_computation = syrec.annotatable_quantum_computation()
+        assert syrec.cost_aware_synthesis(annotatable_quantum_computation, prog)
+        assert syrec.cost_aware_synthesis(simplified_annotatable_quantum_computation, simplified_prog)
+        assert simplified_annotatable_quantum_computation.num_ops <= annotatable_quantum_computation.num_ops
+        assert simplified_annotatable_quantum_computation.num_qubits <= annotatable_quantum_computation.num_qubits
+
+
 def test_simulation_no_lines(data_line_aware_simulation: dict[str, Any]) -> None:
     for test_case_name in data_line_aware_simulation:
         annotatable_quantum_computation = syrec.annotatable_quantum_computation()
@@ -161,6 +615,537 @@ def test_simulation_add_lines(data_cost_aware_simulation: dict[str, Any]) -> Non
             )
 
 
+def test_batch_simulation_matches_simple_simulation(data_cost_aware_simulation: dict[str, Any]) -> None:
+    for test_case_name in data_cost_aware_simulation:
+        annotatable_quantum_computation = syrec.annotatable_quantum_computation()
+        prog = syrec.program()
+        errors = prog.read_from_string(data_cost_aware_simulation[test_case_name]["inputCircuit"])
+
+        assert not errors
+        assert syrec.cost_aware_synthesis(annotatable_quantum_computation, prog)
+
+        input_states = []
+        for simulation_run_data in data_cost_aware_simulation[test_case_name]["simulationRuns"]:
+            input_state = syrec.n_bit_values_container(annotatable_quantum_computation.num_qubits)
+            init_n_bit_values_container_with_expected_state(input_state, simulation_run_data["in"])
+            input_states.append(input_state)
+
+        output_states = syrec.batch_simulation(annotatable_quantum_computation, input_states)
+        assert len(output_states) == len(input_states)
+        for input_state, batch_output_state in zip(input_states, output_states):
+            expected_output_state = syrec.n_bit_values_container(input_state.size())
+            syrec.simple_simulation(expected_output_state, annotatable_quantum_computation, input_state)
+            assert str(expected_output_state) == str(batch_output_state)
+
+
+def test_batch_simulation_of_bit_arrays_matches_batch_simulation(data_cost_aware_simulation: dict[str, Any]) -> None:
+    for test_case_name in data_cost_aware_simulation:
+        annotatable_quantum_computation = syrec.annotatable_quantum_computation()
+        prog = syrec.program()
+        assert not prog.read_from_string(data_cost_aware_simulation[test_case_name]["inputCircuit"])
+        assert syrec.cost_aware_synthesis(annotatable_quantum_computation, prog)
+
+        num_qubits = annotatable_quantum_computation.num_qubits
+        input_bits = np.asarray(
+            [
+                [int(value) for value in simulation_run_data["in"].ljust(num_qubits, "0")[:num_qubits]]
+                for simulation_run_data in data_cost_aware_simulation[test_case_name]["simulationRuns"]
+            ],
+            dtype=np.uint8,
+        ).reshape(-1, num_qubits)
+        input_states = syrec.n_bit_values_container.batch_from_bit_array(input_bits)
+        assert np.array_equal(syrec.n_bit_values_container.batch_to_bit_array(input_states), input_bits)
+
+        output_bits = syrec.batch_simulation(annotatable_quantum_computation, input_bits.astype(bool))
+        expected_output_states = syrec.batch_simulation(annotatable_quantum_computation, input_states)
+        assert output_bits.shape == input_bits.shape
+        assert np.array_equal(output_bits, syrec.n_bit_values_container.batch_to_bit_array(expected_output_states))
+
+
+def test_n_bit_values_container_conversions() -> None:
+    value = (1 << 129) | (1 << 64) | 5
+    container = syrec.n_bit_values_container(130, value)
+    assert int(container) == value
+    assert container[129]
+    assert container[64]
+    assert str(container) == "101" + "0" * 61 + "1" + "0" * 64 + "1"
+    # The bits of the integer beyond the size of the container are ignored
+    assert int(syrec.n_bit_values_container(4, value)) == 5
+
+    assert container.to_bytes() == value.to_bytes(17, "little")
+    assert int(syrec.n_bit_values_container.from_bytes(130, value.to_bytes(17, "little"))) == value
+
+    bit_values = container.to_bit_array()
+    assert bit_values.dtype == np.uint8
+    assert list(np.flatnonzero(bit_values)) == [0, 2, 64, 129]
+    assert int(syrec.n_bit_values_container.from_bit_array(bit_values.astype(bool))) == value
+
+    with pytest.raises(ValueError, match="non-negative"):
+        syrec.n_bit_values_container(4, -1)
+
+
+def test_simulate_batch_matches_batch_simulation(data_cost_aware_simulation: dict[str, Any]) -> None:
+    for test_case_name in data_cost_aware_simulation:
+        annotatable_quantum_computation = syrec.annotatable_quantum_computation()
+        prog = syrec.program()
+        errors = prog.read_from_string(data_cost_aware_simulation[test_case_name]["inputCircuit"])
+
+        assert not errors
+        assert syrec.cost_aware_synthesis(annotatable_quantum_computation, prog)
+        num_qubits = annotatable_quantum_computation.num_qubits
+        if num_qubits > 64:
+            continue
+
+        input_states = np.asarray(
+            [
+                int(simulation_run_data["in"][::-1], 2)
+                for simulation_run_data in data_cost_aware_simulation[test_case_name]["simulationRuns"]
+            ],
+            dtype=np.uint64,
+        )
+        output_states = syrec.simulate_batch(annotatable_quantum_computation, input_states)
+        assert output_states.shape == input_states.shape
+
+        expected_output_states = syrec.batch_simulation(
+            annotatable_quantum_computation,
+            [syrec.n_bit_values_container(num_qubits, int(input_state)) for input_state in input_states],
+        )
+        for expected_output_state, output_state in zip(expected_output_states, output_states):
+            assert str(expected_output_state) == str(syrec.n_bit_values_container(num_qubits, int(output_state)))
+
+
+def test_simulate_batch_of_all_assignments_of_data_qubits() -> None:
+    annotatable_quantum_computation = syrec.annotatable_quantum_computation()
+    prog = syrec.program()
+    assert not prog.read_from_string("module main(inout a(2), out b(2)) b ^= (a + 1)")
+    assert syrec.cost_aware_synthesis(annotatable_quantum_computation, prog)
+
+    output_states = syrec.simulate_batch(annotatable_quantum_computation)
+    num_data_qubits = annotatable_quantum_computation.num_data_qubits
+    assert len(output_states) == 2**num_data_qubits
+
+    all_assignments = np.arange(2**num_data_qubits, dtype=np.uint64)
+    assert np.array_equal(output_states, syrec.simulate_batch(annotatable_quantum_computation, all_assignments))
+    # The data qubits of a and b are the first four qubits with the value of b being (a + 1) xor the initial value of b
+    data_qubit_mask = np.uint64(2**num_data_qubits - 1)
+    expected_b = ((all_assignments & np.uint64(3)) + np.uint64(1)) & np.uint64(3)
+    expected_b ^= (all_assignments >> np.uint64(2)) & np.uint64(3)
+    assert np.array_equal((output_states & data_qubit_mask) >> np.uint64(2), expected_b)
+
+
+def test_build_task_matches_synchronous_build() -> None:
+    stringified_program = "module main(inout a(2), out b(2)) b ^= (a + 1)"
+    task = syrec.build_task(
+        syrec.incremental_program_reader(), stringified_program, synthesis_algorithm=syrec.synthesis_algorithm.line_aware
+    )
+    assert task.wait()
+    assert task.is_finished
+    assert task.state == syrec.background_task_state.succeeded
+    assert task.num_processed_work_items == task.num_work_items
+    assert not task.parser_errors
+    assert not task.error_messages
+
+    prog = syrec.program()
+    assert not prog.read_from_string(stringified_program)
+    expected_computation = syrec.annotatable_quantum_computation()
+    assert syrec.line_aware_synthesis(expected_computation, prog)
+    assert task.annotatable_quantum_computation is not None
+    assert task.annotatable_quantum_computation.num_ops == expected_computation.num_ops
+
+    failed_task = syrec.build_task(syrec.incremental_program_reader(), "module main(inout a(2)) ++= b")
+    assert failed_task.wait()
+    assert failed_task.state == syrec.background_task_state.failed
+    assert failed_task.parser_errors
+    assert failed_task.program is None
+    assert failed_task.annotatable_quantum_computation is None
+
+
+def test_simulation_task_matches_simulate_batch() -> None:
+    annotatable_quantum_computation = syrec.annotatable_quantum_computation()
+    prog = syrec.program()
+    assert not prog.read_from_string("module main(inout a(8), out b(8)) b ^= (a + 1)")
+    assert syrec.cost_aware_synthesis(annotatable_quantum_computation, prog)
+
+    task = syrec.simulation_task(annotatable_quantum_computation)
+    assert task.wait(timeout_in_milliseconds=60000)
+    assert task.state == syrec.background_task_state.succeeded
+    assert task.num_processed_work_items == task.num_work_items == 2**annotatable_quantum_computation.num_data_qubits
+    assert np.array_equal(task.outputs, syrec.simulate_batch(annotatable_quantum_computation, task.inputs))
+
+    # The outputs of a cancelled simulation are the ones of the input states simulated prior to its cancellation
+    cancelled_task = syrec.simulation_task(annotatable_quantum_computation)
+    cancelled_task.cancel()
+    assert cancelled_task.wait()
+    assert cancelled_task.state in {syrec.background_task_state.cancelled, syrec.background_task_state.succeeded}
+    num_simulated_inputs = len(cancelled_task.outputs)
+    assert np.array_equal(cancelled_task.outputs, task.outputs[:num_simulated_inputs])
+
+
+def test_random_stimulus_simulation_covers_data_qubits() -> None:
+    annotatable_quantum_computation = syrec.annotatable_quantum_computation()
+    prog = syrec.program()
+    assert not prog.read_from_string("module main(inout a(2), out b(2)) b ^= (a + 1)")
+    assert syrec.cost_aware_synthesis(annotatable_quantum_computation, prog)
+
+    settings = syrec.stimulus_simulation_settings()
+    settings.num_random_patterns = 1000
+    settings.seed = 3
+    result = syrec.random_stimulus_simulation(annotatable_quantum_computation, settings)
+    num_data_qubits = annotatable_quantum_computation.num_data_qubits
+    assert result.num_simulated_patterns == 1000 + 2 + num_data_qubits
+    assert len(result.num_ones_per_qubit) == annotatable_quantum_computation.num_qubits
+    assert all(result.is_qubit_toggle_covered(qubit) for qubit in range(num_data_qubits))
+
+    settings.num_threads = 3
+    result_of_multiple_threads = syrec.random_stimulus_simulation(annotatable_quantum_computation, settings)
+    assert result_of_multiple_threads.num_ones_per_qubit == result.num_ones_per_qubit
+    assert result_of_multiple_threads.num_flips_per_qubit == result.num_flips_per_qubit
+
+
+def test_fault_simulation_modes_report_same_detecting_patterns() -> None:
+    annotatable_quantum_computation = syrec.annotatable_quantum_computation()
+    prog = syrec.program()
+    assert not prog.read_from_string("module main(inout a(2), out b(2)) b ^= (a + 1)")
+    assert syrec.cost_aware_synthesis(annotatable_quantum_computation, prog)
+
+    num_qubits = annotatable_quantum_computation.num_qubits
+    faults = syrec.determine_single_faults(annotatable_quantum_computation)
+    assert faults
+    input_patterns = [syrec.n_bit_values_container(num_qubits, input_value) for input_value in range(16)]
+
+    settings = syrec.fault_simulation_settings()
+    settings.mode = syrec.fault_simulation_mode.parallel_fault
+    parallel_fault_result = syrec.fault_simulation(annotatable_quantum_computation, faults, input_patterns, settings)
+    settings.mode = syrec.fault_simulation_mode.parallel_pattern
+    parallel_pattern_result = syrec.fault_simulation(annotatable_quantum_computation, faults, input_patterns, settings)
+    assert len(parallel_pattern_result.detecting_patterns_per_fault) == len(faults)
+    assert parallel_fault_result.detecting_patterns_per_fault == parallel_pattern_result.detecting_patterns_per_fault
+    assert parallel_pattern_result.num_detected_faults == sum(
+        parallel_pattern_result.is_fault_detected(i) for i in range(len(faults))
+    )
+    assert parallel_pattern_result.num_detected_faults > 0
+
+
+def test_check_equivalence_of_synthesized_programs() -> None:
+    quantum_computations = []
+    for program_text in ("module main(inout a(2), out b(2)) b ^= (a + 1)", "module main(inout a(2), out b(2)) b ^= (a + 2)"):
+        annotatable_quantum_computation = syrec.annotatable_quantum_computation()
+        prog = syrec.program()
+        assert not prog.read_from_string(program_text)
+        assert syrec.cost_aware_synthesis(annotatable_quantum_computation, prog)
+        quantum_computations.append(annotatable_quantum_computation)
+
+    # The data qubits of a and b are the primary inputs while the ancillary qubits are initialized to zero
+    num_data_qubits = quantum_computations[0].num_data_qubits
+    result = syrec.check_equivalence(quantum_computations[0], quantum_computations[0])
+    assert result.outcome == syrec.equivalence_checking_outcome.equivalent
+    assert result.num_checked_assignments == 2**num_data_qubits
+    assert not result.counterexample
+
+    result = syrec.check_equivalence(quantum_computations[0], quantum_computations[1])
+    assert result.outcome == syrec.equivalence_checking_outcome.not_equivalent
+    assert len(result.counterexample) == num_data_qubits
+
+    settings = syrec.equivalence_checking_settings()
+    settings.max_num_primary_inputs_of_exhaustive_check = 2
+    settings.num_random_samples = 100
+    result = syrec.check_equivalence(quantum_computations[0], quantum_computations[0], settings)
+    assert result.outcome == syrec.equivalence_checking_outcome.probably_equivalent
+    assert result.num_checked_assignments == 128
+    assert 0 < result.max_fraction_of_non_equivalent_assignments < 1
+
+
+def test_check_equivalence_of_synthesized_programs_symbolically() -> None:
+    quantum_computations = []
+    for program_text in ("module main(inout a(2), out b(2)) b ^= (a + 1)", "module main(inout a(2), out b(2)) b ^= (a + 2)"):
+        annotatable_quantum_computation = syrec.annotatable_quantum_computation()
+        prog = syrec.program()
+        assert not prog.read_from_string(program_text)
+        assert syrec.cost_aware_synthesis(annotatable_quantum_computation, prog)
+        quantum_computations.append(annotatable_quantum_computation)
+
+    result = syrec.check_equivalence_symbolically(quantum_computations[0], quantum_computations[0])
+    assert result.outcome == syrec.equivalence_checking_outcome.equivalent
+    assert result.num_checked_assignments == 0
+    assert not result.counterexample
+
+    result = syrec.check_equivalence_symbolically(quantum_computations[0], quantum_computations[1])
+    assert result.outcome == syrec.equivalence_checking_outcome.not_equivalent
+    assert len(result.counterexample) == quantum_computations[0].num_data_qubits
+
+    settings = syrec.symbolic_simulation_settings()
+    settings.variable_order = syrec.symbolic_simulation_variable_order.primary_inputs
+    settings.max_num_nodes = 4
+    result = syrec.check_equivalence_symbolically(quantum_computations[0], quantum_computations[0], settings)
+    assert result.outcome == syrec.equivalence_checking_outcome.limit_exceeded
+
+def test_interpret_program() -> None:
+    prog = syrec.program()
+    assert not prog.read_from_string("module main(inout a(2), out b(2)) b ^= (a + 1)")
+
+    assignments = [[a, 0] for a in range(4)]
+    assert syrec.interpret_program(prog, assignments) == [[a, (a + 1) % 4] for a in range(4)]
+    assert syrec.interpret_program(prog, assignments, num_threads=3) == [[a, (a + 1) % 4] for a in range(4)]
+
+    diagnostics = syrec.diagnostics()
+    assert not syrec.interpret_program(prog, [[4, 0]], optional_diagnostics=diagnostics)
+    assert diagnostics.has_errors
+
+
+def test_interpret_program_using_concurrency_settings() -> None:
+    prog = syrec.program()
+    assert not prog.read_from_string("module main(inout a(4), out b(4)) b ^= (a * 3)")
+
+    settings = syrec.configurable_options()
+    assert settings.max_num_threads == 0
+    assert not settings.pin_worker_threads_to_cores
+    assert not settings.deterministic_parallel_execution
+
+    settings.max_num_threads = 3
+    settings.pin_worker_threads_to_cores = True
+    settings.deterministic_parallel_execution = True
+    assignments = [[a, 0] for a in range(16)]
+    assert syrec.interpret_program(prog, assignments, settings) == [[a, (a * 3) % 16] for a in range(16)]
+
+
+def test_synthesis_stopped_by_execution_limits() -> None:
+    prog = syrec.program()
+    assert not prog.read_from_string("module main(inout a(4), in b(4)) for $i = 0 to 16 do a += (b + $i) rof")
+
+    settings = syrec.configurable_options()
+    assert settings.execution_limits.cancellation_token is None
+    assert settings.execution_limits.time_limit_in_milliseconds is None
+    assert settings.execution_limits.memory_budget_in_mib is None
+
+    cancellation_token = syrec.cancellation_token()
+    cancellation_token.request_cancellation()
+    assert cancellation_token.is_cancellation_requested
+
+    cancelled_execution_limits = syrec.execution_limits()
+    cancelled_execution_limits.cancellation_token = cancellation_token
+    exceeded_execution_limits = syrec.execution_limits()
+    exceeded_execution_limits.time_limit_in_milliseconds = 0
+
+    for execution_limits, expected_violation in (
+        (cancelled_execution_limits, syrec.execution_limit_violation.cancelled),
+        (exceeded_execution_limits, syrec.execution_limit_violation.time_limit_exceeded),
+    ):
+        settings.execution_limits = execution_limits
+
+        stat = syrec.statistics()
+        annotatable_quantum_computation = syrec.annotatable_quantum_computation()
+        assert not syrec.cost_aware_synthesis(
+            annotatable_quantum_computation, prog, settings, optional_recorded_statistics=stat
+        )
+        assert stat.execution_limit_violation == expected_violation
+        assert json.loads(stat.to_json())["execution_limit_violation"] == expected_violation.name
+
+
+def test_progress_reporting_of_synthesis_and_simulation() -> None:
+    prog = syrec.program()
+    assert not prog.read_from_string("module main(inout a(4), in b(4)) for $i = 0 to 3 do a += (b + $i) rof; a ^= b")
+
+    progress_reports = []
+    settings = syrec.configurable_options()
+    settings.progress_callback = progress_reports.append
+    settings.progress_report_interval_in_milliseconds = 0
+
+    annotatable_quantum_computation = syrec.annotatable_quantum_computation()
+    assert syrec.cost_aware_synthesis(annotatable_quantum_computation, prog, settings)
+    assert progress_reports
+    final_progress_report = progress_reports[-1]
+    assert final_progress_report.estimated_num_statements == syrec.estimate_resources(prog).num_statements
+    assert 0 < final_progress_report.num_processed_statements <= final_progress_report.estimated_num_statements
+    assert final_progress_report.num_emitted_quantum_operations == annotatable_quantum_computation.num_ops
+
+    simulation_progress_reports = []
+    output_states = syrec.simulate_batch(annotatable_quantum_computation, progress_callback=simulation_progress_reports.append)
+    assert simulation_progress_reports
+    assert simulation_progress_reports[-1].num_simulated_patterns == len(output_states)
+    assert simulation_progress_reports[-1].num_patterns == len(output_states)
+
+
+def test_memory_usage_is_only_recorded_if_requested() -> None:
+    stringified_program = (
+        "module add(inout x(4), in y(4)) x += y "
+        "module main(inout a(4), in b(4)) wire c(4) for $i = 0 to 3 do a += (b + $i) rof; call add(c, b); a ^= c"
+    )
+    for record_memory_usage in (False, True):
+        settings = syrec.configurable_options()
+        settings.record_memory_usage = record_memory_usage
+
+        stat = syrec.statistics()
+        prog = syrec.program()
+        assert not prog.read_from_string(stringified_program, settings, stat)
+        annotatable_quantum_computation = syrec.annotatable_quantum_computation(True)
+        assert syrec.cost_aware_synthesis(
+            annotatable_quantum_computation, prog, settings, optional_recorded_statistics=stat
+        )
+
+        memory_usage = stat.memory_usage
+        if not record_memory_usage:
+            assert memory_usage.num_bytes_of_program == 0
+            assert memory_usage.num_bytes_of_quantum_operations == 0
+            assert json.loads(stat.to_json())["memory_usage"]["num_bytes_of_symbol_tables"] == 0
+            continue
+        assert memory_usage.num_bytes_of_program > 0
+        assert memory_usage.num_bytes_of_symbol_tables > 0
+        assert memory_usage.num_bytes_of_quantum_operations > 0
+        assert memory_usage.num_bytes_of_quantum_operation_annotations > 0
+        assert memory_usage.num_bytes_of_quantum_register_layouts > 0
+        assert memory_usage.peak_resident_set_size_during_synthesis_in_bytes >= (
+            memory_usage.resident_set_size_at_start_of_synthesis_in_bytes
+        )
+        assert json.loads(stat.to_json())["memory_usage"]["num_bytes_of_program"] == memory_usage.num_bytes_of_program
+
+
+def test_differential_verification() -> None:
+    prog = syrec.program()
+    assert not prog.read_from_string("module main(in a(4), inout b(4), out c(4)) c ^= (a * b); b += (a / 3)")
+
+    for synthesis_algorithm in (syrec.synthesis_algorithm.cost_aware, syrec.synthesis_algorithm.line_aware):
+        settings = syrec.differential_verification_settings()
+        settings.synthesis_algorithm = synthesis_algorithm
+        settings.num_stimuli = 1000
+        settings.num_threads = 2
+        result = syrec.differential_verification(prog, settings=settings)
+        assert result.num_checked_stimuli == 1000
+        assert result.first_mismatch is None
+
+
+def test_export_quantum_operations_matches_quantum_operations(data_cost_aware_synthesis: dict[str, Any]) -> None:
+    for file_name in data_cost_aware_synthesis:
+        annotatable_quantum_computation = syrec.annotatable_quantum_computation(True)
+        prog = syrec.program()
+        error = prog.read(str(circuit_dir / (file_name + ".src")))
+        assert not error
+        assert syrec.cost_aware_synthesis(annotatable_quantum_computation, prog)
+
+        quantum_operations = annotatable_quantum_computation.export_quantum_operations()
+        assert quantum_operations.index_of_first_quantum_operation == 0
+        assert len(quantum_operations) == annotatable_quantum_computation.num_ops
+        assert not quantum_operations.op_types.flags.writeable
+        for i in range(annotatable_quantum_computation.num_ops):
+            quantum_operation = annotatable_quantum_computation[i]
+            target_offsets = quantum_operations.target_offsets[i : i + 2]
+            control_offsets = quantum_operations.control_offsets[i : i + 2]
+            assert quantum_operations.op_types[i] == quantum_operation.type_.value
+            assert quantum_operations.target_qubits[target_offsets[0] : target_offsets[1]].tolist() == list(
+                quantum_operation.targets
+            )
+            control_qubits = quantum_operations.control_qubits[control_offsets[0] : control_offsets[1]].tolist()
+            assert sorted(control_qubits) == sorted(control.qubit for control in quantum_operation.controls)
+            assert quantum_operations.distinct_annotations[
+                quantum_operations.annotations_indices[i]
+            ] == annotatable_quantum_computation.get_annotations_of_quantum_operation(i)
+
+
+def test_statement_line_number_matches_annotation_of_quantum_operation(data_cost_aware_synthesis: dict[str, Any]) -> None:
+    for file_name in data_cost_aware_synthesis:
+        annotatable_quantum_computation = syrec.annotatable_quantum_computation(True)
+        prog = syrec.program()
+        error = prog.read(str(circuit_dir / (file_name + ".src")))
+        assert not error
+        assert syrec.cost_aware_synthesis(annotatable_quantum_computation, prog)
+
+        for i in range(annotatable_quantum_computation.num_ops):
+            statement_line_number = annotatable_quantum_computation.get_statement_line_number_of_quantum_operation(i)
+            annotations = annotatable_quantum_computation.get_annotations_of_quantum_operation(i)
+            if statement_line_number is None:
+                assert "lno" not in annotations
+            else:
+                assert annotations["lno"] == str(statement_line_number)
+
+
+def test_depth_analysis_matches_quantum_operations(data_cost_aware_synthesis: dict[str, Any]) -> None:
+    for file_name in data_cost_aware_synthesis:
+        annotatable_quantum_computation = syrec.annotatable_quantum_computation(True)
+        prog = syrec.program()
+        error = prog.read(str(circuit_dir / (file_name + ".src")))
+        assert not error
+        assert syrec.cost_aware_synthesis(annotatable_quantum_computation, prog)
+
+        depth_analysis = annotatable_quantum_computation.analyze_depth()
+        assert len(depth_analysis.layer_per_quantum_operation) == annotatable_quantum_computation.num_ops
+        assert len(depth_analysis.num_quantum_operations_per_qubit) == annotatable_quantum_computation.num_qubits
+        assert len(depth_analysis.indices_of_quantum_operations_of_critical_path) == depth_analysis.depth
+        assert depth_analysis.depth == (max(depth_analysis.layer_per_quantum_operation, default=-1) + 1)
+
+        # Every quantum operation of the critical path is placed in the layer following the one of its predecessor
+        assert [
+            depth_analysis.layer_per_quantum_operation[i]
+            for i in depth_analysis.indices_of_quantum_operations_of_critical_path
+        ] == list(range(depth_analysis.depth))
+        assert (
+            sum(depth_analysis.num_quantum_operations_of_critical_path_per_statement_line_number.values())
+            <= depth_analysis.depth
+        )
+
+
+def test_layout_of_quantum_operations_matches_quantum_operations(data_cost_aware_synthesis: dict[str, Any]) -> None:
+    for file_name in data_cost_aware_synthesis:
+        annotatable_quantum_computation = syrec.annotatable_quantum_computation()
+        prog = syrec.program()
+        error = prog.read(str(circuit_dir / (file_name + ".src")))
+        assert not error
+        assert syrec.cost_aware_synthesis(annotatable_quantum_computation, prog)
+
+        quantum_operations = annotatable_quantum_computation.export_quantum_operations()
+        layout = annotatable_quantum_computation.determine_layout_of_quantum_operations()
+        assert len(layout) == len(quantum_operations)
+        assert len(layout.column_offsets) == layout.num_columns + 1
+        assert np.array_equal(np.sort(layout.gates_ordered_by_column), np.arange(len(layout)))
+        assert np.all(np.diff(layout.column_per_gate[layout.gates_ordered_by_column].astype(np.int64)) >= 0)
+
+        for i in range(len(quantum_operations)):
+            qubits = np.concatenate((
+                quantum_operations.target_qubits[
+                    quantum_operations.target_offsets[i] : quantum_operations.target_offsets[i + 1]
+                ],
+                quantum_operations.control_qubits[
+                    quantum_operations.control_offsets[i] : quantum_operations.control_offsets[i + 1]
+                ],
+            ))
+            assert layout.min_qubit_per_gate[i] == qubits.min()
+            assert layout.max_qubit_per_gate[i] == qubits.max()
+
+
+
+def test_frozen_quantum_computation_matches_annotatable_quantum_computation(
+    data_cost_aware_synthesis: dict[str, Any],
+) -> None:
+    for file_name in data_cost_aware_synthesis:
+        annotatable_quantum_computation = syrec.annotatable_quantum_computation(True)
+        prog = syrec.program()
+        error = prog.read(str(circuit_dir / (file_name + ".src")))
+        assert not error
+        assert syrec.cost_aware_synthesis(annotatable_quantum_computation, prog)
+
+        frozen_quantum_computation = annotatable_quantum_computation.freeze()
+        assert frozen_quantum_computation.num_qubits == annotatable_quantum_computation.num_qubits
+        assert frozen_quantum_computation.num_ops == annotatable_quantum_computation.num_ops
+        assert (
+            frozen_quantum_computation.get_quantum_cost_for_synthesis()
+            == annotatable_quantum_computation.get_quantum_cost_for_synthesis()
+        )
+        assert frozen_quantum_computation.get_qubit_labels(
+            syrec.qubit_label_type.user_declared
+        ) == annotatable_quantum_computation.get_qubit_labels(syrec.qubit_label_type.user_declared)
+
+        # The analyses of the snapshot can be performed concurrently
+        with ThreadPoolExecutor(max_workers=2) as executor:
+            depth_analyses = list(executor.map(lambda _: frozen_quantum_computation.analyze_depth(), range(2)))
+            nearest_neighbor_costs = list(
+                executor.map(lambda _: frozen_quantum_computation.determine_nearest_neighbor_cost(), range(2))
+            )
+        expected_depth_analysis = annotatable_quantum_computation.analyze_depth()
+        for depth_analysis in depth_analyses:
+            assert depth_analysis.depth == expected_depth_analysis.depth
+            assert list(depth_analysis.layer_per_quantum_operation) == list(
+                expected_depth_analysis.layer_per_quantum_operation
+            )
+        assert nearest_neighbor_costs == [annotatable_quantum_computation.determine_nearest_neighbor_cost()] * 2
+
 def test_no_lines_to_qasm(data_line_aware_synthesis: dict[str, Any]) -> None:
     for file_name in data_line_aware_synthesis:
         expected_qasm_file_path = Path(str(circuit_dir / (file_name + ".qasm")))
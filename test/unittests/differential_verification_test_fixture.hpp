@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "algorithms/simulation/differential_verification.hpp"
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/syrec/program.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <string_view>
+
+/**
+ * A test fixture usable to check that an optional synthesis or optimization feature does not change the simulation result of the synthesized quantum computation of a SyReC program.
+ * @details The simulation result is compared to the one of the SyReC program using a differential verification with a fixed number of stimuli generated from a fixed seed.
+ */
+class DifferentialVerificationTestFixture: public ::testing::Test {
+protected:
+    static constexpr std::uint64_t NUM_STIMULI = 1000U;
+
+    syrec::Program program;
+
+    void parseProgram(const std::string_view& stringifiedProgram) {
+        ASSERT_EQ("", program.readFromString(stringifiedProgram));
+    }
+
+    static void assertSynthesisDoesNotChangeSimulationResult(const syrec::Program& programToVerify, const syrec::ConfigurableOptions& synthesisSettings, const syrec::SynthesisAlgorithm synthesisAlgorithm) {
+        syrec::DifferentialVerificationResult result;
+        ASSERT_TRUE(syrec::differentialVerification(result, programToVerify, synthesisSettings, syrec::DifferentialVerificationSettings{.synthesisAlgorithm = synthesisAlgorithm, .numStimuli = NUM_STIMULI, .seed = 5U, .numThreads = 1U}));
+        ASSERT_EQ(NUM_STIMULI, result.numCheckedStimuli);
+        ASSERT_FALSE(result.firstMismatch.has_value());
+    }
+
+    static void assertQuantumComputationsAreEqual(const syrec::AnnotatableQuantumComputation& expected, const syrec::AnnotatableQuantumComputation& actual) {
+        ASSERT_EQ(expected.getNqubits(), actual.getNqubits());
+        ASSERT_EQ(expected.getNops(), actual.getNops());
+        for (std::size_t i = 0; i < expected.getNops(); ++i) {
+            ASSERT_TRUE(expected.at(i)->equals(*actual.at(i))) << "Quantum operation " << i << " did not match";
+        }
+    }
+};
@@ -17,6 +17,8 @@
 #include "core/n_bit_values_container.hpp"
 #include "core/statistics.hpp"
 #include "core/syrec/program.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/operations/Operation.hpp"
 #include "qasm3/Importer.hpp"
 
 #include <cstddef>
@@ -29,6 +31,7 @@
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <vector>
 
 // The .clang-tidy warning about the missing header file seems to be a false positive since the include of the required <nlohmann/json.hpp> is defined in this file.
 // Maybe this warning is reported because the nlohmann library is implicitly added by one of the external dependencies?
@@ -187,6 +190,58 @@ protected:
         }
     }
 
+    /**
+     * Simulate the quantum computation for every state of its first \p numQubitsOfParameters qubits, with all other qubits being initialized to zero, and compare the simulated output state with the expected one.
+     * @param determineExpectedOutputState Callable of the form (std::size_t stateOfParameters, syrec::NBitValuesContainer& expectedOutputState) setting the expected output state for the given state of the parameters
+     */
+    template<typename ExpectedOutputStateDeterminer>
+    static void assertSimulationResultsForAllStatesOfParametersMatchExpectedOnes(const syrec::AnnotatableQuantumComputation& annotatableQuantumComputation, const std::size_t numQubitsOfParameters, const ExpectedOutputStateDeterminer& determineExpectedOutputState) {
+        for (std::size_t stateOfParameters = 0; stateOfParameters < (1U << numQubitsOfParameters); ++stateOfParameters) {
+            syrec::NBitValuesContainer inputState(annotatableQuantumComputation.getNqubits());
+            for (std::size_t i = 0; i < numQubitsOfParameters; ++i) {
+                inputState.set(i, ((stateOfParameters >> i) & 1U) != 0U);
+            }
+
+            syrec::NBitValuesContainer expectedOutputState(inputState.size());
+            ASSERT_NO_FATAL_FAILURE(determineExpectedOutputState(stateOfParameters, expectedOutputState));
+            ASSERT_NO_FATAL_FAILURE(assertSimulationResultForStateMatchesExpectedOne(annotatableQuantumComputation, inputState, expectedOutputState, numQubitsOfParameters));
+        }
+    }
+
+    /**
+     * Check that the simulation results of the quantum computation match the ones of a reference quantum computation synthesized from the same SyReC program for every state of the first \p numQubitsOfParameters qubits.
+     * @param referenceQubitPerOutputQubit The qubit of the reference quantum computation storing the expected value of the i-th output qubit. The i-th qubits are compared if the mapping is empty.
+     */
+    static void assertSimulationResultsForAllStatesOfParametersMatchReference(const syrec::AnnotatableQuantumComputation& annotatableQuantumComputation, const syrec::AnnotatableQuantumComputation& referenceQuantumComputation, const std::size_t numQubitsOfParameters, const std::vector<qc::Qubit>& referenceQubitPerOutputQubit = {}) {
+        const auto determineExpectedOutputStateUsingReference = [&](const std::size_t stateOfParameters, syrec::NBitValuesContainer& expectedOutputState) {
+            syrec::NBitValuesContainer inputStateOfReference(referenceQuantumComputation.getNqubits());
+            for (std::size_t i = 0; i < numQubitsOfParameters; ++i) {
+                inputStateOfReference.set(i, ((stateOfParameters >> i) & 1U) != 0U);
+            }
+
+            syrec::NBitValuesContainer outputStateOfReference(inputStateOfReference.size());
+            ASSERT_NO_FATAL_FAILURE(syrec::simpleSimulation(outputStateOfReference, referenceQuantumComputation, inputStateOfReference));
+            for (std::size_t i = 0; i < numQubitsOfParameters; ++i) {
+                expectedOutputState.set(i, outputStateOfReference[referenceQubitPerOutputQubit.empty() ? i : referenceQubitPerOutputQubit[i]]);
+            }
+        };
+        assertSimulationResultsForAllStatesOfParametersMatchExpectedOnes(annotatableQuantumComputation, numQubitsOfParameters, determineExpectedOutputStateUsingReference);
+    }
+
+    static void assertThatQuantumOperationsOfQuantumComputationsAreEqual(const syrec::AnnotatableQuantumComputation& expectedQuantumComputation, const syrec::AnnotatableQuantumComputation& actualQuantumComputation) {
+        ASSERT_EQ(expectedQuantumComputation.getNqubits(), actualQuantumComputation.getNqubits());
+        ASSERT_EQ(expectedQuantumComputation.getNops(), actualQuantumComputation.getNops());
+        for (std::size_t i = 0; i < actualQuantumComputation.getNops(); ++i) {
+            const qc::Operation* expectedQuantumOperation = expectedQuantumComputation.getQuantumOperation(i);
+            const qc::Operation* actualQuantumOperation   = actualQuantumComputation.getQuantumOperation(i);
+            ASSERT_NE(expectedQuantumOperation, nullptr);
+            ASSERT_NE(actualQuantumOperation, nullptr);
+            ASSERT_EQ(expectedQuantumOperation->getType(), actualQuantumOperation->getType()) << "Type of quantum operation at index " << std::to_string(i) << " did not match";
+            ASSERT_EQ(expectedQuantumOperation->getControls(), actualQuantumOperation->getControls()) << "Control qubits of quantum operation at index " << std::to_string(i) << " did not match";
+            ASSERT_EQ(expectedQuantumOperation->getTargets(), actualQuantumOperation->getTargets()) << "Target qubits of quantum operation at index " << std::to_string(i) << " did not match";
+        }
+    }
+
     static void loadNBitValuesContainerFromString(syrec::NBitValuesContainer& container, const std::string& stringifiedBinaryState) {
         ASSERT_GT(container.size(), 0) << "To be able to verify the contents of the stringified binary state we need to know how many values are to be expected using the NBitValuesContainer";
         ASSERT_GE(container.size(), stringifiedBinaryState.size()) << "Expected size of NBitValues container must be equal to larger than stringified binary state size";
@@ -8,19 +8,32 @@
  * Licensed under the MIT License
  */
 
+#include "algorithms/simulation/simple_simulation.hpp"
+#include "algorithms/synthesis/quantum_operation_sinks.hpp"
 #include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
 #include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
 #include "algorithms/synthesis/syrec_synthesis.hpp"
 #include "base_simulation_test_fixture.hpp"
 #include "core/annotatable_quantum_computation.hpp"
 #include "core/configurable_options.hpp"
+#include "core/n_bit_values_container.hpp"
+#include "core/statistics.hpp"
+#include "core/syrec/module.hpp"
 #include "core/syrec/parser/utils/syrec_operation_utils.hpp"
+#include "core/syrec/program.hpp"
 #include "ir/Definitions.hpp"
+#include "ir/operations/Operation.hpp"
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <gtest/gtest.h>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 const std::string RELATIVE_PATH_TO_TEST_CASE_DATA_JSON_FILE = "./unittests/simulation/data/test_synthesis_settings_features.json";
 
@@ -255,6 +268,555 @@ TYPED_TEST_P(BaseSimulationTestFixture, MismatchBetweenQuantumOperationAnnotatio
     ASSERT_FALSE(this->performProgramSynthesis(this->syrecProgramInstance, annotatableQuantumComputationWithQuantumOperationAnnotationFeatureEnabled, synthesisOptionsWithQuantumOperationAnnotationFeatureDisabled));
 }
 
+TYPED_TEST_P(BaseSimulationTestFixture, ReuseOfSynthesizedModuleCallsDoesNotChangeSynthesizedQuantumComputation) {
+    constexpr std::string_view stringifiedCircuitToParseAndSynthesis = "module add(inout a(4), in b(4)) wire t(4) t ^= b; a += t; t ^= b "
+                                                                       "module main(inout a(4), inout b(4), in c(4)) call add(a, c); call add(b, c); uncall add(a, c); for $i = 0 to 3 do call add(b, c); uncall add(a, b) rof; if c.0 then call add(a, b) else uncall add(b, a) fi c.0";
+    ASSERT_NO_FATAL_FAILURE(this->parseInputCircuitFromString(stringifiedCircuitToParseAndSynthesis, this->syrecProgramInstance));
+
+    auto synthesisSettingsWithReuseOfSynthesizedModuleCalls                        = syrec::ConfigurableOptions();
+    synthesisSettingsWithReuseOfSynthesizedModuleCalls.reuseSynthesizedModuleCalls = true;
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, this->annotatableQuantumComputation, synthesisSettingsWithReuseOfSynthesizedModuleCalls));
+
+    auto annotatableQuantumComputationWithoutReuseOfSynthesizedModuleCalls            = syrec::AnnotatableQuantumComputation();
+    auto synthesisSettingsWithoutReuseOfSynthesizedModuleCalls                        = syrec::ConfigurableOptions();
+    synthesisSettingsWithoutReuseOfSynthesizedModuleCalls.reuseSynthesizedModuleCalls = false;
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, annotatableQuantumComputationWithoutReuseOfSynthesizedModuleCalls, synthesisSettingsWithoutReuseOfSynthesizedModuleCalls));
+
+    ASSERT_NO_FATAL_FAILURE(this->assertThatQuantumOperationsOfQuantumComputationsAreEqual(annotatableQuantumComputationWithoutReuseOfSynthesizedModuleCalls, this->annotatableQuantumComputation));
+}
+
+TYPED_TEST_P(BaseSimulationTestFixture, ReplayOfSynthesizedLoopIterationsDoesNotChangeSynthesizedQuantumComputation) {
+    constexpr std::string_view stringifiedCircuitToParseAndSynthesis = "module main(inout a[8](4), in b[8](4), inout c(8), inout d(4)) "
+                                                                       "for $i = 0 to 7 do a[$i] += b[$i]; c.$i ^= a[$i].0; if b[$i].1 then ++= a[$i] else a[$i] ^= (b[$i] & d) fi b[$i].1 rof; "
+                                                                       "for $i = 7 to 0 do d += (a[$i] + b[(7 - $i)]) rof";
+    ASSERT_NO_FATAL_FAILURE(this->parseInputCircuitFromString(stringifiedCircuitToParseAndSynthesis, this->syrecProgramInstance));
+
+    auto synthesisSettingsWithReplayOfSynthesizedLoopIterations                            = syrec::ConfigurableOptions();
+    synthesisSettingsWithReplayOfSynthesizedLoopIterations.replaySynthesizedLoopIterations = true;
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, this->annotatableQuantumComputation, synthesisSettingsWithReplayOfSynthesizedLoopIterations));
+
+    auto annotatableQuantumComputationWithoutReplayOfSynthesizedLoopIterations                = syrec::AnnotatableQuantumComputation();
+    auto synthesisSettingsWithoutReplayOfSynthesizedLoopIterations                            = syrec::ConfigurableOptions();
+    synthesisSettingsWithoutReplayOfSynthesizedLoopIterations.replaySynthesizedLoopIterations = false;
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, annotatableQuantumComputationWithoutReplayOfSynthesizedLoopIterations, synthesisSettingsWithoutReplayOfSynthesizedLoopIterations));
+
+    ASSERT_NO_FATAL_FAILURE(this->assertThatQuantumOperationsOfQuantumComputationsAreEqual(annotatableQuantumComputationWithoutReplayOfSynthesizedLoopIterations, this->annotatableQuantumComputation));
+}
+
+TYPED_TEST_P(BaseSimulationTestFixture, ArenaAllocationOfIrNodesDoesNotChangeSynthesizedQuantumComputation) {
+    constexpr std::string_view stringifiedCircuitToParseAndSynthesis = "module add(inout x(4), in y(4)) x += (y + 1) "
+                                                                       "module main(inout a[4](4), inout d(4), in b(4), out c(4)) wire t(4) "
+                                                                       "for $i = 0 to 3 do if (a[$i] > b) then c ^= (a[$i] << 1) else skip fi (a[$i] > b) rof; "
+                                                                       "call add(d, b); t ^= (b * 2); c <=> t; uncall add(d, b)";
+
+    auto parserSettingsWithArenaAllocationOfIrNodes                   = syrec::ConfigurableOptions();
+    parserSettingsWithArenaAllocationOfIrNodes.allocateIrNodesInArena = true;
+    ASSERT_NO_FATAL_FAILURE(this->parseInputCircuitFromString(stringifiedCircuitToParseAndSynthesis, this->syrecProgramInstance, parserSettingsWithArenaAllocationOfIrNodes));
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, this->annotatableQuantumComputation, parserSettingsWithArenaAllocationOfIrNodes));
+
+    auto syrecProgramWithoutArenaAllocationOfIrNodes                     = syrec::Program();
+    auto annotatableQuantumComputationWithoutArenaAllocationOfIrNodes    = syrec::AnnotatableQuantumComputation();
+    auto parserSettingsWithoutArenaAllocationOfIrNodes                   = syrec::ConfigurableOptions();
+    parserSettingsWithoutArenaAllocationOfIrNodes.allocateIrNodesInArena = false;
+    ASSERT_NO_FATAL_FAILURE(this->parseInputCircuitFromString(stringifiedCircuitToParseAndSynthesis, syrecProgramWithoutArenaAllocationOfIrNodes, parserSettingsWithoutArenaAllocationOfIrNodes));
+    ASSERT_TRUE(this->performProgramSynthesis(syrecProgramWithoutArenaAllocationOfIrNodes, annotatableQuantumComputationWithoutArenaAllocationOfIrNodes, parserSettingsWithoutArenaAllocationOfIrNodes));
+
+    ASSERT_NO_FATAL_FAILURE(this->assertThatQuantumOperationsOfQuantumComputationsAreEqual(annotatableQuantumComputationWithoutArenaAllocationOfIrNodes, this->annotatableQuantumComputation));
+
+    // The IR nodes allocated in the arena must remain accessible after the program owning them was destroyed
+    syrec::Module::ptr mainModule = this->syrecProgramInstance.findModule("main");
+    ASSERT_NE(mainModule, nullptr);
+    this->syrecProgramInstance = syrec::Program();
+    ASSERT_EQ(mainModule->statements.size(), 5U);
+    ASSERT_EQ(mainModule->parameters.size(), 4U);
+    ASSERT_EQ(mainModule->parameters.front()->name, "a");
+}
+
+TYPED_TEST_P(BaseSimulationTestFixture, SharingOfSynthesizedCommonSubexpressionsDoesNotChangeSimulationResult) {
+    constexpr std::string_view stringifiedCircuitToParseAndSynthesis = "module main(inout a(2), inout b(2), out c(2), out d(2)) "
+                                                                       "c += (a + b); d ^= ((a + b) * (a + b)); "
+                                                                       "if (a < b) then c ^= (a + b) else d -= (a + b) fi (a < b); "
+                                                                       "++= a; d += ((a + b) - (b & a))";
+    constexpr std::size_t numQubitsOfParameters = 8;
+
+    ASSERT_NO_FATAL_FAILURE(this->parseInputCircuitFromString(stringifiedCircuitToParseAndSynthesis, this->syrecProgramInstance));
+    auto synthesisSettingsWithSharingOfCommonSubexpressions                                 = syrec::ConfigurableOptions();
+    synthesisSettingsWithSharingOfCommonSubexpressions.shareSynthesizedCommonSubexpressions = true;
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, this->annotatableQuantumComputation, synthesisSettingsWithSharingOfCommonSubexpressions));
+
+    auto annotatableQuantumComputationWithoutSharingOfCommonSubexpressions                     = syrec::AnnotatableQuantumComputation();
+    auto synthesisSettingsWithoutSharingOfCommonSubexpressions                                 = syrec::ConfigurableOptions();
+    synthesisSettingsWithoutSharingOfCommonSubexpressions.shareSynthesizedCommonSubexpressions = false;
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, annotatableQuantumComputationWithoutSharingOfCommonSubexpressions, synthesisSettingsWithoutSharingOfCommonSubexpressions));
+
+    // The line aware synthesis does not support the sharing of the synthesized results of expressions
+    if constexpr (BaseSimulationTestFixture<TypeParam>::isTestingLineAwareSynthesis()) {
+        ASSERT_EQ(annotatableQuantumComputationWithoutSharingOfCommonSubexpressions.getNqubits(), this->annotatableQuantumComputation.getNqubits());
+        ASSERT_EQ(annotatableQuantumComputationWithoutSharingOfCommonSubexpressions.getNops(), this->annotatableQuantumComputation.getNops());
+    } else {
+        ASSERT_LT(this->annotatableQuantumComputation.getNqubits(), annotatableQuantumComputationWithoutSharingOfCommonSubexpressions.getNqubits());
+        ASSERT_LT(this->annotatableQuantumComputation.getNops(), annotatableQuantumComputationWithoutSharingOfCommonSubexpressions.getNops());
+    }
+
+    ASSERT_NO_FATAL_FAILURE(this->assertSimulationResultsForAllStatesOfParametersMatchReference(this->annotatableQuantumComputation, annotatableQuantumComputationWithoutSharingOfCommonSubexpressions, numQubitsOfParameters));
+}
+
+TYPED_TEST_P(BaseSimulationTestFixture, DecodingOfNonConstantIndicesUsingUnaryIterationDoesNotChangeSimulationResult) {
+    // The index value 3 does not select any element of the variable 'a' and thus tests the pruning of the unary iteration tree
+    constexpr std::string_view stringifiedCircuitToParseAndSynthesis = "module main(inout a[3](2), in i(2), out c(2)) "
+                                                                       "c ^= a[i]; ++= a[i]; a[i] <=> c; a[(i + 1)] += c";
+    constexpr std::size_t numQubitsOfParameters = 10;
+
+    ASSERT_NO_FATAL_FAILURE(this->parseInputCircuitFromString(stringifiedCircuitToParseAndSynthesis, this->syrecProgramInstance));
+    auto synthesisSettingsWithUnaryIteration                                        = syrec::ConfigurableOptions();
+    synthesisSettingsWithUnaryIteration.decodeNonConstantIndicesUsingUnaryIteration = true;
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, this->annotatableQuantumComputation, synthesisSettingsWithUnaryIteration));
+
+    auto annotatableQuantumComputationWithoutUnaryIteration                            = syrec::AnnotatableQuantumComputation();
+    auto synthesisSettingsWithoutUnaryIteration                                        = syrec::ConfigurableOptions();
+    synthesisSettingsWithoutUnaryIteration.decodeNonConstantIndicesUsingUnaryIteration = false;
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, annotatableQuantumComputationWithoutUnaryIteration, synthesisSettingsWithoutUnaryIteration));
+
+    ASSERT_NO_FATAL_FAILURE(this->assertSimulationResultsForAllStatesOfParametersMatchReference(this->annotatableQuantumComputation, annotatableQuantumComputationWithoutUnaryIteration, numQubitsOfParameters));
+}
+
+TYPED_TEST_P(BaseSimulationTestFixture, SharingOfIndexDecodingOfNonConstantIndicesDoesNotChangeSimulationResult) {
+    // The index value 3 does not select any element of the variables 'a' and 'b' whose accesses share the decoding of their index in every statement
+    constexpr std::string_view stringifiedCircuitToParseAndSynthesis = "module main(inout a[3](1), inout b[3](1), in i(2), out c(1)) "
+                                                                       "a[i] += b[i]; a[i] <=> b[i]; ++= a[i]; c ^= (a[i] + b[i]); b[(i + 1)] -= a[i]";
+    constexpr std::size_t numQubitsOfParameters = 9;
+
+    ASSERT_NO_FATAL_FAILURE(this->parseInputCircuitFromString(stringifiedCircuitToParseAndSynthesis, this->syrecProgramInstance));
+    auto synthesisSettingsWithSharedIndexDecoding                                   = syrec::ConfigurableOptions();
+    synthesisSettingsWithSharedIndexDecoding.shareIndexDecodingOfNonConstantIndices = true;
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, this->annotatableQuantumComputation, synthesisSettingsWithSharedIndexDecoding));
+
+    auto annotatableQuantumComputationWithoutSharedIndexDecoding = syrec::AnnotatableQuantumComputation();
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, annotatableQuantumComputationWithoutSharedIndexDecoding, syrec::ConfigurableOptions()));
+
+    // The line aware synthesis does not support the sharing of index decodings
+    if constexpr (BaseSimulationTestFixture<TypeParam>::isTestingLineAwareSynthesis()) {
+        ASSERT_EQ(annotatableQuantumComputationWithoutSharedIndexDecoding.getNqubits(), this->annotatableQuantumComputation.getNqubits());
+        ASSERT_EQ(annotatableQuantumComputationWithoutSharedIndexDecoding.getNops(), this->annotatableQuantumComputation.getNops());
+    } else {
+        ASSERT_LT(this->annotatableQuantumComputation.getNops(), annotatableQuantumComputationWithoutSharedIndexDecoding.getNops());
+    }
+
+    ASSERT_NO_FATAL_FAILURE(this->assertSimulationResultsForAllStatesOfParametersMatchReference(this->annotatableQuantumComputation, annotatableQuantumComputationWithoutSharedIndexDecoding, numQubitsOfParameters));
+}
+
+TYPED_TEST_P(BaseSimulationTestFixture, PaddingDimensionsOfUnrolledIndicesToPowersOfTwoDoesNotChangeSimulationResult) {
+    // The index value 3 of the first dimension of the variable 'a' selects a padding element
+    constexpr std::string_view stringifiedCircuitToParseAndSynthesis = "module main(inout a[3][2](1), in i(2), in j(1), out c(1), out d(1)) "
+                                                                       "c ^= a[i][j]; ++= a[i][j]; a[(i + 1)][j] ^= c; d ^= a[1][j]";
+    constexpr std::size_t numQubitsOfParameters = 11;
+
+    ASSERT_NO_FATAL_FAILURE(this->parseInputCircuitFromString(stringifiedCircuitToParseAndSynthesis, this->syrecProgramInstance));
+    for (const bool decodeNonConstantIndicesUsingUnaryIteration: {false, true}) {
+        auto synthesisSettingsWithPaddedDimensions                                        = syrec::ConfigurableOptions();
+        synthesisSettingsWithPaddedDimensions.padDimensionsOfUnrolledIndicesToPowersOfTwo = true;
+        synthesisSettingsWithPaddedDimensions.decodeNonConstantIndicesUsingUnaryIteration = decodeNonConstantIndicesUsingUnaryIteration;
+        auto annotatableQuantumComputationWithPaddedDimensions                            = syrec::AnnotatableQuantumComputation();
+        ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, annotatableQuantumComputationWithPaddedDimensions, synthesisSettingsWithPaddedDimensions));
+
+        auto synthesisSettingsWithoutPaddedDimensions                                        = syrec::ConfigurableOptions();
+        synthesisSettingsWithoutPaddedDimensions.decodeNonConstantIndicesUsingUnaryIteration = decodeNonConstantIndicesUsingUnaryIteration;
+        auto annotatableQuantumComputationWithoutPaddedDimensions                            = syrec::AnnotatableQuantumComputation();
+        ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, annotatableQuantumComputationWithoutPaddedDimensions, synthesisSettingsWithoutPaddedDimensions));
+        // The multiplications and additions calculating the unrolled indices are omitted
+        ASSERT_LT(annotatableQuantumComputationWithPaddedDimensions.getNops(), annotatableQuantumComputationWithoutPaddedDimensions.getNops());
+
+        ASSERT_NO_FATAL_FAILURE(this->assertSimulationResultsForAllStatesOfParametersMatchReference(annotatableQuantumComputationWithPaddedDimensions, annotatableQuantumComputationWithoutPaddedDimensions, numQubitsOfParameters));
+    }
+}
+
+TYPED_TEST_P(BaseSimulationTestFixture, SelectedAdderArchitectureDoesNotChangeSimulationResult) {
+    constexpr std::string_view stringifiedCircuitToParseAndSynthesis = "module main(inout a(3), inout b(3), out c(3), out d(1)) "
+                                                                       "a += b; b -= a; c ^= (a * b); c += 5; a -= 3; d ^= (a < b); b += (c / (a + 1)); c -= (a - b)";
+    constexpr std::size_t numQubitsOfParameters = 10;
+
+    ASSERT_NO_FATAL_FAILURE(this->parseInputCircuitFromString(stringifiedCircuitToParseAndSynthesis, this->syrecProgramInstance));
+    auto annotatableQuantumComputationUsingRippleCarryAdder = syrec::AnnotatableQuantumComputation();
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, annotatableQuantumComputationUsingRippleCarryAdder, syrec::ConfigurableOptions()));
+
+    const std::vector<std::pair<syrec::AdderArchitecture, bool>> testedAdderConfigurations = {{syrec::AdderArchitecture::RippleCarry, true}, {syrec::AdderArchitecture::Cuccaro, false}, {syrec::AdderArchitecture::CarryLookahead, false}, {syrec::AdderArchitecture::CarryLookahead, true}};
+    for (const auto& [adderArchitecture, addConstantsWithoutAncillaryQubits]: testedAdderConfigurations) {
+        auto annotatableQuantumComputationUsingAdder         = syrec::AnnotatableQuantumComputation();
+        auto synthesisSettings                               = syrec::ConfigurableOptions();
+        synthesisSettings.adderArchitecture                  = adderArchitecture;
+        synthesisSettings.addConstantsWithoutAncillaryQubits = addConstantsWithoutAncillaryQubits;
+        ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, annotatableQuantumComputationUsingAdder, synthesisSettings));
+
+        ASSERT_NO_FATAL_FAILURE(this->assertSimulationResultsForAllStatesOfParametersMatchReference(annotatableQuantumComputationUsingAdder, annotatableQuantumComputationUsingRippleCarryAdder, numQubitsOfParameters));
+    }
+}
+
+TYPED_TEST_P(BaseSimulationTestFixture, SelectedMultiplierArchitectureDoesNotChangeSimulationResult) {
+    constexpr std::string_view stringifiedCircuitToParseAndSynthesis = "module main(inout a(3), inout b(3), out c(3), in d(1)) "
+                                                                       "c ^= (a * b); if (d = 1) then c += (b * a) else c -= (a * a) fi (d = 1); b += (c * a)";
+    constexpr std::size_t numQubitsOfParameters = 10;
+
+    ASSERT_NO_FATAL_FAILURE(this->parseInputCircuitFromString(stringifiedCircuitToParseAndSynthesis, this->syrecProgramInstance));
+    auto annotatableQuantumComputationUsingControlledAdditions = syrec::AnnotatableQuantumComputation();
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, annotatableQuantumComputationUsingControlledAdditions, syrec::ConfigurableOptions()));
+
+    for (const syrec::AdderArchitecture adderArchitecture: {syrec::AdderArchitecture::RippleCarry, syrec::AdderArchitecture::CarryLookahead}) {
+        auto annotatableQuantumComputationUsingPartialProducts = syrec::AnnotatableQuantumComputation();
+        auto synthesisSettings                                 = syrec::ConfigurableOptions();
+        synthesisSettings.adderArchitecture                    = adderArchitecture;
+        synthesisSettings.multiplierArchitecture               = syrec::MultiplierArchitecture::PartialProducts;
+        ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, annotatableQuantumComputationUsingPartialProducts, synthesisSettings));
+
+        ASSERT_NO_FATAL_FAILURE(this->assertSimulationResultsForAllStatesOfParametersMatchReference(annotatableQuantumComputationUsingPartialProducts, annotatableQuantumComputationUsingControlledAdditions, numQubitsOfParameters));
+    }
+}
+
+TYPED_TEST_P(BaseSimulationTestFixture, SpecializationOfOperationsWithConstantOperandDoesNotChangeSimulationResult) {
+    // The non-constant index of the first dimension of the variable 'a' requires a multiplication with the constant offset 3 between its elements
+    constexpr std::string_view stringifiedCircuitToParseAndSynthesis = "module main(inout a[2][3](1), in i(1), inout b(3), out c(3), out d(1)) "
+                                                                       "c ^= (b * 5); c += (6 * b); d ^= (b < 5); d ^= (3 > b); d ^= (b <= 2); d ^= (6 >= b); d ^= (b = 4); d ^= (1 != b); a[i][1] ^= d";
+    constexpr std::size_t numQubitsOfParameters = 14;
+
+    ASSERT_NO_FATAL_FAILURE(this->parseInputCircuitFromString(stringifiedCircuitToParseAndSynthesis, this->syrecProgramInstance));
+    auto synthesisSettingsWithSpecialization                                    = syrec::ConfigurableOptions();
+    synthesisSettingsWithSpecialization.specializeOperationsWithConstantOperand = true;
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, this->annotatableQuantumComputation, synthesisSettingsWithSpecialization));
+
+    auto annotatableQuantumComputationWithoutSpecialization = syrec::AnnotatableQuantumComputation();
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, annotatableQuantumComputationWithoutSpecialization, syrec::ConfigurableOptions()));
+    ASSERT_LT(this->annotatableQuantumComputation.getNqubits(), annotatableQuantumComputationWithoutSpecialization.getNqubits());
+
+    ASSERT_NO_FATAL_FAILURE(this->assertSimulationResultsForAllStatesOfParametersMatchReference(this->annotatableQuantumComputation, annotatableQuantumComputationWithoutSpecialization, numQubitsOfParameters));
+}
+
+TYPED_TEST_P(BaseSimulationTestFixture, SynthesisOfShiftsByRelabelingQubitsDoesNotChangeSimulationResult) {
+    // The operands of the relational operation 'a = (a << 1)' share qubits if the shift is synthesized by relabeling the qubits of 'a'
+    constexpr std::string_view stringifiedCircuitToParseAndSynthesis = "module main(inout a(3), in b(3), out c(3), out d(1)) "
+                                                                       "c += (a << 1); c ^= (b >> 2); d ^= (a = (a << 1)); c -= ((b << 1) + (a >> 1)); ++= a; c ^= ((a >> 1) * (b << 4))";
+    constexpr std::size_t numQubitsOfParameters = 10;
+
+    ASSERT_NO_FATAL_FAILURE(this->parseInputCircuitFromString(stringifiedCircuitToParseAndSynthesis, this->syrecProgramInstance));
+    auto synthesisSettingsWithRelabeling                               = syrec::ConfigurableOptions();
+    synthesisSettingsWithRelabeling.synthesizeShiftsByRelabelingQubits = true;
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, this->annotatableQuantumComputation, synthesisSettingsWithRelabeling));
+
+    auto annotatableQuantumComputationWithoutRelabeling = syrec::AnnotatableQuantumComputation();
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, annotatableQuantumComputationWithoutRelabeling, syrec::ConfigurableOptions()));
+
+    // The line aware synthesis does not support the synthesis of shifts by relabeling qubits
+    if constexpr (BaseSimulationTestFixture<TypeParam>::isTestingLineAwareSynthesis()) {
+        ASSERT_EQ(annotatableQuantumComputationWithoutRelabeling.getNqubits(), this->annotatableQuantumComputation.getNqubits());
+        ASSERT_EQ(annotatableQuantumComputationWithoutRelabeling.getNops(), this->annotatableQuantumComputation.getNops());
+    } else {
+        ASSERT_LT(this->annotatableQuantumComputation.getNqubits(), annotatableQuantumComputationWithoutRelabeling.getNqubits());
+        ASSERT_LT(this->annotatableQuantumComputation.getNops(), annotatableQuantumComputationWithoutRelabeling.getNops());
+    }
+
+    ASSERT_NO_FATAL_FAILURE(this->assertSimulationResultsForAllStatesOfParametersMatchReference(this->annotatableQuantumComputation, annotatableQuantumComputationWithoutRelabeling, numQubitsOfParameters));
+}
+
+TYPED_TEST_P(BaseSimulationTestFixture, TrackingOfUnconditionalSwapsAsQubitPermutationDoesNotChangeSimulationResult) {
+    // Only the swaps 'a <=> b' and 'c <=> d' outside of the IfStatement and the loop are tracked as qubit permutation, the swap of the bitranges accesses only some of the qubits of the swapped variables
+    constexpr std::string_view stringifiedCircuitToParseAndSynthesis = "module main(inout a(3), inout b(3), out c(3), out d(3)) "
+                                                                       "c ^= (a + b); a <=> b; d ^= (a - b); if (c = 2) then a <=> b fi (c = 2); for 2 do a <=> b rof; c <=> d; a.0:1 <=> b.1:2; d += (a & b)";
+    constexpr std::size_t numQubitsOfParameters = 12;
+
+    ASSERT_NO_FATAL_FAILURE(this->parseInputCircuitFromString(stringifiedCircuitToParseAndSynthesis, this->syrecProgramInstance));
+    auto synthesisSettingsWithQubitPermutation                                      = syrec::ConfigurableOptions();
+    synthesisSettingsWithQubitPermutation.trackUnconditionalSwapsAsQubitPermutation = true;
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, this->annotatableQuantumComputation, synthesisSettingsWithQubitPermutation));
+
+    auto annotatableQuantumComputationWithoutQubitPermutation = syrec::AnnotatableQuantumComputation();
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, annotatableQuantumComputationWithoutQubitPermutation, syrec::ConfigurableOptions()));
+    ASSERT_EQ(annotatableQuantumComputationWithoutQubitPermutation.getNqubits(), this->annotatableQuantumComputation.getNqubits());
+    ASSERT_LT(this->annotatableQuantumComputation.getNops(), annotatableQuantumComputationWithoutQubitPermutation.getNops());
+
+    // The value of a logical qubit is stored in the qubit mapped to it by the output permutation
+    std::vector<qc::Qubit> logicalQubitPerOutputQubit(numQubitsOfParameters);
+    for (qc::Qubit i = 0; i < numQubitsOfParameters; ++i) {
+        ASSERT_TRUE(this->annotatableQuantumComputation.outputPermutation.contains(i));
+        logicalQubitPerOutputQubit[i] = this->annotatableQuantumComputation.outputPermutation.at(i);
+    }
+    ASSERT_EQ(3U, logicalQubitPerOutputQubit[0]);
+    ASSERT_EQ(9U, logicalQubitPerOutputQubit[6]);
+
+    ASSERT_NO_FATAL_FAILURE(this->assertSimulationResultsForAllStatesOfParametersMatchReference(this->annotatableQuantumComputation, annotatableQuantumComputationWithoutQubitPermutation, numQubitsOfParameters, logicalQubitPerOutputQubit));
+}
+
+TYPED_TEST_P(BaseSimulationTestFixture, FoldingOfNegationsIntoNegativeControlsDoesNotChangeSimulationResult) {
+    constexpr std::string_view stringifiedCircuitToParseAndSynthesis = "module main(inout a(2), inout b(2), out c(2), in d(1)) "
+                                                                       "c ^= (~a + b); if d then c += a else if (a < b) then c ^= (~b) fi (a < b); c -= b fi d; c.0 ^= (!d)";
+    constexpr std::size_t numQubitsOfParameters = 7;
+
+    ASSERT_NO_FATAL_FAILURE(this->parseInputCircuitFromString(stringifiedCircuitToParseAndSynthesis, this->syrecProgramInstance));
+    auto synthesisSettingsWithFoldedNegations                              = syrec::ConfigurableOptions();
+    synthesisSettingsWithFoldedNegations.foldNegationsIntoNegativeControls = true;
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, this->annotatableQuantumComputation, synthesisSettingsWithFoldedNegations));
+
+    auto annotatableQuantumComputationWithoutFoldedNegations = syrec::AnnotatableQuantumComputation();
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, annotatableQuantumComputationWithoutFoldedNegations, syrec::ConfigurableOptions()));
+    ASSERT_EQ(annotatableQuantumComputationWithoutFoldedNegations.getNqubits(), this->annotatableQuantumComputation.getNqubits());
+    ASSERT_LT(this->annotatableQuantumComputation.getNops(), annotatableQuantumComputationWithoutFoldedNegations.getNops());
+
+    ASSERT_NO_FATAL_FAILURE(this->assertSimulationResultsForAllStatesOfParametersMatchReference(this->annotatableQuantumComputation, annotatableQuantumComputationWithoutFoldedNegations, numQubitsOfParameters));
+}
+
+TYPED_TEST_P(BaseSimulationTestFixture, SelectedDividerArchitectureAndSharingOfDividerDoNotChangeSimulationResult) {
+    constexpr std::string_view stringifiedCircuitToParseAndSynthesis = "module main(inout a(3), inout b(3), out c(3), in d(1)) "
+                                                                       "c ^= ((a / b) + (a % b)); if (d = 1) then c += (b % a) else c -= (a / (b + 1)) fi (d = 1); b ^= ((c % a) ^ (c / a))";
+    constexpr std::size_t numQubitsOfParameters = 10;
+
+    ASSERT_NO_FATAL_FAILURE(this->parseInputCircuitFromString(stringifiedCircuitToParseAndSynthesis, this->syrecProgramInstance));
+    auto annotatableQuantumComputationUsingRestoringDivider = syrec::AnnotatableQuantumComputation();
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, annotatableQuantumComputationUsingRestoringDivider, syrec::ConfigurableOptions()));
+
+    for (const syrec::DividerArchitecture dividerArchitecture: {syrec::DividerArchitecture::Restoring, syrec::DividerArchitecture::NonRestoring}) {
+        for (const bool shareDividerOfQuotientAndRemainder: {false, true}) {
+            if (dividerArchitecture == syrec::DividerArchitecture::Restoring && !shareDividerOfQuotientAndRemainder) {
+                continue;
+            }
+
+            auto annotatableQuantumComputationUsingDivider       = syrec::AnnotatableQuantumComputation();
+            auto synthesisSettings                               = syrec::ConfigurableOptions();
+            synthesisSettings.dividerArchitecture                = dividerArchitecture;
+            synthesisSettings.shareDividerOfQuotientAndRemainder = shareDividerOfQuotientAndRemainder;
+            ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, annotatableQuantumComputationUsingDivider, synthesisSettings));
+
+            ASSERT_NO_FATAL_FAILURE(this->assertSimulationResultsForAllStatesOfParametersMatchReference(annotatableQuantumComputationUsingDivider, annotatableQuantumComputationUsingRestoringDivider, numQubitsOfParameters));
+        }
+    }
+}
+
+TYPED_TEST_P(BaseSimulationTestFixture, SharingOfComparatorOfRelationalOperationsDoesNotChangeSimulationResult) {
+    constexpr std::string_view stringifiedCircuitToParseAndSynthesis = "module main(inout a(2), inout b(2), out c(1), out d(1), in e(1)) "
+                                                                       "c ^= ((a < b) || (a > b)); d ^= ((b >= a) && (a != b)); if ((a = b) || (b < a)) then c ^= e else d ^= ((a <= b) ^ (b > a)) fi ((a = b) || (b < a))";
+    constexpr std::size_t numQubitsOfParameters = 7;
+
+    ASSERT_NO_FATAL_FAILURE(this->parseInputCircuitFromString(stringifiedCircuitToParseAndSynthesis, this->syrecProgramInstance));
+    auto synthesisSettingsWithSharedComparators                                  = syrec::ConfigurableOptions();
+    synthesisSettingsWithSharedComparators.shareComparatorOfRelationalOperations = true;
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, this->annotatableQuantumComputation, synthesisSettingsWithSharedComparators));
+
+    auto annotatableQuantumComputationWithoutSharedComparators = syrec::AnnotatableQuantumComputation();
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, annotatableQuantumComputationWithoutSharedComparators, syrec::ConfigurableOptions()));
+
+    // The line aware synthesis does not support the sharing of comparators
+    if constexpr (BaseSimulationTestFixture<TypeParam>::isTestingLineAwareSynthesis()) {
+        ASSERT_EQ(annotatableQuantumComputationWithoutSharedComparators.getNqubits(), this->annotatableQuantumComputation.getNqubits());
+        ASSERT_EQ(annotatableQuantumComputationWithoutSharedComparators.getNops(), this->annotatableQuantumComputation.getNops());
+    } else {
+        ASSERT_LT(this->annotatableQuantumComputation.getNops(), annotatableQuantumComputationWithoutSharedComparators.getNops());
+    }
+
+    ASSERT_NO_FATAL_FAILURE(this->assertSimulationResultsForAllStatesOfParametersMatchReference(this->annotatableQuantumComputation, annotatableQuantumComputationWithoutSharedComparators, numQubitsOfParameters));
+}
+
+TYPED_TEST_P(BaseSimulationTestFixture, ReuseOfAncillaryQubitsAcrossStatementsDoesNotChangeSimulationResult) {
+    constexpr std::string_view stringifiedCircuitToParseAndSynthesis = "module f(inout x(2), inout y(2)) y += (x + 3) "
+                                                                       "module main(inout a(2), inout b(2), out c(2), out d(2)) "
+                                                                       "call f(a, c); c += (a + b); d ^= ((a + b) * (a + b)); call f(b, d); "
+                                                                       "if (a < b) then c ^= (a + b) else d -= (a + b) fi (a < b); "
+                                                                       "++= a; d += ((a + b) - (b & a))";
+    constexpr std::size_t numQubitsOfParameters = 8;
+
+    ASSERT_NO_FATAL_FAILURE(this->parseInputCircuitFromString(stringifiedCircuitToParseAndSynthesis, this->syrecProgramInstance));
+    auto synthesisSettingsWithReuseOfAncillaryQubits                                 = syrec::ConfigurableOptions();
+    synthesisSettingsWithReuseOfAncillaryQubits.reuseAncillaryQubitsAcrossStatements = true;
+    syrec::Statistics statisticsWithReuseOfAncillaryQubits;
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, this->annotatableQuantumComputation, synthesisSettingsWithReuseOfAncillaryQubits, &statisticsWithReuseOfAncillaryQubits));
+
+    auto annotatableQuantumComputationWithoutReuseOfAncillaryQubits                     = syrec::AnnotatableQuantumComputation();
+    auto synthesisSettingsWithoutReuseOfAncillaryQubits                                 = syrec::ConfigurableOptions();
+    synthesisSettingsWithoutReuseOfAncillaryQubits.reuseAncillaryQubitsAcrossStatements = false;
+    syrec::Statistics statisticsWithoutReuseOfAncillaryQubits;
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, annotatableQuantumComputationWithoutReuseOfAncillaryQubits, synthesisSettingsWithoutReuseOfAncillaryQubits, &statisticsWithoutReuseOfAncillaryQubits));
+    ASSERT_EQ(0U, statisticsWithoutReuseOfAncillaryQubits.numReusedAncillaryQubits);
+
+    // The line aware synthesis does not support the reuse of ancillary qubits across statements
+    if constexpr (BaseSimulationTestFixture<TypeParam>::isTestingLineAwareSynthesis()) {
+        ASSERT_EQ(0U, statisticsWithReuseOfAncillaryQubits.numReusedAncillaryQubits);
+        ASSERT_EQ(annotatableQuantumComputationWithoutReuseOfAncillaryQubits.getNqubits(), this->annotatableQuantumComputation.getNqubits());
+        ASSERT_EQ(annotatableQuantumComputationWithoutReuseOfAncillaryQubits.getNops(), this->annotatableQuantumComputation.getNops());
+    } else {
+        ASSERT_GT(statisticsWithReuseOfAncillaryQubits.numReusedAncillaryQubits, 0U);
+        ASSERT_EQ(annotatableQuantumComputationWithoutReuseOfAncillaryQubits.getNqubits() - statisticsWithReuseOfAncillaryQubits.numReusedAncillaryQubits, this->annotatableQuantumComputation.getNqubits());
+    }
+
+    ASSERT_NO_FATAL_FAILURE(this->assertSimulationResultsForAllStatesOfParametersMatchReference(this->annotatableQuantumComputation, annotatableQuantumComputationWithoutReuseOfAncillaryQubits, numQubitsOfParameters));
+}
+
+TYPED_TEST_P(BaseSimulationTestFixture, DeferredUncomputationOfExpressionsDoesNotChangeSimulationResult) {
+    constexpr std::string_view stringifiedCircuitToParseAndSynthesis = "module f(inout x(2), inout y(2)) y += (x + 3) "
+                                                                       "module main(inout a(2), inout b(2), out c(2), out d(2)) "
+                                                                       "call f(a, c); c += (a + b); d ^= ((a + b) * (a + b)); call f(b, d); "
+                                                                       "if (a < b) then c ^= (a + b) else d -= (a + b) fi (a < b); "
+                                                                       "++= a; d += ((a + b) - (b & a))";
+    constexpr std::size_t numQubitsOfParameters = 8;
+
+    ASSERT_NO_FATAL_FAILURE(this->parseInputCircuitFromString(stringifiedCircuitToParseAndSynthesis, this->syrecProgramInstance));
+    auto annotatableQuantumComputationWithEagerUncomputation                     = syrec::AnnotatableQuantumComputation();
+    auto synthesisSettingsWithEagerUncomputation                                 = syrec::ConfigurableOptions();
+    synthesisSettingsWithEagerUncomputation.reuseAncillaryQubitsAcrossStatements = true;
+    synthesisSettingsWithEagerUncomputation.ancillaryQubitUncomputationStrategy  = syrec::AncillaryQubitUncomputationStrategy::Eager;
+    syrec::Statistics statisticsWithEagerUncomputation;
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, annotatableQuantumComputationWithEagerUncomputation, synthesisSettingsWithEagerUncomputation, &statisticsWithEagerUncomputation));
+
+    for (const syrec::AncillaryQubitUncomputationStrategy ancillaryQubitUncomputationStrategy: {syrec::AncillaryQubitUncomputationStrategy::Lazy, syrec::AncillaryQubitUncomputationStrategy::Bennett}) {
+        auto annotatableQuantumComputationWithDeferredUncomputation                       = syrec::AnnotatableQuantumComputation();
+        auto synthesisSettingsWithDeferredUncomputation                                   = synthesisSettingsWithEagerUncomputation;
+        synthesisSettingsWithDeferredUncomputation.ancillaryQubitUncomputationStrategy    = ancillaryQubitUncomputationStrategy;
+        synthesisSettingsWithDeferredUncomputation.maxNumDeferredExpressionUncomputations = 1;
+        syrec::Statistics statisticsWithDeferredUncomputation;
+        ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, annotatableQuantumComputationWithDeferredUncomputation, synthesisSettingsWithDeferredUncomputation, &statisticsWithDeferredUncomputation));
+
+        // The line aware synthesis does not support the reuse of ancillary qubits across statements
+        if constexpr (BaseSimulationTestFixture<TypeParam>::isTestingLineAwareSynthesis()) {
+            ASSERT_EQ(0U, statisticsWithDeferredUncomputation.numUncomputedExpressions);
+            ASSERT_EQ(0U, statisticsWithDeferredUncomputation.numQuantumOperationsOfUncomputedExpressions);
+        } else {
+            // The expression of the last assignment is only uncomputed by the eager uncomputation
+            ASSERT_GT(statisticsWithEagerUncomputation.numUncomputedExpressions, 0U);
+            ASSERT_LT(statisticsWithDeferredUncomputation.numQuantumOperationsOfUncomputedExpressions, statisticsWithEagerUncomputation.numQuantumOperationsOfUncomputedExpressions);
+        }
+
+        ASSERT_NO_FATAL_FAILURE(this->assertSimulationResultsForAllStatesOfParametersMatchReference(annotatableQuantumComputationWithDeferredUncomputation, annotatableQuantumComputationWithEagerUncomputation, numQubitsOfParameters));
+    }
+}
+
+TYPED_TEST_P(BaseSimulationTestFixture, ReuseAndCombinationOfGuardsOfIfStatementsDoNotChangeSimulationResult) {
+    // The variable 'd' of the guard of the last IfStatement is accessed in its branches and thus requires the copy of its value to an ancillary qubit
+    constexpr std::string_view stringifiedCircuitToParseAndSynthesis = "module main(in a(1), in b(1), in c(2), inout d(2), inout e(2)) "
+                                                                       "if a then "
+                                                                       "if b then if (c = 1) then ++= d; e += d else d <=> e fi (c = 1) else --= e fi b; "
+                                                                       "if d.0 then e ^= d fi d.0 "
+                                                                       "else d += e fi a";
+    constexpr std::size_t numQubitsOfParameters = 8;
+
+    const auto determineMaxNumControlQubitsOfQuantumOperations = [](const syrec::AnnotatableQuantumComputation& annotatableQuantumComputation) {
+        std::size_t maxNumControlQubits = 0;
+        for (std::size_t i = 0; i < annotatableQuantumComputation.getNumQuantumOperations(); ++i) {
+            if (const qc::Operation* quantumOperation = annotatableQuantumComputation.getQuantumOperation(i); quantumOperation != nullptr) {
+                maxNumControlQubits = std::max(maxNumControlQubits, quantumOperation->getNcontrols());
+            }
+        }
+        return maxNumControlQubits;
+    };
+
+    ASSERT_NO_FATAL_FAILURE(this->parseInputCircuitFromString(stringifiedCircuitToParseAndSynthesis, this->syrecProgramInstance));
+    auto annotatableQuantumComputationWithoutOptimizedGuards = syrec::AnnotatableQuantumComputation();
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, annotatableQuantumComputationWithoutOptimizedGuards, syrec::ConfigurableOptions()));
+
+    for (const auto& [reuseQubitOfGuardVariable, combineGuardsOfNestedIfStatements]: {std::make_pair(true, false), std::make_pair(false, true), std::make_pair(true, true)}) {
+        auto annotatableQuantumComputationWithOptimizedGuards                               = syrec::AnnotatableQuantumComputation();
+        auto synthesisSettingsWithOptimizedGuards                                           = syrec::ConfigurableOptions();
+        synthesisSettingsWithOptimizedGuards.reuseQubitOfGuardVariableNotAccessedInBranches = reuseQubitOfGuardVariable;
+        synthesisSettingsWithOptimizedGuards.combineGuardsOfNestedIfStatements              = combineGuardsOfNestedIfStatements;
+        ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, annotatableQuantumComputationWithOptimizedGuards, synthesisSettingsWithOptimizedGuards));
+
+        // The values of the guard variables 'a' and 'b' are not copied to ancillary qubits while the quantum operations of the innermost branches are no longer controlled by the guards of all enclosing IfStatements
+        if (!combineGuardsOfNestedIfStatements) {
+            ASSERT_LT(annotatableQuantumComputationWithOptimizedGuards.getNqubits(), annotatableQuantumComputationWithoutOptimizedGuards.getNqubits());
+        } else {
+            ASSERT_LT(determineMaxNumControlQubitsOfQuantumOperations(annotatableQuantumComputationWithOptimizedGuards), determineMaxNumControlQubitsOfQuantumOperations(annotatableQuantumComputationWithoutOptimizedGuards));
+        }
+
+        ASSERT_NO_FATAL_FAILURE(this->assertSimulationResultsForAllStatesOfParametersMatchReference(annotatableQuantumComputationWithOptimizedGuards, annotatableQuantumComputationWithoutOptimizedGuards, numQubitsOfParameters));
+    }
+}
+
+TYPED_TEST_P(BaseSimulationTestFixture, CancellationOfAdjacentSelfInverseQuantumOperationsDoesNotChangeSimulationResult) {
+    constexpr std::string_view stringifiedCircuitToParseAndSynthesis = "module main(inout a(2), inout b(2), out c(2)) "
+                                                                       "a ^= b; a ^= b; c += ((a + b) - (b & a))";
+    constexpr std::size_t numQubitsOfParameters = 6;
+
+    ASSERT_NO_FATAL_FAILURE(this->parseInputCircuitFromString(stringifiedCircuitToParseAndSynthesis, this->syrecProgramInstance));
+    auto synthesisSettingsWithCancellation                                       = syrec::ConfigurableOptions();
+    synthesisSettingsWithCancellation.cancelAdjacentSelfInverseQuantumOperations = true;
+    syrec::Statistics statisticsWithCancellation;
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, this->annotatableQuantumComputation, synthesisSettingsWithCancellation, &statisticsWithCancellation));
+
+    auto annotatableQuantumComputationWithoutCancellation                           = syrec::AnnotatableQuantumComputation();
+    auto synthesisSettingsWithoutCancellation                                       = syrec::ConfigurableOptions();
+    synthesisSettingsWithoutCancellation.cancelAdjacentSelfInverseQuantumOperations = false;
+    syrec::Statistics statisticsWithoutCancellation;
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, annotatableQuantumComputationWithoutCancellation, synthesisSettingsWithoutCancellation, &statisticsWithoutCancellation));
+    ASSERT_EQ(0U, statisticsWithoutCancellation.numCancelledQuantumOperations);
+
+    ASSERT_GT(statisticsWithCancellation.numCancelledQuantumOperations, 0U);
+    ASSERT_EQ(annotatableQuantumComputationWithoutCancellation.getNqubits(), this->annotatableQuantumComputation.getNqubits());
+    ASSERT_EQ(annotatableQuantumComputationWithoutCancellation.getNops() - statisticsWithCancellation.numCancelledQuantumOperations, this->annotatableQuantumComputation.getNops());
+
+    ASSERT_NO_FATAL_FAILURE(this->assertSimulationResultsForAllStatesOfParametersMatchReference(this->annotatableQuantumComputation, annotatableQuantumComputationWithoutCancellation, numQubitsOfParameters));
+}
+
+TYPED_TEST_P(BaseSimulationTestFixture, ReorderingOfQuantumOperationsToReduceDepthDoesNotChangeSimulationResult) {
+    constexpr std::string_view stringifiedCircuitToParseAndSynthesis = "module main(inout a(2), inout b(2), out c(2)) "
+                                                                       "for $i = 0 to 1 do c.$i ^= (a.$i & b.$i) rof; c += ((a + b) - (b & a))";
+    constexpr std::size_t numQubitsOfParameters = 6;
+
+    ASSERT_NO_FATAL_FAILURE(this->parseInputCircuitFromString(stringifiedCircuitToParseAndSynthesis, this->syrecProgramInstance));
+    auto synthesisSettingsWithReordering                                  = syrec::ConfigurableOptions();
+    synthesisSettingsWithReordering.reorderQuantumOperationsToReduceDepth = true;
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, this->annotatableQuantumComputation, synthesisSettingsWithReordering, nullptr));
+
+    auto annotatableQuantumComputationWithoutReordering                      = syrec::AnnotatableQuantumComputation();
+    auto synthesisSettingsWithoutReordering                                  = syrec::ConfigurableOptions();
+    synthesisSettingsWithoutReordering.reorderQuantumOperationsToReduceDepth = false;
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, annotatableQuantumComputationWithoutReordering, synthesisSettingsWithoutReordering, nullptr));
+
+    ASSERT_EQ(annotatableQuantumComputationWithoutReordering.getNqubits(), this->annotatableQuantumComputation.getNqubits());
+    ASSERT_EQ(annotatableQuantumComputationWithoutReordering.getNops(), this->annotatableQuantumComputation.getNops());
+    ASSERT_LE(this->annotatableQuantumComputation.analyzeDepth().depth, annotatableQuantumComputationWithoutReordering.analyzeDepth().depth);
+
+    ASSERT_NO_FATAL_FAILURE(this->assertSimulationResultsForAllStatesOfParametersMatchReference(this->annotatableQuantumComputation, annotatableQuantumComputationWithoutReordering, numQubitsOfParameters));
+}
+
+TYPED_TEST_P(BaseSimulationTestFixture, StreamingOfQuantumOperationsToSinkDoesNotChangeSimulationResult) {
+    constexpr std::string_view stringifiedCircuitToParseAndSynthesis = "module main(inout a(2), inout b(2), out c(2)) "
+                                                                       "for $i = 0 to 1 do c.$i ^= (a.$i & b.$i) rof; c += ((a + b) - (b & a))";
+    constexpr std::size_t numQubitsOfParameters = 6;
+
+    ASSERT_NO_FATAL_FAILURE(this->parseInputCircuitFromString(stringifiedCircuitToParseAndSynthesis, this->syrecProgramInstance));
+    auto synthesisSettings                            = syrec::ConfigurableOptions();
+    synthesisSettings.replaySynthesizedLoopIterations = true;
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, this->annotatableQuantumComputation, synthesisSettings, nullptr));
+
+    // Every simulated input state is stored in one lane of the bit-parallel simulation
+    std::vector<std::uint64_t> initialLaneValuesPerQubit(numQubitsOfParameters, 0U);
+    for (std::size_t stateOfParameters = 0; stateOfParameters < (1U << numQubitsOfParameters); ++stateOfParameters) {
+        for (std::size_t i = 0; i < numQubitsOfParameters; ++i) {
+            initialLaneValuesPerQubit[i] |= static_cast<std::uint64_t>((stateOfParameters >> i) & 1U) << stateOfParameters;
+        }
+    }
+
+    // A replay window of a single quantum operation forces the synthesis of the loop iterations without replaying the quantum operations of the first iteration
+    auto       annotatableQuantumComputationWithStreaming = syrec::AnnotatableQuantumComputation();
+    const auto batchSimulationSink                        = std::make_shared<syrec::BatchSimulationQuantumOperationSink>(initialLaneValuesPerQubit);
+    const auto synthesisCostSink                          = std::make_shared<syrec::SynthesisCostQuantumOperationSink>();
+    ASSERT_TRUE(annotatableQuantumComputationWithStreaming.streamQuantumOperationsToSink(batchSimulationSink, 1U));
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, annotatableQuantumComputationWithStreaming, synthesisSettings, nullptr));
+    ASSERT_FALSE(annotatableQuantumComputationWithStreaming.isStreamingOfQuantumOperationsActive());
+    ASSERT_EQ(0U, annotatableQuantumComputationWithStreaming.getNops());
+    ASSERT_EQ(this->annotatableQuantumComputation.getNqubits(), annotatableQuantumComputationWithStreaming.getNqubits());
+
+    const std::vector<std::uint64_t>& streamedLaneValuesPerQubit = batchSimulationSink->getLaneValuesPerQubit();
+    ASSERT_EQ(this->annotatableQuantumComputation.getNqubits(), streamedLaneValuesPerQubit.size());
+    const auto determineStreamedOutputState = [&streamedLaneValuesPerQubit](const std::size_t stateOfParameters, syrec::NBitValuesContainer& streamedOutputState) {
+        for (std::size_t i = 0; i < streamedLaneValuesPerQubit.size(); ++i) {
+            streamedOutputState.set(i, ((streamedLaneValuesPerQubit[i] >> stateOfParameters) & 1U) != 0U);
+        }
+    };
+    ASSERT_NO_FATAL_FAILURE(this->assertSimulationResultsForAllStatesOfParametersMatchExpectedOnes(this->annotatableQuantumComputation, numQubitsOfParameters, determineStreamedOutputState));
+
+    // Without forwarding any quantum operation prior to the completion of the synthesis, the streamed quantum operations match the ones of the quantum computation synthesized without streaming
+    auto annotatableQuantumComputationWithCostSink = syrec::AnnotatableQuantumComputation();
+    ASSERT_TRUE(annotatableQuantumComputationWithCostSink.streamQuantumOperationsToSink(synthesisCostSink, this->annotatableQuantumComputation.getNops()));
+    ASSERT_TRUE(this->performProgramSynthesis(this->syrecProgramInstance, annotatableQuantumComputationWithCostSink, synthesisSettings, nullptr));
+    ASSERT_EQ(this->annotatableQuantumComputation.getNops(), synthesisCostSink->getNumConsumedQuantumOperations());
+    ASSERT_EQ(this->annotatableQuantumComputation.getQuantumCostForSynthesis(), synthesisCostSink->getQuantumCostForSynthesis());
+    ASSERT_EQ(this->annotatableQuantumComputation.getTransistorCostForSynthesis(), synthesisCostSink->getTransistorCostForSynthesis());
+}
+
 REGISTER_TYPED_TEST_SUITE_P(BaseSimulationTestFixture,
                             OmittingUserDefinedMainModuleIdentifierInSynthesisSettingsChoosesModuleWithMainIdentiferAsMainModule,
                             OmittingUserDefinedMainModuleIdentifierInSynthesisSettingsChoosesLastDefinedModuleAsMainModuleIfNoModuleWithIdentifierMainExists,
@@ -295,7 +857,28 @@ REGISTER_TYPED_TEST_SUITE_P(BaseSimulationTestFixture,
                             SynthesisNotPossibleIfAnnotatableQuantumComputationAlreadyContainsOperations,
                             SynthesisOfEmptySyrecProgramNotPossible,
                             InvalidSynthesizerInstanceNotUsableToSynthesizeSyrecProgram,
-                            MismatchBetweenQuantumOperationAnnotationsFeatureInAnnotatableQuantumComputationAndSynthesizerNotAllowed);
+                            MismatchBetweenQuantumOperationAnnotationsFeatureInAnnotatableQuantumComputationAndSynthesizerNotAllowed,
+                            ReuseOfSynthesizedModuleCallsDoesNotChangeSynthesizedQuantumComputation,
+                            ReplayOfSynthesizedLoopIterationsDoesNotChangeSynthesizedQuantumComputation,
+                            ArenaAllocationOfIrNodesDoesNotChangeSynthesizedQuantumComputation,
+                            SharingOfSynthesizedCommonSubexpressionsDoesNotChangeSimulationResult,
+                            DecodingOfNonConstantIndicesUsingUnaryIterationDoesNotChangeSimulationResult,
+                            SharingOfIndexDecodingOfNonConstantIndicesDoesNotChangeSimulationResult,
+                            PaddingDimensionsOfUnrolledIndicesToPowersOfTwoDoesNotChangeSimulationResult,
+                            SelectedAdderArchitectureDoesNotChangeSimulationResult,
+                            SelectedMultiplierArchitectureDoesNotChangeSimulationResult,
+                            SpecializationOfOperationsWithConstantOperandDoesNotChangeSimulationResult,
+                            SynthesisOfShiftsByRelabelingQubitsDoesNotChangeSimulationResult,
+                            TrackingOfUnconditionalSwapsAsQubitPermutationDoesNotChangeSimulationResult,
+                            FoldingOfNegationsIntoNegativeControlsDoesNotChangeSimulationResult,
+                            SelectedDividerArchitectureAndSharingOfDividerDoNotChangeSimulationResult,
+                            SharingOfComparatorOfRelationalOperationsDoesNotChangeSimulationResult,
+                            ReuseOfAncillaryQubitsAcrossStatementsDoesNotChangeSimulationResult,
+                            DeferredUncomputationOfExpressionsDoesNotChangeSimulationResult,
+                            ReuseAndCombinationOfGuardsOfIfStatementsDoNotChangeSimulationResult,
+                            CancellationOfAdjacentSelfInverseQuantumOperationsDoesNotChangeSimulationResult,
+                            ReorderingOfQuantumOperationsToReduceDepthDoesNotChangeSimulationResult,
+                            StreamingOfQuantumOperationsToSinkDoesNotChangeSimulationResult);
 
 using SynthesizerTypes = testing::Types<syrec::CostAwareSynthesis, syrec::LineAwareSynthesis>;
 INSTANTIATE_TYPED_TEST_SUITE_P(SyrecSynthesisTest, BaseSimulationTestFixture, SynthesizerTypes, );
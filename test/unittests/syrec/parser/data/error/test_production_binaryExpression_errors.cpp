@@ -24,7 +24,7 @@ TEST_F(SyrecParserErrorTestsFixture, UsageOfUndeclaredVariableInBinaryExpression
 }
 
 TEST_F(SyrecParserErrorTestsFixture, UsageOfUnknownBinaryOperationInBinaryExpressionCausesError) {
-    recordSyntaxError(Message::Position(1, 39), "no viable alternative at input '(a <=>'");
+    recordSyntaxError(Message::Position(1, 39), "mismatched input '<=>' expecting {'+', '-', '*', '*>', '/', '%', '<<', '>>', '>=', '<=', '>', '<', '=', '!=', '&&', '||', '&', '|', '^'}");
     performTestExecution("module main(out b(4), in a(4)) b += (a <=> 2)");
 }
 
@@ -29,12 +29,14 @@ TEST_F(SyrecParserErrorTestsFixture, UsageOfUndeclaredVariableInRhsOperandOfShif
 }
 
 TEST_F(SyrecParserErrorTestsFixture, UsageOfInvalidShiftOperationCausesError) {
-    recordSyntaxError(Message::Position(1, 47), "no viable alternative at input '((b[0] <=>'");
+    recordSyntaxError(Message::Position(1, 47), "mismatched input '<=>' expecting {'+', '-', '*', '*>', '/', '%', '<<', '>>', '>=', '<=', '>', '<', '=', '!=', '&&', '||', '&', '|', '^'}");
     performTestExecution("module main(out a(4), out b[2](4)) a += ((b[0] <=> 2) + 2)");
 }
 
 TEST_F(SyrecParserErrorTestsFixture, OmittingLhsOperandOfShiftExpressionCausesError) {
-    recordSyntaxError(Message::Position(1, 42), "no viable alternative at input '((<<'");
+    recordSyntaxError(Message::Position(1, 42), "extraneous input '<<' expecting {'!', '~', '$', '#', '(', IDENT, HEX_LITERAL, BINARY_LITERAL, INT}");
+    recordSyntaxError(Message::Position(1, 47), "extraneous input ')' expecting {'+', '-', '*', '*>', '/', '%', '<<', '>>', '>=', '<=', '>', '<', '=', '!=', '&&', '||', '&', '|', '^'}");
+    recordSyntaxError(Message::Position(1, 53), "mismatched input '<EOF>' expecting {'+', '-', '*', '*>', '/', '%', '<<', '>>', '>=', '<=', '>', '<', '=', '!=', '&&', '||', '&', '|', '^'}");
     performTestExecution("module main(out a(4), out b[2](4)) a += ((<< #b) + 2)");
 }
 
@@ -44,7 +46,9 @@ TEST_F(SyrecParserErrorTestsFixture, OmittingRhsOperandOfShiftExpressionCausesEr
 }
 
 TEST_F(SyrecParserErrorTestsFixture, NonNumericExpressionInRhsOperandOfShiftExpressionCausesError) {
-    recordSyntaxError(Message::Position(1, 51), "no viable alternative at input '((b[0] << (b'");
+    recordSyntaxError(Message::Position(1, 51), "mismatched input 'b' expecting {'$', '#', '(', HEX_LITERAL, BINARY_LITERAL, INT}");
+    recordSyntaxError(Message::Position(1, 61), "missing ')' at '+'");
+    recordSyntaxError(Message::Position(1, 65), "extraneous input ')' expecting {<EOF>, 'module'}");
     performTestExecution("module main(out a(4), out b[2](4)) a += ((b[0] << (b[1] - 2) + 2))");
 }
 
@@ -50,17 +50,19 @@ TEST_F(SyrecParserErrorTestsFixture, MissingOpeningBracketInUnaryExpressionWhenU
 }
 
 TEST_F(SyrecParserErrorTestsFixture, InvalidOpeningBracketInUnaryExpressionWhenUsingBitwiseNegationCausesError) {
-    recordSyntaxError(Message::Position(1, 38), "no viable alternative at input '(~['");
+    recordSyntaxError(Message::Position(1, 38), "extraneous input '[' expecting {'!', '~', '$', '#', '(', IDENT, HEX_LITERAL, BINARY_LITERAL, INT}");
+    buildAndRecordExpectedSemanticError<SemanticError::ExpressionBitwidthMismatches>(Message::Position(1, 36), 1, 2);
+    recordSyntaxError(Message::Position(1, 46), "mismatched input '>' expecting 'then'");
     performTestExecution("module main(inout a(2), in b(2)) if (~[a + b) > 1) then ++= a else --= a fi (~(a + b) > 1)");
 }
 
 TEST_F(SyrecParserErrorTestsFixture, MissingClosingBracketInUnaryExpressionWhenUsingBitwiseNegationCausesError) {
-    recordSyntaxError(Message::Position(1, 45), "no viable alternative at input '(~(a + b >'");
+    recordSyntaxError(Message::Position(1, 45), "missing ')' at '>'");
     performTestExecution("module main(inout a(2), in b(2)) if (~(a + b > 1) then ++= a else --= a fi (~(a + b) > 1)");
 }
 
 TEST_F(SyrecParserErrorTestsFixture, InvalidClosingBracketInUnaryExpressionWhenUsingBitwiseNegationCausesError) {
-    recordSyntaxError(Message::Position(1, 44), "no viable alternative at input '(~(a + b]'");
+    recordSyntaxError(Message::Position(1, 44), "mismatched input ']' expecting ')'");
     performTestExecution("module main(inout a(2), in b(2)) if (~(a + b] > 1) then ++= a else --= a fi (~(a + b) > 1)");
 }
 
@@ -1240,3 +1240,28 @@ TEST(BaseSymbolTableTests, FetchModulesUsingCallerSignatureWithNoExistingModules
     ASSERT_NO_FATAL_FAILURE(modulesMatchingSignature = symbolTable.getModulesMatchingSignature("moduleName", {callerArgument}));
     ASSERT_NO_FATAL_FAILURE(assertModuleMatchingSignatureMatchesExpectedOne(createModuleOverloadResolutionResultForNoMatch(), modulesMatchingSignature));
 }
+
+TEST(BaseSymbolTableTests, FetchModulesUsingCallerSignatureSelectsOverloadMatchingStructureOfCallerArguments) {
+    BaseSymbolTable symbolTable;
+
+    const auto firstModule = std::make_shared<syrec::Module>("moduleOne");
+    firstModule->parameters.emplace_back(std::make_shared<syrec::Variable>(syrec::Variable::Type::Inout, "mOneParamOne", DEFAULT_SIGNAL_DIMENSIONS, DEFAULT_BITWIDTH));
+    ASSERT_NO_FATAL_FAILURE(assertModuleInsertionCompletesSuccessfully(symbolTable, firstModule));
+
+    const auto secondModule = std::make_shared<syrec::Module>(firstModule->name);
+    secondModule->parameters.emplace_back(std::make_shared<syrec::Variable>(syrec::Variable::Type::Inout, "mTwoParamOne", DEFAULT_SIGNAL_DIMENSIONS, DEFAULT_BITWIDTH + 1));
+    ASSERT_NO_FATAL_FAILURE(assertModuleInsertionCompletesSuccessfully(symbolTable, secondModule));
+
+    // Repeated calls using different caller arguments with the same structure and type resolve to the same module
+    for (const auto* callerArgumentIdentifier: {"callerArgOne", "callerArgTwo"}) {
+        const auto callerArgument           = std::make_shared<syrec::Variable>(syrec::Variable::Type::Wire, callerArgumentIdentifier, DEFAULT_SIGNAL_DIMENSIONS, DEFAULT_BITWIDTH + 1);
+        auto       modulesMatchingSignature = BaseSymbolTable::ModuleOverloadResolutionResult(BaseSymbolTable::ModuleOverloadResolutionResult::NoMatchFound, std::nullopt);
+        ASSERT_NO_FATAL_FAILURE(modulesMatchingSignature = symbolTable.getModulesMatchingSignature(firstModule->name, {callerArgument}));
+        ASSERT_NO_FATAL_FAILURE(assertModuleMatchingSignatureMatchesExpectedOne(createModuleOverloadResolutionResultForSingleMatch(secondModule), modulesMatchingSignature));
+    }
+
+    const auto callerArgumentOfNotAssignableType = std::make_shared<syrec::Variable>(syrec::Variable::Type::In, "callerArgThree", DEFAULT_SIGNAL_DIMENSIONS, DEFAULT_BITWIDTH);
+    auto       modulesMatchingSignature          = BaseSymbolTable::ModuleOverloadResolutionResult(BaseSymbolTable::ModuleOverloadResolutionResult::NoMatchFound, std::nullopt);
+    ASSERT_NO_FATAL_FAILURE(modulesMatchingSignature = symbolTable.getModulesMatchingSignature(firstModule->name, {callerArgumentOfNotAssignableType}));
+    ASSERT_NO_FATAL_FAILURE(assertModuleMatchingSignatureMatchesExpectedOne(createModuleOverloadResolutionResultForNoMatch(), modulesMatchingSignature));
+}
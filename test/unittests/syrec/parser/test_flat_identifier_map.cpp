@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/syrec/parser/utils/symbolTable/base_symbol_table.hpp"
+#include "core/syrec/parser/utils/symbolTable/flat_identifier_map.hpp"
+#include "core/syrec/parser/utils/symbolTable/temporary_variable_scope.hpp"
+#include "core/syrec/variable.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace utils;
+
+TEST(FlatIdentifierMapTests, InsertionOfExistingIdentifierDoesNotOverwriteValue) {
+    FlatIdentifierMap<unsigned> map;
+    ASSERT_TRUE(map.tryEmplace("a", 1U).second);
+    const auto [existingValue, wasInserted] = map.tryEmplace("a", 2U);
+    ASSERT_FALSE(wasInserted);
+    ASSERT_EQ(1U, *existingValue);
+    ASSERT_EQ(1U, map.size());
+    ASSERT_EQ(nullptr, map.find("b"));
+}
+
+TEST(FlatIdentifierMapTests, LookupsMatchOrderedMapAfterInterleavedInsertionsAndErasures) {
+    FlatIdentifierMap<std::size_t>     map;
+    std::map<std::string, std::size_t> expectedMap;
+    for (std::size_t i = 0; i < 2000; ++i) {
+        const std::string identifier = "var_" + std::to_string((i * 7919U) % 509U);
+        if (i % 3U == 2U) {
+            ASSERT_EQ(expectedMap.erase(identifier) != 0U, map.erase(identifier)) << "Identifier: " << identifier;
+        } else {
+            ASSERT_EQ(expectedMap.emplace(identifier, i).second, map.tryEmplace(identifier, i).second) << "Identifier: " << identifier;
+        }
+        ASSERT_EQ(expectedMap.size(), map.size());
+    }
+
+    for (std::size_t i = 0; i < 509U; ++i) {
+        const std::string identifier    = "var_" + std::to_string(i);
+        const auto        expectedEntry = expectedMap.find(identifier);
+        const auto*       actualValue   = map.find(identifier);
+        if (expectedEntry == expectedMap.end()) {
+            ASSERT_EQ(nullptr, actualValue) << "Identifier: " << identifier;
+        } else {
+            ASSERT_NE(nullptr, actualValue) << "Identifier: " << identifier;
+            ASSERT_EQ(expectedEntry->second, *actualValue);
+        }
+    }
+
+    std::size_t numIteratedEntries = 0;
+    for (const auto& [identifier, hash, value]: map) {
+        ASSERT_EQ(expectedMap.at(identifier), value);
+        ++numIteratedEntries;
+    }
+    ASSERT_EQ(expectedMap.size(), numIteratedEntries);
+
+    map.clear();
+    ASSERT_TRUE(map.empty());
+    ASSERT_FALSE(map.contains("var_0"));
+}
+
+TEST(FlatIdentifierMapTests, ReusedTemporaryScopeDoesNotContainVariablesOfClosedScope) {
+    BaseSymbolTable symbolTable;
+    ASSERT_TRUE(symbolTable.openTemporaryScope()->recordVariable(std::make_shared<syrec::Variable>(syrec::Variable::Type::In, "a", std::vector<unsigned>{1U}, 4U)));
+    symbolTable.closeTemporaryScope();
+    ASSERT_FALSE(symbolTable.openTemporaryScope()->existsVariableForName("a"));
+
+    // A closed scope still referenced by the caller is not reused
+    const TemporaryVariableScope::ptr referencedScope = *symbolTable.getActiveTemporaryScope();
+    ASSERT_TRUE(referencedScope->recordVariable(std::make_shared<syrec::Variable>(syrec::Variable::Type::In, "b", std::vector<unsigned>{1U}, 4U)));
+    symbolTable.closeTemporaryScope();
+    ASSERT_NE(referencedScope, symbolTable.openTemporaryScope());
+    ASSERT_TRUE(referencedScope->existsVariableForName("b"));
+}
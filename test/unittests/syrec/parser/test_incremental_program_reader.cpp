@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/syrec/incremental_program_reader.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/program_serialization.hpp"
+#include "core/syrec/statement.hpp"
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <optional>
+#include <string>
+
+using namespace syrec;
+
+namespace {
+    constexpr auto CALLEE_MODULES = "module add(in a(4), in b(4), out c(4))\n"
+                                    "  c ^= (a + b)\n"
+                                    "module inc(inout a(4))\n"
+                                    "  ++= a\n";
+    constexpr auto MAIN_MODULE    = "module main(in a(4), in b(4), out c(4), inout d(4))\n"
+                                    "  call add(a, b, c);\n"
+                                    "  call inc(d)";
+
+    void assertProgramMatchesFullParse(const std::string& stringifiedProgram, const Program& actualProgram) {
+        Program expectedProgram;
+        ASSERT_EQ("", expectedProgram.readFromString(stringifiedProgram));
+        const std::optional<std::string> expectedSerializedProgram = serializeProgram(expectedProgram);
+        ASSERT_TRUE(expectedSerializedProgram.has_value());
+        ASSERT_EQ(expectedSerializedProgram, serializeProgram(actualProgram));
+    }
+
+    [[nodiscard]] Module::ptr getCallTargetOfStatement(const Module& module, const std::size_t statementIndex) {
+        const auto* callStatement = dynamic_cast<const CallStatement*>(module.statements.at(statementIndex).get());
+        return callStatement != nullptr ? callStatement->target : nullptr;
+    }
+} // namespace
+
+TEST(IncrementalProgramReaderTests, OnlyChangedModuleIsReparsed) {
+    IncrementalProgramReader reader;
+    Program                  program;
+    ASSERT_EQ("", reader.readFromString(program, std::string(CALLEE_MODULES) + MAIN_MODULE));
+    ASSERT_FALSE(reader.wasLastReadIncremental());
+    ASSERT_EQ(3U, reader.getNumParsedModulesOfLastRead());
+    const Module::ptr unchangedModule = program.modules().front();
+    const Module::ptr changedModule   = program.modules().at(1);
+
+    const std::string changedProgram = "module add(in a(4), in b(4), out c(4))\n"
+                                       "  c ^= (a + b)\n"
+                                       "module inc(inout a(4))\n"
+                                       "  ++= a;\n"
+                                       "  // Increment twice\n"
+                                       "  ++= a\n" +
+                                       std::string(MAIN_MODULE);
+    ASSERT_EQ("", reader.readFromString(program, changedProgram));
+    ASSERT_TRUE(reader.wasLastReadIncremental());
+    ASSERT_EQ(1U, reader.getNumParsedModulesOfLastRead());
+    ASSERT_EQ(unchangedModule, program.modules().front());
+    ASSERT_NE(changedModule, program.modules().at(1));
+
+    // The unchanged caller of the re-parsed module calls its new version with the line numbers of its statements being updated.
+    ASSERT_EQ(program.modules().at(1), getCallTargetOfStatement(*program.modules().back(), 1));
+    ASSERT_NO_FATAL_FAILURE(assertProgramMatchesFullParse(changedProgram, program));
+}
+
+TEST(IncrementalProgramReaderTests, InsertedAndRemovedModulesMatchFullParse) {
+    IncrementalProgramReader reader;
+    Program                  program;
+    ASSERT_EQ("", reader.readFromString(program, std::string(CALLEE_MODULES) + MAIN_MODULE));
+
+    const std::string programWithInsertedModule = std::string(CALLEE_MODULES) + "module dec(inout a(4))\n  --= a\n" + MAIN_MODULE;
+    ASSERT_EQ("", reader.readFromString(program, programWithInsertedModule));
+    ASSERT_TRUE(reader.wasLastReadIncremental());
+    ASSERT_EQ(1U, reader.getNumParsedModulesOfLastRead());
+    ASSERT_NO_FATAL_FAILURE(assertProgramMatchesFullParse(programWithInsertedModule, program));
+
+    const std::string programWithRemovedModule = "module inc(inout a(4))\n  ++= a\nmodule dec(inout a(4))\n  --= a\nmodule main(inout d(4))\n  call inc(d)";
+    ASSERT_EQ("", reader.readFromString(program, programWithRemovedModule));
+    ASSERT_NO_FATAL_FAILURE(assertProgramMatchesFullParse(programWithRemovedModule, program));
+}
+
+TEST(IncrementalProgramReaderTests, ErrorsInUnchangedCallersOfChangedModuleMatchFullParse) {
+    IncrementalProgramReader reader;
+    Program                  program;
+    ASSERT_EQ("", reader.readFromString(program, std::string(CALLEE_MODULES) + MAIN_MODULE));
+
+    // The call of the unchanged module 'main' does no longer match the signature of the changed module 'inc'
+    const std::string programWithInvalidCall = "module add(in a(4), in b(4), out c(4))\n"
+                                               "  c ^= (a + b)\n"
+                                               "module inc(inout a(4), inout b(4))\n"
+                                               "  a <=> b\n" +
+                                               std::string(MAIN_MODULE);
+    Program           expectedProgram;
+    const std::string expectedErrors = expectedProgram.readFromString(programWithInvalidCall);
+    ASSERT_FALSE(expectedErrors.empty());
+    ASSERT_EQ(expectedErrors, reader.readFromString(program, programWithInvalidCall));
+    ASSERT_FALSE(reader.wasLastReadIncremental());
+
+    // The revision following one containing errors is fully parsed
+    ASSERT_EQ("", reader.readFromString(program, std::string(CALLEE_MODULES) + MAIN_MODULE));
+    ASSERT_FALSE(reader.wasLastReadIncremental());
+    ASSERT_NO_FATAL_FAILURE(assertProgramMatchesFullParse(std::string(CALLEE_MODULES) + MAIN_MODULE, program));
+}
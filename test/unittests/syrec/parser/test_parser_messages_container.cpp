@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/syrec/parser/utils/custom_error_messages.hpp"
+#include "core/syrec/parser/utils/parser_messages_container.hpp"
+
+#include <cstddef>
+#include <format>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace syrec_parser;
+
+namespace {
+    [[nodiscard]] std::unique_ptr<Message> buildOutOfRangeIndexError(const std::size_t line, const std::size_t column, const unsigned accessedIndex) {
+        return std::make_unique<Message>(Message::Type::Error, std::string(getIdentifierForSemanticError<SemanticError::IndexOfAccessedValueForDimensionOutOfRange>()), Message::Position(line, column),
+                                         getFormatForSemanticErrorMessage<SemanticError::IndexOfAccessedValueForDimensionOutOfRange>(),
+                                         std::vector<Message::Argument>{Message::makeArgument(accessedIndex), Message::makeArgument(0), Message::makeArgument(std::size_t{2})});
+    }
+} // namespace
+
+TEST(ParserMessagesContainerTests, LazilyFormattedMessageMatchesEagerlyFormattedOne) {
+    const auto lazilyFormattedMessage = buildOutOfRangeIndexError(1, 2, 4U);
+    ASSERT_EQ(std::format(getFormatForSemanticErrorMessage<SemanticError::IndexOfAccessedValueForDimensionOutOfRange>(), 4U, 0, std::size_t{2}), lazilyFormattedMessage->getMessage());
+
+    const Message lazilyFormattedStringMessage(Message::Type::Error, "ID", Message::Position(1, 2), getFormatForSemanticErrorMessage<SemanticError::ReservedIdentifierPrefixUsed>(), {Message::makeArgument("__a"), Message::makeArgument(std::string("__"))});
+    ASSERT_EQ(std::format(getFormatForSemanticErrorMessage<SemanticError::ReservedIdentifierPrefixUsed>(), "__a", "__"), lazilyFormattedStringMessage.getMessage());
+}
+
+TEST(ParserMessagesContainerTests, DuplicateMessagesAreOnlyRecordedOnce) {
+    ParserMessagesContainer messagesContainer;
+    for (int i = 0; i < 1000; ++i) {
+        messagesContainer.recordMessage(buildOutOfRangeIndexError(3, 4, 5U));
+    }
+    // Messages differing in their position or arguments are not duplicates
+    messagesContainer.recordMessage(buildOutOfRangeIndexError(3, 5, 5U));
+    messagesContainer.recordMessage(buildOutOfRangeIndexError(3, 4, 6U));
+    messagesContainer.recordMessage(std::make_unique<Message>(Message::Type::Error, "SYNTAX", Message::Position(3, 4), "syntax error"));
+    messagesContainer.recordMessage(std::make_unique<Message>(Message::Type::Error, "SYNTAX", Message::Position(3, 4), "syntax error"));
+    ASSERT_EQ(4U, messagesContainer.getMessagesOfType(Message::Type::Error).size());
+    ASSERT_EQ(0U, messagesContainer.getNumNotRecordedErrors());
+}
+
+TEST(ParserMessagesContainerTests, ErrorsExceedingLimitAreOnlyCounted) {
+    ParserMessagesContainer messagesContainer(2U);
+    for (unsigned i = 0; i < 5U; ++i) {
+        messagesContainer.recordMessage(buildOutOfRangeIndexError(i + 1, 0, i));
+        messagesContainer.recordMessage(buildOutOfRangeIndexError(1, 0, 0U));
+    }
+    ASSERT_EQ(2U, messagesContainer.getMessagesOfType(Message::Type::Error).size());
+    ASSERT_EQ(3U, messagesContainer.getNumNotRecordedErrors());
+}
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/configurable_options.hpp"
+#include "core/statistics.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/program_cache.hpp"
+#include "core/syrec/program_serialization.hpp"
+
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <optional>
+#include <string>
+
+using namespace syrec;
+
+namespace {
+    constexpr auto PATH_TO_SYREC_CIRCUITS = "./circuits";
+
+    class ProgramCacheTestFixture: public testing::Test {
+    protected:
+        std::filesystem::path onDiskCacheDirectory = std::filesystem::temp_directory_path() / "mqt_syrec_program_cache_tests";
+
+        void SetUp() override {
+            std::filesystem::remove_all(onDiskCacheDirectory);
+        }
+
+        void TearDown() override {
+            std::filesystem::remove_all(onDiskCacheDirectory);
+        }
+
+        static void assertProgramsAreEqual(const Program& expectedProgram, const Program& actualProgram) {
+            const std::optional<std::string> expectedSerializedProgram = serializeProgram(expectedProgram);
+            ASSERT_TRUE(expectedSerializedProgram.has_value());
+            ASSERT_EQ(expectedSerializedProgram, serializeProgram(actualProgram));
+        }
+    };
+} // namespace
+
+TEST_F(ProgramCacheTestFixture, RepeatedlyReadProgramIsLoadedFromCache) {
+    const std::string pathToFile = PATH_TO_SYREC_CIRCUITS + std::string("/call_8.src");
+
+    Program expectedProgram;
+    ASSERT_EQ("", expectedProgram.read(pathToFile));
+
+    ProgramCache cache;
+    Program      firstProgram;
+    ASSERT_EQ("", cache.read(firstProgram, pathToFile));
+    ASSERT_EQ(0U, cache.getNumCacheHits());
+    ASSERT_EQ(1U, cache.getNumCacheMisses());
+
+    Statistics statistics;
+    Program    secondProgram;
+    ASSERT_EQ("", cache.read(secondProgram, pathToFile, ConfigurableOptions{}, &statistics));
+    ASSERT_EQ(1U, cache.getNumCacheHits());
+    ASSERT_EQ(1U, cache.getNumCacheMisses());
+    ASSERT_EQ(0U, statistics.parsingRuntimeInNanoseconds);
+    ASSERT_EQ(0U, statistics.semanticCheckRuntimeInNanoseconds);
+
+    ASSERT_NO_FATAL_FAILURE(assertProgramsAreEqual(expectedProgram, firstProgram));
+    ASSERT_NO_FATAL_FAILURE(assertProgramsAreEqual(expectedProgram, secondProgram));
+    // Every program read from the cache owns its own IR
+    ASSERT_NE(firstProgram.modules().front(), secondProgram.modules().front());
+}
+
+TEST_F(ProgramCacheTestFixture, ProgramIsParsedAgainForDifferentParserRelevantOptions) {
+    constexpr auto stringifiedProgram = "module main(inout a, out b(4)) ++= a";
+
+    ProgramCache cache;
+    Program      programWithDefaultBitwidth;
+    ASSERT_EQ("", cache.readFromString(programWithDefaultBitwidth, stringifiedProgram));
+
+    ConfigurableOptions settings;
+    settings.defaultBitwidth = 8U;
+    Program programWithCustomBitwidth;
+    ASSERT_EQ("", cache.readFromString(programWithCustomBitwidth, stringifiedProgram, settings));
+    ASSERT_EQ(0U, cache.getNumCacheHits());
+    ASSERT_EQ(2U, cache.getNumCacheMisses());
+    ASSERT_EQ(8U, programWithCustomBitwidth.modules().front()->parameters.front()->bitwidth);
+
+    // Options only relevant for the synthesis do not influence the cached result of the parser
+    settings.generateQuantumOperationAnnotations = !settings.generateQuantumOperationAnnotations;
+    Program programWithCustomSynthesisOptions;
+    ASSERT_EQ("", cache.readFromString(programWithCustomSynthesisOptions, stringifiedProgram, settings));
+    ASSERT_EQ(1U, cache.getNumCacheHits());
+    ASSERT_EQ(8U, programWithCustomSynthesisOptions.modules().front()->parameters.front()->bitwidth);
+}
+
+TEST_F(ProgramCacheTestFixture, ErrorsOfParserAreCached) {
+    constexpr auto stringifiedProgram = "module main(inout a(4)) ++= b";
+
+    Program     expectedProgram;
+    std::string expectedErrors = expectedProgram.readFromString(stringifiedProgram);
+    ASSERT_FALSE(expectedErrors.empty());
+
+    ProgramCache cache;
+    for (int i = 0; i < 2; ++i) {
+        Program program;
+        ASSERT_EQ(expectedErrors, cache.readFromString(program, stringifiedProgram));
+        ASSERT_TRUE(program.modules().empty());
+    }
+    ASSERT_EQ(1U, cache.getNumCacheHits());
+}
+
+TEST_F(ProgramCacheTestFixture, LeastRecentlyUsedProgramIsEvicted) {
+    ProgramCache cache(2U);
+    Program      program;
+    ASSERT_EQ("", cache.readFromString(program, "module first(inout a(4)) ++= a"));
+    ASSERT_EQ("", cache.readFromString(program, "module second(inout a(4)) ++= a"));
+    ASSERT_EQ("", cache.readFromString(program, "module first(inout a(4)) ++= a"));
+    ASSERT_EQ("", cache.readFromString(program, "module third(inout a(4)) ++= a"));
+    ASSERT_EQ(2U, cache.getNumCachedPrograms());
+    ASSERT_EQ(1U, cache.getNumCacheHits());
+
+    ASSERT_EQ("", cache.readFromString(program, "module first(inout a(4)) ++= a"));
+    ASSERT_EQ(2U, cache.getNumCacheHits());
+    ASSERT_EQ("", cache.readFromString(program, "module second(inout a(4)) ++= a"));
+    ASSERT_EQ(2U, cache.getNumCacheHits());
+    ASSERT_EQ(4U, cache.getNumCacheMisses());
+}
+
+TEST_F(ProgramCacheTestFixture, ProgramIsLoadedFromOnDiskCacheOfOtherCache) {
+    const std::string pathToFile = PATH_TO_SYREC_CIRCUITS + std::string("/for_4.src");
+
+    Program expectedProgram;
+    ASSERT_EQ("", expectedProgram.read(pathToFile));
+    {
+        ProgramCache cache(ProgramCache::DEFAULT_MAX_NUM_CACHED_PROGRAMS, onDiskCacheDirectory.string());
+        Program      program;
+        ASSERT_EQ("", cache.read(program, pathToFile));
+        ASSERT_EQ(1U, cache.getNumCacheMisses());
+    }
+
+    ProgramCache cache(ProgramCache::DEFAULT_MAX_NUM_CACHED_PROGRAMS, onDiskCacheDirectory.string());
+    Program      program;
+    ASSERT_EQ("", cache.read(program, pathToFile));
+    ASSERT_EQ(1U, cache.getNumCacheHits());
+    ASSERT_EQ(0U, cache.getNumCacheMisses());
+    ASSERT_NO_FATAL_FAILURE(assertProgramsAreEqual(expectedProgram, program));
+}
@@ -0,0 +1,324 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/configurable_options.hpp"
+#include "core/syrec/parser/utils/ascii_char_stream_view.hpp"
+#include "core/syrec/parser/utils/memory_mapped_file.hpp"
+#include "core/syrec/parser/utils/parser_messages_container.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/statement.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <ios>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    constexpr auto PATH_TO_SYREC_CIRCUITS = "./circuits";
+
+    [[nodiscard]] std::string readFileContent(const std::string& filename) {
+        std::ifstream inputFileStream(filename, std::ifstream::in | std::ifstream::binary);
+        return {std::istreambuf_iterator<char>(inputFileStream), std::istreambuf_iterator<char>()};
+    }
+
+    void assertStatementsAreEquivalent(const Statement::vec& expectedStatements, const Statement::vec& actualStatements) {
+        ASSERT_EQ(expectedStatements.size(), actualStatements.size());
+        for (std::size_t i = 0; i < expectedStatements.size(); ++i) {
+            ASSERT_EQ(expectedStatements[i]->lineNumber, actualStatements[i]->lineNumber);
+            ASSERT_EQ(expectedStatements[i]->getKind(), actualStatements[i]->getKind());
+            if (const auto* expectedCallStatement = statementCast<CallStatement>(expectedStatements[i].get()); expectedCallStatement != nullptr) {
+                const auto* actualCallStatement = statementCast<CallStatement>(actualStatements[i].get());
+                ASSERT_EQ(expectedCallStatement->target->name, actualCallStatement->target->name);
+                ASSERT_EQ(expectedCallStatement->target->parameters.size(), actualCallStatement->target->parameters.size());
+                ASSERT_EQ(expectedCallStatement->parameters, actualCallStatement->parameters);
+            } else if (const auto* expectedForStatement = statementCast<ForStatement>(expectedStatements[i].get()); expectedForStatement != nullptr) {
+                assertStatementsAreEquivalent(expectedForStatement->statements, statementCast<ForStatement>(actualStatements[i].get())->statements);
+            } else if (const auto* expectedIfStatement = statementCast<IfStatement>(expectedStatements[i].get()); expectedIfStatement != nullptr) {
+                const auto* actualIfStatement = statementCast<IfStatement>(actualStatements[i].get());
+                assertStatementsAreEquivalent(expectedIfStatement->thenStatements, actualIfStatement->thenStatements);
+                assertStatementsAreEquivalent(expectedIfStatement->elseStatements, actualIfStatement->elseStatements);
+            }
+        }
+    }
+} // namespace
+
+TEST(MemoryMappedFileTests, ContentOfMappedFileMatchesFileContent) {
+    const std::string filename = PATH_TO_SYREC_CIRCUITS + std::string("/alu_2.src");
+
+    const std::optional<syrec_parser::MemoryMappedFile> memoryMappedFile = syrec_parser::MemoryMappedFile::open(filename);
+    ASSERT_TRUE(memoryMappedFile.has_value());
+    ASSERT_TRUE(memoryMappedFile->isMappedIntoMemory());
+    ASSERT_EQ(readFileContent(filename), memoryMappedFile->getContent());
+}
+
+TEST(MemoryMappedFileTests, MappingEmptyFileProvidesEmptyContent) {
+    const std::filesystem::path pathToEmptyFile = std::filesystem::temp_directory_path() / "mqt_syrec_memory_mapped_empty_file.src";
+    std::ofstream(pathToEmptyFile, std::ofstream::out | std::ofstream::trunc).close();
+
+    const std::optional<syrec_parser::MemoryMappedFile> memoryMappedFile = syrec_parser::MemoryMappedFile::open(pathToEmptyFile.string());
+    std::filesystem::remove(pathToEmptyFile);
+    ASSERT_TRUE(memoryMappedFile.has_value());
+    ASSERT_TRUE(memoryMappedFile->getContent().empty());
+}
+
+TEST(MemoryMappedFileTests, MappingNotExistingFileCausesError) {
+    const std::string filename = PATH_TO_SYREC_CIRCUITS + std::string("/notExistingCircuit.src");
+
+    std::string foundErrors;
+    ASSERT_FALSE(syrec_parser::MemoryMappedFile::open(filename, &foundErrors).has_value());
+    ASSERT_EQ("Cannot open given circuit file @ " + filename, foundErrors);
+}
+
+TEST(AsciiCharStreamViewTests, OnlyTextsConsistingOfAsciiCharactersAreDetected) {
+    ASSERT_TRUE(syrec_parser::AsciiCharStreamView::isAsciiText(""));
+    ASSERT_TRUE(syrec_parser::AsciiCharStreamView::isAsciiText("module main(inout a(4)) ++= a"));
+    ASSERT_FALSE(syrec_parser::AsciiCharStreamView::isAsciiText("// \xC3\xBC\nmodule main(inout a(4)) ++= a"));
+}
+
+TEST(ProgramReaderTests, ReadingMultipleProgramsWithSameReaderMatchesReadingWithSeparateProgramInstances) {
+    const std::vector<std::string> filenames = {"alu_2.src", "call_8.src", "for_4.src", "modulo_2.src"};
+
+    ProgramReader reader;
+    for (const std::string& filename: filenames) {
+        const std::string pathToFile = PATH_TO_SYREC_CIRCUITS + std::string("/") + filename;
+
+        Program expectedProgram;
+        ASSERT_EQ("", expectedProgram.read(pathToFile)) << "Failed to read program " << filename;
+
+        Program actualProgram;
+        ASSERT_EQ("", reader.read(actualProgram, pathToFile)) << "Failed to read program " << filename << " with reused reader";
+        ASSERT_EQ(expectedProgram.modules().size(), actualProgram.modules().size());
+        for (std::size_t i = 0; i < expectedProgram.modules().size(); ++i) {
+            ASSERT_EQ(expectedProgram.modules()[i]->name, actualProgram.modules()[i]->name);
+            ASSERT_EQ(expectedProgram.modules()[i]->parameters.size(), actualProgram.modules()[i]->parameters.size());
+            ASSERT_EQ(expectedProgram.modules()[i]->statements.size(), actualProgram.modules()[i]->statements.size());
+        }
+    }
+}
+
+TEST(ProgramReaderTests, ErrorsOfProgramDoNotAffectNextProgramReadBySameReader) {
+    ProgramReader reader;
+
+    Program programWithErrors;
+    ASSERT_FALSE(reader.readFromString(programWithErrors, "module main(inout a(4)) ++= b").empty());
+
+    Program programWithoutErrors;
+    ASSERT_EQ("", reader.readFromString(programWithoutErrors, "module main(inout a(4)) ++= a"));
+    ASSERT_EQ(1U, programWithoutErrors.modules().size());
+}
+
+TEST(ProgramReaderTests, ReadingNonAsciiProgramMatchesReadingAsciiProgram) {
+    ProgramReader reader;
+
+    Program asciiProgram;
+    ASSERT_EQ("", reader.readFromString(asciiProgram, "// comment\nmodule main(inout a(4)) ++= a"));
+
+    Program nonAsciiProgram;
+    ASSERT_EQ("", reader.readFromString(nonAsciiProgram, "// \xC3\xBC\nmodule main(inout a(4)) ++= a"));
+    ASSERT_EQ(asciiProgram.modules().size(), nonAsciiProgram.modules().size());
+
+    // Both error messages reference the same position since the non-ASCII character is located in the comment of the otherwise identical first line.
+    Program asciiProgramWithErrors;
+    Program nonAsciiProgramWithErrors;
+    ASSERT_EQ(reader.readFromString(asciiProgramWithErrors, "// c\nmodule main(inout a(4)) ++= b"), reader.readFromString(nonAsciiProgramWithErrors, "// \xC3\xBC\nmodule main(inout a(4)) ++= b"));
+}
+
+TEST(ProgramReaderTests, WarmingUpPredictionCachesDoesNotAffectParsedPrograms) {
+    ASSERT_NO_THROW(ProgramReader::warmUpPredictionCaches());
+
+    ProgramReader reader;
+    Program       program;
+    ASSERT_EQ("", reader.read(program, PATH_TO_SYREC_CIRCUITS + std::string("/call_8.src")));
+    ASSERT_EQ(2U, program.modules().size());
+
+    const std::string expectedError = syrec_parser::Message(syrec_parser::Message::Type::Error, "SYNTAX", syrec_parser::Message::Position(1, 0), "mismatched input '<EOF>' expecting 'module'").stringify();
+    ASSERT_EQ(expectedError, reader.readFromString(program, ""));
+}
+
+TEST(ProgramReaderTests, ErrorsExceedingConfiguredLimitAreOnlyCounted) {
+    constexpr auto stringifiedProgram = "module main(inout a(4)) ++= b; ++= c; ++= d";
+
+    ProgramReader     reader;
+    Program           program;
+    const std::string allErrors  = reader.readFromString(program, stringifiedProgram);
+    const std::string firstError = allErrors.substr(0, allErrors.find_first_of("\r\n"));
+    ASSERT_NE(allErrors, firstError);
+
+    ConfigurableOptions settings;
+    settings.optionalMaxNumReportedParserErrors = 1U;
+    const std::string limitedErrors             = reader.readFromString(program, stringifiedProgram, settings);
+    ASSERT_TRUE(limitedErrors.starts_with(firstError));
+    ASSERT_TRUE(limitedErrors.ends_with("-- 2 further errors were not reported")) << limitedErrors;
+    ASSERT_EQ(firstError.size(), limitedErrors.find_first_of("\r\n"));
+}
+
+TEST(ProgramReaderTests, ConcurrentlyParsedModuleDeclarationsMatchSequentiallyParsedOnes) {
+    constexpr auto stringifiedProgram = "// first module\nmodule add(inout x(4), in y(4))\n  x += y\n"
+                                        "module add(inout x(4), in y(2))\n  x.0:1 += y\n"
+                                        "module swap(inout x(4), inout y(4))\n  x <=> y\n"
+                                        "module main(inout a(4), in b(4), in c(2)) wire d(4)\n  call add(a, b);\n  for $i = 0 to 1 do\n    call add(d, c)\n  rof;\n  uncall swap(a, d)";
+
+    ConfigurableOptions settings;
+    settings.parseModuleDeclarationsConcurrently = true;
+    settings.maxNumThreads                       = 2U;
+
+    ProgramReader reader;
+    Program       expectedProgram;
+    ASSERT_EQ("", reader.readFromString(expectedProgram, stringifiedProgram));
+    Program actualProgram;
+    ASSERT_EQ("", reader.readFromString(actualProgram, stringifiedProgram, settings));
+
+    ASSERT_EQ(expectedProgram.modules().size(), actualProgram.modules().size());
+    for (std::size_t i = 0; i < expectedProgram.modules().size(); ++i) {
+        ASSERT_EQ(expectedProgram.modules()[i]->name, actualProgram.modules()[i]->name);
+        ASSERT_EQ(expectedProgram.modules()[i]->parameters.size(), actualProgram.modules()[i]->parameters.size());
+        assertStatementsAreEquivalent(expectedProgram.modules()[i]->statements, actualProgram.modules()[i]->statements);
+    }
+
+    // The call statements of the main module reference the modules of the concurrently parsed program.
+    const auto* callStatement = statementCast<CallStatement>(actualProgram.modules().back()->statements.front().get());
+    ASSERT_NE(nullptr, callStatement);
+    ASSERT_EQ(actualProgram.modules().front(), callStatement->target);
+}
+
+TEST(ProgramReaderTests, ErrorsOfConcurrentlyParsedModuleDeclarationsMatchErrorsOfSequentialParse) {
+    const std::vector<std::string> programsWithErrors = {
+            "module add(inout x(4), in y(4)) x += y module add(inout x(4), in y(4)) x -= y module main(inout a(4), in b(4)) call add(a, b)",
+            "module add(inout x(4), in y(4)) x += z module main(inout a(4), in b(4)) call add(a, b)",
+            "module add(inout x(4), in y(4)) x += y module main(inout a(4), in b(4)) call sub(a, b)",
+            "module add(inout x(4), in y(4)) x += y module main(inout a(4), in b(4)) call add(a, b"};
+
+    ConfigurableOptions settings;
+    settings.parseModuleDeclarationsConcurrently = true;
+    settings.maxNumThreads                       = 2U;
+
+    ProgramReader reader;
+    for (const std::string& programWithErrors: programsWithErrors) {
+        Program           expectedProgram;
+        const std::string expectedErrors = reader.readFromString(expectedProgram, programWithErrors);
+        ASSERT_FALSE(expectedErrors.empty()) << programWithErrors;
+
+        Program actualProgram;
+        ASSERT_EQ(expectedErrors, reader.readFromString(actualProgram, programWithErrors, settings));
+        ASSERT_TRUE(actualProgram.modules().empty());
+    }
+}
+
+TEST(ProgramReaderTests, ModulesNotReachableFromProgramEntryPointAreOnlyValidatedSyntacticallyIfPruned) {
+    constexpr auto stringifiedProgram = "module unused(inout x(4)) ++= y "
+                                        "module inner(inout x(4)) --= x "
+                                        "module outer(inout x(4), in y(4)) if (y = 0) then call inner(x) else skip fi (y = 0) "
+                                        "module main(inout a(4), in b(4)) for $i = 0 to 1 do uncall outer(a, b) rof";
+
+    ProgramReader reader;
+    Program       program;
+    ASSERT_FALSE(reader.readFromString(program, stringifiedProgram).empty());
+
+    ConfigurableOptions settings;
+    settings.pruneModulesNotReachableFromProgramEntryPoint = true;
+    ASSERT_EQ("", reader.readFromString(program, stringifiedProgram, settings));
+    ASSERT_EQ(3U, program.modules().size());
+    ASSERT_EQ("inner", program.modules()[0]->name);
+    ASSERT_EQ("outer", program.modules()[1]->name);
+    ASSERT_EQ("main", program.modules()[2]->name);
+
+    // Syntax errors of unreachable modules are still reported.
+    ASSERT_FALSE(reader.readFromString(program, "module unused(inout x(4)) ++= module main(inout a(4)) ++= a", settings).empty());
+}
+
+TEST(ProgramReaderTests, PruningModulesUsesUserDefinedProgramEntryPoint) {
+    constexpr auto stringifiedProgram = "module add(inout x(4), in y(4)) x += y "
+                                        "module add(inout x(4)) ++= x "
+                                        "module sub(inout x(4), in y(4)) x -= y "
+                                        "module top(inout a(4), in b(4)) call add(a, b)";
+
+    ConfigurableOptions settings;
+    settings.pruneModulesNotReachableFromProgramEntryPoint = true;
+    settings.optionalProgramEntryPointModuleIdentifier     = "top";
+
+    ProgramReader reader;
+    Program       program;
+    ASSERT_EQ("", reader.readFromString(program, stringifiedProgram, settings));
+    // All overloads of a called module are kept since the overload resolution requires the semantic checks of the caller arguments.
+    ASSERT_EQ(3U, program.modules().size());
+    ASSERT_EQ("add", program.modules()[0]->name);
+    ASSERT_EQ("add", program.modules()[1]->name);
+    ASSERT_EQ("top", program.modules()[2]->name);
+
+    // Without a module matching the program entry point all modules are checked to report the missing entry point.
+    settings.optionalProgramEntryPointModuleIdentifier = "missing";
+    ASSERT_FALSE(reader.readFromString(program, stringifiedProgram, settings).empty());
+}
+
+TEST(ProgramReaderTests, ModulesOfLinkedLibraryAreCallableWithoutBeingParsedAgain) {
+    ProgramReader      reader;
+    ModuleLibrary::ptr library;
+    ASSERT_EQ("", reader.readModuleLibraryFromString(library, "module add(inout x(4), in y(4)) x += y "
+                                                              "module add(inout x(4)) ++= x "
+                                                              "module inc(inout x(4)) call add(x)"));
+    ASSERT_NE(nullptr, library);
+    ASSERT_EQ(3U, library->modules().size());
+
+    // Every program linking the library references the modules of the library instead of copies of the latter.
+    for (const auto* const stringifiedProgram: {"module main(inout a(4), in b(4)) call add(a, b); call inc(a)", "module main(inout a(4)) call inc(a); uncall add(a)"}) {
+        Program program;
+        ASSERT_EQ("", reader.readFromString(program, stringifiedProgram, *library));
+        ASSERT_EQ(4U, program.modules().size());
+        for (std::size_t i = 0; i < library->modules().size(); ++i) {
+            ASSERT_EQ(library->modules()[i], program.modules()[i]);
+        }
+        ASSERT_EQ("main", program.modules().back()->name);
+
+        const auto* const firstCallStatement = statementCast<CallStatement>(program.modules().back()->statements.front().get());
+        ASSERT_NE(nullptr, firstCallStatement);
+        ASSERT_TRUE(firstCallStatement->target == library->modules()[0] || firstCallStatement->target == library->modules()[2]);
+    }
+}
+
+TEST(ProgramReaderTests, ModuleLibraryDoesNotRequireProgramEntryPoint) {
+    ProgramReader      reader;
+    ModuleLibrary::ptr library;
+    // The last declared module would be the program entry point of a program and thus not be callable.
+    ASSERT_EQ("", reader.readModuleLibraryFromString(library, "module twice(inout x(4)) call inc(x); call inc(x) module inc(inout x(4)) ++= x"));
+    ASSERT_NE(nullptr, library);
+
+    Program program;
+    ASSERT_EQ("", reader.readFromString(program, "module main(inout a(4)) call twice(a); call inc(a)", *library));
+    ASSERT_EQ(3U, program.modules().size());
+}
+
+TEST(ProgramReaderTests, ErrorsOfModuleLibraryAreReported) {
+    ProgramReader      reader;
+    ModuleLibrary::ptr library;
+    ASSERT_FALSE(reader.readModuleLibraryFromString(library, "module inc(inout x(4)) ++= y").empty());
+    ASSERT_EQ(nullptr, library);
+}
+
+TEST(ProgramReaderTests, DeclarationConflictsWithModulesOfLinkedLibraryAreReported) {
+    ProgramReader      reader;
+    ModuleLibrary::ptr library;
+    ASSERT_EQ("", reader.readModuleLibraryFromString(library, "module inc(inout x(4)) ++= x"));
+    ASSERT_NE(nullptr, library);
+
+    Program program;
+    ASSERT_FALSE(reader.readFromString(program, "module inc(inout x(4)) --= x module main(inout a(4)) call inc(a)", *library).empty());
+    ASSERT_FALSE(reader.readFromString(program, "module main(inout a(4)) call dec(a)", *library).empty());
+
+    // A program declaring an overload of a module of the library can call both modules.
+    ASSERT_EQ("", reader.readFromString(program, "module inc(inout x(4), in y(4)) x += y module main(inout a(4), in b(4)) call inc(a); call inc(a, b)", *library));
+    ASSERT_EQ(3U, program.modules().size());
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/syrec/module.hpp"
+#include "core/syrec/parser/utils/base_syrec_ir_entity_stringifier.hpp"
+#include "core/syrec/parser/utils/syrec_ir_entity_buffer_stringifier.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/variable.hpp"
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace utils;
+
+namespace {
+    constexpr auto PATH_TO_SYREC_CIRCUITS = "./circuits";
+
+    class SyrecIrEntityBufferStringifierTestFixture: public testing::TestWithParam<std::string> {
+    protected:
+        syrec::Program program;
+
+        void SetUp() override {
+            ASSERT_EQ("", program.read(PATH_TO_SYREC_CIRCUITS + std::string("/") + GetParam() + ".src"));
+        }
+
+        void assertStringificationIntoBufferMatchesStringificationIntoStream(const std::optional<BaseSyrecIrEntityStringifier::AdditionalFormattingOptions>& formattingOptions) const {
+            std::ostringstream streamOfStringifiedProgram;
+            ASSERT_TRUE(BaseSyrecIrEntityStringifier(formattingOptions).stringify(streamOfStringifiedProgram, program));
+
+            std::string bufferOfStringifiedProgram;
+            ASSERT_TRUE(SyrecIrEntityBufferStringifier(formattingOptions).stringify(bufferOfStringifiedProgram, program));
+            ASSERT_EQ(streamOfStringifiedProgram.str(), bufferOfStringifiedProgram);
+        }
+    };
+
+    INSTANTIATE_TEST_SUITE_P(SyrecIrEntityBufferStringifierTests, SyrecIrEntityBufferStringifierTestFixture,
+                             testing::Values("alu_2", "binary_numeric", "call_8", "constExpr_8", "for_4", "ifCondVariants_4", "negate_8", "shift_4", "skip", "swap_2"),
+                             [](const testing::TestParamInfo<SyrecIrEntityBufferStringifierTestFixture::ParamType>& info) { return info.param; });
+} // namespace
+
+TEST_P(SyrecIrEntityBufferStringifierTestFixture, StringificationWithDefaultFormattingOptionsMatchesStreamStringifier) {
+    assertStringificationIntoBufferMatchesStringificationIntoStream(std::nullopt);
+}
+
+TEST_P(SyrecIrEntityBufferStringifierTestFixture, StringificationWithCustomFormattingOptionsMatchesStreamStringifier) {
+    BaseSyrecIrEntityStringifier::AdditionalFormattingOptions formattingOptions;
+    formattingOptions.useWhitespaceBetweenOperandsOfBinaryOperation                  = false;
+    formattingOptions.useWhitespaceAfterAfterModuleParameterDeclaration              = false;
+    formattingOptions.omitVariableTypeSharedBySequenceOfLocalVariables               = false;
+    formattingOptions.omitNumberOfDimensionsDeclarationFor1DVariablesWithSingleValue = false;
+    formattingOptions.optionalCustomNewlineCharacterSequence                         = "\n";
+    formattingOptions.optionalCustomIndentationCharacterSequence                     = "  ";
+    assertStringificationIntoBufferMatchesStringificationIntoStream(formattingOptions);
+}
+
+TEST(SyrecIrEntityBufferStringifierTests, SignatureOfModuleIsMemoized) {
+    syrec::Program program;
+    ASSERT_EQ("", program.read(PATH_TO_SYREC_CIRCUITS + std::string("/call_8.src")));
+    ASSERT_FALSE(program.modules().empty());
+
+    SyrecIrEntityBufferStringifier        stringifier(std::nullopt);
+    const syrec::Module&                  calledModule = *program.modules().front();
+    const std::optional<std::string_view> signature    = stringifier.stringifySignatureOfModule(calledModule);
+    ASSERT_TRUE(signature.has_value());
+    ASSERT_EQ("module call_func(in x[1](1), inout y[1](8), inout z[1](8), inout t[1](8))", *signature);
+
+    const std::optional<std::string_view> memoizedSignature = stringifier.stringifySignatureOfModule(calledModule);
+    ASSERT_TRUE(memoizedSignature.has_value());
+    ASSERT_EQ(signature->data(), memoizedSignature->data());
+}
+
+TEST(SyrecIrEntityBufferStringifierTests, SignatureOfModuleWithLocalVariableAsParameterIsNotStringified) {
+    syrec::Module programModule("main");
+    programModule.addParameter(std::make_shared<syrec::Variable>(syrec::Variable::Type::Wire, "a", std::vector<unsigned>{1}, 4));
+
+    SyrecIrEntityBufferStringifier stringifier(std::nullopt);
+    ASSERT_FALSE(stringifier.stringifySignatureOfModule(programModule).has_value());
+}
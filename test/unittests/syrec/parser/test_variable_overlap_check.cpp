@@ -1958,3 +1958,39 @@ TEST(VariableAccessOverlapTests, NonConstantValueForAccessedValueOfDimensionOfBo
     rhsVariableAccess.indexes[0U]        = exprForSecondLoopVariable;
     ASSERT_NO_FATAL_FAILURE(assertSymmetricEquivalenceBetweenPotentiallyVariableAccessOverlapOperands(lhsVariableAccess, rhsVariableAccess));
 }
+
+TEST(VariableAccessOverlapTests, OverlapCheckerWithFixedVariableAccessMatchesPairwiseOverlapChecks) {
+    const auto referencedVariable = createVariableInstance(DEFAULT_VARIABLE_IDENTIFIER, {2, 3}, DEFAULT_VARIABLE_BITWIDTH);
+
+    syrec::VariableAccess fixedVariableAccess;
+    fixedVariableAccess.setVar(referencedVariable);
+    fixedVariableAccess.indexes = {createExpressionForConstantValue(1), createExpressionForConstantValue(2)};
+    fixedVariableAccess.range   = std::make_pair(createNumberContainerForConstantValue(4), createNumberContainerForConstantValue(8));
+
+    std::vector<syrec::VariableAccess> checkedVariableAccesses(4);
+    for (syrec::VariableAccess& checkedVariableAccess: checkedVariableAccesses) {
+        checkedVariableAccess.setVar(referencedVariable);
+    }
+    checkedVariableAccesses[0].indexes = fixedVariableAccess.indexes;
+    checkedVariableAccesses[0].range   = std::make_pair(createNumberContainerForConstantValue(8), createNumberContainerForConstantValue(6));
+    checkedVariableAccesses[1].indexes = {createExpressionForConstantValue(1), createExpressionForConstantValue(0)};
+    checkedVariableAccesses[2].indexes = {createExpressionForLoopVariableIdentifier("$i"), createExpressionForConstantValue(2)};
+    checkedVariableAccesses[3].setVar(createVariableInstance(DEFAULT_VARIABLE_IDENTIFIER + "Other", {2, 3}, DEFAULT_VARIABLE_BITWIDTH));
+
+    const utils::VariableAccessOverlapChecker overlapChecker(fixedVariableAccess);
+    for (const syrec::VariableAccess& checkedVariableAccess: checkedVariableAccesses) {
+        const std::optional<utils::VariableAccessOverlapCheckResult> expectedOverlapCheckResult = utils::checkOverlapBetweenVariableAccesses(fixedVariableAccess, checkedVariableAccess);
+        const std::optional<utils::VariableAccessOverlapCheckResult> actualOverlapCheckResult   = overlapChecker.checkOverlapWith(checkedVariableAccess);
+        ASSERT_EQ(expectedOverlapCheckResult.has_value(), actualOverlapCheckResult.has_value());
+        if (expectedOverlapCheckResult.has_value()) {
+            ASSERT_EQ(expectedOverlapCheckResult->overlapState, actualOverlapCheckResult->overlapState);
+            ASSERT_NO_FATAL_FAILURE(assertOverlapDataMatches(expectedOverlapCheckResult->overlappingIndicesInformation, actualOverlapCheckResult->overlappingIndicesInformation));
+        }
+    }
+
+    const std::optional<utils::VariableAccessOverlapCheckResult> overlapCheckResult = overlapChecker.checkOverlapWith(checkedVariableAccesses[0]);
+    ASSERT_TRUE(overlapCheckResult.has_value());
+    ASSERT_EQ(utils::VariableAccessOverlapCheckResult::OverlapState::Overlapping, overlapCheckResult->overlapState);
+    ASSERT_EQ("(0,1)(1,2)| 6", overlapCheckResult->stringifyOverlappingIndicesInformation());
+    ASSERT_FALSE(overlapChecker.checkOverlapWith(checkedVariableAccesses[3]).has_value());
+}
@@ -12,6 +12,7 @@
 
 #include "core/configurable_options.hpp"
 #include "core/syrec/parser/utils/base_syrec_ir_entity_stringifier.hpp"
+#include "core/syrec/parser/utils/syrec_ir_entity_buffer_stringifier.hpp"
 #include "core/syrec/parser/utils/syrec_operation_utils.hpp"
 #include "core/syrec/program.hpp"
 
@@ -142,5 +143,13 @@ protected:
         std::ostringstream containerForStringifiedProgram;
         ASSERT_NO_FATAL_FAILURE(assertStringificationOfParsedSyrecProgramIsSuccessful(parserInstance, containerForStringifiedProgram));
         ASSERT_EQ(containerForStringifiedProgram.str(), loadedTestCaseData.stringifiedExpectedSyrecProgramContent) << "SyReC program processed by the parser needs to match the user defined input circuit";
+
+        utils::SyrecIrEntityBufferStringifier::AdditionalFormattingOptions customFormattingOptions;
+        customFormattingOptions.optionalCustomIndentationCharacterSequence = "";
+        customFormattingOptions.optionalCustomNewlineCharacterSequence     = " ";
+
+        std::string bufferOfStringifiedProgram;
+        ASSERT_TRUE(utils::SyrecIrEntityBufferStringifier(customFormattingOptions).stringify(bufferOfStringifiedProgram, parserInstance)) << "Failed to stringify SyReC program into buffer";
+        ASSERT_EQ(containerForStringifiedProgram.str(), bufferOfStringifiedProgram) << "Stringification of SyReC program into buffer needs to match the stringification into a stream";
     }
 };
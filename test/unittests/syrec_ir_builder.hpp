@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/syrec/expression.hpp"
+#include "core/syrec/number.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+
+#include <bit>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+/**
+ * Helpers to build the SyReC IR entities of a program in the tests without parsing the stringified program.
+ */
+namespace syrec_ir_builder {
+    using AccessedBitrange = std::optional<std::pair<syrec::Number::ptr, syrec::Number::ptr>>;
+
+    [[nodiscard]] inline syrec::Number::ptr createNumber(const unsigned value) {
+        return std::make_shared<syrec::Number>(value);
+    }
+
+    [[nodiscard]] inline syrec::Expression::ptr createNumericExpression(const syrec::Number::ptr& value, const unsigned bitwidth = 4U) {
+        return std::make_shared<syrec::NumericExpression>(value, bitwidth);
+    }
+
+    [[nodiscard]] inline syrec::Expression::ptr createNumericExpression(const unsigned value, const unsigned bitwidth = 4U) {
+        return createNumericExpression(createNumber(value), bitwidth);
+    }
+
+    [[nodiscard]] inline AccessedBitrange createAccessedBit(const syrec::Number::ptr& accessedBit) {
+        return std::make_pair(accessedBit, accessedBit);
+    }
+
+    /**
+     * Create an access on an element of the first dimension of a variable.
+     * @param variable The accessed variable.
+     * @param accessedElement The expression defining the index of the accessed element.
+     * @param accessedBitrange The optionally accessed bitrange of the element.
+     */
+    [[nodiscard]] inline syrec::VariableAccess::ptr createVariableAccess(const syrec::Variable::ptr& variable, const syrec::Expression::ptr& accessedElement, AccessedBitrange accessedBitrange = std::nullopt) {
+        auto variableAccess = std::make_shared<syrec::VariableAccess>();
+        variableAccess->setVar(variable);
+        variableAccess->indexes = {accessedElement};
+        variableAccess->range   = std::move(accessedBitrange);
+        return variableAccess;
+    }
+
+    /**
+     * Create an access on an element of the first dimension of a variable using a number as the index whose bitwidth is large enough to store the index of any element of the dimension.
+     * @param variable The accessed variable.
+     * @param accessedElement The number defining the index of the accessed element.
+     * @param accessedBitrange The optionally accessed bitrange of the element.
+     */
+    [[nodiscard]] inline syrec::VariableAccess::ptr createVariableAccess(const syrec::Variable::ptr& variable, const syrec::Number::ptr& accessedElement, AccessedBitrange accessedBitrange = std::nullopt) {
+        const unsigned maxIndexOfDimension = variable->dimensions.front() - 1U;
+        const unsigned bitwidthOfIndex     = maxIndexOfDimension == 0U ? 1U : static_cast<unsigned>(std::bit_width(maxIndexOfDimension));
+        return createVariableAccess(variable, createNumericExpression(accessedElement, bitwidthOfIndex), std::move(accessedBitrange));
+    }
+
+    [[nodiscard]] inline syrec::VariableAccess::ptr createVariableAccess(const syrec::Variable::ptr& variable, const std::string& loopVariable, AccessedBitrange accessedBitrange = std::nullopt) {
+        return createVariableAccess(variable, std::make_shared<syrec::Number>(loopVariable), std::move(accessedBitrange));
+    }
+
+    [[nodiscard]] inline syrec::VariableAccess::ptr createVariableAccess(const syrec::Variable::ptr& variable, const unsigned accessedElement = 0U, AccessedBitrange accessedBitrange = std::nullopt) {
+        return createVariableAccess(variable, createNumber(accessedElement), std::move(accessedBitrange));
+    }
+
+    [[nodiscard]] inline syrec::VariableAccess::ptr createVariableAccess(const syrec::Variable::ptr& variable, AccessedBitrange accessedBitrange) {
+        return createVariableAccess(variable, 0U, std::move(accessedBitrange));
+    }
+
+    [[nodiscard]] inline syrec::Expression::ptr createVariableExpression(const syrec::VariableAccess::ptr& variableAccess) {
+        return std::make_shared<syrec::VariableExpression>(variableAccess);
+    }
+
+    [[nodiscard]] inline syrec::Expression::ptr createVariableExpression(const syrec::Variable::ptr& variable, const unsigned accessedElement = 0U) {
+        return std::make_shared<syrec::VariableExpression>(createVariableAccess(variable, accessedElement));
+    }
+
+    [[nodiscard]] inline syrec::Statement::ptr createAssignment(const syrec::VariableAccess::ptr& assignedToVariable, const syrec::AssignStatement::AssignOperation assignOperation, const syrec::Expression::ptr& rhs, const unsigned lineNumber = 0U) {
+        auto assignment        = std::make_shared<syrec::AssignStatement>(assignedToVariable, assignOperation, rhs);
+        assignment->lineNumber = lineNumber;
+        return assignment;
+    }
+
+    [[nodiscard]] inline syrec::Statement::ptr createAssignment(const syrec::Variable::ptr& assignedToVariable, const syrec::AssignStatement::AssignOperation assignOperation, const syrec::Expression::ptr& rhs) {
+        return createAssignment(createVariableAccess(assignedToVariable), assignOperation, rhs);
+    }
+} // namespace syrec_ir_builder
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/ancillary_qubit_pool.hpp"
+#include "ir/Definitions.hpp"
+
+#include <gtest/gtest.h>
+#include <optional>
+#include <vector>
+
+using namespace syrec;
+
+TEST(AncillaryQubitPoolTests, BorrowFromEmptyPool) {
+    AncillaryQubitPool ancillaryQubitPool;
+    ASSERT_FALSE(ancillaryQubitPool.tryBorrowQubit().has_value());
+    ASSERT_TRUE(ancillaryQubitPool.getBorrowedQubits().empty());
+}
+
+TEST(AncillaryQubitPoolTests, BorrowReleasedQubits) {
+    AncillaryQubitPool ancillaryQubitPool;
+    ancillaryQubitPool.releaseQubits({2U, 3U});
+
+    const std::optional<qc::Qubit> firstBorrowedQubit = ancillaryQubitPool.tryBorrowQubit();
+    ASSERT_EQ(std::make_optional(3U), firstBorrowedQubit);
+    const std::optional<qc::Qubit> secondBorrowedQubit = ancillaryQubitPool.tryBorrowQubit();
+    ASSERT_EQ(std::make_optional(2U), secondBorrowedQubit);
+    ASSERT_FALSE(ancillaryQubitPool.tryBorrowQubit().has_value());
+    ASSERT_EQ(std::vector<qc::Qubit>({3U, 2U}), ancillaryQubitPool.getBorrowedQubits());
+}
+
+TEST(AncillaryQubitPoolTests, QubitReleasedMultipleTimesIsOnlyBorrowedOnce) {
+    AncillaryQubitPool ancillaryQubitPool;
+    ancillaryQubitPool.releaseQubits({1U, 1U});
+    ancillaryQubitPool.releaseQubits({1U});
+
+    ASSERT_EQ(std::make_optional(1U), ancillaryQubitPool.tryBorrowQubit());
+    ASSERT_FALSE(ancillaryQubitPool.tryBorrowQubit().has_value());
+
+    // A borrowed qubit can be released again
+    ancillaryQubitPool.releaseQubits({1U});
+    ASSERT_EQ(std::make_optional(1U), ancillaryQubitPool.tryBorrowQubit());
+    ASSERT_EQ(std::vector<qc::Qubit>({1U, 1U}), ancillaryQubitPool.getBorrowedQubits());
+}
+
+TEST(AncillaryQubitPoolTests, QubitsOfParentScopeCannotBeBorrowedInNestedScope) {
+    AncillaryQubitPool ancillaryQubitPool;
+    ancillaryQubitPool.releaseQubits({1U});
+    ancillaryQubitPool.openScope();
+    ASSERT_FALSE(ancillaryQubitPool.tryBorrowQubit().has_value());
+
+    ancillaryQubitPool.releaseQubits({2U});
+    ASSERT_EQ(std::make_optional(2U), ancillaryQubitPool.tryBorrowQubit());
+    ASSERT_TRUE(ancillaryQubitPool.closeScope());
+    ASSERT_EQ(std::make_optional(1U), ancillaryQubitPool.tryBorrowQubit());
+}
+
+TEST(AncillaryQubitPoolTests, ClosingNestedScopeReleasesItsQubitsToParentScope) {
+    AncillaryQubitPool ancillaryQubitPool;
+    ancillaryQubitPool.openScope();
+    ancillaryQubitPool.releaseQubits({4U, 5U});
+    ASSERT_TRUE(ancillaryQubitPool.closeScope());
+
+    ASSERT_EQ(std::make_optional(5U), ancillaryQubitPool.tryBorrowQubit());
+    ASSERT_EQ(std::make_optional(4U), ancillaryQubitPool.tryBorrowQubit());
+    ASSERT_FALSE(ancillaryQubitPool.tryBorrowQubit().has_value());
+}
+
+TEST(AncillaryQubitPoolTests, OutermostScopeCannotBeClosed) {
+    AncillaryQubitPool ancillaryQubitPool;
+    ASSERT_FALSE(ancillaryQubitPool.closeScope());
+
+    ancillaryQubitPool.openScope();
+    ASSERT_TRUE(ancillaryQubitPool.closeScope());
+    ASSERT_FALSE(ancillaryQubitPool.closeScope());
+}
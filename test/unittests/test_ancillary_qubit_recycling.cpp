@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/optimization/ancillary_qubit_recycling.hpp"
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "differential_verification_test_fixture.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/operations/StandardOperation.hpp"
+
+#include <gtest/gtest.h>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    class AncillaryQubitRecyclingTestsFixture: public DifferentialVerificationTestFixture {
+    protected:
+        AnnotatableQuantumComputation annotatableQuantumComputation;
+
+        // Creates a quantum register storing the two qubits 0 and 1 of a variable followed by an ancillary quantum register storing the qubits 2 and 3.
+        void SetUp() override {
+            ASSERT_EQ(std::make_optional<qc::Qubit>(0U), annotatableQuantumComputation.addQuantumRegisterForSyrecVariable("var", AnnotatableQuantumComputation::AssociatedVariableLayoutInformation({.numValuesPerDimension = {1U}, .bitwidth = 2U}), false));
+            ASSERT_EQ(std::make_optional<qc::Qubit>(2U), annotatableQuantumComputation.addPreliminaryAncillaryRegisterOrAppendToAdjacentOne("anc", {false, false}, AnnotatableQuantumComputation::InlinedQubitInformation{}));
+            annotatableQuantumComputation.promotePreliminaryAncillaryQubitsToDefinitiveAncillaryQubits();
+        }
+
+        // Computes the value of the first qubit of the variable into an ancillary qubit, applies it to the second qubit of the variable and uncomputes the ancillary qubit again.
+        void addComputeApplyUncomputeSequenceUsingAncillaryQubit(const qc::Qubit ancillaryQubit) {
+            ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingCnotGate(0U, ancillaryQubit));
+            ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingCnotGate(ancillaryQubit, 1U));
+            ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingCnotGate(0U, ancillaryQubit));
+        }
+    };
+} // namespace
+
+TEST_F(AncillaryQubitRecyclingTestsFixture, AncillaryQubitsWithNonOverlappingLiveRangesAreMerged) {
+    ASSERT_NO_FATAL_FAILURE(addComputeApplyUncomputeSequenceUsingAncillaryQubit(2U));
+    ASSERT_NO_FATAL_FAILURE(addComputeApplyUncomputeSequenceUsingAncillaryQubit(3U));
+    const auto synthesisCostPriorToRecycling = annotatableQuantumComputation.getQuantumCostForSynthesis();
+
+    ASSERT_EQ(1U, recycleAncillaryQubits(annotatableQuantumComputation));
+    ASSERT_EQ(3U, annotatableQuantumComputation.getNqubits());
+    ASSERT_EQ(6U, annotatableQuantumComputation.getNops());
+    ASSERT_EQ(synthesisCostPriorToRecycling, annotatableQuantumComputation.getQuantumCostForSynthesis());
+    for (std::size_t i = 0; i < annotatableQuantumComputation.getNops(); ++i) {
+        const qc::StandardOperation expectedQuantumOperation = i % 3U == 1U ? qc::StandardOperation(qc::Controls({2U}), 1U, qc::OpType::X) : qc::StandardOperation(qc::Controls({0U}), 2U, qc::OpType::X);
+        ASSERT_TRUE(annotatableQuantumComputation.at(i)->equals(expectedQuantumOperation)) << "Quantum operation " << i << " did not match";
+    }
+
+    ASSERT_TRUE(annotatableQuantumComputation.logicalQubitIsAncillary(2U));
+    ASSERT_EQ(std::make_optional<std::string>("anc[0].0"), annotatableQuantumComputation.getQubitLabel(2U, AnnotatableQuantumComputation::QubitLabelType::Internal));
+    ASSERT_EQ(1U, annotatableQuantumComputation.getQuantumRegisters().at("anc").getSize());
+}
+
+TEST_F(AncillaryQubitRecyclingTestsFixture, AncillaryQubitNotRestoredToZeroIsNotMerged) {
+    ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingCnotGate(0U, 2U));
+    ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingCnotGate(2U, 1U));
+    ASSERT_NO_FATAL_FAILURE(addComputeApplyUncomputeSequenceUsingAncillaryQubit(3U));
+
+    ASSERT_EQ(0U, recycleAncillaryQubits(annotatableQuantumComputation));
+    ASSERT_EQ(4U, annotatableQuantumComputation.getNqubits());
+}
+
+TEST_F(AncillaryQubitRecyclingTestsFixture, AncillaryQubitNotRestoredToZeroForSingleAssignmentIsNotMerged) {
+    // The first ancillary qubit is only set for the assignment setting both qubits of the variable to one.
+    ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingToffoliGate(0U, 1U, 2U));
+    ASSERT_NO_FATAL_FAILURE(addComputeApplyUncomputeSequenceUsingAncillaryQubit(3U));
+
+    ASSERT_EQ(0U, recycleAncillaryQubits(annotatableQuantumComputation));
+    ASSERT_EQ(4U, annotatableQuantumComputation.getNqubits());
+}
+
+TEST_F(AncillaryQubitRecyclingTestsFixture, QuantumComputationWithMoreInputsThanCheckedExhaustivelyIsNotRecycled) {
+    ASSERT_NO_FATAL_FAILURE(addComputeApplyUncomputeSequenceUsingAncillaryQubit(2U));
+    ASSERT_NO_FATAL_FAILURE(addComputeApplyUncomputeSequenceUsingAncillaryQubit(3U));
+
+    ASSERT_EQ(0U, recycleAncillaryQubits(annotatableQuantumComputation, AncillaryQubitRecyclingSettings{.maxNumInputsOfExhaustiveCheck = 1U}));
+    ASSERT_EQ(4U, annotatableQuantumComputation.getNqubits());
+    ASSERT_EQ(1U, recycleAncillaryQubits(annotatableQuantumComputation, AncillaryQubitRecyclingSettings{.maxNumInputsOfExhaustiveCheck = 2U}));
+    ASSERT_EQ(3U, annotatableQuantumComputation.getNqubits());
+}
+
+TEST_F(AncillaryQubitRecyclingTestsFixture, AncillaryQubitsWithOverlappingLiveRangesAreNotMerged) {
+    ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingCnotGate(0U, 2U));
+    ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingCnotGate(2U, 3U));
+    ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingCnotGate(3U, 1U));
+    ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingCnotGate(2U, 3U));
+    ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingCnotGate(0U, 2U));
+
+    ASSERT_EQ(0U, recycleAncillaryQubits(annotatableQuantumComputation));
+    ASSERT_EQ(4U, annotatableQuantumComputation.getNqubits());
+}
+
+TEST_F(AncillaryQubitRecyclingTestsFixture, NotAccessedAncillaryQubitsAreRemoved) {
+    ASSERT_NO_FATAL_FAILURE(addComputeApplyUncomputeSequenceUsingAncillaryQubit(3U));
+
+    ASSERT_EQ(1U, recycleAncillaryQubits(annotatableQuantumComputation));
+    ASSERT_EQ(3U, annotatableQuantumComputation.getNqubits());
+    ASSERT_TRUE(annotatableQuantumComputation.at(0)->equals(qc::StandardOperation(qc::Controls({0U}), 2U, qc::OpType::X)));
+}
+
+TEST_F(AncillaryQubitRecyclingTestsFixture, RecyclingAncillaryQubitsDuringSynthesisDoesNotChangeSimulationResult) {
+    ASSERT_NO_FATAL_FAILURE(parseProgram("module main(inout a(4), in b(4), in c(4)) a += (b & c); if (b > c) then a ^= c else skip fi (b > c); a -= (b | c)"));
+
+    ConfigurableOptions settings;
+    settings.recycleAncillaryQubitsWithNonOverlappingLiveRanges = true;
+    for (const SynthesisAlgorithm synthesisAlgorithm: {SynthesisAlgorithm::CostAware, SynthesisAlgorithm::LineAware}) {
+        ASSERT_NO_FATAL_FAILURE(assertSynthesisDoesNotChangeSimulationResult(program, settings, synthesisAlgorithm));
+    }
+}
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/qubit_inlining_stack.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/variable.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/operations/Control.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    class AnnotatableQuantumComputationSerializationTestsFixture: public testing::Test {
+    protected:
+        AnnotatableQuantumComputation annotatableQuantumComputation{true};
+
+        // Creates the quantum register of the variable 'a[2](2)' storing the qubits 0 to 3, of the garbage variable 'b' storing the qubit 4 and of the ancillary qubits 5 and 6 (added in two ranges with different inline stacks)
+        // followed by annotated quantum operations of every supported gate type.
+        void SetUp() override {
+            const auto calledModule = std::make_shared<Module>("add");
+            calledModule->addParameter(std::make_shared<Variable>(Variable::Type::Inout, "x", std::vector<unsigned>{1U}, 2U));
+            const auto callerInlineStack = std::make_shared<QubitInliningStack>();
+            ASSERT_TRUE(callerInlineStack->push(QubitInliningStack::QubitInliningStackEntry({.lineNumberOfCallOfTargetModule = 3U, .isTargetModuleAccessedViaCallStmt = true, .targetModule = std::make_shared<Module>("main")})));
+            const auto calleeInlineStack = std::make_shared<QubitInliningStack>();
+            ASSERT_TRUE(calleeInlineStack->push(*callerInlineStack->getStackEntryAt(0U)));
+            ASSERT_TRUE(calleeInlineStack->push(QubitInliningStack::QubitInliningStackEntry({.lineNumberOfCallOfTargetModule = std::nullopt, .isTargetModuleAccessedViaCallStmt = std::nullopt, .targetModule = calledModule})));
+
+            ASSERT_EQ(std::make_optional<qc::Qubit>(0U), annotatableQuantumComputation.addQuantumRegisterForSyrecVariable("a", AnnotatableQuantumComputation::AssociatedVariableLayoutInformation({.numValuesPerDimension = {2U}, .bitwidth = 2U}), false, AnnotatableQuantumComputation::InlinedQubitInformation({.userDeclaredQubitLabel = "userA", .inlineStack = callerInlineStack})));
+            ASSERT_EQ(std::make_optional<qc::Qubit>(4U), annotatableQuantumComputation.addQuantumRegisterForSyrecVariable("b", AnnotatableQuantumComputation::AssociatedVariableLayoutInformation({.numValuesPerDimension = {1U}, .bitwidth = 1U}), true));
+            ASSERT_EQ(std::make_optional<qc::Qubit>(5U), annotatableQuantumComputation.addPreliminaryAncillaryRegisterOrAppendToAdjacentOne("anc", {false}, AnnotatableQuantumComputation::InlinedQubitInformation({.userDeclaredQubitLabel = std::nullopt, .inlineStack = callerInlineStack})));
+            ASSERT_EQ(std::make_optional<qc::Qubit>(6U), annotatableQuantumComputation.addPreliminaryAncillaryRegisterOrAppendToAdjacentOne("anc2", {false}, AnnotatableQuantumComputation::InlinedQubitInformation({.userDeclaredQubitLabel = std::nullopt, .inlineStack = calleeInlineStack})));
+            annotatableQuantumComputation.promotePreliminaryAncillaryQubitsToDefinitiveAncillaryQubits();
+
+            static_cast<void>(annotatableQuantumComputation.setOrUpdateGlobalQuantumOperationAnnotation("key", "value"));
+            static_cast<void>(annotatableQuantumComputation.setOrUpdateGlobalStatementLineNumber(2U));
+            ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingNotGate(0U));
+            ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingCnotGate(0U, 5U));
+            static_cast<void>(annotatableQuantumComputation.setOrUpdateGlobalStatementLineNumber(4U));
+            ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingToffoliGate(0U, 1U, 4U));
+            ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingFredkinGate(2U, 3U));
+            static_cast<void>(annotatableQuantumComputation.removeGlobalStatementLineNumber());
+            ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingMultiControlToffoliGate(qc::Controls({qc::Control{0U}, qc::Control{1U, qc::Control::Type::Neg}, qc::Control{6U}}), 4U));
+        }
+
+        static void assertQuantumComputationsMatch(const AnnotatableQuantumComputation& expected, const AnnotatableQuantumComputation& actual) {
+            ASSERT_EQ(expected.isGenerationOfQuantumOperationAnnotationsEnabled(), actual.isGenerationOfQuantumOperationAnnotationsEnabled());
+            ASSERT_EQ(expected.getNqubits(), actual.getNqubits());
+            ASSERT_EQ(expected.getNancillae(), actual.getNancillae());
+            ASSERT_EQ(expected.getNops(), actual.getNops());
+            ASSERT_EQ(expected.getQuantumCostForSynthesis(), actual.getQuantumCostForSynthesis());
+            ASSERT_EQ(expected.getTransistorCostForSynthesis(), actual.getTransistorCostForSynthesis());
+            ASSERT_EQ(expected.getSynthesisCostPerStatementLineNumber(), actual.getSynthesisCostPerStatementLineNumber());
+
+            for (std::size_t i = 0; i < expected.getNops(); ++i) {
+                ASSERT_TRUE(expected.at(i)->equals(*actual.at(i))) << "Quantum operation " << i << " did not match";
+                ASSERT_EQ(expected.getAnnotationsOfQuantumOperation(i), actual.getAnnotationsOfQuantumOperation(i)) << "Annotations of quantum operation " << i << " did not match";
+            }
+
+            for (qc::Qubit qubit = 0; qubit < expected.getNqubits(); ++qubit) {
+                ASSERT_EQ(expected.logicalQubitIsAncillary(qubit), actual.logicalQubitIsAncillary(qubit));
+                ASSERT_EQ(expected.logicalQubitIsGarbage(qubit), actual.logicalQubitIsGarbage(qubit));
+                ASSERT_EQ(expected.getQubitLabel(qubit, AnnotatableQuantumComputation::QubitLabelType::Internal), actual.getQubitLabel(qubit, AnnotatableQuantumComputation::QubitLabelType::Internal));
+                ASSERT_EQ(expected.getQubitLabel(qubit, AnnotatableQuantumComputation::QubitLabelType::UserDeclared), actual.getQubitLabel(qubit, AnnotatableQuantumComputation::QubitLabelType::UserDeclared));
+
+                const std::optional<AnnotatableQuantumComputation::InlinedQubitInformation> expectedInlinedQubitInformation = expected.getInlinedQubitInformation(qubit);
+                const std::optional<AnnotatableQuantumComputation::InlinedQubitInformation> actualInlinedQubitInformation   = actual.getInlinedQubitInformation(qubit);
+                ASSERT_EQ(expectedInlinedQubitInformation.has_value(), actualInlinedQubitInformation.has_value());
+                if (!expectedInlinedQubitInformation.has_value() || !expectedInlinedQubitInformation->inlineStack.has_value()) {
+                    continue;
+                }
+                ASSERT_TRUE(actualInlinedQubitInformation->inlineStack.has_value());
+
+                QubitInliningStack& expectedInlineStack = **expectedInlinedQubitInformation->inlineStack;
+                QubitInliningStack& actualInlineStack   = **actualInlinedQubitInformation->inlineStack;
+                ASSERT_EQ(expectedInlineStack.size(), actualInlineStack.size());
+                for (std::size_t i = 0; i < expectedInlineStack.size(); ++i) {
+                    const QubitInliningStack::QubitInliningStackEntry* expectedEntry = expectedInlineStack.getStackEntryAt(i);
+                    const QubitInliningStack::QubitInliningStackEntry* actualEntry   = actualInlineStack.getStackEntryAt(i);
+                    ASSERT_NE(nullptr, actualEntry);
+                    ASSERT_EQ(expectedEntry->lineNumberOfCallOfTargetModule, actualEntry->lineNumberOfCallOfTargetModule);
+                    ASSERT_EQ(expectedEntry->isTargetModuleAccessedViaCallStmt, actualEntry->isTargetModuleAccessedViaCallStmt);
+                    ASSERT_EQ(expectedEntry->stringifySignatureOfCalledModule(), actualEntry->stringifySignatureOfCalledModule());
+                }
+            }
+        }
+    };
+} // namespace
+
+TEST_F(AnnotatableQuantumComputationSerializationTestsFixture, DeserializedQuantumComputationMatchesSerializedOne) {
+    const std::optional<std::string> serializedQuantumComputation = annotatableQuantumComputation.serialize();
+    ASSERT_TRUE(serializedQuantumComputation.has_value());
+
+    const std::unique_ptr<AnnotatableQuantumComputation> deserializedQuantumComputation = AnnotatableQuantumComputation::deserialize(*serializedQuantumComputation);
+    ASSERT_NE(nullptr, deserializedQuantumComputation);
+    assertQuantumComputationsMatch(annotatableQuantumComputation, *deserializedQuantumComputation);
+
+    // The serialization of the deserialized quantum computation is identical since the modules and inline stacks are serialized in the order of their first use.
+    ASSERT_EQ(serializedQuantumComputation, deserializedQuantumComputation->serialize());
+}
+
+TEST_F(AnnotatableQuantumComputationSerializationTestsFixture, LoadedQuantumComputationMatchesSavedOne) {
+    const std::string filename = (std::filesystem::temp_directory_path() / "syrec_saved_quantum_computation_test.bin").string();
+    ASSERT_TRUE(annotatableQuantumComputation.save(filename));
+
+    const std::unique_ptr<AnnotatableQuantumComputation> loadedQuantumComputation = AnnotatableQuantumComputation::load(filename);
+    ASSERT_NE(nullptr, loadedQuantumComputation);
+    assertQuantumComputationsMatch(annotatableQuantumComputation, *loadedQuantumComputation);
+    std::filesystem::remove(filename);
+}
+
+TEST_F(AnnotatableQuantumComputationSerializationTestsFixture, QubitsCanNotBeAddedToDeserializedQuantumComputationAfterPromotionOfAncillaryQubits) {
+    const std::optional<std::string> serializedQuantumComputation = annotatableQuantumComputation.serialize();
+    ASSERT_TRUE(serializedQuantumComputation.has_value());
+
+    const std::unique_ptr<AnnotatableQuantumComputation> deserializedQuantumComputation = AnnotatableQuantumComputation::deserialize(*serializedQuantumComputation);
+    ASSERT_NE(nullptr, deserializedQuantumComputation);
+    ASSERT_FALSE(deserializedQuantumComputation->addQuantumRegisterForSyrecVariable("c", AnnotatableQuantumComputation::AssociatedVariableLayoutInformation({.numValuesPerDimension = {1U}, .bitwidth = 1U}), false).has_value());
+}
+
+TEST_F(AnnotatableQuantumComputationSerializationTestsFixture, DeserializationOfTruncatedOrModifiedContentFails) {
+    const std::optional<std::string> serializedQuantumComputation = annotatableQuantumComputation.serialize();
+    ASSERT_TRUE(serializedQuantumComputation.has_value());
+
+    for (std::size_t size = 0; size < serializedQuantumComputation->size(); size += 8U) {
+        ASSERT_EQ(nullptr, AnnotatableQuantumComputation::deserialize(std::string_view(*serializedQuantumComputation).substr(0, size))) << "Truncation to " << size << " bytes was not detected";
+    }
+
+    std::string serializedQuantumComputationWithInvalidVersion = *serializedQuantumComputation;
+    serializedQuantumComputationWithInvalidVersion[16] = static_cast<char>(serializedQuantumComputationWithInvalidVersion[16] + 1);
+    ASSERT_EQ(nullptr, AnnotatableQuantumComputation::deserialize(serializedQuantumComputationWithInvalidVersion));
+    ASSERT_EQ(nullptr, AnnotatableQuantumComputation::deserialize(*serializedQuantumComputation + std::string(8U, '\0')));
+}
+
+TEST_F(AnnotatableQuantumComputationSerializationTestsFixture, SerializationOfUnsupportedQuantumOperationFails) {
+    annotatableQuantumComputation.h(0U);
+    ASSERT_FALSE(annotatableQuantumComputation.serialize().has_value());
+    ASSERT_FALSE(annotatableQuantumComputation.save((std::filesystem::temp_directory_path() / "syrec_unsupported_quantum_computation_test.bin").string()));
+}
+
+TEST(AnnotatableQuantumComputationSerializationTests, EmptyQuantumComputationCanBeSerialized) {
+    const AnnotatableQuantumComputation emptyQuantumComputation;
+    const std::optional<std::string>    serializedQuantumComputation = emptyQuantumComputation.serialize();
+    ASSERT_TRUE(serializedQuantumComputation.has_value());
+
+    const std::unique_ptr<AnnotatableQuantumComputation> deserializedQuantumComputation = AnnotatableQuantumComputation::deserialize(*serializedQuantumComputation);
+    ASSERT_NE(nullptr, deserializedQuantumComputation);
+    ASSERT_EQ(0U, deserializedQuantumComputation->getNqubits());
+    ASSERT_EQ(0U, deserializedQuantumComputation->getNops());
+    ASSERT_FALSE(deserializedQuantumComputation->isGenerationOfQuantumOperationAnnotationsEnabled());
+}
@@ -9,6 +9,8 @@
  */
 
 #include "core/annotatable_quantum_computation.hpp"
+#include "core/frozen_quantum_computation.hpp"
+#include "core/quantum_operation_sink.hpp"
 #include "core/qubit_inlining_stack.hpp"
 #include "core/syrec/module.hpp"
 #include "ir/Definitions.hpp"
@@ -21,12 +23,15 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <functional>
 #include <gmock/gmock-matchers.h>
 #include <gtest/gtest.h>
+#include <map>
 #include <memory>
 #include <optional>
 #include <ranges>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -984,6 +989,14 @@ TEST_F(AnnotatableQuantumComputationTestsFixture, GetInternalQubitLabelOfUnknown
     ASSERT_FALSE(annotatedQuantumComputation->getQubitLabel(6U, AnnotatableQuantumComputation::QubitLabelType::Internal).has_value());
 }
 
+TEST_F(AnnotatableQuantumComputationTestsFixture, GetInternalQubitLabelOfQubitNotAddedViaAnnotatableQuantumComputationNotPossible) {
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 2U));
+    annotatedQuantumComputation->addQubitRegister(2U, "baseReg");
+    ASSERT_TRUE(annotatedQuantumComputation->getQubitLabel(1U, AnnotatableQuantumComputation::QubitLabelType::Internal).has_value());
+    ASSERT_FALSE(annotatedQuantumComputation->getQubitLabel(2U, AnnotatableQuantumComputation::QubitLabelType::Internal).has_value());
+    ASSERT_FALSE(annotatedQuantumComputation->getQubitLabel(3U, AnnotatableQuantumComputation::QubitLabelType::Internal).has_value());
+}
+
 TEST_F(AnnotatableQuantumComputationTestsFixture, GetInternalQubitLabelOfQubitOf1DVariable) {
     const std::string expectedQuantumRegisterLabel              = "regLabel";
     constexpr auto    expectedQubitRangeOfQuantumRegister       = AnnotatableQuantumComputation::QubitIndexRange({.firstQubitIndex = 0U, .lastQubitIndex = 4U});
@@ -1129,6 +1142,42 @@ TEST_F(AnnotatableQuantumComputationTestsFixture, GetUserDeclaredQubitLabelOfAnc
         ASSERT_FALSE(annotatedQuantumComputation->getQubitLabel(qubit, AnnotatableQuantumComputation::QubitLabelType::UserDeclared).has_value()) << "Expected not to be able to fetch user declared label of qubit " << std::to_string(qubit);
     }
 }
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, GetQubitLabelsOfAllQubitsMatchLabelsOfIndividualQubits) {
+    const auto inlineStack = std::make_shared<QubitInliningStack>();
+    ASSERT_TRUE(inlineStack->push(QubitInliningStack::QubitInliningStackEntry({.lineNumberOfCallOfTargetModule = std::nullopt, .isTargetModuleAccessedViaCallStmt = std::nullopt, .targetModule = std::make_shared<syrec::Module>("moduleLabel")})));
+    const auto sharedInlineInformationOfVariableQubits  = AnnotatableQuantumComputation::InlinedQubitInformation({.userDeclaredQubitLabel = "varName", .inlineStack = inlineStack});
+    const auto sharedInlineInformationOfAncillaryQubits = AnnotatableQuantumComputation::InlinedQubitInformation({.userDeclaredQubitLabel = std::nullopt, .inlineStack = inlineStack});
+
+    constexpr auto qubitRangeOfVariableQuantumRegister       = AnnotatableQuantumComputation::QubitIndexRange({.firstQubitIndex = 0U, .lastQubitIndex = 29U});
+    const auto     associatedVariableLayoutOfQuantumRegister = AnnotatableQuantumComputation::AssociatedVariableLayoutInformation({.numValuesPerDimension = {2U, 3U}, .bitwidth = 5U});
+    ASSERT_NO_FATAL_FAILURE(assertAdditionOfQuantumRegisterForSyrecVariableIsSuccessful(*annotatedQuantumComputation, "regLabel", qubitRangeOfVariableQuantumRegister, associatedVariableLayoutOfQuantumRegister, false, sharedInlineInformationOfVariableQubits));
+
+    constexpr auto qubitRangeOfAncillaryQuantumRegister = AnnotatableQuantumComputation::QubitIndexRange({.firstQubitIndex = 30U, .lastQubitIndex = 32U});
+    ASSERT_NO_FATAL_FAILURE(assertAdditionOfAncillaryQuantumRegisterIsSuccessfulWithNewRegisterCreated(*annotatedQuantumComputation, "ancReg", qubitRangeOfAncillaryQuantumRegister, std::vector({false, true, false}), sharedInlineInformationOfAncillaryQubits));
+
+    for (const auto qubitLabelType: {AnnotatableQuantumComputation::QubitLabelType::Internal, AnnotatableQuantumComputation::QubitLabelType::UserDeclared}) {
+        const std::vector<std::optional<std::string>> actualQubitLabels = annotatedQuantumComputation->getQubitLabels(qubitLabelType);
+        ASSERT_EQ(annotatedQuantumComputation->getNqubits(), actualQubitLabels.size());
+        for (qc::Qubit qubit = 0; qubit < actualQubitLabels.size(); ++qubit) {
+            ASSERT_EQ(annotatedQuantumComputation->getQubitLabel(qubit, qubitLabelType), actualQubitLabels[qubit]) << "Qubit label mismatch for qubit " << std::to_string(qubit);
+        }
+    }
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, AppendQubitLabelToNonEmptyBuffer) {
+    constexpr auto qubitRangeOfQuantumRegister               = AnnotatableQuantumComputation::QubitIndexRange({.firstQubitIndex = 0U, .lastQubitIndex = 29U});
+    const auto     associatedVariableLayoutOfQuantumRegister = AnnotatableQuantumComputation::AssociatedVariableLayoutInformation({.numValuesPerDimension = {2U, 3U}, .bitwidth = 5U});
+    ASSERT_NO_FATAL_FAILURE(assertAdditionOfQuantumRegisterForSyrecVariableIsSuccessful(*annotatedQuantumComputation, "regLabel", qubitRangeOfQuantumRegister, associatedVariableLayoutOfQuantumRegister, false));
+
+    std::string qubitLabel = "prefix:";
+    ASSERT_TRUE(annotatedQuantumComputation->appendQubitLabel(17U, AnnotatableQuantumComputation::QubitLabelType::Internal, qubitLabel));
+    ASSERT_EQ("prefix:regLabel[1][0].2", qubitLabel);
+
+    ASSERT_FALSE(annotatedQuantumComputation->appendQubitLabel(17U, AnnotatableQuantumComputation::QubitLabelType::UserDeclared, qubitLabel));
+    ASSERT_FALSE(annotatedQuantumComputation->appendQubitLabel(30U, AnnotatableQuantumComputation::QubitLabelType::Internal, qubitLabel));
+    ASSERT_EQ("prefix:regLabel[1][0].2", qubitLabel);
+}
 // END getQubitLabel tests
 
 // BEGIN AddXGate tests
@@ -1219,6 +1268,65 @@ TEST_F(AnnotatableQuantumComputationTestsFixture, AddOperationsImplementingToffo
     assertThatOperationsOfQuantumComputationAreEqualToSequence(*annotatedQuantumComputation, expectedQuantumOperations);
 }
 
+TEST_F(AnnotatableQuantumComputationTestsFixture, GateLocalControlQubitsAreNotPropagatedToSubsequentlyAddedGates) {
+    constexpr qc::Qubit propagatedControlQubitIndex = 0;
+    constexpr qc::Qubit gateControlQubitOneIndex    = 1;
+    constexpr qc::Qubit gateControlQubitTwoIndex    = 2;
+    constexpr qc::Qubit gateTargetQubitIndex        = 3;
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 4U));
+
+    annotatedQuantumComputation->activateControlQubitPropagationScope();
+    ASSERT_TRUE(annotatedQuantumComputation->registerControlQubitForPropagationInCurrentAndNestedScopes(propagatedControlQubitIndex));
+
+    // A gate local control qubit matching a propagated control qubit must still be propagated after the gate was added
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingToffoliGate(propagatedControlQubitIndex, gateControlQubitOneIndex, gateTargetQubitIndex));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingMultiControlToffoliGate(qc::Controls({gateControlQubitOneIndex, gateControlQubitTwoIndex}), gateTargetQubitIndex));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(gateControlQubitTwoIndex, gateTargetQubitIndex));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(gateTargetQubitIndex));
+
+    annotatedQuantumComputation->deactivateControlQubitPropagationScope();
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(gateTargetQubitIndex));
+
+    std::vector<std::unique_ptr<qc::Operation>> expectedQuantumOperations;
+    expectedQuantumOperations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Controls({propagatedControlQubitIndex, gateControlQubitOneIndex}), gateTargetQubitIndex, qc::OpType::X));
+    expectedQuantumOperations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Controls({propagatedControlQubitIndex, gateControlQubitOneIndex, gateControlQubitTwoIndex}), gateTargetQubitIndex, qc::OpType::X));
+    expectedQuantumOperations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Controls({propagatedControlQubitIndex, gateControlQubitTwoIndex}), gateTargetQubitIndex, qc::OpType::X));
+    expectedQuantumOperations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Controls({propagatedControlQubitIndex}), gateTargetQubitIndex, qc::OpType::X));
+    expectedQuantumOperations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Controls(), gateTargetQubitIndex, qc::OpType::X));
+    assertThatOperationsOfQuantumComputationAreEqualToSequence(*annotatedQuantumComputation, expectedQuantumOperations);
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, PolarityOfPropagatedControlQubitIsRestoredAfterDeactivationOfScopeRegisteringControlQubitWithOtherPolarity) {
+    constexpr qc::Qubit propagatedControlQubitIndex = 0;
+    constexpr qc::Qubit gateControlQubitIndex       = 1;
+    constexpr qc::Qubit gateTargetQubitIndex        = 2;
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 3U));
+
+    annotatedQuantumComputation->activateControlQubitPropagationScope();
+    ASSERT_TRUE(annotatedQuantumComputation->registerControlQubitForPropagationInCurrentAndNestedScopes(propagatedControlQubitIndex));
+
+    annotatedQuantumComputation->activateControlQubitPropagationScope();
+    ASSERT_TRUE(annotatedQuantumComputation->registerControlQubitForPropagationInCurrentAndNestedScopes(propagatedControlQubitIndex, qc::Control::Type::Neg));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(gateControlQubitIndex, gateTargetQubitIndex));
+    // A gate local negative control qubit matching a negative propagated control qubit must still be propagated after the gate was added
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingMultiControlToffoliGate(qc::Controls({qc::Control{propagatedControlQubitIndex, qc::Control::Type::Neg}}), gateTargetQubitIndex));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(gateTargetQubitIndex));
+    annotatedQuantumComputation->deactivateControlQubitPropagationScope();
+
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(gateTargetQubitIndex));
+    annotatedQuantumComputation->deactivateControlQubitPropagationScope();
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(gateTargetQubitIndex));
+
+    const qc::Control                           negativePropagatedControlQubit{propagatedControlQubitIndex, qc::Control::Type::Neg};
+    std::vector<std::unique_ptr<qc::Operation>> expectedQuantumOperations;
+    expectedQuantumOperations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Controls({negativePropagatedControlQubit, qc::Control{gateControlQubitIndex}}), gateTargetQubitIndex, qc::OpType::X));
+    expectedQuantumOperations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Controls({negativePropagatedControlQubit}), gateTargetQubitIndex, qc::OpType::X));
+    expectedQuantumOperations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Controls({negativePropagatedControlQubit}), gateTargetQubitIndex, qc::OpType::X));
+    expectedQuantumOperations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Controls({propagatedControlQubitIndex}), gateTargetQubitIndex, qc::OpType::X));
+    expectedQuantumOperations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Controls(), gateTargetQubitIndex, qc::OpType::X));
+    assertThatOperationsOfQuantumComputationAreEqualToSequence(*annotatedQuantumComputation, expectedQuantumOperations);
+}
+
 TEST_F(AnnotatableQuantumComputationTestsFixture, AddOperationsImplementingToffoliGateWithTargetLineMatchingActiveControlQubitInAnyParentControlQubitScope) {
     constexpr qc::Qubit expectedControlQubitIndexOne = 0;
     constexpr qc::Qubit expectedControlQubitIndexTwo = 1;
@@ -1983,6 +2091,76 @@ TEST_F(AnnotatableQuantumComputationTestsFixture, AddOperationsImplementingFredk
     const auto expectedAnnotationsOfAddedQuantumOperation = AnnotatableQuantumComputation::QuantumOperationAnnotationsLookup();
     assertThatAnnotationsOfQuantumOperationAreEqualTo(annotatableQuantumComputationWithQuantumOperationAnnotationsGenerationDisabled, 0, expectedAnnotationsOfAddedQuantumOperation);
 }
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, AddOperationsImplementingCnotGates) {
+    const std::vector<qc::Qubit> controlQubits = {0, 1, 2};
+    const std::vector<qc::Qubit> targetQubits  = {3, 4, 5};
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 6U));
+
+    annotatedQuantumComputation->activateControlQubitPropagationScope();
+    ASSERT_TRUE(annotatedQuantumComputation->registerControlQubitForPropagationInCurrentAndNestedScopes(0U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGates(controlQubits, targetQubits));
+
+    std::vector<std::unique_ptr<qc::Operation>> expectedQuantumOperations;
+    expectedQuantumOperations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Controls({0U}), 3U, qc::OpType::X));
+    expectedQuantumOperations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Controls({0U, 1U}), 4U, qc::OpType::X));
+    expectedQuantumOperations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Controls({0U, 2U}), 5U, qc::OpType::X));
+    assertThatOperationsOfQuantumComputationAreEqualToSequence(*annotatedQuantumComputation, expectedQuantumOperations);
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, AddOperationsImplementingCnotGatesWithEmptyQubitSequences) {
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 1U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGates({}, {}));
+    assertThatOperationsOfQuantumComputationAreEqualToSequence(*annotatedQuantumComputation, {});
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, AddOperationsImplementingCnotGatesWithMismatchingNumberOfControlAndTargetQubits) {
+    const std::vector<qc::Qubit> controlQubits = {0, 1};
+    const std::vector<qc::Qubit> targetQubits  = {2};
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 3U));
+
+    ASSERT_FALSE(annotatedQuantumComputation->addOperationsImplementingCnotGates(controlQubits, targetQubits));
+    assertThatOperationsOfQuantumComputationAreEqualToSequence(*annotatedQuantumComputation, {});
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, AddOperationsImplementingCnotGatesWithInvalidGateDoesNotAddAnyQuantumOperation) {
+    const std::vector<qc::Qubit> controlQubits = {0, 1, 2};
+    const std::vector<qc::Qubit> targetQubits  = {1, 2, 2};
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 3U));
+
+    ASSERT_FALSE(annotatedQuantumComputation->addOperationsImplementingCnotGates(controlQubits, targetQubits));
+    assertThatOperationsOfQuantumComputationAreEqualToSequence(*annotatedQuantumComputation, {});
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, AddOperationsImplementingCnotGatesWithUnknownQubitDoesNotAddAnyQuantumOperation) {
+    const std::vector<qc::Qubit> controlQubits = {0, 1};
+    const std::vector<qc::Qubit> targetQubits  = {1, 2};
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 2U));
+
+    ASSERT_FALSE(annotatedQuantumComputation->addOperationsImplementingCnotGates(controlQubits, targetQubits));
+    assertThatOperationsOfQuantumComputationAreEqualToSequence(*annotatedQuantumComputation, {});
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, AddOperationsImplementingFredkinGates) {
+    const std::vector<qc::Qubit> targetQubitsOne = {0, 1};
+    const std::vector<qc::Qubit> targetQubitsTwo = {2, 3};
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 4U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingFredkinGates(targetQubitsOne, targetQubitsTwo));
+
+    std::vector<std::unique_ptr<qc::Operation>> expectedQuantumOperations;
+    expectedQuantumOperations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Controls(), qc::Targets({0U, 2U}), qc::OpType::SWAP));
+    expectedQuantumOperations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Controls(), qc::Targets({1U, 3U}), qc::OpType::SWAP));
+    assertThatOperationsOfQuantumComputationAreEqualToSequence(*annotatedQuantumComputation, expectedQuantumOperations);
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, AddOperationsImplementingFredkinGatesWithInvalidGateDoesNotAddAnyQuantumOperation) {
+    const std::vector<qc::Qubit> targetQubitsOne = {0, 1};
+    const std::vector<qc::Qubit> targetQubitsTwo = {2, 1};
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 3U));
+
+    ASSERT_FALSE(annotatedQuantumComputation->addOperationsImplementingFredkinGates(targetQubitsOne, targetQubitsTwo));
+    assertThatOperationsOfQuantumComputationAreEqualToSequence(*annotatedQuantumComputation, {});
+}
 // END AddXGate tests
 
 // BEGIN Control line propagation scopes tests
@@ -3128,6 +3306,563 @@ TEST_F(AnnotatableQuantumComputationTestsFixture, ReplayQuantumOperationsWithQua
 }
 // END Replay operations tests
 
+// BEGIN Cancel adjacent self-inverse quantum operations tests
+TEST_F(AnnotatableQuantumComputationTestsFixture, PropagateConstantValuesOfAncillaryQubits) {
+    std::vector<std::unique_ptr<qc::Operation>> expectedQuantumComputations;
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 2U));
+
+    const auto inlineStack = std::make_shared<QubitInliningStack>();
+    ASSERT_TRUE(inlineStack->push(QubitInliningStack::QubitInliningStackEntry({.lineNumberOfCallOfTargetModule = std::nullopt, .isTargetModuleAccessedViaCallStmt = std::nullopt, .targetModule = std::make_shared<Module>("test")})));
+    const auto ancillaryQubitsSharedInlineInformation = AnnotatableQuantumComputation::InlinedQubitInformation({.userDeclaredQubitLabel = std::nullopt, .inlineStack = inlineStack});
+    ASSERT_NO_FATAL_FAILURE(assertAdditionOfAncillaryQuantumRegisterIsSuccessfulWithNewRegisterCreated(*annotatedQuantumComputation, "ancReg", AnnotatableQuantumComputation::QubitIndexRange({.firstQubitIndex = 2U, .lastQubitIndex = 3U}), {false, true}, ancillaryQubitsSharedInlineInformation));
+    ASSERT_NO_FATAL_FAILURE(annotatedQuantumComputation->promotePreliminaryAncillaryQubitsToDefinitiveAncillaryQubits());
+
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(2U, 0U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingToffoliGate(0U, 3U, 1U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(3U, 2U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(2U, 0U));
+    ASSERT_EQ(4U, annotatedQuantumComputation->propagateConstantQubitValues());
+
+    expectedQuantumComputations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Controls(), 3U, qc::OpType::X));
+    expectedQuantumComputations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Controls({0U}), 1U, qc::OpType::X));
+    expectedQuantumComputations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Controls(), 2U, qc::OpType::X));
+    expectedQuantumComputations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Controls(), 0U, qc::OpType::X));
+    assertThatOperationsOfQuantumComputationAreEqualToSequence(*annotatedQuantumComputation, expectedQuantumComputations);
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, PropagateConstantValuesRemovesSwapOfQubitsStoringSameValue) {
+    std::vector<std::unique_ptr<qc::Operation>> expectedQuantumComputations;
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 2U));
+
+    const auto inlineStack = std::make_shared<QubitInliningStack>();
+    ASSERT_TRUE(inlineStack->push(QubitInliningStack::QubitInliningStackEntry({.lineNumberOfCallOfTargetModule = std::nullopt, .isTargetModuleAccessedViaCallStmt = std::nullopt, .targetModule = std::make_shared<Module>("test")})));
+    const auto ancillaryQubitsSharedInlineInformation = AnnotatableQuantumComputation::InlinedQubitInformation({.userDeclaredQubitLabel = std::nullopt, .inlineStack = inlineStack});
+    ASSERT_NO_FATAL_FAILURE(assertAdditionOfAncillaryQuantumRegisterIsSuccessfulWithNewRegisterCreated(*annotatedQuantumComputation, "ancReg", AnnotatableQuantumComputation::QubitIndexRange({.firstQubitIndex = 2U, .lastQubitIndex = 3U}), {false, false}, ancillaryQubitsSharedInlineInformation));
+    ASSERT_NO_FATAL_FAILURE(annotatedQuantumComputation->promotePreliminaryAncillaryQubitsToDefinitiveAncillaryQubits());
+
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingFredkinGate(2U, 3U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(0U, 2U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(2U, 1U));
+    ASSERT_EQ(1U, annotatedQuantumComputation->propagateConstantQubitValues());
+
+    // The value of the ancillary qubit becomes unknown after the CNOT gate with the unknown control qubit, thus the last CNOT gate is kept.
+    expectedQuantumComputations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Controls({0U}), 2U, qc::OpType::X));
+    expectedQuantumComputations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Controls({2U}), 1U, qc::OpType::X));
+    assertThatOperationsOfQuantumComputationAreEqualToSequence(*annotatedQuantumComputation, expectedQuantumComputations);
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, PropagateConstantValuesDoesNotModifyQuantumOperationsOnNonAncillaryQubits) {
+    std::vector<std::unique_ptr<qc::Operation>> expectedQuantumComputations;
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 2U));
+
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(0U, 1U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(1U, 0U));
+    ASSERT_EQ(0U, annotatedQuantumComputation->propagateConstantQubitValues());
+
+    expectedQuantumComputations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Controls({0U}), 1U, qc::OpType::X));
+    expectedQuantumComputations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Controls({1U}), 0U, qc::OpType::X));
+    assertThatOperationsOfQuantumComputationAreEqualToSequence(*annotatedQuantumComputation, expectedQuantumComputations);
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, ApplyTemplateMergingMultiControlledXGateWithSubsetOfControlQubitsAcrossCommutingQuantumOperation) {
+    std::vector<std::unique_ptr<qc::Operation>> expectedQuantumComputations;
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 4U));
+
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(0U, 2U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(1U, 3U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingToffoliGate(0U, 1U, 2U));
+    ASSERT_EQ(1U, annotatedQuantumComputation->applyReversibleCircuitTemplates(64U));
+
+    expectedQuantumComputations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Controls({qc::Control{0U}, qc::Control{1U, qc::Control::Type::Neg}}), 2U, qc::OpType::X));
+    expectedQuantumComputations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Controls({1U}), 3U, qc::OpType::X));
+    assertThatOperationsOfQuantumComputationAreEqualToSequence(*annotatedQuantumComputation, expectedQuantumComputations);
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, ApplyTemplateMergingMultiControlledXGatesDifferingInPolarityOfControlQubit) {
+    std::vector<std::unique_ptr<qc::Operation>> expectedQuantumComputations;
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 3U));
+
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingMultiControlToffoliGate(qc::Controls({qc::Control{0U}, qc::Control{1U}}), 2U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingMultiControlToffoliGate(qc::Controls({qc::Control{0U}, qc::Control{1U, qc::Control::Type::Neg}}), 2U));
+    ASSERT_EQ(1U, annotatedQuantumComputation->applyReversibleCircuitTemplates(64U));
+
+    expectedQuantumComputations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Controls({0U}), 2U, qc::OpType::X));
+    assertThatOperationsOfQuantumComputationAreEqualToSequence(*annotatedQuantumComputation, expectedQuantumComputations);
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, ApplyTemplatesRepeatedUntilNoFurtherQuantumOperationIsRemoved) {
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 3U));
+
+    // The merge of the first two gates results in X(C = {0}) which is then cancelled by the last gate.
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingMultiControlToffoliGate(qc::Controls({qc::Control{0U}, qc::Control{1U}}), 2U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingMultiControlToffoliGate(qc::Controls({qc::Control{0U}, qc::Control{1U, qc::Control::Type::Neg}}), 2U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(0U, 2U));
+    ASSERT_EQ(3U, annotatedQuantumComputation->applyReversibleCircuitTemplates(64U));
+    assertThatOperationsOfQuantumComputationAreEqualToSequence(*annotatedQuantumComputation, {});
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, ApplyTemplatesDoesNotMoveMultiControlledXGateAcrossQuantumOperationModifyingItsControlQubit) {
+    std::vector<std::unique_ptr<qc::Operation>> expectedQuantumComputations;
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 2U));
+
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(0U, 1U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(0U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(0U, 1U));
+    ASSERT_EQ(0U, annotatedQuantumComputation->applyReversibleCircuitTemplates(64U));
+    ASSERT_EQ(0U, annotatedQuantumComputation->applyReversibleCircuitTemplates(0U));
+
+    expectedQuantumComputations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Controls({0U}), 1U, qc::OpType::X));
+    expectedQuantumComputations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Controls(), 0U, qc::OpType::X));
+    expectedQuantumComputations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Controls({0U}), 1U, qc::OpType::X));
+    assertThatOperationsOfQuantumComputationAreEqualToSequence(*annotatedQuantumComputation, expectedQuantumComputations);
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, CancelAdjacentIdenticalCnotGates) {
+    std::vector<std::unique_ptr<qc::Operation>> expectedQuantumComputations;
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 3U));
+
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(2U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(0U, 1U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(0U, 1U));
+    ASSERT_EQ(2U, annotatedQuantumComputation->cancelAdjacentSelfInverseQuantumOperations());
+
+    expectedQuantumComputations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Controls(), 2U, qc::OpType::X));
+    assertThatOperationsOfQuantumComputationAreEqualToSequence(*annotatedQuantumComputation, expectedQuantumComputations);
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, CancelNestedPairsOfIdenticalSelfInverseQuantumOperations) {
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 2U));
+
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(0U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(0U, 1U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(0U, 1U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(0U));
+    ASSERT_EQ(4U, annotatedQuantumComputation->cancelAdjacentSelfInverseQuantumOperations());
+    assertThatOperationsOfQuantumComputationAreEqualToSequence(*annotatedQuantumComputation, {});
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, CancelSelfInverseQuantumOperationsSeparatedByQuantumOperationOnDisjointQubits) {
+    std::vector<std::unique_ptr<qc::Operation>> expectedQuantumComputations;
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 3U));
+
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(0U, 1U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(2U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(0U, 1U));
+    ASSERT_EQ(2U, annotatedQuantumComputation->cancelAdjacentSelfInverseQuantumOperations());
+
+    expectedQuantumComputations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Controls(), 2U, qc::OpType::X));
+    assertThatOperationsOfQuantumComputationAreEqualToSequence(*annotatedQuantumComputation, expectedQuantumComputations);
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, SelfInverseQuantumOperationsSeparatedByQuantumOperationOnSharedQubitAreNotCancelled) {
+    std::vector<std::unique_ptr<qc::Operation>> expectedQuantumComputations;
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 3U));
+
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(0U, 1U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(2U, 0U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(0U, 1U));
+    ASSERT_EQ(0U, annotatedQuantumComputation->cancelAdjacentSelfInverseQuantumOperations());
+
+    expectedQuantumComputations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Control(0U), 1U, qc::OpType::X));
+    expectedQuantumComputations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Control(2U), 0U, qc::OpType::X));
+    expectedQuantumComputations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Control(0U), 1U, qc::OpType::X));
+    assertThatOperationsOfQuantumComputationAreEqualToSequence(*annotatedQuantumComputation, expectedQuantumComputations);
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, CnotGatesWithSwappedControlAndTargetQubitAreNotCancelled) {
+    std::vector<std::unique_ptr<qc::Operation>> expectedQuantumComputations;
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 2U));
+
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(0U, 1U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(1U, 0U));
+    ASSERT_EQ(0U, annotatedQuantumComputation->cancelAdjacentSelfInverseQuantumOperations());
+
+    expectedQuantumComputations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Control(0U), 1U, qc::OpType::X));
+    expectedQuantumComputations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Control(1U), 0U, qc::OpType::X));
+    assertThatOperationsOfQuantumComputationAreEqualToSequence(*annotatedQuantumComputation, expectedQuantumComputations);
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, CancelFredkinGatesWithSwappedTargetQubits) {
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 2U));
+
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingFredkinGate(0U, 1U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingFredkinGate(1U, 0U));
+    ASSERT_EQ(2U, annotatedQuantumComputation->cancelAdjacentSelfInverseQuantumOperations());
+    assertThatOperationsOfQuantumComputationAreEqualToSequence(*annotatedQuantumComputation, {});
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, AnnotationsOfRemainingQuantumOperationsAreKeptAfterCancellation) {
+    std::vector<std::unique_ptr<qc::Operation>> expectedQuantumComputations;
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 2U));
+
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(0U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(0U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(1U));
+
+    const std::string annotationKey = "KEY";
+    ASSERT_TRUE(annotatedQuantumComputation->setOrUpdateAnnotationOfQuantumOperation(0, annotationKey, "cancelled"));
+    ASSERT_TRUE(annotatedQuantumComputation->setOrUpdateAnnotationOfQuantumOperation(2, annotationKey, "kept"));
+    ASSERT_EQ(2U, annotatedQuantumComputation->cancelAdjacentSelfInverseQuantumOperations());
+
+    expectedQuantumComputations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Controls(), 1U, qc::OpType::X));
+    assertThatOperationsOfQuantumComputationAreEqualToSequence(*annotatedQuantumComputation, expectedQuantumComputations);
+    assertThatAnnotationsOfQuantumOperationAreEqualTo(*annotatedQuantumComputation, 0, {{annotationKey, "kept"}});
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, AnnotationsOfCancelledQuantumOperationsAreRemovedFromPartiallyAnnotatedQuantumComputation) {
+    std::vector<std::unique_ptr<qc::Operation>> expectedQuantumComputations;
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 2U));
+
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(0U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(0U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(1U));
+
+    // Only the first quantum operation, which is cancelled, is annotated.
+    const std::string annotationKey = "KEY";
+    ASSERT_TRUE(annotatedQuantumComputation->setOrUpdateAnnotationOfQuantumOperation(0, annotationKey, "cancelled"));
+    ASSERT_EQ(2U, annotatedQuantumComputation->cancelAdjacentSelfInverseQuantumOperations());
+
+    expectedQuantumComputations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Controls(), 1U, qc::OpType::X));
+    assertThatOperationsOfQuantumComputationAreEqualToSequence(*annotatedQuantumComputation, expectedQuantumComputations);
+    assertThatAnnotationsOfQuantumOperationAreEqualTo(*annotatedQuantumComputation, 0, {});
+}
+// END Cancel adjacent self-inverse quantum operations tests
+
+// BEGIN Streaming of quantum operations tests
+namespace {
+    class RecordingQuantumOperationSink: public QuantumOperationSink {
+    public:
+        std::vector<std::unique_ptr<qc::Operation>>    consumedQuantumOperations;
+        std::vector<QuantumOperationAnnotationsLookup> annotationsOfConsumedQuantumOperations;
+        std::optional<std::size_t>                     numQubitsNotifiedInFinish;
+
+        [[nodiscard]] bool consumeQuantumOperation(const qc::Operation& quantumOperation, const QuantumOperationAnnotationsLookup& annotationsOfQuantumOperation) override {
+            consumedQuantumOperations.emplace_back(quantumOperation.clone());
+            annotationsOfConsumedQuantumOperations.emplace_back(annotationsOfQuantumOperation);
+            return true;
+        }
+
+        [[nodiscard]] bool finish(const std::size_t numQubits) override {
+            numQubitsNotifiedInFinish = numQubits;
+            return true;
+        }
+    };
+} // namespace
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, StreamingToNullSinkNotPossible) {
+    ASSERT_FALSE(annotatedQuantumComputation->streamQuantumOperationsToSink(nullptr, 0U));
+    ASSERT_FALSE(annotatedQuantumComputation->isStreamingOfQuantumOperationsActive());
+    ASSERT_FALSE(annotatedQuantumComputation->finishStreamingOfQuantumOperations());
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, StreamingToSecondSinkWhileStreamingIsActiveNotPossible) {
+    ASSERT_TRUE(annotatedQuantumComputation->streamQuantumOperationsToSink(std::make_shared<RecordingQuantumOperationSink>(), 0U));
+    ASSERT_FALSE(annotatedQuantumComputation->streamQuantumOperationsToSink(std::make_shared<RecordingQuantumOperationSink>(), 0U));
+    ASSERT_TRUE(annotatedQuantumComputation->isStreamingOfQuantumOperationsActive());
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, QuantumOperationsNotInReplayWindowAreForwardedToSink) {
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 3U));
+    const auto sink = std::make_shared<RecordingQuantumOperationSink>();
+    ASSERT_TRUE(annotatedQuantumComputation->streamQuantumOperationsToSink(sink, 1U));
+
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(0U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(0U, 1U));
+    ASSERT_TRUE(sink->consumedQuantumOperations.empty());
+
+    // The quantum operations are forwarded once more than twice the number of quantum operations in the replay window are retained
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(2U));
+    ASSERT_EQ(2U, sink->consumedQuantumOperations.size());
+    ASSERT_TRUE(sink->consumedQuantumOperations[0]->equals(qc::StandardOperation(qc::Controls(), 0U, qc::OpType::X)));
+    ASSERT_TRUE(sink->consumedQuantumOperations[1]->equals(qc::StandardOperation(qc::Control(0U), 1U, qc::OpType::X)));
+
+    ASSERT_EQ(1U, annotatedQuantumComputation->getNops());
+    ASSERT_EQ(2U, annotatedQuantumComputation->getNumForwardedQuantumOperations());
+    ASSERT_EQ(3U, annotatedQuantumComputation->getNumQuantumOperations());
+    ASSERT_FALSE(sink->numQubitsNotifiedInFinish.has_value());
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, IndicesOfRetainedQuantumOperationsAreNotChangedByForwardingToSink) {
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 3U));
+    ASSERT_TRUE(annotatedQuantumComputation->streamQuantumOperationsToSink(std::make_shared<RecordingQuantumOperationSink>(), 1U));
+
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(0U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(0U, 1U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(2U));
+
+    ASSERT_THAT(annotatedQuantumComputation->getQuantumOperation(0), testing::IsNull());
+    ASSERT_THAT(annotatedQuantumComputation->getQuantumOperation(1), testing::IsNull());
+    const auto* retainedQuantumOperation = annotatedQuantumComputation->getQuantumOperation(2);
+    ASSERT_THAT(retainedQuantumOperation, testing::NotNull());
+    ASSERT_TRUE(retainedQuantumOperation->equals(qc::StandardOperation(qc::Controls(), 2U, qc::OpType::X)));
+
+    const std::string annotationKey = "KEY";
+    ASSERT_FALSE(annotatedQuantumComputation->setOrUpdateAnnotationOfQuantumOperation(1, annotationKey, "forwarded"));
+    ASSERT_TRUE(annotatedQuantumComputation->setOrUpdateAnnotationOfQuantumOperation(2, annotationKey, "retained"));
+    ASSERT_EQ(AnnotatableQuantumComputation::QuantumOperationAnnotationsLookup({{annotationKey, "retained"}}), annotatedQuantumComputation->getAnnotationsOfQuantumOperation(2));
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, ReplayOfQuantumOperationsForwardedToSinkNotPossible) {
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 3U));
+    ASSERT_TRUE(annotatedQuantumComputation->streamQuantumOperationsToSink(std::make_shared<RecordingQuantumOperationSink>(), 1U));
+
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(0U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(0U, 1U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(2U));
+
+    ASSERT_FALSE(annotatedQuantumComputation->replayOperationsAtGivenIndexRange(1, 2));
+    ASSERT_FALSE(annotatedQuantumComputation->replayOperationsWithRemappedQubits(0, 2, {}));
+    ASSERT_EQ(3U, annotatedQuantumComputation->getNumQuantumOperations());
+
+    ASSERT_TRUE(annotatedQuantumComputation->replayOperationsAtGivenIndexRange(2, 2));
+    ASSERT_EQ(4U, annotatedQuantumComputation->getNumQuantumOperations());
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, FinishStreamingForwardsAllRetainedQuantumOperationsWithTheirAnnotationsToSink) {
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 2U));
+    const auto sink = std::make_shared<RecordingQuantumOperationSink>();
+    ASSERT_TRUE(annotatedQuantumComputation->streamQuantumOperationsToSink(sink, 5U));
+
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(0U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(0U, 1U));
+
+    const std::string annotationKey = "KEY";
+    ASSERT_TRUE(annotatedQuantumComputation->setOrUpdateAnnotationOfQuantumOperation(0, annotationKey, "value"));
+    ASSERT_TRUE(sink->consumedQuantumOperations.empty());
+
+    ASSERT_TRUE(annotatedQuantumComputation->finishStreamingOfQuantumOperations());
+    ASSERT_FALSE(annotatedQuantumComputation->isStreamingOfQuantumOperationsActive());
+    ASSERT_EQ(0U, annotatedQuantumComputation->getNops());
+    ASSERT_EQ(2U, annotatedQuantumComputation->getNumQuantumOperations());
+
+    ASSERT_EQ(2U, sink->consumedQuantumOperations.size());
+    ASSERT_TRUE(sink->consumedQuantumOperations[0]->equals(qc::StandardOperation(qc::Controls(), 0U, qc::OpType::X)));
+    ASSERT_TRUE(sink->consumedQuantumOperations[1]->equals(qc::StandardOperation(qc::Control(0U), 1U, qc::OpType::X)));
+    ASSERT_EQ(AnnotatableQuantumComputation::QuantumOperationAnnotationsLookup({{annotationKey, "value"}}), sink->annotationsOfConsumedQuantumOperations[0]);
+    ASSERT_TRUE(sink->annotationsOfConsumedQuantumOperations[1].empty());
+    ASSERT_EQ(std::optional<std::size_t>(2U), sink->numQubitsNotifiedInFinish);
+}
+// END Streaming of quantum operations tests
+
+// BEGIN Synthesis cost tests
+namespace {
+    AnnotatableQuantumComputation::SynthesisCost determineSynthesisCostOfRetainedQuantumOperations(const AnnotatableQuantumComputation& annotatableQuantumComputation) {
+        AnnotatableQuantumComputation::SynthesisCost synthesisCost;
+        for (std::size_t i = 0; i < annotatableQuantumComputation.getNops(); ++i) {
+            const qc::Operation& quantumOperation = *annotatableQuantumComputation.at(i);
+            synthesisCost.quantumCost += AnnotatableQuantumComputation::getQuantumCostForSynthesisOfGate(quantumOperation.getNcontrols(), quantumOperation.getType() == qc::OpType::SWAP, annotatableQuantumComputation.getNqubits());
+            synthesisCost.transistorCost += AnnotatableQuantumComputation::getTransistorCostForSynthesisOfGate(quantumOperation.getNcontrols());
+        }
+        return synthesisCost;
+    }
+
+    void assertRecordedSynthesisCostMatchesOneOfRetainedQuantumOperations(const AnnotatableQuantumComputation& annotatableQuantumComputation) {
+        const AnnotatableQuantumComputation::SynthesisCost expectedSynthesisCost = determineSynthesisCostOfRetainedQuantumOperations(annotatableQuantumComputation);
+        ASSERT_EQ(expectedSynthesisCost.quantumCost, annotatableQuantumComputation.getQuantumCostForSynthesis());
+        ASSERT_EQ(expectedSynthesisCost.transistorCost, annotatableQuantumComputation.getTransistorCostForSynthesis());
+    }
+} // namespace
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, SynthesisCostIsUpdatedForAddedQuantumOperations) {
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 3U));
+    ASSERT_EQ(0U, annotatedQuantumComputation->getQuantumCostForSynthesis());
+    ASSERT_EQ(0U, annotatedQuantumComputation->getTransistorCostForSynthesis());
+
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(0U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(0U, 1U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingToffoliGate(0U, 1U, 2U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingFredkinGate(1U, 2U));
+    ASSERT_EQ(8U, annotatedQuantumComputation->getQuantumCostForSynthesis());
+    ASSERT_EQ(24U, annotatedQuantumComputation->getTransistorCostForSynthesis());
+
+    ASSERT_TRUE(annotatedQuantumComputation->replayOperationsAtGivenIndexRange(1, 2));
+    ASSERT_TRUE(annotatedQuantumComputation->replayOperationsWithRemappedQubits(2, 1, {{.mappedQubitIndexRange = {.firstQubitIndex = 2U, .lastQubitIndex = 2U}, .firstQubitIndexOfMappingTarget = 0U}}));
+    ASSERT_NO_FATAL_FAILURE(assertRecordedSynthesisCostMatchesOneOfRetainedQuantumOperations(*annotatedQuantumComputation));
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, QuantumCostIsDeterminedUsingCurrentNumberOfQubits) {
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 5U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingMultiControlToffoliGate(qc::Controls({0U, 1U, 2U, 3U}), 4U));
+    ASSERT_EQ(29U, annotatedQuantumComputation->getQuantumCostForSynthesis());
+
+    // The additional empty qubits reduce the quantum cost of the already added quantum operation
+    ASSERT_TRUE(annotatedQuantumComputation->addPreliminaryAncillaryRegisterOrAppendToAdjacentOne("ancillaryReg", {false, false}, AnnotatableQuantumComputation::InlinedQubitInformation()).has_value());
+    ASSERT_EQ(26U, annotatedQuantumComputation->getQuantumCostForSynthesis());
+    ASSERT_NO_FATAL_FAILURE(assertRecordedSynthesisCostMatchesOneOfRetainedQuantumOperations(*annotatedQuantumComputation));
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, SynthesisCostOfCancelledQuantumOperationsIsRemoved) {
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 3U));
+    ASSERT_FALSE(annotatedQuantumComputation->setOrUpdateGlobalQuantumOperationAnnotation(AnnotatableQuantumComputation::QUANTUM_OPERATION_ANNOTATION_KEY_ASSOCIATED_STATEMENT_LINE_NUMBER, "1"));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(2U));
+    ASSERT_TRUE(annotatedQuantumComputation->setOrUpdateGlobalQuantumOperationAnnotation(AnnotatableQuantumComputation::QUANTUM_OPERATION_ANNOTATION_KEY_ASSOCIATED_STATEMENT_LINE_NUMBER, "2"));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingToffoliGate(0U, 1U, 2U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingToffoliGate(0U, 1U, 2U));
+    ASSERT_EQ(2U, annotatedQuantumComputation->getSynthesisCostPerStatementLineNumber().size());
+
+    ASSERT_EQ(2U, annotatedQuantumComputation->cancelAdjacentSelfInverseQuantumOperations());
+    ASSERT_EQ(1U, annotatedQuantumComputation->getQuantumCostForSynthesis());
+    ASSERT_EQ(0U, annotatedQuantumComputation->getTransistorCostForSynthesis());
+
+    const auto synthesisCostPerStatementLineNumber = annotatedQuantumComputation->getSynthesisCostPerStatementLineNumber();
+    ASSERT_EQ(1U, synthesisCostPerStatementLineNumber.size());
+    ASSERT_TRUE(synthesisCostPerStatementLineNumber.contains("1"));
+    ASSERT_EQ(AnnotatableQuantumComputation::SynthesisCost({.quantumCost = 1U, .transistorCost = 0U}), synthesisCostPerStatementLineNumber.at("1"));
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, SynthesisCostOfQuantumOperationsForwardedToSinkIsRemoved) {
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 3U));
+    ASSERT_TRUE(annotatedQuantumComputation->streamQuantumOperationsToSink(std::make_shared<RecordingQuantumOperationSink>(), 1U));
+
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingToffoliGate(0U, 1U, 2U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingToffoliGate(0U, 2U, 1U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(0U, 1U));
+    ASSERT_EQ(1U, annotatedQuantumComputation->getNops());
+    ASSERT_EQ(1U, annotatedQuantumComputation->getQuantumCostForSynthesis());
+    ASSERT_EQ(8U, annotatedQuantumComputation->getTransistorCostForSynthesis());
+
+    ASSERT_TRUE(annotatedQuantumComputation->finishStreamingOfQuantumOperations());
+    ASSERT_EQ(0U, annotatedQuantumComputation->getQuantumCostForSynthesis());
+    ASSERT_EQ(0U, annotatedQuantumComputation->getTransistorCostForSynthesis());
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, SynthesisCostIsAttributedToStatementLineNumberOfQuantumOperation) {
+    const std::string_view statementLineNumberAnnotationKey = AnnotatableQuantumComputation::QUANTUM_OPERATION_ANNOTATION_KEY_ASSOCIATED_STATEMENT_LINE_NUMBER;
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 3U));
+
+    // Quantum operations without a statement line number annotation are only considered in the synthesis cost of the whole quantum computation
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(0U));
+    ASSERT_FALSE(annotatedQuantumComputation->setOrUpdateGlobalQuantumOperationAnnotation(statementLineNumberAnnotationKey, "3"));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingToffoliGate(0U, 1U, 2U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(0U, 1U));
+    ASSERT_TRUE(annotatedQuantumComputation->setOrUpdateGlobalQuantumOperationAnnotation(statementLineNumberAnnotationKey, "7"));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingFredkinGate(0U, 2U));
+
+    // The replayed quantum operations are attributed to the statement line number active during the replay while the remapped ones keep the annotations of the replayed quantum operations
+    ASSERT_TRUE(annotatedQuantumComputation->replayOperationsAtGivenIndexRange(2, 2));
+    ASSERT_TRUE(annotatedQuantumComputation->replayOperationsWithRemappedQubits(1, 1, {}));
+
+    const auto synthesisCostPerStatementLineNumber = annotatedQuantumComputation->getSynthesisCostPerStatementLineNumber();
+    ASSERT_EQ(2U, synthesisCostPerStatementLineNumber.size());
+    ASSERT_EQ(AnnotatableQuantumComputation::SynthesisCost({.quantumCost = 11U, .transistorCost = 40U}), synthesisCostPerStatementLineNumber.at("3"));
+    ASSERT_EQ(AnnotatableQuantumComputation::SynthesisCost({.quantumCost = 2U, .transistorCost = 8U}), synthesisCostPerStatementLineNumber.at("7"));
+    ASSERT_NO_FATAL_FAILURE(assertRecordedSynthesisCostMatchesOneOfRetainedQuantumOperations(*annotatedQuantumComputation));
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, SynthesisCostPerStatementLineNumberIsEmptyIfAnnotationsAreDisabled) {
+    AnnotatableQuantumComputation annotatableQuantumComputationWithoutAnnotations(false);
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(annotatableQuantumComputationWithoutAnnotations, 3U));
+
+    ASSERT_FALSE(annotatableQuantumComputationWithoutAnnotations.setOrUpdateGlobalQuantumOperationAnnotation(AnnotatableQuantumComputation::QUANTUM_OPERATION_ANNOTATION_KEY_ASSOCIATED_STATEMENT_LINE_NUMBER, "1"));
+    ASSERT_TRUE(annotatableQuantumComputationWithoutAnnotations.addOperationsImplementingToffoliGate(0U, 1U, 2U));
+    ASSERT_EQ(5U, annotatableQuantumComputationWithoutAnnotations.getQuantumCostForSynthesis());
+    ASSERT_EQ(16U, annotatableQuantumComputationWithoutAnnotations.getTransistorCostForSynthesis());
+    ASSERT_TRUE(annotatableQuantumComputationWithoutAnnotations.getSynthesisCostPerStatementLineNumber().empty());
+}
+// END Synthesis cost tests
+
+// BEGIN Depth analysis tests
+TEST_F(AnnotatableQuantumComputationTestsFixture, DepthAnalysisOfEmptyQuantumComputation) {
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 2U));
+
+    const AnnotatableQuantumComputation::DepthAnalysis depthAnalysis = annotatedQuantumComputation->analyzeDepth();
+    ASSERT_EQ(0U, depthAnalysis.depth);
+    ASSERT_EQ(std::vector<std::size_t>({0U, 0U}), depthAnalysis.numQuantumOperationsPerQubit);
+    ASSERT_TRUE(depthAnalysis.layerPerQuantumOperation.empty());
+    ASSERT_TRUE(depthAnalysis.indicesOfQuantumOperationsOfCriticalPath.empty());
+    ASSERT_TRUE(depthAnalysis.numQuantumOperationsOfCriticalPathPerStatementLineNumber.empty());
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, DepthAnalysisDeterminesLayersAndCriticalPath) {
+    const std::string_view statementLineNumberAnnotationKey = AnnotatableQuantumComputation::QUANTUM_OPERATION_ANNOTATION_KEY_ASSOCIATED_STATEMENT_LINE_NUMBER;
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 4U));
+
+    ASSERT_FALSE(annotatedQuantumComputation->setOrUpdateGlobalQuantumOperationAnnotation(statementLineNumberAnnotationKey, "1"));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(0U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(1U, 2U));
+    ASSERT_TRUE(annotatedQuantumComputation->setOrUpdateGlobalQuantumOperationAnnotation(statementLineNumberAnnotationKey, "2"));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingToffoliGate(0U, 2U, 3U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(1U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(3U, 0U));
+
+    // The Toffoli gate can only be executed after both of the quantum operations of the first layer while the predecessor on the critical path is the first of the latter
+    const AnnotatableQuantumComputation::DepthAnalysis depthAnalysis = annotatedQuantumComputation->analyzeDepth();
+    ASSERT_EQ(3U, depthAnalysis.depth);
+    ASSERT_EQ(std::vector<std::size_t>({3U, 2U, 2U, 2U}), depthAnalysis.numQuantumOperationsPerQubit);
+    ASSERT_EQ(std::vector<std::size_t>({0U, 0U, 1U, 1U, 2U}), depthAnalysis.layerPerQuantumOperation);
+    ASSERT_EQ(std::vector<std::size_t>({0U, 2U, 4U}), depthAnalysis.indicesOfQuantumOperationsOfCriticalPath);
+
+    const std::map<std::string, std::size_t, std::less<>> expectedNumQuantumOperationsOfCriticalPathPerStatementLineNumber = {{"1", 1U}, {"2", 2U}};
+    ASSERT_EQ(expectedNumQuantumOperationsOfCriticalPathPerStatementLineNumber, depthAnalysis.numQuantumOperationsOfCriticalPathPerStatementLineNumber);
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, DepthAnalysisOnlyConsidersRetainedQuantumOperations) {
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 3U));
+    ASSERT_TRUE(annotatedQuantumComputation->streamQuantumOperationsToSink(std::make_shared<RecordingQuantumOperationSink>(), 1U));
+
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingToffoliGate(0U, 1U, 2U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingToffoliGate(0U, 2U, 1U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(0U, 1U));
+    ASSERT_EQ(1U, annotatedQuantumComputation->getNops());
+
+    // The indices of the quantum operations of the critical path are the ones in the quantum computation and thus include the number of forwarded quantum operations
+    const AnnotatableQuantumComputation::DepthAnalysis depthAnalysis = annotatedQuantumComputation->analyzeDepth();
+    ASSERT_EQ(1U, depthAnalysis.depth);
+    ASSERT_EQ(std::vector<std::size_t>({1U, 1U, 0U}), depthAnalysis.numQuantumOperationsPerQubit);
+    ASSERT_EQ(std::vector<std::size_t>({0U}), depthAnalysis.layerPerQuantumOperation);
+    ASSERT_EQ(std::vector<std::size_t>({2U}), depthAnalysis.indicesOfQuantumOperationsOfCriticalPath);
+    ASSERT_TRUE(annotatedQuantumComputation->finishStreamingOfQuantumOperations());
+}
+// END Depth analysis tests
+
+// BEGIN Reorder quantum operations to reduce depth tests
+TEST_F(AnnotatableQuantumComputationTestsFixture, ReorderCnotGatesSharingTargetQubitToReduceDepth) {
+    std::vector<std::unique_ptr<qc::Operation>> expectedQuantumComputations;
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 4U));
+
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(2U, 3U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(2U, 1U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(0U, 1U));
+
+    const std::string annotationKey = "KEY";
+    for (const auto quantumOperationIdx: std::views::iota(0U, 3U)) {
+        ASSERT_TRUE(annotatedQuantumComputation->setOrUpdateAnnotationOfQuantumOperation(quantumOperationIdx, annotationKey, std::to_string(quantumOperationIdx)));
+    }
+    ASSERT_EQ(3U, annotatedQuantumComputation->analyzeDepth().depth);
+
+    // The last CNOT gate commutes with the second one since both only share their target qubit and can thus be executed in parallel to the first CNOT gate
+    ASSERT_EQ(1U, annotatedQuantumComputation->reorderQuantumOperationsToReduceDepth());
+    ASSERT_EQ(2U, annotatedQuantumComputation->analyzeDepth().depth);
+
+    expectedQuantumComputations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Control(2U), 3U, qc::OpType::X));
+    expectedQuantumComputations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Control(0U), 1U, qc::OpType::X));
+    expectedQuantumComputations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Control(2U), 1U, qc::OpType::X));
+    assertThatOperationsOfQuantumComputationAreEqualToSequence(*annotatedQuantumComputation, expectedQuantumComputations);
+    assertThatAnnotationsOfQuantumOperationAreEqualTo(*annotatedQuantumComputation, 0, {{annotationKey, "0"}});
+    assertThatAnnotationsOfQuantumOperationAreEqualTo(*annotatedQuantumComputation, 1, {{annotationKey, "2"}});
+    assertThatAnnotationsOfQuantumOperationAreEqualTo(*annotatedQuantumComputation, 2, {{annotationKey, "1"}});
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, QuantumOperationsNotCommutingAreNotReordered) {
+    std::vector<std::unique_ptr<qc::Operation>> expectedQuantumComputations;
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 4U));
+
+    // The target qubits of a SWAP gate do not commute with any other usage of said qubits
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(2U, 3U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingFredkinGate(1U, 2U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(0U, 1U));
+    // The target qubit of the CNOT gate is the control qubit of the previous one
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(3U, 0U));
+    ASSERT_EQ(0U, annotatedQuantumComputation->reorderQuantumOperationsToReduceDepth());
+
+    expectedQuantumComputations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Control(2U), 3U, qc::OpType::X));
+    expectedQuantumComputations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Controls(), qc::Targets({1U, 2U}), qc::OpType::SWAP));
+    expectedQuantumComputations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Control(0U), 1U, qc::OpType::X));
+    expectedQuantumComputations.emplace_back(std::make_unique<qc::StandardOperation>(qc::Control(3U), 0U, qc::OpType::X));
+    assertThatOperationsOfQuantumComputationAreEqualToSequence(*annotatedQuantumComputation, expectedQuantumComputations);
+}
+// END Reorder quantum operations to reduce depth tests
+
 TEST_F(AnnotatableQuantumComputationTestsFixture, GetQuantumOperationUsingOutOfRangeIndexNotPossible) {
     std::vector<std::unique_ptr<qc::Operation>> expectedQuantumComputations;
 
@@ -3271,3 +4006,169 @@ TEST_F(AnnotatableQuantumComputationTestsFixture, GetInlineQubitInformationForQu
     }
 }
 // END getInlineQubitInformation tests
+
+// BEGIN Export of quantum operations as arrays tests
+TEST_F(AnnotatableQuantumComputationTestsFixture, ExportQuantumOperationsAsArrays) {
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 4U));
+    ASSERT_FALSE(annotatedQuantumComputation->setOrUpdateGlobalQuantumOperationAnnotation("key", "valueOne"));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(0U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingToffoliGate(2U, 0U, 3U));
+    ASSERT_TRUE(annotatedQuantumComputation->setOrUpdateGlobalQuantumOperationAnnotation("key", "valueTwo"));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingFredkinGate(1U, 2U));
+    ASSERT_TRUE(annotatedQuantumComputation->setOrUpdateGlobalQuantumOperationAnnotation("key", "valueOne"));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(3U, 1U));
+
+    const AnnotatableQuantumComputation::QuantumOperationArrays quantumOperationArrays = annotatedQuantumComputation->exportQuantumOperationsAsArrays();
+    ASSERT_EQ(0U, quantumOperationArrays.indexOfFirstQuantumOperation);
+    ASSERT_THAT(quantumOperationArrays.opTypes, testing::ElementsAre(qc::OpType::X, qc::OpType::X, qc::OpType::SWAP, qc::OpType::X));
+    ASSERT_THAT(quantumOperationArrays.targetOffsets, testing::ElementsAre(0U, 1U, 2U, 4U, 5U));
+    ASSERT_THAT(quantumOperationArrays.targetQubits, testing::ElementsAre(0U, 3U, 1U, 2U, 1U));
+    ASSERT_THAT(quantumOperationArrays.controlOffsets, testing::ElementsAre(0U, 0U, 2U, 2U, 3U));
+    ASSERT_THAT(quantumOperationArrays.controlQubits, testing::ElementsAre(0U, 2U, 3U));
+    ASSERT_THAT(quantumOperationArrays.isControlPositive, testing::ElementsAre(1U, 1U, 1U));
+    ASSERT_THAT(quantumOperationArrays.annotationsIndices, testing::ElementsAre(0U, 0U, 1U, 0U));
+
+    const AnnotatableQuantumComputation::QuantumOperationAnnotationsLookup expectedFirstAnnotations  = {{"key", "valueOne"}};
+    const AnnotatableQuantumComputation::QuantumOperationAnnotationsLookup expectedSecondAnnotations = {{"key", "valueTwo"}};
+    ASSERT_THAT(quantumOperationArrays.distinctAnnotations, testing::ElementsAre(expectedFirstAnnotations, expectedSecondAnnotations));
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, ExportQuantumOperationsAsArraysWithAnnotationsGenerationDisabled) {
+    AnnotatableQuantumComputation annotatableQuantumComputationWithQuantumOperationAnnotationsGenerationDisabled(false);
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(annotatableQuantumComputationWithQuantumOperationAnnotationsGenerationDisabled, 2U));
+    ASSERT_TRUE(annotatableQuantumComputationWithQuantumOperationAnnotationsGenerationDisabled.addOperationsImplementingCnotGate(0U, 1U));
+    ASSERT_TRUE(annotatableQuantumComputationWithQuantumOperationAnnotationsGenerationDisabled.addOperationsImplementingNotGate(0U));
+
+    const AnnotatableQuantumComputation::QuantumOperationArrays quantumOperationArrays = annotatableQuantumComputationWithQuantumOperationAnnotationsGenerationDisabled.exportQuantumOperationsAsArrays();
+    ASSERT_THAT(quantumOperationArrays.opTypes, testing::ElementsAre(qc::OpType::X, qc::OpType::X));
+    ASSERT_THAT(quantumOperationArrays.annotationsIndices, testing::ElementsAre(0U, 0U));
+    ASSERT_EQ(1U, quantumOperationArrays.distinctAnnotations.size());
+    ASSERT_TRUE(quantumOperationArrays.distinctAnnotations.front().empty());
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, ExportQuantumOperationsAsArraysOfEmptyQuantumComputation) {
+    const AnnotatableQuantumComputation::QuantumOperationArrays quantumOperationArrays = annotatedQuantumComputation->exportQuantumOperationsAsArrays();
+    ASSERT_TRUE(quantumOperationArrays.opTypes.empty());
+    ASSERT_THAT(quantumOperationArrays.targetOffsets, testing::ElementsAre(0U));
+    ASSERT_THAT(quantumOperationArrays.controlOffsets, testing::ElementsAre(0U));
+    ASSERT_TRUE(quantumOperationArrays.distinctAnnotations.empty());
+}
+// END Export of quantum operations as arrays tests
+
+// BEGIN Layout of quantum operations tests
+TEST_F(AnnotatableQuantumComputationTestsFixture, LayoutOfQuantumOperationsPlacesGatesWithDisjointSpansInSameColumn) {
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 4U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(0U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(3U, 2U));
+    // The span of the Toffoli gate covers the qubit 1 and thus overlaps the spans of both previous gates
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingToffoliGate(0U, 3U, 1U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(1U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(0U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(2U, 3U));
+
+    const AnnotatableQuantumComputation::QuantumOperationLayout layout = annotatedQuantumComputation->determineLayoutOfQuantumOperations();
+    ASSERT_EQ(3U, layout.numColumns);
+    ASSERT_THAT(layout.columnPerGate, testing::ElementsAre(0U, 0U, 1U, 2U, 2U, 2U));
+    ASSERT_THAT(layout.minQubitPerGate, testing::ElementsAre(0U, 2U, 0U, 1U, 0U, 2U));
+    ASSERT_THAT(layout.maxQubitPerGate, testing::ElementsAre(0U, 3U, 3U, 1U, 0U, 3U));
+    ASSERT_THAT(layout.columnOffsets, testing::ElementsAre(0U, 2U, 3U, 6U));
+    ASSERT_THAT(layout.gatesOrderedByColumn, testing::ElementsAre(0U, 1U, 2U, 3U, 4U, 5U));
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, LayoutOfQuantumOperationsOrdersGatesByColumn) {
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 3U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(0U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(0U));
+    // The gate is placed in the first column since no previous gate operated on its qubit
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(2U));
+
+    const AnnotatableQuantumComputation::QuantumOperationLayout layout = annotatedQuantumComputation->determineLayoutOfQuantumOperations();
+    ASSERT_EQ(2U, layout.numColumns);
+    ASSERT_THAT(layout.columnPerGate, testing::ElementsAre(0U, 1U, 0U));
+    ASSERT_THAT(layout.columnOffsets, testing::ElementsAre(0U, 2U, 3U));
+    ASSERT_THAT(layout.gatesOrderedByColumn, testing::ElementsAre(0U, 2U, 1U));
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, LayoutOfEmptyQuantumComputation) {
+    const AnnotatableQuantumComputation::QuantumOperationLayout layout = annotatedQuantumComputation->determineLayoutOfQuantumOperations();
+    ASSERT_EQ(0U, layout.numColumns);
+    ASSERT_TRUE(layout.columnPerGate.empty());
+    ASSERT_THAT(layout.columnOffsets, testing::ElementsAre(0U));
+    ASSERT_TRUE(layout.gatesOrderedByColumn.empty());
+}
+// END Layout of quantum operations tests
+
+// BEGIN Freezing tests
+TEST_F(AnnotatableQuantumComputationTestsFixture, FrozenQuantumComputationMatchesAnalysesOfQuantumComputation) {
+    const std::string_view statementLineNumberAnnotationKey = AnnotatableQuantumComputation::QUANTUM_OPERATION_ANNOTATION_KEY_ASSOCIATED_STATEMENT_LINE_NUMBER;
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 4U));
+
+    ASSERT_FALSE(annotatedQuantumComputation->setOrUpdateGlobalQuantumOperationAnnotation(statementLineNumberAnnotationKey, "1"));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingNotGate(0U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(1U, 2U));
+    ASSERT_TRUE(annotatedQuantumComputation->setOrUpdateGlobalQuantumOperationAnnotation(statementLineNumberAnnotationKey, "2"));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingToffoliGate(0U, 2U, 3U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingFredkinGate(1U, 3U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(3U, 0U));
+
+    const FrozenQuantumComputation::ptr frozenQuantumComputation = annotatedQuantumComputation->freeze();
+    ASSERT_THAT(frozenQuantumComputation, testing::NotNull());
+    ASSERT_EQ(annotatedQuantumComputation->getNqubits(), frozenQuantumComputation->getNqubits());
+    ASSERT_EQ(annotatedQuantumComputation->getNops(), frozenQuantumComputation->getNops());
+    ASSERT_EQ(annotatedQuantumComputation->getQuantumCostForSynthesis(), frozenQuantumComputation->getQuantumCostForSynthesis());
+    ASSERT_EQ(annotatedQuantumComputation->getTransistorCostForSynthesis(), frozenQuantumComputation->getTransistorCostForSynthesis());
+    ASSERT_EQ(annotatedQuantumComputation->getSynthesisCostPerStatementLineNumber(), frozenQuantumComputation->getSynthesisCostPerStatementLineNumber());
+    ASSERT_EQ(annotatedQuantumComputation->determineNearestNeighborCost(), frozenQuantumComputation->determineNearestNeighborCost());
+    ASSERT_EQ(annotatedQuantumComputation->getQubitLabels(AnnotatableQuantumComputation::QubitLabelType::Internal), frozenQuantumComputation->getQubitLabels(AnnotatableQuantumComputation::QubitLabelType::Internal));
+    ASSERT_EQ(annotatedQuantumComputation->getQubitLabels(AnnotatableQuantumComputation::QubitLabelType::UserDeclared), frozenQuantumComputation->getQubitLabels(AnnotatableQuantumComputation::QubitLabelType::UserDeclared));
+
+    const AnnotatableQuantumComputation::DepthAnalysis expectedDepthAnalysis = annotatedQuantumComputation->analyzeDepth();
+    const AnnotatableQuantumComputation::DepthAnalysis actualDepthAnalysis   = frozenQuantumComputation->analyzeDepth();
+    ASSERT_EQ(expectedDepthAnalysis.depth, actualDepthAnalysis.depth);
+    ASSERT_EQ(expectedDepthAnalysis.numQuantumOperationsPerQubit, actualDepthAnalysis.numQuantumOperationsPerQubit);
+    ASSERT_EQ(expectedDepthAnalysis.layerPerQuantumOperation, actualDepthAnalysis.layerPerQuantumOperation);
+    ASSERT_EQ(expectedDepthAnalysis.indicesOfQuantumOperationsOfCriticalPath, actualDepthAnalysis.indicesOfQuantumOperationsOfCriticalPath);
+    ASSERT_EQ(expectedDepthAnalysis.numQuantumOperationsOfCriticalPathPerStatementLineNumber, actualDepthAnalysis.numQuantumOperationsOfCriticalPathPerStatementLineNumber);
+
+    const AnnotatableQuantumComputation::QuantumOperationLayout expectedLayout = annotatedQuantumComputation->determineLayoutOfQuantumOperations();
+    const AnnotatableQuantumComputation::QuantumOperationLayout actualLayout   = frozenQuantumComputation->determineLayoutOfQuantumOperations();
+    ASSERT_EQ(expectedLayout.numColumns, actualLayout.numColumns);
+    ASSERT_EQ(expectedLayout.columnPerGate, actualLayout.columnPerGate);
+    ASSERT_EQ(expectedLayout.gatesOrderedByColumn, actualLayout.gatesOrderedByColumn);
+
+    for (std::size_t i = 0; i < annotatedQuantumComputation->getNops(); ++i) {
+        ASSERT_EQ(annotatedQuantumComputation->getStatementLineNumberOfQuantumOperation(i), frozenQuantumComputation->getStatementLineNumberOfQuantumOperation(i));
+        const AnnotatableQuantumComputation::QuantumOperationAnnotationsLookup* actualAnnotations = frozenQuantumComputation->getAnnotationsOfQuantumOperation(i);
+        ASSERT_THAT(actualAnnotations, testing::NotNull());
+        ASSERT_EQ(annotatedQuantumComputation->getAnnotationsOfQuantumOperation(i), *actualAnnotations);
+    }
+    ASSERT_THAT(frozenQuantumComputation->getAnnotationsOfQuantumOperation(annotatedQuantumComputation->getNops()), testing::IsNull());
+    ASSERT_FALSE(frozenQuantumComputation->getStatementLineNumberOfQuantumOperation(annotatedQuantumComputation->getNops()).has_value());
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, FrozenQuantumComputationIsNotAffectedByLaterModifications) {
+    ASSERT_NO_FATAL_FAILURE(create1DQuantumRegisterContainingNQubits(*annotatedQuantumComputation, 3U));
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingToffoliGate(0U, 1U, 2U));
+
+    const FrozenQuantumComputation::ptr frozenQuantumComputation = annotatedQuantumComputation->freeze();
+    ASSERT_TRUE(annotatedQuantumComputation->addOperationsImplementingCnotGate(0U, 1U));
+    ASSERT_EQ(2U, annotatedQuantumComputation->getNops());
+
+    ASSERT_EQ(1U, frozenQuantumComputation->getNops());
+    ASSERT_EQ(1U, frozenQuantumComputation->getNumGates());
+    ASSERT_THAT(frozenQuantumComputation->getTargetQubitsOfGate(0), testing::ElementsAre(2U));
+    ASSERT_THAT(frozenQuantumComputation->getControlQubitsOfGate(0), testing::ElementsAre(0U, 1U));
+    ASSERT_EQ(5U, frozenQuantumComputation->getQuantumCostForSynthesis());
+    ASSERT_EQ(1U, frozenQuantumComputation->analyzeDepth().depth);
+}
+
+TEST_F(AnnotatableQuantumComputationTestsFixture, FrozenQuantumComputationOfEmptyQuantumComputation) {
+    const FrozenQuantumComputation::ptr frozenQuantumComputation = annotatedQuantumComputation->freeze();
+    ASSERT_EQ(0U, frozenQuantumComputation->getNops());
+    ASSERT_EQ(0U, frozenQuantumComputation->getNumGates());
+    ASSERT_THAT(frozenQuantumComputation->getGateOffsets(), testing::ElementsAre(0U));
+    ASSERT_EQ(0U, frozenQuantumComputation->analyzeDepth().depth);
+    ASSERT_EQ(0U, frozenQuantumComputation->determineLayoutOfQuantumOperations().numColumns);
+    ASSERT_EQ(0U, frozenQuantumComputation->determineNearestNeighborCost());
+}
+// END Freezing tests
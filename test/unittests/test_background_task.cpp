@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/background_task.hpp"
+#include "core/diagnostics.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace syrec;
+
+TEST(BackgroundTaskTests, SuccessfulWorkReportsProgressAndErrors) {
+    BackgroundTask task([](BackgroundTask& self) {
+        for (std::size_t i = 1; i <= 3; ++i) {
+            self.reportProgress(i, 3);
+        }
+        getErrorStream() << "reported warning\n";
+        return true;
+    });
+    ASSERT_TRUE(task.wait());
+    ASSERT_EQ(BackgroundTask::State::Succeeded, task.getState());
+    ASSERT_EQ(3U, task.getNumProcessedWorkItems());
+    ASSERT_EQ(3U, task.getNumWorkItems());
+    ASSERT_EQ(std::vector<std::string>({"reported warning"}), task.getErrorMessages());
+}
+
+TEST(BackgroundTaskTests, UnsuccessfulWorkFails) {
+    BackgroundTask task([](BackgroundTask&) {
+        getErrorStream() << "work failed\n";
+        return false;
+    });
+    ASSERT_TRUE(task.wait());
+    ASSERT_EQ(BackgroundTask::State::Failed, task.getState());
+    ASSERT_EQ(std::vector<std::string>({"work failed"}), task.getErrorMessages());
+}
+
+TEST(BackgroundTaskTests, ExceptionOfWorkIsReportedAsError) {
+    BackgroundTask task([](BackgroundTask&) -> bool { throw std::runtime_error("unexpected"); });
+    ASSERT_TRUE(task.wait());
+    ASSERT_EQ(BackgroundTask::State::Failed, task.getState());
+    ASSERT_EQ(1U, task.getErrorMessages().size());
+}
+
+TEST(BackgroundTaskTests, WorkIsCancelledAtNextCheckpoint) {
+    std::atomic_bool workStarted = false;
+    BackgroundTask   task([&](BackgroundTask& self) {
+        workStarted.store(true);
+        while (!self.isCancellationRequested()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return false;
+    });
+    while (!workStarted.load()) {
+        std::this_thread::yield();
+    }
+    ASSERT_FALSE(task.wait(std::chrono::milliseconds(10)));
+    ASSERT_FALSE(task.isFinished());
+    ASSERT_TRUE(task.getErrorMessages().empty());
+
+    task.requestCancellation();
+    ASSERT_TRUE(task.wait());
+    ASSERT_EQ(BackgroundTask::State::Cancelled, task.getState());
+}
+
+TEST(BackgroundTaskTests, DestructionOfTaskCancelsWork) {
+    std::atomic_bool wasCancelled = false;
+    {
+        const BackgroundTask task([&](BackgroundTask& self) {
+            while (!self.isCancellationRequested()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            wasCancelled.store(true);
+            return false;
+        });
+    }
+    ASSERT_TRUE(wasCancelled.load());
+}
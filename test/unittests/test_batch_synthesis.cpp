@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/syrec/program.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+
+class BatchSynthesisTest: public testing::Test {
+protected:
+    std::string                           testCircuitsDir = "./circuits/";
+    std::vector<std::unique_ptr<Program>> programs;
+    std::vector<BatchSynthesisJob>        jobs;
+
+    void SetUp() override {
+        for (const auto* circuitName: {"alu_2", "call_8", "for_32", "gray_binary_conversion_16", "ifCondVariants_4", "parity_check_16"}) {
+            auto              program     = std::make_unique<Program>();
+            const std::string errorString = program->read(testCircuitsDir + circuitName + ".src", ConfigurableOptions());
+            ASSERT_TRUE(errorString.empty()) << "Found errors during processing of SyReC program " << circuitName << ": " << errorString;
+
+            jobs.emplace_back(BatchSynthesisJob{.program = program.get(), .settings = ConfigurableOptions(), .synthesisAlgorithm = SynthesisAlgorithm::CostAware});
+            jobs.emplace_back(BatchSynthesisJob{.program = program.get(), .settings = ConfigurableOptions(), .synthesisAlgorithm = SynthesisAlgorithm::LineAware});
+            programs.emplace_back(std::move(program));
+        }
+    }
+
+    static void assertBatchSynthesisResultsMatchSequentialSynthesis(const std::vector<BatchSynthesisJob>& jobs, const std::vector<BatchSynthesisResult>& results) {
+        ASSERT_EQ(jobs.size(), results.size());
+        for (std::size_t i = 0; i < jobs.size(); ++i) {
+            AnnotatableQuantumComputation expectedAnnotatableQuantumComputation;
+            const bool                    expectedSynthesisResult = jobs[i].synthesisAlgorithm == SynthesisAlgorithm::CostAware
+                                                                            ? CostAwareSynthesis::synthesize(expectedAnnotatableQuantumComputation, *jobs[i].program, jobs[i].settings)
+                                                                            : LineAwareSynthesis::synthesize(expectedAnnotatableQuantumComputation, *jobs[i].program, jobs[i].settings);
+            ASSERT_EQ(expectedSynthesisResult, results[i].synthesisOk) << "Synthesis result mismatch for job " << i;
+            ASSERT_NE(nullptr, results[i].annotatableQuantumComputation) << "No quantum computation was synthesized for job " << i;
+            ASSERT_EQ(expectedAnnotatableQuantumComputation.getNqubits(), results[i].annotatableQuantumComputation->getNqubits()) << "Qubit count mismatch for job " << i;
+            ASSERT_EQ(expectedAnnotatableQuantumComputation.getNops(), results[i].annotatableQuantumComputation->getNops()) << "Quantum operation count mismatch for job " << i;
+            ASSERT_EQ(expectedAnnotatableQuantumComputation.getQuantumCostForSynthesis(), results[i].annotatableQuantumComputation->getQuantumCostForSynthesis()) << "Quantum cost mismatch for job " << i;
+        }
+    }
+};
+
+TEST_F(BatchSynthesisTest, SingleThreadedBatchSynthesisMatchesSequentialSynthesis) {
+    std::vector<BatchSynthesisResult> results;
+    batchSynthesis(results, jobs, 1);
+    assertBatchSynthesisResultsMatchSequentialSynthesis(jobs, results);
+}
+
+TEST_F(BatchSynthesisTest, MultiThreadedBatchSynthesisMatchesSequentialSynthesis) {
+    std::vector<BatchSynthesisResult> results;
+    batchSynthesis(results, jobs, 4);
+    assertBatchSynthesisResultsMatchSequentialSynthesis(jobs, results);
+}
+
+TEST_F(BatchSynthesisTest, BatchSynthesisWithMoreThreadsThanJobs) {
+    const std::vector<BatchSynthesisJob> singleJob = {jobs.front()};
+    std::vector<BatchSynthesisResult>    results;
+    batchSynthesis(results, singleJob, 8);
+    assertBatchSynthesisResultsMatchSequentialSynthesis(singleJob, results);
+}
+
+TEST_F(BatchSynthesisTest, JobWithoutProgramFails) {
+    const std::vector<BatchSynthesisJob> jobsWithMissingProgram = {BatchSynthesisJob{.program = nullptr, .settings = ConfigurableOptions(), .synthesisAlgorithm = SynthesisAlgorithm::CostAware}, jobs.front()};
+    std::vector<BatchSynthesisResult>    results;
+    batchSynthesis(results, jobsWithMissingProgram, 2);
+    ASSERT_EQ(2U, results.size());
+    ASSERT_FALSE(results.front().synthesisOk);
+    ASSERT_TRUE(results.back().synthesisOk);
+    ASSERT_EQ(std::vector<std::string>({"Program of batch synthesis job 0 cannot be NULL"}), results.front().diagnostics.getErrorMessages());
+    ASSERT_FALSE(results.back().diagnostics.hasErrors());
+}
+
+TEST_F(BatchSynthesisTest, EmptyBatch) {
+    std::vector<BatchSynthesisResult> results(3);
+    batchSynthesis(results, {}, 0);
+    ASSERT_TRUE(results.empty());
+}
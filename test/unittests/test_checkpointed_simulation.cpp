@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/checkpointed_simulation.hpp"
+#include "algorithms/simulation/simple_simulation.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/n_bit_values_container.hpp"
+#include "core/syrec/program.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <optional>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    class CheckpointedSimulationTestsFixture: public testing::Test {
+    protected:
+        AnnotatableQuantumComputation    annotatableQuantumComputation{true};
+        std::vector<NBitValuesContainer> inputs;
+
+        void SetUp() override {
+            Program program;
+            ASSERT_EQ("", program.readFromString("module main(inout a(4), in b(4))\n  a += b;\n  a ^= b;\n  ++= a;\n  b <=> a"));
+
+            ConfigurableOptions settings;
+            settings.generateQuantumOperationAnnotations = true;
+            ASSERT_TRUE(CostAwareSynthesis::synthesize(annotatableQuantumComputation, program, settings));
+
+            // Enough input patterns to require more than one block of simulated lanes with the ancillary qubits being initialized to zero
+            for (std::uint64_t inputValue = 0; inputValue < 100U; ++inputValue) {
+                inputs.emplace_back(annotatableQuantumComputation.getNqubits(), (inputValue * 37U) % 256U);
+            }
+        }
+
+        // Determine the expected state of an input pattern by simulating the quantum operations of the first statements one by one.
+        [[nodiscard]] NBitValuesContainer determineExpectedState(const CheckpointedSimulation& simulation, const std::size_t indexOfInput, const std::size_t numStatements) const {
+            NBitValuesContainer state = inputs[indexOfInput];
+            for (std::size_t i = 0; i < numStatements; ++i) {
+                const AnnotatableQuantumComputation::QuantumOperationIndexRange& quantumOperations = simulation.getStatements()[i].quantumOperations;
+                for (std::size_t j = quantumOperations.indexOfFirstQuantumOperation; j < quantumOperations.indexOfFirstQuantumOperation + quantumOperations.numQuantumOperations; ++j) {
+                    EXPECT_TRUE(coreOperationSimulation(*annotatableQuantumComputation.getQuantumOperation(j), state));
+                }
+            }
+            return state;
+        }
+
+        void assertStatesMatchExpectedOnes(const CheckpointedSimulation& simulation) const {
+            for (const std::size_t indexOfInput: {0U, 63U, 64U, 99U}) {
+                const std::optional<NBitValuesContainer> actualState = simulation.getState(indexOfInput);
+                ASSERT_TRUE(actualState.has_value());
+                ASSERT_EQ(determineExpectedState(simulation, indexOfInput, simulation.getNumSimulatedStatements()), *actualState) << "Mismatch for input " << indexOfInput << " after statement " << simulation.getNumSimulatedStatements();
+            }
+        }
+    };
+} // namespace
+
+TEST_F(CheckpointedSimulationTestsFixture, StatementsAreDeterminedByStatementLineNumbers) {
+    CheckpointedSimulation simulation;
+    ASSERT_TRUE(simulation.simulate(annotatableQuantumComputation, inputs));
+    ASSERT_EQ(inputs.size(), simulation.getNumInputs());
+    ASSERT_EQ(0U, simulation.getNumSimulatedStatements());
+
+    std::size_t           numQuantumOperationsOfStatements = 0;
+    std::vector<unsigned> statementLineNumbers;
+    for (const CheckpointedSimulation::Statement& statement: simulation.getStatements()) {
+        ASSERT_EQ(numQuantumOperationsOfStatements, statement.quantumOperations.indexOfFirstQuantumOperation);
+        ASSERT_NE(0U, statement.quantumOperations.numQuantumOperations);
+        numQuantumOperationsOfStatements += statement.quantumOperations.numQuantumOperations;
+        if (statement.statementLineNumber.has_value()) {
+            statementLineNumbers.emplace_back(*statement.statementLineNumber);
+        }
+    }
+    ASSERT_EQ(annotatableQuantumComputation.getNops(), numQuantumOperationsOfStatements);
+    ASSERT_EQ(std::vector<unsigned>({2U, 3U, 4U, 5U}), statementLineNumbers);
+
+    // The final states match the ones of the simulation of the whole quantum computation
+    ASSERT_TRUE(simulation.seek(simulation.getStatements().size()));
+    NBitValuesContainer expectedOutput;
+    simpleSimulation(expectedOutput, annotatableQuantumComputation, inputs[99]);
+    ASSERT_EQ(expectedOutput, simulation.getState(99));
+    ASSERT_FALSE(simulation.getState(100).has_value());
+}
+
+TEST_F(CheckpointedSimulationTestsFixture, SteppingForwardAndBackwardRestoresStatesOfStatements) {
+    CheckpointedSimulation simulation;
+    ASSERT_TRUE(simulation.simulate(annotatableQuantumComputation, inputs, CheckpointedSimulationSettings{.numStatementsPerSnapshot = 2U}));
+    ASSERT_NO_FATAL_FAILURE(assertStatesMatchExpectedOnes(simulation));
+
+    while (simulation.stepForward()) {
+        ASSERT_NO_FATAL_FAILURE(assertStatesMatchExpectedOnes(simulation));
+    }
+    ASSERT_EQ(simulation.getStatements().size(), simulation.getNumSimulatedStatements());
+
+    while (simulation.stepBackward()) {
+        ASSERT_NO_FATAL_FAILURE(assertStatesMatchExpectedOnes(simulation));
+    }
+    ASSERT_EQ(0U, simulation.getNumSimulatedStatements());
+    ASSERT_EQ(inputs[64], simulation.getState(64));
+}
+
+TEST_F(CheckpointedSimulationTestsFixture, SeekingStatementsWithAndWithoutSnapshots) {
+    for (const std::size_t numStatementsPerSnapshot: {0U, 1U, 3U}) {
+        CheckpointedSimulation simulation;
+        ASSERT_TRUE(simulation.simulate(annotatableQuantumComputation, inputs, CheckpointedSimulationSettings{.numStatementsPerSnapshot = numStatementsPerSnapshot}));
+
+        const std::size_t numStatements = simulation.getStatements().size();
+        for (const std::size_t targetStatement: {numStatements, std::size_t{1}, numStatements - 1U, std::size_t{0}, numStatements / 2U}) {
+            ASSERT_TRUE(simulation.seek(targetStatement));
+            ASSERT_EQ(targetStatement, simulation.getNumSimulatedStatements());
+            ASSERT_NO_FATAL_FAILURE(assertStatesMatchExpectedOnes(simulation));
+        }
+        ASSERT_FALSE(simulation.seek(numStatements + 1U));
+    }
+}
+
+TEST(CheckpointedSimulationTests, InputsNotMatchingQuantumComputationAreRejected) {
+    const AnnotatableQuantumComputation annotatableQuantumComputation;
+    CheckpointedSimulation              simulation;
+    ASSERT_FALSE(simulation.simulate(annotatableQuantumComputation, {NBitValuesContainer(3)}));
+    ASSERT_TRUE(simulation.getStatements().empty());
+    ASSERT_FALSE(simulation.stepForward());
+    ASSERT_FALSE(simulation.stepBackward());
+    ASSERT_TRUE(simulation.seek(0));
+}
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/circuit_to_truthtable.hpp"
+#include "algorithms/synthesis/dd_synthesis.hpp"
+#include "core/execution_limits.hpp"
+#include "core/io/pla_parser.hpp"
+#include "core/truthTable/truth_table.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+
+using namespace syrec;
+
+class CircuitToTruthTableTest: public testing::Test {
+protected:
+    std::string testCircuitsDir = "./circuits/";
+
+    static TruthTable buildTruthTableWithSettings(const qc::QuantumComputation& quantumComputation, const std::size_t numThreads, const bool useClassicalSimulation, const bool useFunctionalityDd = false) {
+        TruthTable tt;
+        EXPECT_TRUE(buildTruthTable(quantumComputation, tt, TruthTableExtractionSettings{.numThreads = numThreads, .useClassicalSimulationForPermutationCircuits = useClassicalSimulation, .useFunctionalityDd = useFunctionalityDd}));
+        return tt;
+    }
+};
+
+TEST_F(CircuitToTruthTableTest, ToffoliGate) {
+    qc::QuantumComputation quantumComputation(3);
+    quantumComputation.mcx(qc::Controls({0, 1}), 2);
+
+    TruthTable tt;
+    ASSERT_TRUE(buildTruthTable(quantumComputation, tt));
+    ASSERT_EQ(8, tt.size());
+    for (const auto& [input, output]: tt) {
+        const auto inputValue          = input.toInteger();
+        const auto expectedOutputValue = (inputValue & 3U) == 3U ? inputValue ^ 4U : inputValue;
+        ASSERT_EQ(expectedOutputValue, output.toInteger()) << "Output mismatch for input " << input.toString();
+    }
+}
+
+TEST_F(CircuitToTruthTableTest, InputsWithConstantLinesSetAreNotEnumerated) {
+    qc::QuantumComputation quantumComputation(4);
+    quantumComputation.setLogicalQubitAncillary(1);
+    quantumComputation.setLogicalQubitAncillary(3);
+    quantumComputation.cx(0, 1);
+    quantumComputation.mcx(qc::Controls({1, 2}), 3);
+
+    for (const bool useClassicalSimulation: {false, true}) {
+        const auto tt = buildTruthTableWithSettings(quantumComputation, 2U, useClassicalSimulation);
+        ASSERT_EQ(4, tt.size());
+        for (const auto& [input, output]: tt) {
+            const auto inputValue = input.toInteger();
+            ASSERT_EQ(0U, inputValue & 0b1010U) << "Input " << input.toString() << " violates the constant lines";
+
+            const auto qubitZeroValue      = inputValue & 1U;
+            const auto qubitTwoValue       = (inputValue >> 2U) & 1U;
+            const auto expectedOutputValue = inputValue | (qubitZeroValue << 1U) | ((qubitZeroValue & qubitTwoValue) << 3U);
+            ASSERT_EQ(expectedOutputValue, output.toInteger()) << "Output mismatch for input " << input.toString();
+        }
+    }
+}
+
+TEST_F(CircuitToTruthTableTest, ClassicalAndDdSimulationYieldSameTruthTable) {
+    qc::QuantumComputation quantumComputation(4);
+    quantumComputation.x(3);
+    quantumComputation.mcx(qc::Controls({qc::Control{0, qc::Control::Type::Neg}, qc::Control{2}}), 1);
+    quantumComputation.mcswap(qc::Controls({3}), 0, 2);
+    quantumComputation.cx(1, 3);
+
+    const auto ddSimulatedTruthTable          = buildTruthTableWithSettings(quantumComputation, 1U, false);
+    const auto classicallySimulatedTruthTable = buildTruthTableWithSettings(quantumComputation, 1U, true);
+    ASSERT_EQ(16, ddSimulatedTruthTable.size());
+    ASSERT_EQ(ddSimulatedTruthTable, classicallySimulatedTruthTable);
+}
+
+TEST_F(CircuitToTruthTableTest, MultiThreadedExtractionYieldsSameTruthTable) {
+    TruthTable tt;
+    ASSERT_TRUE(readPla(tt, testCircuitsDir + "rd53.pla"));
+    const auto& synthesizedQuantumComputation = DDSynthesizer::synthesizeCodingTechniques(tt);
+
+    for (const bool useClassicalSimulation: {false, true}) {
+        const auto singleThreadedTruthTable = buildTruthTableWithSettings(*synthesizedQuantumComputation, 1U, useClassicalSimulation);
+        ASSERT_TRUE(TruthTable::equal(singleThreadedTruthTable, tt));
+
+        for (const std::size_t numThreads: {0U, 3U, 8U}) {
+            const auto multiThreadedTruthTable = buildTruthTableWithSettings(*synthesizedQuantumComputation, numThreads, useClassicalSimulation);
+            ASSERT_EQ(singleThreadedTruthTable, multiThreadedTruthTable);
+        }
+    }
+}
+
+TEST_F(CircuitToTruthTableTest, FunctionalityDdYieldsSameTruthTableAsDdSimulation) {
+    qc::QuantumComputation quantumComputation(5);
+    quantumComputation.setLogicalQubitAncillary(4);
+    quantumComputation.x(3);
+    quantumComputation.mcx(qc::Controls({qc::Control{0, qc::Control::Type::Neg}, qc::Control{2}}), 1);
+    quantumComputation.mcswap(qc::Controls({3}), 0, 2);
+    quantumComputation.cx(1, 4);
+    // a pair of Hadamard gates is not simulated classically but still realizes a permutation
+    quantumComputation.h(2);
+    quantumComputation.h(2);
+
+    const auto ddSimulatedTruthTable   = buildTruthTableWithSettings(quantumComputation, 1U, true);
+    const auto functionalityTruthTable = buildTruthTableWithSettings(quantumComputation, 1U, true, true);
+    ASSERT_EQ(16, functionalityTruthTable.size());
+    ASSERT_EQ(ddSimulatedTruthTable, functionalityTruthTable);
+}
+
+TEST_F(CircuitToTruthTableTest, ViolatedExecutionLimitsStopExtractionWithoutAddingEntries) {
+    qc::QuantumComputation quantumComputation(3);
+    quantumComputation.mcx(qc::Controls({0, 1}), 2);
+
+    const CancellationToken cancellationToken;
+    cancellationToken.requestCancellation();
+    for (const bool useClassicalSimulation: {false, true}) {
+        for (const ExecutionLimits& executionLimits: {ExecutionLimits{.optionalCancellationToken = cancellationToken}, ExecutionLimits{.timeLimitInMilliseconds = 0U}}) {
+            TruthTable tt;
+            ASSERT_FALSE(buildTruthTable(quantumComputation, tt, TruthTableExtractionSettings{.numThreads = 2U, .useClassicalSimulationForPermutationCircuits = useClassicalSimulation, .executionLimits = executionLimits}));
+            ASSERT_EQ(0, tt.size());
+        }
+    }
+}
+
+TEST_F(CircuitToTruthTableTest, StreamedPlaMatchesExtractedTruthTable) {
+    // the 2^13 inputs are written in multiple blocks
+    qc::QuantumComputation quantumComputation(14);
+    quantumComputation.setLogicalQubitAncillary(13);
+    quantumComputation.setLogicalQubitGarbage(0);
+    for (qc::Qubit qubit = 0; qubit < 13; ++qubit) {
+        quantumComputation.cx(qubit, qubit + 1);
+    }
+    quantumComputation.mcx(qc::Controls({qc::Control{2, qc::Control::Type::Neg}, qc::Control{7}}), 0);
+
+    for (const bool useClassicalSimulation: {false, true}) {
+        const auto extractedTruthTable = buildTruthTableWithSettings(quantumComputation, 1U, useClassicalSimulation);
+        for (const std::size_t numThreads: {1U, 3U}) {
+            std::ostringstream plaStream;
+            ASSERT_TRUE(writeTruthTableAsPla(quantumComputation, plaStream, TruthTableExtractionSettings{.numThreads = numThreads, .useClassicalSimulationForPermutationCircuits = useClassicalSimulation}));
+
+            TruthTable streamedTruthTable;
+            ASSERT_TRUE(parsePla(streamedTruthTable, plaStream.str()));
+            // the streamed PLA only consists of the primary inputs and outputs
+            ASSERT_EQ(13U, streamedTruthTable.nInputs());
+            ASSERT_EQ(13U, streamedTruthTable.nOutputs());
+            ASSERT_TRUE(TruthTable::equal(extractedTruthTable, streamedTruthTable));
+        }
+    }
+}
+
+TEST_F(CircuitToTruthTableTest, ViolatedExecutionLimitsStopStreamedPla) {
+    qc::QuantumComputation quantumComputation(3);
+    quantumComputation.mcx(qc::Controls({0, 1}), 2);
+
+    const CancellationToken cancellationToken;
+    cancellationToken.requestCancellation();
+    std::ostringstream plaStream;
+    ASSERT_FALSE(writeTruthTableAsPla(quantumComputation, plaStream, TruthTableExtractionSettings{.executionLimits = ExecutionLimits{.optionalCancellationToken = cancellationToken}}));
+    ASSERT_EQ(std::string::npos, plaStream.str().find(".e"));
+}
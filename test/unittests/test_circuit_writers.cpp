@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/io/circuit_writers.hpp"
+#include "core/real/parser.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <optional>
+#include <sstream>
+#include <string>
+
+using namespace syrec;
+
+namespace {
+    class CircuitWritersTestsFixture: public testing::Test {
+    protected:
+        AnnotatableQuantumComputation annotatableQuantumComputation;
+
+        // Creates the quantum registers of the variable 'a' storing the qubits 0 and 1, of the garbage variable 'b' storing the qubit 2 and of the ancillary qubit 3 followed by a quantum operation of every gate type supported by the writers.
+        void SetUp() override {
+            ASSERT_EQ(std::make_optional<qc::Qubit>(0U), annotatableQuantumComputation.addQuantumRegisterForSyrecVariable("a", AnnotatableQuantumComputation::AssociatedVariableLayoutInformation({.numValuesPerDimension = {1U}, .bitwidth = 2U}), false));
+            ASSERT_EQ(std::make_optional<qc::Qubit>(2U), annotatableQuantumComputation.addQuantumRegisterForSyrecVariable("b", AnnotatableQuantumComputation::AssociatedVariableLayoutInformation({.numValuesPerDimension = {1U}, .bitwidth = 1U}), true));
+            ASSERT_EQ(std::make_optional<qc::Qubit>(3U), annotatableQuantumComputation.addPreliminaryAncillaryRegisterOrAppendToAdjacentOne("anc", {false}, AnnotatableQuantumComputation::InlinedQubitInformation{}));
+            annotatableQuantumComputation.promotePreliminaryAncillaryQubitsToDefinitiveAncillaryQubits();
+
+            ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingNotGate(0U));
+            ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingCnotGate(0U, 3U));
+            ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingToffoliGate(0U, 1U, 2U));
+            ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingFredkinGate(1U, 2U));
+            ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingMultiControlToffoliGate(qc::Controls({qc::Control{0U}, qc::Control{1U, qc::Control::Type::Neg}, qc::Control{3U}}), 2U));
+        }
+    };
+} // namespace
+
+TEST_F(CircuitWritersTestsFixture, WriteRealFormat) {
+    std::ostringstream outputStream;
+    ASSERT_TRUE(writeRealFormat(annotatableQuantumComputation, outputStream));
+
+    const std::string expectedOutput = ".version 2.0\n"
+                                       ".numvars 4\n"
+                                       ".variables q0 q1 q2 q3\n"
+                                       ".constants ---0\n"
+                                       ".garbage --1-\n"
+                                       ".begin\n"
+                                       "t1 q0\n"
+                                       "t2 q0 q3\n"
+                                       "t3 q0 q1 q2\n"
+                                       "f2 q1 q2\n"
+                                       "t4 q0 -q1 q3 q2\n"
+                                       ".end\n";
+    ASSERT_EQ(expectedOutput, outputStream.str());
+}
+
+TEST_F(CircuitWritersTestsFixture, WriteOpenQasm3Format) {
+    std::ostringstream outputStream;
+    ASSERT_TRUE(writeOpenQasm3(annotatableQuantumComputation, outputStream));
+
+    const std::string expectedOutput = "OPENQASM 3.0;\n"
+                                       "include \"stdgates.inc\";\n"
+                                       "qubit[4] q;\n"
+                                       "x q[0];\n"
+                                       "cx q[0], q[3];\n"
+                                       "ccx q[0], q[1], q[2];\n"
+                                       "swap q[1], q[2];\n"
+                                       "ctrl @ negctrl @ ctrl @ x q[0], q[1], q[3], q[2];\n";
+    ASSERT_EQ(expectedOutput, outputStream.str());
+}
+
+TEST_F(CircuitWritersTestsFixture, WrittenRealFormatCanBeParsed) {
+    std::ostringstream outputStream;
+    ASSERT_TRUE(writeRealFormat(annotatableQuantumComputation, outputStream, CircuitWriterSettings{.writeStatementLineNumbers = true, .writeQuantumOperationAnnotations = false, .writeQubitLabels = true}));
+
+    const qc::QuantumComputation parsedQuantumComputation = RealParser::imports(outputStream.str());
+    ASSERT_EQ(annotatableQuantumComputation.getNqubits(), parsedQuantumComputation.getNqubits());
+    ASSERT_EQ(annotatableQuantumComputation.getNops(), parsedQuantumComputation.getNops());
+    for (std::size_t i = 0; i < annotatableQuantumComputation.getNops(); ++i) {
+        ASSERT_TRUE(annotatableQuantumComputation.at(i)->equals(*parsedQuantumComputation.at(i))) << "Quantum operation " << i << " did not match";
+    }
+    ASSERT_TRUE(parsedQuantumComputation.logicalQubitIsAncillary(3U));
+    ASSERT_TRUE(parsedQuantumComputation.logicalQubitIsGarbage(2U));
+}
+
+TEST_F(CircuitWritersTestsFixture, WritingQuantumOperationOfUnsupportedTypeFails) {
+    annotatableQuantumComputation.h(0U);
+
+    std::ostringstream outputStream;
+    ASSERT_FALSE(writeRealFormat(annotatableQuantumComputation, outputStream));
+    ASSERT_FALSE(writeOpenQasm3(annotatableQuantumComputation, outputStream));
+}
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/simple_simulation.hpp"
+#include "algorithms/synthesis/clifford_t_lowering.hpp"
+#include "core/n_bit_values_container.hpp"
+#include "core/statistics.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+#include "ir/operations/OpType.hpp"
+#include "ir/operations/Operation.hpp"
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <map>
+#include <memory>
+#include <numbers>
+
+using namespace syrec;
+
+namespace {
+    using StateVector = std::map<std::uint64_t, std::complex<double>>;
+
+    // Sparse state vector simulation of the gates of the Clifford+T gate set emitted by the lowering.
+    [[nodiscard]] StateVector simulateBasisState(const qc::QuantumComputation& quantumComputation, const std::uint64_t basisState) {
+        const std::complex<double> phaseOfTGate = std::polar(1.0, std::numbers::pi / 4.0);
+        StateVector                stateVector  = {{basisState, 1.0}};
+        for (const std::unique_ptr<qc::Operation>& gate: quantumComputation) {
+            std::uint64_t maskOfControlQubits = 0;
+            for (const qc::Control& controlQubit: gate->getControls()) {
+                maskOfControlQubits |= static_cast<std::uint64_t>(1) << controlQubit.qubit;
+            }
+            const std::uint64_t maskOfTargetQubit = static_cast<std::uint64_t>(1) << gate->getTargets().front();
+
+            StateVector nextStateVector;
+            for (const auto& [state, amplitude]: stateVector) {
+                const bool isTargetQubitSet = (state & maskOfTargetQubit) != 0U;
+                switch (gate->getType()) {
+                    case qc::OpType::X:
+                        nextStateVector[(state & maskOfControlQubits) == maskOfControlQubits ? state ^ maskOfTargetQubit : state] += amplitude;
+                        break;
+                    case qc::OpType::T:
+                        nextStateVector[state] += isTargetQubitSet ? amplitude * phaseOfTGate : amplitude;
+                        break;
+                    case qc::OpType::Tdg:
+                        nextStateVector[state] += isTargetQubitSet ? amplitude * std::conj(phaseOfTGate) : amplitude;
+                        break;
+                    case qc::OpType::H:
+                        nextStateVector[state & ~maskOfTargetQubit] += amplitude * std::numbers::sqrt2 / 2.0;
+                        nextStateVector[state | maskOfTargetQubit] += (isTargetQubitSet ? -amplitude : amplitude) * std::numbers::sqrt2 / 2.0;
+                        break;
+                    default:
+                        ADD_FAILURE() << "Unexpected gate of type " << qc::toString(gate->getType());
+                        return {};
+                }
+            }
+            std::erase_if(nextStateVector, [](const auto& stateAndAmplitude) { return std::abs(stateAndAmplitude.second) < 1e-9; });
+            stateVector = std::move(nextStateVector);
+        }
+        return stateVector;
+    }
+
+    /*
+     * Check that the lowered quantum computation maps every basis state, in which the ancillary qubits of the quantum computation and all qubits added by the lowering are zero, to the output state of the
+     * quantum computation without any phase while restoring the added qubits.
+     */
+    void assertLoweredQuantumComputationIsEquivalent(const qc::QuantumComputation& quantumComputation, const qc::QuantumComputation& loweredQuantumComputation) {
+        const std::size_t numQubits = quantumComputation.getNqubits();
+        for (std::uint64_t input = 0; input < (static_cast<std::uint64_t>(1) << numQubits); ++input) {
+            bool isAnyAncillaryQubitSet = false;
+            for (std::size_t qubit = 0; qubit < numQubits; ++qubit) {
+                isAnyAncillaryQubitSet |= quantumComputation.logicalQubitIsAncillary(static_cast<qc::Qubit>(qubit)) && ((input >> qubit) & 1U) != 0U;
+            }
+            if (isAnyAncillaryQubitSet) {
+                continue;
+            }
+
+            NBitValuesContainer expectedOutput;
+            simpleSimulation(expectedOutput, quantumComputation, NBitValuesContainer(numQubits, input));
+            std::uint64_t expectedOutputState = 0;
+            for (std::size_t qubit = 0; qubit < numQubits; ++qubit) {
+                expectedOutputState |= static_cast<std::uint64_t>(expectedOutput[qubit]) << qubit;
+            }
+
+            const StateVector outputStateVector = simulateBasisState(loweredQuantumComputation, input);
+            ASSERT_EQ(1U, outputStateVector.size()) << "Output of input " << input << " was not a basis state";
+            ASSERT_EQ(expectedOutputState, outputStateVector.cbegin()->first) << "Output of input " << input << " did not match";
+            ASSERT_NEAR(0.0, std::abs(outputStateVector.cbegin()->second - 1.0), 1e-9) << "Output of input " << input << " had a phase";
+        }
+    }
+} // namespace
+
+TEST(CliffordTLoweringTests, ToffoliGateIsDecomposedIntoSevenTGates) {
+    qc::QuantumComputation quantumComputation(3);
+    quantumComputation.mcx(qc::Controls({0, 1}), 2);
+    quantumComputation.cx(2, 0);
+
+    qc::QuantumComputation loweredQuantumComputation;
+    Statistics             statistics;
+    ASSERT_TRUE(lowerToCliffordT(loweredQuantumComputation, quantumComputation, CliffordTLoweringSettings(), &statistics));
+    ASSERT_NO_FATAL_FAILURE(assertLoweredQuantumComputationIsEquivalent(quantumComputation, loweredQuantumComputation));
+    ASSERT_EQ(3U, loweredQuantumComputation.getNqubits());
+    ASSERT_EQ(7U, statistics.numTGates);
+    ASSERT_EQ(4U, statistics.tDepth);
+}
+
+TEST(CliffordTLoweringTests, MultiControlledXGateUsesRelativePhaseToffoliGatesOnAddedCleanAncillaryQubits) {
+    qc::QuantumComputation quantumComputation(5);
+    quantumComputation.mcx(qc::Controls({0, 1, 2, 3}), 4);
+
+    qc::QuantumComputation loweredQuantumComputation;
+    ASSERT_TRUE(lowerToCliffordT(loweredQuantumComputation, quantumComputation));
+    ASSERT_NO_FATAL_FAILURE(assertLoweredQuantumComputationIsEquivalent(quantumComputation, loweredQuantumComputation));
+    ASSERT_EQ(7U, loweredQuantumComputation.getNqubits());
+    ASSERT_TRUE(loweredQuantumComputation.logicalQubitIsAncillary(6));
+    // Two relative-phase Toffoli gates compute and uncompute the conjunction of the first three control qubits
+    ASSERT_EQ(4U * 4U + 7U, determineTCount(loweredQuantumComputation));
+
+    ASSERT_TRUE(lowerToCliffordT(loweredQuantumComputation, quantumComputation, CliffordTLoweringSettings{.useRelativePhaseToffoliGates = false}));
+    ASSERT_NO_FATAL_FAILURE(assertLoweredQuantumComputationIsEquivalent(quantumComputation, loweredQuantumComputation));
+    ASSERT_EQ(5U * 7U, determineTCount(loweredQuantumComputation));
+}
+
+TEST(CliffordTLoweringTests, AncillaryQubitsKnownToBeZeroAreUsedAsCleanAncillaryQubits) {
+    qc::QuantumComputation quantumComputation(7);
+    quantumComputation.setLogicalQubitAncillary(5);
+    quantumComputation.setLogicalQubitAncillary(6);
+    quantumComputation.x(6);
+    quantumComputation.mcx(qc::Controls({0, 1, 2, 3}), 4);
+    quantumComputation.x(6);
+
+    qc::QuantumComputation loweredQuantumComputation;
+    ASSERT_TRUE(lowerToCliffordT(loweredQuantumComputation, quantumComputation));
+    ASSERT_NO_FATAL_FAILURE(assertLoweredQuantumComputationIsEquivalent(quantumComputation, loweredQuantumComputation));
+    // Qubit 6 is known to be one at the multi-controlled X gate and thus only one additional clean ancillary qubit is added
+    ASSERT_EQ(8U, loweredQuantumComputation.getNqubits());
+}
+
+TEST(CliffordTLoweringTests, IdleQubitsAreBorrowedAsDirtyAncillaryQubits) {
+    qc::QuantumComputation quantumComputation(7);
+    quantumComputation.mcx(qc::Controls({0, 1, 2, 3}), 4);
+
+    qc::QuantumComputation loweredQuantumComputation;
+    Statistics             statistics;
+    ASSERT_TRUE(lowerToCliffordT(loweredQuantumComputation, quantumComputation, CliffordTLoweringSettings{.addCleanAncillaryQubits = false}, &statistics));
+    ASSERT_NO_FATAL_FAILURE(assertLoweredQuantumComputationIsEquivalent(quantumComputation, loweredQuantumComputation));
+    ASSERT_EQ(7U, loweredQuantumComputation.getNqubits());
+    ASSERT_EQ(2U * (7U + 3U * 4U), statistics.numTGates);
+
+    // Without idle qubits the gate cannot be lowered without adding qubits
+    qc::QuantumComputation quantumComputationWithoutIdleQubits(5);
+    quantumComputationWithoutIdleQubits.mcx(qc::Controls({0, 1, 2, 3}), 4);
+    ASSERT_FALSE(lowerToCliffordT(loweredQuantumComputation, quantumComputationWithoutIdleQubits, CliffordTLoweringSettings{.addCleanAncillaryQubits = false}));
+    ASSERT_EQ(0U, loweredQuantumComputation.getNqubits());
+}
+
+TEST(CliffordTLoweringTests, ControlledSwapGateWithNegativeControlQubit) {
+    qc::QuantumComputation quantumComputation(4);
+    quantumComputation.mcswap(qc::Controls({qc::Control(0, qc::Control::Type::Neg), 1}), 2, 3);
+    quantumComputation.swap(0, 3);
+
+    qc::QuantumComputation loweredQuantumComputation;
+    ASSERT_TRUE(lowerToCliffordT(loweredQuantumComputation, quantumComputation));
+    ASSERT_NO_FATAL_FAILURE(assertLoweredQuantumComputationIsEquivalent(quantumComputation, loweredQuantumComputation));
+    ASSERT_EQ(5U, loweredQuantumComputation.getNqubits());
+}
+
+TEST(CliffordTLoweringTests, TDepthOfQuantumComputation) {
+    qc::QuantumComputation quantumComputation(3);
+    quantumComputation.t(0);
+    quantumComputation.cx(0, 1);
+    quantumComputation.tdg(1);
+    quantumComputation.t(2);
+    ASSERT_EQ(3U, determineTCount(quantumComputation));
+    ASSERT_EQ(2U, determineTDepth(quantumComputation));
+}
+
+TEST(CliffordTLoweringTests, GatesOtherThanXAndSwapGatesAreRejected) {
+    qc::QuantumComputation quantumComputation(1);
+    quantumComputation.h(0);
+
+    qc::QuantumComputation loweredQuantumComputation;
+    ASSERT_FALSE(lowerToCliffordT(loweredQuantumComputation, quantumComputation));
+}
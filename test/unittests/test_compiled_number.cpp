@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/syrec/compiled_number.hpp"
+#include "core/syrec/number.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    using Operation = Number::ConstantExpression::Operation;
+
+    [[nodiscard]] Number::ptr makeConstantExpression(Number::ptr lhsOperand, const Operation operation, Number::ptr rhsOperand) {
+        return std::make_shared<Number>(Number::ConstantExpression(std::move(lhsOperand), operation, std::move(rhsOperand)));
+    }
+
+    [[nodiscard]] Number::ptr makeConstant(const unsigned value) {
+        return std::make_shared<Number>(value);
+    }
+
+    [[nodiscard]] Number::ptr makeLoopVariable(const std::string& identifier) {
+        return std::make_shared<Number>(identifier);
+    }
+
+    // Compare the evaluation of the compiled number with the one of the number for all combinations of values (including no value) of the loop variables 'i' and 'j'.
+    void assertCompiledNumberMatchesNumberForAllLoopVariableValues(const Number& number, const bool expectedToBeAffine) {
+        std::vector<std::string> identifierPerLoopVariableSlot;
+        const CompiledNumber     compiledNumber(number, identifierPerLoopVariableSlot);
+        ASSERT_EQ(expectedToBeAffine, compiledNumber.isAffine());
+
+        const std::vector<std::optional<unsigned>> testedLoopVariableValues = {std::nullopt, 0U, 1U, 2U, 7U};
+        for (const std::optional<unsigned>& valueOfI: testedLoopVariableValues) {
+            for (const std::optional<unsigned>& valueOfJ: testedLoopVariableValues) {
+                Number::LoopVariableMapping          loopVariableValueLookup;
+                std::vector<std::optional<unsigned>> valuePerLoopVariableSlot(identifierPerLoopVariableSlot.size(), std::nullopt);
+                for (std::size_t i = 0; i < identifierPerLoopVariableSlot.size(); ++i) {
+                    const std::optional<unsigned>& value = identifierPerLoopVariableSlot[i] == "i" ? valueOfI : valueOfJ;
+                    valuePerLoopVariableSlot[i]          = value;
+                    if (value.has_value()) {
+                        loopVariableValueLookup[identifierPerLoopVariableSlot[i]] = *value;
+                    }
+                }
+                ASSERT_EQ(number.tryEvaluate(loopVariableValueLookup), compiledNumber.tryEvaluate(valuePerLoopVariableSlot)) << "i: " << valueOfI.value_or(0U) << " (set: " << valueOfI.has_value() << "), j: " << valueOfJ.value_or(0U) << " (set: " << valueOfJ.has_value() << ")";
+            }
+        }
+    }
+} // namespace
+
+TEST(CompiledNumberTests, NumberOfSingleLoopVariableWithoutDivisionIsLoweredToAffineForm) {
+    const Number::ptr offsetScaledLoopVariable = makeConstantExpression(makeConstant(3U), Operation::Multiplication, makeConstantExpression(makeLoopVariable("i"), Operation::Subtraction, makeConstant(5U)));
+    ASSERT_NO_FATAL_FAILURE(assertCompiledNumberMatchesNumberForAllLoopVariableValues(*offsetScaledLoopVariable, true));
+
+    // The value of a loop variable whose coefficient is zero must still be known
+    const Number::ptr cancelledLoopVariable = makeConstantExpression(makeLoopVariable("i"), Operation::Subtraction, makeLoopVariable("i"));
+    ASSERT_NO_FATAL_FAILURE(assertCompiledNumberMatchesNumberForAllLoopVariableValues(*cancelledLoopVariable, true));
+}
+
+TEST(CompiledNumberTests, NonAffineNumberIsLoweredToInstructions) {
+    const Number::ptr productOfLoopVariables = makeConstantExpression(makeConstantExpression(makeLoopVariable("i"), Operation::Multiplication, makeLoopVariable("j")), Operation::Addition, makeConstant(1U));
+    ASSERT_NO_FATAL_FAILURE(assertCompiledNumberMatchesNumberForAllLoopVariableValues(*productOfLoopVariables, false));
+
+    const Number::ptr divisionByLoopVariable = makeConstantExpression(makeConstantExpression(makeLoopVariable("i"), Operation::Addition, makeConstant(9U)), Operation::Division, makeConstantExpression(makeLoopVariable("j"), Operation::Subtraction, makeConstant(1U)));
+    ASSERT_NO_FATAL_FAILURE(assertCompiledNumberMatchesNumberForAllLoopVariableValues(*divisionByLoopVariable, false));
+
+    const Number::ptr missingOperand = makeConstantExpression(makeLoopVariable("i"), Operation::Division, nullptr);
+    ASSERT_NO_FATAL_FAILURE(assertCompiledNumberMatchesNumberForAllLoopVariableValues(*missingOperand, false));
+
+    // Operand stack exceeding the inline storage
+    Number::ptr deeplyNestedNumber = makeLoopVariable("j");
+    for (unsigned i = 0; i < 24U; ++i) {
+        deeplyNestedNumber = makeConstantExpression(makeLoopVariable("i"), i % 2U == 0U ? Operation::Division : Operation::Addition, deeplyNestedNumber);
+    }
+    ASSERT_NO_FATAL_FAILURE(assertCompiledNumberMatchesNumberForAllLoopVariableValues(*deeplyNestedNumber, false));
+}
+
+TEST(CompiledNumberTests, ExchangedLoopVariableValuesAreRestored) {
+    CompiledNumberEvaluator evaluator;
+    const Number::ptr       number  = makeConstantExpression(makeLoopVariable("i"), Operation::Addition, makeLoopVariable("j"));
+    const std::size_t       slotOfI = evaluator.getLoopVariableSlot("i");
+    evaluator.setLoopVariableValue(slotOfI, 2U);
+    ASSERT_EQ(std::nullopt, evaluator.tryEvaluate(number));
+
+    const std::size_t slotOfJ = evaluator.getLoopVariableSlot("j");
+    ASSERT_NE(slotOfI, slotOfJ);
+    ASSERT_EQ(slotOfI, evaluator.getLoopVariableSlot("i"));
+    evaluator.setLoopVariableValue(slotOfJ, 3U);
+    ASSERT_EQ(5U, evaluator.tryEvaluate(number));
+
+    const std::vector<std::optional<unsigned>> valuesOfCaller = evaluator.exchangeLoopVariableValues({});
+    ASSERT_EQ(std::nullopt, evaluator.tryEvaluate(number));
+    ASSERT_EQ(4U, evaluator.tryEvaluate(makeConstant(4U)));
+
+    static_cast<void>(evaluator.exchangeLoopVariableValues(valuesOfCaller));
+    ASSERT_EQ(5U, evaluator.tryEvaluate(number));
+}
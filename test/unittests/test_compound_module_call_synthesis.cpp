@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/statistics.hpp"
+#include "core/syrec/program.hpp"
+#include "differential_verification_test_fixture.hpp"
+#include "ir/operations/CompoundOperation.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <memory>
+
+using namespace syrec;
+
+namespace {
+    class CompoundModuleCallSynthesisTestsFixture: public DifferentialVerificationTestFixture {
+    protected:
+        [[nodiscard]] static ConfigurableOptions createSettingsEmittingModuleCallsAsCompoundOperations() {
+            ConfigurableOptions settings;
+            settings.emitModuleCallsAsCompoundOperations = true;
+            return settings;
+        }
+
+        void assertEmittingModuleCallsAsCompoundOperationsDoesNotChangeSimulationResult(const SynthesisAlgorithm synthesisAlgorithm) const {
+            ASSERT_NO_FATAL_FAILURE(assertSynthesisDoesNotChangeSimulationResult(program, createSettingsEmittingModuleCallsAsCompoundOperations(), synthesisAlgorithm));
+        }
+    };
+} // namespace
+
+TEST_F(CompoundModuleCallSynthesisTestsFixture, EveryModuleCallIsEmittedAsCompoundOperation) {
+    parseProgram("module inc(inout x(4)) ++= x module main(inout a(4), inout b(4)) call inc(a); call inc(b); uncall inc(a)");
+
+    AnnotatableQuantumComputation flatQuantumComputation;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(flatQuantumComputation, program));
+
+    AnnotatableQuantumComputation hierarchicalQuantumComputation;
+    Statistics                    statistics;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(hierarchicalQuantumComputation, program, createSettingsEmittingModuleCallsAsCompoundOperations(), &statistics));
+    ASSERT_EQ(3U, hierarchicalQuantumComputation.getNops());
+    for (std::size_t i = 0; i < hierarchicalQuantumComputation.getNops(); ++i) {
+        ASSERT_TRUE(hierarchicalQuantumComputation.at(i)->isCompoundOperation()) << "Quantum operation " << i << " was not a compound operation";
+    }
+
+    // The statistics and the synthesis cost are determined for the gates of the compound operations.
+    ASSERT_EQ(flatQuantumComputation.getNops(), statistics.numQuantumOperations);
+    ASSERT_EQ(flatQuantumComputation.getQuantumCostForSynthesis(), hierarchicalQuantumComputation.getQuantumCostForSynthesis());
+    ASSERT_EQ(flatQuantumComputation.getTransistorCostForSynthesis(), hierarchicalQuantumComputation.getTransistorCostForSynthesis());
+
+    ASSERT_EQ(3U, hierarchicalQuantumComputation.flattenCompoundOperations());
+    assertQuantumComputationsAreEqual(flatQuantumComputation, hierarchicalQuantumComputation);
+}
+
+TEST_F(CompoundModuleCallSynthesisTestsFixture, NestedModuleCallsAreEmittedAsNestedCompoundOperations) {
+    parseProgram("module inc(inout x(4)) ++= x module incTwice(inout y(4)) call inc(y); call inc(y) module main(inout a(4), in b(4)) a ^= b; call incTwice(a)");
+
+    AnnotatableQuantumComputation flatQuantumComputation;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(flatQuantumComputation, program));
+
+    AnnotatableQuantumComputation hierarchicalQuantumComputation;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(hierarchicalQuantumComputation, program, createSettingsEmittingModuleCallsAsCompoundOperations()));
+    ASSERT_LT(1U, hierarchicalQuantumComputation.getNops());
+    for (std::size_t i = 0; i + 1U < hierarchicalQuantumComputation.getNops(); ++i) {
+        ASSERT_FALSE(hierarchicalQuantumComputation.at(i)->isCompoundOperation()) << "Quantum operation " << i << " was a compound operation";
+    }
+
+    const auto* compoundOperationOfOuterModuleCall = dynamic_cast<const qc::CompoundOperation*>(hierarchicalQuantumComputation.at(hierarchicalQuantumComputation.getNops() - 1U).get());
+    ASSERT_NE(nullptr, compoundOperationOfOuterModuleCall);
+    ASSERT_EQ(2U, compoundOperationOfOuterModuleCall->size());
+    for (const std::unique_ptr<qc::Operation>& nestedQuantumOperation: *compoundOperationOfOuterModuleCall) {
+        ASSERT_TRUE(nestedQuantumOperation->isCompoundOperation());
+    }
+
+    ASSERT_EQ(3U, hierarchicalQuantumComputation.flattenCompoundOperations());
+    assertQuantumComputationsAreEqual(flatQuantumComputation, hierarchicalQuantumComputation);
+}
+
+TEST_F(CompoundModuleCallSynthesisTestsFixture, ModuleCallsAreNotGroupedIfAnnotationsAreGenerated) {
+    parseProgram("module inc(inout x(4)) ++= x module main(inout a(4)) call inc(a)");
+
+    ConfigurableOptions settings                 = createSettingsEmittingModuleCallsAsCompoundOperations();
+    settings.generateQuantumOperationAnnotations = true;
+
+    AnnotatableQuantumComputation quantumComputation(true);
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(quantumComputation, program, settings));
+    for (std::size_t i = 0; i < quantumComputation.getNops(); ++i) {
+        ASSERT_FALSE(quantumComputation.at(i)->isCompoundOperation()) << "Quantum operation " << i << " was a compound operation";
+    }
+    ASSERT_EQ(0U, quantumComputation.flattenCompoundOperations());
+}
+
+TEST_F(CompoundModuleCallSynthesisTestsFixture, EmittingModuleCallsAsCompoundOperationsDoesNotChangeSimulationResult) {
+    parseProgram("module swapAndInc(inout x(4), inout y(4)) x <=> y; ++= x module main(inout a(4), inout b(4), in c(4)) call swapAndInc(a, b); if (c > 2) then call swapAndInc(b, a) else uncall swapAndInc(a, b) fi (c > 2)");
+    assertEmittingModuleCallsAsCompoundOperationsDoesNotChangeSimulationResult(SynthesisAlgorithm::CostAware);
+    assertEmittingModuleCallsAsCompoundOperationsDoesNotChangeSimulationResult(SynthesisAlgorithm::LineAware);
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/statistics.hpp"
+#include "core/syrec/expression.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/number.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+#include "differential_verification_test_fixture.hpp"
+#include "syrec_ir_builder.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+using namespace syrec;
+using namespace syrec_ir_builder;
+
+namespace {
+    class ConcurrentSynthesisTestsFixture: public DifferentialVerificationTestFixture {
+    protected:
+        Module::ptr   mainModule = std::make_shared<Module>("main");
+        Variable::ptr a          = std::make_shared<Variable>(Variable::Type::In, "a", std::vector<unsigned>({1U}), 4U);
+        Variable::ptr b          = std::make_shared<Variable>(Variable::Type::Inout, "b", std::vector<unsigned>({1U}), 4U);
+        Variable::ptr c          = std::make_shared<Variable>(Variable::Type::In, "c", std::vector<unsigned>({1U}), 4U);
+        Variable::ptr d          = std::make_shared<Variable>(Variable::Type::Inout, "d", std::vector<unsigned>({1U}), 4U);
+
+        void SetUp() override {
+            mainModule->addParameter(a);
+            mainModule->addParameter(b);
+            mainModule->addParameter(c);
+            mainModule->addParameter(d);
+            program.addModule(mainModule);
+        }
+
+        void addAssignment(const Variable::ptr& assignedToVariable, const AssignStatement::AssignOperation assignOperation, const Variable::ptr& lhsOperand, const BinaryExpression::BinaryOperation binaryOperation, const Variable::ptr& rhsOperand) const {
+            mainModule->addStatement(std::make_shared<AssignStatement>(createVariableAccess(assignedToVariable), assignOperation, std::make_shared<BinaryExpression>(createVariableExpression(lhsOperand), binaryOperation, createVariableExpression(rhsOperand))));
+        }
+
+        [[nodiscard]] static ConfigurableOptions createSettingsOfConcurrentSynthesis(const std::size_t numThreads) {
+            ConfigurableOptions settings;
+            settings.synthesizeIndependentStatementsConcurrently = true;
+            settings.numThreadsOfConcurrentSynthesis             = numThreads;
+            return settings;
+        }
+
+        void assertConcurrentSynthesisDoesNotChangeSimulationResult(const SynthesisAlgorithm synthesisAlgorithm) const {
+            ASSERT_NO_FATAL_FAILURE(assertSynthesisDoesNotChangeSimulationResult(program, createSettingsOfConcurrentSynthesis(4U), synthesisAlgorithm));
+        }
+
+        void addStatementsOfTwoIndependentGroups() const {
+            addAssignment(b, AssignStatement::AssignOperation::Add, a, BinaryExpression::BinaryOperation::Add, c);
+            addAssignment(d, AssignStatement::AssignOperation::Exor, c, BinaryExpression::BinaryOperation::Subtract, a);
+            addAssignment(b, AssignStatement::AssignOperation::Subtract, c, BinaryExpression::BinaryOperation::Exor, a);
+            addAssignment(d, AssignStatement::AssignOperation::Add, c, BinaryExpression::BinaryOperation::Add, a);
+        }
+    };
+} // namespace
+
+TEST_F(ConcurrentSynthesisTestsFixture, SynthesisOfIndependentStatementsDoesNotDependOnNumberOfThreads) {
+    addStatementsOfTwoIndependentGroups();
+
+    AnnotatableQuantumComputation synthesizedWithOneThread;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(synthesizedWithOneThread, program, createSettingsOfConcurrentSynthesis(1U)));
+
+    AnnotatableQuantumComputation synthesizedWithMultipleThreads;
+    Statistics                    statistics;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(synthesizedWithMultipleThreads, program, createSettingsOfConcurrentSynthesis(4U), &statistics));
+    assertQuantumComputationsAreEqual(synthesizedWithOneThread, synthesizedWithMultipleThreads);
+
+    // Both groups use separate ancillary qubits for the results of the right-hand side expressions which are not reused across statements, thus the number of qubits matches the sequential synthesis.
+    AnnotatableQuantumComputation synthesizedSequentially;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(synthesizedSequentially, program));
+    ASSERT_EQ(synthesizedSequentially.getNqubits(), synthesizedWithMultipleThreads.getNqubits());
+    ASSERT_EQ(synthesizedSequentially.getNops(), synthesizedWithMultipleThreads.getNops());
+    ASSERT_EQ(synthesizedWithMultipleThreads.getNops(), statistics.numQuantumOperations);
+}
+
+TEST_F(ConcurrentSynthesisTestsFixture, DependentStatementsAreSynthesizedSequentially) {
+    addAssignment(b, AssignStatement::AssignOperation::Add, a, BinaryExpression::BinaryOperation::Add, c);
+    addAssignment(d, AssignStatement::AssignOperation::Exor, b, BinaryExpression::BinaryOperation::Subtract, a);
+    addAssignment(b, AssignStatement::AssignOperation::Subtract, c, BinaryExpression::BinaryOperation::Exor, a);
+
+    AnnotatableQuantumComputation synthesizedConcurrently;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(synthesizedConcurrently, program, createSettingsOfConcurrentSynthesis(4U)));
+
+    AnnotatableQuantumComputation synthesizedSequentially;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(synthesizedSequentially, program));
+    assertQuantumComputationsAreEqual(synthesizedSequentially, synthesizedConcurrently);
+}
+
+TEST_F(ConcurrentSynthesisTestsFixture, ConcurrentSynthesisOfIndependentStatementsDoesNotChangeSimulationResult) {
+    addStatementsOfTwoIndependentGroups();
+    assertConcurrentSynthesisDoesNotChangeSimulationResult(SynthesisAlgorithm::CostAware);
+    assertConcurrentSynthesisDoesNotChangeSimulationResult(SynthesisAlgorithm::LineAware);
+    assertConcurrentSynthesisDoesNotChangeSimulationResult(SynthesisAlgorithm::Hybrid);
+}
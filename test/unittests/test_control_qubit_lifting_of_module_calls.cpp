@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/syrec/program.hpp"
+#include "differential_verification_test_fixture.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace syrec;
+
+namespace {
+    class ControlQubitLiftingOfModuleCallsTestsFixture: public DifferentialVerificationTestFixture {
+    protected:
+        [[nodiscard]] static ConfigurableOptions createSettingsLiftingControlQubitsOfModuleCalls() {
+            ConfigurableOptions settings;
+            settings.liftControlQubitsOfModuleCalls       = true;
+            settings.reuseAncillaryQubitsAcrossStatements = true;
+            return settings;
+        }
+
+        void assertLiftingControlQubitsOfModuleCallsDoesNotChangeSimulationResult(const SynthesisAlgorithm synthesisAlgorithm) const {
+            ASSERT_NO_FATAL_FAILURE(assertSynthesisDoesNotChangeSimulationResult(program, createSettingsLiftingControlQubitsOfModuleCalls(), synthesisAlgorithm));
+        }
+    };
+} // namespace
+
+TEST_F(ControlQubitLiftingOfModuleCallsTestsFixture, ComputeAndUncomputeOfModuleCallInBranchAreNotControlled) {
+    parseProgram("module f(inout a(2), in b(2), in c(2)) a ^= (b & c) module main(inout a(2), in b(2), in c(2), in g(1)) if g then call f(a, b, c) else skip fi g");
+
+    ConfigurableOptions defaultSettings;
+    defaultSettings.reuseAncillaryQubitsAcrossStatements = true;
+
+    AnnotatableQuantumComputation quantumComputationWithControlledModuleCall;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(quantumComputationWithControlledModuleCall, program, defaultSettings));
+
+    AnnotatableQuantumComputation quantumComputationWithLiftedControlQubits;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(quantumComputationWithLiftedControlQubits, program, createSettingsLiftingControlQubitsOfModuleCalls()));
+
+    ASSERT_EQ(quantumComputationWithControlledModuleCall.getNops(), quantumComputationWithLiftedControlQubits.getNops());
+    ASSERT_GT(quantumComputationWithControlledModuleCall.getQuantumCostForSynthesis(), quantumComputationWithLiftedControlQubits.getQuantumCostForSynthesis());
+}
+
+TEST_F(ControlQubitLiftingOfModuleCallsTestsFixture, ModuleCallWithoutUncomputedQuantumOperationsIsNotChanged) {
+    parseProgram("module inc(inout x(4)) ++= x module main(inout a(4), in g(1)) if g then call inc(a) else skip fi g");
+
+    ConfigurableOptions defaultSettings;
+    defaultSettings.reuseAncillaryQubitsAcrossStatements = true;
+
+    AnnotatableQuantumComputation quantumComputationWithControlledModuleCall;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(quantumComputationWithControlledModuleCall, program, defaultSettings));
+
+    AnnotatableQuantumComputation quantumComputationWithLiftedControlQubits;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(quantumComputationWithLiftedControlQubits, program, createSettingsLiftingControlQubitsOfModuleCalls()));
+
+    assertQuantumComputationsAreEqual(quantumComputationWithControlledModuleCall, quantumComputationWithLiftedControlQubits);
+}
+
+TEST_F(ControlQubitLiftingOfModuleCallsTestsFixture, LiftingControlQubitsOfModuleCallsDoesNotChangeSimulationResult) {
+    parseProgram("module f(inout a(2), in b(2), in c(2)) a ^= (b & c); a += (b ^ c) module main(inout a(2), in b(2), in c(2), in g(1)) if g then call f(a, b, c); uncall f(a, b, c) else call f(a, c, b) fi g");
+    assertLiftingControlQubitsOfModuleCallsDoesNotChangeSimulationResult(SynthesisAlgorithm::CostAware);
+    assertLiftingControlQubitsOfModuleCallsDoesNotChangeSimulationResult(SynthesisAlgorithm::LineAware);
+}
@@ -8,17 +8,25 @@
  * Licensed under the MIT License
  */
 
+#include "algorithms/simulation/circuit_to_truthtable.hpp"
+#include "algorithms/synthesis/dd_package_settings.hpp"
 #include "algorithms/synthesis/dd_synthesis.hpp"
+#include "core/execution_limits.hpp"
 #include "core/io/pla_parser.hpp"
 #include "core/truthTable/truth_table.hpp"
 #include "dd/FunctionalityConstruction.hpp"
 #include "dd/Package.hpp"
 
 #include <algorithm>
+#include <chrono>
+#include <cstddef>
 #include <gtest/gtest.h>
 #include <iostream>
 #include <memory>
+#include <ranges>
 #include <string>
+#include <utility>
+#include <vector>
 
 using namespace syrec;
 
@@ -82,3 +90,152 @@ TEST_P(TestDDSynth, GenericDDSynthesisTest) {
     std::cout << synthesizer.numGate() << "\n";
     std::cout << synthesizer.getExecutionTime() << "\n";
 }
+
+TEST(DDSynthesisGarbageCollectionPolicyTests, SynthesisUsingGarbageCollectionPolicyPreservesFunctionality) {
+    using Trigger = DDSynthesizer::GarbageCollectionPolicy::Trigger;
+    for (const Trigger trigger: {Trigger::PackageManaged, Trigger::NodeCountThreshold, Trigger::MemoryBudget, Trigger::EveryKIterations}) {
+        TruthTable tt{};
+        ASSERT_TRUE(readPla(tt, "./circuits/hwb5_13.pla"));
+
+        auto       dd   = std::make_unique<dd::Package>(tt.nInputs());
+        const auto ttDD = buildDD(tt, dd);
+
+        DDSynthesizer::GarbageCollectionPolicy garbageCollectionPolicy;
+        garbageCollectionPolicy.trigger                         = trigger;
+        garbageCollectionPolicy.nodeCountThreshold              = 64U;
+        garbageCollectionPolicy.memoryBudgetInMiB               = 0.;
+        garbageCollectionPolicy.numIterationsBetweenCollections = 2U;
+
+        DDSynthesizer synthesizer(garbageCollectionPolicy);
+        const auto    qc   = synthesizer.synthesize(ttDD, dd);
+        const auto&   qcDD = dd::buildFunctionality(*qc, *dd);
+        ASSERT_TRUE(ttDD == qcDD);
+
+        const DDSynthesizer::Statistics& statistics = synthesizer.getStatistics();
+        ASSERT_GT(statistics.uniqueTableLookups, 0U);
+        ASSERT_GT(statistics.computeTableLookups, 0U);
+        ASSERT_LE(statistics.uniqueTableHitRatio(), 1.);
+        ASSERT_LE(statistics.computeTableHitRatio(), 1.);
+        ASSERT_GT(statistics.peakMemoryInMiB, 0.);
+        ASSERT_LE(statistics.activeMemoryInMiB, statistics.peakMemoryInMiB);
+        if (trigger != Trigger::PackageManaged) {
+            ASSERT_GT(statistics.numGarbageCollections, 0U);
+        }
+    }
+}
+
+TEST(DDSynthesisPackageSettingsTests, SynthesisUsingResizedTablesPreservesFunctionality) {
+    TruthTable tt{};
+    ASSERT_TRUE(readPla(tt, "./circuits/hwb5_13.pla"));
+
+    DDPackageSettings ddPackageSettings;
+    ddPackageSettings.uniqueTableNumBuckets                = 1U << 10U;
+    ddPackageSettings.uniqueTableInitialAllocationSize     = 256U;
+    ddPackageSettings.multiplicationComputeTableNumBuckets = 1U << 16U;
+    ddPackageSettings.additionComputeTableNumBuckets       = 1U << 10U;
+
+    auto       dd   = createDDPackage(tt.nInputs(), ddPackageSettings);
+    const auto ttDD = buildDD(tt, dd);
+
+    DDSynthesizer synthesizer{};
+    const auto    qc   = synthesizer.synthesize(ttDD, dd);
+    const auto&   qcDD = dd::buildFunctionality(*qc, *dd);
+    ASSERT_TRUE(ttDD == qcDD);
+
+    const DDSynthesizer::Statistics& statistics = synthesizer.getStatistics();
+    ASSERT_GT(statistics.numNodes, 0U);
+    ASSERT_GE(statistics.peakNumNodes, statistics.numNodes);
+    ASSERT_GT(statistics.computeTableLookups, 0U);
+
+    // the synthesis of a truth table creates its own DD package using the settings
+    const auto qcOnePass = DDSynthesizer::synthesizeOnePass(tt, false, ddPackageSettings);
+    ASSERT_NE(nullptr, qcOnePass);
+    TruthTable ttOnePass{};
+    TruthTableExtractionSettings extractionSettings;
+    extractionSettings.useClassicalSimulationForPermutationCircuits = false;
+    extractionSettings.ddPackageSettings                            = ddPackageSettings;
+    ASSERT_TRUE(buildTruthTable(*qcOnePass, ttOnePass, extractionSettings));
+    EXPECT_TRUE(TruthTable::equal(tt, ttOnePass));
+}
+
+TEST(DDSynthesisExecutionLimitsTests, CancelledSynthesisReturnsNoCircuit) {
+    TruthTable tt{};
+    ASSERT_TRUE(readPla(tt, "./circuits/hwb5_13.pla"));
+
+    auto       dd   = std::make_unique<dd::Package>(tt.nInputs());
+    const auto ttDD = buildDD(tt, dd);
+
+    const CancellationToken cancellationToken;
+    cancellationToken.requestCancellation();
+    DDSynthesizer synthesizer{};
+    synthesizer.setExecutionLimits(ExecutionLimits{.optionalCancellationToken = cancellationToken});
+    ASSERT_EQ(nullptr, synthesizer.synthesize(ttDD, dd));
+    ASSERT_EQ(ExecutionLimitViolation::Cancelled, synthesizer.getExecutionLimitViolation());
+
+    synthesizer.reset();
+    ASSERT_EQ(ExecutionLimitViolation::None, synthesizer.getExecutionLimitViolation());
+}
+
+TEST(DDSynthesisEffortSettingsTests, BoundedEffortSynthesisPreservesFunctionality) {
+    using EffortMode = DDSynthesizer::EffortMode;
+
+    TruthTable tt{};
+    ASSERT_TRUE(readPla(tt, "./circuits/hwb5_13.pla"));
+
+    const std::vector<std::pair<DDSynthesizer::EffortSettings, EffortMode>> effortSettingsAndExpectedModes = {
+            {DDSynthesizer::EffortSettings{}, EffortMode::Exhaustive},
+            {DDSynthesizer::EffortSettings{.maxPathSignatureSize = 2U}, EffortMode::Bounded},
+            {DDSynthesizer::EffortSettings{.greedyUniquePathSearch = true}, EffortMode::Bounded},
+            // the budget is already exceeded once the first node is processed
+            {DDSynthesizer::EffortSettings{.timeBudget = std::chrono::nanoseconds(1)}, EffortMode::Fallback}};
+
+    for (const auto& [effortSettings, expectedMode]: effortSettingsAndExpectedModes) {
+        auto       dd   = std::make_unique<dd::Package>(tt.nInputs());
+        const auto ttDD = buildDD(tt, dd);
+
+        DDSynthesizer synthesizer{};
+        synthesizer.setEffortSettings(effortSettings);
+        const auto qc = synthesizer.synthesize(ttDD, dd);
+        ASSERT_NE(nullptr, qc);
+        const auto& qcDD = dd::buildFunctionality(*qc, *dd);
+        ASSERT_TRUE(ttDD == qcDD);
+        ASSERT_EQ(expectedMode, synthesizer.getStatistics().effortMode);
+    }
+}
+
+TEST(DDSynthesisLineReorderingTests, SynthesisOfReorderedLinesPreservesFunctionality) {
+    using Strategy = LineReorderingSettings::Strategy;
+    for (const std::string& circuitName: {"hwb5_13", "urf1", "graycode", "4_49_7"}) {
+        TruthTable tt{};
+        ASSERT_TRUE(readPla(tt, "./circuits/" + circuitName + ".pla"));
+
+        for (const Strategy strategy: {Strategy::None, Strategy::Sifting, Strategy::WindowPermutation}) {
+            LineReorderingSettings settings;
+            settings.strategy = strategy;
+
+            const auto order = determineLineOrder(tt, settings);
+            ASSERT_EQ(tt.nInputs(), order.size());
+            ASSERT_TRUE(std::ranges::is_permutation(order, std::views::iota(std::size_t{0U}, tt.nInputs())));
+            if (strategy == Strategy::None) {
+                ASSERT_TRUE(std::ranges::is_sorted(order));
+            }
+
+            const auto qc   = DDSynthesizer::synthesizeWithReorderedLines(tt, settings);
+            auto       dd   = std::make_unique<dd::Package>(tt.nInputs());
+            const auto ttDD = buildDD(tt, dd);
+            ASSERT_TRUE(ttDD == dd::buildFunctionality(*qc, *dd)) << circuitName;
+        }
+    }
+}
+
+TEST(DDSynthesisLineReorderingTests, ReorderingLinesTwiceWithInverseOrderRestoresTruthTable) {
+    TruthTable tt{};
+    ASSERT_TRUE(readPla(tt, "./circuits/hwb6_14.pla"));
+
+    const auto order = determineLineOrder(tt, LineReorderingSettings{});
+    std::vector<std::size_t> inverseOrder(order.size());
+    for (std::size_t i = 0U; i < order.size(); ++i) {
+        inverseOrder[order[i]] = i;
+    }
+    ASSERT_TRUE(TruthTable::equal(tt, reorderLines(reorderLines(tt, order), inverseOrder), false));
+}
@@ -14,9 +14,11 @@
 #include "core/truthTable/truth_table.hpp"
 
 #include <algorithm>
+#include <cstddef>
 #include <gtest/gtest.h>
 #include <iostream>
 #include <string>
+#include <vector>
 
 using namespace qc::literals;
 using namespace syrec;
@@ -72,7 +74,7 @@ TEST_P(TestDDSynthDc, GenericDDSynthesisDcTest) {
 
     const auto& qc = DDSynthesizer::synthesizeCodingTechniques(tt);
 
-    buildTruthTable(*qc, ttqc);
+    ASSERT_TRUE(buildTruthTable(*qc, ttqc));
 
     EXPECT_TRUE(TruthTable::equal(ttqc, tt));
     EXPECT_TRUE(TruthTable::equal(tt, ttqc));
@@ -85,7 +87,33 @@ TEST_P(TestDDSynthDc, GenericDDSynthesisDcTestEncodingWithoutAdditionalLine) {
 
     const auto& qc = DDSynthesizer::synthesizeCodingTechniques(tt, false);
 
-    buildTruthTable(*qc, ttqc);
+    ASSERT_TRUE(buildTruthTable(*qc, ttqc));
+
+    EXPECT_TRUE(TruthTable::equal(ttqc, tt));
+    EXPECT_TRUE(TruthTable::equal(tt, ttqc));
+
+    std::cout << qc->getNops() << "\n";
+}
+
+TEST_P(TestDDSynthDc, GenericDDSynthesisDcTestWithEsopDecoder) {
+    EXPECT_TRUE(readPla(tt, fileName));
+
+    const auto& qc = DDSynthesizer::synthesizeCodingTechniques(tt, true, DDSynthesizer::DecoderMode::EsopNetwork);
+
+    ASSERT_TRUE(buildTruthTable(*qc, ttqc));
+
+    EXPECT_TRUE(TruthTable::equal(ttqc, tt));
+    EXPECT_TRUE(TruthTable::equal(tt, ttqc));
+
+    std::cout << qc->getNops() << "\n";
+}
+
+TEST_P(TestDDSynthDc, GenericDDSynthesisDcTestEncodingWithoutAdditionalLineWithEsopDecoder) {
+    EXPECT_TRUE(readPla(tt, fileName));
+
+    const auto& qc = DDSynthesizer::synthesizeCodingTechniques(tt, false, DDSynthesizer::DecoderMode::EsopNetwork);
+
+    ASSERT_TRUE(buildTruthTable(*qc, ttqc));
 
     EXPECT_TRUE(TruthTable::equal(ttqc, tt));
     EXPECT_TRUE(TruthTable::equal(tt, ttqc));
@@ -98,10 +126,56 @@ TEST_P(TestDDSynthDc, GenericDDSynthesisOnePass) {
 
     const auto& qc = DDSynthesizer::synthesizeOnePass(tt);
 
-    buildTruthTable(*qc, ttqc);
+    ASSERT_TRUE(buildTruthTable(*qc, ttqc));
 
     EXPECT_TRUE(TruthTable::equal(ttqc, tt));
     EXPECT_TRUE(TruthTable::equal(tt, ttqc));
 
     std::cout << qc->getNops() << "\n";
 }
+
+TEST_P(TestDDSynthDc, GenericDDSynthesisOnePassWithMemoizedDDConstruction) {
+    EXPECT_TRUE(readPla(tt, fileName));
+
+    const auto& qc         = DDSynthesizer::synthesizeOnePass(tt);
+    const auto& qcMemoized = DDSynthesizer::synthesizeOnePass(tt, true);
+
+    // the memoized construction yields the same DD and thus the same circuit
+    EXPECT_EQ(qc->getNops(), qcMemoized->getNops());
+
+    ASSERT_TRUE(buildTruthTable(*qcMemoized, ttqc));
+
+    EXPECT_TRUE(TruthTable::equal(ttqc, tt));
+    EXPECT_TRUE(TruthTable::equal(tt, ttqc));
+}
+
+TEST_P(TestDDSynthDc, GenericDDSynthesisOnePassPartitionedByOutputCones) {
+    EXPECT_TRUE(readPla(tt, fileName));
+
+    const auto& qc = DDSynthesizer::synthesizeOnePassPartitioned(tt, 2U, 2U);
+
+    ASSERT_TRUE(buildTruthTable(*qc, ttqc));
+
+    EXPECT_TRUE(TruthTable::equal(ttqc, tt));
+    EXPECT_TRUE(TruthTable::equal(tt, ttqc));
+
+    std::cout << qc->getNops() << "\n";
+}
+
+TEST(TestDDSynthDcBatch, BatchSynthesisMatchesSynthesisOfIndividualTruthTables) {
+    std::vector<TruthTable> tts;
+    for (const std::string fileName: {"huff_1", "dc3bit", "rd53", "z4", "majority"}) {
+        ASSERT_TRUE(readPla(tts.emplace_back(), "./circuits/" + fileName + ".pla"));
+    }
+
+    const auto synthesizedQcs = DDSynthesizer::synthesizeOnePassBatch(tts, 3U);
+    ASSERT_EQ(tts.size(), synthesizedQcs.size());
+    for (std::size_t i = 0; i < tts.size(); ++i) {
+        ASSERT_NE(nullptr, synthesizedQcs[i]);
+        EXPECT_EQ(DDSynthesizer::synthesizeOnePass(tts[i])->getNops(), synthesizedQcs[i]->getNops());
+
+        TruthTable ttqc{};
+        ASSERT_TRUE(buildTruthTable(*synthesizedQcs[i], ttqc));
+        EXPECT_TRUE(TruthTable::equal(ttqc, tts[i]));
+    }
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/diagnostics.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace syrec;
+
+TEST(DiagnosticsTests, ReportedErrorsAreSplitIntoNonEmptyLines) {
+    Diagnostics diagnostics;
+    ASSERT_FALSE(diagnostics.hasErrors());
+    diagnostics.reportErrors("first error\n\nsecond error\nthird error");
+    ASSERT_EQ(std::vector<std::string>({"first error", "second error", "third error"}), diagnostics.getErrorMessages());
+
+    diagnostics.clear();
+    ASSERT_FALSE(diagnostics.hasErrors());
+}
+
+TEST(DiagnosticsTests, ErrorStreamWithoutActiveCollectionIsStandardErrorStream) {
+    ASSERT_EQ(&std::cerr, &getErrorStream());
+}
+
+TEST(DiagnosticsTests, ErrorsAreOnlyCollectedByInnermostCollection) {
+    Diagnostics outerDiagnostics;
+    Diagnostics innerDiagnostics;
+    {
+        const ScopedDiagnosticsCollection outerCollection(outerDiagnostics);
+        getErrorStream() << "outer error\n";
+        {
+            const ScopedDiagnosticsCollection innerCollection(innerDiagnostics);
+            getErrorStream() << "inner error\n";
+        }
+        getErrorStream() << "second outer error\n";
+    }
+    ASSERT_EQ(&std::cerr, &getErrorStream());
+    ASSERT_EQ(std::vector<std::string>({"outer error", "second outer error"}), outerDiagnostics.getErrorMessages());
+    ASSERT_EQ(std::vector<std::string>({"inner error"}), innerDiagnostics.getErrorMessages());
+}
+
+TEST(DiagnosticsTests, ErrorsOfConcurrentCollectionsAreNotInterleaved) {
+    constexpr std::size_t    numThreads         = 4;
+    constexpr std::size_t    numErrorsPerThread = 100;
+    std::vector<Diagnostics> diagnosticsPerThread(numThreads);
+
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads);
+    for (std::size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex) {
+        threads.emplace_back([&diagnostics = diagnosticsPerThread[threadIndex], threadIndex] {
+            const ScopedDiagnosticsCollection collection(diagnostics);
+            for (std::size_t i = 0; i < numErrorsPerThread; ++i) {
+                getErrorStream() << "error of thread " << threadIndex << "\n";
+            }
+        });
+    }
+    for (auto& thread: threads) {
+        thread.join();
+    }
+
+    for (std::size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex) {
+        ASSERT_EQ(std::vector<std::string>(numErrorsPerThread, "error of thread " + std::to_string(threadIndex)), diagnosticsPerThread[threadIndex].getErrorMessages());
+    }
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/differential_verification.hpp"
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "core/configurable_options.hpp"
+#include "core/diagnostics.hpp"
+#include "core/statistics.hpp"
+#include "core/syrec/expression.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/number.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+#include "syrec_ir_builder.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+using namespace syrec;
+using namespace syrec_ir_builder;
+
+namespace {
+    class DifferentialVerificationTestsFixture: public testing::TestWithParam<SynthesisAlgorithm> {
+    protected:
+        Program       program;
+        Module::ptr   mainModule = std::make_shared<Module>("main");
+        Variable::ptr a          = std::make_shared<Variable>(Variable::Type::In, "a", std::vector<unsigned>({1U}), 4U);
+        Variable::ptr b          = std::make_shared<Variable>(Variable::Type::Inout, "b", std::vector<unsigned>({2U}), 4U);
+        Variable::ptr c          = std::make_shared<Variable>(Variable::Type::Out, "c", std::vector<unsigned>({1U}), 4U);
+        Variable::ptr t          = std::make_shared<Variable>(Variable::Type::Wire, "t", std::vector<unsigned>({1U}), 4U);
+
+        void SetUp() override {
+            mainModule->addParameter(a);
+            mainModule->addParameter(b);
+            mainModule->addParameter(c);
+            mainModule->variables = {t};
+            program.addModule(mainModule);
+        }
+
+        [[nodiscard]] DifferentialVerificationSettings createSettings(const std::size_t numThreads) const {
+            return DifferentialVerificationSettings{.synthesisAlgorithm = GetParam(), .numStimuli = 1000U, .seed = 5U, .numThreads = numThreads};
+        }
+    };
+} // namespace
+
+INSTANTIATE_TEST_SUITE_P(DifferentialVerificationTests, DifferentialVerificationTestsFixture, testing::Values(SynthesisAlgorithm::CostAware, SynthesisAlgorithm::LineAware, SynthesisAlgorithm::Hybrid), [](const testing::TestParamInfo<SynthesisAlgorithm>& info) {
+    switch (info.param) {
+        case SynthesisAlgorithm::CostAware:
+            return "CostAwareSynthesis";
+        case SynthesisAlgorithm::LineAware:
+            return "LineAwareSynthesis";
+        default:
+            return "HybridSynthesis";
+    }
+});
+
+TEST_P(DifferentialVerificationTestsFixture, SynthesizedQuantumComputationMatchesInterpretation) {
+    // t ^= (a * b[1]); b[0] += (t - a); c ^= (b[0] / b[1]); t ^= (a * b[1])
+    const Expression::ptr product = std::make_shared<BinaryExpression>(createVariableExpression(a), BinaryExpression::BinaryOperation::Multiply, createVariableExpression(b, 1U));
+    mainModule->addStatement(createAssignment(createVariableAccess(t), AssignStatement::AssignOperation::Exor, product, 1U));
+    mainModule->addStatement(createAssignment(createVariableAccess(b), AssignStatement::AssignOperation::Add, std::make_shared<BinaryExpression>(createVariableExpression(t), BinaryExpression::BinaryOperation::Subtract, createVariableExpression(a)), 2U));
+    mainModule->addStatement(createAssignment(createVariableAccess(c), AssignStatement::AssignOperation::Exor, std::make_shared<BinaryExpression>(createVariableExpression(b), BinaryExpression::BinaryOperation::Divide, createVariableExpression(b, 1U)), 3U));
+    mainModule->addStatement(createAssignment(createVariableAccess(t), AssignStatement::AssignOperation::Exor, product, 4U));
+
+    for (const std::size_t numThreads: {1U, 4U, 0U}) {
+        DifferentialVerificationResult result;
+        Statistics                     statistics;
+        ASSERT_TRUE(differentialVerification(result, program, ConfigurableOptions(), createSettings(numThreads), &statistics));
+        ASSERT_EQ(1000U, result.numCheckedStimuli);
+        ASSERT_FALSE(result.firstMismatch.has_value());
+    }
+}
+
+TEST_P(DifferentialVerificationTestsFixture, FailedInterpretationIsReported) {
+    // if (a = b[0]) then b[0] += 1 fi (a = b[0]) with the interpretation failing for every stimulus with a = b[0] due to the fi condition not matching the if condition
+    const auto ifStatement = std::make_shared<IfStatement>();
+    ifStatement->setCondition(std::make_shared<BinaryExpression>(createVariableExpression(a), BinaryExpression::BinaryOperation::Equals, createVariableExpression(b)));
+    ifStatement->addThenStatement(createAssignment(createVariableAccess(b), AssignStatement::AssignOperation::Add, std::make_shared<NumericExpression>(std::make_shared<Number>(1U), 4U), 2U));
+    ifStatement->setFiCondition(std::make_shared<BinaryExpression>(createVariableExpression(a), BinaryExpression::BinaryOperation::Equals, createVariableExpression(b)));
+    ifStatement->lineNumber = 1U;
+    mainModule->addStatement(ifStatement);
+
+    DifferentialVerificationResult result;
+    Diagnostics                    diagnostics;
+    {
+        const ScopedDiagnosticsCollection diagnosticsCollection(diagnostics);
+        ASSERT_FALSE(differentialVerification(result, program, ConfigurableOptions(), createSettings(2U)));
+    }
+    ASSERT_TRUE(diagnostics.hasErrors());
+    ASSERT_EQ(0U, result.numCheckedStimuli);
+}
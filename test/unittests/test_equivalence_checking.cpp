@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/equivalence_checking.hpp"
+#include "core/truthTable/truth_table.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    // the sum and carry of a full adder with the carry being computed into an ancillary line and the second operand being garbage
+    auto createFullAdder(const bool useSwapInsteadOfCx) -> qc::QuantumComputation {
+        qc::QuantumComputation quantumComputation(4);
+        quantumComputation.setLogicalQubitAncillary(0);
+        quantumComputation.setLogicalQubitGarbage(2);
+        quantumComputation.mcx(qc::Controls({2, 3}), 0);
+        quantumComputation.cx(3, 2);
+        quantumComputation.mcx(qc::Controls({1, 2}), 0);
+        if (useSwapInsteadOfCx) {
+            // the garbage line is not required to hold the same value
+            quantumComputation.swap(1, 2);
+            quantumComputation.cx(2, 1);
+        } else {
+            quantumComputation.cx(2, 1);
+        }
+        return quantumComputation;
+    }
+
+    auto createChainOfToffoliGates(const std::size_t nQubits) -> qc::QuantumComputation {
+        qc::QuantumComputation quantumComputation(nQubits);
+        for (std::size_t i = 0; i + 2U < nQubits; ++i) {
+            quantumComputation.mcx(qc::Controls({static_cast<qc::Qubit>(i), static_cast<qc::Qubit>(i + 1U)}), static_cast<qc::Qubit>(i + 2U));
+        }
+        quantumComputation.swap(0, static_cast<qc::Qubit>(nQubits - 1U));
+        return quantumComputation;
+    }
+} // namespace
+
+TEST(EquivalenceCheckingTest, IdenticalCircuitsAreEquivalent) {
+    const auto quantumComputation = createChainOfToffoliGates(8U);
+    for (const std::size_t numThreads: {1U, 3U}) {
+        const auto result = checkEquivalence(quantumComputation, quantumComputation, EquivalenceCheckingSettings{.numThreads = numThreads});
+        ASSERT_EQ(EquivalenceCheckingResult::Outcome::Equivalent, result.outcome);
+        ASSERT_EQ(256U, result.numCheckedAssignments);
+        ASSERT_TRUE(result.counterexample.empty());
+    }
+}
+
+TEST(EquivalenceCheckingTest, ValuesOfGarbageLinesAreIgnored) {
+    const auto lhs = createFullAdder(false);
+    const auto rhs = createFullAdder(true);
+    // the sum is computed into line 1 in both circuits while line 2 differs
+    const auto result = checkEquivalence(lhs, rhs);
+    ASSERT_EQ(EquivalenceCheckingResult::Outcome::Equivalent, result.outcome);
+    ASSERT_EQ(8U, result.numCheckedAssignments);
+}
+
+TEST(EquivalenceCheckingTest, ModifiedGateYieldsCounterexample) {
+    const auto             lhs = createChainOfToffoliGates(10U);
+    qc::QuantumComputation rhs(10U);
+    // only the two inputs with the qubits [1, 9] being set are mapped differently
+    rhs.mcx(qc::Controls({1, 2, 3, 4, 5, 6, 7, 8, 9}), 0);
+    for (const auto& operation: lhs) {
+        rhs.emplace_back(operation->clone());
+    }
+
+    // the primary inputs are ordered by descending qubit index, thus the assignment with qubit 0 being zero is enumerated first
+    const auto singleThreadedResult = checkEquivalence(lhs, rhs, EquivalenceCheckingSettings{.numThreads = 1U});
+    ASSERT_EQ(EquivalenceCheckingResult::Outcome::NotEquivalent, singleThreadedResult.outcome);
+    ASSERT_EQ(std::vector<bool>({true, true, true, true, true, true, true, true, true, false}), singleThreadedResult.counterexample);
+
+    const auto multiThreadedResult = checkEquivalence(lhs, rhs, EquivalenceCheckingSettings{.numThreads = 4U});
+    ASSERT_EQ(EquivalenceCheckingResult::Outcome::NotEquivalent, multiThreadedResult.outcome);
+    ASSERT_EQ(10U, multiThreadedResult.counterexample.size());
+    for (std::size_t i = 0; i < 9U; ++i) {
+        ASSERT_TRUE(multiThreadedResult.counterexample[i]);
+    }
+}
+
+TEST(EquivalenceCheckingTest, RandomSamplingIsUsedAboveLimitOfExhaustiveCheck) {
+    const auto quantumComputation = createChainOfToffoliGates(12U);
+    const auto settings           = EquivalenceCheckingSettings{.maxNumPrimaryInputsOfExhaustiveCheck = 4U, .numRandomSamples = 1000U, .seed = 42U, .numThreads = 2U};
+
+    const auto result = checkEquivalence(quantumComputation, quantumComputation, settings);
+    ASSERT_EQ(EquivalenceCheckingResult::Outcome::ProbablyEquivalent, result.outcome);
+    ASSERT_EQ(1024U, result.numCheckedAssignments);
+    ASSERT_GT(result.maxFractionOfNonEquivalentAssignments, 0.);
+    ASSERT_LT(result.maxFractionOfNonEquivalentAssignments, 0.01);
+
+    auto modifiedQuantumComputation = createChainOfToffoliGates(12U);
+    modifiedQuantumComputation.x(5);
+    const auto resultOfModified = checkEquivalence(quantumComputation, modifiedQuantumComputation, settings);
+    ASSERT_EQ(EquivalenceCheckingResult::Outcome::NotEquivalent, resultOfModified.outcome);
+    ASSERT_EQ(12U, resultOfModified.counterexample.size());
+}
+
+TEST(EquivalenceCheckingTest, DeviceSimulationMatchesHostSimulation) {
+    const auto             lhs = createChainOfToffoliGates(10U);
+    qc::QuantumComputation rhs(10U);
+    rhs.mcx(qc::Controls({1, 2, 3, 4, 5, 6, 7, 8, 9}), 0);
+    for (const auto& operation: lhs) {
+        rhs.emplace_back(operation->clone());
+    }
+
+    // the device reports the mismatching assignment with the smallest index which is also found by the host simulation with a single thread
+    const auto hostResult   = checkEquivalence(lhs, rhs, EquivalenceCheckingSettings{.numThreads = 1U});
+    const auto deviceResult = checkEquivalence(lhs, rhs, EquivalenceCheckingSettings{.numThreads = 1U, .useDeviceSimulation = true});
+    ASSERT_EQ(hostResult.outcome, deviceResult.outcome);
+    ASSERT_EQ(hostResult.counterexample, deviceResult.counterexample);
+
+    const auto resultOfIdenticalCircuits = checkEquivalence(lhs, lhs, EquivalenceCheckingSettings{.useDeviceSimulation = true});
+    ASSERT_EQ(EquivalenceCheckingResult::Outcome::Equivalent, resultOfIdenticalCircuits.outcome);
+    ASSERT_EQ(1024U, resultOfIdenticalCircuits.numCheckedAssignments);
+    if (isDeviceSimulationAvailable()) {
+        // only the two assignments with the qubits [1, 9] being set differ in the value of qubit 0, which is the last primary output
+        ASSERT_EQ(std::vector<std::uint64_t>({0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 2U}), deviceResult.numMismatchingAssignmentsPerPrimaryOutput);
+        ASSERT_EQ(std::vector<std::uint64_t>(10U, 0U), resultOfIdenticalCircuits.numMismatchingAssignmentsPerPrimaryOutput);
+    } else {
+        ASSERT_TRUE(deviceResult.numMismatchingAssignmentsPerPrimaryOutput.empty());
+    }
+}
+
+TEST(EquivalenceCheckingTest, DifferentNumberOfPrimaryLinesIsNotEquivalent) {
+    const auto lhs = createChainOfToffoliGates(4U);
+    auto       rhs = createChainOfToffoliGates(4U);
+    rhs.setLogicalQubitGarbage(3);
+
+    const auto result = checkEquivalence(lhs, rhs);
+    ASSERT_EQ(EquivalenceCheckingResult::Outcome::NotEquivalent, result.outcome);
+    ASSERT_EQ(0U, result.numCheckedAssignments);
+}
+
+TEST(EquivalenceCheckingTest, NonClassicalGatesAreNotSupported) {
+    auto quantumComputation = createChainOfToffoliGates(3U);
+    quantumComputation.h(1);
+    ASSERT_EQ(EquivalenceCheckingResult::Outcome::NotSupported, checkEquivalence(quantumComputation, quantumComputation).outcome);
+}
+
+TEST(EquivalenceCheckingTest, CircuitMatchesTruthTableWithDontCares) {
+    // the carry (qubit 0) and sum (qubit 1) of a full adder of the qubits 3, 2 and 1 with qubit 2 being garbage, the first position of a cube corresponds to qubit 3
+    const auto quantumComputation = createFullAdder(false);
+
+    TruthTable tt;
+    tt.setConstants({true, false, false, false});
+    tt.setGarbage({false, false, true, false});
+    for (std::uint64_t input = 0U; input < 8U; ++input) {
+        const auto a     = (input >> 2U) & 1U;
+        const auto b     = (input >> 1U) & 1U;
+        const auto c     = input & 1U;
+        const auto carry = (a & b) | (a & c) | (b & c);
+        const auto sum   = a ^ b ^ c;
+        // the output of the garbage line is a don't care
+        tt.try_emplace(TruthTable::Cube::fromInteger(input << 1U, 4U), TruthTable::Cube::fromString(std::string{a != 0U ? '1' : '0', '-', sum != 0U ? '1' : '0', carry != 0U ? '1' : '0'}));
+    }
+    // the entry assigning one to the constant line does not specify the function
+    tt.try_emplace(TruthTable::Cube::fromString("0001"), TruthTable::Cube::fromString("1111"));
+
+    const auto result = checkEquivalence(quantumComputation, tt);
+    ASSERT_EQ(EquivalenceCheckingResult::Outcome::Equivalent, result.outcome);
+    ASSERT_EQ(8U, result.numCheckedAssignments);
+
+    TruthTable ttWithInputDontCares;
+    ttWithInputDontCares.setConstants({true, false, false, false});
+    ttWithInputDontCares.setGarbage({false, false, true, false});
+    // the carry is set if the last two operands are set independent of the first one
+    ttWithInputDontCares.try_emplace(TruthTable::Cube::fromString("-110"), TruthTable::Cube::fromString("---1"));
+    ASSERT_EQ(EquivalenceCheckingResult::Outcome::Equivalent, checkEquivalence(quantumComputation, ttWithInputDontCares).outcome);
+
+    ttWithInputDontCares.try_emplace(TruthTable::Cube::fromString("0-00"), TruthTable::Cube::fromString("--1-"));
+    const auto resultOfInvalidEntry = checkEquivalence(quantumComputation, ttWithInputDontCares);
+    ASSERT_EQ(EquivalenceCheckingResult::Outcome::NotEquivalent, resultOfInvalidEntry.outcome);
+    ASSERT_EQ(std::vector<bool>({false, false, false}), resultOfInvalidEntry.counterexample);
+}
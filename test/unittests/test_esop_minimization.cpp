@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/optimization/esop_minimization.hpp"
+#include "core/truthTable/truth_table.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    // Assert that every cube of the minimized expression only covers cubes of the on-set while every cube of the on-set is covered by at least one cube of the minimized expression.
+    void assertMinimizedExpressionCoversOnSet(const TruthTable::Cube::Set& onSet, const TruthTable::Cube::Set& minimizedExpression) {
+        TruthTable::Cube::Set coveredCubes;
+        for (const TruthTable::Cube& cube: minimizedExpression) {
+            std::vector<std::size_t> dontCarePositions;
+            for (std::size_t i = 0; i < cube.size(); ++i) {
+                if (!cube[i].has_value()) {
+                    dontCarePositions.emplace_back(i);
+                }
+            }
+            ASSERT_LT(dontCarePositions.size(), 20U);
+
+            for (std::uint64_t assignment = 0; assignment < (static_cast<std::uint64_t>(1) << dontCarePositions.size()); ++assignment) {
+                TruthTable::Cube coveredCube = cube;
+                for (std::size_t i = 0; i < dontCarePositions.size(); ++i) {
+                    coveredCube[dontCarePositions[i]] = ((assignment >> i) & 1U) != 0U;
+                }
+                ASSERT_TRUE(onSet.contains(coveredCube)) << "Cube " << cube.toString() << " covers " << coveredCube.toString() << " which is not part of the on-set";
+                coveredCubes.emplace(coveredCube);
+            }
+        }
+        ASSERT_EQ(onSet, coveredCubes);
+    }
+
+    [[nodiscard]] TruthTable::Cube::Set generateRandomOnSet(const std::size_t numInputs, const unsigned seed) {
+        std::mt19937_64       generator(seed);
+        TruthTable::Cube::Set onSet;
+        for (std::uint64_t i = 0; i < (static_cast<std::uint64_t>(1) << numInputs); ++i) {
+            if ((generator() & 1U) != 0U) {
+                onSet.emplace(TruthTable::Cube::fromInteger(i, numInputs));
+            }
+        }
+        return onSet;
+    }
+} // namespace
+
+TEST(EsopMinimizationTests, HeuristicMinimizationOfSmallFunction) {
+    const TruthTable::Cube::Set onSet = {TruthTable::Cube::fromString("000"), TruthTable::Cube::fromString("001"), TruthTable::Cube::fromString("011"), TruthTable::Cube::fromString("111")};
+
+    const TruthTable::Cube::Set minimizedExpression = minbool::minimizeBooleanHeuristically(onSet);
+    ASSERT_NO_FATAL_FAILURE(assertMinimizedExpressionCoversOnSet(onSet, minimizedExpression));
+    ASSERT_EQ(minbool::minimizeBoolean(onSet).size(), minimizedExpression.size());
+}
+
+TEST(EsopMinimizationTests, HeuristicMinimizationOfRandomFunction) {
+    const TruthTable::Cube::Set onSet = generateRandomOnSet(10U, 42U);
+    ASSERT_GT(onSet.size(), minbool::MAX_NUM_CUBES_OF_EXACTLY_MINIMIZED_ON_SET);
+
+    const TruthTable::Cube::Set minimizedExpression = minbool::minimizeBooleanHeuristically(onSet);
+    ASSERT_NO_FATAL_FAILURE(assertMinimizedExpressionCoversOnSet(onSet, minimizedExpression));
+    ASSERT_LT(minimizedExpression.size(), onSet.size());
+
+    // On-sets exceeding the size limit of the exact minimization are minimized heuristically
+    ASSERT_EQ(minimizedExpression, minbool::minimizeBoolean(onSet));
+}
+
+TEST(EsopMinimizationTests, MinimizationOfCubesWithMoreThan64Positions) {
+    constexpr std::size_t cubeSize = 100U;
+    TruthTable::Cube      baseCube(cubeSize, false);
+    baseCube[50] = true;
+
+    // All but one of the combinations of the values at the positions 3, 70 and 99
+    TruthTable::Cube::Set onSet;
+    for (unsigned combination = 0; combination < 7U; ++combination) {
+        TruthTable::Cube cube = baseCube;
+        cube[3]               = (combination & 1U) != 0U;
+        cube[70]              = (combination & 2U) != 0U;
+        cube[99]              = (combination & 4U) != 0U;
+        onSet.emplace(cube);
+    }
+
+    const TruthTable::Cube::Set minimizedExpression = minbool::minimizeBoolean(onSet);
+    ASSERT_NO_FATAL_FAILURE(assertMinimizedExpressionCoversOnSet(onSet, minimizedExpression));
+    ASSERT_EQ(3U, minimizedExpression.size());
+}
+
+TEST(EsopMinimizationTests, CachedMinimizedExpressionMatchesMinimizedExpression) {
+    const TruthTable::Cube::Set onSet                       = generateRandomOnSet(6U, 7U);
+    const TruthTable::Cube::Set otherOnSet                  = generateRandomOnSet(6U, 8U);
+    const TruthTable::Cube::Set expectedMinimizedExpression = minbool::minimizeBoolean(onSet);
+
+    minbool::MinimizedExpressionCache cache;
+    ASSERT_EQ(expectedMinimizedExpression, cache.minimize(onSet));
+    ASSERT_EQ(minbool::minimizeBoolean(otherOnSet), cache.minimize(otherOnSet));
+    ASSERT_EQ(expectedMinimizedExpression, cache.minimize(onSet));
+
+    cache.clear();
+    ASSERT_EQ(expectedMinimizedExpression, cache.minimize(onSet));
+}
+
+TEST(EsopMinimizationTests, ExactMinimizationOfCubesWithMoreThan64PositionsMatchesOneOfNarrowCubes) {
+    const TruthTable::Cube::Set narrowOnSet = generateRandomOnSet(6U, 3U);
+
+    // The positions appended to the cubes of the on-set are constant and thus do not change the number of cubes of the minimized expression
+    TruthTable::Cube::Set wideOnSet;
+    for (TruthTable::Cube cube: narrowOnSet) {
+        cube.resize(120U, true);
+        wideOnSet.emplace(cube);
+    }
+
+    const TruthTable::Cube::Set minimizedExpression = minbool::minimizeBoolean(wideOnSet);
+    ASSERT_NO_FATAL_FAILURE(assertMinimizedExpressionCoversOnSet(wideOnSet, minimizedExpression));
+    ASSERT_EQ(minbool::minimizeBoolean(narrowOnSet).size(), minimizedExpression.size());
+}
+
+TEST(EsopMinimizationTests, MultiOutputEsopOfOverlappingCubes) {
+    TruthTable tt;
+    tt.try_emplace(TruthTable::Cube::fromString("-1"), TruthTable::Cube::fromString("01"));
+    tt.try_emplace(TruthTable::Cube::fromString("10"), TruthTable::Cube::fromString("11"));
+    tt.try_emplace(TruthTable::Cube::fromString("11"), TruthTable::Cube::fromString("10"));
+
+    // The fully specified input 11 is covered by the cube -1 and thus its first output is set in addition to the second one, with the terms of 10 and 11 sharing the first output
+    const std::vector<minbool::EsopTerm> esop = minbool::minimizeMultiOutputEsop(tt);
+    ASSERT_EQ(3U, esop.size());
+    ASSERT_EQ(TruthTable::Cube::fromString("-1"), esop[0].cube);
+    ASSERT_EQ(std::vector<bool>({false, true}), esop[0].outputs);
+    ASSERT_EQ(TruthTable::Cube::fromString("1-"), esop[1].cube);
+    ASSERT_EQ(std::vector<bool>({true, false}), esop[1].outputs);
+    ASSERT_EQ(TruthTable::Cube::fromString("10"), esop[2].cube);
+    ASSERT_EQ(std::vector<bool>({false, true}), esop[2].outputs);
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/circuit_to_truthtable.hpp"
+#include "algorithms/synthesis/esop_synthesis.hpp"
+#include "core/io/pla_parser.hpp"
+#include "core/truthTable/truth_table.hpp"
+#include "ir/operations/Control.hpp"
+#include "ir/operations/OpType.hpp"
+#include "ir/operations/StandardOperation.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+
+using namespace syrec;
+
+class TestEsopSynth: public testing::TestWithParam<std::string> {
+protected:
+    TruthTable  tt{};
+    TruthTable  extendedTt{};
+    TruthTable  ttqc{};
+    std::string testCircuitsDir = "./circuits/";
+    std::string fileName;
+
+    void SetUp() override {
+        fileName = testCircuitsDir + GetParam() + ".pla";
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(TestEsopSynth, TestEsopSynth,
+                         testing::Values(
+                                 "huff_1",
+                                 "dcX2bit",
+                                 "dc3bit",
+                                 "dc3bitNew",
+                                 "dcX4bit",
+                                 "sym6_32",
+                                 "huff_2",
+                                 "rd32_19",
+                                 "c17",
+                                 "con1",
+                                 "sqr",
+                                 "aludc",
+                                 "minialu",
+                                 "majority",
+                                 "4gt10",
+                                 "4mod5",
+                                 "rd53",
+                                 "wim",
+                                 "z4ml",
+                                 "dist",
+                                 "root",
+                                 "hwb4_12",
+                                 "urf2"),
+                         [](const testing::TestParamInfo<TestEsopSynth::ParamType>& info) {
+                             auto s = info.param;
+                             std::ranges::replace(s, '-', '_');
+                             return s; });
+
+TEST_P(TestEsopSynth, GenericEsopSynthesisOfUnextendedPla) {
+    std::ifstream plaFile(fileName);
+    ASSERT_TRUE(plaFile.good());
+    parsePla(tt, plaFile);
+    const auto nCubes = tt.size();
+
+    EsopSynthesizer synthesizer;
+    const auto&     qc = synthesizer.synthesizeTT(tt);
+    ASSERT_EQ(tt.nInputs() + tt.nOutputs(), qc->getNqubits());
+    EXPECT_EQ(qc->getNops(), synthesizer.numGate());
+    // the truth table is not extended by the synthesis
+    EXPECT_EQ(nCubes, tt.size());
+
+    ASSERT_TRUE(readPla(extendedTt, fileName));
+    ASSERT_TRUE(buildTruthTable(*qc, ttqc));
+
+    EXPECT_TRUE(TruthTable::equal(ttqc, extendedTt));
+    EXPECT_TRUE(TruthTable::equal(extendedTt, ttqc));
+}
+
+TEST(TestEsopSynthSparsePla, RuntimeDoesNotDependOnNumberOfMinterms) {
+    // two cubes of a PLA with 40 inputs, whose extension would consist of 2^40 entries
+    std::istringstream pla(".i 40\n.o 2\n1" + std::string(39U, '-') + " 11\n0" + std::string(39U, '-') + " 10\n.e\n");
+    TruthTable         tt{};
+    parsePla(tt, pla);
+
+    EsopSynthesizer synthesizer;
+    const auto&     qc = synthesizer.synthesizeTT(tt);
+    ASSERT_EQ(42U, qc->getNqubits());
+
+    // the first output is shared by both cubes, which are merged into the cube without any control line
+    ASSERT_EQ(2U, synthesizer.numProductTerm());
+    ASSERT_EQ(2U, qc->getNops());
+    EXPECT_TRUE(qc->at(0)->equals(qc::StandardOperation(qc::Controls{}, 1U, qc::OpType::X)));
+    EXPECT_TRUE(qc->at(1)->equals(qc::StandardOperation(qc::Controls{41U}, 0U, qc::OpType::X)));
+}
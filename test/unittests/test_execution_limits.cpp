@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/execution_limits.hpp"
+#include "core/statistics.hpp"
+#include "core/syrec/program.hpp"
+
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace syrec;
+
+namespace {
+    constexpr auto STRINGIFIED_PROGRAM = "module main(inout a(4), in b(4)) for $i = 0 to 16 do a += (b + $i) rof";
+
+    void assertSynthesisFailsDueToViolation(const ExecutionLimits& executionLimits, const ExecutionLimitViolation expectedViolation) {
+        Program program;
+        ASSERT_EQ("", program.readFromString(STRINGIFIED_PROGRAM));
+
+        ConfigurableOptions settings;
+        settings.executionLimits = executionLimits;
+        AnnotatableQuantumComputation annotatableQuantumComputation(false);
+        Statistics                    statistics;
+        ASSERT_FALSE(CostAwareSynthesis::synthesize(annotatableQuantumComputation, program, settings, &statistics));
+        ASSERT_EQ(expectedViolation, statistics.executionLimitViolation);
+        // The statistics of the partially synthesized quantum computation are still recorded
+        ASSERT_EQ(annotatableQuantumComputation.getNqubits(), statistics.numQubits);
+    }
+} // namespace
+
+TEST(ExecutionLimitsTests, MonitorWithoutLimitsIsNeverViolated) {
+    ExecutionLimitsMonitor monitor(ExecutionLimits{});
+    ASSERT_FALSE(monitor.isAnyLimitViolated());
+    ASSERT_EQ(ExecutionLimitViolation::None, monitor.getViolation());
+}
+
+TEST(ExecutionLimitsTests, CancellationIsSharedByCopiesOfToken) {
+    const CancellationToken cancellationToken;
+    ExecutionLimitsMonitor  monitor(ExecutionLimits{.optionalCancellationToken = cancellationToken});
+    ASSERT_FALSE(monitor.isAnyLimitViolated());
+
+    const CancellationToken copyOfCancellationToken = cancellationToken;
+    copyOfCancellationToken.requestCancellation();
+    ASSERT_TRUE(cancellationToken.isCancellationRequested());
+    ASSERT_TRUE(monitor.isAnyLimitViolated());
+    ASSERT_EQ(ExecutionLimitViolation::Cancelled, monitor.getViolation());
+}
+
+TEST(ExecutionLimitsTests, FirstDetectedViolationIsKept) {
+    const CancellationToken cancellationToken;
+    ExecutionLimitsMonitor  monitor(ExecutionLimits{.optionalCancellationToken = cancellationToken, .timeLimitInMilliseconds = 0U});
+    ASSERT_TRUE(monitor.isAnyLimitViolated());
+    ASSERT_EQ(ExecutionLimitViolation::TimeLimitExceeded, monitor.getViolation());
+
+    cancellationToken.requestCancellation();
+    monitor.adoptViolationOfNestedComputation(ExecutionLimitViolation::MemoryBudgetExceeded);
+    ASSERT_TRUE(monitor.isAnyLimitViolated());
+    ASSERT_EQ(ExecutionLimitViolation::TimeLimitExceeded, monitor.getViolation());
+}
+
+TEST(ExecutionLimitsTests, StringifiedViolations) {
+    ASSERT_EQ("none", stringifyExecutionLimitViolation(ExecutionLimitViolation::None));
+    ASSERT_EQ("cancelled", stringifyExecutionLimitViolation(ExecutionLimitViolation::Cancelled));
+    ASSERT_EQ("time_limit_exceeded", stringifyExecutionLimitViolation(ExecutionLimitViolation::TimeLimitExceeded));
+    ASSERT_EQ("memory_budget_exceeded", stringifyExecutionLimitViolation(ExecutionLimitViolation::MemoryBudgetExceeded));
+}
+
+TEST(ExecutionLimitsTests, CancelledSynthesisFails) {
+    const CancellationToken cancellationToken;
+    cancellationToken.requestCancellation();
+    assertSynthesisFailsDueToViolation(ExecutionLimits{.optionalCancellationToken = cancellationToken}, ExecutionLimitViolation::Cancelled);
+}
+
+TEST(ExecutionLimitsTests, SynthesisExceedingTimeLimitFails) {
+    assertSynthesisFailsDueToViolation(ExecutionLimits{.timeLimitInMilliseconds = 0U}, ExecutionLimitViolation::TimeLimitExceeded);
+}
+
+TEST(ExecutionLimitsTests, SynthesisExceedingMemoryBudgetFails) {
+    if (!determineResidentSetSizeInBytes().has_value()) {
+        GTEST_SKIP() << "The resident set size cannot be determined on the current platform";
+    }
+    assertSynthesisFailsDueToViolation(ExecutionLimits{.memoryBudgetInMiB = 0.}, ExecutionLimitViolation::MemoryBudgetExceeded);
+}
+
+TEST(ExecutionLimitsTests, SynthesisWithinLimitsIsUnaffected) {
+    Program program;
+    ASSERT_EQ("", program.readFromString(STRINGIFIED_PROGRAM));
+
+    ConfigurableOptions settings;
+    settings.executionLimits = ExecutionLimits{.optionalCancellationToken = CancellationToken(), .timeLimitInMilliseconds = 60U * 60U * 1000U};
+    AnnotatableQuantumComputation annotatableQuantumComputation(false);
+    Statistics                    statistics;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(annotatableQuantumComputation, program, settings, &statistics));
+    ASSERT_EQ(ExecutionLimitViolation::None, statistics.executionLimitViolation);
+}
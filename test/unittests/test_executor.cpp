@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/executor.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    constexpr std::size_t NUM_WORKER_THREADS = 3U;
+} // namespace
+
+TEST(ExecutorTests, EveryIndexIsProcessedExactlyOnce) {
+    Executor                      executor(NUM_WORKER_THREADS);
+    constexpr std::size_t         count = 10000U;
+    std::vector<std::atomic<int>> numExecutionsPerIndex(count);
+    for (const bool deterministic: {false, true}) {
+        for (const std::size_t maxNumThreads: {0U, 1U, 2U, 16U}) {
+            for (auto& numExecutions: numExecutionsPerIndex) {
+                numExecutions = 0;
+            }
+            executor.parallelFor(count, [&](const std::size_t index) { ++numExecutionsPerIndex[index]; }, maxNumThreads, deterministic);
+            for (std::size_t i = 0; i < count; ++i) {
+                ASSERT_EQ(1, numExecutionsPerIndex[i].load()) << "Index " << std::to_string(i) << " with at most " << std::to_string(maxNumThreads) << " threads";
+            }
+        }
+    }
+}
+
+TEST(ExecutorTests, ExecutorWithoutWorkerThreadsExecutesOnCallingThread) {
+    Executor                     executor(0U);
+    const std::thread::id        callingThread = std::this_thread::get_id();
+    std::vector<std::thread::id> executingThreadPerIndex(100U);
+    executor.parallelFor(executingThreadPerIndex.size(), [&](const std::size_t index) { executingThreadPerIndex[index] = std::this_thread::get_id(); });
+    for (const std::thread::id& executingThread: executingThreadPerIndex) {
+        ASSERT_EQ(callingThread, executingThread);
+    }
+}
+
+TEST(ExecutorTests, NestedParallelLoopsDoNotDeadlock) {
+    Executor                 executor(NUM_WORKER_THREADS);
+    std::atomic<std::size_t> numExecutions = 0;
+    executor.parallelFor(16U, [&](std::size_t) {
+        executor.parallelFor(16U, [&](std::size_t) {
+            executor.parallelFor(4U, [&](std::size_t) { ++numExecutions; });
+        });
+    });
+    ASSERT_EQ(16U * 16U * 4U, numExecutions.load());
+}
+
+TEST(ExecutorTests, ExceptionOfSmallestIndexIsRethrownAfterAllIndicesWereProcessed) {
+    Executor                 executor(NUM_WORKER_THREADS);
+    std::atomic<std::size_t> numExecutions = 0;
+    try {
+        executor.parallelFor(1000U, [&](const std::size_t index) {
+            ++numExecutions;
+            if (index % 100U == 42U) {
+                throw std::runtime_error(std::to_string(index));
+            }
+        });
+        FAIL() << "Exception was not rethrown";
+    } catch (const std::runtime_error& exception) {
+        ASSERT_EQ("42", std::string(exception.what()));
+    }
+    ASSERT_EQ(1000U, numExecutions.load());
+}
+
+TEST(ExecutorTests, DeterministicModeProcessesFixedGroupsInAscendingOrder) {
+    Executor              executor(NUM_WORKER_THREADS);
+    constexpr std::size_t count     = 1000U;
+    constexpr std::size_t numGroups = 4U;
+
+    // Every group is processed sequentially by a single thread, thus the indices of a group are observed in ascending order by the same thread.
+    std::vector<std::vector<std::size_t>> processedIndicesPerGroup(numGroups);
+    std::vector<std::thread::id>          executingThreadPerIndex(count);
+
+    const auto recordProcessedIndex = [&](const std::size_t index) {
+        processedIndicesPerGroup[index % numGroups].emplace_back(index);
+        executingThreadPerIndex[index] = std::this_thread::get_id();
+    };
+    executor.parallelFor(count, recordProcessedIndex, numGroups, true);
+
+    for (std::size_t group = 0; group < numGroups; ++group) {
+        const std::vector<std::size_t>& processedIndices = processedIndicesPerGroup[group];
+        ASSERT_EQ(count / numGroups, processedIndices.size());
+        for (std::size_t i = 0; i < processedIndices.size(); ++i) {
+            ASSERT_EQ(group + i * numGroups, processedIndices[i]);
+            ASSERT_EQ(executingThreadPerIndex[group], executingThreadPerIndex[processedIndices[i]]);
+        }
+    }
+}
+
+TEST(ExecutorTests, SharedExecutorDoesNotExceedHardwareConcurrency) {
+    ASSERT_EQ(Executor::determineNumThreads(0U) - 1U, Executor::getShared().getNumWorkerThreads());
+    ASSERT_EQ(5U, Executor::determineNumThreads(5U));
+
+    // Concurrent callers of the shared executor are only assisted by its fixed set of worker threads.
+    std::atomic<std::size_t> numExecutions = 0;
+    std::vector<std::thread> callers;
+    for (std::size_t i = 0; i < 4U; ++i) {
+        callers.emplace_back([&] { Executor::getShared().parallelFor(1000U, [&](std::size_t) { ++numExecutions; }); });
+    }
+    for (auto& caller: callers) {
+        caller.join();
+    }
+    ASSERT_EQ(4000U, numExecutions.load());
+    Executor::getShared().pinWorkerThreadsToCores();
+}
@@ -100,3 +100,35 @@ TEST_F(TruthTableExtend, EXTENDTT) {
         EXPECT_TRUE(search->second.equals(0b000U, 3U));
     }
 }
+
+TEST_F(TruthTableExtend, ExtendedTruthTableIsStoredDensely) {
+    const std::string circEXTENDTT = testCircuitsDir + "extend.pla";
+
+    EXPECT_TRUE(readPla(tt, circEXTENDTT));
+    EXPECT_TRUE(tt.hasDenseStorage());
+    EXPECT_EQ(tt.size(), 8U);
+    EXPECT_EQ(tt.nInputs(), 3U);
+
+    // the entries are visited in the order of the integer values of their inputs
+    std::uint64_t expectedInput = 0U;
+    for (const auto& [input, output]: tt) {
+        EXPECT_TRUE(input.equals(expectedInput, 3U));
+        ++expectedInput;
+    }
+
+    // inputs with don't cares are never stored in a complete truth table
+    EXPECT_TRUE(tt.find(TruthTable::Cube::fromString("0-1")) == tt.end());
+
+    // switching back to the map based storage does not change the truth table
+    TruthTable sparseTruthTable(tt);
+    sparseTruthTable.useSparseStorage();
+    EXPECT_FALSE(sparseTruthTable.hasDenseStorage());
+    EXPECT_TRUE(sparseTruthTable == tt);
+
+    sparseTruthTable[TruthTable::Cube::fromInteger(0b000U, 3U)] = TruthTable::Cube::fromInteger(0b111U, 3U);
+    EXPECT_FALSE(sparseTruthTable == tt);
+    tt[TruthTable::Cube::fromInteger(0b000U, 3U)] = TruthTable::Cube::fromInteger(0b111U, 3U);
+    EXPECT_TRUE(tt.hasDenseStorage());
+    EXPECT_TRUE(sparseTruthTable == tt);
+    EXPECT_TRUE(sparseTruthTable.useDenseStorageIfComplete());
+}
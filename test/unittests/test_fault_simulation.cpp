@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/fault_simulation.hpp"
+#include "core/n_bit_values_container.hpp"
+#include "core/statistics.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    [[nodiscard]] std::vector<NBitValuesContainer> generateAllInputPatterns(const std::size_t numQubits) {
+        std::vector<NBitValuesContainer> inputPatterns;
+        for (std::uint64_t inputValue = 0; inputValue < (static_cast<std::uint64_t>(1) << numQubits); ++inputValue) {
+            inputPatterns.emplace_back(numQubits, inputValue);
+        }
+        return inputPatterns;
+    }
+
+    void assertSimulationModesReportSameDetectingPatterns(const qc::QuantumComputation& quantumComputation, const std::vector<ReversibleCircuitFault>& faults, const std::vector<NBitValuesContainer>& inputPatterns, FaultSimulationResult& result) {
+        FaultSimulationResult parallelFaultResult;
+        ASSERT_TRUE(faultSimulation(parallelFaultResult, quantumComputation, faults, inputPatterns, FaultSimulationSettings{.mode = FaultSimulationSettings::Mode::ParallelFault, .numThreads = 2U}));
+        ASSERT_TRUE(faultSimulation(result, quantumComputation, faults, inputPatterns, FaultSimulationSettings{.mode = FaultSimulationSettings::Mode::ParallelPattern, .numThreads = 2U}));
+        ASSERT_EQ(parallelFaultResult.detectingPatternsPerFault, result.detectingPatternsPerFault);
+    }
+} // namespace
+
+TEST(FaultSimulationTests, MissingAndRepeatedGateFaultsOfCnotGate) {
+    qc::QuantumComputation quantumComputation(2);
+    quantumComputation.cx(0, 1);
+
+    const std::vector<ReversibleCircuitFault> faults = {
+            ReversibleCircuitFault{.kind = ReversibleCircuitFault::Kind::MissingGate, .gateIndex = 0},
+            ReversibleCircuitFault{.kind = ReversibleCircuitFault::Kind::RepeatedGate, .gateIndex = 0, .numRepetitions = 2U},
+            ReversibleCircuitFault{.kind = ReversibleCircuitFault::Kind::RepeatedGate, .gateIndex = 0, .numRepetitions = 3U}};
+
+    FaultSimulationResult result;
+    ASSERT_NO_FATAL_FAILURE(assertSimulationModesReportSameDetectingPatterns(quantumComputation, faults, generateAllInputPatterns(2), result));
+    // The missing gate is only observable if the control qubit is set, while an odd number of repetitions of the self-inverse gate is not detectable
+    ASSERT_EQ(std::vector<std::size_t>({1U, 3U}), result.detectingPatternsPerFault[0]);
+    ASSERT_EQ(std::vector<std::size_t>({1U, 3U}), result.detectingPatternsPerFault[1]);
+    ASSERT_FALSE(result.isFaultDetected(2));
+    ASSERT_EQ(2U, result.getNumDetectedFaults());
+}
+
+TEST(FaultSimulationTests, StuckAtFaultsAreDetectedIfValueOfQubitDiffers) {
+    // The Toffoli gate only propagates a stuck-at fault of its control qubit 1 to its target qubit if the other control qubit is set
+    qc::QuantumComputation quantumComputation(3);
+    quantumComputation.mcx(qc::Controls({0, 1}), 2);
+    quantumComputation.swap(1, 2);
+
+    const std::vector<ReversibleCircuitFault> faults = {
+            ReversibleCircuitFault{.kind = ReversibleCircuitFault::Kind::StuckAtZero, .gateIndex = 0, .qubit = 1},
+            ReversibleCircuitFault{.kind = ReversibleCircuitFault::Kind::StuckAtOne, .gateIndex = 2, .qubit = 0}};
+
+    FaultSimulationResult result;
+    ASSERT_NO_FATAL_FAILURE(assertSimulationModesReportSameDetectingPatterns(quantumComputation, faults, generateAllInputPatterns(3), result));
+    // Qubit 1 stuck at zero at the inputs of the Toffoli gate is observable at the output of qubit 2 (and at the output of qubit 1 via the target of the Toffoli gate if qubit 0 is set)
+    ASSERT_EQ(std::vector<std::size_t>({2U, 3U, 6U, 7U}), result.detectingPatternsPerFault[0]);
+    // Qubit 0 stuck at one at the outputs of the circuit is detected by every pattern in which qubit 0 is not set
+    ASSERT_EQ(std::vector<std::size_t>({0U, 2U, 4U, 6U}), result.detectingPatternsPerFault[1]);
+}
+
+TEST(FaultSimulationTests, SimulationModesAgreeForManyFaultsAndPatterns) {
+    constexpr std::size_t  numQubits = 7U;
+    qc::QuantumComputation quantumComputation(numQubits);
+    for (std::size_t i = 0; i + 2U < numQubits; ++i) {
+        quantumComputation.mcx(qc::Controls({static_cast<qc::Qubit>(i), qc::Control(static_cast<qc::Qubit>(i + 1U), qc::Control::Type::Neg)}), static_cast<qc::Qubit>(i + 2U));
+        quantumComputation.cx(static_cast<qc::Qubit>(i + 2U), static_cast<qc::Qubit>(i));
+    }
+    quantumComputation.mcswap(qc::Controls({0}), 1, numQubits - 1U);
+
+    const std::vector<ReversibleCircuitFault> faults = determineSingleFaults(quantumComputation);
+    ASSERT_EQ(2U * quantumComputation.getNops() + 2U * numQubits * (quantumComputation.getNops() + 1U), faults.size());
+
+    FaultSimulationResult result;
+    Statistics            statistics;
+    ASSERT_NO_FATAL_FAILURE(assertSimulationModesReportSameDetectingPatterns(quantumComputation, faults, generateAllInputPatterns(numQubits), result));
+    // Every stuck-at fault at the outputs of the circuit is detected by half of the patterns since the circuit is a permutation of its input states
+    ASSERT_EQ(64U, result.detectingPatternsPerFault[faults.size() - 1U].size());
+
+    FaultSimulationResult singleThreadedResult;
+    ASSERT_TRUE(faultSimulation(singleThreadedResult, quantumComputation, faults, generateAllInputPatterns(numQubits), FaultSimulationSettings{.numThreads = 1U}, &statistics));
+    ASSERT_EQ(result.detectingPatternsPerFault, singleThreadedResult.detectingPatternsPerFault);
+}
+
+TEST(FaultSimulationTests, FaultsOrPatternsNotMatchingCircuitAreRejected) {
+    qc::QuantumComputation quantumComputation(2);
+    quantumComputation.cx(0, 1);
+
+    FaultSimulationResult result;
+    ASSERT_FALSE(faultSimulation(result, quantumComputation, {ReversibleCircuitFault{.kind = ReversibleCircuitFault::Kind::MissingGate, .gateIndex = 1}}, generateAllInputPatterns(2)));
+    ASSERT_FALSE(faultSimulation(result, quantumComputation, {ReversibleCircuitFault{.kind = ReversibleCircuitFault::Kind::StuckAtOne, .gateIndex = 1, .qubit = 2}}, generateAllInputPatterns(2)));
+    ASSERT_FALSE(faultSimulation(result, quantumComputation, {ReversibleCircuitFault{.kind = ReversibleCircuitFault::Kind::MissingGate, .gateIndex = 0}}, generateAllInputPatterns(3)));
+    ASSERT_TRUE(result.detectingPatternsPerFault.empty());
+
+    quantumComputation.h(0);
+    ASSERT_TRUE(determineSingleFaults(quantumComputation).empty());
+}
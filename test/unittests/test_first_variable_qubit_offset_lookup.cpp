@@ -9,11 +9,14 @@
  */
 
 #include "algorithms/synthesis/first_variable_qubit_offset_lookup.hpp"
+#include "core/syrec/variable.hpp"
 #include "ir/Definitions.hpp"
 
 #include <gtest/gtest.h>
+#include <memory>
 #include <optional>
 #include <string_view>
+#include <vector>
 
 using namespace syrec;
 
@@ -218,3 +221,127 @@ TEST(FirstVariableQubitOffsetLookupTests, GetQubitOffsetForVariablesWithMatching
     ASSERT_NO_FATAL_FAILURE(assertFetchedQubitOffsetMatchesExpectedValue(qubitOffsetLookup, firstVariableIdentifier, expectedOffsetForFirstVariableInFirstScope));
     ASSERT_NO_FATAL_FAILURE(assertFetchedQubitOffsetMatchesExpectedValue(qubitOffsetLookup, secondVariableIdentifier, std::nullopt));
 }
+
+TEST(FirstVariableQubitOffsetLookupTests, GetQubitOffsetForVariableUsingDeclarationIndex) {
+    FirstVariableQubitOffsetLookup qubitOffsetLookup;
+
+    Variable firstVariable(Variable::Type::Inout, "a", {1U}, 2U);
+    firstVariable.declarationIndexInModule = 0U;
+    Variable secondVariable(Variable::Type::Wire, "b", {1U}, 2U);
+    secondVariable.declarationIndexInModule = 1U;
+    // Variable declared in another module reusing the declaration index of the second variable
+    Variable variableOfOtherModule(Variable::Type::Inout, "c", {1U}, 2U);
+    variableOfOtherModule.declarationIndexInModule = 1U;
+
+    ASSERT_NO_FATAL_FAILURE(qubitOffsetLookup.openNewVariableQubitOffsetScope());
+    ASSERT_TRUE(qubitOffsetLookup.registerOrUpdateOffsetToFirstQubitOfVariableInCurrentScope(firstVariable, 2U));
+    ASSERT_TRUE(qubitOffsetLookup.registerOrUpdateOffsetToFirstQubitOfVariableInCurrentScope(secondVariable, 4U));
+
+    ASSERT_EQ(std::make_optional(2U), qubitOffsetLookup.getOffsetToFirstQubitOfVariableInCurrentScope(firstVariable));
+    ASSERT_EQ(std::make_optional(4U), qubitOffsetLookup.getOffsetToFirstQubitOfVariableInCurrentScope(secondVariable));
+    ASSERT_FALSE(qubitOffsetLookup.getOffsetToFirstQubitOfVariableInCurrentScope(variableOfOtherModule).has_value());
+    ASSERT_NO_FATAL_FAILURE(assertFetchedQubitOffsetMatchesExpectedValue(qubitOffsetLookup, "a", 2U));
+    ASSERT_NO_FATAL_FAILURE(assertFetchedQubitOffsetMatchesExpectedValue(qubitOffsetLookup, "b", 4U));
+
+    ASSERT_NO_FATAL_FAILURE(qubitOffsetLookup.openNewVariableQubitOffsetScope());
+    ASSERT_FALSE(qubitOffsetLookup.getOffsetToFirstQubitOfVariableInCurrentScope(firstVariable).has_value());
+    ASSERT_TRUE(qubitOffsetLookup.closeVariableQubitOffsetScope());
+    ASSERT_EQ(std::make_optional(2U), qubitOffsetLookup.getOffsetToFirstQubitOfVariableInCurrentScope(firstVariable));
+}
+
+TEST(FirstVariableQubitOffsetLookupTests, GetQubitOffsetForVariableWithoutDeclarationIndexUsesVariableIdentifier) {
+    FirstVariableQubitOffsetLookup qubitOffsetLookup;
+
+    const Variable variable(Variable::Type::Inout, "a", {1U}, 2U);
+    ASSERT_NO_FATAL_FAILURE(qubitOffsetLookup.openNewVariableQubitOffsetScope());
+    ASSERT_TRUE(qubitOffsetLookup.registerOrUpdateOffsetToFirstQubitOfVariableInCurrentScope(variable, 3U));
+    ASSERT_EQ(std::make_optional(3U), qubitOffsetLookup.getOffsetToFirstQubitOfVariableInCurrentScope(variable));
+    ASSERT_NO_FATAL_FAILURE(assertFetchedQubitOffsetMatchesExpectedValue(qubitOffsetLookup, "a", 3U));
+}
+
+TEST(FirstVariableQubitOffsetLookupTests, UpdatingQubitOffsetUsingVariableIdentifierInvalidatesRegistrationUsingDeclarationIndex) {
+    FirstVariableQubitOffsetLookup qubitOffsetLookup;
+
+    Variable variable(Variable::Type::Inout, "a", {1U}, 2U);
+    variable.declarationIndexInModule = 0U;
+    ASSERT_NO_FATAL_FAILURE(qubitOffsetLookup.openNewVariableQubitOffsetScope());
+    ASSERT_TRUE(qubitOffsetLookup.registerOrUpdateOffsetToFirstQubitOfVariableInCurrentScope(variable, 3U));
+    ASSERT_TRUE(qubitOffsetLookup.registerOrUpdateOffsetToFirstQubitOfVariableInCurrentScope("a", 5U));
+    ASSERT_EQ(std::make_optional(5U), qubitOffsetLookup.getOffsetToFirstQubitOfVariableInCurrentScope(variable));
+}
+
+TEST(FirstVariableQubitOffsetLookupTests, CacheQubitsOfVariableAccess) {
+    FirstVariableQubitOffsetLookup qubitOffsetLookup;
+
+    const auto variable       = std::make_shared<Variable>(Variable::Type::Inout, "a", std::vector<unsigned>({1U}), 2U);
+    const auto variableAccess = std::make_shared<VariableAccess>();
+    variableAccess->setVar(variable);
+
+    const std::vector<qc::Qubit> accessedQubits = {3U, 4U};
+    ASSERT_FALSE(qubitOffsetLookup.cacheQubitsOfVariableAccessInCurrentScope(variableAccess, accessedQubits));
+
+    ASSERT_NO_FATAL_FAILURE(qubitOffsetLookup.openNewVariableQubitOffsetScope());
+    ASSERT_FALSE(qubitOffsetLookup.getCachedQubitsOfVariableAccessInCurrentScope(*variableAccess).has_value());
+    ASSERT_TRUE(qubitOffsetLookup.cacheQubitsOfVariableAccessInCurrentScope(variableAccess, accessedQubits));
+
+    const auto cachedQubits = qubitOffsetLookup.getCachedQubitsOfVariableAccessInCurrentScope(*variableAccess);
+    ASSERT_TRUE(cachedQubits.has_value());
+    ASSERT_EQ(accessedQubits, std::vector<qc::Qubit>(cachedQubits->begin(), cachedQubits->end()));
+
+    // Cached qubits are not shared between scopes
+    ASSERT_NO_FATAL_FAILURE(qubitOffsetLookup.openNewVariableQubitOffsetScope());
+    ASSERT_FALSE(qubitOffsetLookup.getCachedQubitsOfVariableAccessInCurrentScope(*variableAccess).has_value());
+    ASSERT_TRUE(qubitOffsetLookup.closeVariableQubitOffsetScope());
+    ASSERT_TRUE(qubitOffsetLookup.getCachedQubitsOfVariableAccessInCurrentScope(*variableAccess).has_value());
+}
+
+TEST(FirstVariableQubitOffsetLookupTests, UpdatingQubitOffsetOfVariableInvalidatesCachedQubitsOfVariableAccesses) {
+    FirstVariableQubitOffsetLookup qubitOffsetLookup;
+
+    const auto variable       = std::make_shared<Variable>(Variable::Type::Inout, "a", std::vector<unsigned>({1U}), 2U);
+    const auto variableAccess = std::make_shared<VariableAccess>();
+    variableAccess->setVar(variable);
+
+    ASSERT_NO_FATAL_FAILURE(qubitOffsetLookup.openNewVariableQubitOffsetScope());
+    ASSERT_TRUE(qubitOffsetLookup.registerOrUpdateOffsetToFirstQubitOfVariableInCurrentScope(*variable, 0U));
+    ASSERT_TRUE(qubitOffsetLookup.cacheQubitsOfVariableAccessInCurrentScope(variableAccess, {0U, 1U}));
+
+    // Registering the offset of another variable or the same offset again does not invalidate the cached qubits
+    ASSERT_TRUE(qubitOffsetLookup.registerOrUpdateOffsetToFirstQubitOfVariableInCurrentScope("b", 2U));
+    ASSERT_TRUE(qubitOffsetLookup.registerOrUpdateOffsetToFirstQubitOfVariableInCurrentScope(*variable, 0U));
+    ASSERT_TRUE(qubitOffsetLookup.getCachedQubitsOfVariableAccessInCurrentScope(*variableAccess).has_value());
+
+    ASSERT_TRUE(qubitOffsetLookup.registerOrUpdateOffsetToFirstQubitOfVariableInCurrentScope(*variable, 4U));
+    ASSERT_FALSE(qubitOffsetLookup.getCachedQubitsOfVariableAccessInCurrentScope(*variableAccess).has_value());
+}
+
+TEST(FirstVariableQubitOffsetLookupTests, VariableSlotsOfClosedScopeAreReusedByNextOpenedScope) {
+    FirstVariableQubitOffsetLookup qubitOffsetLookup;
+
+    Variable variableOfCaller(Variable::Type::Inout, "a", {1U}, 2U);
+    variableOfCaller.declarationIndexInModule = 0U;
+    Variable firstVariableOfCallee(Variable::Type::Inout, "a", {1U}, 2U);
+    firstVariableOfCallee.declarationIndexInModule = 0U;
+    Variable secondVariableOfCallee(Variable::Type::Wire, "x", {1U}, 2U);
+    secondVariableOfCallee.declarationIndexInModule = 1U;
+
+    ASSERT_NO_FATAL_FAILURE(qubitOffsetLookup.openNewVariableQubitOffsetScope(1U));
+    ASSERT_TRUE(qubitOffsetLookup.registerOrUpdateOffsetToFirstQubitOfVariableInCurrentScope(variableOfCaller, 1U));
+
+    for (const qc::Qubit offsetOfCalleeVariables: {4U, 8U}) {
+        ASSERT_NO_FATAL_FAILURE(qubitOffsetLookup.openNewVariableQubitOffsetScope(2U));
+        ASSERT_FALSE(qubitOffsetLookup.getOffsetToFirstQubitOfVariableInCurrentScope(firstVariableOfCallee).has_value());
+        ASSERT_FALSE(qubitOffsetLookup.getOffsetToFirstQubitOfVariableInCurrentScope(variableOfCaller).has_value());
+        ASSERT_NO_FATAL_FAILURE(assertFetchedQubitOffsetMatchesExpectedValue(qubitOffsetLookup, "a", std::nullopt));
+
+        ASSERT_TRUE(qubitOffsetLookup.registerOrUpdateOffsetToFirstQubitOfVariableInCurrentScope(firstVariableOfCallee, offsetOfCalleeVariables));
+        ASSERT_TRUE(qubitOffsetLookup.registerOrUpdateOffsetToFirstQubitOfVariableInCurrentScope(secondVariableOfCallee, offsetOfCalleeVariables + 2U));
+        ASSERT_EQ(std::make_optional(offsetOfCalleeVariables), qubitOffsetLookup.getOffsetToFirstQubitOfVariableInCurrentScope(firstVariableOfCallee));
+        ASSERT_EQ(std::make_optional(offsetOfCalleeVariables + 2U), qubitOffsetLookup.getOffsetToFirstQubitOfVariableInCurrentScope(secondVariableOfCallee));
+        ASSERT_NO_FATAL_FAILURE(assertFetchedQubitOffsetMatchesExpectedValue(qubitOffsetLookup, "x", offsetOfCalleeVariables + 2U));
+        ASSERT_TRUE(qubitOffsetLookup.closeVariableQubitOffsetScope());
+
+        ASSERT_EQ(std::make_optional(1U), qubitOffsetLookup.getOffsetToFirstQubitOfVariableInCurrentScope(variableOfCaller));
+        ASSERT_NO_FATAL_FAILURE(assertFetchedQubitOffsetMatchesExpectedValue(qubitOffsetLookup, "x", std::nullopt));
+    }
+}
@@ -12,8 +12,10 @@
 #include "core/io/pla_parser.hpp"
 #include "core/truthTable/truth_table.hpp"
 
+#include <cstddef>
 #include <cstdint>
 #include <gtest/gtest.h>
+#include <map>
 #include <string>
 #include <vector>
 
@@ -134,3 +136,17 @@ TEST_F(TestHuff, HUFF2) {
         EXPECT_TRUE(search4 != tt.end());
     }
 }
+
+TEST_F(TestHuff, HuffmanCodewordsOfFlatHuffmanTree) {
+    const std::map<TruthTable::Cube, std::size_t> outputFreq{{TruthTable::Cube::fromString("00"), 1U}, {TruthTable::Cube::fromString("01"), 1U}, {TruthTable::Cube::fromString("10"), 2U}, {TruthTable::Cube::fromString("11"), 4U}};
+
+    std::vector<PackedCodeword> codewords;
+    EXPECT_EQ(huffmanCodewords(outputFreq, codewords), 3U);
+    ASSERT_EQ(codewords.size(), 4U);
+
+    // the outputs with a smaller frequency are assigned longer codewords
+    const std::vector<std::string> expectedCodewords{"000", "001", "01", "1"};
+    for (std::size_t i = 0; i < codewords.size(); ++i) {
+        EXPECT_EQ(TruthTable::Cube::fromInteger(codewords[i].bits, codewords[i].length).toString(), expectedCodewords[i]);
+    }
+}
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/differential_verification.hpp"
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "algorithms/synthesis/syrec_hybrid_synthesis.hpp"
+#include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/statistics.hpp"
+#include "core/syrec/expression.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/number.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+#include "syrec_ir_builder.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <memory>
+#include <optional>
+#include <vector>
+
+using namespace syrec;
+using namespace syrec_ir_builder;
+
+namespace {
+    class HybridSynthesisTestsFixture: public testing::Test {
+    protected:
+        Program       program;
+        Module::ptr   mainModule = std::make_shared<Module>("main");
+        Variable::ptr a          = std::make_shared<Variable>(Variable::Type::In, "a", std::vector<unsigned>({1U}), 4U);
+        Variable::ptr b          = std::make_shared<Variable>(Variable::Type::Inout, "b", std::vector<unsigned>({1U}), 4U);
+        Variable::ptr c          = std::make_shared<Variable>(Variable::Type::Out, "c", std::vector<unsigned>({1U}), 4U);
+
+        void SetUp() override {
+            mainModule->addParameter(a);
+            mainModule->addParameter(b);
+            mainModule->addParameter(c);
+
+            // c ^= (a + b); b += (a ^ c); c -= (a - b)
+            mainModule->addStatement(std::make_shared<AssignStatement>(createVariableAccess(c), AssignStatement::AssignOperation::Exor, std::make_shared<BinaryExpression>(createVariableExpression(a), BinaryExpression::BinaryOperation::Add, createVariableExpression(b))));
+            mainModule->addStatement(std::make_shared<AssignStatement>(createVariableAccess(b), AssignStatement::AssignOperation::Add, std::make_shared<BinaryExpression>(createVariableExpression(a), BinaryExpression::BinaryOperation::Exor, createVariableExpression(c))));
+            mainModule->addStatement(std::make_shared<AssignStatement>(createVariableAccess(c), AssignStatement::AssignOperation::Subtract, std::make_shared<BinaryExpression>(createVariableExpression(a), BinaryExpression::BinaryOperation::Subtract, createVariableExpression(b))));
+            program.addModule(mainModule);
+        }
+    };
+} // namespace
+
+TEST_F(HybridSynthesisTestsFixture, CheaperSynthesisVariantIsSelectedPerAssignmentWithoutQubitBudget) {
+    AnnotatableQuantumComputation costAwareQuantumComputation;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(costAwareQuantumComputation, program));
+
+    AnnotatableQuantumComputation hybridQuantumComputation;
+    Statistics                    statistics;
+    ASSERT_TRUE(HybridSynthesis::synthesize(hybridQuantumComputation, program, ConfigurableOptions(), &statistics));
+    ASSERT_GT(costAwareQuantumComputation.getNqubits(), hybridQuantumComputation.getNqubits());
+    ASSERT_GT(costAwareQuantumComputation.getNops(), hybridQuantumComputation.getNops());
+
+    // The XOR of the second assignment is estimated to be as expensive in both variants while the subtraction of the third assignment is merged with the matching assignment operation, thus both are synthesized like in the line aware synthesis.
+    ASSERT_EQ(1U, statistics.numAssignmentsSynthesizedCostAware);
+    ASSERT_EQ(2U, statistics.numAssignmentsSynthesizedLineAware);
+    ASSERT_LT(0U, statistics.estimatedNumQuantumOperationsSavedByHybridSynthesis);
+    ASSERT_EQ(8U, statistics.estimatedNumAncillaryQubitsSavedByHybridSynthesis);
+}
+
+TEST_F(HybridSynthesisTestsFixture, AssignmentsAreSynthesizedLineAwareIfQubitBudgetIsExhausted) {
+    AnnotatableQuantumComputation lineAwareQuantumComputation;
+    ASSERT_TRUE(LineAwareSynthesis::synthesize(lineAwareQuantumComputation, program));
+
+    ConfigurableOptions settings;
+    settings.qubitBudgetOfHybridSynthesis = 12U;
+
+    AnnotatableQuantumComputation hybridQuantumComputation;
+    Statistics                    statistics;
+    ASSERT_TRUE(HybridSynthesis::synthesize(hybridQuantumComputation, program, settings, &statistics));
+    ASSERT_EQ(lineAwareQuantumComputation.getNqubits(), hybridQuantumComputation.getNqubits());
+    ASSERT_EQ(lineAwareQuantumComputation.getNops(), hybridQuantumComputation.getNops());
+
+    ASSERT_EQ(0U, statistics.numAssignmentsSynthesizedCostAware);
+    ASSERT_EQ(3U, statistics.numAssignmentsSynthesizedLineAware);
+    ASSERT_EQ(0U, statistics.estimatedNumQuantumOperationsSavedByHybridSynthesis);
+    ASSERT_LT(0U, statistics.estimatedNumAncillaryQubitsSavedByHybridSynthesis);
+}
+
+TEST_F(HybridSynthesisTestsFixture, SelectedSynthesisVariantsDoNotChangeSimulationResult) {
+    for (const std::optional<std::size_t> qubitBudget: {std::optional<std::size_t>(), std::make_optional<std::size_t>(12U)}) {
+        ConfigurableOptions settings;
+        settings.qubitBudgetOfHybridSynthesis = qubitBudget;
+
+        DifferentialVerificationResult result;
+        ASSERT_TRUE(differentialVerification(result, program, settings, DifferentialVerificationSettings{.synthesisAlgorithm = SynthesisAlgorithm::Hybrid, .numStimuli = 1000U, .seed = 5U, .numThreads = 1U}));
+        ASSERT_EQ(1000U, result.numCheckedStimuli);
+        ASSERT_FALSE(result.firstMismatch.has_value());
+    }
+}
+
+TEST_F(HybridSynthesisTestsFixture, AssignmentsSynthesizedLineAwareInBranchesDoNotRevertSubexpressionsOfGuard) {
+    // if ((a + b) = 3) then c ^= (a ^ b) fi ((a + b) = 3) with the guard being synthesized like in the cost aware synthesis while the assignment is synthesized like in the line aware synthesis
+    const auto ifStatement = std::make_shared<IfStatement>();
+    ifStatement->setCondition(std::make_shared<BinaryExpression>(std::make_shared<BinaryExpression>(createVariableExpression(a), BinaryExpression::BinaryOperation::Add, createVariableExpression(b)), BinaryExpression::BinaryOperation::Equals, std::make_shared<NumericExpression>(std::make_shared<Number>(3U), 4U)));
+    ifStatement->addThenStatement(std::make_shared<AssignStatement>(createVariableAccess(c), AssignStatement::AssignOperation::Exor, std::make_shared<BinaryExpression>(createVariableExpression(a), BinaryExpression::BinaryOperation::Exor, createVariableExpression(b))));
+    ifStatement->setFiCondition(ifStatement->condition);
+
+    Program    programWithIfStatement;
+    const auto moduleWithIfStatement = std::make_shared<Module>("main");
+    moduleWithIfStatement->addParameter(a);
+    moduleWithIfStatement->addParameter(b);
+    moduleWithIfStatement->addParameter(c);
+    moduleWithIfStatement->addStatement(ifStatement);
+    programWithIfStatement.addModule(moduleWithIfStatement);
+
+    DifferentialVerificationResult result;
+    ASSERT_TRUE(differentialVerification(result, programWithIfStatement, ConfigurableOptions(), DifferentialVerificationSettings{.synthesisAlgorithm = SynthesisAlgorithm::Hybrid, .numStimuli = 1000U, .seed = 5U, .numThreads = 1U}));
+    ASSERT_EQ(1000U, result.numCheckedStimuli);
+    ASSERT_FALSE(result.firstMismatch.has_value());
+}
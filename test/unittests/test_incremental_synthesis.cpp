@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/equivalence_checking.hpp"
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "algorithms/synthesis/incremental_synthesis.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/statistics.hpp"
+#include "core/syrec/program.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+
+using namespace syrec;
+
+namespace {
+    constexpr auto STRINGIFIED_PROGRAM        = "module main(inout a(4), in b(4)) wire c(4) a += b; c ^= (a + b); a ^= c; ++= b";
+    constexpr auto STRINGIFIED_EDITED_PROGRAM = "module main(inout a(4), in b(4)) wire c(4) a += b; c ^= (a - b); a ^= c; ++= b";
+
+    void assertIsEquivalentToSynthesisFromScratch(const Program& program, const AnnotatableQuantumComputation* incrementallySynthesizedQuantumComputation) {
+        ASSERT_NE(nullptr, incrementallySynthesizedQuantumComputation);
+        AnnotatableQuantumComputation quantumComputationSynthesizedFromScratch;
+        ASSERT_TRUE(CostAwareSynthesis::synthesize(quantumComputationSynthesizedFromScratch, program));
+        ASSERT_EQ(EquivalenceCheckingResult::Outcome::Equivalent, checkEquivalence(quantumComputationSynthesizedFromScratch, *incrementallySynthesizedQuantumComputation).outcome);
+    }
+
+    void assertFootprintsCoverQuantumComputation(const IncrementalSynthesis& incrementalSynthesis, const AnnotatableQuantumComputation& quantumComputation) {
+        std::size_t indexOfNextQuantumOperation = 0;
+        for (const SynthesizedStatementFootprint& footprint: incrementalSynthesis.getFootprintsOfStatements()) {
+            ASSERT_EQ(indexOfNextQuantumOperation, footprint.quantumOperations.indexOfFirstQuantumOperation);
+            indexOfNextQuantumOperation += footprint.quantumOperations.numQuantumOperations;
+            if (footprint.ancillaryQubits.has_value()) {
+                for (auto qubit = footprint.ancillaryQubits->firstQubitIndex; qubit <= footprint.ancillaryQubits->lastQubitIndex; ++qubit) {
+                    ASSERT_TRUE(quantumComputation.logicalQubitIsAncillary(qubit));
+                }
+            }
+        }
+        ASSERT_EQ(quantumComputation.getNumQuantumOperations(), indexOfNextQuantumOperation);
+    }
+} // namespace
+
+TEST(IncrementalSynthesisTests, OnlyChangedStatementsAreResynthesized) {
+    Program program;
+    ASSERT_EQ("", program.readFromString(STRINGIFIED_PROGRAM));
+
+    IncrementalSynthesis incrementalSynthesis;
+    const auto           synthesizedQuantumComputation = incrementalSynthesis.synthesize(program);
+    ASSERT_NO_FATAL_FAILURE(assertIsEquivalentToSynthesisFromScratch(program, synthesizedQuantumComputation.get()));
+    ASSERT_NO_FATAL_FAILURE(assertFootprintsCoverQuantumComputation(incrementalSynthesis, *synthesizedQuantumComputation));
+    ASSERT_EQ(4U, incrementalSynthesis.getNumResynthesizedStatements());
+    ASSERT_EQ(0U, incrementalSynthesis.getNumReusedStatements());
+
+    Program editedProgram;
+    ASSERT_EQ("", editedProgram.readFromString(STRINGIFIED_EDITED_PROGRAM));
+    Statistics statistics;
+    const auto resynthesizedQuantumComputation = incrementalSynthesis.synthesize(editedProgram, ConfigurableOptions(), &statistics);
+    ASSERT_NO_FATAL_FAILURE(assertIsEquivalentToSynthesisFromScratch(editedProgram, resynthesizedQuantumComputation.get()));
+    ASSERT_NO_FATAL_FAILURE(assertFootprintsCoverQuantumComputation(incrementalSynthesis, *resynthesizedQuantumComputation));
+    ASSERT_EQ(1U, incrementalSynthesis.getNumResynthesizedStatements());
+    ASSERT_EQ(3U, incrementalSynthesis.getNumReusedStatements());
+    ASSERT_FALSE(incrementalSynthesis.getFootprintsOfStatements()[0].wasResynthesized);
+    ASSERT_TRUE(incrementalSynthesis.getFootprintsOfStatements()[1].wasResynthesized);
+    ASSERT_EQ(resynthesizedQuantumComputation->getNqubits(), statistics.numQubits);
+    ASSERT_EQ(resynthesizedQuantumComputation->getNumQuantumOperations(), statistics.numQuantumOperations);
+}
+
+TEST(IncrementalSynthesisTests, StatementsWhoseLineNumbersChangedAreReused) {
+    Program program;
+    ASSERT_EQ("", program.readFromString(STRINGIFIED_PROGRAM));
+    IncrementalSynthesis incrementalSynthesis;
+    ASSERT_NE(nullptr, incrementalSynthesis.synthesize(program));
+
+    Program programWithInsertedLines;
+    ASSERT_EQ("", programWithInsertedLines.readFromString("\n\n" + std::string(STRINGIFIED_PROGRAM)));
+    ASSERT_NE(nullptr, incrementalSynthesis.synthesize(programWithInsertedLines));
+    ASSERT_EQ(0U, incrementalSynthesis.getNumResynthesizedStatements());
+    ASSERT_EQ(4U, incrementalSynthesis.getNumReusedStatements());
+}
+
+TEST(IncrementalSynthesisTests, ChangedQubitLayoutDiscardsSynthesizedStatements) {
+    Program program;
+    ASSERT_EQ("", program.readFromString(STRINGIFIED_PROGRAM));
+    IncrementalSynthesis incrementalSynthesis;
+    ASSERT_NE(nullptr, incrementalSynthesis.synthesize(program));
+
+    Program programWithChangedVariables;
+    ASSERT_EQ("", programWithChangedVariables.readFromString("module main(inout a(4), in b(4)) wire c(4), d(2) a += b; c ^= (a + b); a ^= c; ++= b"));
+    const auto synthesizedQuantumComputation = incrementalSynthesis.synthesize(programWithChangedVariables);
+    ASSERT_NO_FATAL_FAILURE(assertIsEquivalentToSynthesisFromScratch(programWithChangedVariables, synthesizedQuantumComputation.get()));
+    ASSERT_EQ(4U, incrementalSynthesis.getNumResynthesizedStatements());
+    ASSERT_EQ(0U, incrementalSynthesis.getNumReusedStatements());
+}
+
+TEST(IncrementalSynthesisTests, ProgramIsSynthesizedFromScratchIfOptimizationsOrAnnotationsAreEnabled) {
+    Program program;
+    ASSERT_EQ("", program.readFromString(STRINGIFIED_PROGRAM));
+
+    ConfigurableOptions settings;
+    settings.generateQuantumOperationAnnotations = true;
+    IncrementalSynthesis incrementalSynthesis(SynthesisAlgorithm::CostAware);
+    const auto           synthesizedQuantumComputation = incrementalSynthesis.synthesize(program, settings);
+    ASSERT_NE(nullptr, synthesizedQuantumComputation);
+    ASSERT_TRUE(synthesizedQuantumComputation->isGenerationOfQuantumOperationAnnotationsEnabled());
+    ASSERT_TRUE(incrementalSynthesis.getFootprintsOfStatements().empty());
+    ASSERT_EQ(0U, incrementalSynthesis.getNumResynthesizedStatements());
+
+    settings.generateQuantumOperationAnnotations        = false;
+    settings.cancelAdjacentSelfInverseQuantumOperations = true;
+    ASSERT_NE(nullptr, incrementalSynthesis.synthesize(program, settings));
+    ASSERT_TRUE(incrementalSynthesis.getFootprintsOfStatements().empty());
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/jit_simulation_program.hpp"
+#include "algorithms/simulation/simple_simulation.hpp"
+#include "algorithms/simulation/simulation_program.hpp"
+#include "core/n_bit_values_container.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+#include <optional>
+#include <random>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    [[nodiscard]] qc::QuantumComputation createRandomQuantumComputation(const std::size_t numQubits, const std::size_t numGates, const std::uint64_t seed) {
+        std::mt19937_64                            generator(seed);
+        std::uniform_int_distribution<std::size_t> qubitDistribution(0, numQubits - 1U);
+        std::uniform_int_distribution<int>         gateKindDistribution(0, 3);
+
+        qc::QuantumComputation quantumComputation(numQubits);
+        for (std::size_t i = 0; i < numGates; ++i) {
+            const auto firstTarget  = static_cast<qc::Qubit>(qubitDistribution(generator));
+            const auto secondTarget = static_cast<qc::Qubit>((firstTarget + 1U + (qubitDistribution(generator) % (numQubits - 1U))) % numQubits);
+
+            qc::Controls controls;
+            for (std::size_t j = 0; j < 3U; ++j) {
+                const auto controlQubit = static_cast<qc::Qubit>(qubitDistribution(generator));
+                if (controlQubit != firstTarget && controlQubit != secondTarget) {
+                    controls.emplace(controlQubit, (generator() & 1U) != 0U ? qc::Control::Type::Pos : qc::Control::Type::Neg);
+                }
+            }
+
+            switch (gateKindDistribution(generator)) {
+                case 0:
+                    quantumComputation.x(firstTarget);
+                    break;
+                case 1:
+                    quantumComputation.mcx(controls, firstTarget);
+                    break;
+                case 2:
+                    quantumComputation.swap(firstTarget, secondTarget);
+                    break;
+                default:
+                    quantumComputation.mcswap(controls, firstTarget, secondTarget);
+                    break;
+            }
+        }
+        return quantumComputation;
+    }
+
+    void assertJitSimulationProgramMatchesSimulationProgram(const SimulationProgram& simulationProgram, const std::size_t numInputStates, const std::uint64_t seed) {
+        const JitSimulationProgram jitSimulationProgram = JitSimulationProgram::compile(simulationProgram);
+        ASSERT_EQ(simulationProgram.getNumQubits(), jitSimulationProgram.getNumQubits());
+        ASSERT_EQ(simulationProgram.getNumGates(), jitSimulationProgram.getNumGates());
+        ASSERT_EQ(JitSimulationProgram::isNativeCodeGenerationAvailable(), jitSimulationProgram.isNative());
+
+        std::mt19937_64                  generator(seed);
+        const std::uint64_t              valueMask = simulationProgram.getNumQubits() == 64U ? ~static_cast<std::uint64_t>(0U) : (static_cast<std::uint64_t>(1U) << simulationProgram.getNumQubits()) - 1U;
+        std::vector<std::uint64_t>       integerInputStates(numInputStates);
+        std::vector<NBitValuesContainer> inputStates;
+        for (auto& integerInputState: integerInputStates) {
+            integerInputState = generator() & valueMask;
+            inputStates.emplace_back(simulationProgram.getNumQubits(), integerInputState);
+        }
+
+        std::vector<std::uint64_t> expectedIntegerOutputStates(numInputStates);
+        std::vector<std::uint64_t> actualIntegerOutputStates(numInputStates);
+        ASSERT_TRUE(batchSimulation(expectedIntegerOutputStates, simulationProgram, integerInputStates));
+        ASSERT_TRUE(batchSimulation(actualIntegerOutputStates, jitSimulationProgram, integerInputStates));
+        ASSERT_EQ(expectedIntegerOutputStates, actualIntegerOutputStates);
+
+        std::vector<NBitValuesContainer> expectedOutputStates;
+        std::vector<NBitValuesContainer> actualOutputStates;
+        ASSERT_NO_FATAL_FAILURE(batchSimulation(expectedOutputStates, simulationProgram, inputStates));
+        ASSERT_NO_FATAL_FAILURE(batchSimulation(actualOutputStates, jitSimulationProgram, inputStates));
+        ASSERT_EQ(expectedOutputStates, actualOutputStates);
+    }
+} // namespace
+
+TEST(JitSimulationProgramTests, SimulationOfEmptyProgramDoesNotChangeInputStates) {
+    const qc::QuantumComputation quantumComputation(3);
+    const auto                   simulationProgram = SimulationProgram::compile(quantumComputation);
+    ASSERT_TRUE(simulationProgram.has_value());
+    ASSERT_NO_FATAL_FAILURE(assertJitSimulationProgramMatchesSimulationProgram(*simulationProgram, 300U, 1U));
+}
+
+TEST(JitSimulationProgramTests, SimulationOfRandomProgramsMatchesInterpretedSimulation) {
+    for (const std::size_t numQubits: {2U, 13U, 14U, 40U, 64U}) {
+        const auto quantumComputation = createRandomQuantumComputation(numQubits, 500U, numQubits);
+        const auto simulationProgram  = SimulationProgram::compile(quantumComputation);
+        ASSERT_TRUE(simulationProgram.has_value());
+        // The number of input states is chosen to not be a multiple of the lane count of the native code to also simulate a partially filled block.
+        ASSERT_NO_FATAL_FAILURE(assertJitSimulationProgramMatchesSimulationProgram(*simulationProgram, (2U * JitSimulationProgram::LANE_COUNT) + 37U, numQubits)) << "Mismatch for program with " << numQubits << " qubits";
+    }
+}
+
+TEST(JitSimulationProgramTests, SimulationWithMismatchingNumberOfLaneWordsFails) {
+    qc::QuantumComputation quantumComputation(2);
+    quantumComputation.cx(0, 1);
+    const auto simulationProgram = SimulationProgram::compile(quantumComputation);
+    ASSERT_TRUE(simulationProgram.has_value());
+
+    const JitSimulationProgram jitSimulationProgram = JitSimulationProgram::compile(*simulationProgram);
+    std::vector<std::uint64_t> laneWordsPerQubit(JitSimulationProgram::NUM_LANE_WORDS_PER_QUBIT, 0U);
+    ASSERT_FALSE(jitSimulationProgram.simulate(laneWordsPerQubit));
+
+    laneWordsPerQubit.assign(2U * JitSimulationProgram::NUM_LANE_WORDS_PER_QUBIT, 0U);
+    laneWordsPerQubit.front() = 1U;
+    ASSERT_TRUE(jitSimulationProgram.simulate(laneWordsPerQubit));
+    ASSERT_EQ(1U, laneWordsPerQubit[JitSimulationProgram::NUM_LANE_WORDS_PER_QUBIT]);
+}
+
+TEST(JitSimulationProgramTests, CacheReusesProgramWithSameGates) {
+    const auto firstSimulationProgram  = SimulationProgram::compile(createRandomQuantumComputation(8U, 50U, 1U));
+    const auto secondSimulationProgram = SimulationProgram::compile(createRandomQuantumComputation(8U, 50U, 2U));
+    ASSERT_TRUE(firstSimulationProgram.has_value());
+    ASSERT_TRUE(secondSimulationProgram.has_value());
+
+    JitSimulationProgramCache cache;
+    const auto                firstJitSimulationProgram = cache.getOrCompile(*firstSimulationProgram);
+    ASSERT_NE(nullptr, firstJitSimulationProgram);
+    ASSERT_EQ(firstJitSimulationProgram, cache.getOrCompile(*firstSimulationProgram));
+    ASSERT_NE(firstJitSimulationProgram, cache.getOrCompile(*secondSimulationProgram));
+    ASSERT_EQ(2U, cache.getNumCachedPrograms());
+    ASSERT_EQ(1U, cache.getNumCacheHits());
+    ASSERT_EQ(2U, cache.getNumCacheMisses());
+
+    cache.clear();
+    ASSERT_EQ(0U, cache.getNumCachedPrograms());
+    ASSERT_NE(firstJitSimulationProgram, cache.getOrCompile(*firstSimulationProgram));
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/optimization/line_ordering.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/operations/Control.hpp"
+#include "ir/operations/OpType.hpp"
+#include "ir/operations/StandardOperation.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    class LineOrderingTestsFixture: public testing::Test {
+    protected:
+        AnnotatableQuantumComputation annotatableQuantumComputation;
+
+        // Creates the quantum registers of the two variables 'a' and 'b' storing the qubits 0 to 1 and 2 to 3 followed by an ancillary quantum register storing the qubit 4.
+        void SetUp() override {
+            ASSERT_EQ(std::make_optional<qc::Qubit>(0U), annotatableQuantumComputation.addQuantumRegisterForSyrecVariable("a", AnnotatableQuantumComputation::AssociatedVariableLayoutInformation({.numValuesPerDimension = {1U}, .bitwidth = 2U}), false));
+            ASSERT_EQ(std::make_optional<qc::Qubit>(2U), annotatableQuantumComputation.addQuantumRegisterForSyrecVariable("b", AnnotatableQuantumComputation::AssociatedVariableLayoutInformation({.numValuesPerDimension = {1U}, .bitwidth = 2U}), false));
+            ASSERT_EQ(std::make_optional<qc::Qubit>(4U), annotatableQuantumComputation.addPreliminaryAncillaryRegisterOrAppendToAdjacentOne("anc", {false}, AnnotatableQuantumComputation::InlinedQubitInformation{}));
+            annotatableQuantumComputation.promotePreliminaryAncillaryQubitsToDefinitiveAncillaryQubits();
+        }
+    };
+} // namespace
+
+TEST(LineOrderingTests, NearestNeighborCostOfGate) {
+    ASSERT_EQ(0U, AnnotatableQuantumComputation::getNearestNeighborCostOfGate(std::vector<qc::Qubit>({2U})));
+    ASSERT_EQ(0U, AnnotatableQuantumComputation::getNearestNeighborCostOfGate(std::vector<qc::Qubit>({2U, 3U, 4U})));
+    ASSERT_EQ(2U, AnnotatableQuantumComputation::getNearestNeighborCostOfGate(std::vector<qc::Qubit>({0U, 3U})));
+    // Moving the qubits 0 and 5 next to the qubit 2 requires one and two SWAP gates
+    ASSERT_EQ(3U, AnnotatableQuantumComputation::getNearestNeighborCostOfGate(std::vector<qc::Qubit>({0U, 2U, 5U})));
+}
+
+TEST_F(LineOrderingTestsFixture, PermutationOfQubitsSplitsQuantumRegisters) {
+    ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingCnotGate(0U, 4U));
+    ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingToffoliGate(1U, 2U, 3U));
+    ASSERT_EQ(3U, annotatableQuantumComputation.determineNearestNeighborCost());
+
+    ASSERT_TRUE(annotatableQuantumComputation.permuteQubits({3U, 0U, 1U, 4U, 2U}));
+    ASSERT_TRUE(annotatableQuantumComputation.at(0)->equals(qc::StandardOperation(qc::Controls({3U}), 2U, qc::OpType::X)));
+    ASSERT_TRUE(annotatableQuantumComputation.at(1)->equals(qc::StandardOperation(qc::Controls({0U, 1U}), 4U, qc::OpType::X)));
+    ASSERT_EQ(2U, annotatableQuantumComputation.determineNearestNeighborCost());
+
+    const std::vector<std::optional<std::string>> expectedQubitLabels = {"a[0].1", "b[0].0", "anc[0].0", "a[0].0", "b[0].1"};
+    ASSERT_EQ(expectedQubitLabels, annotatableQuantumComputation.getQubitLabels(AnnotatableQuantumComputation::QubitLabelType::Internal));
+    for (qc::Qubit qubit = 0; qubit < annotatableQuantumComputation.getNqubits(); ++qubit) {
+        ASSERT_EQ(expectedQubitLabels[qubit], annotatableQuantumComputation.getQubitLabel(qubit, AnnotatableQuantumComputation::QubitLabelType::Internal)) << "Label of qubit " << qubit << " did not match";
+    }
+    ASSERT_TRUE(annotatableQuantumComputation.logicalQubitIsAncillary(2U));
+    ASSERT_FALSE(annotatableQuantumComputation.logicalQubitIsAncillary(4U));
+
+    const auto& quantumRegisters = annotatableQuantumComputation.getQuantumRegisters();
+    ASSERT_EQ(5U, quantumRegisters.size());
+    ASSERT_EQ(3U, quantumRegisters.at("a_0").getStartIndex());
+    ASSERT_EQ(0U, quantumRegisters.at("a_1").getStartIndex());
+    ASSERT_EQ(1U, quantumRegisters.at("b_0").getStartIndex());
+    ASSERT_EQ(4U, quantumRegisters.at("b_1").getStartIndex());
+    ASSERT_EQ(2U, quantumRegisters.at("anc").getStartIndex());
+
+    const std::optional<std::string> serializedQuantumComputation = annotatableQuantumComputation.serialize();
+    ASSERT_TRUE(serializedQuantumComputation.has_value());
+    const std::unique_ptr<AnnotatableQuantumComputation> deserializedQuantumComputation = AnnotatableQuantumComputation::deserialize(*serializedQuantumComputation);
+    ASSERT_NE(nullptr, deserializedQuantumComputation);
+    ASSERT_EQ(expectedQubitLabels, deserializedQuantumComputation->getQubitLabels(AnnotatableQuantumComputation::QubitLabelType::Internal));
+    ASSERT_EQ(5U, deserializedQuantumComputation->getQuantumRegisters().size());
+}
+
+TEST_F(LineOrderingTestsFixture, PermutationRestoringOriginalOrderOfQubitsMergesQuantumRegisters) {
+    ASSERT_TRUE(annotatableQuantumComputation.permuteQubits({1U, 0U, 2U, 3U, 4U}));
+    ASSERT_EQ(4U, annotatableQuantumComputation.getQuantumRegisters().size());
+    ASSERT_TRUE(annotatableQuantumComputation.permuteQubits({1U, 0U, 2U, 3U, 4U}));
+    ASSERT_EQ(3U, annotatableQuantumComputation.getQuantumRegisters().size());
+    ASSERT_EQ(std::make_optional<std::string>("a[0].0"), annotatableQuantumComputation.getQubitLabel(0U, AnnotatableQuantumComputation::QubitLabelType::Internal));
+}
+
+TEST_F(LineOrderingTestsFixture, InvalidPermutationIsRejected) {
+    ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingCnotGate(0U, 4U));
+    ASSERT_FALSE(annotatableQuantumComputation.permuteQubits({0U, 0U, 1U, 2U, 3U}));
+    ASSERT_FALSE(annotatableQuantumComputation.permuteQubits({0U, 1U, 2U, 3U}));
+    ASSERT_FALSE(annotatableQuantumComputation.permuteQubits({0U, 1U, 2U, 3U, 5U}));
+    ASSERT_TRUE(annotatableQuantumComputation.at(0)->equals(qc::StandardOperation(qc::Controls({0U}), 4U, qc::OpType::X)));
+    ASSERT_EQ(3U, annotatableQuantumComputation.getQuantumRegisters().size());
+}
+
+TEST_F(LineOrderingTestsFixture, ReorderingReducesNearestNeighborCost) {
+    for (std::size_t i = 0; i < 3U; ++i) {
+        ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingCnotGate(0U, 4U));
+        ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingCnotGate(1U, 3U));
+    }
+    const auto costPriorToReordering = annotatableQuantumComputation.determineNearestNeighborCost();
+    ASSERT_EQ(3U * (3U + 1U), costPriorToReordering);
+
+    const std::vector<std::optional<std::string>> qubitLabelsPriorToReordering = annotatableQuantumComputation.getQubitLabels(AnnotatableQuantumComputation::QubitLabelType::Internal);
+    const auto                                    costReduction                = reorderQubitsToReduceNearestNeighborCost(annotatableQuantumComputation, LineOrderingSettings{.seed = 42U});
+    // Both pairs of interacting qubits can be placed next to each other
+    ASSERT_EQ(costPriorToReordering, costReduction);
+    ASSERT_EQ(0U, annotatableQuantumComputation.determineNearestNeighborCost());
+
+    // Every gate still operates on the qubits with the labels of its original qubits
+    const std::vector<std::optional<std::string>> qubitLabels = annotatableQuantumComputation.getQubitLabels(AnnotatableQuantumComputation::QubitLabelType::Internal);
+    std::vector<qc::Qubit>                        newIndexPerQubit(qubitLabels.size());
+    for (qc::Qubit qubit = 0; qubit < qubitLabels.size(); ++qubit) {
+        const auto matchingQubitLabel = std::ranges::find(qubitLabels, qubitLabelsPriorToReordering[qubit]);
+        ASSERT_NE(qubitLabels.cend(), matchingQubitLabel) << "Label of qubit " << qubit << " was lost";
+        newIndexPerQubit[qubit] = static_cast<qc::Qubit>(std::distance(qubitLabels.cbegin(), matchingQubitLabel));
+    }
+    for (std::size_t i = 0; i < annotatableQuantumComputation.getNops(); ++i) {
+        const qc::StandardOperation expectedQuantumOperation = i % 2U == 0U ? qc::StandardOperation(qc::Controls({newIndexPerQubit[0]}), newIndexPerQubit[4], qc::OpType::X) : qc::StandardOperation(qc::Controls({newIndexPerQubit[1]}), newIndexPerQubit[3], qc::OpType::X);
+        ASSERT_TRUE(annotatableQuantumComputation.at(i)->equals(expectedQuantumOperation)) << "Quantum operation " << i << " did not match";
+    }
+    ASSERT_TRUE(annotatableQuantumComputation.logicalQubitIsAncillary(newIndexPerQubit[4]));
+
+    // No further reduction is possible
+    ASSERT_EQ(0U, reorderQubitsToReduceNearestNeighborCost(annotatableQuantumComputation));
+}
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/optimization/loop_optimization.hpp"
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "core/configurable_options.hpp"
+#include "core/syrec/expression.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/number.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+#include "differential_verification_test_fixture.hpp"
+#include "syrec_ir_builder.hpp"
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+using namespace syrec_ir_builder;
+
+namespace {
+    class LoopOptimizationTestsFixture: public DifferentialVerificationTestFixture {
+    protected:
+        Module::ptr   mainModule = std::make_shared<Module>("main");
+        Variable::ptr x          = std::make_shared<Variable>(Variable::Type::In, "x", std::vector<unsigned>({4U}), 4U);
+        Variable::ptr y          = std::make_shared<Variable>(Variable::Type::Inout, "y", std::vector<unsigned>({4U}), 4U);
+        Variable::ptr z          = std::make_shared<Variable>(Variable::Type::Out, "z", std::vector<unsigned>({4U}), 4U);
+        Variable::ptr u          = std::make_shared<Variable>(Variable::Type::In, "u", std::vector<unsigned>({1U}), 4U);
+        Variable::ptr w          = std::make_shared<Variable>(Variable::Type::In, "w", std::vector<unsigned>({1U}), 4U);
+
+        void SetUp() override {
+            mainModule->addParameter(x);
+            mainModule->addParameter(y);
+            mainModule->addParameter(z);
+            mainModule->addParameter(u);
+            mainModule->addParameter(w);
+            program.addModule(mainModule);
+        }
+
+        [[nodiscard]] static std::shared_ptr<ForStatement> createLoop(const std::string& loopVariable, const unsigned startValue, const unsigned endValue, Statement::vec statements) {
+            auto loop          = std::make_shared<ForStatement>();
+            loop->loopVariable = loopVariable;
+            loop->range        = std::make_pair(std::make_shared<Number>(startValue), std::make_shared<Number>(endValue));
+            loop->step         = std::make_shared<Number>(1U);
+            loop->statements   = std::move(statements);
+            return loop;
+        }
+
+        [[nodiscard]] Expression::ptr createSumOfScalarInputs() const {
+            return std::make_shared<BinaryExpression>(createVariableExpression(createVariableAccess(u)), BinaryExpression::BinaryOperation::Add, createVariableExpression(createVariableAccess(w)));
+        }
+
+        void assertOptimizationDoesNotChangeSimulationResult(const SynthesisAlgorithm synthesisAlgorithm) {
+            ASSERT_NO_FATAL_FAILURE(assertSynthesisDoesNotChangeSimulationResult(program, ConfigurableOptions(), synthesisAlgorithm));
+            optimizeLoopsOfProgram(program);
+            ASSERT_NO_FATAL_FAILURE(assertSynthesisDoesNotChangeSimulationResult(program, ConfigurableOptions(), synthesisAlgorithm));
+        }
+    };
+} // namespace
+
+TEST_F(LoopOptimizationTestsFixture, AdjacentLoopsAccessingElementsSelectedByLoopVariableAreFused) {
+    const Statement::ptr firstAssignment = createAssignment(createVariableAccess(y, "i"), AssignStatement::AssignOperation::Add, createVariableExpression(createVariableAccess(x, "i")));
+    mainModule->addStatement(createLoop("i", 0U, 4U, {firstAssignment}));
+    mainModule->addStatement(createLoop("j", 0U, 4U, {createAssignment(createVariableAccess(z, "j"), AssignStatement::AssignOperation::Exor, createVariableExpression(createVariableAccess(y, "j")))}));
+
+    LoopOptimizationReport report;
+    optimizeLoopsOfProgram(program, LoopOptimizationSettings{.fuseAdjacentLoops = true, .hoistLoopInvariantExpressions = false}, ConfigurableOptions(), SynthesisAlgorithm::CostAware, &report);
+    ASSERT_EQ(1U, report.loopFusion.numTransformations);
+    ASSERT_EQ(0U, report.loopInvariantCodeMotion.numTransformations);
+    ASSERT_TRUE(report.loopFusion.getEstimatedNumRemovedQuantumOperations().has_value());
+    ASSERT_EQ(0, *report.loopFusion.getEstimatedNumRemovedQuantumOperations());
+
+    ASSERT_EQ(1U, mainModule->statements.size());
+    const auto* const fusedLoop = dynamic_cast<const ForStatement*>(mainModule->statements.front().get());
+    ASSERT_NE(nullptr, fusedLoop);
+    ASSERT_EQ("i", fusedLoop->loopVariable);
+    ASSERT_EQ(2U, fusedLoop->statements.size());
+    ASSERT_EQ(firstAssignment, fusedLoop->statements.front());
+
+    // The loop variable of the second loop is replaced by the one of the fused loop
+    const auto* const renamedAssignment = dynamic_cast<const AssignStatement*>(fusedLoop->statements.back().get());
+    ASSERT_NE(nullptr, renamedAssignment);
+    const auto* const renamedIndex = dynamic_cast<const NumericExpression*>(renamedAssignment->lhs->indexes.front().get());
+    ASSERT_NE(nullptr, renamedIndex);
+    ASSERT_TRUE(renamedIndex->value->isLoopVariable());
+    ASSERT_EQ("i", renamedIndex->value->variableName());
+}
+
+TEST_F(LoopOptimizationTestsFixture, DependentOrDifferentLoopsAreNotFused) {
+    // The second loop reads an element of y modified in a later iteration of the first loop
+    mainModule->addStatement(createLoop("i", 0U, 4U, {createAssignment(createVariableAccess(y, "i"), AssignStatement::AssignOperation::Add, createVariableExpression(createVariableAccess(x, "i")))}));
+    mainModule->addStatement(createLoop("j", 0U, 4U, {createAssignment(createVariableAccess(z, "j"), AssignStatement::AssignOperation::Exor, createVariableExpression(createVariableAccess(y, 3U)))}));
+    // Loops performing different iterations
+    mainModule->addStatement(createLoop("k", 1U, 4U, {createAssignment(createVariableAccess(z, "k"), AssignStatement::AssignOperation::Add, createVariableExpression(createVariableAccess(x, "k")))}));
+    // The called module could modify any element of its parameters
+    const auto calledModule = std::make_shared<Module>("incr");
+    calledModule->addParameter(std::make_shared<Variable>(Variable::Type::Inout, "p", std::vector<unsigned>({4U}), 4U));
+    program.addModule(calledModule);
+    mainModule->addStatement(createLoop("l", 1U, 4U, {std::make_shared<CallStatement>(calledModule, std::vector<std::string>({"z"}))}));
+
+    const Statement::vec statementsPriorToOptimization = mainModule->statements;
+    LoopOptimizationReport report;
+    optimizeLoopsOfProgram(program, LoopOptimizationSettings{.fuseAdjacentLoops = true, .hoistLoopInvariantExpressions = false}, ConfigurableOptions(), SynthesisAlgorithm::CostAware, &report);
+    ASSERT_EQ(0U, report.loopFusion.numTransformations);
+    ASSERT_EQ(statementsPriorToOptimization, mainModule->statements);
+}
+
+TEST_F(LoopOptimizationTestsFixture, LoopInvariantExpressionIsHoistedOutOfLoop) {
+    const Expression::ptr loopInvariantExpr = createSumOfScalarInputs();
+    mainModule->addStatement(createLoop("i", 0U, 4U, {createAssignment(createVariableAccess(y, "i"), AssignStatement::AssignOperation::Add, std::make_shared<BinaryExpression>(loopInvariantExpr, BinaryExpression::BinaryOperation::Exor, createVariableExpression(createVariableAccess(x, "i"))))}));
+
+    LoopOptimizationReport report;
+    optimizeLoopsOfProgram(program, LoopOptimizationSettings{.fuseAdjacentLoops = false, .hoistLoopInvariantExpressions = true}, ConfigurableOptions(), SynthesisAlgorithm::CostAware, &report);
+    ASSERT_EQ(1U, report.loopInvariantCodeMotion.numTransformations);
+    ASSERT_TRUE(report.loopInvariantCodeMotion.getEstimatedNumRemovedQuantumOperations().has_value());
+    ASSERT_GT(*report.loopInvariantCodeMotion.getEstimatedNumRemovedQuantumOperations(), 0);
+
+    ASSERT_EQ(1U, mainModule->variables.size());
+    const Variable::ptr& wire = mainModule->variables.front();
+    ASSERT_EQ(Variable::Type::Wire, wire->type);
+    ASSERT_EQ(4U, wire->bitwidth);
+    ASSERT_EQ(std::make_optional(5U), wire->declarationIndexInModule);
+
+    // The result of the hoisted expression is computed prior to the loop and reverted after it
+    ASSERT_EQ(3U, mainModule->statements.size());
+    for (const std::size_t i: {0U, 2U}) {
+        const auto* const hoistedAssignment = dynamic_cast<const AssignStatement*>(mainModule->statements[i].get());
+        ASSERT_NE(nullptr, hoistedAssignment);
+        ASSERT_EQ(wire, hoistedAssignment->lhs->var);
+        ASSERT_EQ(AssignStatement::AssignOperation::Exor, hoistedAssignment->assignOperation);
+        ASSERT_EQ(loopInvariantExpr, hoistedAssignment->rhs);
+    }
+
+    const auto* const optimizedLoop = dynamic_cast<const ForStatement*>(mainModule->statements[1].get());
+    ASSERT_NE(nullptr, optimizedLoop);
+    ASSERT_EQ(1U, optimizedLoop->statements.size());
+    const auto* const optimizedAssignment = dynamic_cast<const AssignStatement*>(optimizedLoop->statements.front().get());
+    ASSERT_NE(nullptr, optimizedAssignment);
+    const auto* const optimizedRhs = dynamic_cast<const BinaryExpression*>(optimizedAssignment->rhs.get());
+    ASSERT_NE(nullptr, optimizedRhs);
+    const auto* const accessOfWire = dynamic_cast<const VariableExpression*>(optimizedRhs->lhs.get());
+    ASSERT_NE(nullptr, accessOfWire);
+    ASSERT_EQ(wire, accessOfWire->var->var);
+}
+
+TEST_F(LoopOptimizationTestsFixture, ExpressionsDependingOnIterationOfLoopAreNotHoisted) {
+    // The expression uses the loop variable respectively accesses a variable modified in the loop body
+    mainModule->addStatement(createLoop("i", 0U, 4U, {createAssignment(createVariableAccess(y, "i"), AssignStatement::AssignOperation::Add, std::make_shared<BinaryExpression>(createVariableExpression(createVariableAccess(u)), BinaryExpression::BinaryOperation::Add, createVariableExpression(createVariableAccess(x, "i")))),
+                                                      createAssignment(createVariableAccess(z, "i"), AssignStatement::AssignOperation::Exor, std::make_shared<BinaryExpression>(createVariableExpression(createVariableAccess(y, 0U)), BinaryExpression::BinaryOperation::BitwiseAnd, createVariableExpression(createVariableAccess(w))))}));
+    // The computation of the invariant expression is not amortized over two iterations
+    mainModule->addStatement(createLoop("j", 0U, 2U, {createAssignment(createVariableAccess(z, "j"), AssignStatement::AssignOperation::Add, createSumOfScalarInputs())}));
+
+    const Statement::vec statementsPriorToOptimization = mainModule->statements;
+    LoopOptimizationReport report;
+    optimizeLoopsOfProgram(program, LoopOptimizationSettings{.fuseAdjacentLoops = false, .hoistLoopInvariantExpressions = true}, ConfigurableOptions(), SynthesisAlgorithm::CostAware, &report);
+    ASSERT_EQ(0U, report.loopInvariantCodeMotion.numTransformations);
+    ASSERT_EQ(statementsPriorToOptimization, mainModule->statements);
+    ASSERT_TRUE(mainModule->variables.empty());
+}
+
+TEST_F(LoopOptimizationTestsFixture, OptimizedLoopsDoNotChangeSimulationResult) {
+    mainModule->addStatement(createLoop("i", 0U, 4U, {createAssignment(createVariableAccess(y, "i"), AssignStatement::AssignOperation::Add, std::make_shared<BinaryExpression>(createSumOfScalarInputs(), BinaryExpression::BinaryOperation::Exor, createVariableExpression(createVariableAccess(x, "i"))))}));
+    mainModule->addStatement(createLoop("j", 0U, 4U, {createAssignment(createVariableAccess(z, "j"), AssignStatement::AssignOperation::Exor, std::make_shared<BinaryExpression>(createVariableExpression(createVariableAccess(y, "j")), BinaryExpression::BinaryOperation::Subtract, std::make_shared<BinaryExpression>(createVariableExpression(createVariableAccess(u)), BinaryExpression::BinaryOperation::BitwiseAnd, createVariableExpression(createVariableAccess(w)))))}));
+
+    ASSERT_NO_FATAL_FAILURE(assertOptimizationDoesNotChangeSimulationResult(SynthesisAlgorithm::CostAware));
+    // Both hoisted expressions are computed prior to and reverted after the fused loop
+    ASSERT_EQ(5U, mainModule->statements.size());
+    ASSERT_EQ(2U, mainModule->variables.size());
+}
+
+TEST_F(LoopOptimizationTestsFixture, OptimizedLoopsDoNotChangeSimulationResultOfLineAwareSynthesis) {
+    mainModule->addStatement(createLoop("i", 0U, 4U, {createAssignment(createVariableAccess(y, "i"), AssignStatement::AssignOperation::Add, std::make_shared<BinaryExpression>(createSumOfScalarInputs(), BinaryExpression::BinaryOperation::Exor, createVariableExpression(createVariableAccess(x, "i"))))}));
+    mainModule->addStatement(createLoop("j", 0U, 4U, {createAssignment(createVariableAccess(z, "j"), AssignStatement::AssignOperation::Exor, createVariableExpression(createVariableAccess(y, "j")))}));
+
+    ASSERT_NO_FATAL_FAILURE(assertOptimizationDoesNotChangeSimulationResult(SynthesisAlgorithm::LineAware));
+    ASSERT_EQ(3U, mainModule->statements.size());
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/memory_accounting.hpp"
+#include "core/quantum_operation_annotations_table.hpp"
+#include "core/statistics.hpp"
+#include "core/syrec/ir_memory_usage.hpp"
+#include "core/syrec/program.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace syrec;
+
+namespace {
+    constexpr auto STRINGIFIED_PROGRAM = "module add(inout x(4), in y(4)) x += y "
+                                         "module main(inout a(4), in b(4)) wire c(4) for $i = 0 to 3 do a += (b + $i) rof; call add(c, b); a ^= c";
+} // namespace
+
+TEST(MemoryAccountingTests, HeapStorageOfStringInSmallStringBufferIsNotCounted) {
+    const std::string shortString = "a";
+    const std::string longString(100, 'a');
+    ASSERT_EQ(0U, memory_accounting::numBytesOfHeapStorage(shortString));
+    ASSERT_LE(longString.size() + 1U, memory_accounting::numBytesOfHeapStorage(longString));
+}
+
+TEST(MemoryAccountingTests, NumBytesOfIrGrowWithNumberOfStatements) {
+    Program smallerProgram;
+    ASSERT_EQ("", smallerProgram.readFromString("module main(inout a(4), in b(4)) a += b"));
+    Program largerProgram;
+    ASSERT_EQ("", largerProgram.readFromString("module main(inout a(4), in b(4)) a += b; a += (b + 2); a ^= b"));
+
+    const std::size_t numBytesOfSmallerProgram = determineNumBytesOfIr(smallerProgram.modules());
+    ASSERT_LT(0U, numBytesOfSmallerProgram);
+    ASSERT_LT(numBytesOfSmallerProgram, determineNumBytesOfIr(largerProgram.modules()));
+}
+
+TEST(MemoryAccountingTests, NumBytesOfAnnotationsTableGrowWithDistinctAnnotations) {
+    QuantumOperationAnnotationsTable annotationsTable;
+    annotationsTable.resize(4);
+    const std::size_t numBytesWithoutAnnotations = annotationsTable.determineNumBytes();
+
+    ASSERT_TRUE(annotationsTable.setOrUpdateAnnotationOfQuantumOperation(0, "key", "value"));
+    ASSERT_TRUE(annotationsTable.setOrUpdateAnnotationOfQuantumOperation(2, "key", "otherValue"));
+    ASSERT_LT(numBytesWithoutAnnotations, annotationsTable.determineNumBytes());
+}
+
+TEST(MemoryAccountingTests, MemoryUsageIsNotRecordedByDefault) {
+    Statistics statistics;
+    Program    program;
+    ASSERT_EQ("", program.readFromString(STRINGIFIED_PROGRAM, ConfigurableOptions(), &statistics));
+
+    AnnotatableQuantumComputation annotatableQuantumComputation(true);
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(annotatableQuantumComputation, program, ConfigurableOptions(), &statistics));
+    ASSERT_EQ(MemoryUsage(), statistics.memoryUsage);
+}
+
+TEST(MemoryAccountingTests, MemoryUsageOfParsingAndSynthesisIsRecordedIfRequested) {
+    ConfigurableOptions settings;
+    settings.recordMemoryUsage = true;
+
+    Statistics statistics;
+    Program    program;
+    ASSERT_EQ("", program.readFromString(STRINGIFIED_PROGRAM, settings, &statistics));
+    ASSERT_LT(0U, statistics.memoryUsage.numBytesOfSymbolTables);
+    ASSERT_EQ(determineNumBytesOfIr(program.modules()), statistics.memoryUsage.numBytesOfProgram);
+
+    AnnotatableQuantumComputation annotatableQuantumComputation(true);
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(annotatableQuantumComputation, program, settings, &statistics));
+
+    const MemoryUsage& memoryUsage = statistics.memoryUsage;
+    ASSERT_LT(0U, memoryUsage.numBytesOfSymbolTables);
+    ASSERT_LT(0U, memoryUsage.numBytesOfProgram);
+    ASSERT_LT(0U, memoryUsage.numBytesOfQuantumOperations);
+    ASSERT_LT(0U, memoryUsage.numBytesOfQuantumOperationAnnotations);
+    ASSERT_LT(0U, memoryUsage.numBytesOfQuantumRegisterLayouts);
+    ASSERT_LT(0U, memoryUsage.numBytesOfInlineStacks);
+    ASSERT_LT(0U, memoryUsage.residentSetSizeAtStartOfSynthesisInBytes);
+    ASSERT_LE(memoryUsage.residentSetSizeAtStartOfSynthesisInBytes, memoryUsage.peakResidentSetSizeDuringSynthesisInBytes);
+
+    MemoryUsage memoryUsageOfQuantumComputation;
+    annotatableQuantumComputation.recordMemoryUsage(memoryUsageOfQuantumComputation);
+    ASSERT_EQ(memoryUsage.numBytesOfQuantumOperations, memoryUsageOfQuantumComputation.numBytesOfQuantumOperations);
+    ASSERT_EQ(memoryUsage.numBytesOfQuantumOperationAnnotations, memoryUsageOfQuantumComputation.numBytesOfQuantumOperationAnnotations);
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/statistics.hpp"
+#include "core/syrec/program.hpp"
+#include "differential_verification_test_fixture.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+
+using namespace syrec;
+
+namespace {
+    class MirroredModuleCallSynthesisTestsFixture: public DifferentialVerificationTestFixture {
+    protected:
+        [[nodiscard]] static ConfigurableOptions createSettingsWithoutReuseOfSynthesizedModuleCalls() {
+            ConfigurableOptions settings;
+            settings.reuseSynthesizedModuleCalls = false;
+            return settings;
+        }
+    };
+} // namespace
+
+TEST_F(MirroredModuleCallSynthesisTestsFixture, UncallOfPreviouslyCalledModuleReplaysQuantumOperationsOfCallInReverseOrder) {
+    parseProgram("module f(inout a(4), in b(4)) a ^= b; ++= a module main(inout a(4), in b(4), inout c(4)) call f(a, b); c ^= a; uncall f(a, b)");
+
+    AnnotatableQuantumComputation quantumComputation;
+    Statistics                    statistics;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(quantumComputation, program, ConfigurableOptions(), &statistics));
+    ASSERT_EQ(1U, statistics.numExpandedModuleCalls);
+    ASSERT_EQ(1U, statistics.numReusedModuleCalls);
+
+    AnnotatableQuantumComputation quantumComputationWithoutReuse;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(quantumComputationWithoutReuse, program, createSettingsWithoutReuseOfSynthesizedModuleCalls()));
+    ASSERT_EQ(quantumComputationWithoutReuse.getNqubits(), quantumComputation.getNqubits());
+    ASSERT_EQ(quantumComputationWithoutReuse.getNops(), quantumComputation.getNops());
+
+    // The call of the module synthesizes 4 CNOT gates for the XOR assignment and 4 gates for the increment while the assignment in the main module synthesizes 4 CNOT gates.
+    constexpr std::size_t numQuantumOperationsOfCall = 8U;
+    ASSERT_EQ((2U * numQuantumOperationsOfCall) + 4U, quantumComputation.getNops());
+    for (std::size_t i = 0; i < numQuantumOperationsOfCall; ++i) {
+        ASSERT_TRUE(quantumComputation.at(i)->equals(*quantumComputation.at(quantumComputation.getNops() - 1U - i))) << "Quantum operation " << i << " of call was not mirrored by uncall";
+    }
+    ASSERT_NO_FATAL_FAILURE(assertSynthesisDoesNotChangeSimulationResult(program, ConfigurableOptions(), SynthesisAlgorithm::CostAware));
+    ASSERT_NO_FATAL_FAILURE(assertSynthesisDoesNotChangeSimulationResult(program, ConfigurableOptions(), SynthesisAlgorithm::LineAware));
+}
+
+TEST_F(MirroredModuleCallSynthesisTestsFixture, UncallWithDifferentControlQubitsOrCallerArgumentsIsNotMirrored) {
+    parseProgram("module f(inout a(4), in b(4)) a ^= b; ++= a module main(inout a(4), in b(4), inout c(4), in g(1)) if g then call f(a, b) else skip fi g; call f(c, b); uncall f(a, b)");
+
+    AnnotatableQuantumComputation quantumComputation;
+    Statistics                    statistics;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(quantumComputation, program, ConfigurableOptions(), &statistics));
+    ASSERT_EQ(0U, statistics.numReusedModuleCalls);
+    ASSERT_NO_FATAL_FAILURE(assertSynthesisDoesNotChangeSimulationResult(program, ConfigurableOptions(), SynthesisAlgorithm::CostAware));
+}
+
+TEST_F(MirroredModuleCallSynthesisTestsFixture, UncallInSameBranchAsCallIsMirrored) {
+    parseProgram("module f(inout a(4), in b(4)) a ^= b; ++= a module main(inout a(4), in b(4), inout c(4), in g(1)) if g then call f(a, b); c += a; uncall f(a, b) else skip fi g");
+
+    Statistics                    statistics;
+    AnnotatableQuantumComputation quantumComputation;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(quantumComputation, program, ConfigurableOptions(), &statistics));
+    ASSERT_EQ(1U, statistics.numReusedModuleCalls);
+    ASSERT_NO_FATAL_FAILURE(assertSynthesisDoesNotChangeSimulationResult(program, ConfigurableOptions(), SynthesisAlgorithm::CostAware));
+}
+
+TEST_F(MirroredModuleCallSynthesisTestsFixture, UncallOfModuleCreatingQubitsIsNotMirrored) {
+    // The local variable of the module is not reset by the module body, replaying the quantum operations of the call in reverse order would thus not match the synthesis of the module body for the uncall.
+    parseProgram("module f(inout a(4)) wire t(4) t ^= a; ++= t; a ^= t module main(inout a(4), inout c(4)) call f(a); c ^= a; uncall f(a)");
+
+    AnnotatableQuantumComputation quantumComputation;
+    Statistics                    statistics;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(quantumComputation, program, ConfigurableOptions(), &statistics));
+    ASSERT_EQ(0U, statistics.numReusedModuleCalls);
+
+    AnnotatableQuantumComputation quantumComputationWithoutReuse;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(quantumComputationWithoutReuse, program, createSettingsWithoutReuseOfSynthesizedModuleCalls()));
+    ASSERT_EQ(quantumComputationWithoutReuse.getNqubits(), quantumComputation.getNqubits());
+    ASSERT_EQ(quantumComputationWithoutReuse.getNops(), quantumComputation.getNops());
+    ASSERT_NO_FATAL_FAILURE(assertSynthesisDoesNotChangeSimulationResult(program, ConfigurableOptions(), SynthesisAlgorithm::CostAware));
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/module_call_tree.hpp"
+#include "core/syrec/module.hpp"
+
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+#include <memory>
+#include <optional>
+
+using namespace syrec;
+
+TEST(ModuleCallTreeTests, AddRootNode) {
+    auto       moduleCallTree = ModuleCallTree();
+    const auto mainModule     = std::make_shared<Module>("main");
+
+    const std::optional<ModuleCallTree::NodeId> rootNodeId = moduleCallTree.addNode(std::nullopt, mainModule, std::nullopt, std::nullopt);
+    ASSERT_EQ(0U, rootNodeId);
+    ASSERT_EQ(1U, moduleCallTree.getNumNodes());
+
+    const ModuleCallTree::Node* rootNode = moduleCallTree.getNode(*rootNodeId);
+    ASSERT_THAT(rootNode, testing::NotNull());
+    ASSERT_FALSE(rootNode->parentNodeId.has_value());
+    ASSERT_FALSE(rootNode->lineNumberOfCallOfTargetModule.has_value());
+    ASSERT_FALSE(rootNode->isTargetModuleAccessedViaCallStmt.has_value());
+    ASSERT_EQ(mainModule, rootNode->targetModule);
+    ASSERT_EQ(1U, rootNode->depth);
+}
+
+TEST(ModuleCallTreeTests, AddNodesOfNestedModuleCalls) {
+    auto       moduleCallTree = ModuleCallTree();
+    const auto mainModule     = std::make_shared<Module>("main");
+    const auto calledModule   = std::make_shared<Module>("called");
+
+    const std::optional<ModuleCallTree::NodeId> rootNodeId         = moduleCallTree.addNode(std::nullopt, mainModule, std::nullopt, std::nullopt);
+    const std::optional<ModuleCallTree::NodeId> callNodeId         = rootNodeId.has_value() ? moduleCallTree.addNode(*rootNodeId, calledModule, 2U, true) : std::nullopt;
+    const std::optional<ModuleCallTree::NodeId> nestedUncallNodeId = callNodeId.has_value() ? moduleCallTree.addNode(*callNodeId, calledModule, 7U, false) : std::nullopt;
+    ASSERT_TRUE(nestedUncallNodeId.has_value());
+    ASSERT_EQ(3U, moduleCallTree.getNumNodes());
+
+    const ModuleCallTree::Node* nestedUncallNode = moduleCallTree.getNode(*nestedUncallNodeId);
+    ASSERT_THAT(nestedUncallNode, testing::NotNull());
+    ASSERT_EQ(callNodeId, nestedUncallNode->parentNodeId);
+    ASSERT_EQ(7U, nestedUncallNode->lineNumberOfCallOfTargetModule);
+    ASSERT_EQ(false, nestedUncallNode->isTargetModuleAccessedViaCallStmt);
+    ASSERT_EQ(calledModule, nestedUncallNode->targetModule);
+    ASSERT_EQ(3U, nestedUncallNode->depth);
+
+    // Sibling nodes reference the same parent node and have the same depth
+    const std::optional<ModuleCallTree::NodeId> siblingCallNodeId = moduleCallTree.addNode(*rootNodeId, calledModule, 3U, true);
+    ASSERT_TRUE(siblingCallNodeId.has_value());
+    ASSERT_EQ(rootNodeId, moduleCallTree.getNode(*siblingCallNodeId)->parentNodeId);
+    ASSERT_EQ(2U, moduleCallTree.getNode(*siblingCallNodeId)->depth);
+}
+
+TEST(ModuleCallTreeTests, AddNodeWithoutTargetModuleNotPossible) {
+    auto moduleCallTree = ModuleCallTree();
+    ASSERT_FALSE(moduleCallTree.addNode(std::nullopt, nullptr, std::nullopt, std::nullopt).has_value());
+
+    const std::optional<ModuleCallTree::NodeId> rootNodeId = moduleCallTree.addNode(std::nullopt, std::make_shared<Module>("main"), std::nullopt, std::nullopt);
+    ASSERT_TRUE(rootNodeId.has_value());
+    ASSERT_FALSE(moduleCallTree.addNode(*rootNodeId, nullptr, 1U, true).has_value());
+    ASSERT_EQ(1U, moduleCallTree.getNumNodes());
+}
+
+TEST(ModuleCallTreeTests, AddNodeWithNotExistingParentNodeNotPossible) {
+    auto       moduleCallTree = ModuleCallTree();
+    const auto mainModule     = std::make_shared<Module>("main");
+    ASSERT_FALSE(moduleCallTree.addNode(0U, mainModule, 1U, true).has_value());
+
+    ASSERT_TRUE(moduleCallTree.addNode(std::nullopt, mainModule, std::nullopt, std::nullopt).has_value());
+    ASSERT_FALSE(moduleCallTree.addNode(1U, mainModule, 1U, true).has_value());
+    ASSERT_EQ(1U, moduleCallTree.getNumNodes());
+}
+
+TEST(ModuleCallTreeTests, GetNotExistingNode) {
+    auto moduleCallTree = ModuleCallTree();
+    ASSERT_THAT(moduleCallTree.getNode(0U), testing::IsNull());
+
+    ASSERT_TRUE(moduleCallTree.addNode(std::nullopt, std::make_shared<Module>("main"), std::nullopt, std::nullopt).has_value());
+    ASSERT_THAT(moduleCallTree.getNode(0U), testing::NotNull());
+    ASSERT_THAT(moduleCallTree.getNode(1U), testing::IsNull());
+}
@@ -12,11 +12,14 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <gtest/gtest.h>
 #include <initializer_list>
 #include <memory>
 #include <optional>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 using namespace syrec;
 
@@ -437,3 +440,128 @@ TEST(NBitValuesContainerTests, StringifyContainerWithSomeBitsSet) {
     auto                    nBitValuesContainer   = std::make_unique<NBitValuesContainer>(initialContainerSize, initializationInteger);
     ASSERT_EQ("10111", nBitValuesContainer->stringify());
 }
+
+// WORD-LEVEL STORAGE
+TEST(NBitValuesContainerTests, ResizeContainerBeyondInlineStorageCapacityPreservesValues) {
+    constexpr std::size_t   initialContainerSize  = 5;
+    constexpr std::uint64_t initializationInteger = 29; // 10111
+    NBitValuesContainer     nBitValuesContainer(initialContainerSize, initializationInteger);
+
+    constexpr std::size_t largeContainerSize = NBitValuesContainer::INLINE_STORAGE_CAPACITY_IN_BITS + 72;
+    nBitValuesContainer.resize(largeContainerSize);
+    ASSERT_EQ(largeContainerSize, nBitValuesContainer.size());
+    ASSERT_EQ(4, nBitValuesContainer.count());
+    ASSERT_TRUE(nBitValuesContainer.set(largeContainerSize - 1));
+    ASSERT_EQ(5, nBitValuesContainer.count());
+
+    nBitValuesContainer.resize(initialContainerSize);
+    ASSERT_EQ("10111", nBitValuesContainer.stringify());
+    ASSERT_EQ(NBitValuesContainer(initialContainerSize, initializationInteger), nBitValuesContainer);
+
+    // Previously set bits outside of the range [0, size()) must not reappear after a resize
+    nBitValuesContainer.resize(largeContainerSize);
+    ASSERT_EQ(4, nBitValuesContainer.count());
+    ASSERT_FALSE(nBitValuesContainer[largeContainerSize - 1]);
+}
+
+TEST(NBitValuesContainerTests, ShrinkContainerClearsTruncatedBits) {
+    constexpr std::size_t   containerSize         = 8;
+    constexpr std::uint64_t initializationInteger = 255;
+    NBitValuesContainer     nBitValuesContainer(containerSize, initializationInteger);
+
+    nBitValuesContainer.resize(3);
+    ASSERT_EQ(3, nBitValuesContainer.count());
+    nBitValuesContainer.resize(containerSize);
+    ASSERT_EQ("11100000", nBitValuesContainer.stringify());
+}
+
+TEST(NBitValuesContainerTests, CountSetBits) {
+    ASSERT_EQ(0, NBitValuesContainer().count());
+    ASSERT_EQ(0, NBitValuesContainer(200).count());
+
+    NBitValuesContainer nBitValuesContainer(200, 0xFFFF);
+    ASSERT_EQ(16, nBitValuesContainer.count());
+    ASSERT_TRUE(nBitValuesContainer.set(150));
+    ASSERT_EQ(17, nBitValuesContainer.count());
+}
+
+TEST(NBitValuesContainerTests, BitwiseOperationsOfContainersOfSameSize) {
+    constexpr std::size_t     containerSize = 4;
+    const NBitValuesContainer lOperand(containerSize, 12); // 0011
+    const NBitValuesContainer rOperand(containerSize, 10); // 0101
+
+    ASSERT_EQ("0001", (lOperand & rOperand).stringify());
+    ASSERT_EQ("0111", (lOperand | rOperand).stringify());
+    ASSERT_EQ("0110", (lOperand ^ rOperand).stringify());
+
+    NBitValuesContainer inplaceResult = lOperand;
+    ASSERT_TRUE(inplaceResult.applyBitwiseXor(rOperand));
+    ASSERT_EQ(lOperand ^ rOperand, inplaceResult);
+}
+
+TEST(NBitValuesContainerTests, BitwiseOperationsOfContainersOfDifferentSizeAreRejected) {
+    NBitValuesContainer       lOperand(4, 12);
+    const NBitValuesContainer rOperand(5, 10);
+
+    ASSERT_FALSE(lOperand.applyBitwiseAnd(rOperand));
+    ASSERT_FALSE(lOperand.applyBitwiseOr(rOperand));
+    ASSERT_FALSE(lOperand.applyBitwiseXor(rOperand));
+    ASSERT_EQ("0011", lOperand.stringify());
+    ASSERT_THROW(static_cast<void>(lOperand & rOperand), std::invalid_argument);
+}
+
+TEST(NBitValuesContainerTests, EqualityAndHashOfContainers) {
+    const NBitValuesContainer containerOne(70, 5);
+    NBitValuesContainer       containerTwo(70);
+    ASSERT_TRUE(containerTwo.set(0));
+    ASSERT_TRUE(containerTwo.set(2));
+
+    ASSERT_EQ(containerOne, containerTwo);
+    ASSERT_EQ(std::hash<NBitValuesContainer>()(containerOne), std::hash<NBitValuesContainer>()(containerTwo));
+    ASSERT_NE(containerOne, NBitValuesContainer(71, 5));
+
+    ASSERT_TRUE(containerTwo.flip(69));
+    ASSERT_NE(containerOne, containerTwo);
+}
+
+TEST(NBitValuesContainerTests, UncheckedAccessors) {
+    NBitValuesContainer nBitValuesContainer(130);
+    nBitValuesContainer.setUnchecked(129, true);
+    ASSERT_TRUE(nBitValuesContainer.testUnchecked(129));
+    nBitValuesContainer.flipUnchecked(64);
+    ASSERT_TRUE(nBitValuesContainer.testUnchecked(64));
+    nBitValuesContainer.setUnchecked(129, false);
+    ASSERT_FALSE(nBitValuesContainer.testUnchecked(129));
+    ASSERT_EQ(1, nBitValuesContainer.count());
+}
+
+TEST(NBitValuesContainerTests, ConversionFromAndToBytes) {
+    const std::vector<std::uint8_t> bytes = {0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF};
+    const NBitValuesContainer       nBitValuesContainer = NBitValuesContainer::fromBytes(76, bytes);
+    ASSERT_EQ(76, nBitValuesContainer.size());
+    ASSERT_EQ(6, nBitValuesContainer.count());
+    ASSERT_TRUE(nBitValuesContainer.testUnchecked(0));
+    ASSERT_TRUE(nBitValuesContainer.testUnchecked(71));
+    ASSERT_TRUE(nBitValuesContainer.testUnchecked(72));
+    ASSERT_TRUE(nBitValuesContainer.testUnchecked(75));
+
+    // The bits of the last byte outside of the range of the container are ignored
+    ASSERT_EQ(10, nBitValuesContainer.getNumBytesOfByteRepresentation());
+    std::vector<std::uint8_t> exportedBytes(nBitValuesContainer.getNumBytesOfByteRepresentation(), 0xAA);
+    nBitValuesContainer.exportBytes(exportedBytes);
+    ASSERT_EQ(0x0F, exportedBytes.back());
+    ASSERT_EQ(nBitValuesContainer, NBitValuesContainer::fromBytes(76, exportedBytes));
+
+    // Missing bytes are assumed to be zero
+    ASSERT_EQ(NBitValuesContainer(130, 0x0201), NBitValuesContainer::fromBytes(130, std::vector<std::uint8_t>({0x01, 0x02})));
+}
+
+TEST(NBitValuesContainerTests, ConversionFromAndToBitValues) {
+    const std::vector<std::uint8_t> bitValues = {1, 0, 2, 0, 0, 1};
+    const NBitValuesContainer       nBitValuesContainer = NBitValuesContainer::fromBitValues(bitValues);
+    ASSERT_EQ("101001", nBitValuesContainer.stringify());
+
+    std::vector<std::uint8_t> exportedBitValues(nBitValuesContainer.size(), 0xFF);
+    nBitValuesContainer.exportBitValues(exportedBitValues);
+    ASSERT_EQ(std::vector<std::uint8_t>({1, 0, 1, 0, 0, 1}), exportedBitValues);
+}
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/optimization/optimization_pass_manager.hpp"
+#include "algorithms/simulation/equivalence_checking.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/statistics.hpp"
+#include "core/syrec/program.hpp"
+#include "ir/Definitions.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    constexpr auto PATH_TO_SYREC_CIRCUITS = "./circuits";
+
+    class OptimizationPassManagerTestFixture: public testing::Test {
+    protected:
+        AnnotatableQuantumComputation annotatableQuantumComputation;
+        OptimizationPassManager       passManager;
+
+        // Creates the quantum register of the variable 'a(2)' storing the qubits 0 and 1 and the ancillary qubit 2 followed by the quantum operations X(0) CX(0, 2) CX(0, 2) X(0) CX(1, 2) whose first four quantum operations cancel each other out.
+        void SetUp() override {
+            ASSERT_EQ(std::make_optional<qc::Qubit>(0U), annotatableQuantumComputation.addQuantumRegisterForSyrecVariable("a", AnnotatableQuantumComputation::AssociatedVariableLayoutInformation({.numValuesPerDimension = {1U}, .bitwidth = 2U}), false));
+            ASSERT_EQ(std::make_optional<qc::Qubit>(2U), annotatableQuantumComputation.addPreliminaryAncillaryRegisterOrAppendToAdjacentOne("anc", {false}, AnnotatableQuantumComputation::InlinedQubitInformation{}));
+            annotatableQuantumComputation.promotePreliminaryAncillaryQubitsToDefinitiveAncillaryQubits();
+
+            ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingNotGate(0U));
+            ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingCnotGate(0U, 2U));
+            ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingCnotGate(0U, 2U));
+            ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingNotGate(0U));
+            ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingCnotGate(1U, 2U));
+        }
+    };
+} // namespace
+
+TEST_F(OptimizationPassManagerTestFixture, DefaultPassesAreRegistered) {
+    ASSERT_TRUE(passManager.isPassRegistered(OptimizationPassManager::PROPAGATE_CONSTANT_QUBIT_VALUES_PASS));
+    ASSERT_TRUE(passManager.isPassRegistered(OptimizationPassManager::APPLY_REVERSIBLE_CIRCUIT_TEMPLATES_PASS));
+    ASSERT_TRUE(passManager.isPassRegistered(OptimizationPassManager::CANCEL_ADJACENT_SELF_INVERSE_QUANTUM_OPERATIONS_PASS));
+    ASSERT_TRUE(passManager.isPassRegistered(OptimizationPassManager::REORDER_QUANTUM_OPERATIONS_TO_REDUCE_DEPTH_PASS));
+    ASSERT_TRUE(passManager.isPassRegistered(OptimizationPassManager::RECYCLE_ANCILLARY_QUBITS_PASS));
+    ASSERT_EQ(5U, passManager.getIdentifiersOfRegisteredPasses().size());
+    ASSERT_TRUE(passManager.getPipeline().empty());
+}
+
+TEST_F(OptimizationPassManagerTestFixture, PassWithAlreadyRegisteredIdentifierIsNotRegistered) {
+    ASSERT_FALSE(passManager.registerPass(std::string(OptimizationPassManager::RECYCLE_ANCILLARY_QUBITS_PASS), [](AnnotatableQuantumComputation&) { return 0U; }));
+    ASSERT_FALSE(passManager.registerPass("empty", nullptr));
+    ASSERT_TRUE(passManager.registerPass("noop", [](AnnotatableQuantumComputation&) { return 0U; }));
+    ASSERT_TRUE(passManager.isPassRegistered("noop"));
+}
+
+TEST_F(OptimizationPassManagerTestFixture, PipelineWithNotRegisteredPassIsRejected) {
+    ASSERT_TRUE(passManager.setPipeline({std::string(OptimizationPassManager::CANCEL_ADJACENT_SELF_INVERSE_QUANTUM_OPERATIONS_PASS)}));
+    ASSERT_FALSE(passManager.setPipeline({std::string(OptimizationPassManager::REORDER_QUANTUM_OPERATIONS_TO_REDUCE_DEPTH_PASS), "notRegistered"}));
+    ASSERT_EQ(std::vector<std::string>({std::string(OptimizationPassManager::CANCEL_ADJACENT_SELF_INVERSE_QUANTUM_OPERATIONS_PASS)}), passManager.getPipeline());
+}
+
+TEST_F(OptimizationPassManagerTestFixture, StatisticsOfPassesAreRecorded) {
+    const std::string cancellationPass(OptimizationPassManager::CANCEL_ADJACENT_SELF_INVERSE_QUANTUM_OPERATIONS_PASS);
+    const std::string recyclingPass(OptimizationPassManager::RECYCLE_ANCILLARY_QUBITS_PASS);
+    ASSERT_TRUE(passManager.setPipeline({cancellationPass, recyclingPass}));
+
+    Statistics statistics;
+    ASSERT_TRUE(passManager.run(annotatableQuantumComputation, &statistics));
+    ASSERT_EQ(1U, annotatableQuantumComputation.getNops());
+    ASSERT_EQ(1U, statistics.numIterationsOfOptimizationPipeline);
+    ASSERT_EQ(2U, statistics.statisticsPerOptimizationPass.size());
+
+    const OptimizationPassStatistics& statisticsOfCancellation = statistics.statisticsPerOptimizationPass.at(cancellationPass);
+    ASSERT_EQ(1U, statisticsOfCancellation.numApplications);
+    ASSERT_EQ(4U, statisticsOfCancellation.numModifications);
+    ASSERT_EQ(4, statisticsOfCancellation.numRemovedQuantumOperations);
+    ASSERT_EQ(0, statisticsOfCancellation.numRemovedQubits);
+
+    const OptimizationPassStatistics& statisticsOfRecycling = statistics.statisticsPerOptimizationPass.at(recyclingPass);
+    ASSERT_EQ(1U, statisticsOfRecycling.numApplications);
+    ASSERT_EQ(0, statisticsOfRecycling.numRemovedQuantumOperations);
+}
+
+TEST_F(OptimizationPassManagerTestFixture, PipelineIsRepeatedUntilFixedPointIsReached) {
+    // Removes the two quantum operations following the first one per application
+    ASSERT_TRUE(passManager.registerPass("removeSingleCancellablePair", [](AnnotatableQuantumComputation& quantumComputation) {
+        if (quantumComputation.getNops() <= 1U) {
+            return 0U;
+        }
+        quantumComputation.erase(quantumComputation.begin() + 1, quantumComputation.begin() + 3);
+        return 2U;
+    }));
+    ASSERT_TRUE(passManager.setPipeline({"removeSingleCancellablePair"}));
+
+    passManager.setMaxNumIterations(1U);
+    Statistics statistics;
+    ASSERT_TRUE(passManager.run(annotatableQuantumComputation, &statistics));
+    ASSERT_EQ(3U, annotatableQuantumComputation.getNops());
+    ASSERT_EQ(1U, statistics.numIterationsOfOptimizationPipeline);
+
+    passManager.setMaxNumIterations(10U);
+    ASSERT_TRUE(passManager.run(annotatableQuantumComputation, &statistics));
+    ASSERT_EQ(1U, annotatableQuantumComputation.getNops());
+    // The last iteration did not modify the quantum computation
+    ASSERT_EQ(2U, statistics.numIterationsOfOptimizationPipeline);
+    ASSERT_EQ(2U, statistics.statisticsPerOptimizationPass.at("removeSingleCancellablePair").numApplications);
+}
+
+TEST_F(OptimizationPassManagerTestFixture, PassNotPreservingFunctionFailsVerification) {
+    ASSERT_TRUE(passManager.registerPass("removeLastQuantumOperation", [](AnnotatableQuantumComputation& quantumComputation) {
+        quantumComputation.erase(quantumComputation.end() - 1);
+        return 1U;
+    }));
+    ASSERT_TRUE(passManager.setPipeline({std::string(OptimizationPassManager::CANCEL_ADJACENT_SELF_INVERSE_QUANTUM_OPERATIONS_PASS), "removeLastQuantumOperation"}));
+
+    ASSERT_TRUE(passManager.run(annotatableQuantumComputation));
+    ASSERT_EQ(0U, annotatableQuantumComputation.getNops());
+
+    ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingCnotGate(1U, 2U));
+    passManager.setVerificationOfPasses(true, EquivalenceCheckingSettings());
+    ASSERT_FALSE(passManager.run(annotatableQuantumComputation));
+}
+
+TEST(OptimizationPipelineOfSynthesisTests, PipelineMatchesOptimizationsEnabledByFlags) {
+    Program program;
+    ASSERT_EQ("", program.read(PATH_TO_SYREC_CIRCUITS + std::string("/alu_2.src")));
+
+    ConfigurableOptions settingsWithFlags;
+    settingsWithFlags.cancelAdjacentSelfInverseQuantumOperations = true;
+    settingsWithFlags.reorderQuantumOperationsToReduceDepth      = true;
+    AnnotatableQuantumComputation expectedQuantumComputation;
+    Statistics                    expectedStatistics;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(expectedQuantumComputation, program, settingsWithFlags, &expectedStatistics));
+
+    ConfigurableOptions settingsWithPipeline;
+    settingsWithPipeline.optimizationPipeline               = {std::string(OptimizationPassManager::CANCEL_ADJACENT_SELF_INVERSE_QUANTUM_OPERATIONS_PASS), std::string(OptimizationPassManager::REORDER_QUANTUM_OPERATIONS_TO_REDUCE_DEPTH_PASS)};
+    settingsWithPipeline.verifyPassesOfOptimizationPipeline = true;
+    AnnotatableQuantumComputation actualQuantumComputation;
+    Statistics                    actualStatistics;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(actualQuantumComputation, program, settingsWithPipeline, &actualStatistics));
+
+    ASSERT_EQ(expectedQuantumComputation.getNops(), actualQuantumComputation.getNops());
+    ASSERT_EQ(expectedStatistics.depth, actualStatistics.depth);
+    ASSERT_EQ(expectedStatistics.numCancelledQuantumOperations, actualStatistics.numCancelledQuantumOperations);
+    ASSERT_EQ(1U, actualStatistics.numIterationsOfOptimizationPipeline);
+    ASSERT_EQ(2U, actualStatistics.statisticsPerOptimizationPass.size());
+    ASSERT_TRUE(expectedStatistics.statisticsPerOptimizationPass.empty());
+}
+
+TEST(OptimizationPipelineOfSynthesisTests, SynthesisWithNotRegisteredPassFails) {
+    Program program;
+    ASSERT_EQ("", program.read(PATH_TO_SYREC_CIRCUITS + std::string("/alu_2.src")));
+
+    ConfigurableOptions settings;
+    settings.optimizationPipeline = {"notRegistered"};
+    AnnotatableQuantumComputation annotatableQuantumComputation;
+    ASSERT_FALSE(CostAwareSynthesis::synthesize(annotatableQuantumComputation, program, settings));
+}
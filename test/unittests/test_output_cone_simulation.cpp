@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/output_cone_simulation.hpp"
+#include "algorithms/simulation/simple_simulation.hpp"
+#include "algorithms/simulation/simulation_program.hpp"
+#include "core/n_bit_values_container.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    // The qubits [0, 2] and [3, 5] form two independent halves that are only connected by the final SWAP gate of qubit 2 and 3.
+    auto createQuantumComputationWithIndependentHalves() -> qc::QuantumComputation {
+        qc::QuantumComputation quantumComputation(6);
+        quantumComputation.cx(0, 1);
+        quantumComputation.mcx(qc::Controls({0, 1}), 2);
+        quantumComputation.cx(3, 4);
+        quantumComputation.mcx(qc::Controls({qc::Control(3), qc::Control(4, qc::Control::Type::Neg)}), 5);
+        quantumComputation.x(5);
+        quantumComputation.cx(2, 0);
+        quantumComputation.swap(2, 3);
+        return quantumComputation;
+    }
+
+    void assertOutputConeSimulationMatchesSimpleSimulationForAllInputStates(const qc::QuantumComputation& quantumComputation, const std::vector<qc::Qubit>& outputQubits) {
+        std::vector<NBitValuesContainer> inputStates;
+        for (std::uint64_t inputStateValue = 0; inputStateValue < (static_cast<std::uint64_t>(1) << quantumComputation.getNqubits()); ++inputStateValue) {
+            inputStates.emplace_back(quantumComputation.getNqubits(), inputStateValue);
+        }
+
+        OutputConeSimulationProgramCache cache;
+        std::vector<NBitValuesContainer> batchOutputStates;
+        ASSERT_NO_FATAL_FAILURE(outputConeBatchSimulation(batchOutputStates, quantumComputation, inputStates, outputQubits, &cache));
+        ASSERT_EQ(inputStates.size(), batchOutputStates.size());
+
+        for (std::size_t i = 0; i < inputStates.size(); ++i) {
+            NBitValuesContainer expectedOutputState;
+            ASSERT_NO_FATAL_FAILURE(simpleSimulation(expectedOutputState, quantumComputation, inputStates[i]));
+
+            NBitValuesContainer actualOutputState;
+            ASSERT_NO_FATAL_FAILURE(outputConeSimulation(actualOutputState, quantumComputation, inputStates[i], outputQubits, &cache));
+            for (const qc::Qubit outputQubit: outputQubits) {
+                ASSERT_EQ(expectedOutputState[outputQubit], actualOutputState[outputQubit]) << "Value of output qubit " << outputQubit << " mismatch for input state " << inputStates[i].stringify();
+                ASSERT_EQ(expectedOutputState[outputQubit], batchOutputStates[i][outputQubit]) << "Batch value of output qubit " << outputQubit << " mismatch for input state " << inputStates[i].stringify();
+            }
+        }
+        ASSERT_EQ(1U, cache.getNumCachedPrograms());
+        ASSERT_EQ(1U, cache.getNumCacheMisses());
+        ASSERT_EQ(inputStates.size(), cache.getNumCacheHits());
+    }
+} // namespace
+
+TEST(OutputConeSimulationTests, ConeOfOutputQubitOnlyContainsInfluencingGates) {
+    const auto quantumComputation = createQuantumComputationWithIndependentHalves();
+
+    const std::vector<qc::Qubit> outputQubitsOfFirstHalf = {1};
+    const auto                   coneOfFirstHalf         = SimulationProgram::compileOutputCone(quantumComputation, outputQubitsOfFirstHalf);
+    ASSERT_TRUE(coneOfFirstHalf.has_value());
+    ASSERT_EQ(quantumComputation.getNqubits(), coneOfFirstHalf->getNumQubits());
+    ASSERT_EQ(1U, coneOfFirstHalf->getNumGates());
+
+    const std::vector<qc::Qubit> outputQubitsOfSecondHalf = {4, 5};
+    const auto                   coneOfSecondHalf         = SimulationProgram::compileOutputCone(quantumComputation, outputQubitsOfSecondHalf);
+    ASSERT_TRUE(coneOfSecondHalf.has_value());
+    ASSERT_EQ(3U, coneOfSecondHalf->getNumGates());
+
+    // Qubit 0 depends on qubit 2 prior to the SWAP gate which in turn depends on the qubits [0, 1] while the SWAP gate itself does not modify qubit 0.
+    const std::vector<qc::Qubit> outputQubitsOfCnotAfterFirstHalf = {0};
+    const auto                   coneOfCnotAfterFirstHalf         = SimulationProgram::compileOutputCone(quantumComputation, outputQubitsOfCnotAfterFirstHalf);
+    ASSERT_TRUE(coneOfCnotAfterFirstHalf.has_value());
+    ASSERT_EQ(3U, coneOfCnotAfterFirstHalf->getNumGates());
+}
+
+TEST(OutputConeSimulationTests, SwapGateAddsBothTargetQubitsToCone) {
+    const auto                   quantumComputation = createQuantumComputationWithIndependentHalves();
+    const std::vector<qc::Qubit> outputQubits       = {3};
+    const auto                   cone               = SimulationProgram::compileOutputCone(quantumComputation, outputQubits);
+    ASSERT_TRUE(cone.has_value());
+    // The value of qubit 3 after the SWAP gate is the one of qubit 2 prior to it, thus the gates of the first half computing qubit 2 are part of the cone while no gate of the second half modifies qubit 3.
+    ASSERT_EQ(3U, cone->getNumGates());
+}
+
+TEST(OutputConeSimulationTests, SimulationOfConeMatchesSimpleSimulation) {
+    const auto quantumComputation = createQuantumComputationWithIndependentHalves();
+    ASSERT_NO_FATAL_FAILURE(assertOutputConeSimulationMatchesSimpleSimulationForAllInputStates(quantumComputation, {1}));
+    ASSERT_NO_FATAL_FAILURE(assertOutputConeSimulationMatchesSimpleSimulationForAllInputStates(quantumComputation, {0}));
+    ASSERT_NO_FATAL_FAILURE(assertOutputConeSimulationMatchesSimpleSimulationForAllInputStates(quantumComputation, {3, 5}));
+    ASSERT_NO_FATAL_FAILURE(assertOutputConeSimulationMatchesSimpleSimulationForAllInputStates(quantumComputation, {0, 1, 2, 3, 4, 5}));
+}
+
+TEST(OutputConeSimulationTests, CachedProgramIsSharedBySameSetOfOutputQubits) {
+    const auto                       quantumComputation = createQuantumComputationWithIndependentHalves();
+    OutputConeSimulationProgramCache cache;
+
+    const std::vector<qc::Qubit> outputQubits                = {5, 4};
+    const std::vector<qc::Qubit> permutedOutputQubits        = {4, 5, 4};
+    const std::vector<qc::Qubit> otherOutputQubits           = {4};
+    const auto                   simulationProgram           = cache.getOrCompile(quantumComputation, outputQubits);
+    const auto                   simulationProgramOfPermuted = cache.getOrCompile(quantumComputation, permutedOutputQubits);
+    ASSERT_NE(nullptr, simulationProgram);
+    ASSERT_EQ(simulationProgram, simulationProgramOfPermuted);
+    ASSERT_EQ(1U, cache.getNumCacheHits());
+
+    ASSERT_NE(simulationProgram, cache.getOrCompile(quantumComputation, otherOutputQubits));
+    ASSERT_EQ(2U, cache.getNumCachedPrograms());
+    ASSERT_EQ(2U, cache.getNumCacheMisses());
+
+    // Appending an operation to the quantum computation invalidates its cached programs.
+    auto extendedQuantumComputation = createQuantumComputationWithIndependentHalves();
+    ASSERT_NE(nullptr, cache.getOrCompile(extendedQuantumComputation, outputQubits));
+    extendedQuantumComputation.cx(1, 4);
+    const auto simulationProgramOfExtended = cache.getOrCompile(extendedQuantumComputation, outputQubits);
+    ASSERT_NE(nullptr, simulationProgramOfExtended);
+    ASSERT_EQ(5U, simulationProgramOfExtended->getNumGates());
+    ASSERT_EQ(4U, cache.getNumCacheMisses());
+
+    cache.clear();
+    ASSERT_EQ(0U, cache.getNumCachedPrograms());
+}
+
+TEST(OutputConeSimulationTests, OutputQubitOutOfRangeIsNotSimulated) {
+    const auto                   quantumComputation = createQuantumComputationWithIndependentHalves();
+    const std::vector<qc::Qubit> outputQubits       = {6};
+    ASSERT_FALSE(SimulationProgram::compileOutputCone(quantumComputation, outputQubits).has_value());
+
+    OutputConeSimulationProgramCache cache;
+    std::vector<NBitValuesContainer> outputStates;
+    ASSERT_NO_FATAL_FAILURE(outputConeBatchSimulation(outputStates, quantumComputation, {NBitValuesContainer(6, 0)}, outputQubits, &cache));
+    ASSERT_TRUE(outputStates.empty());
+    ASSERT_EQ(0U, cache.getNumCachedPrograms());
+}
@@ -11,7 +11,9 @@
 #include "core/io/pla_parser.hpp"
 #include "core/truthTable/truth_table.hpp"
 
+#include <cstddef>
 #include <gtest/gtest.h>
+#include <stdexcept>
 #include <string>
 
 using namespace syrec;
@@ -77,3 +79,102 @@ TEST_F(PlaParserTest, orTest) {
     EXPECT_TRUE(it1 != testPla.end());
     EXPECT_TRUE(it1->second.equals(0b1U, 1U));
 }
+
+TEST_F(PlaParserTest, parseFromBuffer) {
+    const std::string plaContent = "# comment\n.i 2\n.o 1\n.ilb a b\n.ob f\n.p 2\n  1-\t 1\r\n01 0\n.e\n";
+
+    EXPECT_TRUE(parsePla(testPla, plaContent));
+
+    EXPECT_EQ(testPla.nInputs(), 2U);
+    EXPECT_EQ(testPla.nOutputs(), 1U);
+    EXPECT_EQ(testPla.size(), 2U);
+
+    auto itOneDc = testPla.find(cOneDc);
+
+    EXPECT_TRUE(itOneDc != testPla.end());
+    EXPECT_TRUE(itOneDc->second.equals(0b1U, 1U));
+
+    auto it01 = testPla.find("01");
+
+    EXPECT_TRUE(it01 != testPla.end());
+    EXPECT_TRUE(it01->second.equals(0b0U, 1U));
+}
+
+TEST_F(PlaParserTest, parseFromBufferWithInvalidNumberOfColumns) {
+    EXPECT_THROW(parsePla(testPla, std::string(".i 2\n.o 1\n11 1 0\n")), std::invalid_argument);
+    EXPECT_THROW(parsePla(testPla, std::string(".i 2\n.o 1\n111 1\n")), std::invalid_argument);
+}
+
+TEST_F(PlaParserTest, progressReportAndCancellation) {
+    const std::string circAnd = testCircuitsDir + "and.pla";
+
+    std::size_t reportedTotalBytes = 0U;
+    EXPECT_TRUE(readPla(testPla, circAnd, [&reportedTotalBytes](const std::size_t processedBytes, const std::size_t totalBytes) {
+        EXPECT_LE(processedBytes, totalBytes);
+        reportedTotalBytes = totalBytes;
+        return true;
+    }));
+    EXPECT_NE(reportedTotalBytes, 0U);
+    EXPECT_EQ(testPla.size(), 4U);
+
+    TruthTable cancelledPla;
+    EXPECT_FALSE(readPla(cancelledPla, circAnd, [](std::size_t, std::size_t) { return false; }));
+    EXPECT_TRUE(cancelledPla.empty());
+}
+
+namespace {
+    // a PLA whose body spans multiple chunks of the parallel parser, with every input being defined by multiple lines with different outputs
+    std::string createPlaWithDuplicatedInputs(const std::size_t numLines, const std::string& linesAfterBody = "") {
+        std::string content = "# duplicated inputs\n.i 10\n.o 3\n.p " + std::to_string(numLines) + "\n";
+        for (std::size_t i = 0U; i < numLines; ++i) {
+            const auto input = (i * 7919U) % 1024U;
+            for (std::size_t bit = 10U; bit-- > 0U;) {
+                if (bit == 4U && i % 5U == 0U) {
+                    content += '-';
+                } else {
+                    content += ((input >> bit) & 1U) != 0U ? '1' : '0';
+                }
+            }
+            content += ' ';
+            for (std::size_t bit = 3U; bit-- > 0U;) {
+                content += ((i >> bit) & 1U) != 0U ? '1' : '0';
+            }
+            content += i % 100U == 0U ? "\n\n# comment\n" : "\n";
+        }
+        return content + linesAfterBody;
+    }
+} // namespace
+
+TEST_F(PlaParserTest, parallelParsingMatchesSequentialParsing) {
+    const auto plaContent = createPlaWithDuplicatedInputs(40000U);
+    TruthTable expectedTruthTable;
+    EXPECT_TRUE(parsePla(expectedTruthTable, plaContent));
+    EXPECT_TRUE(parsePlaInParallel(testPla, plaContent, 4U));
+    EXPECT_EQ(expectedTruthTable.size(), testPla.size());
+    EXPECT_TRUE(expectedTruthTable == testPla);
+}
+
+TEST_F(PlaParserTest, parallelParsingIgnoresLinesAfterEndOfPla) {
+    // the invalid line after the end of the PLA is not reported
+    const auto plaContent = createPlaWithDuplicatedInputs(20000U, ".e\n11 1\n") + createPlaWithDuplicatedInputs(20000U);
+    TruthTable expectedTruthTable;
+    EXPECT_TRUE(parsePla(expectedTruthTable, plaContent));
+    EXPECT_TRUE(parsePlaInParallel(testPla, plaContent, 4U));
+    EXPECT_TRUE(expectedTruthTable == testPla);
+
+    EXPECT_THROW(parsePlaInParallel(testPla, createPlaWithDuplicatedInputs(40000U, "11 1\n"), 4U), std::invalid_argument);
+}
+
+TEST_F(PlaParserTest, parallelParsingOfRedeclaredNumberOfInputsMatchesSequentialParsing) {
+    const auto plaContent = createPlaWithDuplicatedInputs(40000U, ".i 10\n0000000000 111\n");
+    TruthTable expectedTruthTable;
+    EXPECT_TRUE(parsePla(expectedTruthTable, plaContent));
+    EXPECT_TRUE(parsePlaInParallel(testPla, plaContent, 4U));
+    EXPECT_TRUE(expectedTruthTable == testPla);
+}
+
+TEST_F(PlaParserTest, cancelledParallelParsingAddsNoEntries) {
+    const auto plaContent = createPlaWithDuplicatedInputs(200000U);
+    EXPECT_FALSE(parsePlaInParallel(testPla, plaContent, 4U, [](const std::size_t processedBytes, const std::size_t) { return processedBytes < (static_cast<std::size_t>(1U) << 20U); }));
+    EXPECT_TRUE(testPla.empty());
+}
@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/program_interpreter.hpp"
+#include "core/configurable_options.hpp"
+#include "core/diagnostics.hpp"
+#include "core/statistics.hpp"
+#include "core/syrec/expression.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/number.hpp"
+#include "core/syrec/parser/utils/syrec_operation_utils.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+#include "syrec_ir_builder.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+using namespace syrec_ir_builder;
+
+namespace {
+    class ProgramInterpreterTestsFixture: public testing::Test {
+    protected:
+        Program       program;
+        Module::ptr   mainModule = std::make_shared<Module>("main");
+        Variable::ptr a          = std::make_shared<Variable>(Variable::Type::Inout, "a", std::vector<unsigned>({1U}), 4U);
+        Variable::ptr b          = std::make_shared<Variable>(Variable::Type::Inout, "b", std::vector<unsigned>({1U}), 4U);
+
+        void SetUp() override {
+            mainModule->addParameter(a);
+            mainModule->addParameter(b);
+        }
+
+        [[nodiscard]] std::optional<std::vector<std::uint64_t>> interpretMainModule(const std::vector<std::uint64_t>& initialAssignment, const ConfigurableOptions& settings = ConfigurableOptions()) {
+            if (program.modules().empty()) {
+                program.addModule(mainModule);
+            }
+            std::optional<ProgramInterpreter> interpreter = ProgramInterpreter::create(program, settings);
+            if (!interpreter.has_value()) {
+                return std::nullopt;
+            }
+
+            std::vector<std::uint64_t> assignment = initialAssignment;
+            return interpreter->execute(assignment) ? std::make_optional(assignment) : std::nullopt;
+        }
+    };
+} // namespace
+
+TEST_F(ProgramInterpreterTestsFixture, AssignmentsAreComputedModuloBitwidthOfOperands) {
+    // a += b; ++b; a <=> b; a -= 15
+    mainModule->addStatement(createAssignment(a, AssignStatement::AssignOperation::Add, createVariableExpression(b)));
+    mainModule->addStatement(std::make_shared<UnaryStatement>(UnaryStatement::UnaryOperation::Increment, createVariableAccess(b)));
+    mainModule->addStatement(std::make_shared<SwapStatement>(createVariableAccess(a), createVariableAccess(b)));
+    mainModule->addStatement(createAssignment(a, AssignStatement::AssignOperation::Subtract, createNumericExpression(15U)));
+
+    const std::optional<std::vector<std::uint64_t>> assignment = interpretMainModule({9U, 15U});
+    ASSERT_TRUE(assignment.has_value());
+    ASSERT_EQ(std::vector<std::uint64_t>({1U, 8U}), *assignment);
+}
+
+TEST_F(ProgramInterpreterTestsFixture, IntegerConstantsAreTruncatedToBitwidthOfOtherOperand) {
+    // a ^= 18; b ^= (20 - 3)
+    mainModule->addStatement(createAssignment(a, AssignStatement::AssignOperation::Exor, createNumericExpression(18U)));
+    mainModule->addStatement(createAssignment(b, AssignStatement::AssignOperation::Exor, std::make_shared<BinaryExpression>(createNumericExpression(20U), BinaryExpression::BinaryOperation::Subtract, createNumericExpression(3U))));
+
+    const std::optional<std::vector<std::uint64_t>> assignmentUsingBitwiseAndTruncation = interpretMainModule({0U, 0U});
+    ASSERT_TRUE(assignmentUsingBitwiseAndTruncation.has_value());
+    ASSERT_EQ(std::vector<std::uint64_t>({2U, 1U}), *assignmentUsingBitwiseAndTruncation);
+
+    ConfigurableOptions settings;
+    settings.integerConstantTruncationOperation = utils::IntegerConstantTruncationOperation::Modulo;
+
+    const std::optional<std::vector<std::uint64_t>> assignmentUsingModuloTruncation = interpretMainModule({0U, 0U}, settings);
+    ASSERT_TRUE(assignmentUsingModuloTruncation.has_value());
+    ASSERT_EQ(std::vector<std::uint64_t>({3U, 2U}), *assignmentUsingModuloTruncation);
+}
+
+TEST_F(ProgramInterpreterTestsFixture, DivisionByZeroMatchesRestoringDivision) {
+    const auto quotient   = std::make_shared<Variable>(Variable::Type::Wire, "q", std::vector<unsigned>({1U}), 4U);
+    const auto remainder  = std::make_shared<Variable>(Variable::Type::Wire, "r", std::vector<unsigned>({1U}), 4U);
+    mainModule->variables = {quotient, remainder};
+    mainModule->addStatement(createAssignment(quotient, AssignStatement::AssignOperation::Exor, std::make_shared<BinaryExpression>(createVariableExpression(a), BinaryExpression::BinaryOperation::Divide, createVariableExpression(b))));
+    mainModule->addStatement(createAssignment(remainder, AssignStatement::AssignOperation::Exor, std::make_shared<BinaryExpression>(createVariableExpression(a), BinaryExpression::BinaryOperation::Modulo, createVariableExpression(b))));
+
+    const std::optional<std::vector<std::uint64_t>> assignmentOfNonZeroDivisor = interpretMainModule({11U, 3U, 0U, 0U});
+    ASSERT_TRUE(assignmentOfNonZeroDivisor.has_value());
+    ASSERT_EQ(std::vector<std::uint64_t>({11U, 3U, 3U, 2U}), *assignmentOfNonZeroDivisor);
+
+    const std::optional<std::vector<std::uint64_t>> assignmentOfZeroDivisor = interpretMainModule({11U, 0U, 0U, 0U});
+    ASSERT_TRUE(assignmentOfZeroDivisor.has_value());
+    ASSERT_EQ(std::vector<std::uint64_t>({11U, 0U, 15U, 11U}), *assignmentOfZeroDivisor);
+}
+
+TEST_F(ProgramInterpreterTestsFixture, LoopVariableCanBeUsedInBitrangeAccess) {
+    // for $i = 0 to 4 do a.$i ^= b.(3 - $i) rof; for $j = 3 to 0 step 2 do ++b rof
+    const auto loopVariable    = std::make_shared<Number>(std::string("i"));
+    const auto mirroredBit     = std::make_shared<Number>(Number::ConstantExpression(createNumber(3U), Number::ConstantExpression::Operation::Subtraction, loopVariable));
+    const auto reversalLoop    = std::make_shared<ForStatement>();
+    reversalLoop->loopVariable = "i";
+    reversalLoop->range        = std::make_pair(createNumber(0U), createNumber(4U));
+    reversalLoop->addStatement(std::make_shared<AssignStatement>(createVariableAccess(a, std::make_pair(loopVariable, loopVariable)), AssignStatement::AssignOperation::Exor, std::make_shared<VariableExpression>(createVariableAccess(b, std::make_pair(mirroredBit, mirroredBit)))));
+    mainModule->addStatement(reversalLoop);
+
+    const auto descendingLoop    = std::make_shared<ForStatement>();
+    descendingLoop->loopVariable = "j";
+    descendingLoop->range        = std::make_pair(createNumber(3U), createNumber(0U));
+    descendingLoop->step         = createNumber(2U);
+    descendingLoop->addStatement(std::make_shared<UnaryStatement>(UnaryStatement::UnaryOperation::Increment, createVariableAccess(b)));
+    mainModule->addStatement(descendingLoop);
+
+    const std::optional<std::vector<std::uint64_t>> assignment = interpretMainModule({0U, 1U});
+    ASSERT_TRUE(assignment.has_value());
+    ASSERT_EQ(std::vector<std::uint64_t>({8U, 3U}), *assignment);
+}
+
+TEST_F(ProgramInterpreterTestsFixture, DescendingBitrangeReversesAccessedBits) {
+    // a.3:0 ^= b
+    mainModule->addStatement(std::make_shared<AssignStatement>(createVariableAccess(a, std::make_pair(createNumber(3U), createNumber(0U))), AssignStatement::AssignOperation::Exor, createVariableExpression(b)));
+
+    const std::optional<std::vector<std::uint64_t>> assignment = interpretMainModule({0U, 3U});
+    ASSERT_TRUE(assignment.has_value());
+    ASSERT_EQ(std::vector<std::uint64_t>({12U, 3U}), *assignment);
+}
+
+TEST_F(ProgramInterpreterTestsFixture, FiConditionNotMatchingGuardConditionIsReported) {
+    // if (a = 0) then ++a else skip fi (a = 0)
+    const auto ifStatement  = std::make_shared<IfStatement>();
+    ifStatement->lineNumber = 3U;
+    ifStatement->setCondition(std::make_shared<BinaryExpression>(createVariableExpression(a), BinaryExpression::BinaryOperation::Equals, createNumericExpression(0U)));
+    ifStatement->addThenStatement(std::make_shared<UnaryStatement>(UnaryStatement::UnaryOperation::Increment, createVariableAccess(a)));
+    ifStatement->addElseStatement(std::make_shared<SkipStatement>());
+    ifStatement->setFiCondition(std::make_shared<BinaryExpression>(createVariableExpression(a), BinaryExpression::BinaryOperation::Equals, createNumericExpression(0U)));
+    mainModule->addStatement(ifStatement);
+
+    const std::optional<std::vector<std::uint64_t>> assignmentOfElseBranch = interpretMainModule({5U, 0U});
+    ASSERT_TRUE(assignmentOfElseBranch.has_value());
+    ASSERT_EQ(std::vector<std::uint64_t>({5U, 0U}), *assignmentOfElseBranch);
+
+    Diagnostics diagnostics;
+    {
+        const ScopedDiagnosticsCollection diagnosticsCollection(diagnostics);
+        ASSERT_FALSE(interpretMainModule({0U, 0U}).has_value());
+    }
+    ASSERT_EQ(1U, diagnostics.getErrorMessages().size());
+    ASSERT_NE(std::string::npos, diagnostics.getErrorMessages().front().find("line 3"));
+}
+
+TEST_F(ProgramInterpreterTestsFixture, UncallExecutesInverseOfModule) {
+    // module addAndDouble(inout x(4), in y(4)) wire t(4) t ^= y; x += (t << 1); t ^= y
+    const auto x                  = std::make_shared<Variable>(Variable::Type::Inout, "x", std::vector<unsigned>({1U}), 4U);
+    const auto y                  = std::make_shared<Variable>(Variable::Type::In, "y", std::vector<unsigned>({1U}), 4U);
+    const auto t                  = std::make_shared<Variable>(Variable::Type::Wire, "t", std::vector<unsigned>({1U}), 4U);
+    const auto addAndDoubleModule = std::make_shared<Module>("addAndDouble");
+    addAndDoubleModule->addParameter(x);
+    addAndDoubleModule->addParameter(y);
+    addAndDoubleModule->variables = {t};
+    addAndDoubleModule->addStatement(createAssignment(t, AssignStatement::AssignOperation::Exor, createVariableExpression(y)));
+    addAndDoubleModule->addStatement(createAssignment(x, AssignStatement::AssignOperation::Add, std::make_shared<ShiftExpression>(createVariableExpression(t), ShiftExpression::ShiftOperation::Left, createNumber(1U))));
+    addAndDoubleModule->addStatement(createAssignment(t, AssignStatement::AssignOperation::Exor, createVariableExpression(y)));
+    program.addModule(addAndDoubleModule);
+    program.addModule(mainModule);
+
+    // call addAndDouble(a, b); call addAndDouble(b, a); uncall addAndDouble(b, a)
+    mainModule->addStatement(std::make_shared<CallStatement>(addAndDoubleModule, std::vector<std::string>({"a", "b"})));
+    mainModule->addStatement(std::make_shared<CallStatement>(addAndDoubleModule, std::vector<std::string>({"b", "a"})));
+    const std::optional<std::vector<std::uint64_t>> assignmentAfterCalls = interpretMainModule({1U, 3U});
+    ASSERT_TRUE(assignmentAfterCalls.has_value());
+    ASSERT_EQ(std::vector<std::uint64_t>({7U, 1U}), *assignmentAfterCalls);
+
+    mainModule->addStatement(std::make_shared<UncallStatement>(addAndDoubleModule, std::vector<std::string>({"b", "a"})));
+    const std::optional<std::vector<std::uint64_t>> assignmentAfterUncall = interpretMainModule({1U, 3U});
+    ASSERT_TRUE(assignmentAfterUncall.has_value());
+    ASSERT_EQ(std::vector<std::uint64_t>({7U, 3U}), *assignmentAfterUncall);
+}
+
+TEST_F(ProgramInterpreterTestsFixture, AccessOnElementOutsideOfDimensionIsReported) {
+    // wire c[2](4) c[a] += 1
+    const auto c          = std::make_shared<Variable>(Variable::Type::Wire, "c", std::vector<unsigned>({2U}), 4U);
+    mainModule->variables = {c};
+    mainModule->addStatement(std::make_shared<AssignStatement>(createVariableAccess(c, createVariableExpression(a)), AssignStatement::AssignOperation::Add, createNumericExpression(1U)));
+
+    const std::optional<std::vector<std::uint64_t>> assignment = interpretMainModule({1U, 0U, 0U, 0U});
+    ASSERT_TRUE(assignment.has_value());
+    ASSERT_EQ(std::vector<std::uint64_t>({1U, 0U, 0U, 1U}), *assignment);
+
+    Diagnostics diagnostics;
+    {
+        const ScopedDiagnosticsCollection diagnosticsCollection(diagnostics);
+        ASSERT_FALSE(interpretMainModule({2U, 0U, 0U, 0U}).has_value());
+    }
+    ASSERT_TRUE(diagnostics.hasErrors());
+}
+
+TEST_F(ProgramInterpreterTestsFixture, ValuesOfAssignmentMustFitIntoBitwidthOfVariables) {
+    Diagnostics diagnostics;
+    {
+        const ScopedDiagnosticsCollection diagnosticsCollection(diagnostics);
+        ASSERT_FALSE(interpretMainModule({16U, 0U}).has_value());
+        ASSERT_FALSE(interpretMainModule({0U}).has_value());
+    }
+    ASSERT_EQ(2U, diagnostics.getErrorMessages().size());
+}
+
+TEST_F(ProgramInterpreterTestsFixture, BatchInterpretationDoesNotDependOnNumberOfThreads) {
+    // a += (a * b); b ^= (a > b)
+    mainModule->addStatement(createAssignment(a, AssignStatement::AssignOperation::Add, std::make_shared<BinaryExpression>(createVariableExpression(a), BinaryExpression::BinaryOperation::Multiply, createVariableExpression(b))));
+    mainModule->addStatement(std::make_shared<AssignStatement>(createVariableAccess(b, std::make_pair(createNumber(0U), createNumber(0U))), AssignStatement::AssignOperation::Exor, std::make_shared<BinaryExpression>(createVariableExpression(a), BinaryExpression::BinaryOperation::GreaterThan, createVariableExpression(b))));
+    program.addModule(mainModule);
+
+    std::vector<std::vector<std::uint64_t>> expectedAssignments;
+    for (std::uint64_t valueOfA = 0; valueOfA < 16U; ++valueOfA) {
+        for (std::uint64_t valueOfB = 0; valueOfB < 16U; ++valueOfB) {
+            const std::uint64_t updatedValueOfA = (valueOfA + valueOfA * valueOfB) % 16U;
+            expectedAssignments.emplace_back(std::vector<std::uint64_t>({updatedValueOfA, valueOfB ^ (updatedValueOfA > valueOfB ? 1U : 0U)}));
+        }
+    }
+
+    for (const std::size_t numThreads: {1U, 0U, 3U, 1000U}) {
+        std::vector<std::vector<std::uint64_t>> assignments;
+        for (std::uint64_t valueOfA = 0; valueOfA < 16U; ++valueOfA) {
+            for (std::uint64_t valueOfB = 0; valueOfB < 16U; ++valueOfB) {
+                assignments.emplace_back(std::vector<std::uint64_t>({valueOfA, valueOfB}));
+            }
+        }
+
+        Statistics statistics;
+        ASSERT_TRUE(interpretProgram(assignments, program, ConfigurableOptions(), numThreads, &statistics));
+        ASSERT_EQ(expectedAssignments, assignments);
+    }
+
+    std::vector<std::vector<std::uint64_t>> assignmentsWithInvalidValue({{0U, 0U}, {0U, 32U}, {1U, 1U}});
+    Diagnostics                             diagnostics;
+    {
+        const ScopedDiagnosticsCollection diagnosticsCollection(diagnostics);
+        ASSERT_FALSE(interpretProgram(assignmentsWithInvalidValue, program, ConfigurableOptions(), 3U));
+    }
+    ASSERT_EQ(2U, diagnostics.getErrorMessages().size());
+    ASSERT_NE(std::string::npos, diagnostics.getErrorMessages().back().find("assignment 1"));
+}
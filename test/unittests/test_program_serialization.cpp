@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/syrec/expression.hpp"
+#include "core/syrec/ir_node_arena.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/number.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/program_serialization.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    /*
+     * module callee(inout a(4), in b[2](4)) wire w(4)
+     *   for $i = 0 to 1 step 1 do a.0:1 += ((b[$i] + (2 * 1)) << 1) rof;
+     *   if !(a = 0) then ++= w else a <=> w fi !(a = 0)
+     * module main(inout x(4), in y[2](4))
+     *   call callee(x, y); uncall callee(x, y)
+     */
+    [[nodiscard]] Program buildProgram() {
+        auto calleeModule = std::make_shared<Module>("callee");
+        calleeModule->addParameter(std::make_shared<Variable>(Variable::Type::Inout, "a", std::vector<unsigned>{1U}, 4U));
+        calleeModule->addParameter(std::make_shared<Variable>(Variable::Type::In, "b", std::vector<unsigned>{2U}, 4U));
+        calleeModule->variables.emplace_back(std::make_shared<Variable>(Variable::Type::Wire, "w", std::vector<unsigned>{1U}, 4U));
+        calleeModule->assignDeclarationIndicesOfVariables();
+
+        const auto makeAccess = [&](const std::size_t variableIndex) {
+            auto access = std::make_shared<VariableAccess>();
+            access->setVar(variableIndex < 2U ? calleeModule->parameters[variableIndex] : calleeModule->variables[variableIndex - 2U]);
+            return access;
+        };
+
+        auto assignedAccess   = makeAccess(0);
+        assignedAccess->range = std::make_pair(std::make_shared<Number>(0U), std::make_shared<Number>(1U));
+        auto indexedAccess    = makeAccess(1);
+        indexedAccess->indexes.emplace_back(std::make_shared<NumericExpression>(std::make_shared<Number>(std::string("i")), 1U));
+        const auto constantExpression = std::make_shared<Number>(Number::ConstantExpression(std::make_shared<Number>(2U), Number::ConstantExpression::Operation::Multiplication, std::make_shared<Number>(1U)));
+        const auto binaryExpression   = std::make_shared<BinaryExpression>(std::make_shared<VariableExpression>(indexedAccess), BinaryExpression::BinaryOperation::Add, std::make_shared<NumericExpression>(constantExpression, 4U));
+
+        auto forStatement          = std::make_shared<ForStatement>();
+        forStatement->loopVariable = "i";
+        forStatement->range        = std::make_pair(std::make_shared<Number>(0U), std::make_shared<Number>(1U));
+        forStatement->step         = std::make_shared<Number>(1U);
+        forStatement->lineNumber   = 2U;
+        forStatement->addStatement(std::make_shared<AssignStatement>(assignedAccess, AssignStatement::AssignOperation::Add, std::make_shared<ShiftExpression>(binaryExpression, ShiftExpression::ShiftOperation::Left, std::make_shared<Number>(1U))));
+        calleeModule->addStatement(forStatement);
+
+        const auto guardCondition = std::make_shared<UnaryExpression>(UnaryExpression::UnaryOperation::LogicalNegation, std::make_shared<BinaryExpression>(std::make_shared<VariableExpression>(makeAccess(0)), BinaryExpression::BinaryOperation::Equals, std::make_shared<NumericExpression>(std::make_shared<Number>(0U), 4U)));
+        auto       ifStatement    = std::make_shared<IfStatement>();
+        ifStatement->setCondition(guardCondition);
+        ifStatement->addThenStatement(std::make_shared<UnaryStatement>(UnaryStatement::UnaryOperation::Increment, makeAccess(2)));
+        ifStatement->addElseStatement(std::make_shared<SwapStatement>(makeAccess(0), makeAccess(2)));
+        ifStatement->setFiCondition(guardCondition);
+        ifStatement->lineNumber = 3U;
+        calleeModule->addStatement(ifStatement);
+
+        auto mainModule = std::make_shared<Module>("main");
+        mainModule->addParameter(std::make_shared<Variable>(Variable::Type::Inout, "x", std::vector<unsigned>{1U}, 4U));
+        mainModule->addParameter(std::make_shared<Variable>(Variable::Type::In, "y", std::vector<unsigned>{2U}, 4U));
+        mainModule->addStatement(std::make_shared<CallStatement>(calleeModule, std::vector<std::string>{"x", "y"}));
+        mainModule->addStatement(std::make_shared<UncallStatement>(calleeModule, std::vector<std::string>{"x", "y"}));
+        mainModule->addStatement(std::make_shared<SkipStatement>());
+
+        Program program;
+        program.addModule(calleeModule);
+        program.addModule(mainModule);
+        return program;
+    }
+} // namespace
+
+TEST(ProgramSerializationTests, DeserializedProgramMatchesSerializedProgram) {
+    const Program                    program           = buildProgram();
+    const std::optional<std::string> serializedProgram = serializeProgram(program);
+    ASSERT_TRUE(serializedProgram.has_value());
+
+    Program deserializedProgram;
+    ASSERT_TRUE(deserializeProgram(deserializedProgram, *serializedProgram));
+    ASSERT_EQ(2U, deserializedProgram.modules().size());
+
+    const Module::ptr& calleeModule = deserializedProgram.modules()[0];
+    ASSERT_EQ("callee", calleeModule->name);
+    ASSERT_EQ(2U, calleeModule->parameters.size());
+    ASSERT_EQ(1U, calleeModule->variables.size());
+    ASSERT_EQ(Variable::Type::In, calleeModule->parameters[1]->type);
+    ASSERT_EQ(std::vector<unsigned>{2U}, calleeModule->parameters[1]->dimensions);
+    ASSERT_EQ(std::make_optional<std::size_t>(2U), calleeModule->variables[0]->declarationIndexInModule);
+    ASSERT_EQ(2U, calleeModule->statements.size());
+
+    const auto* forStatement = dynamic_cast<const ForStatement*>(calleeModule->statements[0].get());
+    ASSERT_NE(nullptr, forStatement);
+    ASSERT_EQ("i", forStatement->loopVariable);
+    ASSERT_EQ(2U, forStatement->lineNumber);
+    ASSERT_EQ(1U, forStatement->range.second->evaluate({}));
+    ASSERT_EQ(1U, forStatement->statements.size());
+
+    const auto* assignStatement = dynamic_cast<const AssignStatement*>(forStatement->statements[0].get());
+    ASSERT_NE(nullptr, assignStatement);
+    ASSERT_EQ(AssignStatement::AssignOperation::Add, assignStatement->assignOperation);
+    // Variable accesses reference the variables of the deserialized module
+    ASSERT_EQ(calleeModule->parameters[0], assignStatement->lhs->var);
+    ASSERT_EQ(2U, assignStatement->lhs->bitwidth());
+
+    const auto* shiftExpression = dynamic_cast<const ShiftExpression*>(assignStatement->rhs.get());
+    ASSERT_NE(nullptr, shiftExpression);
+    const auto* binaryExpression = dynamic_cast<const BinaryExpression*>(shiftExpression->lhs.get());
+    ASSERT_NE(nullptr, binaryExpression);
+    const auto* constantOperand = dynamic_cast<const NumericExpression*>(binaryExpression->rhs.get());
+    ASSERT_NE(nullptr, constantOperand);
+    ASSERT_TRUE(constantOperand->value->isConstantExpression());
+    ASSERT_EQ(2U, constantOperand->value->evaluate({}));
+    const auto* indexedOperand = dynamic_cast<const VariableExpression*>(binaryExpression->lhs.get());
+    ASSERT_NE(nullptr, indexedOperand);
+    ASSERT_EQ(calleeModule->parameters[1], indexedOperand->var->var);
+    const auto* loopVariableIndex = dynamic_cast<const NumericExpression*>(indexedOperand->var->indexes.front().get());
+    ASSERT_NE(nullptr, loopVariableIndex);
+    ASSERT_TRUE(loopVariableIndex->value->isLoopVariable());
+    ASSERT_EQ("i", loopVariableIndex->value->variableName());
+
+    const auto* ifStatement = dynamic_cast<const IfStatement*>(calleeModule->statements[1].get());
+    ASSERT_NE(nullptr, ifStatement);
+    ASSERT_NE(nullptr, dynamic_cast<const UnaryExpression*>(ifStatement->fiCondition.get()));
+    ASSERT_EQ(1U, ifStatement->thenStatements.size());
+    const auto* swapStatement = dynamic_cast<const SwapStatement*>(ifStatement->elseStatements.front().get());
+    ASSERT_NE(nullptr, swapStatement);
+    ASSERT_EQ(calleeModule->variables[0], swapStatement->rhs->var);
+
+    const Module::ptr& mainModule = deserializedProgram.modules()[1];
+    ASSERT_EQ(3U, mainModule->statements.size());
+    const auto* callStatement = dynamic_cast<const CallStatement*>(mainModule->statements[0].get());
+    ASSERT_NE(nullptr, callStatement);
+    // Call statements reference the deserialized modules
+    ASSERT_EQ(calleeModule, callStatement->target);
+    ASSERT_EQ((std::vector<std::string>{"x", "y"}), callStatement->parameters);
+    ASSERT_NE(nullptr, dynamic_cast<const UncallStatement*>(mainModule->statements[1].get()));
+    ASSERT_NE(nullptr, dynamic_cast<const SkipStatement*>(mainModule->statements[2].get()));
+
+    // The serialization of the deserialized program is identical to the one of the original program
+    ASSERT_EQ(serializedProgram, serializeProgram(deserializedProgram));
+}
+
+TEST(ProgramSerializationTests, DeserializationIntoArenaMatchesDeserializationWithoutArena) {
+    const std::optional<std::string> serializedProgram = serializeProgram(buildProgram());
+    ASSERT_TRUE(serializedProgram.has_value());
+
+    Program deserializedProgram;
+    ASSERT_TRUE(deserializeProgram(deserializedProgram, *serializedProgram, std::make_shared<IrNodeArena>()));
+    ASSERT_EQ(serializedProgram, serializeProgram(deserializedProgram));
+}
+
+TEST(ProgramSerializationTests, SerializationOfVariableAccessOnVariableNotDeclaredInModuleFails) {
+    Program program = buildProgram();
+
+    auto access = std::make_shared<VariableAccess>();
+    access->setVar(std::make_shared<Variable>(Variable::Type::Wire, "undeclared", std::vector<unsigned>{1U}, 4U));
+    program.modules()[1]->addStatement(std::make_shared<UnaryStatement>(UnaryStatement::UnaryOperation::Invert, access));
+    ASSERT_FALSE(serializeProgram(program).has_value());
+}
+
+TEST(ProgramSerializationTests, DeserializationOfTruncatedOrCorruptedProgramFails) {
+    const std::optional<std::string> serializedProgram = serializeProgram(buildProgram());
+    ASSERT_TRUE(serializedProgram.has_value());
+
+    Program deserializedProgram;
+    for (std::size_t truncatedSize = 0; truncatedSize < serializedProgram->size(); ++truncatedSize) {
+        ASSERT_FALSE(deserializeProgram(deserializedProgram, std::string_view(*serializedProgram).substr(0, truncatedSize))) << "Truncated size: " << truncatedSize;
+    }
+    ASSERT_FALSE(deserializeProgram(deserializedProgram, *serializedProgram + "trailing"));
+
+    std::string programWithInvalidVersion = *serializedProgram;
+    programWithInvalidVersion[7]          = static_cast<char>(0xFF);
+    ASSERT_FALSE(deserializeProgram(deserializedProgram, programWithInvalidVersion));
+    ASSERT_TRUE(deserializedProgram.modules().empty());
+}
+
+TEST(ProgramSerializationTests, LoadedProgramMatchesSavedProgram) {
+    const std::filesystem::path pathToSavedProgram = std::filesystem::temp_directory_path() / "mqt_syrec_saved_program.syrecir";
+    const Program               program            = buildProgram();
+    ASSERT_EQ("", program.save(pathToSavedProgram.string()));
+
+    Program loadedProgram = buildProgram();
+    ASSERT_EQ("", loadedProgram.load(pathToSavedProgram.string()));
+    // The modules of the program are replaced by the loaded ones
+    ASSERT_EQ(2U, loadedProgram.modules().size());
+    ASSERT_EQ(serializeProgram(program), serializeProgram(loadedProgram));
+    std::filesystem::remove(pathToSavedProgram);
+}
+
+TEST(ProgramSerializationTests, LoadingOfInvalidOrMissingFileFails) {
+    const std::filesystem::path pathToSavedProgram = std::filesystem::temp_directory_path() / "mqt_syrec_invalid_saved_program.syrecir";
+    std::ofstream(pathToSavedProgram) << "module main(inout a(4)) ++= a";
+
+    Program program = buildProgram();
+    ASSERT_NE("", program.load(pathToSavedProgram.string()));
+    std::filesystem::remove(pathToSavedProgram);
+    ASSERT_NE("", program.load(pathToSavedProgram.string()));
+    ASSERT_EQ(2U, program.modules().size());
+}
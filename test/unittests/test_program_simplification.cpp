@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/optimization/program_simplification.hpp"
+#include "core/configurable_options.hpp"
+#include "core/syrec/expression.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/number.hpp"
+#include "core/syrec/parser/utils/syrec_operation_utils.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+#include "syrec_ir_builder.hpp"
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+using namespace syrec_ir_builder;
+
+namespace {
+    class ProgramSimplificationTestsFixture: public testing::Test {
+    protected:
+        Program      program;
+        Module::ptr  mainModule = std::make_shared<Module>("main");
+        Variable::ptr a         = std::make_shared<Variable>(Variable::Type::Inout, "a", std::vector<unsigned>({1U}), 4U);
+        Variable::ptr b         = std::make_shared<Variable>(Variable::Type::Inout, "b", std::vector<unsigned>({1U}), 4U);
+
+        void SetUp() override {
+            mainModule->addParameter(a);
+            mainModule->addParameter(b);
+        }
+
+        [[nodiscard]] static Number::ptr createLoopVariable(const std::string& loopVariableIdentifier) {
+            return std::make_shared<Number>(loopVariableIdentifier);
+        }
+
+        [[nodiscard]] static std::shared_ptr<ForStatement> createLoop(const std::string& loopVariableIdentifier, const unsigned startValue, const unsigned endValue) {
+            auto loop          = std::make_shared<ForStatement>();
+            loop->loopVariable = loopVariableIdentifier;
+            loop->range        = std::make_pair(createNumber(startValue), createNumber(endValue));
+            loop->step         = createNumber(1U);
+            return loop;
+        }
+
+        void simplifyMainModule() {
+            program.addModule(mainModule);
+            simplifyProgram(program);
+        }
+
+        static void assertExpressionIsIntegerConstant(const Expression::ptr& expression, const unsigned expectedValue) {
+            const auto* const exprAsNumericExpr = dynamic_cast<const NumericExpression*>(expression.get());
+            ASSERT_NE(nullptr, exprAsNumericExpr);
+            ASSERT_TRUE(exprAsNumericExpr->value->isConstant());
+            ASSERT_EQ(expectedValue, exprAsNumericExpr->value->evaluate({}));
+        }
+    };
+} // namespace
+
+TEST_F(ProgramSimplificationTestsFixture, SkipStatementsAndAssignmentsOfZeroAreRemoved) {
+    const Statement::ptr assignmentOfNonZeroValue = createAssignment(createVariableAccess(a), AssignStatement::AssignOperation::Add, std::make_shared<VariableExpression>(createVariableAccess(b)));
+    mainModule->addStatement(std::make_shared<SkipStatement>());
+    mainModule->addStatement(createAssignment(createVariableAccess(a), AssignStatement::AssignOperation::Add, createNumericExpression(createNumber(0U))));
+    mainModule->addStatement(assignmentOfNonZeroValue);
+    mainModule->addStatement(createAssignment(createVariableAccess(a), AssignStatement::AssignOperation::Subtract, createNumericExpression(createNumber(0U))));
+    mainModule->addStatement(createAssignment(createVariableAccess(a), AssignStatement::AssignOperation::Exor, std::make_shared<BinaryExpression>(createNumericExpression(createNumber(2U)), BinaryExpression::BinaryOperation::Subtract, createNumericExpression(createNumber(2U)))));
+
+    simplifyMainModule();
+    ASSERT_EQ(1U, mainModule->statements.size());
+    ASSERT_EQ(assignmentOfNonZeroValue, mainModule->statements.front());
+}
+
+TEST_F(ProgramSimplificationTestsFixture, CompileTimeConstantExpressionsAreEvaluated) {
+    const Expression::ptr compileTimeConstantExpr = std::make_shared<BinaryExpression>(createNumericExpression(createNumber(2U)), BinaryExpression::BinaryOperation::Add,
+                                                                                       std::make_shared<ShiftExpression>(createNumericExpression(createNumber(3U)), ShiftExpression::ShiftOperation::Left, createNumber(1U)));
+    const Statement::ptr originalAssignment = createAssignment(createVariableAccess(a), AssignStatement::AssignOperation::Add, compileTimeConstantExpr);
+    originalAssignment->lineNumber          = 2U;
+    mainModule->addStatement(originalAssignment);
+
+    simplifyMainModule();
+    ASSERT_EQ(1U, mainModule->statements.size());
+    const auto* const simplifiedAssignment = dynamic_cast<const AssignStatement*>(mainModule->statements.front().get());
+    ASSERT_NE(nullptr, simplifiedAssignment);
+    ASSERT_EQ(2U, simplifiedAssignment->lineNumber);
+    ASSERT_EQ(4U, simplifiedAssignment->rhs->bitwidth());
+    ASSERT_NO_FATAL_FAILURE(assertExpressionIsIntegerConstant(simplifiedAssignment->rhs, 8U));
+
+    // The replaced IR nodes are not modified
+    ASSERT_EQ(compileTimeConstantExpr, dynamic_cast<const AssignStatement*>(originalAssignment.get())->rhs);
+}
+
+TEST_F(ProgramSimplificationTestsFixture, LoopPerformingSingleIterationIsReplacedByItsBody) {
+    const auto loop = createLoop("i", 2U, 3U);
+    loop->addStatement(createAssignment(createVariableAccess(a, createAccessedBit(createLoopVariable("i"))), AssignStatement::AssignOperation::Exor, std::make_shared<VariableExpression>(createVariableAccess(b, createAccessedBit(createLoopVariable("i"))))));
+    loop->addStatement(createAssignment(createVariableAccess(a), AssignStatement::AssignOperation::Add, createNumericExpression(std::make_shared<Number>(Number::ConstantExpression(createLoopVariable("i"), Number::ConstantExpression::Operation::Addition, createNumber(1U))))));
+    mainModule->addStatement(loop);
+
+    simplifyMainModule();
+    ASSERT_EQ(2U, mainModule->statements.size());
+
+    const auto* const firstAssignment = dynamic_cast<const AssignStatement*>(mainModule->statements.front().get());
+    ASSERT_NE(nullptr, firstAssignment);
+    ASSERT_TRUE(firstAssignment->lhs->range.has_value());
+    ASSERT_TRUE(firstAssignment->lhs->range->first->isConstant());
+    ASSERT_EQ(2U, firstAssignment->lhs->range->first->evaluate({}));
+    ASSERT_EQ(2U, firstAssignment->lhs->range->second->evaluate({}));
+
+    const auto* const accessedVariableOfRhs = dynamic_cast<const VariableExpression*>(firstAssignment->rhs.get());
+    ASSERT_NE(nullptr, accessedVariableOfRhs);
+    ASSERT_TRUE(accessedVariableOfRhs->var->range.has_value());
+    ASSERT_TRUE(accessedVariableOfRhs->var->range->first->isConstant());
+    ASSERT_EQ(2U, accessedVariableOfRhs->var->range->first->evaluate({}));
+
+    const auto* const secondAssignment = dynamic_cast<const AssignStatement*>(mainModule->statements.back().get());
+    ASSERT_NE(nullptr, secondAssignment);
+    ASSERT_NO_FATAL_FAILURE(assertExpressionIsIntegerConstant(secondAssignment->rhs, 3U));
+}
+
+TEST_F(ProgramSimplificationTestsFixture, LoopVariableOfLoopPerformingMultipleIterationsIsNotReplaced) {
+    const auto loop = createLoop("i", 0U, 4U);
+    loop->addStatement(createAssignment(createVariableAccess(a, createAccessedBit(createLoopVariable("i"))), AssignStatement::AssignOperation::Exor, std::make_shared<VariableExpression>(createVariableAccess(b, createAccessedBit(createLoopVariable("i"))))));
+    mainModule->addStatement(loop);
+
+    simplifyMainModule();
+    ASSERT_EQ(1U, mainModule->statements.size());
+    ASSERT_EQ(loop, mainModule->statements.front());
+    ASSERT_EQ(1U, loop->statements.size());
+}
+
+TEST_F(ProgramSimplificationTestsFixture, LoopsWithoutIterationsOrStatementsAreRemoved) {
+    const auto loopWithoutIterations = createLoop("i", 2U, 2U);
+    loopWithoutIterations->addStatement(createAssignment(createVariableAccess(a), AssignStatement::AssignOperation::Add, std::make_shared<VariableExpression>(createVariableAccess(b))));
+    mainModule->addStatement(loopWithoutIterations);
+
+    const auto loopWithEmptyBody = createLoop("j", 0U, 4U);
+    loopWithEmptyBody->addStatement(std::make_shared<SkipStatement>());
+    mainModule->addStatement(loopWithEmptyBody);
+
+    simplifyMainModule();
+    ASSERT_TRUE(mainModule->statements.empty());
+}
+
+TEST_F(ProgramSimplificationTestsFixture, IfStatementWithCompileTimeConstantGuardConditionsIsReplacedByExecutedBranch) {
+    const Statement::ptr thenBranchStatement = createAssignment(createVariableAccess(a), AssignStatement::AssignOperation::Add, std::make_shared<VariableExpression>(createVariableAccess(b)));
+    const Statement::ptr elseBranchStatement = createAssignment(createVariableAccess(b), AssignStatement::AssignOperation::Add, std::make_shared<VariableExpression>(createVariableAccess(a)));
+
+    const auto ifStatement = std::make_shared<IfStatement>();
+    ifStatement->setCondition(std::make_shared<BinaryExpression>(createNumericExpression(createNumber(1U)), BinaryExpression::BinaryOperation::LessThan, createNumericExpression(createNumber(2U))));
+    ifStatement->setFiCondition(std::make_shared<BinaryExpression>(createNumericExpression(createNumber(2U)), BinaryExpression::BinaryOperation::GreaterThan, createNumericExpression(createNumber(1U))));
+    ifStatement->addThenStatement(thenBranchStatement);
+    ifStatement->addElseStatement(elseBranchStatement);
+    mainModule->addStatement(ifStatement);
+
+    simplifyMainModule();
+    ASSERT_EQ(1U, mainModule->statements.size());
+    ASSERT_EQ(thenBranchStatement, mainModule->statements.front());
+}
+
+TEST_F(ProgramSimplificationTestsFixture, IfStatementWithDifferentTruthValuesOfGuardConditionsIsNotReplaced) {
+    const auto ifStatement = std::make_shared<IfStatement>();
+    ifStatement->setCondition(createNumericExpression(createNumber(1U)));
+    ifStatement->setFiCondition(std::make_shared<VariableExpression>(createVariableAccess(a, createAccessedBit(createNumber(0U)))));
+    ifStatement->addThenStatement(createAssignment(createVariableAccess(a, createAccessedBit(createNumber(1U))), AssignStatement::AssignOperation::Exor, createNumericExpression(createNumber(1U))));
+    mainModule->addStatement(ifStatement);
+
+    simplifyMainModule();
+    ASSERT_EQ(1U, mainModule->statements.size());
+    const auto* const simplifiedIfStatement = dynamic_cast<const IfStatement*>(mainModule->statements.front().get());
+    ASSERT_NE(nullptr, simplifiedIfStatement);
+    ASSERT_EQ(1U, simplifiedIfStatement->thenStatements.size());
+    ASSERT_TRUE(simplifiedIfStatement->elseStatements.empty());
+}
+
+TEST_F(ProgramSimplificationTestsFixture, TruthValueOfGuardConditionDependsOnIntegerConstantTruncationOperation) {
+    const auto ifStatement = std::make_shared<IfStatement>();
+    ifStatement->setCondition(createNumericExpression(createNumber(2U)));
+    ifStatement->setFiCondition(createNumericExpression(createNumber(2U)));
+    ifStatement->addThenStatement(createAssignment(createVariableAccess(a), AssignStatement::AssignOperation::Add, std::make_shared<VariableExpression>(createVariableAccess(b))));
+    mainModule->addStatement(ifStatement);
+    program.addModule(mainModule);
+
+    // The value 2 truncated to a single bit evaluates to false and thus the statements of the empty else branch are executed
+    ConfigurableOptions settings;
+    settings.integerConstantTruncationOperation = utils::IntegerConstantTruncationOperation::BitwiseAnd;
+    simplifyProgram(program, settings);
+    ASSERT_TRUE(mainModule->statements.empty());
+}
+
+TEST_F(ProgramSimplificationTestsFixture, IfStatementWithEmptyBranchesIsRemoved) {
+    const auto ifStatement = std::make_shared<IfStatement>();
+    ifStatement->setCondition(std::make_shared<VariableExpression>(createVariableAccess(a, createAccessedBit(createNumber(0U)))));
+    ifStatement->setFiCondition(std::make_shared<VariableExpression>(createVariableAccess(a, createAccessedBit(createNumber(0U)))));
+    ifStatement->addThenStatement(std::make_shared<SkipStatement>());
+    ifStatement->addElseStatement(createAssignment(createVariableAccess(b), AssignStatement::AssignOperation::Add, createNumericExpression(createNumber(0U))));
+    mainModule->addStatement(ifStatement);
+
+    simplifyMainModule();
+    ASSERT_TRUE(mainModule->statements.empty());
+}
+
+TEST_F(ProgramSimplificationTestsFixture, CallsOfModulesWithEmptyBodyAreRemoved) {
+    const auto calledModule = std::make_shared<Module>("f");
+    calledModule->addParameter(std::make_shared<Variable>(Variable::Type::Inout, "x", std::vector<unsigned>({1U}), 4U));
+    calledModule->addStatement(std::make_shared<SkipStatement>());
+
+    const auto otherCalledModule = std::make_shared<Module>("g");
+    otherCalledModule->addParameter(std::make_shared<Variable>(Variable::Type::Inout, "x", std::vector<unsigned>({1U}), 4U));
+    otherCalledModule->addStatement(std::make_shared<UnaryStatement>(UnaryStatement::UnaryOperation::Increment, createVariableAccess(otherCalledModule->parameters.front())));
+
+    const Statement::ptr callOfNonEmptyModule = std::make_shared<CallStatement>(otherCalledModule, std::vector<std::string>({"a"}));
+    mainModule->addStatement(std::make_shared<CallStatement>(calledModule, std::vector<std::string>({"a"})));
+    mainModule->addStatement(callOfNonEmptyModule);
+    mainModule->addStatement(std::make_shared<UncallStatement>(calledModule, std::vector<std::string>({"b"})));
+
+    // The main module is simplified before the called modules are reached in the modules of the program
+    program.addModule(mainModule);
+    program.addModule(calledModule);
+    program.addModule(otherCalledModule);
+    simplifyProgram(program);
+
+    ASSERT_EQ(1U, mainModule->statements.size());
+    ASSERT_EQ(callOfNonEmptyModule, mainModule->statements.front());
+    ASSERT_TRUE(calledModule->statements.empty());
+    ASSERT_EQ(1U, otherCalledModule->statements.size());
+}
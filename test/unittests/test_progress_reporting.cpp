@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/resource_estimation.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/progress_reporting.hpp"
+#include "core/syrec/program.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace syrec;
+
+TEST(ProgressReportingTests, ReportsAreRateLimited) {
+    std::size_t      numReports   = 0;
+    std::size_t      numAssembled = 0;
+    ProgressReporter progressReporter([&](const ProgressReport&) { ++numReports; }, std::chrono::hours(1));
+    for (std::size_t i = 0; i < 1000U; ++i) {
+        progressReporter.reportIfDue([&] {
+            ++numAssembled;
+            return ProgressReport{};
+        });
+    }
+    ASSERT_EQ(0U, numReports);
+    ASSERT_EQ(0U, numAssembled);
+
+    // The final report is forwarded regardless of the time elapsed since the last report
+    progressReporter.report(ProgressReport{.numSimulatedPatterns = 10U, .numPatterns = 10U});
+    ASSERT_EQ(1U, numReports);
+}
+
+TEST(ProgressReportingTests, ReporterWithoutIntervalForwardsEveryReport) {
+    std::vector<std::size_t> reportedNumSimulatedPatterns;
+    ProgressReporter         progressReporter([&](const ProgressReport& report) { reportedNumSimulatedPatterns.emplace_back(report.numSimulatedPatterns); }, std::chrono::milliseconds(0));
+    for (std::size_t i = 1; i <= 3U; ++i) {
+        progressReporter.reportIfDue([&] { return ProgressReport{.numSimulatedPatterns = i}; });
+    }
+    ASSERT_EQ(std::vector<std::size_t>({1U, 2U, 3U}), reportedNumSimulatedPatterns);
+}
+
+TEST(ProgressReportingTests, ReporterWithoutCallbackIgnoresReports) {
+    ProgressReporter progressReporter(nullptr, std::chrono::milliseconds(0));
+    ASSERT_NO_FATAL_FAILURE(progressReporter.report(ProgressReport{}));
+}
+
+TEST(ProgressReportingTests, SynthesisReportsProgressUpToEstimatedTotals) {
+    Program program;
+    ASSERT_EQ("", program.readFromString("module main(inout a(4), in b(4)) for $i = 0 to 4 do a += (b + $i) rof; a ^= b"));
+
+    ResourceEstimate resourceEstimate;
+    ASSERT_TRUE(estimateResourcesOfSynthesis(resourceEstimate, program));
+    ASSERT_LT(0U, resourceEstimate.numStatements);
+
+    std::vector<ProgressReport> progressReports;
+    ConfigurableOptions         settings;
+    settings.progressCallback                     = [&](const ProgressReport& report) { progressReports.emplace_back(report); };
+    settings.progressReportIntervalInMilliseconds = 0;
+
+    AnnotatableQuantumComputation annotatableQuantumComputation(false);
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(annotatableQuantumComputation, program, settings));
+    ASSERT_FALSE(progressReports.empty());
+
+    std::size_t numProcessedStatementsOfLastReport = 0;
+    for (const ProgressReport& report: progressReports) {
+        ASSERT_LE(numProcessedStatementsOfLastReport, report.numProcessedStatements);
+        ASSERT_EQ(resourceEstimate.numStatements, report.estimatedNumStatements);
+        ASSERT_EQ(resourceEstimate.numQuantumOperations, report.estimatedNumQuantumOperations);
+        numProcessedStatementsOfLastReport = report.numProcessedStatements;
+    }
+    ASSERT_LT(0U, progressReports.back().numProcessedStatements);
+    ASSERT_LE(progressReports.back().numProcessedStatements, resourceEstimate.numStatements);
+    ASSERT_EQ(annotatableQuantumComputation.getNumQuantumOperations(), progressReports.back().numEmittedQuantumOperations);
+}
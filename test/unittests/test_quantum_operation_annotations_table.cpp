@@ -0,0 +1,281 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/quantum_operation_annotations_table.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <optional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    using AnnotationsLookup = QuantumOperationAnnotationsTable::QuantumOperationAnnotationsLookup;
+
+    class InspectableQuantumOperationAnnotationsTable: public QuantumOperationAnnotationsTable {
+    public:
+        [[nodiscard]] std::size_t getNumAnnotationsRanges() const noexcept {
+            return annotationsRanges.size();
+        }
+    };
+
+    void assertAnnotationsOfTableAre(const QuantumOperationAnnotationsTable& table, const std::vector<AnnotationsLookup>& expectedAnnotationsPerQuantumOperation) {
+        ASSERT_EQ(expectedAnnotationsPerQuantumOperation.size(), table.size());
+        for (std::size_t i = 0; i < expectedAnnotationsPerQuantumOperation.size(); ++i) {
+            ASSERT_EQ(expectedAnnotationsPerQuantumOperation[i], table.getAnnotationsOfQuantumOperation(i)) << "Annotations of quantum operation at position " << std::to_string(i) << " did not match";
+        }
+    }
+} // namespace
+
+TEST(QuantumOperationAnnotationsTableTests, AnnotationsOfPositionNotCoveredByTableAreEmpty) {
+    QuantumOperationAnnotationsTable table;
+    ASSERT_EQ(0U, table.size());
+    ASSERT_TRUE(table.getAnnotationsOfQuantumOperation(0).empty());
+    ASSERT_FALSE(table.setOrUpdateAnnotationOfQuantumOperation(0, "KEY", "value"));
+    ASSERT_FALSE(table.setOrUpdateAnnotationsOfQuantumOperations(0, 0, {{"KEY", "value"}}, {}));
+}
+
+TEST(QuantumOperationAnnotationsTableTests, QuantumOperationsSharingAnnotationsAreStoredInSingleRange) {
+    InspectableQuantumOperationAnnotationsTable table;
+    for (std::size_t i = 0; i < 100; ++i) {
+        table.resize(i + 1U);
+        ASSERT_TRUE(table.setOrUpdateAnnotationsOfQuantumOperations(i, i, {{"lno", "1"}}, {}));
+    }
+    ASSERT_EQ(1U, table.getNumAnnotationsRanges());
+
+    table.resize(150);
+    ASSERT_TRUE(table.setOrUpdateAnnotationsOfQuantumOperations(100, 149, {{"lno", "2"}}, {}));
+    ASSERT_EQ(2U, table.getNumAnnotationsRanges());
+    ASSERT_EQ(AnnotationsLookup({{"lno", "1"}}), table.getAnnotationsOfQuantumOperation(99));
+    ASSERT_EQ(AnnotationsLookup({{"lno", "2"}}), table.getAnnotationsOfQuantumOperation(100));
+}
+
+TEST(QuantumOperationAnnotationsTableTests, UpdateOfSingleQuantumOperationSplitsRange) {
+    InspectableQuantumOperationAnnotationsTable table;
+    table.resize(3);
+    ASSERT_TRUE(table.setOrUpdateAnnotationsOfQuantumOperations(0, 2, {{"lno", "1"}}, {}));
+    ASSERT_TRUE(table.setOrUpdateAnnotationOfQuantumOperation(1, "KEY", "value"));
+    ASSERT_EQ(3U, table.getNumAnnotationsRanges());
+    ASSERT_NO_FATAL_FAILURE(assertAnnotationsOfTableAre(table, {{{"lno", "1"}}, {{"lno", "1"}, {"KEY", "value"}}, {{"lno", "1"}}}));
+
+    // Reverting the update merges the ranges again
+    ASSERT_TRUE(table.setOrUpdateAnnotationsOfQuantumOperations(0, 0, {{"KEY", "value"}}, {}));
+    ASSERT_TRUE(table.setOrUpdateAnnotationsOfQuantumOperations(2, 2, {{"KEY", "value"}}, {}));
+    ASSERT_EQ(1U, table.getNumAnnotationsRanges());
+}
+
+TEST(QuantumOperationAnnotationsTableTests, SecondAnnotationsTakePrecedenceOverFirstAnnotations) {
+    QuantumOperationAnnotationsTable table;
+    table.resize(1);
+    ASSERT_TRUE(table.setOrUpdateAnnotationsOfQuantumOperations(0, 0, {{"KEY", "first"}, {"OTHER", "first"}}, {{"KEY", "second"}}));
+    ASSERT_NO_FATAL_FAILURE(assertAnnotationsOfTableAre(table, {{{"KEY", "second"}, {"OTHER", "first"}}}));
+}
+
+TEST(QuantumOperationAnnotationsTableTests, QuantumOperationsWithIdenticalAnnotationsShareAnnotationsId) {
+    QuantumOperationAnnotationsTable table;
+    table.resize(4);
+    ASSERT_TRUE(table.setOrUpdateAnnotationsOfQuantumOperations(0, 0, {{"lno", "1"}}, {}));
+    ASSERT_TRUE(table.setOrUpdateAnnotationsOfQuantumOperations(1, 1, {{"lno", "2"}}, {}));
+    ASSERT_TRUE(table.setOrUpdateAnnotationsOfQuantumOperations(2, 2, {{"lno", "1"}}, {}));
+
+    ASSERT_EQ(table.getAnnotationsIdOfQuantumOperation(0), table.getAnnotationsIdOfQuantumOperation(2));
+    ASSERT_NE(table.getAnnotationsIdOfQuantumOperation(0), table.getAnnotationsIdOfQuantumOperation(1));
+    ASSERT_EQ(table.getAnnotationsIdOfQuantumOperation(3), table.getAnnotationsIdOfQuantumOperation(4));
+    ASSERT_EQ(AnnotationsLookup({{"lno", "2"}}), table.getAnnotationsWithId(table.getAnnotationsIdOfQuantumOperation(1)));
+    ASSERT_TRUE(table.getAnnotationsWithId(table.getAnnotationsIdOfQuantumOperation(3)).empty());
+    ASSERT_TRUE(table.getAnnotationsWithId(100).empty());
+}
+
+TEST(QuantumOperationAnnotationsTableTests, EraseFirstQuantumOperations) {
+    QuantumOperationAnnotationsTable table;
+    table.resize(4);
+    ASSERT_TRUE(table.setOrUpdateAnnotationsOfQuantumOperations(0, 1, {{"lno", "1"}}, {}));
+    ASSERT_TRUE(table.setOrUpdateAnnotationsOfQuantumOperations(2, 3, {{"lno", "2"}}, {}));
+
+    table.eraseFirstQuantumOperations(1);
+    ASSERT_NO_FATAL_FAILURE(assertAnnotationsOfTableAre(table, {{{"lno", "1"}}, {{"lno", "2"}}, {{"lno", "2"}}}));
+    table.eraseFirstQuantumOperations(5);
+    ASSERT_EQ(0U, table.size());
+}
+
+TEST(QuantumOperationAnnotationsTableTests, EraseQuantumOperationsMergesRemainingRanges) {
+    InspectableQuantumOperationAnnotationsTable table;
+    table.resize(3);
+    ASSERT_TRUE(table.setOrUpdateAnnotationsOfQuantumOperations(0, 2, {{"lno", "1"}}, {}));
+    ASSERT_TRUE(table.setOrUpdateAnnotationOfQuantumOperation(1, "KEY", "value"));
+
+    table.eraseQuantumOperations({false, true});
+    ASSERT_EQ(1U, table.getNumAnnotationsRanges());
+    ASSERT_NO_FATAL_FAILURE(assertAnnotationsOfTableAre(table, {{{"lno", "1"}}, {{"lno", "1"}}}));
+}
+
+TEST(QuantumOperationAnnotationsTableTests, ReorderQuantumOperationsMergesRanges) {
+    InspectableQuantumOperationAnnotationsTable table;
+    table.resize(4);
+    ASSERT_TRUE(table.setOrUpdateAnnotationOfQuantumOperation(0, "lno", "1"));
+    ASSERT_TRUE(table.setOrUpdateAnnotationOfQuantumOperation(1, "lno", "2"));
+    ASSERT_TRUE(table.setOrUpdateAnnotationOfQuantumOperation(2, "lno", "1"));
+    ASSERT_TRUE(table.setOrUpdateAnnotationOfQuantumOperation(3, "lno", "2"));
+    ASSERT_EQ(4U, table.getNumAnnotationsRanges());
+
+    ASSERT_TRUE(table.reorderQuantumOperations({0, 2, 1, 3}));
+    ASSERT_EQ(2U, table.getNumAnnotationsRanges());
+    ASSERT_NO_FATAL_FAILURE(assertAnnotationsOfTableAre(table, {{{"lno", "1"}}, {{"lno", "1"}}, {{"lno", "2"}}, {{"lno", "2"}}}));
+}
+
+TEST(QuantumOperationAnnotationsTableTests, ReorderQuantumOperationsUsingNonPermutationNotPossible) {
+    QuantumOperationAnnotationsTable table;
+    table.resize(2);
+    ASSERT_TRUE(table.setOrUpdateAnnotationOfQuantumOperation(1, "lno", "1"));
+
+    ASSERT_FALSE(table.reorderQuantumOperations({0}));
+    ASSERT_FALSE(table.reorderQuantumOperations({1, 1}));
+    ASSERT_FALSE(table.reorderQuantumOperations({0, 2}));
+    ASSERT_NO_FATAL_FAILURE(assertAnnotationsOfTableAre(table, {{}, {{"lno", "1"}}}));
+}
+
+TEST(QuantumOperationAnnotationsTableTests, CopyAnnotationsOfQuantumOperations) {
+    QuantumOperationAnnotationsTable table;
+    table.resize(2);
+    ASSERT_TRUE(table.setOrUpdateAnnotationOfQuantumOperation(0, "lno", "1"));
+    ASSERT_TRUE(table.setOrUpdateAnnotationOfQuantumOperation(1, "lno", "2"));
+
+    table.resize(5);
+    ASSERT_TRUE(table.copyAnnotationsOfQuantumOperations(0, 3, 2));
+    ASSERT_NO_FATAL_FAILURE(assertAnnotationsOfTableAre(table, {{{"lno", "1"}}, {{"lno", "2"}}, {}, {{"lno", "1"}}, {{"lno", "2"}}}));
+    ASSERT_FALSE(table.copyAnnotationsOfQuantumOperations(0, 4, 2));
+}
+
+TEST(QuantumOperationAnnotationsTableTests, StatementLineNumbersAreStoredSeparatelyFromAnnotations) {
+    InspectableQuantumOperationAnnotationsTable table;
+    table.resize(4);
+    ASSERT_TRUE(table.setOrUpdateAnnotationsOfQuantumOperations(0, 3, {{"KEY", "value"}}, {}));
+    ASSERT_TRUE(table.setOrUpdateAnnotationsOfQuantumOperations(0, 1, {}, {}, 1U));
+    ASSERT_TRUE(table.setOrUpdateAnnotationsOfQuantumOperations(2, 3, {}, {}, 2U));
+
+    // Quantum operations with identical annotations but different statement line numbers share the same set of annotations but not the same range
+    ASSERT_EQ(2U, table.getNumAnnotationsRanges());
+    ASSERT_EQ(table.getAnnotationsIdOfQuantumOperation(0), table.getAnnotationsIdOfQuantumOperation(3));
+    ASSERT_NO_FATAL_FAILURE(assertAnnotationsOfTableAre(table, {{{"KEY", "value"}}, {{"KEY", "value"}}, {{"KEY", "value"}}, {{"KEY", "value"}}}));
+    ASSERT_EQ(std::make_optional(1U), table.getStatementLineNumberOfQuantumOperation(1));
+    ASSERT_EQ(std::make_optional(2U), table.getStatementLineNumberOfQuantumOperation(2));
+    ASSERT_EQ(std::nullopt, table.getStatementLineNumberOfQuantumOperation(4));
+
+    // Annotating quantum operations without a statement line number keeps their existing statement line number
+    ASSERT_TRUE(table.setOrUpdateAnnotationOfQuantumOperation(3, "KEY", "otherValue"));
+    ASSERT_EQ(std::make_optional(2U), table.getStatementLineNumberOfQuantumOperation(3));
+    ASSERT_TRUE(table.setOrUpdateAnnotationsOfQuantumOperations(1, 2, {}, {}, 1U));
+    ASSERT_EQ(2U, table.getNumAnnotationsRanges());
+    ASSERT_EQ(std::make_optional(1U), table.getStatementLineNumberOfQuantumOperation(2));
+}
+
+TEST(QuantumOperationAnnotationsTableTests, StatementLineNumbersAreCopiedErasedAndReorderedTogetherWithAnnotations) {
+    InspectableQuantumOperationAnnotationsTable table;
+    table.resize(3);
+    ASSERT_TRUE(table.setOrUpdateAnnotationsOfQuantumOperations(0, 0, {}, {}, 1U));
+    ASSERT_TRUE(table.setOrUpdateAnnotationsOfQuantumOperations(1, 2, {}, {}, 2U));
+
+    table.resize(5);
+    ASSERT_TRUE(table.copyAnnotationsOfQuantumOperations(0, 3, 2));
+    ASSERT_EQ(std::make_optional(1U), table.getStatementLineNumberOfQuantumOperation(3));
+    ASSERT_EQ(std::make_optional(2U), table.getStatementLineNumberOfQuantumOperation(4));
+
+    // Removing the quantum operation at position 3 merges the adjacent ranges sharing the statement line number 2
+    table.eraseQuantumOperations({false, false, false, true, false});
+    ASSERT_EQ(4U, table.size());
+    ASSERT_EQ(2U, table.getNumAnnotationsRanges());
+
+    ASSERT_TRUE(table.reorderQuantumOperations({1, 0, 2, 3}));
+    ASSERT_EQ(std::make_optional(2U), table.getStatementLineNumberOfQuantumOperation(0));
+    ASSERT_EQ(std::make_optional(1U), table.getStatementLineNumberOfQuantumOperation(1));
+
+    table.eraseFirstQuantumOperations(1);
+    ASSERT_EQ(std::make_optional(1U), table.getStatementLineNumberOfQuantumOperation(0));
+    ASSERT_EQ(std::make_optional(2U), table.getStatementLineNumberOfQuantumOperation(2));
+}
+
+TEST(QuantumOperationAnnotationsTableTests, AnnotationsMatchThoseOfUncompressedStorageAfterRandomModifications) {
+    QuantumOperationAnnotationsTable table;
+    std::vector<AnnotationsLookup>   expectedAnnotationsPerQuantumOperation;
+
+    std::mt19937 randomNumberGenerator(42U);
+    auto         drawRandomNumber = [&randomNumberGenerator](const std::size_t upperBound) {
+        return std::uniform_int_distribution<std::size_t>(0U, upperBound)(randomNumberGenerator);
+    };
+
+    for (std::size_t modification = 0; modification < 2000; ++modification) {
+        const std::size_t numQuantumOperations = expectedAnnotationsPerQuantumOperation.size();
+        const std::string annotationValue      = std::to_string(drawRandomNumber(3U));
+        switch (drawRandomNumber(5U)) {
+            case 0U: {
+                const std::size_t newSize = drawRandomNumber(numQuantumOperations + 8U);
+                table.resize(newSize);
+                expectedAnnotationsPerQuantumOperation.resize(newSize);
+                break;
+            }
+            case 1U: {
+                if (numQuantumOperations == 0U) {
+                    break;
+                }
+                const std::size_t position = drawRandomNumber(numQuantumOperations - 1U);
+                ASSERT_TRUE(table.setOrUpdateAnnotationOfQuantumOperation(position, "KEY", annotationValue));
+                expectedAnnotationsPerQuantumOperation[position].insert_or_assign("KEY", annotationValue);
+                break;
+            }
+            case 2U: {
+                if (numQuantumOperations == 0U) {
+                    break;
+                }
+                const std::size_t firstPosition = drawRandomNumber(numQuantumOperations - 1U);
+                const std::size_t lastPosition  = firstPosition + drawRandomNumber(numQuantumOperations - 1U - firstPosition);
+                ASSERT_TRUE(table.setOrUpdateAnnotationsOfQuantumOperations(firstPosition, lastPosition, {{"lno", annotationValue}}, {}));
+                for (std::size_t i = firstPosition; i <= lastPosition; ++i) {
+                    expectedAnnotationsPerQuantumOperation[i].insert_or_assign("lno", annotationValue);
+                }
+                break;
+            }
+            case 3U: {
+                const std::size_t numCopiedQuantumOperations = drawRandomNumber(numQuantumOperations / 2U);
+                const std::size_t firstSourcePosition        = drawRandomNumber(numQuantumOperations - numCopiedQuantumOperations);
+                const std::size_t firstTargetPosition        = drawRandomNumber(numQuantumOperations - numCopiedQuantumOperations);
+                ASSERT_TRUE(table.copyAnnotationsOfQuantumOperations(firstSourcePosition, firstTargetPosition, numCopiedQuantumOperations));
+                const std::vector<AnnotationsLookup> copiedAnnotations(std::next(expectedAnnotationsPerQuantumOperation.begin(), static_cast<std::ptrdiff_t>(firstSourcePosition)), std::next(expectedAnnotationsPerQuantumOperation.begin(), static_cast<std::ptrdiff_t>(firstSourcePosition + numCopiedQuantumOperations)));
+                std::ranges::copy(copiedAnnotations, std::next(expectedAnnotationsPerQuantumOperation.begin(), static_cast<std::ptrdiff_t>(firstTargetPosition)));
+                break;
+            }
+            case 4U: {
+                const std::size_t numErasedQuantumOperations = drawRandomNumber(3U);
+                table.eraseFirstQuantumOperations(numErasedQuantumOperations);
+                expectedAnnotationsPerQuantumOperation.erase(expectedAnnotationsPerQuantumOperation.begin(), std::next(expectedAnnotationsPerQuantumOperation.begin(), static_cast<std::ptrdiff_t>(std::min(numErasedQuantumOperations, numQuantumOperations))));
+                break;
+            }
+            default: {
+                std::vector<bool>              isQuantumOperationRemoved(numQuantumOperations);
+                std::vector<AnnotationsLookup> remainingAnnotations;
+                for (std::size_t i = 0; i < numQuantumOperations; ++i) {
+                    isQuantumOperationRemoved[i] = drawRandomNumber(4U) == 0U;
+                    if (!isQuantumOperationRemoved[i]) {
+                        remainingAnnotations.emplace_back(expectedAnnotationsPerQuantumOperation[i]);
+                    }
+                }
+                table.eraseQuantumOperations(isQuantumOperationRemoved);
+                expectedAnnotationsPerQuantumOperation = std::move(remainingAnnotations);
+                break;
+            }
+        }
+        ASSERT_NO_FATAL_FAILURE(assertAnnotationsOfTableAre(table, expectedAnnotationsPerQuantumOperation)) << "Mismatch after modification " << std::to_string(modification);
+    }
+}
@@ -8,6 +8,7 @@
  * Licensed under the MIT License
  */
 
+#include "core/module_call_tree.hpp"
 #include "core/qubit_inlining_stack.hpp"
 #include "core/syrec/expression.hpp"
 #include "core/syrec/module.hpp"
@@ -557,3 +558,79 @@ TEST(QubitInliningStackTests, StringificationOfModuleSignatureDoesNotStringifiyS
     ASSERT_NO_FATAL_FAILURE(assertStringifiedModuleSignaturesMatch(stackEntry, "module main(inout a[2](3), in b[1](3))"));
 }
 // END stringification of target module signature tests
+
+// BEGIN module call tree view tests
+TEST(QubitInliningStackTests, ViewOfModuleCallTreeNodeContainsTargetModulesOfPathFromRootNode) {
+    const auto mainModule   = std::make_shared<Module>("main");
+    const auto firstModule  = std::make_shared<Module>("first");
+    const auto secondModule = std::make_shared<Module>("second");
+
+    const auto                                  moduleCallTree   = std::make_shared<ModuleCallTree>();
+    const std::optional<ModuleCallTree::NodeId> mainModuleNode   = moduleCallTree->addNode(std::nullopt, mainModule, std::nullopt, std::nullopt);
+    const std::optional<ModuleCallTree::NodeId> firstModuleNode  = mainModuleNode.has_value() ? moduleCallTree->addNode(*mainModuleNode, firstModule, 3U, true) : std::nullopt;
+    const std::optional<ModuleCallTree::NodeId> secondModuleNode = firstModuleNode.has_value() ? moduleCallTree->addNode(*firstModuleNode, secondModule, 5U, false) : std::nullopt;
+    ASSERT_TRUE(secondModuleNode.has_value());
+
+    // The call information of a module is stored in the entry of the calling module
+    auto inlineStack = QubitInliningStack(moduleCallTree, *secondModuleNode);
+    ASSERT_EQ(3, inlineStack.size());
+    ASSERT_TRUE(inlineStack.areTargetModulesOfAllStackEntriesSet());
+    const std::vector expectedInlineStackEntries = {QubitInliningStack::QubitInliningStackEntry({.lineNumberOfCallOfTargetModule = 3U, .isTargetModuleAccessedViaCallStmt = true, .targetModule = mainModule}),
+                                                    QubitInliningStack::QubitInliningStackEntry({.lineNumberOfCallOfTargetModule = 5U, .isTargetModuleAccessedViaCallStmt = false, .targetModule = firstModule}),
+                                                    QubitInliningStack::QubitInliningStackEntry({.lineNumberOfCallOfTargetModule = std::nullopt, .isTargetModuleAccessedViaCallStmt = std::nullopt, .targetModule = secondModule})};
+    ASSERT_NO_FATAL_FAILURE(assertInlineStackEntriesAre(inlineStack, expectedInlineStackEntries));
+}
+
+TEST(QubitInliningStackTests, ViewsOfSiblingModuleCallTreeNodesShareEntriesOfParentNode) {
+    const auto mainModule   = std::make_shared<Module>("main");
+    const auto calledModule = std::make_shared<Module>("called");
+
+    const auto                                  moduleCallTree = std::make_shared<ModuleCallTree>();
+    const std::optional<ModuleCallTree::NodeId> mainModuleNode = moduleCallTree->addNode(std::nullopt, mainModule, std::nullopt, std::nullopt);
+    const std::optional<ModuleCallTree::NodeId> firstCallNode  = mainModuleNode.has_value() ? moduleCallTree->addNode(*mainModuleNode, calledModule, 2U, true) : std::nullopt;
+    const std::optional<ModuleCallTree::NodeId> secondCallNode = mainModuleNode.has_value() ? moduleCallTree->addNode(*mainModuleNode, calledModule, 4U, false) : std::nullopt;
+    ASSERT_TRUE(firstCallNode.has_value());
+    ASSERT_TRUE(secondCallNode.has_value());
+
+    auto inlineStackOfFirstCall  = QubitInliningStack(moduleCallTree, *firstCallNode);
+    auto inlineStackOfSecondCall = QubitInliningStack(moduleCallTree, *secondCallNode);
+    auto inlineStackOfMainModule = QubitInliningStack(moduleCallTree, *mainModuleNode);
+
+    const auto expectedEntryOfCalledModule = QubitInliningStack::QubitInliningStackEntry({.lineNumberOfCallOfTargetModule = std::nullopt, .isTargetModuleAccessedViaCallStmt = std::nullopt, .targetModule = calledModule});
+    ASSERT_NO_FATAL_FAILURE(assertInlineStackEntriesAre(inlineStackOfFirstCall, {QubitInliningStack::QubitInliningStackEntry({.lineNumberOfCallOfTargetModule = 2U, .isTargetModuleAccessedViaCallStmt = true, .targetModule = mainModule}), expectedEntryOfCalledModule}));
+    ASSERT_NO_FATAL_FAILURE(assertInlineStackEntriesAre(inlineStackOfSecondCall, {QubitInliningStack::QubitInliningStackEntry({.lineNumberOfCallOfTargetModule = 4U, .isTargetModuleAccessedViaCallStmt = false, .targetModule = mainModule}), expectedEntryOfCalledModule}));
+    ASSERT_NO_FATAL_FAILURE(assertInlineStackEntriesAre(inlineStackOfMainModule, {QubitInliningStack::QubitInliningStackEntry({.lineNumberOfCallOfTargetModule = std::nullopt, .isTargetModuleAccessedViaCallStmt = std::nullopt, .targetModule = mainModule})}));
+}
+
+TEST(QubitInliningStackTests, ViewOfNotExistingModuleCallTreeNodeIsEmpty) {
+    const auto moduleCallTree = std::make_shared<ModuleCallTree>();
+    ASSERT_TRUE(moduleCallTree->addNode(std::nullopt, std::make_shared<Module>("main"), std::nullopt, std::nullopt).has_value());
+
+    auto inlineStack = QubitInliningStack(moduleCallTree, 1U);
+    ASSERT_EQ(0, inlineStack.size());
+    ASSERT_THAT(inlineStack.getStackEntryAt(0), testing::IsNull());
+    ASSERT_EQ(0, QubitInliningStack(nullptr, 0U).size());
+}
+
+TEST(QubitInliningStackTests, ModificationOfViewOfModuleCallTreeNodeDoesNotModifyModuleCallTree) {
+    const auto mainModule   = std::make_shared<Module>("main");
+    const auto calledModule = std::make_shared<Module>("called");
+
+    const auto                                  moduleCallTree   = std::make_shared<ModuleCallTree>();
+    const std::optional<ModuleCallTree::NodeId> mainModuleNode   = moduleCallTree->addNode(std::nullopt, mainModule, std::nullopt, std::nullopt);
+    const std::optional<ModuleCallTree::NodeId> calledModuleNode = mainModuleNode.has_value() ? moduleCallTree->addNode(*mainModuleNode, calledModule, 2U, true) : std::nullopt;
+    ASSERT_TRUE(calledModuleNode.has_value());
+
+    auto       inlineStack            = QubitInliningStack(moduleCallTree, *calledModuleNode);
+    const auto copyOfInlineStack      = std::make_shared<QubitInliningStack>(inlineStack);
+    const auto pushedInlineStackEntry = QubitInliningStack::QubitInliningStackEntry({.lineNumberOfCallOfTargetModule = std::nullopt, .isTargetModuleAccessedViaCallStmt = std::nullopt, .targetModule = mainModule});
+    ASSERT_TRUE(inlineStack.push(pushedInlineStackEntry));
+    ASSERT_TRUE(inlineStack.pop());
+    ASSERT_TRUE(inlineStack.pop());
+    ASSERT_NO_FATAL_FAILURE(assertInlineStackEntriesAre(inlineStack, {QubitInliningStack::QubitInliningStackEntry({.lineNumberOfCallOfTargetModule = 2U, .isTargetModuleAccessedViaCallStmt = true, .targetModule = mainModule})}));
+
+    ASSERT_EQ(2, moduleCallTree->getNumNodes());
+    ASSERT_NO_FATAL_FAILURE(assertInlineStackEntriesAre(*copyOfInlineStack, {QubitInliningStack::QubitInliningStackEntry({.lineNumberOfCallOfTargetModule = 2U, .isTargetModuleAccessedViaCallStmt = true, .targetModule = mainModule}),
+                                                                             QubitInliningStack::QubitInliningStackEntry({.lineNumberOfCallOfTargetModule = std::nullopt, .isTargetModuleAccessedViaCallStmt = std::nullopt, .targetModule = calledModule})}));
+}
+// END module call tree view tests
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/qubit_span_interner.hpp"
+#include "ir/Definitions.hpp"
+
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace syrec;
+
+TEST(QubitSpanInternerTests, EmptySpanIsAssignedReservedId) {
+    QubitSpanInterner interner;
+    ASSERT_EQ(QubitSpanInterner::EMPTY_SPAN_ID, interner.intern({}));
+    ASSERT_TRUE(interner.get(QubitSpanInterner::EMPTY_SPAN_ID).empty());
+    ASSERT_EQ(0U, interner.getNumInternedSpans());
+}
+
+TEST(QubitSpanInternerTests, EqualSpansAreAssignedSameId) {
+    QubitSpanInterner            interner;
+    const std::vector<qc::Qubit> span = {2, 0, 1};
+    const auto                   id   = interner.intern(span);
+    ASSERT_NE(QubitSpanInterner::EMPTY_SPAN_ID, id);
+    ASSERT_EQ(id, interner.intern(std::vector<qc::Qubit>{2, 0, 1}));
+    ASSERT_EQ(span, interner.get(id));
+    ASSERT_EQ(1U, interner.getNumInternedSpans());
+}
+
+TEST(QubitSpanInternerTests, DifferentSpansAreAssignedDifferentIds) {
+    QubitSpanInterner interner;
+    const auto        firstId  = interner.intern({0, 1});
+    const auto        secondId = interner.intern({1, 0});
+    const auto        thirdId  = interner.intern({0, 1, 2});
+    ASSERT_NE(firstId, secondId);
+    ASSERT_NE(firstId, thirdId);
+    ASSERT_NE(secondId, thirdId);
+    ASSERT_EQ(3U, interner.getNumInternedSpans());
+
+    // References to interned spans are not invalidated by interning further spans
+    const std::vector<qc::Qubit>& firstSpan = interner.get(firstId);
+    for (qc::Qubit qubit = 10; qubit < 100; ++qubit) {
+        static_cast<void>(interner.intern({qubit}));
+    }
+    ASSERT_EQ((std::vector<qc::Qubit>{0, 1}), firstSpan);
+}
+
+TEST(QubitSpanInternerTests, ClearRemovesInternedSpans) {
+    QubitSpanInterner interner;
+    static_cast<void>(interner.intern({0, 1}));
+    interner.clear();
+    ASSERT_EQ(0U, interner.getNumInternedSpans());
+    ASSERT_EQ(QubitSpanInterner::EMPTY_SPAN_ID, interner.intern({}));
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/random_stimulus_simulation.hpp"
+#include "core/statistics.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace syrec;
+
+TEST(RandomStimulusSimulationTest, CornerCasePatternsOfAndGate) {
+    // The AND of the data qubits 0 and 1 is computed into the ancillary qubit 2, which is only one for the all ones pattern
+    qc::QuantumComputation quantumComputation(3);
+    quantumComputation.setLogicalQubitAncillary(2);
+    quantumComputation.mcx(qc::Controls({0, 1}), 2);
+
+    StimulusSimulationResult result;
+    ASSERT_TRUE(randomStimulusSimulation(result, quantumComputation, StimulusSimulationSettings{.numRandomPatterns = 0U, .numThreads = 1U}));
+    ASSERT_EQ(4U, result.numSimulatedPatterns);
+    ASSERT_EQ(std::vector<std::uint64_t>({2U, 2U, 1U}), result.numOnesPerQubit);
+    ASSERT_EQ(std::vector<std::uint64_t>({0U, 0U, 1U}), result.numFlipsPerQubit);
+    ASSERT_EQ(3U, result.getNumToggleCoveredQubits());
+}
+
+TEST(RandomStimulusSimulationTest, UncoveredQubitsAreReported) {
+    // The ancillary qubit 3 is initialized to one and never toggled
+    qc::QuantumComputation quantumComputation(4);
+    quantumComputation.setLogicalQubitAncillary(2);
+    quantumComputation.setLogicalQubitAncillary(3);
+    quantumComputation.x(3);
+    quantumComputation.cx(0, 1);
+
+    StimulusSimulationResult result;
+    ASSERT_TRUE(randomStimulusSimulation(result, quantumComputation, StimulusSimulationSettings{.numRandomPatterns = 1000U, .numThreads = 2U}));
+    ASSERT_EQ(1004U, result.numSimulatedPatterns);
+    ASSERT_TRUE(result.isQubitToggleCovered(0));
+    ASSERT_TRUE(result.isQubitToggleCovered(1));
+    ASSERT_FALSE(result.isQubitToggleCovered(2));
+    ASSERT_FALSE(result.isQubitToggleCovered(3));
+    ASSERT_EQ(0U, result.numOnesPerQubit[2]);
+    ASSERT_EQ(result.numSimulatedPatterns, result.numOnesPerQubit[3]);
+    ASSERT_EQ(result.numSimulatedPatterns, result.numFlipsPerQubit[3]);
+    // The target of the CNOT gate is flipped whenever its control is set
+    ASSERT_EQ(result.numOnesPerQubit[0], result.numFlipsPerQubit[1]);
+}
+
+TEST(RandomStimulusSimulationTest, GeneratedPatternsDoNotDependOnNumberOfThreads) {
+    constexpr std::size_t  numQubits = 70U;
+    qc::QuantumComputation quantumComputation(numQubits);
+    for (std::size_t i = 0; i + 2U < numQubits; ++i) {
+        quantumComputation.mcx(qc::Controls({static_cast<qc::Qubit>(i), static_cast<qc::Qubit>(i + 1U)}), static_cast<qc::Qubit>(i + 2U));
+    }
+
+    StimulusSimulationResult singleThreadedResult;
+    Statistics               statistics;
+    ASSERT_TRUE(randomStimulusSimulation(singleThreadedResult, quantumComputation, StimulusSimulationSettings{.numRandomPatterns = 10000U, .seed = 7U, .numThreads = 1U}, &statistics));
+    ASSERT_EQ(10000U + 2U + numQubits, singleThreadedResult.numSimulatedPatterns);
+    ASSERT_EQ(numQubits, singleThreadedResult.getNumToggleCoveredQubits());
+
+    for (const std::size_t numThreads: {0U, 3U, 16U}) {
+        StimulusSimulationResult multiThreadedResult;
+        ASSERT_TRUE(randomStimulusSimulation(multiThreadedResult, quantumComputation, StimulusSimulationSettings{.numRandomPatterns = 10000U, .seed = 7U, .numThreads = numThreads}));
+        ASSERT_EQ(singleThreadedResult.numSimulatedPatterns, multiThreadedResult.numSimulatedPatterns);
+        ASSERT_EQ(singleThreadedResult.numOnesPerQubit, multiThreadedResult.numOnesPerQubit);
+        ASSERT_EQ(singleThreadedResult.numFlipsPerQubit, multiThreadedResult.numFlipsPerQubit);
+    }
+
+    StimulusSimulationResult resultOfOtherSeed;
+    ASSERT_TRUE(randomStimulusSimulation(resultOfOtherSeed, quantumComputation, StimulusSimulationSettings{.numRandomPatterns = 10000U, .seed = 8U}));
+    ASSERT_NE(singleThreadedResult.numOnesPerQubit, resultOfOtherSeed.numOnesPerQubit);
+}
+
+TEST(RandomStimulusSimulationTest, NonClassicalGatesAreNotSupported) {
+    qc::QuantumComputation quantumComputation(2);
+    quantumComputation.h(0);
+
+    StimulusSimulationResult result;
+    ASSERT_FALSE(randomStimulusSimulation(result, quantumComputation));
+    ASSERT_EQ(0U, result.numSimulatedPatterns);
+    ASSERT_TRUE(result.numOnesPerQubit.empty());
+}
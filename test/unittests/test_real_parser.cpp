@@ -1564,3 +1564,45 @@ TEST_F(RealParserTest, CombinationOfCommentLineAndWhitespacePostfixAllowed) {
     ASSERT_EQ(2, qc.getNqubits());
     ASSERT_EQ(1, qc.getNops());
 }
+
+TEST_F(RealParserTest, ImportOfLargeGateList) {
+    usingVersion(DEFAULT_REAL_VERSION)
+            .usingNVariables(3)
+            .usingVariables({"v1", "v2", "v3"});
+
+    constexpr std::size_t numGates = 10000;
+    realFileContent << realHeaderGateListPrefix;
+    for (std::size_t i = 0; i < numGates; ++i) {
+        // interleave comment lines and gates using negative control lines
+        if (i % 100 == 0) {
+            realFileContent << "\n"
+                            << createComment(" gate " + std::to_string(i));
+        }
+        realFileContent << "\n"
+                        << stringifyGate(GateType::Toffoli, std::optional(3), {"-v1", "v2"}, {"v3"}, std::nullopt);
+    }
+    realFileContent << "\n"
+                    << reakHeaderGateListPostfix;
+
+    EXPECT_NO_THROW(
+            qc = syrec::RealParser::import(realFileContent));
+
+    ASSERT_EQ(3, qc.getNqubits());
+    ASSERT_EQ(numGates, qc.getNops());
+    for (const auto& operation: qc) {
+        ASSERT_EQ(OpType::X, operation->getType());
+        ASSERT_THAT(operation->getControls(), testing::UnorderedElementsAre(Control{0, Control::Type::Neg}, Control{1, Control::Type::Pos}));
+        ASSERT_THAT(operation->getTargets(), testing::ElementsAre(2));
+    }
+}
+
+TEST_F(RealParserTest, GateWithInvalidParameter) {
+    usingVersion(DEFAULT_REAL_VERSION)
+            .usingNVariables(1)
+            .usingVariables({"v1"})
+            .withGates({"rx1:1e v1"});
+
+    EXPECT_THROW(
+            qc = syrec::RealParser::import(realFileContent),
+            std::runtime_error);
+}
@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "algorithms/synthesis/resource_estimation.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "algorithms/synthesis/syrec_hybrid_synthesis.hpp"
+#include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/syrec/expression.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/number.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+#include "syrec_ir_builder.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// .clang-tidy reports a false positive here since we are including the required nlohman json header file
+using json = nlohmann::json; // NOLINT(misc-include-cleaner)
+
+using namespace syrec;
+using namespace syrec_ir_builder;
+
+namespace {
+    class ResourceEstimationTestsFixture: public testing::Test {
+    protected:
+        Program       program;
+        Module::ptr   mainModule = std::make_shared<Module>("main");
+        Variable::ptr a          = std::make_shared<Variable>(Variable::Type::In, "a", std::vector<unsigned>({1U}), 4U);
+        Variable::ptr b          = std::make_shared<Variable>(Variable::Type::Inout, "b", std::vector<unsigned>({1U}), 4U);
+        Variable::ptr c          = std::make_shared<Variable>(Variable::Type::Out, "c", std::vector<unsigned>({1U}), 4U);
+
+        void SetUp() override {
+            mainModule->addParameter(a);
+            mainModule->addParameter(b);
+            mainModule->addParameter(c);
+            program.addModule(mainModule);
+        }
+
+        [[nodiscard]] static Expression::ptr createBinaryExpression(const Variable::ptr& lhsOperand, const BinaryExpression::BinaryOperation binaryOperation, const Variable::ptr& rhsOperand) {
+            return std::make_shared<BinaryExpression>(createVariableExpression(lhsOperand), binaryOperation, createVariableExpression(rhsOperand));
+        }
+
+        static void assertEstimateMatchesSynthesisResult(const Program& programToEstimate, const ConfigurableOptions& settings, const SynthesisAlgorithm synthesisAlgorithm) {
+            AnnotatableQuantumComputation annotatableQuantumComputation;
+            bool                          synthesisOk = false;
+            switch (synthesisAlgorithm) {
+                case SynthesisAlgorithm::CostAware:
+                    synthesisOk = CostAwareSynthesis::synthesize(annotatableQuantumComputation, programToEstimate, settings);
+                    break;
+                case SynthesisAlgorithm::LineAware:
+                    synthesisOk = LineAwareSynthesis::synthesize(annotatableQuantumComputation, programToEstimate, settings);
+                    break;
+                case SynthesisAlgorithm::Hybrid:
+                    synthesisOk = HybridSynthesis::synthesize(annotatableQuantumComputation, programToEstimate, settings);
+                    break;
+            }
+            ASSERT_TRUE(synthesisOk);
+
+            ResourceEstimate estimate;
+            ASSERT_TRUE(estimateResourcesOfSynthesis(estimate, programToEstimate, settings, synthesisAlgorithm));
+            ASSERT_EQ(annotatableQuantumComputation.getNqubits(), estimate.numQubits);
+            ASSERT_EQ(annotatableQuantumComputation.getNops(), estimate.numQuantumOperations);
+            ASSERT_EQ(annotatableQuantumComputation.getQuantumCostForSynthesis(), estimate.quantumCost);
+            ASSERT_EQ(annotatableQuantumComputation.getTransistorCostForSynthesis(), estimate.transistorCost);
+        }
+    };
+
+    class ResourceEstimationOfTestCircuitsTest: public testing::TestWithParam<std::tuple<SynthesisAlgorithm, std::string>> {
+    protected:
+        std::string testConfigsDir  = "./configs/";
+        std::string testCircuitsDir = "./circuits/";
+    };
+} // namespace
+
+TEST_F(ResourceEstimationTestsFixture, EstimateOfArithmeticAssignmentsMatchesSynthesisResultForEveryAdderArchitecture) {
+    // c ^= (a + b); b += (a ^ c); c -= (a - b); b += (c - a)
+    mainModule->addStatement(std::make_shared<AssignStatement>(createVariableAccess(c), AssignStatement::AssignOperation::Exor, createBinaryExpression(a, BinaryExpression::BinaryOperation::Add, b)));
+    mainModule->addStatement(std::make_shared<AssignStatement>(createVariableAccess(b), AssignStatement::AssignOperation::Add, createBinaryExpression(a, BinaryExpression::BinaryOperation::Exor, c)));
+    mainModule->addStatement(std::make_shared<AssignStatement>(createVariableAccess(c), AssignStatement::AssignOperation::Subtract, createBinaryExpression(a, BinaryExpression::BinaryOperation::Subtract, b)));
+    mainModule->addStatement(std::make_shared<AssignStatement>(createVariableAccess(b), AssignStatement::AssignOperation::Add, createBinaryExpression(c, BinaryExpression::BinaryOperation::Subtract, a)));
+
+    for (const AdderArchitecture adderArchitecture: {AdderArchitecture::RippleCarry, AdderArchitecture::Cuccaro, AdderArchitecture::CarryLookahead}) {
+        ConfigurableOptions settings;
+        settings.adderArchitecture = adderArchitecture;
+        for (const SynthesisAlgorithm synthesisAlgorithm: {SynthesisAlgorithm::CostAware, SynthesisAlgorithm::LineAware, SynthesisAlgorithm::Hybrid}) {
+            ASSERT_NO_FATAL_FAILURE(assertEstimateMatchesSynthesisResult(program, settings, synthesisAlgorithm));
+        }
+    }
+}
+
+TEST_F(ResourceEstimationTestsFixture, EstimateOfMultiplicationAndDivisionMatchesSynthesisResultForEveryArchitecture) {
+    // c ^= (a * b); c ^= (a / b); c ^= (a % b)
+    mainModule->addStatement(std::make_shared<AssignStatement>(createVariableAccess(c), AssignStatement::AssignOperation::Exor, createBinaryExpression(a, BinaryExpression::BinaryOperation::Multiply, b)));
+    mainModule->addStatement(std::make_shared<AssignStatement>(createVariableAccess(c), AssignStatement::AssignOperation::Exor, createBinaryExpression(a, BinaryExpression::BinaryOperation::Divide, b)));
+    mainModule->addStatement(std::make_shared<AssignStatement>(createVariableAccess(c), AssignStatement::AssignOperation::Exor, createBinaryExpression(a, BinaryExpression::BinaryOperation::Modulo, b)));
+
+    for (const MultiplierArchitecture multiplierArchitecture: {MultiplierArchitecture::ControlledAdditions, MultiplierArchitecture::PartialProducts}) {
+        for (const DividerArchitecture dividerArchitecture: {DividerArchitecture::Restoring, DividerArchitecture::NonRestoring}) {
+            ConfigurableOptions settings;
+            settings.multiplierArchitecture = multiplierArchitecture;
+            settings.dividerArchitecture    = dividerArchitecture;
+            for (const SynthesisAlgorithm synthesisAlgorithm: {SynthesisAlgorithm::CostAware, SynthesisAlgorithm::LineAware}) {
+                ASSERT_NO_FATAL_FAILURE(assertEstimateMatchesSynthesisResult(program, settings, synthesisAlgorithm));
+            }
+        }
+    }
+}
+
+TEST_F(ResourceEstimationTestsFixture, EstimateOfControlFlowStatementsMatchesSynthesisResult) {
+    // module inc(inout x(4)) x += (x ^ 3); ++= x
+    const auto calledModule = std::make_shared<Module>("inc");
+    const auto x            = std::make_shared<Variable>(Variable::Type::Inout, "x", std::vector<unsigned>({1U}), 4U);
+    calledModule->addParameter(x);
+    calledModule->addStatement(std::make_shared<AssignStatement>(createVariableAccess(x), AssignStatement::AssignOperation::Add, std::make_shared<BinaryExpression>(createVariableExpression(x), BinaryExpression::BinaryOperation::Exor, std::make_shared<NumericExpression>(std::make_shared<Number>(3U), 4U))));
+    calledModule->addStatement(std::make_shared<UnaryStatement>(UnaryStatement::UnaryOperation::Increment, createVariableAccess(x)));
+    program.addModule(calledModule);
+
+    // if (a < b) then call inc(c) else c <=> b fi (a < b)
+    const auto ifStatement = std::make_shared<IfStatement>();
+    ifStatement->setCondition(createBinaryExpression(a, BinaryExpression::BinaryOperation::LessThan, b));
+    ifStatement->addThenStatement(std::make_shared<CallStatement>(calledModule, std::vector<std::string>({"c"})));
+    ifStatement->addElseStatement(std::make_shared<SwapStatement>(createVariableAccess(c), createVariableAccess(b)));
+    ifStatement->setFiCondition(ifStatement->condition);
+    mainModule->addStatement(ifStatement);
+
+    // for $i = 0 to 3 do uncall inc(b); c ^= (a != b) rof
+    const auto forStatement    = std::make_shared<ForStatement>();
+    forStatement->loopVariable = "i";
+    forStatement->range        = std::make_pair(std::make_shared<Number>(0U), std::make_shared<Number>(3U));
+    forStatement->addStatement(std::make_shared<UncallStatement>(calledModule, std::vector<std::string>({"b"})));
+    forStatement->addStatement(std::make_shared<AssignStatement>(createVariableAccess(c), AssignStatement::AssignOperation::Exor, std::make_shared<BinaryExpression>(createBinaryExpression(a, BinaryExpression::BinaryOperation::NotEquals, b), BinaryExpression::BinaryOperation::Add, std::make_shared<NumericExpression>(std::make_shared<Number>(1U), 4U))));
+    mainModule->addStatement(forStatement);
+
+    for (const SynthesisAlgorithm synthesisAlgorithm: {SynthesisAlgorithm::CostAware, SynthesisAlgorithm::LineAware, SynthesisAlgorithm::Hybrid}) {
+        ASSERT_NO_FATAL_FAILURE(assertEstimateMatchesSynthesisResult(program, ConfigurableOptions(), synthesisAlgorithm));
+    }
+}
+
+TEST_F(ResourceEstimationTestsFixture, EstimateOfVariableAccessWithNonCompileTimeConstantIndexMatchesSynthesisResult) {
+    // d[a.0:1] += (a + d[b.1:2]); d[b.0:1] <=> d[a.2:3]
+    const auto d = std::make_shared<Variable>(Variable::Type::Inout, "d", std::vector<unsigned>({4U}), 4U);
+    mainModule->addParameter(d);
+
+    const auto createIndexExpression = [](const Variable::ptr& variable, const unsigned bitrangeStart) {
+        const auto variableAccess = createVariableAccess(variable);
+        variableAccess->range     = std::make_pair(std::make_shared<Number>(bitrangeStart), std::make_shared<Number>(bitrangeStart + 1U));
+        return std::make_shared<VariableExpression>(variableAccess);
+    };
+    mainModule->addStatement(std::make_shared<AssignStatement>(createVariableAccess(d, createIndexExpression(a, 0U)), AssignStatement::AssignOperation::Add, std::make_shared<BinaryExpression>(createVariableExpression(a), BinaryExpression::BinaryOperation::Add, std::make_shared<VariableExpression>(createVariableAccess(d, createIndexExpression(b, 1U))))));
+    mainModule->addStatement(std::make_shared<SwapStatement>(createVariableAccess(d, createIndexExpression(b, 0U)), createVariableAccess(d, createIndexExpression(a, 2U))));
+
+    for (const SynthesisAlgorithm synthesisAlgorithm: {SynthesisAlgorithm::CostAware, SynthesisAlgorithm::Hybrid}) {
+        ASSERT_NO_FATAL_FAILURE(assertEstimateMatchesSynthesisResult(program, ConfigurableOptions(), synthesisAlgorithm));
+    }
+
+    ResourceEstimate estimate;
+    ASSERT_FALSE(estimateResourcesOfSynthesis(estimate, program, ConfigurableOptions(), SynthesisAlgorithm::LineAware));
+}
+
+TEST_F(ResourceEstimationTestsFixture, EstimationOfProgramWithoutModulesFails) {
+    ResourceEstimate estimate;
+    ASSERT_FALSE(estimateResourcesOfSynthesis(estimate, Program()));
+}
+
+INSTANTIATE_TEST_SUITE_P(ResourceEstimationTest, ResourceEstimationOfTestCircuitsTest,
+                         testing::Combine(
+                                 testing::Values(SynthesisAlgorithm::CostAware, SynthesisAlgorithm::LineAware),
+                                 testing::Values(
+                                         "alu_2",
+                                         "binary_numeric",
+                                         "bitwise_and_2",
+                                         "bitwise_or_2",
+                                         "bn_2",
+                                         "call_8",
+                                         "constExpr_8",
+                                         "divide_2",
+                                         "foldEval_4",
+                                         "for_4",
+                                         "for_32",
+                                         "gray_binary_conversion_16",
+                                         "ifCondVariants_4",
+                                         "input_repeated_2",
+                                         "input_repeated_4",
+                                         "logical_and_1",
+                                         "logical_or_1",
+                                         "modulo_2",
+                                         "multiply_2",
+                                         "negate_8",
+                                         "numeric_2",
+                                         "operators_repeated_4",
+                                         "parity_4",
+                                         "parity_check_16",
+                                         "relationalOp_4",
+                                         "shift_4",
+                                         "simple_add_2",
+                                         "single_longstatement_4",
+                                         "skip",
+                                         "swap_2")),
+                         [](const testing::TestParamInfo<ResourceEstimationOfTestCircuitsTest::ParamType>& info) {
+                             auto s = std::string(std::get<0>(info.param) == SynthesisAlgorithm::CostAware ? "CostAware_" : "LineAware_") + std::get<1>(info.param);
+                             std::ranges::replace(s, '-', '_');
+                             return s; });
+
+TEST_P(ResourceEstimationOfTestCircuitsTest, EstimateIsWithinFivePercentOfSynthesisResult) {
+    const auto& [synthesisAlgorithm, circuitName] = GetParam();
+    std::ifstream i(testConfigsDir + (synthesisAlgorithm == SynthesisAlgorithm::CostAware ? "circuits_cost_aware_synthesis.json" : "circuits_line_aware_synthesis.json"));
+    json          j = json::parse(i);
+
+    Program                   prog;
+    const ConfigurableOptions settings;
+    const std::string         errorString = prog.read(testCircuitsDir + circuitName + ".src", settings);
+    ASSERT_TRUE(errorString.empty()) << "Found errors during processing of SyReC program: " << errorString;
+
+    ResourceEstimate estimate;
+    ASSERT_TRUE(estimateResourcesOfSynthesis(estimate, prog, settings, synthesisAlgorithm));
+
+    const auto assertWithinFivePercent = [](const double expectedValue, const double actualValue) {
+        ASSERT_NEAR(expectedValue, actualValue, expectedValue * 0.05);
+    };
+    ASSERT_NO_FATAL_FAILURE(assertWithinFivePercent(j[circuitName]["lines"], static_cast<double>(estimate.numQubits)));
+    ASSERT_NO_FATAL_FAILURE(assertWithinFivePercent(j[circuitName]["num_gates"], static_cast<double>(estimate.numQuantumOperations)));
+    ASSERT_NO_FATAL_FAILURE(assertWithinFivePercent(j[circuitName]["quantum_costs"], static_cast<double>(estimate.quantumCost)));
+    ASSERT_NO_FATAL_FAILURE(assertWithinFivePercent(j[circuitName]["transistor_costs"], static_cast<double>(estimate.transistorCost)));
+}
@@ -21,6 +21,8 @@
 #include <cstdint>
 #include <gtest/gtest.h>
 #include <optional>
+#include <string>
+#include <vector>
 
 using namespace syrec;
 
@@ -206,3 +208,82 @@ TEST(SimpleSimulationTests, SimulationRuntimePropertySet) {
     ASSERT_TRUE(outputState[0]);
     ASSERT_TRUE(outputState[1]);
 }
+
+TEST(SimpleSimulationTests, BatchSimulationOfXOperationWithControlQubits) {
+    constexpr std::size_t numQubits = 3;
+    // Patterns per qubit for each of the lanes 0..3: qubit 0 = 0101, qubit 2 = 0011
+    std::vector<std::uint64_t> laneValuesPerQubit = {0b1010, 0, 0b1100};
+
+    constexpr auto targetQubit    = static_cast<qc::Qubit>(1);
+    const auto     xGateOperation = qc::StandardOperation(qc::Controls({0, 2}), targetQubit, qc::OpType::X);
+    ASSERT_TRUE(coreOperationBatchSimulation(xGateOperation, laneValuesPerQubit));
+
+    ASSERT_EQ(numQubits, laneValuesPerQubit.size());
+    ASSERT_EQ(0b1010, laneValuesPerQubit[0]);
+    ASSERT_EQ(0b1000, laneValuesPerQubit[1]);
+    ASSERT_EQ(0b1100, laneValuesPerQubit[2]);
+}
+
+TEST(SimpleSimulationTests, BatchSimulationOfSwapOperationWithControlQubits) {
+    std::vector<std::uint64_t> laneValuesPerQubit = {0b0110, 0b1010, 0b1001};
+
+    constexpr auto controlQubit      = static_cast<qc::Qubit>(0);
+    constexpr auto targetQubitOne    = static_cast<qc::Qubit>(1);
+    constexpr auto targetQubitTwo    = static_cast<qc::Qubit>(2);
+    const auto     swapGateOperation = qc::StandardOperation(qc::Controls({controlQubit}), qc::Targets({targetQubitOne, targetQubitTwo}), qc::OpType::SWAP);
+    ASSERT_TRUE(coreOperationBatchSimulation(swapGateOperation, laneValuesPerQubit));
+
+    ASSERT_EQ(0b0110, laneValuesPerQubit[0]);
+    ASSERT_EQ(0b1000, laneValuesPerQubit[1]);
+    ASSERT_EQ(0b1011, laneValuesPerQubit[2]);
+}
+
+TEST(SimpleSimulationTests, BatchSimulationOfOperationWithQubitOutOfRange) {
+    std::vector<std::uint64_t> laneValuesPerQubit = {0, 0};
+
+    constexpr auto targetQubit    = static_cast<qc::Qubit>(2);
+    const auto     xGateOperation = qc::StandardOperation(qc::Controls({0}), targetQubit, qc::OpType::X);
+    ASSERT_FALSE(coreOperationBatchSimulation(xGateOperation, laneValuesPerQubit));
+}
+
+TEST(SimpleSimulationTests, BatchSimulationMatchesSimpleSimulationForAllInputStates) {
+    AnnotatableQuantumComputation quantumComputation;
+    constexpr std::size_t         numQubits = 4;
+    for (std::size_t i = 0; i < numQubits; ++i) {
+        ASSERT_TRUE(quantumComputation.addPreliminaryAncillaryRegisterOrAppendToAdjacentOne("q" + std::to_string(i), {false}, AnnotatableQuantumComputation::InlinedQubitInformation()).has_value());
+    }
+    ASSERT_TRUE(quantumComputation.addOperationsImplementingCnotGate(0, 1));
+    ASSERT_TRUE(quantumComputation.addOperationsImplementingToffoliGate(1, 2, 3));
+    ASSERT_TRUE(quantumComputation.addOperationsImplementingFredkinGate(0, 3));
+    ASSERT_TRUE(quantumComputation.addOperationsImplementingNotGate(2));
+
+    // Use more input states than lanes to also check the simulation of partially filled blocks
+    std::vector<NBitValuesContainer> inputStates;
+    for (std::size_t repetition = 0; repetition < 5; ++repetition) {
+        for (std::uint64_t inputStateValue = 0; inputStateValue < (1U << numQubits); ++inputStateValue) {
+            inputStates.emplace_back(numQubits, inputStateValue);
+        }
+    }
+
+    std::vector<NBitValuesContainer> outputStates;
+    Statistics                       statistics;
+    ASSERT_NO_FATAL_FAILURE(batchSimulation(outputStates, quantumComputation, inputStates, &statistics));
+    ASSERT_EQ(inputStates.size(), outputStates.size());
+
+    for (std::size_t i = 0; i < inputStates.size(); ++i) {
+        NBitValuesContainer expectedOutputState;
+        ASSERT_NO_FATAL_FAILURE(simpleSimulation(expectedOutputState, quantumComputation, inputStates[i]));
+        ASSERT_EQ(expectedOutputState, outputStates[i]) << "Output state mismatch for input state " << inputStates[i].stringify();
+    }
+}
+
+TEST(SimpleSimulationTests, BatchSimulationWithInputStateOfInvalidSize) {
+    AnnotatableQuantumComputation  quantumComputation;
+    const std::optional<qc::Qubit> qubitIndex = quantumComputation.addPreliminaryAncillaryRegisterOrAppendToAdjacentOne("q0", {false}, AnnotatableQuantumComputation::InlinedQubitInformation());
+    ASSERT_TRUE(qubitIndex.has_value());
+
+    const std::vector<NBitValuesContainer> inputStates = {NBitValuesContainer(1), NBitValuesContainer(2)};
+    std::vector<NBitValuesContainer>       outputStates;
+    ASSERT_NO_FATAL_FAILURE(batchSimulation(outputStates, quantumComputation, inputStates));
+    ASSERT_TRUE(outputStates.empty());
+}
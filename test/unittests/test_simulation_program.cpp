@@ -0,0 +1,346 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/simple_simulation.hpp"
+#include "algorithms/simulation/simulation_program.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/frozen_quantum_computation.hpp"
+#include "core/n_bit_values_container.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+#include "ir/operations/OpType.hpp"
+#include "ir/operations/StandardOperation.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    void assertCompiledProgramMatchesSimpleSimulationForAllInputStates(const qc::QuantumComputation& quantumComputation, const SimulationProgram& simulationProgram) {
+        ASSERT_EQ(quantumComputation.getNqubits(), simulationProgram.getNumQubits());
+
+        std::vector<NBitValuesContainer> inputStates;
+        for (std::uint64_t inputStateValue = 0; inputStateValue < (static_cast<std::uint64_t>(1) << quantumComputation.getNqubits()); ++inputStateValue) {
+            inputStates.emplace_back(quantumComputation.getNqubits(), inputStateValue);
+        }
+
+        std::vector<NBitValuesContainer> batchOutputStates;
+        ASSERT_NO_FATAL_FAILURE(batchSimulation(batchOutputStates, simulationProgram, inputStates));
+        ASSERT_EQ(inputStates.size(), batchOutputStates.size());
+
+        std::vector<std::uint64_t> integerInputStates(inputStates.size());
+        std::iota(integerInputStates.begin(), integerInputStates.end(), 0U);
+        std::vector<std::uint64_t> integerOutputStates(inputStates.size());
+        ASSERT_TRUE(batchSimulation(integerOutputStates, simulationProgram, integerInputStates));
+
+        for (std::size_t i = 0; i < inputStates.size(); ++i) {
+            NBitValuesContainer expectedOutputState;
+            ASSERT_NO_FATAL_FAILURE(simpleSimulation(expectedOutputState, quantumComputation, inputStates[i]));
+
+            NBitValuesContainer actualOutputState;
+            ASSERT_NO_FATAL_FAILURE(simpleSimulation(actualOutputState, simulationProgram, inputStates[i]));
+            ASSERT_EQ(expectedOutputState, actualOutputState) << "Output state mismatch for input state " << inputStates[i].stringify();
+            ASSERT_EQ(expectedOutputState, batchOutputStates[i]) << "Batch output state mismatch for input state " << inputStates[i].stringify();
+            ASSERT_EQ(expectedOutputState, NBitValuesContainer(quantumComputation.getNqubits(), integerOutputStates[i])) << "Integer batch output state mismatch for input state " << inputStates[i].stringify();
+        }
+    }
+} // namespace
+
+TEST(SimulationProgramTests, CompileEmptyQuantumComputation) {
+    qc::QuantumComputation quantumComputation(2);
+    const auto             simulationProgram = SimulationProgram::compile(quantumComputation);
+    ASSERT_TRUE(simulationProgram.has_value());
+    ASSERT_EQ(2, simulationProgram->getNumQubits());
+    ASSERT_EQ(0, simulationProgram->getNumInstructions());
+    ASSERT_EQ(0, simulationProgram->getNumGates());
+
+    NBitValuesContainer state(2, 2);
+    ASSERT_TRUE(simulationProgram->simulate(state));
+    ASSERT_EQ(NBitValuesContainer(2, 2), state);
+}
+
+TEST(SimulationProgramTests, CompileQuantumComputationWithUnsupportedGate) {
+    qc::QuantumComputation quantumComputation(2);
+    quantumComputation.h(0);
+    ASSERT_FALSE(SimulationProgram::compile(quantumComputation).has_value());
+}
+
+TEST(SimulationProgramTests, IndependentCnotGatesAreFused) {
+    qc::QuantumComputation quantumComputation(6);
+    quantumComputation.cx(0, 1);
+    quantumComputation.cx(0, 2);
+    quantumComputation.cx(3, 4);
+    // Control qubit is a target qubit of a previous CNOT gate of the sequence
+    quantumComputation.cx(4, 5);
+    quantumComputation.cx(0, 3);
+
+    const auto simulationProgram = SimulationProgram::compile(quantumComputation);
+    ASSERT_TRUE(simulationProgram.has_value());
+    ASSERT_EQ(5, simulationProgram->getNumGates());
+    ASSERT_EQ(2, simulationProgram->getNumInstructions());
+    ASSERT_NO_FATAL_FAILURE(assertCompiledProgramMatchesSimpleSimulationForAllInputStates(quantumComputation, *simulationProgram));
+}
+
+TEST(SimulationProgramTests, CnotGatesAreNotFusedIfRequested) {
+    qc::QuantumComputation quantumComputation(6);
+    quantumComputation.cx(0, 1);
+    quantumComputation.cx(0, 2);
+    quantumComputation.cx(3, 4);
+
+    const auto simulationProgram = SimulationProgram::compile(quantumComputation, false);
+    ASSERT_TRUE(simulationProgram.has_value());
+    ASSERT_EQ(3, simulationProgram->getNumGates());
+    ASSERT_EQ(3, simulationProgram->getNumInstructions());
+    ASSERT_NO_FATAL_FAILURE(assertCompiledProgramMatchesSimpleSimulationForAllInputStates(quantumComputation, *simulationProgram));
+
+    // Only the lanes of the mask are modified by a simulated instruction
+    std::vector<std::uint64_t> laneValuesPerQubit(6, 0U);
+    laneValuesPerQubit[0] = 0b11U;
+    simulationProgram->simulateInstruction(0, laneValuesPerQubit, 0b10U);
+    ASSERT_EQ(0b10U, laneValuesPerQubit[1]);
+}
+
+TEST(SimulationProgramTests, CnotGatesSeparatedByOtherGateAreNotFused) {
+    qc::QuantumComputation quantumComputation(4);
+    quantumComputation.cx(0, 1);
+    quantumComputation.mcx(qc::Controls({0, 1}), 2);
+    quantumComputation.cx(2, 3);
+
+    const auto simulationProgram = SimulationProgram::compile(quantumComputation);
+    ASSERT_TRUE(simulationProgram.has_value());
+    ASSERT_EQ(3, simulationProgram->getNumInstructions());
+    ASSERT_NO_FATAL_FAILURE(assertCompiledProgramMatchesSimpleSimulationForAllInputStates(quantumComputation, *simulationProgram));
+}
+
+TEST(SimulationProgramTests, SimulationOfMixedGatesMatchesSimpleSimulation) {
+    qc::QuantumComputation quantumComputation(5);
+    quantumComputation.x(4);
+    quantumComputation.mcx(qc::Controls({0, 2, 3}), 1);
+    quantumComputation.mcswap(qc::Controls({4}), 0, 3);
+    quantumComputation.swap(1, 2);
+    quantumComputation.cx(1, 0);
+    quantumComputation.cx(2, 4);
+
+    const auto simulationProgram = SimulationProgram::compile(quantumComputation);
+    ASSERT_TRUE(simulationProgram.has_value());
+    ASSERT_NO_FATAL_FAILURE(assertCompiledProgramMatchesSimpleSimulationForAllInputStates(quantumComputation, *simulationProgram));
+}
+
+TEST(SimulationProgramTests, SimulationOfGateWithNegativeControlQubit) {
+    qc::QuantumComputation quantumComputation(3);
+    quantumComputation.mcx(qc::Controls({qc::Control{0, qc::Control::Type::Neg}, qc::Control{1}}), 2);
+
+    const auto simulationProgram = SimulationProgram::compile(quantumComputation);
+    ASSERT_TRUE(simulationProgram.has_value());
+
+    NBitValuesContainer stateWithControlsSatisfied(3, 2); // 010
+    ASSERT_TRUE(simulationProgram->simulate(stateWithControlsSatisfied));
+    ASSERT_EQ("011", stateWithControlsSatisfied.stringify());
+
+    NBitValuesContainer stateWithControlsNotSatisfied(3, 3); // 110
+    ASSERT_TRUE(simulationProgram->simulate(stateWithControlsNotSatisfied));
+    ASSERT_EQ("110", stateWithControlsNotSatisfied.stringify());
+}
+
+TEST(SimulationProgramTests, SimulationOfGatesOnQubitsInDifferentWordsOfState) {
+    constexpr std::size_t  numQubits = 130;
+    qc::QuantumComputation quantumComputation(numQubits);
+    quantumComputation.mcx(qc::Controls({1, 70, 129}), 64);
+    quantumComputation.mcswap(qc::Controls({64}), 0, 128);
+
+    const auto simulationProgram = SimulationProgram::compile(quantumComputation);
+    ASSERT_TRUE(simulationProgram.has_value());
+
+    NBitValuesContainer state(numQubits);
+    ASSERT_TRUE(state.set(1));
+    ASSERT_TRUE(state.set(70));
+    ASSERT_TRUE(state.set(129));
+    ASSERT_TRUE(state.set(128));
+    ASSERT_TRUE(simulationProgram->simulate(state));
+    ASSERT_TRUE(state[64]);
+    ASSERT_TRUE(state[0]);
+    ASSERT_FALSE(state[128]);
+
+    std::vector<std::uint64_t> laneValuesPerQubit(numQubits, 0U);
+    laneValuesPerQubit[1]   = 0b11;
+    laneValuesPerQubit[70]  = 0b11;
+    laneValuesPerQubit[129] = 0b01;
+    laneValuesPerQubit[128] = 0b11;
+    ASSERT_TRUE(simulationProgram->simulate(laneValuesPerQubit));
+    ASSERT_EQ(0b01, laneValuesPerQubit[64]);
+    ASSERT_EQ(0b01, laneValuesPerQubit[0]);
+    ASSERT_EQ(0b10, laneValuesPerQubit[128]);
+}
+
+TEST(SimulationProgramTests, SimulationWithStateOfInvalidSize) {
+    qc::QuantumComputation quantumComputation(2);
+    quantumComputation.cx(0, 1);
+
+    const auto simulationProgram = SimulationProgram::compile(quantumComputation);
+    ASSERT_TRUE(simulationProgram.has_value());
+
+    NBitValuesContainer state(3);
+    ASSERT_FALSE(simulationProgram->simulate(state));
+
+    std::vector<std::uint64_t> laneValuesPerQubit(1, 0U);
+    ASSERT_FALSE(simulationProgram->simulate(laneValuesPerQubit));
+}
+
+TEST(SimulationProgramTests, IntegerBatchSimulationOfMoreInputStatesThanLanes) {
+    qc::QuantumComputation quantumComputation(64);
+    quantumComputation.mcx(qc::Controls({0, 63}), 32);
+    quantumComputation.swap(1, 62);
+
+    const auto simulationProgram = SimulationProgram::compile(quantumComputation);
+    ASSERT_TRUE(simulationProgram.has_value());
+
+    constexpr std::uint64_t    topmostQubit = static_cast<std::uint64_t>(1) << 63U;
+    std::vector<std::uint64_t> inputStates(BATCH_SIMULATION_LANE_COUNT + 3U, 0U);
+    inputStates.back()                            = topmostQubit | 0b11U;
+    inputStates[BATCH_SIMULATION_LANE_COUNT - 1U] = 0b10U;
+
+    std::vector<std::uint64_t> outputStates(inputStates.size(), 1U);
+    ASSERT_TRUE(batchSimulation(outputStates, *simulationProgram, inputStates));
+    for (std::size_t i = 0; i < inputStates.size() - 1U; ++i) {
+        ASSERT_EQ(i == BATCH_SIMULATION_LANE_COUNT - 1U ? static_cast<std::uint64_t>(1) << 62U : 0U, outputStates[i]) << "Output state mismatch for input state " << i;
+    }
+    ASSERT_EQ(topmostQubit | (static_cast<std::uint64_t>(1) << 62U) | (static_cast<std::uint64_t>(1) << 32U) | 0b01U, outputStates.back());
+}
+
+TEST(SimulationProgramTests, IntegerBatchSimulationWithInvalidInputStates) {
+    qc::QuantumComputation quantumComputation(2);
+    quantumComputation.cx(0, 1);
+
+    const auto simulationProgram = SimulationProgram::compile(quantumComputation);
+    ASSERT_TRUE(simulationProgram.has_value());
+
+    const std::vector<std::uint64_t> inputStateSettingUnknownQubit = {0b100U};
+    std::vector<std::uint64_t>       outputStates(1, 0U);
+    ASSERT_FALSE(batchSimulation(outputStates, *simulationProgram, inputStateSettingUnknownQubit));
+
+    const std::vector<std::uint64_t> inputStates = {0b01U, 0b10U};
+    ASSERT_FALSE(batchSimulation(outputStates, *simulationProgram, inputStates));
+}
+
+TEST(SimulationProgramTests, IntegerBatchSimulationOfSimulationProgramWithTooManyQubits) {
+    const auto simulationProgram = SimulationProgram::compile(qc::QuantumComputation(MAX_NUM_QUBITS_OF_INTEGER_BATCH_SIMULATION + 1U));
+    ASSERT_TRUE(simulationProgram.has_value());
+
+    const std::vector<std::uint64_t> inputStates = {0U};
+    std::vector<std::uint64_t>       outputStates(1, 0U);
+    ASSERT_FALSE(batchSimulation(outputStates, *simulationProgram, inputStates));
+}
+
+TEST(SimulationProgramTests, IntegerBatchSimulationIsCancelledByProgressCallback) {
+    qc::QuantumComputation quantumComputation(2);
+    quantumComputation.cx(0, 1);
+
+    const auto simulationProgram = SimulationProgram::compile(quantumComputation);
+    ASSERT_TRUE(simulationProgram.has_value());
+
+    // The progress is reported after every 64 blocks of lanes and after the last block
+    const std::vector<std::uint64_t> inputStates(BATCH_SIMULATION_LANE_COUNT * 64U * 2U + 1U, 0b01U);
+    std::vector<std::uint64_t>       outputStates(inputStates.size(), 0U);
+    std::vector<std::size_t>         reportedNumSimulatedInputs;
+    ASSERT_TRUE(batchSimulation(outputStates, *simulationProgram, inputStates, nullptr, [&](const std::size_t numSimulatedInputs, const std::size_t numInputs) {
+        EXPECT_EQ(inputStates.size(), numInputs);
+        reportedNumSimulatedInputs.emplace_back(numSimulatedInputs);
+        return true;
+    }));
+    ASSERT_EQ(std::vector<std::size_t>({BATCH_SIMULATION_LANE_COUNT * 64U, BATCH_SIMULATION_LANE_COUNT * 64U * 2U, inputStates.size()}), reportedNumSimulatedInputs);
+
+    std::ranges::fill(outputStates, 0U);
+    ASSERT_FALSE(batchSimulation(outputStates, *simulationProgram, inputStates, nullptr, [](const std::size_t, const std::size_t) { return false; }));
+    // The outputs of the input states simulated prior to the cancellation are determined
+    ASSERT_EQ(0b11U, outputStates[(BATCH_SIMULATION_LANE_COUNT * 64U) - 1U]);
+    ASSERT_EQ(0U, outputStates.back());
+}
+
+TEST(SimulationProgramTests, CompileFrozenQuantumComputation) {
+    AnnotatableQuantumComputation  annotatableQuantumComputation;
+    const std::optional<qc::Qubit> firstQubit = annotatableQuantumComputation.addPreliminaryAncillaryRegisterOrAppendToAdjacentOne("q", {false, false, false, false}, AnnotatableQuantumComputation::InlinedQubitInformation());
+    ASSERT_TRUE(firstQubit.has_value());
+    ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingCnotGate(0U, 1U));
+    ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingCnotGate(2U, 3U));
+    ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingToffoliGate(1U, 3U, 0U));
+    ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingFredkinGate(1U, 2U));
+    ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingNotGate(3U));
+
+    const FrozenQuantumComputation::ptr frozenQuantumComputation = annotatableQuantumComputation.freeze();
+    for (const bool fuseCnotGates: {false, true}) {
+        const auto simulationProgram = SimulationProgram::compile(*frozenQuantumComputation, fuseCnotGates);
+        ASSERT_TRUE(simulationProgram.has_value());
+        ASSERT_EQ(frozenQuantumComputation->getNumGates(), simulationProgram->getNumGates());
+        ASSERT_EQ(fuseCnotGates ? 4U : 5U, simulationProgram->getNumInstructions());
+        ASSERT_NO_FATAL_FAILURE(assertCompiledProgramMatchesSimpleSimulationForAllInputStates(annotatableQuantumComputation, *simulationProgram));
+    }
+
+    std::vector<NBitValuesContainer> inputStates;
+    for (std::uint64_t inputStateValue = 0; inputStateValue < 16U; ++inputStateValue) {
+        inputStates.emplace_back(4U, inputStateValue);
+    }
+    std::vector<NBitValuesContainer> expectedOutputStates;
+    std::vector<NBitValuesContainer> actualOutputStates;
+    ASSERT_NO_FATAL_FAILURE(batchSimulation(expectedOutputStates, annotatableQuantumComputation, inputStates));
+    ASSERT_NO_FATAL_FAILURE(batchSimulation(actualOutputStates, *frozenQuantumComputation, inputStates));
+    ASSERT_EQ(expectedOutputStates, actualOutputStates);
+}
+
+TEST(SimulationProgramTests, SimulationOfExportedGateArraysMatchesLaneSimulation) {
+    qc::QuantumComputation quantumComputation(5);
+    quantumComputation.cx(0, 1);
+    quantumComputation.cx(0, 2);
+    quantumComputation.mcx(qc::Controls({qc::Control(1), qc::Control(3, qc::Control::Type::Neg)}), 4);
+    quantumComputation.swap(2, 3);
+    quantumComputation.mcswap(qc::Controls({4}), 0, 1);
+    quantumComputation.x(3);
+
+    const auto simulationProgram = SimulationProgram::compile(quantumComputation);
+    ASSERT_TRUE(simulationProgram.has_value());
+
+    const SimulationProgram::GateArrays gateArrays = simulationProgram->exportGateArrays();
+    ASSERT_EQ(simulationProgram->getNumGates(), gateArrays.isSwapGate.size());
+    ASSERT_EQ(gateArrays.isSwapGate.size() + 1U, gateArrays.controlOffsets.size());
+    ASSERT_EQ(gateArrays.controlQubits.size(), gateArrays.controlPolarities.size());
+
+    // every lane simulates one of the 32 input states with the i-th qubit being the i-th bit of the lane index
+    std::vector<std::uint64_t> expectedLaneValuesPerQubit(5U, 0U);
+    for (std::size_t qubit = 0; qubit < expectedLaneValuesPerQubit.size(); ++qubit) {
+        for (std::uint64_t lane = 0; lane < 32U; ++lane) {
+            expectedLaneValuesPerQubit[qubit] |= ((lane >> qubit) & 1U) << lane;
+        }
+    }
+    std::vector<std::uint64_t> actualLaneValuesPerQubit = expectedLaneValuesPerQubit;
+    ASSERT_TRUE(simulationProgram->simulate(expectedLaneValuesPerQubit));
+
+    for (std::size_t gate = 0; gate < gateArrays.isSwapGate.size(); ++gate) {
+        std::uint64_t activeLanes = ~static_cast<std::uint64_t>(0U);
+        for (std::uint32_t i = gateArrays.controlOffsets[gate]; i < gateArrays.controlOffsets[gate + 1U]; ++i) {
+            const std::uint64_t lanesOfControlQubit = actualLaneValuesPerQubit[gateArrays.controlQubits[i]];
+            activeLanes &= gateArrays.controlPolarities[i] != 0U ? lanesOfControlQubit : ~lanesOfControlQubit;
+        }
+        if (gateArrays.isSwapGate[gate] != 0U) {
+            const std::uint64_t swappedLanes = (actualLaneValuesPerQubit[gateArrays.firstTargetQubits[gate]] ^ actualLaneValuesPerQubit[gateArrays.secondTargetQubits[gate]]) & activeLanes;
+            actualLaneValuesPerQubit[gateArrays.firstTargetQubits[gate]] ^= swappedLanes;
+            actualLaneValuesPerQubit[gateArrays.secondTargetQubits[gate]] ^= swappedLanes;
+        } else {
+            actualLaneValuesPerQubit[gateArrays.firstTargetQubits[gate]] ^= activeLanes;
+        }
+    }
+    ASSERT_EQ(expectedLaneValuesPerQubit, actualLaneValuesPerQubit);
+}
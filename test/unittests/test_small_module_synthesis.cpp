@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/equivalence_checking.hpp"
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "algorithms/synthesis/small_module_synthesis.hpp"
+#include "core/configurable_options.hpp"
+#include "core/syrec/program.hpp"
+#include "core/truthTable/truth_table.hpp"
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace syrec;
+
+namespace {
+    // a lookup module whose statement-wise synthesis requires ancillary qubits for the operands of the multiplication
+    constexpr auto STRINGIFIED_LOOKUP_PROGRAM = "module main(in a(3), out b(3))\nb ^= (a * a)";
+
+    class SmallModuleSynthesisTestFixture: public testing::TestWithParam<TruthTableSynthesisEngine> {
+    protected:
+        Program program;
+
+        void SetUp() override {
+            ASSERT_EQ("", program.readFromString(STRINGIFIED_LOOKUP_PROGRAM));
+        }
+    };
+
+    INSTANTIATE_TEST_SUITE_P(SmallModuleSynthesisTest, SmallModuleSynthesisTestFixture,
+                             testing::Values(TruthTableSynthesisEngine::OnePassDD, TruthTableSynthesisEngine::Esop),
+                             [](const testing::TestParamInfo<SmallModuleSynthesisTestFixture::ParamType>& info) {
+                                 return info.param == TruthTableSynthesisEngine::OnePassDD ? std::string("OnePassDD") : std::string("Esop");
+                             });
+} // namespace
+
+TEST_P(SmallModuleSynthesisTestFixture, TruthTableOfMainModuleStoresResultOfInterpretation) {
+    TruthTable tt;
+    ASSERT_TRUE(buildTruthTableOfMainModule(tt, program));
+    ASSERT_EQ(3U, tt.nInputs());
+    ASSERT_EQ(3U, tt.nOutputs());
+    ASSERT_EQ(8U, tt.size());
+    for (std::uint64_t a = 0U; a < 8U; ++a) {
+        const auto entry = tt.find(a, 3U);
+        ASSERT_NE(tt.end(), entry);
+        ASSERT_EQ(TruthTable::Cube::fromInteger((a * a) % 8U, 3U), entry->second);
+    }
+}
+
+TEST_P(SmallModuleSynthesisTestFixture, TruthTableIsNotBuiltForTooManyInputBits) {
+    TruthTable tt;
+    ASSERT_FALSE(buildTruthTableOfMainModule(tt, program, ConfigurableOptions(), 2U));
+}
+
+TEST_P(SmallModuleSynthesisTestFixture, CheaperVariantIsSelected) {
+    SmallModuleSynthesizer synthesizer(SmallModuleSynthesisSettings{.truthTableSynthesisEngine = GetParam()});
+    const auto             result = synthesizer.synthesize(program);
+    ASSERT_TRUE(result.has_value());
+    ASSERT_NE(nullptr, result->quantumComputation);
+    ASSERT_TRUE(result->quantumCostOfStatementWiseSynthesis.has_value());
+    ASSERT_TRUE(result->quantumCostOfTruthTableSynthesis.has_value());
+
+    if (result->origin == SmallModuleSynthesisResult::Origin::TruthTable) {
+        ASSERT_LE(*result->quantumCostOfTruthTableSynthesis, *result->quantumCostOfStatementWiseSynthesis);
+        TruthTable tt;
+        ASSERT_TRUE(buildTruthTableOfMainModule(tt, program));
+        ASSERT_EQ(EquivalenceCheckingResult::Outcome::Equivalent, checkEquivalence(*result->quantumComputation, tt).outcome);
+    } else {
+        ASSERT_LE(*result->quantumCostOfStatementWiseSynthesis, *result->quantumCostOfTruthTableSynthesis);
+    }
+}
+
+TEST_P(SmallModuleSynthesisTestFixture, SelectionIsReusedForProgramWithSameSignature) {
+    SmallModuleSynthesizer synthesizer(SmallModuleSynthesisSettings{.truthTableSynthesisEngine = GetParam()});
+    const auto             firstResult = synthesizer.synthesize(program);
+    ASSERT_TRUE(firstResult.has_value());
+    ASSERT_EQ(1U, synthesizer.getNumCachedSelections());
+    ASSERT_EQ(0U, synthesizer.getNumCacheHits());
+
+    Program programWithSameSignature;
+    ASSERT_EQ("", programWithSameSignature.readFromString(STRINGIFIED_LOOKUP_PROGRAM));
+    const auto secondResult = synthesizer.synthesize(programWithSameSignature);
+    ASSERT_TRUE(secondResult.has_value());
+    ASSERT_EQ(1U, synthesizer.getNumCacheHits());
+    ASSERT_EQ(firstResult->origin, secondResult->origin);
+    // only the previously selected variant is synthesized
+    ASSERT_EQ(firstResult->origin == SmallModuleSynthesisResult::Origin::StatementWise, secondResult->quantumCostOfStatementWiseSynthesis.has_value());
+    ASSERT_EQ(firstResult->origin == SmallModuleSynthesisResult::Origin::TruthTable, secondResult->quantumCostOfTruthTableSynthesis.has_value());
+
+    // the selection depends on the synthesis algorithm
+    ASSERT_TRUE(synthesizer.synthesize(program, SynthesisAlgorithm::LineAware).has_value());
+    ASSERT_EQ(2U, synthesizer.getNumCachedSelections());
+    ASSERT_EQ(1U, synthesizer.getNumCacheHits());
+
+    synthesizer.clear();
+    ASSERT_EQ(0U, synthesizer.getNumCachedSelections());
+}
+
+TEST_P(SmallModuleSynthesisTestFixture, ModuleWithTooManyInputBitsIsSynthesizedStatementWise) {
+    SmallModuleSynthesizer synthesizer(SmallModuleSynthesisSettings{.maxNumInputBits = 2U, .truthTableSynthesisEngine = GetParam()});
+    const auto             result = synthesizer.synthesize(program);
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(SmallModuleSynthesisResult::Origin::StatementWise, result->origin);
+    ASSERT_NE(nullptr, result->quantumComputation);
+    ASSERT_TRUE(result->quantumCostOfStatementWiseSynthesis.has_value());
+    ASSERT_FALSE(result->quantumCostOfTruthTableSynthesis.has_value());
+}
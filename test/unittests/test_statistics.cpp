@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/statistics.hpp"
+
+#include <chrono>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace syrec;
+
+TEST(StatisticsTests, RecordedRuntimeIsStoredInNanosecondsAndMilliseconds) {
+    Statistics statistics;
+    statistics.recordRuntime(std::chrono::microseconds(1500));
+    ASSERT_EQ(1500000U, statistics.runtimeInNanoseconds);
+    ASSERT_DOUBLE_EQ(1.5, statistics.runtimeInMilliseconds);
+}
+
+TEST(StatisticsTests, RecordedPeakResidentSetSizeIsNotZero) {
+    Statistics statistics;
+    statistics.recordPeakResidentSetSize();
+    ASSERT_GT(statistics.peakResidentSetSizeInBytes, 0U);
+}
+
+TEST(StatisticsTests, StringifiedStatisticsOfDefaultConstructedObject) {
+    const Statistics  statistics;
+    const std::string expectedJson = "{\"runtime_in_milliseconds\":0,\"runtime_in_nanoseconds\":0,\"parsing_runtime_in_nanoseconds\":0,\"semantic_check_runtime_in_nanoseconds\":0,"
+                                     "\"synthesis_runtime_in_nanoseconds\":0,\"optimization_runtime_in_nanoseconds\":0,\"num_reused_ancillary_qubits\":0,\"num_uncomputed_expressions\":0,"
+                                     "\"num_quantum_operations_of_uncomputed_expressions\":0,\"num_cancelled_quantum_operations\":0,"
+                                     "\"num_qubits\":0,\"num_ancillary_qubits\":0,\"num_quantum_operations\":0,\"num_quantum_operations_per_gate_type\":{},\"depth\":0,"
+                                     "\"num_expanded_module_calls\":0,\"num_reused_module_calls\":0,\"num_unrolled_loop_iterations\":0,\"num_replayed_loop_iterations\":0,"
+                                     "\"num_assignments_synthesized_cost_aware\":0,\"num_assignments_synthesized_line_aware\":0,\"estimated_num_quantum_operations_saved_by_hybrid_synthesis\":0,"
+                                     "\"estimated_num_ancillary_qubits_saved_by_hybrid_synthesis\":0,\"num_iterations_of_optimization_pipeline\":0,"
+                                     "\"statistics_per_optimization_pass\":{},\"num_synthesis_result_cache_hits\":0,\"num_synthesis_result_cache_misses\":0,"
+                                     "\"num_t_gates\":0,\"t_depth\":0,\"peak_resident_set_size_in_bytes\":0,\"memory_usage\":{\"num_bytes_of_program\":0,\"num_bytes_of_symbol_tables\":0,\"num_bytes_of_quantum_operations\":0,"
+                                     "\"num_bytes_of_quantum_operation_annotations\":0,\"num_bytes_of_quantum_register_layouts\":0,\"num_bytes_of_inline_stacks\":0,"
+                                     "\"resident_set_size_at_start_of_synthesis_in_bytes\":0,\"peak_resident_set_size_during_synthesis_in_bytes\":0},\"execution_limit_violation\":\"none\"}";
+    ASSERT_EQ(expectedJson, statistics.toJson());
+}
+
+TEST(StatisticsTests, StringifiedStatisticsContainNumberOfQuantumOperationsPerGateType) {
+    Statistics statistics;
+    statistics.numQuantumOperations            = 6;
+    statistics.numQuantumOperationsPerGateType = {{"x", 1}, {"cx", 2}, {"c3x", 3}};
+    statistics.numUnrolledLoopIterations       = 4;
+
+    const std::string stringifiedStatistics = statistics.toJson();
+    ASSERT_NE(std::string::npos, stringifiedStatistics.find("\"num_quantum_operations\":6,"));
+    ASSERT_NE(std::string::npos, stringifiedStatistics.find("\"num_quantum_operations_per_gate_type\":{\"c3x\":3,\"cx\":2,\"x\":1}"));
+    ASSERT_NE(std::string::npos, stringifiedStatistics.find("\"num_unrolled_loop_iterations\":4,"));
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/equivalence_checking.hpp"
+#include "algorithms/simulation/symbolic_simulation.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    // the qubits of the i-th bits of both operands of the ripple-carry adder
+    constexpr auto qubitOfFirstOperand(const std::size_t i) -> qc::Qubit {
+        return static_cast<qc::Qubit>(1U + 2U * i);
+    }
+
+    constexpr auto qubitOfSecondOperand(const std::size_t i) -> qc::Qubit {
+        return static_cast<qc::Qubit>(2U + 2U * i);
+    }
+
+    /*
+     * The ripple-carry adder of Cuccaro et al. adding the first operand to the second one with the incoming carry (qubit 0) and the outgoing carry (the last qubit) being ancillary,
+     * with the un-majority-and-add (UMA) gate being implemented either with two or with three CNOT gates.
+     */
+    auto createRippleCarryAdder(const std::size_t bitwidth, const bool useUmaWithThreeCnots) -> qc::QuantumComputation {
+        const auto             carryOut = static_cast<qc::Qubit>(2U * bitwidth + 1U);
+        qc::QuantumComputation quantumComputation(2U * bitwidth + 2U);
+        quantumComputation.setLogicalQubitAncillary(0);
+        quantumComputation.setLogicalQubitAncillary(carryOut);
+        quantumComputation.setLogicalQubitGarbage(0);
+
+        const auto carry = [](const std::size_t i) { return i == 0U ? static_cast<qc::Qubit>(0U) : qubitOfFirstOperand(i - 1U); };
+        for (std::size_t i = 0U; i < bitwidth; ++i) {
+            quantumComputation.cx(qubitOfFirstOperand(i), qubitOfSecondOperand(i));
+            quantumComputation.cx(qubitOfFirstOperand(i), carry(i));
+            quantumComputation.mcx(qc::Controls({carry(i), qubitOfSecondOperand(i)}), qubitOfFirstOperand(i));
+        }
+        quantumComputation.cx(qubitOfFirstOperand(bitwidth - 1U), carryOut);
+        for (std::size_t i = bitwidth; i-- > 0U;) {
+            if (useUmaWithThreeCnots) {
+                quantumComputation.x(qubitOfSecondOperand(i));
+                quantumComputation.cx(carry(i), qubitOfSecondOperand(i));
+                quantumComputation.mcx(qc::Controls({carry(i), qubitOfSecondOperand(i)}), qubitOfFirstOperand(i));
+                quantumComputation.x(qubitOfSecondOperand(i));
+                quantumComputation.cx(qubitOfFirstOperand(i), carry(i));
+                quantumComputation.cx(qubitOfFirstOperand(i), qubitOfSecondOperand(i));
+            } else {
+                quantumComputation.mcx(qc::Controls({carry(i), qubitOfSecondOperand(i)}), qubitOfFirstOperand(i));
+                quantumComputation.cx(qubitOfFirstOperand(i), carry(i));
+                quantumComputation.cx(carry(i), qubitOfSecondOperand(i));
+            }
+        }
+        return quantumComputation;
+    }
+} // namespace
+
+TEST(SymbolicSimulationTest, WideRippleCarryAddersAreEquivalent) {
+    // the 128 primary inputs are far beyond the limit of the exhaustive simulation-based check
+    const auto lhs = createRippleCarryAdder(64U, false);
+    const auto rhs = createRippleCarryAdder(64U, true);
+    for (const auto variableOrder: {SymbolicSimulationSettings::VariableOrder::PrimaryInputs, SymbolicSimulationSettings::VariableOrder::FirstUse}) {
+        const auto result = checkEquivalenceSymbolically(lhs, rhs, SymbolicSimulationSettings{.variableOrder = variableOrder});
+        ASSERT_EQ(EquivalenceCheckingResult::Outcome::Equivalent, result.outcome);
+        ASSERT_EQ(0U, result.numCheckedAssignments);
+        ASSERT_TRUE(result.counterexample.empty());
+    }
+}
+
+TEST(SymbolicSimulationTest, ModifiedGateYieldsCounterexample) {
+    const auto             lhs = createRippleCarryAdder(64U, false);
+    qc::QuantumComputation rhs(lhs.getNqubits());
+    rhs.setLogicalQubitAncillary(0);
+    rhs.setLogicalQubitAncillary(129);
+    rhs.setLogicalQubitGarbage(0);
+    // the bit of significance 40 of the second operand is flipped before the addition only if the bits of significance 20 of both operands are set
+    rhs.mcx(qc::Controls({qubitOfFirstOperand(20U), qubitOfSecondOperand(20U)}), qubitOfSecondOperand(40U));
+    for (const auto& operation: lhs) {
+        rhs.emplace_back(operation->clone());
+    }
+
+    const auto result = checkEquivalenceSymbolically(lhs, rhs);
+    ASSERT_EQ(EquivalenceCheckingResult::Outcome::NotEquivalent, result.outcome);
+    ASSERT_EQ(128U, result.counterexample.size());
+    // the primary inputs are ordered by descending qubit index, i.e. the i-th primary input corresponds to the qubit 128 - i
+    const auto valueOfQubit = [&result](const qc::Qubit qubit) { return result.counterexample[128U - qubit]; };
+    ASSERT_TRUE(valueOfQubit(qubitOfFirstOperand(20U)));
+    ASSERT_TRUE(valueOfQubit(qubitOfSecondOperand(20U)));
+}
+
+TEST(SymbolicSimulationTest, ValuesOfGarbageLinesAreIgnored) {
+    qc::QuantumComputation lhs(3U);
+    lhs.setLogicalQubitGarbage(1);
+    lhs.mcx(qc::Controls({1, 2}), 0);
+    lhs.cx(2, 1);
+
+    qc::QuantumComputation rhs(3U);
+    rhs.setLogicalQubitGarbage(1);
+    rhs.mcx(qc::Controls({1, 2}), 0);
+    // the exchanged values are equal whenever the controls are satisfied
+    rhs.mcswap(qc::Controls({1, 2}), 1, 2);
+    rhs.x(1);
+    ASSERT_EQ(EquivalenceCheckingResult::Outcome::Equivalent, checkEquivalenceSymbolically(lhs, rhs).outcome);
+}
+
+TEST(SymbolicSimulationTest, ExceedingMaximumNumberOfNodesIsReported) {
+    const auto lhs    = createRippleCarryAdder(16U, false);
+    const auto rhs    = createRippleCarryAdder(16U, true);
+    const auto result = checkEquivalenceSymbolically(lhs, rhs, SymbolicSimulationSettings{.maxNumNodes = 16U});
+    ASSERT_EQ(EquivalenceCheckingResult::Outcome::LimitExceeded, result.outcome);
+    ASSERT_TRUE(result.counterexample.empty());
+}
+
+TEST(SymbolicSimulationTest, DifferentNumberOfPrimaryLinesIsNotEquivalent) {
+    const auto lhs = createRippleCarryAdder(4U, false);
+    auto       rhs = createRippleCarryAdder(4U, false);
+    rhs.setLogicalQubitGarbage(qubitOfFirstOperand(0U));
+
+    const auto result = checkEquivalenceSymbolically(lhs, rhs);
+    ASSERT_EQ(EquivalenceCheckingResult::Outcome::NotEquivalent, result.outcome);
+    ASSERT_TRUE(result.counterexample.empty());
+}
+
+TEST(SymbolicSimulationTest, NonClassicalGatesAreNotSupported) {
+    auto quantumComputation = createRippleCarryAdder(2U, false);
+    quantumComputation.h(1);
+    ASSERT_EQ(EquivalenceCheckingResult::Outcome::NotSupported, checkEquivalenceSymbolically(quantumComputation, quantumComputation).outcome);
+}
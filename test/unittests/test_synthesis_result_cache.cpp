@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "algorithms/synthesis/synthesis_result_cache.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/statistics.hpp"
+#include "core/syrec/program.hpp"
+
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <memory>
+#include <optional>
+#include <string>
+
+using namespace syrec;
+
+namespace {
+    constexpr auto PATH_TO_SYREC_CIRCUITS = "./circuits";
+
+    class SynthesisResultCacheTestFixture: public testing::Test {
+    protected:
+        std::filesystem::path onDiskCacheDirectory = std::filesystem::temp_directory_path() / "mqt_syrec_synthesis_result_cache_tests";
+        Program               program;
+
+        void SetUp() override {
+            std::filesystem::remove_all(onDiskCacheDirectory);
+            ASSERT_EQ("", program.read(PATH_TO_SYREC_CIRCUITS + std::string("/call_8.src")));
+        }
+
+        void TearDown() override {
+            std::filesystem::remove_all(onDiskCacheDirectory);
+        }
+
+        static void assertQuantumComputationsAreEqual(const AnnotatableQuantumComputation& expectedQuantumComputation, const AnnotatableQuantumComputation* actualQuantumComputation) {
+            ASSERT_NE(nullptr, actualQuantumComputation);
+            ASSERT_EQ(expectedQuantumComputation.getNqubits(), actualQuantumComputation->getNqubits());
+            ASSERT_EQ(expectedQuantumComputation.getNops(), actualQuantumComputation->getNops());
+            ASSERT_EQ(expectedQuantumComputation.getQuantumCostForSynthesis(), actualQuantumComputation->getQuantumCostForSynthesis());
+            ASSERT_EQ(expectedQuantumComputation.serialize(), actualQuantumComputation->serialize());
+        }
+    };
+} // namespace
+
+TEST_F(SynthesisResultCacheTestFixture, RepeatedlySynthesizedProgramIsLoadedFromCache) {
+    AnnotatableQuantumComputation expectedQuantumComputation;
+    Statistics                    expectedStatistics;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(expectedQuantumComputation, program, ConfigurableOptions(), &expectedStatistics));
+
+    SynthesisResultCache cache;
+    Statistics           statisticsOfSynthesizedResult;
+    const auto           synthesizedQuantumComputation = cache.synthesize(program, SynthesisAlgorithm::CostAware, ConfigurableOptions(), &statisticsOfSynthesizedResult);
+    ASSERT_NO_FATAL_FAILURE(assertQuantumComputationsAreEqual(expectedQuantumComputation, synthesizedQuantumComputation.get()));
+    ASSERT_EQ(0U, statisticsOfSynthesizedResult.numSynthesisResultCacheHits);
+    ASSERT_EQ(1U, statisticsOfSynthesizedResult.numSynthesisResultCacheMisses);
+
+    Statistics statisticsOfCachedResult;
+    const auto cachedQuantumComputation = cache.synthesize(program, SynthesisAlgorithm::CostAware, ConfigurableOptions(), &statisticsOfCachedResult);
+    ASSERT_NO_FATAL_FAILURE(assertQuantumComputationsAreEqual(expectedQuantumComputation, cachedQuantumComputation.get()));
+    ASSERT_EQ(1U, cache.getNumCacheHits());
+    ASSERT_EQ(1U, cache.getNumCacheMisses());
+    ASSERT_EQ(1U, statisticsOfCachedResult.numSynthesisResultCacheHits);
+    ASSERT_EQ(1U, statisticsOfCachedResult.numSynthesisResultCacheMisses);
+    ASSERT_EQ(0U, statisticsOfCachedResult.synthesisRuntimeInNanoseconds);
+    ASSERT_EQ(expectedStatistics.numQubits, statisticsOfCachedResult.numQubits);
+    ASSERT_EQ(expectedStatistics.numQuantumOperations, statisticsOfCachedResult.numQuantumOperations);
+    ASSERT_EQ(expectedStatistics.numQuantumOperationsPerGateType, statisticsOfCachedResult.numQuantumOperationsPerGateType);
+    ASSERT_EQ(expectedStatistics.numExpandedModuleCalls, statisticsOfCachedResult.numExpandedModuleCalls);
+
+    // Every quantum computation loaded from the cache is a separate object
+    ASSERT_NE(synthesizedQuantumComputation.get(), cachedQuantumComputation.get());
+}
+
+TEST_F(SynthesisResultCacheTestFixture, ProgramsWithIdenticalIrShareCacheEntry) {
+    Program firstProgram;
+    ASSERT_EQ("", firstProgram.readFromString("module main(inout a(4), in b(4)) a += b"));
+    Program secondProgram;
+    ASSERT_EQ("", secondProgram.readFromString("module   main( inout a(4),in b(4) )\ta += b"));
+
+    SynthesisResultCache cache;
+    ASSERT_NE(nullptr, cache.synthesize(firstProgram));
+    ASSERT_NE(nullptr, cache.synthesize(secondProgram));
+    ASSERT_EQ(1U, cache.getNumCacheHits());
+    ASSERT_EQ(1U, cache.getNumCachedResults());
+}
+
+TEST_F(SynthesisResultCacheTestFixture, ProgramIsSynthesizedAgainForDifferentSynthesizerOrSynthesisRelevantOptions) {
+    SynthesisResultCache cache;
+    ASSERT_NE(nullptr, cache.synthesize(program, SynthesisAlgorithm::CostAware));
+    ASSERT_NE(nullptr, cache.synthesize(program, SynthesisAlgorithm::LineAware));
+
+    ConfigurableOptions settings;
+    settings.reuseSynthesizedModuleCalls = false;
+    ASSERT_NE(nullptr, cache.synthesize(program, SynthesisAlgorithm::CostAware, settings));
+    ASSERT_EQ(0U, cache.getNumCacheHits());
+    ASSERT_EQ(3U, cache.getNumCacheMisses());
+
+    // Options only used by the parser do not influence the synthesis result
+    settings.optionalMaxNumReportedParserErrors = 1U;
+    ASSERT_NE(nullptr, cache.synthesize(program, SynthesisAlgorithm::CostAware, settings));
+    ASSERT_EQ(1U, cache.getNumCacheHits());
+}
+
+TEST_F(SynthesisResultCacheTestFixture, LeastRecentlyUsedResultIsEvicted) {
+    SynthesisResultCache cache(1U);
+    ASSERT_NE(nullptr, cache.synthesize(program, SynthesisAlgorithm::CostAware));
+    ASSERT_NE(nullptr, cache.synthesize(program, SynthesisAlgorithm::LineAware));
+    ASSERT_EQ(1U, cache.getNumCachedResults());
+
+    ASSERT_NE(nullptr, cache.synthesize(program, SynthesisAlgorithm::CostAware));
+    ASSERT_EQ(0U, cache.getNumCacheHits());
+    ASSERT_EQ(3U, cache.getNumCacheMisses());
+}
+
+TEST_F(SynthesisResultCacheTestFixture, ResultIsLoadedFromOnDiskCache) {
+    AnnotatableQuantumComputation expectedQuantumComputation;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(expectedQuantumComputation, program));
+
+    {
+        SynthesisResultCache cache(SynthesisResultCache::DEFAULT_MAX_NUM_CACHED_RESULTS, onDiskCacheDirectory.string());
+        ASSERT_NE(nullptr, cache.synthesize(program));
+    }
+
+    // A new cache, i.e. of another process, without any in-memory entries loads the result from the on-disk cache
+    SynthesisResultCache cache(SynthesisResultCache::DEFAULT_MAX_NUM_CACHED_RESULTS, onDiskCacheDirectory.string());
+    const auto           cachedQuantumComputation = cache.synthesize(program);
+    ASSERT_NO_FATAL_FAILURE(assertQuantumComputationsAreEqual(expectedQuantumComputation, cachedQuantumComputation.get()));
+    ASSERT_EQ(1U, cache.getNumCacheHits());
+    ASSERT_EQ(0U, cache.getNumCacheMisses());
+}
+
+TEST_F(SynthesisResultCacheTestFixture, CorruptedOnDiskCacheEntryIsReplaced) {
+    {
+        SynthesisResultCache cache(SynthesisResultCache::DEFAULT_MAX_NUM_CACHED_RESULTS, onDiskCacheDirectory.string());
+        ASSERT_NE(nullptr, cache.synthesize(program));
+    }
+    for (const auto& onDiskCacheEntry: std::filesystem::directory_iterator(onDiskCacheDirectory)) {
+        std::filesystem::resize_file(onDiskCacheEntry.path(), std::filesystem::file_size(onDiskCacheEntry.path()) / 2U);
+    }
+
+    SynthesisResultCache cache(SynthesisResultCache::DEFAULT_MAX_NUM_CACHED_RESULTS, onDiskCacheDirectory.string());
+    ASSERT_NE(nullptr, cache.synthesize(program));
+    ASSERT_EQ(0U, cache.getNumCacheHits());
+    ASSERT_EQ(1U, cache.getNumCacheMisses());
+}
+
+TEST_F(SynthesisResultCacheTestFixture, FailedSynthesisIsNotCached) {
+    ConfigurableOptions settings;
+    settings.optionalProgramEntryPointModuleIdentifier = "notExistingModule";
+
+    SynthesisResultCache cache;
+    ASSERT_EQ(nullptr, cache.synthesize(program, SynthesisAlgorithm::CostAware, settings));
+    ASSERT_EQ(0U, cache.getNumCachedResults());
+}
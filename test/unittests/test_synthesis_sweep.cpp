@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "algorithms/synthesis/synthesis_sweep.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/syrec/program.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <string_view>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    constexpr std::string_view STRINGIFIED_PROGRAM = "module add(inout a(4), in b(4)) a += b module main(inout a(4), in b(4), out c(4)) call add(a, b); c ^= (a + b); uncall add(a, b)";
+
+    [[nodiscard]] SynthesisSweepVariant createVariant(const SynthesisAlgorithm synthesisAlgorithm, const AdderArchitecture adderArchitecture) {
+        SynthesisSweepVariant variant;
+        variant.synthesisAlgorithm         = synthesisAlgorithm;
+        variant.settings.adderArchitecture = adderArchitecture;
+        return variant;
+    }
+
+    [[nodiscard]] std::vector<SynthesisSweepVariant> createVariantsOfSynthesizersAndAdderArchitectures() {
+        std::vector<SynthesisSweepVariant> variants;
+        for (const auto synthesisAlgorithm: {SynthesisAlgorithm::CostAware, SynthesisAlgorithm::LineAware}) {
+            for (const auto adderArchitecture: {AdderArchitecture::RippleCarry, AdderArchitecture::Cuccaro, AdderArchitecture::CarryLookahead}) {
+                variants.emplace_back(createVariant(synthesisAlgorithm, adderArchitecture));
+            }
+        }
+        return variants;
+    }
+} // namespace
+
+TEST(SynthesisSweepTests, SweepMatchesSynthesisOfEveryVariantAndParsesProgramOnce) {
+    const std::vector<SynthesisSweepVariant> variants = createVariantsOfSynthesizersAndAdderArchitectures();
+
+    SynthesisSweepResult result;
+    synthesisSweep(result, STRINGIFIED_PROGRAM, variants);
+    ASSERT_EQ(variants.size(), result.entries.size());
+    ASSERT_EQ(1U, result.numParsedPrograms);
+    ASSERT_EQ(variants.size(), result.numSynthesizedVariants);
+
+    Program program;
+    ASSERT_EQ("", program.readFromString(STRINGIFIED_PROGRAM));
+    for (std::size_t i = 0; i < variants.size(); ++i) {
+        AnnotatableQuantumComputation expectedAnnotatableQuantumComputation;
+        const bool                    expectedSynthesisResult = variants[i].synthesisAlgorithm == SynthesisAlgorithm::CostAware
+                                                                        ? CostAwareSynthesis::synthesize(expectedAnnotatableQuantumComputation, program, variants[i].settings)
+                                                                        : LineAwareSynthesis::synthesize(expectedAnnotatableQuantumComputation, program, variants[i].settings);
+        ASSERT_TRUE(expectedSynthesisResult);
+
+        const SynthesisSweepEntry& entry = result.entries[i];
+        ASSERT_TRUE(entry.synthesisOk) << "Synthesis of variant " << i << " failed";
+        ASSERT_EQ(i, entry.indexOfSynthesizedVariant);
+        ASSERT_EQ(expectedAnnotatableQuantumComputation.getNqubits(), entry.statistics.numQubits) << "Qubit count mismatch for variant " << i;
+        ASSERT_EQ(expectedAnnotatableQuantumComputation.getQuantumCostForSynthesis(), entry.quantumCost) << "Quantum cost mismatch for variant " << i;
+        ASSERT_EQ(nullptr, entry.annotatableQuantumComputation) << "Quantum computation of variant " << i << " should not be kept";
+    }
+}
+
+TEST(SynthesisSweepTests, VariantsWithIdenticalSynthesisRelevantSettingsAreSynthesizedOnce) {
+    std::vector<SynthesisSweepVariant> variants(3, createVariant(SynthesisAlgorithm::CostAware, AdderArchitecture::Cuccaro));
+    // The number of threads of the concurrent synthesis does not influence the synthesized quantum computation.
+    variants[1].settings.numThreadsOfConcurrentSynthesis = 2U;
+    variants[2].synthesisAlgorithm                       = SynthesisAlgorithm::LineAware;
+
+    SynthesisSweepResult result;
+    synthesisSweep(result, STRINGIFIED_PROGRAM, variants, SynthesisSweepSettings{.numThreads = 1U, .deterministic = true, .keepParetoOptimalQuantumComputations = true});
+    ASSERT_EQ(1U, result.numParsedPrograms);
+    ASSERT_EQ(2U, result.numSynthesizedVariants);
+    ASSERT_EQ(0U, result.entries[0].indexOfSynthesizedVariant);
+    ASSERT_EQ(0U, result.entries[1].indexOfSynthesizedVariant);
+    ASSERT_EQ(2U, result.entries[2].indexOfSynthesizedVariant);
+    ASSERT_TRUE(result.entries[1].synthesisOk);
+    ASSERT_EQ(result.entries[0].statistics.numQubits, result.entries[1].statistics.numQubits);
+    ASSERT_EQ(result.entries[0].quantumCost, result.entries[1].quantumCost);
+    ASSERT_EQ(result.entries[0].isParetoOptimal, result.entries[1].isParetoOptimal);
+    ASSERT_EQ(result.entries[0].annotatableQuantumComputation, result.entries[1].annotatableQuantumComputation);
+}
+
+TEST(SynthesisSweepTests, ProgramIsParsedOncePerParserRelevantSettings) {
+    constexpr std::string_view stringifiedProgram = "module first(inout a(4)) ++= a module second(inout a(4), inout b) --= a; ~= b";
+
+    std::vector<SynthesisSweepVariant> variants(4);
+    variants[0].settings.optionalProgramEntryPointModuleIdentifier = "first";
+    variants[1].settings.optionalProgramEntryPointModuleIdentifier = "second";
+    variants[2].settings.optionalProgramEntryPointModuleIdentifier = "second";
+    variants[2].settings.defaultBitwidth                           = 8U;
+    variants[3].settings.optionalProgramEntryPointModuleIdentifier = "first";
+    variants[3].synthesisAlgorithm                                 = SynthesisAlgorithm::LineAware;
+
+    SynthesisSweepResult result;
+    synthesisSweep(result, stringifiedProgram, variants);
+    ASSERT_EQ(3U, result.numParsedPrograms);
+    ASSERT_EQ(4U, result.numSynthesizedVariants);
+    for (const auto& entry: result.entries) {
+        ASSERT_TRUE(entry.synthesisOk);
+    }
+    // The variable 'b' of the second module uses the default bitwidth.
+    ASSERT_LT(result.entries[0].statistics.numQubits, result.entries[1].statistics.numQubits);
+    ASSERT_LT(result.entries[2].statistics.numQubits, result.entries[1].statistics.numQubits);
+}
+
+TEST(SynthesisSweepTests, ParserErrorsAreReportedForEveryVariantOfParsedProgram) {
+    std::vector<SynthesisSweepVariant> variants(2);
+    variants[1].synthesisAlgorithm = SynthesisAlgorithm::LineAware;
+
+    SynthesisSweepResult result;
+    synthesisSweep(result, "module main(inout a(4)) a += b", variants);
+    ASSERT_EQ(1U, result.numParsedPrograms);
+    ASSERT_EQ(0U, result.numSynthesizedVariants);
+    for (const auto& entry: result.entries) {
+        ASSERT_FALSE(entry.synthesisOk);
+        ASSERT_FALSE(entry.isParetoOptimal);
+        ASSERT_TRUE(entry.diagnostics.hasErrors());
+    }
+}
+
+TEST(SynthesisSweepTests, OnlyQuantumComputationsOfParetoOptimalVariantsAreKept) {
+    const std::vector<SynthesisSweepVariant> variants = createVariantsOfSynthesizersAndAdderArchitectures();
+
+    SynthesisSweepResult result;
+    synthesisSweep(result, STRINGIFIED_PROGRAM, variants, SynthesisSweepSettings{.numThreads = 0U, .deterministic = false, .keepParetoOptimalQuantumComputations = true});
+    std::size_t numParetoOptimalVariants = 0;
+    for (const auto& entry: result.entries) {
+        ASSERT_TRUE(entry.synthesisOk);
+        bool isDominated = false;
+        for (const auto& other: result.entries) {
+            isDominated |= other.statistics.numQubits <= entry.statistics.numQubits && other.quantumCost <= entry.quantumCost && (other.statistics.numQubits < entry.statistics.numQubits || other.quantumCost < entry.quantumCost);
+        }
+        ASSERT_EQ(!isDominated, entry.isParetoOptimal);
+        if (entry.isParetoOptimal) {
+            ++numParetoOptimalVariants;
+            ASSERT_NE(nullptr, entry.annotatableQuantumComputation);
+            ASSERT_EQ(entry.statistics.numQubits, entry.annotatableQuantumComputation->getNqubits());
+        } else {
+            ASSERT_EQ(nullptr, entry.annotatableQuantumComputation);
+        }
+    }
+    ASSERT_LE(1U, numParetoOptimalVariants);
+}
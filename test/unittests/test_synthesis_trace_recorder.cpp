@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/synthesis_trace_recorder.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+
+#include <chrono>
+#include <gtest/gtest.h>
+#include <optional>
+#include <string>
+
+using namespace syrec;
+
+TEST(SynthesisTraceRecorderTests, StringifiedTraceWithoutEvents) {
+    const SynthesisTraceRecorder traceRecorder;
+    ASSERT_EQ("{\"traceEvents\":[\n],\"displayTimeUnit\":\"ns\"}", traceRecorder.toChromeTraceEventJson());
+}
+
+TEST(SynthesisTraceRecorderTests, StringifiedTraceContainsCompleteEventsWithTimestampsInMicroseconds) {
+    SynthesisTraceRecorder traceRecorder;
+    const auto             eventStartTime = std::chrono::steady_clock::now();
+    traceRecorder.recordEvent("statement", "AssignStatement", 3U, eventStartTime, eventStartTime + std::chrono::nanoseconds(1005), 2U);
+    traceRecorder.recordEvent("module call", "\"add\"", std::nullopt, eventStartTime, eventStartTime + std::chrono::nanoseconds(70), 0U);
+
+    ASSERT_EQ(2U, traceRecorder.getEvents().size());
+    const std::string stringifiedTrace = traceRecorder.toChromeTraceEventJson();
+    ASSERT_NE(std::string::npos, stringifiedTrace.find("{\"name\":\"AssignStatement\",\"cat\":\"statement\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":"));
+    ASSERT_NE(std::string::npos, stringifiedTrace.find(",\"dur\":1.005,\"args\":{\"num_emitted_quantum_operations\":2,\"line_number\":3}}"));
+    ASSERT_NE(std::string::npos, stringifiedTrace.find("{\"name\":\"\\\"add\\\"\",\"cat\":\"module call\""));
+    ASSERT_NE(std::string::npos, stringifiedTrace.find(",\"dur\":0.070,\"args\":{\"num_emitted_quantum_operations\":0}}"));
+}
+
+TEST(SynthesisTraceRecorderTests, ScopedEventRecordsNumberOfEmittedQuantumOperations) {
+    SynthesisTraceRecorder        traceRecorder;
+    AnnotatableQuantumComputation annotatableQuantumComputation;
+    ASSERT_TRUE(annotatableQuantumComputation.addQuantumRegisterForSyrecVariable("a", AnnotatableQuantumComputation::AssociatedVariableLayoutInformation({.numValuesPerDimension = {1U}, .bitwidth = 1U}), false).has_value());
+    {
+        const ScopedSynthesisTraceEvent outerEvent(&traceRecorder, annotatableQuantumComputation, "statement", "UnaryStatement", 1U);
+        ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingNotGate(0));
+        {
+            const ScopedSynthesisTraceEvent innerEvent(&traceRecorder, annotatableQuantumComputation, "expression", "UnaryExpression");
+            ASSERT_TRUE(annotatableQuantumComputation.addOperationsImplementingNotGate(0));
+        }
+    }
+
+    const auto& recordedEvents = traceRecorder.getEvents();
+    ASSERT_EQ(2U, recordedEvents.size());
+    ASSERT_EQ("UnaryExpression", recordedEvents[0].name);
+    ASSERT_EQ(1U, recordedEvents[0].numEmittedQuantumOperations);
+    ASSERT_FALSE(recordedEvents[0].lineNumber.has_value());
+    ASSERT_EQ("UnaryStatement", recordedEvents[1].name);
+    ASSERT_EQ("statement", recordedEvents[1].category);
+    ASSERT_EQ(2U, recordedEvents[1].numEmittedQuantumOperations);
+    ASSERT_EQ(std::optional(1U), recordedEvents[1].lineNumber);
+    ASSERT_LE(recordedEvents[1].startTimestampInNanoseconds, recordedEvents[0].startTimestampInNanoseconds);
+}
+
+TEST(SynthesisTraceRecorderTests, ScopedEventWithoutRecorderIsIgnored) {
+    const AnnotatableQuantumComputation annotatableQuantumComputation;
+    const ScopedSynthesisTraceEvent     event(nullptr, annotatableQuantumComputation, "statement", "SkipStatement");
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/syrec/expression.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/number.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+#include "syrec_ir_builder.hpp"
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+using namespace syrec;
+using namespace syrec_ir_builder;
+
+TEST(SyrecIrEntityKindTests, KindOfStatementMatchesItsDerivedType) {
+    const VariableAccess::ptr variableAccess = createVariableAccess(std::make_shared<Variable>(Variable::Type::Inout, "a", std::vector<unsigned>({1U}), 4U));
+    const auto                calledModule   = std::make_shared<Module>("add");
+
+    ASSERT_EQ(Statement::Kind::Skip, SkipStatement().getKind());
+    ASSERT_EQ(Statement::Kind::Swap, SwapStatement(variableAccess, variableAccess).getKind());
+    ASSERT_EQ(Statement::Kind::Unary, UnaryStatement(UnaryStatement::UnaryOperation::Increment, variableAccess).getKind());
+    ASSERT_EQ(Statement::Kind::Assign, AssignStatement(variableAccess, AssignStatement::AssignOperation::Add, std::make_shared<VariableExpression>(variableAccess)).getKind());
+    ASSERT_EQ(Statement::Kind::If, IfStatement().getKind());
+    ASSERT_EQ(Statement::Kind::For, ForStatement().getKind());
+    ASSERT_EQ(Statement::Kind::Call, CallStatement(calledModule, {}).getKind());
+    ASSERT_EQ(Statement::Kind::Uncall, UncallStatement(calledModule, {}).getKind());
+}
+
+TEST(SyrecIrEntityKindTests, KindOfExpressionMatchesItsDerivedType) {
+    const Expression::ptr numericExpression = std::make_shared<NumericExpression>(std::make_shared<Number>(2U), 4U);
+    const Expression::ptr variableExpression = std::make_shared<VariableExpression>(createVariableAccess(std::make_shared<Variable>(Variable::Type::Inout, "a", std::vector<unsigned>({1U}), 4U)));
+
+    ASSERT_EQ(Expression::Kind::Numeric, numericExpression->getKind());
+    ASSERT_EQ(Expression::Kind::Variable, variableExpression->getKind());
+    ASSERT_EQ(Expression::Kind::Binary, BinaryExpression(variableExpression, BinaryExpression::BinaryOperation::Add, numericExpression).getKind());
+    ASSERT_EQ(Expression::Kind::Shift, ShiftExpression(variableExpression, ShiftExpression::ShiftOperation::Left, std::make_shared<Number>(1U)).getKind());
+    ASSERT_EQ(Expression::Kind::Unary, UnaryExpression(UnaryExpression::UnaryOperation::BitwiseNegation, variableExpression).getKind());
+}
+
+TEST(SyrecIrEntityKindTests, CastOfStatementOnlySucceedsForMatchingKind) {
+    const VariableAccess::ptr variableAccess = createVariableAccess(std::make_shared<Variable>(Variable::Type::Inout, "a", std::vector<unsigned>({1U}), 4U));
+    const Statement::ptr      statement      = std::make_shared<UnaryStatement>(UnaryStatement::UnaryOperation::Increment, variableAccess);
+
+    ASSERT_EQ(statement.get(), statementCast<UnaryStatement>(statement.get()));
+    ASSERT_EQ(nullptr, statementCast<AssignStatement>(statement.get()));
+    ASSERT_EQ(nullptr, statementCast<SkipStatement>(static_cast<const Statement*>(nullptr)));
+
+    const std::shared_ptr<UnaryStatement> statementAsUnaryStatement = statementPointerCast<UnaryStatement>(statement);
+    ASSERT_EQ(statement, statementAsUnaryStatement);
+    ASSERT_EQ(nullptr, statementPointerCast<SwapStatement>(statement));
+    ASSERT_EQ(nullptr, statementPointerCast<SwapStatement>(Statement::ptr()));
+
+    // The inversion of a statement must create a statement of the same kind
+    const auto invertedStatement = statement->reverse();
+    ASSERT_TRUE(invertedStatement.has_value());
+    ASSERT_NE(nullptr, statementCast<UnaryStatement>(invertedStatement->get()));
+    ASSERT_EQ(UnaryStatement::UnaryOperation::Decrement, statementCast<UnaryStatement>(invertedStatement->get())->unaryOperation);
+}
+
+TEST(SyrecIrEntityKindTests, CastOfExpressionOnlySucceedsForMatchingKind) {
+    const Expression::ptr expression = std::make_shared<NumericExpression>(std::make_shared<Number>(2U), 4U);
+
+    ASSERT_EQ(expression.get(), expressionCast<NumericExpression>(expression.get()));
+    ASSERT_EQ(nullptr, expressionCast<VariableExpression>(expression.get()));
+    ASSERT_EQ(nullptr, expressionCast<NumericExpression>(static_cast<const Expression*>(nullptr)));
+
+    ASSERT_EQ(expression, expressionPointerCast<NumericExpression>(expression));
+    ASSERT_EQ(nullptr, expressionPointerCast<BinaryExpression>(expression));
+    ASSERT_EQ(nullptr, expressionPointerCast<BinaryExpression>(Expression::ptr()));
+}
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/truthTable/truth_table.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <gtest/gtest.h>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    // creates a completely specified truth table with n inputs and outputs computing the given function
+    template<typename Function>
+    auto createCompleteTruthTable(const std::size_t n, const Function& function) -> TruthTable {
+        TruthTable tt{};
+        for (std::uint64_t input = 0U; input < (static_cast<std::uint64_t>(1U) << n); ++input) {
+            tt.try_emplace(TruthTable::Cube::fromInteger(input, n), TruthTable::Cube::fromInteger(function(input), n));
+        }
+        tt.setConstants(std::vector<bool>(n, false));
+        tt.setGarbage(std::vector<bool>(n, false));
+        return tt;
+    }
+} // namespace
+
+TEST(TruthTableTests, EqualityIgnoresGarbageOutputs) {
+    auto tt1 = createCompleteTruthTable(3U, [](const std::uint64_t input) { return input; });
+    auto tt2 = createCompleteTruthTable(3U, [](const std::uint64_t input) { return input ^ 0b100U; });
+    ASSERT_FALSE(TruthTable::equal(tt1, tt2));
+
+    // the first position of an output cube is associated with the last line
+    tt1.setGarbage(2U);
+    tt2.setGarbage(2U);
+    ASSERT_TRUE(TruthTable::equal(tt1, tt2));
+    ASSERT_FALSE(TruthTable::equal(tt1, tt2, false));
+}
+
+TEST(TruthTableTests, EqualityUpToDontCareOfOutputs) {
+    TruthTable tt1{};
+    TruthTable tt2{};
+    tt1.try_emplace(TruthTable::Cube::fromString("01"), TruthTable::Cube::fromString("1-"));
+    tt2.try_emplace(TruthTable::Cube::fromString("01"), TruthTable::Cube::fromString("10"));
+    for (auto* tt: {&tt1, &tt2}) {
+        tt->setConstants({false, false});
+        tt->setGarbage({false, false});
+    }
+    ASSERT_TRUE(TruthTable::equal(tt1, tt2));
+
+    tt2.try_emplace(TruthTable::Cube::fromString("10"), TruthTable::Cube::fromString("10"));
+    ASSERT_FALSE(TruthTable::equal(tt1, tt2));
+}
+
+TEST(TruthTableTests, EqualityOfTruthTablesWithDifferentConstantLines) {
+    // the second truth table has an additional constant input line and garbage output line at the last position of its cubes
+    const auto tt1 = createCompleteTruthTable(2U, [](const std::uint64_t input) { return input ^ 0b01U; });
+    TruthTable tt2{};
+    for (std::uint64_t input = 0U; input < 4U; ++input) {
+        tt2.try_emplace(TruthTable::Cube::fromInteger(input << 1U, 3U), TruthTable::Cube::fromInteger(((input ^ 0b01U) << 1U) | 1U, 3U));
+    }
+    tt2.setConstants({true, false, false});
+    tt2.setGarbage({true, false, false});
+    ASSERT_TRUE(TruthTable::equal(tt1, tt2));
+
+    tt2.setGarbage({false, false, false});
+    ASSERT_FALSE(TruthTable::equal(tt1, tt2));
+}
+
+TEST(TruthTableTests, ParallelEqualityMatchesSequentialOne) {
+    const auto tt1 = createCompleteTruthTable(16U, [](const std::uint64_t input) { return (input * 3U) & 0xFFFFU; });
+    auto       tt2 = createCompleteTruthTable(16U, [](const std::uint64_t input) { return (input * 3U) & 0xFFFFU; });
+    ASSERT_TRUE(TruthTable::equal(tt1, tt2, true, 4U));
+
+    tt2[TruthTable::Cube::fromInteger(0xBEEFU, 16U)] = TruthTable::Cube::fromInteger(0U, 16U);
+    ASSERT_FALSE(TruthTable::equal(tt1, tt2, true, 1U));
+    ASSERT_FALSE(TruthTable::equal(tt1, tt2, true, 4U));
+
+    tt2.useDenseStorageIfComplete();
+    ASSERT_TRUE(tt2.hasDenseStorage());
+    ASSERT_FALSE(TruthTable::equal(tt1, tt2, true, 0U));
+}
+
+TEST(TruthTableTests, OutputHistogramCountsDistinctOutputsInAscendingOrder) {
+    auto tt = createCompleteTruthTable(3U, [](const std::uint64_t input) { return input == 0U ? 0b110U : input & 0b011U; });
+
+    const TruthTable::OutputHistogram expectedHistogram = {{TruthTable::Cube::fromInteger(0b000U, 3U), 1U}, {TruthTable::Cube::fromInteger(0b001U, 3U), 2U}, {TruthTable::Cube::fromInteger(0b010U, 3U), 2U}, {TruthTable::Cube::fromInteger(0b011U, 3U), 2U}, {TruthTable::Cube::fromInteger(0b110U, 3U), 1U}};
+    ASSERT_EQ(expectedHistogram, tt.outputHistogram());
+    ASSERT_EQ(1U, tt.minimumAdditionalLinesRequired());
+
+    // modifying an entry invalidates the cached histogram
+    tt[TruthTable::Cube::fromInteger(0b101U, 3U)] = TruthTable::Cube::fromInteger(0b011U, 3U);
+    tt[TruthTable::Cube::fromInteger(0b001U, 3U)] = TruthTable::Cube::fromInteger(0b011U, 3U);
+    ASSERT_EQ(4U, tt.outputHistogram().size());
+    ASSERT_EQ(2U, tt.minimumAdditionalLinesRequired());
+}
+
+TEST(TruthTableTests, OutputHistogramOfOutputsSpanningMultipleWords) {
+    TruthTable tt{};
+    const auto output = TruthTable::Cube::fromString(std::string(70U, '1') + "-");
+    for (std::uint64_t input = 0U; input < 1000U; ++input) {
+        auto distinctOutput = TruthTable::Cube::fromInteger(input, 64U);
+        distinctOutput.resize(71U, false);
+        tt.try_emplace(TruthTable::Cube::fromInteger(input, 10U), input % 10U == 0U ? output : distinctOutput);
+    }
+
+    const auto& histogram = tt.outputHistogram();
+    ASSERT_EQ(901U, histogram.size());
+    const auto it = std::ranges::find(histogram, output, [](const auto& entry) { return entry.first; });
+    ASSERT_NE(histogram.end(), it);
+    ASSERT_EQ(100U, it->second);
+    ASSERT_TRUE(std::ranges::is_sorted(histogram, std::less{}, [](const auto& entry) { return entry.first; }));
+}
+
+TEST(TruthTableTests, MappedTruthTableMatchesSavedOne) {
+    auto tt = createCompleteTruthTable(6U, [](const std::uint64_t input) { return (input * 5U) & 0x3FU; });
+    tt.setConstant(1U);
+    tt.setGarbage(4U);
+    ASSERT_TRUE(tt.useDenseStorageIfComplete());
+
+    const std::string filename = (std::filesystem::temp_directory_path() / "syrec_mapped_truth_table_test.bin").string();
+    ASSERT_TRUE(tt.save(filename));
+    const auto mappedTable = TruthTable::mapFile(filename);
+    ASSERT_TRUE(mappedTable.has_value());
+    ASSERT_EQ(tt.size(), mappedTable->size());
+    ASSERT_EQ(6U, mappedTable->nInputs());
+    ASSERT_EQ(6U, mappedTable->nOutputs());
+    ASSERT_EQ(tt.getConstants(), mappedTable->getConstants());
+    ASSERT_EQ(tt.getGarbage(), mappedTable->getGarbage());
+
+    auto ttIt = tt.begin();
+    for (const auto& entry: *mappedTable) {
+        ASSERT_EQ(ttIt->first, entry.input());
+        ASSERT_EQ(ttIt->second, entry.output());
+        ++ttIt;
+    }
+    ASSERT_EQ(tt.end(), ttIt);
+
+    const auto copiedTable = mappedTable->toTruthTable();
+    ASSERT_TRUE(copiedTable.hasDenseStorage());
+    ASSERT_TRUE(TruthTable::equal(tt, copiedTable, false));
+    ASSERT_EQ(tt.getConstants(), copiedTable.getConstants());
+    std::filesystem::remove(filename);
+}
+
+TEST(TruthTableTests, MappedTruthTableIsSearchedInPlace) {
+    TruthTable tt{};
+    const std::vector<std::string> inputs = {std::string(70U, '0'), std::string(69U, '0') + "-", std::string(64U, '1') + "01-00-", "-" + std::string(69U, '1'), std::string(70U, '1')};
+    for (std::size_t i = 0U; i < inputs.size(); ++i) {
+        tt.try_emplace(TruthTable::Cube::fromString(inputs[i]), TruthTable::Cube::fromInteger(i, 3U));
+    }
+
+    const std::string filename = (std::filesystem::temp_directory_path() / "syrec_searched_truth_table_test.bin").string();
+    ASSERT_TRUE(tt.save(filename));
+    const auto mappedTable = TruthTable::mapFile(filename);
+    ASSERT_TRUE(mappedTable.has_value());
+    ASSERT_TRUE(mappedTable->getConstants().empty());
+
+    for (const auto& [input, output]: tt) {
+        const std::optional<std::size_t> index = mappedTable->find(input);
+        ASSERT_TRUE(index.has_value()) << input.toString();
+        ASSERT_EQ(input, mappedTable->at(*index).input());
+        ASSERT_EQ(output, mappedTable->at(*index).output());
+    }
+    ASSERT_FALSE(mappedTable->find(TruthTable::Cube::fromString(std::string(69U, '1') + "0")).has_value());
+    ASSERT_FALSE(mappedTable->find(TruthTable::Cube::fromString(std::string(69U, '1'))).has_value());
+    std::filesystem::remove(filename);
+}
+
+TEST(TruthTableTests, MappingFileNotStoringTruthTableInBinaryFormatFails) {
+    const std::string filename = (std::filesystem::temp_directory_path() / "syrec_invalid_truth_table_test.bin").string();
+    {
+        std::ofstream os(filename);
+        os << ".i 2\n.o 2\n00 00\n01 01\n10 10\n11 11\n.e\n";
+    }
+    ASSERT_FALSE(TruthTable::mapFile(filename).has_value());
+    std::filesystem::remove(filename);
+    ASSERT_FALSE(TruthTable::mapFile(filename).has_value());
+}
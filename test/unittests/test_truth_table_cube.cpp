@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/truthTable/truth_table.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace syrec;
+
+TEST(TruthTableCubeTests, StringRoundTrip) {
+    const std::string stringifiedCube = "01-1-0";
+    const auto        cube            = TruthTable::Cube::fromString(stringifiedCube);
+    ASSERT_EQ(6U, cube.size());
+    ASSERT_EQ(stringifiedCube, cube.toString());
+    ASSERT_FALSE(cube[2].has_value());
+    ASSERT_TRUE(*cube[1]);
+    ASSERT_FALSE(cube.hasNoDontCares());
+}
+
+TEST(TruthTableCubeTests, IntegerRoundTrip) {
+    const auto cube = TruthTable::Cube::fromInteger(0b1101U, 4U);
+    ASSERT_EQ("1101", cube.toString());
+    ASSERT_EQ(0b1101U, cube.toInteger());
+    ASSERT_TRUE(cube.equals(0b1101U, 4U));
+
+    const auto widestCube = TruthTable::Cube::fromInteger(~static_cast<std::uint64_t>(0), 64U);
+    ASSERT_EQ(~static_cast<std::uint64_t>(0), widestCube.toInteger());
+}
+
+TEST(TruthTableCubeTests, OrderingMatchesOrderingOfOptionalValues) {
+    // don't care < 0 < 1 per position with a prefix being ordered before any extension of it
+    ASSERT_LT(TruthTable::Cube::fromString("-1"), TruthTable::Cube::fromString("0-"));
+    ASSERT_LT(TruthTable::Cube::fromString("0-"), TruthTable::Cube::fromString("00"));
+    ASSERT_LT(TruthTable::Cube::fromString("01"), TruthTable::Cube::fromString("1-"));
+    ASSERT_LT(TruthTable::Cube::fromString("01"), TruthTable::Cube::fromString("010"));
+    ASSERT_GT(TruthTable::Cube::fromString("1"), TruthTable::Cube::fromString("0111"));
+    ASSERT_FALSE(TruthTable::Cube::fromString("011") < TruthTable::Cube::fromString("011"));
+}
+
+TEST(TruthTableCubeTests, CubeSpanningMultipleWords) {
+    constexpr std::size_t cubeSize = 150U;
+    TruthTable::Cube      cube(cubeSize, false);
+    cube[0]   = true;
+    cube[64]  = TruthTable::Cube::Value();
+    cube[149] = true;
+    ASSERT_EQ(3U, cube.numWords());
+    ASSERT_TRUE(*cube[0]);
+    ASSERT_FALSE(cube[64].has_value());
+    ASSERT_TRUE(*cube[149]);
+
+    auto copiedCube = TruthTable::Cube::fromString(cube.toString());
+    ASSERT_EQ(cube, copiedCube);
+
+    // the first position of the cube is moved across the word boundaries
+    copiedCube.insertZero();
+    ASSERT_EQ(cubeSize + 1U, copiedCube.size());
+    ASSERT_EQ("0" + cube.toString(), copiedCube.toString());
+
+    copiedCube.resize(65U);
+    ASSERT_EQ(cube.toString().substr(0, 64), copiedCube.toString().substr(1));
+    copiedCube.pop_back();
+    ASSERT_EQ(1U, copiedCube.numWords());
+}
+
+TEST(TruthTableCubeTests, EqualityUpToDontCare) {
+    const auto cube         = TruthTable::Cube::fromString("0-1");
+    const auto matchingCube = TruthTable::Cube::fromString("001");
+    ASSERT_TRUE(TruthTable::Cube::checkCubeEquality(cube, matchingCube));
+    ASSERT_FALSE(TruthTable::Cube::checkCubeEquality(cube, matchingCube, false));
+    ASSERT_FALSE(TruthTable::Cube::checkCubeEquality(cube, TruthTable::Cube::fromString("0-0")));
+    ASSERT_FALSE(TruthTable::Cube::checkCubeEquality(cube, TruthTable::Cube::fromString("0-")));
+}
+
+TEST(TruthTableCubeTests, CompleteCubes) {
+    const auto completedCubes = TruthTable::Cube::fromString("-1-").completeCubes();
+    ASSERT_EQ(4U, completedCubes.size());
+    ASSERT_EQ("010", completedCubes[0].toString());
+    ASSERT_EQ("011", completedCubes[1].toString());
+    ASSERT_EQ("110", completedCubes[2].toString());
+    ASSERT_EQ("111", completedCubes[3].toString());
+}
+
+TEST(TruthTableCubeTests, LazyCompletions) {
+    const auto cube        = TruthTable::Cube::fromString("-1-0-");
+    const auto completions = cube.completions();
+    ASSERT_EQ(8U, completions.size());
+    ASSERT_EQ(3U, completions.numDontCares());
+
+    // the completions are enumerated in Gray code order, i.e. consecutive completions differ in exactly one position
+    TruthTable::Cube::Vector lazilyCompletedCubes;
+    for (const auto& completedCube: completions) {
+        if (!lazilyCompletedCubes.empty()) {
+            std::size_t numDifferingPositions = 0U;
+            for (std::size_t i = 0U; i < cube.size(); ++i) {
+                numDifferingPositions += lazilyCompletedCubes.back()[i] != completedCube[i] ? 1U : 0U;
+            }
+            ASSERT_EQ(1U, numDifferingPositions);
+        }
+        lazilyCompletedCubes.emplace_back(completedCube);
+    }
+    std::sort(lazilyCompletedCubes.begin(), lazilyCompletedCubes.end());
+    ASSERT_EQ(cube.completeCubes(), lazilyCompletedCubes);
+
+    const auto completeCube = TruthTable::Cube::fromString("101");
+    ASSERT_EQ(1U, completeCube.completions().size());
+    ASSERT_EQ(completeCube, *completeCube.completions().begin());
+}
+
+TEST(TruthTableCubeTests, ConstructFromIteratorRange) {
+    const auto             cube = TruthTable::Cube::fromString("10-1");
+    const TruthTable::Cube reducedCube(cube.begin() + 1, cube.end());
+    ASSERT_EQ("0-1", reducedCube.toString());
+}
+
+TEST(TruthTableCubeTests, FindMissingCubes) {
+    TruthTable::Cube::Set cubes;
+    for (const std::uint64_t value: {0U, 1U, 2U, 4U, 5U, 7U}) {
+        cubes.emplace(TruthTable::Cube::fromInteger(value, 3U));
+    }
+    // cubes with don't cares or a different size do not cover any fully specified cube of the size of the first cube
+    cubes.emplace(TruthTable::Cube::fromString("11-"));
+    cubes.emplace(TruthTable::Cube::fromString("0110"));
+
+    ASSERT_EQ(TruthTable::Cube::fromInteger(3U, 3U), TruthTable::Cube::findMissingCube(cubes));
+    const TruthTable::Cube::Vector expectedMissingCubes = {TruthTable::Cube::fromInteger(3U, 3U), TruthTable::Cube::fromInteger(6U, 3U)};
+    ASSERT_EQ(expectedMissingCubes, TruthTable::Cube::findMissingCubes(cubes, 5U));
+    ASSERT_EQ(1U, TruthTable::Cube::findMissingCubes(cubes, 1U).size());
+
+    for (const std::uint64_t value: {3U, 6U}) {
+        cubes.emplace(TruthTable::Cube::fromInteger(value, 3U));
+    }
+    ASSERT_TRUE(TruthTable::Cube::findMissingCube(cubes).empty());
+}
+
+TEST(TruthTableCubeTests, FindMissingCubesBeyondLargestPresentCube) {
+    TruthTable::Cube::Set cubes;
+    for (std::uint64_t value = 0U; value < 1000U; ++value) {
+        cubes.emplace(TruthTable::Cube::fromInteger(value, 12U));
+    }
+
+    const auto missingCubes = TruthTable::Cube::findMissingCubes(cubes, 3U);
+    ASSERT_EQ(3U, missingCubes.size());
+    for (std::size_t i = 0U; i < missingCubes.size(); ++i) {
+        ASSERT_EQ(1000U + i, missingCubes[i].toInteger());
+    }
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/encoding.hpp"
+#include "algorithms/synthesis/truth_table_pipeline.hpp"
+#include "core/io/pla_parser.hpp"
+#include "core/truthTable/truth_table.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace syrec;
+
+class TruthTablePipelineTest: public testing::TestWithParam<std::string> {
+protected:
+    TruthTable  tt{};
+    std::string testCircuitsDir = "./circuits/";
+
+    void SetUp() override {
+        // the truth table is parsed without being extended
+        std::ifstream plaFile(testCircuitsDir + GetParam() + ".pla");
+        ASSERT_TRUE(plaFile.good());
+        parsePla(tt, plaFile);
+    }
+
+    static void assertEqualTruthTables(const TruthTable& expected, const TruthTable& actual) {
+        ASSERT_EQ(expected, actual);
+        ASSERT_EQ(expected.getConstants(), actual.getConstants());
+        ASSERT_EQ(expected.getGarbage(), actual.getGarbage());
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(TruthTablePipelineTest, TruthTablePipelineTest,
+                         testing::Values("3_17_6",
+                                         "4gt5",
+                                         "4mod5",
+                                         "aludc",
+                                         "c17",
+                                         "dc2",
+                                         "dc3bit",
+                                         "decode24",
+                                         "extend",
+                                         "huff_1"));
+
+TEST_P(TruthTablePipelineTest, CompletionMatchesExtend) {
+    TruthTable extendedTt(tt);
+    extend(extendedTt);
+
+    const auto packedTt = TruthTablePipeline{}.completeDontCares().apply(tt);
+    ASSERT_TRUE(packedTt.has_value());
+    ASSERT_NO_FATAL_FAILURE(assertEqualTruthTables(extendedTt, packedTt->toTruthTable()));
+}
+
+TEST_P(TruthTablePipelineTest, AugmentationsMatchAugmentWithConstants) {
+    extend(tt);
+    const auto n           = tt.nInputs();
+    const auto m           = tt.nOutputs();
+    const auto totalNoBits = std::max(n, m + tt.minimumAdditionalLinesRequired());
+
+    // the augmentations of the one-pass synthesis
+    TruthTable         augmentedTt(tt);
+    TruthTablePipeline pipeline{};
+    if (m > n) {
+        augmentWithConstants(augmentedTt, m);
+        pipeline.augmentWithConstants(m);
+    }
+    augmentWithConstants(augmentedTt, totalNoBits, true);
+    pipeline.augmentWithConstants(totalNoBits, true);
+
+    const auto packedTt = pipeline.apply(tt);
+    ASSERT_TRUE(packedTt.has_value());
+    ASSERT_NO_FATAL_FAILURE(assertEqualTruthTables(augmentedTt, packedTt->toTruthTable()));
+}
+
+TEST_P(TruthTablePipelineTest, ChainedTransformationsMatchIndividualTransformations) {
+    TruthTable expectedTt(tt);
+    extend(expectedTt);
+    const auto codewords   = encodeWithAdditionalLine(expectedTt);
+    const auto totalNoBits = expectedTt.nOutputs() + 2U;
+    if (codewords.empty()) {
+        GTEST_SKIP() << "The function of the truth table is already reversible";
+    }
+
+    // the garbage lines are only updated by the encoding itself
+    tt.getGarbage() = expectedTt.getGarbage();
+    augmentWithConstants(expectedTt, totalNoBits);
+
+    const auto packedTt = TruthTablePipeline{}.completeDontCares().substituteOutputs(codewords).augmentWithConstants(totalNoBits).apply(tt);
+    ASSERT_TRUE(packedTt.has_value());
+    ASSERT_NO_FATAL_FAILURE(assertEqualTruthTables(expectedTt, packedTt->toTruthTable()));
+}
+
+TEST(TruthTablePipelineTests, InputsWithDontCaresAreNotPackedWithoutCompletion) {
+    TruthTable tt{};
+    tt.try_emplace(TruthTable::Cube::fromString("0-"), TruthTable::Cube::fromString("01"));
+    ASSERT_FALSE(TruthTablePipeline{}.apply(tt).has_value());
+    ASSERT_TRUE(TruthTablePipeline{}.completeDontCares().apply(tt).has_value());
+}
+
+TEST(TruthTablePipelineTests, OutputsWithoutCodewordAreNotPacked) {
+    TruthTable tt{};
+    tt.try_emplace(TruthTable::Cube::fromString("00"), TruthTable::Cube::fromString("01"));
+    tt.try_emplace(TruthTable::Cube::fromString("01"), TruthTable::Cube::fromString("10"));
+
+    const TruthTable::CubeMap codewords = {{TruthTable::Cube::fromString("01"), TruthTable::Cube::fromString("1")}};
+    ASSERT_FALSE(TruthTablePipeline{}.substituteOutputs(codewords).apply(tt).has_value());
+}
@@ -82,3 +82,29 @@ TEST_F(TruthTableDD, Toffoli) {
     const auto toffoli = qc::StandardOperation({1_pc, 2_pc}, 0, qc::X);
     EXPECT_TRUE(ttDD == dd::getDD(toffoli, *dd));
 }
+
+TEST_F(TruthTableDD, MemoizedToffoli) {
+    const std::string circToffoli = testCircuitsDir + "toffoli.pla";
+    EXPECT_TRUE(readPla(tt, circToffoli));
+
+    const auto ttDD = buildDDMemoized(tt, dd);
+    EXPECT_TRUE(ttDD == buildDD(tt, dd));
+
+    // Toffoli with target q0, control q1 and control q2
+    const auto toffoli = qc::StandardOperation({1_pc, 2_pc}, 0, qc::X);
+    EXPECT_TRUE(ttDD == dd::getDD(toffoli, *dd));
+}
+
+TEST_F(TruthTableDD, DontCareInputsAreExpandedSymbolically) {
+    tt.try_emplace(TruthTable::Cube::fromString("1--"), TruthTable::Cube::fromString("1-1"));
+    tt.try_emplace(TruthTable::Cube::fromString("0-1"), TruthTable::Cube::fromString("010"));
+
+    TruthTable completedTt{};
+    for (const auto& [input, output]: tt) {
+        for (const auto& completedInput: input.completions()) {
+            completedTt.try_emplace(completedInput, output);
+        }
+    }
+    EXPECT_EQ(completedTt.size(), 6U);
+    EXPECT_TRUE(buildDD(tt, dd) == buildDD(completedTt, dd));
+}
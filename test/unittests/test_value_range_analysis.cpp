@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/optimization/value_range_analysis.hpp"
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/configurable_options.hpp"
+#include "core/syrec/expression.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/number.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+#include "differential_verification_test_fixture.hpp"
+#include "syrec_ir_builder.hpp"
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+using namespace syrec_ir_builder;
+
+namespace {
+    class ValueRangeAnalysisTestsFixture: public DifferentialVerificationTestFixture {
+    protected:
+        Module::ptr   mainModule = std::make_shared<Module>("main");
+        Variable::ptr a          = std::make_shared<Variable>(Variable::Type::In, "a", std::vector<unsigned>({1U}), 6U);
+        Variable::ptr b          = std::make_shared<Variable>(Variable::Type::Inout, "b", std::vector<unsigned>({1U}), 6U);
+        Variable::ptr c          = std::make_shared<Variable>(Variable::Type::Out, "c", std::vector<unsigned>({1U}), 6U);
+        Variable::ptr d          = std::make_shared<Variable>(Variable::Type::Out, "d", std::vector<unsigned>({1U}), 1U);
+
+        void SetUp() override {
+            mainModule->addParameter(a);
+            mainModule->addParameter(b);
+            mainModule->addParameter(c);
+            mainModule->addParameter(d);
+            program.addModule(mainModule);
+        }
+
+        [[nodiscard]] static Expression::ptr createMaskedVariableExpression(const Variable::ptr& variable, const unsigned mask) {
+            return std::make_shared<BinaryExpression>(createVariableExpression(variable), BinaryExpression::BinaryOperation::BitwiseAnd, std::make_shared<NumericExpression>(std::make_shared<Number>(mask), variable->bitwidth));
+        }
+
+        void addAssignment(const Variable::ptr& assignedToVariable, const AssignStatement::AssignOperation assignOperation, const Expression::ptr& rhs) const {
+            mainModule->addStatement(std::make_shared<AssignStatement>(createVariableAccess(assignedToVariable), assignOperation, rhs));
+        }
+
+        static void assertNarrowingDoesNotChangeSimulationResult(const Program& programToVerify, const SynthesisAlgorithm synthesisAlgorithm) {
+            ConfigurableOptions settings;
+            settings.narrowOperationsUsingValueRangeAnalysis = true;
+            ASSERT_NO_FATAL_FAILURE(assertSynthesisDoesNotChangeSimulationResult(programToVerify, settings, synthesisAlgorithm));
+        }
+    };
+} // namespace
+
+TEST_F(ValueRangeAnalysisTestsFixture, RangeOfVariableAccessCoversAllValuesOfAccessedBits) {
+    ASSERT_EQ(std::make_optional(ValueRange{.minValue = 0U, .maxValue = 63U, .bitwidth = 6U}), determineValueRangeOfExpression(*createVariableExpression(a), {}));
+
+    const auto bitrangeAccess = std::make_shared<VariableExpression>(createVariableAccess(a, std::make_pair(std::make_shared<Number>(std::string("i")), std::make_shared<Number>(4U))));
+    ASSERT_EQ(std::make_optional(ValueRange{.minValue = 0U, .maxValue = 7U, .bitwidth = 3U}), determineValueRangeOfExpression(*bitrangeAccess, {{"i", 2U}}));
+    ASSERT_FALSE(determineValueRangeOfExpression(*bitrangeAccess, {}).has_value());
+}
+
+TEST_F(ValueRangeAnalysisTestsFixture, IntegerConstantIsTruncatedToExpectedBitwidth) {
+    const auto integerConstant = std::make_shared<NumericExpression>(std::make_shared<Number>(13U), 6U);
+    ASSERT_EQ(std::make_optional(ValueRange{.minValue = 13U, .maxValue = 13U, .bitwidth = 32U}), determineValueRangeOfExpression(*integerConstant, {}));
+    ASSERT_EQ(std::make_optional(ValueRange{.minValue = 5U, .maxValue = 5U, .bitwidth = 3U}), determineValueRangeOfExpression(*integerConstant, {}, 3U));
+
+    const auto loopVariable = std::make_shared<NumericExpression>(std::make_shared<Number>(std::string("i")), 6U);
+    ASSERT_EQ(std::make_optional(ValueRange{.minValue = 2U, .maxValue = 2U, .bitwidth = 6U}), determineValueRangeOfExpression(*loopVariable, {{"i", 2U}}, 6U));
+    ASSERT_FALSE(determineValueRangeOfExpression(*loopVariable, {}, 6U).has_value());
+}
+
+TEST_F(ValueRangeAnalysisTestsFixture, RangesOfArithmeticOperations) {
+    // (a & 3) + (b & 5) is at most 8 while (a & 3) + b could wrap around
+    ASSERT_EQ(std::make_optional(ValueRange{.minValue = 0U, .maxValue = 8U, .bitwidth = 6U}), determineValueRangeOfExpression(BinaryExpression(createMaskedVariableExpression(a, 3U), BinaryExpression::BinaryOperation::Add, createMaskedVariableExpression(b, 5U)), {}));
+    ASSERT_EQ(std::make_optional(ValueRange{.minValue = 0U, .maxValue = 63U, .bitwidth = 6U}), determineValueRangeOfExpression(BinaryExpression(createMaskedVariableExpression(a, 3U), BinaryExpression::BinaryOperation::Add, createVariableExpression(b)), {}));
+
+    // (a | 8) - (b & 7) is in the range [1, 63]
+    const auto lhsOfSubtraction = std::make_shared<BinaryExpression>(createVariableExpression(a), BinaryExpression::BinaryOperation::BitwiseOr, std::make_shared<NumericExpression>(std::make_shared<Number>(8U), 6U));
+    ASSERT_EQ(std::make_optional(ValueRange{.minValue = 1U, .maxValue = 63U, .bitwidth = 6U}), determineValueRangeOfExpression(BinaryExpression(lhsOfSubtraction, BinaryExpression::BinaryOperation::Subtract, createMaskedVariableExpression(b, 7U)), {}));
+
+    // (a & 7) * (b & 7) is at most 49, (a >> 3) / (b & 3) could divide by zero while (a >> 3) / (a | 8) is zero
+    ASSERT_EQ(std::make_optional(ValueRange{.minValue = 0U, .maxValue = 49U, .bitwidth = 6U}), determineValueRangeOfExpression(BinaryExpression(createMaskedVariableExpression(a, 7U), BinaryExpression::BinaryOperation::Multiply, createMaskedVariableExpression(b, 7U)), {}));
+    const auto shiftedOperand = std::make_shared<ShiftExpression>(createVariableExpression(a), ShiftExpression::ShiftOperation::Right, std::make_shared<Number>(3U));
+    ASSERT_EQ(std::make_optional(ValueRange{.minValue = 0U, .maxValue = 7U, .bitwidth = 6U}), determineValueRangeOfExpression(*shiftedOperand, {}));
+    ASSERT_EQ(std::make_optional(ValueRange{.minValue = 0U, .maxValue = 63U, .bitwidth = 6U}), determineValueRangeOfExpression(BinaryExpression(shiftedOperand, BinaryExpression::BinaryOperation::Divide, createMaskedVariableExpression(b, 3U)), {}));
+    ASSERT_EQ(std::make_optional(ValueRange{.minValue = 0U, .maxValue = 0U, .bitwidth = 6U}), determineValueRangeOfExpression(BinaryExpression(shiftedOperand, BinaryExpression::BinaryOperation::Divide, lhsOfSubtraction), {}));
+}
+
+TEST_F(ValueRangeAnalysisTestsFixture, TruthValueOfRelationalOperationIsDeterminedFromRangesOfOperands) {
+    // (a & 7) < (b | 8) always holds while (a & 7) < b does not
+    const auto lhsOperand = createMaskedVariableExpression(a, 7U);
+    const auto rhsOperand = std::make_shared<BinaryExpression>(createVariableExpression(b), BinaryExpression::BinaryOperation::BitwiseOr, std::make_shared<NumericExpression>(std::make_shared<Number>(8U), 6U));
+    ASSERT_EQ(std::make_optional(ValueRange{.minValue = 1U, .maxValue = 1U, .bitwidth = 1U}), determineValueRangeOfExpression(BinaryExpression(lhsOperand, BinaryExpression::BinaryOperation::LessThan, rhsOperand), {}));
+    ASSERT_EQ(std::make_optional(ValueRange{.minValue = 0U, .maxValue = 0U, .bitwidth = 1U}), determineValueRangeOfExpression(BinaryExpression(lhsOperand, BinaryExpression::BinaryOperation::Equals, rhsOperand), {}));
+    ASSERT_EQ(std::make_optional(ValueRange{.minValue = 0U, .maxValue = 0U, .bitwidth = 1U}), determineValueRangeOfExpression(BinaryExpression(lhsOperand, BinaryExpression::BinaryOperation::GreaterEquals, rhsOperand), {}));
+    ASSERT_EQ(std::make_optional(ValueRange{.minValue = 0U, .maxValue = 1U, .bitwidth = 1U}), determineValueRangeOfExpression(BinaryExpression(lhsOperand, BinaryExpression::BinaryOperation::LessThan, createVariableExpression(b)), {}));
+}
+
+TEST_F(ValueRangeAnalysisTestsFixture, NumberOfRequiredOperandBitsOfBinaryOperations) {
+    ASSERT_EQ(std::make_optional(4U), determineNumberOfOperandBitsRequiredByBinaryOperation(BinaryExpression(createMaskedVariableExpression(a, 3U), BinaryExpression::BinaryOperation::Add, createMaskedVariableExpression(b, 5U)), {}));
+    ASSERT_EQ(std::make_optional(2U), determineNumberOfOperandBitsRequiredByBinaryOperation(BinaryExpression(createMaskedVariableExpression(a, 3U), BinaryExpression::BinaryOperation::BitwiseAnd, createVariableExpression(b)), {}));
+    ASSERT_EQ(std::make_optional(3U), determineNumberOfOperandBitsRequiredByBinaryOperation(BinaryExpression(createMaskedVariableExpression(a, 7U), BinaryExpression::BinaryOperation::LessThan, createMaskedVariableExpression(b, 5U)), {}));
+    ASSERT_FALSE(determineNumberOfOperandBitsRequiredByBinaryOperation(BinaryExpression(createMaskedVariableExpression(a, 3U), BinaryExpression::BinaryOperation::Add, createVariableExpression(b)), {}).has_value());
+    ASSERT_FALSE(determineNumberOfOperandBitsRequiredByBinaryOperation(BinaryExpression(createMaskedVariableExpression(a, 7U), BinaryExpression::BinaryOperation::Modulo, createMaskedVariableExpression(b, 7U)), {}).has_value());
+    ASSERT_FALSE(determineNumberOfOperandBitsRequiredByBinaryOperation(BinaryExpression(createMaskedVariableExpression(a, 7U), BinaryExpression::BinaryOperation::Multiply, createMaskedVariableExpression(b, 15U)), {}).has_value());
+}
+
+TEST_F(ValueRangeAnalysisTestsFixture, NarrowedOperationsRequireFewerQuantumOperationsAndQubits) {
+    // c ^= ((a & 3) + (b & 5)); c += ((a >> 3) * (b & 7))
+    addAssignment(c, AssignStatement::AssignOperation::Exor, std::make_shared<BinaryExpression>(createMaskedVariableExpression(a, 3U), BinaryExpression::BinaryOperation::Add, createMaskedVariableExpression(b, 5U)));
+    addAssignment(c, AssignStatement::AssignOperation::Add, std::make_shared<BinaryExpression>(std::make_shared<ShiftExpression>(createVariableExpression(a), ShiftExpression::ShiftOperation::Right, std::make_shared<Number>(3U)), BinaryExpression::BinaryOperation::Multiply, createMaskedVariableExpression(b, 7U)));
+
+    AnnotatableQuantumComputation annotatableQuantumComputation;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(annotatableQuantumComputation, program));
+
+    ConfigurableOptions settings;
+    settings.narrowOperationsUsingValueRangeAnalysis = true;
+    AnnotatableQuantumComputation narrowedAnnotatableQuantumComputation;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(narrowedAnnotatableQuantumComputation, program, settings));
+    ASSERT_GT(annotatableQuantumComputation.getNops(), narrowedAnnotatableQuantumComputation.getNops());
+    ASSERT_GE(annotatableQuantumComputation.getNqubits(), narrowedAnnotatableQuantumComputation.getNqubits());
+}
+
+TEST_F(ValueRangeAnalysisTestsFixture, OperationWithResultKnownAtCompileTimeIsSynthesizedAsConstant) {
+    // d ^= ((a & 7) < (b | 8))
+    const auto rhsOperand = std::make_shared<BinaryExpression>(createVariableExpression(b), BinaryExpression::BinaryOperation::BitwiseOr, std::make_shared<NumericExpression>(std::make_shared<Number>(8U), 6U));
+    addAssignment(d, AssignStatement::AssignOperation::Exor, std::make_shared<BinaryExpression>(createMaskedVariableExpression(a, 7U), BinaryExpression::BinaryOperation::LessThan, rhsOperand));
+
+    ConfigurableOptions settings;
+    settings.narrowOperationsUsingValueRangeAnalysis = true;
+    AnnotatableQuantumComputation annotatableQuantumComputation;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(annotatableQuantumComputation, program, settings));
+    // The result of the relational operation is stored in a single ancillary qubit initialized to one by an X gate and copied to the assigned to qubit by a CNOT gate.
+    ASSERT_EQ(20U, annotatableQuantumComputation.getNqubits());
+    ASSERT_EQ(2U, annotatableQuantumComputation.getNops());
+}
+
+TEST_F(ValueRangeAnalysisTestsFixture, NarrowedOperationsDoNotChangeSimulationResult) {
+    // c ^= ((a & 3) + (b & 5)); c += ((a >> 3) * (b & 7)); b ^= ((a | 8) - (c & 7)); c -= ((a >> 3) / ((b & 7) | 2)); c ^= ((a >> 2) % ((b & 3) | 1)); c += ((a & 12) ^ (b & 5)); d ^= ((a & 7) <= (b & 3)); d ^= ((a & 7) != (c & 5))
+    addAssignment(c, AssignStatement::AssignOperation::Exor, std::make_shared<BinaryExpression>(createMaskedVariableExpression(a, 3U), BinaryExpression::BinaryOperation::Add, createMaskedVariableExpression(b, 5U)));
+    addAssignment(c, AssignStatement::AssignOperation::Add, std::make_shared<BinaryExpression>(std::make_shared<ShiftExpression>(createVariableExpression(a), ShiftExpression::ShiftOperation::Right, std::make_shared<Number>(3U)), BinaryExpression::BinaryOperation::Multiply, createMaskedVariableExpression(b, 7U)));
+    addAssignment(b, AssignStatement::AssignOperation::Exor, std::make_shared<BinaryExpression>(std::make_shared<BinaryExpression>(createVariableExpression(a), BinaryExpression::BinaryOperation::BitwiseOr, std::make_shared<NumericExpression>(std::make_shared<Number>(8U), 6U)), BinaryExpression::BinaryOperation::Subtract, createMaskedVariableExpression(c, 7U)));
+    addAssignment(c, AssignStatement::AssignOperation::Subtract, std::make_shared<BinaryExpression>(std::make_shared<ShiftExpression>(createVariableExpression(a), ShiftExpression::ShiftOperation::Right, std::make_shared<Number>(3U)), BinaryExpression::BinaryOperation::Divide, std::make_shared<BinaryExpression>(createMaskedVariableExpression(b, 7U), BinaryExpression::BinaryOperation::BitwiseOr, std::make_shared<NumericExpression>(std::make_shared<Number>(2U), 6U))));
+    addAssignment(c, AssignStatement::AssignOperation::Exor, std::make_shared<BinaryExpression>(std::make_shared<ShiftExpression>(createVariableExpression(a), ShiftExpression::ShiftOperation::Right, std::make_shared<Number>(2U)), BinaryExpression::BinaryOperation::Modulo, std::make_shared<BinaryExpression>(createMaskedVariableExpression(b, 3U), BinaryExpression::BinaryOperation::BitwiseOr, std::make_shared<NumericExpression>(std::make_shared<Number>(1U), 6U))));
+    addAssignment(c, AssignStatement::AssignOperation::Add, std::make_shared<BinaryExpression>(createMaskedVariableExpression(a, 12U), BinaryExpression::BinaryOperation::Exor, createMaskedVariableExpression(b, 5U)));
+    addAssignment(d, AssignStatement::AssignOperation::Exor, std::make_shared<BinaryExpression>(createMaskedVariableExpression(a, 7U), BinaryExpression::BinaryOperation::LessEquals, createMaskedVariableExpression(b, 3U)));
+    addAssignment(d, AssignStatement::AssignOperation::Exor, std::make_shared<BinaryExpression>(createMaskedVariableExpression(a, 7U), BinaryExpression::BinaryOperation::NotEquals, createMaskedVariableExpression(c, 5U)));
+
+    for (const SynthesisAlgorithm synthesisAlgorithm: {SynthesisAlgorithm::CostAware, SynthesisAlgorithm::LineAware, SynthesisAlgorithm::Hybrid}) {
+        assertNarrowingDoesNotChangeSimulationResult(program, synthesisAlgorithm);
+    }
+}